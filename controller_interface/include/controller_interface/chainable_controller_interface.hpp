@@ -15,6 +15,7 @@
 #ifndef CONTROLLER_INTERFACE__CHAINABLE_CONTROLLER_INTERFACE_HPP_
 #define CONTROLLER_INTERFACE__CHAINABLE_CONTROLLER_INTERFACE_HPP_
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -61,6 +62,10 @@ public:
 
   bool is_in_chained_mode() const final;
 
+  void assign_interfaces(
+    std::vector<hardware_interface::LoanedCommandInterface> && command_interfaces,
+    std::vector<hardware_interface::LoanedStateInterface> && state_interfaces) override;
+
 protected:
   /**
    * @brief Virtual method that each chainable controller should implement to export its read-only
@@ -159,6 +164,40 @@ protected:
   virtual return_type update_and_write_commands(
     const rclcpp::Time & time, const rclcpp::Duration & period) = 0;
 
+  /**
+   * @brief Virtual method that a chainable controller overrides to skip the updates whose inputs
+   * didn't change.
+   *
+   * In chained mode, the reference interfaces are written by the preceding controllers through
+   * their handles, which count the changes of their values, see
+   * hardware_interface::Handle::get_value_generation(). If the method returns true and neither the
+   * reference interfaces nor the state interfaces changed since the previous successful update,
+   * \ref update_with_unchanged_inputs is called instead of \ref update_and_write_commands. The
+   * commands of a pure controller, i.e., whose commands only depend on its references and states,
+   * then keep their values, and the following controllers of the chain see unchanged references
+   * in turn.
+   *
+   * @note The controller must not write its reference interfaces itself in chained mode, these
+   * writes aren't counted. The updates are never skipped when the controller isn't in chained mode
+   * or if the changes of one of its state interfaces aren't tracked, see
+   * hardware_interface::Handle::is_value_change_tracked().
+   *
+   * @returns false by default, every update calls \ref update_and_write_commands.
+   */
+  virtual bool track_input_changes() const;
+
+  /**
+   * @brief Update of the control steps whose inputs didn't change, see \ref track_input_changes.
+   * @note This method needs to be real-time safe and thread-safe to be called in the control loop.
+   *
+   * A controller whose commands also depend on the time, e.g., an integrator, can override it to
+   * take a cheaper path than \ref update_and_write_commands.
+   *
+   * @returns return_type::OK by default, without changing the commands.
+   */
+  virtual return_type update_with_unchanged_inputs(
+    const rclcpp::Time & time, const rclcpp::Duration & period);
+
   /**
    * @brief Storage of values for state interfaces
    */
@@ -183,6 +222,30 @@ protected:
     exported_reference_interfaces_;
 
 private:
+  /**
+   * @brief Enables the serial access of the exported interfaces of type double, if the controller
+   * isn't asynchronous and its `chained_interfaces_serial_access` parameter is set.
+   *
+   * The preceding and following controllers of a chain are updated one after the other by the same
+   * thread, so the exported reference and state interfaces are then read and written directly
+   * into their storage, without locking their handles.
+   */
+  template <typename InterfacePtrT>
+  void enable_serial_access(const std::vector<InterfacePtrT> & interfaces);
+
+  /// Value of the input generation when the inputs are considered changed at every update
+  static constexpr uint64_t UNTRACKED_INPUTS = std::numeric_limits<uint64_t>::max();
+
+  /**
+   * @brief Returns the sum of the generations of the reference and state interfaces, which only
+   * increases when one of their values changes, or UNTRACKED_INPUTS if a change of a state
+   * interface might not be counted.
+   */
+  uint64_t get_input_generation() const;
+
+  /// Input generation of the previous successful update, see track_input_changes()
+  uint64_t last_input_generation_ = UNTRACKED_INPUTS;
+
   /**
    * @brief A flag marking if a chainable controller is currently preceded by another controller.
    */
@@ -15,7 +15,10 @@
 #ifndef CONTROLLER_INTERFACE__CONTROLLER_INTERFACE_BASE_HPP_
 #define CONTROLLER_INTERFACE__CONTROLLER_INTERFACE_BASE_HPP_
 
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -24,10 +27,14 @@
 #include "realtime_tools/async_function_handler.hpp"
 
 #include "controller_interface/controller_interface_params.hpp"
+#include "hardware_interface/cycle_context.hpp"
+#include "hardware_interface/edge_event_queue.hpp"
 #include "hardware_interface/handle.hpp"
 #include "hardware_interface/introspection.hpp"
 #include "hardware_interface/loaned_command_interface.hpp"
 #include "hardware_interface/loaned_state_interface.hpp"
+#include "hardware_interface/performance_counters.hpp"
+#include "hardware_interface/thread_times.hpp"
 
 #include "lifecycle_msgs/msg/state.hpp"
 #include "pal_statistics/pal_statistics_utils.hpp"
@@ -74,16 +81,56 @@ struct InterfaceConfiguration
   std::vector<std::string> names = {};
 };
 
+/**
+ * @brief Values of the loaned interfaces exchanged between an asynchronous controller and the
+ * control loop, see ControllerInterfaceBase::get_state_frame().
+ */
+struct InterfaceFrame
+{
+  /// Time of the control loop cycle that sampled the states, or of the update of the commands.
+  rclcpp::Time time;
+  /// Count of the control loop cycles that sampled the states, 0 before the first one.
+  uint64_t cycle = 0;
+  /// Values in the order of the loaned interfaces, NaN for the interfaces not readable as double,
+  /// see hardware_interface::Handle::is_double_readable().
+  std::vector<double> values;
+};
+
+/**
+ * @brief Values of the loaned state interfaces sampled in one call, with the stamps of the reads
+ * of their hardware components, see ControllerInterfaceBase::read_state_interfaces_frame().
+ */
+struct StateInterfacesFrame
+{
+  /// Values in the order of the loaned state interfaces, NaN for the interfaces not readable as
+  /// double, see hardware_interface::Handle::is_double_readable().
+  std::vector<double> values;
+  /// Time and cycle of the read of the hardware component each value comes from.
+  std::vector<hardware_interface::ReadStampData> stamps;
+};
+
 struct ControllerUpdateStats
 {
   void reset()
   {
     total_triggers = 0;
     failed_triggers = 0;
+    stale_state_triggers = 0;
+    missed_join_deadlines = 0;
+    idle_triggers = 0;
+    sequential_parallel_loops = 0;
   }
 
   unsigned int total_triggers;
   unsigned int failed_triggers;
+  /// Triggers whose oldest state exceeded the `state_staleness.max_age` parameter.
+  unsigned int stale_state_triggers;
+  /// Joined updates that didn't finish within the `async_parameters.join_deadline` parameter.
+  unsigned int missed_join_deadlines;
+  /// Triggers skipped because none of the `event_trigger.interfaces` parameter was updated.
+  unsigned int idle_triggers;
+  /// Calls of parallel_for() executed by the updating thread alone, since the pool was busy.
+  unsigned int sequential_parallel_loops;
 };
 
 /**
@@ -94,14 +141,34 @@ struct ControllerUpdateStats
  * @var successful: true if the update was triggered successfully, false if not.
  * @var result: return_type::OK if update is successfully, otherwise return_type::ERROR.
  * @var execution_time: duration of the execution of the update method.
+ * @var thread_times: CPU time and context switches of the thread during the update method, only
+ * set for the synchronous controllers if the hardware_interface::ThreadTimes sampling is enabled.
+ * @var performance_counters: hardware performance counters of the thread during the update
+ * method, only set for the synchronous controllers if the hardware_interface::PerformanceCounters
+ * sampling is enabled.
  * @var period: period of the update method.
+ * @var stage_time: duration of the exchange of the interface frames in the control loop, i.e., the
+ * staging of the states and the fetching of the commands, only set for the asynchronous
+ * controllers using interface frames.
+ * @var command_latency: time from the sampling of the states to the commit of the commands
+ * computed from them, only set when the control loop commits a new command frame of an
+ * asynchronous controller using interface frames.
+ * @var parallel_time: wall time of the calls of parallel_for() within the update method, only set
+ * for the synchronous controllers calling it.
+ * @var parallel_task_time: execution time of the longest task of these calls.
  */
 struct ControllerUpdateStatus
 {
   bool successful = true;
   return_type result = return_type::OK;
   std::optional<std::chrono::nanoseconds> execution_time = std::nullopt;
+  std::optional<hardware_interface::ThreadTimes> thread_times = std::nullopt;
+  std::optional<hardware_interface::PerformanceCounters> performance_counters = std::nullopt;
   std::optional<rclcpp::Duration> period = std::nullopt;
+  std::optional<std::chrono::nanoseconds> stage_time = std::nullopt;
+  std::optional<rclcpp::Duration> command_latency = std::nullopt;
+  std::optional<std::chrono::nanoseconds> parallel_time = std::nullopt;
+  std::optional<std::chrono::nanoseconds> parallel_task_time = std::nullopt;
 };
 
 /**
@@ -165,10 +232,38 @@ public:
   /**
    * @brief Method that releases the Loaned interfaces from the controller.
    *
-   * Method used by the controller_manager to release the interfaces from the controller.
+   * Method used by the controller_manager to release the interfaces from the controller. If an
+   * asynchronous update is still running, e.g., when the controller is deactivated by the control
+   * loop after an error, the method doesn't wait for it: the write gate of the loaned command
+   * interfaces is closed, see hardware_interface::LoanWriteGate, and their claims are released at
+   * once, or by release_revoked_interfaces() if the update was writing a command meanwhile. The
+   * loans are destroyed when the controller is assigned new interfaces, by
+   * release_revoked_interfaces() or when its update is stopped.
    */
   virtual void release_interfaces();
 
+  /**
+   * @brief Method that destroys the loans revoked by release_interfaces() once the running
+   * asynchronous update finished, releasing the claims that are still held.
+   *
+   * Called by the controller_manager before every switch, the method does nothing if the loans
+   * weren't revoked.
+   *
+   * @note **The method is not real-time safe and shouldn't be called in the control loop.**
+   */
+  void release_revoked_interfaces();
+
+  /**
+   * @brief Method that hands the loaned command interfaces of the controller over.
+   *
+   * Method used by the controller_manager when the controller is replaced in a controller swap,
+   * see @ref on_handover(). The command interfaces stay claimed and are moved to the controller
+   * replacing this one, the controller_manager calls @ref release_interfaces() afterwards.
+   *
+   * @returns the loaned command interfaces, in the order of @ref command_interfaces_.
+   */
+  std::vector<hardware_interface::LoanedCommandInterface> take_command_interfaces();
+
   [[deprecated(
     "Use the init(const controller_interface::ControllerInterfaceParams & params) method instead. "
     "This method will be removed in the future ROS 2 releases.")]]
@@ -201,6 +296,63 @@ public:
    */
   virtual return_type update(const rclcpp::Time & time, const rclcpp::Duration & period) = 0;
 
+  /**
+   * @brief Take over the internal state of the controller replaced by this one in a swap.
+   *
+   * Called by the controller_manager in the control loop when this controller replaces
+   * \p previous_controller in a controller swap, after this controller is activated and before its
+   * first update. The previous controller is inactive but keeps its internal state, e.g., an
+   * integrator or the active trajectory, which the override can copy after casting
+   * \p previous_controller to its known type. The default implementation takes nothing over.
+   * @note This method needs to be real-time safe to be called in the control loop.
+   *
+   * @param[in] previous_controller The controller replaced by this one.
+   * @returns return_type::OK if the state is taken over or there is nothing to take over,
+   * otherwise return_type::ERROR, which is reported but keeps this controller active.
+   */
+  virtual return_type on_handover(const ControllerInterfaceBase & previous_controller);
+
+  /**
+   * @brief Prepare the activation of the controller outside of the control loop.
+   *
+   * Called by the controller_manager in the thread requesting a switch that activates this
+   * controller, before the switch is performed in the control loop, where @ref on_activate() is
+   * called. The override moves the preparations of the activation that aren't real-time safe here,
+   * e.g., reading parameters, resizing buffers or building lookup tables, so that on_activate()
+   * only binds the loaned interfaces and latches their states within the control cycle. The
+   * interfaces are not assigned yet. The default implementation prepares nothing.
+   * @note The method may be called by several switch requests before an activation, e.g., if a
+   * prepared switch is cancelled, and while the controller is still active if it is restarted.
+   *
+   * @returns return_type::OK if the controller can be activated, otherwise return_type::ERROR,
+   * which rejects the switch.
+   */
+  virtual return_type on_prepare_activate();
+
+  /**
+   * @brief Prepare the inactive controller to run its update() in shadow mode.
+   *
+   * Called by the controller_manager when the shadow mode of this inactive controller starts, after
+   * the state interfaces and detached copies of the command interfaces are assigned. The
+   * controller_manager then triggers the update() of the controller in the control loop for a
+   * number of cycles, so that its first updates after the activation run with warm caches and
+   * their execution time is known beforehand. The commands written in shadow mode never reach the
+   * hardware. The override prepares the update() as @ref on_activate() would, the default
+   * implementation returns return_type::ERROR, as the controllers don't support the shadow mode
+   * unless they opt in.
+   *
+   * @returns return_type::OK if the controller can run in shadow mode, otherwise
+   * return_type::ERROR.
+   */
+  virtual return_type on_shadow_activate();
+
+  /**
+   * @brief Clean up after the shadow mode of the controller, before its interfaces are released.
+   *
+   * The controller stays inactive, the default implementation does nothing.
+   */
+  virtual void on_shadow_deactivate();
+
   /**
    * @brief Trigger update method. This method is used by the controller_manager to trigger the
    * update method of the controller. The method is used to trigger the update method of the
@@ -214,6 +366,61 @@ public:
    */
   ControllerUpdateStatus trigger_update(const rclcpp::Time & time, const rclcpp::Duration & period);
 
+  /**
+   * @brief Trigger update method with the context of the control cycle.
+   *
+   * Like trigger_update(const rclcpp::Time &, const rclcpp::Duration &), with the ROS time of the
+   * cycle, and the update can access the context with get_cycle_context().
+   * @note This method needs to be real-time safe and thread-safe to be called in the control loop.
+   *
+   * @param[in] cycle The context of this control loop iteration
+   * @param[in] period The period of the controller, which differs from the period of the cycle when
+   * the controller runs at a lower rate
+   */
+  ControllerUpdateStatus trigger_update(
+    const hardware_interface::CycleContext & cycle, const rclcpp::Duration & period);
+
+  /**
+   * @brief Get the context of the control cycle of the update.
+   *
+   * The context has the times, the number and the deadline of the cycle triggering the update,
+   * e.g., to shorten an optimization once the deadline is close. The sub-steps of an update share
+   * the context of their trigger, and an asynchronous update has the context of the latest
+   * trigger when it started.
+   * @note This method is real-time safe, it has to be called from the update.
+   *
+   * @returns the context of the cycle, the default context if the controller manager doesn't pass
+   * it.
+   */
+  const hardware_interface::CycleContext & get_cycle_context() const;
+
+  /**
+   * @brief Waits for the asynchronous update triggered in this cycle and commits its commands.
+   *
+   * Only used for the asynchronous controllers using interface frames with a positive
+   * `async_parameters.join_deadline` parameter, see is_async_update_joined(). The controller
+   * manager calls it after the updates of all the controllers, before enforcing the command limits
+   * and writing the hardware, so that the commands computed from the states of a cycle are written
+   * in the same cycle. If the update doesn't finish within the deadline after its trigger, the
+   * command interfaces keep their previous commands and the late commands are committed at the
+   * next trigger.
+   * @note This method is real-time safe. It spins until the update finishes or the deadline
+   * expires, so the asynchronous update has to run on another CPU core than the control loop.
+   *
+   * @returns false if the deadline was missed, true otherwise, also if no update was triggered in
+   * this cycle.
+   */
+  bool join_async_update();
+
+  /// Returns true if the control loop joins the asynchronous update, see join_async_update().
+  bool is_async_update_joined() const;
+
+  /// Returns true if an asynchronous update of the controller is running.
+  /**
+   * @note This method is real-time safe.
+   */
+  bool is_async_update_running() const;
+
   std::shared_ptr<rclcpp_lifecycle::LifecycleNode> get_node();
 
   std::shared_ptr<const rclcpp_lifecycle::LifecycleNode> get_node() const;
@@ -241,19 +448,58 @@ public:
 
   bool is_async() const;
 
+  /// Returns the number of updates of the controller per trigger, set by the `sub_steps` parameter.
+  /**
+   * With more than one sub-step, every trigger of the controller calls update() that many times
+   * with the period divided evenly among them, the time of the sub-step k being the time of the
+   * trigger plus k sub-step periods. An inner loop, e.g., a current controller, runs then at a
+   * multiple of the update rate without the reads and writes of the hardware of the whole control
+   * loop. The sub-steps stop at the first update not returning return_type::OK, and the measured
+   * execution time of the trigger covers all of them. The asynchronous controllers have a single
+   * sub-step.
+   */
+  unsigned int get_sub_steps() const;
+
   const std::string & get_robot_description() const;
 
   /**
    * @brief Get the unordered map of joint limits that are defined in the robot description.
+   *
+   * @note If the limits are shared through the joint limits store, they are copied from it at the
+   * first call of this method or of get_soft_joint_limits. Use get_joint_limits_store to access
+   * them without a copy and to follow their updates.
    */
   const std::unordered_map<std::string, joint_limits::JointLimits> & get_hard_joint_limits() const;
 
   /**
    * @brief Get the unordered map of soft joint limits that are defined in the robot description.
+   *
+   * @note See get_hard_joint_limits.
    */
   const std::unordered_map<std::string, joint_limits::SoftJointLimits> & get_soft_joint_limits()
     const;
 
+  /**
+   * @brief Get the store of the joint limits shared by the resource manager and the controllers.
+   *
+   * Its snapshots are read in real-time safe way, e.g., in update, with
+   * hardware_interface::JointLimitsStore::read.
+   *
+   * @return the store of the joint limits, nullptr if the controller was initialized without it.
+   */
+  std::shared_ptr<const hardware_interface::JointLimitsStore> get_joint_limits_store() const;
+
+  /**
+   * @brief Get the memory resource the controller allocates its buffers from.
+   *
+   * If the controller manager is configured with memory arenas, the resource is pre-faulted and
+   * locked memory, so that the buffers allocated from it, e.g., std::pmr::vector members created
+   * in on_configure or on_activate, don't page-fault in the first updates.
+   *
+   * @return the memory resource of the controller, the default resource if there is no arena.
+   */
+  std::pmr::memory_resource * get_memory_resource() const;
+
   /**
    * @brief Method used by the controller_manager for base NodeOptions to instantiate the Lifecycle
    * node of the controller upon loading the controller.
@@ -417,7 +663,213 @@ protected:
    */
   std::vector<hardware_interface::LoanedStateInterface> state_interfaces_;
 
+  /**
+   * @brief Check if the asynchronous update exchanges the interface values through frames.
+   *
+   * Enabled with the `async_parameters.use_interface_frames` parameter of an asynchronous
+   * controller. The control loop then samples the values of all the state interfaces into a frame
+   * when it triggers the update, and commits the values of the command frame, published after the
+   * last finished update, to the command interfaces. The frames are exchanged without locks, so
+   * the update reads the states of a single cycle and never competes with the control loop for
+   * the interfaces.
+   */
+  bool uses_interface_frames() const;
+
+  /**
+   * @brief Get the states sampled by the control loop for the running asynchronous update.
+   * @note Only valid in the update of an asynchronous controller using interface frames. The
+   * values are in the order of @ref state_interfaces_.
+   */
+  const InterfaceFrame & get_state_frame() const;
+
+  /**
+   * @brief Get the commands committed by the control loop after the running asynchronous update.
+   * @note Only valid in the update of an asynchronous controller using interface frames. The
+   * values are in the order of @ref command_interfaces_ and are kept between the updates. They are
+   * initialized with the values of the command interfaces at the activation.
+   */
+  InterfaceFrame & get_command_frame();
+
+  /**
+   * @brief Samples the values of all the loaned state interfaces into a contiguous frame.
+   *
+   * Every value is stamped with the time and cycle of the read of the hardware component it comes
+   * from, and is sampled again if the component was read meanwhile, so that the value and its
+   * stamp belong to the same read. The stamps tell the age of the values, e.g., of the components
+   * running asynchronously or at a lower rate, for a latency compensation.
+   *
+   * \param[out] frame values and stamps in the order of @ref state_interfaces_. The vectors are
+   * only resized if the number of interfaces changed, so a frame reused in every update doesn't
+   * allocate memory.
+   * \returns true if all the values readable as double are sampled, false if some of them
+   * couldn't be accessed and kept their previous value.
+   */
+  bool read_state_interfaces_frame(StateInterfacesFrame & frame) const;
+
+  /**
+   * @brief Get the age of the oldest loaned state at the last trigger of the update.
+   *
+   * The age is the time since the read of the hardware component the state comes from, see
+   * hardware_interface::LoanedStateInterface::get_read_stamp(), and is only measured if the
+   * `state_staleness.max_age` parameter is set. The states older than this age are stale, e.g.,
+   * those of an asynchronous component whose read is still running. The
+   * `state_staleness.policy` parameter decides whether the update is still called with the stale
+   * states, `use`, and can compensate their age, e.g., extrapolate them, or skipped, `skip`.
+   *
+   * @returns the age of the oldest state, zero if the age isn't measured.
+   */
+  rclcpp::Duration get_state_age() const;
+
+  /**
+   * @brief Check if the update is only called when one of its trigger interfaces was updated.
+   *
+   * The trigger interfaces are the loaned state interfaces listed in the
+   * `event_trigger.interfaces` parameter, e.g., of a sensor publishing at a lower rate than the
+   * controller manager. A trigger skips the update until one of them was read again from its
+   * hardware component since the previous update, or changed its value for the interfaces not read
+   * from a hardware component, e.g., of a chained controller. The `event_trigger.max_age`
+   * parameter, if set, still calls the update when no trigger interface was updated for this long.
+   * The period passed to the update is the time since the previous update.
+   *
+   * @returns true if the trigger interfaces were found in the loaned state interfaces at the
+   * activation.
+   */
+  bool is_event_driven() const;
+
+  /**
+   * @brief Get the edge events of the boolean state interfaces pushed by the hardware components.
+   *
+   * The list holds the events collected by the last read of the resource manager, e.g., of the
+   * buttons, limit switches or e-stop chains of the GPIO inputs, with the time stamp of the change
+   * from the hardware, see hardware_interface::HardwareComponentInterface::push_edge_event(). A
+   * controller processes the changes of its inputs in O(events) instead of polling all of them,
+   * and finds their loaned state interface with get_edge_event_state_index().
+   *
+   * @returns the events of the cycle of all the components, empty for the asynchronous
+   * controllers, since the list is filled again at the next read.
+   * @note This method is real-time safe, the list is only valid within the update.
+   */
+  const hardware_interface::EdgeEventList & get_edge_events() const;
+
+  /**
+   * @brief Get the index of the state interface of an edge event in @ref state_interfaces_.
+   *
+   * @returns the index of the interface, or the size of @ref state_interfaces_ if the interface
+   * isn't loaned by the controller.
+   * @note This method is real-time safe, the indices are cached at the activation.
+   */
+  std::size_t get_edge_event_state_index(const hardware_interface::EdgeEvent & event) const;
+
+  /**
+   * @brief Executes task(i) for every i in [0, number_of_tasks) in parallel within the update.
+   *
+   * The tasks run on the worker threads of the `controller_worker_pool` of the controller manager,
+   * pinned and with a real-time priority, and on the calling thread, and the method returns once
+   * all of them are finished, e.g., to compute the legs of a walking robot on the spare cores.
+   * Without a pool, or while the pool runs the tasks of another controller updated in parallel,
+   * the tasks are executed in sequence by the calling thread. The wall time of the calls and the
+   * execution time of their longest task are published in the statistics of the controller.
+   *
+   * If a task throws, the remaining tasks are still executed and the first exception is rethrown.
+   *
+   * \note This method is real-time safe if the tasks are, it doesn't allocate memory. The tasks
+   * run concurrently, so they must not write unprotected shared state, e.g., the same interface.
+   */
+  void parallel_for(std::size_t number_of_tasks, const std::function<void(std::size_t)> & task);
+
+  /**
+   * @brief Executes all the tasks of a group in parallel within the update, see parallel_for().
+   *
+   * \param[in] tasks the tasks, created before the activation so that the update doesn't allocate.
+   */
+  void run_task_group(const std::vector<std::function<void()>> & tasks);
+
+  /**
+   * @brief Reads the values of all the loaned state interfaces in one call.
+   *
+   * The data types of the interfaces are checked once at the activation, so every value is read
+   * in a single non-blocking try, without the type checks, retries and access statistics of
+   * hardware_interface::LoanedStateInterface::get_optional().
+   *
+   * \param[out] values values in the order of @ref state_interfaces_. The vector is only resized
+   * if the number of interfaces changed. The values of the interfaces not readable as double,
+   * see hardware_interface::Handle::is_double_readable(), and of the interfaces that couldn't be
+   * accessed are left unchanged.
+   * \returns true if all the interfaces readable as double are read, false otherwise.
+   */
+  bool read_states(std::vector<double> & values) const;
+
+  /**
+   * @brief Writes the values of all the loaned command interfaces in one call.
+   *
+   * The data types of the interfaces are checked once at the activation, so every value is
+   * passed through the command limiter and written in a single non-blocking try, without the type
+   * checks, retries and access statistics of
+   * hardware_interface::LoanedCommandInterface::set_value().
+   *
+   * \param[in] values values in the order of @ref command_interfaces_. The values of the
+   * interfaces not of type double are ignored.
+   * \returns true if all the interfaces of type double are written, false if the number of values
+   * doesn't match the number of interfaces or if some interfaces couldn't be accessed.
+   */
+  bool write_commands(const std::vector<double> & values);
+
 private:
+  /**
+   * @brief Update called by the asynchronous thread, taking the state frame before the update and
+   * publishing the command frame after it.
+   */
+  return_type async_update(const rclcpp::Time & time, const rclcpp::Duration & period);
+
+  /**
+   * @brief Commits the latest command frame and publishes a new state frame, called by the
+   * control loop before triggering the asynchronous update.
+   *
+   * \returns the time from the sampling of the states to the commit of the commands computed
+   * from them, std::nullopt if no new command frame was committed.
+   */
+  std::optional<rclcpp::Duration> exchange_interface_frames(const rclcpp::Time & time);
+
+  /**
+   * @brief Writes the command frame published after the last finished update to the command
+   * interfaces, if it wasn't committed yet.
+   *
+   * \returns true if a new command frame was committed.
+   */
+  bool commit_command_frame();
+
+  /**
+   * @brief Sizes the frames for the assigned interfaces, called before the activation.
+   */
+  void prepare_interface_frames();
+
+  /**
+   * @brief Caches which loaned interfaces are of type double for the bulk accessors, called
+   * before the activation.
+   */
+  void cache_interface_data_types();
+
+  /**
+   * @brief Finds the trigger interfaces in the loaned state interfaces, called before the
+   * activation.
+   *
+   * \returns false if a trigger interface is not loaned by the controller.
+   */
+  bool resolve_trigger_interfaces();
+
+  /**
+   * @brief Remembers the last update of every trigger interface.
+   *
+   * \returns true if a trigger interface was updated since the previous call.
+   */
+  bool consume_trigger_interface_updates();
+
+  /**
+   * @brief Caches the indices of the loaned state interfaces by the ids of their names for
+   * get_edge_event_state_index(), called before the activation.
+   */
+  void index_edge_event_interfaces();
+
   /**
    * @brief Method to stop the async handler thread. This method is called before the controller
    * cleanup, error and shutdown lifecycle transitions.
@@ -428,7 +880,7 @@ private:
   std::unique_ptr<ControllerInterfaceBaseImpl> impl_;
 
 protected:
-  pal_statistics::RegistrationsRAII stats_registrations_;
+  hardware_interface::IntrospectionRegistrations stats_registrations_;
 };
 
 using ControllerInterfaceBaseSharedPtr = std::shared_ptr<ControllerInterfaceBase>;
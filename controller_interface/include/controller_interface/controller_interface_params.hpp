@@ -15,9 +15,16 @@
 #ifndef CONTROLLER_INTERFACE__CONTROLLER_INTERFACE_PARAMS_HPP_
 #define CONTROLLER_INTERFACE__CONTROLLER_INTERFACE_PARAMS_HPP_
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
+#include "hardware_interface/async_worker_pool.hpp"
+#include "hardware_interface/edge_event_queue.hpp"
+#include "hardware_interface/joint_limits_store.hpp"
+#include "hardware_interface/memory_arena.hpp"
+#include "hardware_interface/rt_worker_pool.hpp"
 #include "joint_limits/joint_limits.hpp"
 #include "rclcpp/node_options.hpp"
 
@@ -27,11 +34,24 @@
  *
  * @var controller_name Name of the controller.
  * @var robot_description The URDF or SDF description of the robot.
+ * @var shared_robot_description Robot description shared by the controllers, used instead of
+ * robot_description if not nullptr so that it isn't copied for every controller.
  * @var cm_update_rate The update rate of the controller manager in Hz.
  * @var node_namespace The namespace for the controller node.
  * @var node_options Options for the controller node.
  * @var joint_limits A map of joint names to their limits.
  * @var soft_joint_limits A map of joint names to their soft limits.
+ * @var joint_limits_store Store of the limits of the resource manager, shared by the controllers,
+ * from which the limits are read if the maps above are empty.
+ * @var edge_events Edge events of the hardware components collected in every read cycle by the
+ * resource manager, see ControllerInterfaceBase::get_edge_events().
+ * @var async_worker_pool Pool running the updates of the asynchronous controllers, if not nullptr.
+ * @var worker_pool Pool executing the tasks of ControllerInterfaceBase::parallel_for() within the
+ * updates, shared by the controllers, if not nullptr.
+ * @var memory_arena Pre-faulted and locked memory the controller allocates its buffers from, if
+ * not nullptr.
+ * @var thread_stack_prefault_size Bytes of the stack of the asynchronous thread of the controller
+ * prefaulted at its first update, see hardware_interface::RealtimeThreadParams.
  *
  * This struct is used to pass parameters to the controller interface during initialization.
  * It allows for easy configuration of the controller's behavior and interaction with the robot's
@@ -46,6 +66,7 @@ struct ControllerInterfaceParams
 
   std::string controller_name = "";
   std::string robot_description = "";
+  std::shared_ptr<const std::string> shared_robot_description = nullptr;
   unsigned int update_rate = 0;
   unsigned int controller_manager_update_rate = 0;
 
@@ -54,6 +75,17 @@ struct ControllerInterfaceParams
 
   std::unordered_map<std::string, joint_limits::JointLimits> hard_joint_limits = {};
   std::unordered_map<std::string, joint_limits::SoftJointLimits> soft_joint_limits = {};
+  std::shared_ptr<const hardware_interface::JointLimitsStore> joint_limits_store = nullptr;
+
+  std::shared_ptr<const hardware_interface::EdgeEventList> edge_events = nullptr;
+
+  std::shared_ptr<hardware_interface::AsyncWorkerPool> async_worker_pool = nullptr;
+
+  std::shared_ptr<hardware_interface::RTWorkerPool> worker_pool = nullptr;
+
+  std::shared_ptr<hardware_interface::MemoryArena> memory_arena = nullptr;
+
+  std::size_t thread_stack_prefault_size = 0;
 };
 
 }  // namespace controller_interface
@@ -20,6 +20,8 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 // Add hardware interface helpers here, so all inherited controllers can use them
@@ -27,19 +29,42 @@
 
 namespace controller_interface
 {
+/// Hash index of loaned interfaces by their full name, see build_interface_index().
+template <typename T>
+using InterfaceIndex = std::unordered_multimap<std::string_view, std::reference_wrapper<T>>;
+
 /**
- * @brief Reorder interfaces with references according to joint names or full interface names.
+ * @brief Build a hash index of the interfaces by their full name.
  *
- * Method to reorder and check if all expected interfaces are provided for the joint.
- * Fill `ordered_interfaces` with references from `unordered_interfaces` in the same order as in
- * `ordered_names`.
+ * The index references the names and the interfaces in @p unordered_interfaces, therefore it is
+ * valid only as long as the vector is not modified.
  *
  * @param[in] unordered_interfaces vector with loaned unordered state or command interfaces.
- * @param[in] ordered_names vector with ordered names to order @p unordered_interfaces.
- *  The valued inputs are list of joint names or interface full names.
- *  If joint names are used for ordering, @p interface_type specifies valid interface.
- *  If full interface names are used for ordering, @p interface_type should be empty string ("").
- * @param[in] interface_type used for ordering interfaces with respect to joint names.
+ * @return index of @p unordered_interfaces to be used with get_ordered_interfaces().
+ */
+template <typename T>
+InterfaceIndex<T> build_interface_index(std::vector<T> & unordered_interfaces)
+{
+  InterfaceIndex<T> interface_index;
+  interface_index.reserve(unordered_interfaces.size());
+  for (auto & interface : unordered_interfaces)
+  {
+    interface_index.emplace(interface.get_name(), std::ref(interface));
+  }
+  return interface_index;
+}
+
+/**
+ * @brief Reorder interfaces with references according to joint names or full interface names.
+ *
+ * Same as get_ordered_interfaces() below, but resolves the names with a prebuilt index of the
+ * interfaces. Every name is resolved by a single hash lookup, so the cost is linear in the number
+ * of names and interfaces instead of their product.
+ *
+ * @param[in] interface_index index of the loaned interfaces built with build_interface_index().
+ * @param[in] ordered_names vector with ordered names to order the interfaces.
+ * @param[in] interface_type used for ordering interfaces with respect to joint names, or empty
+ * string ("") if full interface names are used for ordering.
  * @param[out] ordered_interfaces vector with ordered interfaces. Has to have the same capacity as
  * @p ordered_names size. Throws otherwise.
  * @throws std::range_error if the capacity of ordered_interfaces is less than the size of
@@ -48,7 +73,7 @@ namespace controller_interface
  */
 template <typename T>
 bool get_ordered_interfaces(
-  std::vector<T> & unordered_interfaces, const std::vector<std::string> & ordered_names,
+  const InterfaceIndex<T> & interface_index, const std::vector<std::string> & ordered_names,
   const std::string & interface_type, std::vector<std::reference_wrapper<T>> & ordered_interfaces)
 {
   if (ordered_interfaces.capacity() < ordered_names.size())
@@ -60,35 +85,58 @@ bool get_ordered_interfaces(
       ") for realtime reasons. Please reserve sufficient space in the on_configure method to avoid "
       "allocating memory in real-time loop.");
   }
+  // the full name of an interface is always <joint>/<interface>, so looking up the full name also
+  // covers the case of matching the prefix and the interface name
+  std::string full_name;
   for (const auto & name : ordered_names)
   {
-    for (auto & interface : unordered_interfaces)
+    std::string_view key = name;
+    if (!interface_type.empty())
     {
-      if (!interface_type.empty())
-      {
-        // check case where:
-        // (<joint> == <joint> AND <interface> == <interface>) OR <joint>/<interface> == 'full name'
-        if (
-          ((name == interface.get_prefix_name()) &&
-           (interface_type == interface.get_interface_name())) ||
-          ((name + "/" + interface_type) == interface.get_name()))
-        {
-          ordered_interfaces.push_back(std::ref(interface));
-        }
-      }
-      else
-      {
-        if (name == interface.get_name())
-        {
-          ordered_interfaces.push_back(std::ref(interface));
-        }
-      }
+      full_name.assign(name).append("/").append(interface_type);
+      key = full_name;
+    }
+    const auto range = interface_index.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      ordered_interfaces.push_back(it->second);
     }
   }
 
   return ordered_names.size() == ordered_interfaces.size();
 }
 
+/**
+ * @brief Reorder interfaces with references according to joint names or full interface names.
+ *
+ * Method to reorder and check if all expected interfaces are provided for the joint.
+ * Fill `ordered_interfaces` with references from `unordered_interfaces` in the same order as in
+ * `ordered_names`.
+ *
+ * @param[in] unordered_interfaces vector with loaned unordered state or command interfaces.
+ * @param[in] ordered_names vector with ordered names to order @p unordered_interfaces.
+ *  The valued inputs are list of joint names or interface full names.
+ *  If joint names are used for ordering, @p interface_type specifies valid interface.
+ *  If full interface names are used for ordering, @p interface_type should be empty string ("").
+ * @param[in] interface_type used for ordering interfaces with respect to joint names.
+ * @param[out] ordered_interfaces vector with ordered interfaces. Has to have the same capacity as
+ * @p ordered_names size. Throws otherwise.
+ * @throws std::range_error if the capacity of ordered_interfaces is less than the size of
+ * ordered_names.
+ * @return true if all interfaces or joints in @p ordered_names are found, otherwise false.
+ * @note The interfaces are indexed on every call, controllers ordering several lists of the same
+ * interfaces should build the index once with build_interface_index().
+ */
+template <typename T>
+bool get_ordered_interfaces(
+  std::vector<T> & unordered_interfaces, const std::vector<std::string> & ordered_names,
+  const std::string & interface_type, std::vector<std::reference_wrapper<T>> & ordered_interfaces)
+{
+  return get_ordered_interfaces(
+    build_interface_index(unordered_interfaces), ordered_names, interface_type,
+    ordered_interfaces);
+}
+
 inline bool interface_list_contains_interface_type(
   const std::vector<std::string> & interface_type_list, const std::string & interface_type)
 {
@@ -0,0 +1,127 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONTROLLER_INTERFACE__PARAMETER_SNAPSHOT_HPP_
+#define CONTROLLER_INTERFACE__PARAMETER_SNAPSHOT_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "hardware_interface/rcu_pointer.hpp"
+#include "rclcpp/parameter.hpp"
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+
+namespace controller_interface
+{
+/// Lock-free access of the real-time update of a controller to its parameters.
+/**
+ * The parameters are published as immutable snapshots, prepared off the real-time thread, and
+ * the update reads the current one inside a short read guard, without locking or allocating
+ * memory. A publication replaces the snapshot with read-copy-update: the publishing thread waits
+ * until the updates reading the previous snapshot left their guard, and destroys it, so the
+ * update never waits and never frees a snapshot, see hardware_interface::RcuPointer.
+ *
+ * A controller using a listener of generate_parameter_library tracks it in on_configure, and the
+ * parameters validated by the listener are published after every change of the parameters:
+ * \code
+ * params_.track(get_node(), param_listener_);
+ * ...
+ * const auto params = params_.read();
+ * command = params->gain * error;
+ * \endcode
+ *
+ * \tparam ParamsT type of the parameters, copied into every snapshot.
+ */
+template <class ParamsT>
+class ParameterSnapshot
+{
+public:
+  using ReadGuard = typename hardware_interface::RcuPointer<const ParamsT>::ReadGuard;
+
+  explicit ParameterSnapshot(ParamsT initial_params = ParamsT())
+  : snapshot_(std::make_unique<const ParamsT>(std::move(initial_params)))
+  {
+  }
+
+  ParameterSnapshot(const ParameterSnapshot &) = delete;
+  ParameterSnapshot & operator=(const ParameterSnapshot &) = delete;
+
+  ~ParameterSnapshot() { untrack(); }
+
+  /// Returns the current snapshot of the parameters, valid until the guard is destroyed.
+  /**
+   * \note This method is real-time safe and lock-free. The guard has to be short-lived, e.g., for
+   * one update, since a publication waits for it.
+   */
+  ReadGuard read() const noexcept { return snapshot_.read(); }
+
+  /// Returns the number of publications, to detect the changes of the parameters in the update.
+  /**
+   * \note This method is real-time safe and lock-free.
+   */
+  uint64_t get_version() const noexcept { return version_.load(std::memory_order_acquire); }
+
+  /// Publishes new parameters, already validated.
+  /**
+   * \note This method is not real-time safe, it waits for the readers of the previous snapshot.
+   */
+  void publish(ParamsT params)
+  {
+    snapshot_.update(std::make_unique<const ParamsT>(std::move(params)));
+    version_.fetch_add(1u, std::memory_order_release);
+  }
+
+  /// Publishes the parameters of \p listener now and after every change of the parameters.
+  /**
+   * The parameters are taken from `listener->get_params()` in a post set parameters callback of
+   * \p node, once the listener accepted and validated them, replacing the previous tracking.
+   * \note This method is not real-time safe.
+   */
+  template <class ListenerT>
+  void track(
+    const std::shared_ptr<rclcpp_lifecycle::LifecycleNode> & node,
+    std::shared_ptr<ListenerT> listener)
+  {
+    untrack();
+    publish(listener->get_params());
+    node_ = node;
+    post_set_callback_handle_ = node->add_post_set_parameters_callback(
+      [this, listener](const std::vector<rclcpp::Parameter> &)
+      { publish(listener->get_params()); });
+  }
+
+  /// Stops publishing the changes of the parameters, e.g., in on_cleanup.
+  void untrack()
+  {
+    if (auto node = node_.lock(); node && post_set_callback_handle_)
+    {
+      node->remove_post_set_parameters_callback(post_set_callback_handle_.get());
+    }
+    post_set_callback_handle_.reset();
+    node_.reset();
+  }
+
+private:
+  hardware_interface::RcuPointer<const ParamsT> snapshot_;
+  std::atomic<uint64_t> version_{0u};
+  std::weak_ptr<rclcpp_lifecycle::LifecycleNode> node_;
+  rclcpp::node_interfaces::PostSetParametersCallbackHandle::SharedPtr post_set_callback_handle_;
+};
+
+}  // namespace controller_interface
+
+#endif  // CONTROLLER_INTERFACE__PARAMETER_SNAPSHOT_HPP_
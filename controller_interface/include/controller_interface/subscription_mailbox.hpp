@@ -0,0 +1,164 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONTROLLER_INTERFACE__SUBSCRIPTION_MAILBOX_HPP_
+#define CONTROLLER_INTERFACE__SUBSCRIPTION_MAILBOX_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "hardware_interface/triple_buffer.hpp"
+#include "hardware_interface/types/statistics_types.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/time.hpp"
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+
+namespace controller_interface
+{
+/// Lock-free delivery of the latest message of a subscription to the update of a controller.
+/**
+ * The subscription callback, on the executor of the controller manager, copies the message with
+ * its reception time into a TripleBuffer, and the real-time update takes it with receive(),
+ * without locking or allocating memory. The messages received between two updates are
+ * overwritten by the newer ones, only the latest one is delivered.
+ *
+ * Every delivered message is stamped with the time of the update taking it, and the age of the
+ * message, from its reception to its delivery, is added to get_age_histogram(), for a uniform
+ * measurement of the command latency of the controllers.
+ *
+ * A typical controller subscribes in on_configure and receives in update:
+ * \code
+ * reference_mailbox_.subscribe(get_node(), "~/reference", rclcpp::SystemDefaultsQoS());
+ * ...
+ * if (reference_mailbox_.receive(time)) { use(reference_mailbox_.get_message()); }
+ * \endcode
+ */
+template <class MessageT>
+class SubscriptionMailbox
+{
+public:
+  /// Creates the subscription, replacing the previous one, and clears the delivered message.
+  /**
+   * \param[in] node node of the controller, whose clock stamps the reception of the messages.
+   * \param[in] topic name of the topic.
+   * \param[in] qos quality of service of the subscription.
+   * \param[in] initial_message value of the buffers before the first message, which also
+   * reserves the memory of the dynamically sized fields, e.g., the arrays, of the messages.
+   * \note This method is not real-time safe and not thread-safe with receive().
+   */
+  void subscribe(
+    const std::shared_ptr<rclcpp_lifecycle::LifecycleNode> & node, const std::string & topic,
+    const rclcpp::QoS & qos, const MessageT & initial_message = MessageT())
+  {
+    subscription_.reset();
+    clock_ = node->get_clock();
+    buffer_.initialize(Entry{initial_message, 0});
+    has_message_ = false;
+    delivery_time_ = rclcpp::Time(0, 0, clock_->get_clock_type());
+    received_count_.store(0u, std::memory_order_relaxed);
+    delivered_count_.store(0u, std::memory_order_relaxed);
+    age_histogram_.reset();
+    subscription_ = node->create_subscription<MessageT>(
+      topic, qos,
+      [this](const std::shared_ptr<const MessageT> message)
+      {
+        Entry & entry = buffer_.get_write_buffer();
+        entry.message = *message;
+        entry.receive_time_ns = clock_->now().nanoseconds();
+        buffer_.publish();
+        received_count_.fetch_add(1u, std::memory_order_relaxed);
+      });
+  }
+
+  /// Destroys the subscription, e.g., in on_cleanup.
+  void unsubscribe() { subscription_.reset(); }
+
+  /// Takes the latest message received since the last call, to be called in the update.
+  /**
+   * \param[in] time time of the update, stamping the delivery of the message.
+   * \returns true if a new message was delivered, false if get_message() is unchanged.
+   */
+  bool receive(const rclcpp::Time & time)
+  {
+    if (!buffer_.update_read_buffer())
+    {
+      return false;
+    }
+    has_message_ = true;
+    delivery_time_ = time;
+    delivered_count_.fetch_add(1u, std::memory_order_relaxed);
+    age_histogram_.add_measurement(
+      static_cast<double>(time.nanoseconds() - buffer_.get_read_buffer().receive_time_ns) / 1.e9);
+    return true;
+  }
+
+  /// Returns true once a message was delivered since the subscription was created.
+  bool has_message() const { return has_message_; }
+
+  /// Returns the last delivered message, the initial message if none was delivered yet.
+  const MessageT & get_message() const { return buffer_.get_read_buffer().message; }
+
+  /// Returns the time the last delivered message was received by the subscription.
+  rclcpp::Time get_receive_time() const
+  {
+    return rclcpp::Time(buffer_.get_read_buffer().receive_time_ns, delivery_time_.get_clock_type());
+  }
+
+  /// Returns the time of the update the last message was delivered to.
+  const rclcpp::Time & get_delivery_time() const { return delivery_time_; }
+
+  /// Returns the number of messages received by the subscription.
+  uint64_t get_received_count() const { return received_count_.load(std::memory_order_relaxed); }
+
+  /// Returns the number of messages delivered to the update.
+  uint64_t get_delivered_count() const
+  {
+    return delivered_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns the number of messages overwritten by a newer one before being delivered.
+  uint64_t get_overwritten_count() const
+  {
+    const uint64_t delivered = get_delivered_count();
+    const uint64_t received = get_received_count();
+    return received > delivered ? received - delivered : 0u;
+  }
+
+  /// Returns the histogram of the ages of the delivered messages, in seconds.
+  const ros2_control::LatencyHistogram & get_age_histogram() const { return age_histogram_; }
+
+private:
+  struct Entry
+  {
+    MessageT message;
+    /// Reception time of the message, in nanoseconds of the clock of the node
+    int64_t receive_time_ns;
+  };
+
+  hardware_interface::TripleBuffer<Entry> buffer_;
+  typename rclcpp::Subscription<MessageT>::SharedPtr subscription_;
+  rclcpp::Clock::SharedPtr clock_;
+  bool has_message_ = false;
+  rclcpp::Time delivery_time_;
+  std::atomic<uint64_t> received_count_{0u};
+  std::atomic<uint64_t> delivered_count_{0u};
+  ros2_control::LatencyHistogram age_histogram_;
+};
+
+}  // namespace controller_interface
+
+#endif  // CONTROLLER_INTERFACE__SUBSCRIPTION_MAILBOX_HPP_
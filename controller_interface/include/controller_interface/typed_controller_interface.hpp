@@ -0,0 +1,309 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef CONTROLLER_INTERFACE__TYPED_CONTROLLER_INTERFACE_HPP_
+#define CONTROLLER_INTERFACE__TYPED_CONTROLLER_INTERFACE_HPP_
+
+#include <fmt/compile.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "controller_interface/controller_interface.hpp"
+#include "hardware_interface/loaned_command_interface.hpp"
+#include "hardware_interface/loaned_interface_view.hpp"
+#include "hardware_interface/loaned_state_interface.hpp"
+
+namespace controller_interface
+{
+/// Interface type claimed for every joint of an InterfaceSchema, with the data type of its values.
+/**
+ * e.g., `InterfaceField<double, hardware_interface::HW_IF_POSITION>`.
+ */
+template <typename T, const char * InterfaceType>
+struct InterfaceField
+{
+  using value_type = T;
+  static constexpr const char * interface_type = InterfaceType;
+};
+
+/// List of the fields of the command or the state interfaces of an InterfaceSchema.
+template <typename... FieldsT>
+struct InterfaceFields
+{
+  static constexpr std::size_t size = sizeof...(FieldsT);
+};
+
+/// Compile-time layout of the interfaces of a TypedControllerInterface.
+/**
+ * Every command field and every state field is claimed for each of the NumberOfJoints joints,
+ * e.g., for a controller commanding the position of six joints from their position and velocity:
+ * \code
+ * using Position = InterfaceField<double, hardware_interface::HW_IF_POSITION>;
+ * using Velocity = InterfaceField<double, hardware_interface::HW_IF_VELOCITY>;
+ * using Schema =
+ *   InterfaceSchema<6, InterfaceFields<Position>, InterfaceFields<Position, Velocity>>;
+ * \endcode
+ */
+template <
+  std::size_t NumberOfJoints, typename CommandFieldsT, typename StateFieldsT = InterfaceFields<>>
+struct InterfaceSchema
+{
+  static_assert(NumberOfJoints > 0, "The schema needs at least one joint.");
+
+  static constexpr std::size_t number_of_joints = NumberOfJoints;
+  using command_fields = CommandFieldsT;
+  using state_fields = StateFieldsT;
+};
+
+namespace detail
+{
+template <typename FieldT, typename... FieldsT>
+constexpr std::size_t count_field = (std::size_t{std::is_same_v<FieldT, FieldsT>} + ... + 0u);
+
+template <typename FieldT, typename... FieldsT>
+constexpr std::size_t get_field_index()
+{
+  std::size_t index = 0;
+  for (const bool match : {std::is_same_v<FieldT, FieldsT>..., false})
+  {
+    if (match)
+    {
+      break;
+    }
+    ++index;
+  }
+  return index;
+}
+}  // namespace detail
+
+/// Typed views of the loaned interfaces of a list of fields, an array of views per field.
+/**
+ * The fields and the joints are laid out at compile time, so the views are accessed without any
+ * name lookup, e.g., `views.get<Position>()[joint]`, and a loop over the joints has a constant
+ * number of iterations.
+ */
+template <template <typename> class ViewT, std::size_t NumberOfJoints, typename FieldsT>
+class TypedInterfaceViews;
+
+template <template <typename> class ViewT, std::size_t NumberOfJoints, typename... FieldsT>
+class TypedInterfaceViews<ViewT, NumberOfJoints, InterfaceFields<FieldsT...>>
+{
+public:
+  template <typename FieldT>
+  using views_type = std::array<ViewT<typename FieldT::value_type>, NumberOfJoints>;
+
+  /// Returns the views of the field, one per joint in the order of the joint names.
+  template <typename FieldT>
+  views_type<FieldT> & get()
+  {
+    static_assert(detail::count_field<FieldT, FieldsT...> == 1u, "The field isn't in the schema.");
+    return std::get<detail::get_field_index<FieldT, FieldsT...>()>(views_);
+  }
+
+  template <typename FieldT>
+  const views_type<FieldT> & get() const
+  {
+    static_assert(detail::count_field<FieldT, FieldsT...> == 1u, "The field isn't in the schema.");
+    return std::get<detail::get_field_index<FieldT, FieldsT...>()>(views_);
+  }
+
+  /// Returns the names of the interfaces, `<joint>/<interface type>`, joint by joint.
+  static std::vector<std::string> get_interface_names(const std::vector<std::string> & joint_names)
+  {
+    std::vector<std::string> names;
+    names.reserve(joint_names.size() * sizeof...(FieldsT));
+    for (const auto & joint_name : joint_names)
+    {
+      (names.push_back(joint_name + "/" + FieldsT::interface_type), ...);
+    }
+    return names;
+  }
+
+  /// Creates the views of all the fields from the loaned interfaces.
+  /**
+   * \param[in] loaned_interfaces interfaces to view, in any order.
+   * \param[in] joint_names names of the NumberOfJoints joints.
+   * \throws std::runtime_error if an interface is missing or isn't of the type of its field.
+   */
+  template <typename LoanedInterfaceT>
+  void assign(
+    std::vector<LoanedInterfaceT> & loaned_interfaces, const std::vector<std::string> & joint_names)
+  {
+    if (joint_names.size() != NumberOfJoints)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("The schema has {} joints, but {} joint names are given"), NumberOfJoints,
+          joint_names.size()));
+    }
+    (assign_field<FieldsT>(loaned_interfaces, joint_names), ...);
+  }
+
+  /// Resets all the views, e.g., when the interfaces are released.
+  void reset() { views_ = std::tuple<views_type<FieldsT>...>(); }
+
+private:
+  template <typename FieldT, typename LoanedInterfaceT>
+  void assign_field(
+    std::vector<LoanedInterfaceT> & loaned_interfaces, const std::vector<std::string> & joint_names)
+  {
+    auto & views = get<FieldT>();
+    for (std::size_t i = 0; i < NumberOfJoints; ++i)
+    {
+      const std::string name = joint_names[i] + "/" + FieldT::interface_type;
+      const auto it = std::find_if(
+        loaned_interfaces.begin(), loaned_interfaces.end(),
+        [&name](const auto & loaned_interface) { return loaned_interface.get_name() == name; });
+      if (it == loaned_interfaces.end())
+      {
+        throw std::runtime_error(
+          fmt::format(FMT_COMPILE("The interface '{}' of the schema is not assigned"), name));
+      }
+      views[i] = ViewT<typename FieldT::value_type>(*it);
+    }
+  }
+
+  std::tuple<views_type<FieldsT>...> views_;
+};
+
+/// Controller claiming the interfaces of a compile-time InterfaceSchema.
+/**
+ * The controller sets the names of its joints with set_joint_names(), e.g., in `on_configure`,
+ * and the interfaces of the schema are claimed for them. When the interfaces are assigned, typed
+ * views are created once for all the interfaces, so `update` accesses them through
+ * @ref command_views_ and @ref state_views_ by field and joint index, e.g.,
+ * `command_views_.get<Position>()[i].set(value)`, instead of matching the loaned interfaces by name
+ * and checking their data type at every access.
+ *
+ * \note The controller checks typed_interfaces_assigned() in `on_activate`, the views are reset if
+ * an interface of the schema is missing or isn't of the type of its field.
+ */
+template <typename SchemaT>
+class TypedControllerInterface : public ControllerInterface
+{
+public:
+  using Schema = SchemaT;
+  using CommandViews = TypedInterfaceViews<
+    hardware_interface::LoanedCommandView, SchemaT::number_of_joints,
+    typename SchemaT::command_fields>;
+  using StateViews = TypedInterfaceViews<
+    hardware_interface::LoanedStateView, SchemaT::number_of_joints,
+    typename SchemaT::state_fields>;
+
+  InterfaceConfiguration command_interface_configuration() const override
+  {
+    return get_interface_configuration(CommandViews::get_interface_names(joint_names_));
+  }
+
+  InterfaceConfiguration state_interface_configuration() const override
+  {
+    return get_interface_configuration(StateViews::get_interface_names(joint_names_));
+  }
+
+  void assign_interfaces(
+    std::vector<hardware_interface::LoanedCommandInterface> && command_interfaces,
+    std::vector<hardware_interface::LoanedStateInterface> && state_interfaces) override
+  {
+    ControllerInterface::assign_interfaces(
+      std::move(command_interfaces), std::move(state_interfaces));
+    typed_interfaces_error_.clear();
+    try
+    {
+      command_views_.assign(command_interfaces_, joint_names_);
+      state_views_.assign(state_interfaces_, joint_names_);
+      typed_interfaces_assigned_ = true;
+    }
+    catch (const std::runtime_error & e)
+    {
+      reset_typed_interfaces();
+      typed_interfaces_error_ = e.what();
+    }
+  }
+
+  void release_interfaces() override
+  {
+    // the views stay valid for a running asynchronous update, its loans are revoked instead
+    if (!is_async_update_running())
+    {
+      reset_typed_interfaces();
+    }
+    ControllerInterface::release_interfaces();
+  }
+
+  /// Returns the names of the joints of the schema, empty until set_joint_names() succeeds.
+  const std::vector<std::string> & get_joint_names() const { return joint_names_; }
+
+  /// Returns true if the views of all the interfaces of the schema are created.
+  bool typed_interfaces_assigned() const { return typed_interfaces_assigned_; }
+
+  /// Returns the reason why the views of the interfaces are not created, empty if they are.
+  const std::string & get_typed_interfaces_error() const { return typed_interfaces_error_; }
+
+protected:
+  /**
+   * @brief Set the names of the joints of the schema, whose interfaces are claimed.
+   *
+   * @param[in] joint_names names of the Schema::number_of_joints joints.
+   * @return false if the number of names is not the number of joints of the schema.
+   */
+  bool set_joint_names(const std::vector<std::string> & joint_names)
+  {
+    if (joint_names.size() != SchemaT::number_of_joints)
+    {
+      return false;
+    }
+    joint_names_ = joint_names;
+    return true;
+  }
+
+  /// Typed views of the command interfaces, valid while the interfaces are assigned
+  CommandViews command_views_;
+  /// Typed views of the state interfaces, valid while the interfaces are assigned
+  StateViews state_views_;
+
+private:
+  static InterfaceConfiguration get_interface_configuration(std::vector<std::string> && names)
+  {
+    if (names.empty())
+    {
+      return InterfaceConfiguration{interface_configuration_type::NONE};
+    }
+    return InterfaceConfiguration{interface_configuration_type::INDIVIDUAL, std::move(names)};
+  }
+
+  void reset_typed_interfaces()
+  {
+    command_views_.reset();
+    state_views_.reset();
+    typed_interfaces_assigned_ = false;
+  }
+
+  std::vector<std::string> joint_names_;
+  bool typed_interfaces_assigned_ = false;
+  std::string typed_interfaces_error_;
+};
+
+}  // namespace controller_interface
+
+#endif  // CONTROLLER_INTERFACE__TYPED_CONTROLLER_INTERFACE_HPP_
@@ -16,12 +16,14 @@
 #define SEMANTIC_COMPONENTS__FORCE_TORQUE_SENSOR_HPP_
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <string>
 #include <vector>
 
 #include "geometry_msgs/msg/wrench.hpp"
 #include "hardware_interface/loaned_state_interface.hpp"
+#include "semantic_components/frame_transform.hpp"
 #include "semantic_components/semantic_component_interface.hpp"
 
 namespace semantic_components
@@ -129,44 +131,86 @@ public:
   bool get_values_as_message(geometry_msgs::msg::Wrench & message) const
   {
     update_data_from_interfaces();
-    message.force.x = data_[0];
-    message.force.y = data_[1];
-    message.force.z = data_[2];
-    message.torque.x = data_[3];
-    message.torque.y = data_[4];
-    message.torque.z = data_[5];
+    fill_message(message);
+    return true;
+  }
 
+  /**
+   * @brief Return Wrench message from values read by a SemanticComponentGroup.
+   *
+   * @param[in] values values of the state interfaces, in the order of the interface names.
+   * @param[out] message Wrench message from values
+   * @return always returns true
+   */
+  bool get_values_as_message(const double * values, geometry_msgs::msg::Wrench & message) const
+  {
+    update_data(values);
+    fill_message(message);
     return true;
   }
 
+  /**
+   * @brief Transform a Wrench message from the sensor frame to another frame.
+   *
+   * The torque is moved to the origin of the other frame, using the translation of @p transform.
+   */
+  static void transform_message(
+    const FrameTransform & transform, geometry_msgs::msg::Wrench & message)
+  {
+    transform.rotate(message.force.x, message.force.y, message.force.z);
+    transform.rotate(message.torque.x, message.torque.y, message.torque.z);
+    transform.add_moment(
+      message.force.x, message.force.y, message.force.z, message.torque.x, message.torque.y,
+      message.torque.z);
+  }
+
 protected:
   /**
    * @brief Update the data from the state interfaces.
    * @note The method is thread-safe and non-blocking.
    * @note This method might return stale data if the data is not updated. This is to ensure that
-   * the data from the sensor is not discontinuous.
+   * the data from the sensor is not discontinuous. All the values are updated from the same read
+   * or none of them.
    */
   void update_data_from_interfaces() const
+  {
+    std::array<double, 6> values;
+    if (read_values(values.data()))
+    {
+      update_data(values.data());
+    }
+  }
+
+  /**
+   * @brief Update the data from the values of the existing axes.
+   */
+  void update_data(const double * values) const
   {
     std::size_t interface_counter{0};
     for (auto i = 0u; i < data_.size(); ++i)
     {
       if (existing_axes_[i])
       {
-        const auto data = state_interfaces_[interface_counter].get().get_optional();
-        if (data.has_value())
-        {
-          data_[i] = data.value();
-        }
+        data_[i] = values[interface_counter];
         ++interface_counter;
       }
     }
   }
 
+  void fill_message(geometry_msgs::msg::Wrench & message) const
+  {
+    message.force.x = data_[0];
+    message.force.y = data_[1];
+    message.force.z = data_[2];
+    message.torque.x = data_[3];
+    message.torque.y = data_[4];
+    message.torque.z = data_[5];
+  }
+
   /**
    * @brief Array to store the data of the FT sensors
    */
-  mutable std::array<double, 6> data_;
+  alignas(64) mutable std::array<double, 6> data_;
   /**
    * @brief Array with existing axes for sensors with less than 6D axes.
    */
@@ -0,0 +1,107 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SEMANTIC_COMPONENTS__FRAME_TRANSFORM_HPP_
+#define SEMANTIC_COMPONENTS__FRAME_TRANSFORM_HPP_
+
+#include <array>
+#include <cmath>
+
+namespace semantic_components
+{
+/// Rigid transform from the frame of a sensor to another frame, e.g., the base of the robot.
+/**
+ * The rotation matrix is computed once from the quaternion, so that transforming the values of a
+ * sensor in the control loop only takes a few multiplications.
+ */
+class FrameTransform
+{
+public:
+  /// Identity transform.
+  FrameTransform() = default;
+
+  /**
+   * @param[in] orientation rotation of the sensor frame in the target frame, quaternion (x,y,z,w),
+   * normalized here.
+   * @param[in] translation origin of the sensor frame in the target frame (x, y, z).
+   */
+  FrameTransform(
+    const std::array<double, 4> & orientation, const std::array<double, 3> & translation)
+  : translation_(translation)
+  {
+    const double norm = std::sqrt(
+      orientation[0] * orientation[0] + orientation[1] * orientation[1] +
+      orientation[2] * orientation[2] + orientation[3] * orientation[3]);
+    for (auto i = 0u; i < orientation_.size(); ++i)
+    {
+      orientation_[i] = orientation[i] / norm;
+    }
+    const auto & [x, y, z, w] = orientation_;
+    rotation_ = {
+      {1.0 - 2.0 * (y * y + z * z), 2.0 * (x * y - z * w), 2.0 * (x * z + y * w),
+       2.0 * (x * y + z * w), 1.0 - 2.0 * (x * x + z * z), 2.0 * (y * z - x * w),
+       2.0 * (x * z - y * w), 2.0 * (y * z + x * w), 1.0 - 2.0 * (x * x + y * y)}};
+  }
+
+  const std::array<double, 4> & get_orientation() const { return orientation_; }
+
+  const std::array<double, 3> & get_translation() const { return translation_; }
+
+  /// Rotates the vector (x, y, z) in place.
+  void rotate(double & x, double & y, double & z) const
+  {
+    const double rx = rotation_[0] * x + rotation_[1] * y + rotation_[2] * z;
+    const double ry = rotation_[3] * x + rotation_[4] * y + rotation_[5] * z;
+    const double rz = rotation_[6] * x + rotation_[7] * y + rotation_[8] * z;
+    x = rx;
+    y = ry;
+    z = rz;
+  }
+
+  /// Rotates the orientation quaternion (x, y, z, w) in place.
+  void rotate(double & x, double & y, double & z, double & w) const
+  {
+    const auto & [tx, ty, tz, tw] = orientation_;
+    const double rx = tw * x + tx * w + ty * z - tz * y;
+    const double ry = tw * y - tx * z + ty * w + tz * x;
+    const double rz = tw * z + tx * y - ty * x + tz * w;
+    const double rw = tw * w - tx * x - ty * y - tz * z;
+    x = rx;
+    y = ry;
+    z = rz;
+    w = rw;
+  }
+
+  /// Adds the moment of the force (fx, fy, fz) applied at the origin of the sensor frame.
+  /**
+   * The force is in the target frame, the moment (x, y, z) is around the origin of the target frame.
+   */
+  void add_moment(double fx, double fy, double fz, double & x, double & y, double & z) const
+  {
+    const auto & [px, py, pz] = translation_;
+    x += py * fz - pz * fy;
+    y += pz * fx - px * fz;
+    z += px * fy - py * fx;
+  }
+
+private:
+  std::array<double, 4> orientation_{{0.0, 0.0, 0.0, 1.0}};
+  std::array<double, 3> translation_{{0.0, 0.0, 0.0}};
+  /// Rotation matrix of the orientation, row-major
+  std::array<double, 9> rotation_{{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
+};
+
+}  // namespace semantic_components
+
+#endif  // SEMANTIC_COMPONENTS__FRAME_TRANSFORM_HPP_
@@ -16,10 +16,12 @@
 #define SEMANTIC_COMPONENTS__IMU_SENSOR_HPP_
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <string>
 #include <vector>
 
+#include "semantic_components/frame_transform.hpp"
 #include "semantic_components/semantic_component_interface.hpp"
 #include "sensor_msgs/msg/imu.hpp"
 
@@ -97,6 +99,44 @@ public:
   bool get_values_as_message(sensor_msgs::msg::Imu & message) const
   {
     update_data_from_interfaces();
+    fill_message(message);
+    return true;
+  }
+
+  /**
+   * @brief Return Imu message from values read by a SemanticComponentGroup.
+   *
+   * @param[in] values values of the state interfaces, in the order of the interface names.
+   * @param[out] message IMU message from values
+   * @return always returns true
+   */
+  bool get_values_as_message(const double * values, sensor_msgs::msg::Imu & message) const
+  {
+    std::copy(values, values + data_.size(), data_.begin());
+    fill_message(message);
+    return true;
+  }
+
+  /**
+   * @brief Transform an Imu message from the sensor frame to another frame.
+   *
+   * The orientation, the angular velocity and the linear acceleration are rotated. The
+   * acceleration isn't corrected for the rotation of the sensor around the origin of the other
+   * frame, the translation of @p transform is ignored.
+   */
+  static void transform_message(const FrameTransform & transform, sensor_msgs::msg::Imu & message)
+  {
+    transform.rotate(
+      message.orientation.x, message.orientation.y, message.orientation.z, message.orientation.w);
+    transform.rotate(
+      message.angular_velocity.x, message.angular_velocity.y, message.angular_velocity.z);
+    transform.rotate(
+      message.linear_acceleration.x, message.linear_acceleration.y, message.linear_acceleration.z);
+  }
+
+private:
+  void fill_message(sensor_msgs::msg::Imu & message) const
+  {
     message.orientation.x = data_[0];
     message.orientation.y = data_[1];
     message.orientation.z = data_[2];
@@ -109,31 +149,20 @@ public:
     message.linear_acceleration.x = data_[7];
     message.linear_acceleration.y = data_[8];
     message.linear_acceleration.z = data_[9];
-
-    return true;
   }
 
-private:
   /**
    * @brief Update the data array from the state interfaces.
    * @note This method is thread-safe and non-blocking.
    * @note This method might return stale data if the data is not updated. This is to ensure that
-   * the data from the sensor is not discontinuous.
+   * the data from the sensor is not discontinuous. All the values are updated from the same read
+   * or none of them.
    */
-  void update_data_from_interfaces() const
-  {
-    for (auto i = 0u; i < data_.size(); ++i)
-    {
-      const auto data = state_interfaces_[i].get().get_optional();
-      if (data.has_value())
-      {
-        data_[i] = data.value();
-      }
-    }
-  }
+  void update_data_from_interfaces() const { read_values(data_.data()); }
 
   // Array to store the data of the IMU sensor
-  mutable std::array<double, 10> data_{{0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}};
+  alignas(64) mutable std::array<double, 10> data_{
+    {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}};
 };
 
 }  // namespace semantic_components
@@ -0,0 +1,184 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SEMANTIC_COMPONENTS__PACKED_COMMAND_ARRAY_HPP_
+#define SEMANTIC_COMPONENTS__PACKED_COMMAND_ARRAY_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "controller_interface/helpers.hpp"
+#include "hardware_interface/loaned_command_interface.hpp"
+#include "hardware_interface/loaned_interface_view.hpp"
+#include "hardware_interface/packed_interface_values.hpp"
+
+namespace semantic_components
+{
+/// Semantic component commanding a large array of bool or uint8_t command interfaces at once.
+/**
+ * The commands are set from a packed buffer, with one bit per interface of type bool and one byte
+ * per interface of type uint8_t, e.g., for the digital outputs of a lighting or valve bank. The
+ * data types are checked once when the interfaces are assigned, and only the commands that changed
+ * since the last successful write are written, so a cycle with a few changes costs a few writes.
+ * The hardware component can read the commands back as a packed buffer with
+ * hardware_interface::PackedInterfaceReader.
+ */
+template <typename T>
+class PackedCommandArray
+{
+public:
+  PackedCommandArray(const std::string & name, const std::vector<std::string> & interface_names)
+  : name_(name), interface_names_(interface_names)
+  {
+    command_interfaces_.reserve(interface_names.size());
+  }
+
+  /**
+   * @brief Constructor with the interfaces "name/1" to "name/size".
+   */
+  PackedCommandArray(const std::string & name, std::size_t size) : name_(name)
+  {
+    interface_names_.reserve(size);
+    for (auto i = 0u; i < size; ++i)
+    {
+      interface_names_.emplace_back(name_ + "/" + std::to_string(i + 1));
+    }
+    command_interfaces_.reserve(size);
+  }
+
+  /**
+   * @brief Assign loaned command interfaces from the hardware.
+   *
+   * @param[in] command_interfaces vector of command interfaces provided by the controller.
+   * @return false if an interface is missing or isn't of type T.
+   */
+  bool assign_loaned_command_interfaces(
+    std::vector<hardware_interface::LoanedCommandInterface> & command_interfaces)
+  {
+    release_interfaces();
+    if (!controller_interface::get_ordered_interfaces(
+          command_interfaces, interface_names_, "", command_interfaces_))
+    {
+      return false;
+    }
+    command_views_.reserve(command_interfaces_.size());
+    try
+    {
+      for (auto & command_interface : command_interfaces_)
+      {
+        command_views_.emplace_back(command_interface.get());
+      }
+    }
+    catch (const std::runtime_error &)
+    {
+      release_interfaces();
+      return false;
+    }
+    written_.assign(get_packed_size(), 0u);
+    // the commands are all written at the first call
+    unwritten_.assign(hardware_interface::get_packed_size<bool>(size()), 0xFFu);
+    return true;
+  }
+
+  /**
+   * @brief Release loaned command interfaces from the hardware.
+   */
+  void release_interfaces()
+  {
+    command_views_.clear();
+    command_interfaces_.clear();
+  }
+
+  /**
+   * @brief Definition of command interface names for the component.
+   */
+  const std::vector<std::string> & get_command_interface_names() const { return interface_names_; }
+
+  /// Returns the number of commanded interfaces.
+  std::size_t size() const { return interface_names_.size(); }
+
+  /// Returns the number of bytes of the packed commands.
+  std::size_t get_packed_size() const { return hardware_interface::get_packed_size<T>(size()); }
+
+  /**
+   * @brief Set the commands from a packed buffer.
+   *
+   * @param[in] packed the commands, see hardware_interface::get_packed_value() for the layout.
+   * @param[in] packed_size number of bytes of @p packed, has to be get_packed_size().
+   * @return true if all the changed commands are written, false if the size is invalid, the
+   * interfaces aren't assigned or an interface is locked by another thread. The commands that
+   * couldn't be written are written at the next call.
+   * @note The method is non-blocking and doesn't allocate memory.
+   */
+  bool set_packed_values(const uint8_t * packed, std::size_t packed_size)
+  {
+    if (packed_size != get_packed_size() || command_views_.size() != size())
+    {
+      return false;
+    }
+    bool all_set = true;
+    for (std::size_t i = 0; i < command_views_.size(); ++i)
+    {
+      const T value = hardware_interface::get_packed_value<T>(packed, i);
+      if (
+        !hardware_interface::get_packed_value<bool>(unwritten_.data(), i) &&
+        hardware_interface::get_packed_value<T>(written_.data(), i) == value)
+      {
+        continue;
+      }
+      const bool set = command_views_[i].set(value);
+      hardware_interface::set_packed_value<bool>(unwritten_.data(), i, !set);
+      if (set)
+      {
+        hardware_interface::set_packed_value<T>(written_.data(), i, value);
+      }
+      all_set &= set;
+    }
+    return all_set;
+  }
+
+  /// Set the commands from a packed buffer of get_packed_size() bytes, see set_packed_values().
+  bool set_values_from_message(const std::vector<uint8_t> & packed)
+  {
+    return set_packed_values(packed.data(), packed.size());
+  }
+
+  /// Writes all the commands again at the next call of set_packed_values(), e.g., after the
+  /// commands were changed by another controller.
+  void invalidate_written_values() { std::fill(unwritten_.begin(), unwritten_.end(), 0xFFu); }
+
+  // delete copy constructor, because
+  // copy will change capacity of member variables
+  PackedCommandArray(const PackedCommandArray &) = delete;
+
+protected:
+  std::string name_;
+  std::vector<std::string> interface_names_;
+  std::vector<std::reference_wrapper<hardware_interface::LoanedCommandInterface>>
+    command_interfaces_;
+  std::vector<hardware_interface::LoanedCommandView<T>> command_views_;
+  /// Last written commands, packed like the input
+  std::vector<uint8_t> written_;
+  /// One bit per interface, set if its command has to be written regardless of its last value
+  std::vector<uint8_t> unwritten_;
+};
+
+}  // namespace semantic_components
+
+#endif  // SEMANTIC_COMPONENTS__PACKED_COMMAND_ARRAY_HPP_
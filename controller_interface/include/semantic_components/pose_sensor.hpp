@@ -100,24 +100,15 @@ private:
    * @brief Update the data array from the state interfaces.
    * @note This method is thread-safe and non-blocking.
    * @note This method might return stale data if the data is not updated. This is to ensure that
-   * the data from the sensor is not discontinuous.
+   * the data from the sensor is not discontinuous. All the values are updated from the same read
+   * or none of them.
    */
-  void update_data_from_interfaces() const
-  {
-    for (auto i = 0u; i < data_.size(); ++i)
-    {
-      const auto data = state_interfaces_[i].get().get_optional();
-      if (data.has_value())
-      {
-        data_[i] = data.value();
-      }
-    }
-  }
+  void update_data_from_interfaces() const { read_values(data_.data()); }
 
   /**
    * @brief Array to store the data of the pose sensor
    */
-  mutable std::array<double, 7> data_{{0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0}};
+  alignas(64) mutable std::array<double, 7> data_{{0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0}};
 };
 
 }  // namespace semantic_components
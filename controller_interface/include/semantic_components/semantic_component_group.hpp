@@ -0,0 +1,154 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SEMANTIC_COMPONENTS__SEMANTIC_COMPONENT_GROUP_HPP_
+#define SEMANTIC_COMPONENTS__SEMANTIC_COMPONENT_GROUP_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "semantic_components/frame_transform.hpp"
+#include "semantic_components/semantic_component_interface.hpp"
+
+namespace semantic_components
+{
+/// Group of semantic components of the same type, read as one block of state interfaces.
+/**
+ * Instead of reading every component with its get_values_as_message(), e.g., in a broadcaster of
+ * many force-torque sensors, get_values_as_messages() reads the state interfaces of all the
+ * components in one pass and fills the preallocated messages of all of them from the same read.
+ * The messages can also be transformed from the frames of the sensors to a common frame.
+ *
+ * SemanticComponentType has to provide `get_values_as_message(const double *, MessageType &)`,
+ * filling a message from the values of its interfaces, and, for the frame transforms, a static
+ * `transform_message(const FrameTransform &, MessageType &)`, like ForceTorqueSensor and IMUSensor.
+ *
+ * The components are only used to convert the values, their own interfaces aren't assigned.
+ */
+template <typename SemanticComponentType, typename MessageType>
+class SemanticComponentGroup : public SemanticComponentInterface<std::vector<MessageType>>
+{
+public:
+  /**
+   * @brief Constructor of a group of components with the standard interface names.
+   *
+   * @param[in] names names of the components, e.g., the names of the sensors.
+   */
+  explicit SemanticComponentGroup(const std::vector<std::string> & names)
+  : SemanticComponentInterface<std::vector<MessageType>>("")
+  {
+    std::vector<std::unique_ptr<SemanticComponentType>> components;
+    components.reserve(names.size());
+    for (const auto & name : names)
+    {
+      components.emplace_back(std::make_unique<SemanticComponentType>(name));
+    }
+    add_components(std::move(components));
+  }
+
+  /**
+   * @brief Constructor of a group of components, e.g., with custom interface names.
+   */
+  explicit SemanticComponentGroup(std::vector<std::unique_ptr<SemanticComponentType>> components)
+  : SemanticComponentInterface<std::vector<MessageType>>("")
+  {
+    add_components(std::move(components));
+  }
+
+  /// Number of components of the group.
+  std::size_t size() const { return components_.size(); }
+
+  /**
+   * @brief Set the transform of the messages of a component to a common frame.
+   *
+   * @param[in] index index of the component.
+   * @param[in] transform transform from the frame of the component to the common frame.
+   * @throws std::out_of_range if @p index isn't the index of a component.
+   */
+  void set_frame_transform(std::size_t index, const FrameTransform & transform)
+  {
+    frame_transforms_.at(index) = transform;
+    has_frame_transform_.at(index) = true;
+  }
+
+  /**
+   * @brief Remove the frame transforms of all the components.
+   */
+  void clear_frame_transforms()
+  {
+    std::fill(has_frame_transform_.begin(), has_frame_transform_.end(), false);
+  }
+
+  /**
+   * @brief Return the messages of all the components from one read of their state interfaces.
+   *
+   * @param[in,out] messages messages of the components, in their order, with one message per
+   * component. If an interface is locked by another thread, all the messages keep their previous
+   * values, so that they are never filled from different reads of the hardware.
+   * @return true if all the messages are filled, else false.
+   * @note The method is thread-safe, non-blocking and doesn't allocate memory.
+   */
+  bool get_values_as_messages(std::vector<MessageType> & messages) const
+  {
+    if (messages.size() != components_.size() || !this->read_values(values_.data()))
+    {
+      return false;
+    }
+    for (auto i = 0u; i < components_.size(); ++i)
+    {
+      components_[i]->get_values_as_message(values_.data() + offsets_[i], messages[i]);
+      if (has_frame_transform_[i])
+      {
+        SemanticComponentType::transform_message(frame_transforms_[i], messages[i]);
+      }
+    }
+    return true;
+  }
+
+private:
+  void add_components(std::vector<std::unique_ptr<SemanticComponentType>> components)
+  {
+    components_ = std::move(components);
+    offsets_.reserve(components_.size());
+    for (const auto & component : components_)
+    {
+      if (!component)
+      {
+        throw std::invalid_argument("The components of a SemanticComponentGroup can't be null.");
+      }
+      offsets_.push_back(this->interface_names_.size());
+      const auto names = component->get_state_interface_names();
+      this->interface_names_.insert(this->interface_names_.end(), names.begin(), names.end());
+    }
+    this->state_interfaces_.reserve(this->interface_names_.size());
+    values_.resize(this->interface_names_.size());
+    frame_transforms_.resize(components_.size());
+    has_frame_transform_.resize(components_.size(), false);
+  }
+
+  std::vector<std::unique_ptr<SemanticComponentType>> components_;
+  /// Index of the first value of every component in values_
+  std::vector<std::size_t> offsets_;
+  /// Values of the state interfaces of all the components, in the order of the interface names
+  mutable std::vector<double> values_;
+  std::vector<FrameTransform> frame_transforms_;
+  std::vector<bool> has_frame_transform_;
+};
+
+}  // namespace semantic_components
+
+#endif  // SEMANTIC_COMPONENTS__SEMANTIC_COMPONENT_GROUP_HPP_
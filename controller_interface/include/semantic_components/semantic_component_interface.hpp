@@ -15,10 +15,13 @@
 #ifndef SEMANTIC_COMPONENTS__SEMANTIC_COMPONENT_INTERFACE_HPP_
 #define SEMANTIC_COMPONENTS__SEMANTIC_COMPONENT_INTERFACE_HPP_
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "controller_interface/helpers.hpp"
+#include "hardware_interface/loaned_interface_view.hpp"
 #include "hardware_interface/loaned_state_interface.hpp"
 
 namespace semantic_components
@@ -45,21 +48,43 @@ public:
   /**
    * @brief Assign loaned state interfaces from the hardware.
    *
-   * Assign loaned state interfaces on the controller start.
+   * Assign loaned state interfaces on the controller start. The typed views and the buffer read by
+   * read_values() are also allocated here, so that reading the values doesn't allocate memory.
    *
    * @param[in] state_interfaces vector of interfaces provided by the controller.
+   * @return true if all the interfaces are found, else false.
    */
   bool assign_loaned_state_interfaces(
     std::vector<hardware_interface::LoanedStateInterface> & state_interfaces)
   {
-    return controller_interface::get_ordered_interfaces(
+    state_views_.clear();
+    const bool result = controller_interface::get_ordered_interfaces(
       state_interfaces, interface_names_, "", state_interfaces_);
+    read_buffer_.resize(state_interfaces_.size());
+    state_views_.reserve(state_interfaces_.size());
+    try
+    {
+      for (const auto & state_interface : state_interfaces_)
+      {
+        state_views_.emplace_back(state_interface.get());
+      }
+    }
+    catch (const std::runtime_error &)
+    {
+      // the interfaces that aren't of type double are read through get_optional()
+      state_views_.clear();
+    }
+    return result;
   }
 
   /**
    * @brief Release loaned interfaces from the hardware.
    */
-  void release_interfaces() { state_interfaces_.clear(); }
+  void release_interfaces()
+  {
+    state_views_.clear();
+    state_interfaces_.clear();
+  }
 
   /**
    * @brief Definition of state interface names for the component.
@@ -91,15 +116,34 @@ public:
   bool get_values(std::vector<double> & values) const
   {
     // check we have sufficient memory
-    if (values.capacity() != state_interfaces_.size())
+    if (values.capacity() != state_interfaces_.size() || !read_block())
     {
       return false;
     }
     // insert all the values
-    for (auto i = 0u; i < state_interfaces_.size(); ++i)
+    values.insert(values.end(), read_buffer_.begin(), read_buffer_.end());
+    return true;
+  }
+
+  /**
+   * @brief Read the values of all the state interfaces in one block.
+   *
+   * The values are copied in the order of the interface names into @p values, which has to hold
+   * at least as many values as there are assigned interfaces. Either all the values are copied or
+   * none: if an interface is locked by another thread, @p values keeps the previous values, so
+   * that a block never mixes values from different reads of the hardware.
+   *
+   * @param[out] values the values of the state interfaces.
+   * @return true if all the values are read, else false.
+   * @note The method is thread-safe, non-blocking and doesn't allocate memory.
+   */
+  bool read_values(double * values) const
+  {
+    if (state_interfaces_.empty() || !read_block())
     {
-      values.emplace_back(state_interfaces_[i].get().get_optional().value());
+      return false;
     }
+    std::copy(read_buffer_.begin(), read_buffer_.end(), values);
     return true;
   }
 
@@ -118,6 +162,37 @@ protected:
   std::string name_;
   std::vector<std::string> interface_names_;
   std::vector<std::reference_wrapper<hardware_interface::LoanedStateInterface>> state_interfaces_;
+  /// Typed views of the state interfaces, in the order of the interface names
+  std::vector<hardware_interface::LoanedStateView<double>> state_views_;
+  /// Values of the block being read, committed to the caller once all of them are read
+  mutable std::vector<double> read_buffer_;
+
+private:
+  /// Reads the values of all the state interfaces into read_buffer_.
+  bool read_block() const
+  {
+    if (state_views_.size() == state_interfaces_.size())
+    {
+      for (auto i = 0u; i < state_views_.size(); ++i)
+      {
+        if (!state_views_[i].get(read_buffer_[i]))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+    for (auto i = 0u; i < state_interfaces_.size(); ++i)
+    {
+      const auto data = state_interfaces_[i].get().get_optional();
+      if (!data.has_value())
+      {
+        return false;
+      }
+      read_buffer_[i] = data.value();
+    }
+    return true;
+  }
 };
 
 }  // namespace semantic_components
@@ -16,6 +16,7 @@
 
 #include <fmt/compile.h>
 
+#include <utility>
 #include <vector>
 
 #include "controller_interface/helpers.hpp"
@@ -41,12 +42,52 @@ return_type ChainableControllerInterface::update(
       return ret;
     }
   }
+  else if (track_input_changes())
+  {
+    // the generation is read before the inputs, a change during the update is seen next cycle
+    const uint64_t input_generation = get_input_generation();
+    if (input_generation != UNTRACKED_INPUTS && input_generation == last_input_generation_)
+    {
+      return update_with_unchanged_inputs(time, period);
+    }
+    ret = update_and_write_commands(time, period);
+    last_input_generation_ = (ret == return_type::OK) ? input_generation : UNTRACKED_INPUTS;
+    return ret;
+  }
 
   ret = update_and_write_commands(time, period);
 
   return ret;
 }
 
+void ChainableControllerInterface::assign_interfaces(
+  std::vector<hardware_interface::LoanedCommandInterface> && command_interfaces,
+  std::vector<hardware_interface::LoanedStateInterface> && state_interfaces)
+{
+  ControllerInterfaceBase::assign_interfaces(
+    std::move(command_interfaces), std::move(state_interfaces));
+  // the first update after an activation always runs
+  last_input_generation_ = UNTRACKED_INPUTS;
+}
+
+uint64_t ChainableControllerInterface::get_input_generation() const
+{
+  uint64_t generation = 0;
+  for (const auto & reference_interface : ordered_exported_reference_interfaces_)
+  {
+    generation += reference_interface->get_value_generation();
+  }
+  for (const auto & state_interface : state_interfaces_)
+  {
+    if (!state_interface.is_value_change_tracked())
+    {
+      return UNTRACKED_INPUTS;
+    }
+    generation += state_interface.get_value_generation();
+  }
+  return generation;
+}
+
 std::vector<hardware_interface::StateInterface::ConstSharedPtr>
 ChainableControllerInterface::export_state_interfaces()
 {
@@ -157,6 +198,7 @@ ChainableControllerInterface::export_state_interfaces()
       exported_state_interfaces_.size(), total_state_interfaces, get_node()->get_name());
     throw std::runtime_error(error_msg);
   }
+  enable_serial_access(ordered_exported_state_interfaces_);
 
   return state_interfaces_ptrs_vec;
 }
@@ -290,10 +332,30 @@ ChainableControllerInterface::export_reference_interfaces()
       exported_reference_interfaces_.size(), total_ref_interfaces, get_node()->get_name());
     throw std::runtime_error(error_msg);
   }
+  enable_serial_access(ordered_exported_reference_interfaces_);
 
   return reference_interfaces_ptrs_vec;
 }
 
+template <typename InterfacePtrT>
+void ChainableControllerInterface::enable_serial_access(
+  const std::vector<InterfacePtrT> & interfaces)
+{
+  if (is_async() || !auto_declare<bool>("chained_interfaces_serial_access", false))
+  {
+    return;
+  }
+  for (const auto & interface : interfaces)
+  {
+    if (
+      interface->get_data_type() == hardware_interface::HandleDataType::DOUBLE &&
+      !interface->is_lock_free() && interface->is_valid())
+    {
+      interface->enable_serial_access();
+    }
+  }
+}
+
 bool ChainableControllerInterface::set_chained_mode(bool chained_mode)
 {
   bool result = false;
@@ -305,6 +367,7 @@ bool ChainableControllerInterface::set_chained_mode(bool chained_mode)
     if (result)
     {
       in_chained_mode_ = chained_mode;
+      last_input_generation_ = UNTRACKED_INPUTS;
     }
   }
   else
@@ -324,6 +387,14 @@ bool ChainableControllerInterface::is_in_chained_mode() const { return in_chaine
 
 bool ChainableControllerInterface::on_set_chained_mode(bool /*chained_mode*/) { return true; }
 
+bool ChainableControllerInterface::track_input_changes() const { return false; }
+
+return_type ChainableControllerInterface::update_with_unchanged_inputs(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/)
+{
+  return return_type::OK;
+}
+
 std::vector<hardware_interface::StateInterface>
 ChainableControllerInterface::on_export_state_interfaces()
 {
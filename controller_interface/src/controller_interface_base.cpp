@@ -14,11 +14,24 @@
 
 #include "controller_interface/controller_interface_base.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "hardware_interface/introspection.hpp"
+#include "hardware_interface/instrumentation_clock.hpp"
+#include "hardware_interface/realtime_thread.hpp"
+#include "hardware_interface/triple_buffer.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
 
 namespace controller_interface
@@ -27,11 +40,70 @@ struct ControllerInterfaceBase::ControllerInterfaceBaseImpl
 {
   std::shared_ptr<rclcpp_lifecycle::LifecycleNode> node_;
   std::unique_ptr<realtime_tools::AsyncFunctionHandler<return_type>> async_handler_;
+  /// Update in the shared async worker pool, used instead of the async handler if set
+  std::shared_ptr<hardware_interface::AsyncWorkerPool::Task> async_task_;
+  std::atomic<return_type> async_task_result_ = return_type::OK;
   bool is_async_ = false;
+  /// Number of updates of the controller per trigger, see get_sub_steps()
+  unsigned int sub_steps_ = 1;
   controller_interface::ControllerInterfaceParams ctrl_itf_params_;
+  /// Copies the limits of the joint limits store into the parameters at the first access
+  mutable std::once_flag joint_limits_copied_;
   std::atomic_bool skip_async_triggers_ = false;
   ControllerUpdateStats trigger_stats_;
   mutable std::atomic<uint8_t> lifecycle_id_ = lifecycle_msgs::msg::State::PRIMARY_STATE_UNKNOWN;
+
+  /// Exchange of the interface values between the control loop and the asynchronous update
+  bool use_interface_frames_ = false;
+  hardware_interface::TripleBuffer<InterfaceFrame> state_frames_;
+  hardware_interface::TripleBuffer<InterfaceFrame> command_frames_;
+  /// States sampled by the control loop, keeping the last value of the interfaces locked
+  InterfaceFrame sampled_states_;
+  /// Commands of the asynchronous update, kept between the updates
+  InterfaceFrame async_commands_;
+  /// Time after the trigger within which the control loop waits for the update, 0 if not joined
+  int64_t join_deadline_ns_ = 0;
+  /// Set by the trigger of a joined update, reset by its join
+  bool join_pending_ = false;
+  std::chrono::steady_clock::time_point join_deadline_;
+  /// Set by the control loop if the interfaces were released while the asynchronous update was
+  /// running, reset once the loans are destroyed
+  std::atomic_bool loans_revoked_{false};
+  /// Gate of the writes of the loaned command interfaces of an asynchronous controller
+  hardware_interface::LoanWriteGate command_write_gate_;
+
+  /// Age of the states above which the states are stale, 0 if the age isn't measured
+  int64_t stale_state_max_age_ns_ = 0;
+  bool skip_stale_state_updates_ = false;
+  /// Set by the control loop, read by the asynchronous updates
+  std::atomic<int64_t> state_age_ns_ = 0;
+
+  /// Names of the state interfaces whose updates trigger the update, empty if not event-driven
+  std::vector<std::string> trigger_interface_names_;
+  /// Maximal time between two updates without a trigger interface updated, 0 if unbounded
+  int64_t trigger_max_age_ns_ = 0;
+  /// Indices of the trigger interfaces in the loaned state interfaces, resolved at the activation
+  std::vector<std::size_t> trigger_interface_indices_;
+  /// Last read cycle, or value generation for the states without a read stamp, seen per trigger
+  std::vector<uint64_t> trigger_interface_updates_;
+  /// Time of the last update, uninitialized before the first update after the activation
+  rclcpp::Time last_event_update_time_{0, 0, RCL_CLOCK_UNINITIALIZED};
+
+  /// Context of the cycle of the synchronous update
+  hardware_interface::CycleContext cycle_context_;
+  /// Contexts of the cycles triggering the asynchronous updates, taken when an update starts
+  hardware_interface::TripleBuffer<hardware_interface::CycleContext> async_cycle_contexts_;
+
+  /// Indices of the loaned state interfaces by the ids of their names, cached at the activation
+  std::vector<std::size_t> edge_event_state_indices_;
+
+  /// Wall time of the calls of parallel_for() and longest task within the current update
+  int64_t parallel_time_ns_ = 0;
+  std::atomic<int64_t> parallel_task_max_ns_ = 0;
+
+  /// Loaned interfaces of type double, checked at the activation for the bulk accessors
+  std::vector<bool> double_state_interfaces_;
+  std::vector<bool> double_command_interfaces_;
 };
 
 ControllerInterfaceBase::ControllerInterfaceBase()
@@ -53,6 +125,7 @@ ControllerInterfaceBase::~ControllerInterfaceBase()
       get_node()->get_name());
     impl_->node_->shutdown();
   }
+  stop_async_handler_thread();
 }
 
 return_type ControllerInterfaceBase::init(
@@ -99,7 +172,14 @@ return_type ControllerInterfaceBase::init(
     // no rclcpp::ParameterValue unsigned int specialization
     auto_declare<int>("update_rate", static_cast<int>(params.controller_manager_update_rate));
     auto_declare<bool>("is_async", false);
+    auto_declare<int>("sub_steps", 1);
     auto_declare<int>("thread_priority", -100);
+    auto_declare<bool>("async_parameters.use_interface_frames", false);
+    auto_declare<double>("async_parameters.join_deadline", 0.0);
+    auto_declare<double>("state_staleness.max_age", 0.0);
+    auto_declare<std::string>("state_staleness.policy", "use");
+    auto_declare<std::vector<std::string>>("event_trigger.interfaces", {});
+    auto_declare<double>("event_trigger.max_age", 0.0);
   }
   catch (const std::exception & e)
   {
@@ -128,6 +208,17 @@ return_type ControllerInterfaceBase::init(
   impl_->node_->register_on_activate(
     [this](const rclcpp_lifecycle::State & previous_state) -> CallbackReturn
     {
+      cache_interface_data_types();
+      index_edge_event_interfaces();
+      if (!resolve_trigger_interfaces())
+      {
+        return CallbackReturn::ERROR;
+      }
+      if (impl_->use_interface_frames_)
+      {
+        // the async update is idle until the triggers are enabled again
+        prepare_interface_frames();
+      }
       impl_->skip_async_triggers_.store(false, std::memory_order_release);
       enable_introspection(true);
       if (is_async() && impl_->async_handler_ && impl_->async_handler_->is_running())
@@ -135,6 +226,7 @@ return_type ControllerInterfaceBase::init(
         // This is needed if it is disabled due to a thrown exception in the async callback thread
         impl_->async_handler_->reset_variables();
       }
+      impl_->async_task_result_.store(return_type::OK, std::memory_order_release);
       impl_->lifecycle_id_.store(this->get_lifecycle_state().id(), std::memory_order_release);
       return on_activate(previous_state);
     });
@@ -241,7 +333,62 @@ const rclcpp_lifecycle::State & ControllerInterfaceBase::configure()
       }
     }
     impl_->is_async_ = get_node()->get_parameter("is_async").as_bool();
+    const auto sub_steps = get_node()->get_parameter("sub_steps").as_int();
+    if (sub_steps < 1 || (sub_steps > 1 && impl_->is_async_))
+    {
+      RCLCPP_ERROR(
+        get_node()->get_logger(),
+        "Invalid number of sub-steps '%ld': it has to be at least 1, and 1 for the asynchronous "
+        "controllers!",
+        sub_steps);
+      return get_lifecycle_state();
+    }
+    impl_->sub_steps_ = static_cast<unsigned int>(sub_steps);
+
+    const auto stale_state_max_age =
+      get_node()->get_parameter("state_staleness.max_age").as_double();
+    const auto stale_state_policy = get_node()->get_parameter("state_staleness.policy").as_string();
+    if (stale_state_max_age < 0.0 || (stale_state_policy != "use" && stale_state_policy != "skip"))
+    {
+      RCLCPP_ERROR(
+        get_node()->get_logger(),
+        "Invalid state staleness: the maximum age '%f' cannot be negative and the policy '%s' has "
+        "to be 'use' or 'skip'!",
+        stale_state_max_age, stale_state_policy.c_str());
+      return get_lifecycle_state();
+    }
+    impl_->stale_state_max_age_ns_ = static_cast<int64_t>(stale_state_max_age * 1e9);
+    impl_->skip_stale_state_updates_ = stale_state_policy == "skip";
+
+    const auto trigger_max_age = get_node()->get_parameter("event_trigger.max_age").as_double();
+    if (trigger_max_age < 0.0)
+    {
+      RCLCPP_ERROR(
+        get_node()->get_logger(),
+        "Invalid event trigger: the maximum age '%f' cannot be negative!", trigger_max_age);
+      return get_lifecycle_state();
+    }
+    impl_->trigger_interface_names_ =
+      get_node()->get_parameter("event_trigger.interfaces").as_string_array();
+    impl_->trigger_max_age_ns_ = static_cast<int64_t>(trigger_max_age * 1e9);
   }
+  impl_->use_interface_frames_ =
+    impl_->is_async_ &&
+    get_node()->get_parameter("async_parameters.use_interface_frames").as_bool();
+  const auto join_deadline =
+    get_node()->get_parameter("async_parameters.join_deadline").as_double();
+  if (join_deadline < 0.0 || (join_deadline > 0.0 && !impl_->use_interface_frames_))
+  {
+    // the commands of a joined update are committed through the command frame
+    RCLCPP_ERROR(
+      get_node()->get_logger(),
+      "Invalid join deadline '%f': it cannot be negative, and it requires an asynchronous "
+      "controller using interface frames!",
+      join_deadline);
+    return get_node()->get_current_state();
+  }
+  impl_->join_deadline_ns_ = static_cast<int64_t>(join_deadline * 1e9);
+  impl_->join_pending_ = false;
   if (impl_->is_async_)
   {
     realtime_tools::AsyncFunctionHandlerParams async_params;
@@ -265,18 +412,59 @@ const rclcpp_lifecycle::State & ControllerInterfaceBase::configure()
         "The controllers are not supported to run asynchronously in detached mode!");
       return get_node()->get_current_state();
     }
-    RCLCPP_INFO(
-      get_node()->get_logger(), "Starting async handler with scheduler priority: %d",
-      async_params.thread_priority);
-    impl_->async_handler_ = std::make_unique<realtime_tools::AsyncFunctionHandler<return_type>>();
-    impl_->async_handler_->init(
-      std::bind(
-        &ControllerInterfaceBase::update, this, std::placeholders::_1, std::placeholders::_2),
-      async_params);
-    impl_->async_handler_->start_thread();
+    if (params.async_worker_pool && !impl_->async_task_)
+    {
+      impl_->async_task_ = params.async_worker_pool->add_task(
+        [this](const rclcpp::Time & time, const rclcpp::Duration & period)
+        {
+          try
+          {
+            impl_->async_task_result_.store(
+              async_update(time, period), std::memory_order_release);
+          }
+          catch (...)
+          {
+            impl_->async_task_result_.store(return_type::ERROR, std::memory_order_release);
+            throw;
+          }
+        });
+    }
+    if (impl_->async_task_)
+    {
+      RCLCPP_INFO(get_node()->get_logger(), "Running the async updates on the async worker pool");
+    }
+    else
+    {
+      RCLCPP_INFO(
+        get_node()->get_logger(), "Starting async handler with scheduler priority: %d",
+        async_params.thread_priority);
+      // the handler sets the priority and the affinity of its thread, the name and the stack are
+      // set up at the first update
+      hardware_interface::RealtimeThreadParams thread_params;
+      thread_params.name = params.controller_name;
+      thread_params.stack_prefault_size = params.thread_stack_prefault_size;
+      impl_->async_handler_ =
+        std::make_unique<realtime_tools::AsyncFunctionHandler<return_type>>();
+      impl_->async_handler_->init(
+        [this, thread_params, logger = get_node()->get_logger()](
+          const rclcpp::Time & time, const rclcpp::Duration & period)
+        {
+          hardware_interface::configure_current_thread_once(thread_params, logger);
+          return async_update(time, period);
+        },
+        async_params);
+      impl_->async_handler_->start_thread();
+    }
   }
   REGISTER_ROS2_CONTROL_INTROSPECTION("total_triggers", &impl_->trigger_stats_.total_triggers);
   REGISTER_ROS2_CONTROL_INTROSPECTION("failed_triggers", &impl_->trigger_stats_.failed_triggers);
+  REGISTER_ROS2_CONTROL_INTROSPECTION(
+    "stale_state_triggers", &impl_->trigger_stats_.stale_state_triggers);
+  REGISTER_ROS2_CONTROL_INTROSPECTION(
+    "missed_join_deadlines", &impl_->trigger_stats_.missed_join_deadlines);
+  REGISTER_ROS2_CONTROL_INTROSPECTION("idle_triggers", &impl_->trigger_stats_.idle_triggers);
+  REGISTER_ROS2_CONTROL_INTROSPECTION(
+    "sequential_parallel_loops", &impl_->trigger_stats_.sequential_parallel_loops);
   impl_->trigger_stats_.reset();
 
   const auto & return_value = get_node()->configure();
@@ -290,14 +478,70 @@ void ControllerInterfaceBase::assign_interfaces(
 {
   command_interfaces_ = std::forward<decltype(command_interfaces)>(command_interfaces);
   state_interfaces_ = std::forward<decltype(state_interfaces)>(state_interfaces);
+  impl_->loans_revoked_.store(false, std::memory_order_relaxed);
+  // only the writes of an asynchronous update can outlive the deactivation
+  impl_->command_write_gate_.open();
+  for (auto & command_interface : command_interfaces_)
+  {
+    command_interface.set_write_gate(is_async() ? &impl_->command_write_gate_ : nullptr);
+  }
 }
 
 void ControllerInterfaceBase::release_interfaces()
 {
+  if (is_async_update_running())
+  {
+    // the running update keeps accessing its loans, it only can't write the commands anymore. The
+    // claims of a write in progress are released once the update finished.
+    if (impl_->command_write_gate_.close())
+    {
+      for (auto & command_interface : command_interfaces_)
+      {
+        command_interface.release_claim();
+      }
+    }
+    impl_->loans_revoked_.store(true, std::memory_order_release);
+    return;
+  }
   command_interfaces_.clear();
   state_interfaces_.clear();
+  impl_->trigger_interface_indices_.clear();
+}
+
+void ControllerInterfaceBase::release_revoked_interfaces()
+{
+  if (!impl_->loans_revoked_.load(std::memory_order_acquire))
+  {
+    return;
+  }
+  wait_for_trigger_update_to_finish();
+  command_interfaces_.clear();
+  state_interfaces_.clear();
+  impl_->trigger_interface_indices_.clear();
+  impl_->loans_revoked_.store(false, std::memory_order_relaxed);
+}
+
+std::vector<hardware_interface::LoanedCommandInterface>
+ControllerInterfaceBase::take_command_interfaces()
+{
+  // the vector is moved as a whole, so the loans are not moved and stay claimed
+  std::vector<hardware_interface::LoanedCommandInterface> command_interfaces;
+  command_interfaces.swap(command_interfaces_);
+  return command_interfaces;
+}
+
+return_type ControllerInterfaceBase::on_handover(
+  const ControllerInterfaceBase & /*previous_controller*/)
+{
+  return return_type::OK;
 }
 
+return_type ControllerInterfaceBase::on_prepare_activate() { return return_type::OK; }
+
+return_type ControllerInterfaceBase::on_shadow_activate() { return return_type::ERROR; }
+
+void ControllerInterfaceBase::on_shadow_deactivate() {}
+
 const rclcpp_lifecycle::State & ControllerInterfaceBase::get_lifecycle_state() const
 {
   if (!impl_->node_.get())
@@ -326,10 +570,65 @@ uint8_t ControllerInterfaceBase::get_lifecycle_id() const
 }
 
 ControllerUpdateStatus ControllerInterfaceBase::trigger_update(
-  const rclcpp::Time & time, const rclcpp::Duration & period)
+  const rclcpp::Time & time, const rclcpp::Duration & trigger_period)
 {
   ControllerUpdateStatus status;
   impl_->trigger_stats_.total_triggers++;
+  rclcpp::Duration period = trigger_period;
+  if (impl_->stale_state_max_age_ns_ > 0)
+  {
+    int64_t state_age_ns = 0;
+    for (const auto & interface : state_interfaces_)
+    {
+      // the states not read from a hardware component, e.g., of a chained controller, have no age
+      const auto stamp = interface.get_read_stamp();
+      if (stamp.cycle > 0 && stamp.time.get_clock_type() == time.get_clock_type())
+      {
+        state_age_ns = std::max(state_age_ns, (time - stamp.time).nanoseconds());
+      }
+    }
+    impl_->state_age_ns_.store(state_age_ns, std::memory_order_relaxed);
+    if (state_age_ns > impl_->stale_state_max_age_ns_)
+    {
+      impl_->trigger_stats_.stale_state_triggers++;
+      RCLCPP_WARN_THROTTLE(
+        get_node()->get_logger(), *get_node()->get_clock(), 20000,
+        "The controller was triggered with stale states %u times out of %u total triggers, the "
+        "oldest state is %.1f ms old.",
+        impl_->trigger_stats_.stale_state_triggers, impl_->trigger_stats_.total_triggers,
+        static_cast<double>(state_age_ns) / 1e6);
+      if (impl_->skip_stale_state_updates_)
+      {
+        status.successful = false;
+        status.result = return_type::OK;
+        return status;
+      }
+    }
+  }
+  if (!impl_->trigger_interface_indices_.empty())
+  {
+    const auto & last_update_time = impl_->last_event_update_time_;
+    const bool has_last_update = last_update_time.get_clock_type() == time.get_clock_type();
+    if (!consume_trigger_interface_updates())
+    {
+      const bool max_age_expired = impl_->trigger_max_age_ns_ > 0 &&
+                                   (!has_last_update || (time - last_update_time).nanoseconds() >=
+                                                          impl_->trigger_max_age_ns_);
+      if (!max_age_expired)
+      {
+        impl_->trigger_stats_.idle_triggers++;
+        status.successful = false;
+        status.result = return_type::OK;
+        return status;
+      }
+    }
+    // the update integrates over all the cycles since the previous update
+    if (has_last_update)
+    {
+      period = time - last_update_time;
+    }
+    impl_->last_event_update_time_ = time;
+  }
   if (is_async())
   {
     if (impl_->skip_async_triggers_.load())
@@ -339,8 +638,22 @@ ControllerUpdateStatus ControllerInterfaceBase::trigger_update(
       status.result = return_type::OK;
       return status;
     }
-    const rclcpp::Time last_trigger_time = impl_->async_handler_->get_current_callback_time();
-    const auto result = impl_->async_handler_->trigger_async_callback(time, period);
+    const auto & async_task = impl_->async_task_;
+    if (impl_->use_interface_frames_)
+    {
+      const auto stage_start_time = hardware_interface::InstrumentationClock::now();
+      status.command_latency = exchange_interface_frames(time);
+      status.stage_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        hardware_interface::InstrumentationClock::now() - stage_start_time);
+    }
+    const rclcpp::Time last_trigger_time = async_task
+                                             ? async_task->get_current_callback_time()
+                                             : impl_->async_handler_->get_current_callback_time();
+    const auto result =
+      async_task ? std::make_pair(
+                     async_task->trigger(time, period),
+                     impl_->async_task_result_.load(std::memory_order_acquire))
+                 : impl_->async_handler_->trigger_async_callback(time, period);
     if (!result.first)
     {
       impl_->trigger_stats_.failed_triggers++;
@@ -349,9 +662,16 @@ ControllerUpdateStatus ControllerInterfaceBase::trigger_update(
         "The controller missed %u update cycles out of %u total triggers.",
         impl_->trigger_stats_.failed_triggers, impl_->trigger_stats_.total_triggers);
     }
+    if (result.first && impl_->join_deadline_ns_ > 0)
+    {
+      impl_->join_pending_ = true;
+      impl_->join_deadline_ =
+        std::chrono::steady_clock::now() + std::chrono::nanoseconds(impl_->join_deadline_ns_);
+    }
     status.successful = result.first;
     status.result = result.second;
-    const auto execution_time = impl_->async_handler_->get_last_execution_time();
+    const auto execution_time = async_task ? async_task->get_last_execution_time()
+                                           : impl_->async_handler_->get_last_execution_time();
     if (execution_time.count() > 0)
     {
       status.execution_time = execution_time;
@@ -363,16 +683,162 @@ ControllerUpdateStatus ControllerInterfaceBase::trigger_update(
   }
   else
   {
-    const auto start_time = std::chrono::steady_clock::now();
+    const auto start_thread_times = hardware_interface::ThreadTimes::now();
+    const auto start_counters = hardware_interface::PerformanceCounters::now();
+    const auto start_time = hardware_interface::InstrumentationClock::now();
+    impl_->parallel_time_ns_ = 0;
+    impl_->parallel_task_max_ns_.store(0, std::memory_order_relaxed);
     status.successful = true;
-    status.result = update(time, period);
+    status.result = return_type::OK;
+    if (impl_->sub_steps_ == 1u)
+    {
+      status.result = update(time, period);
+    }
+    else
+    {
+      // the sub-steps divide the period evenly, the first one starts at the time of the trigger
+      const auto sub_step_period =
+        rclcpp::Duration::from_nanoseconds(period.nanoseconds() / impl_->sub_steps_);
+      for (unsigned int sub_step = 0;
+           sub_step < impl_->sub_steps_ && status.result == return_type::OK; ++sub_step)
+      {
+        status.result = update(
+          time + rclcpp::Duration::from_nanoseconds(sub_step_period.nanoseconds() * sub_step),
+          sub_step_period);
+      }
+    }
     status.execution_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
-      std::chrono::steady_clock::now() - start_time);
+      hardware_interface::InstrumentationClock::now() - start_time);
+    if (hardware_interface::PerformanceCounters::is_sampling_enabled())
+    {
+      status.performance_counters = hardware_interface::PerformanceCounters::now() - start_counters;
+    }
+    if (hardware_interface::ThreadTimes::is_sampling_enabled())
+    {
+      status.thread_times = hardware_interface::ThreadTimes::now() - start_thread_times;
+    }
+    if (impl_->parallel_time_ns_ > 0)
+    {
+      status.parallel_time = std::chrono::nanoseconds(impl_->parallel_time_ns_);
+      status.parallel_task_time =
+        std::chrono::nanoseconds(impl_->parallel_task_max_ns_.load(std::memory_order_relaxed));
+    }
     status.period = period;
   }
   return status;
 }
 
+ControllerUpdateStatus ControllerInterfaceBase::trigger_update(
+  const hardware_interface::CycleContext & cycle, const rclcpp::Duration & period)
+{
+  if (is_async())
+  {
+    impl_->async_cycle_contexts_.get_write_buffer() = cycle;
+    impl_->async_cycle_contexts_.publish();
+  }
+  else
+  {
+    impl_->cycle_context_ = cycle;
+  }
+  return trigger_update(cycle.ros_time, period);
+}
+
+bool ControllerInterfaceBase::resolve_trigger_interfaces()
+{
+  impl_->trigger_interface_indices_.clear();
+  impl_->last_event_update_time_ = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
+  for (const auto & name : impl_->trigger_interface_names_)
+  {
+    const auto it = std::find_if(
+      state_interfaces_.begin(), state_interfaces_.end(),
+      [&name](const auto & interface) { return interface.get_name() == name; });
+    if (it == state_interfaces_.end())
+    {
+      RCLCPP_ERROR(
+        get_node()->get_logger(),
+        "The trigger interface '%s' is not one of the state interfaces of the controller!",
+        name.c_str());
+      impl_->trigger_interface_indices_.clear();
+      return false;
+    }
+    impl_->trigger_interface_indices_.push_back(
+      static_cast<std::size_t>(std::distance(state_interfaces_.begin(), it)));
+  }
+  // the first trigger after the activation always updates the controller
+  impl_->trigger_interface_updates_.assign(
+    impl_->trigger_interface_indices_.size(), std::numeric_limits<uint64_t>::max());
+  return true;
+}
+
+bool ControllerInterfaceBase::consume_trigger_interface_updates()
+{
+  bool updated = false;
+  for (std::size_t i = 0; i < impl_->trigger_interface_indices_.size(); ++i)
+  {
+    const auto & interface = state_interfaces_[impl_->trigger_interface_indices_[i]];
+    // the states read from a hardware component are updated by its reads, the others, e.g., of a
+    // chained controller, by the changes of their value
+    const auto stamp = interface.get_read_stamp();
+    const uint64_t update = stamp.cycle > 0 ? stamp.cycle : interface.get_value_generation();
+    if (update != impl_->trigger_interface_updates_[i])
+    {
+      impl_->trigger_interface_updates_[i] = update;
+      updated = true;
+    }
+  }
+  return updated;
+}
+
+const hardware_interface::CycleContext & ControllerInterfaceBase::get_cycle_context() const
+{
+  return is_async() ? impl_->async_cycle_contexts_.get_read_buffer() : impl_->cycle_context_;
+}
+
+bool ControllerInterfaceBase::join_async_update()
+{
+  if (!impl_->join_pending_)
+  {
+    return true;
+  }
+  impl_->join_pending_ = false;
+  // the update publishes its command frame once it finishes, with the cycle of its state frame
+  const uint64_t cycle = impl_->sampled_states_.cycle;
+  while (true)
+  {
+    if (commit_command_frame() || impl_->command_frames_.get_read_buffer().cycle == cycle)
+    {
+      return true;
+    }
+    if (std::chrono::steady_clock::now() >= impl_->join_deadline_)
+    {
+      break;
+    }
+    std::this_thread::yield();
+  }
+  impl_->trigger_stats_.missed_join_deadlines++;
+  RCLCPP_WARN_THROTTLE(
+    get_node()->get_logger(), *get_node()->get_clock(), 20000,
+    "The update missed its join deadline %u times out of %u total triggers, the previous commands "
+    "were kept.",
+    impl_->trigger_stats_.missed_join_deadlines, impl_->trigger_stats_.total_triggers);
+  return false;
+}
+
+bool ControllerInterfaceBase::is_async_update_joined() const
+{
+  return impl_->join_deadline_ns_ > 0;
+}
+
+bool ControllerInterfaceBase::is_async_update_running() const
+{
+  if (impl_->async_task_)
+  {
+    return !impl_->async_task_->is_idle();
+  }
+  return is_async() && impl_->async_handler_ && impl_->async_handler_->is_running() &&
+         impl_->async_handler_->is_trigger_cycle_in_progress();
+}
+
 std::shared_ptr<rclcpp_lifecycle::LifecycleNode> ControllerInterfaceBase::get_node()
 {
   if (!impl_->node_.get())
@@ -398,29 +864,393 @@ unsigned int ControllerInterfaceBase::get_update_rate() const
 
 bool ControllerInterfaceBase::is_async() const { return impl_->is_async_; }
 
+unsigned int ControllerInterfaceBase::get_sub_steps() const { return impl_->sub_steps_; }
+
 const std::string & ControllerInterfaceBase::get_robot_description() const
 {
+  if (impl_->ctrl_itf_params_.shared_robot_description)
+  {
+    return *impl_->ctrl_itf_params_.shared_robot_description;
+  }
   return impl_->ctrl_itf_params_.robot_description;
 }
 
+namespace
+{
+void copy_joint_limits_from_store(controller_interface::ControllerInterfaceParams & params)
+{
+  if (
+    !params.joint_limits_store || !params.hard_joint_limits.empty() ||
+    !params.soft_joint_limits.empty())
+  {
+    return;
+  }
+  const auto snapshot = params.joint_limits_store->read();
+  params.hard_joint_limits = snapshot->hard_joint_limits;
+  params.soft_joint_limits = snapshot->soft_joint_limits;
+}
+}  // namespace
+
 const std::unordered_map<std::string, joint_limits::JointLimits> &
 ControllerInterfaceBase::get_hard_joint_limits() const
 {
+  std::call_once(
+    impl_->joint_limits_copied_, copy_joint_limits_from_store, std::ref(impl_->ctrl_itf_params_));
   return impl_->ctrl_itf_params_.hard_joint_limits;
 }
 
 const std::unordered_map<std::string, joint_limits::SoftJointLimits> &
 ControllerInterfaceBase::get_soft_joint_limits() const
 {
+  std::call_once(
+    impl_->joint_limits_copied_, copy_joint_limits_from_store, std::ref(impl_->ctrl_itf_params_));
   return impl_->ctrl_itf_params_.soft_joint_limits;
 }
 
+std::shared_ptr<const hardware_interface::JointLimitsStore>
+ControllerInterfaceBase::get_joint_limits_store() const
+{
+  return impl_->ctrl_itf_params_.joint_limits_store;
+}
+
+std::pmr::memory_resource * ControllerInterfaceBase::get_memory_resource() const
+{
+  if (impl_->ctrl_itf_params_.memory_arena)
+  {
+    return impl_->ctrl_itf_params_.memory_arena.get();
+  }
+  return std::pmr::get_default_resource();
+}
+
+bool ControllerInterfaceBase::uses_interface_frames() const
+{
+  return impl_->use_interface_frames_;
+}
+
+const InterfaceFrame & ControllerInterfaceBase::get_state_frame() const
+{
+  return impl_->state_frames_.get_read_buffer();
+}
+
+InterfaceFrame & ControllerInterfaceBase::get_command_frame() { return impl_->async_commands_; }
+
+return_type ControllerInterfaceBase::async_update(
+  const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  std::ignore = impl_->async_cycle_contexts_.update_read_buffer();
+  if (!impl_->use_interface_frames_)
+  {
+    return update(time, period);
+  }
+  std::ignore = impl_->state_frames_.update_read_buffer();
+  const auto ret = update(time, period);
+  auto & commands = impl_->command_frames_.get_write_buffer();
+  // the frames are sized at the activation, so the copy doesn't allocate
+  commands.values = impl_->async_commands_.values;
+  commands.time = time;
+  commands.cycle = get_state_frame().cycle;
+  impl_->command_frames_.publish();
+  return ret;
+}
+
+bool ControllerInterfaceBase::read_state_interfaces_frame(StateInterfacesFrame & frame) const
+{
+  // the number of times a value is sampled again while its component is being read
+  constexpr int max_resamples = 3;
+  if (frame.values.size() != state_interfaces_.size())
+  {
+    frame.values.assign(state_interfaces_.size(), std::numeric_limits<double>::quiet_NaN());
+    frame.stamps.assign(state_interfaces_.size(), hardware_interface::ReadStampData{});
+  }
+  bool all_sampled = true;
+  for (std::size_t i = 0; i < state_interfaces_.size(); ++i)
+  {
+    const auto & interface = state_interfaces_[i];
+    if (!interface.is_double_readable())
+    {
+      frame.stamps[i] = interface.get_read_stamp();
+      continue;
+    }
+    bool sampled = false;
+    for (int n = 0; n <= max_resamples && !sampled; ++n)
+    {
+      const auto stamp = interface.get_read_stamp();
+      const auto value = interface.get_optional(1);
+      if (!value.has_value())
+      {
+        continue;
+      }
+      if (interface.get_read_stamp().cycle == stamp.cycle || n == max_resamples)
+      {
+        frame.values[i] = value.value();
+        frame.stamps[i] = stamp;
+        sampled = true;
+      }
+    }
+    all_sampled &= sampled;
+  }
+  return all_sampled;
+}
+
+rclcpp::Duration ControllerInterfaceBase::get_state_age() const
+{
+  return rclcpp::Duration::from_nanoseconds(impl_->state_age_ns_.load(std::memory_order_relaxed));
+}
+
+bool ControllerInterfaceBase::is_event_driven() const
+{
+  return !impl_->trigger_interface_indices_.empty();
+}
+
+const hardware_interface::EdgeEventList & ControllerInterfaceBase::get_edge_events() const
+{
+  static const hardware_interface::EdgeEventList no_events;
+  const auto & edge_events = impl_->ctrl_itf_params_.edge_events;
+  return edge_events && !is_async() ? *edge_events : no_events;
+}
+
+std::size_t ControllerInterfaceBase::get_edge_event_state_index(
+  const hardware_interface::EdgeEvent & event) const
+{
+  const auto & indices = impl_->edge_event_state_indices_;
+  return event.interface_id < indices.size() ? indices[event.interface_id]
+                                             : state_interfaces_.size();
+}
+
+void ControllerInterfaceBase::parallel_for(
+  std::size_t number_of_tasks, const std::function<void(std::size_t)> & task)
+{
+  if (number_of_tasks == 0)
+  {
+    return;
+  }
+  const auto start_time = hardware_interface::InstrumentationClock::now();
+  // the wrapper only captures two pointers, which std::function stores without allocating
+  const std::function<void(std::size_t)> timed_task = [this, &task](std::size_t index)
+  {
+    const auto task_start_time = hardware_interface::InstrumentationClock::now();
+    task(index);
+    const int64_t task_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              hardware_interface::InstrumentationClock::now() - task_start_time)
+                              .count();
+    int64_t max_ns = impl_->parallel_task_max_ns_.load(std::memory_order_relaxed);
+    while (task_ns > max_ns && !impl_->parallel_task_max_ns_.compare_exchange_weak(
+                                 max_ns, task_ns, std::memory_order_relaxed))
+    {
+    }
+  };
+
+  const auto & pool = impl_->ctrl_itf_params_.worker_pool;
+  std::exception_ptr exception = nullptr;
+  try
+  {
+    if (!pool || !pool->try_parallel_for(number_of_tasks, timed_task))
+    {
+      if (pool)
+      {
+        impl_->trigger_stats_.sequential_parallel_loops++;
+      }
+      // as in the pool, all the tasks are executed and the first exception is rethrown
+      for (std::size_t i = 0; i < number_of_tasks; ++i)
+      {
+        try
+        {
+          timed_task(i);
+        }
+        catch (...)
+        {
+          if (!exception)
+          {
+            exception = std::current_exception();
+          }
+        }
+      }
+    }
+  }
+  catch (...)
+  {
+    exception = std::current_exception();
+  }
+  impl_->parallel_time_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                hardware_interface::InstrumentationClock::now() - start_time)
+                                .count();
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
+void ControllerInterfaceBase::run_task_group(const std::vector<std::function<void()>> & tasks)
+{
+  parallel_for(tasks.size(), [&tasks](std::size_t index) { tasks[index](); });
+}
+
+void ControllerInterfaceBase::index_edge_event_interfaces()
+{
+  auto & indices = impl_->edge_event_state_indices_;
+  indices.clear();
+  if (!impl_->ctrl_itf_params_.edge_events)
+  {
+    return;
+  }
+  for (std::size_t i = 0; i < state_interfaces_.size(); ++i)
+  {
+    const auto id = hardware_interface::NamePool::find(state_interfaces_[i].get_name());
+    if (id == hardware_interface::NamePool::EMPTY_ID)
+    {
+      continue;
+    }
+    if (id >= indices.size())
+    {
+      indices.resize(id + 1, state_interfaces_.size());
+    }
+    indices[id] = i;
+  }
+}
+
+bool ControllerInterfaceBase::read_states(std::vector<double> & values) const
+{
+  const auto & double_interfaces = impl_->double_state_interfaces_;
+  if (double_interfaces.size() != state_interfaces_.size())
+  {
+    return false;
+  }
+  if (values.size() != state_interfaces_.size())
+  {
+    values.resize(state_interfaces_.size(), std::numeric_limits<double>::quiet_NaN());
+  }
+  bool all_read = true;
+  for (std::size_t i = 0; i < state_interfaces_.size(); ++i)
+  {
+    if (double_interfaces[i])
+    {
+      all_read &= state_interfaces_[i].get_double_unchecked(values[i]);
+    }
+  }
+  return all_read;
+}
+
+bool ControllerInterfaceBase::write_commands(const std::vector<double> & values)
+{
+  const auto & double_interfaces = impl_->double_command_interfaces_;
+  if (
+    values.size() != command_interfaces_.size() ||
+    double_interfaces.size() != command_interfaces_.size())
+  {
+    return false;
+  }
+  bool all_written = true;
+  for (std::size_t i = 0; i < command_interfaces_.size(); ++i)
+  {
+    if (double_interfaces[i])
+    {
+      all_written &= command_interfaces_[i].set_double_unchecked(values[i]);
+    }
+  }
+  return all_written;
+}
+
+void ControllerInterfaceBase::cache_interface_data_types()
+{
+  const auto cache = [](const auto & interfaces, std::vector<bool> & double_interfaces)
+  {
+    double_interfaces.assign(interfaces.size(), false);
+    for (std::size_t i = 0; i < interfaces.size(); ++i)
+    {
+      double_interfaces[i] = interfaces[i].is_double_readable();
+    }
+  };
+  cache(state_interfaces_, impl_->double_state_interfaces_);
+  cache(command_interfaces_, impl_->double_command_interfaces_);
+}
+
+std::optional<rclcpp::Duration> ControllerInterfaceBase::exchange_interface_frames(
+  const rclcpp::Time & time)
+{
+  std::optional<rclcpp::Duration> command_latency = std::nullopt;
+  if (commit_command_frame())
+  {
+    // the commands are stamped with the time of the trigger that sampled their states
+    const auto & command_frame = impl_->command_frames_.get_read_buffer();
+    if (command_frame.time.get_clock_type() == time.get_clock_type())
+    {
+      command_latency = time - command_frame.time;
+    }
+  }
+
+  auto & sampled_states = impl_->sampled_states_;
+  for (std::size_t i = 0; i < state_interfaces_.size() && i < sampled_states.values.size(); ++i)
+  {
+    if (state_interfaces_[i].is_double_readable())
+    {
+      const auto value = state_interfaces_[i].get_optional();
+      if (value.has_value())
+      {
+        sampled_states.values[i] = value.value();
+      }
+    }
+  }
+  sampled_states.time = time;
+  ++sampled_states.cycle;
+  auto & states = impl_->state_frames_.get_write_buffer();
+  states.values = sampled_states.values;
+  states.time = sampled_states.time;
+  states.cycle = sampled_states.cycle;
+  impl_->state_frames_.publish();
+  return command_latency;
+}
+
+bool ControllerInterfaceBase::commit_command_frame()
+{
+  if (!impl_->command_frames_.update_read_buffer())
+  {
+    return false;
+  }
+  const auto & commands = impl_->command_frames_.get_read_buffer().values;
+  for (std::size_t i = 0; i < command_interfaces_.size() && i < commands.size(); ++i)
+  {
+    if (command_interfaces_[i].is_double_readable())
+    {
+      std::ignore = command_interfaces_[i].set_value(commands[i]);
+    }
+  }
+  return true;
+}
+
+void ControllerInterfaceBase::prepare_interface_frames()
+{
+  const auto read_values = [](const auto & interfaces)
+  {
+    std::vector<double> values(interfaces.size(), std::numeric_limits<double>::quiet_NaN());
+    for (std::size_t i = 0; i < interfaces.size(); ++i)
+    {
+      if (interfaces[i].is_double_readable())
+      {
+        values[i] = interfaces[i].get_optional().value_or(values[i]);
+      }
+    }
+    return values;
+  };
+  impl_->sampled_states_.values = read_values(state_interfaces_);
+  impl_->sampled_states_.time = get_node()->now();
+  impl_->sampled_states_.cycle = 0;
+  impl_->state_frames_.initialize(impl_->sampled_states_);
+  impl_->async_commands_.values = read_values(command_interfaces_);
+  impl_->async_commands_.time = impl_->sampled_states_.time;
+  impl_->async_commands_.cycle = 0;
+  impl_->command_frames_.initialize(impl_->async_commands_);
+}
+
 void ControllerInterfaceBase::wait_for_trigger_update_to_finish()
 {
   if (is_async() && impl_->async_handler_ && impl_->async_handler_->is_running())
   {
     impl_->async_handler_->wait_for_trigger_cycle_to_finish();
   }
+  if (impl_->async_task_)
+  {
+    impl_->async_task_->wait_until_idle();
+  }
 }
 
 void ControllerInterfaceBase::prepare_for_deactivation()
@@ -435,6 +1265,13 @@ void ControllerInterfaceBase::stop_async_handler_thread()
   {
     impl_->async_handler_->stop_thread();
   }
+  if (impl_->async_task_)
+  {
+    impl_->ctrl_itf_params_.async_worker_pool->remove_task(impl_->async_task_);
+    impl_->async_task_.reset();
+  }
+  // the loans revoked by release_interfaces() aren't accessed by a stopped update
+  release_revoked_interfaces();
 }
 
 std::string ControllerInterfaceBase::get_name() const { return get_node()->get_name(); }
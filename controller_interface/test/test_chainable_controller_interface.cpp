@@ -177,6 +177,7 @@ TEST_F(ChainableControllerInterfaceTest, export_reference_interfaces)
   EXPECT_EQ(reference_interfaces[0]->get_interface_name(), "test_itf");
 
   EXPECT_EQ(reference_interfaces[0]->get_optional().value(), INTERFACE_VALUE);
+  EXPECT_FALSE(reference_interfaces[0]->is_serial_access());
 
   // calling export_reference_interfaces again should return the same interface and shouldn't throw
   EXPECT_NO_THROW(reference_interfaces = controller.export_reference_interfaces());
@@ -186,6 +187,36 @@ TEST_F(ChainableControllerInterfaceTest, export_reference_interfaces)
   EXPECT_EQ(reference_interfaces[0]->get_interface_name(), "test_itf");
 }
 
+TEST_F(ChainableControllerInterfaceTest, exported_interfaces_with_serial_access)
+{
+  TestableChainableControllerInterface controller;
+
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 50;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  controller.get_node()->declare_parameter("chained_interfaces_serial_access", true);
+
+  auto reference_interfaces = controller.export_reference_interfaces();
+  ASSERT_THAT(reference_interfaces, SizeIs(1));
+  EXPECT_TRUE(reference_interfaces[0]->is_serial_access());
+  EXPECT_EQ(reference_interfaces[0]->get_optional().value(), INTERFACE_VALUE);
+  // the values are written directly into the storage of the controller, without locking the handle
+  {
+    std::unique_lock<std::shared_mutex> lock(reference_interfaces[0]->get_mutex());
+    ASSERT_TRUE(reference_interfaces[0]->set_value(2.0 * INTERFACE_VALUE));
+  }
+  EXPECT_EQ(reference_interfaces[0]->get_optional().value(), 2.0 * INTERFACE_VALUE);
+
+  auto state_interfaces = controller.export_state_interfaces();
+  ASSERT_THAT(state_interfaces, SizeIs(1));
+  EXPECT_TRUE(state_interfaces[0]->is_serial_access());
+  EXPECT_EQ(state_interfaces[0]->get_optional().value(), EXPORTED_STATE_INTERFACE_VALUE);
+}
+
 TEST_F(ChainableControllerInterfaceTest, export_reference_interfaces_list_only)
 {
   TestableChainableControllerInterface controller;
@@ -425,3 +456,60 @@ TEST_F(ChainableControllerInterfaceTest, test_update_logic)
   ASSERT_EQ(
     controller.state_interfaces_values_[0], EXPORTED_STATE_INTERFACE_VALUE_IN_CHAINMODE + 1);
 }
+
+TEST_F(ChainableControllerInterfaceTest, skip_updates_with_unchanged_inputs)
+{
+  TestableChainableControllerInterface controller;
+  controller.pointers_export = true;
+  controller.track_inputs = true;
+
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 50;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  auto reference_interfaces = controller.export_reference_interfaces();
+  ASSERT_THAT(reference_interfaces, SizeIs(2));
+  const auto time = rclcpp::Time(0);
+  const auto period = rclcpp::Duration::from_seconds(0.01);
+
+  // the updates aren't skipped when the references come from the subscribers
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.state_interfaces_values_[0], EXPORTED_STATE_INTERFACE_VALUE + 2);
+  EXPECT_EQ(controller.unchanged_updates, 0);
+
+  controller.reference_interfaces_[0] = 0.0;
+  ASSERT_TRUE(controller.set_chained_mode(true));
+  const double state_value = controller.state_interfaces_values_[0];
+
+  // the first update in chained mode runs, the next ones only if a reference changed
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.state_interfaces_values_[0], state_value + 1);
+  EXPECT_EQ(controller.unchanged_updates, 1);
+
+  ASSERT_TRUE(reference_interfaces[1]->set_value(INTERFACE_VALUE));
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.state_interfaces_values_[0], state_value + 2);
+  // writing the same value isn't a change
+  ASSERT_TRUE(reference_interfaces[1]->set_value(INTERFACE_VALUE));
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.unchanged_updates, 2);
+
+  // a failed update runs again
+  ASSERT_TRUE(reference_interfaces[0]->set_value(INTERFACE_VALUE_UPDATE_ERROR));
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::ERROR);
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::ERROR);
+  EXPECT_EQ(controller.unchanged_updates, 2);
+
+  // the controllers that don't track their inputs run every update
+  controller.track_inputs = false;
+  ASSERT_TRUE(reference_interfaces[0]->set_value(0.0));
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.update(time, period), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.state_interfaces_values_[0], state_value + 4);
+  EXPECT_EQ(controller.unchanged_updates, 2);
+}
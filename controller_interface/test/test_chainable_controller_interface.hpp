@@ -41,6 +41,7 @@ public:
   FRIEND_TEST(ChainableControllerInterfaceTest, export_reference_interfaces_list_plus_legacy);
   FRIEND_TEST(ChainableControllerInterfaceTest, export_state_interfaces_list_only);
   FRIEND_TEST(ChainableControllerInterfaceTest, export_state_interfaces_list_plus_legacy);
+  FRIEND_TEST(ChainableControllerInterfaceTest, skip_updates_with_unchanged_inputs);
 
   TestableChainableControllerInterface()
   {
@@ -166,6 +167,15 @@ public:
     return controller_interface::return_type::OK;
   }
 
+  bool track_input_changes() const override { return track_inputs; }
+
+  controller_interface::return_type update_with_unchanged_inputs(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    ++unchanged_updates;
+    return controller_interface::return_type::OK;
+  }
+
   void set_name_prefix_of_reference_interfaces(const std::string & prefix)
   {
     name_prefix_of_interfaces_ = prefix;
@@ -180,6 +190,8 @@ public:
   double reference_interface_value_ = INTERFACE_VALUE_INITIAL_REF;
   bool pointers_export = false;
   bool legacy_export = true;
+  bool track_inputs = false;
+  int unchanged_updates = 0;
 };
 
 class ChainableControllerInterfaceTest : public ::testing::Test
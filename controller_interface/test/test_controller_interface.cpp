@@ -14,7 +14,10 @@
 
 #include "test_controller_interface.hpp"
 
+#include <array>
+#include <functional>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -214,6 +217,74 @@ TEST(TestableControllerInterface, setting_update_rate_in_configure)
   rclcpp::shutdown();
 }
 
+TEST(TestableControllerInterface, joint_limits_from_the_shared_store)
+{
+  rclcpp::init(0, nullptr);
+
+  auto store = std::make_shared<hardware_interface::JointLimitsStore>();
+  joint_limits::JointLimits joint_limits;
+  joint_limits.has_velocity_limits = true;
+  joint_limits.max_velocity = 1.0;
+  joint_limits::SoftJointLimits soft_joint_limits;
+  soft_joint_limits.min_position = -1.0;
+  soft_joint_limits.max_position = 1.0;
+  store->update({{"joint1", joint_limits}}, {{"joint1", soft_joint_limits}});
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.update_rate = 100;
+  params.controller_manager_update_rate = 100;
+  params.node_options = controller.define_custom_node_options();
+  params.joint_limits_store = store;
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+
+  ASSERT_EQ(controller.get_joint_limits_store(), store);
+  const auto hard_limits = controller.get_hard_joint_limits();
+  ASSERT_THAT(hard_limits, testing::SizeIs(1));
+  ASSERT_TRUE(hard_limits.at("joint1").has_velocity_limits);
+  ASSERT_EQ(hard_limits.at("joint1").max_velocity, joint_limits.max_velocity);
+  const auto soft_limits = controller.get_soft_joint_limits();
+  ASSERT_THAT(soft_limits, testing::SizeIs(1));
+  ASSERT_EQ(soft_limits.at("joint1").max_position, soft_joint_limits.max_position);
+
+  // the updates of the store are visible through it, the copied maps are kept
+  joint_limits.max_velocity = 2.0;
+  store->update({{"joint1", joint_limits}, {"joint2", joint_limits}}, {});
+  {
+    const auto snapshot = controller.get_joint_limits_store()->read();
+    ASSERT_EQ(snapshot->version, 2u);
+    ASSERT_THAT(snapshot->hard_joint_limits, testing::SizeIs(2));
+    ASSERT_EQ(snapshot->hard_joint_limits.at("joint1").max_velocity, 2.0);
+  }
+  ASSERT_THAT(controller.get_hard_joint_limits(), testing::SizeIs(1));
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, robot_description_shared_by_the_controllers)
+{
+  rclcpp::init(0, nullptr);
+
+  const auto robot_description = std::make_shared<const std::string>("<robot name=\"test\"/>");
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "<robot name=\"copy\"/>";
+  params.shared_robot_description = robot_description;
+  params.update_rate = 100;
+  params.controller_manager_update_rate = 100;
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+
+  // the shared description is used instead of the copied one, without copying it
+  ASSERT_EQ(&controller.get_robot_description(), robot_description.get());
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
 TEST(TestableControllerInterfaceInitError, init_with_error)
 {
   char const * const argv[] = {""};
@@ -260,6 +331,597 @@ TEST(TestableControllerInterfaceInitFailure, init_with_failure)
   rclcpp::shutdown();
 }
 
+TEST(TestableControllerInterface, bulk_access_to_the_loaned_interfaces)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 10;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  controller.configure();
+
+  std::vector<double> state_values = {1.1, 2.2, 3.3};
+  std::vector<double> command_values = {0.0, 0.0};
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  std::vector<hardware_interface::LoanedCommandInterface> command_interfaces;
+  for (std::size_t i = 0; i < state_values.size(); ++i)
+  {
+    state_interfaces.emplace_back(
+      std::make_shared<hardware_interface::StateInterface>(
+        "joint" + std::to_string(i), "position", &state_values[i]));
+  }
+  for (std::size_t i = 0; i < command_values.size(); ++i)
+  {
+    command_interfaces.emplace_back(
+      std::make_shared<hardware_interface::CommandInterface>(
+        "joint" + std::to_string(i), "position", &command_values[i]));
+  }
+
+  // the data types are only checked at the activation
+  std::vector<double> states;
+  EXPECT_FALSE(controller.read_states(states));
+
+  controller.assign_interfaces(std::move(command_interfaces), std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  ASSERT_TRUE(controller.read_states(states));
+  EXPECT_THAT(states, testing::ElementsAre(1.1, 2.2, 3.3));
+  state_values[1] = 4.4;
+  ASSERT_TRUE(controller.read_states(states));
+  EXPECT_THAT(states, testing::ElementsAre(1.1, 4.4, 3.3));
+
+  EXPECT_FALSE(controller.write_commands({1.0}));
+  EXPECT_THAT(command_values, testing::ElementsAre(0.0, 0.0));
+  ASSERT_TRUE(controller.write_commands({1.0, -2.0}));
+  EXPECT_THAT(command_values, testing::ElementsAre(1.0, -2.0));
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, state_interfaces_narrowed_to_float32)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides(
+    {{"is_async", true}, {"async_parameters.use_interface_frames", true}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+
+  // as done by the float32_state_interface_storage option of the resource manager
+  hardware_interface::InterfaceInfo info;
+  info.name = "position";
+  info.data_type = "double";
+  info.initial_value = "1.5";
+  auto position = std::make_shared<hardware_interface::StateInterface>(
+    hardware_interface::InterfaceDescription{"joint0", info});
+  position->narrow_to_float32();
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  state_interfaces.emplace_back(position);
+  controller.assign_interfaces({}, std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  std::vector<double> states;
+  ASSERT_TRUE(controller.read_states(states));
+  EXPECT_THAT(states, testing::ElementsAre(1.5));
+  controller_interface::StateInterfacesFrame frame;
+  ASSERT_TRUE(controller.read_state_interfaces_frame(frame));
+  EXPECT_THAT(frame.values, testing::ElementsAre(1.5));
+
+  ASSERT_TRUE(position->set_value(2.5));
+  std::vector<double> sampled_states;
+  controller.on_update = [&]() { sampled_states = controller.get_state_frame().values; };
+  const rclcpp::Time time(1, 0);
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  ASSERT_TRUE(controller.trigger_update(time, period).successful);
+  controller.wait_for_trigger_update_to_finish();
+  EXPECT_THAT(sampled_states, testing::ElementsAre(2.5));
+
+  controller.get_node()->deactivate();
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, skipping_the_updates_with_stale_states)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 10;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides(
+    {{"state_staleness.max_age", 0.05}, {"state_staleness.policy", "skip"}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  controller.configure();
+
+  double position = 1.0;
+  double reference = 2.0;
+  auto read_stamp = std::make_shared<hardware_interface::ReadStamp>();
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  state_interfaces.emplace_back(
+    std::make_shared<hardware_interface::StateInterface>("joint0", "position", &position),
+    read_stamp, nullptr);
+  // the states without a read stamp have no age
+  state_interfaces.emplace_back(
+    std::make_shared<hardware_interface::StateInterface>("chained", "reference", &reference));
+  controller.assign_interfaces({}, std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  const rclcpp::Time read_time(1, 0);
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  read_stamp->stamp(read_time);
+  auto status = controller.trigger_update(read_time + rclcpp::Duration::from_seconds(0.02), period);
+  EXPECT_TRUE(status.successful);
+  EXPECT_EQ(controller.updates, 1u);
+  EXPECT_EQ(controller.get_state_age(), rclcpp::Duration::from_seconds(0.02));
+
+  // the component wasn't read again
+  status = controller.trigger_update(read_time + rclcpp::Duration::from_seconds(0.1), period);
+  EXPECT_FALSE(status.successful);
+  EXPECT_EQ(status.result, controller_interface::return_type::OK);
+  EXPECT_EQ(controller.updates, 1u);
+  EXPECT_EQ(controller.get_state_age(), rclcpp::Duration::from_seconds(0.1));
+
+  read_stamp->stamp(read_time + rclcpp::Duration::from_seconds(0.1));
+  status = controller.trigger_update(read_time + rclcpp::Duration::from_seconds(0.11), period);
+  EXPECT_TRUE(status.successful);
+  EXPECT_EQ(controller.updates, 2u);
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, updating_only_when_a_trigger_interface_was_updated)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides(
+    {{"event_trigger.interfaces", std::vector<std::string>{"camera/frame", "chained/reference"}},
+     {"event_trigger.max_age", 0.1}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  controller.configure();
+
+  double frame = 1.0;
+  double position = 0.0;
+  auto read_stamp = std::make_shared<hardware_interface::ReadStamp>();
+  auto reference = std::make_shared<hardware_interface::StateInterface>(
+    "chained", "reference", "double", "0.0");
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  state_interfaces.emplace_back(
+    std::make_shared<hardware_interface::StateInterface>("joint0", "position", &position));
+  state_interfaces.emplace_back(
+    std::make_shared<hardware_interface::StateInterface>("camera", "frame", &frame), read_stamp,
+    nullptr);
+  // the states without a read stamp trigger the update when their value changes
+  state_interfaces.emplace_back(reference);
+  controller.assign_interfaces({}, std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_TRUE(controller.is_event_driven());
+
+  const rclcpp::Time time(1, 0);
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  read_stamp->stamp(time);
+  // the first trigger after the activation always updates the controller
+  auto status = controller.trigger_update(time, period);
+  EXPECT_TRUE(status.successful);
+  EXPECT_EQ(controller.updates, 1u);
+
+  status = controller.trigger_update(time + period, period);
+  EXPECT_FALSE(status.successful);
+  EXPECT_EQ(status.result, controller_interface::return_type::OK);
+  EXPECT_EQ(controller.updates, 1u);
+
+  // the camera was read again, the update integrates over the skipped cycle
+  read_stamp->stamp(time + period * 2);
+  status = controller.trigger_update(time + period * 2, period);
+  EXPECT_TRUE(status.successful);
+  ASSERT_EQ(controller.updates, 2u);
+  EXPECT_EQ(controller.update_periods.back(), period * 2);
+
+  ASSERT_TRUE(reference->set_value(1.0));
+  status = controller.trigger_update(time + period * 3, period);
+  EXPECT_TRUE(status.successful);
+  EXPECT_EQ(controller.updates, 3u);
+
+  // no trigger interface was updated for the maximal age
+  status = controller.trigger_update(time + period * 12, period);
+  EXPECT_FALSE(status.successful);
+  status = controller.trigger_update(time + period * 13, period);
+  EXPECT_TRUE(status.successful);
+  ASSERT_EQ(controller.updates, 4u);
+  EXPECT_EQ(controller.update_periods.back(), period * 10);
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, trigger_interfaces_have_to_be_loaned)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides(
+    {{"event_trigger.interfaces", std::vector<std::string>{"camera/frame"}}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+
+  EXPECT_NE(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_FALSE(controller.is_event_driven());
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, edge_events_of_the_loaned_state_interfaces)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  auto edge_events = std::make_shared<hardware_interface::EdgeEventList>(8);
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.edge_events = edge_events;
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  controller.configure();
+
+  double button = 0.0;
+  double limit_switch = 0.0;
+  double other_input = 0.0;
+  auto other_input_interface =
+    std::make_shared<hardware_interface::StateInterface>("gpio", "other_input", &other_input);
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  state_interfaces.emplace_back(
+    std::make_shared<hardware_interface::StateInterface>("gpio", "button", &button));
+  state_interfaces.emplace_back(
+    std::make_shared<hardware_interface::StateInterface>("gpio", "limit_switch", &limit_switch));
+  controller.assign_interfaces({}, std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  edge_events->push({hardware_interface::NamePool::find("gpio/limit_switch"), true, 10});
+  edge_events->push({other_input_interface->get_name_id(), true, 20});
+  const auto & events = controller.get_edge_events();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(controller.get_edge_event_state_index(events[0]), 1u);
+  EXPECT_EQ(events[0].stamp, 10);
+  // the events of the interfaces not loaned by the controller are ignored
+  EXPECT_EQ(controller.get_edge_event_state_index(events[1]), 2u);
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, latencies_of_the_interface_frames)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides(
+    {{"is_async", true}, {"async_parameters.use_interface_frames", true}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+
+  double position = 1.0;
+  double command = 0.0;
+  std::vector<hardware_interface::LoanedCommandInterface> command_interfaces;
+  command_interfaces.emplace_back(
+    std::make_shared<hardware_interface::CommandInterface>("joint0", "position", &command));
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  state_interfaces.emplace_back(
+    std::make_shared<hardware_interface::StateInterface>("joint0", "position", &position));
+  controller.assign_interfaces(std::move(command_interfaces), std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  const rclcpp::Time time(1, 0);
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  auto status = controller.trigger_update(time, period);
+  ASSERT_TRUE(status.successful);
+  EXPECT_TRUE(status.stage_time.has_value());
+  // no commands were computed yet
+  EXPECT_FALSE(status.command_latency.has_value());
+  controller.wait_for_trigger_update_to_finish();
+
+  // the commands computed from the states of the first trigger are fetched by the next one
+  status = controller.trigger_update(time + period + period, period);
+  EXPECT_TRUE(status.stage_time.has_value());
+  ASSERT_TRUE(status.command_latency.has_value());
+  EXPECT_EQ(status.command_latency.value(), period + period);
+  controller.wait_for_trigger_update_to_finish();
+
+  controller.get_node()->deactivate();
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, joined_update_commits_its_commands_in_the_same_cycle)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides(
+    {{"is_async", true},
+     {"async_parameters.use_interface_frames", true},
+     {"async_parameters.join_deadline", 1.0}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  EXPECT_TRUE(controller.is_async_update_joined());
+
+  double position = 1.0;
+  double command = 0.0;
+  std::vector<hardware_interface::LoanedCommandInterface> command_interfaces;
+  command_interfaces.emplace_back(
+    std::make_shared<hardware_interface::CommandInterface>("joint0", "position", &command));
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  state_interfaces.emplace_back(
+    std::make_shared<hardware_interface::StateInterface>("joint0", "position", &position));
+  controller.assign_interfaces(std::move(command_interfaces), std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  const rclcpp::Time time(1, 0);
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  // nothing to join before the first trigger
+  EXPECT_TRUE(controller.join_async_update());
+  auto status = controller.trigger_update(time, period);
+  ASSERT_TRUE(status.successful);
+  EXPECT_TRUE(controller.join_async_update());
+  EXPECT_EQ(controller.updates, 1u);
+
+  // the commands were committed by the join, not by the next trigger
+  status = controller.trigger_update(time + period, period);
+  ASSERT_TRUE(status.successful);
+  EXPECT_FALSE(status.command_latency.has_value());
+  EXPECT_TRUE(controller.join_async_update());
+
+  controller.get_node()->deactivate();
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, join_deadline_requires_interface_frames)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides(
+    {{"is_async", true}, {"async_parameters.join_deadline", 0.001}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED);
+  EXPECT_FALSE(controller.is_async_update_joined());
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, sub_steps_divide_the_period_of_the_trigger)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 1000;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides({{"sub_steps", 4}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  EXPECT_EQ(controller.get_sub_steps(), 4u);
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  const rclcpp::Time time(1, 0);
+  const auto status = controller.trigger_update(time, rclcpp::Duration::from_seconds(0.001));
+  EXPECT_TRUE(status.successful);
+  EXPECT_EQ(status.period, rclcpp::Duration::from_seconds(0.001));
+  ASSERT_EQ(controller.updates, 4u);
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    EXPECT_EQ(controller.update_periods[i], rclcpp::Duration::from_nanoseconds(250000));
+    EXPECT_EQ(controller.update_times[i], time + rclcpp::Duration::from_nanoseconds(250000 * i));
+  }
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, trigger_update_with_the_cycle_context)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_EQ(controller.get_cycle_context().index, 0u);
+
+  hardware_interface::CycleContext cycle;
+  cycle.ros_time = rclcpp::Time(2, 0);
+  cycle.period = rclcpp::Duration::from_seconds(0.001);
+  cycle.index = 7;
+  cycle.overrun = true;
+  // the controller runs at a lower rate than the cycles
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  const auto status = controller.trigger_update(cycle, period);
+  EXPECT_TRUE(status.successful);
+  ASSERT_EQ(controller.updates, 1u);
+  EXPECT_EQ(controller.update_times[0], cycle.ros_time);
+  EXPECT_EQ(controller.update_periods[0], period);
+  EXPECT_EQ(controller.get_cycle_context().index, 7u);
+  EXPECT_TRUE(controller.get_cycle_context().overrun);
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, parallel_for_on_the_worker_pool)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  hardware_interface::RTWorkerPoolParams pool_params;
+  pool_params.number_of_workers = 2;
+  auto pool = std::make_shared<hardware_interface::RTWorkerPool>(pool_params);
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 100;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.worker_pool = pool;
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  std::array<int, 8> executed{};
+  controller.on_update = [&]()
+  { controller.parallel_for(executed.size(), [&](std::size_t i) { executed[i]++; }); };
+  auto status = controller.trigger_update(rclcpp::Time(1, 0), rclcpp::Duration::from_seconds(0.01));
+  EXPECT_THAT(executed, testing::Each(1));
+  ASSERT_TRUE(status.parallel_time.has_value());
+  ASSERT_TRUE(status.parallel_task_time.has_value());
+  EXPECT_LE(status.parallel_task_time.value(), status.parallel_time.value());
+
+  // all the tasks of a group are executed, the first exception is rethrown
+  const std::vector<std::function<void()>> tasks = {
+    [&]() { executed[0]++; }, []() { throw std::runtime_error("task failed"); },
+    [&]() { executed[2]++; }};
+  EXPECT_THROW(controller.run_task_group(tasks), std::runtime_error);
+  EXPECT_EQ(executed[0], 2);
+  EXPECT_EQ(executed[2], 2);
+
+  // the tasks are executed by the calling thread while the pool is busy
+  int nested_tasks = 0;
+  pool->parallel_for(
+    1, [&](std::size_t) { controller.parallel_for(3, [&](std::size_t) { ++nested_tasks; }); });
+  EXPECT_EQ(nested_tasks, 3);
+
+  // the statistics are only set for the updates calling parallel_for()
+  controller.on_update = nullptr;
+  status =
+    controller.trigger_update(rclcpp::Time(1, 10000000), rclcpp::Duration::from_seconds(0.01));
+  EXPECT_FALSE(status.parallel_time.has_value());
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, invalid_sub_steps)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 1000;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  params.node_options.parameter_overrides({{"sub_steps", 2}, {"is_async", true}});
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  // the asynchronous controllers can't be sub-stepped
+  EXPECT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED);
+
+  controller.get_node()->set_parameter({"is_async", false});
+  controller.get_node()->set_parameter({"sub_steps", 0});
+  EXPECT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED);
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
 TEST(TestableControllerInterface, default_returns_for_chainable_controllers_methods)
 {
   char const * const argv[] = {""};
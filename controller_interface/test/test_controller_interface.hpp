@@ -15,6 +15,9 @@
 #ifndef TEST_CONTROLLER_INTERFACE_HPP_
 #define TEST_CONTROLLER_INTERFACE_HPP_
 
+#include <functional>
+#include <vector>
+
 #include "controller_interface/controller_interface.hpp"
 
 constexpr char TEST_CONTROLLER_NAME[] = "testable_controller_interface";
@@ -22,6 +25,12 @@ constexpr char TEST_CONTROLLER_NAME[] = "testable_controller_interface";
 class TestableControllerInterface : public controller_interface::ControllerInterface
 {
 public:
+  using controller_interface::ControllerInterfaceBase::get_state_age;
+  using controller_interface::ControllerInterfaceBase::get_state_frame;
+  using controller_interface::ControllerInterfaceBase::read_state_interfaces_frame;
+  using controller_interface::ControllerInterfaceBase::read_states;
+  using controller_interface::ControllerInterfaceBase::write_commands;
+
   controller_interface::CallbackReturn on_init() override
   {
     return controller_interface::CallbackReturn::SUCCESS;
@@ -40,10 +49,23 @@ public:
   }
 
   controller_interface::return_type update(
-    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+    const rclcpp::Time & time, const rclcpp::Duration & period) override
   {
+    ++updates;
+    update_times.push_back(time);
+    update_periods.push_back(period);
+    if (on_update)
+    {
+      on_update();
+    }
     return controller_interface::return_type::OK;
   }
+
+  /// Called by the update, if set
+  std::function<void()> on_update = nullptr;
+  std::size_t updates = 0;
+  std::vector<rclcpp::Time> update_times;
+  std::vector<rclcpp::Duration> update_periods;
 };
 
 class TestableControllerInterfaceInitError : public TestableControllerInterface
@@ -0,0 +1,104 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "controller_interface/helpers.hpp"
+#include "gmock/gmock.h"
+#include "hardware_interface/handle.hpp"
+
+namespace
+{
+using hardware_interface::StateInterface;
+
+class TestGetOrderedInterfaces : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    interfaces_.emplace_back("joint2", "velocity", &values_[0]);
+    interfaces_.emplace_back("joint1", "position", &values_[1]);
+    interfaces_.emplace_back("joint2", "position", &values_[2]);
+    interfaces_.emplace_back("joint1", "velocity", &values_[3]);
+  }
+
+  double values_[4] = {0.0, 1.0, 2.0, 3.0};
+  std::vector<StateInterface> interfaces_;
+};
+}  // namespace
+
+TEST_F(TestGetOrderedInterfaces, orders_by_joint_names_and_interface_type)
+{
+  std::vector<std::reference_wrapper<StateInterface>> ordered;
+  ordered.reserve(2);
+  ASSERT_TRUE(controller_interface::get_ordered_interfaces(
+    interfaces_, {"joint1", "joint2"}, "position", ordered));
+  ASSERT_EQ(ordered.size(), 2u);
+  EXPECT_EQ(ordered[0].get().get_name(), "joint1/position");
+  EXPECT_EQ(ordered[1].get().get_name(), "joint2/position");
+}
+
+TEST_F(TestGetOrderedInterfaces, orders_by_full_interface_names)
+{
+  std::vector<std::reference_wrapper<StateInterface>> ordered;
+  ordered.reserve(3);
+  ASSERT_TRUE(controller_interface::get_ordered_interfaces(
+    interfaces_, {"joint1/velocity", "joint2/velocity", "joint1/position"}, "", ordered));
+  ASSERT_EQ(ordered.size(), 3u);
+  EXPECT_EQ(ordered[0].get().get_name(), "joint1/velocity");
+  EXPECT_EQ(ordered[1].get().get_name(), "joint2/velocity");
+  EXPECT_EQ(ordered[2].get().get_name(), "joint1/position");
+}
+
+TEST_F(TestGetOrderedInterfaces, reports_missing_interfaces)
+{
+  std::vector<std::reference_wrapper<StateInterface>> ordered;
+  ordered.reserve(2);
+  EXPECT_FALSE(controller_interface::get_ordered_interfaces(
+    interfaces_, {"joint1", "joint3"}, "position", ordered));
+  EXPECT_EQ(ordered.size(), 1u);
+}
+
+TEST_F(TestGetOrderedInterfaces, throws_if_capacity_is_insufficient)
+{
+  std::vector<std::reference_wrapper<StateInterface>> ordered;
+  EXPECT_THROW(
+    controller_interface::get_ordered_interfaces(
+      interfaces_, {"joint1", "joint2"}, "position", ordered),
+    std::range_error);
+}
+
+TEST_F(TestGetOrderedInterfaces, reuses_prebuilt_interface_index)
+{
+  const auto interface_index = controller_interface::build_interface_index(interfaces_);
+  ASSERT_EQ(interface_index.size(), interfaces_.size());
+
+  std::vector<std::reference_wrapper<StateInterface>> positions;
+  positions.reserve(2);
+  ASSERT_TRUE(controller_interface::get_ordered_interfaces(
+    interface_index, {"joint2", "joint1"}, "position", positions));
+  EXPECT_EQ(positions[0].get().get_name(), "joint2/position");
+  EXPECT_EQ(positions[1].get().get_name(), "joint1/position");
+
+  std::vector<std::reference_wrapper<StateInterface>> velocities;
+  velocities.reserve(2);
+  ASSERT_TRUE(controller_interface::get_ordered_interfaces(
+    interface_index, {"joint2", "joint1"}, "velocity", velocities));
+  EXPECT_EQ(velocities[0].get().get_name(), "joint2/velocity");
+  EXPECT_EQ(velocities[1].get().get_name(), "joint1/velocity");
+  EXPECT_DOUBLE_EQ(velocities[1].get().get_optional().value(), 3.0);
+}
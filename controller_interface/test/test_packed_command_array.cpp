@@ -0,0 +1,134 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/packed_interface_values.hpp"
+#include "semantic_components/packed_command_array.hpp"
+
+using hardware_interface::CommandInterface;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceInfo;
+using semantic_components::PackedCommandArray;
+
+namespace
+{
+std::vector<CommandInterface::SharedPtr> make_interfaces(
+  const std::string & name, std::size_t size, const std::string & data_type)
+{
+  std::vector<CommandInterface::SharedPtr> interfaces;
+  for (auto i = 0u; i < size; ++i)
+  {
+    InterfaceInfo info;
+    info.name = std::to_string(i + 1);
+    info.data_type = data_type;
+    interfaces.push_back(std::make_shared<CommandInterface>(InterfaceDescription(name, info)));
+  }
+  return interfaces;
+}
+
+std::vector<hardware_interface::LoanedCommandInterface> loan(
+  const std::vector<CommandInterface::SharedPtr> & interfaces)
+{
+  std::vector<hardware_interface::LoanedCommandInterface> loaned_interfaces;
+  loaned_interfaces.reserve(interfaces.size());
+  for (const auto & interface : interfaces)
+  {
+    loaned_interfaces.emplace_back(interface);
+  }
+  return loaned_interfaces;
+}
+}  // namespace
+
+TEST(TestPackedCommandArray, bool_commands_are_packed_as_bits)
+{
+  PackedCommandArray<bool> outputs("valves", 10);
+  ASSERT_EQ(10u, outputs.get_command_interface_names().size());
+  EXPECT_EQ("valves/10", outputs.get_command_interface_names().back());
+  ASSERT_EQ(2u, outputs.get_packed_size());
+
+  const auto interfaces = make_interfaces("valves", 10, "bool");
+  auto loaned_interfaces = loan(interfaces);
+  ASSERT_TRUE(outputs.assign_loaned_command_interfaces(loaned_interfaces));
+
+  // valves 1, 3 and 10
+  std::array<uint8_t, 2> packed = {{0b00000101, 0b00000010}};
+  ASSERT_FALSE(outputs.set_packed_values(packed.data(), 1u));
+  ASSERT_TRUE(outputs.set_packed_values(packed.data(), packed.size()));
+  for (auto i = 0u; i < interfaces.size(); ++i)
+  {
+    EXPECT_EQ(i == 0u || i == 2u || i == 9u, interfaces[i]->get_optional<bool>().value()) << i;
+  }
+
+  // the hardware component reads the commands back as a packed buffer
+  const hardware_interface::PackedInterfaceReader<bool> reader(interfaces);
+  std::array<uint8_t, 2> received = {{0u, 0u}};
+  ASSERT_EQ(2u, reader.get_packed_size());
+  ASSERT_TRUE(reader.read(received.data()));
+  EXPECT_EQ(packed, received);
+
+  // a locked interface is written at the next call
+  packed = {{0b00000100, 0b00000011}};
+  {
+    std::unique_lock<std::shared_mutex> lock(interfaces[8]->get_mutex());
+    EXPECT_FALSE(outputs.set_packed_values(packed.data(), packed.size()));
+  }
+  EXPECT_FALSE(interfaces[0]->get_optional<bool>().value());
+  EXPECT_FALSE(interfaces[8]->get_optional<bool>().value());
+  ASSERT_TRUE(outputs.set_values_from_message({packed.begin(), packed.end()}));
+  EXPECT_TRUE(interfaces[8]->get_optional<bool>().value());
+  ASSERT_TRUE(reader.read(received.data()));
+  EXPECT_EQ(packed, received);
+
+  // the unchanged commands are only written again once invalidated
+  ASSERT_TRUE(interfaces[2]->set_value(false));
+  ASSERT_TRUE(outputs.set_packed_values(packed.data(), packed.size()));
+  EXPECT_FALSE(interfaces[2]->get_optional<bool>().value());
+  outputs.invalidate_written_values();
+  ASSERT_TRUE(outputs.set_packed_values(packed.data(), packed.size()));
+  EXPECT_TRUE(interfaces[2]->get_optional<bool>().value());
+}
+
+TEST(TestPackedCommandArray, uint8_commands_are_packed_as_bytes)
+{
+  PackedCommandArray<uint8_t> dimmers("dimmers", {"dimmers/1", "dimmers/2", "dimmers/3"});
+  ASSERT_EQ(3u, dimmers.get_packed_size());
+  const auto interfaces = make_interfaces("dimmers", 3, "uint8");
+  auto loaned_interfaces = loan(interfaces);
+  ASSERT_TRUE(dimmers.assign_loaned_command_interfaces(loaned_interfaces));
+
+  const std::vector<uint8_t> levels = {0u, 128u, 255u};
+  ASSERT_TRUE(dimmers.set_values_from_message(levels));
+  EXPECT_EQ(128u, interfaces[1]->get_optional<uint8_t>().value());
+
+  const hardware_interface::PackedInterfaceReader<uint8_t> reader(interfaces);
+  std::vector<uint8_t> received(reader.get_packed_size());
+  ASSERT_TRUE(reader.read(received.data()));
+  EXPECT_EQ(levels, received);
+
+  // the interfaces of another type are rejected
+  PackedCommandArray<bool> outputs("dimmers", 3);
+  EXPECT_FALSE(outputs.assign_loaned_command_interfaces(loaned_interfaces));
+  EXPECT_FALSE(outputs.set_values_from_message({0u}));
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "controller_interface/parameter_snapshot.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+namespace
+{
+struct Params
+{
+  double gain = 1.0;
+  double offset = 0.0;
+};
+
+/// Validates the gain like a listener of generate_parameter_library
+class FakeParamListener
+{
+public:
+  explicit FakeParamListener(const std::shared_ptr<rclcpp_lifecycle::LifecycleNode> & node)
+  {
+    node->declare_parameter("gain", params_.gain);
+    callback_handle_ = node->add_on_set_parameters_callback(
+      [this](const std::vector<rclcpp::Parameter> & parameters)
+      {
+        rcl_interfaces::msg::SetParametersResult result;
+        result.successful = true;
+        for (const auto & parameter : parameters)
+        {
+          if (parameter.get_name() == "gain")
+          {
+            result.successful = parameter.as_double() >= 0.0;
+            if (result.successful)
+            {
+              params_.gain = parameter.as_double();
+            }
+          }
+        }
+        return result;
+      });
+  }
+
+  Params get_params() const { return params_; }
+
+private:
+  Params params_;
+  rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr callback_handle_;
+};
+}  // namespace
+
+using controller_interface::ParameterSnapshot;
+
+class TestParameterSnapshot : public ::testing::Test
+{
+public:
+  static void SetUpTestCase() { rclcpp::init(0, nullptr); }
+
+  static void TearDownTestCase() { rclcpp::shutdown(); }
+};
+
+TEST_F(TestParameterSnapshot, publishes_new_snapshots)
+{
+  ParameterSnapshot<Params> snapshot(Params{2.0, 0.5});
+  EXPECT_EQ(snapshot.get_version(), 0u);
+  {
+    const auto params = snapshot.read();
+    ASSERT_TRUE(params);
+    EXPECT_DOUBLE_EQ(params->gain, 2.0);
+    EXPECT_DOUBLE_EQ(params->offset, 0.5);
+  }
+  snapshot.publish(Params{3.0, 1.5});
+  EXPECT_EQ(snapshot.get_version(), 1u);
+  EXPECT_DOUBLE_EQ(snapshot.read()->gain, 3.0);
+  EXPECT_DOUBLE_EQ(snapshot.read()->offset, 1.5);
+}
+
+TEST_F(TestParameterSnapshot, readers_see_consistent_snapshots)
+{
+  ParameterSnapshot<Params> snapshot(Params{0.0, 0.0});
+  std::atomic<bool> stop{false};
+  std::atomic<uint64_t> inconsistent_reads{0u};
+  std::thread reader(
+    [&]()
+    {
+      while (!stop)
+      {
+        const auto params = snapshot.read();
+        // every snapshot is published with offset == -gain
+        inconsistent_reads += params->gain != -params->offset;
+      }
+    });
+  for (int i = 1; i <= 1000; ++i)
+  {
+    snapshot.publish(Params{static_cast<double>(i), -static_cast<double>(i)});
+  }
+  stop = true;
+  reader.join();
+  EXPECT_EQ(inconsistent_reads, 0u);
+  EXPECT_EQ(snapshot.get_version(), 1000u);
+  EXPECT_DOUBLE_EQ(snapshot.read()->gain, 1000.0);
+}
+
+TEST_F(TestParameterSnapshot, tracks_the_validated_parameters)
+{
+  const auto node = std::make_shared<rclcpp_lifecycle::LifecycleNode>("test_parameter_snapshot");
+  const auto listener = std::make_shared<FakeParamListener>(node);
+  ParameterSnapshot<Params> snapshot;
+  snapshot.track(node, listener);
+  EXPECT_EQ(snapshot.get_version(), 1u);
+
+  ASSERT_TRUE(node->set_parameter(rclcpp::Parameter("gain", 4.0)).successful);
+  EXPECT_EQ(snapshot.get_version(), 2u);
+  EXPECT_DOUBLE_EQ(snapshot.read()->gain, 4.0);
+
+  // the rejected parameters are not published
+  ASSERT_FALSE(node->set_parameter(rclcpp::Parameter("gain", -1.0)).successful);
+  EXPECT_EQ(snapshot.get_version(), 2u);
+  EXPECT_DOUBLE_EQ(snapshot.read()->gain, 4.0);
+
+  snapshot.untrack();
+  ASSERT_TRUE(node->set_parameter(rclcpp::Parameter("gain", 5.0)).successful);
+  EXPECT_EQ(snapshot.get_version(), 2u);
+  EXPECT_DOUBLE_EQ(snapshot.read()->gain, 4.0);
+}
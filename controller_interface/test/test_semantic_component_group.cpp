@@ -0,0 +1,147 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "semantic_components/force_torque_sensor.hpp"
+#include "semantic_components/imu_sensor.hpp"
+#include "semantic_components/semantic_component_group.hpp"
+
+using semantic_components::ForceTorqueSensor;
+using semantic_components::FrameTransform;
+using semantic_components::IMUSensor;
+
+namespace
+{
+const std::vector<std::string> fts_interface_names = {
+  {"force.x", "force.y", "force.z", "torque.x", "torque.y", "torque.z"}};
+const std::vector<std::string> imu_interface_names = {
+  {"orientation.x", "orientation.y", "orientation.z", "orientation.w", "angular_velocity.x",
+   "angular_velocity.y", "angular_velocity.z", "linear_acceleration.x", "linear_acceleration.y",
+   "linear_acceleration.z"}};
+constexpr double EPSILON = 1e-12;
+}  // namespace
+
+TEST(SemanticComponentGroupTest, messages_of_all_the_components_from_one_read)
+{
+  semantic_components::SemanticComponentGroup<ForceTorqueSensor, geometry_msgs::msg::Wrench> group(
+    {"fts_1", "fts_2"});
+  ASSERT_EQ(group.size(), 2u);
+
+  const auto interface_names = group.get_state_interface_names();
+  ASSERT_EQ(interface_names.size(), 12u);
+  EXPECT_EQ(interface_names[0], "fts_1/force.x");
+  EXPECT_EQ(interface_names[11], "fts_2/torque.z");
+
+  std::array<double, 12> values = {
+    {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0}};
+  std::vector<hardware_interface::StateInterface::SharedPtr> interfaces;
+  std::vector<hardware_interface::LoanedStateInterface> loaned_interfaces;
+  loaned_interfaces.reserve(values.size());
+  // the interfaces of the second sensor are loaned first
+  for (const std::string sensor : {"fts_2", "fts_1"})
+  {
+    const std::size_t offset = sensor == "fts_1" ? 0 : 6;
+    for (auto i = 0u; i < fts_interface_names.size(); ++i)
+    {
+      interfaces.push_back(
+        std::make_shared<hardware_interface::StateInterface>(
+          sensor, fts_interface_names[i], &values[offset + i]));
+      loaned_interfaces.emplace_back(interfaces.back());
+    }
+  }
+  ASSERT_TRUE(group.assign_loaned_state_interfaces(loaned_interfaces));
+
+  // the messages have to be preallocated
+  std::vector<geometry_msgs::msg::Wrench> messages;
+  EXPECT_FALSE(group.get_values_as_messages(messages));
+  messages.resize(group.size());
+  ASSERT_TRUE(group.get_values_as_messages(messages));
+  EXPECT_EQ(messages[0].force.x, 1.0);
+  EXPECT_EQ(messages[0].torque.z, 6.0);
+  EXPECT_EQ(messages[1].force.x, 7.0);
+  EXPECT_EQ(messages[1].torque.z, 12.0);
+
+  group.release_interfaces();
+  EXPECT_FALSE(group.get_values_as_messages(messages));
+  EXPECT_EQ(messages[1].force.x, 7.0);
+}
+
+TEST(SemanticComponentGroupTest, messages_are_transformed_to_the_common_frame)
+{
+  semantic_components::SemanticComponentGroup<ForceTorqueSensor, geometry_msgs::msg::Wrench>
+    wrench_group({"fts"});
+  semantic_components::SemanticComponentGroup<IMUSensor, sensor_msgs::msg::Imu> imu_group({"imu"});
+
+  std::array<double, 6> fts_values = {{1.0, 0.0, 0.0, 0.0, 0.0, 0.0}};
+  std::array<double, 10> imu_values = {{0.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 9.81}};
+  std::vector<hardware_interface::StateInterface::SharedPtr> interfaces;
+  std::vector<hardware_interface::LoanedStateInterface> loaned_interfaces;
+  loaned_interfaces.reserve(fts_values.size() + imu_values.size());
+  for (auto i = 0u; i < fts_interface_names.size(); ++i)
+  {
+    interfaces.push_back(
+      std::make_shared<hardware_interface::StateInterface>(
+        "fts", fts_interface_names[i], &fts_values[i]));
+    loaned_interfaces.emplace_back(interfaces.back());
+  }
+  for (auto i = 0u; i < imu_interface_names.size(); ++i)
+  {
+    interfaces.push_back(
+      std::make_shared<hardware_interface::StateInterface>(
+        "imu", imu_interface_names[i], &imu_values[i]));
+    loaned_interfaces.emplace_back(interfaces.back());
+  }
+  ASSERT_TRUE(wrench_group.assign_loaned_state_interfaces(loaned_interfaces));
+  ASSERT_TRUE(imu_group.assign_loaned_state_interfaces(loaned_interfaces));
+
+  // the sensors are rotated by 90 degrees around z, the force-torque sensor is 1 m along x
+  const double half_angle = M_PI / 4.0;
+  EXPECT_THROW(wrench_group.set_frame_transform(1, FrameTransform()), std::out_of_range);
+  wrench_group.set_frame_transform(
+    0, FrameTransform({{0.0, 0.0, std::sin(half_angle), std::cos(half_angle)}}, {{1.0, 0.0, 0.0}}));
+  imu_group.set_frame_transform(
+    0, FrameTransform({{0.0, 0.0, std::sin(half_angle), std::cos(half_angle)}}, {{0.0, 0.0, 0.0}}));
+
+  std::vector<geometry_msgs::msg::Wrench> wrenches(1);
+  ASSERT_TRUE(wrench_group.get_values_as_messages(wrenches));
+  EXPECT_NEAR(wrenches[0].force.x, 0.0, EPSILON);
+  EXPECT_NEAR(wrenches[0].force.y, 1.0, EPSILON);
+  EXPECT_NEAR(wrenches[0].force.z, 0.0, EPSILON);
+  // the force applied at the sensor has a moment around the origin of the common frame
+  EXPECT_NEAR(wrenches[0].torque.x, 0.0, EPSILON);
+  EXPECT_NEAR(wrenches[0].torque.y, 0.0, EPSILON);
+  EXPECT_NEAR(wrenches[0].torque.z, 1.0, EPSILON);
+
+  std::vector<sensor_msgs::msg::Imu> imus(1);
+  ASSERT_TRUE(imu_group.get_values_as_messages(imus));
+  EXPECT_NEAR(imus[0].orientation.z, std::sin(half_angle), EPSILON);
+  EXPECT_NEAR(imus[0].orientation.w, std::cos(half_angle), EPSILON);
+  EXPECT_NEAR(imus[0].angular_velocity.x, 0.0, EPSILON);
+  EXPECT_NEAR(imus[0].angular_velocity.y, 1.0, EPSILON);
+  EXPECT_NEAR(imus[0].linear_acceleration.z, 9.81, EPSILON);
+
+  // without the transforms, the messages are in the frames of the sensors
+  wrench_group.clear_frame_transforms();
+  ASSERT_TRUE(wrench_group.get_values_as_messages(wrenches));
+  EXPECT_EQ(wrenches[0].force.x, 1.0);
+  EXPECT_EQ(wrenches[0].torque.z, 0.0);
+}
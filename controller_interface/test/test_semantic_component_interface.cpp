@@ -18,7 +18,10 @@
 
 #include "test_semantic_component_interface.hpp"
 
+#include <array>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -138,3 +141,38 @@ TEST_F(SemanticComponentInterfaceTest, validate_state_interfaces)
       semantic_component_->interface_names_.begin(), semantic_component_->interface_names_.end(),
       interface_names.begin(), interface_names.end()));
 }
+
+TEST_F(SemanticComponentInterfaceTest, values_are_read_in_one_block)
+{
+  semantic_component_ = std::make_unique<TestableSemanticComponentInterface>(3);
+
+  std::array<double, 3> interface_values = {{1.1, 2.2, 3.3}};
+  std::vector<hardware_interface::StateInterface::SharedPtr> interfaces;
+  std::vector<hardware_interface::LoanedStateInterface> loaned_interfaces;
+  loaned_interfaces.reserve(3);
+  for (auto i = 0u; i < 3u; ++i)
+  {
+    interfaces.push_back(
+      std::make_shared<hardware_interface::StateInterface>(
+        "TestSemanticComponent", "i" + std::to_string(i + 5), &interface_values[i]));
+    loaned_interfaces.emplace_back(interfaces.back());
+  }
+  ASSERT_TRUE(semantic_component_->assign_loaned_state_interfaces(loaned_interfaces));
+
+  std::array<double, 3> values = {{0.0, 0.0, 0.0}};
+  ASSERT_TRUE(semantic_component_->read_values(values.data()));
+  EXPECT_EQ(values, interface_values);
+
+  // a locked interface leaves the whole block unchanged
+  interface_values = {{4.4, 5.5, 6.6}};
+  {
+    std::unique_lock<std::shared_mutex> lock(interfaces[1]->get_mutex());
+    EXPECT_FALSE(semantic_component_->read_values(values.data()));
+  }
+  EXPECT_EQ(values[0], 1.1);
+  ASSERT_TRUE(semantic_component_->read_values(values.data()));
+  EXPECT_EQ(values, interface_values);
+
+  semantic_component_->release_interfaces();
+  EXPECT_FALSE(semantic_component_->read_values(values.data()));
+}
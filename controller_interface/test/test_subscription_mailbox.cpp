@@ -0,0 +1,105 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <memory>
+
+#include "controller_interface/subscription_mailbox.hpp"
+#include "rclcpp/executors/single_threaded_executor.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "std_msgs/msg/float64.hpp"
+
+using namespace std::chrono_literals;
+
+class TestSubscriptionMailbox : public ::testing::Test
+{
+public:
+  static void SetUpTestCase() { rclcpp::init(0, nullptr); }
+
+  static void TearDownTestCase() { rclcpp::shutdown(); }
+
+  void SetUp() override
+  {
+    node_ = std::make_shared<rclcpp_lifecycle::LifecycleNode>("test_subscription_mailbox");
+    publisher_ = node_->create_publisher<std_msgs::msg::Float64>("~/reference", 10);
+    publisher_->on_activate();
+    executor_.add_node(node_->get_node_base_interface());
+  }
+
+  void publish_and_spin(double value)
+  {
+    std_msgs::msg::Float64 message;
+    message.data = value;
+    const uint64_t received_count = mailbox_.get_received_count();
+    publisher_->publish(message);
+    const auto deadline = std::chrono::steady_clock::now() + 2s;
+    while (mailbox_.get_received_count() == received_count &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+      executor_.spin_some(10ms);
+    }
+  }
+
+protected:
+  std::shared_ptr<rclcpp_lifecycle::LifecycleNode> node_;
+  rclcpp_lifecycle::LifecyclePublisher<std_msgs::msg::Float64>::SharedPtr publisher_;
+  rclcpp::executors::SingleThreadedExecutor executor_;
+  controller_interface::SubscriptionMailbox<std_msgs::msg::Float64> mailbox_;
+};
+
+TEST_F(TestSubscriptionMailbox, initial_message_until_the_first_delivery)
+{
+  std_msgs::msg::Float64 initial_message;
+  initial_message.data = -1.0;
+  mailbox_.subscribe(node_, "~/reference", rclcpp::SystemDefaultsQoS(), initial_message);
+  EXPECT_FALSE(mailbox_.has_message());
+  EXPECT_FALSE(mailbox_.receive(node_->now()));
+  EXPECT_DOUBLE_EQ(mailbox_.get_message().data, -1.0);
+  EXPECT_EQ(mailbox_.get_delivered_count(), 0u);
+}
+
+TEST_F(TestSubscriptionMailbox, latest_message_is_delivered_once_with_its_age)
+{
+  mailbox_.subscribe(node_, "~/reference", rclcpp::SystemDefaultsQoS());
+  publish_and_spin(1.0);
+  publish_and_spin(2.0);
+  ASSERT_EQ(mailbox_.get_received_count(), 2u);
+
+  const rclcpp::Time update_time = node_->now();
+  ASSERT_TRUE(mailbox_.receive(update_time));
+  EXPECT_TRUE(mailbox_.has_message());
+  EXPECT_DOUBLE_EQ(mailbox_.get_message().data, 2.0);
+  EXPECT_EQ(mailbox_.get_delivery_time(), update_time);
+  EXPECT_LE(mailbox_.get_receive_time(), update_time);
+  EXPECT_EQ(mailbox_.get_delivered_count(), 1u);
+  EXPECT_EQ(mailbox_.get_overwritten_count(), 1u);
+  EXPECT_EQ(mailbox_.get_age_histogram().get_count(), 1u);
+  EXPECT_GE(mailbox_.get_age_histogram().get_percentile(100.0), 0.0);
+
+  // the delivered message is kept until a new one is received
+  EXPECT_FALSE(mailbox_.receive(node_->now()));
+  EXPECT_DOUBLE_EQ(mailbox_.get_message().data, 2.0);
+  EXPECT_EQ(mailbox_.get_delivered_count(), 1u);
+}
+
+TEST_F(TestSubscriptionMailbox, no_delivery_after_unsubscribing)
+{
+  mailbox_.subscribe(node_, "~/reference", rclcpp::SystemDefaultsQoS());
+  mailbox_.unsubscribe();
+  publish_and_spin(1.0);
+  EXPECT_EQ(mailbox_.get_received_count(), 0u);
+  EXPECT_FALSE(mailbox_.receive(node_->now()));
+}
@@ -0,0 +1,198 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "controller_interface/typed_controller_interface.hpp"
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/types/hardware_interface_type_values.hpp"
+
+using controller_interface::InterfaceField;
+using controller_interface::InterfaceFields;
+using controller_interface::InterfaceSchema;
+using hardware_interface::CommandInterface;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceInfo;
+using hardware_interface::StateInterface;
+
+namespace
+{
+constexpr char ENABLE_INTERFACE[] = "enable";
+
+using Position = InterfaceField<double, hardware_interface::HW_IF_POSITION>;
+using Velocity = InterfaceField<double, hardware_interface::HW_IF_VELOCITY>;
+using Enable = InterfaceField<bool, ENABLE_INTERFACE>;
+using TestSchema =
+  InterfaceSchema<2, InterfaceFields<Position, Enable>, InterfaceFields<Position, Velocity>>;
+
+class TestableTypedController : public controller_interface::TypedControllerInterface<TestSchema>
+{
+public:
+  using TypedControllerInterface::command_views_;
+  using TypedControllerInterface::set_joint_names;
+  using TypedControllerInterface::state_views_;
+
+  controller_interface::CallbackReturn on_init() override
+  {
+    return controller_interface::CallbackReturn::SUCCESS;
+  }
+
+  // follows the state position of every joint with the velocity in the period
+  controller_interface::return_type update(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & period) override
+  {
+    for (std::size_t i = 0; i < TestSchema::number_of_joints; ++i)
+    {
+      double position = 0.0;
+      double velocity = 0.0;
+      if (
+        !state_views_.get<Position>()[i].get(position) ||
+        !state_views_.get<Velocity>()[i].get(velocity) ||
+        !command_views_.get<Position>()[i].set(position + velocity * period.seconds()) ||
+        !command_views_.get<Enable>()[i].set(true))
+      {
+        return controller_interface::return_type::ERROR;
+      }
+    }
+    return controller_interface::return_type::OK;
+  }
+};
+
+static_assert(
+  std::is_same_v<
+    decltype(std::declval<TestableTypedController::CommandViews &>().get<Enable>()),
+    std::array<hardware_interface::LoanedCommandView<bool>, 2> &>);
+
+template <typename InterfaceT>
+std::shared_ptr<InterfaceT> make_interface(
+  const std::string & joint_name, const std::string & interface_name, const std::string & data_type,
+  const std::string & initial_value = "")
+{
+  InterfaceInfo info;
+  info.name = interface_name;
+  info.data_type = data_type;
+  info.initial_value = initial_value;
+  return std::make_shared<InterfaceT>(InterfaceDescription(joint_name, info));
+}
+
+class TestTypedControllerInterface : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    for (const auto & joint_name : {"joint1", "joint2"})
+    {
+      command_interfaces_.push_back(
+        make_interface<CommandInterface>(joint_name, hardware_interface::HW_IF_POSITION, "double"));
+      command_interfaces_.push_back(
+        make_interface<CommandInterface>(joint_name, ENABLE_INTERFACE, "bool"));
+      state_interfaces_.push_back(
+        make_interface<StateInterface>(
+          joint_name, hardware_interface::HW_IF_POSITION, "double", "1.0"));
+      state_interfaces_.push_back(
+        make_interface<StateInterface>(
+          joint_name, hardware_interface::HW_IF_VELOCITY, "double", "2.0"));
+    }
+  }
+
+  void assign_interfaces()
+  {
+    std::vector<hardware_interface::LoanedCommandInterface> command_loans;
+    // the loans are matched by name, not by order
+    for (auto it = command_interfaces_.rbegin(); it != command_interfaces_.rend(); ++it)
+    {
+      command_loans.emplace_back(*it);
+    }
+    std::vector<hardware_interface::LoanedStateInterface> state_loans;
+    for (const auto & state_interface : state_interfaces_)
+    {
+      state_loans.emplace_back(state_interface);
+    }
+    controller_.assign_interfaces(std::move(command_loans), std::move(state_loans));
+  }
+
+  TestableTypedController controller_;
+  std::vector<CommandInterface::SharedPtr> command_interfaces_;
+  std::vector<StateInterface::SharedPtr> state_interfaces_;
+};
+}  // namespace
+
+TEST_F(TestTypedControllerInterface, interfaces_of_the_schema_are_claimed_for_the_joints)
+{
+  EXPECT_EQ(
+    controller_interface::interface_configuration_type::NONE,
+    controller_.command_interface_configuration().type);
+  ASSERT_FALSE(controller_.set_joint_names({"joint1"}));
+  EXPECT_TRUE(controller_.get_joint_names().empty());
+  ASSERT_TRUE(controller_.set_joint_names({"joint1", "joint2"}));
+
+  const auto command_configuration = controller_.command_interface_configuration();
+  EXPECT_EQ(
+    controller_interface::interface_configuration_type::INDIVIDUAL, command_configuration.type);
+  EXPECT_THAT(
+    command_configuration.names,
+    ::testing::ElementsAre("joint1/position", "joint1/enable", "joint2/position", "joint2/enable"));
+  EXPECT_THAT(
+    controller_.state_interface_configuration().names,
+    ::testing::ElementsAre(
+      "joint1/position", "joint1/velocity", "joint2/position", "joint2/velocity"));
+}
+
+TEST_F(TestTypedControllerInterface, typed_views_access_the_assigned_interfaces)
+{
+  ASSERT_TRUE(controller_.set_joint_names({"joint1", "joint2"}));
+  assign_interfaces();
+  ASSERT_TRUE(controller_.typed_interfaces_assigned());
+  EXPECT_TRUE(controller_.get_typed_interfaces_error().empty());
+
+  ASSERT_TRUE(state_interfaces_[2]->set_value(3.0));
+  ASSERT_EQ(
+    controller_interface::return_type::OK,
+    controller_.update(rclcpp::Time(0, 0), rclcpp::Duration::from_seconds(0.5)));
+  EXPECT_DOUBLE_EQ(2.0, command_interfaces_[0]->get_optional().value());
+  EXPECT_TRUE(command_interfaces_[1]->get_optional<bool>().value());
+  EXPECT_DOUBLE_EQ(4.0, command_interfaces_[2]->get_optional().value());
+  EXPECT_TRUE(command_interfaces_[3]->get_optional<bool>().value());
+
+  controller_.release_interfaces();
+  EXPECT_FALSE(controller_.typed_interfaces_assigned());
+  EXPECT_FALSE(controller_.command_views_.get<Position>()[0].valid());
+  EXPECT_FALSE(controller_.state_views_.get<Velocity>()[1].valid());
+}
+
+TEST_F(TestTypedControllerInterface, views_are_not_created_if_an_interface_does_not_match)
+{
+  ASSERT_TRUE(controller_.set_joint_names({"joint1", "joint2"}));
+  // the enable interface of the second joint is not of type bool
+  command_interfaces_[3] = make_interface<CommandInterface>("joint2", ENABLE_INTERFACE, "double");
+  assign_interfaces();
+  EXPECT_FALSE(controller_.typed_interfaces_assigned());
+  EXPECT_FALSE(controller_.get_typed_interfaces_error().empty());
+  EXPECT_FALSE(controller_.command_views_.get<Position>()[0].valid());
+
+  // the velocity state interface of the first joint is missing
+  state_interfaces_.erase(state_interfaces_.begin() + 1);
+  command_interfaces_[3] = make_interface<CommandInterface>("joint2", ENABLE_INTERFACE, "bool");
+  assign_interfaces();
+  EXPECT_FALSE(controller_.typed_interfaces_assigned());
+  EXPECT_THAT(controller_.get_typed_interfaces_error(), ::testing::HasSubstr("joint1/velocity"));
+}
@@ -18,6 +18,7 @@ from .controller_manager_services import (
     list_controllers,
     list_hardware_components,
     list_hardware_interfaces,
+    load_configure_controllers,
     load_controller,
     reload_controller_libraries,
     set_hardware_component_state,
@@ -36,6 +37,7 @@ __all__ = [
     "list_controllers",
     "list_hardware_components",
     "list_hardware_interfaces",
+    "load_configure_controllers",
     "load_controller",
     "reload_controller_libraries",
     "set_hardware_component_state",
@@ -18,6 +18,7 @@ from controller_manager_msgs.srv import (
     ListControllerTypes,
     ListHardwareComponents,
     ListHardwareInterfaces,
+    LoadConfigureControllers,
     LoadController,
     ReloadControllerLibraries,
     SetHardwareComponentState,
@@ -233,6 +234,27 @@ def list_hardware_interfaces(
     )
 
 
+def load_configure_controllers(
+    node,
+    controller_manager_name,
+    controller_names,
+    configure,
+    service_timeout=0.0,
+    call_timeout=10.0,
+):
+    request = LoadConfigureControllers.Request()
+    request.names = controller_names
+    request.configure = configure
+    return service_caller(
+        node,
+        f"{controller_manager_name}/load_configure_controllers",
+        LoadConfigureControllers,
+        request,
+        service_timeout,
+        call_timeout,
+    )
+
+
 def load_controller(
     node, controller_manager_name, controller_name, service_timeout=0.0, call_timeout=10.0
 ):
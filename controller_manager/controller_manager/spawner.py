@@ -24,6 +24,7 @@ import warnings
 from controller_manager import (
     configure_controller,
     list_controllers,
+    load_configure_controllers,
     load_controller,
     switch_controllers,
     unload_controller,
@@ -73,6 +74,94 @@ def is_controller_loaded(
     return any(c.name == controller_name for c in controllers)
 
 
+def has_load_configure_controllers_service(node, controller_manager_name):
+    node_and_namespace = find_node_and_namespace(node, controller_manager_name)
+    if not node_and_namespace:
+        return False
+    return has_service_names(
+        node,
+        node_and_namespace[0],
+        node_and_namespace[1],
+        [f"{controller_manager_name}/load_configure_controllers"],
+    )
+
+
+def log_failed_loading(logger, controller_name):
+    logger.fatal(
+        bcolors.FAIL + "Failed loading controller " + bcolors.BOLD + controller_name + bcolors.ENDC
+    )
+
+
+def load_and_configure(
+    node,
+    logger,
+    controller_manager_name,
+    controller,
+    load,
+    service_timeout=0.0,
+    call_timeout=10.0,
+):
+    """Load and configure one controller, returns False if one of the calls failed."""
+    controller_name = controller["name"]
+    if load:
+        ret = load_controller(
+            node, controller_manager_name, controller_name, service_timeout, call_timeout
+        )
+        if not ret.ok:
+            log_failed_loading(logger, controller_name)
+            return False
+        logger.info(bcolors.OKBLUE + "Loaded " + bcolors.BOLD + controller_name + bcolors.ENDC)
+
+    if not controller["load_only"]:
+        ret = configure_controller(
+            node, controller_manager_name, controller_name, service_timeout, call_timeout
+        )
+        if not ret.ok:
+            logger.error(bcolors.FAIL + "Failed to configure controller" + bcolors.ENDC)
+            return False
+    return True
+
+
+def load_and_configure_batch(
+    node,
+    logger,
+    controller_manager_name,
+    controllers,
+    controllers_to_load,
+    service_timeout=0.0,
+    call_timeout=10.0,
+):
+    """Load and configure the controllers with the batch service of the controller manager."""
+    # the controllers that are already loaded are only configured by the service
+    load_only_controllers = [
+        c["name"] for c in controllers if c["load_only"] and c["name"] in controllers_to_load
+    ]
+    batches = [
+        (load_only_controllers, False),
+        ([c["name"] for c in controllers if not c["load_only"]], True),
+    ]
+    for names, configure in batches:
+        if not names:
+            continue
+        ret = load_configure_controllers(
+            node, controller_manager_name, names, configure, service_timeout, call_timeout
+        )
+        for name, loaded, configured in zip(names, ret.loaded, ret.configured):
+            if not loaded:
+                log_failed_loading(logger, name)
+                return False
+            if name in controllers_to_load:
+                logger.info(bcolors.OKBLUE + "Loaded " + bcolors.BOLD + name + bcolors.ENDC)
+            if configure and not configured:
+                logger.error(
+                    bcolors.FAIL + "Failed to configure controller " + name + bcolors.ENDC
+                )
+                return False
+        if not ret.ok:
+            return False
+    return True
+
+
 def parse_args_advanced(args):
     """Parse arguments split by --controller, extracting global args first."""
     # Global parser
@@ -440,7 +529,7 @@ def main(args=None):
             else:
                 controller_manager_name = f"/{controller_manager_name}"
 
-        controllers_to_activate = []
+        controllers_to_load = []
         for controller in controllers:
             controller_name = controller["name"]
 
@@ -479,66 +568,67 @@ def main(args=None):
                         spawner_namespace,
                     ):
                         return 1
-
-                ret = load_controller(
+                controllers_to_load.append(controller_name)
+
+        # The batch service configures the controllers concurrently, the controller managers
+        # that don't provide it are called once per controller
+        if len(controllers) > 1 and has_load_configure_controllers_service(
+            node, controller_manager_name
+        ):
+            if not load_and_configure_batch(
+                node,
+                logger,
+                controller_manager_name,
+                controllers,
+                controllers_to_load,
+                controller_manager_timeout,
+                service_call_timeout,
+            ):
+                return 1
+        else:
+            for controller in controllers:
+                if not load_and_configure(
                     node,
+                    logger,
                     controller_manager_name,
-                    controller_name,
+                    controller,
+                    controller["name"] in controllers_to_load,
                     controller_manager_timeout,
                     service_call_timeout,
-                )
-                if not ret.ok:
-                    logger.fatal(
-                        bcolors.FAIL
-                        + "Failed loading controller "
-                        + bcolors.BOLD
-                        + controller_name
-                        + bcolors.ENDC
-                    )
+                ):
                     return 1
-                logger.info(
-                    bcolors.OKBLUE + "Loaded " + bcolors.BOLD + controller_name + bcolors.ENDC
-                )
 
-            if not controller["load_only"]:
-                ret = configure_controller(
+        controllers_to_activate = []
+        for controller in controllers:
+            controller_name = controller["name"]
+            if controller["load_only"] or controller["inactive"]:
+                continue
+            if activate_as_group:
+                controllers_to_activate.append(controller_name)
+            else:
+                ret = switch_controllers(
                     node,
                     controller_manager_name,
-                    controller_name,
-                    controller_manager_timeout,
+                    [],
+                    [controller_name],
+                    strictness,
+                    switch_asap,
+                    switch_timeout,
                     service_call_timeout,
                 )
                 if not ret.ok:
-                    logger.error(bcolors.FAIL + "Failed to configure controller" + bcolors.ENDC)
+                    logger.error(
+                        f"{bcolors.FAIL}Failed to activate controller : {controller_name}{bcolors.ENDC}"
+                    )
                     return 1
 
-                if not controller["inactive"]:
-                    if activate_as_group:
-                        controllers_to_activate.append(controller_name)
-                    else:
-                        ret = switch_controllers(
-                            node,
-                            controller_manager_name,
-                            [],
-                            [controller_name],
-                            strictness,
-                            switch_asap,
-                            switch_timeout,
-                            service_call_timeout,
-                        )
-                        if not ret.ok:
-                            logger.error(
-                                f"{bcolors.FAIL}Failed to activate controller : {controller_name}{bcolors.ENDC}"
-                            )
-                            return 1
-
-                        logger.info(
-                            bcolors.OKGREEN
-                            + "Configured and activated "
-                            + bcolors.BOLD
-                            + controller_name
-                            + bcolors.ENDC
-                        )
+                logger.info(
+                    bcolors.OKGREEN
+                    + "Configured and activated "
+                    + bcolors.BOLD
+                    + controller_name
+                    + bcolors.ENDC
+                )
 
         if activate_as_group and controllers_to_activate:
             ret = switch_controllers(
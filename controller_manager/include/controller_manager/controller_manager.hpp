@@ -15,9 +15,19 @@
 #ifndef CONTROLLER_MANAGER__CONTROLLER_MANAGER_HPP_
 #define CONTROLLER_MANAGER__CONTROLLER_MANAGER_HPP_
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -27,27 +37,44 @@
 #include "controller_interface/controller_interface_base.hpp"
 
 #include "controller_manager/controller_spec.hpp"
+#include "controller_manager/metrics_endpoint.hpp"
+#include "controller_manager/parameter_overrides_index.hpp"
+#include "controller_manager/warm_restart_checkpoint.hpp"
 #include "controller_manager_msgs/msg/controller_manager_activity.hpp"
+#include "controller_manager_msgs/msg/controller_manager_activity_changes.hpp"
 #include "controller_manager_msgs/srv/cleanup_controller.hpp"
+#include "controller_manager_msgs/srv/commit_switch_controller.hpp"
 #include "controller_manager_msgs/srv/configure_controller.hpp"
 #include "controller_manager_msgs/srv/list_controller_types.hpp"
 #include "controller_manager_msgs/srv/list_controllers.hpp"
 #include "controller_manager_msgs/srv/list_hardware_components.hpp"
 #include "controller_manager_msgs/srv/list_hardware_interfaces.hpp"
+#include "controller_manager_msgs/srv/load_configure_controllers.hpp"
 #include "controller_manager_msgs/srv/load_controller.hpp"
+#include "controller_manager_msgs/srv/prepare_switch_controller.hpp"
+#include "controller_manager_msgs/srv/profile_cycles.hpp"
 #include "controller_manager_msgs/srv/reload_controller_libraries.hpp"
 #include "controller_manager_msgs/srv/set_hardware_component_state.hpp"
+#include "controller_manager_msgs/srv/set_hardware_components_state.hpp"
+#include "controller_manager_msgs/srv/shadow_controller.hpp"
+#include "controller_manager_msgs/srv/swap_controller.hpp"
 #include "controller_manager_msgs/srv/switch_controller.hpp"
 #include "controller_manager_msgs/srv/unload_controller.hpp"
 
 #include "diagnostic_updater/diagnostic_updater.hpp"
+#include "hardware_interface/async_worker_pool.hpp"
+#include "hardware_interface/cycle_context.hpp"
 #include "hardware_interface/helpers.hpp"
+#include "hardware_interface/rate_divider.hpp"
 #include "hardware_interface/resource_manager.hpp"
+#include "hardware_interface/rt_worker_pool.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
 
 #include "pluginlib/class_loader.hpp"
 
 #include "rclcpp/executor.hpp"
 #include "rclcpp/node.hpp"
+#include "realtime_tools/lock_free_queue.hpp"
 #include "std_msgs/msg/string.hpp"
 
 #if !defined(_WIN32)
@@ -99,6 +126,17 @@ public:
 
   void init_resource_manager(const std::string & robot_description);
 
+  /// Loads, unloads and reloads only the hardware components that differ in a robot description.
+  /**
+   * The components used by active controllers are not reloaded, the robot description is then
+   * ignored. The joint limiters are imported again, if the command limits are enforced, and the
+   * initial state is set for the loaded components.
+   *
+   * \param[in] robot_description new robot description.
+   * \returns false if the robot description is ignored or a component failed to be loaded.
+   */
+  bool reload_robot_description(const std::string & robot_description);
+
   controller_interface::ControllerInterfaceBaseSharedPtr load_controller(
     const std::string & controller_name, const std::string & controller_type);
 
@@ -147,6 +185,20 @@ public:
    */
   controller_interface::return_type configure_controller(const std::string & controller_name);
 
+  /// configure_controllers Configure a batch of controllers by name.
+  /**
+   * The checks of the controllers and the update of the controller lists are done one controller
+   * after the other, in the given order, while the "configure" methods of the controllers run on
+   * up to \p number_of_threads threads, every controller having its own node.
+   *
+   * \param[in] controller_names names of the loaded controllers to configure.
+   * \param[in] number_of_threads maximum number of controllers configured at the same time.
+   * \return configure controller response of every controller, in the order of the names.
+   * \see Documentation in controller_manager_msgs/LoadConfigureControllers.srv
+   */
+  std::vector<controller_interface::return_type> configure_controllers(
+    const std::vector<std::string> & controller_names, unsigned int number_of_threads);
+
   /// switch_controller Deactivates some controllers and activates others.
   /**
    * \param[in] activate_controllers is a list of controllers to activate.
@@ -177,6 +229,91 @@ public:
     const std::vector<std::string> & deactivate_controllers, int strictness, bool activate_asap,
     const rclcpp::Duration & timeout, std::string & message);
 
+  /// prepare_switch Prepares a switch to be committed later with commit_switch().
+  /**
+   * Runs all the checks of the switch and prepares the command mode switch of the hardware, so
+   * that committing the switch only performs the command mode switch and (de)activates the
+   * controllers in the real-time loop. Until the prepared switch is committed or cancelled, no
+   * other switch can be requested.
+   *
+   * \param[in] activate_controllers is a list of controllers to activate.
+   * \param[in] deactivate_controllers is a list of controllers to deactivate.
+   * \param[in] strictness level of strictness (BEST_EFFORT or STRICT)
+   * \param[out] message describing the result of the preparation.
+   * \return return_type::OK if the switch is prepared, otherwise return_type::ERROR.
+   * \see Documentation in controller_manager_msgs/PrepareSwitchController.srv
+   */
+  controller_interface::return_type prepare_switch(
+    const std::vector<std::string> & activate_controllers,
+    const std::vector<std::string> & deactivate_controllers, int strictness,
+    std::string & message);
+
+  /// commit_switch Executes the prepared switch in the real-time loop.
+  /**
+   * The switch is executed in the first update cycle whose time is at or after \p commit_time, and
+   * the method blocks until the switch is executed.
+   *
+   * \param[in] commit_time the earliest time of the update cycle executing the switch, zero to
+   * execute it in the next update cycle.
+   * \param[in] timeout to wait for the controllers to be switched, counted from the call.
+   * \param[out] message describing the result of the switch.
+   * \return return_type::OK if the controllers are switched, otherwise return_type::ERROR.
+   * \see Documentation in controller_manager_msgs/CommitSwitchController.srv
+   */
+  controller_interface::return_type commit_switch(
+    const rclcpp::Time & commit_time, const rclcpp::Duration & timeout, std::string & message);
+
+  /// cancel_prepared_switch Discards the prepared switch.
+  /**
+   * \note The hardware components are not informed, the command mode switch they prepared is
+   * replaced by the one of the next switch.
+   */
+  void cancel_prepared_switch();
+
+  /// swap_controller Replaces an active controller by an inactive one in one real-time cycle.
+  /**
+   * The swap is checked and the command mode switch of the hardware is prepared outside of the
+   * real-time loop. In the update cycle executing the swap, the outgoing controller is updated and
+   * deactivated, its command interfaces are moved to the incoming controller without being
+   * released and claimed again, and the command interfaces they share keep their command mode.
+   * The incoming controller is then activated and takes over the state of the outgoing one in
+   * ControllerInterfaceBase::on_handover(), and is updated from the next cycle on.
+   *
+   * \param[in] outgoing_controller name of the active controller to replace.
+   * \param[in] incoming_controller name of the inactive controller replacing it.
+   * \param[in] timeout to wait for the controllers to be swapped.
+   * \param[out] message describing the result of the swap.
+   * \return return_type::OK if the controllers are swapped, return_type::ERROR if the swap would
+   * switch other controllers, change the chained mode of a controller or failed.
+   * \see Documentation in controller_manager_msgs/SwapController.srv
+   */
+  controller_interface::return_type swap_controller(
+    const std::string & outgoing_controller, const std::string & incoming_controller,
+    const rclcpp::Duration & timeout, std::string & message);
+
+  /// shadow_controller Runs the update of an inactive controller in shadow mode.
+  /**
+   * The controller is assigned its state interfaces and detached copies of its command interfaces,
+   * see ControllerInterfaceBase::on_shadow_activate(), and its update is triggered after the
+   * updates of the active controllers in the next \p cycles iterations of the control loop. Its
+   * commands never reach the hardware, so the command interfaces can be claimed by an active
+   * controller meanwhile. The controller stays inactive and its interfaces are released once the
+   * shadow updates are done, a failed shadow update ends the shadow mode.
+   *
+   * \param[in] controller_name name of the inactive controller.
+   * \param[in] cycles number of shadow updates.
+   * \param[in] timeout to wait for the shadow updates, the duration of the cycles at the update
+   * rate plus 1 second when zero.
+   * \param[out] message describing the result.
+   * \param[out] execution_time_statistics of the shadow updates, in microseconds.
+   * \return return_type::OK if all the shadow updates ran and succeeded, otherwise
+   * return_type::ERROR.
+   * \see Documentation in controller_manager_msgs/ShadowController.srv
+   */
+  controller_interface::return_type shadow_controller(
+    const std::string & controller_name, unsigned int cycles, const rclcpp::Duration & timeout,
+    std::string & message, MovingAverageStatistics::StatisticData & execution_time_statistics);
+
   /// Read values to state interfaces.
   /**
    * Read current values from hardware to state interfaces.
@@ -208,6 +345,21 @@ public:
    */
   void write(const rclcpp::Time & time, const rclcpp::Duration & period);
 
+  /// Run control cycles back-to-back, without waiting between them.
+  /**
+   * Calls read, update and write for every cycle, with the time advancing by the period of the
+   * update rate from the given time. The controllers and hardware components see the nominal
+   * period independently of the wall time, e.g., to run the control loop in lock-step with a
+   * simulator or faster than real time in tests.
+   * **The method runs the (real-time) control loop, it must not be called concurrently with
+   * read, update or write.**
+   *
+   * \param[in]  time    The time of the first cycle
+   * \param[in]  number_of_cycles  The number of cycles to run
+   * \returns the time of the cycle following the last one that was run.
+   */
+  rclcpp::Time step(const rclcpp::Time & time, std::size_t number_of_cycles = 1);
+
   /// Deterministic (real-time safe) callback group, e.g., update function.
   /**
    * Deterministic (real-time safe) callback group for the update function. Default behavior
@@ -227,6 +379,52 @@ public:
     return resource_manager_ && resource_manager_->are_components_initialized();
   }
 
+  /// Get the cycle trigger of a hardware component, to pace the control loop by the hardware.
+  /**
+   * \param[in] component_name name of the hardware component.
+   * \returns cycle trigger of the component, nullptr if the component is not loaded.
+   */
+  std::shared_ptr<hardware_interface::CycleTrigger> get_hardware_cycle_trigger(
+    const std::string & component_name) const
+  {
+    return resource_manager_ ? resource_manager_->get_cycle_trigger(component_name) : nullptr;
+  }
+
+  /// What the active controllers do with the hardware, to slow the control loop down when idle.
+  enum class ControllersActivity : std::uint8_t
+  {
+    /// No controller is active
+    NO_ACTIVE_CONTROLLERS,
+    /// Only controllers claiming no command interface, e.g., broadcasters, are active
+    STATE_ONLY,
+    /// A controller claiming command interfaces is active, or a controller switch is pending
+    COMMANDING
+  };
+
+  /// Get the activity of the active controllers, used by the idle policy of the control loop.
+  /**
+   * The activity is derived from the active controllers after every controller switch. A pending
+   * switch is reported as COMMANDING, so that the loop runs at the full rate to perform it.
+   * \note This method is real-time safe.
+   *
+   * \returns activity of the active controllers.
+   */
+  ControllersActivity get_controllers_activity() const;
+
+  /// Wakes up the control loop waiting in wait_for_control_loop_notification().
+  /**
+   * Called when a controller switch is requested and when the controllers list changes, so that
+   * an idle control loop runs the cycle performing them without waiting for its idle period.
+   */
+  void notify_control_loop();
+
+  /// Waits until notify_control_loop() is called or until the given time.
+  /**
+   * \param[in] wake_up_time time at which the wait ends without a notification.
+   * \returns true if the wait was ended by a notification.
+   */
+  bool wait_for_control_loop_notification(std::chrono::steady_clock::time_point wake_up_time);
+
   /// Update rate of the main control loop in the controller manager.
   /**
    * Update rate of the main control loop in the controller manager.
@@ -249,14 +447,130 @@ public:
    */
   rclcpp::Clock::SharedPtr get_trigger_clock() const;
 
+  /// Get the context of the current control cycle.
+  /**
+   * The context is computed once per cycle, at the beginning of the read, or of the update or the
+   * write if the cycle doesn't begin with a read, and passed to the hardware components and the
+   * controllers.
+   * \note This method is meant to be used only in the real-time control loop.
+   *
+   * \returns context of the current cycle.
+   */
+  const hardware_interface::CycleContext & get_cycle_context() const;
+
+  /// Add a measurement of the wake-up jitter of the control loop.
+  /**
+   * The wake-up jitter is the delay between the planned and the actual start of a control cycle,
+   * reported by the sleeping policy of the control loop next to the periodicity statistics.
+   *
+   * \param[in] jitter_us wake-up jitter in microseconds.
+   * \note This method is real-time safe.
+   */
+  void add_wake_up_jitter_measurement(double jitter_us)
+  {
+    wake_up_jitter_stats_.add_measurement(jitter_us);
+  }
+
+  /// Execution times of the phases of the last control loop iteration in microseconds.
+  struct ControllerManagerExecutionTime
+  {
+    double read_time = 0.0;
+    double update_time = 0.0;
+    double write_time = 0.0;
+    double switch_time = 0.0;
+    double total_time = 0.0;
+    double switch_chained_mode_time = 0.0;
+    double switch_perform_mode_time = 0.0;
+    double deactivation_time = 0.0;
+    double activation_time = 0.0;
+    /// Time of the on_prepare_activate() of the controllers of the last switch, measured in the
+    /// thread requesting it and kept until the next switch
+    double activation_preparation_time = 0.0;
+  };
+
+  /// Get the execution times of the last control loop iteration.
+  /**
+   * \returns the execution times measured in the last calls of read, update and write.
+   * \note The values are written by the (real-time) control loop, so the method is meant to be
+   * called from the thread running the control loop.
+   */
+  const ControllerManagerExecutionTime & get_execution_time() const { return execution_time_; }
+
+  /// Durations of the bringup phases of the hardware components in milliseconds.
+  struct ControllerManagerStartupTime
+  {
+    /// Loading and initialization of the components of the last robot description.
+    double load_components_time = 0.0;
+    /// Setting of the initial state of the components, including their configuration and
+    /// activation.
+    double initial_hardware_state_time = 0.0;
+    /// Loading, configuration and activation of the controllers of the warm restart checkpoint,
+    /// 0 without a warm restart.
+    double warm_restart_time = 0.0;
+  };
+
+  /// Get the durations of the last bringup of the hardware components.
+  /**
+   * \returns the durations measured at the last loading of a robot description.
+   * \note The values are written by the thread loading the robot description.
+   */
+  const ControllerManagerStartupTime & get_startup_time() const { return startup_time_; }
+
+  /// Durations of the non real-time phases of the last controller switch in microseconds.
+  struct ControllerManagerSwitchTime
+  {
+    /// Checks of the request and computation of the switch plan, 0 for a committed prepared switch.
+    double prepare_time = 0.0;
+    /// Wait for the real-time loop to acknowledge the switch, which it performs meanwhile with
+    /// activate_asap. The real-time part is measured by ControllerManagerExecutionTime::switch_time.
+    double realtime_acknowledge_time = 0.0;
+    /// Switch performed by the non real-time thread without activate_asap.
+    double non_realtime_switch_time = 0.0;
+    /// Waits for the real-time loop to release the former list of the controllers.
+    double list_release_time = 0.0;
+  };
+
+  /// Get the durations of the non real-time phases of the last controller switch.
+  /**
+   * \returns the durations measured by the last switch_controller call that switched controllers.
+   * \note The values are written by the thread switching the controllers.
+   */
+  const ControllerManagerSwitchTime & get_last_switch_time() const { return last_switch_time_; }
+
+  /// Get the statistics of the controllers, hardware components and controller manager as metrics.
+  /**
+   * \returns the execution times, periodicities, percentiles, time budget overruns and switch
+   * latencies in the OpenMetrics text format, served by the ``metrics_endpoint``.
+   * \note The metrics are built from the same snapshots of the statistics as the diagnostics, so
+   * the method can be called from a non real-time thread without taking any lock of the control
+   * loop, but it's not real-time safe itself.
+   */
+  std::string export_metrics();
+
 protected:
   void init_services();
 
   controller_interface::ControllerInterfaceBaseSharedPtr add_controller_impl(
     const ControllerSpec & controller);
 
+  /// Performs the requested switch from the real-time loop, if the switch mutex is available.
   void manage_switch();
 
+  /// Performs the requested switch, the caller has to hold the switch mutex.
+  void perform_switch();
+
+  /// Moves the memory of the controllers activated by the switch to the NUMA node of the real-time
+  /// loop.
+  /**
+   * Only the memory the real-time loop doesn't use yet is moved: the new list and the controllers
+   * activated by the switch, before their first update. The hardware memory is moved by the
+   * resource manager when it is allocated or before the activation of the components, see
+   * hardware_interface::ResourceManager::set_realtime_numa_node().
+   * \param[in] controllers list of the controllers that is going to be used by the real-time loop.
+   * \note This method is not real-time safe.
+   */
+  void move_realtime_memory_to_numa_node(const std::vector<ControllerSpec> & controllers);
+
   /// Deactivate chosen controllers from real-time controller list.
   /**
    * Deactivate controllers with names \p controllers_to_deactivate from list \p rt_controller_list.
@@ -264,10 +578,14 @@ protected:
    *
    * \param[in] rt_controller_list controllers in the real-time list.
    * \param[in] controllers_to_deactivate names of the controller that have to be deactivated.
+   * \param[out] handed_over_command_interfaces if not null, receives the command interfaces of
+   * the deactivated controllers instead of releasing them, for a controller swap.
    */
   void deactivate_controllers(
     const std::vector<ControllerSpec> & rt_controller_list,
-    const std::vector<std::string> & controllers_to_deactivate);
+    const std::vector<std::string> & controllers_to_deactivate,
+    std::vector<hardware_interface::LoanedCommandInterface> * handed_over_command_interfaces =
+      nullptr);
 
   /**
    * Switch chained mode for all the controllers with respect to the following cases:
@@ -288,10 +606,26 @@ protected:
    * \param[in] rt_controller_list controllers in the real-time list.
    * \param[in] controllers_to_activate names of the controller that have to be activated.
    * \param[in] strictness level of strictness for activation.
+   * \param[in,out] handed_over_command_interfaces if not null, command interfaces handed over by
+   * a swap, assigned to the activated controllers instead of claiming them again.
    */
   void activate_controllers(
     const std::vector<ControllerSpec> & rt_controller_list,
-    const std::vector<std::string> & controllers_to_activate, int strictness);
+    const std::vector<std::string> & controllers_to_activate, int strictness,
+    std::vector<hardware_interface::LoanedCommandInterface> * handed_over_command_interfaces =
+      nullptr);
+
+  /// Assigns the update phases of the active controllers running at a divided rate.
+  /**
+   * The phases set with the update_phase parameter are kept. The other phases are assigned again
+   * to balance the load of the update cycles, taking the controllers with the longest measured
+   * execution time first.
+   *
+   * \note This method doesn't allocate memory and is real-time safe.
+   *
+   * \param[in] rt_controller_list controllers in the real-time list.
+   */
+  void spread_update_phases(const std::vector<ControllerSpec> & rt_controller_list);
 
   void list_controllers_srv_cb(
     const std::shared_ptr<controller_manager_msgs::srv::ListControllers::Request> request,
@@ -309,6 +643,10 @@ protected:
     const std::shared_ptr<controller_manager_msgs::srv::ConfigureController::Request> request,
     std::shared_ptr<controller_manager_msgs::srv::ConfigureController::Response> response);
 
+  void load_configure_controllers_service_cb(
+    const std::shared_ptr<controller_manager_msgs::srv::LoadConfigureControllers::Request> request,
+    std::shared_ptr<controller_manager_msgs::srv::LoadConfigureControllers::Response> response);
+
   void reload_controller_libraries_service_cb(
     const std::shared_ptr<controller_manager_msgs::srv::ReloadControllerLibraries::Request> request,
     std::shared_ptr<controller_manager_msgs::srv::ReloadControllerLibraries::Response> response);
@@ -317,6 +655,22 @@ protected:
     const std::shared_ptr<controller_manager_msgs::srv::SwitchController::Request> request,
     std::shared_ptr<controller_manager_msgs::srv::SwitchController::Response> response);
 
+  void prepare_switch_controller_service_cb(
+    const std::shared_ptr<controller_manager_msgs::srv::PrepareSwitchController::Request> request,
+    std::shared_ptr<controller_manager_msgs::srv::PrepareSwitchController::Response> response);
+
+  void commit_switch_controller_service_cb(
+    const std::shared_ptr<controller_manager_msgs::srv::CommitSwitchController::Request> request,
+    std::shared_ptr<controller_manager_msgs::srv::CommitSwitchController::Response> response);
+
+  void swap_controller_service_cb(
+    const std::shared_ptr<controller_manager_msgs::srv::SwapController::Request> request,
+    std::shared_ptr<controller_manager_msgs::srv::SwapController::Response> response);
+
+  void shadow_controller_service_cb(
+    const std::shared_ptr<controller_manager_msgs::srv::ShadowController::Request> request,
+    std::shared_ptr<controller_manager_msgs::srv::ShadowController::Response> response);
+
   void unload_controller_service_cb(
     const std::shared_ptr<controller_manager_msgs::srv::UnloadController::Request> request,
     std::shared_ptr<controller_manager_msgs::srv::UnloadController::Response> response);
@@ -337,9 +691,21 @@ protected:
     const std::shared_ptr<controller_manager_msgs::srv::SetHardwareComponentState::Request> request,
     std::shared_ptr<controller_manager_msgs::srv::SetHardwareComponentState::Response> response);
 
+  void set_hardware_components_state_srv_cb(
+    const std::shared_ptr<controller_manager_msgs::srv::SetHardwareComponentsState::Request>
+      request,
+    std::shared_ptr<controller_manager_msgs::srv::SetHardwareComponentsState::Response> response);
+
+  /// Records the sections of the next cycles with the CycleProfiler and returns its report.
+  void profile_cycles_srv_cb(
+    const std::shared_ptr<controller_manager_msgs::srv::ProfileCycles::Request> request,
+    std::shared_ptr<controller_manager_msgs::srv::ProfileCycles::Response> response);
+
   // Per controller update rate support
   unsigned int update_loop_counter_ = 0;
   unsigned int update_rate_;
+  /// Phases of the active controllers running at a divided rate, if they are spread
+  hardware_interface::RatePhaseAllocator rate_phase_allocator_;
   std::vector<std::vector<std::string>> chained_controllers_configuration_;
 
   std::unique_ptr<hardware_interface::ResourceManager> resource_manager_ = nullptr;
@@ -349,9 +715,80 @@ private:
   std::pair<std::string, std::string> split_command_interface(
     const std::string & command_interface);
 
-  /// Initialize controller manager publishers, diagnostics, introspection, and shutdown handling.
+  /// Checks that the controller can be configured and cleans it up if needed.
+  /**
+   * \param[in] controller_name name of the loaded controller.
+   * \param[out] controller the controller to configure.
+   */
+  controller_interface::return_type prepare_controller_configuration(
+    const std::string & controller_name,
+    controller_interface::ControllerInterfaceBaseSharedPtr & controller);
+
+  /// Calls the "configure" method of the controller.
+  /**
+   * \note This method doesn't access the controller lists, so it can be called concurrently for
+   * different controllers.
+   */
+  controller_interface::return_type trigger_controller_configure(
+    const std::string & controller_name,
+    const controller_interface::ControllerInterfaceBaseSharedPtr & controller);
+
+  /// Exports the interfaces of the configured controller and updates the controllers order.
+  controller_interface::return_type finish_controller_configuration(
+    const std::string & controller_name);
+
+  /// Loads and pins the libraries of the controller types of the controller_libraries.preload
+  /// parameter, so that loading controllers of these types only calls their constructor.
+  void preload_controller_libraries(const std::vector<std::string> & controller_types);
+
+  /// Waits until the controller libraries are preloaded, the loaders are not thread-safe.
+  void wait_for_controller_libraries_preload();
+
+  /// Initialize the worker pools, the recording of the real-time loop and the shutdown handling.
   void init_controller_manager();
 
+  /// Initialize the activity publishers, the diagnostics, the introspection publishers and, if the
+  /// resource manager is initialized, the services.
+  void init_ros_interfaces();
+
+  /// Calls init_ros_interfaces(), or defers it until the executor spins if the staged startup is
+  /// enabled, so that the real-time loop can start without waiting for the ROS interfaces.
+  void start_ros_interfaces();
+
+  /// Called by the resource manager once a hardware component has been recovered after an error,
+  /// schedules the activation of its controllers deactivated by the error if
+  /// \p restore_controllers is set.
+  void on_hardware_component_recovered(const std::string & component, bool restore_controllers);
+
+  /// Activates again the controllers deactivated by the errors of the recovered components.
+  void restore_controllers_of_recovered_hardware();
+
+  /// Returns the robot description stored in ``staged_startup.robot_description_cache_file``, or
+  /// an empty string if there is none.
+  std::string read_cached_robot_description() const;
+
+  /// Stores the robot description in ``staged_startup.robot_description_cache_file``, if set.
+  void write_cached_robot_description(const std::string & robot_description) const;
+
+  /// Returns the checkpoint of the ``warm_restart.checkpoint_file`` to restore with the robot
+  /// description, or nullptr if there is none or it was restored already.
+  /**
+   * The file is read at the first call, which also starts the preload of the libraries of the
+   * checkpointed controllers while the hardware components are initialized.
+   */
+  const WarmRestartCheckpoint * get_warm_restart_checkpoint(const std::string & robot_description);
+
+  /// Loads, configures and activates the controllers of the warm restart checkpoint, once the
+  /// hardware components are restored.
+  void restore_warm_restart_controllers();
+
+  /// Writes the state of the controller manager to the ``warm_restart.checkpoint_file`` if it
+  /// changed since the last checkpoint.
+  void checkpoint_warm_restart_state();
+
+  /// Writes the last checkpoint before the controllers are shut down, which is not checkpointed.
+  void stop_warm_restart_checkpoint();
+
   /// Initialize controller manager parameters.
   /**
    * Declares controller manager parameters, reads them from the generated parameter listener, and
@@ -371,8 +808,14 @@ private:
   /**
    * Applies the hardware_components_initial_state parameters after the resource manager has loaded
    * and initialized components from a valid robot description.
+   *
+   * \param[in] components components to set the state of, all the components if empty.
    */
-  void set_initial_hardware_components_state();
+  void set_initial_hardware_components_state(const std::vector<std::string> & components = {});
+
+  /// Parameters of the resource manager for a robot description, from the parameters of the CM.
+  hardware_interface::ResourceManagerParams get_resource_manager_params(
+    const std::string & robot_description) const;
 
   /**
    * Call cleanup to change the given controller lifecycle node to the unconfigured state.
@@ -389,6 +832,21 @@ private:
    */
   void shutdown_controller(const controller_manager::ControllerSpec & controller) const;
 
+  /**
+   * Trigger the update of the given controller, record its statistics and its last update time.
+   *
+   * \param[in] controller controller to be updated.
+   * \param[in] period period of the controller since its last update.
+   * \param[in] current_time time of the current update cycle.
+   * \param[in] first_update_cycle true if the controller is updated for the first time.
+   * \returns the return value of the controller's update.
+   * \note This method is meant to be used only in the real-time control loop (`update`) and has to
+   * be safe to call concurrently for controllers of different chain groups.
+   */
+  controller_interface::return_type update_controller(
+    ControllerSpec & controller, const rclcpp::Duration & period,
+    const rclcpp::Time & current_time, bool first_update_cycle);
+
   /**
    * Clear request lists used when switching controllers. The lists are shared between "callback"
    * and "control loop" threads.
@@ -411,6 +869,17 @@ private:
     const std::vector<std::string> & deactivate_controllers_list,
     const std::string & rt_cycle_name);
 
+  /**
+   * Resolves the controllers and the hardware command mode change of the failed controllers of
+   * rt_buffer_.deactivate_controllers_list from their precomputed ControllerFaultPlan. The
+   * controllers using the command interfaces of the fallback controllers are added to the list,
+   * the fallback controllers are stored in rt_buffer_.fallback_controllers_list.
+   * \param[in] rt_controller_list list of controllers in the real-time list.
+   * \note This method is meant to be used only in the `update` real-time control loop. It doesn't
+   * resolve any interface names and defers its logs to the activity publisher thread.
+   */
+  void perform_fault_cascade(const std::vector<ControllerSpec> & rt_controller_list);
+
   /**
    * If a controller is deactivated all following controllers (if any exist) should be switched
    * 'from' the chained mode.
@@ -486,6 +955,57 @@ private:
     const std::vector<ControllerSpec> & controllers, const ControllersListIterator controller_it,
     std::string & message);
 
+  /// Checks the requested switch and prepares the command mode switch of the hardware.
+  /**
+   * \param[in] swap whether the switch replaces the single deactivated controller by the single
+   * activated one, see swap_controller().
+   * \return return_type::OK if the switch is prepared or no switch is needed, in which case the
+   * activate and deactivate requests are empty, otherwise return_type::ERROR.
+   */
+  controller_interface::return_type prepare_switch_impl(
+    const std::vector<std::string> & activate_controllers,
+    const std::vector<std::string> & deactivate_controllers, int strictness,
+    std::string & message, bool swap = false);
+
+  /// Lets the controller activated by a swap take over the state of the one it replaces.
+  void perform_controller_handover(const std::vector<ControllerSpec> & rt_controller_list);
+
+  /// Runs the pending shadow updates of the inactive controllers, see shadow_controller().
+  void update_shadowed_controllers(
+    std::vector<ControllerSpec> & rt_controller_list, const rclcpp::Time & time,
+    const rclcpp::Duration & period);
+
+  /// Requests the prepared switch from the real-time loop and waits for it to be executed.
+  controller_interface::return_type execute_switch(
+    bool activate_asap, const rclcpp::Duration & timeout, std::string & message);
+
+  /// Compile the switch plan of the requested switch into the switch parameters.
+  /**
+   * Checks the requested controllers, resolves the chained mode changes and collects the command
+   * interfaces to switch. The activate and deactivate requests are empty if no switch is needed.
+   *
+   * \param[in] controllers list with controllers.
+   * \param[in] strictness the strictness of the switch.
+   * \param[out] message the message describing the failure of the checks.
+   * \return return_type::OK if the plan is compiled, otherwise return_type::ERROR.
+   */
+  controller_interface::return_type compile_switch_plan(
+    const std::vector<ControllerSpec> & controllers, int strictness, std::string & message);
+
+  /// Get the key of the switch plan cache for the requested switch in the current state.
+  std::string get_switch_plan_key(
+    const std::vector<ControllerSpec> & controllers,
+    const std::vector<std::string> & activate_controllers,
+    const std::vector<std::string> & deactivate_controllers, int strictness);
+
+  /// Clears the cached switch plans, whose key doesn't cover the configurations of the interfaces.
+  /**
+   * Called when the interfaces claimed by a controller or exported by the hardware components may
+   * have changed, i.e., after a configuration or cleanup of a controller and after a reload of the
+   * robot description, so that the next switches are compiled and checked again.
+   */
+  void clear_switch_plan_cache();
+
   /**
    * Checks that all the interfaces required by the controller are available to activate.
    *
@@ -500,27 +1020,36 @@ private:
     const std::vector<std::string> deactivation_list, std::string & message);
 
   /**
-   * @brief Inserts a controller into an ordered list based on dependencies to compute the
-   * controller chain.
+   * @brief Orders the controllers so that every controller is updated after the controllers
+   * preceding it in its chain, and stores their names in ordered_controllers_names_.
    *
-   * This method computes the controller chain by inserting the provided controller name into an
-   * ordered list of controllers based on dependencies. It ensures that controllers are inserted in
-   * the correct order so that dependencies are satisfied.
+   * The controllers are sorted topologically with Kahn's algorithm, in O(n + e log n) for n
+   * controllers and e chain connections. Among the controllers that can be updated next, the one
+   * that comes first in \p controllers is taken, so that the order is deterministic and keeps the
+   * order of the independent controllers.
    *
-   * @param ctrl_name The name of the controller to be inserted into the chain.
-   * @param controller_iterator An iterator pointing to the position in the ordered list where the
-   * controller should be inserted.
-   * @param append_to_controller Flag indicating whether the controller should be appended or
-   * prepended to the parsed iterator.
+   * @param controllers The controllers to order.
    * @note The specification of controller dependencies is in the ControllerChainSpec,
-   * containing information about following and preceding controllers. This struct should include
-   * the neighboring controllers with their relationships to the provided controller.
    * `following_controllers` specify controllers that come after the provided controller.
    * `preceding_controllers` specify controllers that come before the provided controller.
+   * The controllers of a cycle are appended in their order in \p controllers.
+   *
+   * With the `update_order.group_by_hardware` parameter, the controllers that can be updated next
+   * are taken by the hardware groups of get_hardware_locality_ranks() first, so that the
+   * controllers using the same hardware components are updated one after the other.
+   */
+  void sort_controllers_topologically(const std::vector<ControllerSpec> & controllers);
+
+  /**
+   * @brief Groups the configured controllers using the interfaces of the same hardware
+   * components, or the same interfaces not exported by a component.
+   *
+   * @param controllers The controllers to group.
+   * @return The rank of the group of every controller, the index of its first controller in
+   * \p controllers. A controller without interfaces is its own group.
    */
-  void update_list_with_controller_chain(
-    const std::string & ctrl_name, std::vector<std::string>::iterator controller_iterator,
-    bool append_to_controller);
+  std::vector<std::size_t> get_hardware_locality_ranks(
+    const std::vector<ControllerSpec> & controllers) const;
 
   /**
    * @brief Build the controller chain topology information based on the provided controllers.
@@ -530,13 +1059,100 @@ private:
    */
   void build_controllers_topology_info(const std::vector<ControllerSpec> & controllers);
 
+  /// Topology of the controllers stored in the ``controllers_topology_cache_file``.
+  struct CachedControllersTopology
+  {
+    /// Key the topology was computed for, to detect the collisions of its hash
+    std::string key;
+    std::unordered_map<std::string, ControllerChainSpec> chain_spec;
+    std::map<std::string, std::vector<std::string>> chained_reference_interfaces;
+    std::map<std::string, std::vector<std::string>> chained_state_interfaces;
+    std::vector<std::string> ordered_controllers_names;
+    /// Set once the topology is used, the unused topologies are not written to the file again
+    bool used = false;
+  };
+
+  /**
+   * @brief Returns the key of the topology of the controllers, made of the names, the types and the
+   * states of the controllers, and of the interfaces claimed by the configured controllers.
+   */
+  std::string get_controllers_topology_key(const std::vector<ControllerSpec> & controllers) const;
+
+  /**
+   * @brief Restores the chain specification, the chained interfaces caches and the order of the
+   * controllers computed for the key, if they are in the topology cache.
+   *
+   * @return true if the topology was restored, false if it has to be computed.
+   */
+  bool restore_cached_controllers_topology(const std::string & key);
+
+  /// Stores the current topology of the controllers for the key in the topology cache.
+  void store_cached_controllers_topology(const std::string & key);
+
+  /// Reads the topology cache from the ``controllers_topology_cache_file``, if not done yet.
+  void read_controllers_topology_cache();
+
+  /// Writes the topology cache to the ``controllers_topology_cache_file``.
+  void write_controllers_topology_cache() const;
+
   /**
    * @brief Method to publish the state of the controller manager.
    * The state includes the list of controllers and the list of hardware interfaces along with
-   * their states.
+   * their states. The changes since the previous publication, if any, are published with a new
+   * version on the activity changes topic.
    */
   void publish_activity();
 
+  /// Requests the publication of the activity by the activity publisher thread.
+  /**
+   * The method only increments a counter, it doesn't allocate memory or call the middleware, so it
+   * can be called from the real-time loop, e.g., when a controller fails. The requests made before
+   * the publication are merged into a single message with the latest states.
+   */
+  void request_activity_publish() noexcept;
+
+  /// Publishes the activity whenever it was requested, until stop_activity_publisher is called
+  void activity_publisher_loop();
+
+  /// Stops the activity publisher thread, after publishing the pending request
+  void stop_activity_publisher();
+
+  /// Logs the report of the last fault cascades of the real-time loop, if any
+  void log_fault_report();
+
+  /// Derives the activity reported by get_controllers_activity() from the active controllers
+  void update_controllers_activity(const std::vector<ControllerSpec> & controllers);
+
+  std::thread activity_publisher_thread_;
+  std::mutex activity_publisher_mutex_;
+  std::condition_variable activity_publisher_cv_;
+  bool activity_publisher_stop_ = false;
+  std::atomic<uint64_t> activity_publish_requests_{0};
+
+  /// Last published activity, only used by the activity publisher thread to find the changes
+  struct PublishedActivity
+  {
+    uint64_t version = 0;
+    std::map<std::string, lifecycle_msgs::msg::State> controllers;
+    std::map<std::string, lifecycle_msgs::msg::State> hardware_components;
+    std::set<std::string> claimed_interfaces;
+    uint32_t auxiliary_decimation = 1u;
+  };
+  PublishedActivity published_activity_;
+
+  /// Messages of the fault cascades, written by the real-time loop and logged by the activity
+  /// publisher thread
+  struct FaultReport
+  {
+    FaultReport() { message.reserve(5000); }
+
+    std::mutex mutex;
+    std::string message;
+    /// Number of reports not fitting in the message or arriving while it was logged
+    std::atomic<uint64_t> dropped{0};
+  };
+  FaultReport fault_report_;
+
   void controller_activity_diagnostic_callback(diagnostic_updater::DiagnosticStatusWrapper & stat);
 
   void hardware_components_diagnostic_callback(diagnostic_updater::DiagnosticStatusWrapper & stat);
@@ -546,7 +1162,10 @@ private:
   /**
    * @brief determine_controller_node_options - A method that retrieves the controller defined node
    * options and adapts them, based on if there is a params file to be loaded or the use_sim_time
-   * needs to be set
+   * needs to be set, and removes the remote access to the parameters and the logger levels with
+   * the lightweight_controller_nodes.enable parameter. With index_controller_parameter_files, the
+   * parameters of the controller are looked up in the indexed parameter files and set as
+   * parameter overrides instead of passing the files as arguments
    * @param controller - controller info
    * @return The node options that will be set to the controller LifeCycleNode
    */
@@ -568,6 +1187,13 @@ private:
   std::shared_ptr<pluginlib::ClassLoader<controller_interface::ControllerInterface>> loader_;
   std::shared_ptr<pluginlib::ClassLoader<controller_interface::ChainableControllerInterface>>
     chainable_loader_;
+  /// Plugin manifests found by the first loaders, reused by the reloads if they are cached
+  std::vector<std::string> controller_plugin_xml_paths_;
+  std::vector<std::string> chainable_controller_plugin_xml_paths_;
+  /// Preload of the controller libraries, declared after the loaders to be waited for first
+  std::future<void> controller_libraries_preload_;
+  /// Protects the loaders and their preload against the concurrent queries of the controller types
+  std::mutex controller_loaders_lock_;
 
   /// Best effort (non real-time safe) callback group, e.g., service callbacks.
   /**
@@ -575,6 +1201,8 @@ private:
    * real-time requirements, for example, service callbacks.
    */
   rclcpp::CallbackGroup::SharedPtr best_effort_callback_group_;
+  /// Reentrant callback group of the read-only service callbacks, which don't lock the services
+  rclcpp::CallbackGroup::SharedPtr query_callback_group_;
 
   /**
    * The RTControllerListWrapper class wraps a double-buffered list of controllers
@@ -584,8 +1212,11 @@ private:
    * There's always an "updated" list and an "outdated" one
    * There's always an "used by rt" list and an "unused by rt" list
    *
-   * The updated state changes on the switch_updated_list()
-   * The rt usage state changes on the update_and_get_used_by_rt_list()
+   * The updated state changes on the switch_updated_list(), which publishes the updated list with
+   * a single atomic pointer exchange
+   * The rt usage state changes on the update_and_get_used_by_rt_list(), the real-time thread
+   * announces the list it picked up as a hazard pointer, so that it is never modified or destroyed
+   * while in use
    */
   class RTControllerListWrapper
   {
@@ -605,6 +1236,14 @@ private:
      */
     std::vector<ControllerSpec> & update_and_get_used_by_rt_list();
 
+    /// Returns the real-time entries of the controllers of \p list, in the same order.
+    /**
+     * \param[in] list the list returned by update_and_get_used_by_rt_list().
+     * \note This method is real-time safe, the entries are derived when the list is switched.
+     */
+    const std::vector<RealtimeControllerEntry> & get_realtime_table(
+      const std::vector<ControllerSpec> & list) const;
+
     /**
      * get_unused_list Waits until the "outdated" and "unused by rt"
      * lists match and returns a reference to it
@@ -639,6 +1278,13 @@ private:
      */
     void set_on_switch_callback(std::function<void()> callback);
 
+    /// A method to register a callback to be called once the new list is available to the
+    /// real-time thread, before waiting for the real-time thread to pick it up
+    /**
+     * \param[in] callback Callback to be called when the new list is available
+     */
+    void set_on_list_updated_callback(std::function<void()> callback);
+
     // Mutex protecting the controllers list
     // must be acquired before using any list other than the "used by rt"
     mutable controllers_lock_type controllers_lock_;
@@ -646,22 +1292,38 @@ private:
     // *INDENT-OFF*
   private:
     // *INDENT-ON*
-    /// get_other_list get the list not pointed by index
+    /// get_other_list get the list other than \p list
     /**
-     * \param[in] index int
+     * \param[in] list one of the two controllers lists
      */
-    int get_other_list(int index) const;
+    std::vector<ControllerSpec> * get_other_list(const std::vector<ControllerSpec> * list);
 
+    /// Waits until the real-time thread picks up a list other than \p list.
+    /**
+     * The real-time thread notifies the waiting thread when it picks up a new list. The wait is
+     * woken up at least every \p max_wait_period in case a notification is missed.
+     */
     void wait_until_rt_not_using(
-      int index, std::chrono::microseconds sleep_delay = std::chrono::microseconds(200)) const;
+      const std::vector<ControllerSpec> * list,
+      std::chrono::microseconds max_wait_period = std::chrono::milliseconds(1)) const;
+
+    /// Derives the real-time entries of the controllers of \p list.
+    void update_realtime_table(const std::vector<ControllerSpec> & list);
 
     std::vector<ControllerSpec> controllers_lists_[2];
-    /// The index of the controller list with the most updated information
-    int updated_controllers_index_ = 0;
-    /// The index of the controllers list being used in the real-time thread.
-    int used_by_realtime_controllers_index_ = -1;
+    /// Real-time entries of the controllers of each of the controllers_lists_
+    std::vector<RealtimeControllerEntry> realtime_tables_[2];
+    /// The controllers list with the most updated information
+    std::atomic<std::vector<ControllerSpec> *> updated_controllers_list_{&controllers_lists_[0]};
+    /// Hazard pointer to the controllers list being used in the real-time thread.
+    std::atomic<const std::vector<ControllerSpec> *> used_by_realtime_controllers_list_{nullptr};
+    /// Notified by the real-time thread when it picks up a new list
+    mutable std::mutex rt_list_mutex_;
+    mutable std::condition_variable rt_list_cv_;
     /// The callback to be called when the list is switched
     std::function<void()> on_switch_callback_ = nullptr;
+    /// The callback to be called when the new list is available to the real-time thread
+    std::function<void()> on_list_updated_callback_ = nullptr;
   };
 
   bool use_sim_time_;
@@ -670,11 +1332,49 @@ private:
   RTControllerListWrapper rt_controllers_wrapper_;
   std::unordered_map<std::string, ControllerChainSpec> controller_chain_spec_;
   std::vector<std::string> ordered_controllers_names_;
-  /// mutex copied from ROS1 Control, protects service callbacks
-  /// not needed if we're guaranteed that the callbacks don't come from multiple threads
+  /// mutex copied from ROS1 Control, serializes the service callbacks that change the controllers
+  /// or the hardware components, the read-only queries don't lock it
   std::mutex services_lock_;
+
+  /// Response of a list service, rebuilt only when the states it reports changed
+  /**
+   * The controllers version is the counter of the activity publish requests, incremented whenever
+   * a controller changes its state, and the interfaces version is the one of the resource manager.
+   */
+  template <typename ResponseT>
+  struct CachedListResponse
+  {
+    bool is_up_to_date(uint64_t current_controllers_version, uint64_t current_interfaces_version)
+    {
+      return valid && controllers_version == current_controllers_version &&
+             interfaces_version == current_interfaces_version;
+    }
+
+    void update(
+      uint64_t new_controllers_version, uint64_t new_interfaces_version,
+      const ResponseT & new_response)
+    {
+      controllers_version = new_controllers_version;
+      interfaces_version = new_interfaces_version;
+      response = new_response;
+      valid = true;
+    }
+
+    std::mutex mutex;
+    bool valid = false;
+    uint64_t controllers_version = 0;
+    uint64_t interfaces_version = 0;
+    ResponseT response;
+  };
+  CachedListResponse<controller_manager_msgs::srv::ListControllers::Response>
+    list_controllers_cache_;
+  CachedListResponse<controller_manager_msgs::srv::ListHardwareInterfaces::Response>
+    list_hardware_interfaces_cache_;
+
   rclcpp::Publisher<controller_manager_msgs::msg::ControllerManagerActivity>::SharedPtr
     controller_manager_activity_publisher_;
+  rclcpp::Publisher<controller_manager_msgs::msg::ControllerManagerActivityChanges>::SharedPtr
+    controller_manager_activity_changes_publisher_;
   rclcpp::Service<controller_manager_msgs::srv::ListControllers>::SharedPtr
     list_controllers_service_;
   rclcpp::Service<controller_manager_msgs::srv::ListControllerTypes>::SharedPtr
@@ -682,10 +1382,19 @@ private:
   rclcpp::Service<controller_manager_msgs::srv::LoadController>::SharedPtr load_controller_service_;
   rclcpp::Service<controller_manager_msgs::srv::ConfigureController>::SharedPtr
     configure_controller_service_;
+  rclcpp::Service<controller_manager_msgs::srv::LoadConfigureControllers>::SharedPtr
+    load_configure_controllers_service_;
   rclcpp::Service<controller_manager_msgs::srv::ReloadControllerLibraries>::SharedPtr
     reload_controller_libraries_service_;
   rclcpp::Service<controller_manager_msgs::srv::SwitchController>::SharedPtr
     switch_controller_service_;
+  rclcpp::Service<controller_manager_msgs::srv::PrepareSwitchController>::SharedPtr
+    prepare_switch_controller_service_;
+  rclcpp::Service<controller_manager_msgs::srv::CommitSwitchController>::SharedPtr
+    commit_switch_controller_service_;
+  rclcpp::Service<controller_manager_msgs::srv::SwapController>::SharedPtr swap_controller_service_;
+  rclcpp::Service<controller_manager_msgs::srv::ShadowController>::SharedPtr
+    shadow_controller_service_;
   rclcpp::Service<controller_manager_msgs::srv::UnloadController>::SharedPtr
     unload_controller_service_;
   rclcpp::Service<controller_manager_msgs::srv::CleanupController>::SharedPtr
@@ -697,32 +1406,190 @@ private:
     list_hardware_interfaces_service_;
   rclcpp::Service<controller_manager_msgs::srv::SetHardwareComponentState>::SharedPtr
     set_hardware_component_state_service_;
+  rclcpp::Service<controller_manager_msgs::srv::SetHardwareComponentsState>::SharedPtr
+    set_hardware_components_state_service_;
+  rclcpp::Service<controller_manager_msgs::srv::ProfileCycles>::SharedPtr profile_cycles_service_;
 
   std::map<std::string, std::vector<std::string>> controller_chained_reference_interfaces_cache_;
   std::map<std::string, std::vector<std::string>> controller_chained_state_interfaces_cache_;
-
-  std::string robot_description_;
+  /// Topologies of the controllers by the hash of their key
+  std::unordered_map<uint64_t, CachedControllersTopology> controllers_topology_cache_;
+  bool controllers_topology_cache_read_ = false;
+  /// Parameter files of the controllers, parsed once for all the controllers
+  mutable ParameterOverridesIndex parameter_overrides_index_;
+
+  /// Loaded robot description, shared with the controllers instead of being copied for each of them
+  std::shared_ptr<const std::string> robot_description_ = std::make_shared<const std::string>();
   rclcpp::Subscription<std_msgs::msg::String>::SharedPtr robot_description_subscription_;
   rclcpp::TimerBase::SharedPtr robot_description_notification_timer_;
+  /// One-shot timer running init_ros_interfaces() once the executor spins, see the staged startup
+  rclcpp::TimerBase::SharedPtr staged_startup_timer_;
+  /// Components recovered after an error, whose controllers are activated again by a one-shot
+  /// timer, see on_hardware_component_recovered()
+  std::mutex hardware_recovery_mutex_;
+  std::vector<std::string> recovered_hardware_components_;
+  rclcpp::TimerBase::SharedPtr hardware_recovery_timer_;
+  /// Checkpoint to restore, read once from the ``warm_restart.checkpoint_file``
+  std::optional<WarmRestartCheckpoint> warm_restart_checkpoint_;
+  bool warm_restart_checkpoint_read_ = false;
+  /// Set while the checkpoint is being restored, the state isn't checkpointed meanwhile
+  std::atomic<bool> warm_restart_pending_{false};
+  /// One-shot timer running restore_warm_restart_controllers() once the executor spins
+  rclcpp::TimerBase::SharedPtr warm_restart_restore_timer_;
+  rclcpp::TimerBase::SharedPtr warm_restart_checkpoint_timer_;
+  /// Protects the writes of the checkpoint by the timer and by the shutdown
+  std::mutex warm_restart_checkpoint_mutex_;
+  WarmRestartCheckpoint last_warm_restart_checkpoint_;
+  bool warm_restart_checkpoint_stopped_ = false;
+  /// Set once init_ros_interfaces() is done, the introspection data is not published before
+  std::atomic<bool> ros_interfaces_initialized_{false};
 
   bool activate_all_hw_components_ = false;
 
-  struct ControllerManagerExecutionTime
+  ControllerManagerExecutionTime execution_time_;
+  ControllerManagerStartupTime startup_time_;
+  ControllerManagerSwitchTime last_switch_time_;
+
+  /// Heap allocations of the phases of the last control loop iteration
+  struct ControllerManagerAllocations
   {
-    double read_time = 0.0;
-    double update_time = 0.0;
-    double write_time = 0.0;
-    double switch_time = 0.0;
-    double total_time = 0.0;
-    double switch_chained_mode_time = 0.0;
-    double switch_perform_mode_time = 0.0;
-    double deactivation_time = 0.0;
-    double activation_time = 0.0;
+    unsigned int read_allocations = 0;
+    unsigned int update_allocations = 0;
+    unsigned int write_allocations = 0;
   };
 
-  ControllerManagerExecutionTime execution_time_;
+  ControllerManagerAllocations allocations_;
+
+  /// Ids of the trace sections of the control loop, recorded by the tracing and the profiling
+  struct ControllerManagerTraceIds
+  {
+    uint32_t read = 0;
+    uint32_t update = 0;
+    uint32_t enforce_command_limits = 0;
+    uint32_t switch_controllers = 0;
+    uint32_t write = 0;
+    /// The whole cycle, recorded by the CycleTraceRing only
+    uint32_t cycle = 0;
+  };
+
+  ControllerManagerTraceIds trace_ids_;
+
+  /// Begin of the cycle recorded by the CycleProfiler or the CycleTraceRing, on the steady clock
+  /// in nanoseconds
+  int64_t cycle_begin_ns_ = 0;
+
+  /// Samples the clocks of a new cycle into the cycle_context_.
+  void begin_cycle(const rclcpp::Time & time, const rclcpp::Duration & period);
+
+  hardware_interface::CycleContext cycle_context_;
+  /// Set from the beginning of the cycle to its write
+  bool cycle_open_ = false;
+  /// Set once the open cycle is updated, so that the next update begins another cycle
+  bool cycle_updated_ = false;
+  /// End of the last write on the steady clock in nanoseconds
+  int64_t last_cycle_end_ns_ = 0;
+
+  /// Drains the recorded trace events periodically and writes them to the \p output_file
+  void trace_writer_loop(const std::string & output_file);
+
+  /// Stops the trace writer thread, after writing the last recorded events
+  void stop_trace_writer();
+
+  std::thread trace_writer_thread_;
+  std::mutex trace_writer_mutex_;
+  std::condition_variable trace_writer_cv_;
+  bool trace_writer_stop_ = false;
+
+  /// Writes the cycles frozen by the CycleTraceRing on an overrun, each time to a new file
+  void overrun_forensics_writer_loop(const std::string & directory, int64_t max_files);
+
+  /// Stops the overrun forensics writer thread, after writing the last frozen cycles
+  void stop_overrun_forensics_writer();
+
+  std::thread overrun_forensics_writer_thread_;
+  std::mutex overrun_forensics_writer_mutex_;
+  std::condition_variable overrun_forensics_writer_cv_;
+  bool overrun_forensics_writer_stop_ = false;
+
+  /// True if this controller manager started the DeferredLogger, which is stopped on destruction
+  bool deferred_logger_started_ = false;
+
+  /// Drains the samples of the introspection sink periodically and writes them to the
+  /// \p output_file
+  void introspection_sink_writer_loop(const std::string & output_file);
+
+  /// Stops the introspection sink writer thread, after writing the last samples
+  void stop_introspection_sink_writer();
+
+  std::thread introspection_sink_writer_thread_;
+  std::mutex introspection_sink_writer_mutex_;
+  std::condition_variable introspection_sink_writer_cv_;
+  bool introspection_sink_writer_stop_ = false;
+
+  /// Applies the publishing and sampling rates of the introspection variables and the excluded
+  /// variables of the sink, at the start and whenever the parameters change
+  void configure_introspection(const controller_manager::Params & params);
+
+  /// Number of cycles between two publications of the introspection data and of the statistics,
+  /// and between two samples of the introspection sink, written by the non real-time thread
+  std::atomic<uint32_t> introspection_publish_divider_{1};
+  std::atomic<uint32_t> statistics_publish_divider_{1};
+  std::atomic<uint32_t> introspection_sink_sample_divider_{1};
+  /// NUMA node of the real-time loop at its last controller switch, -1 if it is unknown
+  std::atomic<int> realtime_numa_node_{-1};
+  /// Sheds the auxiliary controllers and hardware components when the loop is overloaded, only
+  /// used by the real-time loop
+  hardware_interface::OverloadGovernor overload_governor_;
+  /// Decimation of the auxiliary cycles and number of its changes, for the activity and the
+  /// diagnostics
+  std::atomic<uint32_t> auxiliary_decimation_{1u};
+  std::atomic<uint64_t> overload_governor_changes_{0u};
+  /// Activity of the controllers active after the last switch, see get_controllers_activity()
+  std::atomic<ControllersActivity> controllers_activity_{
+    ControllersActivity::NO_ACTIVE_CONTROLLERS};
+  /// Notification of the control loop waiting while idle
+  std::mutex control_loop_notification_mutex_;
+  std::condition_variable control_loop_notification_cv_;
+  bool control_loop_notified_ = false;
+  rclcpp::node_interfaces::PostSetParametersCallbackHandle::SharedPtr
+    introspection_parameters_callback_handle_;
+
+  /// Pool of real-time workers updating independent controller chains in parallel, nullptr if
+  /// the controllers are updated sequentially
+  std::unique_ptr<hardware_interface::RTWorkerPool> update_worker_pool_ = nullptr;
+
+  /// Pool of real-time workers executing the parallel_for() of the controllers within their
+  /// updates, nullptr if the controllers execute their tasks sequentially
+  std::shared_ptr<hardware_interface::RTWorkerPool> controller_worker_pool_ = nullptr;
+
+  /// Pool of real-time workers running the asynchronous controllers and hardware components,
+  /// nullptr if every one of them has its own thread
+  std::shared_ptr<hardware_interface::AsyncWorkerPool> async_worker_pool_ = nullptr;
+
+  /// Threads of the additional control loops, by loop name, each one a pool of a single worker
+  std::unordered_map<std::string, std::shared_ptr<hardware_interface::AsyncWorkerPool>>
+    control_loop_pools_;
 
   controller_manager::MovingAverageStatistics periodicity_stats_;
+  /// Delay between the planned and the actual start of the control cycles, in microseconds
+  controller_manager::MovingAverageStatistics wake_up_jitter_stats_;
+  /// Duration of the switches of the controllers, from the request to the release of the former
+  /// list of the controllers, in microseconds
+  controller_manager::MovingAverageStatistics switch_latency_stats_;
+  /// Endpoint serving export_metrics(), refreshed by the timer, nullptr if it isn't enabled
+  std::unique_ptr<MetricsEndpoint> metrics_endpoint_;
+  rclcpp::TimerBase::SharedPtr metrics_endpoint_timer_;
+  /// Failed try-locks of the resources by the read and write, at the last diagnostics update
+  uint64_t last_resources_try_lock_failures_ = 0;
+
+  /// Acknowledgement of a switch request sent by the real-time loop
+  enum class SwitchResponse : std::uint8_t
+  {
+    /// The real-time loop is ready for the switch to be performed by the requesting thread
+    READY_TO_SWITCH,
+    /// The switch was performed by the real-time loop
+    SWITCH_FINISHED
+  };
 
   struct SwitchParams
   {
@@ -731,28 +1598,87 @@ private:
       do_switch = false;
       strictness = 0;
       activate_asap = false;
-      ready_to_switch = false;
+      ready_to_switch_sent = false;
+      commit_time_ns = 0;
+      swap_outgoing_controller.clear();
+      swap_incoming_controller.clear();
+      SwitchResponse stale_response = SwitchResponse::SWITCH_FINISHED;
+      while (responses.pop(stale_response))
+      {
+      }
     }
 
+    /// Set once the switch request is prepared, cleared once the switch is performed
     std::atomic_bool do_switch{false};
-    std::atomic_bool ready_to_switch{false};
+    /// Whether the real-time loop already acknowledged that it is ready to switch, read by the
+    /// real-time loop without the mutex and reset by the requesting thread
+    std::atomic_bool ready_to_switch_sent{false};
+    /// Responses of the real-time loop to the switch request, pushed with the mutex held
+    realtime_tools::LockFreeSPSCQueue<SwitchResponse, 4> responses;
 
     // Switch options
     int strictness;
     std::atomic_bool activate_asap{false};
     std::chrono::nanoseconds timeout;
-
-    // conditional variable and mutex to wait for the switch to complete
+    /// Earliest time of the update cycle performing a committed switch, in nanoseconds
+    int64_t commit_time_ns = 0;
+    /// Whether a switch is prepared and waits to be committed
+    bool prepared = false;
+    /// Controllers replaced and replacing in a swap, empty if the switch isn't a swap
+    std::string swap_outgoing_controller;
+    std::string swap_incoming_controller;
+
+    // conditional variable and mutex to wait for the responses of the real-time loop
     std::condition_variable cv;
     std::mutex mutex;
 
+    /// Bits of switch_flags of a controller
+    enum SwitchFlag : uint8_t
+    {
+      ACTIVATE = 1u << 0,
+      DEACTIVATE = 1u << 1,
+      TO_CHAINED_MODE = 1u << 2,
+      FROM_CHAINED_MODE = 1u << 3,
+    };
+
+    /// Resolves the requests into the switch flags of the controllers, before do_switch is set
+    void update_switch_flags(const std::vector<controller_manager::ControllerSpec> & controllers)
+    {
+      std::fill(switch_flags.begin(), switch_flags.end(), 0u);
+      for (const auto & spec : controllers)
+      {
+        if (spec.id >= switch_flags.size())
+        {
+          switch_flags.resize(spec.id + 1, 0u);
+        }
+        const auto & name = spec.info.name;
+        switch_flags[spec.id] = static_cast<uint8_t>(
+          (ros2_control::has_item(activate_request, name) ? ACTIVATE : 0u) |
+          (ros2_control::has_item(deactivate_request, name) ? DEACTIVATE : 0u) |
+          (ros2_control::has_item(to_chained_mode_request, name) ? TO_CHAINED_MODE : 0u) |
+          (ros2_control::has_item(from_chained_mode_request, name) ? FROM_CHAINED_MODE : 0u));
+      }
+    }
+
+    bool has_switch_flag(std::size_t controller_id, uint8_t flag) const
+    {
+      return controller_id < switch_flags.size() && (switch_flags[controller_id] & flag) != 0u;
+    }
+
+    bool has_switch_flag(const controller_manager::ControllerSpec & spec, uint8_t flag) const
+    {
+      return has_switch_flag(spec.id, flag);
+    }
+
+    bool skip_cycle(std::size_t controller_id) const
+    {
+      return has_switch_flag(
+        controller_id, ACTIVATE | DEACTIVATE | TO_CHAINED_MODE | FROM_CHAINED_MODE);
+    }
+
     bool skip_cycle(const controller_manager::ControllerSpec & spec) const
     {
-      const std::string controller_name = spec.info.name;
-      return ros2_control::has_item(activate_request, controller_name) ||
-             ros2_control::has_item(deactivate_request, controller_name) ||
-             ros2_control::has_item(to_chained_mode_request, controller_name) ||
-             ros2_control::has_item(from_chained_mode_request, controller_name);
+      return skip_cycle(spec.id);
     }
 
     // The controllers list to activate and deactivate
@@ -762,14 +1688,44 @@ private:
     std::vector<std::string> from_chained_mode_request;
     std::vector<std::string> activate_command_interface_request;
     std::vector<std::string> deactivate_command_interface_request;
+    /// Switch flags of the controllers by their ControllerSpec::id, so that the real-time loop
+    /// never compares controller names
+    std::vector<uint8_t> switch_flags;
   };
 
   SwitchParams switch_params_;
 
+  /// Switch requests compiled by compile_switch_plan(), replayed for repeated switches
+  struct SwitchPlan
+  {
+    std::vector<std::string> activate_request;
+    std::vector<std::string> deactivate_request;
+    std::vector<std::string> to_chained_mode_request;
+    std::vector<std::string> from_chained_mode_request;
+    std::vector<std::string> activate_command_interface_request;
+    std::vector<std::string> deactivate_command_interface_request;
+  };
+
+  /// Compiled switch plans by the key of get_switch_plan_key(), protected by the controllers lock
+  std::unordered_map<std::string, SwitchPlan> switch_plan_cache_;
+
+  /// Controller update scheduled in the current cycle, when updating in parallel
+  struct ScheduledControllerUpdate
+  {
+    std::size_t controller_index = 0;
+    std::size_t chain_group_id = 0;
+    rclcpp::Duration period = rclcpp::Duration(0, 0);
+    rclcpp::Time current_time;
+    bool first_update_cycle = false;
+    controller_interface::return_type result = controller_interface::return_type::OK;
+  };
+
   struct RTBufferVariables
   {
     RTBufferVariables()
     {
+      scheduled_updates.reserve(1000);
+      scheduled_chain_groups.reserve(1000);
       deactivate_controllers_list.reserve(1000);
       activate_controllers_using_interfaces_list.reserve(1000);
       fallback_controllers_list.reserve(1000);
@@ -778,8 +1734,8 @@ private:
       concatenated_string.reserve(5000);
     }
 
-    const std::string & get_concatenated_string(
-      const std::vector<std::string> & strings, bool clear_string = true)
+    template <typename StringsT>
+    const std::string & get_concatenated_string(const StringsT & strings, bool clear_string = true)
     {
       if (clear_string)
       {
@@ -793,12 +1749,16 @@ private:
       return concatenated_string;
     }
 
+    std::vector<ScheduledControllerUpdate> scheduled_updates;
+    std::vector<std::size_t> scheduled_chain_groups;
     std::vector<std::string> deactivate_controllers_list;
     std::vector<std::string> activate_controllers_using_interfaces_list;
     std::vector<std::string> fallback_controllers_list;
     std::vector<std::string> interfaces_to_start;
     std::vector<std::string> interfaces_to_stop;
     std::string concatenated_string;
+    /// Command interfaces moved from the outgoing to the incoming controller of a swap
+    std::vector<hardware_interface::LoanedCommandInterface> handed_over_command_interfaces;
   };
   RTBufferVariables rt_buffer_;
 };
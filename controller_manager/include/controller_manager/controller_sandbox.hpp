@@ -0,0 +1,137 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "controller_interface/controller_interface.hpp"
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/shared_memory_bridge.hpp"
+
+namespace controller_manager
+{
+/// Proxy of a controller running in a sandbox process, see ControllerSandboxHost.
+/**
+ * The proxy is loaded by the controller manager in place of the sandboxed controller and claims
+ * its interfaces, given by the ``command_interfaces`` and ``state_interfaces`` parameters. It
+ * creates a shared-memory bridge in which it is the hardware side: at every update it publishes
+ * the state values with a wait-free write and wakes the sandbox process, then waits for the
+ * command values of the cycle until ``deadline_us``.
+ *
+ * A late cycle keeps the previous commands. After more than ``max_missed_deadlines`` consecutive
+ * late cycles, e.g., if the sandboxed controller crashed, the update returns an error so that the
+ * controller manager deactivates the proxy and activates its fallback controllers, while the
+ * control loop keeps running.
+ *
+ * \note Only the interfaces of type double are supported.
+ */
+class SandboxProxyController : public controller_interface::ControllerInterface
+{
+public:
+  controller_interface::CallbackReturn on_init() override;
+
+  controller_interface::InterfaceConfiguration command_interface_configuration() const override;
+
+  controller_interface::InterfaceConfiguration state_interface_configuration() const override;
+
+  controller_interface::CallbackReturn on_configure(
+    const rclcpp_lifecycle::State & previous_state) override;
+
+  controller_interface::CallbackReturn on_activate(
+    const rclcpp_lifecycle::State & previous_state) override;
+
+  controller_interface::CallbackReturn on_cleanup(
+    const rclcpp_lifecycle::State & previous_state) override;
+
+  controller_interface::return_type update(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+  /// Returns the number of consecutive cycles in which the sandbox missed its deadline.
+  std::size_t get_missed_deadlines() const { return missed_deadlines_; }
+
+private:
+  std::vector<std::string> command_interface_names_;
+  std::vector<std::string> state_interface_names_;
+  std::string segment_name_;
+  std::chrono::nanoseconds deadline_{std::chrono::microseconds(200)};
+  std::chrono::nanoseconds connection_timeout_{std::chrono::seconds(1)};
+  std::size_t max_missed_deadlines_ = 3;
+
+  hardware_interface::SharedMemoryBridge bridge_;
+  std::vector<double> state_values_;
+  std::vector<double> command_values_;
+  uint32_t last_command_frame_ = 0;
+  std::size_t missed_deadlines_ = 0;
+};
+
+/// Runs a controller in a sandbox process against the interfaces mirrored by its proxy.
+/**
+ * The host attaches to the shared-memory bridge of a SandboxProxyController, creates local copies
+ * of the interfaces claimed by the proxy, and assigns them to the controller. Every cycle of the
+ * proxy is then run by spin_once(): the state values are copied into the local state interfaces,
+ * the controller is updated with the time of the proxy, and the command values are published
+ * back.
+ *
+ * A crash of the controller only terminates the sandbox process, the proxy then falls back after
+ * its missed deadlines.
+ */
+class ControllerSandboxHost
+{
+public:
+  /// \param[in] controller initialized controller, configured by connect().
+  explicit ControllerSandboxHost(controller_interface::ControllerInterfaceBaseSharedPtr controller);
+
+  ~ControllerSandboxHost();
+
+  ControllerSandboxHost(const ControllerSandboxHost &) = delete;
+  ControllerSandboxHost & operator=(const ControllerSandboxHost &) = delete;
+
+  /// Attaches to the bridge of the proxy, then configures and activates the controller.
+  /**
+   * \param[in] segment_name name of the segment of the proxy, see its ``segment_name`` parameter.
+   * \returns false if the segment doesn't exist, doesn't mirror the interfaces of the controller
+   * or if the controller failed to configure or to activate.
+   * \note This method is not real-time safe.
+   */
+  bool connect(const std::string & segment_name);
+
+  /// Waits for the next cycle of the proxy and updates the controller.
+  /**
+   * \param[in] timeout maximal time to wait for the cycle.
+   * \returns false on timeout, if the proxy closed the bridge or if the controller failed to
+   * update, the commands of a failed update are not published.
+   */
+  bool spin_once(std::chrono::nanoseconds timeout);
+
+  /// Returns true if the bridge is active, i.e., the proxy didn't close it.
+  bool is_connected() const { return bridge_.is_active(); }
+
+private:
+  controller_interface::ControllerInterfaceBaseSharedPtr controller_;
+  hardware_interface::SharedMemoryBridge bridge_;
+  std::vector<hardware_interface::StateInterface::SharedPtr> state_interfaces_;
+  std::vector<hardware_interface::CommandInterface::SharedPtr> command_interfaces_;
+  std::vector<double> state_values_;
+  std::vector<double> command_values_;
+  uint32_t last_state_frame_ = 0;
+  int64_t last_stamp_ns_ = 0;
+};
+
+}  // namespace controller_manager
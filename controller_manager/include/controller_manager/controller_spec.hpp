@@ -19,17 +19,56 @@
 #ifndef CONTROLLER_MANAGER__CONTROLLER_SPEC_HPP_
 #define CONTROLLER_MANAGER__CONTROLLER_SPEC_HPP_
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
 #include "controller_interface/controller_interface_base.hpp"
 #include "hardware_interface/controller_info.hpp"
+#include "hardware_interface/memory_arena.hpp"
+#include "hardware_interface/overload_governor.hpp"
+#include "hardware_interface/rate_divider.hpp"
+#include "hardware_interface/time_budget.hpp"
 #include "hardware_interface/types/statistics_types.hpp"
 
 namespace controller_manager
 {
 
 using MovingAverageStatistics = ros2_control::MovingAverageStatistics;
+
+/// Reaction of the real-time loop to a failed update of a controller
+/**
+ * The plan is resolved and validated with the fallback graph of all the controllers whenever the
+ * controllers list changes, so that the real-time loop doesn't resolve any interface or search any
+ * controller when the update of a controller fails. The indices refer to the controllers list the
+ * plan was resolved for.
+ */
+struct ControllerFaultPlan
+{
+  /// Command interfaces of the controller, empty if it is not configured
+  std::vector<std::string> command_interfaces;
+  /// Indices of the fallback controllers to activate
+  std::vector<std::size_t> fallback_controllers;
+  /// Indices of the controllers using the command interfaces of the fallback controllers, which
+  /// are deactivated together with the failed controller if they are active
+  std::vector<std::size_t> conflicting_controllers;
+  /// Reason why the fallback controllers can never be activated together, empty if they can
+  std::string invalid_reason;
+};
+
+/// Shadow mode of an inactive controller, see ControllerManager::shadow_controller()
+struct ControllerShadowMode
+{
+  /// Number of shadow updates left to the real-time loop, 0 if the controller is not shadowed
+  std::atomic<int> remaining_cycles{0};
+  /// True while the real-time loop runs a shadow update, so that the interfaces of the controller
+  /// are only released once no update uses them
+  std::atomic<bool> updating{false};
+  /// Result of the last shadow update
+  std::atomic<controller_interface::return_type> result{controller_interface::return_type::OK};
+};
+
 /// Controller Specification
 /**
  * This struct contains both a pointer to a given controller, \ref c, as well
@@ -41,16 +80,108 @@ struct ControllerSpec
   ControllerSpec()
   {
     last_update_cycle_time = std::make_shared<rclcpp::Time>(0, 0, RCL_CLOCK_UNINITIALIZED);
+    rate_divider = std::make_shared<hardware_interface::RateDivider>();
+    time_budget = std::make_shared<hardware_interface::TimeBudget>();
     execution_time_statistics = std::make_shared<MovingAverageStatistics>();
     periodicity_statistics = std::make_shared<MovingAverageStatistics>();
+    update_allocations = std::make_shared<unsigned int>(0);
+    cpu_time_statistics = std::make_shared<MovingAverageStatistics>();
+    preempted_time_statistics = std::make_shared<MovingAverageStatistics>();
+    stage_time_statistics = std::make_shared<MovingAverageStatistics>();
+    command_latency_statistics = std::make_shared<MovingAverageStatistics>();
+    parallel_time_statistics = std::make_shared<MovingAverageStatistics>();
+    parallel_task_time_statistics = std::make_shared<MovingAverageStatistics>();
+    update_voluntary_context_switches = std::make_shared<unsigned int>(0);
+    update_involuntary_context_switches = std::make_shared<unsigned int>(0);
+    performance_counters_statistics =
+      std::make_shared<hardware_interface::PerformanceCountersStatisticsCollector>();
+    fault_plan = std::make_shared<ControllerFaultPlan>();
+    shadow_mode = std::make_shared<ControllerShadowMode>();
+    deactivated_by_hardware_error = std::make_shared<std::atomic<bool>>(false);
   }
 
   hardware_interface::ControllerInfo info;
   controller_interface::ControllerInterfaceBaseSharedPtr c;
+  /// Dense index of the controller among the loaded controllers, assigned when it is added to the
+  /// controller manager and reused after it is unloaded
+  std::size_t id = 0;
   std::shared_ptr<rclcpp::Time> last_update_cycle_time;
+  /// Update cycles of the controller if its update rate divides the controller manager rate
+  std::shared_ptr<hardware_interface::RateDivider> rate_divider;
+  /// Phase of the update cycles set with the <controller_name>.update_phase parameter, -1 if the
+  /// phase is assigned automatically
+  int update_phase = -1;
+  /// Budget of the execution time of the update, set with the <controller_name>.time_budget_us
+  /// and <controller_name>.time_budget_policy parameters
+  std::shared_ptr<hardware_interface::TimeBudget> time_budget;
+  /// Criticality class set with the <controller_name>.criticality parameter, the auxiliary
+  /// controllers are shed by the overload governor
+  hardware_interface::Criticality criticality = hardware_interface::Criticality::CONTROL;
+  /// Pre-faulted memory the controller allocates its buffers from, nullptr if the arenas are
+  /// disabled with the memory_arenas.controller_size parameter
+  std::shared_ptr<hardware_interface::MemoryArena> memory_arena;
+  /// Control loop running the asynchronous updates, set with the <controller_name>.control_loop
+  /// parameter, empty for the default async threads
+  std::string control_loop = "";
   std::vector<std::string> controllers_chain_group = {};
+  /// Index of the group of chained controllers this controller belongs to. Controllers with
+  /// different ids don't share any chained interfaces and can be updated concurrently.
+  std::size_t controllers_chain_group_id = 0;
   std::shared_ptr<MovingAverageStatistics> execution_time_statistics;
   std::shared_ptr<MovingAverageStatistics> periodicity_statistics;
+  /// Heap allocations of the last update, only counted when the allocation tracking is enabled
+  std::shared_ptr<unsigned int> update_allocations;
+  /// CPU time of the updates and their execution time minus the CPU time, and context switches
+  /// of the last update, only sampled when the CPU time statistics are enabled
+  std::shared_ptr<MovingAverageStatistics> cpu_time_statistics;
+  std::shared_ptr<MovingAverageStatistics> preempted_time_statistics;
+  std::shared_ptr<unsigned int> update_voluntary_context_switches;
+  std::shared_ptr<unsigned int> update_involuntary_context_switches;
+  /// Time of the exchange of the interface frames in the control loop, and time from the sampling
+  /// of the states to the commit of the commands computed from them, only measured for the
+  /// asynchronous controllers using interface frames
+  std::shared_ptr<MovingAverageStatistics> stage_time_statistics;
+  std::shared_ptr<MovingAverageStatistics> command_latency_statistics;
+  /// Wall time of the parallel_for() calls of the updates and execution time of their longest
+  /// task, only measured for the synchronous controllers calling it
+  std::shared_ptr<MovingAverageStatistics> parallel_time_statistics;
+  std::shared_ptr<MovingAverageStatistics> parallel_task_time_statistics;
+  /// Hardware performance counters of the updates, only sampled when the performance counters
+  /// are enabled
+  std::shared_ptr<hardware_interface::PerformanceCountersStatisticsCollector>
+    performance_counters_statistics;
+  /// Id of the trace section of the controller update, 0 if the tracing is disabled
+  uint32_t update_trace_id = 0;
+  /// Reaction to a failed update, replaced whenever the controllers list changes
+  std::shared_ptr<const ControllerFaultPlan> fault_plan;
+  /// Shadow mode of the controller while it is inactive
+  std::shared_ptr<ControllerShadowMode> shadow_mode;
+  /// Set by the control loop when the active controller is deactivated after an error of its
+  /// hardware, to activate it again once the hardware is recovered
+  std::shared_ptr<std::atomic<bool>> deactivated_by_hardware_error;
+};
+
+/// Fields of a controller read by the real-time loop at every cycle, packed in one cache line.
+/**
+ * The entries are derived from the controllers list whenever the list is switched, in the same
+ * order, so that the loop scans them for the controllers to update without touching the names,
+ * the interfaces and the statistics of the ControllerSpec, which it only accesses through
+ * \ref spec_index for the controllers it updates. The pointed objects are owned by the
+ * ControllerSpec, they are shared by both controllers lists and change while the list is used.
+ */
+struct alignas(64) RealtimeControllerEntry
+{
+  controller_interface::ControllerInterfaceBase * controller = nullptr;
+  hardware_interface::RateDivider * rate_divider = nullptr;
+  hardware_interface::TimeBudget * time_budget = nullptr;
+  rclcpp::Time * last_update_cycle_time = nullptr;
+  ControllerShadowMode * shadow_mode = nullptr;
+  /// Index of the ControllerSpec in the controllers list
+  std::size_t spec_index = 0;
+  /// ControllerSpec::id, indexing the switch flags of the controller
+  std::size_t controller_id = 0;
+  /// ControllerSpec::controllers_chain_group_id
+  std::size_t chain_group_id = 0;
 };
 
 struct ControllerChainSpec
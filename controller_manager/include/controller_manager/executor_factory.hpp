@@ -0,0 +1,68 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <rclcpp/executor.hpp>
+#include <rclcpp/node_options.hpp>
+#include <rclcpp/parameter_value.hpp>
+
+namespace controller_manager
+{
+/// Executor spinning the non real-time callbacks of the controller manager and of the controllers
+enum class ExecutorType : std::uint8_t
+{
+  /// rclcpp::executors::MultiThreadedExecutor, the callback groups run in parallel
+  MULTI_THREADED,
+  /// rclcpp::executors::SingleThreadedExecutor, which only rebuilds its wait set on changes
+  SINGLE_THREADED,
+  /// rclcpp::experimental::executors::EventsExecutor, which waits for the events of the
+  /// middleware instead of rebuilding a wait set, for the setups with many nodes
+  EVENTS
+};
+
+/// Parses the name of an ExecutorType, i.e., "multi_threaded", "single_threaded" or "events".
+/**
+ * \returns false if the name is unknown or the executor is not available in this version of
+ * rclcpp, the type is left unchanged then.
+ */
+bool parse_executor_type(const std::string & name, ExecutorType & type);
+
+/// Creates the executor of the given type.
+/**
+ * \param[in] type type of the executor.
+ * \param[in] number_of_threads threads of the MULTI_THREADED executor, 0 for one per core.
+ */
+std::shared_ptr<rclcpp::Executor> create_executor(ExecutorType type, std::size_t number_of_threads);
+
+/// Returns the value a parameter of a node is overridden with by the node options.
+/**
+ * The executor has to be created before the controller manager, so its parameters are read from
+ * the parameter overrides and the parameter files of the arguments of the node options, with the
+ * same precedence as when the node is created.
+ *
+ * \param[in] options options the node will be created with.
+ * \param[in] node_fqn fully qualified name of the node, e.g., "/controller_manager".
+ * \param[in] name name of the parameter.
+ * \returns the value of the parameter, of type PARAMETER_NOT_SET if it isn't overridden.
+ */
+rclcpp::ParameterValue get_parameter_override(
+  const rclcpp::NodeOptions & options, const std::string & node_fqn, const std::string & name);
+
+}  // namespace controller_manager
@@ -0,0 +1,115 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "controller_interface/controller_interface_base.hpp"
+#include "hardware_interface/resource_manager.hpp"
+#include "rclcpp/clock.hpp"
+#include "rclcpp/duration.hpp"
+#include "rclcpp/logger.hpp"
+#include "rclcpp/time.hpp"
+
+namespace controller_manager
+{
+/// Read, update and write core of a control loop, without the node of the controller manager.
+/**
+ * The core owns a ResourceManager, created with its own clock and logger instead of the
+ * interfaces of a node, and runs the controllers added to it. It has no executor, no services and
+ * no parameters, so that the control loop runs on targets where the controller manager node is
+ * too heavy, e.g., on an embedded co-processor. The ControllerManager remains the ROS adapter of
+ * the same components and controllers.
+ *
+ * The controllers are loaded and initialized by the caller, e.g., created directly instead of
+ * through pluginlib. They are updated in the order in which they were added. Chainable
+ * controllers are not supported.
+ *
+ * \note The core is not thread-safe, it is used by one thread. read(), update() and write() are
+ * real-time safe once the controllers are activated.
+ */
+class HeadlessControlCore
+{
+public:
+  /// Loads and activates the hardware components of the robot description.
+  /**
+   * \param[in] urdf robot description with the ros2_control tags of the hardware components.
+   * \param[in] update_rate rate of the control loop in Hz.
+   * \param[in] logger logger of the core and of its ResourceManager.
+   */
+  HeadlessControlCore(
+    const std::string & urdf, unsigned int update_rate,
+    rclcpp::Logger logger = rclcpp::get_logger("headless_control_core"));
+
+  HeadlessControlCore(const HeadlessControlCore &) = delete;
+  HeadlessControlCore & operator=(const HeadlessControlCore &) = delete;
+
+  ~HeadlessControlCore();
+
+  hardware_interface::ResourceManager & get_resource_manager() { return *resource_manager_; }
+
+  rclcpp::Clock::SharedPtr get_clock() const { return clock_; }
+
+  unsigned int get_update_rate() const { return update_rate_; }
+
+  /// Adds an initialized controller and configures it.
+  /**
+   * \returns false if the controller is chainable, not initialized, already configured or failed
+   * to configure.
+   */
+  bool add_controller(const controller_interface::ControllerInterfaceBaseSharedPtr & controller);
+
+  /// Claims the interfaces of the inactive controllers and activates them.
+  /**
+   * \returns false if a controller couldn't claim its interfaces or failed to activate, it is then
+   * left inactive.
+   */
+  bool activate_controllers();
+
+  /// Deactivates the active controllers and releases their interfaces.
+  void deactivate_controllers();
+
+  const hardware_interface::HardwareReadWriteStatus & read(
+    const rclcpp::Time & time, const rclcpp::Duration & period);
+
+  /// Updates the active controllers.
+  /**
+   * \returns ERROR if a controller failed to update, the other controllers are still updated.
+   */
+  controller_interface::return_type update(
+    const rclcpp::Time & time, const rclcpp::Duration & period);
+
+  const hardware_interface::HardwareReadWriteStatus & write(
+    const rclcpp::Time & time, const rclcpp::Duration & period);
+
+private:
+  struct Controller
+  {
+    controller_interface::ControllerInterfaceBaseSharedPtr controller;
+    std::vector<std::string> command_interfaces;
+  };
+
+  bool activate_controller(Controller & controller);
+
+  rclcpp::Logger logger_;
+  rclcpp::Clock::SharedPtr clock_;
+  unsigned int update_rate_;
+  std::unique_ptr<hardware_interface::ResourceManager> resource_manager_;
+  std::vector<Controller> controllers_;
+};
+
+}  // namespace controller_manager
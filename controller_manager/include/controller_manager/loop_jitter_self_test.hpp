@@ -0,0 +1,125 @@
+// Copyright 2026 ROS2-Control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "controller_manager/sleeping_policies.hpp"
+#include "hardware_interface/types/statistics_types.hpp"
+
+namespace controller_manager
+{
+/// Periodic wait of the control loop recommended from the measured wake-up latency.
+struct PeriodicWaitRecommendation
+{
+  PeriodicWaitMode mode{PeriodicWaitMode::SLEEP};
+  /// Time spun before the start of the cycle in the HYBRID mode, in seconds
+  double spin_margin{0.0};
+  std::string reason{};
+};
+
+/// Recommends the periodic wait for the worst wake-up latency of the sleeps of the loop.
+/**
+ * Sleeping is recommended if the latency is below 5% of the period, the HYBRID mode if it is
+ * below half of the period, with a spin margin covering the latency like its calibration, and
+ * spinning on an isolated core otherwise.
+ */
+PeriodicWaitRecommendation recommend_periodic_wait(
+  std::chrono::nanoseconds period, std::chrono::nanoseconds worst_sleep_latency);
+
+/// Returns the name of a PeriodicWaitMode, as parsed by parse_periodic_wait_mode().
+std::string to_string(PeriodicWaitMode mode);
+
+/// Histogram of the timing measurements of the control loop in microseconds.
+class LoopTimingHistogram
+{
+public:
+  /// Number of the power of two buckets, below 1 us, then [1, 2) us up to >= 2^(N - 2) us
+  static constexpr std::size_t NUMBER_OF_BUCKETS = 18;
+
+  void add_measurement(double value_us) noexcept;
+
+  uint64_t get_count() const noexcept { return percentiles_.get_count(); }
+
+  double get_percentile(double percentile) const noexcept
+  {
+    return percentiles_.get_percentile(percentile);
+  }
+
+  double get_max() const noexcept { return max_us_; }
+
+  /// Returns the percentiles and a bar for every bucket between the first and the last non-empty
+  std::string to_string(const std::string & name) const;
+
+private:
+  ros2_control::LatencyHistogram percentiles_;
+  std::array<uint64_t, NUMBER_OF_BUCKETS> buckets_{};
+  double max_us_ = 0.0;
+};
+
+/// Calibration of the control loop of the ros2_control_node, similar to cyclictest.
+/**
+ * The loop runs with its real settings, i.e., the thread priority, the CPU affinity, the memory
+ * locking and the periodic wait, and the test collects the wake-up delay of every cycle, the
+ * latency of its sleep and the deviation of the measured period from the period of the update
+ * rate. Once the duration elapsed, the report lists their histograms and a recommendation of the
+ * periodic wait. add_cycle() doesn't allocate memory.
+ */
+class LoopJitterSelfTest
+{
+public:
+  LoopJitterSelfTest(
+    std::chrono::nanoseconds period, std::chrono::nanoseconds duration,
+    PeriodicWaitMode periodic_wait_mode);
+
+  /// Adds the measurements of a cycle and consumes the wait latencies of the state.
+  /**
+   * \param[in] measured_period time between the start of the previous and of this cycle.
+   * \param[in,out] state state of the loop, whose last_wake_up_delay and last_sleep_latency are
+   * reset once added.
+   * \returns true once the duration of the test elapsed.
+   */
+  bool add_cycle(std::chrono::nanoseconds measured_period, ControlLoopState & state) noexcept;
+
+  uint64_t get_number_of_cycles() const noexcept { return cycles_; }
+
+  const LoopTimingHistogram & get_wake_up_delay() const noexcept { return wake_up_delay_; }
+
+  const LoopTimingHistogram & get_sleep_latency() const noexcept { return sleep_latency_; }
+
+  const LoopTimingHistogram & get_period_deviation() const noexcept { return period_deviation_; }
+
+  /// Returns the recommended periodic wait, or nullopt if the loop didn't sleep, e.g., spinning.
+  std::optional<PeriodicWaitRecommendation> get_recommendation() const;
+
+  /// Returns the multi-line report of the measurements and of the recommendation
+  std::string get_report() const;
+
+private:
+  std::chrono::nanoseconds period_;
+  std::chrono::nanoseconds duration_;
+  PeriodicWaitMode periodic_wait_mode_;
+  std::chrono::nanoseconds elapsed_{0};
+  uint64_t cycles_ = 0;
+  LoopTimingHistogram wake_up_delay_;
+  LoopTimingHistogram sleep_latency_;
+  LoopTimingHistogram period_deviation_;
+};
+}  // namespace controller_manager
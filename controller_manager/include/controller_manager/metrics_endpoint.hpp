@@ -0,0 +1,125 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace controller_manager
+{
+/// Content type of the OpenMetrics text format served by the MetricsEndpoint
+constexpr char OPENMETRICS_CONTENT_TYPE[] =
+  "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+/// Writer of metrics in the OpenMetrics text format, also read by Prometheus.
+/**
+ * The samples of a family are added after the family and before the next one, each family is
+ * written once. The names are sanitized and the values of the labels are escaped.
+ */
+class OpenMetricsWriter
+{
+public:
+  enum class MetricType : std::uint8_t
+  {
+    GAUGE,
+    COUNTER
+  };
+
+  using Labels = std::vector<std::pair<std::string, std::string>>;
+
+  /// Starts a family of metrics.
+  /**
+   * \param[in] name name of the family, the samples of a counter are suffixed with ``_total``.
+   * \param[in] type type of the metrics of the family.
+   * \param[in] help description of the family.
+   */
+  void add_family(const std::string & name, MetricType type, const std::string & help);
+
+  /// Adds a sample to the last family, a NaN value is written as ``NaN``.
+  void add_sample(const Labels & labels, double value);
+
+  /// Returns the metrics, terminated by the ``# EOF`` marker.
+  std::string str() const;
+
+private:
+  std::string text_;
+  std::string sample_name_;
+};
+
+struct MetricsEndpointParams
+{
+  /// Address of the TCP socket, e.g., 0.0.0.0 to serve the metrics on all the network interfaces
+  std::string address = "127.0.0.1";
+  /// Port of the TCP socket, 0 to bind an ephemeral port, see MetricsEndpoint::get_port()
+  uint16_t port = 9464;
+  /// Path of a Unix domain socket used instead of the TCP socket, if not empty. A socket left at
+  /// the path is replaced, any other file fails the construction of the endpoint.
+  std::string unix_socket_path;
+};
+
+/// HTTP endpoint serving metrics in the OpenMetrics text format on ``GET /metrics``.
+/**
+ * The endpoint serves the last metrics passed to update_metrics() from its own non real-time
+ * thread, one request per connection, so that a scrape never waits for the thread producing the
+ * metrics and the producer never waits for a slow client. A client has one second to send its
+ * request, the connection is closed afterwards.
+ *
+ * \note Only supported on POSIX systems.
+ */
+class MetricsEndpoint
+{
+public:
+  /// Binds the socket and starts the thread of the endpoint.
+  /**
+   * \throws std::runtime_error if the socket cannot be bound, or on a non POSIX system.
+   */
+  explicit MetricsEndpoint(const MetricsEndpointParams & params);
+
+  /// Stops the thread and closes the socket.
+  ~MetricsEndpoint();
+
+  MetricsEndpoint(const MetricsEndpoint &) = delete;
+  MetricsEndpoint & operator=(const MetricsEndpoint &) = delete;
+
+  /// Replaces the metrics served by the next requests, e.g., the text of an OpenMetricsWriter.
+  void update_metrics(std::string metrics);
+
+  /// Port of the TCP socket, 0 if the endpoint serves a Unix domain socket.
+  uint16_t get_port() const { return port_; }
+
+  /// Number of the requests answered, whatever their status.
+  uint64_t get_served_requests() const { return served_requests_.load(std::memory_order_relaxed); }
+
+private:
+  void serve_loop();
+
+  void serve_connection(int connection);
+
+  std::string unix_socket_path_;
+  int socket_ = -1;
+  uint16_t port_ = 0;
+  std::mutex metrics_mutex_;
+  std::string metrics_;
+  std::atomic<uint64_t> served_requests_{0};
+  std::atomic<bool> stop_{false};
+  std::thread thread_;
+};
+
+}  // namespace controller_manager
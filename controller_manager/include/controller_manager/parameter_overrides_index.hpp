@@ -0,0 +1,73 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <rclcpp/parameter.hpp>
+
+namespace controller_manager
+{
+/// Parameters of the parameter files, indexed by the fully qualified name of their nodes.
+/**
+ * A parameter file is parsed once, and its parameters are then looked up by node, so that loading
+ * many controllers from one large file doesn't parse the whole file again for every controller.
+ * A file is parsed again when its size or modification time changes.
+ */
+class ParameterOverridesIndex
+{
+public:
+  /// Returns the parameters of a node in a parameter file.
+  /**
+   * The parameters of the entries with wildcards matching the node, e.g., `/**`, come first, then
+   * the ones of the entry of the node itself, so that the latter take precedence when they are
+   * applied in order as parameter overrides.
+   *
+   * \param[in] parameters_file path of the parameter file.
+   * \param[in] node_fqn fully qualified name of the node, e.g., "/ns/my_controller".
+   * \throws std::runtime_error if the file can't be read or parsed.
+   */
+  std::vector<rclcpp::Parameter> get_parameter_overrides(
+    const std::string & parameters_file, const std::string & node_fqn);
+
+  /// Returns true if the node name pattern of a parameter file entry, e.g., `/**/my_controller`,
+  /// matches the fully qualified name of a node.
+  static bool node_name_matches(const std::string & pattern, const std::string & node_fqn);
+
+  /// Returns the number of times a parameter file was parsed, e.g., for testing.
+  std::size_t get_number_of_parses() const;
+
+private:
+  struct IndexedFile
+  {
+    std::filesystem::file_time_type write_time;
+    std::uintmax_t size = 0;
+    std::unordered_map<std::string, std::vector<rclcpp::Parameter>> nodes;
+    std::vector<std::pair<std::string, std::vector<rclcpp::Parameter>>> wildcard_nodes;
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, IndexedFile> files_;
+  std::size_t number_of_parses_ = 0;
+};
+
+}  // namespace controller_manager
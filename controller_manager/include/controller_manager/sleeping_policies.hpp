@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <string>
 
 #include <rclcpp/logging.hpp>
 
@@ -22,12 +25,45 @@
 
 namespace controller_manager
 {
+/// How the control loop waits for the start of the next periodic cycle
+enum class PeriodicWaitMode : std::uint8_t
+{
+  /// Sleep until the start of the cycle
+  SLEEP,
+  /// Spin on the steady clock until the start of the cycle, for loops running on isolated cores
+  SPIN,
+  /// Sleep until shortly before the start of the cycle and spin for the remaining time
+  HYBRID
+};
+
+/// Parses the name of a PeriodicWaitMode, i.e., "sleep", "spin" or "hybrid".
+/**
+ * \returns false if the name is unknown, the mode is left unchanged then.
+ */
+bool parse_periodic_wait_mode(const std::string & name, PeriodicWaitMode & mode);
+
 struct ControlLoopTimingConfig
 {
   bool use_sim_time{false};
   bool manage_overruns{true};
   bool expect_blocking_read_write{false};
   double minimum_cycle_time{0.0001};
+  /// Hardware component whose cycle trigger paces the control loop, empty to use the own clock
+  std::string cycle_trigger_component{};
+  /// Maximum time to wait for the cycle trigger, in seconds, before running the cycle anyway
+  double cycle_trigger_timeout{0.1};
+  PeriodicWaitMode periodic_wait_mode{PeriodicWaitMode::SLEEP};
+  /// Time spun before the start of the cycle in the HYBRID mode, in seconds, 0 to calibrate it
+  /// from the measured wake-up latency
+  double spin_margin{0.0};
+  /// Slow the loop down while no active controller claims command interfaces
+  bool idle_enable{false};
+  /// Rate of the loop while idle, in Hz, 0 to only run a cycle when the loop is notified
+  double idle_update_rate{10.0};
+  /// Whether active controllers claiming no command interface, e.g., broadcasters, keep it idle
+  bool idle_with_state_only_controllers{true};
+  /// Skip the write of the hardware while idle, and the read if no controller is active
+  bool idle_pause_hardware{false};
 };
 
 struct ControlLoopState
@@ -36,6 +72,13 @@ struct ControlLoopState
   std::chrono::steady_clock::time_point next_iteration_time;
   std::chrono::nanoseconds period{0};
   rclcpp::Time cycle_end_time;  //< The time when work was done in the current cycle.
+  std::shared_ptr<hardware_interface::CycleTrigger> cycle_trigger;  //< Resolved lazily.
+  /// Calibrated time spun before the start of the cycle in the HYBRID mode.
+  std::chrono::nanoseconds calibrated_spin_margin{std::chrono::microseconds(100)};
+  /// Delay of the start of the last periodic cycle, negative if the loop didn't wait for it.
+  std::chrono::nanoseconds last_wake_up_delay{-1};
+  /// Latency of the last sleep of the periodic wait, negative if the wait didn't sleep.
+  std::chrono::nanoseconds last_sleep_latency{-1};
 };
 }  // namespace controller_manager
 
@@ -52,3 +95,54 @@ void sleep_for_periodic_cycle(
   std::shared_ptr<controller_manager::ControllerManager> cm,
   const controller_manager::ControlLoopTimingConfig & config,
   controller_manager::ControlLoopState & state);
+
+/// Samples the time of the current control cycle, to be passed to read, update and write.
+/**
+ * Without simulation time the steady clock is read directly, which is the clock of the trigger
+ * clock of the controller manager.
+ */
+rclcpp::Time sample_cycle_time(
+  const std::shared_ptr<controller_manager::ControllerManager> & cm,
+  const controller_manager::ControlLoopTimingConfig & config);
+
+/// Waits until the given time with the PeriodicWaitMode of the config.
+/**
+ * In the HYBRID mode without a fixed spin margin, the margin in the state is adapted to the
+ * measured wake-up latency of the sleep. The latency of the sleep is stored in the state.
+ *
+ * \returns the delay between the given time and the wake-up.
+ */
+std::chrono::nanoseconds wait_until_steady_time(
+  const controller_manager::ControlLoopTimingConfig & config,
+  controller_manager::ControlLoopState & state, std::chrono::steady_clock::time_point wake_up_time);
+
+/// Whether the control loop runs at the idle rate, with the idle settings of the config.
+/**
+ * The loop is idle if the idle policy is enabled and no controller is active, or only controllers
+ * claiming no command interface if idle_with_state_only_controllers is set.
+ */
+bool is_control_loop_idle(
+  const std::shared_ptr<controller_manager::ControllerManager> & cm,
+  const controller_manager::ControlLoopTimingConfig & config);
+
+/// Waits for the next cycle of the idle control loop.
+/**
+ * Waits for the period of the idle update rate, or until the controller manager notifies the loop,
+ * e.g., on a controller switch request, so that the full rate resumes with the next cycle. With an
+ * idle update rate of 0, a cycle only runs when the loop is notified. The periodic schedule is
+ * restarted at the wake-up, so that resuming the full rate isn't reported as an overrun.
+ */
+void sleep_while_idle(
+  std::shared_ptr<controller_manager::ControllerManager> cm,
+  const controller_manager::ControlLoopTimingConfig & config,
+  controller_manager::ControlLoopState & state);
+
+/// Waits for the cycle trigger of the hardware component set in the config.
+/**
+ * Falls back to sleep_for_periodic_cycle() until the component is loaded. If the trigger doesn't
+ * fire within the timeout, the cycle is run anyway so that the controllers keep being updated.
+ */
+void sleep_for_hardware_trigger(
+  std::shared_ptr<controller_manager::ControllerManager> cm,
+  const controller_manager::ControlLoopTimingConfig & config,
+  controller_manager::ControlLoopState & state);
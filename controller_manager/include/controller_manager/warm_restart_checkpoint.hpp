@@ -0,0 +1,95 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace controller_manager
+{
+/// Version of the format of the warm restart checkpoint file
+constexpr int WARM_RESTART_CHECKPOINT_VERSION = 1;
+
+/// State of a controller manager, restored by the next process after a restart.
+/**
+ * The states are the ids of the primary lifecycle states, see lifecycle_msgs::msg::State.
+ */
+struct WarmRestartCheckpoint
+{
+  struct HardwareComponent
+  {
+    std::string name;
+    uint8_t state = 0;
+
+    bool operator==(const HardwareComponent & other) const
+    {
+      return name == other.name && state == other.state;
+    }
+  };
+
+  struct Controller
+  {
+    std::string name;
+    std::string type;
+    uint8_t state = 0;
+
+    bool operator==(const Controller & other) const
+    {
+      return name == other.name && type == other.type && state == other.state;
+    }
+  };
+
+  /// Hash of the robot description, the checkpoint is only restored with the same description
+  uint64_t robot_description_hash = 0;
+  std::vector<HardwareComponent> hardware_components;
+  /// Controllers in their update order, i.e., the preceding controllers of a chain first
+  std::vector<Controller> controllers;
+
+  bool operator==(const WarmRestartCheckpoint & other) const
+  {
+    return robot_description_hash == other.robot_description_hash &&
+           hardware_components == other.hardware_components && controllers == other.controllers;
+  }
+
+  bool operator!=(const WarmRestartCheckpoint & other) const { return !(*this == other); }
+};
+
+/// Serializes the checkpoint in the text format of the checkpoint file.
+std::string serialize_warm_restart_checkpoint(const WarmRestartCheckpoint & checkpoint);
+
+/// Deserializes a checkpoint written by serialize_warm_restart_checkpoint.
+/**
+ * \throws std::runtime_error if the data is of another version, truncated or malformed.
+ */
+WarmRestartCheckpoint deserialize_warm_restart_checkpoint(const std::string & data);
+
+/// Writes the checkpoint to a file, replaced atomically so that a crash during the write still
+/// leaves the previous checkpoint.
+/**
+ * \returns false if the file cannot be written.
+ */
+bool write_warm_restart_checkpoint(
+  const std::string & file_path, const WarmRestartCheckpoint & checkpoint);
+
+/// Reads the checkpoint from a file.
+/**
+ * \returns false if the file doesn't exist.
+ * \throws std::runtime_error if the file is of another version, truncated or malformed.
+ */
+bool read_warm_restart_checkpoint(
+  const std::string & file_path, WarmRestartCheckpoint & checkpoint);
+
+}  // namespace controller_manager
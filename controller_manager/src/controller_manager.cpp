@@ -16,16 +16,49 @@
 
 #include <fmt/compile.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <regex>
 #include <set>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "controller_interface/controller_interface_base.hpp"
 #include "controller_manager_msgs/msg/hardware_component_state.hpp"
+#include "hardware_interface/allocation_tracker.hpp"
+#include "hardware_interface/cycle_profiler.hpp"
+#include "hardware_interface/cycle_trace_ring.hpp"
+#include "hardware_interface/deferred_logger.hpp"
+#include "hardware_interface/hardware_info_cache.hpp"
 #include "hardware_interface/helpers.hpp"
+#include "hardware_interface/instrumentation_clock.hpp"
+#include "hardware_interface/interface_id_set.hpp"
 #include "hardware_interface/introspection.hpp"
+#include "hardware_interface/introspection_sink.hpp"
+#include "hardware_interface/memory_arena.hpp"
+#include "hardware_interface/numa_memory.hpp"
+#include "hardware_interface/realtime_thread.hpp"
+#include "hardware_interface/performance_counters.hpp"
+#include "hardware_interface/robot_description_reference.hpp"
+#include "hardware_interface/static_plugin_registry.hpp"
+#include "hardware_interface/thread_times.hpp"
+#include "hardware_interface/trace_recorder.hpp"
 #include "hardware_interface/types/lifecycle_state_names.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
 #include "rcl/arguments.h"
@@ -42,6 +75,39 @@ static constexpr const char * kControllerInterfaceClassName =
 static constexpr const char * kChainableControllerInterfaceClassName =
   "controller_interface::ChainableControllerInterface";
 
+// The controllers compiled into the executable, registered with
+// HARDWARE_INTERFACE_REGISTER_STATIC_PLUGIN() for one of the base classes of the loaders
+using StaticControllerRegistry =
+  hardware_interface::StaticPluginRegistry<controller_interface::ControllerInterface>;
+using StaticChainableControllerRegistry =
+  hardware_interface::StaticPluginRegistry<controller_interface::ChainableControllerInterface>;
+// Clock of the execution times and the statistics of the control loop
+using hardware_interface::InstrumentationClock;
+
+bool is_static_controller_type(const std::string & controller_type)
+{
+  return StaticControllerRegistry::is_class_available(controller_type) ||
+         StaticChainableControllerRegistry::is_class_available(controller_type);
+}
+
+std::vector<std::string> get_static_controller_types()
+{
+  auto types = StaticControllerRegistry::get_declared_classes();
+  const auto chainable_types = StaticChainableControllerRegistry::get_declared_classes();
+  types.insert(types.end(), chainable_types.begin(), chainable_types.end());
+  return types;
+}
+
+controller_interface::ControllerInterfaceBaseSharedPtr create_static_controller(
+  const std::string & controller_type)
+{
+  if (StaticChainableControllerRegistry::is_class_available(controller_type))
+  {
+    return StaticChainableControllerRegistry::create_unique_instance(controller_type);
+  }
+  return StaticControllerRegistry::create_unique_instance(controller_type);
+}
+
 // Changed services history QoS to keep all so we don't lose any client service calls
 // \note The versions conditioning is added here to support the source-compatibility with Humble
 #if RCLCPP_VERSION_MAJOR >= 17
@@ -281,38 +347,104 @@ std::vector<std::string> get_state_interfaces_names(
   return state_interface_names;
 }
 
-// Gets the list of active controllers that use the command interface of the given controller
-void get_active_controllers_using_command_interfaces_of_controller(
-  const std::string & controller_name,
+// Appends the cached controllers of the failed components to the list, once each, without
+// comparing the names of the components
+void add_controllers_of_failed_components(
+  const hardware_interface::ResourceManager & resource_manager,
+  const hardware_interface::FailedHardwareComponents & failed_components,
+  bool command_controllers_only, std::vector<std::string> & controllers)
+{
+  const auto dependencies = resource_manager.get_hardware_dependencies();
+  for (const std::size_t component_index : failed_components.get_indices())
+  {
+    const auto & controller_indices =
+      command_controllers_only ? dependencies->get_command_controllers_of_component(component_index)
+                               : dependencies->get_controllers_of_component(component_index);
+    for (const std::size_t controller_index : controller_indices)
+    {
+      const auto & controller_name = dependencies->get_controller_name(controller_index);
+      if (std::find(controllers.begin(), controllers.end(), controller_name) == controllers.end())
+      {
+        controllers.push_back(controller_name);
+      }
+    }
+  }
+}
+
+// Flags the active controllers of the list deactivated after an error of their hardware
+void flag_controllers_deactivated_by_hardware_error(
   const std::vector<controller_manager::ControllerSpec> & controllers,
-  std::vector<std::string> & controllers_using_command_interfaces,
+  const std::vector<std::string> & deactivated_controllers)
+{
+  for (const auto & controller_name : deactivated_controllers)
+  {
+    const auto controller_it = std::find_if(
+      controllers.begin(), controllers.end(),
+      std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+    if (controller_it != controllers.end() && is_controller_active(controller_it->c))
+    {
+      controller_it->deactivated_by_hardware_error->store(true, std::memory_order_relaxed);
+    }
+  }
+}
+
+// Resolves the reaction of the real-time loop to a failed update of every controller of the list
+void update_controllers_fault_plans(
+  std::vector<controller_manager::ControllerSpec> & controllers,
   const std::unique_ptr<hardware_interface::ResourceManager> & resource_manager)
 {
-  auto it = std::find_if(
-    controllers.begin(), controllers.end(),
-    std::bind(controller_name_compare, std::placeholders::_1, controller_name));
-  if (it == controllers.end())
+  std::vector<std::vector<std::string>> command_interfaces(controllers.size());
+  // the pairwise conflicts are checked on the bitsets of the interface ids
+  std::vector<hardware_interface::InterfaceIdSet> command_interface_ids(controllers.size());
+  for (std::size_t i = 0; i < controllers.size(); ++i)
   {
-    RCLCPP_ERROR(
-      rclcpp::get_logger("ControllerManager::utils"),
-      "Controller '%s' not found in the list of controllers.", controller_name.c_str());
-    return;
+    if (is_controller_active(controllers[i].c) || is_controller_inactive(controllers[i].c))
+    {
+      command_interfaces[i] = get_command_interfaces_names(controllers[i].c, resource_manager);
+      command_interface_ids[i].insert(command_interfaces[i]);
+    }
   }
-  const auto cmd_itfs = get_command_interfaces_names(it->c, resource_manager);
-  for (const auto & cmd_itf : cmd_itfs)
+  for (std::size_t i = 0; i < controllers.size(); ++i)
   {
-    for (const auto & controller : controllers)
+    auto plan = std::make_shared<controller_manager::ControllerFaultPlan>();
+    plan->command_interfaces = command_interfaces[i];
+    for (const auto & fallback_controller : controllers[i].info.fallback_controllers_names)
     {
-      const auto ctrl_cmd_itfs = get_command_interfaces_names(controller.c, resource_manager);
-      // check if the controller is active and has the command interface and make sure that it
-      // doesn't exist in the list already
-      if (
-        is_controller_active(controller.c) &&
-        std::find(ctrl_cmd_itfs.begin(), ctrl_cmd_itfs.end(), cmd_itf) != ctrl_cmd_itfs.end())
+      const auto it = std::find_if(
+        controllers.begin(), controllers.end(),
+        std::bind(controller_name_compare, std::placeholders::_1, fallback_controller));
+      if (it == controllers.end())
+      {
+        continue;
+      }
+      const auto fallback_index = static_cast<std::size_t>(it - controllers.begin());
+      for (const auto other_fallback_index : plan->fallback_controllers)
+      {
+        if (
+          plan->invalid_reason.empty() &&
+          command_interface_ids[fallback_index].intersects(
+            command_interface_ids[other_fallback_index]))
+        {
+          plan->invalid_reason = fmt::format(
+            FMT_COMPILE(
+              "the fallback controllers '{}' and '{}' of the controller '{}' claim the same "
+              "command interfaces"),
+            controllers[other_fallback_index].info.name, fallback_controller,
+            controllers[i].info.name);
+        }
+      }
+      ros2_control::add_item(plan->fallback_controllers, fallback_index);
+      for (std::size_t j = 0; j < controllers.size(); ++j)
       {
-        ros2_control::add_item(controllers_using_command_interfaces, controller.info.name);
+        if (
+          j != fallback_index &&
+          command_interface_ids[fallback_index].intersects(command_interface_ids[j]))
+        {
+          ros2_control::add_item(plan->conflicting_controllers, j);
+        }
       }
     }
+    controllers[i].fault_plan = plan;
   }
 }
 
@@ -495,11 +627,75 @@ void build_controller_full_chain_map_cache(
   }
 }
 
+/// Version of the format of the controllers topology cache file
+constexpr int CONTROLLERS_TOPOLOGY_CACHE_VERSION = 1;
+
+void write_names(std::ostream & stream, const std::vector<std::string> & names)
+{
+  stream << names.size();
+  for (const auto & name : names)
+  {
+    stream << ' ' << name;
+  }
+  stream << '\n';
+}
+
+bool read_names(std::istream & stream, std::vector<std::string> & names)
+{
+  std::size_t count = 0;
+  if (!(stream >> count))
+  {
+    return false;
+  }
+  names.resize(count);
+  for (auto & name : names)
+  {
+    if (!(stream >> name))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename MapT>
+void write_names_map(std::ostream & stream, const MapT & names_map)
+{
+  stream << names_map.size() << '\n';
+  for (const auto & [name, names] : names_map)
+  {
+    stream << name << ' ';
+    write_names(stream, names);
+  }
+}
+
+template <typename MapT>
+bool read_names_map(std::istream & stream, MapT & names_map)
+{
+  std::size_t count = 0;
+  if (!(stream >> count))
+  {
+    return false;
+  }
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    std::string name;
+    if (!(stream >> name) || !read_names(stream, names_map[name]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename PercentilesT>
 void register_controller_manager_statistics(
   const std::string & name,
-  const libstatistics_collector::moving_average_statistics::StatisticData * variable)
+  const libstatistics_collector::moving_average_statistics::StatisticData * variable,
+  const PercentilesT * percentiles)
 {
   REGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name, variable);
+  REGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name, percentiles);
 }
 
 void unregister_controller_manager_statistics(const std::string & name)
@@ -509,8 +705,103 @@ void unregister_controller_manager_statistics(const std::string & name)
   UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/average");
   UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/standard_deviation");
   UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/sample_count");
+  UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/p50");
+  UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/p99");
+  UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/p99_9");
+  UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/p99_99");
   UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/current_value");
 }
+
+/// Registers the statistics of the performance counters of the updates of a controller
+void register_performance_counters_statistics(
+  const std::string & prefix,
+  const hardware_interface::PerformanceCountersStatisticsCollector & statistics)
+{
+  register_controller_manager_statistics(
+    prefix + "cycles", &statistics.cycles->get_statistics_const_ptr(),
+    &statistics.cycles->get_histogram());
+  register_controller_manager_statistics(
+    prefix + "instructions_per_cycle",
+    &statistics.instructions_per_cycle->get_statistics_const_ptr(),
+    &statistics.instructions_per_cycle->get_histogram());
+  register_controller_manager_statistics(
+    prefix + "cache_misses", &statistics.cache_misses->get_statistics_const_ptr(),
+    &statistics.cache_misses->get_histogram());
+  register_controller_manager_statistics(
+    prefix + "branch_misses", &statistics.branch_misses->get_statistics_const_ptr(),
+    &statistics.branch_misses->get_histogram());
+}
+
+/// Registers the statistics of the performance counters of the cycles of a hardware component
+void register_performance_counters_statistics(
+  const std::string & prefix,
+  const hardware_interface::PerformanceCountersStatisticsData & statistics)
+{
+  register_controller_manager_statistics(
+    prefix + "cycles", &statistics.cycles.get_statistics_const_ptr(),
+    &statistics.cycles.get_percentiles_const_ptr());
+  register_controller_manager_statistics(
+    prefix + "instructions_per_cycle",
+    &statistics.instructions_per_cycle.get_statistics_const_ptr(),
+    &statistics.instructions_per_cycle.get_percentiles_const_ptr());
+  register_controller_manager_statistics(
+    prefix + "cache_misses", &statistics.cache_misses.get_statistics_const_ptr(),
+    &statistics.cache_misses.get_percentiles_const_ptr());
+  register_controller_manager_statistics(
+    prefix + "branch_misses", &statistics.branch_misses.get_statistics_const_ptr(),
+    &statistics.branch_misses.get_percentiles_const_ptr());
+}
+
+void unregister_performance_counters_statistics(const std::string & prefix)
+{
+  unregister_controller_manager_statistics(prefix + "cycles");
+  unregister_controller_manager_statistics(prefix + "instructions_per_cycle");
+  unregister_controller_manager_statistics(prefix + "cache_misses");
+  unregister_controller_manager_statistics(prefix + "branch_misses");
+}
+
+/// Registers the usage of the memory arena of a controller or of a hardware component
+void register_memory_arena_statistics(
+  const std::string & name, const hardware_interface::MemoryArena * memory_arena)
+{
+  REGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name, memory_arena);
+}
+
+void unregister_memory_arena_statistics(const std::string & name)
+{
+  UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/capacity");
+  UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/used_bytes");
+  UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/high_water_mark");
+  UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/overflow_bytes");
+}
+
+/// Appends the states that changed since the published ones to \p changed_states, and the names
+/// that are not listed anymore to \p removed_names, then stores the states as the published ones.
+void update_published_states(
+  const std::vector<controller_manager_msgs::msg::NamedLifecycleState> & states,
+  std::map<std::string, lifecycle_msgs::msg::State> & published_states,
+  std::vector<controller_manager_msgs::msg::NamedLifecycleState> & changed_states,
+  std::vector<std::string> & removed_names)
+{
+  std::map<std::string, lifecycle_msgs::msg::State> new_published_states;
+  for (const auto & named_state : states)
+  {
+    const auto it = published_states.find(named_state.name);
+    if (it == published_states.end() || it->second != named_state.state)
+    {
+      changed_states.push_back(named_state);
+    }
+    new_published_states[named_state.name] = named_state.state;
+  }
+  for (const auto & [name, state] : published_states)
+  {
+    if (new_published_states.find(name) == new_published_states.end())
+    {
+      removed_names.push_back(name);
+    }
+  }
+  published_states = std::move(new_published_states);
+}
 }  // namespace
 
 namespace controller_manager
@@ -548,17 +839,21 @@ ControllerManager::ControllerManager(
   chainable_loader_(
     std::make_shared<pluginlib::ClassLoader<controller_interface::ChainableControllerInterface>>(
       kControllerInterfaceNamespace, kChainableControllerInterfaceClassName)),
-  robot_description_(urdf),
+  robot_description_(std::make_shared<const std::string>(urdf)),
   activate_all_hw_components_(activate_all_hw_components)
 {
   initialize_parameters();
-  init_resource_manager(urdf);
+  if (robot_description_->empty())
+  {
+    robot_description_ = std::make_shared<const std::string>(read_cached_robot_description());
+  }
+  init_resource_manager(*robot_description_);
   init_controller_manager();
   if (is_resource_manager_initialized())
   {
     set_initial_hardware_components_state();
-    init_services();
   }
+  start_ros_interfaces();
 }
 
 ControllerManager::ControllerManager(
@@ -581,17 +876,18 @@ ControllerManager::ControllerManager(
     throw std::runtime_error("The parsed resource manager is a nullptr!");
   }
 
-  robot_description_ = resource_manager_->get_robot_description();
+  robot_description_ =
+    std::make_shared<const std::string>(resource_manager_->get_robot_description());
   initialize_parameters();
   if (is_resource_manager_initialized())
   {
     init_controller_manager();
     set_initial_hardware_components_state();
-    init_services();
+    start_ros_interfaces();
   }
   else
   {
-    if (!robot_description_.empty())
+    if (!robot_description_->empty())
     {
       RCLCPP_FATAL(get_logger(), "The resource manager is not properly initialized");
       throw std::runtime_error(
@@ -604,12 +900,29 @@ ControllerManager::ControllerManager(
         "The resource manager is not yet initialized, will wait for the robot description to "
         "initialize it..");
       init_controller_manager();
+      start_ros_interfaces();
     }
   }
 }
 
 ControllerManager::~ControllerManager()
 {
+  stop_activity_publisher();
+  stop_trace_writer();
+  stop_overrun_forensics_writer();
+  stop_introspection_sink_writer();
+  // the timer refreshing the metrics is stopped before the endpoint serving them
+  metrics_endpoint_timer_.reset();
+  metrics_endpoint_.reset();
+  if (resource_manager_)
+  {
+    resource_manager_->set_on_component_recovered_callback(nullptr);
+  }
+  if (deferred_logger_started_)
+  {
+    hardware_interface::DeferredLogger::stop();
+    deferred_logger_started_ = false;
+  }
   CLEAR_ALL_ROS2_CONTROL_INTROSPECTION_REGISTRIES();
   if (preshutdown_cb_handle_)
   {
@@ -652,37 +965,195 @@ bool ControllerManager::shutdown_controllers()
 
 void ControllerManager::init_controller_manager()
 {
-  // Initialized activity publisher and diagnostics
-  controller_manager_activity_publisher_ =
-    create_publisher<controller_manager_msgs::msg::ControllerManagerActivity>(
-      "~/activity", rclcpp::QoS(1).reliable().transient_local());
   rt_controllers_wrapper_.set_on_switch_callback(
-    std::bind(&ControllerManager::publish_activity, this));
+    std::bind(&ControllerManager::request_activity_publish, this));
+  rt_controllers_wrapper_.set_on_list_updated_callback(
+    std::bind(&ControllerManager::notify_control_loop, this));
   if (resource_manager_)
   {
     resource_manager_->set_on_component_state_switch_callback(
-      std::bind(&ControllerManager::publish_activity, this));
+      std::bind(&ControllerManager::request_activity_publish, this));
+    resource_manager_->set_on_component_recovered_callback(
+      std::bind(
+        &ControllerManager::on_hardware_component_recovered, this, std::placeholders::_1,
+        std::placeholders::_2));
   }
 
-  // Setup diagnostics
-  periodicity_stats_.reset();
-  diagnostics_updater_.setHardwareID("ros2_control");
-  diagnostics_updater_.add(
-    "Controllers Activity", this, &ControllerManager::controller_activity_diagnostic_callback);
-  diagnostics_updater_.add(
-    "Hardware Components Activity", this,
-    &ControllerManager::hardware_components_diagnostic_callback);
-  diagnostics_updater_.add(
-    "Controller Manager Activity", this,
-    &ControllerManager::controller_manager_diagnostic_callback);
+  overload_governor_.configure(
+    static_cast<uint32_t>(params_->overload_governor.window),
+    params_->overload_governor.min_headroom, params_->overload_governor.restore_headroom,
+    static_cast<uint32_t>(params_->overload_governor.restore_windows),
+    static_cast<uint32_t>(params_->overload_governor.max_decimation));
 
-  INITIALIZE_ROS2_CONTROL_INTROSPECTION_REGISTRY(
-    this, hardware_interface::DEFAULT_INTROSPECTION_TOPIC,
-    hardware_interface::DEFAULT_REGISTRY_KEY);
-  START_ROS2_CONTROL_INTROSPECTION_PUBLISHER_THREAD(hardware_interface::DEFAULT_REGISTRY_KEY);
-  INITIALIZE_ROS2_CONTROL_INTROSPECTION_REGISTRY(
-    this, hardware_interface::CM_STATISTICS_TOPIC, hardware_interface::CM_STATISTICS_KEY);
-  START_ROS2_CONTROL_INTROSPECTION_PUBLISHER_THREAD(hardware_interface::CM_STATISTICS_KEY);
+  if (!params_->controller_libraries.preload.empty() && !controller_libraries_preload_.valid())
+  {
+    controller_libraries_preload_ = std::async(
+      std::launch::async, &ControllerManager::preload_controller_libraries, this,
+      params_->controller_libraries.preload);
+  }
+
+  if (!params_->warm_restart.checkpoint_file.empty() && !warm_restart_checkpoint_timer_)
+  {
+    warm_restart_checkpoint_timer_ = create_wall_timer(
+      std::chrono::duration<double>(params_->warm_restart.checkpoint_period),
+      [this]() { checkpoint_warm_restart_state(); });
+  }
+
+  if (params_->parallel_update.number_of_workers > 0)
+  {
+    hardware_interface::RTWorkerPoolParams pool_params;
+    pool_params.number_of_workers =
+      static_cast<unsigned int>(params_->parallel_update.number_of_workers);
+    pool_params.thread_priority = static_cast<int>(params_->parallel_update.thread_priority);
+    pool_params.cpu_affinity_cores.assign(
+      params_->parallel_update.cpu_affinity.begin(), params_->parallel_update.cpu_affinity.end());
+    pool_params.name = "update_worker";
+    pool_params.stack_prefault_size =
+      static_cast<std::size_t>(params_->realtime_threads.stack_prefault_size);
+    update_worker_pool_ = std::make_unique<hardware_interface::RTWorkerPool>(
+      pool_params, get_logger().get_child("update_worker_pool"));
+    RCLCPP_INFO(
+      get_logger(), "Updating independent controller chains in parallel on %u worker threads.",
+      pool_params.number_of_workers);
+  }
+
+  if (params_->controller_worker_pool.number_of_workers > 0)
+  {
+    hardware_interface::RTWorkerPoolParams pool_params;
+    pool_params.number_of_workers =
+      static_cast<unsigned int>(params_->controller_worker_pool.number_of_workers);
+    pool_params.thread_priority = static_cast<int>(params_->controller_worker_pool.thread_priority);
+    pool_params.cpu_affinity_cores.assign(
+      params_->controller_worker_pool.cpu_affinity.begin(),
+      params_->controller_worker_pool.cpu_affinity.end());
+    pool_params.name = "controller_worker";
+    pool_params.stack_prefault_size =
+      static_cast<std::size_t>(params_->realtime_threads.stack_prefault_size);
+    controller_worker_pool_ = std::make_shared<hardware_interface::RTWorkerPool>(
+      pool_params, get_logger().get_child("controller_worker_pool"));
+    RCLCPP_INFO(
+      get_logger(), "Executing the parallel tasks of the controllers on %u worker threads.",
+      pool_params.number_of_workers);
+  }
+
+  if (
+    params_->allocation_tracking.enable &&
+    !hardware_interface::AllocationTracker::is_hook_installed())
+  {
+    RCLCPP_WARN(
+      get_logger(),
+      "The allocation tracking is enabled, but the executable doesn't count the heap allocations. "
+      "Use the ros2_control_node or replace the global operator new to track the allocations.");
+  }
+
+  if (params_->cpu_time_statistics.enable)
+  {
+    // the sampling is process-wide, another controller manager may have enabled it
+    hardware_interface::ThreadTimes::set_sampling_enabled(true);
+  }
+
+  if (params_->performance_counters.enable)
+  {
+    hardware_interface::PerformanceCounters::set_sampling_enabled(true);
+    if (!hardware_interface::PerformanceCounters::is_available())
+    {
+      RCLCPP_WARN(
+        get_logger(),
+        "The performance counters are enabled, but the hardware performance counters can't be "
+        "opened. Check the kernel.perf_event_paranoid setting and that the CPU exposes them.");
+    }
+  }
+
+  if (params_->instrumentation_clock.use_cpu_counter)
+  {
+    if (InstrumentationClock::use_cpu_counter())
+    {
+      RCLCPP_INFO(
+        get_logger(), "The instrumentation uses the counter of the CPU at %.3f MHz.",
+        InstrumentationClock::get_counter_frequency() * 1e-6);
+    }
+    else
+    {
+      RCLCPP_WARN(
+        get_logger(),
+        "The instrumentation clock is set to use the counter of the CPU, but the CPU has no "
+        "invariant counter. The steady clock is used instead.");
+    }
+  }
+
+  // the sections are also recorded by the ~/profile_cycles service without tracing
+  const std::string cm_name = get_name();
+  trace_ids_.read = hardware_interface::TraceRecorder::register_name(cm_name + "/read");
+  trace_ids_.update = hardware_interface::TraceRecorder::register_name(cm_name + "/update");
+  trace_ids_.enforce_command_limits =
+    hardware_interface::TraceRecorder::register_name(cm_name + "/enforce_command_limits");
+  trace_ids_.switch_controllers =
+    hardware_interface::TraceRecorder::register_name(cm_name + "/switch_controllers");
+  trace_ids_.write = hardware_interface::TraceRecorder::register_name(cm_name + "/write");
+  trace_ids_.cycle = hardware_interface::TraceRecorder::register_name(cm_name + "/cycle");
+  if (params_->tracing.enable && !trace_writer_thread_.joinable())
+  {
+    hardware_interface::TraceRecorder::enable(
+      static_cast<std::size_t>(params_->tracing.events_per_thread),
+      static_cast<std::size_t>(params_->tracing.max_threads));
+    trace_writer_stop_ = false;
+    hardware_interface::RealtimeThreadParams thread_params;
+    thread_params.name = "trace_writer";
+    trace_writer_thread_ = hardware_interface::create_realtime_thread(
+      thread_params, get_logger(),
+      [this, output_file = params_->tracing.output_file]() { trace_writer_loop(output_file); });
+    RCLCPP_INFO(
+      get_logger(), "Recording the trace of the control loop to '%s'.",
+      params_->tracing.output_file.c_str());
+  }
+
+  if (params_->overrun_forensics.enable && !overrun_forensics_writer_thread_.joinable())
+  {
+    hardware_interface::CycleTraceRing::enable(
+      static_cast<std::size_t>(params_->overrun_forensics.cycles),
+      static_cast<std::size_t>(params_->overrun_forensics.sections_per_cycle));
+    overrun_forensics_writer_stop_ = false;
+    hardware_interface::RealtimeThreadParams thread_params;
+    thread_params.name = "overrun_writer";
+    overrun_forensics_writer_thread_ = hardware_interface::create_realtime_thread(
+      thread_params, get_logger(),
+      [this, directory = params_->overrun_forensics.output_directory,
+       max_files = params_->overrun_forensics.max_files]()
+      { overrun_forensics_writer_loop(directory, max_files); });
+    RCLCPP_INFO(
+      get_logger(), "Keeping the last %ld control cycles to write them to '%s' on an overrun.",
+      params_->overrun_forensics.cycles, params_->overrun_forensics.output_directory.c_str());
+  }
+
+  if (params_->deferred_logging.enable && !deferred_logger_started_)
+  {
+    hardware_interface::DeferredLogger::start(
+      static_cast<std::size_t>(params_->deferred_logging.records_per_thread),
+      static_cast<std::size_t>(params_->deferred_logging.max_threads));
+    deferred_logger_started_ = true;
+    RCLCPP_INFO(get_logger(), "Deferring the output of the messages of the real-time loop.");
+  }
+
+  if (params_->introspection_sink.enable && !introspection_sink_writer_thread_.joinable())
+  {
+    hardware_interface::IntrospectionSink::enable(
+      static_cast<std::size_t>(params_->introspection_sink.capacity),
+      static_cast<std::size_t>(params_->introspection_sink.max_variables));
+    introspection_sink_writer_stop_ = false;
+    hardware_interface::RealtimeThreadParams thread_params;
+    thread_params.name = "sink_writer";
+    introspection_sink_writer_thread_ = hardware_interface::create_realtime_thread(
+      thread_params, get_logger(),
+      [this, output_file = params_->introspection_sink.output_file]()
+      { introspection_sink_writer_loop(output_file); });
+    RCLCPP_INFO(
+      get_logger(), "Recording the introspection variables to '%s'.",
+      params_->introspection_sink.output_file.c_str());
+  }
+
+  periodicity_stats_.reset();
+  wake_up_jitter_stats_.reset();
+  switch_latency_stats_.reset();
 
   // Add on_shutdown callback to stop the controller manager
   rclcpp::Context::SharedPtr context = this->get_node_base_interface()->get_context();
@@ -691,6 +1162,7 @@ void ControllerManager::init_controller_manager()
       [this]()
       {
         RCLCPP_INFO(get_logger(), "Shutdown request received....");
+        stop_warm_restart_checkpoint();
         if (this->get_node_base_interface()->get_associated_with_executor_atomic().load())
         {
           executor_->remove_node(this->get_node_base_interface());
@@ -710,60 +1182,542 @@ void ControllerManager::init_controller_manager()
   init_robot_description_callback();
 }
 
-void ControllerManager::initialize_parameters()
+void ControllerManager::init_ros_interfaces()
 {
-  // Initialize parameters
-  try
-  {
-    use_sim_time_ = this->get_parameter("use_sim_time").as_bool();
-
-    if (!this->has_parameter("overruns.print_warnings"))
-    {
-      rcl_interfaces::msg::ParameterDescriptor descriptor;
-      descriptor.description =
-        "If true, the controller manager will print a warning message to the console if an overrun "
-        "is detected in its real-time loop (read, update and write). By default, it is set to "
-        "true, except when used with use_sim_time parameter set to true.";
-      descriptor.read_only = false;
-      auto parameter = rclcpp::ParameterValue(!use_sim_time_);
-      this->declare_parameter("overruns.print_warnings", parameter, descriptor);
-    }
-    cm_param_listener_ = std::make_shared<controller_manager::ParamListener>(
-      this->get_node_parameters_interface(), this->get_logger());
-    params_ = std::make_shared<controller_manager::Params>(cm_param_listener_->get_params());
-    update_rate_ = static_cast<unsigned int>(params_->update_rate);
-    trigger_clock_ =
-      use_sim_time_ ? this->get_clock() : std::make_shared<rclcpp::Clock>(RCL_STEADY_TIME);
-    RCLCPP_INFO(
-      get_logger(), "Using %s clock for triggering controller manager cycles.",
-      trigger_clock_->get_clock_type() == RCL_STEADY_TIME ? "Steady (Monotonic)" : "ROS");
-  }
-  catch (const std::exception & e)
+  // Initialize activity publisher
+  controller_manager_activity_publisher_ =
+    create_publisher<controller_manager_msgs::msg::ControllerManagerActivity>(
+      "~/activity", rclcpp::QoS(1).reliable().transient_local());
+  // the late subscribers get the recent changes to apply to the last activity message
+  controller_manager_activity_changes_publisher_ =
+    create_publisher<controller_manager_msgs::msg::ControllerManagerActivityChanges>(
+      "~/activity_changes", rclcpp::QoS(100).reliable().transient_local());
+  if (!activity_publisher_thread_.joinable())
   {
-    RCLCPP_ERROR(
-      this->get_logger(),
-      "Exception thrown while initializing controller manager parameters: %s \n", e.what());
-    throw e;
+    activity_publisher_stop_ = false;
+    hardware_interface::RealtimeThreadParams thread_params;
+    thread_params.name = "activity_pub";
+    activity_publisher_thread_ = hardware_interface::create_realtime_thread(
+      thread_params, get_logger(), [this]() { activity_publisher_loop(); });
   }
-}
 
-void ControllerManager::init_robot_description_callback()
-{
-  if (!robot_description_subscription_)
+  configure_introspection(*params_);
+  if (!introspection_parameters_callback_handle_)
   {
-    robot_description_subscription_ = create_subscription<std_msgs::msg::String>(
-      "robot_description", rclcpp::QoS(1).transient_local(),
-      std::bind(&ControllerManager::robot_description_callback, this, std::placeholders::_1));
-    RCLCPP_INFO(
-      get_logger(), "Subscribing to '%s' topic for robot description.",
-      robot_description_subscription_->get_topic_name());
+    introspection_parameters_callback_handle_ = add_post_set_parameters_callback(
+      [this](const std::vector<rclcpp::Parameter> & parameters)
+      {
+        const bool introspection_changed = std::any_of(
+          parameters.begin(), parameters.end(),
+          [](const rclcpp::Parameter & parameter)
+          {
+            return parameter.get_name().rfind("introspection.", 0) == 0 ||
+                   parameter.get_name().rfind("introspection_sink.", 0) == 0;
+          });
+        if (introspection_changed)
+        {
+          configure_introspection(cm_param_listener_->get_params());
+        }
+      });
   }
 
-  if (!is_resource_manager_initialized() && !robot_description_notification_timer_)
-  {
-    robot_description_notification_timer_ = create_wall_timer(
-      std::chrono::seconds(1),
-      [&]()
+  // Setup diagnostics
+  diagnostics_updater_.setHardwareID("ros2_control");
+  diagnostics_updater_.add(
+    "Controllers Activity", this, &ControllerManager::controller_activity_diagnostic_callback);
+  diagnostics_updater_.add(
+    "Hardware Components Activity", this,
+    &ControllerManager::hardware_components_diagnostic_callback);
+  diagnostics_updater_.add(
+    "Controller Manager Activity", this,
+    &ControllerManager::controller_manager_diagnostic_callback);
+
+  INITIALIZE_ROS2_CONTROL_INTROSPECTION_REGISTRY(
+    this, hardware_interface::DEFAULT_INTROSPECTION_TOPIC,
+    hardware_interface::DEFAULT_REGISTRY_KEY);
+  START_ROS2_CONTROL_INTROSPECTION_PUBLISHER_THREAD(hardware_interface::DEFAULT_REGISTRY_KEY);
+  INITIALIZE_ROS2_CONTROL_INTROSPECTION_REGISTRY(
+    this, hardware_interface::CM_STATISTICS_TOPIC, hardware_interface::CM_STATISTICS_KEY);
+  START_ROS2_CONTROL_INTROSPECTION_PUBLISHER_THREAD(hardware_interface::CM_STATISTICS_KEY);
+
+  if (params_->metrics_endpoint.enable && !metrics_endpoint_)
+  {
+    MetricsEndpointParams endpoint_params;
+    endpoint_params.address = params_->metrics_endpoint.address;
+    endpoint_params.port = static_cast<uint16_t>(params_->metrics_endpoint.port);
+    endpoint_params.unix_socket_path = params_->metrics_endpoint.unix_socket_path;
+    try
+    {
+      metrics_endpoint_ = std::make_unique<MetricsEndpoint>(endpoint_params);
+      // the metrics are built in the executor, the thread of the endpoint only serves the last ones
+      metrics_endpoint_timer_ = create_wall_timer(
+        std::chrono::duration<double>(params_->metrics_endpoint.update_period),
+        [this]() { metrics_endpoint_->update_metrics(export_metrics()); });
+      if (endpoint_params.unix_socket_path.empty())
+      {
+        RCLCPP_INFO(
+          get_logger(), "Serving the metrics on http://%s:%u/metrics.",
+          endpoint_params.address.c_str(), metrics_endpoint_->get_port());
+      }
+      else
+      {
+        RCLCPP_INFO(
+          get_logger(), "Serving the metrics on the Unix socket '%s'.",
+          endpoint_params.unix_socket_path.c_str());
+      }
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(get_logger(), "The metrics endpoint is disabled: %s", e.what());
+    }
+  }
+
+  if (is_resource_manager_initialized())
+  {
+    init_services();
+  }
+  ros_interfaces_initialized_.store(true, std::memory_order_release);
+}
+
+void ControllerManager::start_ros_interfaces()
+{
+  if (!params_->staged_startup.enable)
+  {
+    init_ros_interfaces();
+    return;
+  }
+  if (!staged_startup_timer_)
+  {
+    // the executor runs the timer once it spins, i.e., after the real-time loop is started
+    staged_startup_timer_ = create_wall_timer(
+      std::chrono::milliseconds(0),
+      [this]()
+      {
+        staged_startup_timer_->cancel();
+        const auto start_time = std::chrono::steady_clock::now();
+        init_ros_interfaces();
+        RCLCPP_INFO(
+          get_logger(), "Initialized the services, diagnostics and introspection in %.3f ms.",
+          std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time)
+            .count());
+      });
+  }
+}
+
+void ControllerManager::on_hardware_component_recovered(
+  const std::string & component, bool restore_controllers)
+{
+  request_activity_publish();
+  if (!restore_controllers)
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(hardware_recovery_mutex_);
+  recovered_hardware_components_.push_back(component);
+  if (hardware_recovery_timer_ && !hardware_recovery_timer_->is_canceled())
+  {
+    // the pending timer restores the controllers of this component as well
+    return;
+  }
+  // the switch waits for the real-time loop, so it runs in the executor and not in the thread of
+  // the resource manager running the recoveries
+  hardware_recovery_timer_ = create_wall_timer(
+    std::chrono::milliseconds(0), [this]() { restore_controllers_of_recovered_hardware(); });
+}
+
+void ControllerManager::restore_controllers_of_recovered_hardware()
+{
+  std::vector<std::string> recovered_components;
+  {
+    std::lock_guard<std::mutex> guard(hardware_recovery_mutex_);
+    hardware_recovery_timer_->cancel();
+    recovered_components.swap(recovered_hardware_components_);
+  }
+  std::vector<std::string> controllers_to_activate;
+  {
+    std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+      rt_controllers_wrapper_.controllers_lock_);
+    const auto & controllers = rt_controllers_wrapper_.get_updated_list(guard);
+    for (const auto & component : recovered_components)
+    {
+      for (const auto & controller_name :
+           resource_manager_->get_cached_controllers_to_hardware(component))
+      {
+        const auto controller_it = std::find_if(
+          controllers.begin(), controllers.end(),
+          std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+        if (
+          controller_it != controllers.end() && is_controller_inactive(controller_it->c) &&
+          controller_it->deactivated_by_hardware_error->load(std::memory_order_relaxed))
+        {
+          ros2_control::add_item(controllers_to_activate, controller_name);
+        }
+      }
+    }
+  }
+  if (controllers_to_activate.empty())
+  {
+    return;
+  }
+  std::string controllers_string;
+  for (const auto & controller_name : controllers_to_activate)
+  {
+    controllers_string += controller_name + " ";
+  }
+  RCLCPP_INFO(
+    get_logger(), "Activating controllers [ %s] again after the recovery of their hardware.",
+    controllers_string.c_str());
+  const auto strictness = controller_manager_msgs::srv::SwitchController::Request::BEST_EFFORT;
+  if (
+    switch_controller(controllers_to_activate, {}, strictness, true) !=
+    controller_interface::return_type::OK)
+  {
+    RCLCPP_WARN(
+      get_logger(), "Could not activate the controllers [ %s] of the recovered hardware.",
+      controllers_string.c_str());
+  }
+}
+
+std::string ControllerManager::read_cached_robot_description() const
+{
+  const auto & cache_file = params_->staged_startup.robot_description_cache_file;
+  if (cache_file.empty())
+  {
+    return "";
+  }
+  std::ifstream file(cache_file, std::ios::binary);
+  if (!file)
+  {
+    RCLCPP_INFO(
+      get_logger(), "No cached robot description in '%s', waiting for the robot description.",
+      cache_file.c_str());
+    return "";
+  }
+  std::string robot_description(
+    (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  RCLCPP_INFO(
+    get_logger(), "Initializing the resource manager from the cached robot description '%s'.",
+    cache_file.c_str());
+  return robot_description;
+}
+
+void ControllerManager::write_cached_robot_description(const std::string & robot_description) const
+{
+  const auto & cache_file = params_->staged_startup.robot_description_cache_file;
+  if (cache_file.empty())
+  {
+    return;
+  }
+  // replace the cache atomically, a restart during the write still finds a complete description
+  const std::string temporary_file = cache_file + ".tmp";
+  {
+    std::ofstream file(temporary_file, std::ios::binary | std::ios::trunc);
+    file << robot_description;
+    if (!file)
+    {
+      RCLCPP_WARN(
+        get_logger(), "Failed to write the robot description cache '%s'.", temporary_file.c_str());
+      return;
+    }
+  }
+  if (std::rename(temporary_file.c_str(), cache_file.c_str()) != 0)
+  {
+    RCLCPP_WARN(
+      get_logger(), "Failed to replace the robot description cache '%s'.", cache_file.c_str());
+  }
+}
+
+const WarmRestartCheckpoint * ControllerManager::get_warm_restart_checkpoint(
+  const std::string & robot_description)
+{
+  const auto & checkpoint_file = params_->warm_restart.checkpoint_file;
+  if (checkpoint_file.empty() || !params_->warm_restart.restore)
+  {
+    return nullptr;
+  }
+  if (!warm_restart_checkpoint_read_)
+  {
+    warm_restart_checkpoint_read_ = true;
+    WarmRestartCheckpoint checkpoint;
+    try
+    {
+      if (!read_warm_restart_checkpoint(checkpoint_file, checkpoint))
+      {
+        RCLCPP_INFO(
+          get_logger(), "No warm restart checkpoint in '%s', it is created.",
+          checkpoint_file.c_str());
+        return nullptr;
+      }
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_WARN(
+        get_logger(), "Ignoring the warm restart checkpoint '%s': %s", checkpoint_file.c_str(),
+        e.what());
+      return nullptr;
+    }
+    // the libraries are loaded while the hardware components are initialized
+    std::vector<std::string> controller_types = params_->controller_libraries.preload;
+    for (const auto & controller : checkpoint.controllers)
+    {
+      ros2_control::add_item(controller_types, controller.type);
+    }
+    if (!controller_libraries_preload_.valid())
+    {
+      controller_libraries_preload_ = std::async(
+        std::launch::async, &ControllerManager::preload_controller_libraries, this,
+        controller_types);
+    }
+    warm_restart_checkpoint_ = std::move(checkpoint);
+  }
+  if (!warm_restart_checkpoint_ || robot_description.empty())
+  {
+    return nullptr;
+  }
+  if (
+    warm_restart_checkpoint_->robot_description_hash !=
+    hardware_interface::HardwareInfoCache::hash(robot_description))
+  {
+    RCLCPP_WARN(
+      get_logger(),
+      "Ignoring the warm restart checkpoint '%s', it was written for another robot description.",
+      checkpoint_file.c_str());
+    warm_restart_checkpoint_.reset();
+    return nullptr;
+  }
+  return &warm_restart_checkpoint_.value();
+}
+
+void ControllerManager::restore_warm_restart_controllers()
+{
+  warm_restart_restore_timer_->cancel();
+  const auto * checkpoint = get_warm_restart_checkpoint(*robot_description_);
+  if (checkpoint == nullptr)
+  {
+    warm_restart_pending_.store(false, std::memory_order_release);
+    return;
+  }
+  const auto start_time = std::chrono::steady_clock::now();
+  RCLCPP_INFO(
+    get_logger(), "Restoring %zu controllers from the warm restart checkpoint '%s'.",
+    checkpoint->controllers.size(), params_->warm_restart.checkpoint_file.c_str());
+  {
+    std::lock_guard<std::mutex> guard(services_lock_);
+    // the controllers loaded meanwhile, e.g., by a spawner, are left to their client
+    const auto loaded_controllers = get_controller_names();
+    std::vector<std::string> controllers_to_configure;
+    std::vector<std::string> controllers_to_activate;
+    for (const auto & controller : checkpoint->controllers)
+    {
+      if (ros2_control::has_item(loaded_controllers, controller.name))
+      {
+        continue;
+      }
+      if (load_controller(controller.name, controller.type) == nullptr)
+      {
+        RCLCPP_ERROR(
+          get_logger(), "Could not restore the controller '%s' of type '%s'.",
+          controller.name.c_str(), controller.type.c_str());
+        continue;
+      }
+      if (
+        controller.state == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE ||
+        controller.state == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+      {
+        controllers_to_configure.push_back(controller.name);
+      }
+    }
+
+    const unsigned int configuration_threads =
+      params_->warm_restart.configuration_threads > 0
+        ? static_cast<unsigned int>(params_->warm_restart.configuration_threads)
+        : std::thread::hardware_concurrency();
+    const auto results = configure_controllers(controllers_to_configure, configuration_threads);
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      const auto controller_it = std::find_if(
+        checkpoint->controllers.begin(), checkpoint->controllers.end(),
+        [&](const auto & controller) { return controller.name == controllers_to_configure[i]; });
+      if (results[i] != controller_interface::return_type::OK)
+      {
+        RCLCPP_ERROR(
+          get_logger(), "Could not configure the restored controller '%s'.",
+          controllers_to_configure[i].c_str());
+      }
+      else if (controller_it->state == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+      {
+        controllers_to_activate.push_back(controllers_to_configure[i]);
+      }
+    }
+
+    // the chained controllers are activated together, in one switch
+    const auto strictness = controller_manager_msgs::srv::SwitchController::Request::BEST_EFFORT;
+    if (
+      !controllers_to_activate.empty() &&
+      switch_controller(controllers_to_activate, {}, strictness, true) !=
+        controller_interface::return_type::OK)
+    {
+      RCLCPP_ERROR(get_logger(), "Could not activate the restored controllers.");
+    }
+  }
+  warm_restart_checkpoint_.reset();
+  warm_restart_pending_.store(false, std::memory_order_release);
+  startup_time_.warm_restart_time =
+    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time)
+      .count();
+  RCLCPP_INFO(
+    get_logger(), "Restored the controllers of the warm restart checkpoint in %.3f ms.",
+    startup_time_.warm_restart_time);
+}
+
+void ControllerManager::checkpoint_warm_restart_state()
+{
+  std::lock_guard<std::mutex> checkpoint_guard(warm_restart_checkpoint_mutex_);
+  if (
+    warm_restart_checkpoint_stopped_ || warm_restart_pending_.load(std::memory_order_acquire) ||
+    !is_resource_manager_initialized())
+  {
+    return;
+  }
+  WarmRestartCheckpoint checkpoint;
+  checkpoint.robot_description_hash =
+    hardware_interface::HardwareInfoCache::hash(*robot_description_);
+  for (const auto & [component_name, component_info] : resource_manager_->get_components_status())
+  {
+    checkpoint.hardware_components.push_back({component_name, component_info.state.id()});
+  }
+  std::sort(
+    checkpoint.hardware_components.begin(), checkpoint.hardware_components.end(),
+    [](const auto & a, const auto & b) { return a.name < b.name; });
+  {
+    std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+      rt_controllers_wrapper_.controllers_lock_);
+    for (const auto & controller : rt_controllers_wrapper_.get_updated_list(guard))
+    {
+      checkpoint.controllers.push_back(
+        {controller.info.name, controller.info.type, controller.c->get_lifecycle_id()});
+    }
+  }
+  if (checkpoint == last_warm_restart_checkpoint_)
+  {
+    return;
+  }
+  const auto & checkpoint_file = params_->warm_restart.checkpoint_file;
+  if (!write_warm_restart_checkpoint(checkpoint_file, checkpoint))
+  {
+    RCLCPP_WARN(
+      get_logger(), "Failed to write the warm restart checkpoint '%s'.", checkpoint_file.c_str());
+    return;
+  }
+  last_warm_restart_checkpoint_ = std::move(checkpoint);
+}
+
+void ControllerManager::stop_warm_restart_checkpoint()
+{
+  if (params_->warm_restart.checkpoint_file.empty())
+  {
+    return;
+  }
+  checkpoint_warm_restart_state();
+  std::lock_guard<std::mutex> checkpoint_guard(warm_restart_checkpoint_mutex_);
+  warm_restart_checkpoint_stopped_ = true;
+}
+
+void ControllerManager::initialize_parameters()
+{
+  // Initialize parameters
+  try
+  {
+    use_sim_time_ = this->get_parameter("use_sim_time").as_bool();
+
+    if (!this->has_parameter("overruns.print_warnings"))
+    {
+      rcl_interfaces::msg::ParameterDescriptor descriptor;
+      descriptor.description =
+        "If true, the controller manager will print a warning message to the console if an overrun "
+        "is detected in its real-time loop (read, update and write). By default, it is set to "
+        "true, except when used with use_sim_time parameter set to true.";
+      descriptor.read_only = false;
+      auto parameter = rclcpp::ParameterValue(!use_sim_time_);
+      this->declare_parameter("overruns.print_warnings", parameter, descriptor);
+    }
+    cm_param_listener_ = std::make_shared<controller_manager::ParamListener>(
+      this->get_node_parameters_interface(), this->get_logger());
+    params_ = std::make_shared<controller_manager::Params>(cm_param_listener_->get_params());
+    update_rate_ = static_cast<unsigned int>(params_->update_rate);
+    rate_phase_allocator_.reset(update_rate_);
+    trigger_clock_ =
+      use_sim_time_ ? this->get_clock() : std::make_shared<rclcpp::Clock>(RCL_STEADY_TIME);
+    RCLCPP_INFO(
+      get_logger(), "Using %s clock for triggering controller manager cycles.",
+      trigger_clock_->get_clock_type() == RCL_STEADY_TIME ? "Steady (Monotonic)" : "ROS");
+    if (params_->async_worker_pool.number_of_workers > 0 && !async_worker_pool_)
+    {
+      hardware_interface::AsyncWorkerPoolParams pool_params;
+      pool_params.number_of_workers =
+        static_cast<unsigned int>(params_->async_worker_pool.number_of_workers);
+      pool_params.thread_priority = static_cast<int>(params_->async_worker_pool.thread_priority);
+      pool_params.cpu_affinity_cores.assign(
+        params_->async_worker_pool.cpu_affinity.begin(),
+        params_->async_worker_pool.cpu_affinity.end());
+      pool_params.max_tasks = static_cast<std::size_t>(params_->async_worker_pool.max_tasks);
+      pool_params.stack_prefault_size =
+        static_cast<std::size_t>(params_->realtime_threads.stack_prefault_size);
+      async_worker_pool_ = std::make_shared<hardware_interface::AsyncWorkerPool>(
+        pool_params, get_logger().get_child("async_worker_pool"));
+      RCLCPP_INFO(
+        get_logger(), "Running the asynchronous controllers and hardware on %u worker threads.",
+        pool_params.number_of_workers);
+    }
+    for (const auto & loop_name : params_->control_loops.names)
+    {
+      if (control_loop_pools_.count(loop_name) > 0)
+      {
+        continue;
+      }
+      const auto & loop_params = params_->control_loops.names_map.at(loop_name);
+      hardware_interface::AsyncWorkerPoolParams pool_params;
+      pool_params.number_of_workers = 1;
+      pool_params.thread_priority = static_cast<int>(loop_params.thread_priority);
+      pool_params.cpu_affinity_cores.assign(
+        loop_params.cpu_affinity.begin(), loop_params.cpu_affinity.end());
+      pool_params.max_tasks = static_cast<std::size_t>(loop_params.max_tasks);
+      pool_params.name = loop_name;
+      pool_params.stack_prefault_size =
+        static_cast<std::size_t>(params_->realtime_threads.stack_prefault_size);
+      control_loop_pools_[loop_name] = std::make_shared<hardware_interface::AsyncWorkerPool>(
+        pool_params, get_logger().get_child("control_loop." + loop_name));
+      RCLCPP_INFO(
+        get_logger(), "Running the control loop '%s' with the thread priority %d.",
+        loop_name.c_str(), pool_params.thread_priority);
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(
+      this->get_logger(),
+      "Exception thrown while initializing controller manager parameters: %s \n", e.what());
+    throw e;
+  }
+}
+
+void ControllerManager::init_robot_description_callback()
+{
+  if (!robot_description_subscription_)
+  {
+    robot_description_subscription_ = create_subscription<std_msgs::msg::String>(
+      "robot_description", rclcpp::QoS(1).transient_local(),
+      std::bind(&ControllerManager::robot_description_callback, this, std::placeholders::_1));
+    RCLCPP_INFO(
+      get_logger(), "Subscribing to '%s' topic for robot description.",
+      robot_description_subscription_->get_topic_name());
+  }
+
+  if (!is_resource_manager_initialized() && !robot_description_notification_timer_)
+  {
+    robot_description_notification_timer_ = create_wall_timer(
+      std::chrono::seconds(1),
+      [&]()
       {
         RCLCPP_WARN(
           get_logger(), "Waiting for data on 'robot_description' topic to finish initialization");
@@ -776,7 +1730,63 @@ void ControllerManager::robot_description_callback(const std_msgs::msg::String &
   RCLCPP_INFO(get_logger(), "Received robot description from topic.");
   RCLCPP_DEBUG(
     get_logger(), "'Content of robot description file: %s", robot_description.data.c_str());
-  robot_description_ = robot_description.data;
+  std::optional<hardware_interface::RobotDescriptionReference> reference;
+  if (params_->robot_description_references)
+  {
+    try
+    {
+      reference = hardware_interface::RobotDescriptionReference::parse(robot_description.data);
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(get_logger(), "Ignoring the robot description: %s", e.what());
+      return;
+    }
+  }
+  std::shared_ptr<const std::string> received_description;
+  bool matches_loaded_description = false;
+  if (reference)
+  {
+    // an unchanged hash skips the mapping, the parsing and the reload of the description
+    if (
+      is_resource_manager_initialized() && reference->hash.has_value() &&
+      reference->hash.value() == hardware_interface::HardwareInfoCache::hash(*robot_description_))
+    {
+      RCLCPP_DEBUG(
+        get_logger(), "The referenced robot description '%s' is the loaded one.",
+        reference->to_string().c_str());
+      return;
+    }
+    try
+    {
+      received_description = reference->read();
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(get_logger(), "Ignoring the robot description: %s", e.what());
+      return;
+    }
+    RCLCPP_INFO(
+      get_logger(), "Read the robot description from '%s'.", reference->to_string().c_str());
+    matches_loaded_description = *robot_description_ == *received_description;
+  }
+  else
+  {
+    matches_loaded_description = *robot_description_ == robot_description.data;
+    received_description = std::make_shared<const std::string>(robot_description.data);
+  }
+  robot_description_ = received_description;
+  write_cached_robot_description(*robot_description_);
+  if (is_resource_manager_initialized() && matches_loaded_description)
+  {
+    RCLCPP_DEBUG(get_logger(), "The received robot description is the loaded one.");
+    return;
+  }
+  if (is_resource_manager_initialized() && params_->incremental_robot_description_reload)
+  {
+    reload_robot_description(*robot_description_);
+    return;
+  }
   if (is_resource_manager_initialized())
   {
     RCLCPP_WARN(
@@ -786,7 +1796,7 @@ void ControllerManager::robot_description_callback(const std_msgs::msg::String &
     return;
   }
 
-  init_resource_manager(robot_description_);
+  init_resource_manager(*robot_description_);
   if (!is_resource_manager_initialized())
   {
     // The RM failed to init AFTER we received the description - a critical error.
@@ -802,10 +1812,15 @@ void ControllerManager::robot_description_callback(const std_msgs::msg::String &
     "Resource Manager has been successfully initialized. Starting Controller Manager "
     "services...");
 
-  init_services();
+  // otherwise the services are initialized with the other ROS interfaces of the staged startup
+  if (ros_interfaces_initialized_.load(std::memory_order_acquire))
+  {
+    init_services();
+  }
 }
 
-void ControllerManager::init_resource_manager(const std::string & robot_description)
+hardware_interface::ResourceManagerParams ControllerManager::get_resource_manager_params(
+  const std::string & robot_description) const
 {
   hardware_interface::ResourceManagerParams params;
   params.robot_description = robot_description;
@@ -820,22 +1835,202 @@ void ControllerManager::init_resource_manager(const std::string & robot_descript
   params.return_failed_hardware_names_on_return_deactivate_write_cycle_ =
     params_->defaults.deactivate_controllers_on_hardware_self_deactivate;
   params.handle_exceptions = params_->handle_exceptions;
+  params.contiguous_interface_storage = params_->contiguous_interface_storage;
+  params.float32_state_interface_storage = params_->float32_state_interface_storage;
+  params.read_write_worker_pool.number_of_workers =
+    static_cast<unsigned int>(params_->parallel_read_write.number_of_workers);
+  params.read_write_worker_pool.thread_priority =
+    static_cast<int>(params_->parallel_read_write.thread_priority);
+  params.read_write_worker_pool.cpu_affinity_cores.assign(
+    params_->parallel_read_write.cpu_affinity.begin(),
+    params_->parallel_read_write.cpu_affinity.end());
+  params.read_write_worker_pool.name = "read_write_worker";
+  params.read_write_worker_pool.stack_prefault_size =
+    static_cast<std::size_t>(params_->realtime_threads.stack_prefault_size);
+  params.shared_memory_export.enable = params_->shared_memory_export.enable;
+  params.shared_memory_export.segment_name = params_->shared_memory_export.segment_name;
+  params.shared_memory_export.include_command_interfaces =
+    params_->shared_memory_export.include_command_interfaces;
+  params.remote_interface_export.enable = params_->remote_interface_export.enable;
+  params.remote_interface_export.local_port =
+    static_cast<uint16_t>(params_->remote_interface_export.local_port);
+  params.remote_interface_export.remote_address = params_->remote_interface_export.remote_address;
+  params.remote_interface_export.remote_port =
+    static_cast<uint16_t>(params_->remote_interface_export.remote_port);
+  params.remote_interface_export.state_interfaces =
+    params_->remote_interface_export.state_interfaces;
+  params.remote_interface_export.command_interfaces =
+    params_->remote_interface_export.command_interfaces;
+  params.hardware_status_aggregation.enable = params_->hardware_status_aggregation.enable;
+  params.hardware_status_aggregation.publish_rate =
+    params_->hardware_status_aggregation.publish_rate;
+  params.state_snapshot_publisher.enable = params_->state_snapshot_publisher.enable;
+  params.state_snapshot_publisher.decimation =
+    static_cast<unsigned int>(params_->state_snapshot_publisher.decimation);
+  params.edge_events.capacity = static_cast<std::size_t>(params_->edge_events.capacity);
+  params.flight_recorder.enable = params_->flight_recorder.enable;
+  params.flight_recorder.capacity = static_cast<std::size_t>(params_->flight_recorder.capacity);
+  params.flight_recorder.interfaces = params_->flight_recorder.interfaces;
+  params.flight_recorder.include_command_interfaces =
+    params_->flight_recorder.include_command_interfaces;
+  params.flight_recorder.output_file = params_->flight_recorder.output_file;
+  params.flight_recorder.dump_file_prefix = params_->flight_recorder.dump_file_prefix;
+  params.spread_rate_divider_phases = params_->rate_scheduling.spread_phases;
+  params.transmission_stage_plugin = params_->transmission_stage_plugin;
+  params.transmission_stage_in_place = params_->transmission_stage_in_place;
+  params.hardware_info_cache_directory = params_->hardware_info_cache_directory;
+  params.component_initialization_threads =
+    static_cast<unsigned int>(params_->hardware_components_initialization_threads);
+  params.command_mode_switch_prepare_timeout = params_->hardware_components_prepare_switch_timeout;
+  params.defer_control_loop_transitions = params_->hardware_components_deferred_transitions;
+  params.introspected_interfaces = params_->introspection.interfaces;
+  params.memory_arena_size =
+    static_cast<std::size_t>(params_->memory_arenas.hardware_component_size);
+  params.thread_stack_prefault_size =
+    static_cast<std::size_t>(params_->realtime_threads.stack_prefault_size);
+  params.async_worker_pool = async_worker_pool_;
+  params.control_loop_pools = control_loop_pools_;
+  return params;
+}
+
+void ControllerManager::init_resource_manager(const std::string & robot_description)
+{
+  auto params = get_resource_manager_params(robot_description);
+  if (const auto * checkpoint = get_warm_restart_checkpoint(robot_description))
+  {
+    for (const auto & component : checkpoint->hardware_components)
+    {
+      if (
+        component.state == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE ||
+        component.state == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+      {
+        params.warm_restart_components.push_back(component.name);
+      }
+    }
+  }
   if (resource_manager_ == nullptr)
   {
     resource_manager_ = std::make_unique<hardware_interface::ResourceManager>(params, false);
   }
 
-  resource_manager_->set_on_component_state_switch_callback(
-    std::bind(&ControllerManager::publish_activity, this));
-
-  if (robot_description.empty())
+  resource_manager_->set_on_component_state_switch_callback(
+    std::bind(&ControllerManager::request_activity_publish, this));
+  resource_manager_->set_on_component_recovered_callback(
+    std::bind(
+      &ControllerManager::on_hardware_component_recovered, this, std::placeholders::_1,
+      std::placeholders::_2));
+  {
+    // the versions of a new resource manager may match the ones of the cached lists
+    std::lock_guard<std::mutex> cache_guard(list_controllers_cache_.mutex);
+    list_controllers_cache_.valid = false;
+  }
+  {
+    std::lock_guard<std::mutex> cache_guard(list_hardware_interfaces_cache_.mutex);
+    list_hardware_interfaces_cache_.valid = false;
+  }
+
+  if (robot_description.empty())
+  {
+    return;
+  }
+
+  if (params_->enforce_command_limits)
+  {
+    RCLCPP_INFO(get_logger(), "Enforcing command limits is enabled...");
+    try
+    {
+      resource_manager_->import_joint_limiters(robot_description);
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(get_logger(), "Error importing joint limiters: %s", e.what());
+      return;
+    }
+  }
+  else
+  {
+    RCLCPP_INFO(
+      get_logger(),
+      "Enforcing command limits is disabled. Command limits from URDF will be "
+      "ignored.");
+  }
+
+  try
+  {
+    const auto start_time = std::chrono::steady_clock::now();
+    if (!resource_manager_->load_and_initialize_components(params))
+    {
+      RCLCPP_WARN(
+        get_logger(),
+        "Could not load and initialize hardware. Please check previous output for more details. "
+        "After you have corrected your URDF, try to publish robot description again.");
+      return;
+    }
+    startup_time_.load_components_time =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time)
+        .count();
+    RCLCPP_INFO(
+      get_logger(), "Loaded and initialized the hardware components in %.3f ms.",
+      startup_time_.load_components_time);
+  }
+  catch (const std::exception & e)
+  {
+    // Other possible errors when loading components
+    RCLCPP_ERROR(
+      get_logger(), "Exception caught while loading and initializing components: %s", e.what());
+    return;
+  }
+
+  if (robot_description_notification_timer_)
+  {
+    robot_description_notification_timer_->cancel();
+  }
+}
+
+bool ControllerManager::reload_robot_description(const std::string & robot_description)
+{
+  hardware_interface::RobotDescriptionDiff diff;
+  try
+  {
+    diff = resource_manager_->diff_robot_description(robot_description);
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(get_logger(), "Ignoring the robot description, it cannot be parsed: %s", e.what());
+    return false;
+  }
+
+  // the components used by active controllers are kept running with their old description
   {
-    return;
+    std::lock_guard<std::recursive_mutex> guard(rt_controllers_wrapper_.controllers_lock_);
+    const std::vector<ControllerSpec> & controllers =
+      rt_controllers_wrapper_.get_updated_list(guard);
+    std::vector<std::string> unloaded_components = diff.removed_components;
+    unloaded_components.insert(
+      unloaded_components.end(), diff.changed_components.begin(), diff.changed_components.end());
+    for (const auto & component : unloaded_components)
+    {
+      for (const auto & controller_name :
+           resource_manager_->get_cached_controllers_to_hardware(component))
+      {
+        const auto controller_it = std::find_if(
+          controllers.begin(), controllers.end(),
+          [&](const ControllerSpec & spec) { return spec.info.name == controller_name; });
+        if (controller_it != controllers.end() && is_controller_active(controller_it->c))
+        {
+          RCLCPP_ERROR(
+            get_logger(),
+            "Ignoring the robot description, the hardware component '%s' to reload is used by the "
+            "active controller '%s'.",
+            component.c_str(), controller_name.c_str());
+          return false;
+        }
+      }
+    }
   }
 
   if (params_->enforce_command_limits)
   {
-    RCLCPP_INFO(get_logger(), "Enforcing command limits is enabled...");
     try
     {
       resource_manager_->import_joint_limiters(robot_description);
@@ -843,55 +2038,108 @@ void ControllerManager::init_resource_manager(const std::string & robot_descript
     catch (const std::exception & e)
     {
       RCLCPP_ERROR(get_logger(), "Error importing joint limiters: %s", e.what());
-      return;
+      return false;
     }
   }
-  else
+  if (diff.empty())
   {
-    RCLCPP_INFO(
-      get_logger(),
-      "Enforcing command limits is disabled. Command limits from URDF will be "
-      "ignored.");
+    RCLCPP_INFO(get_logger(), "The hardware components of the robot description didn't change.");
+    return true;
   }
 
+  bool result = false;
   try
   {
-    if (!resource_manager_->load_and_initialize_components(params))
-    {
-      RCLCPP_WARN(
-        get_logger(),
-        "Could not load and initialize hardware. Please check previous output for more details. "
-        "After you have corrected your URDF, try to publish robot description again.");
-      return;
-    }
+    result = resource_manager_->reload_components(
+      diff, get_resource_manager_params(robot_description));
   }
   catch (const std::exception & e)
   {
-    // Other possible errors when loading components
-    RCLCPP_ERROR(
-      get_logger(), "Exception caught while loading and initializing components: %s", e.what());
-    return;
+    RCLCPP_ERROR(get_logger(), "Exception caught while reloading components: %s", e.what());
   }
+  // the reloaded components may export other interfaces under the same names
+  clear_switch_plan_cache();
 
-  if (robot_description_notification_timer_)
+  std::vector<std::string> loaded_components = diff.added_components;
+  loaded_components.insert(
+    loaded_components.end(), diff.changed_components.begin(), diff.changed_components.end());
+  const auto & components = resource_manager_->get_components_status();
+  loaded_components.erase(
+    std::remove_if(
+      loaded_components.begin(), loaded_components.end(),
+      [&components](const std::string & name) { return components.count(name) == 0; }),
+    loaded_components.end());
+  if (!loaded_components.empty())
   {
-    robot_description_notification_timer_->cancel();
+    set_initial_hardware_components_state(loaded_components);
   }
+  request_activity_publish();
+  return result;
 }
 
-void ControllerManager::set_initial_hardware_components_state()
+void ControllerManager::set_initial_hardware_components_state(
+  const std::vector<std::string> & components)
 {
+  const auto start_time = std::chrono::steady_clock::now();
   // Get all components and if they are not defined in parameters activate them automatically
   auto components_to_activate = resource_manager_->get_components_status();
+  if (!components.empty())
+  {
+    for (auto it = components_to_activate.begin(); it != components_to_activate.end();)
+    {
+      it = std::find(components.begin(), components.end(), it->first) == components.end()
+             ? components_to_activate.erase(it)
+             : std::next(it);
+    }
+  }
 
   using lifecycle_msgs::msg::State;
 
+  // Sets the components to the state in one batch, returns the components that failed
+  auto set_components_state_with_error_handling =
+    [&](const std::vector<std::string> & components_to_set, rclcpp_lifecycle::State state)
+  {
+    std::vector<std::string> failed_components;
+    if (components_to_set.empty())
+    {
+      return failed_components;
+    }
+    const auto results = resource_manager_->set_components_state(components_to_set, state);
+    for (std::size_t i = 0; i < components_to_set.size(); ++i)
+    {
+      if (results[i] == hardware_interface::return_type::ERROR)
+      {
+        failed_components.push_back(components_to_set[i]);
+      }
+    }
+    if (
+      !failed_components.empty() &&
+      params_->hardware_components_initial_state.shutdown_on_initial_state_failure)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Failed to set the initial state of the components : [{}] to {}"),
+          fmt::join(failed_components, ", "), state.label()));
+    }
+    for (const auto & component : failed_components)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Failed to set the initial state of the component : '%s' to '%s'",
+        component.c_str(), state.label().c_str());
+    }
+    return failed_components;
+  };
+
   auto set_components_to_state =
     [&](const std::vector<std::string> & components_to_set, rclcpp_lifecycle::State state)
   {
+    std::vector<std::string> known_components;
     for (const auto & component : components_to_set)
     {
-      if (component.empty())
+      if (
+        component.empty() ||
+        (!components.empty() &&
+         std::find(components.begin(), components.end(), component) == components.end()))
       {
         continue;
       }
@@ -906,27 +2154,11 @@ void ControllerManager::set_initial_hardware_components_state()
         RCLCPP_INFO(
           get_logger(), "Setting component '%s' to '%s' state.", component.c_str(),
           state.label().c_str());
-        if (
-          resource_manager_->set_component_state(component, state) ==
-          hardware_interface::return_type::ERROR)
-        {
-          if (params_->hardware_components_initial_state.shutdown_on_initial_state_failure)
-          {
-            throw std::runtime_error(
-              fmt::format(
-                FMT_COMPILE("Failed to set the initial state of the component : {} to {}"),
-                component.c_str(), state.label()));
-          }
-          else
-          {
-            RCLCPP_ERROR(
-              get_logger(), "Failed to set the initial state of the component : '%s' to '%s'",
-              component.c_str(), state.label().c_str());
-          }
-        }
+        known_components.push_back(component);
         components_to_activate.erase(component);
       }
     }
+    set_components_state_with_error_handling(known_components, state);
   };
 
   if (cm_param_listener_->is_old(*params_))
@@ -934,15 +2166,43 @@ void ControllerManager::set_initial_hardware_components_state()
     *params_ = cm_param_listener_->get_params();
   }
 
+  std::vector<std::string> unconfigured_components =
+    params_->hardware_components_initial_state.unconfigured;
+  std::vector<std::string> inactive_components =
+    params_->hardware_components_initial_state.inactive;
+  // the checkpointed states take precedence over the initial states, the active components are
+  // activated with the components not listed in the initial states
+  const auto * warm_restart_checkpoint =
+    components.empty() ? get_warm_restart_checkpoint(*robot_description_) : nullptr;
+  if (warm_restart_checkpoint)
+  {
+    RCLCPP_INFO(
+      get_logger(), "Restoring the states of the hardware components from the checkpoint '%s'.",
+      params_->warm_restart.checkpoint_file.c_str());
+    for (const auto & component : warm_restart_checkpoint->hardware_components)
+    {
+      (void)ros2_control::remove_item(unconfigured_components, component.name);
+      (void)ros2_control::remove_item(inactive_components, component.name);
+      if (component.state == State::PRIMARY_STATE_INACTIVE)
+      {
+        inactive_components.push_back(component.name);
+      }
+      else if (component.state != State::PRIMARY_STATE_ACTIVE)
+      {
+        unconfigured_components.push_back(component.name);
+      }
+    }
+  }
+
   // unconfigured (loaded only)
   set_components_to_state(
-    params_->hardware_components_initial_state.unconfigured,
+    unconfigured_components,
     rclcpp_lifecycle::State(
       State::PRIMARY_STATE_UNCONFIGURED, hardware_interface::lifecycle_state_names::UNCONFIGURED));
 
   // inactive (configured)
   set_components_to_state(
-    params_->hardware_components_initial_state.inactive,
+    inactive_components,
     rclcpp_lifecycle::State(
       State::PRIMARY_STATE_INACTIVE, hardware_interface::lifecycle_state_names::INACTIVE));
 
@@ -1088,14 +2348,25 @@ void ControllerManager::set_initial_hardware_components_state()
         group_name.c_str());
     }
   }
-  // Process ungrouped components individually (configure and activate each one)
+  // Process ungrouped components in one batch (configure and activate each one)
   for (const auto & component_name : ungrouped_components)
   {
     RCLCPP_INFO(get_logger(), "Activating component '%s'.", component_name.c_str());
-    if (set_component_state_with_error_handling(component_name, active_state))
-    {
-      RCLCPP_DEBUG(get_logger(), "Successfully activated component '%s'.", component_name.c_str());
-    }
+  }
+  set_components_state_with_error_handling(ungrouped_components, active_state);
+  startup_time_.initial_hardware_state_time =
+    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time)
+      .count();
+  RCLCPP_INFO(
+    get_logger(), "Set the initial state of the hardware components in %.3f ms.",
+    startup_time_.initial_hardware_state_time);
+
+  if (warm_restart_checkpoint)
+  {
+    // the activation waits for the real-time loop, so it runs once the executor spins
+    warm_restart_pending_.store(true, std::memory_order_release);
+    warm_restart_restore_timer_ = create_wall_timer(
+      std::chrono::milliseconds(0), [this]() { restore_warm_restart_controllers(); });
   }
 
   if (robot_description_notification_timer_)
@@ -1121,21 +2392,80 @@ void ControllerManager::set_initial_hardware_components_state()
       continue;
     }
     RCLCPP_INFO(get_logger(), "Registering statistics for : %s", component_name.c_str());
+    if (component_info.memory_arena)
+    {
+      register_memory_arena_statistics(
+        component_name + ".stats/memory_arena", component_info.memory_arena.get());
+    }
     const std::string read_cycle_exec_time_prefix =
       component_name + ".stats/read_cycle/execution_time";
     const std::string read_cycle_periodicity_prefix =
       component_name + ".stats/read_cycle/periodicity";
     register_controller_manager_statistics(
       read_cycle_exec_time_prefix,
-      &component_info.read_statistics->execution_time.get_statistics());
+      &component_info.read_statistics->execution_time.get_statistics_const_ptr(),
+      &component_info.read_statistics->execution_time.get_percentiles_const_ptr());
     REGISTER_ENTITY(
       hardware_interface::CM_STATISTICS_KEY, read_cycle_exec_time_prefix + "/current_value",
       &component_info.read_statistics->execution_time.get_current_data());
     register_controller_manager_statistics(
-      read_cycle_periodicity_prefix, &component_info.read_statistics->periodicity.get_statistics());
+      read_cycle_periodicity_prefix,
+      &component_info.read_statistics->periodicity.get_statistics_const_ptr(),
+      &component_info.read_statistics->periodicity.get_percentiles_const_ptr());
     REGISTER_ENTITY(
       hardware_interface::CM_STATISTICS_KEY, read_cycle_periodicity_prefix + "/current_value",
       &component_info.read_statistics->periodicity.get_current_data());
+    if (params_->allocation_tracking.enable)
+    {
+      REGISTER_ENTITY(
+        hardware_interface::CM_STATISTICS_KEY, component_name + ".stats/read_cycle/allocations",
+        &component_info.read_statistics->allocations);
+    }
+    if (params_->cpu_time_statistics.enable)
+    {
+      const std::string read_cycle_prefix = component_name + ".stats/read_cycle/";
+      register_controller_manager_statistics(
+        read_cycle_prefix + "cpu_time",
+        &component_info.read_statistics->cpu_time.get_statistics_const_ptr(),
+        &component_info.read_statistics->cpu_time.get_percentiles_const_ptr());
+      register_controller_manager_statistics(
+        read_cycle_prefix + "preempted_time",
+        &component_info.read_statistics->preempted_time.get_statistics_const_ptr(),
+        &component_info.read_statistics->preempted_time.get_percentiles_const_ptr());
+      REGISTER_ENTITY(
+        hardware_interface::CM_STATISTICS_KEY, read_cycle_prefix + "voluntary_context_switches",
+        &component_info.read_statistics->voluntary_context_switches);
+      REGISTER_ENTITY(
+        hardware_interface::CM_STATISTICS_KEY, read_cycle_prefix + "involuntary_context_switches",
+        &component_info.read_statistics->involuntary_context_switches);
+    }
+    if (params_->performance_counters.enable)
+    {
+      register_performance_counters_statistics(
+        component_name + ".stats/read_cycle/",
+        component_info.read_statistics->performance_counters);
+    }
+    if (component_info.time_budget_us > 0.0)
+    {
+      REGISTER_ENTITY(
+        hardware_interface::CM_STATISTICS_KEY,
+        component_name + ".stats/read_cycle/time_budget_overruns",
+        &component_info.read_statistics->time_budget_overruns);
+    }
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, component_name + ".stats/read_cycle/skipped_cycles",
+      &component_info.read_statistics->skipped_cycles);
+    const bool records_cycle_cpu =
+      params_->parallel_read_write.number_of_workers > 0 && !component_info.is_async;
+    if (records_cycle_cpu)
+    {
+      REGISTER_ENTITY(
+        hardware_interface::CM_STATISTICS_KEY, component_name + ".stats/read_cycle/cpu",
+        &component_info.read_statistics->cpu);
+      REGISTER_ENTITY(
+        hardware_interface::CM_STATISTICS_KEY, component_name + ".stats/read_cycle/cpu_migrations",
+        &component_info.read_statistics->cpu_migrations);
+    }
     if (component_info.write_statistics)
     {
       const std::string write_cycle_exec_time_prefix =
@@ -1144,18 +2474,111 @@ void ControllerManager::set_initial_hardware_components_state()
         component_name + ".stats/write_cycle/periodicity";
       register_controller_manager_statistics(
         write_cycle_exec_time_prefix,
-        &component_info.write_statistics->execution_time.get_statistics());
+        &component_info.write_statistics->execution_time.get_statistics_const_ptr(),
+        &component_info.write_statistics->execution_time.get_percentiles_const_ptr());
       REGISTER_ENTITY(
         hardware_interface::CM_STATISTICS_KEY, write_cycle_exec_time_prefix + "/current_value",
         &component_info.write_statistics->execution_time.get_current_data());
       register_controller_manager_statistics(
         write_cycle_periodicity_prefix,
-        &component_info.write_statistics->periodicity.get_statistics());
+        &component_info.write_statistics->periodicity.get_statistics_const_ptr(),
+        &component_info.write_statistics->periodicity.get_percentiles_const_ptr());
       REGISTER_ENTITY(
         hardware_interface::CM_STATISTICS_KEY, write_cycle_periodicity_prefix + "/current_value",
         &component_info.write_statistics->periodicity.get_current_data());
+      if (params_->allocation_tracking.enable)
+      {
+        REGISTER_ENTITY(
+          hardware_interface::CM_STATISTICS_KEY, component_name + ".stats/write_cycle/allocations",
+          &component_info.write_statistics->allocations);
+      }
+      if (params_->cpu_time_statistics.enable)
+      {
+        const std::string write_cycle_prefix = component_name + ".stats/write_cycle/";
+        register_controller_manager_statistics(
+          write_cycle_prefix + "cpu_time",
+          &component_info.write_statistics->cpu_time.get_statistics_const_ptr(),
+          &component_info.write_statistics->cpu_time.get_percentiles_const_ptr());
+        register_controller_manager_statistics(
+          write_cycle_prefix + "preempted_time",
+          &component_info.write_statistics->preempted_time.get_statistics_const_ptr(),
+          &component_info.write_statistics->preempted_time.get_percentiles_const_ptr());
+        REGISTER_ENTITY(
+          hardware_interface::CM_STATISTICS_KEY, write_cycle_prefix + "voluntary_context_switches",
+          &component_info.write_statistics->voluntary_context_switches);
+        REGISTER_ENTITY(
+          hardware_interface::CM_STATISTICS_KEY,
+          write_cycle_prefix + "involuntary_context_switches",
+          &component_info.write_statistics->involuntary_context_switches);
+      }
+      if (params_->performance_counters.enable)
+      {
+        register_performance_counters_statistics(
+          component_name + ".stats/write_cycle/",
+          component_info.write_statistics->performance_counters);
+      }
+      if (component_info.time_budget_us > 0.0)
+      {
+        REGISTER_ENTITY(
+          hardware_interface::CM_STATISTICS_KEY,
+          component_name + ".stats/write_cycle/time_budget_overruns",
+          &component_info.write_statistics->time_budget_overruns);
+      }
+      REGISTER_ENTITY(
+        hardware_interface::CM_STATISTICS_KEY,
+        component_name + ".stats/write_cycle/skipped_cycles",
+        &component_info.write_statistics->skipped_cycles);
+      if (!component_info.command_interfaces.empty())
+      {
+        register_controller_manager_statistics(
+          component_name + ".stats/write_cycle/changed_command_ratio",
+          &component_info.write_statistics->changed_command_ratio.get_statistics_const_ptr(),
+          &component_info.write_statistics->changed_command_ratio.get_percentiles_const_ptr());
+      }
+      if (records_cycle_cpu)
+      {
+        REGISTER_ENTITY(
+          hardware_interface::CM_STATISTICS_KEY, component_name + ".stats/write_cycle/cpu",
+          &component_info.write_statistics->cpu);
+        REGISTER_ENTITY(
+          hardware_interface::CM_STATISTICS_KEY,
+          component_name + ".stats/write_cycle/cpu_migrations",
+          &component_info.write_statistics->cpu_migrations);
+      }
     }
   }
+
+  const auto transmission_stage_statistics = resource_manager_->get_transmission_stage_statistics();
+  if (transmission_stage_statistics)
+  {
+    RCLCPP_INFO(get_logger(), "Registering statistics for the transmission stage");
+    const std::string actuator_to_joint_prefix =
+      "transmission_stage.stats/actuator_to_joint/execution_time";
+    const std::string joint_to_actuator_prefix =
+      "transmission_stage.stats/joint_to_actuator/execution_time";
+    register_controller_manager_statistics(
+      actuator_to_joint_prefix,
+      &transmission_stage_statistics->actuator_to_joint.get_statistics_const_ptr(),
+      &transmission_stage_statistics->actuator_to_joint.get_percentiles_const_ptr());
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, actuator_to_joint_prefix + "/current_value",
+      &transmission_stage_statistics->actuator_to_joint.get_current_data());
+    register_controller_manager_statistics(
+      joint_to_actuator_prefix,
+      &transmission_stage_statistics->joint_to_actuator.get_statistics_const_ptr(),
+      &transmission_stage_statistics->joint_to_actuator.get_percentiles_const_ptr());
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, joint_to_actuator_prefix + "/current_value",
+      &transmission_stage_statistics->joint_to_actuator.get_current_data());
+  }
+
+  if (params_->remote_interface_export.enable)
+  {
+    RCLCPP_INFO(get_logger(), "Registering statistics for the remote interface export");
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, "remote_interface_export.stats/link",
+      &resource_manager_->get_remote_interface_export_statistics());
+  }
 }
 
 void ControllerManager::init_services()
@@ -1165,16 +2588,17 @@ void ControllerManager::init_services()
   // deterministic_callback_group_ = create_callback_group(
   //   rclcpp::CallbackGroupType::MutuallyExclusive);
   best_effort_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  query_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::Reentrant);
 
   using namespace std::placeholders;
   list_controllers_service_ = create_service<controller_manager_msgs::srv::ListControllers>(
     "~/list_controllers", std::bind(&ControllerManager::list_controllers_srv_cb, this, _1, _2),
-    qos_services, best_effort_callback_group_);
+    qos_services, query_callback_group_);
   list_controller_types_service_ =
     create_service<controller_manager_msgs::srv::ListControllerTypes>(
       "~/list_controller_types",
       std::bind(&ControllerManager::list_controller_types_srv_cb, this, _1, _2), qos_services,
-      best_effort_callback_group_);
+      query_callback_group_);
   load_controller_service_ = create_service<controller_manager_msgs::srv::LoadController>(
     "~/load_controller", std::bind(&ControllerManager::load_controller_service_cb, this, _1, _2),
     qos_services, best_effort_callback_group_);
@@ -1182,6 +2606,11 @@ void ControllerManager::init_services()
     "~/configure_controller",
     std::bind(&ControllerManager::configure_controller_service_cb, this, _1, _2), qos_services,
     best_effort_callback_group_);
+  load_configure_controllers_service_ =
+    create_service<controller_manager_msgs::srv::LoadConfigureControllers>(
+      "~/load_configure_controllers",
+      std::bind(&ControllerManager::load_configure_controllers_service_cb, this, _1, _2),
+      qos_services, best_effort_callback_group_);
   reload_controller_libraries_service_ =
     create_service<controller_manager_msgs::srv::ReloadControllerLibraries>(
       "~/reload_controller_libraries",
@@ -1191,6 +2620,23 @@ void ControllerManager::init_services()
     "~/switch_controller",
     std::bind(&ControllerManager::switch_controller_service_cb, this, _1, _2), qos_services,
     best_effort_callback_group_);
+  prepare_switch_controller_service_ =
+    create_service<controller_manager_msgs::srv::PrepareSwitchController>(
+      "~/prepare_switch_controller",
+      std::bind(&ControllerManager::prepare_switch_controller_service_cb, this, _1, _2),
+      qos_services, best_effort_callback_group_);
+  commit_switch_controller_service_ =
+    create_service<controller_manager_msgs::srv::CommitSwitchController>(
+      "~/commit_switch_controller",
+      std::bind(&ControllerManager::commit_switch_controller_service_cb, this, _1, _2),
+      qos_services, best_effort_callback_group_);
+  swap_controller_service_ = create_service<controller_manager_msgs::srv::SwapController>(
+    "~/swap_controller", std::bind(&ControllerManager::swap_controller_service_cb, this, _1, _2),
+    qos_services, best_effort_callback_group_);
+  shadow_controller_service_ = create_service<controller_manager_msgs::srv::ShadowController>(
+    "~/shadow_controller",
+    std::bind(&ControllerManager::shadow_controller_service_cb, this, _1, _2), qos_services,
+    best_effort_callback_group_);
   unload_controller_service_ = create_service<controller_manager_msgs::srv::UnloadController>(
     "~/unload_controller",
     std::bind(&ControllerManager::unload_controller_service_cb, this, _1, _2), qos_services,
@@ -1203,17 +2649,26 @@ void ControllerManager::init_services()
     create_service<controller_manager_msgs::srv::ListHardwareComponents>(
       "~/list_hardware_components",
       std::bind(&ControllerManager::list_hardware_components_srv_cb, this, _1, _2), qos_services,
-      best_effort_callback_group_);
+      query_callback_group_);
   list_hardware_interfaces_service_ =
     create_service<controller_manager_msgs::srv::ListHardwareInterfaces>(
       "~/list_hardware_interfaces",
       std::bind(&ControllerManager::list_hardware_interfaces_srv_cb, this, _1, _2), qos_services,
-      best_effort_callback_group_);
+      query_callback_group_);
   set_hardware_component_state_service_ =
     create_service<controller_manager_msgs::srv::SetHardwareComponentState>(
       "~/set_hardware_component_state",
       std::bind(&ControllerManager::set_hardware_component_state_srv_cb, this, _1, _2),
       qos_services, best_effort_callback_group_);
+  set_hardware_components_state_service_ =
+    create_service<controller_manager_msgs::srv::SetHardwareComponentsState>(
+      "~/set_hardware_components_state",
+      std::bind(&ControllerManager::set_hardware_components_state_srv_cb, this, _1, _2),
+      qos_services, best_effort_callback_group_);
+  // the profiling waits for the cycles, it doesn't block the lifecycle services
+  profile_cycles_service_ = create_service<controller_manager_msgs::srv::ProfileCycles>(
+    "~/profile_cycles", std::bind(&ControllerManager::profile_cycles_srv_cb, this, _1, _2),
+    qos_services, query_callback_group_);
 
   const std::string cm_name = get_name();
   REGISTER_ENTITY(
@@ -1238,15 +2693,83 @@ void ControllerManager::init_services()
   REGISTER_ENTITY(
     hardware_interface::CM_STATISTICS_KEY, cm_name + ".activation_time",
     &execution_time_.activation_time);
+  REGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, cm_name + ".activation_preparation_time",
+    &execution_time_.activation_preparation_time);
+  if (params_->allocation_tracking.enable)
+  {
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, cm_name + ".read_allocations",
+      &allocations_.read_allocations);
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, cm_name + ".update_allocations",
+      &allocations_.update_allocations);
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, cm_name + ".write_allocations",
+      &allocations_.write_allocations);
+  }
+}
+
+void ControllerManager::preload_controller_libraries(
+  const std::vector<std::string> & controller_types)
+{
+  for (const auto & controller_type : controller_types)
+  {
+    if (is_static_controller_type(controller_type))
+    {
+      // compiled into the executable, there is no library to load
+      continue;
+    }
+    try
+    {
+      // the libraries stay loaded until the loaders are destroyed
+      if (loader_->isClassAvailable(controller_type))
+      {
+        loader_->loadLibraryForClass(controller_type);
+      }
+      else if (chainable_loader_->isClassAvailable(controller_type))
+      {
+        chainable_loader_->loadLibraryForClass(controller_type);
+      }
+      else
+      {
+        RCLCPP_WARN(
+          get_logger(), "Unable to preload the library of the unknown controller type '%s'.",
+          controller_type.c_str());
+        continue;
+      }
+      RCLCPP_DEBUG(
+        get_logger(), "Preloaded the library of the controller type '%s'.",
+        controller_type.c_str());
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_WARN(
+        get_logger(), "Unable to preload the library of the controller type '%s': %s",
+        controller_type.c_str(), e.what());
+    }
+  }
+}
+
+void ControllerManager::wait_for_controller_libraries_preload()
+{
+  std::lock_guard<std::mutex> guard(controller_loaders_lock_);
+  if (controller_libraries_preload_.valid())
+  {
+    controller_libraries_preload_.get();
+  }
 }
 
 controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::load_controller(
   const std::string & controller_name, const std::string & controller_type)
 {
   RCLCPP_INFO(get_logger(), "Loading controller '%s'", controller_name.c_str());
+  wait_for_controller_libraries_preload();
 
+  // the controllers compiled into the executable are looked up first
+  const bool is_static_type = is_static_controller_type(controller_type);
   if (
-    !loader_->isClassAvailable(controller_type) &&
+    !is_static_type && !loader_->isClassAvailable(controller_type) &&
     !chainable_loader_->isClassAvailable(controller_type))
   {
     RCLCPP_ERROR(
@@ -1261,6 +2784,10 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::load_c
     {
       RCLCPP_INFO(get_logger(), "  %s", available_class.c_str());
     }
+    for (const auto & available_class : get_static_controller_types())
+    {
+      RCLCPP_INFO(get_logger(), "  %s (static)", available_class.c_str());
+    }
     return nullptr;
   }
   RCLCPP_DEBUG(get_logger(), "Loader for controller '%s' found.", controller_name.c_str());
@@ -1269,11 +2796,15 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::load_c
 
   try
   {
-    if (loader_->isClassAvailable(controller_type))
+    if (is_static_type)
+    {
+      controller = create_static_controller(controller_type);
+    }
+    else if (loader_->isClassAvailable(controller_type))
     {
       controller = loader_->createSharedInstance(controller_type);
     }
-    if (chainable_loader_->isClassAvailable(controller_type))
+    if (!is_static_type && chainable_loader_->isClassAvailable(controller_type))
     {
       controller = chainable_loader_->createSharedInstance(controller_type);
     }
@@ -1302,22 +2833,101 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::load_c
   controller_spec.info.type = controller_type;
   controller_spec.last_update_cycle_time =
     std::make_shared<rclcpp::Time>(0, 0, this->get_trigger_clock()->get_clock_type());
+  controller_spec.rate_divider = std::make_shared<hardware_interface::RateDivider>();
+  controller_spec.time_budget = std::make_shared<hardware_interface::TimeBudget>();
   controller_spec.execution_time_statistics = std::make_shared<MovingAverageStatistics>();
   controller_spec.periodicity_statistics = std::make_shared<MovingAverageStatistics>();
   const std::string controller_exec_time_prefix = controller_name + ".stats/execution_time";
   const std::string controller_periodicity_prefix = controller_name + ".stats/periodicity";
   register_controller_manager_statistics(
     controller_exec_time_prefix,
-    &controller_spec.execution_time_statistics->get_statistics_const_ptr());
+    &controller_spec.execution_time_statistics->get_statistics_const_ptr(),
+    &controller_spec.execution_time_statistics->get_histogram());
   REGISTER_ENTITY(
     hardware_interface::CM_STATISTICS_KEY, controller_exec_time_prefix + "/current_value",
     &controller_spec.execution_time_statistics->get_current_measurement_const_ptr());
   register_controller_manager_statistics(
     controller_periodicity_prefix,
-    &controller_spec.periodicity_statistics->get_statistics_const_ptr());
+    &controller_spec.periodicity_statistics->get_statistics_const_ptr(),
+    &controller_spec.periodicity_statistics->get_histogram());
   REGISTER_ENTITY(
     hardware_interface::CM_STATISTICS_KEY, controller_periodicity_prefix + "/current_value",
     &controller_spec.periodicity_statistics->get_current_measurement_const_ptr());
+  if (params_->allocation_tracking.enable)
+  {
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, controller_name + ".stats/update_allocations",
+      controller_spec.update_allocations.get());
+  }
+  controller_spec.cpu_time_statistics = std::make_shared<MovingAverageStatistics>();
+  controller_spec.preempted_time_statistics = std::make_shared<MovingAverageStatistics>();
+  controller_spec.stage_time_statistics = std::make_shared<MovingAverageStatistics>();
+  controller_spec.command_latency_statistics = std::make_shared<MovingAverageStatistics>();
+  controller_spec.parallel_time_statistics = std::make_shared<MovingAverageStatistics>();
+  controller_spec.parallel_task_time_statistics = std::make_shared<MovingAverageStatistics>();
+  register_controller_manager_statistics(
+    controller_name + ".stats/parallel_time",
+    &controller_spec.parallel_time_statistics->get_statistics_const_ptr(),
+    &controller_spec.parallel_time_statistics->get_histogram());
+  register_controller_manager_statistics(
+    controller_name + ".stats/parallel_task_time",
+    &controller_spec.parallel_task_time_statistics->get_statistics_const_ptr(),
+    &controller_spec.parallel_task_time_statistics->get_histogram());
+  register_controller_manager_statistics(
+    controller_name + ".stats/stage_time",
+    &controller_spec.stage_time_statistics->get_statistics_const_ptr(),
+    &controller_spec.stage_time_statistics->get_histogram());
+  register_controller_manager_statistics(
+    controller_name + ".stats/command_latency",
+    &controller_spec.command_latency_statistics->get_statistics_const_ptr(),
+    &controller_spec.command_latency_statistics->get_histogram());
+  if (params_->cpu_time_statistics.enable)
+  {
+    const std::string controller_cpu_time_prefix = controller_name + ".stats/cpu_time";
+    const std::string controller_preempted_time_prefix = controller_name + ".stats/preempted_time";
+    register_controller_manager_statistics(
+      controller_cpu_time_prefix, &controller_spec.cpu_time_statistics->get_statistics_const_ptr(),
+      &controller_spec.cpu_time_statistics->get_histogram());
+    register_controller_manager_statistics(
+      controller_preempted_time_prefix,
+      &controller_spec.preempted_time_statistics->get_statistics_const_ptr(),
+      &controller_spec.preempted_time_statistics->get_histogram());
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY,
+      controller_name + ".stats/update_voluntary_context_switches",
+      controller_spec.update_voluntary_context_switches.get());
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY,
+      controller_name + ".stats/update_involuntary_context_switches",
+      controller_spec.update_involuntary_context_switches.get());
+  }
+  controller_spec.performance_counters_statistics =
+    std::make_shared<hardware_interface::PerformanceCountersStatisticsCollector>();
+  if (params_->performance_counters.enable)
+  {
+    register_performance_counters_statistics(
+      controller_name + ".stats/", *controller_spec.performance_counters_statistics);
+  }
+  REGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, controller_name + ".stats/time_budget_overruns",
+    &controller_spec.time_budget->overruns);
+  if (params_->memory_arenas.controller_size > 0)
+  {
+    controller_spec.memory_arena = std::make_shared<hardware_interface::MemoryArena>(
+      static_cast<std::size_t>(params_->memory_arenas.controller_size));
+    if (!controller_spec.memory_arena->is_locked())
+    {
+      RCLCPP_WARN(
+        get_logger(),
+        "The memory arena of controller '%s' can't be locked in RAM, its pages may be swapped "
+        "out. Check the memlock limit of the process.",
+        controller_name.c_str());
+    }
+    register_memory_arena_statistics(
+      controller_name + ".stats/memory_arena", controller_spec.memory_arena.get());
+  }
+  controller_spec.update_trace_id =
+    hardware_interface::TraceRecorder::register_name(controller_name + "/update");
 
   // We have to fetch the parameters_file at the time of loading the controller, because this way we
   // can load them at the creation of the LifeCycleNode and this helps in using the features such as
@@ -1381,6 +2991,107 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::load_c
     controller_spec.info.node_options_args = node_options_args;
   }
 
+  const std::string update_phase_param =
+    fmt::format(FMT_COMPILE("{}.update_phase"), controller_name);
+  if (!has_parameter(update_phase_param))
+  {
+    declare_parameter(update_phase_param, -1);
+  }
+  int64_t update_phase = -1;
+  if (get_parameter(update_phase_param, update_phase) && update_phase >= 0)
+  {
+    controller_spec.update_phase = static_cast<int>(update_phase);
+  }
+
+  const std::string time_budget_param =
+    fmt::format(FMT_COMPILE("{}.time_budget_us"), controller_name);
+  const std::string time_budget_policy_param =
+    fmt::format(FMT_COMPILE("{}.time_budget_policy"), controller_name);
+  if (!has_parameter(time_budget_param))
+  {
+    declare_parameter(time_budget_param, 0.0);
+  }
+  if (!has_parameter(time_budget_policy_param))
+  {
+    declare_parameter(time_budget_policy_param, std::string("report"));
+  }
+  double time_budget_us = 0.0;
+  std::string time_budget_policy = "report";
+  get_parameter(time_budget_param, time_budget_us);
+  get_parameter(time_budget_policy_param, time_budget_policy);
+  try
+  {
+    controller_spec.time_budget->policy =
+      hardware_interface::parse_time_budget_policy(time_budget_policy);
+  }
+  catch (const std::invalid_argument & e)
+  {
+    RCLCPP_ERROR(
+      get_logger(), "Controller '%s' has an invalid time budget: %s", controller_name.c_str(),
+      e.what());
+    return nullptr;
+  }
+  controller_spec.time_budget->budget_us = std::max(0.0, time_budget_us);
+
+  const std::string criticality_param =
+    fmt::format(FMT_COMPILE("{}.criticality"), controller_name);
+  if (!has_parameter(criticality_param))
+  {
+    declare_parameter(criticality_param, std::string("control"));
+  }
+  std::string criticality = "control";
+  get_parameter(criticality_param, criticality);
+  try
+  {
+    controller_spec.criticality = hardware_interface::parse_criticality(criticality);
+  }
+  catch (const std::invalid_argument & e)
+  {
+    RCLCPP_ERROR(
+      get_logger(), "Controller '%s' has an invalid criticality: %s", controller_name.c_str(),
+      e.what());
+    return nullptr;
+  }
+
+  const std::string statistics_type_param =
+    fmt::format(FMT_COMPILE("{}.statistics_type"), controller_name);
+  if (!has_parameter(statistics_type_param))
+  {
+    declare_parameter(statistics_type_param, std::string("cumulative"));
+  }
+  std::string statistics_type = "cumulative";
+  get_parameter(statistics_type_param, statistics_type);
+  try
+  {
+    const auto statistics_config = ros2_control::parse_statistics_config(statistics_type);
+    controller_spec.execution_time_statistics->configure(statistics_config);
+    controller_spec.periodicity_statistics->configure(statistics_config);
+  }
+  catch (const std::invalid_argument & e)
+  {
+    RCLCPP_ERROR(
+      get_logger(), "Controller '%s' has an invalid statistics type: %s", controller_name.c_str(),
+      e.what());
+    return nullptr;
+  }
+
+  const std::string control_loop_param =
+    fmt::format(FMT_COMPILE("{}.control_loop"), controller_name);
+  if (!has_parameter(control_loop_param))
+  {
+    declare_parameter(control_loop_param, std::string(""));
+  }
+  get_parameter(control_loop_param, controller_spec.control_loop);
+  if (
+    !controller_spec.control_loop.empty() &&
+    control_loop_pools_.count(controller_spec.control_loop) == 0)
+  {
+    RCLCPP_ERROR(
+      get_logger(), "The control loop '%s' of the controller '%s' is not in 'control_loops.names'",
+      controller_spec.control_loop.c_str(), controller_name.c_str());
+    return nullptr;
+  }
+
   return add_controller_impl(controller_spec);
 }
 
@@ -1418,6 +3129,7 @@ controller_interface::return_type ControllerManager::unload_controller(
   RCLCPP_INFO(get_logger(), "Unloading controller: '%s'", controller_name.c_str());
   std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
     rt_controllers_wrapper_.controllers_lock_);
+  switch_plan_cache_.clear();
   std::vector<ControllerSpec> & to = rt_controllers_wrapper_.get_unused_list(guard);
   const std::vector<ControllerSpec> & from = rt_controllers_wrapper_.get_updated_list(guard);
 
@@ -1463,10 +3175,42 @@ controller_interface::return_type ControllerManager::unload_controller(
       get_logger(), "Controller '%s' is shutdown before unloading!", controller_name.c_str());
     shutdown_controller(controller);
   }
-  unregister_controller_manager_statistics(controller_name + ".stats/execution_time");
-  unregister_controller_manager_statistics(controller_name + ".stats/periodicity");
+  unregister_controller_manager_statistics(controller_name + ".stats/execution_time");
+  unregister_controller_manager_statistics(controller_name + ".stats/periodicity");
+  unregister_controller_manager_statistics(controller_name + ".stats/stage_time");
+  unregister_controller_manager_statistics(controller_name + ".stats/command_latency");
+  unregister_controller_manager_statistics(controller_name + ".stats/parallel_time");
+  unregister_controller_manager_statistics(controller_name + ".stats/parallel_task_time");
+  if (params_->allocation_tracking.enable)
+  {
+    UNREGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, controller_name + ".stats/update_allocations");
+  }
+  if (params_->cpu_time_statistics.enable)
+  {
+    unregister_controller_manager_statistics(controller_name + ".stats/cpu_time");
+    unregister_controller_manager_statistics(controller_name + ".stats/preempted_time");
+    UNREGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY,
+      controller_name + ".stats/update_voluntary_context_switches");
+    UNREGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY,
+      controller_name + ".stats/update_involuntary_context_switches");
+  }
+  if (params_->performance_counters.enable)
+  {
+    unregister_performance_counters_statistics(controller_name + ".stats/");
+  }
+  UNREGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, controller_name + ".stats/time_budget_overruns");
+  if (controller.memory_arena)
+  {
+    unregister_memory_arena_statistics(controller_name + ".stats/memory_arena");
+  }
   executor_->remove_node(controller.c->get_node()->get_node_base_interface());
+  resource_manager_->remove_cached_controller_to_hardware(controller_name);
   to.erase(found_it);
+  update_controllers_fault_plans(to, resource_manager_);
 
   // Destroys the old controllers list when the realtime thread is finished with it.
   RCLCPP_DEBUG(get_logger(), "Realtime switches over to new controller list");
@@ -1488,6 +3232,8 @@ controller_interface::return_type ControllerManager::cleanup_controller(
   {
     cleanup_controller_exported_interfaces(controller);
     const auto new_state = controller.c->get_node()->cleanup();
+    // the controller may claim other interfaces once it's configured again
+    clear_switch_plan_cache();
     if (new_state.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED)
     {
       RCLCPP_ERROR(
@@ -1504,6 +3250,7 @@ controller_interface::return_type ControllerManager::cleanup_controller(
     params_->handle_exceptions ? void() : throw;
     return controller_interface::return_type::ERROR;
   }
+  request_activity_publish();
   return controller_interface::return_type::OK;
 }
 
@@ -1595,6 +3342,86 @@ std::vector<ControllerSpec> ControllerManager::get_loaded_controllers() const
 
 controller_interface::return_type ControllerManager::configure_controller(
   const std::string & controller_name)
+{
+  controller_interface::ControllerInterfaceBaseSharedPtr controller;
+  if (
+    prepare_controller_configuration(controller_name, controller) !=
+      controller_interface::return_type::OK ||
+    trigger_controller_configure(controller_name, controller) !=
+      controller_interface::return_type::OK)
+  {
+    return controller_interface::return_type::ERROR;
+  }
+  return finish_controller_configuration(controller_name);
+}
+
+std::vector<controller_interface::return_type> ControllerManager::configure_controllers(
+  const std::vector<std::string> & controller_names, unsigned int number_of_threads)
+{
+  std::vector<controller_interface::return_type> results(
+    controller_names.size(), controller_interface::return_type::ERROR);
+  std::vector<controller_interface::ControllerInterfaceBaseSharedPtr> controllers(
+    controller_names.size());
+  std::vector<std::size_t> prepared;
+  for (std::size_t i = 0; i < controller_names.size(); ++i)
+  {
+    if (
+      prepare_controller_configuration(controller_names[i], controllers[i]) ==
+      controller_interface::return_type::OK)
+    {
+      prepared.push_back(i);
+    }
+  }
+
+  // every controller has its own node, so their on_configure are independent of each other
+  std::vector<std::exception_ptr> exceptions(controller_names.size());
+  std::atomic<std::size_t> next{0};
+  auto configure = [&]()
+  {
+    for (std::size_t k = next++; k < prepared.size(); k = next++)
+    {
+      const auto i = prepared[k];
+      try
+      {
+        results[i] = trigger_controller_configure(controller_names[i], controllers[i]);
+      }
+      catch (...)
+      {
+        exceptions[i] = std::current_exception();
+      }
+    }
+  };
+  const std::size_t threads_count =
+    std::min<std::size_t>(std::max(number_of_threads, 1u), prepared.size());
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < threads_count; ++i)
+  {
+    threads.emplace_back(configure);
+  }
+  configure();
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+
+  // the interfaces and the controllers order are updated in the order of the request
+  for (const auto i : prepared)
+  {
+    if (exceptions[i])
+    {
+      std::rethrow_exception(exceptions[i]);
+    }
+    if (results[i] == controller_interface::return_type::OK)
+    {
+      results[i] = finish_controller_configuration(controller_names[i]);
+    }
+  }
+  return results;
+}
+
+controller_interface::return_type ControllerManager::prepare_controller_configuration(
+  const std::string & controller_name,
+  controller_interface::ControllerInterfaceBaseSharedPtr & controller)
 {
   RCLCPP_INFO(get_logger(), "Configuring controller: '%s'", controller_name.c_str());
 
@@ -1612,7 +3439,7 @@ controller_interface::return_type ControllerManager::configure_controller(
       controller_name.c_str());
     return controller_interface::return_type::ERROR;
   }
-  auto controller = found_it->c;
+  controller = found_it->c;
 
   const auto & state = controller->get_lifecycle_state();
   if (
@@ -1636,7 +3463,13 @@ controller_interface::return_type ControllerManager::configure_controller(
   }
   // For cases, when the controller ends up in the unconfigured state from any other state
   cleanup_controller_exported_interfaces(*found_it);
+  return controller_interface::return_type::OK;
+}
 
+controller_interface::return_type ControllerManager::trigger_controller_configure(
+  const std::string & controller_name,
+  const controller_interface::ControllerInterfaceBaseSharedPtr & controller)
+{
   try
   {
     const auto & new_state = controller->configure();
@@ -1664,6 +3497,23 @@ controller_interface::return_type ControllerManager::configure_controller(
     params_->handle_exceptions ? void() : throw;
     return controller_interface::return_type::ERROR;
   }
+  return controller_interface::return_type::OK;
+}
+
+controller_interface::return_type ControllerManager::finish_controller_configuration(
+  const std::string & controller_name)
+{
+  // the plans cached before the configuration were compiled with the previous interfaces
+  clear_switch_plan_cache();
+  const auto & controllers = get_loaded_controllers();
+  auto found_it = std::find_if(
+    controllers.begin(), controllers.end(),
+    std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+  if (found_it == controllers.end())
+  {
+    return controller_interface::return_type::ERROR;
+  }
+  auto controller = found_it->c;
 
   const auto controller_update_rate = controller->get_update_rate();
   const auto cm_update_rate = get_update_rate();
@@ -1763,7 +3613,18 @@ controller_interface::return_type ControllerManager::configure_controller(
     return controller_interface::return_type::ERROR;
   }
 
-  build_controllers_topology_info(controllers);
+  // the topology of a fixed set of controllers is restored from the cache, if enabled
+  std::string topology_key;
+  bool is_topology_restored = false;
+  if (!params_->controllers_topology_cache_file.empty())
+  {
+    topology_key = get_controllers_topology_key(controllers);
+    is_topology_restored = restore_cached_controllers_topology(topology_key);
+  }
+  if (!is_topology_restored)
+  {
+    build_controllers_topology_info(controllers);
+  }
 
   std::unordered_map<std::string, std::vector<std::string>> controller_full_chain_info_cache;
   build_controller_full_chain_map_cache(controller_chain_spec_, controller_full_chain_info_cache);
@@ -1775,92 +3636,416 @@ controller_interface::return_type ControllerManager::configure_controller(
   std::vector<ControllerSpec> & to = rt_controllers_wrapper_.get_unused_list(guard);
   const std::vector<ControllerSpec> & from = rt_controllers_wrapper_.get_updated_list(guard);
 
-  // Copy all controllers from the 'from' list to the 'to' list
-  to = from;
-  std::vector<ControllerSpec> sorted_list;
+  if (!is_topology_restored)
+  {
+    sort_controllers_topologically(from);
+    if (!topology_key.empty())
+    {
+      store_cached_controllers_topology(topology_key);
+    }
+  }
 
-  // clear the list before reordering it again
-  ordered_controllers_names_.clear();
-  for (const auto & [ctrl_name, chain_spec] : controller_chain_spec_)
+  // Copy the controllers from the 'from' list in their new order, the reordered list is moved to
+  // the 'to' list so that each controller spec is copied only once
+  std::unordered_map<std::string, std::size_t> from_indices;
+  from_indices.reserve(from.size());
+  for (std::size_t i = 0; i < from.size(); ++i)
+  {
+    from_indices.emplace(from[i].info.name, i);
+  }
+  std::vector<ControllerSpec> new_list;
+  new_list.reserve(from.size());
+  std::unordered_map<std::string, std::size_t> new_indices;
+  new_indices.reserve(from.size());
+  for (const auto & ctrl : ordered_controllers_names_)
+  {
+    const auto from_it = from_indices.find(ctrl);
+    if (from_it != from_indices.end())
+    {
+      new_indices.emplace(ctrl, new_list.size());
+      new_list.push_back(from[from_it->second]);
+    }
+  }
+
+  // Update the controllers chain groups in the ControllerSpec
+  for (const auto & [ctrl_name, full_chain_info] : controller_full_chain_info_cache)
+  {
+    RCLCPP_DEBUG(
+      get_logger(), "%s",
+      fmt::format(
+        "The controller '{}' is in chain with: [{}]", ctrl_name, fmt::join(full_chain_info, ", "))
+        .c_str());
+    const auto new_it = new_indices.find(ctrl_name);
+    if (new_it != new_indices.end())
+    {
+      new_list[new_it->second].controllers_chain_group = full_chain_info;
+    }
+  }
+
+  // Assign the same chain group id to all the controllers of a chain, so that the real-time loop
+  // can update the independent chains concurrently without resolving the chains in every cycle.
+  // The chain groups are closed, so the id is the index of the first controller of the chain.
+  for (std::size_t i = 0; i < new_list.size(); ++i)
+  {
+    new_list[i].controllers_chain_group_id = i;
+    for (const auto & chained_controller : new_list[i].controllers_chain_group)
+    {
+      const auto new_it = new_indices.find(chained_controller);
+      if (new_it != new_indices.end() && new_it->second < new_list[i].controllers_chain_group_id)
+      {
+        new_list[i].controllers_chain_group_id = new_it->second;
+      }
+    }
+  }
+
+  to = std::move(new_list);
+  RCLCPP_DEBUG(get_logger(), "Reordered controllers list is:");
+  for (const auto & ctrl : to)
+  {
+    RCLCPP_DEBUG(this->get_logger(), "\t%s", ctrl.info.name.c_str());
+  }
+  update_controllers_fault_plans(to, resource_manager_);
+  // the fallback graph is validated when its controllers are configured, not when they fail
+  for (const auto & ctrl : to)
+  {
+    RCLCPP_ERROR_EXPRESSION(
+      get_logger(),
+      !ctrl.fault_plan->invalid_reason.empty() &&
+        (ctrl.info.name == controller_name ||
+         ros2_control::has_item(ctrl.info.fallback_controllers_names, controller_name)),
+      "The controller '%s' can't be activated until its fallback controllers are fixed, %s.",
+      ctrl.info.name.c_str(), ctrl.fault_plan->invalid_reason.c_str());
+  }
+
+  // switch lists
+  rt_controllers_wrapper_.switch_updated_list(guard);
+  // clear unused list
+  rt_controllers_wrapper_.get_unused_list(guard).clear();
+
+  return controller_interface::return_type::OK;
+}
+
+void ControllerManager::clear_requests()
+{
+  switch_params_.do_switch = false;
+  switch_params_.commit_time_ns = 0;
+  switch_params_.ready_to_switch_sent = false;
+  switch_params_.activate_asap = false;
+  switch_params_.deactivate_request.clear();
+  switch_params_.activate_request.clear();
+  switch_params_.to_chained_mode_request.clear();
+  switch_params_.from_chained_mode_request.clear();
+  switch_params_.activate_command_interface_request.clear();
+  switch_params_.deactivate_command_interface_request.clear();
+  switch_params_.swap_outgoing_controller.clear();
+  switch_params_.swap_incoming_controller.clear();
+}
+
+controller_interface::return_type ControllerManager::switch_controller(
+  const std::vector<std::string> & activate_controllers,
+  const std::vector<std::string> & deactivate_controllers, int strictness, bool activate_asap,
+  const rclcpp::Duration & timeout)
+{
+  std::string message;
+  return switch_controller_cb(
+    activate_controllers, deactivate_controllers, strictness, activate_asap, timeout, message);
+}
+
+controller_interface::return_type ControllerManager::switch_controller_cb(
+  const std::vector<std::string> & activate_controllers,
+  const std::vector<std::string> & deactivate_controllers, int strictness, bool activate_asap,
+  const rclcpp::Duration & timeout, std::string & message)
+{
+  // lock controllers, so that the controllers can't change between the preparation and the switch
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+  if (switch_params_.prepared)
+  {
+    message =
+      "Could not switch controllers since a prepared switch is pending. Commit or cancel it "
+      "first.";
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  }
+  const auto start_time = std::chrono::steady_clock::now();
+  const auto ret =
+    prepare_switch_impl(activate_controllers, deactivate_controllers, strictness, message);
+  if (
+    ret != controller_interface::return_type::OK ||
+    (switch_params_.activate_request.empty() && switch_params_.deactivate_request.empty()))
+  {
+    return ret;
+  }
+  last_switch_time_ = ControllerManagerSwitchTime();
+  last_switch_time_.prepare_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count();
+  return execute_switch(activate_asap, timeout, message);
+}
+
+controller_interface::return_type ControllerManager::prepare_switch(
+  const std::vector<std::string> & activate_controllers,
+  const std::vector<std::string> & deactivate_controllers, int strictness, std::string & message)
+{
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+  if (switch_params_.prepared)
+  {
+    message = "Could not prepare the switch since another prepared switch is pending.";
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  }
+  const auto ret =
+    prepare_switch_impl(activate_controllers, deactivate_controllers, strictness, message);
+  switch_params_.prepared = ret == controller_interface::return_type::OK;
+  return ret;
+}
+
+controller_interface::return_type ControllerManager::commit_switch(
+  const rclcpp::Time & commit_time, const rclcpp::Duration & timeout, std::string & message)
+{
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+  if (!switch_params_.prepared)
+  {
+    message = "Could not commit the switch since no switch is prepared.";
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  }
+  switch_params_.prepared = false;
+  if (switch_params_.activate_request.empty() && switch_params_.deactivate_request.empty())
+  {
+    return controller_interface::return_type::OK;
+  }
+  switch_params_.commit_time_ns = commit_time.nanoseconds();
+  last_switch_time_ = ControllerManagerSwitchTime();
+  return execute_switch(true, timeout, message);
+}
+
+void ControllerManager::cancel_prepared_switch()
+{
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+  if (switch_params_.prepared)
+  {
+    RCLCPP_INFO(get_logger(), "Cancelling the prepared controller switch");
+    switch_params_.prepared = false;
+    clear_requests();
+  }
+}
+
+controller_interface::return_type ControllerManager::swap_controller(
+  const std::string & outgoing_controller, const std::string & incoming_controller,
+  const rclcpp::Duration & timeout, std::string & message)
+{
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+  if (switch_params_.prepared)
+  {
+    message =
+      "Could not swap controllers since a prepared switch is pending. Commit or cancel it first.";
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  }
+  RCLCPP_INFO(
+    get_logger(), "Swapping controller '%s' for controller '%s'", outgoing_controller.c_str(),
+    incoming_controller.c_str());
+  const auto start_time = std::chrono::steady_clock::now();
+  const auto ret = prepare_switch_impl(
+    {incoming_controller}, {outgoing_controller},
+    controller_manager_msgs::srv::SwitchController::Request::STRICT, message, true);
+  if (ret != controller_interface::return_type::OK)
+  {
+    return ret;
+  }
+  if (switch_params_.activate_request.empty() && switch_params_.deactivate_request.empty())
+  {
+    message = fmt::format(
+      FMT_COMPILE(
+        "Could not swap controller '{}' for controller '{}' since none of them has to be "
+        "switched."),
+      outgoing_controller, incoming_controller);
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  }
+  last_switch_time_ = ControllerManagerSwitchTime();
+  last_switch_time_.prepare_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count();
+  // the swap is performed in the real-time loop, after the update of the outgoing controller
+  return execute_switch(true, timeout, message);
+}
+
+controller_interface::return_type ControllerManager::shadow_controller(
+  const std::string & controller_name, unsigned int cycles, const rclcpp::Duration & timeout,
+  std::string & message, MovingAverageStatistics::StatisticData & execution_time_statistics)
+{
+  const auto fail = [this, &message](const std::string & reason)
+  {
+    message = reason;
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  };
+  // the controller can't be switched while it is shadowed
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+  const std::vector<ControllerSpec> & controllers = rt_controllers_wrapper_.get_updated_list(guard);
+  const auto found_it = std::find_if(
+    controllers.begin(), controllers.end(),
+    std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+  if (found_it == controllers.end())
+  {
+    return fail(fmt::format(
+      FMT_COMPILE("Could not shadow controller '{}' since it is not loaded."), controller_name));
+  }
+  const auto controller = found_it->c;
+  if (!is_controller_inactive(controller))
+  {
+    return fail(fmt::format(
+      FMT_COMPILE("Could not shadow controller '{}' since it is not inactive."), controller_name));
+  }
+  if (controller->is_async())
+  {
+    return fail(fmt::format(
+      FMT_COMPILE(
+        "Could not shadow controller '{}' since asynchronous controllers are not supported."),
+      controller_name));
+  }
+  if (cycles == 0u || cycles > static_cast<unsigned int>(std::numeric_limits<int>::max()))
+  {
+    return fail(fmt::format(
+      FMT_COMPILE("Could not shadow controller '{}' for {} cycles."), controller_name, cycles));
+  }
+
+  // the commands are written to detached copies, so the command interfaces are not claimed
+  std::vector<hardware_interface::CommandInterface::SharedPtr> shadow_command_interfaces;
+  std::vector<hardware_interface::LoanedStateInterface> state_loans;
+  try
+  {
+    shadow_command_interfaces = resource_manager_->make_detached_command_interfaces(
+      get_command_interfaces_names(controller, resource_manager_));
+    const auto state_interface_names = get_state_interfaces_names(controller, resource_manager_);
+    state_loans.reserve(state_interface_names.size());
+    for (const auto & state_interface : state_interface_names)
+    {
+      state_loans.emplace_back(resource_manager_->claim_state_interface(state_interface));
+    }
+  }
+  catch (const std::exception & e)
+  {
+    return fail(fmt::format(
+      FMT_COMPILE("Could not shadow controller '{}' since its interfaces are missing: {}"),
+      controller_name, e.what()));
+  }
+  std::vector<hardware_interface::LoanedCommandInterface> command_loans;
+  command_loans.reserve(shadow_command_interfaces.size());
+  for (const auto & command_interface : shadow_command_interfaces)
+  {
+    command_loans.emplace_back(command_interface);
+  }
+  controller->assign_interfaces(std::move(command_loans), std::move(state_loans));
+
+  auto shadow_activate_ret = controller_interface::return_type::ERROR;
+  try
+  {
+    shadow_activate_ret = controller->on_shadow_activate();
+  }
+  catch (const std::exception & e)
   {
-    auto it =
-      std::find(ordered_controllers_names_.begin(), ordered_controllers_names_.end(), ctrl_name);
-    if (it == ordered_controllers_names_.end())
+    RCLCPP_ERROR(
+      get_logger(),
+      "Caught exception of type : %s while preparing the shadow mode of controller '%s': %s",
+      typeid(e).name(), controller_name.c_str(), e.what());
+    if (!params_->handle_exceptions)
     {
-      update_list_with_controller_chain(ctrl_name, ordered_controllers_names_.end(), false);
+      controller->release_interfaces();
+      throw;
     }
   }
-
-  std::vector<ControllerSpec> new_list;
-  for (const auto & ctrl : ordered_controllers_names_)
+  if (shadow_activate_ret != controller_interface::return_type::OK)
   {
-    auto controller_it = std::find_if(
-      to.begin(), to.end(), std::bind(controller_name_compare, std::placeholders::_1, ctrl));
-    if (controller_it != to.end())
-    {
-      new_list.push_back(*controller_it);
-    }
+    controller->release_interfaces();
+    return fail(fmt::format(
+      FMT_COMPILE("Controller '{}' does not support the shadow mode or failed to prepare it."),
+      controller_name));
   }
 
-  // Update the controllers chain groups in the ControllerSpec
-  for (const auto & [ctrl_name, full_chain_info] : controller_full_chain_info_cache)
+  RCLCPP_INFO(
+    get_logger(), "Running controller '%s' in shadow mode for %u cycles", controller_name.c_str(),
+    cycles);
+  *found_it->last_update_cycle_time =
+    rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type());
+  found_it->periodicity_statistics->reset();
+  found_it->execution_time_statistics->reset();
+  auto & shadow_mode = *found_it->shadow_mode;
+  shadow_mode.result.store(controller_interface::return_type::OK);
+  shadow_mode.remaining_cycles.store(static_cast<int>(cycles));
+  const auto wait_timeout =
+    timeout == rclcpp::Duration(0, 0)
+      ? rclcpp::Duration::from_seconds(static_cast<double>(cycles) / update_rate_ + 1.0)
+      : timeout;
+  const auto deadline =
+    std::chrono::steady_clock::now() + wait_timeout.to_chrono<std::chrono::nanoseconds>();
+  while (shadow_mode.remaining_cycles.load() > 0 && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  // stops the shadow updates and waits for the one the real-time loop might be running
+  shadow_mode.remaining_cycles.store(0);
+  while (shadow_mode.updating.load())
+  {
+    std::this_thread::yield();
+  }
+  // the update stopped by the first store is counted after it
+  shadow_mode.remaining_cycles.store(0);
+
+  execution_time_statistics = found_it->execution_time_statistics->get_statistics();
+  // an overrun of the time budget in shadow mode doesn't skip the first active update
+  found_it->time_budget->skip_next_cycle = false;
+  try
   {
-    RCLCPP_DEBUG(
-      get_logger(), "%s",
-      fmt::format(
-        "The controller '{}' is in chain with: [{}]", ctrl_name, fmt::join(full_chain_info, ", "))
-        .c_str());
-    auto controller_it = std::find_if(
-      new_list.begin(), new_list.end(),
-      std::bind(controller_name_compare, std::placeholders::_1, ctrl_name));
-    if (controller_it != new_list.end())
+    controller->on_shadow_deactivate();
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "Caught exception of type : %s while ending the shadow mode of controller '%s': %s",
+      typeid(e).name(), controller_name.c_str(), e.what());
+    if (!params_->handle_exceptions)
     {
-      controller_it->controllers_chain_group = full_chain_info;
+      controller->release_interfaces();
+      throw;
     }
   }
+  controller->release_interfaces();
 
-  to = new_list;
-  RCLCPP_DEBUG(get_logger(), "Reordered controllers list is:");
-  for (const auto & ctrl : to)
+  const auto shadow_updates = static_cast<unsigned int>(execution_time_statistics.sample_count);
+  if (shadow_mode.result.load() != controller_interface::return_type::OK)
   {
-    RCLCPP_DEBUG(this->get_logger(), "\t%s", ctrl.info.name.c_str());
+    return fail(fmt::format(
+      FMT_COMPILE("A shadow update of controller '{}' failed, its shadow mode was ended."),
+      controller_name));
   }
-
-  // switch lists
-  rt_controllers_wrapper_.switch_updated_list(guard);
-  // clear unused list
-  rt_controllers_wrapper_.get_unused_list(guard).clear();
-
+  if (shadow_updates < cycles)
+  {
+    return fail(fmt::format(
+      FMT_COMPILE("Controller '{}' ran {} of {} shadow updates before the timeout."),
+      controller_name, shadow_updates, cycles));
+  }
+  message = fmt::format(
+    FMT_COMPILE(
+      "Controller '{}' ran {} shadow updates in {:.1f} us on average and {:.1f} us at most."),
+    controller_name, shadow_updates, execution_time_statistics.average,
+    execution_time_statistics.max);
+  RCLCPP_INFO(get_logger(), "%s", message.c_str());
   return controller_interface::return_type::OK;
 }
 
-void ControllerManager::clear_requests()
-{
-  switch_params_.do_switch = false;
-  switch_params_.ready_to_switch = false;
-  switch_params_.activate_asap = false;
-  switch_params_.deactivate_request.clear();
-  switch_params_.activate_request.clear();
-  switch_params_.to_chained_mode_request.clear();
-  switch_params_.from_chained_mode_request.clear();
-  switch_params_.activate_command_interface_request.clear();
-  switch_params_.deactivate_command_interface_request.clear();
-}
-
-controller_interface::return_type ControllerManager::switch_controller(
-  const std::vector<std::string> & activate_controllers,
-  const std::vector<std::string> & deactivate_controllers, int strictness, bool activate_asap,
-  const rclcpp::Duration & timeout)
-{
-  std::string message;
-  return switch_controller_cb(
-    activate_controllers, deactivate_controllers, strictness, activate_asap, timeout, message);
-}
-
-controller_interface::return_type ControllerManager::switch_controller_cb(
+controller_interface::return_type ControllerManager::prepare_switch_impl(
   const std::vector<std::string> & activate_controllers,
-  const std::vector<std::string> & deactivate_controllers, int strictness, bool activate_asap,
-  const rclcpp::Duration & timeout, std::string & message)
+  const std::vector<std::string> & deactivate_controllers, int strictness, std::string & message,
+  bool swap)
 {
   if (!is_resource_manager_initialized())
   {
@@ -2004,40 +4189,334 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
         request_list.push_back(controller);
       }
     }
-    RCLCPP_DEBUG(
-      get_logger(), "'%s' request vector has size %i", action.c_str(),
-      static_cast<int>(request_list.size()));
+    RCLCPP_DEBUG(
+      get_logger(), "'%s' request vector has size %i", action.c_str(),
+      static_cast<int>(request_list.size()));
+
+    return result;
+  };
+
+  // list all controllers to deactivate (check if all controllers exist)
+  auto ret = list_controllers(
+    deactivate_controllers, switch_params_.deactivate_request, "deactivate", message);
+  if (ret != controller_interface::return_type::OK)
+  {
+    switch_params_.deactivate_request.clear();
+    return ret;
+  }
+
+  // list all controllers to activate (check if all controllers exist)
+  ret =
+    list_controllers(activate_controllers, switch_params_.activate_request, "activate", message);
+  if (ret != controller_interface::return_type::OK)
+  {
+    switch_params_.deactivate_request.clear();
+    switch_params_.activate_request.clear();
+    return ret;
+  }
+  // If it is a best effort switch, we can remove the controllers log that could not be activated
+  message.clear();
+
+  // lock controllers
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+
+  const std::vector<ControllerSpec> & controllers = rt_controllers_wrapper_.get_updated_list(guard);
+
+  std::string switch_plan_key;
+  if (params_->switch_plan_cache.enable)
+  {
+    switch_plan_key = get_switch_plan_key(
+      controllers, activate_controllers, deactivate_controllers, strictness);
+  }
+  const auto switch_plan_it = switch_plan_key.empty() ? switch_plan_cache_.end()
+                                                      : switch_plan_cache_.find(switch_plan_key);
+  if (switch_plan_it != switch_plan_cache_.end())
+  {
+    RCLCPP_DEBUG(get_logger(), "Using the cached switch plan for the requested switch");
+    const SwitchPlan & plan = switch_plan_it->second;
+    switch_params_.activate_request = plan.activate_request;
+    switch_params_.deactivate_request = plan.deactivate_request;
+    switch_params_.to_chained_mode_request = plan.to_chained_mode_request;
+    switch_params_.from_chained_mode_request = plan.from_chained_mode_request;
+    switch_params_.activate_command_interface_request = plan.activate_command_interface_request;
+    switch_params_.deactivate_command_interface_request =
+      plan.deactivate_command_interface_request;
+  }
+  else
+  {
+    const auto compile_result = compile_switch_plan(controllers, strictness, message);
+    if (
+      compile_result != controller_interface::return_type::OK ||
+      (switch_params_.activate_request.empty() && switch_params_.deactivate_request.empty()))
+    {
+      return compile_result;
+    }
+    if (!switch_plan_key.empty())
+    {
+      switch_plan_cache_[switch_plan_key] = SwitchPlan{
+        switch_params_.activate_request,
+        switch_params_.deactivate_request,
+        switch_params_.to_chained_mode_request,
+        switch_params_.from_chained_mode_request,
+        switch_params_.activate_command_interface_request,
+        switch_params_.deactivate_command_interface_request};
+    }
+  }
+
+  if (swap)
+  {
+    // a swap replaces one controller by another without changing the other controllers
+    if (
+      switch_params_.activate_request != activate_controllers ||
+      switch_params_.deactivate_request != deactivate_controllers ||
+      !switch_params_.to_chained_mode_request.empty() ||
+      !switch_params_.from_chained_mode_request.empty())
+    {
+      message = fmt::format(
+        FMT_COMPILE(
+          "Could not swap controller '{}' for controller '{}' since the switch changes other "
+          "controllers or the chained mode of a controller."),
+        deactivate_controllers.front(), activate_controllers.front());
+      RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+      clear_requests();
+      return controller_interface::return_type::ERROR;
+    }
+    switch_params_.swap_outgoing_controller = deactivate_controllers.front();
+    switch_params_.swap_incoming_controller = activate_controllers.front();
+    // the command interfaces handed over stay claimed and keep their command mode
+    std::vector<std::string> handed_over_interfaces;
+    for (const auto & interface : switch_params_.deactivate_command_interface_request)
+    {
+      if (ros2_control::has_item(switch_params_.activate_command_interface_request, interface))
+      {
+        handed_over_interfaces.push_back(interface);
+      }
+    }
+    for (const auto & interface : handed_over_interfaces)
+    {
+      (void)ros2_control::remove_item(switch_params_.activate_command_interface_request, interface);
+      (void)ros2_control::remove_item(
+        switch_params_.deactivate_command_interface_request, interface);
+    }
+  }
+
+  // the preparations of the activations that aren't real-time safe run here, only on_activate()
+  // runs in the control loop
+  const auto preparation_start_time = std::chrono::steady_clock::now();
+  std::vector<std::string> controllers_to_prepare = switch_params_.activate_request;
+  for (const auto & controller_name : switch_params_.activate_request)
+  {
+    // the fallback controllers are activated by the control loop when the controller fails
+    const auto controller_it = std::find_if(
+      controllers.begin(), controllers.end(),
+      std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+    if (controller_it != controllers.end())
+    {
+      ros2_control::add_items(
+        controllers_to_prepare, controller_it->info.fallback_controllers_names);
+    }
+  }
+  for (const auto & controller_name : controllers_to_prepare)
+  {
+    const auto controller_it = std::find_if(
+      controllers.begin(), controllers.end(),
+      std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+    if (controller_it == controllers.end())
+    {
+      continue;
+    }
+    auto prepare_ret = controller_interface::return_type::ERROR;
+    try
+    {
+      prepare_ret = controller_it->c->on_prepare_activate();
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Caught exception of type : %s while preparing the activation of the controller '%s': %s",
+        typeid(e).name(), controller_name.c_str(), e.what());
+      params_->handle_exceptions ? void() : throw;
+    }
+    if (prepare_ret != controller_interface::return_type::OK)
+    {
+      message = fmt::format(
+        FMT_COMPILE(
+          "Could not switch controllers since the controller '{}' failed to prepare its "
+          "activation."),
+        controller_name);
+      RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+      clear_requests();
+      return controller_interface::return_type::ERROR;
+    }
+  }
+  execution_time_.activation_preparation_time =
+    std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now() - preparation_start_time)
+      .count();
+
+  RCLCPP_DEBUG(get_logger(), "Request for command interfaces from activating controllers:");
+  for (const auto & interface : switch_params_.activate_command_interface_request)
+  {
+    RCLCPP_DEBUG(get_logger(), " - %s", interface.c_str());
+  }
+  RCLCPP_DEBUG(get_logger(), "Release of command interfaces from deactivating controllers:");
+  for (const auto & interface : switch_params_.deactivate_command_interface_request)
+  {
+    RCLCPP_DEBUG(get_logger(), " - %s", interface.c_str());
+  }
+
+  if (
+    !switch_params_.activate_command_interface_request.empty() ||
+    !switch_params_.deactivate_command_interface_request.empty())
+  {
+    if (!resource_manager_->prepare_command_mode_switch(
+          switch_params_.activate_command_interface_request,
+          switch_params_.deactivate_command_interface_request))
+    {
+      message = "Could not switch controllers since prepare command mode switch was rejected.";
+      RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+      clear_requests();
+      return controller_interface::return_type::ERROR;
+    }
+  }
+
+  switch_params_.strictness = strictness;
+  return controller_interface::return_type::OK;
+}
+
+controller_interface::return_type ControllerManager::execute_switch(
+  bool activate_asap, const rclcpp::Duration & timeout, std::string & message)
+{
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+  const std::vector<ControllerSpec> & controllers = rt_controllers_wrapper_.get_updated_list(guard);
+
+  // the control loop doesn't wait for the asynchronous updates of the controllers it deactivates,
+  // the claims still held by their revoked loans are released once the updates finished
+  for (const auto & controller : controllers)
+  {
+    controller.c->release_revoked_interfaces();
+  }
+
+  // wait for deactivating async controllers to finish their current cycle
+  for (const auto & controller : switch_params_.deactivate_request)
+  {
+    auto controller_it = std::find_if(
+      controllers.begin(), controllers.end(),
+      std::bind(controller_name_compare, std::placeholders::_1, controller));
+    if (controller_it != controllers.end())
+    {
+      controller_it->c->prepare_for_deactivation();
+    }
+  }
+  // the controllers deactivated by the control loop, e.g., after an error, don't wait for their
+  // asynchronous update, it has to finish before they are activated again
+  for (const auto & controller : switch_params_.activate_request)
+  {
+    auto controller_it = std::find_if(
+      controllers.begin(), controllers.end(),
+      std::bind(controller_name_compare, std::placeholders::_1, controller));
+    if (controller_it != controllers.end())
+    {
+      controller_it->c->wait_for_trigger_update_to_finish();
+    }
+  }
+
+  // start the atomic controller switching
+  switch_params_.activate_asap = activate_asap;
+  if (timeout == rclcpp::Duration{0, 0})
+  {
+    RCLCPP_INFO_ONCE(get_logger(), "Switch controller timeout is set to 0, using default 1s!");
+    switch_params_.timeout = std::chrono::nanoseconds(1'000'000'000);
+  }
+  else
+  {
+    switch_params_.timeout = timeout.to_chrono<std::chrono::nanoseconds>();
+  }
+  if (switch_params_.activate_asap)
+  {
+    RCLCPP_DEBUG(get_logger(), "Requested atomic controller switch from realtime loop");
+  }
+  const auto elapsed_us = [](const std::chrono::steady_clock::time_point & start)
+  {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+      .count();
+  };
+  {
+    // wait until the realtime loop acknowledges the switch request, it only pushes the responses
+    // with the mutex held, so no notification can be missed
+    const auto acknowledge_start_time = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> switch_params_guard(switch_params_.mutex);
+    switch_params_.update_switch_flags(controllers);
+    switch_params_.do_switch = true;
+    // an idle control loop doesn't wait for its idle period to acknowledge the request
+    notify_control_loop();
+    SwitchResponse response = SwitchResponse::SWITCH_FINISHED;
+    if (!switch_params_.cv.wait_for(
+          switch_params_guard, switch_params_.timeout,
+          [this, &response] { return switch_params_.responses.pop(response); }))
+    {
+      // the realtime loop checks the request again once it holds the mutex, so it can't start
+      // the switch after the request is withdrawn here
+      switch_params_.do_switch = false;
+      switch_params_guard.unlock();
+      message = fmt::format(
+        FMT_COMPILE("Switch controller timed out after {} seconds!"),
+        static_cast<double>(switch_params_.timeout.count()) / 1e9);
+      RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+      clear_requests();
+      return controller_interface::return_type::ERROR;
+    }
+    last_switch_time_.realtime_acknowledge_time = elapsed_us(acknowledge_start_time);
+    if (response == SwitchResponse::READY_TO_SWITCH)
+    {
+      RCLCPP_INFO(get_logger(), "Requested controller switch from non-realtime loop");
+      // This should work as the realtime thread operation is read-only operation
+      const auto switch_start_time = std::chrono::steady_clock::now();
+      perform_switch();
+      last_switch_time_.non_realtime_switch_time = elapsed_us(switch_start_time);
+    }
+  }
 
-    return result;
-  };
+  // copy the controllers spec from the used to the unused list
+  auto list_release_start_time = std::chrono::steady_clock::now();
+  std::vector<ControllerSpec> & to = rt_controllers_wrapper_.get_unused_list(guard);
+  last_switch_time_.list_release_time = elapsed_us(list_release_start_time);
+  to = controllers;
 
-  // list all controllers to deactivate (check if all controllers exist)
-  auto ret = list_controllers(
-    deactivate_controllers, switch_params_.deactivate_request, "deactivate", message);
-  if (ret != controller_interface::return_type::OK)
+  // update the claimed interface controller info
+  auto switch_result = evaluate_switch_result(
+    resource_manager_, switch_params_.activate_request, switch_params_.deactivate_request,
+    switch_params_.strictness, get_logger(), to, message);
+  update_controllers_fault_plans(to, resource_manager_);
+  if (params_->numa_placement.enable)
   {
-    switch_params_.deactivate_request.clear();
-    return ret;
+    move_realtime_memory_to_numa_node(to);
   }
 
-  // list all controllers to activate (check if all controllers exist)
-  ret =
-    list_controllers(activate_controllers, switch_params_.activate_request, "activate", message);
-  if (ret != controller_interface::return_type::OK)
-  {
-    switch_params_.deactivate_request.clear();
-    switch_params_.activate_request.clear();
-    return ret;
-  }
-  // If it is a best effort switch, we can remove the controllers log that could not be activated
-  message.clear();
+  // the activity is updated before the real-time loop, woken up by the new list, checks it
+  update_controllers_activity(to);
 
-  // lock controllers
-  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
-    rt_controllers_wrapper_.controllers_lock_);
+  // switch lists
+  list_release_start_time = std::chrono::steady_clock::now();
+  rt_controllers_wrapper_.switch_updated_list(guard);
+  last_switch_time_.list_release_time += elapsed_us(list_release_start_time);
+  switch_latency_stats_.add_measurement(
+    last_switch_time_.prepare_time + last_switch_time_.realtime_acknowledge_time +
+    last_switch_time_.non_realtime_switch_time + last_switch_time_.list_release_time);
+  // clear unused list
+  rt_controllers_wrapper_.get_unused_list(guard).clear();
 
-  const std::vector<ControllerSpec> & controllers = rt_controllers_wrapper_.get_updated_list(guard);
+  clear_requests();
+
+  return switch_result;
+}
 
+controller_interface::return_type ControllerManager::compile_switch_plan(
+  const std::vector<ControllerSpec> & controllers, int strictness, std::string & message)
+{
   // if a preceding controller is deactivated, all first-level controllers should be switched 'from'
   // chained mode
   propagate_deactivation_of_chained_mode(controllers);
@@ -2298,22 +4777,13 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
         controller, resource_manager_, switch_params_.deactivate_command_interface_request);
     }
 
-    // cache mapping between hardware and controllers for stopping when read/write error happens
-    // TODO(destogl): This caching approach is suboptimal because the cache can fast become
-    // outdated. Keeping it up to date is not easy because of stopping controllers from multiple
-    // threads maybe we should not at all cache this but always search for the related controllers
-    // to a hardware when error in hardware happens
+    // cache mapping between hardware and controllers for stopping when read/write error happens,
+    // the controllers are removed from the cache when they are unloaded
     if (in_activate_list)
     {
-      std::vector<std::string> interface_names =
-        get_command_interfaces_names(controller.c, resource_manager_);
-
-      std::vector<std::string> state_interfaces =
-        get_state_interfaces_names(controller.c, resource_manager_);
-      interface_names.insert(
-        interface_names.end(), state_interfaces.begin(), state_interfaces.end());
-
-      resource_manager_->cache_controller_to_hardware(controller.info.name, interface_names);
+      resource_manager_->cache_controller_to_hardware(
+        controller.info.name, get_command_interfaces_names(controller.c, resource_manager_),
+        get_state_interfaces_names(controller.c, resource_manager_));
     }
   }
 
@@ -2334,114 +4804,45 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
     return controller_interface::return_type::ERROR;
   }
 
-  RCLCPP_DEBUG(get_logger(), "Request for command interfaces from activating controllers:");
-  for (const auto & interface : switch_params_.activate_command_interface_request)
-  {
-    RCLCPP_DEBUG(get_logger(), " - %s", interface.c_str());
-  }
-  RCLCPP_DEBUG(get_logger(), "Release of command interfaces from deactivating controllers:");
-  for (const auto & interface : switch_params_.deactivate_command_interface_request)
-  {
-    RCLCPP_DEBUG(get_logger(), " - %s", interface.c_str());
-  }
-
-  // wait for deactivating async controllers to finish their current cycle
-  for (const auto & controller : switch_params_.deactivate_request)
-  {
-    auto controller_it = std::find_if(
-      controllers.begin(), controllers.end(),
-      std::bind(controller_name_compare, std::placeholders::_1, controller));
-    if (controller_it != controllers.end())
-    {
-      controller_it->c->prepare_for_deactivation();
-    }
-  }
-
-  if (
-    !switch_params_.activate_command_interface_request.empty() ||
-    !switch_params_.deactivate_command_interface_request.empty())
-  {
-    if (!resource_manager_->prepare_command_mode_switch(
-          switch_params_.activate_command_interface_request,
-          switch_params_.deactivate_command_interface_request))
-    {
-      message = "Could not switch controllers since prepare command mode switch was rejected.";
-      RCLCPP_ERROR(get_logger(), "%s", message.c_str());
-      clear_requests();
-      return controller_interface::return_type::ERROR;
-    }
-  }
+  return controller_interface::return_type::OK;
+}
 
-  // start the atomic controller switching
-  switch_params_.strictness = strictness;
-  switch_params_.activate_asap = activate_asap;
-  if (timeout == rclcpp::Duration{0, 0})
+std::string ControllerManager::get_switch_plan_key(
+  const std::vector<ControllerSpec> & controllers,
+  const std::vector<std::string> & activate_controllers,
+  const std::vector<std::string> & deactivate_controllers, int strictness)
+{
+  // the plan depends on the states of all the controllers and hardware components, so they are
+  // part of the key, and any change of the states results in a new plan
+  std::string key = std::to_string(strictness);
+  for (const auto & controller : controllers)
   {
-    RCLCPP_INFO_ONCE(get_logger(), "Switch controller timeout is set to 0, using default 1s!");
-    switch_params_.timeout = std::chrono::nanoseconds(1'000'000'000);
+    key.append(";").append(controller.info.name).append(":");
+    key.append(std::to_string(controller.c->get_lifecycle_id()));
   }
-  else
+  for (const auto & [component_name, component_info] : resource_manager_->get_components_status())
   {
-    switch_params_.timeout = timeout.to_chrono<std::chrono::nanoseconds>();
+    key.append(";").append(component_name).append(":");
+    key.append(std::to_string(component_info.state.id()));
   }
-  switch_params_.ready_to_switch.store(false, std::memory_order_release);
-  switch_params_.do_switch = true;
-  // wait until switch is finished
-  if (switch_params_.activate_asap)
+  key.append("|");
+  for (const auto & controller : activate_controllers)
   {
-    RCLCPP_DEBUG(get_logger(), "Requested atomic controller switch from realtime loop");
-    std::unique_lock<std::mutex> switch_params_guard(switch_params_.mutex);
-    if (!switch_params_.cv.wait_for(
-          switch_params_guard, switch_params_.timeout,
-          [this] { return !switch_params_.do_switch; }))
-    {
-      message = fmt::format(
-        FMT_COMPILE("Switch controller timed out after {} seconds!"),
-        static_cast<double>(switch_params_.timeout.count()) / 1e9);
-      RCLCPP_ERROR(get_logger(), "%s", message.c_str());
-      clear_requests();
-      return controller_interface::return_type::ERROR;
-    }
+    key.append(controller).append(";");
   }
-  else
+  key.append("|");
+  for (const auto & controller : deactivate_controllers)
   {
-    const auto deadline = std::chrono::steady_clock::now() + switch_params_.timeout;
-    while (!switch_params_.ready_to_switch.load(std::memory_order_acquire))
-    {
-      if (std::chrono::steady_clock::now() >= deadline)
-      {
-        message = fmt::format(
-          FMT_COMPILE("Switch controller timed out after {} seconds!"),
-          static_cast<double>(switch_params_.timeout.count()) / 1e9);
-        RCLCPP_ERROR(get_logger(), "%s", message.c_str());
-        clear_requests();
-        return controller_interface::return_type::ERROR;
-      }
-      // wait for the realtime loop to be ready for switching controllers
-      std::this_thread::yield();
-    }
-    RCLCPP_INFO(get_logger(), "Requested controller switch from non-realtime loop");
-    // This should work as the realtime thread operation is read-only operation
-    manage_switch();
+    key.append(controller).append(";");
   }
+  return key;
+}
 
-  // copy the controllers spec from the used to the unused list
-  std::vector<ControllerSpec> & to = rt_controllers_wrapper_.get_unused_list(guard);
-  to = controllers;
-
-  // update the claimed interface controller info
-  auto switch_result = evaluate_switch_result(
-    resource_manager_, switch_params_.activate_request, switch_params_.deactivate_request,
-    strictness, get_logger(), to, message);
-
-  // switch lists
-  rt_controllers_wrapper_.switch_updated_list(guard);
-  // clear unused list
-  rt_controllers_wrapper_.get_unused_list(guard).clear();
-
-  clear_requests();
-
-  return switch_result;
+void ControllerManager::clear_switch_plan_cache()
+{
+  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+    rt_controllers_wrapper_.controllers_lock_);
+  switch_plan_cache_.clear();
 }
 
 controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::add_controller_impl(
@@ -2450,6 +4851,8 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::add_co
   // lock controllers
   std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
     rt_controllers_wrapper_.controllers_lock_);
+  // the cached switch plans don't know about the new controller
+  switch_plan_cache_.clear();
 
   std::vector<ControllerSpec> & to = rt_controllers_wrapper_.get_unused_list(guard);
   const std::vector<ControllerSpec> & from = rt_controllers_wrapper_.get_updated_list(guard);
@@ -2476,13 +4879,21 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::add_co
   {
     controller_interface::ControllerInterfaceParams controller_params;
     controller_params.controller_name = controller.info.name;
-    controller_params.robot_description = robot_description_;
+    controller_params.shared_robot_description = robot_description_;
     controller_params.update_rate = get_update_rate();
     controller_params.controller_manager_update_rate = get_update_rate();
     controller_params.node_namespace = get_namespace();
     controller_params.node_options = controller_node_options;
-    controller_params.hard_joint_limits = resource_manager_->get_hard_joint_limits();
-    controller_params.soft_joint_limits = resource_manager_->get_soft_joint_limits();
+    // the controllers share the limits of the resource manager instead of copying them
+    controller_params.joint_limits_store = resource_manager_->get_joint_limits_store();
+    controller_params.edge_events = resource_manager_->get_edge_events();
+    controller_params.async_worker_pool = controller.control_loop.empty()
+                                            ? async_worker_pool_
+                                            : control_loop_pools_.at(controller.control_loop);
+    controller_params.worker_pool = controller_worker_pool_;
+    controller_params.memory_arena = controller.memory_arena;
+    controller_params.thread_stack_prefault_size =
+      static_cast<std::size_t>(params_->realtime_threads.stack_prefault_size);
     if (controller.c->init(controller_params) == controller_interface::return_type::ERROR)
     {
       to.clear();
@@ -2519,6 +4930,16 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::add_co
 
   executor_->add_node(controller.c->get_node()->get_node_base_interface());
   to.emplace_back(controller);
+  // the lowest id not used by the other controllers keeps the ids dense
+  std::size_t controller_id = 0;
+  while (std::any_of(
+    to.begin(), to.end() - 1,
+    [controller_id](const ControllerSpec & spec) { return spec.id == controller_id; }))
+  {
+    ++controller_id;
+  }
+  to.back().id = controller_id;
+  update_controllers_fault_plans(to, resource_manager_);
 
   // Destroys the old controllers list when the realtime thread is finished with it.
   RCLCPP_DEBUG(get_logger(), "Realtime switches over to new controller list");
@@ -2533,7 +4954,8 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::add_co
 
 void ControllerManager::deactivate_controllers(
   const std::vector<ControllerSpec> & rt_controller_list,
-  const std::vector<std::string> & controllers_to_deactivate)
+  const std::vector<std::string> & controllers_to_deactivate,
+  std::vector<hardware_interface::LoanedCommandInterface> * handed_over_command_interfaces)
 {
   // deactivate controllers
   for (const auto & controller_name : controllers_to_deactivate)
@@ -2552,9 +4974,17 @@ void ControllerManager::deactivate_controllers(
     auto controller = found_it->c;
     if (is_controller_active(*controller))
     {
+      // the phase is assigned again on the next activation
+      found_it->rate_divider->reset_phase();
       try
       {
         const auto new_state = controller->get_node()->deactivate();
+        if (handed_over_command_interfaces)
+        {
+          // only the controller replaced by a swap is deactivated, its command interfaces stay
+          // claimed for the controller replacing it
+          *handed_over_command_interfaces = controller->take_command_interfaces();
+        }
         controller->release_interfaces();
 
         // if it is a chainable controller, make the reference interfaces unavailable on
@@ -2640,7 +5070,8 @@ void ControllerManager::switch_chained_mode(
 
 void ControllerManager::activate_controllers(
   const std::vector<ControllerSpec> & rt_controller_list,
-  const std::vector<std::string> & controllers_to_activate, int strictness)
+  const std::vector<std::string> & controllers_to_activate, int strictness,
+  std::vector<hardware_interface::LoanedCommandInterface> * handed_over_command_interfaces)
 {
   std::vector<std::string> failed_controllers_command_interfaces;
   bool is_successful = true;
@@ -2678,9 +5109,16 @@ void ControllerManager::activate_controllers(
       continue;
     }
     auto controller = found_it->c;
+    found_it->deactivated_by_hardware_error->store(false, std::memory_order_relaxed);
     // reset the last update cycle time for newly activated controllers
     *found_it->last_update_cycle_time =
       rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type());
+    // without a phase set manually or spread, the phase is anchored at the first update
+    found_it->rate_divider->configure(update_rate_, controller->get_update_rate());
+    if (found_it->update_phase >= 0 && found_it->rate_divider->get_divider() > 1u)
+    {
+      found_it->rate_divider->set_phase(static_cast<uint64_t>(found_it->update_phase));
+    }
 
     bool assignment_successful = true;
     const auto command_interface_names =
@@ -2689,6 +5127,18 @@ void ControllerManager::activate_controllers(
     command_loans.reserve(command_interface_names.size());
     for (const auto & command_interface : command_interface_names)
     {
+      if (handed_over_command_interfaces)
+      {
+        auto handed_over_it = std::find_if(
+          handed_over_command_interfaces->begin(), handed_over_command_interfaces->end(),
+          [&command_interface](const hardware_interface::LoanedCommandInterface & loan)
+          { return loan.get_name() == command_interface; });
+        if (handed_over_it != handed_over_command_interfaces->end())
+        {
+          command_loans.push_back(std::move(*handed_over_it));
+          continue;
+        }
+      }
       if (resource_manager_->command_interface_is_claimed(command_interface))
       {
         RCLCPP_ERROR(
@@ -2757,6 +5207,10 @@ void ControllerManager::activate_controllers(
     {
       found_it->periodicity_statistics->reset();
       found_it->execution_time_statistics->reset();
+      found_it->stage_time_statistics->reset();
+      found_it->command_latency_statistics->reset();
+      found_it->parallel_time_statistics->reset();
+      found_it->parallel_task_time_statistics->reset();
       new_state = controller->get_node()->activate();
     }
     catch (const std::exception & e)
@@ -2835,16 +5289,85 @@ void ControllerManager::activate_controllers(
       "Error switching back the interfaces in the hardware when the controller activation "
       "failed.");
   }
+
+  if (params_->rate_scheduling.spread_phases)
+  {
+    spread_update_phases(rt_controller_list);
+  }
+}
+
+void ControllerManager::spread_update_phases(const std::vector<ControllerSpec> & rt_controller_list)
+{
+  auto is_spread = [](const ControllerSpec & controller)
+  {
+    return controller.update_phase < 0 && controller.rate_divider->get_divider() > 1u &&
+           is_controller_active(controller.c);
+  };
+  // the load of a controller is its measured execution time, 1 if not measured yet
+  auto get_load = [](const ControllerSpec & controller)
+  {
+    return controller.execution_time_statistics->get_count() > 0
+             ? controller.execution_time_statistics->get_average()
+             : 1.0;
+  };
+
+  rate_phase_allocator_.reset(update_rate_);
+  for (const auto & controller : rt_controller_list)
+  {
+    if (is_spread(controller))
+    {
+      controller.rate_divider->reset_phase();
+    }
+    else if (
+      controller.update_phase >= 0 && controller.rate_divider->has_phase() &&
+      is_controller_active(controller.c))
+    {
+      rate_phase_allocator_.reserve(
+        controller.rate_divider->get_divider(), controller.rate_divider->get_phase(),
+        get_load(controller));
+    }
+  }
+  // placing the longest controllers first balances the load better, the controllers are selected
+  // in place to avoid allocating memory in the real-time loop
+  while (true)
+  {
+    const ControllerSpec * longest_controller = nullptr;
+    for (const auto & controller : rt_controller_list)
+    {
+      if (
+        is_spread(controller) && !controller.rate_divider->has_phase() &&
+        (longest_controller == nullptr || get_load(controller) > get_load(*longest_controller)))
+      {
+        longest_controller = &controller;
+      }
+    }
+    if (longest_controller == nullptr)
+    {
+      break;
+    }
+    const auto & rate_divider = longest_controller->rate_divider;
+    rate_divider->set_phase(
+      rate_phase_allocator_.allocate(rate_divider->get_divider(), get_load(*longest_controller)));
+  }
 }
 
 void ControllerManager::list_controllers_srv_cb(
   const std::shared_ptr<controller_manager_msgs::srv::ListControllers::Request>,
   std::shared_ptr<controller_manager_msgs::srv::ListControllers::Response> response)
 {
-  // lock services
+  // the query doesn't lock the services, it can run concurrently with the lifecycle services
   RCLCPP_DEBUG(get_logger(), "list controller service called");
-  std::lock_guard<std::mutex> services_guard(services_lock_);
-  RCLCPP_DEBUG(get_logger(), "list controller service locked");
+
+  // the list is rebuilt only when the controllers or the interfaces changed since the last call
+  const uint64_t controllers_version = activity_publish_requests_.load(std::memory_order_acquire);
+  const uint64_t interfaces_version = resource_manager_->get_interfaces_version();
+  std::lock_guard<std::mutex> cache_guard(list_controllers_cache_.mutex);
+  if (list_controllers_cache_.is_up_to_date(controllers_version, interfaces_version))
+  {
+    *response = list_controllers_cache_.response;
+    RCLCPP_DEBUG(get_logger(), "list controller service finished with the cached list");
+    return;
+  }
 
   // lock controllers
   std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
@@ -2940,6 +5463,7 @@ void ControllerManager::list_controllers_srv_cb(
       controller_state.chain_connections.push_back(connection);
     }
   }
+  list_controllers_cache_.update(controllers_version, interfaces_version, *response);
 
   RCLCPP_DEBUG(get_logger(), "list controller service finished");
 }
@@ -2948,25 +5472,43 @@ void ControllerManager::list_controller_types_srv_cb(
   const std::shared_ptr<controller_manager_msgs::srv::ListControllerTypes::Request>,
   std::shared_ptr<controller_manager_msgs::srv::ListControllerTypes::Response> response)
 {
-  // lock services
+  // the query doesn't lock the services, it can run concurrently with the lifecycle services
   RCLCPP_DEBUG(get_logger(), "list types service called");
-  std::lock_guard<std::mutex> guard(services_lock_);
-  RCLCPP_DEBUG(get_logger(), "list types service locked");
 
-  auto cur_types = loader_->getDeclaredClasses();
+  wait_for_controller_libraries_preload();
+  std::shared_ptr<pluginlib::ClassLoader<controller_interface::ControllerInterface>> loader;
+  std::shared_ptr<pluginlib::ClassLoader<controller_interface::ChainableControllerInterface>>
+    chainable_loader;
+  {
+    // the loaders may be replaced by a concurrent reload of the controller libraries
+    std::lock_guard<std::mutex> guard(controller_loaders_lock_);
+    loader = loader_;
+    chainable_loader = chainable_loader_;
+  }
+  auto cur_types = loader->getDeclaredClasses();
   for (const auto & cur_type : cur_types)
   {
     response->types.push_back(cur_type);
     response->base_classes.push_back(kControllerInterfaceClassName);
     RCLCPP_DEBUG(get_logger(), "%s", cur_type.c_str());
   }
-  cur_types = chainable_loader_->getDeclaredClasses();
+  cur_types = chainable_loader->getDeclaredClasses();
   for (const auto & cur_type : cur_types)
   {
     response->types.push_back(cur_type);
     response->base_classes.push_back(kChainableControllerInterfaceClassName);
     RCLCPP_DEBUG(get_logger(), "%s", cur_type.c_str());
   }
+  for (const auto & cur_type : StaticControllerRegistry::get_declared_classes())
+  {
+    response->types.push_back(cur_type);
+    response->base_classes.push_back(kControllerInterfaceClassName);
+  }
+  for (const auto & cur_type : StaticChainableControllerRegistry::get_declared_classes())
+  {
+    response->types.push_back(cur_type);
+    response->base_classes.push_back(kChainableControllerInterfaceClassName);
+  }
 
   RCLCPP_DEBUG(get_logger(), "list types service finished");
 }
@@ -3002,6 +5544,57 @@ void ControllerManager::configure_controller_service_cb(
     get_logger(), "configuring service finished for controller '%s' ", request->name.c_str());
 }
 
+void ControllerManager::load_configure_controllers_service_cb(
+  const std::shared_ptr<controller_manager_msgs::srv::LoadConfigureControllers::Request> request,
+  std::shared_ptr<controller_manager_msgs::srv::LoadConfigureControllers::Response> response)
+{
+  // lock services
+  RCLCPP_DEBUG(
+    get_logger(), "loading and configuring service called for %zu controllers",
+    request->names.size());
+  std::lock_guard<std::mutex> guard(services_lock_);
+  RCLCPP_DEBUG(get_logger(), "loading and configuring service locked");
+
+  // the controller plugins are loaded one after the other, pluginlib is not thread-safe
+  response->ok = true;
+  response->loaded.resize(request->names.size(), false);
+  response->configured.resize(request->names.size(), false);
+  std::vector<std::string> loaded_controllers;
+  std::vector<std::size_t> loaded_indices;
+  for (std::size_t i = 0; i < request->names.size(); ++i)
+  {
+    // the controllers that are already loaded are only configured
+    const auto & controllers = get_loaded_controllers();
+    const bool is_loaded = std::any_of(
+      controllers.begin(), controllers.end(),
+      std::bind(controller_name_compare, std::placeholders::_1, request->names[i]));
+    response->loaded[i] = is_loaded || load_controller(request->names[i]) != nullptr;
+    response->ok &= response->loaded[i];
+    if (response->loaded[i])
+    {
+      loaded_controllers.push_back(request->names[i]);
+      loaded_indices.push_back(i);
+    }
+  }
+
+  if (request->configure)
+  {
+    const auto results =
+      configure_controllers(loaded_controllers, std::thread::hardware_concurrency());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      response->configured[loaded_indices[i]] =
+        results[i] == controller_interface::return_type::OK;
+    }
+    for (std::size_t i = 0; i < request->names.size(); ++i)
+    {
+      response->ok &= response->configured[i];
+    }
+  }
+
+  RCLCPP_DEBUG(get_logger(), "loading and configuring service finished");
+}
+
 void ControllerManager::reload_controller_libraries_service_cb(
   const std::shared_ptr<controller_manager_msgs::srv::ReloadControllerLibraries::Request> request,
   std::shared_ptr<controller_manager_msgs::srv::ReloadControllerLibraries::Response> response)
@@ -3073,35 +5666,127 @@ void ControllerManager::reload_controller_libraries_service_cb(
   assert(loaded_controllers.empty());
 
   // Force a reload on all the PluginLoaders (internally, this recreates the plugin loaders)
+  wait_for_controller_libraries_preload();
+  std::lock_guard<std::mutex> loaders_guard(controller_loaders_lock_);
+  if (params_->controller_libraries.cache_manifests && controller_plugin_xml_paths_.empty())
+  {
+    controller_plugin_xml_paths_ = loader_->getPluginXmlPaths();
+    chainable_controller_plugin_xml_paths_ = chainable_loader_->getPluginXmlPaths();
+  }
+  // the manifests are parsed again, but the packages aren't searched if their paths are cached
   loader_ = std::make_shared<pluginlib::ClassLoader<controller_interface::ControllerInterface>>(
-    kControllerInterfaceNamespace, kControllerInterfaceClassName);
+    kControllerInterfaceNamespace, kControllerInterfaceClassName, "plugin",
+    controller_plugin_xml_paths_);
   chainable_loader_ =
     std::make_shared<pluginlib::ClassLoader<controller_interface::ChainableControllerInterface>>(
-      kControllerInterfaceNamespace, kChainableControllerInterfaceClassName);
+      kControllerInterfaceNamespace, kChainableControllerInterfaceClassName, "plugin",
+      chainable_controller_plugin_xml_paths_);
   RCLCPP_INFO(
     get_logger(), "Controller manager: reloaded controller libraries for '%s'",
     kControllerInterfaceNamespace);
+  if (!params_->controller_libraries.preload.empty())
+  {
+    controller_libraries_preload_ = std::async(
+      std::launch::async, &ControllerManager::preload_controller_libraries, this,
+      params_->controller_libraries.preload);
+  }
 
   response->ok = true;
 
-  RCLCPP_DEBUG(get_logger(), "reload libraries service finished");
+  RCLCPP_DEBUG(get_logger(), "reload libraries service finished");
+}
+
+void ControllerManager::switch_controller_service_cb(
+  const std::shared_ptr<controller_manager_msgs::srv::SwitchController::Request> request,
+  std::shared_ptr<controller_manager_msgs::srv::SwitchController::Response> response)
+{
+  // lock services
+  RCLCPP_DEBUG(get_logger(), "switching service called");
+  std::lock_guard<std::mutex> guard(services_lock_);
+  RCLCPP_DEBUG(get_logger(), "switching service locked");
+
+  response->ok = switch_controller_cb(
+                   request->activate_controllers, request->deactivate_controllers,
+                   request->strictness, request->activate_asap, request->timeout,
+                   response->message) == controller_interface::return_type::OK;
+
+  RCLCPP_DEBUG(get_logger(), "switching service finished");
+}
+
+void ControllerManager::prepare_switch_controller_service_cb(
+  const std::shared_ptr<controller_manager_msgs::srv::PrepareSwitchController::Request> request,
+  std::shared_ptr<controller_manager_msgs::srv::PrepareSwitchController::Response> response)
+{
+  // lock services
+  RCLCPP_DEBUG(get_logger(), "prepare switch service called");
+  std::lock_guard<std::mutex> guard(services_lock_);
+  RCLCPP_DEBUG(get_logger(), "prepare switch service locked");
+
+  response->ok = prepare_switch(
+                   request->activate_controllers, request->deactivate_controllers,
+                   request->strictness,
+                   response->message) == controller_interface::return_type::OK;
+
+  RCLCPP_DEBUG(get_logger(), "prepare switch service finished");
+}
+
+void ControllerManager::commit_switch_controller_service_cb(
+  const std::shared_ptr<controller_manager_msgs::srv::CommitSwitchController::Request> request,
+  std::shared_ptr<controller_manager_msgs::srv::CommitSwitchController::Response> response)
+{
+  // lock services
+  RCLCPP_DEBUG(get_logger(), "commit switch service called");
+  std::lock_guard<std::mutex> guard(services_lock_);
+  RCLCPP_DEBUG(get_logger(), "commit switch service locked");
+
+  if (request->cancel)
+  {
+    cancel_prepared_switch();
+    response->ok = true;
+  }
+  else
+  {
+    response->ok = commit_switch(
+                     rclcpp::Time(request->commit_time), request->timeout,
+                     response->message) == controller_interface::return_type::OK;
+  }
+
+  RCLCPP_DEBUG(get_logger(), "commit switch service finished");
 }
 
-void ControllerManager::switch_controller_service_cb(
-  const std::shared_ptr<controller_manager_msgs::srv::SwitchController::Request> request,
-  std::shared_ptr<controller_manager_msgs::srv::SwitchController::Response> response)
+void ControllerManager::swap_controller_service_cb(
+  const std::shared_ptr<controller_manager_msgs::srv::SwapController::Request> request,
+  std::shared_ptr<controller_manager_msgs::srv::SwapController::Response> response)
 {
   // lock services
-  RCLCPP_DEBUG(get_logger(), "switching service called");
+  RCLCPP_DEBUG(get_logger(), "swap service called");
   std::lock_guard<std::mutex> guard(services_lock_);
-  RCLCPP_DEBUG(get_logger(), "switching service locked");
+  RCLCPP_DEBUG(get_logger(), "swap service locked");
 
-  response->ok = switch_controller_cb(
-                   request->activate_controllers, request->deactivate_controllers,
-                   request->strictness, request->activate_asap, request->timeout,
+  response->ok = swap_controller(
+                   request->outgoing_controller, request->incoming_controller, request->timeout,
                    response->message) == controller_interface::return_type::OK;
 
-  RCLCPP_DEBUG(get_logger(), "switching service finished");
+  RCLCPP_DEBUG(get_logger(), "swap service finished");
+}
+
+void ControllerManager::shadow_controller_service_cb(
+  const std::shared_ptr<controller_manager_msgs::srv::ShadowController::Request> request,
+  std::shared_ptr<controller_manager_msgs::srv::ShadowController::Response> response)
+{
+  // lock services
+  RCLCPP_DEBUG(get_logger(), "shadow service called for controller '%s'", request->name.c_str());
+  std::lock_guard<std::mutex> guard(services_lock_);
+  RCLCPP_DEBUG(get_logger(), "shadow service locked");
+
+  MovingAverageStatistics::StatisticData execution_time_statistics;
+  response->ok = shadow_controller(
+                   request->name, request->cycles, request->timeout, response->message,
+                   execution_time_statistics) == controller_interface::return_type::OK;
+  response->average_execution_time = execution_time_statistics.average;
+  response->max_execution_time = execution_time_statistics.max;
+
+  RCLCPP_DEBUG(get_logger(), "shadow service finished");
 }
 
 void ControllerManager::unload_controller_service_cb(
@@ -3140,8 +5825,6 @@ void ControllerManager::list_hardware_components_srv_cb(
   std::shared_ptr<controller_manager_msgs::srv::ListHardwareComponents::Response> response)
 {
   RCLCPP_DEBUG(get_logger(), "list hardware components service called");
-  std::lock_guard<std::mutex> guard(services_lock_);
-  RCLCPP_DEBUG(get_logger(), "list hardware components service locked");
 
   auto hw_components_info = resource_manager_->get_components_status();
 
@@ -3205,8 +5888,16 @@ void ControllerManager::list_hardware_interfaces_srv_cb(
   std::shared_ptr<controller_manager_msgs::srv::ListHardwareInterfaces::Response> response)
 {
   RCLCPP_DEBUG(get_logger(), "list hardware interfaces service called");
-  std::lock_guard<std::mutex> guard(services_lock_);
-  RCLCPP_DEBUG(get_logger(), "list hardware interfaces service locked");
+
+  // the list is rebuilt only when the interfaces changed since the last call
+  const uint64_t interfaces_version = resource_manager_->get_interfaces_version();
+  std::lock_guard<std::mutex> cache_guard(list_hardware_interfaces_cache_.mutex);
+  if (list_hardware_interfaces_cache_.is_up_to_date(0, interfaces_version))
+  {
+    *response = list_hardware_interfaces_cache_.response;
+    RCLCPP_DEBUG(get_logger(), "list hardware interfaces service finished with the cached list");
+    return;
+  }
 
   auto state_interface_names = resource_manager_->state_interface_keys();
   for (const auto & state_interface_name : state_interface_names)
@@ -3228,6 +5919,7 @@ void ControllerManager::list_hardware_interfaces_srv_cb(
     hwi.data_type = resource_manager_->get_command_interface_data_type(command_interface_name);
     response->command_interfaces.push_back(hwi);
   }
+  list_hardware_interfaces_cache_.update(0, interfaces_version, *response);
 
   RCLCPP_DEBUG(get_logger(), "list hardware interfaces service finished");
 }
@@ -3266,6 +5958,103 @@ void ControllerManager::set_hardware_component_state_srv_cb(
   RCLCPP_DEBUG(get_logger(), "set hardware component state service finished");
 }
 
+void ControllerManager::set_hardware_components_state_srv_cb(
+  const std::shared_ptr<controller_manager_msgs::srv::SetHardwareComponentsState::Request> request,
+  std::shared_ptr<controller_manager_msgs::srv::SetHardwareComponentsState::Response> response)
+{
+  RCLCPP_DEBUG(get_logger(), "set hardware components state service called");
+  std::lock_guard<std::mutex> guard(services_lock_);
+  RCLCPP_DEBUG(get_logger(), "set hardware components state service locked");
+
+  rclcpp_lifecycle::State target_state(
+    request->target_state.id,
+    // the ternary operator is needed because label in State constructor cannot be an empty string
+    request->target_state.label.empty() ? "-" : request->target_state.label);
+  const auto results = resource_manager_->set_components_state(request->names, target_state);
+  const auto hw_components_info = resource_manager_->get_components_status();
+  response->ok = true;
+  response->results.reserve(request->names.size());
+  response->states.resize(request->names.size());
+  for (std::size_t i = 0; i < request->names.size(); ++i)
+  {
+    const bool ok = results[i] == hardware_interface::return_type::OK;
+    response->results.push_back(ok);
+    response->ok &= ok;
+    const auto it = hw_components_info.find(request->names[i]);
+    if (it == hw_components_info.end())
+    {
+      RCLCPP_ERROR(
+        get_logger(), "hardware component with name '%s' does not exist",
+        request->names[i].c_str());
+      continue;
+    }
+    response->states[i].id = it->second.state.id();
+    response->states[i].label = it->second.state.label();
+  }
+
+  RCLCPP_DEBUG(get_logger(), "set hardware components state service finished");
+}
+
+void ControllerManager::profile_cycles_srv_cb(
+  const std::shared_ptr<controller_manager_msgs::srv::ProfileCycles::Request> request,
+  std::shared_ptr<controller_manager_msgs::srv::ProfileCycles::Response> response)
+{
+  RCLCPP_DEBUG(get_logger(), "profile cycles service called");
+  response->ok = false;
+  // the read, update, write, command limits and switch sections, the reads and writes of the
+  // components and the controller updates, twice for the asynchronous ones ending in the cycle
+  const std::size_t sections_per_cycle =
+    2 * (5 + 2 * resource_manager_->get_components_status().size() + get_controller_names().size());
+  if (!hardware_interface::CycleProfiler::start(request->cycles, sections_per_cycle))
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "Unable to profile %u cycles, the number of cycles is 0 or another profiling is running.",
+      request->cycles);
+    return;
+  }
+  RCLCPP_INFO(get_logger(), "Profiling the next %u control cycles.", request->cycles);
+
+  const auto expected_duration = std::chrono::duration<double>(
+    static_cast<double>(request->cycles) / static_cast<double>(get_update_rate()));
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                          2 * expected_duration + std::chrono::seconds(1));
+  while (!hardware_interface::CycleProfiler::is_finished() &&
+         std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  const auto report = hardware_interface::CycleProfiler::stop();
+  RCLCPP_WARN_EXPRESSION(
+    get_logger(), report.cycles < request->cycles,
+    "Only %zu of the %u requested cycles ran before the timeout of the profiling.", report.cycles,
+    request->cycles);
+
+  response->cycles = static_cast<uint32_t>(report.cycles);
+  response->overrun_cycles = static_cast<uint32_t>(report.overrun_cycles);
+  response->cycle_mean_us = report.cycle_mean_us;
+  response->cycle_p99_us = report.cycle_p99_us;
+  response->cycle_max_us = report.cycle_max_us;
+  response->sections.reserve(report.sections.size());
+  for (const auto & section : report.sections)
+  {
+    controller_manager_msgs::msg::ProfiledSection profiled_section;
+    profiled_section.name = section.name;
+    profiled_section.count = static_cast<uint32_t>(section.count);
+    profiled_section.mean_us = section.mean_us;
+    profiled_section.p99_us = section.p99_us;
+    profiled_section.max_us = section.max_us;
+    profiled_section.critical_path_share = section.critical_path_share;
+    profiled_section.overruns = static_cast<uint32_t>(section.overruns);
+    profiled_section.overrun_share = section.overrun_share;
+    response->sections.push_back(std::move(profiled_section));
+  }
+  response->report = report.to_string();
+  response->ok = report.cycles > 0;
+  RCLCPP_INFO(get_logger(), "%s", response->report.c_str());
+}
+
 std::vector<std::string> ControllerManager::get_controller_names()
 {
   std::vector<std::string> names;
@@ -3280,41 +6069,246 @@ std::vector<std::string> ControllerManager::get_controller_names()
   return names;
 }
 
+void ControllerManager::trace_writer_loop(const std::string & output_file)
+{
+  std::ofstream output(output_file);
+  if (!output.is_open())
+  {
+    RCLCPP_ERROR(
+      get_logger(), "Unable to open the trace output file '%s', the trace is not written.",
+      output_file.c_str());
+    return;
+  }
+  // The closing bracket of the array is optional in the trace event format, so that the trace of a
+  // process that didn't stop cleanly can still be opened
+  output << "[\n";
+  std::vector<hardware_interface::TraceEvent> events;
+  bool stop = false;
+  while (!stop)
+  {
+    {
+      std::unique_lock<std::mutex> lock(trace_writer_mutex_);
+      stop = trace_writer_cv_.wait_for(
+        lock, std::chrono::milliseconds(100), [this]() { return trace_writer_stop_; });
+    }
+    events.clear();
+    hardware_interface::TraceRecorder::drain(events);
+    hardware_interface::TraceRecorder::write_chrome_trace_events(output, events);
+    output.flush();
+  }
+  const auto dropped_events = hardware_interface::TraceRecorder::get_dropped_events();
+  RCLCPP_WARN_EXPRESSION(
+    get_logger(), dropped_events > 0,
+    "%zu trace events were dropped because the ring buffers were full. Increase the "
+    "'tracing.events_per_thread' parameter to record all of them.",
+    static_cast<std::size_t>(dropped_events));
+}
+
+void ControllerManager::stop_trace_writer()
+{
+  if (!trace_writer_thread_.joinable())
+  {
+    return;
+  }
+  hardware_interface::TraceRecorder::disable();
+  {
+    std::lock_guard<std::mutex> lock(trace_writer_mutex_);
+    trace_writer_stop_ = true;
+  }
+  trace_writer_cv_.notify_all();
+  trace_writer_thread_.join();
+}
+
+void ControllerManager::overrun_forensics_writer_loop(
+  const std::string & directory, int64_t max_files)
+{
+  std::vector<hardware_interface::TraceEvent> events;
+  int64_t written_files = 0;
+  bool stop = false;
+  while (!stop)
+  {
+    {
+      std::unique_lock<std::mutex> lock(overrun_forensics_writer_mutex_);
+      stop = overrun_forensics_writer_cv_.wait_for(
+        lock, std::chrono::milliseconds(100), [this]() { return overrun_forensics_writer_stop_; });
+    }
+    events.clear();
+    // taking the events allows the control loop to freeze the next overrun
+    if (hardware_interface::CycleTraceRing::take_frozen_events(events) == 0)
+    {
+      continue;
+    }
+    if (written_files >= max_files)
+    {
+      RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 10000,
+        "Overrun of the control loop, its cycles are not written as %ld files were already "
+        "written (%lu overruns frozen so far).",
+        max_files,
+        static_cast<unsigned long>(hardware_interface::CycleTraceRing::get_number_of_freezes()));
+      continue;
+    }
+    const std::string output_file = directory + "/" + std::string(get_name()) + "_overrun_" +
+                                    std::to_string(written_files++) + ".json";
+    std::ofstream output(output_file);
+    if (!output.is_open())
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Unable to open the file '%s', the cycles of the overrun are not written.",
+        output_file.c_str());
+      continue;
+    }
+    output << "[\n";
+    hardware_interface::TraceRecorder::write_chrome_trace_events(output, events);
+    RCLCPP_WARN(
+      get_logger(), "Overrun of the control loop, wrote its last %ld cycles to '%s'.",
+      params_->overrun_forensics.cycles, output_file.c_str());
+  }
+  const auto skipped_freezes = hardware_interface::CycleTraceRing::get_skipped_freezes();
+  RCLCPP_WARN_EXPRESSION(
+    get_logger(), skipped_freezes > 0,
+    "The cycles of %zu overruns were not frozen because they occurred while the cycles of a "
+    "previous overrun were being written.",
+    static_cast<std::size_t>(skipped_freezes));
+}
+
+void ControllerManager::stop_overrun_forensics_writer()
+{
+  if (!overrun_forensics_writer_thread_.joinable())
+  {
+    return;
+  }
+  hardware_interface::CycleTraceRing::disable();
+  {
+    std::lock_guard<std::mutex> lock(overrun_forensics_writer_mutex_);
+    overrun_forensics_writer_stop_ = true;
+  }
+  overrun_forensics_writer_cv_.notify_all();
+  overrun_forensics_writer_thread_.join();
+}
+
+void ControllerManager::introspection_sink_writer_loop(const std::string & output_file)
+{
+  std::ofstream output(output_file, std::ios::binary | std::ios::trunc);
+  if (!output.is_open())
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "Unable to open the introspection output file '%s', the introspection variables are not "
+      "written.",
+      output_file.c_str());
+    return;
+  }
+  hardware_interface::IntrospectionRecording::write_file_header(output);
+  hardware_interface::IntrospectionRecording recording;
+  uint32_t written_schema_version = 0;
+  bool stop = false;
+  while (!stop)
+  {
+    {
+      std::unique_lock<std::mutex> lock(introspection_sink_writer_mutex_);
+      stop = introspection_sink_writer_cv_.wait_for(
+        lock, std::chrono::milliseconds(100),
+        [this]() { return introspection_sink_writer_stop_; });
+    }
+    recording.segments.clear();
+    hardware_interface::IntrospectionSink::drain(recording);
+    recording.write_segments(output, written_schema_version);
+    output.flush();
+  }
+  const auto dropped_samples = hardware_interface::IntrospectionSink::get_dropped_samples();
+  RCLCPP_WARN_EXPRESSION(
+    get_logger(), dropped_samples > 0,
+    "%zu samples of the introspection variables were dropped because the ring buffer was full or "
+    "a variable was being registered. Increase the 'introspection_sink.capacity' parameter to "
+    "record more of them.",
+    static_cast<std::size_t>(dropped_samples));
+}
+
+void ControllerManager::stop_introspection_sink_writer()
+{
+  if (!introspection_sink_writer_thread_.joinable())
+  {
+    return;
+  }
+  hardware_interface::IntrospectionSink::disable();
+  {
+    std::lock_guard<std::mutex> lock(introspection_sink_writer_mutex_);
+    introspection_sink_writer_stop_ = true;
+  }
+  introspection_sink_writer_cv_.notify_all();
+  introspection_sink_writer_thread_.join();
+}
+
+void ControllerManager::begin_cycle(const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  auto & cycle = cycle_context_;
+  // the previous cycle overran if its write finished after its deadline
+  cycle.overrun = cycle.index > 0 && last_cycle_end_ns_ > cycle.deadline_ns;
+  cycle.trigger_time = get_clock()->started() ? get_trigger_clock()->now() : time;
+  // the trigger clock is either the clock of the node or the steady clock
+  cycle.ros_time = trigger_clock_ == get_clock() ? cycle.trigger_time : this->now();
+  cycle.monotonic_ns = cycle.trigger_time.get_clock_type() == RCL_STEADY_TIME
+                         ? cycle.trigger_time.nanoseconds()
+                         : hardware_interface::TraceRecorder::now();
+  cycle.period = period;
+  cycle.deadline_ns = cycle.monotonic_ns + 1'000'000'000 / static_cast<int64_t>(update_rate_);
+  ++cycle.index;
+  cycle_open_ = true;
+  cycle_updated_ = false;
+}
+
+const hardware_interface::CycleContext & ControllerManager::get_cycle_context() const
+{
+  return cycle_context_;
+}
+
 void ControllerManager::read(const rclcpp::Time & time, const rclcpp::Duration & period)
 {
+  begin_cycle(time, period);
   periodicity_stats_.add_measurement(1.0 / period.seconds());
-  const auto start_time = std::chrono::steady_clock::now();
-  auto [result, failed_hardware_names] = resource_manager_->read(time, period);
+  if (
+    hardware_interface::CycleProfiler::is_recording() ||
+    hardware_interface::CycleTraceRing::is_enabled())
+  {
+    cycle_begin_ns_ = hardware_interface::TraceRecorder::now();
+  }
+  hardware_interface::TraceScope trace_scope(trace_ids_.read);
+  const auto start_time = InstrumentationClock::now();
+  // The tracking is enabled for the thread running the real-time loop
+  hardware_interface::AllocationTracker::set_tracking_enabled(params_->allocation_tracking.enable);
+  const uint64_t allocations_before = hardware_interface::AllocationTracker::get_allocation_count();
+  const auto & [result, failed_hardware_names] = resource_manager_->read(cycle_context_);
 
   if (result != hardware_interface::return_type::OK)
   {
     rt_buffer_.deactivate_controllers_list.clear();
     // Determine controllers to stop
-    for (const auto & hardware_name : failed_hardware_names)
-    {
-      auto controllers = resource_manager_->get_cached_controllers_to_hardware(hardware_name);
-      rt_buffer_.deactivate_controllers_list.insert(
-        rt_buffer_.deactivate_controllers_list.end(), controllers.begin(), controllers.end());
-    }
-    RCLCPP_ERROR(
+    add_controllers_of_failed_components(
+      *resource_manager_, failed_hardware_names, false, rt_buffer_.deactivate_controllers_list);
+    RT_LOG_ERROR(
       get_logger(),
       "Deactivating following hardware components as their read cycle resulted in an error: [ %s]",
       rt_buffer_.get_concatenated_string(failed_hardware_names).c_str());
-    RCLCPP_ERROR_EXPRESSION(
+    RT_LOG_ERROR_EXPRESSION(
       get_logger(), !rt_buffer_.deactivate_controllers_list.empty(),
       "Deactivating following controllers as their hardware components read cycle resulted in an "
       "error: [ %s]",
       rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list).c_str());
     std::vector<ControllerSpec> & rt_controller_list =
       rt_controllers_wrapper_.update_and_get_used_by_rt_list();
+    flag_controllers_deactivated_by_hardware_error(
+      rt_controller_list, rt_buffer_.deactivate_controllers_list);
     perform_hardware_command_mode_change(
       rt_controller_list, {}, rt_buffer_.deactivate_controllers_list, "read");
     deactivate_controllers(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+    request_activity_publish();
     // TODO(destogl): do auto-start of broadcasters
   }
   execution_time_.read_time =
-    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
-      .count();
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - start_time).count();
+  allocations_.read_allocations = static_cast<unsigned int>(
+    hardware_interface::AllocationTracker::get_allocation_count() - allocations_before);
 }
 
 void ControllerManager::manage_switch()
@@ -3322,65 +6316,322 @@ void ControllerManager::manage_switch()
   std::unique_lock<std::mutex> guard(switch_params_.mutex, std::try_to_lock);
   if (!guard.owns_lock())
   {
-    RCLCPP_DEBUG(get_logger(), "Unable to lock switch mutex. Retrying in next cycle.");
+    RT_LOG_DEBUG(get_logger(), "Unable to lock switch mutex. Retrying in next cycle.");
     return;
   }
-  const auto start_time = std::chrono::steady_clock::now();
+  // the request might have been withdrawn after a timeout, before the mutex was acquired
+  if (!switch_params_.do_switch)
+  {
+    return;
+  }
+  if (params_->numa_placement.enable)
+  {
+    realtime_numa_node_.store(
+      hardware_interface::NumaMemory::get_current_node(), std::memory_order_relaxed);
+  }
+  perform_switch();
+  switch_params_.responses.push(SwitchResponse::SWITCH_FINISHED);
+  switch_params_.cv.notify_all();
+}
+
+void ControllerManager::perform_switch()
+{
+  hardware_interface::TraceScope trace_scope(trace_ids_.switch_controllers);
+  const auto start_time = InstrumentationClock::now();
   // Ask hardware interfaces to change mode
   if (!resource_manager_->perform_command_mode_switch(
         switch_params_.activate_command_interface_request,
         switch_params_.deactivate_command_interface_request))
   {
-    RCLCPP_ERROR(get_logger(), "Error while performing mode switch.");
+    RT_LOG_ERROR(get_logger(), "Error while performing mode switch.");
     // If the hardware switching fails, there is no point in continuing to switch controllers
     switch_params_.do_switch = false;
-    switch_params_.cv.notify_all();
     return;
   }
   execution_time_.switch_perform_mode_time =
-    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
-      .count();
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - start_time).count();
 
   std::vector<ControllerSpec> & rt_controller_list =
     rt_controllers_wrapper_.update_and_get_used_by_rt_list();
 
-  const auto deact_start_time = std::chrono::steady_clock::now();
-  deactivate_controllers(rt_controller_list, switch_params_.deactivate_request);
+  // the command interfaces of a swapped controller are handed over instead of being released
+  auto * handed_over_command_interfaces = switch_params_.swap_incoming_controller.empty()
+                                            ? nullptr
+                                            : &rt_buffer_.handed_over_command_interfaces;
+  const auto deact_start_time = InstrumentationClock::now();
+  deactivate_controllers(
+    rt_controller_list, switch_params_.deactivate_request, handed_over_command_interfaces);
   execution_time_.deactivation_time =
-    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - deact_start_time)
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - deact_start_time)
       .count();
 
-  const auto chain_start_time = std::chrono::steady_clock::now();
+  const auto chain_start_time = InstrumentationClock::now();
   switch_chained_mode(switch_params_.to_chained_mode_request, true);
   switch_chained_mode(switch_params_.from_chained_mode_request, false);
-  RCLCPP_DEBUG(
+  RT_LOG_DEBUG(
     get_logger(),
     "Switching  %lu controllers to chained mode and %lu controllers from chained mode",
     switch_params_.to_chained_mode_request.size(), switch_params_.from_chained_mode_request.size());
   execution_time_.switch_chained_mode_time =
-    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - chain_start_time)
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - chain_start_time)
       .count();
 
   // activate controllers once the switch is fully complete
-  const auto act_start_time = std::chrono::steady_clock::now();
+  const auto act_start_time = InstrumentationClock::now();
   activate_controllers(
-    rt_controller_list, switch_params_.activate_request, switch_params_.strictness);
+    rt_controller_list, switch_params_.activate_request, switch_params_.strictness,
+    handed_over_command_interfaces);
+  if (handed_over_command_interfaces)
+  {
+    perform_controller_handover(rt_controller_list);
+    // releases the command interfaces the incoming controller doesn't use
+    handed_over_command_interfaces->clear();
+  }
   execution_time_.activation_time =
-    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - act_start_time)
-      .count();
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - act_start_time).count();
 
   // All controllers switched --> switching done
   switch_params_.do_switch = false;
-  switch_params_.cv.notify_all();
   execution_time_.switch_time =
-    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
-      .count();
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - start_time).count();
+}
+
+void ControllerManager::perform_controller_handover(
+  const std::vector<ControllerSpec> & rt_controller_list)
+{
+  const auto outgoing_it = std::find_if(
+    rt_controller_list.begin(), rt_controller_list.end(),
+    std::bind(
+      controller_name_compare, std::placeholders::_1, switch_params_.swap_outgoing_controller));
+  const auto incoming_it = std::find_if(
+    rt_controller_list.begin(), rt_controller_list.end(),
+    std::bind(
+      controller_name_compare, std::placeholders::_1, switch_params_.swap_incoming_controller));
+  if (outgoing_it == rt_controller_list.end() || incoming_it == rt_controller_list.end())
+  {
+    return;
+  }
+  if (!is_controller_active(*incoming_it->c))
+  {
+    RT_LOG_ERROR(
+      get_logger(),
+      "Controller '%s' failed to replace controller '%s' in the swap, their command interfaces "
+      "are released.",
+      incoming_it->info.name.c_str(), outgoing_it->info.name.c_str());
+    return;
+  }
+  try
+  {
+    if (incoming_it->c->on_handover(*outgoing_it->c) != controller_interface::return_type::OK)
+    {
+      RT_LOG_WARN(
+        get_logger(), "Controller '%s' failed to take over the state of controller '%s'",
+        incoming_it->info.name.c_str(), outgoing_it->info.name.c_str());
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "Caught exception of type : %s while controller '%s' took over the state of controller "
+      "'%s': %s",
+      typeid(e).name(), incoming_it->info.name.c_str(), outgoing_it->info.name.c_str(), e.what());
+    params_->handle_exceptions ? void() : throw;
+  }
+}
+
+void ControllerManager::update_shadowed_controllers(
+  std::vector<ControllerSpec> & rt_controller_list, const rclcpp::Time & time,
+  const rclcpp::Duration & period)
+{
+  for (const auto & entry : rt_controllers_wrapper_.get_realtime_table(rt_controller_list))
+  {
+    auto & shadow_mode = *entry.shadow_mode;
+    if (shadow_mode.remaining_cycles.load(std::memory_order_relaxed) <= 0)
+    {
+      continue;
+    }
+    auto & controller = rt_controller_list[entry.spec_index];
+    // the non real-time thread releases the interfaces only once no shadow update runs
+    shadow_mode.updating.store(true);
+    if (shadow_mode.remaining_cycles.load() > 0)
+    {
+      const bool first_update_cycle =
+        (*controller.last_update_cycle_time ==
+         rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type()));
+      const auto controller_ret = update_controller(controller, period, time, first_update_cycle);
+      if (controller_ret != controller_interface::return_type::OK)
+      {
+        // a failed shadow update ends the shadow mode, the controller is not active
+        shadow_mode.result.store(controller_ret);
+        shadow_mode.remaining_cycles.store(0);
+      }
+      else
+      {
+        shadow_mode.remaining_cycles.fetch_sub(1);
+      }
+    }
+    shadow_mode.updating.store(false);
+  }
+}
+
+void ControllerManager::move_realtime_memory_to_numa_node(
+  const std::vector<ControllerSpec> & controllers)
+{
+  const int node = realtime_numa_node_.load(std::memory_order_relaxed);
+  if (node < 0)
+  {
+    return;
+  }
+  // the hardware memory is moved before the real-time loop accesses it, when it is allocated or
+  // the components are activated
+  resource_manager_->set_realtime_numa_node(node);
+
+  // the real-time loop still uses the other list, and doesn't update the controllers activated by
+  // the switch yet
+  std::vector<hardware_interface::NumaMemoryRange> ranges;
+  ranges.push_back({controllers.data(), controllers.size() * sizeof(ControllerSpec)});
+  for (const auto & controller : controllers)
+  {
+    if (!ros2_control::has_item(switch_params_.activate_request, controller.info.name))
+    {
+      continue;
+    }
+    // the internal allocations of the controller are not known, only its base object is moved
+    ranges.push_back({controller.c.get(), sizeof(controller_interface::ControllerInterfaceBase)});
+    ranges.push_back({controller.execution_time_statistics.get(), sizeof(MovingAverageStatistics)});
+    ranges.push_back({controller.periodicity_statistics.get(), sizeof(MovingAverageStatistics)});
+    ranges.push_back({controller.last_update_cycle_time.get(), sizeof(rclcpp::Time)});
+  }
+  const std::size_t controller_pages = hardware_interface::NumaMemory::move_to_node(ranges, node);
+  RCLCPP_DEBUG(
+    get_logger(),
+    "Placed %zu pages of the activated controllers on the NUMA node %d of the real-time loop.",
+    controller_pages, node);
+}
+
+controller_interface::return_type ControllerManager::update_controller(
+  ControllerSpec & controller, const rclcpp::Duration & period, const rclcpp::Time & current_time,
+  bool first_update_cycle)
+{
+  auto controller_ret = controller_interface::return_type::OK;
+  hardware_interface::TraceScope trace_scope(controller.update_trace_id);
+  const uint64_t allocations_before = hardware_interface::AllocationTracker::get_allocation_count();
+  // Catch exceptions thrown by the controller update function
+  try
+  {
+    const auto trigger_result = controller.c->trigger_update(cycle_context_, period);
+    const bool trigger_status = trigger_result.successful;
+    controller_ret = trigger_result.result;
+    if (trigger_status && trigger_result.execution_time.has_value())
+    {
+      const double execution_time_us =
+        static_cast<double>(trigger_result.execution_time.value().count()) / 1.e3;
+      controller.execution_time_statistics->add_measurement(execution_time_us);
+      if (trigger_result.thread_times.has_value())
+      {
+        const auto & thread_times = trigger_result.thread_times.value();
+        controller.cpu_time_statistics->add_measurement(
+          static_cast<double>(thread_times.cpu_time.count()) / 1.e3);
+        controller.preempted_time_statistics->add_measurement(
+          static_cast<double>(
+            thread_times.get_preempted_time(trigger_result.execution_time.value()).count()) /
+          1.e3);
+        *controller.update_voluntary_context_switches =
+          static_cast<unsigned int>(thread_times.voluntary_context_switches);
+        *controller.update_involuntary_context_switches =
+          static_cast<unsigned int>(thread_times.involuntary_context_switches);
+      }
+      if (trigger_result.performance_counters.has_value())
+      {
+        controller.performance_counters_statistics->add_measurement(
+          trigger_result.performance_counters.value());
+      }
+      // the budget of the asynchronous controllers is not checked, their update doesn't delay
+      // the loop
+      if (!controller.c->is_async() && controller.time_budget->check(execution_time_us))
+      {
+        RCLCPP_WARN_THROTTLE(
+          get_logger(), *get_clock(), 1000,
+          "The update of controller '%s' took %.1f us and exceeded its time budget of %.1f us "
+          "(%u overruns).",
+          controller.info.name.c_str(), execution_time_us, controller.time_budget->budget_us,
+          controller.time_budget->overruns);
+        if (controller.time_budget->policy == hardware_interface::TimeBudgetPolicy::ERROR)
+        {
+          controller_ret = controller_interface::return_type::ERROR;
+        }
+      }
+    }
+    if (!first_update_cycle && trigger_status && trigger_result.period.has_value())
+    {
+      controller.periodicity_statistics->add_measurement(
+        1.0 / trigger_result.period.value().seconds());
+    }
+    // the frames are exchanged even if the asynchronous update is still running
+    if (trigger_result.stage_time.has_value())
+    {
+      controller.stage_time_statistics->add_measurement(
+        static_cast<double>(trigger_result.stage_time.value().count()) / 1.e3);
+    }
+    if (trigger_result.command_latency.has_value())
+    {
+      controller.command_latency_statistics->add_measurement(
+        static_cast<double>(trigger_result.command_latency.value().nanoseconds()) / 1.e3);
+    }
+    if (trigger_result.parallel_time.has_value())
+    {
+      controller.parallel_time_statistics->add_measurement(
+        static_cast<double>(trigger_result.parallel_time.value().count()) / 1.e3);
+      controller.parallel_task_time_statistics->add_measurement(
+        static_cast<double>(trigger_result.parallel_task_time.value().count()) / 1.e3);
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RT_LOG_ERROR(
+      get_logger(), "Caught exception of type : %s while updating controller '%s': %s",
+      typeid(e).name(), controller.info.name.c_str(), e.what());
+    params_->handle_exceptions ? void() : throw;
+    controller_ret = controller_interface::return_type::ERROR;
+  }
+  catch (...)
+  {
+    RT_LOG_ERROR(
+      get_logger(), "Caught unknown exception while updating controller '%s'",
+      controller.info.name.c_str());
+    params_->handle_exceptions ? void() : throw;
+    controller_ret = controller_interface::return_type::ERROR;
+  }
+
+  *controller.last_update_cycle_time = current_time;
+
+  const auto allocations = static_cast<unsigned int>(
+    hardware_interface::AllocationTracker::get_allocation_count() - allocations_before);
+  *controller.update_allocations = allocations;
+  if (allocations > 0 && params_->allocation_tracking.on_allocation_in_update != "none")
+  {
+    if (params_->allocation_tracking.on_allocation_in_update == "abort")
+    {
+      RCLCPP_FATAL(
+        get_logger(), "Controller '%s' allocated memory %u times in its update, aborting.",
+        controller.info.name.c_str(), allocations);
+      std::abort();
+    }
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000,
+      "Controller '%s' allocated memory %u times in its update, this is not real-time safe.",
+      controller.info.name.c_str(), allocations);
+  }
+  return controller_ret;
 }
 
 controller_interface::return_type ControllerManager::update(
   const rclcpp::Time & time, const rclcpp::Duration & period)
 {
-  const auto start_time = std::chrono::steady_clock::now();
+  hardware_interface::TraceScope trace_scope(trace_ids_.update);
+  const auto start_time = InstrumentationClock::now();
+  const uint64_t allocations_before = hardware_interface::AllocationTracker::get_allocation_count();
   execution_time_.switch_time = 0.0;
   execution_time_.switch_chained_mode_time = 0.0;
   execution_time_.activation_time = 0.0;
@@ -3388,6 +6639,13 @@ controller_interface::return_type ControllerManager::update(
   execution_time_.switch_perform_mode_time = 0.0;
   std::vector<ControllerSpec> & rt_controller_list =
     rt_controllers_wrapper_.update_and_get_used_by_rt_list();
+  const std::vector<RealtimeControllerEntry> & rt_controller_table =
+    rt_controllers_wrapper_.get_realtime_table(rt_controller_list);
+  if (!cycle_open_ || cycle_updated_)
+  {
+    begin_cycle(time, period);
+  }
+  cycle_updated_ = true;
 
   auto ret = controller_interface::return_type::OK;
   ++update_loop_counter_;
@@ -3413,162 +6671,165 @@ controller_interface::return_type ControllerManager::update(
   }
 
   rt_buffer_.deactivate_controllers_list.clear();
-  for (const auto & loaded_controller : rt_controller_list)
+  rt_buffer_.scheduled_updates.clear();
+  rt_buffer_.scheduled_chain_groups.clear();
+  const auto handle_controller_update_result =
+    [this, &ret](
+      const ControllerSpec & controller, const controller_interface::return_type controller_ret)
+  {
+    if (controller_ret != controller_interface::return_type::OK)
+    {
+      const std::vector<std::string> & controller_chain = controller.controllers_chain_group;
+      for (const auto & chained_controller : controller_chain)
+      {
+        ros2_control::add_item(rt_buffer_.deactivate_controllers_list, chained_controller);
+      }
+      ret = controller_ret;
+    }
+  };
+  // the entries are scanned for the controllers to update, their specs are only accessed for the
+  // controllers updated in this cycle
+  for (const auto & entry : rt_controller_table)
   {
+    auto & loaded_controller = rt_controller_list[entry.spec_index];
     if (
       switch_params_.do_switch && !switch_params_.activate_asap &&
-      switch_params_.skip_cycle(loaded_controller))
+      switch_params_.skip_cycle(entry.controller_id))
     {
-      RCLCPP_DEBUG(
+      RT_LOG_DEBUG(
         get_logger(), "Skipping update for controller '%s' as it is being switched",
         loaded_controller.info.name.c_str());
       continue;
     }
-    if (is_controller_active(*loaded_controller.c))
+    if (is_controller_active(*entry.controller))
     {
       if (
-        switch_params_.do_switch && loaded_controller.c->is_async() &&
-        std::find(
-          switch_params_.deactivate_request.begin(), switch_params_.deactivate_request.end(),
-          loaded_controller.info.name) != switch_params_.deactivate_request.end())
+        switch_params_.do_switch && entry.controller->is_async() &&
+        switch_params_.has_switch_flag(entry.controller_id, SwitchParams::DEACTIVATE))
       {
-        RCLCPP_DEBUG(
+        RT_LOG_DEBUG(
           get_logger(), "Skipping update for async controller '%s' as it is being deactivated",
           loaded_controller.info.name.c_str());
         continue;
       }
-      const auto controller_update_rate = loaded_controller.c->get_update_rate();
+      const auto controller_update_rate = entry.controller->get_update_rate();
       const bool run_controller_at_cm_rate = (controller_update_rate >= update_rate_);
       const auto controller_period =
         run_controller_at_cm_rate ? period
                                   : rclcpp::Duration::from_seconds((1.0 / controller_update_rate));
 
       const bool first_update_cycle =
-        (*loaded_controller.last_update_cycle_time ==
+        (*entry.last_update_cycle_time ==
          rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type()));
-      const rclcpp::Time current_time = get_clock()->started() ? get_trigger_clock()->now() : time;
+      const rclcpp::Time & current_time = cycle_context_.trigger_time;
       const auto controller_actual_period =
         first_update_cycle ? controller_period
-                           : (current_time - *loaded_controller.last_update_cycle_time);
-
-      const double error_now =
-        std::abs((controller_actual_period.seconds() * controller_update_rate) - 1.0);
-      const double error_if_skipped = std::abs(
-        ((controller_actual_period.seconds() + (1.0 / static_cast<double>(update_rate_))) *
-         controller_update_rate) -
-        1.0);
-      const bool controller_go =
+                           : (current_time - *entry.last_update_cycle_time);
+
+      bool controller_go =
         run_controller_at_cm_rate ||
-        (time == rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type())) ||
-        (error_now <= error_if_skipped) || first_update_cycle;
+        (time == rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type()));
+      auto & rate_divider = *entry.rate_divider;
+      if (!controller_go && rate_divider.is_divisible())
+      {
+        // the update loop counter wraps at the update rate, which is a multiple of every divider
+        controller_go = rate_divider.is_due(update_loop_counter_);
+      }
+      else if (!controller_go)
+      {
+        // rates not dividing the update rate are scheduled by comparing the elapsed time
+        const double error_now =
+          std::abs((controller_actual_period.seconds() * controller_update_rate) - 1.0);
+        const double error_if_skipped = std::abs(
+          ((controller_actual_period.seconds() + (1.0 / static_cast<double>(update_rate_))) *
+           controller_update_rate) -
+          1.0);
+        controller_go = (error_now <= error_if_skipped) || first_update_cycle;
+      }
+
+      if (controller_go && entry.time_budget->consume_skip())
+      {
+        RT_LOG_DEBUG(
+          get_logger(), "Skipping update for controller '%s' as it exceeded its time budget",
+          loaded_controller.info.name.c_str());
+        controller_go = false;
+      }
+      if (
+        controller_go && !overload_governor_.is_due() &&
+        loaded_controller.criticality == hardware_interface::Criticality::AUXILIARY)
+      {
+        RT_LOG_DEBUG(
+          get_logger(), "Skipping update for controller '%s' as the loop is overloaded",
+          loaded_controller.info.name.c_str());
+        controller_go = false;
+      }
 
-      RCLCPP_DEBUG(
-        get_logger(), "update_loop_counter: '%d ' controller_go: '%s ' controller_name: '%s '",
-        update_loop_counter_, controller_go ? "True" : "False",
-        loaded_controller.info.name.c_str());
+      RT_LOG_DEBUG_EXPRESSION(
+        get_logger(), controller_go, "update_loop_counter: '%d ' controller_name: '%s '",
+        update_loop_counter_, loaded_controller.info.name.c_str());
 
       if (controller_go)
       {
-        auto controller_ret = controller_interface::return_type::OK;
-        bool trigger_status = true;
-        // Catch exceptions thrown by the controller update function
-        try
-        {
-          const auto trigger_result =
-            loaded_controller.c->trigger_update(this->now(), controller_actual_period);
-          trigger_status = trigger_result.successful;
-          controller_ret = trigger_result.result;
-          if (trigger_status && trigger_result.execution_time.has_value())
-          {
-            loaded_controller.execution_time_statistics->add_measurement(
-              static_cast<double>(trigger_result.execution_time.value().count()) / 1.e3);
-          }
-          if (!first_update_cycle && trigger_status && trigger_result.period.has_value())
-          {
-            loaded_controller.periodicity_statistics->add_measurement(
-              1.0 / trigger_result.period.value().seconds());
-          }
-        }
-        catch (const std::exception & e)
-        {
-          RCLCPP_ERROR(
-            get_logger(), "Caught exception of type : %s while updating controller '%s': %s",
-            typeid(e).name(), loaded_controller.info.name.c_str(), e.what());
-          params_->handle_exceptions ? void() : throw;
-          controller_ret = controller_interface::return_type::ERROR;
-        }
-        catch (...)
+        if (update_worker_pool_)
         {
-          RCLCPP_ERROR(
-            get_logger(), "Caught unknown exception while updating controller '%s'",
-            loaded_controller.info.name.c_str());
-          params_->handle_exceptions ? void() : throw;
-          controller_ret = controller_interface::return_type::ERROR;
+          // The update is deferred to be run with the other controllers of its chain group
+          ScheduledControllerUpdate scheduled_update;
+          scheduled_update.controller_index = entry.spec_index;
+          scheduled_update.chain_group_id = entry.chain_group_id;
+          scheduled_update.period = controller_actual_period;
+          scheduled_update.current_time = current_time;
+          scheduled_update.first_update_cycle = first_update_cycle;
+          rt_buffer_.scheduled_updates.push_back(scheduled_update);
+          ros2_control::add_item(rt_buffer_.scheduled_chain_groups, entry.chain_group_id);
         }
-
-        *loaded_controller.last_update_cycle_time = current_time;
-
-        if (controller_ret != controller_interface::return_type::OK)
+        else
         {
-          const std::vector<std::string> & controller_chain =
-            loaded_controller.controllers_chain_group;
-          RCLCPP_INFO_EXPRESSION(
-            get_logger(), controller_chain.size() > 1,
-            "Controller '%s' is part of a chain of %lu controllers that will be deactivated.",
-            loaded_controller.info.name.c_str(), controller_chain.size());
-          for (const auto & chained_controller : controller_chain)
-          {
-            ros2_control::add_item(rt_buffer_.deactivate_controllers_list, chained_controller);
-          }
-          ret = controller_ret;
+          const auto controller_ret = update_controller(
+            loaded_controller, controller_actual_period, current_time, first_update_cycle);
+          handle_controller_update_result(loaded_controller, controller_ret);
         }
       }
     }
   }
-  if (!rt_buffer_.deactivate_controllers_list.empty())
+  if (update_worker_pool_ && !rt_buffer_.scheduled_updates.empty())
   {
-    rt_buffer_.fallback_controllers_list.clear();
-    rt_buffer_.activate_controllers_using_interfaces_list.clear();
-
-    for (const auto & failed_ctrl : rt_buffer_.deactivate_controllers_list)
-    {
-      auto ctrl_it = std::find_if(
-        rt_controller_list.begin(), rt_controller_list.end(),
-        std::bind(controller_name_compare, std::placeholders::_1, failed_ctrl));
-      if (ctrl_it != rt_controller_list.end())
+    // Each task updates one chain group in the order of the controllers list, which respects the
+    // chaining order. Different chain groups don't share any chained interfaces.
+    update_worker_pool_->parallel_for(
+      rt_buffer_.scheduled_chain_groups.size(),
+      [this, &rt_controller_list](std::size_t group_index)
       {
-        for (const auto & fallback_controller : ctrl_it->info.fallback_controllers_names)
+        const std::size_t chain_group_id = rt_buffer_.scheduled_chain_groups[group_index];
+        for (auto & scheduled_update : rt_buffer_.scheduled_updates)
         {
-          ros2_control::add_item(rt_buffer_.fallback_controllers_list, fallback_controller);
-          get_active_controllers_using_command_interfaces_of_controller(
-            fallback_controller, rt_controller_list,
-            rt_buffer_.activate_controllers_using_interfaces_list, resource_manager_);
+          if (scheduled_update.chain_group_id == chain_group_id)
+          {
+            scheduled_update.result = update_controller(
+              rt_controller_list[scheduled_update.controller_index], scheduled_update.period,
+              scheduled_update.current_time, scheduled_update.first_update_cycle);
+          }
         }
-      }
+      });
+    // Process the results sequentially in the order of the controllers list
+    for (const auto & scheduled_update : rt_buffer_.scheduled_updates)
+    {
+      handle_controller_update_result(
+        rt_controller_list[scheduled_update.controller_index], scheduled_update.result);
     }
-
-    RCLCPP_ERROR(
-      get_logger(), "Deactivating controllers : [ %s] as their update resulted in an error!",
-      rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list).c_str());
-    RCLCPP_ERROR_EXPRESSION(
-      get_logger(), !rt_buffer_.activate_controllers_using_interfaces_list.empty(),
-      "Deactivating controllers : [ %s] using the command interfaces needed for the fallback "
-      "controllers to activate.",
-      rt_buffer_.get_concatenated_string(rt_buffer_.activate_controllers_using_interfaces_list)
-        .c_str());
-    RCLCPP_ERROR_EXPRESSION(
-      get_logger(), !rt_buffer_.fallback_controllers_list.empty(),
-      "Activating fallback controllers : [ %s]",
-      rt_buffer_.get_concatenated_string(rt_buffer_.fallback_controllers_list).c_str());
-    for (const std::string & controller : rt_buffer_.activate_controllers_using_interfaces_list)
+  }
+  // the joined asynchronous updates ran in parallel with the other controllers, their commands
+  // are committed before the command limits and the write
+  for (const auto & entry : rt_controller_table)
+  {
+    if (entry.controller->is_async_update_joined() && is_controller_active(*entry.controller))
     {
-      ros2_control::add_item(rt_buffer_.deactivate_controllers_list, controller);
-    };
-
-    // Retrieve the interfaces to start and stop from the hardware end
-    perform_hardware_command_mode_change(
-      rt_controller_list, rt_buffer_.fallback_controllers_list,
-      rt_buffer_.deactivate_controllers_list, "update");
+      entry.controller->join_async_update();
+    }
+  }
+  update_shadowed_controllers(rt_controller_list, cycle_context_.trigger_time, period);
+  if (!rt_buffer_.deactivate_controllers_list.empty())
+  {
+    perform_fault_cascade(rt_controller_list);
     deactivate_controllers(rt_controller_list, rt_buffer_.deactivate_controllers_list);
     if (!rt_buffer_.fallback_controllers_list.empty())
     {
@@ -3577,53 +6838,81 @@ controller_interface::return_type ControllerManager::update(
         controller_manager_msgs::srv::SwitchController::Request::STRICT);
     }
     // To publish the activity of the failing controllers and the fallback controllers
-    publish_activity();
+    request_activity_publish();
+  }
+  {
+    hardware_interface::TraceScope limits_trace_scope(trace_ids_.enforce_command_limits);
+    resource_manager_->enforce_command_limits(period);
   }
-  resource_manager_->enforce_command_limits(period);
 
   // there are controllers to (de)activate
   if (switch_params_.do_switch)
   {
     if (switch_params_.activate_asap)
     {
-      manage_switch();
+      // a committed switch waits for its commit time
+      if (time.nanoseconds() >= switch_params_.commit_time_ns)
+      {
+        manage_switch();
+      }
     }
-    else
+    else if (!switch_params_.ready_to_switch_sent)
     {
-      switch_params_.ready_to_switch.store(true, std::memory_order_release);
+      // acknowledge the request once, the requesting thread then performs the switch
+      std::unique_lock<std::mutex> guard(switch_params_.mutex, std::try_to_lock);
+      if (guard.owns_lock() && switch_params_.do_switch)
+      {
+        switch_params_.ready_to_switch_sent =
+          switch_params_.responses.push(SwitchResponse::READY_TO_SWITCH);
+        switch_params_.cv.notify_all();
+      }
     }
   }
 
-  PUBLISH_ROS2_CONTROL_INTROSPECTION_DATA_ASYNC(hardware_interface::DEFAULT_REGISTRY_KEY);
+  if (
+    update_loop_counter_ % introspection_publish_divider_.load(std::memory_order_relaxed) == 0 &&
+    ros_interfaces_initialized_.load(std::memory_order_relaxed))
+  {
+    PUBLISH_ROS2_CONTROL_INTROSPECTION_DATA_ASYNC(hardware_interface::DEFAULT_REGISTRY_KEY);
+  }
+  if (
+    update_loop_counter_ % introspection_sink_sample_divider_.load(std::memory_order_relaxed) == 0)
+  {
+    hardware_interface::IntrospectionSink::sample(time.nanoseconds());
+  }
 
   execution_time_.update_time =
-    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
-      .count();
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - start_time).count();
+  allocations_.update_allocations = static_cast<unsigned int>(
+    hardware_interface::AllocationTracker::get_allocation_count() - allocations_before);
 
   return ret;
 }
 
 void ControllerManager::write(const rclcpp::Time & time, const rclcpp::Duration & period)
 {
-  const auto start_time = std::chrono::steady_clock::now();
-  auto [result, failed_hardware_names] = resource_manager_->write(time, period);
+  // the section ends before the cycle, so that it's profiled in its own cycle
+  std::optional<hardware_interface::TraceScope> trace_scope(std::in_place, trace_ids_.write);
+  const auto start_time = InstrumentationClock::now();
+  const uint64_t allocations_before = hardware_interface::AllocationTracker::get_allocation_count();
+  if (!cycle_open_)
+  {
+    begin_cycle(time, period);
+  }
+  const auto & [result, failed_hardware_names] = resource_manager_->write(cycle_context_);
 
   if (result == hardware_interface::return_type::ERROR)
   {
     rt_buffer_.deactivate_controllers_list.clear();
     // Determine controllers to stop
-    for (const auto & hardware_name : failed_hardware_names)
-    {
-      auto controllers = resource_manager_->get_cached_controllers_to_hardware(hardware_name);
-      rt_buffer_.deactivate_controllers_list.insert(
-        rt_buffer_.deactivate_controllers_list.end(), controllers.begin(), controllers.end());
-    }
-    RCLCPP_ERROR(
+    add_controllers_of_failed_components(
+      *resource_manager_, failed_hardware_names, false, rt_buffer_.deactivate_controllers_list);
+    RT_LOG_ERROR(
       get_logger(),
       "Deactivating following hardware components as their write cycle resulted in an error: [ "
       "%s]",
       rt_buffer_.get_concatenated_string(failed_hardware_names).c_str());
-    RCLCPP_ERROR_EXPRESSION(
+    RT_LOG_ERROR_EXPRESSION(
       get_logger(), !rt_buffer_.deactivate_controllers_list.empty(),
       "Deactivating following controllers as their hardware components write cycle resulted in an "
       "error: [ %s]",
@@ -3631,45 +6920,22 @@ void ControllerManager::write(const rclcpp::Time & time, const rclcpp::Duration
     std::vector<ControllerSpec> & rt_controller_list =
       rt_controllers_wrapper_.update_and_get_used_by_rt_list();
 
+    flag_controllers_deactivated_by_hardware_error(
+      rt_controller_list, rt_buffer_.deactivate_controllers_list);
     perform_hardware_command_mode_change(
       rt_controller_list, {}, rt_buffer_.deactivate_controllers_list, "write");
     deactivate_controllers(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+    request_activity_publish();
     // TODO(destogl): do auto-start of broadcasters
   }
   else if (result == hardware_interface::return_type::DEACTIVATE)
   {
     rt_buffer_.deactivate_controllers_list.clear();
-    auto loaded_controllers = get_loaded_controllers();
-    // Only stop controllers with active command interfaces to the failed_hardware_names
-    for (const auto & hardware_name : failed_hardware_names)
-    {
-      auto controllers = resource_manager_->get_cached_controllers_to_hardware(hardware_name);
-      for (const auto & controller : controllers)
-      {
-        auto controller_spec = std::find_if(
-          loaded_controllers.begin(), loaded_controllers.end(),
-          [&](const controller_manager::ControllerSpec & spec)
-          { return spec.c->get_name() == controller; });
-        if (controller_spec == loaded_controllers.end())
-        {
-          RCLCPP_WARN(
-            get_logger(),
-            "Deactivate failed to find controller [%s] in loaded controllers. "
-            "This can happen due to multiple returns of 'DEACTIVATE' from [%s] write()",
-            controller.c_str(), hardware_name.c_str());
-          continue;
-        }
-        std::vector<std::string> command_interface_names;
-        extract_command_interfaces_for_controller(
-          *controller_spec, resource_manager_, command_interface_names);
-        // if this controller has command interfaces add it to the deactivate_controllers_list
-        if (!command_interface_names.empty())
-        {
-          rt_buffer_.deactivate_controllers_list.push_back(controller);
-        }
-      }
-    }
-    RCLCPP_ERROR_EXPRESSION(
+    // Only stop the controllers with command interfaces to the failed_hardware_names, the cache is
+    // kept up to date by the switches and the unloads of the controllers
+    add_controllers_of_failed_components(
+      *resource_manager_, failed_hardware_names, true, rt_buffer_.deactivate_controllers_list);
+    RT_LOG_ERROR_EXPRESSION(
       get_logger(), !rt_buffer_.deactivate_controllers_list.empty(),
       "Deactivating controllers [%s] as their command interfaces are tied to DEACTIVATEing "
       "hardware components",
@@ -3680,13 +6946,65 @@ void ControllerManager::write(const rclcpp::Time & time, const rclcpp::Duration
     perform_hardware_command_mode_change(
       rt_controller_list, {}, rt_buffer_.deactivate_controllers_list, "write");
     deactivate_controllers(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+    request_activity_publish();
   }
   execution_time_.write_time =
-    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
-      .count();
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - start_time).count();
+  allocations_.write_allocations = static_cast<unsigned int>(
+    hardware_interface::AllocationTracker::get_allocation_count() - allocations_before);
   execution_time_.total_time =
     execution_time_.write_time + execution_time_.update_time + execution_time_.read_time;
   const double expected_cycle_time = 1.e6 / static_cast<double>(get_update_rate());
+  if (
+    params_->overload_governor.enable &&
+    overload_governor_.add_cycle(execution_time_.total_time, expected_cycle_time))
+  {
+    const uint32_t decimation = overload_governor_.get_decimation();
+    resource_manager_->set_auxiliary_decimation(decimation);
+    auxiliary_decimation_.store(decimation, std::memory_order_relaxed);
+    overload_governor_changes_.fetch_add(1u, std::memory_order_relaxed);
+    if (decimation == hardware_interface::OverloadGovernor::PAUSED)
+    {
+      RT_LOG_WARN(
+        get_logger(),
+        "The control loop is overloaded, the auxiliary controllers and hardware components are "
+        "paused.");
+    }
+    else if (decimation > 1u)
+    {
+      RT_LOG_WARN(
+        get_logger(),
+        "The control loop is overloaded, the auxiliary controllers and hardware components only "
+        "run every %u cycles.",
+        decimation);
+    }
+    else
+    {
+      RT_LOG_INFO(
+        get_logger(),
+        "The control loop has headroom again, the auxiliary controllers and hardware components "
+        "run at their rate.");
+    }
+    request_activity_publish();
+  }
+  trace_scope.reset();
+  const int64_t cycle_end_ns = hardware_interface::TraceRecorder::now();
+  last_cycle_end_ns_ = cycle_end_ns;
+  cycle_open_ = false;
+  const auto cycle_period_ns = static_cast<int64_t>(1.e3 * expected_cycle_time);
+  hardware_interface::CycleProfiler::end_cycle(cycle_begin_ns_, cycle_end_ns, cycle_period_ns);
+  if (hardware_interface::CycleTraceRing::is_enabled())
+  {
+    hardware_interface::CycleTraceRing::end_cycle(trace_ids_.cycle, cycle_begin_ns_, cycle_end_ns);
+    const int64_t threshold_ns =
+      params_->overrun_forensics.threshold_us > 0.0
+        ? static_cast<int64_t>(1.e3 * params_->overrun_forensics.threshold_us)
+        : cycle_period_ns;
+    if (cycle_end_ns - cycle_begin_ns_ > threshold_ns)
+    {
+      hardware_interface::CycleTraceRing::freeze();
+    }
+  }
   if (params_->overruns.print_warnings && execution_time_.total_time > expected_cycle_time)
   {
     if (execution_time_.switch_time > 0.0)
@@ -3714,14 +7032,97 @@ void ControllerManager::write(const rclcpp::Time & time, const rclcpp::Duration
     }
   }
 
-  PUBLISH_ROS2_CONTROL_INTROSPECTION_DATA_ASYNC(hardware_interface::CM_STATISTICS_KEY);
+  if (
+    update_loop_counter_ % statistics_publish_divider_.load(std::memory_order_relaxed) == 0 &&
+    ros_interfaces_initialized_.load(std::memory_order_relaxed))
+  {
+    PUBLISH_ROS2_CONTROL_INTROSPECTION_DATA_ASYNC(hardware_interface::CM_STATISTICS_KEY);
+  }
+}
+
+void ControllerManager::configure_introspection(const controller_manager::Params & params)
+{
+  auto get_divider = [this](const std::string & parameter_name, int64_t rate) -> uint32_t
+  {
+    hardware_interface::RateDivider divider;
+    divider.configure(update_rate_, static_cast<unsigned int>(rate));
+    if (divider.is_divisible())
+    {
+      return divider.get_divider();
+    }
+    // the closest rate dividing the update rate
+    uint32_t closest_divider = 1u;
+    for (uint32_t candidate = 1u; candidate <= update_rate_; ++candidate)
+    {
+      if (
+        update_rate_ % candidate == 0u &&
+        std::abs(static_cast<double>(update_rate_) / candidate - static_cast<double>(rate)) <
+          std::abs(static_cast<double>(update_rate_) / closest_divider - static_cast<double>(rate)))
+      {
+        closest_divider = candidate;
+      }
+    }
+    RCLCPP_WARN(
+      get_logger(),
+      "The rate %ld Hz of '%s' doesn't divide the update rate %u Hz, using %u Hz instead.",
+      static_cast<long>(rate), parameter_name.c_str(), update_rate_,
+      update_rate_ / closest_divider);
+    return closest_divider;
+  };
+  introspection_publish_divider_.store(
+    get_divider("introspection.publish_rate", params.introspection.publish_rate),
+    std::memory_order_relaxed);
+  statistics_publish_divider_.store(
+    get_divider(
+      "introspection.statistics_publish_rate", params.introspection.statistics_publish_rate),
+    std::memory_order_relaxed);
+  introspection_sink_sample_divider_.store(
+    get_divider("introspection_sink.sample_rate", params.introspection_sink.sample_rate),
+    std::memory_order_relaxed);
+  hardware_interface::IntrospectionSink::set_excluded_prefixes(
+    params.introspection_sink.excluded_prefixes);
+  if (resource_manager_)
+  {
+    resource_manager_->set_introspected_interfaces(params.introspection.interfaces);
+  }
+}
+
+rclcpp::Time ControllerManager::step(const rclcpp::Time & time, std::size_t number_of_cycles)
+{
+  const rclcpp::Duration period(std::chrono::nanoseconds(1'000'000'000 / get_update_rate()));
+  rclcpp::Time cycle_time = time;
+  for (std::size_t i = 0; i < number_of_cycles; ++i)
+  {
+    read(cycle_time, period);
+    update(cycle_time, period);
+    write(cycle_time, period);
+    cycle_time += period;
+  }
+  return cycle_time;
 }
 
 std::vector<ControllerSpec> &
 ControllerManager::RTControllerListWrapper::update_and_get_used_by_rt_list()
 {
-  used_by_realtime_controllers_index_ = updated_controllers_index_;
-  return controllers_lists_[used_by_realtime_controllers_index_];
+  std::vector<ControllerSpec> * updated_list = updated_controllers_list_.load();
+  const std::vector<ControllerSpec> * former_list = nullptr;
+  while (true)
+  {
+    former_list = used_by_realtime_controllers_list_.exchange(updated_list);
+    // a list switched in between may have been released before this thread announced it
+    std::vector<ControllerSpec> * current_list = updated_controllers_list_.load();
+    if (current_list == updated_list)
+    {
+      break;
+    }
+    updated_list = current_list;
+  }
+  if (former_list != updated_list)
+  {
+    // wake up the threads waiting for the former list to be released
+    rt_list_cv_.notify_all();
+  }
+  return *updated_list;
 }
 
 std::vector<ControllerSpec> & ControllerManager::RTControllerListWrapper::get_unused_list(
@@ -3732,12 +7133,13 @@ std::vector<ControllerSpec> & ControllerManager::RTControllerListWrapper::get_un
     throw std::runtime_error("controllers_lock_ not owned by thread");
   }
   controllers_lock_.unlock();
-  // Get the index to the outdated controller list
-  int free_controllers_list = get_other_list(updated_controllers_index_);
+  // Get the outdated controller list
+  std::vector<ControllerSpec> * free_controllers_list =
+    get_other_list(updated_controllers_list_.load());
 
   // Wait until the outdated controller list is not being used by the realtime thread
   wait_until_rt_not_using(free_controllers_list);
-  return controllers_lists_[free_controllers_list];
+  return *free_controllers_list;
 }
 
 const std::vector<ControllerSpec> & ControllerManager::RTControllerListWrapper::get_updated_list(
@@ -3748,7 +7150,7 @@ const std::vector<ControllerSpec> & ControllerManager::RTControllerListWrapper::
     throw std::runtime_error("controllers_lock_ not owned by thread");
   }
   controllers_lock_.unlock();
-  return controllers_lists_[updated_controllers_index_];
+  return *updated_controllers_list_.load();
 }
 
 void ControllerManager::RTControllerListWrapper::switch_updated_list(
@@ -3759,9 +7161,18 @@ void ControllerManager::RTControllerListWrapper::switch_updated_list(
     throw std::runtime_error("controllers_lock_ not owned by thread");
   }
   controllers_lock_.unlock();
-  int former_current_controllers_list_ = updated_controllers_index_;
-  updated_controllers_index_ = get_other_list(former_current_controllers_list_);
-  wait_until_rt_not_using(former_current_controllers_list_);
+  std::vector<ControllerSpec> * former_current_controllers_list =
+    updated_controllers_list_.load();
+  std::vector<ControllerSpec> * new_controllers_list =
+    get_other_list(former_current_controllers_list);
+  // the real-time thread doesn't use the new list yet
+  update_realtime_table(*new_controllers_list);
+  updated_controllers_list_.store(new_controllers_list);
+  if (on_list_updated_callback_)
+  {
+    on_list_updated_callback_();
+  }
+  wait_until_rt_not_using(former_current_controllers_list);
   if (on_switch_callback_)
   {
     on_switch_callback_();
@@ -3775,21 +7186,61 @@ void ControllerManager::RTControllerListWrapper::set_on_switch_callback(
   on_switch_callback_ = callback;
 }
 
-int ControllerManager::RTControllerListWrapper::get_other_list(int index) const
+void ControllerManager::RTControllerListWrapper::set_on_list_updated_callback(
+  std::function<void()> callback)
+{
+  std::lock_guard<controllers_lock_type> guard(controllers_lock_);
+  on_list_updated_callback_ = callback;
+}
+
+const std::vector<RealtimeControllerEntry> &
+ControllerManager::RTControllerListWrapper::get_realtime_table(
+  const std::vector<ControllerSpec> & list) const
+{
+  return &list == &controllers_lists_[0] ? realtime_tables_[0] : realtime_tables_[1];
+}
+
+void ControllerManager::RTControllerListWrapper::update_realtime_table(
+  const std::vector<ControllerSpec> & list)
+{
+  auto & table = &list == &controllers_lists_[0] ? realtime_tables_[0] : realtime_tables_[1];
+  table.clear();
+  table.reserve(list.size());
+  for (std::size_t i = 0; i < list.size(); ++i)
+  {
+    const auto & spec = list[i];
+    RealtimeControllerEntry entry;
+    entry.controller = spec.c.get();
+    entry.rate_divider = spec.rate_divider.get();
+    entry.time_budget = spec.time_budget.get();
+    entry.last_update_cycle_time = spec.last_update_cycle_time.get();
+    entry.shadow_mode = spec.shadow_mode.get();
+    entry.spec_index = i;
+    entry.controller_id = spec.id;
+    entry.chain_group_id = spec.controllers_chain_group_id;
+    table.push_back(entry);
+  }
+}
+
+std::vector<ControllerSpec> * ControllerManager::RTControllerListWrapper::get_other_list(
+  const std::vector<ControllerSpec> * list)
 {
-  return (index + 1) % 2;
+  return list == &controllers_lists_[0] ? &controllers_lists_[1] : &controllers_lists_[0];
 }
 
 void ControllerManager::RTControllerListWrapper::wait_until_rt_not_using(
-  int index, std::chrono::microseconds sleep_period) const
+  const std::vector<ControllerSpec> * list, std::chrono::microseconds max_wait_period) const
 {
-  while (used_by_realtime_controllers_index_ == index)
+  std::unique_lock<std::mutex> lock(rt_list_mutex_);
+  while (used_by_realtime_controllers_list_.load() == list)
   {
     if (!rclcpp::ok())
     {
       throw std::runtime_error("rclcpp interrupted");
     }
-    std::this_thread::sleep_for(sleep_period);
+    // the real-time thread doesn't lock the mutex when notifying, the timeout bounds the wait in
+    // case the notification is sent between the check and the wait
+    rt_list_cv_.wait_for(lock, max_wait_period);
   }
 }
 
@@ -3802,6 +7253,57 @@ std::pair<std::string, std::string> ControllerManager::split_command_interface(
   return {prefix, interface_type};
 }
 
+ControllerManager::ControllersActivity ControllerManager::get_controllers_activity() const
+{
+  if (switch_params_.do_switch)
+  {
+    return ControllersActivity::COMMANDING;
+  }
+  return controllers_activity_.load(std::memory_order_relaxed);
+}
+
+void ControllerManager::notify_control_loop()
+{
+  {
+    std::lock_guard<std::mutex> guard(control_loop_notification_mutex_);
+    control_loop_notified_ = true;
+  }
+  control_loop_notification_cv_.notify_all();
+}
+
+bool ControllerManager::wait_for_control_loop_notification(
+  std::chrono::steady_clock::time_point wake_up_time)
+{
+  std::unique_lock<std::mutex> guard(control_loop_notification_mutex_);
+  const bool notified = control_loop_notification_cv_.wait_until(
+    guard, wake_up_time, [this] { return control_loop_notified_; });
+  control_loop_notified_ = false;
+  return notified;
+}
+
+void ControllerManager::update_controllers_activity(const std::vector<ControllerSpec> & controllers)
+{
+  ControllersActivity activity = ControllersActivity::NO_ACTIVE_CONTROLLERS;
+  for (const auto & controller : controllers)
+  {
+    if (!is_controller_active(controller.c))
+    {
+      continue;
+    }
+    activity = ControllersActivity::STATE_ONLY;
+    const auto command_interfaces_config = controller.c->command_interface_configuration();
+    if (
+      command_interfaces_config.type == controller_interface::interface_configuration_type::ALL ||
+      (command_interfaces_config.type != controller_interface::interface_configuration_type::NONE &&
+       !command_interfaces_config.names.empty()))
+    {
+      activity = ControllersActivity::COMMANDING;
+      break;
+    }
+  }
+  controllers_activity_.store(activity, std::memory_order_relaxed);
+}
+
 unsigned int ControllerManager::get_update_rate() const { return update_rate_; }
 
 rclcpp::Clock::SharedPtr ControllerManager::get_trigger_clock() const { return trigger_clock_; }
@@ -3834,6 +7336,114 @@ void ControllerManager::perform_hardware_command_mode_change(
   }
 }
 
+void ControllerManager::perform_fault_cascade(
+  const std::vector<ControllerSpec> & rt_controller_list)
+{
+  rt_buffer_.fallback_controllers_list.clear();
+  rt_buffer_.activate_controllers_using_interfaces_list.clear();
+  rt_buffer_.interfaces_to_start.clear();
+  rt_buffer_.interfaces_to_stop.clear();
+
+  const auto find_controller = [&rt_controller_list](const std::string & controller_name)
+  {
+    return std::find_if(
+      rt_controller_list.begin(), rt_controller_list.end(),
+      std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+  };
+  for (const auto & failed_ctrl : rt_buffer_.deactivate_controllers_list)
+  {
+    const auto ctrl_it = find_controller(failed_ctrl);
+    if (ctrl_it == rt_controller_list.end())
+    {
+      continue;
+    }
+    for (const auto index : ctrl_it->fault_plan->fallback_controllers)
+    {
+      ros2_control::add_item(
+        rt_buffer_.fallback_controllers_list, rt_controller_list[index].info.name);
+    }
+    for (const auto index : ctrl_it->fault_plan->conflicting_controllers)
+    {
+      if (is_controller_active(rt_controller_list[index].c))
+      {
+        ros2_control::add_item(
+          rt_buffer_.activate_controllers_using_interfaces_list,
+          rt_controller_list[index].info.name);
+      }
+    }
+  }
+
+  auto & message = rt_buffer_.concatenated_string;
+  message.clear();
+  message.append("Deactivating controllers : [ ");
+  rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list, false);
+  message.append("] as their update resulted in an error!");
+  if (!rt_buffer_.activate_controllers_using_interfaces_list.empty())
+  {
+    message.append(" Deactivating controllers : [ ");
+    rt_buffer_.get_concatenated_string(
+      rt_buffer_.activate_controllers_using_interfaces_list, false);
+    message.append("] using the command interfaces needed for the fallback controllers to "
+                   "activate.");
+  }
+  if (!rt_buffer_.fallback_controllers_list.empty())
+  {
+    message.append(" Activating fallback controllers : [ ");
+    rt_buffer_.get_concatenated_string(rt_buffer_.fallback_controllers_list, false);
+    message.append("]");
+  }
+  for (const std::string & controller : rt_buffer_.activate_controllers_using_interfaces_list)
+  {
+    ros2_control::add_item(rt_buffer_.deactivate_controllers_list, controller);
+  }
+
+  // Retrieve the interfaces to start and stop from the hardware end, resolved in the fault plans
+  const auto add_command_interfaces =
+    [&](const std::vector<std::string> & controllers, std::vector<std::string> & interfaces)
+  {
+    for (const auto & controller_name : controllers)
+    {
+      const auto ctrl_it = find_controller(controller_name);
+      if (
+        ctrl_it != rt_controller_list.end() &&
+        (is_controller_active(ctrl_it->c) || is_controller_inactive(ctrl_it->c)))
+      {
+        const auto & command_interfaces = ctrl_it->fault_plan->command_interfaces;
+        interfaces.insert(interfaces.end(), command_interfaces.begin(), command_interfaces.end());
+      }
+    }
+  };
+  add_command_interfaces(rt_buffer_.deactivate_controllers_list, rt_buffer_.interfaces_to_stop);
+  add_command_interfaces(rt_buffer_.fallback_controllers_list, rt_buffer_.interfaces_to_start);
+  if (
+    (!rt_buffer_.interfaces_to_stop.empty() || !rt_buffer_.interfaces_to_start.empty()) &&
+    !(resource_manager_->prepare_command_mode_switch(
+        rt_buffer_.interfaces_to_start, rt_buffer_.interfaces_to_stop) &&
+      resource_manager_->perform_command_mode_switch(
+        rt_buffer_.interfaces_to_start, rt_buffer_.interfaces_to_stop)))
+  {
+    message.append(" Error while attempting mode switch when deactivating controllers in update "
+                   "cycle!");
+  }
+
+  // the message is logged by the activity publisher thread, requested by the caller
+  std::unique_lock<std::mutex> lock(fault_report_.mutex, std::try_to_lock);
+  if (
+    lock.owns_lock() &&
+    fault_report_.message.size() + message.size() + 1 <= fault_report_.message.capacity())
+  {
+    if (!fault_report_.message.empty())
+    {
+      fault_report_.message.append("\n");
+    }
+    fault_report_.message.append(message);
+  }
+  else
+  {
+    fault_report_.dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
 void ControllerManager::propagate_deactivation_of_chained_mode(
   const std::vector<ControllerSpec> & controllers)
 {
@@ -4129,6 +7739,14 @@ ControllerManager::check_fallback_controllers_state_pre_activation(
   const std::vector<ControllerSpec> & controllers, const ControllersListIterator controller_it,
   std::string & message)
 {
+  if (!controller_it->fault_plan->invalid_reason.empty())
+  {
+    message = fmt::format(
+      FMT_COMPILE("Controller with name '{}' cannot be activated, as {}!"),
+      controller_it->info.name, controller_it->fault_plan->invalid_reason);
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  }
   for (const auto & fb_ctrl : controller_it->info.fallback_controllers_names)
   {
     auto fb_ctrl_it = std::find_if(
@@ -4289,6 +7907,8 @@ void ControllerManager::publish_activity()
 {
   controller_manager_msgs::msg::ControllerManagerActivity status_msg;
   status_msg.header.stamp = get_clock()->now();
+  status_msg.auxiliary_decimation = auxiliary_decimation_.load(std::memory_order_relaxed);
+  std::set<std::string> claimed_interfaces;
   {
     // lock controllers
     std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
@@ -4302,6 +7922,15 @@ void ControllerManager::publish_activity()
       lifecycle_info.state.id = controller.c->get_lifecycle_state().id();
       lifecycle_info.state.label = controller.c->get_lifecycle_state().label();
       status_msg.controllers.push_back(lifecycle_info);
+      claimed_interfaces.insert(
+        controller.info.claimed_interfaces.begin(), controller.info.claimed_interfaces.end());
+      if (
+        status_msg.auxiliary_decimation != 1u &&
+        controller.criticality == hardware_interface::Criticality::AUXILIARY &&
+        is_controller_active(controller.c))
+      {
+        status_msg.shed_controllers.push_back(controller.info.name);
+      }
     }
   }
   {
@@ -4313,22 +7942,149 @@ void ControllerManager::publish_activity()
       lifecycle_info.state.id = component_info.state.id();
       lifecycle_info.state.label = component_info.state.label();
       status_msg.hardware_components.push_back(lifecycle_info);
+      if (
+        status_msg.auxiliary_decimation != 1u &&
+        component_info.criticality == hardware_interface::Criticality::AUXILIARY &&
+        component_info.state.id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+      {
+        status_msg.shed_hardware_components.push_back(component_name);
+      }
+    }
+  }
+
+  controller_manager_msgs::msg::ControllerManagerActivityChanges changes_msg;
+  changes_msg.header = status_msg.header;
+  update_published_states(
+    status_msg.controllers, published_activity_.controllers, changes_msg.controllers,
+    changes_msg.removed_controllers);
+  update_published_states(
+    status_msg.hardware_components, published_activity_.hardware_components,
+    changes_msg.hardware_components, changes_msg.removed_hardware_components);
+  std::set_difference(
+    claimed_interfaces.begin(), claimed_interfaces.end(),
+    published_activity_.claimed_interfaces.begin(), published_activity_.claimed_interfaces.end(),
+    std::back_inserter(changes_msg.claimed_interfaces));
+  std::set_difference(
+    published_activity_.claimed_interfaces.begin(), published_activity_.claimed_interfaces.end(),
+    claimed_interfaces.begin(), claimed_interfaces.end(),
+    std::back_inserter(changes_msg.released_interfaces));
+  published_activity_.claimed_interfaces = std::move(claimed_interfaces);
+  changes_msg.auxiliary_decimation = status_msg.auxiliary_decimation;
+  changes_msg.shed_controllers = status_msg.shed_controllers;
+  changes_msg.shed_hardware_components = status_msg.shed_hardware_components;
+  const bool changed =
+    !changes_msg.controllers.empty() || !changes_msg.removed_controllers.empty() ||
+    !changes_msg.hardware_components.empty() || !changes_msg.removed_hardware_components.empty() ||
+    !changes_msg.claimed_interfaces.empty() || !changes_msg.released_interfaces.empty() ||
+    status_msg.auxiliary_decimation != published_activity_.auxiliary_decimation;
+  published_activity_.auxiliary_decimation = status_msg.auxiliary_decimation;
+  if (changed)
+  {
+    ++published_activity_.version;
+  }
+
+  status_msg.version = published_activity_.version;
+  controller_manager_activity_publisher_->publish(status_msg);
+  if (changed)
+  {
+    changes_msg.version = published_activity_.version;
+    controller_manager_activity_changes_publisher_->publish(changes_msg);
+  }
+}
+
+void ControllerManager::request_activity_publish() noexcept
+{
+  activity_publish_requests_.fetch_add(1, std::memory_order_release);
+}
+
+void ControllerManager::activity_publisher_loop()
+{
+  uint64_t published_requests = 0;
+  bool stop = false;
+  while (!stop)
+  {
+    {
+      // the real-time loop doesn't notify the thread, so the requests are also polled
+      std::unique_lock<std::mutex> lock(activity_publisher_mutex_);
+      activity_publisher_cv_.wait_for(
+        lock, std::chrono::milliseconds(10),
+        [this, published_requests]()
+        {
+          return activity_publisher_stop_ ||
+                 activity_publish_requests_.load(std::memory_order_acquire) != published_requests;
+        });
+      stop = activity_publisher_stop_;
     }
+    const uint64_t requests = activity_publish_requests_.load(std::memory_order_acquire);
+    if (requests != published_requests)
+    {
+      published_requests = requests;
+      try
+      {
+        publish_activity();
+      }
+      catch (const std::exception & e)
+      {
+        RCLCPP_ERROR(get_logger(), "Failed to publish the activity: %s", e.what());
+      }
+    }
+    log_fault_report();
+  }
+}
+
+void ControllerManager::log_fault_report()
+{
+  std::string message;
+  {
+    std::lock_guard<std::mutex> lock(fault_report_.mutex);
+    message = fault_report_.message;
+    fault_report_.message.clear();
+  }
+  RCLCPP_ERROR_EXPRESSION(get_logger(), !message.empty(), "%s", message.c_str());
+  const uint64_t dropped = fault_report_.dropped.exchange(0, std::memory_order_relaxed);
+  RCLCPP_ERROR_EXPRESSION(
+    get_logger(), dropped > 0,
+    "The messages of %lu fault cascades of the real-time loop were dropped.",
+    static_cast<unsigned long>(dropped));
+}
+
+void ControllerManager::stop_activity_publisher()
+{
+  if (!activity_publisher_thread_.joinable())
+  {
+    return;
   }
-  controller_manager_activity_publisher_->publish(status_msg);
+  {
+    std::lock_guard<std::mutex> lock(activity_publisher_mutex_);
+    activity_publisher_stop_ = true;
+  }
+  activity_publisher_cv_.notify_all();
+  activity_publisher_thread_.join();
 }
 
 controller_interface::return_type ControllerManager::check_for_interfaces_availability_to_activate(
   const std::vector<ControllerSpec> & controllers, const std::vector<std::string> activation_list,
   const std::vector<std::string> deactivation_list, std::string & message)
 {
-  std::vector<std::string> future_unavailable_cmd_interfaces = {};
-  std::vector<std::string> future_available_cmd_interfaces = {};
+  // the interfaces are compared as bitsets of their ids, see hardware_interface::InterfaceIdSet
+  hardware_interface::InterfaceIdSet future_unavailable_cmd_interfaces;
+  hardware_interface::InterfaceIdSet future_available_cmd_interfaces;
+  std::unordered_map<std::string, std::size_t> controller_indices;
+  controller_indices.reserve(controllers.size());
+  for (std::size_t i = 0; i < controllers.size(); ++i)
+  {
+    controller_indices.emplace(controllers[i].info.name, i);
+  }
+  const auto find_controller = [&controllers, &controller_indices](const std::string & name)
+  {
+    const auto index_it = controller_indices.find(name);
+    return index_it == controller_indices.end()
+             ? controllers.end()
+             : controllers.begin() + static_cast<std::ptrdiff_t>(index_it->second);
+  };
   for (const auto & controller_name : deactivation_list)
   {
-    auto controller_it = std::find_if(
-      controllers.begin(), controllers.end(),
-      std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+    auto controller_it = find_controller(controller_name);
     if (controller_it == controllers.end())
     {
       message = fmt::format(
@@ -4342,10 +8098,7 @@ controller_interface::return_type ControllerManager::check_for_interfaces_availa
       (cmd_itf_cfg.type == controller_interface::interface_configuration_type::INDIVIDUAL)
         ? cmd_itf_cfg.names
         : controller_it->info.claimed_interfaces;
-    for (const auto & cmd_itf : controller_cmd_interfaces)
-    {
-      future_available_cmd_interfaces.push_back(cmd_itf);
-    }
+    future_available_cmd_interfaces.insert(controller_cmd_interfaces);
   }
   for (const auto & controller_name : activation_list)
   {
@@ -4354,9 +8107,7 @@ controller_interface::return_type ControllerManager::check_for_interfaces_availa
       // skip controllers that are being deactivated and activated in the same request
       continue;
     }
-    auto controller_it = std::find_if(
-      controllers.begin(), controllers.end(),
-      std::bind(controller_name_compare, std::placeholders::_1, controller_name));
+    auto controller_it = find_controller(controller_name);
     if (controller_it == controllers.end())
     {
       message = fmt::format(
@@ -4369,6 +8120,12 @@ controller_interface::return_type ControllerManager::check_for_interfaces_availa
       get_command_interfaces_names(controller_it->c, resource_manager_);
     const auto controller_state_interfaces =
       get_state_interfaces_names(controller_it->c, resource_manager_);
+    const hardware_interface::InterfaceIdSet controller_cmd_interface_ids(
+      controller_cmd_interfaces);
+
+    // the interfaces are only looked up one by one if they conflict with the activated ones
+    const bool conflicts_with_activated_controllers =
+      future_unavailable_cmd_interfaces.intersects(controller_cmd_interface_ids);
 
     // check if the interfaces are available in the first place
     for (const auto & cmd_itf : controller_cmd_interfaces)
@@ -4385,7 +8142,7 @@ controller_interface::return_type ControllerManager::check_for_interfaces_availa
       }
       if (
         resource_manager_->command_interface_is_claimed(cmd_itf) &&
-        !ros2_control::has_item(future_available_cmd_interfaces, cmd_itf))
+        !future_available_cmd_interfaces.contains(cmd_itf))
       {
         message = fmt::format(
           FMT_COMPILE(
@@ -4395,7 +8152,9 @@ controller_interface::return_type ControllerManager::check_for_interfaces_availa
         RCLCPP_WARN(get_logger(), "%s", message.c_str());
         return controller_interface::return_type::ERROR;
       }
-      if (ros2_control::has_item(future_unavailable_cmd_interfaces, cmd_itf))
+      if (
+        conflicts_with_activated_controllers &&
+        future_unavailable_cmd_interfaces.contains(cmd_itf))
       {
         message = fmt::format(
           FMT_COMPILE(
@@ -4405,8 +8164,8 @@ controller_interface::return_type ControllerManager::check_for_interfaces_availa
         RCLCPP_WARN(get_logger(), "%s", message.c_str());
         return controller_interface::return_type::ERROR;
       }
-      future_unavailable_cmd_interfaces.push_back(cmd_itf);
     }
+    future_unavailable_cmd_interfaces.insert(controller_cmd_interface_ids);
     for (const auto & state_itf : controller_state_interfaces)
     {
       if (!resource_manager_->state_interface_is_available(state_itf))
@@ -4436,13 +8195,18 @@ void ControllerManager::controller_activity_diagnostic_callback(
       break;
     }
   }
-  // lock controllers
-  std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
-    rt_controllers_wrapper_.controllers_lock_);
-  const std::vector<ControllerSpec> & controllers = rt_controllers_wrapper_.get_updated_list(guard);
+  // the statistics are read and the strings are built from a copy of the list, so that the
+  // controllers lock needed by the switches is only held while copying it
+  std::vector<ControllerSpec> controllers;
+  {
+    std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+      rt_controllers_wrapper_.controllers_lock_);
+    controllers = rt_controllers_wrapper_.get_updated_list(guard);
+  }
   bool all_active = true;
   const std::string periodicity_suffix = ".periodicity";
   const std::string exec_time_suffix = ".execution_time";
+  const std::string percentiles_suffix = ".percentiles";
   const std::string state_suffix = ".state";
 
   if (cm_param_listener_->is_old(*params_))
@@ -4461,6 +8225,18 @@ void ControllerManager::controller_activity_diagnostic_callback(
     return oss.str();
   };
 
+  auto make_percentiles_string =
+    [](const ros2_control::LatencyPercentiles & percentiles, const std::string & measurement_unit)
+    -> std::string
+  {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << "P50: " << percentiles.p50 << ", P99: " << percentiles.p99
+        << ", P99.9: " << percentiles.p99_9 << ", P99.99: " << percentiles.p99_99 << " "
+        << measurement_unit;
+    return oss.str();
+  };
+
   // Variable to define the overall status of the controller diagnostics
   auto level = diagnostic_msgs::msg::DiagnosticStatus::OK;
 
@@ -4481,6 +8257,37 @@ void ControllerManager::controller_activity_diagnostic_callback(
       const auto exec_time_stats = controllers[i].execution_time_statistics->get_statistics();
       stat.add(
         controllers[i].info.name + exec_time_suffix, make_stats_string(exec_time_stats, "us"));
+      stat.add(
+        controllers[i].info.name + exec_time_suffix + percentiles_suffix,
+        make_percentiles_string(
+          controllers[i].execution_time_statistics->get_percentiles(), "us"));
+      if (params_->cpu_time_statistics.enable && !is_async)
+      {
+        stat.add(
+          controllers[i].info.name + ".cpu_time",
+          make_stats_string(controllers[i].cpu_time_statistics->get_statistics(), "us"));
+        stat.add(
+          controllers[i].info.name + ".preempted_time",
+          make_stats_string(controllers[i].preempted_time_statistics->get_statistics(), "us"));
+      }
+      if (is_async && controllers[i].c->uses_interface_frames())
+      {
+        stat.add(
+          controllers[i].info.name + ".stage_time",
+          make_stats_string(controllers[i].stage_time_statistics->get_statistics(), "us"));
+        stat.add(
+          controllers[i].info.name + ".command_latency",
+          make_stats_string(controllers[i].command_latency_statistics->get_statistics(), "us"));
+      }
+      if (controllers[i].parallel_time_statistics->get_count() > 0)
+      {
+        stat.add(
+          controllers[i].info.name + ".parallel_time",
+          make_stats_string(controllers[i].parallel_time_statistics->get_statistics(), "us"));
+        stat.add(
+          controllers[i].info.name + ".parallel_task_time",
+          make_stats_string(controllers[i].parallel_task_time_statistics->get_statistics(), "us"));
+      }
       const bool publish_periodicity_stats =
         is_async || (controllers[i].c->get_update_rate() != this->get_update_rate());
       if (publish_periodicity_stats)
@@ -4489,6 +8296,9 @@ void ControllerManager::controller_activity_diagnostic_callback(
           controllers[i].info.name + periodicity_suffix,
           make_stats_string(periodicity_stats, "Hz") +
             " -> Desired : " + std::to_string(controllers[i].c->get_update_rate()) + " Hz");
+        stat.add(
+          controllers[i].info.name + periodicity_suffix + percentiles_suffix,
+          make_percentiles_string(controllers[i].periodicity_statistics->get_percentiles(), "Hz"));
         const double periodicity_error = std::abs(
           periodicity_stats.average - static_cast<double>(controllers[i].c->get_update_rate()));
         if (
@@ -4640,6 +8450,18 @@ void ControllerManager::hardware_components_diagnostic_callback(
     return oss.str();
   };
 
+  auto make_percentiles_string =
+    [](const ros2_control::LatencyPercentiles & percentiles, const std::string & measurement_unit)
+    -> std::string
+  {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << "P50: " << percentiles.p50 << ", P99: " << percentiles.p99
+        << ", P99.9: " << percentiles.p99_9 << ", P99.99: " << percentiles.p99_99 << " "
+        << measurement_unit;
+    return oss.str();
+  };
+
   // Variable to define the overall status of the controller diagnostics
   auto level = diagnostic_msgs::msg::DiagnosticStatus::OK;
 
@@ -4652,7 +8474,8 @@ void ControllerManager::hardware_components_diagnostic_callback(
     if (component_info.state.id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
     {
       auto update_stats =
-        [&bad_periodicity_async_hw, &high_exec_time_hw, &stat, &make_stats_string, this](
+        [&bad_periodicity_async_hw, &high_exec_time_hw, &stat, &make_stats_string,
+         &make_percentiles_string, this](
           const std::string & comp_name, const auto & statistics,
           const std::string & statistics_type_suffix, auto & diag_level, const auto & comp_info,
           const auto & params)
@@ -4664,11 +8487,24 @@ void ControllerManager::hardware_components_diagnostic_callback(
         const bool is_async = comp_info.is_async;
         const std::string periodicity_suffix = ".periodicity";
         const std::string exec_time_suffix = ".execution_time";
+        const std::string percentiles_suffix = ".percentiles";
         const auto periodicity_stats = statistics->periodicity.get_statistics();
         const auto exec_time_stats = statistics->execution_time.get_statistics();
         stat.add(
           comp_name + statistics_type_suffix + exec_time_suffix,
           make_stats_string(exec_time_stats, "us"));
+        stat.add(
+          comp_name + statistics_type_suffix + exec_time_suffix + percentiles_suffix,
+          make_percentiles_string(statistics->execution_time.get_percentiles(), "us"));
+        if (params->cpu_time_statistics.enable)
+        {
+          stat.add(
+            comp_name + statistics_type_suffix + ".cpu_time",
+            make_stats_string(statistics->cpu_time.get_statistics(), "us"));
+          stat.add(
+            comp_name + statistics_type_suffix + ".preempted_time",
+            make_stats_string(statistics->preempted_time.get_statistics(), "us"));
+        }
         const bool publish_periodicity_stats =
           is_async || (comp_info.rw_rate != this->get_update_rate());
         if (publish_periodicity_stats)
@@ -4677,6 +8513,9 @@ void ControllerManager::hardware_components_diagnostic_callback(
             comp_name + statistics_type_suffix + periodicity_suffix,
             make_stats_string(periodicity_stats, "Hz") +
               " -> Desired : " + std::to_string(comp_info.rw_rate) + " Hz");
+          stat.add(
+            comp_name + statistics_type_suffix + periodicity_suffix + percentiles_suffix,
+            make_percentiles_string(statistics->periodicity.get_percentiles(), "Hz"));
           const double periodicity_error =
             std::abs(periodicity_stats.average - static_cast<double>(comp_info.rw_rate));
           if (
@@ -4773,13 +8612,52 @@ void ControllerManager::controller_manager_diagnostic_callback(
     periodicity_stat_name + ".standard_deviation", std::to_string(cm_stats.standard_deviation));
   stat.add(periodicity_stat_name + ".min", std::to_string(cm_stats.min));
   stat.add(periodicity_stat_name + ".max", std::to_string(cm_stats.max));
+  const auto cm_percentiles = periodicity_stats_.get_percentiles();
+  stat.add(periodicity_stat_name + ".p50", std::to_string(cm_percentiles.p50));
+  stat.add(periodicity_stat_name + ".p99", std::to_string(cm_percentiles.p99));
+  stat.add(periodicity_stat_name + ".p99_9", std::to_string(cm_percentiles.p99_9));
+  stat.add(periodicity_stat_name + ".p99_99", std::to_string(cm_percentiles.p99_99));
+  const auto jitter_stats = wake_up_jitter_stats_.get_statistics();
+  if (jitter_stats.sample_count > 0)
+  {
+    const std::string jitter_stat_name = "wake_up_jitter";
+    stat.add(jitter_stat_name + ".average", std::to_string(jitter_stats.average) + " us");
+    stat.add(jitter_stat_name + ".max", std::to_string(jitter_stats.max) + " us");
+    stat.add(
+      jitter_stat_name + ".p99_9",
+      std::to_string(wake_up_jitter_stats_.get_percentiles().p99_9) + " us");
+  }
+  uint64_t resources_try_lock_failures = last_resources_try_lock_failures_;
   if (is_resource_manager_initialized())
   {
+    const auto lock_contention_statistics = resource_manager_->get_lock_contention_statistics();
+    for (const auto & [lock_name, lock_stats] : lock_contention_statistics)
+    {
+      const std::string lock_stat_name = "locks." + lock_name;
+      stat.add(lock_stat_name + ".try_lock_failures", std::to_string(lock_stats.try_lock_failures));
+      stat.add(lock_stat_name + ".contended_locks", std::to_string(lock_stats.contended_locks));
+      stat.add(
+        lock_stat_name + ".max_wait_time",
+        std::to_string(static_cast<double>(lock_stats.max_wait_time.count()) / 1.e3) + " us");
+      stat.add(
+        lock_stat_name + ".max_hold_time",
+        std::to_string(static_cast<double>(lock_stats.max_hold_time.count()) / 1.e3) + " us");
+      if (lock_stats.last_blocking_thread != 0)
+      {
+        stat.add(
+          lock_stat_name + ".last_blocking_thread",
+          std::to_string(lock_stats.last_blocking_thread));
+      }
+      if (lock_name == "resources")
+      {
+        resources_try_lock_failures = lock_stats.try_lock_failures;
+      }
+    }
     stat.summary(diagnostic_msgs::msg::DiagnosticStatus::OK, "Controller Manager is running");
   }
   else
   {
-    if (robot_description_.empty())
+    if (robot_description_->empty())
     {
       stat.summary(
         diagnostic_msgs::msg::DiagnosticStatus::WARN, "Waiting for robot description....");
@@ -4812,80 +8690,302 @@ void ControllerManager::controller_manager_diagnostic_callback(
   {
     stat.mergeSummary(diagnostic_msgs::msg::DiagnosticStatus::WARN, diag_summary);
   }
+  // the read and the write only try to lock the resources, and skip their cycle if they are held
+  if (resources_try_lock_failures > last_resources_try_lock_failures_)
+  {
+    stat.mergeSummary(
+      diagnostic_msgs::msg::DiagnosticStatus::WARN,
+      fmt::format(
+        FMT_COMPILE("The read or write skipped {} cycles because the resources were locked"),
+        resources_try_lock_failures - last_resources_try_lock_failures_));
+  }
+  last_resources_try_lock_failures_ = resources_try_lock_failures;
+
+  if (params_->overload_governor.enable)
+  {
+    const uint32_t decimation = auxiliary_decimation_.load(std::memory_order_relaxed);
+    stat.add("overload_governor.auxiliary_decimation", std::to_string(decimation));
+    stat.add(
+      "overload_governor.changes",
+      std::to_string(overload_governor_changes_.load(std::memory_order_relaxed)));
+    if (decimation != 1u)
+    {
+      const std::string shed_summary =
+        decimation == hardware_interface::OverloadGovernor::PAUSED
+          ? "paused"
+          : fmt::format(FMT_COMPILE("only run every {} cycles"), decimation);
+      stat.mergeSummary(
+        diagnostic_msgs::msg::DiagnosticStatus::WARN,
+        "The loop is overloaded, the auxiliary controllers and components are " + shed_summary);
+    }
+  }
 }
 
-void ControllerManager::update_list_with_controller_chain(
-  const std::string & ctrl_name, std::vector<std::string>::iterator controller_iterator,
-  bool append_to_controller)
+std::string ControllerManager::export_metrics()
 {
-  auto new_ctrl_it =
-    std::find(ordered_controllers_names_.begin(), ordered_controllers_names_.end(), ctrl_name);
-  if (new_ctrl_it == ordered_controllers_names_.end())
+  using MetricType = OpenMetricsWriter::MetricType;
+  // the statistics are read from a copy of the list, like in the diagnostics, so that the
+  // controllers lock needed by the switches is only held while copying it
+  std::vector<ControllerSpec> controllers;
+  {
+    std::lock_guard<RTControllerListWrapper::controllers_lock_type> guard(
+      rt_controllers_wrapper_.controllers_lock_);
+    controllers = rt_controllers_wrapper_.get_updated_list(guard);
+  }
+
+  OpenMetricsWriter writer;
+  const auto add_statistics_samples =
+    [&writer](
+      const OpenMetricsWriter::Labels & labels,
+      const MovingAverageStatistics::StatisticData & statistics,
+      const ros2_control::LatencyPercentiles & percentiles)
+  {
+    const auto add_sample = [&writer, &labels](const char * key, const char * value, double sample)
+    {
+      OpenMetricsWriter::Labels sample_labels = labels;
+      sample_labels.emplace_back(key, value);
+      writer.add_sample(sample_labels, sample);
+    };
+    add_sample("statistic", "average", statistics.average);
+    add_sample("statistic", "min", statistics.min);
+    add_sample("statistic", "max", statistics.max);
+    add_sample("statistic", "stddev", statistics.standard_deviation);
+    add_sample("statistic", "count", static_cast<double>(statistics.sample_count));
+    add_sample("quantile", "0.5", percentiles.p50);
+    add_sample("quantile", "0.99", percentiles.p99);
+    add_sample("quantile", "0.999", percentiles.p99_9);
+    add_sample("quantile", "0.9999", percentiles.p99_99);
+  };
+
+  writer.add_family(
+    "ros2_control_controller_execution_time_microseconds", MetricType::GAUGE,
+    "Execution time of the updates of the controller");
+  for (const auto & controller : controllers)
+  {
+    add_statistics_samples(
+      {{"controller", controller.info.name}},
+      controller.execution_time_statistics->get_statistics(),
+      controller.execution_time_statistics->get_percentiles());
+  }
+  writer.add_family(
+    "ros2_control_controller_periodicity_hertz", MetricType::GAUGE,
+    "Rate of the updates of the controller");
+  for (const auto & controller : controllers)
+  {
+    add_statistics_samples(
+      {{"controller", controller.info.name}}, controller.periodicity_statistics->get_statistics(),
+      controller.periodicity_statistics->get_percentiles());
+  }
+  writer.add_family(
+    "ros2_control_controller_time_budget_overruns", MetricType::COUNTER,
+    "Updates of the controller exceeding its time budget");
+  for (const auto & controller : controllers)
   {
-    RCLCPP_DEBUG(get_logger(), "Adding controller chain : %s", ctrl_name.c_str());
+    // the counter is only incremented by the control loop and read like by the introspection
+    writer.add_sample(
+      {{"controller", controller.info.name}},
+      static_cast<double>(controller.time_budget->overruns));
+  }
 
-    auto iterator = controller_iterator;
-    for (const auto & ctrl : controller_chain_spec_[ctrl_name].following_controllers)
+  if (is_resource_manager_initialized())
+  {
+    using hardware_interface::HardwareComponentStatisticsData;
+    std::vector<std::pair<OpenMetricsWriter::Labels, const HardwareComponentStatisticsData *>>
+      cycles;
+    for (const auto & [component_name, component_info] :
+         resource_manager_->get_components_status())
     {
-      auto it =
-        std::find(ordered_controllers_names_.begin(), ordered_controllers_names_.end(), ctrl);
-      if (it != ordered_controllers_names_.end())
+      if (component_info.read_statistics)
       {
-        if (
-          std::distance(ordered_controllers_names_.begin(), it) <
-          std::distance(ordered_controllers_names_.begin(), iterator))
-        {
-          iterator = it;
-        }
+        cycles.emplace_back(
+          OpenMetricsWriter::Labels{{"component", component_name}, {"cycle", "read"}},
+          component_info.read_statistics.get());
+      }
+      if (component_info.write_statistics)
+      {
+        cycles.emplace_back(
+          OpenMetricsWriter::Labels{{"component", component_name}, {"cycle", "write"}},
+          component_info.write_statistics.get());
       }
     }
-    for (const auto & ctrl : controller_chain_spec_[ctrl_name].preceding_controllers)
+    writer.add_family(
+      "ros2_control_hardware_component_execution_time_microseconds", MetricType::GAUGE,
+      "Execution time of the reads and writes of the hardware component");
+    for (const auto & [labels, statistics] : cycles)
+    {
+      add_statistics_samples(
+        labels, statistics->execution_time.get_statistics(),
+        statistics->execution_time.get_percentiles());
+    }
+    writer.add_family(
+      "ros2_control_hardware_component_periodicity_hertz", MetricType::GAUGE,
+      "Rate of the reads and writes of the hardware component");
+    for (const auto & [labels, statistics] : cycles)
+    {
+      add_statistics_samples(
+        labels, statistics->periodicity.get_statistics(),
+        statistics->periodicity.get_percentiles());
+    }
+    writer.add_family(
+      "ros2_control_hardware_component_time_budget_overruns", MetricType::COUNTER,
+      "Reads and writes of the hardware component exceeding its time budget");
+    for (const auto & [labels, statistics] : cycles)
+    {
+      writer.add_sample(labels, static_cast<double>(statistics->time_budget_overruns));
+    }
+  }
+
+  writer.add_family(
+    "ros2_control_controller_manager_periodicity_hertz", MetricType::GAUGE,
+    "Rate of the control loop");
+  add_statistics_samples(
+    {}, periodicity_stats_.get_statistics(), periodicity_stats_.get_percentiles());
+  writer.add_family(
+    "ros2_control_controller_manager_wake_up_jitter_microseconds", MetricType::GAUGE,
+    "Delay between the planned and the actual start of the control cycles");
+  add_statistics_samples(
+    {}, wake_up_jitter_stats_.get_statistics(), wake_up_jitter_stats_.get_percentiles());
+  writer.add_family(
+    "ros2_control_controller_manager_switch_latency_microseconds", MetricType::GAUGE,
+    "Duration of the switches of the controllers, from the request to the release of the former "
+    "list of the controllers");
+  add_statistics_samples(
+    {}, switch_latency_stats_.get_statistics(), switch_latency_stats_.get_percentiles());
+  return writer.str();
+}
+
+void ControllerManager::sort_controllers_topologically(
+  const std::vector<ControllerSpec> & controllers)
+{
+  std::unordered_map<std::string, std::size_t> controller_indices;
+  controller_indices.reserve(controllers.size());
+  for (std::size_t i = 0; i < controllers.size(); ++i)
+  {
+    controller_indices.emplace(controllers[i].info.name, i);
+  }
+  const ControllerChainSpec empty_chain_spec;
+  std::vector<const ControllerChainSpec *> chain_specs(controllers.size(), &empty_chain_spec);
+  std::vector<std::size_t> in_degrees(controllers.size(), 0u);
+  for (std::size_t i = 0; i < controllers.size(); ++i)
+  {
+    const auto spec_it = controller_chain_spec_.find(controllers[i].info.name);
+    if (spec_it == controller_chain_spec_.end())
+    {
+      continue;
+    }
+    chain_specs[i] = &spec_it->second;
+    in_degrees[i] = static_cast<std::size_t>(std::count_if(
+      spec_it->second.preceding_controllers.begin(), spec_it->second.preceding_controllers.end(),
+      [&controller_indices](const std::string & name)
+      { return controller_indices.count(name) > 0; }));
+  }
+
+  // the ready controllers are taken by their hardware group, then in the order of the list
+  std::vector<std::size_t> ranks(controllers.size());
+  if (params_->update_order.group_by_hardware)
+  {
+    ranks = get_hardware_locality_ranks(controllers);
+  }
+  else
+  {
+    std::iota(ranks.begin(), ranks.end(), 0u);
+  }
+  using ReadyController = std::pair<std::size_t, std::size_t>;
+  std::priority_queue<ReadyController, std::vector<ReadyController>, std::greater<ReadyController>>
+    ready;
+  for (std::size_t i = 0; i < controllers.size(); ++i)
+  {
+    if (in_degrees[i] == 0u)
+    {
+      ready.emplace(ranks[i], i);
+    }
+  }
+  std::vector<bool> is_ordered(controllers.size(), false);
+  ordered_controllers_names_.clear();
+  ordered_controllers_names_.reserve(controllers.size());
+  while (!ready.empty())
+  {
+    const std::size_t i = ready.top().second;
+    ready.pop();
+    is_ordered[i] = true;
+    ordered_controllers_names_.push_back(controllers[i].info.name);
+    for (const auto & following_controller : chain_specs[i]->following_controllers)
     {
-      auto it =
-        std::find(ordered_controllers_names_.begin(), ordered_controllers_names_.end(), ctrl);
-      if (it != ordered_controllers_names_.end())
+      const auto following_it = controller_indices.find(following_controller);
+      if (following_it != controller_indices.end() && --in_degrees[following_it->second] == 0u)
       {
-        if (
-          std::distance(ordered_controllers_names_.begin(), it) >
-          std::distance(ordered_controllers_names_.begin(), iterator))
-        {
-          iterator = it;
-        }
+        ready.emplace(ranks[following_it->second], following_it->second);
       }
     }
+  }
 
-    if (append_to_controller)
+  if (ordered_controllers_names_.size() < controllers.size())
+  {
+    for (std::size_t i = 0; i < controllers.size(); ++i)
     {
-      ordered_controllers_names_.insert(iterator + 1, ctrl_name);
+      if (!is_ordered[i])
+      {
+        RCLCPP_WARN(
+          get_logger(),
+          "The controller '%s' is part of a cycle of chained controllers, it is updated in the "
+          "order it was loaded.",
+          controllers[i].info.name.c_str());
+        ordered_controllers_names_.push_back(controllers[i].info.name);
+      }
     }
-    else
+  }
+}
+
+std::vector<std::size_t> ControllerManager::get_hardware_locality_ranks(
+  const std::vector<ControllerSpec> & controllers) const
+{
+  // union-find of the controllers, the root of a group is its first controller
+  std::vector<std::size_t> roots(controllers.size());
+  std::iota(roots.begin(), roots.end(), 0u);
+  const auto find_root = [&roots](std::size_t i)
+  {
+    while (roots[i] != i)
     {
-      ordered_controllers_names_.insert(iterator, ctrl_name);
+      roots[i] = roots[roots[i]];
+      i = roots[i];
     }
-
-    RCLCPP_DEBUG_EXPRESSION(
-      get_logger(), !controller_chain_spec_[ctrl_name].following_controllers.empty(),
-      "\t[%s] Following controllers : %ld", ctrl_name.c_str(),
-      controller_chain_spec_[ctrl_name].following_controllers.size());
-    for (const std::string & flwg_ctrl : controller_chain_spec_[ctrl_name].following_controllers)
+    return i;
+  };
+  std::vector<std::vector<std::string>> interfaces(controllers.size());
+  for (std::size_t i = 0; i < controllers.size(); ++i)
+  {
+    if (!is_controller_unconfigured(*controllers[i].c))
     {
-      new_ctrl_it =
-        std::find(ordered_controllers_names_.begin(), ordered_controllers_names_.end(), ctrl_name);
-      RCLCPP_DEBUG(get_logger(), "\t\t[%s] : %s", ctrl_name.c_str(), flwg_ctrl.c_str());
-      update_list_with_controller_chain(flwg_ctrl, new_ctrl_it, true);
+      interfaces[i] = get_command_interfaces_names(controllers[i].c, resource_manager_);
+      const auto state_itfs = get_state_interfaces_names(controllers[i].c, resource_manager_);
+      interfaces[i].insert(interfaces[i].end(), state_itfs.begin(), state_itfs.end());
     }
-    RCLCPP_DEBUG_EXPRESSION(
-      get_logger(), !controller_chain_spec_[ctrl_name].preceding_controllers.empty(),
-      "\t[%s] Preceding controllers : %ld", ctrl_name.c_str(),
-      controller_chain_spec_[ctrl_name].preceding_controllers.size());
-    for (const std::string & preced_ctrl : controller_chain_spec_[ctrl_name].preceding_controllers)
+  }
+  // the key of an interface is the component exporting it, or its name if no component does
+  std::unordered_map<std::string, std::size_t> first_users;
+  const auto dependencies = resource_manager_->get_hardware_dependencies();
+  for (std::size_t i = 0; i < controllers.size(); ++i)
+  {
+    for (const auto & interface : interfaces[i])
     {
-      new_ctrl_it =
-        std::find(ordered_controllers_names_.begin(), ordered_controllers_names_.end(), ctrl_name);
-      RCLCPP_DEBUG(get_logger(), "\t\t[%s]: %s", ctrl_name.c_str(), preced_ctrl.c_str());
-      update_list_with_controller_chain(preced_ctrl, new_ctrl_it, false);
+      const auto owner = dependencies->find_interface_owner(interface);
+      std::string key =
+        owner ? "component " + dependencies->get_component_name(*owner) : "interface " + interface;
+      const auto [user_it, inserted] = first_users.emplace(std::move(key), i);
+      if (!inserted)
+      {
+        const std::size_t root = find_root(user_it->second);
+        const std::size_t own_root = find_root(i);
+        roots[std::max(root, own_root)] = std::min(root, own_root);
+      }
     }
   }
+  std::vector<std::size_t> ranks(controllers.size());
+  for (std::size_t i = 0; i < controllers.size(); ++i)
+  {
+    ranks[i] = find_root(i);
+  }
+  return ranks;
 }
 
 void ControllerManager::build_controllers_topology_info(
@@ -4963,14 +9063,263 @@ void ControllerManager::build_controllers_topology_info(
   }
 }
 
+std::string ControllerManager::get_controllers_topology_key(
+  const std::vector<ControllerSpec> & controllers) const
+{
+  // the update order depends on the grouping by hardware
+  std::string key = params_->update_order.group_by_hardware ? "group_by_hardware\n" : "";
+  for (const auto & controller : controllers)
+  {
+    if (is_controller_unconfigured(*controller.c))
+    {
+      key += fmt::format(
+        FMT_COMPILE("{} {} unconfigured\n"), controller.info.name, controller.info.type);
+      continue;
+    }
+    key += fmt::format(
+      "{} {} command [{}] state [{}]\n", controller.info.name, controller.info.type,
+      fmt::join(get_command_interfaces_names(controller.c, resource_manager_), " "),
+      fmt::join(get_state_interfaces_names(controller.c, resource_manager_), " "));
+  }
+  return key;
+}
+
+bool ControllerManager::restore_cached_controllers_topology(const std::string & key)
+{
+  read_controllers_topology_cache();
+  const auto topology_it =
+    controllers_topology_cache_.find(hardware_interface::HardwareInfoCache::hash(key));
+  if (topology_it == controllers_topology_cache_.end() || topology_it->second.key != key)
+  {
+    return false;
+  }
+  auto & topology = topology_it->second;
+  topology.used = true;
+  for (auto & [controller_name, spec] : controller_chain_spec_)
+  {
+    const auto spec_it = topology.chain_spec.find(controller_name);
+    spec = spec_it != topology.chain_spec.end() ? spec_it->second : ControllerChainSpec();
+  }
+  const auto restore_interfaces_cache =
+    [](const auto & cached_interfaces, auto & interfaces_cache)
+  {
+    for (auto & [controller_name, cache] : interfaces_cache)
+    {
+      const auto cached_it = cached_interfaces.find(controller_name);
+      cache = cached_it != cached_interfaces.end() ? cached_it->second
+                                                   : std::vector<std::string>();
+    }
+  };
+  restore_interfaces_cache(
+    topology.chained_reference_interfaces, controller_chained_reference_interfaces_cache_);
+  restore_interfaces_cache(
+    topology.chained_state_interfaces, controller_chained_state_interfaces_cache_);
+  ordered_controllers_names_ = topology.ordered_controllers_names;
+  RCLCPP_DEBUG(get_logger(), "Restored the topology of the controllers from the cache.");
+  return true;
+}
+
+void ControllerManager::store_cached_controllers_topology(const std::string & key)
+{
+  CachedControllersTopology topology;
+  topology.key = key;
+  for (const auto & [controller_name, spec] : controller_chain_spec_)
+  {
+    if (!spec.following_controllers.empty() || !spec.preceding_controllers.empty())
+    {
+      topology.chain_spec.emplace(controller_name, spec);
+    }
+  }
+  const auto store_interfaces_cache =
+    [](const auto & interfaces_cache, auto & cached_interfaces)
+  {
+    for (const auto & [controller_name, cache] : interfaces_cache)
+    {
+      if (!cache.empty())
+      {
+        cached_interfaces.emplace(controller_name, cache);
+      }
+    }
+  };
+  store_interfaces_cache(
+    controller_chained_reference_interfaces_cache_, topology.chained_reference_interfaces);
+  store_interfaces_cache(
+    controller_chained_state_interfaces_cache_, topology.chained_state_interfaces);
+  topology.ordered_controllers_names = ordered_controllers_names_;
+  topology.used = true;
+  controllers_topology_cache_[hardware_interface::HardwareInfoCache::hash(key)] =
+    std::move(topology);
+  write_controllers_topology_cache();
+}
+
+void ControllerManager::read_controllers_topology_cache()
+{
+  if (controllers_topology_cache_read_)
+  {
+    return;
+  }
+  controllers_topology_cache_read_ = true;
+  const auto & cache_file = params_->controllers_topology_cache_file;
+  std::ifstream file(cache_file);
+  if (!file)
+  {
+    RCLCPP_INFO(
+      get_logger(), "No controllers topology cache in '%s', it is created.", cache_file.c_str());
+    return;
+  }
+  int version = 0;
+  std::size_t count = 0;
+  std::string magic;
+  if (
+    !(file >> magic >> version >> count) || magic != "ros2_control_controllers_topology" ||
+    version != CONTROLLERS_TOPOLOGY_CACHE_VERSION)
+  {
+    RCLCPP_WARN(
+      get_logger(), "Ignoring the controllers topology cache '%s' of an unknown format.",
+      cache_file.c_str());
+    return;
+  }
+  std::unordered_map<uint64_t, CachedControllersTopology> topologies;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    uint64_t hash = 0;
+    std::size_t key_size = 0;
+    std::size_t chain_spec_count = 0;
+    CachedControllersTopology topology;
+    // the key contains white spaces, it's stored with its size on the line before
+    bool is_valid = (file >> hash >> key_size) && file.get() == '\n';
+    if (is_valid)
+    {
+      topology.key.resize(key_size);
+      is_valid = file.read(topology.key.data(), static_cast<std::streamsize>(key_size)) &&
+                 hardware_interface::HardwareInfoCache::hash(topology.key) == hash &&
+                 (file >> chain_spec_count);
+    }
+    for (std::size_t j = 0; is_valid && j < chain_spec_count; ++j)
+    {
+      std::string controller_name;
+      is_valid = static_cast<bool>(file >> controller_name);
+      if (is_valid)
+      {
+        auto & spec = topology.chain_spec[controller_name];
+        is_valid = read_names(file, spec.following_controllers) &&
+                   read_names(file, spec.preceding_controllers);
+      }
+    }
+    is_valid = is_valid && read_names_map(file, topology.chained_reference_interfaces) &&
+               read_names_map(file, topology.chained_state_interfaces) &&
+               read_names(file, topology.ordered_controllers_names);
+    if (!is_valid)
+    {
+      RCLCPP_WARN(
+        get_logger(), "Ignoring the truncated or malformed controllers topology cache '%s'.",
+        cache_file.c_str());
+      return;
+    }
+    topologies[hash] = std::move(topology);
+  }
+  controllers_topology_cache_ = std::move(topologies);
+  RCLCPP_INFO(
+    get_logger(), "Read %zu controllers topologies from the cache '%s'.",
+    controllers_topology_cache_.size(), cache_file.c_str());
+}
+
+void ControllerManager::write_controllers_topology_cache() const
+{
+  const auto & cache_file = params_->controllers_topology_cache_file;
+  // replace the cache atomically, a restart during the write still finds a complete cache
+  const std::string temporary_file = cache_file + ".tmp";
+  {
+    std::ofstream file(temporary_file, std::ios::trunc);
+    const auto used_count = std::count_if(
+      controllers_topology_cache_.begin(), controllers_topology_cache_.end(),
+      [](const auto & entry) { return entry.second.used; });
+    file << "ros2_control_controllers_topology " << CONTROLLERS_TOPOLOGY_CACHE_VERSION << ' '
+         << used_count << '\n';
+    for (const auto & [hash, topology] : controllers_topology_cache_)
+    {
+      if (!topology.used)
+      {
+        continue;
+      }
+      file << hash << ' ' << topology.key.size() << '\n' << topology.key;
+      file << topology.chain_spec.size() << '\n';
+      for (const auto & [controller_name, spec] : topology.chain_spec)
+      {
+        file << controller_name << ' ';
+        write_names(file, spec.following_controllers);
+        write_names(file, spec.preceding_controllers);
+      }
+      write_names_map(file, topology.chained_reference_interfaces);
+      write_names_map(file, topology.chained_state_interfaces);
+      write_names(file, topology.ordered_controllers_names);
+    }
+    if (!file)
+    {
+      RCLCPP_WARN(
+        get_logger(), "Failed to write the controllers topology cache '%s'.",
+        temporary_file.c_str());
+      return;
+    }
+  }
+  if (std::rename(temporary_file.c_str(), cache_file.c_str()) != 0)
+  {
+    RCLCPP_WARN(
+      get_logger(), "Failed to replace the controllers topology cache '%s'.", cache_file.c_str());
+  }
+}
+
 rclcpp::NodeOptions ControllerManager::determine_controller_node_options(
   const ControllerSpec & controller) const
 {
   rclcpp::NodeOptions controller_node_options = controller.c->define_custom_node_options();
   std::vector<std::string> node_options_arguments = controller_node_options.arguments();
 
+  // the parameters of the indexed files become overrides, so the files stay arguments if the
+  // controller has other arguments or overrides, which keep their precedence over the files then
+  std::vector<std::string> parameters_files = controller.info.parameters_files;
+  bool parameters_files_indexed = false;
+  if (
+    params_->index_controller_parameter_files && !parameters_files.empty() &&
+    node_options_arguments.empty() && controller.info.node_options_args.empty() &&
+    controller_node_options.parameter_overrides().empty())
+  {
+    const std::string node_namespace = get_namespace();
+    const std::string node_fqn =
+      (node_namespace == "/" ? "" : node_namespace) + "/" + controller.info.name;
+    std::vector<rclcpp::Parameter> parameter_overrides;
+    try
+    {
+      for (const auto & parameters_file : parameters_files)
+      {
+        const auto file_overrides =
+          parameter_overrides_index_.get_parameter_overrides(parameters_file, node_fqn);
+        parameter_overrides.insert(
+          parameter_overrides.end(), file_overrides.begin(), file_overrides.end());
+      }
+      if (use_sim_time_)
+      {
+        parameter_overrides.emplace_back("use_sim_time", true);
+      }
+      controller_node_options.parameter_overrides(parameter_overrides);
+      parameters_files.clear();
+      parameters_files_indexed = true;
+      RCLCPP_DEBUG(
+        get_logger(), "Controller '%s' gets %zu parameters from the indexed parameter files.",
+        controller.info.name.c_str(), parameter_overrides.size());
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_WARN(
+        get_logger(),
+        "Passing the parameter files of controller '%s' as node arguments, they can't be "
+        "indexed: %s",
+        controller.info.name.c_str(), e.what());
+    }
+  }
+
   // add parameter files specified in controller's info
-  for (const auto & parameters_file : controller.info.parameters_files)
+  for (const auto & parameters_file : parameters_files)
   {
     if (!ros2_control::has_item(node_options_arguments, std::string(RCL_ROS_ARGS_FLAG)))
     {
@@ -4981,7 +9330,7 @@ rclcpp::NodeOptions ControllerManager::determine_controller_node_options(
   }
 
   // ensure controller's `use_sim_time` parameter matches controller_manager's
-  if (use_sim_time_)
+  if (use_sim_time_ && !parameters_files_indexed)
   {
     if (!ros2_control::has_item(node_options_arguments, std::string(RCL_ROS_ARGS_FLAG)))
     {
@@ -5012,6 +9361,13 @@ rclcpp::NodeOptions ControllerManager::determine_controller_node_options(
 
   controller_node_options = controller_node_options.arguments(node_options_arguments);
   controller_node_options.use_global_arguments(false);
+  if (params_->lightweight_controller_nodes.enable)
+  {
+    // the parameters are still declared from the overrides, only their remote access is removed
+    controller_node_options.start_parameter_services(false);
+    controller_node_options.start_parameter_event_publisher(false);
+    controller_node_options.enable_logger_service(false);
+  }
   return controller_node_options;
 }
 
@@ -0,0 +1,375 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/controller_sandbox.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/logging.hpp"
+
+// The proxy is the hardware side of the shared-memory bridge: the state values of the claimed
+// interfaces are the "commands" of the bridge, and the commands of the sandboxed controller its
+// "states", written by the sandbox process.
+
+namespace controller_manager
+{
+namespace
+{
+/// Returns the interfaces requested by the sandboxed controller, in its order.
+std::optional<std::vector<std::string>> resolve_sandbox_interfaces(
+  const controller_interface::InterfaceConfiguration & config,
+  const std::vector<std::string> & mirrored_interfaces)
+{
+  using controller_interface::interface_configuration_type;
+  auto is_mirrored = [&mirrored_interfaces](const std::string & name)
+  {
+    return std::find(mirrored_interfaces.begin(), mirrored_interfaces.end(), name) !=
+           mirrored_interfaces.end();
+  };
+  std::vector<std::string> names;
+  switch (config.type)
+  {
+    case interface_configuration_type::ALL:
+      return mirrored_interfaces;
+    case interface_configuration_type::NONE:
+      return names;
+    case interface_configuration_type::INDIVIDUAL:
+      if (!std::all_of(config.names.begin(), config.names.end(), is_mirrored))
+      {
+        return std::nullopt;
+      }
+      return config.names;
+    case interface_configuration_type::INDIVIDUAL_BEST_EFFORT:
+      std::copy_if(
+        config.names.begin(), config.names.end(), std::back_inserter(names), is_mirrored);
+      return names;
+    default:
+      return std::nullopt;
+  }
+}
+
+/// Splits the name of an interface into its prefix and its interface name.
+std::pair<std::string, std::string> split_interface_name(const std::string & name)
+{
+  const auto separator = name.rfind('/');
+  if (separator == std::string::npos)
+  {
+    return {"", name};
+  }
+  return {name.substr(0, separator), name.substr(separator + 1)};
+}
+}  // namespace
+
+controller_interface::CallbackReturn SandboxProxyController::on_init()
+{
+  try
+  {
+    auto_declare<std::vector<std::string>>("command_interfaces", {});
+    auto_declare<std::vector<std::string>>("state_interfaces", {});
+    auto_declare<std::string>(
+      "segment_name", std::string("/ros2_control_sandbox_") + get_node()->get_name());
+    auto_declare<int>("deadline_us", 200);
+    auto_declare<int>("max_missed_deadlines", 3);
+    auto_declare<int>("connection_timeout_ms", 1000);
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(
+      get_node()->get_logger(), "Exception while declaring the parameters: %s", e.what());
+    return controller_interface::CallbackReturn::ERROR;
+  }
+  return controller_interface::CallbackReturn::SUCCESS;
+}
+
+controller_interface::InterfaceConfiguration
+SandboxProxyController::command_interface_configuration() const
+{
+  return {controller_interface::interface_configuration_type::INDIVIDUAL, command_interface_names_};
+}
+
+controller_interface::InterfaceConfiguration SandboxProxyController::state_interface_configuration()
+  const
+{
+  return {controller_interface::interface_configuration_type::INDIVIDUAL, state_interface_names_};
+}
+
+controller_interface::CallbackReturn SandboxProxyController::on_configure(
+  const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  const auto node = get_node();
+  command_interface_names_ = node->get_parameter("command_interfaces").as_string_array();
+  state_interface_names_ = node->get_parameter("state_interfaces").as_string_array();
+  segment_name_ = node->get_parameter("segment_name").as_string();
+  const auto deadline_us = node->get_parameter("deadline_us").as_int();
+  const auto max_missed_deadlines = node->get_parameter("max_missed_deadlines").as_int();
+  const auto connection_timeout_ms = node->get_parameter("connection_timeout_ms").as_int();
+  if (deadline_us <= 0 || max_missed_deadlines < 0 || connection_timeout_ms <= 0)
+  {
+    RCLCPP_ERROR(
+      node->get_logger(),
+      "The deadline and the connection timeout must be positive, and the number of missed "
+      "deadlines not negative.");
+    return controller_interface::CallbackReturn::ERROR;
+  }
+  deadline_ = std::chrono::microseconds(deadline_us);
+  max_missed_deadlines_ = static_cast<std::size_t>(max_missed_deadlines);
+  connection_timeout_ = std::chrono::milliseconds(connection_timeout_ms);
+
+  try
+  {
+    bridge_.create(segment_name_, command_interface_names_, state_interface_names_);
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(node->get_logger(), "%s", e.what());
+    return controller_interface::CallbackReturn::ERROR;
+  }
+  state_values_.assign(state_interface_names_.size(), std::numeric_limits<double>::quiet_NaN());
+  command_values_.assign(
+    command_interface_names_.size(), std::numeric_limits<double>::quiet_NaN());
+  last_command_frame_ = 0;
+  RCLCPP_INFO(
+    node->get_logger(),
+    "Created the shared-memory segment '%s' for %zu command and %zu state interfaces, waiting for "
+    "the sandbox process.",
+    segment_name_.c_str(), command_interface_names_.size(), state_interface_names_.size());
+  return controller_interface::CallbackReturn::SUCCESS;
+}
+
+controller_interface::CallbackReturn SandboxProxyController::on_activate(
+  const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  // the sandbox publishes the initial commands of its controller once it is activated
+  if (last_command_frame_ == 0)
+  {
+    bridge_.wait_for_states(last_command_frame_, connection_timeout_);
+  }
+  int64_t stamp_ns = 0;
+  if (
+    !bridge_.read_states(command_values_, last_command_frame_, stamp_ns) ||
+    last_command_frame_ == 0)
+  {
+    RCLCPP_ERROR(
+      get_node()->get_logger(),
+      "The sandbox process didn't attach to the shared-memory segment '%s' within %ld ms.",
+      segment_name_.c_str(), static_cast<long>(  // NOLINT
+        std::chrono::duration_cast<std::chrono::milliseconds>(connection_timeout_).count()));
+    return controller_interface::CallbackReturn::ERROR;
+  }
+  missed_deadlines_ = 0;
+  return controller_interface::CallbackReturn::SUCCESS;
+}
+
+controller_interface::CallbackReturn SandboxProxyController::on_cleanup(
+  const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  bridge_.close();
+  return controller_interface::CallbackReturn::SUCCESS;
+}
+
+controller_interface::return_type SandboxProxyController::update(
+  const rclcpp::Time & time, const rclcpp::Duration & /*period*/)
+{
+  for (std::size_t i = 0; i < state_interfaces_.size(); ++i)
+  {
+    // a state that cannot be accessed without blocking keeps its previous value
+    const auto value = state_interfaces_[i].get_optional(0);
+    if (value.has_value())
+    {
+      state_values_[i] = value.value();
+    }
+  }
+  if (!bridge_.write_commands(state_values_, time.nanoseconds()))
+  {
+    RCLCPP_ERROR(
+      get_node()->get_logger(), "The shared-memory segment '%s' is not active.",
+      segment_name_.c_str());
+    return controller_interface::return_type::ERROR;
+  }
+
+  const uint32_t previous_frame = last_command_frame_;
+  int64_t stamp_ns = 0;
+  bridge_.wait_for_states(previous_frame, deadline_);
+  if (
+    !bridge_.read_states(command_values_, last_command_frame_, stamp_ns) ||
+    last_command_frame_ == previous_frame)
+  {
+    // the previous commands are kept until the sandbox is considered lost
+    if (++missed_deadlines_ > max_missed_deadlines_)
+    {
+      RCLCPP_ERROR(
+        get_node()->get_logger(),
+        "The sandbox process missed %zu consecutive deadlines, it is considered lost.",
+        missed_deadlines_);
+      return controller_interface::return_type::ERROR;
+    }
+    return controller_interface::return_type::OK;
+  }
+  missed_deadlines_ = 0;
+  for (std::size_t i = 0; i < command_interfaces_.size(); ++i)
+  {
+    // the commands not set by the sandboxed controller are left unchanged
+    if (!std::isnan(command_values_[i]))
+    {
+      std::ignore = command_interfaces_[i].set_value(command_values_[i], 0);
+    }
+  }
+  return controller_interface::return_type::OK;
+}
+
+ControllerSandboxHost::ControllerSandboxHost(
+  controller_interface::ControllerInterfaceBaseSharedPtr controller)
+: controller_(std::move(controller))
+{
+}
+
+ControllerSandboxHost::~ControllerSandboxHost()
+{
+  if (controller_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+  {
+    controller_->get_node()->deactivate();
+  }
+  controller_->release_interfaces();
+  bridge_.close();
+}
+
+bool ControllerSandboxHost::connect(const std::string & segment_name)
+{
+  const auto logger = controller_->get_node()->get_logger();
+  if (!bridge_.open(segment_name))
+  {
+    RCLCPP_ERROR(
+      logger, "The shared-memory segment '%s' of the proxy doesn't exist or isn't active.",
+      segment_name.c_str());
+    return false;
+  }
+  if (
+    controller_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED &&
+    controller_->configure().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE)
+  {
+    RCLCPP_ERROR(logger, "The sandboxed controller failed to configure.");
+    return false;
+  }
+
+  // the commands of the controller are written by the sandbox, i.e., the states of the bridge
+  const auto command_names = resolve_sandbox_interfaces(
+    controller_->command_interface_configuration(), bridge_.get_state_interface_names());
+  const auto state_names = resolve_sandbox_interfaces(
+    controller_->state_interface_configuration(), bridge_.get_command_interface_names());
+  if (!command_names || !state_names)
+  {
+    RCLCPP_ERROR(
+      logger,
+      "The interfaces of the sandboxed controller are not mirrored by the proxy of the segment "
+      "'%s'.",
+      segment_name.c_str());
+    return false;
+  }
+  command_interfaces_.clear();
+  for (const auto & name : bridge_.get_state_interface_names())
+  {
+    const auto [prefix, interface] = split_interface_name(name);
+    command_interfaces_.push_back(
+      std::make_shared<hardware_interface::CommandInterface>(prefix, interface));
+  }
+  state_interfaces_.clear();
+  for (const auto & name : bridge_.get_command_interface_names())
+  {
+    const auto [prefix, interface] = split_interface_name(name);
+    state_interfaces_.push_back(
+      std::make_shared<hardware_interface::StateInterface>(prefix, interface));
+  }
+  auto find_interface = [](const auto & interfaces, const std::string & name)
+  {
+    return *std::find_if(
+      interfaces.begin(), interfaces.end(),
+      [&name](const auto & interface) { return interface->get_name() == name; });
+  };
+  std::vector<hardware_interface::LoanedCommandInterface> command_loans;
+  for (const auto & name : *command_names)
+  {
+    command_loans.emplace_back(find_interface(command_interfaces_, name));
+  }
+  std::vector<hardware_interface::LoanedStateInterface> state_loans;
+  for (const auto & name : *state_names)
+  {
+    state_loans.emplace_back(find_interface(state_interfaces_, name));
+  }
+  controller_->assign_interfaces(std::move(command_loans), std::move(state_loans));
+  if (
+    controller_->get_node()->activate().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+  {
+    RCLCPP_ERROR(logger, "The sandboxed controller failed to activate.");
+    controller_->release_interfaces();
+    return false;
+  }
+
+  state_values_.assign(state_interfaces_.size(), std::numeric_limits<double>::quiet_NaN());
+  command_values_.assign(command_interfaces_.size(), std::numeric_limits<double>::quiet_NaN());
+  last_state_frame_ = 0;
+  last_stamp_ns_ = 0;
+  // the initial commands tell the proxy that the sandbox is attached
+  return bridge_.write_states(command_values_, 0);
+}
+
+bool ControllerSandboxHost::spin_once(std::chrono::nanoseconds timeout)
+{
+  const uint32_t previous_frame = last_state_frame_;
+  int64_t stamp_ns = 0;
+  if (
+    !bridge_.wait_for_commands(previous_frame, timeout) ||
+    !bridge_.read_commands(state_values_, last_state_frame_, stamp_ns) ||
+    last_state_frame_ == previous_frame)
+  {
+    return false;
+  }
+  for (std::size_t i = 0; i < state_interfaces_.size(); ++i)
+  {
+    std::ignore = state_interfaces_[i]->set_value(state_values_[i]);
+  }
+
+  const rclcpp::Time time(stamp_ns, RCL_ROS_TIME);
+  const rclcpp::Duration period =
+    last_stamp_ns_ > 0 ? rclcpp::Duration::from_nanoseconds(stamp_ns - last_stamp_ns_)
+                       : rclcpp::Duration::from_nanoseconds(0);
+  last_stamp_ns_ = stamp_ns;
+  if (controller_->trigger_update(time, period).result != controller_interface::return_type::OK)
+  {
+    // a failed update isn't published, the proxy falls back as after a crash of the controller
+    return false;
+  }
+  for (std::size_t i = 0; i < command_interfaces_.size(); ++i)
+  {
+    const auto value = command_interfaces_[i]->get_optional();
+    if (value.has_value())
+    {
+      command_values_[i] = value.value();
+    }
+  }
+  return bridge_.write_states(command_values_, stamp_ns);
+}
+
+}  // namespace controller_manager
+
+#include "pluginlib/class_list_macros.hpp"
+PLUGINLIB_EXPORT_CLASS(
+  controller_manager::SandboxProxyController, controller_interface::ControllerInterface)
@@ -0,0 +1,106 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/executor_factory.hpp"
+
+#include <rcl/arguments.h>
+#include <rcl_yaml_param_parser/parser.h>
+
+#include <rclcpp/executors/multi_threaded_executor.hpp>
+#include <rclcpp/executors/single_threaded_executor.hpp>
+#include <rclcpp/parameter_map.hpp>
+#include <rclcpp/version.h>
+
+#if RCLCPP_VERSION_GTE(28, 0, 0)
+#include <rclcpp/experimental/executors/events_executor/events_executor.hpp>
+#endif
+
+namespace controller_manager
+{
+bool parse_executor_type(const std::string & name, ExecutorType & type)
+{
+  if (name == "multi_threaded")
+  {
+    type = ExecutorType::MULTI_THREADED;
+    return true;
+  }
+  if (name == "single_threaded")
+  {
+    type = ExecutorType::SINGLE_THREADED;
+    return true;
+  }
+#if RCLCPP_VERSION_GTE(28, 0, 0)
+  if (name == "events")
+  {
+    type = ExecutorType::EVENTS;
+    return true;
+  }
+#endif
+  return false;
+}
+
+std::shared_ptr<rclcpp::Executor> create_executor(ExecutorType type, std::size_t number_of_threads)
+{
+  switch (type)
+  {
+    case ExecutorType::SINGLE_THREADED:
+      return std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+#if RCLCPP_VERSION_GTE(28, 0, 0)
+    case ExecutorType::EVENTS:
+      return std::make_shared<rclcpp::experimental::executors::EventsExecutor>();
+#endif
+    case ExecutorType::MULTI_THREADED:
+    default:
+      return std::make_shared<rclcpp::executors::MultiThreadedExecutor>(
+        rclcpp::ExecutorOptions(), number_of_threads);
+  }
+}
+
+rclcpp::ParameterValue get_parameter_override(
+  const rclcpp::NodeOptions & options, const std::string & node_fqn, const std::string & name)
+{
+  rclcpp::ParameterValue value;
+  for (const auto & parameter : options.parameter_overrides())
+  {
+    if (parameter.get_name() == name)
+    {
+      value = parameter.get_parameter_value();
+    }
+  }
+
+  // the arguments of the node take precedence over the overrides, as when the node is created
+  rcl_params_t * params = nullptr;
+  const rcl_node_options_t * rcl_options = options.get_rcl_node_options();
+  if (
+    rcl_arguments_get_param_overrides(&rcl_options->arguments, &params) != RCL_RET_OK ||
+    params == nullptr)
+  {
+    return value;
+  }
+  const rclcpp::ParameterMap parameter_map = rclcpp::parameter_map_from(params, node_fqn.c_str());
+  rcl_yaml_node_struct_fini(params);
+  for (const auto & [node_name, parameters] : parameter_map)
+  {
+    for (const auto & parameter : parameters)
+    {
+      if (parameter.get_name() == name)
+      {
+        value = parameter.get_parameter_value();
+      }
+    }
+  }
+  return value;
+}
+
+}  // namespace controller_manager
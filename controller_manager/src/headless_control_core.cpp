@@ -0,0 +1,274 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/headless_control_core.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <regex>
+#include <utility>
+
+#include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/logging.hpp"
+
+namespace controller_manager
+{
+namespace
+{
+std::vector<std::string> resolve_interface_names(
+  const controller_interface::InterfaceConfiguration & config,
+  const std::vector<std::string> & available_interfaces)
+{
+  using controller_interface::interface_configuration_type;
+  std::vector<std::string> names;
+  switch (config.type)
+  {
+    case interface_configuration_type::ALL:
+      return available_interfaces;
+    case interface_configuration_type::INDIVIDUAL:
+      return config.names;
+    case interface_configuration_type::INDIVIDUAL_BEST_EFFORT:
+      std::copy_if(
+        config.names.begin(), config.names.end(), std::back_inserter(names),
+        [&available_interfaces](const std::string & name)
+        {
+          return std::find(available_interfaces.begin(), available_interfaces.end(), name) !=
+                 available_interfaces.end();
+        });
+      break;
+    case interface_configuration_type::REGEX:
+      for (const auto & pattern : config.names)
+      {
+        const std::regex regex_pattern(pattern);
+        std::copy_if(
+          available_interfaces.begin(), available_interfaces.end(), std::back_inserter(names),
+          [&regex_pattern](const std::string & name)
+          { return std::regex_match(name, regex_pattern); });
+      }
+      break;
+    case interface_configuration_type::NONE:
+    default:
+      break;
+  }
+  return names;
+}
+
+bool is_active(const controller_interface::ControllerInterfaceBase & controller)
+{
+  return controller.get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE;
+}
+}  // namespace
+
+HeadlessControlCore::HeadlessControlCore(
+  const std::string & urdf, unsigned int update_rate, rclcpp::Logger logger)
+: logger_(logger),
+  // without a time source, the ROS time expected by the controllers is the system time
+  clock_(std::make_shared<rclcpp::Clock>(RCL_ROS_TIME)),
+  update_rate_(update_rate),
+  resource_manager_(std::make_unique<hardware_interface::ResourceManager>(
+    urdf, clock_, logger_.get_child("resource_manager"), true, update_rate))
+{
+}
+
+HeadlessControlCore::~HeadlessControlCore()
+{
+  deactivate_controllers();
+  resource_manager_->shutdown_components();
+}
+
+bool HeadlessControlCore::add_controller(
+  const controller_interface::ControllerInterfaceBaseSharedPtr & controller)
+{
+  if (
+    !controller ||
+    controller->get_lifecycle_id() != lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED)
+  {
+    RCLCPP_ERROR(logger_, "Can't add a controller that is not initialized or already configured.");
+    return false;
+  }
+  if (controller->is_chainable())
+  {
+    RCLCPP_ERROR(
+      logger_, "Can't add the controller '%s': chainable controllers are not supported.",
+      controller->get_name().c_str());
+    return false;
+  }
+  try
+  {
+    if (controller->configure().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE)
+    {
+      RCLCPP_ERROR(
+        logger_, "Can't add the controller '%s': it failed to configure.",
+        controller->get_name().c_str());
+      return false;
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(
+      logger_, "Caught exception while configuring the controller '%s': %s",
+      controller->get_name().c_str(), e.what());
+    return false;
+  }
+  controllers_.push_back({controller, {}});
+  return true;
+}
+
+bool HeadlessControlCore::activate_controllers()
+{
+  bool is_successful = true;
+  for (auto & controller : controllers_)
+  {
+    if (!is_active(*controller.controller))
+    {
+      is_successful &= activate_controller(controller);
+    }
+  }
+  return is_successful;
+}
+
+bool HeadlessControlCore::activate_controller(Controller & controller)
+{
+  const auto & name = controller.controller->get_name();
+  std::vector<hardware_interface::LoanedCommandInterface> command_loans;
+  std::vector<hardware_interface::LoanedStateInterface> state_loans;
+  try
+  {
+    controller.command_interfaces = resolve_interface_names(
+      controller.controller->command_interface_configuration(),
+      resource_manager_->available_command_interfaces());
+    for (const auto & interface : controller.command_interfaces)
+    {
+      if (resource_manager_->command_interface_is_claimed(interface))
+      {
+        RCLCPP_ERROR(
+          logger_,
+          "Resource conflict for controller '%s'. Command interface '%s' is already claimed.",
+          name.c_str(), interface.c_str());
+        return false;
+      }
+      command_loans.emplace_back(resource_manager_->claim_command_interface(interface));
+    }
+    for (const auto & interface : resolve_interface_names(
+           controller.controller->state_interface_configuration(),
+           resource_manager_->available_state_interfaces()))
+    {
+      state_loans.emplace_back(resource_manager_->claim_state_interface(interface));
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(
+      logger_, "Caught exception while claiming the interfaces of the controller '%s': %s",
+      name.c_str(), e.what());
+    return false;
+  }
+  if (
+    !resource_manager_->prepare_command_mode_switch(controller.command_interfaces, {}) ||
+    !resource_manager_->perform_command_mode_switch(controller.command_interfaces, {}))
+  {
+    RCLCPP_ERROR(
+      logger_, "The hardware components rejected the command interfaces of the controller '%s'.",
+      name.c_str());
+    return false;
+  }
+  controller.controller->assign_interfaces(std::move(command_loans), std::move(state_loans));
+  try
+  {
+    const auto new_state = controller.controller->get_node()->activate();
+    if (new_state.id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+    {
+      return true;
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(
+      logger_, "Caught exception while activating the controller '%s': %s", name.c_str(), e.what());
+  }
+  RCLCPP_ERROR(logger_, "The controller '%s' failed to activate.", name.c_str());
+  controller.controller->release_interfaces();
+  resource_manager_->prepare_command_mode_switch({}, controller.command_interfaces);
+  resource_manager_->perform_command_mode_switch({}, controller.command_interfaces);
+  return false;
+}
+
+void HeadlessControlCore::deactivate_controllers()
+{
+  // in the reverse order of the activation
+  for (auto it = controllers_.rbegin(); it != controllers_.rend(); ++it)
+  {
+    if (!is_active(*it->controller))
+    {
+      continue;
+    }
+    try
+    {
+      it->controller->get_node()->deactivate();
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        logger_, "Caught exception while deactivating the controller '%s': %s",
+        it->controller->get_name().c_str(), e.what());
+    }
+    it->controller->release_interfaces();
+    resource_manager_->prepare_command_mode_switch({}, it->command_interfaces);
+    resource_manager_->perform_command_mode_switch({}, it->command_interfaces);
+  }
+}
+
+const hardware_interface::HardwareReadWriteStatus & HeadlessControlCore::read(
+  const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  return resource_manager_->read(time, period);
+}
+
+controller_interface::return_type HeadlessControlCore::update(
+  const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  auto result = controller_interface::return_type::OK;
+  for (const auto & controller : controllers_)
+  {
+    if (!is_active(*controller.controller))
+    {
+      continue;
+    }
+    try
+    {
+      if (
+        controller.controller->trigger_update(time, period).result !=
+        controller_interface::return_type::OK)
+      {
+        result = controller_interface::return_type::ERROR;
+      }
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        logger_, "Caught exception while updating the controller '%s': %s",
+        controller.controller->get_name().c_str(), e.what());
+      result = controller_interface::return_type::ERROR;
+    }
+  }
+  return result;
+}
+
+const hardware_interface::HardwareReadWriteStatus & HeadlessControlCore::write(
+  const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  return resource_manager_->write(time, period);
+}
+
+}  // namespace controller_manager
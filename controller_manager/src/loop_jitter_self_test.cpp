@@ -0,0 +1,204 @@
+// Copyright 2026 ROS2-Control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/loop_jitter_self_test.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <fmt/format.h>
+
+namespace
+{
+/// Width of the bar of the fullest bucket of a histogram
+constexpr std::size_t kBarWidth = 50;
+/// Margin added to the latency spun in the HYBRID mode, as its calibration does
+constexpr std::chrono::nanoseconds kMinimumSpinMargin = std::chrono::microseconds(5);
+
+double to_us(std::chrono::nanoseconds duration)
+{
+  return static_cast<double>(duration.count()) / 1e3;
+}
+
+std::string bucket_range(std::size_t bucket)
+{
+  using controller_manager::LoopTimingHistogram;
+  if (bucket == 0)
+  {
+    return "[0, 1) us";
+  }
+  if (bucket == LoopTimingHistogram::NUMBER_OF_BUCKETS - 1)
+  {
+    return fmt::format(">= {} us", uint64_t{1} << (bucket - 1));
+  }
+  return fmt::format("[{}, {}) us", uint64_t{1} << (bucket - 1), uint64_t{1} << bucket);
+}
+}  // namespace
+
+namespace controller_manager
+{
+PeriodicWaitRecommendation recommend_periodic_wait(
+  std::chrono::nanoseconds period, std::chrono::nanoseconds worst_sleep_latency)
+{
+  PeriodicWaitRecommendation recommendation;
+  if (worst_sleep_latency * 20 <= period)
+  {
+    recommendation.mode = PeriodicWaitMode::SLEEP;
+    recommendation.reason = fmt::format(
+      "the worst wake-up latency of {:.1f} us is below 5% of the period, sleeping until the "
+      "cycles keeps the CPU free",
+      to_us(worst_sleep_latency));
+  }
+  else if (worst_sleep_latency * 2 <= period)
+  {
+    recommendation.mode = PeriodicWaitMode::HYBRID;
+    // covers the latency like the calibration of the margin, rounded up to microseconds
+    const auto margin = worst_sleep_latency + worst_sleep_latency / 4 + kMinimumSpinMargin;
+    recommendation.spin_margin = std::ceil(static_cast<double>(margin.count()) / 1e3) / 1e6;
+    recommendation.reason = fmt::format(
+      "the worst wake-up latency of {:.1f} us is a noticeable part of the period, spinning for "
+      "{:.0f} us before the cycles hides it",
+      to_us(worst_sleep_latency), recommendation.spin_margin * 1e6);
+  }
+  else
+  {
+    recommendation.mode = PeriodicWaitMode::SPIN;
+    recommendation.reason = fmt::format(
+      "the worst wake-up latency of {:.1f} us exceeds half of the period, spin on a core isolated "
+      "from the other processes and set in 'cpu_affinity'",
+      to_us(worst_sleep_latency));
+  }
+  return recommendation;
+}
+
+std::string to_string(PeriodicWaitMode mode)
+{
+  switch (mode)
+  {
+    case PeriodicWaitMode::SPIN:
+      return "spin";
+    case PeriodicWaitMode::HYBRID:
+      return "hybrid";
+    case PeriodicWaitMode::SLEEP:
+    default:
+      return "sleep";
+  }
+}
+
+void LoopTimingHistogram::add_measurement(double value_us) noexcept
+{
+  percentiles_.add_measurement(value_us);
+  max_us_ = std::max(max_us_, value_us);
+  std::size_t bucket = 0;
+  if (value_us >= 1.0)
+  {
+    int exponent = 0;
+    std::frexp(value_us, &exponent);
+    bucket = std::min(NUMBER_OF_BUCKETS - 1, static_cast<std::size_t>(exponent));
+  }
+  ++buckets_[bucket];
+}
+
+std::string LoopTimingHistogram::to_string(const std::string & name) const
+{
+  if (get_count() == 0)
+  {
+    return fmt::format("{}: no measurements\n", name);
+  }
+  std::string text = fmt::format(
+    "{}: p50 {:.1f} us, p99 {:.1f} us, p99.9 {:.1f} us, p99.99 {:.1f} us, max {:.1f} us\n", name,
+    get_percentile(50.0), get_percentile(99.0), get_percentile(99.9), get_percentile(99.99),
+    max_us_);
+  const auto is_empty = [](uint64_t count) { return count == 0; };
+  const auto first = std::find_if_not(buckets_.begin(), buckets_.end(), is_empty);
+  const auto last = std::find_if_not(buckets_.rbegin(), buckets_.rend(), is_empty).base();
+  const uint64_t fullest = *std::max_element(buckets_.begin(), buckets_.end());
+  for (auto bucket = first; bucket != last; ++bucket)
+  {
+    std::size_t width = static_cast<std::size_t>(*bucket * kBarWidth / fullest);
+    if (*bucket > 0)
+    {
+      // a non-empty bucket always has a visible bar
+      width = std::max<std::size_t>(width, 1);
+    }
+    text += fmt::format(
+      "  {:>16} {:>10} {}\n", bucket_range(static_cast<std::size_t>(bucket - buckets_.begin())),
+      *bucket, std::string(width, '#'));
+  }
+  return text;
+}
+
+LoopJitterSelfTest::LoopJitterSelfTest(
+  std::chrono::nanoseconds period, std::chrono::nanoseconds duration,
+  PeriodicWaitMode periodic_wait_mode)
+: period_(period), duration_(duration), periodic_wait_mode_(periodic_wait_mode)
+{
+}
+
+bool LoopJitterSelfTest::add_cycle(
+  std::chrono::nanoseconds measured_period, ControlLoopState & state) noexcept
+{
+  ++cycles_;
+  elapsed_ += measured_period;
+  period_deviation_.add_measurement(std::abs(to_us(measured_period - period_)));
+  if (state.last_wake_up_delay.count() >= 0)
+  {
+    wake_up_delay_.add_measurement(to_us(state.last_wake_up_delay));
+  }
+  if (state.last_sleep_latency.count() >= 0)
+  {
+    sleep_latency_.add_measurement(to_us(state.last_sleep_latency));
+  }
+  state.last_wake_up_delay = std::chrono::nanoseconds(-1);
+  state.last_sleep_latency = std::chrono::nanoseconds(-1);
+  return elapsed_ >= duration_;
+}
+
+std::optional<PeriodicWaitRecommendation> LoopJitterSelfTest::get_recommendation() const
+{
+  if (sleep_latency_.get_count() == 0)
+  {
+    return std::nullopt;
+  }
+  // the max of a short test is the best estimate of the tail of the latency
+  const double worst_us = std::max(sleep_latency_.get_percentile(99.99), sleep_latency_.get_max());
+  return recommend_periodic_wait(
+    period_, std::chrono::nanoseconds(static_cast<int64_t>(worst_us * 1e3)));
+}
+
+std::string LoopJitterSelfTest::get_report() const
+{
+  std::string text = fmt::format(
+    "Loop jitter self-test of {} cycles with a period of {:.1f} us and the '{}' periodic wait:\n",
+    cycles_, to_us(period_), to_string(periodic_wait_mode_));
+  text += wake_up_delay_.to_string("wake-up delay of the cycles");
+  text += sleep_latency_.to_string("wake-up latency of the sleeps");
+  text += period_deviation_.to_string("deviation of the measured period");
+  const auto recommendation = get_recommendation();
+  if (!recommendation)
+  {
+    text +=
+      "No sleep was measured, run the self-test with the 'sleep' or 'hybrid' periodic wait to get "
+      "a recommendation.\n";
+    return text;
+  }
+  text += fmt::format("Recommendation: periodic_wait.mode: '{}'", to_string(recommendation->mode));
+  if (recommendation->mode == PeriodicWaitMode::HYBRID)
+  {
+    text += fmt::format(", periodic_wait.spin_margin: {}", recommendation->spin_margin);
+  }
+  text += fmt::format(", as {}.\n", recommendation->reason);
+  return text;
+}
+}  // namespace controller_manager
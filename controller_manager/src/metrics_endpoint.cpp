@@ -0,0 +1,446 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/metrics_endpoint.hpp"
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace controller_manager
+{
+namespace
+{
+/// Maximal size of the header of a request, the larger requests are rejected
+constexpr std::size_t MAX_REQUEST_SIZE = 8192;
+/// Period at which the thread of the endpoint checks if it has to stop
+constexpr int POLL_TIMEOUT_MS = 100;
+/// Time a client has to send its whole request, however slowly it sends it
+constexpr int RECEIVE_TIMEOUT_MS = 1000;
+
+/// Replaces the characters that are not allowed in the names of metrics and labels
+std::string sanitize_name(const std::string & name)
+{
+  std::string sanitized = name.empty() ? "_" : name;
+  for (std::size_t i = 0; i < sanitized.size(); ++i)
+  {
+    const char c = sanitized[i];
+    const bool is_letter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+    const bool is_digit = c >= '0' && c <= '9';
+    if (!is_letter && !(is_digit && i > 0))
+    {
+      sanitized[i] = '_';
+    }
+  }
+  return sanitized;
+}
+
+std::string escape_label_value(const std::string & value)
+{
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const char c : value)
+  {
+    if (c == '\\' || c == '"')
+    {
+      escaped += '\\';
+      escaped += c;
+    }
+    else if (c == '\n')
+    {
+      escaped += "\\n";
+    }
+    else
+    {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+std::string format_value(double value)
+{
+  if (std::isnan(value))
+  {
+    return "NaN";
+  }
+  if (std::isinf(value))
+  {
+    return value > 0.0 ? "+Inf" : "-Inf";
+  }
+  return fmt::format(FMT_COMPILE("{}"), value);
+}
+
+#if !defined(_WIN32)
+std::string make_response(
+  const std::string & status, const std::string & content_type, const std::string & body,
+  bool send_body)
+{
+  std::string response = fmt::format(
+    FMT_COMPILE(
+      "HTTP/1.1 {}\r\nContent-Type: {}\r\nContent-Length: {}\r\nConnection: close\r\n"),
+    status, content_type, body.size());
+  if (status.rfind("405", 0) == 0)
+  {
+    response += "Allow: GET, HEAD\r\n";
+  }
+  response += "\r\n";
+  if (send_body)
+  {
+    response += body;
+  }
+  return response;
+}
+
+void send_all(int connection, const std::string & data)
+{
+  std::size_t sent = 0;
+  while (sent < data.size())
+  {
+    const ssize_t result = ::send(connection, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+    if (result < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (result <= 0)
+    {
+      // the client closed the connection or didn't read the response in time
+      return;
+    }
+    sent += static_cast<std::size_t>(result);
+  }
+}
+#endif
+}  // namespace
+
+void OpenMetricsWriter::add_family(
+  const std::string & name, MetricType type, const std::string & help)
+{
+  const std::string family_name = sanitize_name(name);
+  std::string escaped_help;
+  for (const char c : help)
+  {
+    if (c == '\\')
+    {
+      escaped_help += "\\\\";
+    }
+    else if (c == '\n')
+    {
+      escaped_help += "\\n";
+    }
+    else
+    {
+      escaped_help += c;
+    }
+  }
+  text_ += fmt::format(
+    FMT_COMPILE("# TYPE {} {}\n# HELP {} {}\n"), family_name,
+    type == MetricType::COUNTER ? "counter" : "gauge", family_name, escaped_help);
+  sample_name_ = type == MetricType::COUNTER ? family_name + "_total" : family_name;
+}
+
+void OpenMetricsWriter::add_sample(const Labels & labels, double value)
+{
+  if (sample_name_.empty())
+  {
+    throw std::logic_error("A sample of a metric has to be added after its family.");
+  }
+  text_ += sample_name_;
+  if (!labels.empty())
+  {
+    text_ += '{';
+    for (std::size_t i = 0; i < labels.size(); ++i)
+    {
+      text_ += fmt::format(
+        FMT_COMPILE("{}{}=\"{}\""), i > 0 ? "," : "", sanitize_name(labels[i].first),
+        escape_label_value(labels[i].second));
+    }
+    text_ += '}';
+  }
+  text_ += ' ';
+  text_ += format_value(value);
+  text_ += '\n';
+}
+
+std::string OpenMetricsWriter::str() const { return text_ + "# EOF\n"; }
+
+MetricsEndpoint::MetricsEndpoint(const MetricsEndpointParams & params) : metrics_("# EOF\n")
+{
+#if defined(_WIN32)
+  (void)params;
+  throw std::runtime_error("The metrics endpoint is only supported on POSIX systems.");
+#else
+  if (!params.unix_socket_path.empty())
+  {
+    sockaddr_un address{};
+    if (params.unix_socket_path.size() >= sizeof(address.sun_path))
+    {
+      throw std::runtime_error(fmt::format(
+        FMT_COMPILE("The path of the Unix socket '{}' is longer than {} characters."),
+        params.unix_socket_path, sizeof(address.sun_path) - 1));
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(
+      address.sun_path, params.unix_socket_path.c_str(), params.unix_socket_path.size() + 1);
+    socket_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket_ < 0)
+    {
+      throw std::runtime_error(fmt::format(
+        FMT_COMPILE("Unable to create the Unix socket of the metrics endpoint: {}"),
+        std::strerror(errno)));
+    }
+    // a socket left by a previous process would fail the bind, any other file is kept
+    struct stat status{};
+    if (::lstat(params.unix_socket_path.c_str(), &status) == 0)
+    {
+      if (!S_ISSOCK(status.st_mode))
+      {
+        ::close(socket_);
+        throw std::runtime_error(fmt::format(
+          FMT_COMPILE("Unable to listen on the Unix socket '{}': the path exists and is not a "
+                      "socket."),
+          params.unix_socket_path));
+      }
+      ::unlink(params.unix_socket_path.c_str());
+    }
+    if (
+      ::bind(socket_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+      ::listen(socket_, SOMAXCONN) != 0)
+    {
+      const int error = errno;
+      ::close(socket_);
+      throw std::runtime_error(fmt::format(
+        FMT_COMPILE("Unable to listen on the Unix socket '{}': {}"), params.unix_socket_path,
+        std::strerror(error)));
+    }
+    unix_socket_path_ = params.unix_socket_path;
+  }
+  else
+  {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE | AI_NUMERICSERV;
+    addrinfo * local = nullptr;
+    const std::string service = std::to_string(params.port);
+    const int result = getaddrinfo(params.address.c_str(), service.c_str(), &hints, &local);
+    if (result != 0 || local == nullptr)
+    {
+      throw std::runtime_error(fmt::format(
+        FMT_COMPILE("Unable to resolve the address '{}' of the metrics endpoint: {}"),
+        params.address, gai_strerror(result)));
+    }
+    socket_ = ::socket(local->ai_family, SOCK_STREAM, 0);
+    if (socket_ < 0)
+    {
+      const int error = errno;
+      freeaddrinfo(local);
+      throw std::runtime_error(fmt::format(
+        FMT_COMPILE("Unable to create the TCP socket of the metrics endpoint: {}"),
+        std::strerror(error)));
+    }
+    const int reuse = 1;
+    setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    const bool listening =
+      ::bind(socket_, local->ai_addr, local->ai_addrlen) == 0 && ::listen(socket_, SOMAXCONN) == 0;
+    const int error = errno;
+    freeaddrinfo(local);
+    if (!listening)
+    {
+      ::close(socket_);
+      throw std::runtime_error(fmt::format(
+        FMT_COMPILE("Unable to listen on '{}:{}' for the metrics endpoint: {}"), params.address,
+        params.port, std::strerror(error)));
+    }
+    sockaddr_storage bound_address{};
+    socklen_t bound_address_size = sizeof(bound_address);
+    if (
+      getsockname(socket_, reinterpret_cast<sockaddr *>(&bound_address), &bound_address_size) == 0)
+    {
+      port_ = ntohs(
+        bound_address.ss_family == AF_INET6
+          ? reinterpret_cast<sockaddr_in6 *>(&bound_address)->sin6_port
+          : reinterpret_cast<sockaddr_in *>(&bound_address)->sin_port);
+    }
+  }
+  // a client closing its connection before it is accepted doesn't block the accept
+  fcntl(socket_, F_SETFL, fcntl(socket_, F_GETFL) | O_NONBLOCK);
+  thread_ = std::thread(&MetricsEndpoint::serve_loop, this);
+#endif
+}
+
+MetricsEndpoint::~MetricsEndpoint()
+{
+#if !defined(_WIN32)
+  stop_.store(true, std::memory_order_relaxed);
+  if (thread_.joinable())
+  {
+    thread_.join();
+  }
+  if (socket_ >= 0)
+  {
+    ::close(socket_);
+  }
+  if (!unix_socket_path_.empty())
+  {
+    ::unlink(unix_socket_path_.c_str());
+  }
+#endif
+}
+
+void MetricsEndpoint::update_metrics(std::string metrics)
+{
+  std::lock_guard<std::mutex> guard(metrics_mutex_);
+  metrics_.swap(metrics);
+}
+
+void MetricsEndpoint::serve_loop()
+{
+#if !defined(_WIN32)
+  while (!stop_.load(std::memory_order_relaxed))
+  {
+    pollfd descriptor;
+    descriptor.fd = socket_;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    if (poll(&descriptor, 1, POLL_TIMEOUT_MS) <= 0)
+    {
+      continue;
+    }
+    const int connection = ::accept(socket_, nullptr, nullptr);
+    if (connection < 0)
+    {
+      continue;
+    }
+    serve_connection(connection);
+    ::close(connection);
+  }
+#endif
+}
+
+void MetricsEndpoint::serve_connection(int connection)
+{
+#if defined(_WIN32)
+  (void)connection;
+#else
+  // the accepted socket inherits the non-blocking flag on some systems
+  fcntl(connection, F_SETFL, fcntl(connection, F_GETFL) & ~O_NONBLOCK);
+  timeval timeout{};
+  timeout.tv_sec = RECEIVE_TIMEOUT_MS / 1000;
+  timeout.tv_usec = (RECEIVE_TIMEOUT_MS % 1000) * 1000;
+  setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+  // the deadline bounds the whole request, a client sending it byte by byte can't hold the thread
+  const auto deadline =
+    std::chrono::steady_clock::now() + std::chrono::milliseconds(RECEIVE_TIMEOUT_MS);
+  std::string request;
+  char buffer[1024];
+  while (request.find("\r\n\r\n") == std::string::npos)
+  {
+    if (request.size() >= MAX_REQUEST_SIZE)
+    {
+      served_requests_.fetch_add(1, std::memory_order_relaxed);
+      send_all(
+        connection, make_response(
+                      "431 Request Header Fields Too Large", "text/plain; charset=utf-8",
+                      "Request too large\n", true));
+      return;
+    }
+    const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - std::chrono::steady_clock::now());
+    if (remaining.count() <= 0)
+    {
+      // the client didn't send its request in time
+      return;
+    }
+    pollfd descriptor;
+    descriptor.fd = connection;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    const int ready = poll(&descriptor, 1, static_cast<int>(remaining.count()));
+    if (ready < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (ready <= 0)
+    {
+      return;
+    }
+    const ssize_t received = ::recv(connection, buffer, sizeof(buffer), 0);
+    if (received < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (received <= 0)
+    {
+      // the client closed the connection
+      return;
+    }
+    request.append(buffer, static_cast<std::size_t>(received));
+  }
+
+  // request line: <method> <target> <version>
+  const std::size_t method_end = request.find(' ');
+  const std::size_t target_end =
+    method_end == std::string::npos ? std::string::npos : request.find(' ', method_end + 1);
+  const std::string method = request.substr(0, method_end);
+  std::string target = target_end == std::string::npos
+                         ? std::string()
+                         : request.substr(method_end + 1, target_end - method_end - 1);
+  target = target.substr(0, target.find('?'));
+
+  std::string response;
+  if (method != "GET" && method != "HEAD")
+  {
+    response = make_response(
+      "405 Method Not Allowed", "text/plain; charset=utf-8", "Method not allowed\n", true);
+  }
+  else if (target != "/metrics")
+  {
+    response =
+      make_response("404 Not Found", "text/plain; charset=utf-8", "Not found\n", method == "GET");
+  }
+  else
+  {
+    std::string metrics;
+    {
+      std::lock_guard<std::mutex> guard(metrics_mutex_);
+      metrics = metrics_;
+    }
+    response = make_response("200 OK", OPENMETRICS_CONTENT_TYPE, metrics, method == "GET");
+  }
+  served_requests_.fetch_add(1, std::memory_order_relaxed);
+  send_all(connection, response);
+#endif
+}
+
+}  // namespace controller_manager
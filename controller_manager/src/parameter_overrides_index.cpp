@@ -0,0 +1,141 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/parameter_overrides_index.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+
+#include <rclcpp/parameter_map.hpp>
+
+namespace controller_manager
+{
+namespace
+{
+std::vector<std::string> split_node_name(const std::string & name)
+{
+  std::vector<std::string> tokens;
+  std::size_t start = 0;
+  while (start <= name.size())
+  {
+    const auto end = std::min(name.find('/', start), name.size());
+    if (end > start)
+    {
+      tokens.push_back(name.substr(start, end - start));
+    }
+    start = end + 1;
+  }
+  return tokens;
+}
+
+bool tokens_match(
+  const std::vector<std::string> & pattern, std::size_t pattern_index,
+  const std::vector<std::string> & name, std::size_t name_index)
+{
+  if (pattern_index == pattern.size())
+  {
+    return name_index == name.size();
+  }
+  if (pattern[pattern_index] == "**")
+  {
+    // matches any number of tokens, including none
+    for (std::size_t i = name_index; i <= name.size(); ++i)
+    {
+      if (tokens_match(pattern, pattern_index + 1, name, i))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+  if (name_index == name.size())
+  {
+    return false;
+  }
+  return (pattern[pattern_index] == "*" || pattern[pattern_index] == name[name_index]) &&
+         tokens_match(pattern, pattern_index + 1, name, name_index + 1);
+}
+}  // namespace
+
+bool ParameterOverridesIndex::node_name_matches(
+  const std::string & pattern, const std::string & node_fqn)
+{
+  return tokens_match(split_node_name(pattern), 0, split_node_name(node_fqn), 0);
+}
+
+std::vector<rclcpp::Parameter> ParameterOverridesIndex::get_parameter_overrides(
+  const std::string & parameters_file, const std::string & node_fqn)
+{
+  std::error_code error;
+  const auto write_time = std::filesystem::last_write_time(parameters_file, error);
+  const auto size = error ? 0 : std::filesystem::file_size(parameters_file, error);
+  if (error)
+  {
+    throw std::runtime_error(
+      "Unable to read the parameter file '" + parameters_file + "': " + error.message());
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = files_.find(parameters_file);
+  if (it == files_.end() || it->second.write_time != write_time || it->second.size != size)
+  {
+    // throws if the file can't be parsed, the previous index of the file is then kept
+    const rclcpp::ParameterMap parameter_map =
+      rclcpp::parameter_map_from_yaml_file(parameters_file);
+    IndexedFile indexed_file;
+    indexed_file.write_time = write_time;
+    indexed_file.size = size;
+    for (const auto & [node_name, parameters] : parameter_map)
+    {
+      if (node_name.find('*') != std::string::npos)
+      {
+        indexed_file.wildcard_nodes.emplace_back(node_name, parameters);
+      }
+      else
+      {
+        indexed_file.nodes.emplace(node_name, parameters);
+      }
+    }
+    // the wildcard entries are applied in a deterministic order
+    std::sort(
+      indexed_file.wildcard_nodes.begin(), indexed_file.wildcard_nodes.end(),
+      [](const auto & a, const auto & b) { return a.first < b.first; });
+    it = files_.insert_or_assign(parameters_file, std::move(indexed_file)).first;
+    ++number_of_parses_;
+  }
+
+  std::vector<rclcpp::Parameter> parameters;
+  for (const auto & [pattern, wildcard_parameters] : it->second.wildcard_nodes)
+  {
+    if (node_name_matches(pattern, node_fqn))
+    {
+      parameters.insert(parameters.end(), wildcard_parameters.begin(), wildcard_parameters.end());
+    }
+  }
+  const auto node_it = it->second.nodes.find(node_fqn);
+  if (node_it != it->second.nodes.end())
+  {
+    parameters.insert(parameters.end(), node_it->second.begin(), node_it->second.end());
+  }
+  return parameters;
+}
+
+std::size_t ParameterOverridesIndex::get_number_of_parses() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return number_of_parses_;
+}
+
+}  // namespace controller_manager
@@ -13,13 +13,23 @@
 // limitations under the License.
 
 #include <errno.h>
+#include <algorithm>
 #include <chrono>
+#include <exception>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 
 #include "controller_manager/controller_manager.hpp"
+#include "controller_manager/executor_factory.hpp"
+#include "controller_manager/loop_jitter_self_test.hpp"
 #include "controller_manager/sleeping_policies.hpp"
+#include "controller_manager_msgs/srv/step_cycles.hpp"
+#include "hardware_interface/allocation_hook.hpp"
+#include "hardware_interface/realtime_thread.hpp"
+#include "hardware_interface/simulation_step_barrier.hpp"
+#include "rclcpp/contexts/default_context.hpp"
 #include "rclcpp/executors.hpp"
 #include "realtime_tools/realtime_helpers.hpp"
 
@@ -34,12 +44,14 @@ int const kSchedPriority = 50;
 
 }  // namespace
 
+// Report the heap allocations to the allocation tracker of the controller manager, the allocations
+// are only counted on the real-time thread when the allocation_tracking.enable parameter is set
+HARDWARE_INTERFACE_DEFINE_ALLOCATION_HOOK();
+
 int main(int argc, char ** argv)
 {
   rclcpp::init(argc, argv);
 
-  std::shared_ptr<rclcpp::Executor> executor =
-    std::make_shared<rclcpp::executors::MultiThreadedExecutor>();
   std::string manager_node_name = "controller_manager";
 
   rclcpp::NodeOptions cm_node_options = controller_manager::get_cm_node_options();
@@ -55,11 +67,43 @@ int main(int argc, char ** argv)
   }
   cm_node_options.arguments(node_arguments);
 
+  // the executor is created before the controller manager, which adds the controllers to it
+  const std::string manager_node_fqn = "/" + manager_node_name;
+  const rclcpp::ParameterValue executor_type_value = controller_manager::get_parameter_override(
+    cm_node_options, manager_node_fqn, "executor.type");
+  const rclcpp::ParameterValue number_of_threads_value = controller_manager::get_parameter_override(
+    cm_node_options, manager_node_fqn, "executor.number_of_threads");
+  const std::string executor_type_name =
+    executor_type_value.get_type() == rclcpp::ParameterType::PARAMETER_STRING
+      ? executor_type_value.get<std::string>()
+      : "multi_threaded";
+  controller_manager::ExecutorType executor_type = controller_manager::ExecutorType::MULTI_THREADED;
+  const bool known_executor_type =
+    controller_manager::parse_executor_type(executor_type_name, executor_type);
+  const int64_t number_of_threads =
+    number_of_threads_value.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER
+      ? number_of_threads_value.get<int64_t>()
+      : 0;
+  std::shared_ptr<rclcpp::Executor> executor = controller_manager::create_executor(
+    executor_type, static_cast<std::size_t>(std::max<int64_t>(number_of_threads, 0)));
+
   auto cm = std::make_shared<controller_manager::ControllerManager>(
     executor, manager_node_name, "", cm_node_options);
 
   const bool use_sim_time = cm->get_parameter_or("use_sim_time", false);
 
+  if (!known_executor_type)
+  {
+    RCLCPP_WARN(
+      cm->get_logger(),
+      "Unknown or unavailable executor type '%s', expected 'multi_threaded', 'single_threaded' or "
+      "'events'. Using 'multi_threaded'.",
+      executor_type_name.c_str());
+  }
+  RCLCPP_INFO(
+    cm->get_logger(), "Spinning the non real-time callbacks with the '%s' executor.",
+    known_executor_type ? executor_type_name.c_str() : "multi_threaded");
+
   const bool has_realtime = realtime_tools::has_realtime_kernel();
   const bool lock_memory = cm->get_parameter_or<bool>("lock_memory", has_realtime);
   if (lock_memory)
@@ -80,6 +124,18 @@ int main(int argc, char ** argv)
     cm->get_logger(), "Spawning %s RT thread with scheduler priority: %d", cm->get_name(),
     thread_priority);
 
+  const std::string periodic_wait_mode_name =
+    cm->get_parameter_or<std::string>("periodic_wait.mode", "sleep");
+  controller_manager::PeriodicWaitMode periodic_wait_mode =
+    controller_manager::PeriodicWaitMode::SLEEP;
+  if (!controller_manager::parse_periodic_wait_mode(periodic_wait_mode_name, periodic_wait_mode))
+  {
+    RCLCPP_WARN(
+      cm->get_logger(),
+      "Unknown periodic wait mode '%s', expected 'sleep', 'spin' or 'hybrid'. Using 'sleep'.",
+      periodic_wait_mode_name.c_str());
+  }
+
   const controller_manager::ControlLoopTimingConfig timing_config{
     .use_sim_time = use_sim_time,
     .manage_overruns = manage_overruns,
@@ -87,96 +143,287 @@ int main(int argc, char ** argv)
       cm->get_parameter_or<bool>("hardware_synchronization.expect_blocking_read_write", false),
     .minimum_cycle_time =
       cm->get_parameter_or<double>("hardware_synchronization.minimum_cycle_time", 0.0001),
+    .cycle_trigger_component = cm->get_parameter_or<std::string>(
+      "hardware_synchronization.cycle_trigger_component", ""),
+    .cycle_trigger_timeout =
+      cm->get_parameter_or<double>("hardware_synchronization.cycle_trigger_timeout", 0.1),
+    .periodic_wait_mode = periodic_wait_mode,
+    .spin_margin = cm->get_parameter_or<double>("periodic_wait.spin_margin", 0.0),
+    .idle_enable = cm->get_parameter_or<bool>("idle.enable", false),
+    .idle_update_rate = std::max(cm->get_parameter_or<double>("idle.update_rate", 10.0), 0.0),
+    .idle_with_state_only_controllers =
+      cm->get_parameter_or<bool>("idle.with_broadcasters", true),
+    .idle_pause_hardware = cm->get_parameter_or<bool>("idle.pause_hardware", false),
   };
   RCLCPP_INFO_EXPRESSION(
     cm->get_logger(), timing_config.expect_blocking_read_write,
     "Synchronizing control loop with hardware.");
+  RCLCPP_INFO_EXPRESSION(
+    cm->get_logger(), !timing_config.cycle_trigger_component.empty(),
+    "Triggering the control loop by the hardware component '%s'.",
+    timing_config.cycle_trigger_component.c_str());
+  RCLCPP_INFO_EXPRESSION(
+    cm->get_logger(), timing_config.idle_enable && !use_sim_time,
+    "Running the control loop at %.1f Hz while no controller commands the hardware%s.",
+    timing_config.idle_update_rate,
+    timing_config.idle_update_rate > 0.0 ? "" : ", i.e., only on controller switches");
 
-  std::thread cm_thread(
-    [cm, thread_priority, timing_config]()
+  // "free_running" runs the cycles back-to-back, "lockstep" runs them on requests of the
+  // step_cycles service, both with the time advancing by the period of the update rate, and
+  // "shared_memory" runs them on the steps of a simulator at the time of the simulation
+  const std::string stepping_mode = cm->get_parameter_or<std::string>("stepping.mode", "realtime");
+  const bool free_running = stepping_mode == "free_running";
+  const bool lockstep = stepping_mode == "lockstep";
+  std::shared_ptr<hardware_interface::SimulationStepBarrier> step_barrier;
+  if (stepping_mode == "shared_memory")
+  {
+    const auto segment_name =
+      cm->get_parameter_or<std::string>("stepping.segment_name", "/ros2_control_step_barrier");
+    step_barrier = std::make_shared<hardware_interface::SimulationStepBarrier>();
+    try
+    {
+      step_barrier->create(segment_name);
+      RCLCPP_INFO(
+        cm->get_logger(), "Running the control cycles on the steps of the simulator through '%s'.",
+        segment_name.c_str());
+    }
+    catch (const std::exception & e)
     {
-      rclcpp::Parameter cpu_affinity_param;
-      if (cm->get_parameter("cpu_affinity", cpu_affinity_param))
+      RCLCPP_ERROR(cm->get_logger(), "%s Using the 'realtime' stepping mode instead.", e.what());
+      step_barrier.reset();
+    }
+  }
+  else if (!free_running && !lockstep && stepping_mode != "realtime")
+  {
+    RCLCPP_WARN(
+      cm->get_logger(),
+      "Unknown stepping mode '%s', expected 'realtime', 'free_running', 'lockstep' or "
+      "'shared_memory'. Using 'realtime'.",
+      stepping_mode.c_str());
+  }
+
+  rclcpp::Service<controller_manager_msgs::srv::StepCycles>::SharedPtr step_cycles_service;
+  if (lockstep)
+  {
+    RCLCPP_INFO(cm->get_logger(), "Running the control cycles on requests of '~/step_cycles'.");
+    auto next_cycle_time = std::make_shared<std::optional<rclcpp::Time>>();
+    step_cycles_service = cm->create_service<controller_manager_msgs::srv::StepCycles>(
+      "~/step_cycles",
+      [cm, next_cycle_time](
+        const std::shared_ptr<controller_manager_msgs::srv::StepCycles::Request> request,
+        std::shared_ptr<controller_manager_msgs::srv::StepCycles::Response> response)
       {
-        std::vector<int> cpus = {};
-        if (cpu_affinity_param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER)
+        if (!next_cycle_time->has_value())
         {
-          cpus = {static_cast<int>(cpu_affinity_param.as_int())};
+          *next_cycle_time = cm->get_trigger_clock()->now();
         }
-        else if (cpu_affinity_param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER_ARRAY)
+        *next_cycle_time = cm->step(next_cycle_time->value(), request->cycles);
+        response->time = next_cycle_time->value();
+        response->ok = true;
+      },
+      rclcpp::ServicesQoS(),
+      // the cycles run next to the services of the controller manager waiting for them
+      cm->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive));
+  }
+  RCLCPP_INFO_EXPRESSION(
+    cm->get_logger(), free_running, "Running the control cycles back-to-back without sleeping.");
+
+  // the self-test measures the real-time loop with all its settings and stops the node afterwards
+  const double self_test_duration = cm->get_parameter_or<double>("jitter_self_test.duration", 0.0);
+  std::shared_ptr<controller_manager::LoopJitterSelfTest> self_test;
+  if (self_test_duration > 0.0)
+  {
+    if (free_running || lockstep || step_barrier || use_sim_time)
+    {
+      RCLCPP_WARN(
+        cm->get_logger(),
+        "The loop jitter self-test needs the 'realtime' stepping mode without simulation time, it "
+        "is not run.");
+    }
+    else
+    {
+      RCLCPP_INFO(
+        cm->get_logger(), "Running the loop jitter self-test for %.1f s, then stopping the node.",
+        self_test_duration);
+      self_test = std::make_shared<controller_manager::LoopJitterSelfTest>(
+        std::chrono::nanoseconds(1'000'000'000 / cm->get_update_rate()),
+        std::chrono::nanoseconds(static_cast<int64_t>(self_test_duration * 1e9)),
+        periodic_wait_mode);
+    }
+  }
+
+  std::thread cm_thread;
+  if (!lockstep)
+  {
+    cm_thread = std::thread(
+      [cm, thread_priority, timing_config, free_running, step_barrier, self_test]()
+      {
+        rclcpp::Parameter cpu_affinity_param;
+        if (cm->get_parameter("cpu_affinity", cpu_affinity_param))
         {
-          const auto cpu_affinity_param_array = cpu_affinity_param.as_integer_array();
-          cpus.assign(cpu_affinity_param_array.begin(), cpu_affinity_param_array.end());
+          std::vector<int> cpus = {};
+          if (cpu_affinity_param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER)
+          {
+            cpus = {static_cast<int>(cpu_affinity_param.as_int())};
+          }
+          else if (cpu_affinity_param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER_ARRAY)
+          {
+            const auto cpu_affinity_param_array = cpu_affinity_param.as_integer_array();
+            cpus.assign(cpu_affinity_param_array.begin(), cpu_affinity_param_array.end());
+          }
+          const auto affinity_result = realtime_tools::set_current_thread_affinity(cpus);
+          if (!affinity_result.first)
+          {
+            RCLCPP_WARN(
+              cm->get_logger(), "Unable to set the CPU affinity : '%s'",
+              affinity_result.second.c_str());
+          }
         }
-        const auto affinity_result = realtime_tools::set_current_thread_affinity(cpus);
-        if (!affinity_result.first)
+
+        if (!realtime_tools::configure_sched_fifo(thread_priority))
         {
           RCLCPP_WARN(
-            cm->get_logger(), "Unable to set the CPU affinity : '%s'",
-            affinity_result.second.c_str());
+            cm->get_logger(),
+            "Could not enable FIFO RT scheduling policy: with error number <%i>(%s). See "
+            "[https://control.ros.org/master/doc/ros2_control/controller_manager/doc/userdoc.html] "
+            "for details on how to enable realtime scheduling.",
+            errno, strerror(errno));
+        }
+        else
+        {
+          RCLCPP_INFO(
+            cm->get_logger(), "Successful set up FIFO RT scheduling policy with priority %i.",
+            thread_priority);
         }
-      }
 
-      if (!realtime_tools::configure_sched_fifo(thread_priority))
-      {
-        RCLCPP_WARN(
-          cm->get_logger(),
-          "Could not enable FIFO RT scheduling policy: with error number <%i>(%s). See "
-          "[https://control.ros.org/master/doc/ros2_control/controller_manager/doc/userdoc.html] "
-          "for details on how to enable realtime scheduling.",
-          errno, strerror(errno));
-      }
-      else
-      {
-        RCLCPP_INFO(
-          cm->get_logger(), "Successful set up FIFO RT scheduling policy with priority %i.",
-          thread_priority);
-      }
+        hardware_interface::set_current_thread_name("ros2_control");
+        const int64_t stack_prefault_size =
+          cm->get_parameter_or<int64_t>("realtime_threads.stack_prefault_size", 0);
+        if (stack_prefault_size > 0)
+        {
+          hardware_interface::prefault_current_thread_stack(
+            static_cast<std::size_t>(stack_prefault_size));
+        }
 
-      // wait for the clock to be available
-      cm->get_clock()->wait_until_started();
-      cm->get_clock()->sleep_for(rclcpp::Duration::from_seconds(1.0 / cm->get_update_rate()));
+        // wait for the clock to be available
+        cm->get_clock()->wait_until_started();
+        cm->get_clock()->sleep_for(rclcpp::Duration::from_seconds(1.0 / cm->get_update_rate()));
 
-      controller_manager::ControlLoopState state;
-      state.period = std::chrono::nanoseconds(1'000'000'000 / cm->get_update_rate());
-      state.previous_time = cm->get_trigger_clock()->now();
-      std::this_thread::sleep_for(state.period);
-      state.next_iteration_time = std::chrono::steady_clock::now();
-      while (rclcpp::ok())
-      {
-        // calculate measured period
-        auto const current_time = cm->get_trigger_clock()->now();
-        auto const measured_period = current_time - state.previous_time;
-        state.previous_time = current_time;
-
-        // execute update loop
-        cm->read(cm->get_trigger_clock()->now(), measured_period);
-        cm->update(cm->get_trigger_clock()->now(), measured_period);
-        cm->write(cm->get_trigger_clock()->now(), measured_period);
-        state.cycle_end_time = cm->get_trigger_clock()->now();
-
-        // wait until we hit the end of the period
-        if (timing_config.use_sim_time)
+        if (free_running)
         {
-          if (!sleep_for_sim_time(cm, state))
+          rclcpp::Time cycle_time = sample_cycle_time(cm, timing_config);
+          while (rclcpp::ok())
           {
-            break;
+            cycle_time = cm->step(cycle_time);
           }
+          return;
         }
-        else if (timing_config.expect_blocking_read_write)
+
+        if (step_barrier)
         {
-          sleep_for_blocking_read_write(cm, timing_config, state);
+          const auto clock_type = cm->get_trigger_clock()->get_clock_type();
+          int64_t step_time_ns = 0;
+          while (rclcpp::ok())
+          {
+            // the timeout only bounds the reaction to the shutdown
+            if (step_barrier->wait_for_step(100ms, step_time_ns))
+            {
+              cm->step(rclcpp::Time(step_time_ns, clock_type));
+              step_barrier->complete_step(step_time_ns);
+            }
+          }
+          return;
         }
-        else
+
+        controller_manager::ControlLoopState state;
+        state.period = std::chrono::nanoseconds(1'000'000'000 / cm->get_update_rate());
+        state.previous_time = sample_cycle_time(cm, timing_config);
+        std::this_thread::sleep_for(state.period);
+        state.next_iteration_time = std::chrono::steady_clock::now();
+        while (rclcpp::ok())
         {
-          sleep_for_periodic_cycle(cm, timing_config, state);
+          // calculate measured period, the time of the cycle is sampled once for all the phases
+          auto const current_time = sample_cycle_time(cm, timing_config);
+          auto const measured_period = current_time - state.previous_time;
+          state.previous_time = current_time;
+
+          // the idle policy doesn't apply to the simulation time and to the self-test
+          const bool idle =
+            !timing_config.use_sim_time && !self_test && is_control_loop_idle(cm, timing_config);
+          const bool pause_hardware = idle && timing_config.idle_pause_hardware;
+
+          // execute update loop
+          if (
+            !pause_hardware ||
+            cm->get_controllers_activity() !=
+              controller_manager::ControllerManager::ControllersActivity::NO_ACTIVE_CONTROLLERS)
+          {
+            cm->read(current_time, measured_period);
+          }
+          cm->update(current_time, measured_period);
+          if (!pause_hardware)
+          {
+            cm->write(current_time, measured_period);
+          }
+          if (timing_config.expect_blocking_read_write)
+          {
+            state.cycle_end_time = sample_cycle_time(cm, timing_config);
+          }
+
+          // wait until we hit the end of the period
+          if (timing_config.use_sim_time)
+          {
+            if (!sleep_for_sim_time(cm, state))
+            {
+              break;
+            }
+          }
+          else if (idle)
+          {
+            sleep_while_idle(cm, timing_config, state);
+          }
+          else if (!timing_config.cycle_trigger_component.empty())
+          {
+            sleep_for_hardware_trigger(cm, timing_config, state);
+          }
+          else if (timing_config.expect_blocking_read_write)
+          {
+            sleep_for_blocking_read_write(cm, timing_config, state);
+          }
+          else
+          {
+            sleep_for_periodic_cycle(cm, timing_config, state);
+          }
+
+          if (
+            self_test &&
+            self_test->add_cycle(std::chrono::nanoseconds(measured_period.nanoseconds()), state))
+          {
+            RCLCPP_INFO(cm->get_logger(), "%s", self_test->get_report().c_str());
+            rclcpp::shutdown();
+            break;
+          }
         }
+      });
+  }
+
+  // the idle control loop stops waiting at the shutdown
+  std::weak_ptr<controller_manager::ControllerManager> weak_cm = cm;
+  rclcpp::contexts::get_global_default_context()->add_on_shutdown_callback(
+    [weak_cm]()
+    {
+      if (auto shared_cm = weak_cm.lock())
+      {
+        shared_cm->notify_control_loop();
       }
     });
 
   executor->add_node(cm);
   executor->spin();
-  cm_thread.join();
+  if (cm_thread.joinable())
+  {
+    cm_thread.join();
+  }
   rclcpp::shutdown();
   return 0;
 }
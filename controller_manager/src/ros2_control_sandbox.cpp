@@ -0,0 +1,106 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "controller_interface/controller_interface.hpp"
+#include "controller_manager/controller_sandbox.hpp"
+#include "pluginlib/class_loader.hpp"
+#include "rclcpp/executors.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+
+// Runs a controller in its own process, mirroring the interfaces claimed by its
+// SandboxProxyController in the controller manager:
+//   ros2_control_sandbox <controller_name> <controller_type> <segment_name> [update_rate]
+// The parameters of the controller are given as ROS arguments, e.g., with --params-file.
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  const std::vector<std::string> arguments = rclcpp::remove_ros_arguments(argc, argv);
+  if (arguments.size() != 4 && arguments.size() != 5)
+  {
+    std::fprintf(
+      stderr,
+      "Usage: ros2_control_sandbox <controller_name> <controller_type> <segment_name> "
+      "[update_rate]\n");
+    rclcpp::shutdown();
+    return 1;
+  }
+  const auto & controller_name = arguments[1];
+  const auto & controller_type = arguments[2];
+  const auto & segment_name = arguments[3];
+  auto logger = rclcpp::get_logger("ros2_control_sandbox");
+
+  pluginlib::ClassLoader<controller_interface::ControllerInterface> loader(
+    "controller_interface", "controller_interface::ControllerInterface");
+  std::shared_ptr<controller_interface::ControllerInterface> controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = controller_name;
+  try
+  {
+    params.update_rate = arguments.size() == 5 ? static_cast<unsigned int>(std::stoul(arguments[4]))
+                                               : 100u;
+    params.controller_manager_update_rate = params.update_rate;
+    controller = loader.createSharedInstance(controller_type);
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(
+      logger, "Can't load the controller '%s' of type '%s': %s", controller_name.c_str(),
+      controller_type.c_str(), e.what());
+    rclcpp::shutdown();
+    return 1;
+  }
+  if (controller->init(params) != controller_interface::return_type::OK)
+  {
+    RCLCPP_ERROR(logger, "The controller '%s' failed to initialize.", controller_name.c_str());
+    rclcpp::shutdown();
+    return 1;
+  }
+
+  int result = 0;
+  {
+    controller_manager::ControllerSandboxHost host(controller);
+    if (!host.connect(segment_name))
+    {
+      result = 1;
+    }
+    else
+    {
+      // the subscriptions and the services of the controller are not spun by the update thread
+      rclcpp::executors::SingleThreadedExecutor executor;
+      executor.add_node(controller->get_node()->get_node_base_interface());
+      std::thread spinner([&executor]() { executor.spin(); });
+      RCLCPP_INFO(
+        logger, "Running the controller '%s' for the proxy of the segment '%s'.",
+        controller_name.c_str(), segment_name.c_str());
+      while (rclcpp::ok() && host.is_connected())
+      {
+        host.spin_once(100ms);
+      }
+      executor.cancel();
+      spinner.join();
+    }
+  }
+  rclcpp::shutdown();
+  return result;
+}
@@ -14,6 +14,155 @@
 
 #include "controller_manager/sleeping_policies.hpp"
 
+#include <algorithm>
+
+#ifdef __linux__
+#include <time.h>
+#include <cerrno>
+#endif
+
+#include "hardware_interface/cycle_trace_ring.hpp"
+
+namespace
+{
+/// Bounds of the calibrated spin margin of the HYBRID mode
+constexpr std::chrono::nanoseconds kMinimumSpinMargin = std::chrono::microseconds(5);
+/// The calibrated margin decreases by this fraction of the difference every cycle
+constexpr int64_t kSpinMarginDecayDivisor = 64;
+/// Longest wait of the idle loop without notification, to check for the shutdown
+constexpr std::chrono::seconds kMaximumIdleWait = std::chrono::seconds(1);
+
+/// Sleeps until an absolute time of the steady clock, unaffected by rounding of relative sleeps
+void sleep_until_steady_time(std::chrono::steady_clock::time_point wake_up_time)
+{
+#ifdef __linux__
+  // std::chrono::steady_clock is CLOCK_MONOTONIC on Linux
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    wake_up_time.time_since_epoch())
+                    .count();
+  timespec deadline;
+  deadline.tv_sec = static_cast<time_t>(ns / 1'000'000'000);
+  deadline.tv_nsec = static_cast<long>(ns % 1'000'000'000);  // NOLINT(runtime/int)
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR)
+  {
+  }
+#else
+  std::this_thread::sleep_until(wake_up_time);
+#endif
+}
+
+void spin_until(std::chrono::steady_clock::time_point wake_up_time)
+{
+  while (std::chrono::steady_clock::now() < wake_up_time)
+  {
+  }
+}
+
+/// Follows an increase of the wake-up latency at once and a decrease slowly
+void calibrate_spin_margin(
+  controller_manager::ControlLoopState & state, std::chrono::nanoseconds wake_up_latency)
+{
+  const auto target = wake_up_latency + wake_up_latency / 4 + kMinimumSpinMargin;
+  auto & margin = state.calibrated_spin_margin;
+  if (target > margin)
+  {
+    margin = target;
+  }
+  else
+  {
+    margin -= (margin - target) / kSpinMarginDecayDivisor;
+  }
+  const auto maximum_margin = std::max(kMinimumSpinMargin, state.period / 2);
+  margin = std::clamp(margin, kMinimumSpinMargin, maximum_margin);
+}
+}  // namespace
+
+namespace controller_manager
+{
+bool parse_periodic_wait_mode(const std::string & name, PeriodicWaitMode & mode)
+{
+  if (name == "sleep")
+  {
+    mode = PeriodicWaitMode::SLEEP;
+  }
+  else if (name == "spin")
+  {
+    mode = PeriodicWaitMode::SPIN;
+  }
+  else if (name == "hybrid")
+  {
+    mode = PeriodicWaitMode::HYBRID;
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+}  // namespace controller_manager
+
+rclcpp::Time sample_cycle_time(
+  const std::shared_ptr<controller_manager::ControllerManager> & cm,
+  const controller_manager::ControlLoopTimingConfig & config)
+{
+  if (config.use_sim_time)
+  {
+    return cm->get_trigger_clock()->now();
+  }
+  // same time source as the steady trigger clock, without the locking of rclcpp::Clock::now()
+  return rclcpp::Time(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch())
+      .count(),
+    RCL_STEADY_TIME);
+}
+
+std::chrono::nanoseconds wait_until_steady_time(
+  const controller_manager::ControlLoopTimingConfig & config,
+  controller_manager::ControlLoopState & state, std::chrono::steady_clock::time_point wake_up_time)
+{
+  switch (config.periodic_wait_mode)
+  {
+    case controller_manager::PeriodicWaitMode::SPIN:
+      state.last_sleep_latency = std::chrono::nanoseconds(-1);
+      spin_until(wake_up_time);
+      break;
+    case controller_manager::PeriodicWaitMode::HYBRID:
+    {
+      const bool calibrate = config.spin_margin <= 0.0;
+      const auto margin =
+        calibrate ? state.calibrated_spin_margin
+                  : std::chrono::nanoseconds(static_cast<int64_t>(config.spin_margin * 1e9));
+      const auto sleep_end_time = wake_up_time - margin;
+      state.last_sleep_latency = std::chrono::nanoseconds(-1);
+      if (std::chrono::steady_clock::now() < sleep_end_time)
+      {
+        sleep_until_steady_time(sleep_end_time);
+        state.last_sleep_latency = std::max(
+          std::chrono::nanoseconds::zero(), std::chrono::steady_clock::now() - sleep_end_time);
+        if (calibrate)
+        {
+          calibrate_spin_margin(state, state.last_sleep_latency);
+        }
+      }
+      spin_until(wake_up_time);
+      break;
+    }
+    case controller_manager::PeriodicWaitMode::SLEEP:
+    default:
+    {
+      const bool sleeps = std::chrono::steady_clock::now() < wake_up_time;
+      sleep_until_steady_time(wake_up_time);
+      const auto delay = std::max(
+        std::chrono::nanoseconds::zero(), std::chrono::steady_clock::now() - wake_up_time);
+      state.last_sleep_latency = sleeps ? delay : std::chrono::nanoseconds(-1);
+      return delay;
+    }
+  }
+  return std::max(
+    std::chrono::nanoseconds::zero(), std::chrono::steady_clock::now() - wake_up_time);
+}
+
 bool sleep_for_sim_time(
   std::shared_ptr<controller_manager::ControllerManager> cm,
   controller_manager::ControlLoopState & state)
@@ -69,6 +218,8 @@ void sleep_for_periodic_cycle(
       1.e6;
     const double cm_period = 1.e3 / static_cast<double>(cm->get_update_rate());
     const int overrun_count = static_cast<int>(std::ceil(time_diff / cm_period));
+    // keeps the cycles before the overrun, unless the controller manager already froze them
+    hardware_interface::CycleTraceRing::freeze();
     RCLCPP_WARN_THROTTLE(
       cm->get_logger(), *cm->get_clock(), 1000,
       "Overrun detected! The controller manager missed its desired rate of %d Hz. The loop "
@@ -76,5 +227,76 @@ void sleep_for_periodic_cycle(
       cm->get_update_rate(), time_diff + cm_period, overrun_count + 1);
     state.next_iteration_time += (overrun_count * state.period);
   }
-  std::this_thread::sleep_until(state.next_iteration_time);
+  const auto wake_up_jitter = wait_until_steady_time(config, state, state.next_iteration_time);
+  state.last_wake_up_delay = wake_up_jitter;
+  cm->add_wake_up_jitter_measurement(static_cast<double>(wake_up_jitter.count()) / 1.e3);
+}
+
+void sleep_for_hardware_trigger(
+  std::shared_ptr<controller_manager::ControllerManager> cm,
+  const controller_manager::ControlLoopTimingConfig & config,
+  controller_manager::ControlLoopState & state)
+{
+  if (!state.cycle_trigger)
+  {
+    state.cycle_trigger = cm->get_hardware_cycle_trigger(config.cycle_trigger_component);
+    if (!state.cycle_trigger)
+    {
+      RCLCPP_WARN_THROTTLE(
+        cm->get_logger(), *cm->get_clock(), 1000,
+        "The hardware component '%s' pacing the control loop is not loaded, running the loop at "
+        "the update rate.",
+        config.cycle_trigger_component.c_str());
+      sleep_for_periodic_cycle(cm, config, state);
+      return;
+    }
+  }
+  if (!state.cycle_trigger->wait_for(
+        std::chrono::nanoseconds(static_cast<int64_t>(config.cycle_trigger_timeout * 1e9))))
+  {
+    RCLCPP_WARN_THROTTLE(
+      cm->get_logger(), *cm->get_clock(), 1000,
+      "The hardware component '%s' didn't trigger the control cycle within %f s, running the "
+      "cycle anyway.",
+      config.cycle_trigger_component.c_str(), config.cycle_trigger_timeout);
+  }
+  // keep the periodic schedule consistent in case the loop falls back to it
+  state.next_iteration_time = std::chrono::steady_clock::now();
+}
+
+bool is_control_loop_idle(
+  const std::shared_ptr<controller_manager::ControllerManager> & cm,
+  const controller_manager::ControlLoopTimingConfig & config)
+{
+  if (!config.idle_enable)
+  {
+    return false;
+  }
+  using ControllersActivity = controller_manager::ControllerManager::ControllersActivity;
+  const auto activity = cm->get_controllers_activity();
+  return activity == ControllersActivity::NO_ACTIVE_CONTROLLERS ||
+         (activity == ControllersActivity::STATE_ONLY && config.idle_with_state_only_controllers);
+}
+
+void sleep_while_idle(
+  std::shared_ptr<controller_manager::ControllerManager> cm,
+  const controller_manager::ControlLoopTimingConfig & config,
+  controller_manager::ControlLoopState & state)
+{
+  if (config.idle_update_rate > 0.0)
+  {
+    const auto idle_period = std::chrono::nanoseconds(
+      static_cast<int64_t>(1e9 / config.idle_update_rate));
+    cm->wait_for_control_loop_notification(std::chrono::steady_clock::now() + idle_period);
+  }
+  else
+  {
+    while (!cm->wait_for_control_loop_notification(
+             std::chrono::steady_clock::now() + kMaximumIdleWait) &&
+           rclcpp::ok())
+    {
+    }
+  }
+  // the full rate resumes from the wake-up, the idle period isn't an overrun
+  state.next_iteration_time = std::chrono::steady_clock::now();
 }
@@ -0,0 +1,126 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/warm_restart_checkpoint.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace controller_manager
+{
+namespace
+{
+constexpr char kCheckpointMagic[] = "ros2_control_warm_restart";
+
+bool read_state(std::istream & stream, uint8_t & state)
+{
+  // read as a number, not as a character
+  unsigned int value = 0;
+  if (!(stream >> value) || value > 255u)
+  {
+    return false;
+  }
+  state = static_cast<uint8_t>(value);
+  return true;
+}
+}  // namespace
+
+std::string serialize_warm_restart_checkpoint(const WarmRestartCheckpoint & checkpoint)
+{
+  // the names of the ROS nodes and the controller types have no white spaces
+  std::ostringstream stream;
+  stream << kCheckpointMagic << ' ' << WARM_RESTART_CHECKPOINT_VERSION << ' '
+         << checkpoint.robot_description_hash << '\n';
+  stream << checkpoint.hardware_components.size() << '\n';
+  for (const auto & component : checkpoint.hardware_components)
+  {
+    stream << component.name << ' ' << static_cast<unsigned int>(component.state) << '\n';
+  }
+  stream << checkpoint.controllers.size() << '\n';
+  for (const auto & controller : checkpoint.controllers)
+  {
+    stream << controller.name << ' ' << controller.type << ' '
+           << static_cast<unsigned int>(controller.state) << '\n';
+  }
+  return stream.str();
+}
+
+WarmRestartCheckpoint deserialize_warm_restart_checkpoint(const std::string & data)
+{
+  std::istringstream stream(data);
+  std::string magic;
+  int version = 0;
+  WarmRestartCheckpoint checkpoint;
+  if (
+    !(stream >> magic >> version >> checkpoint.robot_description_hash) ||
+    magic != kCheckpointMagic || version != WARM_RESTART_CHECKPOINT_VERSION)
+  {
+    throw std::runtime_error("The warm restart checkpoint is of an unknown format or version.");
+  }
+  std::size_t count = 0;
+  bool is_valid = static_cast<bool>(stream >> count);
+  for (std::size_t i = 0; is_valid && i < count; ++i)
+  {
+    WarmRestartCheckpoint::HardwareComponent component;
+    is_valid = (stream >> component.name) && read_state(stream, component.state);
+    checkpoint.hardware_components.push_back(std::move(component));
+  }
+  is_valid = is_valid && (stream >> count);
+  for (std::size_t i = 0; is_valid && i < count; ++i)
+  {
+    WarmRestartCheckpoint::Controller controller;
+    is_valid =
+      (stream >> controller.name >> controller.type) && read_state(stream, controller.state);
+    checkpoint.controllers.push_back(std::move(controller));
+  }
+  if (!is_valid)
+  {
+    throw std::runtime_error("The warm restart checkpoint is truncated or malformed.");
+  }
+  return checkpoint;
+}
+
+bool write_warm_restart_checkpoint(
+  const std::string & file_path, const WarmRestartCheckpoint & checkpoint)
+{
+  const std::string temporary_file = file_path + ".tmp";
+  {
+    std::ofstream file(temporary_file, std::ios::trunc);
+    file << serialize_warm_restart_checkpoint(checkpoint);
+    if (!file)
+    {
+      return false;
+    }
+  }
+  return std::rename(temporary_file.c_str(), file_path.c_str()) == 0;
+}
+
+bool read_warm_restart_checkpoint(
+  const std::string & file_path, WarmRestartCheckpoint & checkpoint)
+{
+  std::ifstream file(file_path);
+  if (!file)
+  {
+    return false;
+  }
+  checkpoint = deserialize_warm_restart_checkpoint(
+    std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+  return true;
+}
+
+}  // namespace controller_manager
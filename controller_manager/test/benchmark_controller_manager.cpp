@@ -0,0 +1,311 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "controller_manager/controller_manager.hpp"
+#include "controller_manager_msgs/srv/switch_controller.hpp"
+#include "hardware_interface/allocation_hook.hpp"
+#include "hardware_interface/allocation_tracker.hpp"
+#include "rclcpp/executors/single_threaded_executor.hpp"
+#include "rclcpp/utilities.hpp"
+#include "test_chainable_controller/test_chainable_controller.hpp"
+
+// Count the heap allocations like the ros2_control_node. Only the thread calling the controller
+// manager is tracked, so allocations of the worker pools or of the background threads are not
+// included.
+HARDWARE_INTERFACE_DEFINE_ALLOCATION_HOOK();
+
+namespace
+{
+const auto PERIOD = rclcpp::Duration::from_seconds(0.001);
+
+/// Description of the benchmarked setup, taken from the benchmark arguments
+struct BenchmarkSetup
+{
+  explicit BenchmarkSetup(const benchmark::State & state)
+  : number_of_joints(static_cast<std::size_t>(state.range(0))),
+    number_of_components(static_cast<std::size_t>(state.range(1))),
+    number_of_chained_controllers(static_cast<std::size_t>(state.range(2)))
+  {
+  }
+
+  std::size_t number_of_joints;
+  std::size_t number_of_components;
+  std::size_t number_of_chained_controllers;
+};
+
+std::string joint_name(std::size_t index) { return "joint" + std::to_string(index + 1); }
+
+std::string chained_controller_name(std::size_t index)
+{
+  return "chained_controller_" + std::to_string(index + 1);
+}
+
+/// Generates a serial robot with the joints distributed over mock system components
+std::string generate_robot_description(const BenchmarkSetup & setup)
+{
+  std::string urdf = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<robot name=\"Benchmark\">\n";
+  urdf += "  <link name=\"base_link\"/>\n";
+  for (std::size_t i = 0; i < setup.number_of_joints; ++i)
+  {
+    const std::string parent = i == 0 ? "base_link" : "link" + std::to_string(i);
+    urdf += "  <link name=\"link" + std::to_string(i + 1) + "\"/>\n";
+    urdf += "  <joint name=\"" + joint_name(i) + "\" type=\"revolute\">\n";
+    urdf += "    <parent link=\"" + parent + "\"/>\n";
+    urdf += "    <child link=\"link" + std::to_string(i + 1) + "\"/>\n";
+    urdf += "    <axis xyz=\"0 0 1\"/>\n";
+    urdf += "    <limit effort=\"100\" lower=\"-3.14\" upper=\"3.14\" velocity=\"10\"/>\n";
+    urdf += "  </joint>\n";
+  }
+  for (std::size_t c = 0; c < setup.number_of_components; ++c)
+  {
+    urdf += "  <ros2_control name=\"BenchmarkSystem" + std::to_string(c + 1) +
+            "\" type=\"system\">\n";
+    urdf += "    <hardware>\n      <plugin>mock_components/GenericSystem</plugin>\n";
+    urdf += "    </hardware>\n";
+    for (std::size_t i = c; i < setup.number_of_joints; i += setup.number_of_components)
+    {
+      urdf += "    <joint name=\"" + joint_name(i) + "\">\n";
+      urdf += "      <command_interface name=\"position\"/>\n";
+      urdf += "      <state_interface name=\"position\"/>\n";
+      urdf += "      <state_interface name=\"velocity\"/>\n";
+      urdf += "    </joint>\n";
+    }
+    urdf += "  </ros2_control>\n";
+  }
+  urdf += "</robot>\n";
+  return urdf;
+}
+
+/// Reports the latency percentiles of the measured iterations in microseconds
+void report_latencies(benchmark::State & state, std::vector<double> & latencies)
+{
+  if (latencies.empty())
+  {
+    return;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  const auto percentile = [&latencies](double p)
+  {
+    const auto index = static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1));
+    return latencies[index];
+  };
+  state.counters["p50_us"] = percentile(0.5);
+  state.counters["p90_us"] = percentile(0.9);
+  state.counters["p99_us"] = percentile(0.99);
+  state.counters["p99.9_us"] = percentile(0.999);
+  state.counters["max_us"] = latencies.back();
+}
+
+void report_allocations(benchmark::State & state, uint64_t allocations)
+{
+  state.counters["allocs_per_iteration"] =
+    benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+class ControllerManagerBenchmark : public benchmark::Fixture
+{
+public:
+  void SetUp(benchmark::State & state) override
+  {
+    if (!rclcpp::ok())
+    {
+      rclcpp::init(0, nullptr);
+    }
+    const BenchmarkSetup setup(state);
+    executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+    rclcpp::NodeOptions cm_node_options = controller_manager::get_cm_node_options();
+    cm_node_options.parameter_overrides(
+      {rclcpp::Parameter("allocation_tracking.enable", true),
+       rclcpp::Parameter("allocation_tracking.on_allocation_in_update", "none")});
+    cm_ = std::make_shared<controller_manager::ControllerManager>(
+      executor_, generate_robot_description(setup), true, "benchmark_controller_manager", "",
+      cm_node_options);
+    time_ = rclcpp::Time(0, 0, cm_->get_trigger_clock()->get_clock_type());
+
+    // The first controller of the chain receives the references and the last one writes the
+    // hardware commands
+    for (std::size_t k = 0; k < setup.number_of_chained_controllers; ++k)
+    {
+      auto controller = std::make_shared<test_chainable_controller::TestChainableController>();
+      controller_interface::InterfaceConfiguration cmd_cfg{
+        controller_interface::interface_configuration_type::INDIVIDUAL, {}};
+      controller_interface::InterfaceConfiguration state_cfg{
+        controller_interface::interface_configuration_type::INDIVIDUAL, {}};
+      std::vector<std::string> reference_interfaces;
+      for (std::size_t i = 0; i < setup.number_of_joints; ++i)
+      {
+        const std::string interface = joint_name(i) + "/position";
+        cmd_cfg.names.push_back(
+          k + 1 < setup.number_of_chained_controllers
+            ? chained_controller_name(k + 1) + "/" + interface
+            : interface);
+        state_cfg.names.push_back(interface);
+        reference_interfaces.push_back(interface);
+      }
+      controller->set_command_interface_configuration(cmd_cfg);
+      controller->set_state_interface_configuration(state_cfg);
+      controller->set_reference_interface_names(reference_interfaces);
+      cm_->add_controller(
+        controller, chained_controller_name(k),
+        test_chainable_controller::TEST_CONTROLLER_CLASS_NAME);
+      controllers_.push_back(controller);
+    }
+    for (std::size_t k = 0; k < setup.number_of_chained_controllers; ++k)
+    {
+      cm_->configure_controller(chained_controller_name(k));
+    }
+    // Activate the chain starting from the controller writing to the hardware
+    for (std::size_t k = setup.number_of_chained_controllers; k > 0; --k)
+    {
+      switch_controllers({chained_controller_name(k - 1)}, {});
+    }
+  }
+
+  void TearDown(benchmark::State &) override
+  {
+    controllers_.clear();
+    cm_.reset();
+    executor_.reset();
+  }
+
+protected:
+  /// Switches the controllers while running the control loop, returns the switch time
+  double switch_controllers(
+    const std::vector<std::string> & activate, const std::vector<std::string> & deactivate)
+  {
+    auto switch_future = std::async(
+      std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+      activate, deactivate, controller_manager_msgs::srv::SwitchController::Request::STRICT, true,
+      rclcpp::Duration(0, 0));
+    double switch_time = 0.0;
+    while (switch_future.wait_for(std::chrono::microseconds(10)) != std::future_status::ready)
+    {
+      cycle();
+      switch_time = std::max(switch_time, cm_->get_execution_time().switch_time);
+    }
+    if (switch_future.get() != controller_interface::return_type::OK)
+    {
+      throw std::runtime_error("Switching the benchmark controllers failed.");
+    }
+    return switch_time;
+  }
+
+  void cycle()
+  {
+    cm_->read(time_, PERIOD);
+    cm_->update(time_, PERIOD);
+    cm_->write(time_, PERIOD);
+  }
+
+  std::shared_ptr<rclcpp::Executor> executor_;
+  std::shared_ptr<controller_manager::ControllerManager> cm_;
+  std::vector<std::shared_ptr<test_chainable_controller::TestChainableController>> controllers_;
+  rclcpp::Time time_;
+};
+
+/// Runs the given phase once per iteration and reports its latency distribution and allocations
+template <typename PhaseT>
+void run_phase_benchmark(benchmark::State & state, PhaseT && phase)
+{
+  using hardware_interface::AllocationTracker;
+  std::vector<double> latencies;
+  latencies.reserve(static_cast<std::size_t>(state.max_iterations));
+  uint64_t allocations = 0;
+  AllocationTracker::set_tracking_enabled(true);
+  for (auto _ : state)
+  {
+    const uint64_t allocations_before = AllocationTracker::get_allocation_count();
+    const auto start = std::chrono::steady_clock::now();
+    phase();
+    const auto end = std::chrono::steady_clock::now();
+    allocations += AllocationTracker::get_allocation_count() - allocations_before;
+    if (latencies.size() < latencies.capacity())
+    {
+      latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+  }
+  AllocationTracker::set_tracking_enabled(false);
+  report_allocations(state, allocations);
+  report_latencies(state, latencies);
+}
+
+void benchmark_arguments(benchmark::internal::Benchmark * benchmark)
+{
+  // number of joints, number of hardware components, number of chained controllers
+  benchmark->ArgNames({"joints", "components", "chained"});
+  benchmark->Args({6, 1, 1});
+  benchmark->Args({24, 4, 2});
+  benchmark->Args({96, 8, 4});
+  benchmark->Args({384, 16, 8});
+}
+}  // namespace
+
+BENCHMARK_DEFINE_F(ControllerManagerBenchmark, read)(benchmark::State & state)
+{
+  run_phase_benchmark(state, [this]() { cm_->read(time_, PERIOD); });
+}
+BENCHMARK_REGISTER_F(ControllerManagerBenchmark, read)->Apply(benchmark_arguments);
+
+BENCHMARK_DEFINE_F(ControllerManagerBenchmark, update)(benchmark::State & state)
+{
+  run_phase_benchmark(state, [this]() { cm_->update(time_, PERIOD); });
+}
+BENCHMARK_REGISTER_F(ControllerManagerBenchmark, update)->Apply(benchmark_arguments);
+
+BENCHMARK_DEFINE_F(ControllerManagerBenchmark, write)(benchmark::State & state)
+{
+  run_phase_benchmark(state, [this]() { cm_->write(time_, PERIOD); });
+}
+BENCHMARK_REGISTER_F(ControllerManagerBenchmark, write)->Apply(benchmark_arguments);
+
+BENCHMARK_DEFINE_F(ControllerManagerBenchmark, cycle)(benchmark::State & state)
+{
+  run_phase_benchmark(state, [this]() { cycle(); });
+}
+BENCHMARK_REGISTER_F(ControllerManagerBenchmark, cycle)->Apply(benchmark_arguments);
+
+// Deactivates and reactivates the head of the chain, the reported time is the real-time part of
+// the switch as measured by the controller manager
+BENCHMARK_DEFINE_F(ControllerManagerBenchmark, controller_switch)(benchmark::State & state)
+{
+  const std::vector<std::string> head = {chained_controller_name(0)};
+  std::vector<double> latencies;
+  latencies.reserve(2 * static_cast<std::size_t>(state.max_iterations));
+  for (auto _ : state)
+  {
+    const double deactivation_time = switch_controllers({}, head);
+    const double activation_time = switch_controllers(head, {});
+    state.SetIterationTime((deactivation_time + activation_time) * 1.e-6);
+    if (latencies.size() < latencies.capacity())
+    {
+      latencies.push_back(deactivation_time);
+      latencies.push_back(activation_time);
+    }
+  }
+  report_latencies(state, latencies);
+}
+BENCHMARK_REGISTER_F(ControllerManagerBenchmark, controller_switch)
+  ->Apply(benchmark_arguments)
+  ->UseManualTime()
+  ->Iterations(100);
@@ -0,0 +1,325 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "controller_manager/controller_manager.hpp"
+#include "controller_manager_msgs/srv/switch_controller.hpp"
+#include "rclcpp/executors/single_threaded_executor.hpp"
+#include "rclcpp/utilities.hpp"
+#include "ros2_control_test_assets/generated_descriptions.hpp"
+#include "test_chainable_controller/test_chainable_controller.hpp"
+#include "test_controller/test_controller.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using controller_manager_msgs::srv::SwitchController;
+
+const auto PERIOD = rclcpp::Duration::from_seconds(0.001);
+constexpr char SWITCHED_CONTROLLER[] = "switched_controller";
+constexpr char CHAINABLE_CONTROLLER[] = "chainable_controller";
+/// Upper bounds of the buckets of the latency histogram in microseconds, the last bucket counts
+/// the larger latencies
+constexpr double HISTOGRAM_FIRST_BOUND_US = 8.0;
+constexpr std::size_t HISTOGRAM_BUCKETS = 16;
+
+int64_t now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+    .count();
+}
+
+/// Controller recording the time of its first update after its activation
+class SwitchedController : public test_controller::TestController
+{
+public:
+  controller_interface::return_type update(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override
+  {
+    if (first_update_ns.load(std::memory_order_relaxed) == 0)
+    {
+      first_update_ns.store(now_ns(), std::memory_order_release);
+    }
+    return TestController::update(time, period);
+  }
+
+  std::atomic<int64_t> first_update_ns{0};
+};
+
+/// Description of the benchmarked switch, taken from the benchmark arguments
+struct SwitchSetup
+{
+  explicit SwitchSetup(const benchmark::State & state)
+  : strictness(static_cast<int>(state.range(0))),
+    activate_asap(state.range(1) != 0),
+    chained(state.range(2) != 0),
+    number_of_joints(static_cast<std::size_t>(state.range(3)))
+  {
+  }
+
+  int strictness;
+  bool activate_asap;
+  bool chained;
+  std::size_t number_of_joints;
+};
+
+/// Latencies of the switches in a constant memory histogram with logarithmic buckets
+class LatencyHistogram
+{
+public:
+  void add(double latency_us)
+  {
+    std::size_t bucket = 0;
+    for (double bound = HISTOGRAM_FIRST_BOUND_US;
+         bucket + 1 < HISTOGRAM_BUCKETS && latency_us > bound; bound *= 2.0)
+    {
+      ++bucket;
+    }
+    ++counts_[bucket];
+    latencies_.push_back(latency_us);
+  }
+
+  /// Reports the percentiles and the counts of the buckets, exported with the other counters by
+  /// --benchmark_out_format=json
+  void report(benchmark::State & state, const std::string & prefix)
+  {
+    if (latencies_.empty())
+    {
+      return;
+    }
+    std::sort(latencies_.begin(), latencies_.end());
+    const auto percentile = [this](double p)
+    {
+      const auto index = static_cast<std::size_t>(p * static_cast<double>(latencies_.size() - 1));
+      return latencies_[index];
+    };
+    state.counters[prefix + "_p50_us"] = percentile(0.5);
+    state.counters[prefix + "_p99_us"] = percentile(0.99);
+    state.counters[prefix + "_max_us"] = latencies_.back();
+    double bound = HISTOGRAM_FIRST_BOUND_US;
+    for (std::size_t bucket = 0; bucket < HISTOGRAM_BUCKETS; ++bucket, bound *= 2.0)
+    {
+      const std::string name = bucket + 1 < HISTOGRAM_BUCKETS
+                                 ? prefix + "_le_" + std::to_string(static_cast<int>(bound)) + "_us"
+                                 : prefix + "_gt_" + std::to_string(static_cast<int>(bound / 2.0)) +
+                                     "_us";
+      state.counters[name] = static_cast<double>(counts_[bucket]);
+    }
+  }
+
+private:
+  std::array<uint64_t, HISTOGRAM_BUCKETS> counts_ = {};
+  std::vector<double> latencies_;
+};
+
+/// Averages of the phases of the switches in microseconds
+void report_phase(benchmark::State & state, const std::string & name, double total_us)
+{
+  state.counters[name + "_us"] = benchmark::Counter(total_us, benchmark::Counter::kAvgIterations);
+}
+
+class ControllerSwitchBenchmark : public benchmark::Fixture
+{
+public:
+  void SetUp(benchmark::State & state) override
+  {
+    if (!rclcpp::ok())
+    {
+      rclcpp::init(0, nullptr);
+    }
+    const SwitchSetup setup(state);
+    ros2_control_test_assets::GeneratedDescriptionParameters parameters;
+    parameters.joints_per_system = setup.number_of_joints;
+    executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+    cm_ = std::make_shared<controller_manager::ControllerManager>(
+      executor_, ros2_control_test_assets::generate_robot_description(parameters), true,
+      "benchmark_controller_switch", "", controller_manager::get_cm_node_options());
+    time_ = rclcpp::Time(0, 0, cm_->get_trigger_clock()->get_clock_type());
+
+    controller_interface::InterfaceConfiguration hardware_commands{
+      controller_interface::interface_configuration_type::INDIVIDUAL, {}};
+    controller_interface::InterfaceConfiguration references{
+      controller_interface::interface_configuration_type::INDIVIDUAL, {}};
+    controller_interface::InterfaceConfiguration states{
+      controller_interface::interface_configuration_type::INDIVIDUAL, {}};
+    std::vector<std::string> reference_interfaces;
+    for (std::size_t j = 0; j < setup.number_of_joints; ++j)
+    {
+      const std::string interface =
+        ros2_control_test_assets::generated_joint_name(0, j) + "/position";
+      hardware_commands.names.push_back(interface);
+      references.names.push_back(std::string(CHAINABLE_CONTROLLER) + "/" + interface);
+      states.names.push_back(interface);
+      reference_interfaces.push_back(interface);
+    }
+
+    // the switched controller claims the references of an active chainable controller, which is
+    // switched to chained mode with it
+    if (setup.chained)
+    {
+      auto chainable = std::make_shared<test_chainable_controller::TestChainableController>();
+      chainable->set_command_interface_configuration(hardware_commands);
+      chainable->set_state_interface_configuration(states);
+      chainable->set_reference_interface_names(reference_interfaces);
+      cm_->add_controller(
+        chainable, CHAINABLE_CONTROLLER, test_chainable_controller::TEST_CONTROLLER_CLASS_NAME);
+      cm_->configure_controller(CHAINABLE_CONTROLLER);
+    }
+    controller_ = std::make_shared<SwitchedController>();
+    controller_->set_command_interface_configuration(
+      setup.chained ? references : hardware_commands);
+    controller_->set_state_interface_configuration(states);
+    cm_->add_controller(
+      controller_, SWITCHED_CONTROLLER, test_controller::TEST_CONTROLLER_CLASS_NAME);
+    cm_->configure_controller(SWITCHED_CONTROLLER);
+
+    stop_ = false;
+    realtime_thread_ = std::thread(&ControllerSwitchBenchmark::run_control_loop, this);
+    if (setup.chained)
+    {
+      switch_controllers({CHAINABLE_CONTROLLER}, {}, SwitchController::Request::STRICT, true);
+    }
+  }
+
+  void TearDown(benchmark::State &) override
+  {
+    stop_ = true;
+    realtime_thread_.join();
+    controller_.reset();
+    cm_.reset();
+    executor_.reset();
+  }
+
+protected:
+  /// Runs the control loop at its period, like the ros2_control_node
+  void run_control_loop()
+  {
+    auto next_cycle = Clock::now();
+    while (!stop_.load())
+    {
+      cm_->read(time_, PERIOD);
+      cm_->update(time_, PERIOD);
+      cm_->write(time_, PERIOD);
+      const double switch_time = cm_->get_execution_time().switch_time;
+      if (switch_time > 0.0)
+      {
+        realtime_switch_time_us_.store(switch_time);
+      }
+      next_cycle += PERIOD.to_chrono<std::chrono::nanoseconds>();
+      std::this_thread::sleep_until(next_cycle);
+    }
+  }
+
+  void switch_controllers(
+    const std::vector<std::string> & activate, const std::vector<std::string> & deactivate,
+    int strictness, bool activate_asap)
+  {
+    if (
+      cm_->switch_controller(
+        activate, deactivate, strictness, activate_asap, rclcpp::Duration(0, 0)) !=
+      controller_interface::return_type::OK)
+    {
+      throw std::runtime_error("Switching the benchmark controllers failed.");
+    }
+  }
+
+  std::shared_ptr<rclcpp::Executor> executor_;
+  std::shared_ptr<controller_manager::ControllerManager> cm_;
+  std::shared_ptr<SwitchedController> controller_;
+  rclcpp::Time time_;
+  std::thread realtime_thread_;
+  std::atomic<bool> stop_{false};
+  std::atomic<double> realtime_switch_time_us_{0.0};
+};
+
+void benchmark_arguments(benchmark::internal::Benchmark * benchmark)
+{
+  benchmark->ArgNames({"strictness", "activate_asap", "chained", "joints"});
+  for (const int64_t strictness :
+       {SwitchController::Request::STRICT, SwitchController::Request::BEST_EFFORT})
+  {
+    for (const int64_t activate_asap : {0, 1})
+    {
+      for (const int64_t chained : {0, 1})
+      {
+        for (const int64_t joints : {6, 48, 384})
+        {
+          benchmark->Args({strictness, activate_asap, chained, joints});
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+// Activates the switched controller and waits for its first update, the manual time is the wall
+// time from the switch_controller call until this update. The controller is deactivated again
+// between the measurements.
+BENCHMARK_DEFINE_F(ControllerSwitchBenchmark, activation)(benchmark::State & state)
+{
+  const SwitchSetup setup(state);
+  LatencyHistogram histogram;
+  double prepare_us = 0.0;
+  double realtime_acknowledge_us = 0.0;
+  double realtime_switch_us = 0.0;
+  double non_realtime_switch_us = 0.0;
+  double list_release_us = 0.0;
+  for (auto _ : state)
+  {
+    controller_->first_update_ns.store(0);
+    realtime_switch_time_us_.store(0.0);
+    const int64_t start_ns = now_ns();
+    switch_controllers({SWITCHED_CONTROLLER}, {}, setup.strictness, setup.activate_asap);
+    int64_t first_update_ns = 0;
+    while ((first_update_ns = controller_->first_update_ns.load(std::memory_order_acquire)) == 0)
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+    const double latency_us = static_cast<double>(first_update_ns - start_ns) * 1.e-3;
+    state.SetIterationTime(latency_us * 1.e-6);
+    histogram.add(latency_us);
+
+    const auto & switch_time = cm_->get_last_switch_time();
+    prepare_us += switch_time.prepare_time;
+    realtime_acknowledge_us += switch_time.realtime_acknowledge_time;
+    realtime_switch_us += realtime_switch_time_us_.load();
+    non_realtime_switch_us += switch_time.non_realtime_switch_time;
+    list_release_us += switch_time.list_release_time;
+
+    switch_controllers({}, {SWITCHED_CONTROLLER}, setup.strictness, setup.activate_asap);
+  }
+  report_phase(state, "prepare", prepare_us);
+  report_phase(state, "realtime_acknowledge", realtime_acknowledge_us);
+  report_phase(state, "realtime_switch", realtime_switch_us);
+  report_phase(state, "non_realtime_switch", non_realtime_switch_us);
+  report_phase(state, "list_release", list_release_us);
+  histogram.report(state, "latency");
+}
+BENCHMARK_REGISTER_F(ControllerSwitchBenchmark, activation)
+  ->Apply(benchmark_arguments)
+  ->UseManualTime()
+  ->Unit(benchmark::kMicrosecond)
+  ->Iterations(200);
@@ -0,0 +1,206 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "controller_manager/controller_manager.hpp"
+#include "hardware_interface/component_parser.hpp"
+#include "rclcpp/executors/single_threaded_executor.hpp"
+#include "rclcpp/utilities.hpp"
+#include "ros2_control_test_assets/generated_descriptions.hpp"
+#include "test_controller/test_controller.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(const Clock::time_point & start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// Peak resident set size of the process in megabytes, it never decreases
+double peak_rss_mb()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0.0;
+  }
+  // kilobytes on Linux
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;
+}
+
+std::string controller_name(std::size_t system)
+{
+  return "controller_" + std::to_string(system + 1);
+}
+
+/// Durations of the bringup phases of one iteration in milliseconds
+struct StartupPhases
+{
+  void add_to(StartupPhases & total) const
+  {
+    total.parse += parse;
+    total.controller_manager += controller_manager;
+    total.load_components += load_components;
+    total.initial_hardware_state += initial_hardware_state;
+    total.load_controllers += load_controllers;
+    total.configure_controllers += configure_controllers;
+  }
+
+  double total() const
+  {
+    return parse + controller_manager + load_controllers + configure_controllers;
+  }
+
+  double parse = 0.0;
+  /// Construction of the controller manager, including the loading of the components and the
+  /// setting of their initial state
+  double controller_manager = 0.0;
+  double load_components = 0.0;
+  double initial_hardware_state = 0.0;
+  double load_controllers = 0.0;
+  double configure_controllers = 0.0;
+};
+
+/// Brings up the controller manager with the generated description and a controller per system
+/// claiming the interfaces of its joints, like a ros2_control_node with its spawners.
+StartupPhases bringup(
+  const std::string & robot_description,
+  const ros2_control_test_assets::GeneratedDescriptionParameters & parameters)
+{
+  StartupPhases phases;
+  // the controller manager parses the description again, the parsing alone is measured here
+  auto start = Clock::now();
+  const auto hardware_info =
+    hardware_interface::parse_control_resources_from_urdf(robot_description);
+  phases.parse = elapsed_ms(start);
+  benchmark::DoNotOptimize(hardware_info.data());
+
+  auto executor = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  start = Clock::now();
+  auto cm = std::make_shared<controller_manager::ControllerManager>(
+    executor, robot_description, false, "benchmark_controller_manager", "",
+    controller_manager::get_cm_node_options());
+  phases.controller_manager = elapsed_ms(start);
+  phases.load_components = cm->get_startup_time().load_components_time;
+  phases.initial_hardware_state = cm->get_startup_time().initial_hardware_state_time;
+  if (!cm->is_resource_manager_initialized())
+  {
+    throw std::runtime_error("The benchmark hardware components could not be loaded.");
+  }
+
+  std::vector<controller_interface::ControllerInterfaceBaseSharedPtr> controllers;
+  start = Clock::now();
+  for (std::size_t s = 0; s < parameters.number_of_systems; ++s)
+  {
+    auto controller =
+      cm->load_controller(controller_name(s), test_controller::TEST_CONTROLLER_CLASS_NAME);
+    if (!controller)
+    {
+      throw std::runtime_error("The benchmark controllers could not be loaded.");
+    }
+    controllers.push_back(controller);
+  }
+  phases.load_controllers = elapsed_ms(start);
+
+  for (std::size_t s = 0; s < parameters.number_of_systems; ++s)
+  {
+    std::vector<std::string> command_interfaces;
+    std::vector<std::string> state_interfaces;
+    for (std::size_t j = 0; j < parameters.joints_per_system; ++j)
+    {
+      const std::string joint = ros2_control_test_assets::generated_joint_name(s, j);
+      command_interfaces.push_back(joint + "/position");
+      state_interfaces.push_back(joint + "/position");
+      state_interfaces.push_back(joint + "/velocity");
+    }
+    controllers[s]->get_node()->declare_parameter("command_interfaces", command_interfaces);
+    controllers[s]->get_node()->declare_parameter("state_interfaces", state_interfaces);
+  }
+  start = Clock::now();
+  for (std::size_t s = 0; s < parameters.number_of_systems; ++s)
+  {
+    if (cm->configure_controller(controller_name(s)) != controller_interface::return_type::OK)
+    {
+      throw std::runtime_error("The benchmark controllers could not be configured.");
+    }
+  }
+  phases.configure_controllers = elapsed_ms(start);
+  return phases;
+}
+
+void report_phases(benchmark::State & state, const StartupPhases & total)
+{
+  const auto average = [](double value)
+  { return benchmark::Counter(value, benchmark::Counter::kAvgIterations); };
+  state.counters["parse_ms"] = average(total.parse);
+  state.counters["controller_manager_ms"] = average(total.controller_manager);
+  state.counters["load_components_ms"] = average(total.load_components);
+  state.counters["initial_hardware_state_ms"] = average(total.initial_hardware_state);
+  state.counters["load_controllers_ms"] = average(total.load_controllers);
+  state.counters["configure_controllers_ms"] = average(total.configure_controllers);
+  // the peak of the whole process, run a single size with --benchmark_filter for its own peak
+  state.counters["peak_rss_mb"] = peak_rss_mb();
+}
+}  // namespace
+
+// Times the bringup phases of the controller manager, the manual time is their sum and excludes the
+// shutdown of the controller manager
+static void startup(benchmark::State & state)
+{
+  if (!rclcpp::ok())
+  {
+    rclcpp::init(0, nullptr);
+  }
+  ros2_control_test_assets::GeneratedDescriptionParameters parameters;
+  parameters.number_of_systems = static_cast<std::size_t>(state.range(0));
+  parameters.joints_per_system = static_cast<std::size_t>(state.range(1));
+  parameters.sensors_per_system = static_cast<std::size_t>(state.range(2));
+  const std::string robot_description =
+    ros2_control_test_assets::generate_robot_description(parameters);
+
+  StartupPhases total;
+  for (auto _ : state)
+  {
+    const StartupPhases phases = bringup(robot_description, parameters);
+    phases.add_to(total);
+    state.SetIterationTime(phases.total() * 1.e-3);
+  }
+  state.counters["interfaces"] = static_cast<double>(
+    parameters.number_of_systems *
+    (parameters.joints_per_system * (parameters.joint_command_interfaces.size() +
+                                     parameters.joint_state_interfaces.size()) +
+     parameters.sensors_per_system * parameters.sensor_state_interfaces.size()));
+  report_phases(state, total);
+}
+BENCHMARK(startup)
+  ->ArgNames({"systems", "joints", "sensors"})
+  ->Args({1, 6, 1})
+  ->Args({4, 12, 2})
+  ->Args({16, 16, 4})
+  ->Args({64, 16, 4})
+  ->Args({128, 24, 8})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond)
+  ->Iterations(5);
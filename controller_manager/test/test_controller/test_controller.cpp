@@ -183,6 +183,35 @@ CallbackReturn TestController::on_configure(const rclcpp_lifecycle::State & /*pr
   return CallbackReturn::SUCCESS;
 }
 
+controller_interface::return_type TestController::on_handover(
+  const controller_interface::ControllerInterfaceBase & previous_controller)
+{
+  const auto * previous_test_controller = dynamic_cast<const TestController *>(&previous_controller);
+  if (previous_test_controller == nullptr)
+  {
+    return controller_interface::return_type::ERROR;
+  }
+  handed_over_counter = previous_test_controller->internal_counter;
+  return controller_interface::return_type::OK;
+}
+
+controller_interface::return_type TestController::on_shadow_activate()
+{
+  if (external_commands_for_testing_.size() != command_interfaces_.size())
+  {
+    external_commands_for_testing_.resize(command_interfaces_.size(), 0.0);
+  }
+  return controller_interface::return_type::OK;
+}
+
+controller_interface::return_type TestController::on_prepare_activate()
+{
+  ++prepare_activate_calls;
+  prepare_activate_lifecycle_id = get_lifecycle_id();
+  return fail_prepare_activate ? controller_interface::return_type::ERROR
+                               : controller_interface::return_type::OK;
+}
+
 CallbackReturn TestController::on_activate(const rclcpp_lifecycle::State & /*previous_state*/)
 {
   verify_internal_lifecycle_id(get_lifecycle_id(), get_lifecycle_state().id());
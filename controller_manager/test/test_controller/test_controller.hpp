@@ -48,6 +48,13 @@ public:
   controller_interface::return_type update(
     const rclcpp::Time & time, const rclcpp::Duration & period) override;
 
+  controller_interface::return_type on_handover(
+    const controller_interface::ControllerInterfaceBase & previous_controller) override;
+
+  controller_interface::return_type on_shadow_activate() override;
+
+  controller_interface::return_type on_prepare_activate() override;
+
   CallbackReturn on_init() override;
 
   CallbackReturn on_configure(const rclcpp_lifecycle::State & previous_state) override;
@@ -69,7 +76,13 @@ public:
 
   rclcpp::Service<example_interfaces::srv::SetBool>::SharedPtr service_;
   unsigned int internal_counter = 0;
+  // internal_counter of the controller replaced by this one in a swap
+  unsigned int handed_over_counter = 0;
   double activation_processing_time = 0.0;
+  // number of activation preparations and lifecycle id of the controller at the last one
+  unsigned int prepare_activate_calls = 0;
+  uint8_t prepare_activate_lifecycle_id = 0;
+  bool fail_prepare_activate = false;
   bool simulate_cleanup_failure = false;
   // Variable where we store when shutdown was called, pointer because the controller
   // is usually destroyed after shutdown
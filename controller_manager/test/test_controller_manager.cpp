@@ -11,14 +11,20 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "controller_manager/controller_manager.hpp"
 #include "controller_manager_msgs/msg/controller_manager_activity.hpp"
+#include "controller_manager_msgs/msg/controller_manager_activity_changes.hpp"
 #include "controller_manager_test_common.hpp"
 #include "gmock/gmock.h"
+#include "hardware_interface/hardware_info_cache.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
 #include "rclcpp/executor.hpp"
 #include "test_chainable_controller/test_chainable_controller.hpp"
@@ -101,6 +107,188 @@ TEST_F(TestControllerManagerRobotDescription, controller_robot_description_updat
     test_controller2->get_robot_description());
 }
 
+class TestControllerManagerControllerIds
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+};
+
+TEST_F(TestControllerManagerControllerIds, unloaded_controller_ids_are_reused)
+{
+  const auto get_controller_id = [this](const std::string & name)
+  {
+    for (const auto & controller : cm_->get_loaded_controllers())
+    {
+      if (controller.info.name == name)
+      {
+        return controller.id;
+      }
+    }
+    return std::numeric_limits<std::size_t>::max();
+  };
+  for (const auto & name : {"test_controller_1", "test_controller_2", "test_controller_3"})
+  {
+    cm_->add_controller(
+      std::make_shared<test_controller::TestController>(), name,
+      test_controller::TEST_CONTROLLER_CLASS_NAME);
+  }
+  EXPECT_EQ(0u, get_controller_id("test_controller_1"));
+  EXPECT_EQ(1u, get_controller_id("test_controller_2"));
+  EXPECT_EQ(2u, get_controller_id("test_controller_3"));
+
+  {
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(
+      controller_interface::return_type::OK, cm_->unload_controller("test_controller_2"));
+  }
+  cm_->add_controller(
+    std::make_shared<test_controller::TestController>(), "test_controller_4",
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  EXPECT_EQ(1u, get_controller_id("test_controller_4"));
+  EXPECT_EQ(2u, get_controller_id("test_controller_3"));
+}
+
+class TestControllerManagerCycleContext
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+};
+
+TEST_F(TestControllerManagerCycleContext, cycle_context_is_shared_by_read_update_and_write)
+{
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  cm_->read(time_, period);
+  const auto cycle = cm_->get_cycle_context();
+  EXPECT_EQ(cycle.index, 1u);
+  EXPECT_EQ(cycle.period, period);
+  EXPECT_FALSE(cycle.overrun);
+  EXPECT_EQ(
+    cycle.deadline_ns - cycle.monotonic_ns,
+    1'000'000'000 / static_cast<int64_t>(cm_->get_update_rate()));
+
+  // the update and the write of the cycle reuse its times
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->update(time_, period));
+  cm_->write(time_, period);
+  EXPECT_EQ(cm_->get_cycle_context().index, 1u);
+  EXPECT_EQ(cm_->get_cycle_context().trigger_time, cycle.trigger_time);
+
+  // every update without a read begins a new cycle
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->update(time_, period));
+  EXPECT_EQ(cm_->get_cycle_context().index, 2u);
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->update(time_, period));
+  EXPECT_EQ(cm_->get_cycle_context().index, 3u);
+}
+
+class TestControllerManagerIdle
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+};
+
+TEST_F(TestControllerManagerIdle, controllers_activity_follows_the_active_controllers)
+{
+  using ControllersActivity = controller_manager::ControllerManager::ControllersActivity;
+  const auto strictness = controller_manager_msgs::srv::SwitchController::Request::STRICT;
+  EXPECT_EQ(cm_->get_controllers_activity(), ControllersActivity::NO_ACTIVE_CONTROLLERS);
+
+  auto broadcaster = std::make_shared<test_controller::TestController>();
+  broadcaster->set_state_interface_configuration(
+    {controller_interface::interface_configuration_type::ALL, {}});
+  cm_->add_controller(broadcaster, "test_broadcaster", test_controller::TEST_CONTROLLER_CLASS_NAME);
+  auto test_controller = std::make_shared<test_controller::TestController>();
+  test_controller->set_command_interface_configuration(
+    {controller_interface::interface_configuration_type::INDIVIDUAL, {"joint1/position"}});
+  cm_->add_controller(
+    test_controller, test_controller::TEST_CONTROLLER_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  {
+    ControllerManagerRunner cm_runner(this);
+    cm_->configure_controller("test_broadcaster");
+    cm_->configure_controller(test_controller::TEST_CONTROLLER_NAME);
+  }
+
+  // controllers claiming no command interface only read the states
+  switch_test_controllers({"test_broadcaster"}, {}, strictness);
+  EXPECT_EQ(cm_->get_controllers_activity(), ControllersActivity::STATE_ONLY);
+
+  switch_test_controllers({test_controller::TEST_CONTROLLER_NAME}, {}, strictness);
+  EXPECT_EQ(cm_->get_controllers_activity(), ControllersActivity::COMMANDING);
+
+  switch_test_controllers({}, {test_controller::TEST_CONTROLLER_NAME}, strictness);
+  EXPECT_EQ(cm_->get_controllers_activity(), ControllersActivity::STATE_ONLY);
+
+  switch_test_controllers({}, {"test_broadcaster"}, strictness);
+  EXPECT_EQ(cm_->get_controllers_activity(), ControllersActivity::NO_ACTIVE_CONTROLLERS);
+}
+
+TEST_F(TestControllerManagerIdle, control_loop_notification)
+{
+  // a wait without notification lasts until the given time
+  EXPECT_FALSE(cm_->wait_for_control_loop_notification(
+    std::chrono::steady_clock::now() + std::chrono::milliseconds(10)));
+
+  // a notification sent before the wait isn't missed
+  cm_->notify_control_loop();
+  const auto start_time = std::chrono::steady_clock::now();
+  EXPECT_TRUE(cm_->wait_for_control_loop_notification(start_time + std::chrono::seconds(10)));
+  EXPECT_LT(std::chrono::steady_clock::now() - start_time, std::chrono::seconds(1));
+
+  // a change of the controllers list wakes up the waiting control loop
+  auto wait_future = std::async(
+    std::launch::async, &controller_manager::ControllerManager::wait_for_control_loop_notification,
+    cm_, std::chrono::steady_clock::now() + std::chrono::seconds(10));
+  auto test_controller = std::make_shared<test_controller::TestController>();
+  cm_->add_controller(
+    test_controller, test_controller::TEST_CONTROLLER_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  EXPECT_TRUE(wait_future.get());
+}
+
+class TestControllerManagerMetrics
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+};
+
+TEST_F(TestControllerManagerMetrics, statistics_are_exported_as_openmetrics)
+{
+  auto test_controller = std::make_shared<test_controller::TestController>();
+  cm_->add_controller(
+    test_controller, test_controller::TEST_CONTROLLER_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  {
+    ControllerManagerRunner cm_runner(this);
+    cm_->configure_controller(test_controller::TEST_CONTROLLER_NAME);
+  }
+  switch_test_controllers({test_controller::TEST_CONTROLLER_NAME}, {}, STRICT);
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  for (int i = 0; i < 10; ++i)
+  {
+    cm_->read(time_, period);
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->update(time_, period));
+    cm_->write(time_, period);
+  }
+
+  const std::string metrics = cm_->export_metrics();
+  EXPECT_THAT(
+    metrics, testing::HasSubstr(
+               "# TYPE ros2_control_controller_execution_time_microseconds gauge\n"));
+  EXPECT_THAT(
+    metrics, testing::HasSubstr(
+               "ros2_control_controller_execution_time_microseconds{controller=\"" +
+               std::string(test_controller::TEST_CONTROLLER_NAME) + "\",quantile=\"0.99\"} "));
+  EXPECT_THAT(
+    metrics, testing::HasSubstr(
+               "ros2_control_controller_time_budget_overruns_total{controller=\"" +
+               std::string(test_controller::TEST_CONTROLLER_NAME) + "\"} 0\n"));
+  EXPECT_THAT(
+    metrics, testing::HasSubstr(
+               "ros2_control_hardware_component_execution_time_microseconds{component=\""
+               "TestActuatorHardware\",cycle=\"read\",statistic=\"average\"} "));
+  // the switch activating the controller is measured
+  EXPECT_THAT(
+    metrics, testing::HasSubstr(
+               "ros2_control_controller_manager_switch_latency_microseconds{"
+               "statistic=\"count\"} 1\n"));
+  EXPECT_THAT(metrics, testing::EndsWith("# EOF\n"));
+}
+
 TEST_P(TestControllerManagerWithStrictness, controller_lifecycle)
 {
   const auto test_param = GetParam();
@@ -822,6 +1010,44 @@ TEST_P(TestControllerManagerWithStrictness, per_controller_update_rate)
   EXPECT_EQ(test_controller->get_update_rate(), 4u);
 }
 
+TEST_P(TestControllerManagerWithStrictness, step_runs_back_to_back_cycles)
+{
+  auto strictness = GetParam().strictness;
+  auto test_controller = std::make_shared<test_controller::TestController>();
+  cm_->add_controller(
+    test_controller, test_controller::TEST_CONTROLLER_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  {
+    ControllerManagerRunner cm_runner(this);
+    cm_->configure_controller(test_controller::TEST_CONTROLLER_NAME);
+  }
+
+  std::vector<std::string> start_controllers = {test_controller::TEST_CONTROLLER_NAME};
+  std::vector<std::string> stop_controllers = {};
+  auto switch_future = std::async(
+    std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+    start_controllers, stop_controllers, strictness, true, rclcpp::Duration(0, 0));
+  ASSERT_EQ(std::future_status::timeout, switch_future.wait_for(std::chrono::milliseconds(100)))
+    << "switch_controller should be blocking until next update cycle";
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+  {
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(controller_interface::return_type::OK, switch_future.get());
+  }
+  ASSERT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, test_controller->get_lifecycle_state().id());
+
+  // the cycles run without waiting and the time advances by the period of the update rate
+  const auto counter_before = test_controller->internal_counter;
+  const rclcpp::Time end_time = cm_->step(time_, 10u);
+  EXPECT_EQ(counter_before + 10u, test_controller->internal_counter);
+  const rclcpp::Duration period(
+    std::chrono::nanoseconds(1'000'000'000 / cm_->get_update_rate()));
+  EXPECT_EQ((time_ + period * 10.0).nanoseconds(), end_time.nanoseconds());
+}
+
 INSTANTIATE_TEST_SUITE_P(
   test_strict_best_effort, TestControllerManagerWithStrictness,
   testing::Values(strict, best_effort));
@@ -1373,6 +1599,76 @@ TEST_F(TestControllerManagerFallbackControllers, test_failure_on_fallback_contro
     test_controller_2->get_lifecycle_state().id());
 }
 
+TEST_F(TestControllerManagerFallbackControllers, test_failure_on_conflicting_fallback_controllers)
+{
+  const auto strictness = controller_manager_msgs::srv::SwitchController::Request::STRICT;
+  controller_interface::InterfaceConfiguration cmd_itfs_cfg;
+  cmd_itfs_cfg.type = controller_interface::interface_configuration_type::INDIVIDUAL;
+  cmd_itfs_cfg.names = {"joint1/position"};
+  auto test_controller_1 = std::make_shared<test_controller::TestController>();
+  test_controller_1->set_command_interface_configuration(cmd_itfs_cfg);
+  auto test_controller_2 = std::make_shared<test_controller::TestController>();
+  test_controller_2->set_command_interface_configuration(cmd_itfs_cfg);
+  auto test_controller_3 = std::make_shared<test_controller::TestController>();
+  test_controller_3->set_command_interface_configuration(cmd_itfs_cfg);
+  const std::string test_controller_1_name = "test_controller_1";
+  const std::string test_controller_2_name = "test_controller_2";
+  const std::string test_controller_3_name = "test_controller_3";
+
+  {
+    controller_manager::ControllerSpec controller_spec;
+    controller_spec.c = test_controller_1;
+    controller_spec.info.name = test_controller_1_name;
+    controller_spec.info.type = "test_controller::TestController";
+    controller_spec.info.fallback_controllers_names = {
+      test_controller_2_name, test_controller_3_name};
+    controller_spec.last_update_cycle_time = std::make_shared<rclcpp::Time>(0);
+    ControllerManagerRunner cm_runner(this);
+    cm_->add_controller(controller_spec);  // add controller_1
+
+    controller_spec.info.fallback_controllers_names = {};
+    controller_spec.c = test_controller_2;
+    controller_spec.info.name = test_controller_2_name;
+    cm_->add_controller(controller_spec);  // add controller_2
+
+    controller_spec.c = test_controller_3;
+    controller_spec.info.name = test_controller_3_name;
+    cm_->add_controller(controller_spec);  // add controller_3
+  }
+  EXPECT_EQ(3u, cm_->get_loaded_controllers().size());
+
+  // configure controllers, the fallback controllers claim the same command interface
+  {
+    ControllerManagerRunner cm_runner(this);
+    cm_->configure_controller(test_controller_1_name);
+    cm_->configure_controller(test_controller_2_name);
+    cm_->configure_controller(test_controller_3_name);
+  }
+  for (const auto & controller : cm_->get_loaded_controllers())
+  {
+    EXPECT_EQ(
+      controller.info.name == test_controller_1_name,
+      !controller.fault_plan->invalid_reason.empty());
+  }
+
+  // the invalid fallback graph is rejected before the activation
+  std::vector<std::string> start_controllers = {test_controller_1_name};
+  std::vector<std::string> stop_controllers = {};
+  auto switch_future = std::async(
+    std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+    start_controllers, stop_controllers, strictness, true, rclcpp::Duration(0, 0));
+
+  ASSERT_EQ(std::future_status::ready, switch_future.wait_for(std::chrono::milliseconds(100)))
+    << "switch_controller should fail before the next update cycle";
+  {
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(controller_interface::return_type::ERROR, switch_future.get());
+  }
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controller_1->get_lifecycle_state().id());
+}
+
 TEST_F(TestControllerManagerFallbackControllers, test_fallback_controllers_activation_simple_case)
 {
   const auto strictness = controller_manager_msgs::srv::SwitchController::Request::STRICT;
@@ -3572,3 +3868,779 @@ TEST_F(TestControllerManagerNotHandlingExceptions, controller_configure_on_excep
     lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
     test_controller->get_lifecycle_state().id());
 }
+
+class TestControllerManagerWithParallelUpdate
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+public:
+  TestControllerManagerWithParallelUpdate()
+  : ControllerManagerFixture<controller_manager::ControllerManager>(
+      ros2_control_test_assets::minimal_robot_urdf, "",
+      {rclcpp::Parameter("parallel_update.number_of_workers", 2)})
+  {
+  }
+};
+
+TEST_F(TestControllerManagerWithParallelUpdate, independent_controllers_are_updated_in_parallel)
+{
+  const std::vector<std::string> controller_names = {
+    "test_controller_1", "test_controller_2", "test_controller_3"};
+  std::vector<std::shared_ptr<test_controller::TestController>> test_controllers;
+  for (const auto & controller_name : controller_names)
+  {
+    test_controllers.push_back(std::make_shared<test_controller::TestController>());
+    cm_->add_controller(
+      test_controllers.back(), controller_name, test_controller::TEST_CONTROLLER_CLASS_NAME);
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->configure_controller(controller_name));
+  }
+  EXPECT_EQ(3u, cm_->get_loaded_controllers().size());
+
+  {
+    ControllerManagerRunner cm_runner(this);
+    auto switch_future = std::async(
+      std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+      controller_names, std::vector<std::string>{},
+      controller_manager_msgs::srv::SwitchController::Request::STRICT, true,
+      rclcpp::Duration(0, 0));
+    ASSERT_EQ(std::future_status::ready, switch_future.wait_for(std::chrono::milliseconds(100)))
+      << "switch_controller should be blocking until next update cycle";
+    EXPECT_EQ(controller_interface::return_type::OK, switch_future.get());
+  }
+
+  std::vector<unsigned int> counters;
+  for (const auto & test_controller : test_controllers)
+  {
+    ASSERT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+      test_controller->get_lifecycle_state().id());
+    counters.push_back(test_controller->internal_counter);
+  }
+
+  for (int i = 0; i < 10; ++i)
+  {
+    EXPECT_EQ(
+      controller_interface::return_type::OK,
+      cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+  }
+  for (std::size_t i = 0; i < test_controllers.size(); ++i)
+  {
+    EXPECT_EQ(counters[i] + 10u, test_controllers[i]->internal_counter);
+  }
+
+  // a failing controller is deactivated once all the controllers are updated, without affecting
+  // the independent controllers
+  test_controllers[1]->throw_on_update = true;
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+  EXPECT_EQ(counters[0] + 11u, test_controllers[0]->internal_counter);
+  EXPECT_EQ(counters[2] + 11u, test_controllers[2]->internal_counter);
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    test_controllers[0]->get_lifecycle_state().id());
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controllers[1]->get_lifecycle_state().id());
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    test_controllers[2]->get_lifecycle_state().id());
+}
+
+class TestControllerManagerWithSwitchPlanCache
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+public:
+  TestControllerManagerWithSwitchPlanCache()
+  : ControllerManagerFixture<controller_manager::ControllerManager>(
+      ros2_control_test_assets::minimal_robot_urdf, "",
+      {rclcpp::Parameter("switch_plan_cache.enable", true)})
+  {
+  }
+
+  controller_interface::return_type switch_controllers(
+    const std::vector<std::string> & activate, const std::vector<std::string> & deactivate)
+  {
+    ControllerManagerRunner cm_runner(this);
+    auto switch_future = std::async(
+      std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+      activate, deactivate, controller_manager_msgs::srv::SwitchController::Request::STRICT,
+      true, rclcpp::Duration(0, 0));
+    EXPECT_EQ(std::future_status::ready, switch_future.wait_for(std::chrono::milliseconds(100)))
+      << "switch_controller should be blocking until next update cycle";
+    return switch_future.get();
+  }
+};
+
+TEST_F(TestControllerManagerWithSwitchPlanCache, repeated_switches_replay_the_cached_plans)
+{
+  // both controllers claim the same command interfaces, so they can only be active one at a time
+  controller_interface::InterfaceConfiguration cmd_itfs_cfg;
+  cmd_itfs_cfg.type = controller_interface::interface_configuration_type::INDIVIDUAL;
+  for (const auto & interface : ros2_control_test_assets::TEST_ACTUATOR_HARDWARE_COMMAND_INTERFACES)
+  {
+    cmd_itfs_cfg.names.push_back(interface);
+  }
+  const std::vector<std::string> controller_names = {"test_controller_1", "test_controller_2"};
+  std::vector<std::shared_ptr<test_controller::TestController>> test_controllers;
+  for (const auto & controller_name : controller_names)
+  {
+    test_controllers.push_back(std::make_shared<test_controller::TestController>());
+    test_controllers.back()->set_command_interface_configuration(cmd_itfs_cfg);
+    cm_->add_controller(
+      test_controllers.back(), controller_name, test_controller::TEST_CONTROLLER_CLASS_NAME);
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->configure_controller(controller_name));
+  }
+
+  ASSERT_EQ(controller_interface::return_type::OK, switch_controllers({controller_names[0]}, {}));
+
+  for (int i = 0; i < 3; ++i)
+  {
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      switch_controllers({controller_names[1]}, {controller_names[0]}));
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+      test_controllers[0]->get_lifecycle_state().id());
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+      test_controllers[1]->get_lifecycle_state().id());
+
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      switch_controllers({controller_names[0]}, {controller_names[1]}));
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+      test_controllers[0]->get_lifecycle_state().id());
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+      test_controllers[1]->get_lifecycle_state().id());
+  }
+
+  // the cached plans don't hide the conflicts of requests compiled in a different state
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR, switch_controllers({controller_names[1]}, {}));
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controllers[1]->get_lifecycle_state().id());
+}
+
+TEST_F(TestControllerManagerWithSwitchPlanCache, reconfigured_controllers_are_checked_again)
+{
+  const std::vector<std::string> controller_names = {"test_controller_1", "test_controller_2"};
+  const std::vector<std::string> command_interfaces = {"joint1/position", "joint2/velocity"};
+  std::vector<std::shared_ptr<test_controller::TestController>> test_controllers;
+  for (std::size_t i = 0; i < controller_names.size(); ++i)
+  {
+    test_controllers.push_back(std::make_shared<test_controller::TestController>());
+    test_controllers.back()->set_command_interface_configuration(
+      {controller_interface::interface_configuration_type::INDIVIDUAL, {command_interfaces[i]}});
+    cm_->add_controller(
+      test_controllers.back(), controller_names[i], test_controller::TEST_CONTROLLER_CLASS_NAME);
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(
+      controller_interface::return_type::OK, cm_->configure_controller(controller_names[i]));
+  }
+
+  // the plans of both switches are cached
+  ASSERT_EQ(controller_interface::return_type::OK, switch_controllers(controller_names, {}));
+  ASSERT_EQ(controller_interface::return_type::OK, switch_controllers({}, controller_names));
+
+  // the second controller claims the interface of the first one once it is configured again, in
+  // the same lifecycle state as before
+  {
+    ControllerManagerRunner cm_runner(this);
+    ASSERT_EQ(controller_interface::return_type::OK, cm_->cleanup_controller(controller_names[1]));
+    test_controllers[1]->set_command_interface_configuration(
+      {controller_interface::interface_configuration_type::INDIVIDUAL, {command_interfaces[0]}});
+    ASSERT_EQ(
+      controller_interface::return_type::OK, cm_->configure_controller(controller_names[1]));
+  }
+  EXPECT_EQ(controller_interface::return_type::ERROR, switch_controllers(controller_names, {}));
+  for (const auto & test_controller : test_controllers)
+  {
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+      test_controller->get_lifecycle_state().id());
+  }
+}
+
+class TestControllerManagerWithUpdateOrderGroupedByHardware
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+public:
+  TestControllerManagerWithUpdateOrderGroupedByHardware()
+  : ControllerManagerFixture<controller_manager::ControllerManager>(
+      ros2_control_test_assets::minimal_robot_urdf, "",
+      {rclcpp::Parameter("update_order.group_by_hardware", true)})
+  {
+  }
+};
+
+TEST_F(
+  TestControllerManagerWithUpdateOrderGroupedByHardware,
+  independent_controllers_of_the_same_component_are_updated_consecutively)
+{
+  // the actuator exports joint1, the sensor sensor1 and the system joint2 and joint3
+  const std::vector<std::pair<std::string, std::string>> controller_interfaces = {
+    {"actuator_controller_1", "joint1/position"},
+    {"system_controller_1", "joint2/velocity"},
+    {"actuator_controller_2", "joint1/max_velocity"},
+    {"sensor_controller", ""},
+    {"system_controller_2", "joint3/velocity"}};
+  for (const auto & [controller_name, command_interface] : controller_interfaces)
+  {
+    auto controller = std::make_shared<test_controller::TestController>();
+    controller_interface::InterfaceConfiguration cmd_itfs_cfg;
+    cmd_itfs_cfg.type = controller_interface::interface_configuration_type::INDIVIDUAL;
+    controller_interface::InterfaceConfiguration state_itfs_cfg = cmd_itfs_cfg;
+    if (command_interface.empty())
+    {
+      state_itfs_cfg.names = {"sensor1/velocity"};
+    }
+    else
+    {
+      cmd_itfs_cfg.names = {command_interface};
+    }
+    controller->set_command_interface_configuration(cmd_itfs_cfg);
+    controller->set_state_interface_configuration(state_itfs_cfg);
+    cm_->add_controller(controller, controller_name, test_controller::TEST_CONTROLLER_CLASS_NAME);
+  }
+  for (const auto & [controller_name, _] : controller_interfaces)
+  {
+    ControllerManagerRunner cm_runner(this);
+    ASSERT_EQ(controller_interface::return_type::OK, cm_->configure_controller(controller_name));
+  }
+
+  std::vector<std::string> update_order;
+  for (const auto & controller : cm_->get_loaded_controllers())
+  {
+    update_order.push_back(controller.info.name);
+  }
+  // the groups are taken in the order of their first controller
+  EXPECT_THAT(
+    update_order, testing::ElementsAre(
+                    "actuator_controller_1", "actuator_controller_2", "system_controller_1",
+                    "system_controller_2", "sensor_controller"));
+}
+
+class TestControllerManagerWithLightweightControllerNodes
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+public:
+  TestControllerManagerWithLightweightControllerNodes()
+  : ControllerManagerFixture<controller_manager::ControllerManager>(
+      ros2_control_test_assets::minimal_robot_urdf, "",
+      {rclcpp::Parameter("lightweight_controller_nodes.enable", true)})
+  {
+  }
+};
+
+TEST_F(
+  TestControllerManagerWithLightweightControllerNodes,
+  controller_node_is_created_without_the_parameter_and_logger_services)
+{
+  auto test_controller = std::make_shared<test_controller::TestController>();
+  cm_->add_controller(
+    test_controller, test_controller::TEST_CONTROLLER_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  ASSERT_NE(test_controller->get_node(), nullptr);
+
+  const auto & node_options = test_controller->get_node()->get_node_options();
+  EXPECT_FALSE(node_options.start_parameter_services());
+  EXPECT_FALSE(node_options.start_parameter_event_publisher());
+  EXPECT_FALSE(node_options.enable_logger_service());
+  EXPECT_STREQ(test_controller->get_node()->get_name(), test_controller::TEST_CONTROLLER_NAME);
+
+  {
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(
+      controller_interface::return_type::OK,
+      cm_->configure_controller(test_controller::TEST_CONTROLLER_NAME));
+  }
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controller->get_lifecycle_state().id());
+}
+
+class TestControllerManagerPreparedSwitch
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+public:
+  void SetUp() override
+  {
+    ControllerManagerFixture<controller_manager::ControllerManager>::SetUp();
+    test_controller_ = std::make_shared<test_controller::TestController>();
+    cm_->add_controller(
+      test_controller_, test_controller::TEST_CONTROLLER_NAME,
+      test_controller::TEST_CONTROLLER_CLASS_NAME);
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(
+      controller_interface::return_type::OK,
+      cm_->configure_controller(test_controller::TEST_CONTROLLER_NAME));
+  }
+
+  std::shared_ptr<test_controller::TestController> test_controller_;
+};
+
+TEST_F(TestControllerManagerPreparedSwitch, prepared_switch_is_executed_at_the_commit_time)
+{
+  std::string message;
+  ASSERT_EQ(
+    controller_interface::return_type::OK,
+    cm_->prepare_switch(
+      {test_controller::TEST_CONTROLLER_NAME}, {},
+      controller_manager_msgs::srv::SwitchController::Request::STRICT, message));
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controller_->get_lifecycle_state().id());
+
+  // no other switch is accepted while the prepared switch is pending
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->switch_controller(
+      {test_controller::TEST_CONTROLLER_NAME}, {},
+      controller_manager_msgs::srv::SwitchController::Request::STRICT, true,
+      rclcpp::Duration(0, 0)));
+
+  const rclcpp::Time commit_time(1, 0, time_.get_clock_type());
+  std::string commit_message;
+  auto commit_future = std::async(
+    std::launch::async,
+    [this, &commit_time, &commit_message]
+    { return cm_->commit_switch(commit_time, rclcpp::Duration(5, 0), commit_message); });
+
+  // the switch waits for the commit time
+  for (int i = 0; i < 5; ++i)
+  {
+    EXPECT_EQ(
+      controller_interface::return_type::OK,
+      cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+    EXPECT_EQ(std::future_status::timeout, commit_future.wait_for(std::chrono::milliseconds(10)));
+  }
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controller_->get_lifecycle_state().id());
+
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->update(commit_time, rclcpp::Duration::from_seconds(0.01)));
+  ASSERT_EQ(std::future_status::ready, commit_future.wait_for(std::chrono::milliseconds(100)));
+  EXPECT_EQ(controller_interface::return_type::OK, commit_future.get());
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, test_controller_->get_lifecycle_state().id());
+
+  // there is nothing left to commit
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->commit_switch(
+      rclcpp::Time(0, 0, time_.get_clock_type()), rclcpp::Duration(0, 0), message));
+}
+
+TEST_F(TestControllerManagerPreparedSwitch, cancelled_switch_is_not_executed)
+{
+  std::string message;
+  ASSERT_EQ(
+    controller_interface::return_type::OK,
+    cm_->prepare_switch(
+      {test_controller::TEST_CONTROLLER_NAME}, {},
+      controller_manager_msgs::srv::SwitchController::Request::STRICT, message));
+  cm_->cancel_prepared_switch();
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->commit_switch(
+      rclcpp::Time(0, 0, time_.get_clock_type()), rclcpp::Duration(0, 0), message));
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controller_->get_lifecycle_state().id());
+
+  // the regular switch is accepted again
+  ControllerManagerRunner cm_runner(this);
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->switch_controller(
+      {test_controller::TEST_CONTROLLER_NAME}, {},
+      controller_manager_msgs::srv::SwitchController::Request::STRICT, true,
+      rclcpp::Duration(0, 0)));
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, test_controller_->get_lifecycle_state().id());
+}
+
+TEST_F(TestControllerManagerPreparedSwitch, activation_is_prepared_outside_of_the_control_loop)
+{
+  std::string message;
+  test_controller_->fail_prepare_activate = true;
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->prepare_switch(
+      {test_controller::TEST_CONTROLLER_NAME}, {},
+      controller_manager_msgs::srv::SwitchController::Request::STRICT, message));
+  EXPECT_EQ(test_controller_->prepare_activate_calls, 1u);
+  EXPECT_THAT(message, testing::HasSubstr("failed to prepare its activation"));
+
+  // the preparation runs in the requesting thread, before the control loop performs the switch
+  test_controller_->fail_prepare_activate = false;
+  ASSERT_EQ(
+    controller_interface::return_type::OK,
+    cm_->prepare_switch(
+      {test_controller::TEST_CONTROLLER_NAME}, {},
+      controller_manager_msgs::srv::SwitchController::Request::STRICT, message));
+  EXPECT_EQ(test_controller_->prepare_activate_calls, 2u);
+  EXPECT_EQ(
+    test_controller_->prepare_activate_lifecycle_id,
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  auto commit_future = std::async(
+    std::launch::async,
+    [this, &message]
+    {
+      return cm_->commit_switch(
+        rclcpp::Time(0, 0, time_.get_clock_type()), rclcpp::Duration(5, 0), message);
+    });
+  for (int i = 0; i < 500 && commit_future.wait_for(std::chrono::milliseconds(1)) !=
+                                 std::future_status::ready;
+       ++i)
+  {
+    EXPECT_EQ(
+      controller_interface::return_type::OK,
+      cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+  }
+  ASSERT_EQ(std::future_status::ready, commit_future.wait_for(std::chrono::milliseconds(100)));
+  EXPECT_EQ(controller_interface::return_type::OK, commit_future.get()) << message;
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, test_controller_->get_lifecycle_state().id());
+  EXPECT_EQ(test_controller_->prepare_activate_calls, 2u);
+}
+
+TEST_F(TestControllerManagerPreparedSwitch, swap_hands_the_command_interfaces_over)
+{
+  controller_interface::InterfaceConfiguration cmd_itfs_cfg;
+  cmd_itfs_cfg.type = controller_interface::interface_configuration_type::INDIVIDUAL;
+  cmd_itfs_cfg.names = {"joint1/position"};
+  test_controller_->set_command_interface_configuration(cmd_itfs_cfg);
+  auto incoming_controller = std::make_shared<test_controller::TestController>();
+  incoming_controller->set_command_interface_configuration(cmd_itfs_cfg);
+  cm_->add_controller(
+    incoming_controller, test_controller::TEST_CONTROLLER2_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  std::string message;
+  {
+    ControllerManagerRunner cm_runner(this);
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->configure_controller(test_controller::TEST_CONTROLLER2_NAME));
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->switch_controller(
+        {test_controller::TEST_CONTROLLER_NAME}, {},
+        controller_manager_msgs::srv::SwitchController::Request::STRICT, true,
+        rclcpp::Duration(0, 0)));
+
+    // the outgoing controller has to be active
+    EXPECT_EQ(
+      controller_interface::return_type::ERROR,
+      cm_->swap_controller(
+        test_controller::TEST_CONTROLLER2_NAME, test_controller::TEST_CONTROLLER_NAME,
+        rclcpp::Duration(0, 0), message));
+  }
+
+  auto swap_future = std::async(
+    std::launch::async,
+    [this, &message]
+    {
+      return cm_->swap_controller(
+        test_controller::TEST_CONTROLLER_NAME, test_controller::TEST_CONTROLLER2_NAME,
+        rclcpp::Duration(5, 0), message);
+    });
+  // the outgoing controller is updated until the cycle performing the swap
+  for (int i = 0; i < 500 && swap_future.wait_for(std::chrono::milliseconds(1)) !=
+                                 std::future_status::ready;
+       ++i)
+  {
+    EXPECT_EQ(
+      controller_interface::return_type::OK,
+      cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+  }
+  ASSERT_EQ(std::future_status::ready, swap_future.wait_for(std::chrono::milliseconds(100)));
+  ASSERT_EQ(controller_interface::return_type::OK, swap_future.get()) << message;
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controller_->get_lifecycle_state().id());
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    incoming_controller->get_lifecycle_state().id());
+  EXPECT_GT(test_controller_->internal_counter, 0u);
+  EXPECT_EQ(incoming_controller->handed_over_counter, test_controller_->internal_counter);
+  // the incoming controller got the command interface of the outgoing one on its activation
+  EXPECT_EQ(incoming_controller->external_commands_for_testing_.size(), 1u);
+
+  // the incoming controller is updated from the next cycle on
+  EXPECT_EQ(incoming_controller->internal_counter, 0u);
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+  EXPECT_EQ(incoming_controller->internal_counter, 1u);
+}
+
+TEST_F(TestControllerManagerPreparedSwitch, shadow_mode_updates_an_inactive_controller)
+{
+  controller_interface::InterfaceConfiguration cmd_itfs_cfg;
+  cmd_itfs_cfg.type = controller_interface::interface_configuration_type::INDIVIDUAL;
+  cmd_itfs_cfg.names = {"joint1/position"};
+  test_controller_->set_command_interface_configuration(cmd_itfs_cfg);
+  auto active_controller = std::make_shared<test_controller::TestController>();
+  active_controller->set_command_interface_configuration(cmd_itfs_cfg);
+  cm_->add_controller(
+    active_controller, test_controller::TEST_CONTROLLER2_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  {
+    ControllerManagerRunner cm_runner(this);
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->configure_controller(test_controller::TEST_CONTROLLER2_NAME));
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->switch_controller(
+        {test_controller::TEST_CONTROLLER2_NAME}, {},
+        controller_manager_msgs::srv::SwitchController::Request::STRICT, true,
+        rclcpp::Duration(0, 0)));
+  }
+  std::string message;
+  controller_manager::MovingAverageStatistics::StatisticData statistics;
+  // only the inactive controllers can be shadowed
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->shadow_controller(
+      test_controller::TEST_CONTROLLER2_NAME, 3u, rclcpp::Duration(0, 0), message, statistics));
+
+  // the shadowed controller writes a copy of the command interface claimed by the active one
+  const auto active_updates = active_controller->internal_counter;
+  auto shadow_future = std::async(
+    std::launch::async,
+    [this, &message, &statistics]
+    {
+      return cm_->shadow_controller(
+        test_controller::TEST_CONTROLLER_NAME, 3u, rclcpp::Duration(5, 0), message, statistics);
+    });
+  for (int i = 0; i < 500 && shadow_future.wait_for(std::chrono::milliseconds(1)) !=
+                                 std::future_status::ready;
+       ++i)
+  {
+    EXPECT_EQ(
+      controller_interface::return_type::OK,
+      cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+  }
+  ASSERT_EQ(std::future_status::ready, shadow_future.wait_for(std::chrono::milliseconds(100)));
+  ASSERT_EQ(controller_interface::return_type::OK, shadow_future.get()) << message;
+  EXPECT_EQ(test_controller_->internal_counter, 3u);
+  EXPECT_EQ(statistics.sample_count, 3u);
+  EXPECT_GT(active_controller->internal_counter, active_updates + 2u);
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controller_->get_lifecycle_state().id());
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    active_controller->get_lifecycle_state().id());
+
+  // the shadow updates stop once done
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->update(time_, rclcpp::Duration::from_seconds(0.01)));
+  EXPECT_EQ(test_controller_->internal_counter, 3u);
+}
+
+class TestControllerManagerActivityChanges
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+public:
+  using ActivityChanges = controller_manager_msgs::msg::ControllerManagerActivityChanges;
+
+  /// Spins until the received changes satisfy \p predicate, returns false on timeout
+  bool wait_for_changes(const std::function<bool(const std::vector<ActivityChanges> &)> & predicate)
+  {
+    const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!predicate(received_changes_) && std::chrono::steady_clock::now() < until)
+    {
+      test_executor_.spin_some();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return predicate(received_changes_);
+  }
+
+  void SetUp() override
+  {
+    ControllerManagerFixture::SetUp();
+    test_node_ = std::make_shared<rclcpp::Node>("test_node");
+    subscription_ = test_node_->create_subscription<ActivityChanges>(
+      std::string("/") + TEST_CM_NAME + "/activity_changes",
+      rclcpp::QoS(100).reliable().transient_local(),
+      [this](const ActivityChanges::SharedPtr msg) { received_changes_.push_back(*msg); });
+    test_executor_.add_node(test_node_);
+  }
+
+  void TearDown() override
+  {
+    test_executor_.remove_node(test_node_);
+    ControllerManagerFixture::TearDown();
+  }
+
+  std::shared_ptr<rclcpp::Node> test_node_;
+  rclcpp::Subscription<ActivityChanges>::SharedPtr subscription_;
+  rclcpp::executors::SingleThreadedExecutor test_executor_;
+  std::vector<ActivityChanges> received_changes_;
+};
+
+TEST_F(TestControllerManagerActivityChanges, changes_of_the_controllers_are_published)
+{
+  auto has_loaded_controller = [](const ActivityChanges & changes)
+  {
+    return std::any_of(
+      changes.controllers.begin(), changes.controllers.end(),
+      [](const auto & state) { return state.name == test_controller::TEST_CONTROLLER_NAME; });
+  };
+  auto test_controller = std::make_shared<test_controller::TestController>();
+  cm_->add_controller(
+    test_controller, test_controller::TEST_CONTROLLER_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  ASSERT_TRUE(wait_for_changes(
+    [&](const std::vector<ActivityChanges> & changes)
+    { return std::any_of(changes.begin(), changes.end(), has_loaded_controller); }));
+
+  {
+    ControllerManagerRunner cm_runner(this);
+    EXPECT_EQ(
+      controller_interface::return_type::OK,
+      cm_->unload_controller(test_controller::TEST_CONTROLLER_NAME));
+  }
+  ASSERT_TRUE(wait_for_changes(
+    [](const std::vector<ActivityChanges> & changes)
+    {
+      return !changes.empty() &&
+             changes.back().removed_controllers ==
+               std::vector<std::string>{test_controller::TEST_CONTROLLER_NAME};
+    }));
+
+  // each message is a new version of the activity
+  for (std::size_t i = 1; i < received_changes_.size(); ++i)
+  {
+    EXPECT_EQ(received_changes_[i - 1].version + 1, received_changes_[i].version);
+  }
+}
+
+class WarmRestartControllerManager : public controller_manager::ControllerManager
+{
+public:
+  using controller_manager::ControllerManager::ControllerManager;
+  using controller_manager::ControllerManager::resource_manager_;
+};
+
+class TestControllerManagerWarmRestart
+: public ControllerManagerFixture<WarmRestartControllerManager>
+{
+public:
+  TestControllerManagerWarmRestart()
+  : ControllerManagerFixture<WarmRestartControllerManager>(
+      ros2_control_test_assets::minimal_robot_urdf, "",
+      {rclcpp::Parameter("warm_restart.checkpoint_file", write_checkpoint()),
+       rclcpp::Parameter("warm_restart.checkpoint_period", 0.01)})
+  {
+  }
+
+  ~TestControllerManagerWarmRestart() override
+  {
+    std::filesystem::remove(get_checkpoint_file());
+  }
+
+  static std::string get_checkpoint_file()
+  {
+    return (std::filesystem::temp_directory_path() / "test_cm_warm_restart_checkpoint.txt")
+      .string();
+  }
+
+  /// Writes the checkpoint of the previous process, before the controller manager is created
+  static std::string write_checkpoint()
+  {
+    using lifecycle_msgs::msg::State;
+    controller_manager::WarmRestartCheckpoint checkpoint;
+    checkpoint.robot_description_hash =
+      hardware_interface::HardwareInfoCache::hash(ros2_control_test_assets::minimal_robot_urdf);
+    checkpoint.hardware_components = {
+      {ros2_control_test_assets::TEST_ACTUATOR_HARDWARE_NAME, State::PRIMARY_STATE_ACTIVE},
+      {ros2_control_test_assets::TEST_SENSOR_HARDWARE_NAME, State::PRIMARY_STATE_ACTIVE},
+      {ros2_control_test_assets::TEST_SYSTEM_HARDWARE_NAME, State::PRIMARY_STATE_INACTIVE}};
+    checkpoint.controllers = {
+      {"active_controller", test_controller::TEST_CONTROLLER_CLASS_NAME,
+       State::PRIMARY_STATE_ACTIVE},
+      {"inactive_controller", test_controller::TEST_CONTROLLER_CLASS_NAME,
+       State::PRIMARY_STATE_INACTIVE}};
+    EXPECT_TRUE(
+      controller_manager::write_warm_restart_checkpoint(get_checkpoint_file(), checkpoint));
+    return get_checkpoint_file();
+  }
+
+  /// Spins the controller manager until the condition is met, or for at most 5 seconds
+  bool spin_until(const std::function<bool()> & condition)
+  {
+    const auto end_time = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition() && std::chrono::steady_clock::now() < end_time)
+    {
+      executor_->spin_some(std::chrono::milliseconds(10));
+    }
+    return condition();
+  }
+
+  /// Returns the states of the controllers of the checkpoint file
+  static std::vector<uint8_t> get_checkpointed_controllers_states()
+  {
+    controller_manager::WarmRestartCheckpoint checkpoint;
+    std::vector<uint8_t> states;
+    if (controller_manager::read_warm_restart_checkpoint(get_checkpoint_file(), checkpoint))
+    {
+      for (const auto & controller : checkpoint.controllers)
+      {
+        states.push_back(controller.state);
+      }
+    }
+    return states;
+  }
+};
+
+TEST_F(TestControllerManagerWarmRestart, restores_and_checkpoints_the_state)
+{
+  using lifecycle_msgs::msg::State;
+  // the hardware components get their checkpointed states instead of their initial states
+  const auto & components = cm_->resource_manager_->get_components_status();
+  EXPECT_EQ(
+    components.at(ros2_control_test_assets::TEST_ACTUATOR_HARDWARE_NAME).state.id(),
+    State::PRIMARY_STATE_ACTIVE);
+  EXPECT_EQ(
+    components.at(ros2_control_test_assets::TEST_SYSTEM_HARDWARE_NAME).state.id(),
+    State::PRIMARY_STATE_INACTIVE);
+
+  // the controllers are restored once the executor spins
+  executor_->add_node(cm_);
+  {
+    ControllerManagerRunner cm_runner(this);
+    ASSERT_TRUE(spin_until([this]() { return cm_->get_startup_time().warm_restart_time > 0.0; }));
+  }
+  const auto controllers = cm_->get_loaded_controllers();
+  ASSERT_EQ(controllers.size(), 2u);
+  for (const auto & controller : controllers)
+  {
+    EXPECT_EQ(
+      controller.c->get_lifecycle_id(), controller.info.name == "active_controller"
+                                          ? State::PRIMARY_STATE_ACTIVE
+                                          : State::PRIMARY_STATE_INACTIVE);
+  }
+
+  // the changes of the restored state are checkpointed for the next restart
+  switch_test_controllers(
+    {}, {"active_controller"}, controller_manager_msgs::srv::SwitchController::Request::STRICT);
+  EXPECT_TRUE(spin_until(
+    []()
+    {
+      return get_checkpointed_controllers_states() ==
+             std::vector<uint8_t>{State::PRIMARY_STATE_INACTIVE, State::PRIMARY_STATE_INACTIVE};
+    }));
+  executor_->remove_node(cm_);
+}
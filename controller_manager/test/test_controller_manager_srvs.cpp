@@ -22,6 +22,7 @@
 #include "controller_manager_msgs/srv/list_controller_types.hpp"
 #include "controller_manager_msgs/srv/list_controllers.hpp"
 #include "controller_manager_msgs/srv/list_hardware_interfaces.hpp"
+#include "controller_manager_msgs/srv/profile_cycles.hpp"
 #include "controller_manager_msgs/srv/switch_controller.hpp"
 #include "controller_manager_test_common.hpp"
 #include "gmock/gmock.h"
@@ -30,11 +31,14 @@
 #include "test_controller/test_controller.hpp"
 
 using ::testing::_;
+using ::testing::Contains;
+using ::testing::HasSubstr;
 using ::testing::Return;
 using ::testing::UnorderedElementsAre;
 
 using ListControllers = controller_manager_msgs::srv::ListControllers;
 using ListHardwareInterfaces = controller_manager_msgs::srv::ListHardwareInterfaces;
+using ProfileCycles = controller_manager_msgs::srv::ProfileCycles;
 using TestController = test_controller::TestController;
 using TestChainableController = test_chainable_controller::TestChainableController;
 
@@ -1961,6 +1965,38 @@ TEST_F(TestControllerManagerSrvs, list_hardware_interfaces_srv)
   }
 }
 
+TEST_F(TestControllerManagerSrvs, profile_cycles_srv)
+{
+  rclcpp::executors::SingleThreadedExecutor srv_executor;
+  rclcpp::Node::SharedPtr srv_node = std::make_shared<rclcpp::Node>("srv_client");
+  srv_executor.add_node(srv_node);
+  rclcpp::Client<ProfileCycles>::SharedPtr client =
+    srv_node->create_client<ProfileCycles>("test_controller_manager/profile_cycles");
+  auto request = std::make_shared<ProfileCycles::Request>();
+
+  // the cycles are run by the real-time thread of the fixture
+  request->cycles = 5;
+  auto result = call_service_and_wait(*client, request, srv_executor);
+  ASSERT_TRUE(result->ok);
+  EXPECT_EQ(5u, result->cycles);
+  EXPECT_GT(result->cycle_max_us, 0.0);
+  std::vector<std::string> section_names;
+  for (const auto & section : result->sections)
+  {
+    section_names.push_back(section.name);
+    EXPECT_GT(section.count, 0u);
+    EXPECT_LE(section.critical_path_share, 1.0);
+  }
+  EXPECT_THAT(section_names, Contains("test_controller_manager/read"));
+  EXPECT_THAT(section_names, Contains("test_controller_manager/write"));
+  EXPECT_THAT(section_names, Contains("TestSystemHardware/read"));
+  EXPECT_THAT(result->report, HasSubstr("Profiled 5 cycles"));
+
+  request->cycles = 0;
+  result = call_service_and_wait(*client, request, srv_executor);
+  EXPECT_FALSE(result->ok);
+}
+
 TEST_F(TestControllerManagerSrvs, activate_chained_controllers_one_by_one)
 {
   /// The simulated controller chaining is:
@@ -0,0 +1,140 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "controller_manager/controller_sandbox.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "test_controller/test_controller.hpp"
+
+using namespace std::chrono_literals;
+
+class TestControllerSandbox : public ::testing::Test
+{
+public:
+  static void SetUpTestCase() { rclcpp::init(0, nullptr); }
+
+  static void TearDownTestCase() { rclcpp::shutdown(); }
+
+  void SetUp() override
+  {
+    // the segment names are unique per process, so that parallel test runs don't interfere
+    segment_name_ = "/test_controller_sandbox_" + std::to_string(getpid());
+    controller_interface::ControllerInterfaceParams params;
+    params.controller_name = "sandbox_proxy";
+    params.update_rate = 100;
+    params.controller_manager_update_rate = 100;
+    params.node_options.parameter_overrides(
+      {{"command_interfaces", std::vector<std::string>{"joint1/position"}},
+       {"state_interfaces", std::vector<std::string>{"joint1/position"}},
+       {"segment_name", segment_name_},
+       {"deadline_us", 100000},
+       {"max_missed_deadlines", 1}});
+    ASSERT_EQ(proxy_.init(params), controller_interface::return_type::OK);
+
+    params.controller_name = "sandboxed_controller";
+    params.node_options = rclcpp::NodeOptions();
+    sandboxed_controller_ = std::make_shared<test_controller::TestController>();
+    ASSERT_EQ(sandboxed_controller_->init(params), controller_interface::return_type::OK);
+    sandboxed_controller_->set_command_interface_configuration(
+      {controller_interface::interface_configuration_type::INDIVIDUAL, {"joint1/position"}});
+    sandboxed_controller_->set_state_interface_configuration(
+      {controller_interface::interface_configuration_type::INDIVIDUAL, {"joint1/position"}});
+  }
+
+  void assign_proxy_interfaces()
+  {
+    std::vector<hardware_interface::LoanedCommandInterface> command_loans;
+    command_loans.emplace_back(command_interface_);
+    std::vector<hardware_interface::LoanedStateInterface> state_loans;
+    state_loans.emplace_back(state_interface_);
+    proxy_.assign_interfaces(std::move(command_loans), std::move(state_loans));
+  }
+
+protected:
+  std::string segment_name_;
+  controller_manager::SandboxProxyController proxy_;
+  std::shared_ptr<test_controller::TestController> sandboxed_controller_;
+  hardware_interface::CommandInterface::SharedPtr command_interface_ =
+    std::make_shared<hardware_interface::CommandInterface>("joint1", "position", "double", "0.0");
+  hardware_interface::StateInterface::SharedPtr state_interface_ =
+    std::make_shared<hardware_interface::StateInterface>("joint1", "position", "double", "0.5");
+};
+
+TEST_F(TestControllerSandbox, proxy_forwards_the_cycles_to_the_sandbox)
+{
+  ASSERT_EQ(proxy_.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  controller_manager::ControllerSandboxHost host(sandboxed_controller_);
+  // the interfaces of the sandboxed controller must be mirrored by the proxy
+  ASSERT_FALSE(host.connect(segment_name_ + "_unknown"));
+  ASSERT_TRUE(host.connect(segment_name_));
+  EXPECT_EQ(
+    sandboxed_controller_->get_lifecycle_state().id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  assign_proxy_interfaces();
+  ASSERT_EQ(proxy_.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  sandboxed_controller_->set_external_commands_for_testing({2.5});
+  std::thread sandbox(
+    [&host]()
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        EXPECT_TRUE(host.spin_once(2s));
+      }
+    });
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(
+      proxy_.update(rclcpp::Time(1000000000 + i * 10000000, RCL_ROS_TIME), period),
+      controller_interface::return_type::OK);
+  }
+  sandbox.join();
+  EXPECT_EQ(sandboxed_controller_->internal_counter, 3u);
+  EXPECT_EQ(command_interface_->get_optional().value(), 2.5);
+  EXPECT_EQ(proxy_.get_missed_deadlines(), 0u);
+
+  // without the sandbox, the previous commands are kept until the proxy falls back
+  ASSERT_TRUE(command_interface_->set_value(1.0));
+  EXPECT_EQ(
+    proxy_.update(rclcpp::Time(2000000000, RCL_ROS_TIME), period),
+    controller_interface::return_type::OK);
+  EXPECT_EQ(proxy_.get_missed_deadlines(), 1u);
+  EXPECT_EQ(command_interface_->get_optional().value(), 1.0);
+  EXPECT_EQ(
+    proxy_.update(rclcpp::Time(2010000000, RCL_ROS_TIME), period),
+    controller_interface::return_type::ERROR);
+
+  proxy_.get_node()->deactivate();
+  proxy_.release_interfaces();
+}
+
+TEST_F(TestControllerSandbox, proxy_fails_to_activate_without_the_sandbox)
+{
+  proxy_.get_node()->set_parameter(rclcpp::Parameter("connection_timeout_ms", 10));
+  ASSERT_EQ(proxy_.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  assign_proxy_interfaces();
+  EXPECT_NE(proxy_.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  proxy_.release_interfaces();
+}
@@ -0,0 +1,82 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+
+#include "controller_manager/executor_factory.hpp"
+#include "rclcpp/executors/multi_threaded_executor.hpp"
+#include "rclcpp/executors/single_threaded_executor.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using controller_manager::ExecutorType;
+
+class TestExecutorFactory : public ::testing::Test
+{
+public:
+  static void SetUpTestCase() { rclcpp::init(0, nullptr); }
+
+  static void TearDownTestCase() { rclcpp::shutdown(); }
+};
+
+TEST_F(TestExecutorFactory, parse_executor_type)
+{
+  ExecutorType type = ExecutorType::EVENTS;
+  EXPECT_TRUE(controller_manager::parse_executor_type("multi_threaded", type));
+  EXPECT_EQ(type, ExecutorType::MULTI_THREADED);
+  EXPECT_TRUE(controller_manager::parse_executor_type("single_threaded", type));
+  EXPECT_EQ(type, ExecutorType::SINGLE_THREADED);
+  EXPECT_FALSE(controller_manager::parse_executor_type("unknown", type));
+  EXPECT_EQ(type, ExecutorType::SINGLE_THREADED);
+}
+
+TEST_F(TestExecutorFactory, create_executor_of_the_requested_type)
+{
+  EXPECT_NE(
+    std::dynamic_pointer_cast<rclcpp::executors::MultiThreadedExecutor>(
+      controller_manager::create_executor(ExecutorType::MULTI_THREADED, 2)),
+    nullptr);
+  EXPECT_NE(
+    std::dynamic_pointer_cast<rclcpp::executors::SingleThreadedExecutor>(
+      controller_manager::create_executor(ExecutorType::SINGLE_THREADED, 0)),
+    nullptr);
+}
+
+TEST_F(TestExecutorFactory, parameter_override_from_the_arguments_takes_precedence)
+{
+  rclcpp::NodeOptions options;
+  options.parameter_overrides({rclcpp::Parameter("executor.type", "single_threaded")});
+  EXPECT_EQ(
+    controller_manager::get_parameter_override(options, "/controller_manager", "executor.type")
+      .get<std::string>(),
+    "single_threaded");
+
+  options.arguments(
+    {"--ros-args", "-p", "executor.type:=multi_threaded", "-p", "executor.number_of_threads:=3"});
+  EXPECT_EQ(
+    controller_manager::get_parameter_override(options, "/controller_manager", "executor.type")
+      .get<std::string>(),
+    "multi_threaded");
+  EXPECT_EQ(
+    controller_manager::get_parameter_override(
+      options, "/controller_manager", "executor.number_of_threads")
+      .get<int64_t>(),
+    3);
+  EXPECT_EQ(
+    controller_manager::get_parameter_override(options, "/controller_manager", "update_rate")
+      .get_type(),
+    rclcpp::ParameterType::PARAMETER_NOT_SET);
+}
@@ -0,0 +1,102 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+
+#include "controller_manager/headless_control_core.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "ros2_control_test_assets/descriptions.hpp"
+#include "test_controller/test_controller.hpp"
+
+class TestHeadlessControlCore : public ::testing::Test
+{
+public:
+  // the controllers still create their lifecycle node, the core doesn't need any other ROS entity
+  static void SetUpTestCase() { rclcpp::init(0, nullptr); }
+
+  static void TearDownTestCase() { rclcpp::shutdown(); }
+
+  std::shared_ptr<test_controller::TestController> make_controller(
+    const std::string & name, const std::string & command_interface)
+  {
+    auto controller = std::make_shared<test_controller::TestController>();
+    controller_interface::ControllerInterfaceParams params;
+    params.controller_name = name;
+    params.robot_description = ros2_control_test_assets::minimal_robot_urdf;
+    params.update_rate = 100;
+    params.controller_manager_update_rate = 100;
+    EXPECT_EQ(controller->init(params), controller_interface::return_type::OK);
+    controller->set_command_interface_configuration(
+      {controller_interface::interface_configuration_type::INDIVIDUAL, {command_interface}});
+    controller->set_state_interface_configuration(
+      {controller_interface::interface_configuration_type::INDIVIDUAL, {"joint1/position"}});
+    return controller;
+  }
+};
+
+TEST_F(TestHeadlessControlCore, runs_the_read_update_write_cycle)
+{
+  controller_manager::HeadlessControlCore core(ros2_control_test_assets::minimal_robot_urdf, 100);
+  EXPECT_TRUE(core.get_resource_manager().command_interface_exists("joint1/position"));
+
+  auto controller = make_controller("test_controller", "joint1/position");
+  ASSERT_TRUE(core.add_controller(controller));
+  EXPECT_EQ(
+    controller->get_lifecycle_state().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  // the controller is only updated once active
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  EXPECT_EQ(core.update(core.get_clock()->now(), period), controller_interface::return_type::OK);
+  EXPECT_EQ(controller->internal_counter, 0u);
+
+  ASSERT_TRUE(core.activate_controllers());
+  EXPECT_EQ(
+    controller->get_lifecycle_state().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_TRUE(core.get_resource_manager().command_interface_is_claimed("joint1/position"));
+
+  controller->set_external_commands_for_testing({1.5});
+  for (int i = 0; i < 3; ++i)
+  {
+    const auto time = core.get_clock()->now();
+    EXPECT_EQ(core.read(time, period).result, hardware_interface::return_type::OK);
+    EXPECT_EQ(core.update(time, period), controller_interface::return_type::OK);
+    EXPECT_EQ(core.write(time, period).result, hardware_interface::return_type::OK);
+  }
+  EXPECT_EQ(controller->internal_counter, 3u);
+
+  core.deactivate_controllers();
+  EXPECT_EQ(
+    controller->get_lifecycle_state().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  EXPECT_FALSE(core.get_resource_manager().command_interface_is_claimed("joint1/position"));
+}
+
+TEST_F(TestHeadlessControlCore, rejects_conflicting_controllers)
+{
+  controller_manager::HeadlessControlCore core(ros2_control_test_assets::minimal_robot_urdf, 100);
+  auto controller1 = make_controller("test_controller1", "joint1/position");
+  auto controller2 = make_controller("test_controller2", "joint1/position");
+  ASSERT_TRUE(core.add_controller(controller1));
+  ASSERT_TRUE(core.add_controller(controller2));
+  EXPECT_FALSE(core.add_controller(std::make_shared<test_controller::TestController>()));
+
+  // the second controller can't claim the command interface of the first one
+  EXPECT_FALSE(core.activate_controllers());
+  EXPECT_EQ(
+    controller1->get_lifecycle_state().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_EQ(
+    controller2->get_lifecycle_state().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+}
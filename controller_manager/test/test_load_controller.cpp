@@ -19,6 +19,7 @@
 #include "controller_manager/controller_manager.hpp"
 #include "controller_manager_test_common.hpp"
 #include "gmock/gmock.h"
+#include "hardware_interface/static_plugin_registry.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
 #include "test_controller/test_controller.hpp"
 #include "test_controller_failed_init/test_controller_failed_init.hpp"
@@ -29,6 +30,11 @@ using ::testing::Return;
 const auto CONTROLLER_NAME_1 = "test_controller1";
 const auto CONTROLLER_NAME_2 = "test_controller2";
 using strvec = std::vector<std::string>;
+constexpr char STATIC_TEST_CONTROLLER_CLASS_NAME[] = "controller_manager/static_test_controller";
+
+HARDWARE_INTERFACE_REGISTER_STATIC_PLUGIN(
+  test_controller::TestController, controller_interface::ControllerInterface,
+  STATIC_TEST_CONTROLLER_CLASS_NAME)
 
 class TestLoadController : public ControllerManagerFixture<controller_manager::ControllerManager>
 {
@@ -48,6 +54,16 @@ TEST_F(TestLoadController, load_controller_failed_init)
     nullptr);
 }
 
+TEST_F(TestLoadController, load_static_controller_without_pluginlib)
+{
+  auto controller = cm_->load_controller(CONTROLLER_NAME_1, STATIC_TEST_CONTROLLER_CLASS_NAME);
+  ASSERT_NE(controller, nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<test_controller::TestController>(controller), nullptr);
+  EXPECT_EQ(
+    cm_->get_loaded_controllers()[0].info.type, std::string(STATIC_TEST_CONTROLLER_CLASS_NAME));
+  EXPECT_EQ(cm_->configure_controller(CONTROLLER_NAME_1), controller_interface::return_type::OK);
+}
+
 TEST_F(TestLoadController, configuring_non_loaded_controller_fails)
 {
   // try configure non-loaded controller
@@ -73,6 +89,35 @@ TEST_F(TestLoadController, can_set_and_get_non_default_update_rate)
   EXPECT_EQ(50u, controller_if->get_update_rate());
 }
 
+TEST_F(TestLoadController, load_controller_with_unknown_control_loop_fails)
+{
+  cm_->set_parameter(rclcpp::Parameter("test_controller_01.control_loop", "unknown_loop"));
+  EXPECT_EQ(
+    cm_->load_controller("test_controller_01", test_controller::TEST_CONTROLLER_CLASS_NAME),
+    nullptr);
+
+  cm_->set_parameter(rclcpp::Parameter("test_controller_01.control_loop", ""));
+  EXPECT_NE(
+    cm_->load_controller("test_controller_01", test_controller::TEST_CONTROLLER_CLASS_NAME),
+    nullptr);
+}
+
+TEST_F(TestLoadController, load_controller_with_invalid_criticality_fails)
+{
+  cm_->set_parameter(rclcpp::Parameter("test_controller_01.criticality", "optional"));
+  EXPECT_EQ(
+    cm_->load_controller("test_controller_01", test_controller::TEST_CONTROLLER_CLASS_NAME),
+    nullptr);
+
+  cm_->set_parameter(rclcpp::Parameter("test_controller_01.criticality", "auxiliary"));
+  EXPECT_NE(
+    cm_->load_controller("test_controller_01", test_controller::TEST_CONTROLLER_CLASS_NAME),
+    nullptr);
+  ASSERT_EQ(cm_->get_loaded_controllers().size(), 1u);
+  EXPECT_EQ(
+    cm_->get_loaded_controllers()[0].criticality, hardware_interface::Criticality::AUXILIARY);
+}
+
 class TestLoadedController : public TestLoadController
 {
 public:
@@ -419,6 +464,20 @@ TEST_F(TestTwoLoadedControllers, load_and_configure_two_known_controllers)
     lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, controller_if2->get_lifecycle_state().id());
 }
 
+TEST_F(TestTwoLoadedControllers, configure_two_controllers_concurrently)
+{
+  const auto results =
+    cm_->configure_controllers({CONTROLLER_NAME_1, "unknown_controller", CONTROLLER_NAME_2}, 2u);
+  ASSERT_EQ(3u, results.size());
+  EXPECT_EQ(controller_interface::return_type::OK, results[0]);
+  EXPECT_EQ(controller_interface::return_type::ERROR, results[1]);
+  EXPECT_EQ(controller_interface::return_type::OK, results[2]);
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, controller_if1->get_lifecycle_state().id());
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, controller_if2->get_lifecycle_state().id());
+}
+
 TEST_P(TestTwoLoadedControllers, switch_multiple_controllers)
 {
   const auto test_param = GetParam();
@@ -0,0 +1,92 @@
+// Copyright 2026 ROS2-Control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <string>
+
+#include "controller_manager/loop_jitter_self_test.hpp"
+
+using controller_manager::ControlLoopState;
+using controller_manager::LoopJitterSelfTest;
+using controller_manager::PeriodicWaitMode;
+using controller_manager::recommend_periodic_wait;
+using namespace std::chrono_literals;
+using testing::HasSubstr;
+
+TEST(LoopJitterSelfTest, recommends_the_periodic_wait_for_the_wake_up_latency)
+{
+  auto recommendation = recommend_periodic_wait(1ms, 20us);
+  EXPECT_EQ(recommendation.mode, PeriodicWaitMode::SLEEP);
+  EXPECT_EQ(recommendation.spin_margin, 0.0);
+
+  recommendation = recommend_periodic_wait(1ms, 100us);
+  EXPECT_EQ(recommendation.mode, PeriodicWaitMode::HYBRID);
+  // 100 us with a quarter of reserve and the minimum margin of 5 us
+  EXPECT_DOUBLE_EQ(recommendation.spin_margin, 130e-6);
+  EXPECT_THAT(recommendation.reason, HasSubstr("130 us"));
+
+  recommendation = recommend_periodic_wait(1ms, 600us);
+  EXPECT_EQ(recommendation.mode, PeriodicWaitMode::SPIN);
+  EXPECT_THAT(recommendation.reason, HasSubstr("cpu_affinity"));
+}
+
+TEST(LoopJitterSelfTest, collects_the_cycles_until_the_duration_elapsed)
+{
+  LoopJitterSelfTest self_test(1ms, 10ms, PeriodicWaitMode::SLEEP);
+  ControlLoopState state;
+  for (int i = 0; i < 9; ++i)
+  {
+    state.last_wake_up_delay = 10us;
+    state.last_sleep_latency = 10us;
+    ASSERT_FALSE(self_test.add_cycle(i == 0 ? 1ms + 200us : 1ms, state));
+    // the latencies are consumed by the test
+    EXPECT_LT(state.last_wake_up_delay, 0ns);
+    EXPECT_LT(state.last_sleep_latency, 0ns);
+  }
+  state.last_wake_up_delay = 3ms;
+  EXPECT_TRUE(self_test.add_cycle(1ms, state));
+
+  EXPECT_EQ(self_test.get_number_of_cycles(), 10u);
+  EXPECT_EQ(self_test.get_wake_up_delay().get_count(), 10u);
+  EXPECT_EQ(self_test.get_sleep_latency().get_count(), 9u);
+  EXPECT_DOUBLE_EQ(self_test.get_wake_up_delay().get_max(), 3000.0);
+  EXPECT_DOUBLE_EQ(self_test.get_period_deviation().get_max(), 200.0);
+
+  const auto recommendation = self_test.get_recommendation();
+  ASSERT_TRUE(recommendation.has_value());
+  EXPECT_EQ(recommendation->mode, PeriodicWaitMode::SLEEP);
+
+  const std::string report = self_test.get_report();
+  EXPECT_THAT(report, HasSubstr("10 cycles"));
+  EXPECT_THAT(report, HasSubstr("[8, 16) us"));
+  EXPECT_THAT(report, HasSubstr("[2048, 4096) us"));
+  EXPECT_THAT(report, HasSubstr("Recommendation: periodic_wait.mode: 'sleep'"));
+}
+
+TEST(LoopJitterSelfTest, has_no_recommendation_without_sleeps)
+{
+  LoopJitterSelfTest self_test(1ms, 2ms, PeriodicWaitMode::SPIN);
+  ControlLoopState state;
+  state.last_wake_up_delay = 1us;
+  EXPECT_FALSE(self_test.add_cycle(1ms, state));
+  EXPECT_TRUE(self_test.add_cycle(1ms, state));
+
+  EXPECT_FALSE(self_test.get_recommendation().has_value());
+  const std::string report = self_test.get_report();
+  EXPECT_THAT(report, HasSubstr("'spin' periodic wait"));
+  EXPECT_THAT(report, HasSubstr("wake-up latency of the sleeps: no measurements"));
+  EXPECT_THAT(report, HasSubstr("No sleep was measured"));
+}
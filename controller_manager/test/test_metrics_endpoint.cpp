@@ -0,0 +1,268 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "controller_manager/metrics_endpoint.hpp"
+
+using controller_manager::MetricsEndpoint;
+using controller_manager::MetricsEndpointParams;
+using controller_manager::OpenMetricsWriter;
+using testing::HasSubstr;
+using testing::StartsWith;
+
+namespace
+{
+std::string receive_response(int fd, const std::string & request)
+{
+  EXPECT_EQ(::send(fd, request.data(), request.size(), 0), static_cast<ssize_t>(request.size()));
+  std::string response;
+  char buffer[1024];
+  ssize_t received = 0;
+  while ((received = ::recv(fd, buffer, sizeof(buffer), 0)) > 0)
+  {
+    response.append(buffer, static_cast<std::size_t>(received));
+  }
+  ::close(fd);
+  return response;
+}
+
+std::string request_tcp(uint16_t port, const std::string & request)
+{
+  const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+  {
+    ::close(fd);
+    throw std::runtime_error("Unable to connect to the metrics endpoint");
+  }
+  return receive_response(fd, request);
+}
+
+std::string request_unix(const std::string & path, const std::string & request)
+{
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+  if (::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+  {
+    ::close(fd);
+    throw std::runtime_error("Unable to connect to the metrics endpoint");
+  }
+  return receive_response(fd, request);
+}
+
+MetricsEndpointParams make_tcp_params()
+{
+  MetricsEndpointParams params;
+  params.address = "127.0.0.1";
+  params.port = 0;
+  return params;
+}
+}  // namespace
+
+TEST(TestOpenMetricsWriter, writes_the_families_and_their_samples)
+{
+  OpenMetricsWriter writer;
+  writer.add_family(
+    "ros2_control_controller_execution_time_microseconds", OpenMetricsWriter::MetricType::GAUGE,
+    "Execution time of the update");
+  writer.add_sample({{"controller", "jtc"}, {"statistic", "average"}}, 12.5);
+  writer.add_sample({{"controller", "jtc"}, {"quantile", "0.99"}}, 20.0);
+  writer.add_family(
+    "ros2_control_controller_time_budget_overruns", OpenMetricsWriter::MetricType::COUNTER,
+    "Updates exceeding the time budget");
+  writer.add_sample({{"controller", "jtc"}}, 3.0);
+  writer.add_family("ros2_control_empty", OpenMetricsWriter::MetricType::GAUGE, "No samples");
+
+  EXPECT_EQ(
+    writer.str(),
+    "# TYPE ros2_control_controller_execution_time_microseconds gauge\n"
+    "# HELP ros2_control_controller_execution_time_microseconds Execution time of the update\n"
+    "ros2_control_controller_execution_time_microseconds{controller=\"jtc\","
+    "statistic=\"average\"} 12.5\n"
+    "ros2_control_controller_execution_time_microseconds{controller=\"jtc\","
+    "quantile=\"0.99\"} 20\n"
+    "# TYPE ros2_control_controller_time_budget_overruns counter\n"
+    "# HELP ros2_control_controller_time_budget_overruns Updates exceeding the time budget\n"
+    "ros2_control_controller_time_budget_overruns_total{controller=\"jtc\"} 3\n"
+    "# TYPE ros2_control_empty gauge\n"
+    "# HELP ros2_control_empty No samples\n"
+    "# EOF\n");
+}
+
+TEST(TestOpenMetricsWriter, sanitizes_the_names_and_escapes_the_values)
+{
+  OpenMetricsWriter writer;
+  EXPECT_THROW(writer.add_sample({}, 1.0), std::logic_error);
+  writer.add_family("2nd.metric-name", OpenMetricsWriter::MetricType::GAUGE, "back\\slash\nline");
+  writer.add_sample({{"label.name", "a \"quoted\" \\ value\n"}}, 1.0);
+  writer.add_sample({}, std::numeric_limits<double>::quiet_NaN());
+  writer.add_sample({}, std::numeric_limits<double>::infinity());
+  writer.add_sample({}, -std::numeric_limits<double>::infinity());
+
+  EXPECT_EQ(
+    writer.str(),
+    "# TYPE _nd_metric_name gauge\n"
+    "# HELP _nd_metric_name back\\\\slash\\nline\n"
+    "_nd_metric_name{label_name=\"a \\\"quoted\\\" \\\\ value\\n\"} 1\n"
+    "_nd_metric_name NaN\n"
+    "_nd_metric_name +Inf\n"
+    "_nd_metric_name -Inf\n"
+    "# EOF\n");
+}
+
+TEST(TestMetricsEndpoint, serves_the_last_metrics_on_tcp)
+{
+  MetricsEndpoint endpoint(make_tcp_params());
+  ASSERT_NE(endpoint.get_port(), 0u);
+
+  // the metrics are valid before the first update
+  std::string response =
+    request_tcp(endpoint.get_port(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+  EXPECT_THAT(response, StartsWith("HTTP/1.1 200 OK\r\n"));
+  EXPECT_THAT(response, HasSubstr("\r\n\r\n# EOF\n"));
+
+  OpenMetricsWriter writer;
+  writer.add_family("metric", OpenMetricsWriter::MetricType::GAUGE, "A metric");
+  writer.add_sample({}, 42.0);
+  endpoint.update_metrics(writer.str());
+  response = request_tcp(endpoint.get_port(), "GET /metrics?format=text HTTP/1.1\r\n\r\n");
+  EXPECT_THAT(response, StartsWith("HTTP/1.1 200 OK\r\n"));
+  EXPECT_THAT(
+    response, HasSubstr(
+                std::string("Content-Type: ") + controller_manager::OPENMETRICS_CONTENT_TYPE +
+                "\r\n"));
+  EXPECT_THAT(response, HasSubstr("Content-Length: " + std::to_string(writer.str().size())));
+  EXPECT_THAT(response, HasSubstr("\r\n\r\n" + writer.str()));
+
+  // the header is sent without the metrics
+  response = request_tcp(endpoint.get_port(), "HEAD /metrics HTTP/1.1\r\n\r\n");
+  EXPECT_THAT(response, StartsWith("HTTP/1.1 200 OK\r\n"));
+  EXPECT_THAT(response, testing::EndsWith("\r\n\r\n"));
+  EXPECT_EQ(endpoint.get_served_requests(), 3u);
+}
+
+TEST(TestMetricsEndpoint, rejects_the_other_requests)
+{
+  MetricsEndpoint endpoint(make_tcp_params());
+
+  EXPECT_THAT(
+    request_tcp(endpoint.get_port(), "GET /other HTTP/1.1\r\n\r\n"),
+    StartsWith("HTTP/1.1 404 Not Found\r\n"));
+  const std::string response = request_tcp(endpoint.get_port(), "POST /metrics HTTP/1.1\r\n\r\n");
+  EXPECT_THAT(response, StartsWith("HTTP/1.1 405 Method Not Allowed\r\n"));
+  EXPECT_THAT(response, HasSubstr("Allow: GET, HEAD\r\n"));
+  // the request is exactly as large as the limit, so it's fully read before the response
+  const std::string request_line = "GET /metrics HTTP/1.1\r\n";
+  EXPECT_THAT(
+    request_tcp(endpoint.get_port(), request_line + std::string(8192 - request_line.size(), 'x')),
+    StartsWith("HTTP/1.1 431 "));
+  EXPECT_EQ(endpoint.get_served_requests(), 3u);
+}
+
+TEST(TestMetricsEndpoint, serves_the_metrics_on_a_unix_socket)
+{
+  const std::string path =
+    (std::filesystem::temp_directory_path() / "test_metrics_endpoint.sock").string();
+  MetricsEndpointParams params;
+  params.unix_socket_path = path;
+  {
+    MetricsEndpoint endpoint(params);
+    EXPECT_EQ(endpoint.get_port(), 0u);
+    endpoint.update_metrics("metric 1\n# EOF\n");
+    EXPECT_THAT(
+      request_unix(path, "GET /metrics HTTP/1.1\r\n\r\n"), HasSubstr("\r\n\r\nmetric 1\n# EOF\n"));
+  }
+  // the socket is removed with the endpoint
+  EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST(TestMetricsEndpoint, closes_the_connections_of_the_slow_clients)
+{
+  MetricsEndpoint endpoint(make_tcp_params());
+  const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(endpoint.get_port());
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+
+  // a byte of the request every 100 ms never reaches a timeout of a single receive
+  const auto start = std::chrono::steady_clock::now();
+  char byte = 'G';
+  bool closed = false;
+  while (!closed && std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+  {
+    if (::send(fd, &byte, 1, MSG_NOSIGNAL) != 1)
+    {
+      closed = true;
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    closed = ::recv(fd, &byte, 1, MSG_DONTWAIT) == 0;
+    byte = 'x';
+  }
+  ::close(fd);
+  EXPECT_TRUE(closed);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+
+  EXPECT_THAT(
+    request_tcp(endpoint.get_port(), "GET /metrics HTTP/1.1\r\n\r\n"),
+    StartsWith("HTTP/1.1 200 OK\r\n"));
+  EXPECT_EQ(endpoint.get_served_requests(), 1u);
+}
+
+TEST(TestMetricsEndpoint, keeps_the_files_that_are_not_sockets)
+{
+  const std::string path =
+    (std::filesystem::temp_directory_path() / "test_metrics_endpoint.file").string();
+  std::ofstream(path) << "not a socket";
+  MetricsEndpointParams params;
+  params.unix_socket_path = path;
+  EXPECT_THROW(MetricsEndpoint{params}, std::runtime_error);
+  EXPECT_TRUE(std::filesystem::is_regular_file(path));
+  std::filesystem::remove(path);
+}
+
+TEST(TestMetricsEndpoint, throws_if_the_socket_cannot_be_bound)
+{
+  MetricsEndpoint endpoint(make_tcp_params());
+  MetricsEndpointParams params = make_tcp_params();
+  params.port = endpoint.get_port();
+  EXPECT_THROW(MetricsEndpoint{params}, std::runtime_error);
+  params.address = "not an address";
+  EXPECT_THROW(MetricsEndpoint{params}, std::runtime_error);
+  params.unix_socket_path = "/" + std::string(200, 'x');
+  EXPECT_THROW(MetricsEndpoint{params}, std::runtime_error);
+}
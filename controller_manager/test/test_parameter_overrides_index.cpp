@@ -0,0 +1,124 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "controller_manager/parameter_overrides_index.hpp"
+
+using controller_manager::ParameterOverridesIndex;
+
+namespace
+{
+std::string write_parameters_file(const std::string & name, const std::string & content)
+{
+  const auto path = (std::filesystem::temp_directory_path() / name).string();
+  std::ofstream file(path, std::ios::trunc);
+  file << content;
+  return path;
+}
+
+/// Applies the overrides in order, as the node does
+std::map<std::string, rclcpp::Parameter> apply(const std::vector<rclcpp::Parameter> & overrides)
+{
+  std::map<std::string, rclcpp::Parameter> parameters;
+  for (const auto & parameter : overrides)
+  {
+    parameters.insert_or_assign(parameter.get_name(), parameter);
+  }
+  return parameters;
+}
+}  // namespace
+
+TEST(TestParameterOverridesIndex, node_name_matches)
+{
+  EXPECT_TRUE(ParameterOverridesIndex::node_name_matches("/**", "/ctrl"));
+  EXPECT_TRUE(ParameterOverridesIndex::node_name_matches("/**", "/ns/ctrl"));
+  EXPECT_TRUE(ParameterOverridesIndex::node_name_matches("/**/ctrl", "/ctrl"));
+  EXPECT_TRUE(ParameterOverridesIndex::node_name_matches("/**/ctrl", "/a/b/ctrl"));
+  EXPECT_FALSE(ParameterOverridesIndex::node_name_matches("/**/ctrl", "/a/b/other"));
+  EXPECT_TRUE(ParameterOverridesIndex::node_name_matches("/*/ctrl", "/ns/ctrl"));
+  EXPECT_FALSE(ParameterOverridesIndex::node_name_matches("/*/ctrl", "/ctrl"));
+  EXPECT_FALSE(ParameterOverridesIndex::node_name_matches("/*/ctrl", "/a/b/ctrl"));
+  EXPECT_TRUE(ParameterOverridesIndex::node_name_matches("/ns/*", "/ns/ctrl"));
+  EXPECT_FALSE(ParameterOverridesIndex::node_name_matches("/ns/*", "/other/ctrl"));
+}
+
+TEST(TestParameterOverridesIndex, parameters_of_the_node_and_of_the_wildcards)
+{
+  const auto path = write_parameters_file(
+    "test_parameter_overrides_index.yaml",
+    "/**:\n"
+    "  ros__parameters:\n"
+    "    param1: 1.0\n"
+    "    param2: 2.0\n"
+    "ctrl_1:\n"
+    "  ros__parameters:\n"
+    "    type: \"controller_manager/test_controller\"\n"
+    "    param2: 20.0\n"
+    "/ns/ctrl_2:\n"
+    "  ros__parameters:\n"
+    "    param3: 3\n");
+
+  ParameterOverridesIndex index;
+  auto parameters = apply(index.get_parameter_overrides(path, "/ctrl_1"));
+  ASSERT_EQ(parameters.size(), 3u);
+  EXPECT_EQ(parameters.at("type").as_string(), "controller_manager/test_controller");
+  EXPECT_EQ(parameters.at("param1").as_double(), 1.0);
+  // the entry of the node takes precedence over the wildcard one
+  EXPECT_EQ(parameters.at("param2").as_double(), 20.0);
+
+  parameters = apply(index.get_parameter_overrides(path, "/ns/ctrl_2"));
+  ASSERT_EQ(parameters.size(), 3u);
+  EXPECT_EQ(parameters.at("param2").as_double(), 2.0);
+  EXPECT_EQ(parameters.at("param3").as_int(), 3);
+
+  parameters = apply(index.get_parameter_overrides(path, "/ctrl_3"));
+  ASSERT_EQ(parameters.size(), 2u);
+
+  // the file is only parsed once for all the nodes
+  EXPECT_EQ(index.get_number_of_parses(), 1u);
+
+  // and parsed again once it changed
+  write_parameters_file(
+    "test_parameter_overrides_index.yaml",
+    "ctrl_1:\n"
+    "  ros__parameters:\n"
+    "    param1: 10.0\n"
+    "    param4: true\n");
+  parameters = apply(index.get_parameter_overrides(path, "/ctrl_1"));
+  EXPECT_EQ(index.get_number_of_parses(), 2u);
+  ASSERT_EQ(parameters.size(), 2u);
+  EXPECT_EQ(parameters.at("param1").as_double(), 10.0);
+  EXPECT_TRUE(parameters.at("param4").as_bool());
+
+  std::filesystem::remove(path);
+  EXPECT_THROW(index.get_parameter_overrides(path, "/ctrl_1"), std::runtime_error);
+}
+
+TEST(TestParameterOverridesIndex, invalid_file_throws)
+{
+  const auto path = write_parameters_file(
+    "test_parameter_overrides_index_invalid.yaml", "ctrl_1:\n  ros__parameters: [\n");
+  ParameterOverridesIndex index;
+  EXPECT_THROW(index.get_parameter_overrides(path, "/ctrl_1"), std::runtime_error);
+  EXPECT_EQ(index.get_number_of_parses(), 0u);
+  std::filesystem::remove(path);
+}
@@ -118,6 +118,9 @@ TEST_F(SleepingPoliciesTest, sleep_for_periodic_cycle_sleeps_until_next_iteratio
   EXPECT_LE(elapsed, state.period + kTimingTolerance);
   EXPECT_GE(state.next_iteration_time, expected_next_iteration_time - kTimingTolerance);
   EXPECT_LE(state.next_iteration_time, expected_next_iteration_time + kTimingTolerance);
+  // the delay of the cycle is the latency of the sleep
+  EXPECT_GE(state.last_wake_up_delay, std::chrono::nanoseconds::zero());
+  EXPECT_EQ(state.last_sleep_latency, state.last_wake_up_delay);
 }
 
 TEST_F(SleepingPoliciesTest, sleep_for_periodic_cycle_recovers_from_overrun)
@@ -178,3 +181,130 @@ TEST_F(SleepingPoliciesTest, sleep_for_sim_time_returns_false_when_clock_types_m
 
   EXPECT_FALSE(sleep_for_sim_time(cm_, state));
 }
+
+TEST_F(SleepingPoliciesTest, sleep_for_hardware_trigger_waits_for_the_cycle_trigger)
+{
+  const controller_manager::ControlLoopTimingConfig config{
+    .cycle_trigger_component = "TestSystemHardware", .cycle_trigger_timeout = 1.0};
+  controller_manager::ControlLoopState state;
+  state.period = std::chrono::nanoseconds(1'000'000'000 / kUpdateRateHz);
+  auto cycle_trigger = cm_->get_hardware_cycle_trigger("TestSystemHardware");
+  ASSERT_NE(nullptr, cycle_trigger);
+
+  auto notify_future = std::async(
+    std::launch::async,
+    [cycle_trigger]()
+    {
+      std::this_thread::sleep_for(30ms);
+      cycle_trigger->notify();
+    });
+  const auto elapsed = measure_execution([&]() { sleep_for_hardware_trigger(cm_, config, state); });
+  notify_future.wait();
+
+  EXPECT_EQ(cycle_trigger, state.cycle_trigger);
+  EXPECT_GE(elapsed, 30ms - kTimingTolerance);
+  EXPECT_LT(elapsed, 500ms);
+  EXPECT_EQ(0u, cycle_trigger->get_missed_cycles());
+
+  // the cycles triggered while the loop was busy are counted as missed
+  cycle_trigger->notify();
+  cycle_trigger->notify();
+  sleep_for_hardware_trigger(cm_, config, state);
+  EXPECT_EQ(1u, cycle_trigger->get_missed_cycles());
+}
+
+TEST_F(SleepingPoliciesTest, sleep_for_hardware_trigger_runs_the_cycle_on_timeout)
+{
+  const controller_manager::ControlLoopTimingConfig config{
+    .cycle_trigger_component = "TestSystemHardware", .cycle_trigger_timeout = 0.02};
+  controller_manager::ControlLoopState state;
+  state.period = std::chrono::nanoseconds(1'000'000'000 / kUpdateRateHz);
+
+  const auto elapsed = measure_execution([&]() { sleep_for_hardware_trigger(cm_, config, state); });
+
+  EXPECT_GE(elapsed, 20ms - kTimingTolerance);
+  EXPECT_LT(elapsed, 500ms);
+}
+
+TEST_F(SleepingPoliciesTest, sleep_for_hardware_trigger_falls_back_to_periodic_cycle)
+{
+  const controller_manager::ControlLoopTimingConfig config{
+    .cycle_trigger_component = "UnknownHardware", .cycle_trigger_timeout = 1.0};
+  controller_manager::ControlLoopState state;
+  state.period = std::chrono::nanoseconds(1'000'000'000 / kUpdateRateHz);
+  state.next_iteration_time = std::chrono::steady_clock::now();
+
+  const auto elapsed = measure_execution([&]() { sleep_for_hardware_trigger(cm_, config, state); });
+
+  EXPECT_EQ(nullptr, state.cycle_trigger);
+  EXPECT_GE(elapsed, state.period - kTimingTolerance);
+  EXPECT_LE(elapsed, state.period + kTimingTolerance);
+}
+
+TEST(PeriodicWaitModeTest, parse_periodic_wait_mode)
+{
+  auto mode = controller_manager::PeriodicWaitMode::SLEEP;
+  EXPECT_TRUE(controller_manager::parse_periodic_wait_mode("spin", mode));
+  EXPECT_EQ(controller_manager::PeriodicWaitMode::SPIN, mode);
+  EXPECT_TRUE(controller_manager::parse_periodic_wait_mode("hybrid", mode));
+  EXPECT_EQ(controller_manager::PeriodicWaitMode::HYBRID, mode);
+  EXPECT_FALSE(controller_manager::parse_periodic_wait_mode("unknown", mode));
+  EXPECT_EQ(controller_manager::PeriodicWaitMode::HYBRID, mode);
+  EXPECT_TRUE(controller_manager::parse_periodic_wait_mode("sleep", mode));
+  EXPECT_EQ(controller_manager::PeriodicWaitMode::SLEEP, mode);
+}
+
+TEST_F(SleepingPoliciesTest, sleep_for_periodic_cycle_spins_until_next_iteration)
+{
+  controller_manager::ControlLoopTimingConfig config{
+    .manage_overruns = true, .periodic_wait_mode = controller_manager::PeriodicWaitMode::SPIN};
+  controller_manager::ControlLoopState state;
+  state.period = std::chrono::nanoseconds(1'000'000'000 / kUpdateRateHz);
+  state.next_iteration_time = std::chrono::steady_clock::now();
+  const auto expected_next_iteration_time = state.next_iteration_time + state.period;
+
+  sleep_for_periodic_cycle(cm_, config, state);
+
+  const auto now = std::chrono::steady_clock::now();
+  EXPECT_GE(now, expected_next_iteration_time);
+  EXPECT_LE(now, expected_next_iteration_time + kTimingTolerance);
+  EXPECT_GE(state.last_wake_up_delay, std::chrono::nanoseconds::zero());
+  EXPECT_LT(state.last_sleep_latency, std::chrono::nanoseconds::zero());
+}
+
+TEST_F(SleepingPoliciesTest, sleep_for_periodic_cycle_calibrates_hybrid_spin_margin)
+{
+  controller_manager::ControlLoopTimingConfig config{
+    .manage_overruns = true, .periodic_wait_mode = controller_manager::PeriodicWaitMode::HYBRID};
+  controller_manager::ControlLoopState state;
+  state.period = std::chrono::nanoseconds(1'000'000'000 / kUpdateRateHz);
+  state.next_iteration_time = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < 10; ++i)
+  {
+    const auto expected_next_iteration_time = state.next_iteration_time + state.period;
+    sleep_for_periodic_cycle(cm_, config, state);
+    EXPECT_GE(std::chrono::steady_clock::now(), expected_next_iteration_time);
+    EXPECT_GE(state.last_sleep_latency, std::chrono::nanoseconds::zero());
+  }
+  EXPECT_GT(state.calibrated_spin_margin, std::chrono::nanoseconds::zero());
+  EXPECT_LE(state.calibrated_spin_margin, state.period / 2);
+
+  // a fixed margin is not calibrated
+  config.spin_margin = 0.001;
+  state.calibrated_spin_margin = std::chrono::microseconds(123);
+  sleep_for_periodic_cycle(cm_, config, state);
+  EXPECT_EQ(std::chrono::microseconds(123), state.calibrated_spin_margin);
+}
+
+TEST_F(SleepingPoliciesTest, sample_cycle_time_reads_the_steady_clock_of_the_trigger_clock)
+{
+  const controller_manager::ControlLoopTimingConfig config{};
+  const auto trigger_time_before = cm_->get_trigger_clock()->now();
+  const auto cycle_time = sample_cycle_time(cm_, config);
+  const auto trigger_time_after = cm_->get_trigger_clock()->now();
+
+  EXPECT_EQ(trigger_time_before.get_clock_type(), cycle_time.get_clock_type());
+  EXPECT_GE(cycle_time, trigger_time_before);
+  EXPECT_LE(cycle_time, trigger_time_after);
+}
@@ -0,0 +1,89 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "controller_manager/warm_restart_checkpoint.hpp"
+
+using controller_manager::WarmRestartCheckpoint;
+
+namespace
+{
+WarmRestartCheckpoint make_checkpoint()
+{
+  WarmRestartCheckpoint checkpoint;
+  checkpoint.robot_description_hash = 0xcbf29ce484222325u;
+  checkpoint.hardware_components = {{"arm", 3}, {"gripper", 2}, {"camera", 1}};
+  checkpoint.controllers = {
+    {"admittance_controller", "admittance_controller/AdmittanceController", 3},
+    {"joint_trajectory_controller", "joint_trajectory_controller/JointTrajectoryController", 3},
+    {"joint_state_broadcaster", "joint_state_broadcaster/JointStateBroadcaster", 2}};
+  return checkpoint;
+}
+}  // namespace
+
+TEST(TestWarmRestartCheckpoint, serialization_roundtrip)
+{
+  const auto checkpoint = make_checkpoint();
+  const auto data = controller_manager::serialize_warm_restart_checkpoint(checkpoint);
+  EXPECT_EQ(controller_manager::deserialize_warm_restart_checkpoint(data), checkpoint);
+
+  WarmRestartCheckpoint empty_checkpoint;
+  EXPECT_EQ(
+    controller_manager::deserialize_warm_restart_checkpoint(
+      controller_manager::serialize_warm_restart_checkpoint(empty_checkpoint)),
+    empty_checkpoint);
+  EXPECT_NE(empty_checkpoint, checkpoint);
+}
+
+TEST(TestWarmRestartCheckpoint, invalid_data_throws)
+{
+  const auto data = controller_manager::serialize_warm_restart_checkpoint(make_checkpoint());
+  EXPECT_THROW(
+    controller_manager::deserialize_warm_restart_checkpoint(data.substr(0, data.size() / 2)),
+    std::runtime_error);
+  EXPECT_THROW(controller_manager::deserialize_warm_restart_checkpoint(""), std::runtime_error);
+  EXPECT_THROW(
+    controller_manager::deserialize_warm_restart_checkpoint(
+      "ros2_control_warm_restart 0 1\n0\n0\n"),
+    std::runtime_error);
+  EXPECT_THROW(
+    controller_manager::deserialize_warm_restart_checkpoint(
+      "ros2_control_warm_restart 1 1\n1\narm 300\n0\n"),
+    std::runtime_error);
+}
+
+TEST(TestWarmRestartCheckpoint, write_and_read_file)
+{
+  const auto path =
+    (std::filesystem::temp_directory_path() / "test_warm_restart_checkpoint.txt").string();
+  std::filesystem::remove(path);
+  WarmRestartCheckpoint checkpoint;
+  EXPECT_FALSE(controller_manager::read_warm_restart_checkpoint(path, checkpoint));
+
+  ASSERT_TRUE(controller_manager::write_warm_restart_checkpoint(path, make_checkpoint()));
+  EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+  ASSERT_TRUE(controller_manager::read_warm_restart_checkpoint(path, checkpoint));
+  EXPECT_EQ(checkpoint, make_checkpoint());
+
+  std::ofstream(path, std::ios::trunc) << "invalid";
+  EXPECT_THROW(
+    controller_manager::read_warm_restart_checkpoint(path, checkpoint), std::runtime_error);
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,73 @@
+# Copyright 2026 ros2_control Development Team
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+set(_ros2_control_interface_layout_script
+  "${CMAKE_CURRENT_LIST_DIR}/../scripts/generate_interface_layout.py")
+
+#
+# Generate a header with the layout of the interfaces of the ros2_control tags of a robot
+# description, and add it to the include directories of a target.
+#
+# The header has a struct per ros2_control tag with the names, the compile-time indices and the
+# types of its joints, sensors, GPIOs, state and command interfaces, see
+# hardware_interface/interface_layout.hpp. It is generated again when the description changes,
+# but not when a file included by a xacro description changes.
+#
+# :param target: the target using the layout
+# :type target: string
+# :param DESCRIPTION: the URDF or xacro file of the robot description
+# :type DESCRIPTION: string
+# :param HEADER: the include path of the generated header, "<target>/interface_layout.hpp" by
+#   default
+# :type HEADER: string
+# :param NAMESPACE: the C++ namespace of the layouts, "<target>" by default
+# :type NAMESPACE: string
+# :param XACRO_ARGS: the arguments of xacro, e.g., "use_mock_hardware:=true"
+# :type XACRO_ARGS: list of strings
+#
+function(ros2_control_generate_interface_layout target)
+  cmake_parse_arguments(ARG "" "DESCRIPTION;HEADER;NAMESPACE" "XACRO_ARGS" ${ARGN})
+  if(ARG_UNPARSED_ARGUMENTS)
+    message(FATAL_ERROR "ros2_control_generate_interface_layout() called with unused arguments: "
+      "${ARG_UNPARSED_ARGUMENTS}")
+  endif()
+  if(NOT ARG_DESCRIPTION)
+    message(FATAL_ERROR "ros2_control_generate_interface_layout() needs a DESCRIPTION")
+  endif()
+  if(NOT ARG_HEADER)
+    set(ARG_HEADER "${target}/interface_layout.hpp")
+  endif()
+  if(NOT ARG_NAMESPACE)
+    string(MAKE_C_IDENTIFIER "${target}" ARG_NAMESPACE)
+  endif()
+
+  find_package(Python3 REQUIRED COMPONENTS Interpreter)
+  get_filename_component(description "${ARG_DESCRIPTION}" ABSOLUTE)
+  set(include_dir "${CMAKE_CURRENT_BINARY_DIR}/ros2_control_interface_layout/${target}")
+  set(header "${include_dir}/${ARG_HEADER}")
+
+  add_custom_command(
+    OUTPUT "${header}"
+    COMMAND "${Python3_EXECUTABLE}" "${_ros2_control_interface_layout_script}"
+      --output "${header}" --namespace "${ARG_NAMESPACE}" --header-name "${ARG_HEADER}"
+      "${description}" -- ${ARG_XACRO_ARGS}
+    DEPENDS "${description}" "${_ros2_control_interface_layout_script}"
+    COMMENT "Generating the interface layout ${ARG_HEADER} of ${ARG_DESCRIPTION}"
+    VERBATIM
+  )
+  add_custom_target(${target}_interface_layout DEPENDS "${header}")
+  add_dependencies(${target} ${target}_interface_layout)
+
+  target_include_directories(${target} PUBLIC "$<BUILD_INTERFACE:${include_dir}>")
+endfunction()
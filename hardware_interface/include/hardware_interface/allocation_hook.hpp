@@ -0,0 +1,151 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__ALLOCATION_HOOK_HPP_
+#define HARDWARE_INTERFACE__ALLOCATION_HOOK_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+#include "hardware_interface/allocation_tracker.hpp"
+
+namespace hardware_interface
+{
+namespace detail
+{
+/// Allocates the memory of the operator new replacement, nullptr if it fails.
+inline void * allocate_tracked(std::size_t size) noexcept
+{
+  AllocationTracker::record_allocation();
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+/// Allocates the memory of the aligned operator new replacement, nullptr if it fails.
+inline void * allocate_tracked(std::size_t size, std::align_val_t alignment) noexcept
+{
+  AllocationTracker::record_allocation();
+  const std::size_t bytes = size == 0 ? 1 : size;
+  const std::size_t align = std::max(static_cast<std::size_t>(alignment), sizeof(void *));
+#if defined(_WIN32)
+  return _aligned_malloc(bytes, align);
+#else
+  void * ptr = nullptr;
+  return posix_memalign(&ptr, align, bytes) == 0 ? ptr : nullptr;
+#endif
+}
+
+/// Frees the memory allocated by allocate_tracked() with an alignment.
+inline void free_tracked_aligned(void * ptr) noexcept
+{
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+template <typename... AlignmentT>
+void * allocate_tracked_or_throw(std::size_t size, AlignmentT... alignment)
+{
+  if (void * ptr = allocate_tracked(size, alignment...))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+}  // namespace detail
+}  // namespace hardware_interface
+
+/// Replaces the global operator new and delete to report the allocations to the AllocationTracker.
+/**
+ * To be used once at namespace scope of one source file of an executable, e.g., of the
+ * ros2_control_node or of a test. It covers the single and array forms, with and without an
+ * alignment and nothrow, and marks the hook as installed, see
+ * AllocationTracker::is_hook_installed().
+ */
+#define HARDWARE_INTERFACE_DEFINE_ALLOCATION_HOOK()                                             \
+  void * operator new(std::size_t size)                                                        \
+  {                                                                                            \
+    return hardware_interface::detail::allocate_tracked_or_throw(size);                        \
+  }                                                                                            \
+  void * operator new[](std::size_t size)                                                      \
+  {                                                                                            \
+    return hardware_interface::detail::allocate_tracked_or_throw(size);                        \
+  }                                                                                            \
+  void * operator new(std::size_t size, const std::nothrow_t &) noexcept                       \
+  {                                                                                            \
+    return hardware_interface::detail::allocate_tracked(size);                                 \
+  }                                                                                            \
+  void * operator new[](std::size_t size, const std::nothrow_t &) noexcept                     \
+  {                                                                                            \
+    return hardware_interface::detail::allocate_tracked(size);                                 \
+  }                                                                                            \
+  void * operator new(std::size_t size, std::align_val_t alignment)                            \
+  {                                                                                            \
+    return hardware_interface::detail::allocate_tracked_or_throw(size, alignment);             \
+  }                                                                                            \
+  void * operator new[](std::size_t size, std::align_val_t alignment)                          \
+  {                                                                                            \
+    return hardware_interface::detail::allocate_tracked_or_throw(size, alignment);             \
+  }                                                                                            \
+  void * operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &)    \
+    noexcept                                                                                   \
+  {                                                                                            \
+    return hardware_interface::detail::allocate_tracked(size, alignment);                      \
+  }                                                                                            \
+  void * operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &)  \
+    noexcept                                                                                   \
+  {                                                                                            \
+    return hardware_interface::detail::allocate_tracked(size, alignment);                      \
+  }                                                                                            \
+  void operator delete(void * ptr) noexcept { std::free(ptr); }                                \
+  void operator delete[](void * ptr) noexcept { std::free(ptr); }                              \
+  void operator delete(void * ptr, std::size_t) noexcept { std::free(ptr); }                   \
+  void operator delete[](void * ptr, std::size_t) noexcept { std::free(ptr); }                 \
+  void operator delete(void * ptr, const std::nothrow_t &) noexcept { std::free(ptr); }        \
+  void operator delete[](void * ptr, const std::nothrow_t &) noexcept { std::free(ptr); }      \
+  void operator delete(void * ptr, std::align_val_t) noexcept                                  \
+  {                                                                                            \
+    hardware_interface::detail::free_tracked_aligned(ptr);                                     \
+  }                                                                                            \
+  void operator delete[](void * ptr, std::align_val_t) noexcept                                \
+  {                                                                                            \
+    hardware_interface::detail::free_tracked_aligned(ptr);                                     \
+  }                                                                                            \
+  void operator delete(void * ptr, std::size_t, std::align_val_t) noexcept                     \
+  {                                                                                            \
+    hardware_interface::detail::free_tracked_aligned(ptr);                                     \
+  }                                                                                            \
+  void operator delete[](void * ptr, std::size_t, std::align_val_t) noexcept                   \
+  {                                                                                            \
+    hardware_interface::detail::free_tracked_aligned(ptr);                                     \
+  }                                                                                            \
+  void operator delete(void * ptr, std::align_val_t, const std::nothrow_t &) noexcept          \
+  {                                                                                            \
+    hardware_interface::detail::free_tracked_aligned(ptr);                                     \
+  }                                                                                            \
+  void operator delete[](void * ptr, std::align_val_t, const std::nothrow_t &) noexcept        \
+  {                                                                                            \
+    hardware_interface::detail::free_tracked_aligned(ptr);                                     \
+  }                                                                                            \
+  static const bool hardware_interface_allocation_hook_installed =                             \
+    (hardware_interface::AllocationTracker::set_hook_installed(), true)
+
+#endif  // HARDWARE_INTERFACE__ALLOCATION_HOOK_HPP_
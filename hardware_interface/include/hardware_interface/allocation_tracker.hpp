@@ -0,0 +1,57 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__ALLOCATION_TRACKER_HPP_
+#define HARDWARE_INTERFACE__ALLOCATION_TRACKER_HPP_
+
+#include <cstdint>
+
+namespace hardware_interface
+{
+/// Counter of the heap allocations done by the threads of the real-time loop.
+/**
+ * The allocations are reported by a replacement of the global operator new, which has to be
+ * defined in the executable with HARDWARE_INTERFACE_DEFINE_ALLOCATION_HOOK() of
+ * allocation_hook.hpp, e.g., in the ros2_control_node. Only the allocations of the threads that
+ * enabled the tracking are counted, the counter of every thread is independent and monotonically
+ * increasing, so the allocations of a code section are obtained as the difference of the counter
+ * before and after it.
+ *
+ * All the methods are real-time safe and don't allocate memory.
+ */
+class AllocationTracker
+{
+public:
+  /// Records an allocation of the current thread, to be called by the operator new replacement.
+  static void record_allocation() noexcept;
+
+  /// Marks the allocation hook as installed, to be called once by the executable providing it.
+  static void set_hook_installed() noexcept;
+
+  /// Returns true if the executable provides the operator new replacement.
+  static bool is_hook_installed() noexcept;
+
+  /// Enables or disables the counting of the allocations of the current thread.
+  static void set_tracking_enabled(bool enabled) noexcept;
+
+  /// Returns true if the allocations of the current thread are counted.
+  static bool is_tracking_enabled() noexcept;
+
+  /// Returns the number of allocations counted for the current thread.
+  static uint64_t get_allocation_count() noexcept;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__ALLOCATION_TRACKER_HPP_
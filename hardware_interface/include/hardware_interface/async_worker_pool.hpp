@@ -0,0 +1,174 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef HARDWARE_INTERFACE__ASYNC_WORKER_POOL_HPP_
+#define HARDWARE_INTERFACE__ASYNC_WORKER_POOL_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/duration.hpp"
+#include "rclcpp/logger.hpp"
+#include "rclcpp/time.hpp"
+
+namespace hardware_interface
+{
+/// Parameters of the AsyncWorkerPool
+struct AsyncWorkerPoolParams
+{
+  /// Number of worker threads, 0 disables the pool
+  unsigned int number_of_workers = 0;
+  /// SCHED_FIFO priority of the worker threads
+  int thread_priority = 50;
+  /// CPU cores of the workers, the worker i is pinned to the core i modulo the number of cores
+  std::vector<int> cpu_affinity_cores = {};
+  /// Maximum number of tasks added to the pool at the same time
+  std::size_t max_tasks = 64;
+  /// Name prefix of the worker threads, used for logging
+  std::string name = "async_worker";
+  /// Bytes of the stack of every worker thread prefaulted at its start, see RealtimeThreadParams
+  std::size_t stack_prefault_size = 0;
+};
+
+/// Fixed-size pool of real-time threads executing the asynchronous cycles of many components.
+/**
+ * Every asynchronous controller or hardware component adds a task to the pool instead of spawning
+ * its own thread. Triggering a task doesn't block: if its previous cycle is still pending or
+ * running, the trigger fails and the component keeps reporting the result of its last finished
+ * cycle, as with realtime_tools::AsyncFunctionHandler. The trigger wakes a worker up by posting
+ * its semaphore, without locking a mutex, and every post is followed by a scan of the tasks by the
+ * woken worker, so a wake-up can't be lost and the idle workers block without a timeout.
+ *
+ * Every task has a home worker. The workers execute the pending tasks of their home first and
+ * then steal the pending tasks of the other workers, so the number of threads scales with the
+ * number of cores instead of the number of components. A trigger wakes the home worker of the task
+ * up, or an idle worker if the home worker is busy.
+ */
+class AsyncWorkerPool : public std::enable_shared_from_this<AsyncWorkerPool>
+{
+public:
+  using Callback = std::function<void(const rclcpp::Time &, const rclcpp::Duration &)>;
+
+  /// Asynchronous cycle of one component, owned by the pool.
+  class Task
+  {
+  public:
+    /// Triggers the callback with the given time and period, if the previous cycle finished.
+    /**
+     * \returns false if the previous cycle is still pending or running.
+     * \note This method is real-time safe and has to be called from one thread only.
+     */
+    bool trigger(const rclcpp::Time & time, const rclcpp::Duration & period);
+
+    /// Returns true if the callback is neither pending nor running.
+    bool is_idle() const;
+
+    /// Waits until the triggered cycle, if any, is finished.
+    void wait_until_idle() const;
+
+    /// Returns the time of the last triggered cycle, uninitialized before the first trigger.
+    const rclcpp::Time & get_current_callback_time() const { return time_; }
+
+    /// Returns the execution time of the last finished cycle.
+    std::chrono::nanoseconds get_last_execution_time() const
+    {
+      return std::chrono::nanoseconds(last_execution_time_ns_.load(std::memory_order_acquire));
+    }
+
+    /// Returns the worker thread executing the task first.
+    std::size_t get_home_worker() const { return home_worker_; }
+
+  private:
+    friend class AsyncWorkerPool;
+
+    enum State : std::uint8_t
+    {
+      FREE,
+      DISABLED,
+      IDLE,
+      PENDING,
+      RUNNING
+    };
+
+    AsyncWorkerPool * pool_ = nullptr;
+    std::size_t home_worker_ = 0;
+    std::atomic<std::uint8_t> state_{FREE};
+    Callback callback_;
+    rclcpp::Time time_;
+    rclcpp::Duration period_ = rclcpp::Duration::from_nanoseconds(0);
+    std::atomic<std::int64_t> last_execution_time_ns_{0};
+  };
+
+  explicit AsyncWorkerPool(
+    const AsyncWorkerPoolParams & params,
+    rclcpp::Logger logger = rclcpp::get_logger("async_worker_pool"));
+
+  ~AsyncWorkerPool();
+
+  AsyncWorkerPool(const AsyncWorkerPool &) = delete;
+  AsyncWorkerPool & operator=(const AsyncWorkerPool &) = delete;
+
+  /// Adds a task executing the callback, the task keeps the pool alive.
+  /**
+   * \returns the task, or nullptr if the pool has no workers or already has max_tasks tasks.
+   * \note This method is not real-time safe.
+   */
+  std::shared_ptr<Task> add_task(Callback callback);
+
+  /// Removes the task from the pool, waiting until its running cycle is finished.
+  /**
+   * A pending cycle that didn't start is dropped.
+   * \note This method is not real-time safe.
+   */
+  void remove_task(const std::shared_ptr<Task> & task);
+
+  /// Returns the number of worker threads.
+  std::size_t get_number_of_workers() const { return workers_.size(); }
+
+private:
+  /// Wake-up of a worker thread, defined in the translation unit
+  struct Worker;
+
+  void worker_loop(std::size_t worker_index, std::size_t number_of_workers);
+
+  /// Executes the task if it is pending, returns true if it was executed.
+  bool try_execute(Task & task);
+
+  /// Wakes up a worker for a newly pending task of the home worker, without blocking.
+  void notify_pending(std::size_t home_worker);
+
+  rclcpp::Logger logger_;
+  std::unique_ptr<Task[]> tasks_;
+  std::size_t max_tasks_ = 0;
+  /// Number of the first tasks that were ever used, the workers don't look further
+  std::atomic<std::size_t> used_tasks_{0};
+  std::mutex tasks_mutex_;
+
+  std::unique_ptr<Worker[]> wakeups_;
+  std::vector<std::thread> workers_;
+  std::atomic_bool stop_{false};
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__ASYNC_WORKER_POOL_HPP_
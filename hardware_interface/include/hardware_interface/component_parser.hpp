@@ -31,6 +31,19 @@ namespace hardware_interface
  */
 std::vector<HardwareInfo> parse_control_resources_from_urdf(const std::string & urdf);
 
+/// Extracts the parts of a URDF that are needed to parse its control resources.
+/**
+ * The URDF is scanned once, without building its document. The returned description has the
+ * robot element of the URDF with its `ros2_control` and `joint` elements, and its `link` elements
+ * reduced to their attributes, so that the possibly huge visual, collision and inertial elements
+ * are neither parsed by tinyxml2 nor by urdf::Model.
+ *
+ * \param[in] urdf string with robot's URDF
+ * \return the reduced description, or an empty string if the URDF can't be reduced, e.g., if its
+ * root element is not a robot tag or if it is not well-formed.
+ */
+std::string extract_control_resources_description(const std::string & urdf);
+
 /**
  * \param[in] component_info information about a component (gpio, joint, sensor)
  * \return vector filled with information about hardware's StateInterfaces for the component
@@ -0,0 +1,62 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__CYCLE_CONTEXT_HPP_
+#define HARDWARE_INTERFACE__CYCLE_CONTEXT_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+#include "rclcpp/duration.hpp"
+#include "rclcpp/time.hpp"
+
+namespace hardware_interface
+{
+/// Times of one cycle of the control loop, sampled once at its beginning.
+/**
+ * The controller manager computes the context at the beginning of the read, or of the update if
+ * the cycle has no read, and passes it to the read and write of the ResourceManager and to the
+ * update of the controllers. They so all see the same times, without reading the clocks again.
+ */
+struct CycleContext
+{
+  /// Steady clock at the beginning of the cycle, in nanoseconds.
+  int64_t monotonic_ns = 0;
+  /// Time of the node clock at the beginning of the cycle, passed to the update of the controllers.
+  rclcpp::Time ros_time = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
+  /// Time of the clock triggering the cycles, passed to the read and write of the hardware.
+  rclcpp::Time trigger_time = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
+  /// Period of the cycle.
+  rclcpp::Duration period = rclcpp::Duration(0, 0);
+  /// Number of the cycle, starting at 1, 0 before the first cycle.
+  uint64_t index = 0;
+  /// Steady clock by which the cycle should finish, in nanoseconds.
+  int64_t deadline_ns = 0;
+  /// Set if the previous cycle finished after its deadline.
+  bool overrun = false;
+
+  /// Returns the time left until the deadline of the cycle, negative once it's missed.
+  /**
+   * \note This method is real-time safe, it reads the steady clock.
+   */
+  std::chrono::nanoseconds get_time_to_deadline() const
+  {
+    return std::chrono::nanoseconds(deadline_ns) -
+           std::chrono::steady_clock::now().time_since_epoch();
+  }
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__CYCLE_CONTEXT_HPP_
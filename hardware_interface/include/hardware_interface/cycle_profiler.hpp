@@ -0,0 +1,118 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__CYCLE_PROFILER_HPP_
+#define HARDWARE_INTERFACE__CYCLE_PROFILER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Timing statistics of a section of the control loop, computed by the CycleProfiler
+struct ProfiledSection
+{
+  /// Registered name of the section, e.g., "<component>/write" or "<controller>/update"
+  std::string name;
+  /// Number of recorded executions of the section
+  std::size_t count = 0;
+  /// Statistics of the duration of the executions, in microseconds
+  double mean_us = 0.0;
+  double p99_us = 0.0;
+  double max_us = 0.0;
+  /// Share of the time of the profiled cycles in which the section was on the critical path
+  double critical_path_share = 0.0;
+  /// Number of overrun cycles attributed to the section
+  std::size_t overruns = 0;
+  /// Share of the overrun cycles attributed to the section
+  double overrun_share = 0.0;
+};
+
+/// Report of the cycles recorded by the CycleProfiler
+struct CycleProfileReport
+{
+  /// Number of recorded cycles
+  std::size_t cycles = 0;
+  /// Number of recorded cycles that took longer than their period
+  std::size_t overrun_cycles = 0;
+  /// Statistics of the duration of the cycles, in microseconds
+  double cycle_mean_us = 0.0;
+  double cycle_p99_us = 0.0;
+  double cycle_max_us = 0.0;
+  /// Number of executions of sections that didn't fit in the sections of their cycle
+  std::size_t dropped_sections = 0;
+  /// Sections ranked by their share of the overruns, then by their share of the critical path
+  std::vector<ProfiledSection> sections;
+
+  /// Returns the report as text, one line per section, e.g., for the logs.
+  std::string to_string() const;
+};
+
+/// Recorder of the sections of a fixed number of control cycles, to find the bottlenecks.
+/**
+ * While recording, the sections measured by a TraceScope, i.e., the phases of the control loop,
+ * the controller updates and the hardware component reads and writes, are stored into a
+ * preallocated table, whatever the thread running them. The cycles are delimited by end_cycle(),
+ * called by the thread of the control loop.
+ *
+ * The report computes, for every section, its duration statistics and its share of the critical
+ * path, i.e., of the time in which the section was the innermost running section of its thread
+ * and, of the sections running in parallel on other threads, the one ending last. Every overrun
+ * cycle is attributed to the section whose time on the critical path exceeded its median by the
+ * most, so that the tail offenders are ranked first.
+ *
+ * record(), end_cycle() and is_recording() are real-time safe and don't allocate memory.
+ */
+class CycleProfiler
+{
+public:
+  /// Allocates the table and starts recording at the next cycle.
+  /**
+   * The table is only reallocated if it is too small, when no thread is recording into it.
+   *
+   * \param[in] cycles number of cycles to record.
+   * \param[in] sections_per_cycle maximum number of sections recorded in a cycle, the further
+   * sections are dropped.
+   * \return false if the recording couldn't start, i.e., if a recording is already running or
+   * if a parameter is 0.
+   */
+  static bool start(std::size_t cycles, std::size_t sections_per_cycle);
+
+  /// Returns true while the sections are recorded.
+  static bool is_recording() noexcept;
+
+  /// Returns true once all the requested cycles are recorded.
+  static bool is_finished() noexcept;
+
+  /// Records a section of the current cycle, if the recording is running.
+  static void record(uint32_t name_id, int64_t begin_ns, int64_t end_ns) noexcept;
+
+  /// Ends the current cycle, which began at \p begin_ns and should take at most \p period_ns.
+  /**
+   * \note Only the thread of the control loop ends the cycles.
+   */
+  static void end_cycle(int64_t begin_ns, int64_t end_ns, int64_t period_ns) noexcept;
+
+  /// Stops the recording and computes the report of the recorded cycles.
+  /**
+   * \note This method is not real-time safe.
+   */
+  static CycleProfileReport stop();
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__CYCLE_PROFILER_HPP_
@@ -0,0 +1,93 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__CYCLE_TRACE_RING_HPP_
+#define HARDWARE_INTERFACE__CYCLE_TRACE_RING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hardware_interface
+{
+struct TraceEvent;
+
+/// Always-on ring of the sections of the last control cycles, frozen when an overrun occurs.
+/**
+ * Unlike the TraceRecorder, which needs a thread draining it continuously, the ring keeps the
+ * sections measured by a TraceScope during the last cycles only, overwriting the oldest cycle at
+ * every end_cycle(). When the control loop detects an overrun, freeze() copies the cycles of the
+ * ring into a preallocated buffer, which a non real-time thread takes with take_frozen_events(),
+ * e.g., to write them with TraceRecorder::write_chrome_trace_events(). The ring keeps recording
+ * while the frozen cycles wait to be taken, but an overrun is not frozen until they are taken.
+ *
+ * The sections of the asynchronous components and controllers are recorded into the cycle
+ * running when they end. record(), end_cycle() and freeze() are real-time safe and don't allocate
+ * memory.
+ */
+class CycleTraceRing
+{
+public:
+  /// Allocates the ring and enables the recording.
+  /**
+   * The ring is allocated on the first call only and never released, so that the recording
+   * threads can't access released memory. Later calls only enable the recording again.
+   *
+   * \param[in] cycles number of complete cycles kept in the ring and frozen on an overrun.
+   * \param[in] sections_per_cycle maximum number of sections of a cycle, the further sections are
+   * dropped.
+   */
+  static void enable(std::size_t cycles, std::size_t sections_per_cycle);
+
+  /// Disables the recording, the frozen cycles can still be taken.
+  static void disable() noexcept;
+
+  static bool is_enabled() noexcept;
+
+  /// Records a section of the current cycle, if the recording is enabled.
+  static void record(uint32_t name_id, int64_t begin_ns, int64_t end_ns) noexcept;
+
+  /// Records the cycle itself as a section named \p name_id and starts the next cycle.
+  /**
+   * The cycle is frozen before its sections and isn't counted in the \p sections_per_cycle.
+   *
+   * \note Only the thread of the control loop ends the cycles.
+   */
+  static void end_cycle(uint32_t name_id, int64_t begin_ns, int64_t end_ns) noexcept;
+
+  /// Freezes the complete cycles of the ring, e.g., when an overrun is detected.
+  /**
+   * \return false if the recording is disabled, if the previous frozen cycles were not taken yet
+   * or if the cycles were already frozen since the last end_cycle().
+   * \note Only the thread of the control loop freezes the ring.
+   */
+  static bool freeze() noexcept;
+
+  /// Moves the events of the frozen cycles to the end of \p events, oldest cycle first.
+  /**
+   * \return number of moved events, 0 if no cycles are frozen.
+   * \note Only one thread can take the events at a time.
+   */
+  static std::size_t take_frozen_events(std::vector<TraceEvent> & events);
+
+  /// Returns the number of times the ring was frozen.
+  static uint64_t get_number_of_freezes() noexcept;
+
+  /// Returns the number of freezes skipped because the previous frozen cycles were not taken yet.
+  static uint64_t get_skipped_freezes() noexcept;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__CYCLE_TRACE_RING_HPP_
@@ -0,0 +1,82 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__CYCLE_TRIGGER_HPP_
+#define HARDWARE_INTERFACE__CYCLE_TRIGGER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace hardware_interface
+{
+/// Start of the control cycles signaled by a hardware component, e.g., from its bus driver.
+/**
+ * A hardware component whose bus or sensor paces the control loop, e.g., an EtherCAT master with
+ * distributed clocks or a camera trigger, calls notify() at the start of every cycle. The control
+ * loop waits in wait_for() and runs its read, update and write as soon as it is notified, instead
+ * of sleeping on its own clock.
+ */
+class CycleTrigger
+{
+public:
+  /// Signals the start of a cycle and wakes up the waiting control loop.
+  /**
+   * \note This method doesn't allocate memory, it may be called from the real-time thread of a
+   * driver.
+   */
+  void notify()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++pending_cycles_;
+    }
+    cv_.notify_one();
+  }
+
+  /// Waits until the start of a cycle is signaled, or until the timeout expires.
+  /**
+   * The cycles signaled while the control loop was still running the previous cycle are dropped
+   * and counted as missed.
+   *
+   * \param[in] timeout maximum duration to wait.
+   * \returns true if the start of a cycle was signaled, false on timeout.
+   */
+  bool wait_for(std::chrono::nanoseconds timeout)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!cv_.wait_for(lock, timeout, [this]() { return pending_cycles_ > 0; }))
+    {
+      return false;
+    }
+    missed_cycles_.fetch_add(pending_cycles_ - 1, std::memory_order_relaxed);
+    pending_cycles_ = 0;
+    return true;
+  }
+
+  /// Returns the number of signaled cycles that were dropped, since the trigger was created.
+  std::uint64_t get_missed_cycles() const { return missed_cycles_.load(std::memory_order_relaxed); }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::uint64_t pending_cycles_ = 0;
+  std::atomic<std::uint64_t> missed_cycles_{0};
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__CYCLE_TRIGGER_HPP_
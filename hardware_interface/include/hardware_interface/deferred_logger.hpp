@@ -0,0 +1,295 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__DEFERRED_LOGGER_HPP_
+#define HARDWARE_INTERFACE__DEFERRED_LOGGER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "rclcpp/logger.hpp"
+#include "rcutils/logging.h"
+
+namespace hardware_interface
+{
+/// Maximum number of arguments of a deferred log message, the further arguments are not printed
+constexpr std::size_t kMaxDeferredLogArguments = 12;
+/// Size of the buffer of a deferred log message holding its logger name
+constexpr std::size_t kDeferredLogLoggerNameSize = 96;
+/// Size of the buffer of a deferred log message holding its string arguments
+constexpr std::size_t kDeferredLogStringsSize = 256;
+
+/// Argument of a deferred log message, copied by value
+struct DeferredLogArgument
+{
+  enum class Type : uint8_t
+  {
+    SIGNED,
+    UNSIGNED,
+    FLOATING_POINT,
+    POINTER,
+    STRING
+  };
+
+  Type type = Type::SIGNED;
+  union
+  {
+    int64_t signed_value = 0;
+    uint64_t unsigned_value;
+    double floating_point_value;
+    const void * pointer_value;
+    /// Offset of the copied string in DeferredLogRecord::strings
+    std::size_t string_offset;
+  };
+};
+
+/// Log message captured on a real-time thread, formatted later by the DeferredLogger
+struct DeferredLogRecord
+{
+  /// Location of the call site, with static storage duration
+  const rcutils_log_location_t * location = nullptr;
+  /// printf-like format string of the message, with static storage duration
+  const char * format = nullptr;
+  int severity = RCUTILS_LOG_SEVERITY_UNSET;
+  /// Capture time on the steady clock, in nanoseconds, to order the messages of all the threads
+  int64_t stamp_ns = 0;
+  std::size_t number_of_arguments = 0;
+  std::size_t strings_size = 0;
+  std::array<DeferredLogArgument, kMaxDeferredLogArguments> arguments;
+  /// Null-terminated logger name, truncated if needed
+  std::array<char, kDeferredLogLoggerNameSize> logger_name;
+  /// Null-terminated copies of the string arguments, truncated if the buffer is full
+  std::array<char, kDeferredLogStringsSize> strings;
+
+  void set_logger_name(const char * name) noexcept
+  {
+    const std::string_view name_view(name);
+    const std::size_t size = std::min(name_view.size(), logger_name.size() - 1);
+    name_view.copy(logger_name.data(), size);
+    logger_name[size] = '\0';
+  }
+
+  /// Copies the argument, strings of any type are copied into the strings buffer.
+  template <typename T>
+  void add_argument(const T & value) noexcept
+  {
+    if (number_of_arguments >= arguments.size())
+    {
+      return;
+    }
+    auto & argument = arguments[number_of_arguments++];
+    using ValueType = std::decay_t<T>;
+    if constexpr (
+      std::is_same_v<ValueType, const char *> || std::is_same_v<ValueType, char *> ||
+      std::is_convertible_v<const T &, std::string_view>)
+    {
+      argument.type = DeferredLogArgument::Type::STRING;
+      argument.string_offset = copy_string(to_string_view(value));
+    }
+    else if constexpr (std::is_floating_point_v<ValueType>)
+    {
+      argument.type = DeferredLogArgument::Type::FLOATING_POINT;
+      argument.floating_point_value = static_cast<double>(value);
+    }
+    else if constexpr (std::is_enum_v<ValueType>)
+    {
+      argument.type = DeferredLogArgument::Type::SIGNED;
+      argument.signed_value = static_cast<int64_t>(value);
+    }
+    else if constexpr (
+      std::is_integral_v<ValueType> && std::is_unsigned_v<ValueType> &&
+      !std::is_same_v<ValueType, bool>)
+    {
+      argument.type = DeferredLogArgument::Type::UNSIGNED;
+      argument.unsigned_value = static_cast<uint64_t>(value);
+    }
+    else if constexpr (std::is_integral_v<ValueType>)
+    {
+      argument.type = DeferredLogArgument::Type::SIGNED;
+      argument.signed_value = static_cast<int64_t>(value);
+    }
+    else if constexpr (std::is_pointer_v<ValueType>)
+    {
+      argument.type = DeferredLogArgument::Type::POINTER;
+      argument.pointer_value = static_cast<const void *>(value);
+    }
+    else
+    {
+      static_assert(
+        std::is_pointer_v<ValueType>,
+        "Deferred log arguments have to be strings, arithmetic types, enums or pointers");
+    }
+  }
+
+  /// Returns the copied string of a STRING argument.
+  const char * get_string(const DeferredLogArgument & argument) const noexcept
+  {
+    return strings.data() + argument.string_offset;
+  }
+
+private:
+  template <typename T>
+  static std::string_view to_string_view(const T & value) noexcept
+  {
+    // only the pointers can be null, not the arrays
+    if constexpr (std::is_pointer_v<T>)
+    {
+      return value ? std::string_view(value) : std::string_view("(null)");
+    }
+    else
+    {
+      return std::string_view(value);
+    }
+  }
+
+  std::size_t copy_string(std::string_view value) noexcept
+  {
+    // the last character of the buffer is kept as terminator of the strings that don't fit
+    const std::size_t offset = std::min(strings_size, strings.size() - 1);
+    const std::size_t size = std::min(value.size(), strings.size() - 1 - offset);
+    value.copy(strings.data() + offset, size);
+    strings[offset + size] = '\0';
+    strings_size = std::min(offset + size + 1, strings.size() - 1);
+    return offset;
+  }
+};
+
+/// Backend deferring the formatting and the output of the log messages of the real-time threads.
+/**
+ * The RT_LOG_* macros copy the location, the format string and the arguments of a message into a
+ * preallocated ring buffer of the calling thread, without formatting it, locking or allocating
+ * memory. A background thread started with start() drains the ring buffers periodically, formats
+ * the messages in the order they were captured and outputs them through rcutils, with the logger
+ * and the location of the call site, so they reach the same handlers as the RCLCPP_* messages.
+ *
+ * The messages logged while a ring buffer is full are dropped and counted, the background thread
+ * reports the number of dropped messages. While the backend is not started, and for the threads
+ * exceeding the number of ring buffers, the messages are formatted and output immediately.
+ *
+ * The format strings are printf-like, as for the RCLCPP_* macros, but have to be string literals.
+ * The arguments can be strings, which are copied, arithmetic types, enums or pointers.
+ */
+class DeferredLogger
+{
+public:
+  /// Allocates the ring buffers and starts the background thread, if not started yet.
+  /**
+   * The ring buffers are allocated on the first call only and never released, so that the
+   * logging threads can't access released memory. Every call has to be paired with a stop().
+   *
+   * \param[in] records_per_thread capacity of the ring buffer of every logging thread.
+   * \param[in] max_threads number of ring buffers.
+   * \param[in] flush_period period of the background thread draining the ring buffers.
+   */
+  static void start(
+    std::size_t records_per_thread, std::size_t max_threads,
+    std::chrono::milliseconds flush_period = std::chrono::milliseconds(10));
+
+  /// Stops the background thread after the last paired start() and outputs the pending messages.
+  static void stop();
+
+  static bool is_started() noexcept;
+
+  /// Logs a message of the calling thread, see the RT_LOG_* macros.
+  /**
+   * \note This method is real-time safe if the backend is started and the thread has a ring
+   * buffer.
+   */
+  template <typename... Args>
+  static void log(
+    const rcutils_log_location_t & location, int severity, const rclcpp::Logger & logger,
+    const char * format, const Args &... args) noexcept
+  {
+    RCUTILS_LOGGING_AUTOINIT;
+    const char * logger_name = logger.get_name();
+    if (logger_name == nullptr || !rcutils_logging_logger_is_enabled_for(logger_name, severity))
+    {
+      return;
+    }
+    DeferredLogRecord record;
+    record.location = &location;
+    record.format = format;
+    record.severity = severity;
+    record.stamp_ns = now();
+    record.set_logger_name(logger_name);
+    (record.add_argument(args), ...);
+    push(record);
+  }
+
+  /// Formats and outputs the pending messages of all the threads.
+  /**
+   * \return number of output messages.
+   * \note Called periodically by the background thread, only one thread can flush at a time.
+   */
+  static std::size_t flush();
+
+  /// Returns the number of messages dropped because the ring buffer of their thread was full.
+  static uint64_t get_dropped_messages() noexcept;
+
+  /// Formats the message of the record like printf.
+  /**
+   * Every conversion uses the next argument, converted to the type of the conversion if needed.
+   * The conversions without argument, and the ones with a '*' width or precision, are printed
+   * verbatim.
+   */
+  static std::string format(const DeferredLogRecord & record);
+
+private:
+  static int64_t now() noexcept;
+
+  static void push(const DeferredLogRecord & record) noexcept;
+};
+
+}  // namespace hardware_interface
+
+/// Logs a message through the DeferredLogger, the arguments are the ones of the RCLCPP_* macros.
+#define RT_LOG(severity, logger, ...)                                                          \
+  do                                                                                           \
+  {                                                                                            \
+    static const rcutils_log_location_t rt_log_location = {                                    \
+      __func__, __FILE__, static_cast<size_t>(__LINE__)};                                      \
+    ::hardware_interface::DeferredLogger::log(rt_log_location, severity, logger, __VA_ARGS__); \
+  } while (0)
+
+#define RT_LOG_EXPRESSION(severity, logger, expression, ...) \
+  do                                                         \
+  {                                                          \
+    if (expression)                                          \
+    {                                                        \
+      RT_LOG(severity, logger, __VA_ARGS__);                 \
+    }                                                        \
+  } while (0)
+
+#define RT_LOG_DEBUG(logger, ...) RT_LOG(RCUTILS_LOG_SEVERITY_DEBUG, logger, __VA_ARGS__)
+#define RT_LOG_INFO(logger, ...) RT_LOG(RCUTILS_LOG_SEVERITY_INFO, logger, __VA_ARGS__)
+#define RT_LOG_WARN(logger, ...) RT_LOG(RCUTILS_LOG_SEVERITY_WARN, logger, __VA_ARGS__)
+#define RT_LOG_ERROR(logger, ...) RT_LOG(RCUTILS_LOG_SEVERITY_ERROR, logger, __VA_ARGS__)
+#define RT_LOG_FATAL(logger, ...) RT_LOG(RCUTILS_LOG_SEVERITY_FATAL, logger, __VA_ARGS__)
+
+#define RT_LOG_DEBUG_EXPRESSION(logger, expression, ...) \
+  RT_LOG_EXPRESSION(RCUTILS_LOG_SEVERITY_DEBUG, logger, expression, __VA_ARGS__)
+#define RT_LOG_INFO_EXPRESSION(logger, expression, ...) \
+  RT_LOG_EXPRESSION(RCUTILS_LOG_SEVERITY_INFO, logger, expression, __VA_ARGS__)
+#define RT_LOG_WARN_EXPRESSION(logger, expression, ...) \
+  RT_LOG_EXPRESSION(RCUTILS_LOG_SEVERITY_WARN, logger, expression, __VA_ARGS__)
+#define RT_LOG_ERROR_EXPRESSION(logger, expression, ...) \
+  RT_LOG_EXPRESSION(RCUTILS_LOG_SEVERITY_ERROR, logger, expression, __VA_ARGS__)
+
+#endif  // HARDWARE_INTERFACE__DEFERRED_LOGGER_HPP_
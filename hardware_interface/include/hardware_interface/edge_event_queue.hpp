@@ -0,0 +1,166 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__EDGE_EVENT_QUEUE_HPP_
+#define HARDWARE_INTERFACE__EDGE_EVENT_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "hardware_interface/name_pool.hpp"
+
+namespace hardware_interface
+{
+/// Change of a boolean state interface detected by a hardware component, e.g., of a GPIO input.
+struct EdgeEvent
+{
+  /// Id of the full name of the state interface in the NamePool, see Handle::get_name_id().
+  NameId interface_id = NamePool::EMPTY_ID;
+  /// New value of the interface.
+  bool value = false;
+  /// Time stamp of the change in nanoseconds, in the clock of the hardware component.
+  int64_t stamp = 0;
+};
+
+/// Bounded queue of the edge events of a hardware component.
+/**
+ * The component pushes the events from its read, also when it runs in its own thread, and the
+ * ResourceManager pops them after the read of all the components into the EdgeEventList of the
+ * cycle.
+ *
+ * \note The queue is lock-free for a single producer and a single consumer, and doesn't allocate
+ * memory after its construction.
+ */
+class EdgeEventQueue
+{
+public:
+  /**
+   * \param[in] capacity maximal number of events waiting to be popped.
+   */
+  explicit EdgeEventQueue(std::size_t capacity) : events_(capacity + 1) {}
+
+  std::size_t capacity() const { return events_.size() - 1; }
+
+  /// Adds an event, called by the hardware component.
+  /**
+   * \returns false if the queue is full, the event is then dropped and counted.
+   */
+  bool push(const EdgeEvent & event) noexcept
+  {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    const std::size_t next = (tail + 1) % events_.size();
+    if (next == head_.load(std::memory_order_acquire))
+    {
+      dropped_events_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    events_[tail] = event;
+    tail_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  /// Pops all the events, the oldest first, called by the consumer.
+  /**
+   * \param[in] callback callable with the signature `void(const EdgeEvent &)`.
+   * \returns the number of popped events.
+   */
+  template <typename Callback>
+  std::size_t pop_all(Callback && callback)
+  {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    const std::size_t tail = tail_.load(std::memory_order_acquire);
+    std::size_t number_of_events = 0;
+    while (head != tail)
+    {
+      callback(events_[head]);
+      head = (head + 1) % events_.size();
+      ++number_of_events;
+    }
+    head_.store(head, std::memory_order_release);
+    return number_of_events;
+  }
+
+  /// Number of events dropped because the queue was full.
+  uint64_t get_dropped_events() const { return dropped_events_.load(std::memory_order_relaxed); }
+
+private:
+  /// One slot is kept free to tell a full queue from an empty one
+  std::vector<EdgeEvent> events_;
+  std::atomic<std::size_t> head_{0};
+  std::atomic<std::size_t> tail_{0};
+  std::atomic<uint64_t> dropped_events_{0};
+};
+
+/// Edge events of all the hardware components collected in one control cycle.
+/**
+ * The ResourceManager clears the list at every read and fills it with the events pushed by the
+ * components since the previous read, so that the controllers process the changes of their
+ * inputs in O(events) instead of polling all the interfaces every cycle.
+ *
+ * \note The list isn't thread-safe, it's filled and read by the control loop and doesn't allocate
+ * memory after its construction: the events beyond its capacity are dropped and counted.
+ */
+class EdgeEventList
+{
+public:
+  EdgeEventList() = default;
+
+  explicit EdgeEventList(std::size_t capacity) { events_.reserve(capacity); }
+
+  std::size_t capacity() const { return events_.capacity(); }
+
+  std::size_t size() const { return events_.size(); }
+
+  bool empty() const { return events_.empty(); }
+
+  const EdgeEvent & operator[](std::size_t index) const { return events_[index]; }
+
+  std::vector<EdgeEvent>::const_iterator begin() const { return events_.begin(); }
+
+  std::vector<EdgeEvent>::const_iterator end() const { return events_.end(); }
+
+  /// Removes the events of the previous cycle.
+  void clear()
+  {
+    events_.clear();
+    dropped_events_ = 0;
+  }
+
+  /// Adds an event, dropped if the list is full.
+  void push(const EdgeEvent & event)
+  {
+    if (events_.size() == events_.capacity())
+    {
+      ++dropped_events_;
+      return;
+    }
+    events_.push_back(event);
+  }
+
+  /// Number of events of the cycle dropped because the list or a queue of a component was full.
+  uint64_t get_dropped_events() const { return dropped_events_; }
+
+  /// Counts the events dropped by the queue of a component.
+  void add_dropped_events(uint64_t dropped_events) { dropped_events_ += dropped_events; }
+
+private:
+  std::vector<EdgeEvent> events_;
+  uint64_t dropped_events_ = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__EDGE_EVENT_QUEUE_HPP_
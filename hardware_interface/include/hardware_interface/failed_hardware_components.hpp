@@ -0,0 +1,124 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__FAILED_HARDWARE_COMPONENTS_HPP_
+#define HARDWARE_INTERFACE__FAILED_HARDWARE_COMPONENTS_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Hardware components that failed in a read or write cycle, reported by their index.
+/**
+ * The indices are the ones of ResourceManager::get_hardware_component_index(). The list is
+ * preallocated for all the loaded components whenever they change, so that the read and write
+ * cycles report their failures without allocating memory or copying names. Iterating over the
+ * list yields the names of the failed components.
+ */
+class FailedHardwareComponents
+{
+public:
+  using value_type = std::string;
+  using size_type = std::size_t;
+  using reference = const std::string &;
+  using const_reference = const std::string &;
+
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string *;
+    using reference = const std::string &;
+
+    const_iterator() = default;
+
+    const_iterator(
+      std::vector<std::size_t>::const_iterator index, const std::vector<std::string> * names)
+    : index_(index), names_(names)
+    {
+    }
+
+    reference operator*() const { return (*names_)[*index_]; }
+
+    pointer operator->() const { return &(*names_)[*index_]; }
+
+    const_iterator & operator++()
+    {
+      ++index_;
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const_iterator previous = *this;
+      ++index_;
+      return previous;
+    }
+
+    bool operator==(const const_iterator & other) const { return index_ == other.index_; }
+
+    bool operator!=(const const_iterator & other) const { return index_ != other.index_; }
+
+  private:
+    std::vector<std::size_t>::const_iterator index_;
+    const std::vector<std::string> * names_ = nullptr;
+  };
+
+  using iterator = const_iterator;
+
+  /// Empties the list and preallocates it for the components named \p names, by index.
+  /**
+   * \note The names have to outlive the list, or the list has to be reset before they are
+   * released. This method is not real-time safe.
+   */
+  void reset(const std::vector<std::string> & names)
+  {
+    names_ = &names;
+    indices_.clear();
+    indices_.reserve(names.size());
+  }
+
+  /// Empties the list, without releasing its memory.
+  void clear() noexcept { indices_.clear(); }
+
+  /// Adds the component of index \p index, within the capacity preallocated by reset().
+  void push_back(std::size_t index) { indices_.push_back(index); }
+
+  bool empty() const noexcept { return indices_.empty(); }
+
+  size_type size() const noexcept { return indices_.size(); }
+
+  /// Returns the indices of the failed components, in the order they were reported.
+  const std::vector<std::size_t> & get_indices() const noexcept { return indices_; }
+
+  /// Returns the name of the \p i-th failed component.
+  const std::string & operator[](std::size_t i) const { return (*names_)[indices_[i]]; }
+
+  const_iterator begin() const { return const_iterator(indices_.begin(), names_); }
+
+  const_iterator end() const { return const_iterator(indices_.end(), names_); }
+
+private:
+  std::vector<std::size_t> indices_;
+  const std::vector<std::string> * names_ = nullptr;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__FAILED_HARDWARE_COMPONENTS_HPP_
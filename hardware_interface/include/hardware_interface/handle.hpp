@@ -16,23 +16,32 @@
 #define HARDWARE_INTERFACE__HANDLE_HPP_
 
 #include <fmt/compile.h>
+#ifndef _WIN32
+#include <cxxabi.h>
+#endif
 
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <optional>
 #include <shared_mutex>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "hardware_interface/hardware_info.hpp"
 #include "hardware_interface/introspection.hpp"
 #include "hardware_interface/lexical_casts.hpp"
 #include "hardware_interface/macros.hpp"
+#include "hardware_interface/name_pool.hpp"
 
 #include "rclcpp/logging.hpp"
 
@@ -60,26 +69,57 @@ std::string get_type_name()
 namespace hardware_interface
 {
 
+/// True for the data types whose value can be stored outside of a handle, see
+/// Handle::relocate_packed_value_storage() and Handle::relocate_float32_value_storage().
+template <typename T>
+inline constexpr bool is_external_value_type_v =
+  !std::is_same_v<T, std::monostate> && (sizeof(T) == 1 || std::is_same_v<T, float>);
+
+/// View of the contiguous values of an array interface, see Handle::read_array().
+template <typename T>
+class ArraySpan
+{
+public:
+  ArraySpan(T * data, std::size_t size) : data_(data), size_(size) {}
+
+  T * data() const { return data_; }
+
+  std::size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  T & operator[](std::size_t index) const { return data_[index]; }
+
+  T * begin() const { return data_; }
+
+  T * end() const { return data_ + size_; }
+
+private:
+  T * data_;
+  std::size_t size_;
+};
+
 /// A handle used to get and set a value on a given interface.
 class Handle
 {
 public:
   [[deprecated("Use InterfaceDescription for initializing the Interface")]]
   Handle(const std::string & prefix_name, const std::string & interface_name, double * value_ptr)
-  : prefix_name_(prefix_name),
-    interface_name_(interface_name),
-    handle_name_(prefix_name_ + "/" + interface_name_),
-    value_ptr_(value_ptr)
+  : value_ptr_(value_ptr), names_(make_names(prefix_name, interface_name))
   {
+    update_typed_value_ptr();
   }
 
+  /**
+   * @param array_size Number of values of the array data types, or capacity of the sample batch
+   * data types, ignored for the other data types. The values of an array are all initialized to
+   * \p initial_value.
+   */
   explicit Handle(
     const std::string & prefix_name, const std::string & interface_name,
-    const std::string & data_type = "double", const std::string & initial_value = "")
-  : prefix_name_(prefix_name),
-    interface_name_(interface_name),
-    handle_name_(prefix_name_ + "/" + interface_name_),
-    data_type_(data_type)
+    const std::string & data_type = "double", const std::string & initial_value = "",
+    std::size_t array_size = 1)
+  : data_type_(data_type), names_(make_names(prefix_name, interface_name))
   {
     // we need to initialize according the type passed in interface description
     if (data_type_ == hardware_interface::HandleDataType::DOUBLE)
@@ -95,7 +135,7 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else if (data_type_ == hardware_interface::HandleDataType::FLOAT32)
@@ -112,7 +152,7 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else if (data_type_ == hardware_interface::HandleDataType::BOOL)
@@ -127,7 +167,7 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else if (data_type_ == hardware_interface::HandleDataType::UINT8)
@@ -144,7 +184,7 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else if (data_type_ == hardware_interface::HandleDataType::INT8)
@@ -161,7 +201,7 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else if (data_type_ == hardware_interface::HandleDataType::UINT16)
@@ -178,7 +218,7 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else if (data_type_ == hardware_interface::HandleDataType::INT16)
@@ -195,7 +235,7 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else if (data_type_ == hardware_interface::HandleDataType::UINT32)
@@ -212,7 +252,7 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else if (data_type_ == hardware_interface::HandleDataType::INT32)
@@ -229,7 +269,51 @@ public:
         throw std::invalid_argument(
           fmt::format(
             FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+            initial_value, get_name(), data_type_.to_string()));
+      }
+    }
+    else if (data_type_.is_array())
+    {
+      if (array_size == 0)
+      {
+        throw std::invalid_argument(
+          fmt::format(
+            FMT_COMPILE("Invalid size: 0 for array interface: '{}' with type: '{}'"), get_name(),
+            data_type_.to_string()));
+      }
+      try
+      {
+        value_ptr_ = nullptr;
+        init_array_value(initial_value, array_size);
+      }
+      catch (const std::invalid_argument & err)
+      {
+        throw std::invalid_argument(
+          fmt::format(
+            FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
+            initial_value, get_name(), data_type_.to_string()));
+      }
+    }
+    else if (data_type_.is_sample_batch())
+    {
+      if (array_size == 0)
+      {
+        throw std::invalid_argument(
+          fmt::format(
+            FMT_COMPILE("Invalid capacity: 0 for sample batch interface: '{}' with type: '{}'"),
+            get_name(), data_type_.to_string()));
+      }
+      try
+      {
+        value_ptr_ = nullptr;
+        init_sample_value(initial_value, array_size);
+      }
+      catch (const std::invalid_argument & err)
+      {
+        throw std::invalid_argument(
+          fmt::format(
+            FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
+            initial_value, get_name(), data_type_.to_string()));
       }
     }
     else
@@ -237,29 +321,35 @@ public:
       throw std::runtime_error(
         fmt::format(
           FMT_COMPILE("Invalid data type: '{}' for interface: {}. Check supported types."),
-          data_type, handle_name_));
+          data_type, get_name()));
     }
+    update_typed_value_ptr();
   }
 
   explicit Handle(const InterfaceDescription & interface_description)
   : Handle(
       interface_description.get_prefix_name(), interface_description.get_interface_name(),
       interface_description.get_data_type_string(),
-      interface_description.interface_info.initial_value)
+      interface_description.interface_info.initial_value,
+      static_cast<std::size_t>(std::max(interface_description.interface_info.size, 1)))
   {
+    if (interface_description.interface_info.lock_free)
+    {
+      enable_lock_free_storage();
+    }
   }
 
   [[deprecated("Use InterfaceDescription for initializing the Interface")]]
 
   explicit Handle(const std::string & interface_name)
-  : interface_name_(interface_name), handle_name_("/" + interface_name_), value_ptr_(nullptr)
+  : value_ptr_(nullptr), names_(make_names("", interface_name))
   {
   }
 
   [[deprecated("Use InterfaceDescription for initializing the Interface")]]
 
   explicit Handle(const char * interface_name)
-  : interface_name_(interface_name), handle_name_("/" + interface_name_), value_ptr_(nullptr)
+  : value_ptr_(nullptr), names_(make_names("", interface_name))
   {
   }
 
@@ -287,11 +377,14 @@ public:
   /// Returns true if handle references a value.
   inline operator bool() const { return value_ptr_ != nullptr; }
 
-  const std::string & get_name() const { return handle_name_; }
+  const std::string & get_name() const { return *names_->handle_name; }
+
+  const std::string & get_interface_name() const { return *names_->interface_name; }
 
-  const std::string & get_interface_name() const { return interface_name_; }
+  const std::string & get_prefix_name() const { return *names_->prefix_name; }
 
-  const std::string & get_prefix_name() const { return prefix_name_; }
+  /// Returns the id of the name of the handle in the NamePool, to compare or hash it cheaply.
+  NameId get_name_id() const { return names_->handle_name_id; }
 
   /**
    * @brief Get the value of the handle.
@@ -306,6 +399,17 @@ public:
   template <typename T = double>
   [[nodiscard]] std::optional<T> get_optional() const
   {
+    if (lock_free_)
+    {
+      return get_lock_free_value<T>();
+    }
+    if constexpr (std::is_same_v<T, double>)
+    {
+      if (serial_access_)
+      {
+        return *value_ptr_;
+      }
+    }
     std::shared_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
     return get_optional<T>(lock);
   }
@@ -323,10 +427,18 @@ public:
   template <typename T = double>
   [[nodiscard]] std::optional<T> get_optional(std::shared_lock<std::shared_mutex> & lock) const
   {
+    if (lock_free_)
+    {
+      return get_lock_free_value<T>();
+    }
     if (!lock.owns_lock())
     {
       return std::nullopt;
     }
+    if (const T * typed_value = get_typed_value_ptr<T>())
+    {
+      return *typed_value;
+    }
     // BEGIN (Handle export change): for backward compatibility
     // TODO(saikishor) return value_ if old functionality is removed
     if constexpr (std::is_same_v<T, double>)
@@ -351,8 +463,13 @@ public:
                 .c_str());
             notified_ = true;
           }
-          return static_cast<double>(std::get<bool>(value_));
-        case HandleDataType::FLOAT32:  // fallthrough
+          return static_cast<double>(get_variant_value<bool>());
+        case HandleDataType::FLOAT32:
+          if (narrowed_to_float32_)
+          {
+            return static_cast<double>(get_variant_value<float>());
+          }
+          [[fallthrough]];
         case HandleDataType::UINT8:    // fallthrough
         case HandleDataType::INT8:     // fallthrough
         case HandleDataType::UINT16:   // fallthrough
@@ -374,7 +491,7 @@ public:
     }
     try
     {
-      return std::get<T>(value_);
+      return get_variant_value<T>();
     }
     catch (const std::bad_variant_access & err)
     {
@@ -403,6 +520,11 @@ public:
                   !std::is_same_v<std::decay_t<T>, std::shared_lock<std::shared_mutex>>>>
   [[nodiscard]] bool get_value(T & value, bool wait_for_lock) const
   {
+    if (lock_free_)
+    {
+      value = get_lock_free_value<T>();
+      return true;
+    }
     if (wait_for_lock)
     {
       std::shared_lock<std::shared_mutex> lock(handle_mutex_);
@@ -429,6 +551,11 @@ public:
   template <typename T>
   [[nodiscard]] bool set_value(const T & value, bool wait_for_lock)
   {
+    if (lock_free_)
+    {
+      set_lock_free_value(value);
+      return true;
+    }
     if (wait_for_lock)
     {
       std::unique_lock<std::shared_mutex> lock(handle_mutex_);
@@ -455,6 +582,19 @@ public:
   template <typename T>
   [[nodiscard]] bool set_value(const T & value)
   {
+    if (lock_free_)
+    {
+      set_lock_free_value(value);
+      return true;
+    }
+    if constexpr (std::is_same_v<T, double>)
+    {
+      if (serial_access_)
+      {
+        store_value(*value_ptr_, value);
+        return true;
+      }
+    }
     std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
     return set_value(lock, value);
   }
@@ -474,17 +614,32 @@ public:
   template <typename T>
   [[nodiscard]] bool set_value(std::unique_lock<std::shared_mutex> & lock, const T & value)
   {
+    if (lock_free_)
+    {
+      set_lock_free_value(value);
+      return true;
+    }
     if (!lock.owns_lock())
     {
       return false;
     }
+    if (T * typed_value = get_typed_value_ptr<T>())
+    {
+      store_value(*typed_value, value);
+      return true;
+    }
     // BEGIN (Handle export change): for backward compatibility
     // TODO(Manuel) set value_ directly if old functionality is removed
     if constexpr (std::is_same_v<T, double>)
     {
+      if (narrowed_to_float32_)
+      {
+        set_variant_value(static_cast<float>(value));
+        return true;
+      }
       // If the template is of type double, check if the value_ptr_ is not nullptr
       THROW_ON_NULLPTR(value_ptr_);
-      *value_ptr_ = value;
+      store_value(*value_ptr_, value);
     }
     else
     {
@@ -495,201 +650,1250 @@ public:
             FMT_COMPILE("Invalid data type: '{}' access for interface: {} expected: '{}'"),
             get_type_name<T>(), get_name(), data_type_.to_string()));
       }
-      value_ = value;
+      set_variant_value(value);
     }
     return true;
     // END
   }
 
-  std::shared_mutex & get_mutex() const { return handle_mutex_; }
-
-  HandleDataType get_data_type() const { return data_type_; }
-
-  /// Returns true if the handle data type can be casted to double.
-  bool is_castable_to_double() const { return data_type_.is_castable_to_double(); }
-
-  bool is_valid() const
-  {
-    return (value_ptr_ != nullptr) || !std::holds_alternative<std::monostate>(value_);
-  }
-
-protected:
   /**
-   * @brief Get the value of the handle.
-   * @tparam T The type of the value to be retrieved.
-   * @param lock The lock to access the value.
+   * @brief Get the value of a handle of type double, without checking its data type.
    * @param value The variable to store the retrieved value.
-   * @return true if the value is retrieved successfully, false otherwise.
+   * @return true if the value is retrieved successfully, false if the handle could not be locked.
+   *
    * @note The method is thread-safe and non-blocking.
-   * @note Ideal for the data types that are large in size to avoid copy during return.
+   * @note The handle must be checked to be double readable beforehand, see is_double_readable(),
+   * e.g., once when the interfaces are claimed, to skip the checks of every access in the
+   * real-time loop.
    */
-  template <typename T>
-  [[nodiscard]] bool get_value(std::shared_lock<std::shared_mutex> & lock, T & value) const
+  [[nodiscard]] bool get_double_unchecked(double & value) const
   {
-    if (!lock.owns_lock())
-    {
-      return false;
-    }
-    // BEGIN (Handle export change): for backward compatibility
-    // TODO(saikishor) get value_ if old functionality is removed
-    if constexpr (std::is_same_v<T, double>)
+    if (lock_free_)
     {
-      switch (data_type_)
-      {
-        case HandleDataType::DOUBLE:
-          THROW_ON_NULLPTR(value_ptr_);
-          value = *value_ptr_;
-          return true;
-        case HandleDataType::BOOL:
-          // TODO(christophfroehlich): replace with RCLCPP_WARN_ONCE once
-          // https://github.com/ros2/rclcpp/issues/2587
-          // is fixed
-          if (!notified_)
-          {
-            RCLCPP_WARN(
-              rclcpp::get_logger(get_name()),
-              "Casting bool to double for interface: %s. Better use get_optional<bool>().",
-              get_name().c_str());
-            notified_ = true;
-          }
-          value = static_cast<double>(std::get<bool>(value_));
-          return true;
-        case HandleDataType::FLOAT32:  // fallthrough
-        case HandleDataType::UINT8:    // fallthrough
-        case HandleDataType::INT8:     // fallthrough
-        case HandleDataType::UINT16:   // fallthrough
-        case HandleDataType::INT16:    // fallthrough
-        case HandleDataType::UINT32:   // fallthrough
-        case HandleDataType::INT32:    // fallthrough
-          throw std::runtime_error(
-            fmt::format(
-              FMT_COMPILE(
-                "Data type: '{}' will not be casted to double for interface: {}. Use "
-                "get_optional<{}>() instead."),
-              data_type_.to_string(), get_name(), data_type_.to_string()));
-        default:
-          throw std::runtime_error(
-            fmt::format(
-              FMT_COMPILE("Data type: '{}' cannot be casted to double for interface: {}"),
-              data_type_.to_string(), get_name()));
-      }
+      value = load_lock_free_bits<double>();
+      return true;
     }
-    try
+    if (serial_access_)
     {
-      value = std::get<T>(value_);
+      value = *value_ptr_;
       return true;
     }
-    catch (const std::bad_variant_access & err)
+    std::shared_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
     {
-      throw std::runtime_error(
-        fmt::format(
-          FMT_COMPILE("Invalid data type: '{}' access for interface: {} expected: '{}'"),
-          get_type_name<T>(), get_name(), data_type_.to_string()));
+      return false;
     }
+    value = narrowed_to_float32_ ? static_cast<double>(*get_typed_value_ptr<float>()) : *value_ptr_;
+    return true;
   }
 
-private:
-  void copy(const Handle & other) noexcept
+  /**
+   * @brief Set the value of a handle of type double, without checking its data type.
+   * @param value The value to be set.
+   * @return true if the value is set successfully, false if the handle could not be locked.
+   *
+   * @note The method is thread-safe and non-blocking.
+   * @note The handle must be checked to be double readable beforehand, see is_double_readable().
+   */
+  [[nodiscard]] bool set_double_unchecked(double value)
   {
-    std::scoped_lock lock(other.handle_mutex_, handle_mutex_);
-    prefix_name_ = other.prefix_name_;
-    interface_name_ = other.interface_name_;
-    handle_name_ = other.handle_name_;
-    value_ = other.value_;
-    data_type_ = other.data_type_;
-    if (std::holds_alternative<std::monostate>(value_))
+    if (lock_free_)
     {
-      value_ptr_ = other.value_ptr_;
+      store_lock_free_bits(value);
+      return true;
     }
-    else
+    if (serial_access_)
     {
-      value_ptr_ = std::get_if<double>(&value_);
+      store_value(*value_ptr_, value);
+      return true;
     }
-  }
-
-  void swap(Handle & first, Handle & second) noexcept
-  {
-    std::scoped_lock lock(first.handle_mutex_, second.handle_mutex_);
-    std::swap(first.prefix_name_, second.prefix_name_);
-    std::swap(first.interface_name_, second.interface_name_);
-    std::swap(first.handle_name_, second.handle_name_);
-    std::swap(first.value_, second.value_);
-    std::swap(first.data_type_, second.data_type_);
-    std::swap(first.value_ptr_, second.value_ptr_);
-  }
-
-protected:
-  /// @note The methods copy and swap need to be updated, if new members are added.
-  std::string prefix_name_;
-  std::string interface_name_;
-  std::string handle_name_;
-  HANDLE_DATATYPE value_ = std::monostate{};
-  HandleDataType data_type_ = HandleDataType::DOUBLE;
-  // BEGIN (Handle export change): for backward compatibility
-  // TODO(Manuel) redeclare as HANDLE_DATATYPE * value_ptr_ if old functionality is removed
-  double * value_ptr_ = nullptr;
-  // END
-  mutable std::shared_mutex handle_mutex_;
-
-private:
-  // TODO(christophfroehlich): remove once
-  // https://github.com/ros2/rclcpp/issues/2587
-  // is fixed
-  mutable bool notified_ = false;
-};
-
-class StateInterface : public Handle
-{
-public:
-  explicit StateInterface(const InterfaceDescription & interface_description)
-  : Handle(interface_description)
-  {
-  }
-
-  void registerIntrospection() const
-  {
-    if (!is_valid())
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
     {
-      RCLCPP_WARN(
-        rclcpp::get_logger(get_name()),
-        "Cannot register state introspection for state interface: %s without a valid value "
-        "pointer or initialized value.",
-        get_name().c_str());
-      return;
+      return false;
     }
-    if (value_ptr_ || data_type_.is_castable_to_double())
+    if (narrowed_to_float32_)
     {
-      std::function<double()> f = [this]()
+      store_value(*get_typed_value_ptr<float>(), static_cast<float>(value));
+      return true;
+    }
+    store_value(*value_ptr_, value);
+    return true;
+  }
+
+  /// Returns the number of values of an array interface, 0 if the interface holds a single value.
+  std::size_t get_array_size() const
+  {
+    return std::visit(
+      [](const auto & array) -> std::size_t
       {
-        if (value_ptr_)
+        if constexpr (std::is_same_v<std::decay_t<decltype(array)>, std::monostate>)
         {
-          return *value_ptr_;
+          return 0;
         }
         else
         {
-          return data_type_.cast_to_double(value_);
+          return array.size();
         }
-      };
-      DEFAULT_REGISTER_ROS2_CONTROL_INTROSPECTION("state_interface." + get_name(), f);
-    }
+      },
+      array_value_);
   }
 
-  void unregisterIntrospection() const
+  /**
+   * @brief Read the values of an array interface in place, without copying them.
+   * @tparam T The type of the values of the array.
+   * @param reader Callable invoked with an ArraySpan<const T> of all the values while the handle
+   * is locked. The span must not be used after the call.
+   * @return true if the values were read, false if the handle could not be locked.
+   * @throw std::runtime_error if the handle doesn't hold an array of values of type T.
+   *
+   * @note The method is thread-safe and non-blocking. The writers are excluded while the reader is
+   * invoked, so that it sees all the values of the same update.
+   */
+  template <typename T, typename Reader>
+  [[nodiscard]] bool read_array(Reader && reader) const
   {
-    if (is_valid() && (value_ptr_ || data_type_.is_castable_to_double()))
+    const std::vector<T> & array = get_array_storage<T>();
+    std::shared_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
     {
-      DEFAULT_UNREGISTER_ROS2_CONTROL_INTROSPECTION("state_interface." + get_name());
+      return false;
     }
+    reader(ArraySpan<const T>(array.data(), array.size()));
+    return true;
   }
 
-  StateInterface(const StateInterface & other) = default;
-
-  StateInterface(StateInterface && other) = default;
-
-  using Handle::Handle;
-
-  using SharedPtr = std::shared_ptr<StateInterface>;
-  using ConstSharedPtr = std::shared_ptr<const StateInterface>;
+  /**
+   * @brief Update the values of an array interface in place.
+   * @tparam T The type of the values of the array.
+   * @param writer Callable invoked with an ArraySpan<T> of all the values while the handle is
+   * locked. The span must not be used after the call.
+   * @return true if the values were updated, false if the handle could not be locked.
+   * @throw std::runtime_error if the handle doesn't hold an array of values of type T.
+   *
+   * @note The method is thread-safe and non-blocking. The readers see either all the values
+   * before or all the values after the update. The value generation is incremented by every
+   * update, even if the writer doesn't change any value.
+   */
+  template <typename T, typename Writer>
+  [[nodiscard]] bool write_array(Writer && writer)
+  {
+    std::vector<T> & array = const_cast<std::vector<T> &>(get_array_storage<T>());
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    writer(ArraySpan<T>(array.data(), array.size()));
+    increment_value_generation();
+    return true;
+  }
+
+  /**
+   * @brief Copy the values of an array interface.
+   * @param values The memory to copy the values to.
+   * @param size The number of values, has to be the size of the array.
+   * @return true if the values were copied, false if the handle could not be locked.
+   * @throw std::runtime_error if the handle doesn't hold an array of \p size values of type T.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  template <typename T>
+  [[nodiscard]] bool get_array(T * values, std::size_t size) const
+  {
+    check_array_size<T>(size);
+    return read_array<T>([values](ArraySpan<const T> array)
+                         { std::copy(array.begin(), array.end(), values); });
+  }
+
+  /**
+   * @brief Set all the values of an array interface.
+   * @param values The values to copy to the array.
+   * @param size The number of values, has to be the size of the array.
+   * @return true if the values were set, false if the handle could not be locked.
+   * @throw std::runtime_error if the handle doesn't hold an array of \p size values of type T.
+   *
+   * @note The method is thread-safe and non-blocking. The value generation is only incremented if
+   * a value changed.
+   */
+  template <typename T>
+  [[nodiscard]] bool set_array(const T * values, std::size_t size)
+  {
+    check_array_size<T>(size);
+    std::vector<T> & array = const_cast<std::vector<T> &>(get_array_storage<T>());
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    if (std::memcmp(array.data(), values, size * sizeof(T)) != 0)
+    {
+      std::copy(values, values + size, array.begin());
+      increment_value_generation();
+    }
+    return true;
+  }
+
+  /// Returns the capacity of a sample batch interface, 0 if the interface holds a single value.
+  std::size_t get_sample_capacity() const
+  {
+    return std::visit(
+      [](const auto & samples) -> std::size_t
+      {
+        if constexpr (std::is_same_v<std::decay_t<decltype(samples)>, std::monostate>)
+        {
+          return 0;
+        }
+        else
+        {
+          return samples.capacity();
+        }
+      },
+      sample_value_);
+  }
+
+  /**
+   * @brief Read the samples of a sample batch interface in place, without copying them.
+   * @tparam T The type of the values of the samples.
+   * @param reader Callable invoked with a SampleBatch<T> of the samples, the oldest first, while
+   * the handle is locked. The batch must not be used after the call.
+   * @return true if the samples were read, false if the handle could not be locked.
+   * @throw std::runtime_error if the handle doesn't hold a batch of samples of type T.
+   *
+   * @note The method is thread-safe and non-blocking. The writers are excluded while the reader is
+   * invoked, so that it sees all the samples of the same update.
+   */
+  template <typename T, typename Reader>
+  [[nodiscard]] bool read_samples(Reader && reader) const
+  {
+    const SampleRing<T> & samples = get_sample_storage<T>();
+    std::shared_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    reader(samples.get_batch());
+    return true;
+  }
+
+  /**
+   * @brief Add samples to a sample batch interface.
+   * @param values The values of the samples, the oldest first.
+   * @param stamps The time stamps of the samples in nanoseconds.
+   * @param size The number of samples. If the batch is full, the oldest samples are overwritten
+   * and counted as dropped.
+   * @return true if the samples were added, false if the handle could not be locked.
+   * @throw std::runtime_error if the handle doesn't hold a batch of samples of type T.
+   *
+   * @note The method is thread-safe, non-blocking and doesn't allocate memory.
+   */
+  template <typename T>
+  [[nodiscard]] bool push_samples(const T * values, const int64_t * stamps, std::size_t size)
+  {
+    SampleRing<T> & samples = const_cast<SampleRing<T> &>(get_sample_storage<T>());
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      samples.push(values[i], stamps[i]);
+    }
+    increment_value_generation();
+    return true;
+  }
+
+  /**
+   * @brief Replace the samples of a sample batch interface, e.g., by the samples of a new cycle in
+   * the read() of the hardware component.
+   * @return true if the samples were replaced, false if the handle could not be locked.
+   * @throw std::runtime_error if the handle doesn't hold a batch of samples of type T.
+   *
+   * @note The method is thread-safe, non-blocking and doesn't allocate memory. The readers see
+   * either all the samples before or all the samples after the update.
+   */
+  template <typename T>
+  [[nodiscard]] bool set_samples(const T * values, const int64_t * stamps, std::size_t size)
+  {
+    SampleRing<T> & samples = const_cast<SampleRing<T> &>(get_sample_storage<T>());
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    samples.clear();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      samples.push(values[i], stamps[i]);
+    }
+    increment_value_generation();
+    return true;
+  }
+
+  /**
+   * @brief Remove all the samples of a sample batch interface.
+   * @return true if the samples were removed, false if the handle could not be locked.
+   * @throw std::runtime_error if the handle doesn't hold a batch of samples.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  [[nodiscard]] bool clear_samples()
+  {
+    if (std::holds_alternative<std::monostate>(sample_value_))
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid sample batch access for interface: {} of type: '{}'"), get_name(),
+          data_type_.to_string()));
+    }
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    std::visit(
+      [](auto & samples)
+      {
+        if constexpr (!std::is_same_v<std::decay_t<decltype(samples)>, std::monostate>)
+        {
+          samples.clear();
+        }
+      },
+      sample_value_);
+    increment_value_generation();
+    return true;
+  }
+
+  std::shared_mutex & get_mutex() const { return handle_mutex_; }
+
+  HandleDataType get_data_type() const { return data_type_; }
+
+  /// Returns true if the handle data type can be casted to double.
+  bool is_castable_to_double() const { return data_type_.is_castable_to_double(); }
+
+  /**
+   * @brief Get the value of the handle casted to double, whatever its data type.
+   * @return The value casted to double, std::nullopt if the handle is not valid, its data type
+   * cannot be casted to double or it could not be locked.
+   *
+   * @note The method is thread-safe, non-blocking and doesn't log any cast warning.
+   */
+  [[nodiscard]] std::optional<double> get_optional_as_double() const
+  {
+    if (!is_valid() || !(value_ptr_ || data_type_.is_castable_to_double()))
+    {
+      return std::nullopt;
+    }
+    if (lock_free_)
+    {
+      return get_lock_free_value_as_double();
+    }
+    std::shared_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return std::nullopt;
+    }
+    if (value_ptr_)
+    {
+      return *value_ptr_;
+    }
+    return data_type_.cast_to_double(get_current_value());
+  }
+
+  bool is_valid() const
+  {
+    return (value_ptr_ != nullptr) || !std::holds_alternative<std::monostate>(value_) ||
+           !std::holds_alternative<std::monostate>(array_value_) ||
+           !std::holds_alternative<std::monostate>(sample_value_);
+  }
+
+  /// Returns true if the handle value is stored in a lock-free atomic word.
+  bool is_lock_free() const { return lock_free_; }
+
+  /// Returns the number of changes of the value of the handle.
+  /**
+   * The generation is incremented whenever the setters of the handle or its typed views store a
+   * value with a different bit pattern, so that the publishers of the interface values can skip
+   * the interfaces that didn't change since the generation they last published, see
+   * InterfaceChangeTracker.
+   *
+   * @note The values written through the pointer passed to the deprecated constructor aren't
+   * tracked, see is_value_change_tracked().
+   */
+  uint64_t get_value_generation() const
+  {
+    return value_generation_.load(std::memory_order_acquire);
+  }
+
+  /// Returns true if all the changes of the value are counted by get_value_generation().
+  bool is_value_change_tracked() const
+  {
+    return !value_storage_bound_ && (!std::holds_alternative<std::monostate>(value_) ||
+                                     !std::holds_alternative<std::monostate>(array_value_) ||
+                                     !std::holds_alternative<std::monostate>(sample_value_));
+  }
+
+  /**
+   * @brief Bind an accessor in place to the double value of the handle, e.g., a transmission
+   * handle converting the value without copying it.
+   * @return The storage of the value, read and written by the accessor without locking the handle.
+   * @throw std::runtime_error if the handle doesn't hold a value of type double or is lock-free.
+   * @note The changes written to the storage aren't counted by get_value_generation(), so
+   * is_value_change_tracked() returns false from now on. The storage is valid until the value is
+   * relocated, see relocate_value_storage(), e.g., when the ResourceManager reconfigures the
+   * storages of the interfaces after an update of the robot description.
+   * @note This method is not real-time safe.
+   */
+  double * bind_value_storage()
+  {
+    if (lock_free_ || data_type_ != HandleDataType::DOUBLE || !value_ptr_)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("In place binding is not supported for interface: '{}' with type: '{}'"),
+          get_name(), data_type_.to_string()));
+    }
+    value_storage_bound_ = true;
+    return value_ptr_;
+  }
+
+  /// Returns true if an accessor was bound in place to the value, see bind_value_storage().
+  bool is_value_storage_bound() const { return value_storage_bound_; }
+
+  /// Accesses the double value of the handle without locking it.
+  /**
+   * For the handles that are only accessed by one thread at a time in a guaranteed serial order,
+   * e.g., the reference and state interfaces exported by a chainable controller and used by the
+   * other controllers of its chain in the same update cycle. The values of type double are then
+   * read and written directly, without the locking of the handle.
+   *
+   * @throw std::runtime_error if the handle doesn't hold a value of type double or is lock-free.
+   */
+  void enable_serial_access()
+  {
+    if (lock_free_ || data_type_ != HandleDataType::DOUBLE || !value_ptr_)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Serial access is not supported for interface: '{}' with type: '{}'"),
+          get_name(), data_type_.to_string()));
+    }
+    serial_access_ = true;
+  }
+
+  /// Returns true if the double value of the handle is accessed without locking it.
+  bool is_serial_access() const { return serial_access_; }
+
+  /// Returns true if the handle owns a double value that can be moved to an external storage.
+  bool has_relocatable_value_storage() const
+  {
+    return !lock_free_ && std::holds_alternative<double>(value_);
+  }
+
+  /**
+   * @brief Relocate the double value of the handle to the given memory location.
+   * The current value is copied to the new location and all the further accesses of the handle use
+   * it. Passing nullptr moves the value back to the storage owned by the handle.
+   * @param storage The memory location to store the value at, or nullptr.
+   * @throw std::runtime_error if the handle value cannot be relocated.
+   * @note The memory has to outlive the handle or the value has to be moved back before it is
+   * released.
+   * @note This method is not real-time safe.
+   */
+  void relocate_value_storage(double * storage)
+  {
+    if (!has_relocatable_value_storage())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Storage of the interface: '{}' with type: '{}' cannot be relocated."),
+          get_name(), data_type_.to_string()));
+    }
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_);
+    double * target = storage ? storage : std::get_if<double>(&value_);
+    if (target != value_ptr_)
+    {
+      *target = *value_ptr_;
+      value_ptr_ = target;
+    }
+    update_typed_value_ptr();
+  }
+
+  /// Returns true if the handle owns a value of type bool, uint8 or int8 that can be moved to an
+  /// external byte storage.
+  bool has_packable_value_storage() const
+  {
+    return !lock_free_ && (std::holds_alternative<bool>(value_) ||
+                           std::holds_alternative<uint8_t>(value_) ||
+                           std::holds_alternative<int8_t>(value_));
+  }
+
+  /**
+   * @brief Relocate the one byte value of the handle to the given memory location.
+   * The current value is copied to the new location and all the further accesses of the handle use
+   * it. Passing nullptr moves the value back to the storage owned by the handle.
+   * @param storage The memory location to store the value at, or nullptr.
+   * @throw std::runtime_error if the handle value cannot be relocated.
+   * @note The memory has to outlive the handle or the value has to be moved back before it is
+   * released.
+   * @note This method is not real-time safe.
+   */
+  void relocate_packed_value_storage(uint8_t * storage)
+  {
+    if (!has_packable_value_storage())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Storage of the interface: '{}' with type: '{}' cannot be packed."),
+          get_name(), data_type_.to_string()));
+    }
+    relocate_external_value_storage(storage);
+  }
+
+  /// Returns true if the handle owns a double value that can be narrowed to float32, see
+  /// narrow_to_float32().
+  bool has_narrowable_value_storage() const
+  {
+    return has_relocatable_value_storage() && !serial_access_ && !value_storage_bound_;
+  }
+
+  /**
+   * @brief Store the double value of the handle as float32 from now on.
+   * The data type of the handle becomes float32, so the typed accessors and views of type float
+   * read and write the value directly. The accessors of type double keep working for the legacy
+   * hardware components and controllers, they convert the value from and to float32.
+   * @throw std::runtime_error if the handle value cannot be narrowed.
+   * @note The value loses the precision of a double, and the value of the legacy pointer based
+   * API is not available anymore.
+   * @note This method is not real-time safe and has to be called before the handle is used.
+   */
+  void narrow_to_float32()
+  {
+    if (!has_narrowable_value_storage())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Interface: '{}' with type: '{}' cannot be narrowed to float32."),
+          get_name(), data_type_.to_string()));
+    }
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_);
+    value_ = static_cast<float>(*value_ptr_);
+    value_ptr_ = nullptr;
+    data_type_ = HandleDataType::FLOAT32;
+    narrowed_to_float32_ = true;
+    update_typed_value_ptr();
+  }
+
+  /// Returns true if the double value of the handle was narrowed to float32.
+  bool is_narrowed_to_float32() const { return narrowed_to_float32_; }
+
+  /// Returns true if the value is accessed as double by get_double_unchecked(),
+  /// set_double_unchecked() and the views of type double, i.e., the handle is of type double or its
+  /// double value was narrowed to float32, see narrow_to_float32().
+  bool is_double_readable() const
+  {
+    return data_type_ == HandleDataType::DOUBLE || narrowed_to_float32_;
+  }
+
+  /// Returns true if the handle owns a float32 value that can be moved to an external storage.
+  bool has_relocatable_float32_value_storage() const
+  {
+    return !lock_free_ && std::holds_alternative<float>(value_);
+  }
+
+  /**
+   * @brief Relocate the float32 value of the handle to the given memory location.
+   * The current value is copied to the new location and all the further accesses of the handle use
+   * it. Passing nullptr moves the value back to the storage owned by the handle.
+   * @param storage The memory location to store the value at, or nullptr.
+   * @throw std::runtime_error if the handle value cannot be relocated.
+   * @note The memory has to outlive the handle or the value has to be moved back before it is
+   * released.
+   * @note This method is not real-time safe.
+   */
+  void relocate_float32_value_storage(float * storage)
+  {
+    if (!has_relocatable_float32_value_storage())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Storage of the interface: '{}' with type: '{}' cannot be relocated."),
+          get_name(), data_type_.to_string()));
+    }
+    relocate_external_value_storage(reinterpret_cast<uint8_t *>(storage));
+  }
+
+protected:
+  /**
+   * @brief Get the value of the handle.
+   * @tparam T The type of the value to be retrieved.
+   * @param lock The lock to access the value.
+   * @param value The variable to store the retrieved value.
+   * @return true if the value is retrieved successfully, false otherwise.
+   * @note The method is thread-safe and non-blocking.
+   * @note Ideal for the data types that are large in size to avoid copy during return.
+   */
+  template <typename T>
+  [[nodiscard]] bool get_value(std::shared_lock<std::shared_mutex> & lock, T & value) const
+  {
+    if (lock_free_)
+    {
+      value = get_lock_free_value<T>();
+      return true;
+    }
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    if (const T * typed_value = get_typed_value_ptr<T>())
+    {
+      value = *typed_value;
+      return true;
+    }
+    // BEGIN (Handle export change): for backward compatibility
+    // TODO(saikishor) get value_ if old functionality is removed
+    if constexpr (std::is_same_v<T, double>)
+    {
+      switch (data_type_)
+      {
+        case HandleDataType::DOUBLE:
+          THROW_ON_NULLPTR(value_ptr_);
+          value = *value_ptr_;
+          return true;
+        case HandleDataType::BOOL:
+          // TODO(christophfroehlich): replace with RCLCPP_WARN_ONCE once
+          // https://github.com/ros2/rclcpp/issues/2587
+          // is fixed
+          if (!notified_)
+          {
+            RCLCPP_WARN(
+              rclcpp::get_logger(get_name()),
+              "Casting bool to double for interface: %s. Better use get_optional<bool>().",
+              get_name().c_str());
+            notified_ = true;
+          }
+          value = static_cast<double>(get_variant_value<bool>());
+          return true;
+        case HandleDataType::FLOAT32:
+          if (narrowed_to_float32_)
+          {
+            value = static_cast<double>(get_variant_value<float>());
+            return true;
+          }
+          [[fallthrough]];
+        case HandleDataType::UINT8:    // fallthrough
+        case HandleDataType::INT8:     // fallthrough
+        case HandleDataType::UINT16:   // fallthrough
+        case HandleDataType::INT16:    // fallthrough
+        case HandleDataType::UINT32:   // fallthrough
+        case HandleDataType::INT32:    // fallthrough
+          throw std::runtime_error(
+            fmt::format(
+              FMT_COMPILE(
+                "Data type: '{}' will not be casted to double for interface: {}. Use "
+                "get_optional<{}>() instead."),
+              data_type_.to_string(), get_name(), data_type_.to_string()));
+        default:
+          throw std::runtime_error(
+            fmt::format(
+              FMT_COMPILE("Data type: '{}' cannot be casted to double for interface: {}"),
+              data_type_.to_string(), get_name()));
+      }
+    }
+    try
+    {
+      value = get_variant_value<T>();
+      return true;
+    }
+    catch (const std::bad_variant_access & err)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid data type: '{}' access for interface: {} expected: '{}'"),
+          get_type_name<T>(), get_name(), data_type_.to_string()));
+    }
+  }
+
+  /**
+   * @brief Switch the handle to the lock-free storage mode.
+   * The current value is moved into an atomic word, so that readers never fail and writers never
+   * block. The mutex of the handle is not used anymore for accessing the value.
+   * @throw std::runtime_error if the handle doesn't own its value.
+   */
+  void enable_lock_free_storage()
+  {
+    if (std::holds_alternative<std::monostate>(value_))
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Lock-free storage is not supported for interface: '{}' with type: '{}'"),
+          get_name(), data_type_.to_string()));
+    }
+    std::visit(
+      [this](const auto & v)
+      {
+        if constexpr (!std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+        {
+          store_lock_free_bits(v);
+        }
+      },
+      value_);
+    lock_free_ = true;
+  }
+
+  /// Access the lock-free stored value with the same type checks as the mutex guarded storage.
+  template <typename T>
+  T get_lock_free_value() const
+  {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "Lock-free storage supports only scalar types");
+    if constexpr (std::is_same_v<T, double>)
+    {
+      switch (data_type_)
+      {
+        case HandleDataType::DOUBLE:
+          return load_lock_free_bits<double>();
+        case HandleDataType::BOOL:
+          return static_cast<double>(load_lock_free_bits<bool>());
+        default:
+          throw std::runtime_error(
+            fmt::format(
+              FMT_COMPILE(
+                "Data type: '{}' will not be casted to double for interface: {}. Use "
+                "get_optional<{}>() instead."),
+              data_type_.to_string(), get_name(), data_type_.to_string()));
+      }
+    }
+    else
+    {
+      if (!std::holds_alternative<T>(value_))
+      {
+        throw std::runtime_error(
+          fmt::format(
+            FMT_COMPILE("Invalid data type: '{}' access for interface: {} expected: '{}'"),
+            get_type_name<T>(), get_name(), data_type_.to_string()));
+      }
+      return load_lock_free_bits<T>();
+    }
+  }
+
+  template <typename T>
+  void set_lock_free_value(const T & value)
+  {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "Lock-free storage supports only scalar types");
+    if (!std::holds_alternative<T>(value_))
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid data type: '{}' access for interface: {} expected: '{}'"),
+          get_type_name<T>(), get_name(), data_type_.to_string()));
+    }
+    store_lock_free_bits(value);
+  }
+
+  /// Returns the lock-free stored value casted to double, used for introspection.
+  double get_lock_free_value_as_double() const
+  {
+    switch (data_type_)
+    {
+      case HandleDataType::DOUBLE:
+        return load_lock_free_bits<double>();
+      case HandleDataType::FLOAT32:
+        return static_cast<double>(load_lock_free_bits<float>());
+      case HandleDataType::BOOL:
+        return static_cast<double>(load_lock_free_bits<bool>());
+      case HandleDataType::UINT8:
+        return static_cast<double>(load_lock_free_bits<uint8_t>());
+      case HandleDataType::INT8:
+        return static_cast<double>(load_lock_free_bits<int8_t>());
+      case HandleDataType::UINT16:
+        return static_cast<double>(load_lock_free_bits<uint16_t>());
+      case HandleDataType::INT16:
+        return static_cast<double>(load_lock_free_bits<int16_t>());
+      case HandleDataType::UINT32:
+        return static_cast<double>(load_lock_free_bits<uint32_t>());
+      case HandleDataType::INT32:
+        return static_cast<double>(load_lock_free_bits<int32_t>());
+      default:
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+
+  /// Returns the storage of the value if the handle holds a value of type T, nullptr otherwise.
+  /**
+   * The storage is resolved once, when the handle is created or its storage is relocated, so the
+   * accessors of the data type of the handle skip the variant and the legacy casts.
+   */
+  template <typename T>
+  T * get_typed_value_ptr() const
+  {
+    if constexpr (HandleDataType::from_type<T>() == HandleDataType::UNKNOWN)
+    {
+      return nullptr;
+    }
+    else
+    {
+      return data_type_ == HandleDataType::from_type<T>()
+               ? std::launder(static_cast<T *>(typed_value_ptr_))
+               : nullptr;
+    }
+  }
+
+  /// Resolves the storage of the value for get_typed_value_ptr(), has to be called whenever the
+  /// storage changes.
+  void update_typed_value_ptr()
+  {
+    if (data_type_ == HandleDataType::DOUBLE)
+    {
+      typed_value_ptr_ = value_ptr_;
+    }
+    else if (packed_value_ptr_ && !std::holds_alternative<std::monostate>(value_))
+    {
+      typed_value_ptr_ = packed_value_ptr_;
+    }
+    else
+    {
+      typed_value_ptr_ = std::visit(
+        [](auto & v) -> void *
+        {
+          if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::monostate>)
+          {
+            return nullptr;
+          }
+          else
+          {
+            return &v;
+          }
+        },
+        value_);
+    }
+  }
+
+  /// Moves the value of the handle to the external storage, or back to value_ if nullptr.
+  void relocate_external_value_storage(uint8_t * storage)
+  {
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_);
+    value_ = get_current_value();
+    packed_value_ptr_ = storage;
+    if (storage)
+    {
+      // create the value in the storage, the typed views access it through a pointer of its type
+      std::visit(
+        [storage](const auto & v)
+        {
+          using ValueT = std::decay_t<decltype(v)>;
+          if constexpr (is_external_value_type_v<ValueT>)
+          {
+            ::new (static_cast<void *>(storage)) ValueT(v);
+          }
+        },
+        value_);
+    }
+    update_typed_value_ptr();
+  }
+
+  /// Returns the value of type T, read from the packed storage if the value was relocated there.
+  /// @throw std::bad_variant_access if the handle doesn't hold a value of type T.
+  template <typename T>
+  T get_variant_value() const
+  {
+    if constexpr (is_external_value_type_v<T>)
+    {
+      if (packed_value_ptr_ && std::holds_alternative<T>(value_))
+      {
+        T value;
+        std::memcpy(&value, packed_value_ptr_, sizeof(T));
+        return value;
+      }
+    }
+    return std::get<T>(value_);
+  }
+
+  template <typename T>
+  void set_variant_value(const T & value)
+  {
+    if constexpr (is_external_value_type_v<T>)
+    {
+      if (packed_value_ptr_)
+      {
+        if (std::memcmp(packed_value_ptr_, &value, sizeof(T)) != 0)
+        {
+          std::memcpy(packed_value_ptr_, &value, sizeof(T));
+          increment_value_generation();
+        }
+        return;
+      }
+    }
+    store_value(std::get<T>(value_), value);
+  }
+
+  /// Returns the value of the handle, read from the packed storage if it was relocated there.
+  HANDLE_DATATYPE get_current_value() const
+  {
+    if (!packed_value_ptr_)
+    {
+      return value_;
+    }
+    return std::visit(
+      [this](const auto & v) -> HANDLE_DATATYPE
+      {
+        using ValueT = std::decay_t<decltype(v)>;
+        if constexpr (is_external_value_type_v<ValueT>)
+        {
+          return get_variant_value<ValueT>();
+        }
+        else
+        {
+          return v;
+        }
+      },
+      value_);
+  }
+
+private:
+  void init_array_value(const std::string & initial_value, std::size_t array_size)
+  {
+    switch (data_type_)
+    {
+      case HandleDataType::DOUBLE_ARRAY:
+        array_value_ = std::vector<double>(
+          array_size, initial_value.empty() ? std::numeric_limits<double>::quiet_NaN()
+                                            : hardware_interface::stod(initial_value));
+        break;
+      case HandleDataType::FLOAT32_ARRAY:
+        array_value_ = std::vector<float>(
+          array_size, initial_value.empty() ? std::numeric_limits<float>::quiet_NaN()
+                                            : hardware_interface::stof(initial_value));
+        break;
+      case HandleDataType::UINT16_ARRAY:
+        array_value_ = std::vector<uint16_t>(
+          array_size, initial_value.empty() ? std::numeric_limits<uint16_t>::max()
+                                            : hardware_interface::stoui16(initial_value));
+        break;
+      default:
+        break;
+    }
+  }
+
+  /// @throw std::runtime_error if the handle doesn't hold an array of values of type T.
+  template <typename T>
+  const std::vector<T> & get_array_storage() const
+  {
+    static_assert(
+      HandleDataType::from_array_element_type<T>() != HandleDataType::UNKNOWN,
+      "Array interfaces support only the double, float and uint16_t values");
+    const auto * array = std::get_if<std::vector<T>>(&array_value_);
+    if (!array)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid array data type: '{}' access for interface: {} expected: '{}'"),
+          get_type_name<T>(), get_name(), data_type_.to_string()));
+    }
+    return *array;
+  }
+
+  void init_sample_value(const std::string & initial_value, std::size_t capacity)
+  {
+    switch (data_type_)
+    {
+      case HandleDataType::DOUBLE_SAMPLES:
+        sample_value_ = SampleRing<double>(
+          capacity, initial_value.empty() ? std::numeric_limits<double>::quiet_NaN()
+                                          : hardware_interface::stod(initial_value));
+        break;
+      case HandleDataType::FLOAT32_SAMPLES:
+        sample_value_ = SampleRing<float>(
+          capacity, initial_value.empty() ? std::numeric_limits<float>::quiet_NaN()
+                                          : hardware_interface::stof(initial_value));
+        break;
+      default:
+        break;
+    }
+  }
+
+  /// @throw std::runtime_error if the handle doesn't hold a batch of samples of type T.
+  template <typename T>
+  const SampleRing<T> & get_sample_storage() const
+  {
+    static_assert(
+      HandleDataType::from_sample_element_type<T>() != HandleDataType::UNKNOWN,
+      "Sample batch interfaces support only the double and float values");
+    const auto * samples = std::get_if<SampleRing<T>>(&sample_value_);
+    if (!samples)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE(
+            "Invalid sample batch data type: '{}' access for interface: {} expected: '{}'"),
+          get_type_name<T>(), get_name(), data_type_.to_string()));
+    }
+    return *samples;
+  }
+
+  template <typename T>
+  void check_array_size(std::size_t size) const
+  {
+    const std::size_t array_size = get_array_storage<T>().size();
+    if (size != array_size)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid size: {} for array interface: {} of size: {}"), size, get_name(),
+          array_size));
+    }
+  }
+
+  template <typename T>
+  T load_lock_free_bits() const
+  {
+    const uint64_t bits = lock_free_value_.load(std::memory_order_acquire);
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  void store_lock_free_bits(const T & value)
+  {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    store_lock_free_word(bits);
+  }
+
+  /// Stores the bit pattern of a lock-free value, incrementing the generation if it changed.
+  void store_lock_free_word(uint64_t bits)
+  {
+    if (lock_free_value_.load(std::memory_order_relaxed) != bits)
+    {
+      lock_free_value_.store(bits, std::memory_order_release);
+      increment_value_generation();
+    }
+  }
+
+  /// Stores the value, incrementing the generation if its bit pattern changed.
+  template <typename T>
+  void store_value(T & storage, const T & value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "The handles store only scalar types");
+    if (std::memcmp(&storage, &value, sizeof(T)) != 0)
+    {
+      storage = value;
+      increment_value_generation();
+    }
+  }
+
+  /// The writers of a handle are serialized by its lock or by the serial access, so the generation
+  /// isn't incremented with a read-modify-write. Concurrent lock-free writers might lose an
+  /// increment, but the generation still changes.
+  void increment_value_generation()
+  {
+    value_generation_.store(
+      value_generation_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  void copy(const Handle & other) noexcept
+  {
+    std::scoped_lock lock(other.handle_mutex_, handle_mutex_);
+    names_ = other.names_;
+    // the value of the other handle might be packed in an external storage
+    value_ = other.get_current_value();
+    packed_value_ptr_ = nullptr;
+    if (std::holds_alternative<double>(value_) && other.value_ptr_)
+    {
+      // the value of the other handle might be relocated to an external storage
+      value_ = *other.value_ptr_;
+    }
+    array_value_ = other.array_value_;
+    sample_value_ = other.sample_value_;
+    data_type_ = other.data_type_;
+    lock_free_ = other.lock_free_;
+    serial_access_ = other.serial_access_;
+    value_storage_bound_ = other.value_storage_bound_;
+    narrowed_to_float32_ = other.narrowed_to_float32_;
+    lock_free_value_.store(
+      other.lock_free_value_.load(std::memory_order_acquire), std::memory_order_release);
+    value_generation_.store(
+      other.value_generation_.load(std::memory_order_acquire), std::memory_order_release);
+    if (std::holds_alternative<std::monostate>(value_))
+    {
+      value_ptr_ = other.value_ptr_;
+    }
+    else
+    {
+      value_ptr_ = std::get_if<double>(&value_);
+    }
+    update_typed_value_ptr();
+  }
+
+  void swap(Handle & first, Handle & second) noexcept
+  {
+    std::scoped_lock lock(first.handle_mutex_, second.handle_mutex_);
+    std::swap(first.names_, second.names_);
+    std::swap(first.value_, second.value_);
+    std::swap(first.array_value_, second.array_value_);
+    std::swap(first.sample_value_, second.sample_value_);
+    std::swap(first.data_type_, second.data_type_);
+    std::swap(first.value_ptr_, second.value_ptr_);
+    std::swap(first.packed_value_ptr_, second.packed_value_ptr_);
+    std::swap(first.lock_free_, second.lock_free_);
+    std::swap(first.serial_access_, second.serial_access_);
+    std::swap(first.value_storage_bound_, second.value_storage_bound_);
+    std::swap(first.narrowed_to_float32_, second.narrowed_to_float32_);
+    first.lock_free_value_.store(
+      second.lock_free_value_.exchange(
+        first.lock_free_value_.load(std::memory_order_acquire), std::memory_order_acq_rel),
+      std::memory_order_release);
+    first.value_generation_.store(
+      second.value_generation_.exchange(
+        first.value_generation_.load(std::memory_order_acquire), std::memory_order_acq_rel),
+      std::memory_order_release);
+    first.update_typed_value_ptr();
+    second.update_typed_value_ptr();
+  }
+
+protected:
+  /// Names of a handle, only used outside of the real-time loop, so they are stored out of line
+  /// and shared by the copies of the handle. The strings are the interned ones of the NamePool.
+  struct Names
+  {
+    const std::string * prefix_name;
+    const std::string * interface_name;
+    const std::string * handle_name;
+    NameId handle_name_id;
+  };
+
+  static std::shared_ptr<const Names> make_names(
+    const std::string & prefix_name, const std::string & interface_name)
+  {
+    const NameId handle_name_id = NamePool::intern(prefix_name + "/" + interface_name);
+    return std::make_shared<const Names>(Names{
+      &NamePool::get_interned(prefix_name), &NamePool::get_interned(interface_name),
+      &NamePool::get_name(handle_name_id), handle_name_id});
+  }
+
+  /// Names of the moved-from handles
+  static const std::shared_ptr<const Names> & get_empty_names()
+  {
+    static const std::shared_ptr<const Names> empty_names = make_names("", "");
+    return empty_names;
+  }
+
+  /// Moves the value of a handle pointing to an external double into the handle itself, so that
+  /// the handle doesn't share its value with the handle it was copied from anymore.
+  void detach_value()
+  {
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_);
+    if (std::holds_alternative<std::monostate>(value_) && value_ptr_)
+    {
+      value_ = *value_ptr_;
+      value_ptr_ = std::get_if<double>(&value_);
+      update_typed_value_ptr();
+    }
+  }
+
+  /// @note The methods copy and swap need to be updated, if new members are added, and
+  /// update_typed_value_ptr() called if the storage of the value changes.
+  /// @note The members accessed by the real-time loop are declared first, next to each other.
+  HANDLE_DATATYPE value_ = std::monostate{};
+  // BEGIN (Handle export change): for backward compatibility
+  // TODO(Manuel) redeclare as HANDLE_DATATYPE * value_ptr_ if old functionality is removed
+  double * value_ptr_ = nullptr;
+  // END
+  /// Storage of the value of the data type of the handle, see get_typed_value_ptr()
+  void * typed_value_ptr_ = nullptr;
+  /// External storage of the value of type bool, uint8, int8 or float, nullptr if the value is in
+  /// value_.
+  uint8_t * packed_value_ptr_ = nullptr;
+  /// Values of the array data types, their number is fixed when the handle is created.
+  HANDLE_ARRAY_DATATYPE array_value_ = std::monostate{};
+  /// Samples of the sample batch data types, their capacity is fixed when the handle is created.
+  HANDLE_SAMPLE_BATCH_DATATYPE sample_value_ = std::monostate{};
+  /// Bit pattern of the current value when the lock-free storage mode is enabled.
+  std::atomic<uint64_t> lock_free_value_{0};
+  /// Number of changes of the value, see get_value_generation()
+  std::atomic<uint64_t> value_generation_{0};
+  HandleDataType data_type_ = HandleDataType::DOUBLE;
+  /// If true, the value is accessed through lock_free_value_ and handle_mutex_ is not used.
+  bool lock_free_ = false;
+  /// If true, the double value is accessed through value_ptr_ without using handle_mutex_.
+  bool serial_access_ = false;
+  /// True if an accessor was bound to the storage of the double value, see bind_value_storage()
+  bool value_storage_bound_ = false;
+  /// If true, the double value is stored as float32, see narrow_to_float32().
+  bool narrowed_to_float32_ = false;
+  mutable std::shared_mutex handle_mutex_;
+  std::shared_ptr<const Names> names_ = get_empty_names();
+
+private:
+  // the typed views resolve the storage of the value once, when they are created
+  template <typename T>
+  friend class LoanedStateView;
+  template <typename T>
+  friend class LoanedCommandView;
+
+  // TODO(christophfroehlich): remove once
+  // https://github.com/ros2/rclcpp/issues/2587
+  // is fixed
+  mutable bool notified_ = false;
+};
+
+class StateInterface : public Handle
+{
+public:
+  explicit StateInterface(const InterfaceDescription & interface_description)
+  : Handle(interface_description)
+  {
+  }
+
+  void registerIntrospection() const
+  {
+    if (!is_valid())
+    {
+      RCLCPP_WARN(
+        rclcpp::get_logger(get_name()),
+        "Cannot register state introspection for state interface: %s without a valid value "
+        "pointer or initialized value.",
+        get_name().c_str());
+      return;
+    }
+    if (value_ptr_ || data_type_.is_castable_to_double())
+    {
+      std::function<double()> f = [this]()
+      {
+        if (lock_free_)
+        {
+          return get_lock_free_value_as_double();
+        }
+        if (value_ptr_)
+        {
+          return *value_ptr_;
+        }
+        else
+        {
+          return data_type_.cast_to_double(get_current_value());
+        }
+      };
+      DEFAULT_REGISTER_ROS2_CONTROL_INTROSPECTION("state_interface." + get_name(), f);
+    }
+  }
+
+  void unregisterIntrospection() const
+  {
+    if (is_valid() && (value_ptr_ || data_type_.is_castable_to_double()))
+    {
+      DEFAULT_UNREGISTER_ROS2_CONTROL_INTROSPECTION("state_interface." + get_name());
+    }
+  }
+
+  StateInterface(const StateInterface & other) = default;
+
+  StateInterface(StateInterface && other) = default;
+
+  using Handle::Handle;
+
+  using SharedPtr = std::shared_ptr<StateInterface>;
+  using ConstSharedPtr = std::shared_ptr<const StateInterface>;
 };
 
 class CommandInterface : public Handle
@@ -732,6 +1936,17 @@ public:
     }
   }
 
+  /// A setter for the value of a command interface of type double that triggers the limiter.
+  /**
+   * @param value The value to be set.
+   * @return True if the value was set successfully, false otherwise.
+   * @note The data type of the command interface must be checked to be double beforehand.
+   */
+  [[nodiscard]] bool set_limited_double_unchecked(double value)
+  {
+    return set_double_unchecked(on_set_command_limiter_(value, is_command_limited_));
+  }
+
   const bool & is_limited() const { return is_command_limited_; }
 
   void registerIntrospection() const
@@ -749,13 +1964,17 @@ public:
     {
       std::function<double()> f = [this]()
       {
+        if (lock_free_)
+        {
+          return get_lock_free_value_as_double();
+        }
         if (value_ptr_)
         {
           return *value_ptr_;
         }
         else
         {
-          return data_type_.cast_to_double(value_);
+          return data_type_.cast_to_double(get_current_value());
         }
       };
       DEFAULT_REGISTER_ROS2_CONTROL_INTROSPECTION("command_interface." + get_name(), f);
@@ -778,7 +1997,25 @@ public:
 
   using SharedPtr = std::shared_ptr<CommandInterface>;
 
+  /// Creates a copy of a command interface that doesn't share the storage of its value.
+  /**
+   * The commands written to the copy never reach the hardware, e.g., the ones of a controller
+   * running in shadow mode. The copy starts with the current value of \p other, without its
+   * limiter, since the state of the limiter belongs to the real command interface.
+   */
+  static SharedPtr make_detached_copy(const CommandInterface & other)
+  {
+    SharedPtr copy(new CommandInterface(static_cast<const Handle &>(other)));
+    copy->detach_value();
+    return copy;
+  }
+
 private:
+  template <typename T>
+  friend class LoanedCommandView;
+
+  explicit CommandInterface(const Handle & other) : Handle(other) {}
+
   bool is_command_limited_ = false;
   std::function<double(double, bool &)> on_set_command_limiter_ =
     [](double value, bool & is_limited)
@@ -0,0 +1,87 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__HARDWARE_BUS_INTERFACE_HPP_
+#define HARDWARE_INTERFACE__HARDWARE_BUS_INTERFACE_HPP_
+
+#include <string>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/types/hardware_interface_return_values.hpp"
+#include "rclcpp/duration.hpp"
+#include "rclcpp/logger.hpp"
+#include "rclcpp/time.hpp"
+
+namespace hardware_interface
+{
+/// Hardware component exchanging its data through a HardwareBusInterface.
+struct HardwareBusMember
+{
+  /// Description of the component, e.g., with the address of its device in its parameters.
+  HardwareInfo info;
+  /// State interfaces exported by the component, written by the bus.
+  std::vector<StateInterface::SharedPtr> state_interfaces;
+  /// Command interfaces exported by the component, read by the bus.
+  std::vector<CommandInterface::SharedPtr> command_interfaces;
+};
+
+/// Master of a fieldbus shared by several hardware components, e.g., EtherCAT drives or CAN nodes.
+/**
+ * The bus is loaded as a plugin by the ResourceManager, from the ``plugin`` attribute of the
+ * ``<bus>`` tag in the ``<hardware>`` tag of its members. Instead of one bus transaction per
+ * component, the ResourceManager calls read() once per cycle before the members are read, which
+ * receives the frame of all the members and scatters it into their state interfaces, and write()
+ * once per cycle after the transmissions of the members are applied and before they are written,
+ * which gathers their command interfaces into one frame and sends it.
+ *
+ * The members stay hardware components with their own lifecycle: they are still read and written,
+ * e.g., to check the status of their device, but they don't access the bus themselves. Only the
+ * synchronous components can be members. A failed read or write of the bus fails the read or write
+ * of all its configured members, which are then handled like any failed component.
+ */
+class HardwareBusInterface
+{
+public:
+  virtual ~HardwareBusInterface() = default;
+
+  /// Configures the bus with its members, whenever hardware components are added or removed.
+  /**
+   * \param[in] bus_name name of the bus in the descriptions of its members.
+   * \param[in] members members of the bus, in the order of the components.
+   * \param[in] logger logger of the ResourceManager.
+   * \returns false if the bus cannot exchange the data of the members.
+   * \note This method is not real-time safe.
+   */
+  virtual bool configure(
+    const std::string & bus_name, const std::vector<HardwareBusMember> & members,
+    const rclcpp::Logger & logger) = 0;
+
+  /// Receives the data of all the members and writes it into their state interfaces.
+  /**
+   * \note This method has to be real-time safe.
+   */
+  virtual return_type read(const rclcpp::Time & time, const rclcpp::Duration & period) = 0;
+
+  /// Sends the values of the command interfaces of all the members.
+  /**
+   * \note This method has to be real-time safe.
+   */
+  virtual return_type write(const rclcpp::Time & time, const rclcpp::Duration & period) = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__HARDWARE_BUS_INTERFACE_HPP_
@@ -15,6 +15,8 @@
 #ifndef HARDWARE_INTERFACE__HARDWARE_COMPONENT_HPP_
 #define HARDWARE_INTERFACE__HARDWARE_COMPONENT_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,6 +24,8 @@
 #include "hardware_interface/handle.hpp"
 #include "hardware_interface/hardware_component_interface.hpp"
 #include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/instrumented_mutex.hpp"
+#include "hardware_interface/read_stamp.hpp"
 #include "hardware_interface/types/hardware_interface_return_values.hpp"
 #include "hardware_interface/types/statistics_types.hpp"
 #include "rclcpp/duration.hpp"
@@ -37,6 +41,14 @@ class HardwareComponentInterface;
 class HardwareComponent final
 {
 public:
+  /// Lifecycle transition requested by the control loop, see request_transition().
+  enum class RequestedTransition : uint8_t
+  {
+    NONE = 0,
+    DEACTIVATE = 1,
+    ERROR = 2
+  };
+
   HardwareComponent() = default;
 
   explicit HardwareComponent(std::unique_ptr<HardwareComponentInterface> impl);
@@ -74,6 +86,10 @@ public:
     const std::vector<std::string> & start_interfaces,
     const std::vector<std::string> & stop_interfaces);
 
+  return_type abort_command_mode_switch(
+    const std::vector<std::string> & start_interfaces,
+    const std::vector<std::string> & stop_interfaces);
+
   return_type perform_command_mode_switch(
     const std::vector<std::string> & start_interfaces,
     const std::vector<std::string> & stop_interfaces);
@@ -82,6 +98,12 @@ public:
 
   const std::string & get_group_name() const;
 
+  std::shared_ptr<CycleTrigger> get_cycle_trigger() const;
+
+  std::shared_ptr<HardwareStatusSource> get_hardware_status_source() const;
+
+  std::size_t drain_edge_events(EdgeEventList & events);
+
   const rclcpp_lifecycle::State & get_lifecycle_state() const;
 
   uint8_t get_lifecycle_id() const;
@@ -90,6 +112,9 @@ public:
 
   const rclcpp::Time & get_last_write_time() const;
 
+  /// Get the stamp of the last successful read, shared with the state interfaces of the component.
+  std::shared_ptr<const ReadStamp> get_read_stamp() const;
+
   const HardwareComponentStatisticsCollector & get_read_statistics() const;
 
   const HardwareComponentStatisticsCollector & get_write_statistics() const;
@@ -98,18 +123,42 @@ public:
 
   return_type write(const rclcpp::Time & time, const rclcpp::Duration & period);
 
-  std::recursive_mutex & get_mutex();
+  InstrumentedRecursiveMutex & get_mutex();
+
+  /// Requests a transition of the component to be run outside of the control loop.
+  /**
+   * Used by read() and write(), and by the resource manager, instead of running the transition in
+   * the control loop if the component is initialized with
+   * HardwareComponentParams::defer_control_loop_transitions. The component isn't written until
+   * the resource manager runs the transition, nor read if it is an error. An error replaces a
+   * requested deactivation.
+   * \note This method is real-time safe.
+   */
+  void request_transition(RequestedTransition transition) noexcept;
+
+  RequestedTransition get_requested_transition() const noexcept;
+
+  /// Returns and clears the requested transition, called before running it.
+  RequestedTransition take_requested_transition() noexcept;
+
+  /// Returns true if the transitions of the control loop are requested instead of being run.
+  bool defers_control_loop_transitions() const { return defer_control_loop_transitions_; }
 
 private:
   std::unique_ptr<HardwareComponentInterface> impl_;
-  mutable std::recursive_mutex component_mutex_;
+  mutable InstrumentedRecursiveMutex component_mutex_;
   // Last read cycle time
   rclcpp::Time last_read_cycle_time_;
   // Last write cycle time
   rclcpp::Time last_write_cycle_time_;
+  // Time and cycle of the last successful read
+  std::shared_ptr<ReadStamp> read_stamp_ = std::make_shared<ReadStamp>();
   // Component statistics
   HardwareComponentStatisticsCollector read_statistics_;
   HardwareComponentStatisticsCollector write_statistics_;
+  // See HardwareComponentParams::defer_control_loop_transitions
+  bool defer_control_loop_transitions_ = false;
+  std::atomic<uint8_t> requested_transition_ = 0;
 };
 
 }  // namespace hardware_interface
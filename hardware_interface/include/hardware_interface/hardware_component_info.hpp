@@ -26,13 +26,54 @@
 #include "rclcpp/time.hpp"
 #include "rclcpp_lifecycle/state.hpp"
 
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/memory_arena.hpp"
+#include "hardware_interface/time_budget.hpp"
 #include "hardware_interface/types/statistics_types.hpp"
 namespace hardware_interface
 {
+struct PerformanceCountersStatisticsData
+{
+  void update_statistics(const PerformanceCountersStatisticsCollector & statistics)
+  {
+    cycles.update_statistics(statistics.cycles);
+    instructions_per_cycle.update_statistics(statistics.instructions_per_cycle);
+    cache_misses.update_statistics(statistics.cache_misses);
+    branch_misses.update_statistics(statistics.branch_misses);
+  }
+
+  ros2_control::MovingAverageStatisticsData cycles;
+  ros2_control::MovingAverageStatisticsData instructions_per_cycle;
+  ros2_control::MovingAverageStatisticsData cache_misses;
+  ros2_control::MovingAverageStatisticsData branch_misses;
+};
+
 struct HardwareComponentStatisticsData
 {
   ros2_control::MovingAverageStatisticsData execution_time;
   ros2_control::MovingAverageStatisticsData periodicity;
+  /// CPU time and execution time minus CPU time, only sampled when the CPU time statistics are
+  /// enabled
+  ros2_control::MovingAverageStatisticsData cpu_time;
+  ros2_control::MovingAverageStatisticsData preempted_time;
+  /// Context switches of the thread during the last cycle
+  unsigned int voluntary_context_switches = 0;
+  unsigned int involuntary_context_switches = 0;
+  /// Hardware performance counters, only sampled when the performance counters are enabled
+  PerformanceCountersStatisticsData performance_counters;
+  /// Heap allocations of the last cycle, only counted when the allocation tracking is enabled
+  unsigned int allocations = 0;
+  /// Number of cycles that exceeded the time budget of the component
+  unsigned int time_budget_overruns = 0;
+  /// CPU core of the last cycle and number of cycles run on another core than the previous read or
+  /// write of the component, only recorded when the components are read and written in parallel
+  int cpu = -1;
+  unsigned int cpu_migrations = 0;
+  /// Number of cycles skipped because another thread held the lock of the component
+  unsigned int skipped_cycles = 0;
+  /// Fraction of the commands changed at every write, only sampled if the component tracks the
+  /// changes of its commands
+  ros2_control::MovingAverageStatisticsData changed_command_ratio;
 };
 /// Hardware Component Information
 /**
@@ -49,6 +90,9 @@ struct HardwareComponentInfo
   /// Component group
   std::string group;
 
+  /// Resource namespace of the component, empty if none, see HardwareInfo::resource_namespace
+  std::string resource_namespace;
+
   /// Component pluginlib plugin name.
   std::string plugin_name;
 
@@ -58,6 +102,21 @@ struct HardwareComponentInfo
   //// read/write rate
   unsigned int rw_rate;
 
+  /// Phase of the read/write cycles set in the description, -1 if assigned automatically
+  int rw_phase = -1;
+
+  /// Budget of the execution time of every read and write in microseconds, 0 if not checked
+  double time_budget_us = 0.0;
+
+  /// Action taken when a read or write exceeds the time budget
+  TimeBudgetPolicy time_budget_policy = TimeBudgetPolicy::REPORT;
+
+  /// Criticality class of the component, the auxiliary ones are shed when the loop is overloaded
+  Criticality criticality = Criticality::CONTROL;
+
+  /// Recovery of the component after an error in its read or write
+  HardwareRecoveryParams recovery_params;
+
   /// Component current state.
   rclcpp_lifecycle::State state;
 
@@ -72,6 +131,9 @@ struct HardwareComponentInfo
 
   /// Write cycle statistics of the component.
   std::shared_ptr<HardwareComponentStatisticsData> write_statistics = nullptr;
+
+  /// Memory arena of the component, nullptr if the arenas are disabled
+  std::shared_ptr<const MemoryArena> memory_arena = nullptr;
 };
 
 }  // namespace hardware_interface
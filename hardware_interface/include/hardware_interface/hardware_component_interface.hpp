@@ -19,6 +19,7 @@
 
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -26,8 +27,11 @@
 
 #include "control_msgs/msg/hardware_status.hpp"
 #include "hardware_interface/component_parser.hpp"
+#include "hardware_interface/cycle_trigger.hpp"
+#include "hardware_interface/edge_event_queue.hpp"
 #include "hardware_interface/handle.hpp"
 #include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/hardware_status_aggregator.hpp"
 #include "hardware_interface/introspection.hpp"
 #include "hardware_interface/types/hardware_component_interface_params.hpp"
 #include "hardware_interface/types/hardware_component_params.hpp"
@@ -223,6 +227,22 @@ public:
     const std::vector<std::string> & start_interfaces,
     const std::vector<std::string> & stop_interfaces);
 
+  /// Abort a prepared command interface switch.
+  /**
+   * Called instead of perform_command_mode_switch after this component accepted the switch in
+   * prepare_command_mode_switch, if another component rejected it. The component should drop the
+   * data prepared for the switch and keep its current command mode.
+   *
+   * \note This is a non-realtime call.
+   * \param[in] start_interfaces vector of string identifiers for the command interfaces starting.
+   * \param[in] stop_interfaces vector of string identifiers for the command interfaces stopping.
+   * \return return_type::OK if the prepared switch was dropped. Returns return_type::ERROR
+   * otherwise.
+   */
+  virtual return_type abort_command_mode_switch(
+    const std::vector<std::string> & start_interfaces,
+    const std::vector<std::string> & stop_interfaces);
+
   // Perform switching to the new command interface.
   /**
    * Perform the mode-switching for the new command interface combination.
@@ -287,6 +307,29 @@ public:
    */
   virtual return_type write(const rclcpp::Time & time, const rclcpp::Duration & period);
 
+  /// Write the commands of the previous cycle and read the current states in one bus transaction.
+  /**
+   * Called instead of read() and write() once enable_exchange() was called, for the buses whose
+   * frames carry the commands and the states together, e.g., EtherCAT or a split-phase SPI or CAN
+   * driver. The commands computed by the controllers in the previous cycle are sent with the
+   * transaction that receives the states of the current cycle, so that the bus is used once per
+   * cycle and the time of the write phase is removed from the critical path of the control loop.
+   * The commands thus reach the hardware one cycle later than with a write() at the end of the
+   * cycle.
+   *
+   * A synchronous component exchanges in the read phase, as long as the controllers updated the
+   * commands since the activation, and read() is called otherwise. The write phase only collects
+   * the changed commands, see get_changed_command_interfaces(). An asynchronous component
+   * exchanges in its own thread, overlapping with the update of the controllers.
+   *
+   * The default implementation calls write() and read().
+   *
+   * \param[in] time The time at the start of this control loop iteration
+   * \param[in] period The measured time taken by the last control loop iteration
+   * \return return_type::OK if the exchange was successful, return_type::ERROR otherwise.
+   */
+  virtual return_type exchange(const rclcpp::Time & time, const rclcpp::Duration & period);
+
   /// Get name of the hardware.
   /**
    * \return name.
@@ -537,6 +580,143 @@ public:
     return command;
   }
 
+  /// Get the index of a state interface, to access it by index in the real-time loop.
+  /**
+   * The indices are assigned when the state interfaces are exported and stay valid for the
+   * lifetime of the component. Resolve them once, e.g., in on_configure(), so that read() accesses
+   * the interfaces without hashing or comparing their names.
+   *
+   * \param[in] interface_name The name of the state interface.
+   * \return The index of the state interface.
+   * \throws std::runtime_error if the component has no state interface with the given name.
+   */
+  std::size_t get_state_interface_index(const std::string & interface_name) const;
+
+  /// Get the indices of state interfaces, e.g., of the position states of all the joints.
+  /**
+   * \param[in] interface_names The names of the state interfaces.
+   * \return The indices of the state interfaces, in the order of the names.
+   * \throws std::runtime_error if the component has no state interface with one of the names.
+   */
+  std::vector<std::size_t> get_state_interface_indices(
+    const std::vector<std::string> & interface_names) const;
+
+  /// Get the state interface handle at an index returned by get_state_interface_index().
+  const StateInterface::SharedPtr & get_state_interface_handle(std::size_t index) const;
+
+  /// Set the value of the state interface at an index, without blocking.
+  /**
+   * \param[in] index The index of the state interface, see get_state_interface_index().
+   * \param[in] value The value to store.
+   * \return True if the value was set, false if the interface is locked by another thread.
+   * \note This method is real-time safe.
+   */
+  template <typename T>
+  bool set_state(std::size_t index, const T & value)
+  {
+    return get_state_interface_handle(index)->set_value(value, false);
+  }
+
+  /// Get the value of the state interface at an index, without blocking.
+  /**
+   * \param[in] index The index of the state interface, see get_state_interface_index().
+   * \param[out] state The variable to store the retrieved value.
+   * \return True if the value was retrieved, false if the interface is locked by another thread.
+   * \note This method is real-time safe.
+   */
+  template <typename T>
+  bool get_state(std::size_t index, T & state) const
+  {
+    return get_state_interface_handle(index)->get_value(state, false);
+  }
+
+  /// Set the values of the state interfaces at indices of type double, without blocking.
+  /**
+   * \param[in] indices The indices of the state interfaces, see get_state_interface_indices().
+   * \param[in] values The values to store, in the order of the indices.
+   * \return True if all the values were set, false if the sizes don't match or if some
+   * interfaces are locked by another thread.
+   * \note This method is real-time safe.
+   */
+  bool set_states(const std::vector<std::size_t> & indices, const std::vector<double> & values);
+
+  /// Get the index of a command interface, to access it by index in the real-time loop.
+  /**
+   * \param[in] interface_name The name of the command interface.
+   * \return The index of the command interface.
+   * \throws std::runtime_error if the component has no command interface with the given name.
+   */
+  std::size_t get_command_interface_index(const std::string & interface_name) const;
+
+  /// Get the indices of command interfaces, e.g., of the position commands of all the joints.
+  /**
+   * \param[in] interface_names The names of the command interfaces.
+   * \return The indices of the command interfaces, in the order of the names.
+   * \throws std::runtime_error if the component has no command interface with one of the names.
+   */
+  std::vector<std::size_t> get_command_interface_indices(
+    const std::vector<std::string> & interface_names) const;
+
+  /// Get the command interface handle at an index returned by get_command_interface_index().
+  const CommandInterface::SharedPtr & get_command_interface_handle(std::size_t index) const;
+
+  /// Set the value of the command interface at an index, without blocking.
+  /**
+   * \param[in] index The index of the command interface, see get_command_interface_index().
+   * \param[in] value The value to store.
+   * \return True if the value was set, false if the interface is locked by another thread.
+   * \note This method is real-time safe.
+   */
+  template <typename T>
+  bool set_command(std::size_t index, const T & value)
+  {
+    return get_command_interface_handle(index)->set_value(value, false);
+  }
+
+  /// Get the value of the command interface at an index, without blocking.
+  /**
+   * \param[in] index The index of the command interface, see get_command_interface_index().
+   * \param[out] command The variable to store the retrieved value.
+   * \return True if the value was retrieved, false if the interface is locked by another thread.
+   * \note This method is real-time safe.
+   */
+  template <typename T>
+  bool get_command(std::size_t index, T & command) const
+  {
+    return get_command_interface_handle(index)->get_value(command, false);
+  }
+
+  /// Get the values of the command interfaces at indices of type double, without blocking.
+  /**
+   * \param[in] indices The indices of the command interfaces, see
+   * get_command_interface_indices().
+   * \param[out] values The retrieved values, in the order of the indices. The vector is only
+   * resized if its size doesn't match, the values of the interfaces locked by another thread are
+   * left unchanged.
+   * \return True if all the values were retrieved, false otherwise.
+   * \note This method is real-time safe, if the size of values matches.
+   */
+  bool get_commands(const std::vector<std::size_t> & indices, std::vector<double> & values) const;
+
+  /// Get the indices of the command interfaces changed since the previous write().
+  /**
+   * The changed commands are collected from the generations of the command interfaces, see
+   * Handle::get_value_generation(), right before every write(), so that the drivers of slow
+   * buses, e.g., CANopen or Modbus, send only the PDOs or registers of the commands that changed.
+   * All the commands are reported at the first write() after the activation.
+   *
+   * \return The indices of the changed command interfaces, see get_command_interface_index(). The
+   * list is empty if the command change tracking isn't enabled.
+   * \note This method is real-time safe, the list is only valid inside write() or exchange().
+   */
+  const std::vector<std::size_t> & get_changed_command_interfaces() const;
+
+  /// Returns true if enable_command_change_tracking() was called.
+  bool is_command_change_tracking_enabled() const;
+
+  /// Returns true if enable_exchange() was called.
+  bool is_exchange_enabled() const;
+
   /// Get the logger of the HardwareComponentInterface.
   /**
    * \return logger of the HardwareComponentInterface.
@@ -549,6 +729,16 @@ public:
    */
   virtual rclcpp::Clock::SharedPtr get_clock() const;
 
+  /// Get the memory resource the component allocates its buffers from.
+  /**
+   * If the resource manager is configured with a memory arena, the resource is pre-faulted and
+   * locked memory, so that the buffers allocated from it, e.g., std::pmr::vector members created
+   * in on_configure, don't page-fault in the first read and write cycles.
+   *
+   * \return memory resource of the component, the default resource if there is no arena.
+   */
+  std::pmr::memory_resource * get_memory_resource() const;
+
   /// Get the default node of the HardwareComponentInterface.
   /**
    * \return node of the HardwareComponentInterface.
@@ -586,7 +776,79 @@ public:
    */
   void enable_introspection(bool enable);
 
+  /// Get the trigger signaling the start of the control cycles of this component.
+  /**
+   * The control loop of the ros2_control_node waits on this trigger instead of sleeping on its own
+   * clock, if the component is set in the `hardware_synchronization.cycle_trigger_component`
+   * parameter.
+   */
+  std::shared_ptr<CycleTrigger> get_cycle_trigger() const;
+
+  /// Get the status message of this component published by the resource manager.
+  /**
+   * The message is only aggregated if the component was initialized with
+   * HardwareComponentParams::aggregate_hardware_status and a positive `status_publish_rate`,
+   * instead of being published by the own publisher and timer of the component.
+   * \returns nullptr if the status message of the component is not aggregated.
+   */
+  std::shared_ptr<HardwareStatusSource> get_hardware_status_source() const;
+
+  /// Move the edge events pushed since the previous call into the list of the cycle.
+  /**
+   * Called by the resource manager after the read of all the components, see push_edge_event().
+   * \param[in,out] events list of the events of the cycle.
+   * \return The number of moved events, 0 if the edge events aren't enabled.
+   * \note This method is real-time safe.
+   */
+  std::size_t drain_edge_events(EdgeEventList & events);
+
 protected:
+  /// Signal the start of a control cycle to the control loop waiting on the cycle trigger.
+  /**
+   * Hardware components whose bus or sensor paces the control loop call this method at the start
+   * of every cycle, e.g., from the callback of their driver.
+   * \note This method is real-time safe.
+   */
+  void trigger_control_cycle();
+
+  /// Enable the collection of the command interfaces changed before every write().
+  /**
+   * The fraction of the commands changed at every write() is added to the write statistics of
+   * the component. Call it once the command interfaces are exported, e.g., in on_configure().
+   * \note This method is not real-time safe.
+   */
+  void enable_command_change_tracking();
+
+  /// Enable the exchange of the commands and the states in one transaction, see exchange().
+  /**
+   * Call it before the activation, e.g., in on_configure().
+   * \note This method is not real-time safe.
+   */
+  void enable_exchange();
+
+  /// Enable the queue of the edge events of the component, see push_edge_event().
+  /**
+   * Call it before the activation, e.g., in on_configure().
+   * \param[in] capacity maximal number of events pushed within one control cycle.
+   * \note This method is not real-time safe.
+   */
+  void enable_edge_events(std::size_t capacity);
+
+  /// Push a change of a boolean state interface, e.g., of a GPIO input, to the controllers.
+  /**
+   * Instead of polling all their inputs every cycle, the controllers process the edge events of
+   * the cycle, see controller_interface::ControllerInterfaceBase::get_edge_events(), with the
+   * time stamp of the change from the hardware, e.g., of an interrupt or of the frame of the bus.
+   * The event doesn't change the value of the interface, which the component still sets.
+   *
+   * \param[in] index index of the state interface, see get_state_interface_index().
+   * \param[in] value new value of the interface.
+   * \param[in] stamp time stamp of the change in nanoseconds.
+   * \return false if the edge events aren't enabled or the queue is full.
+   * \note This method is real-time safe, also from the thread of an asynchronous component.
+   */
+  bool push_edge_event(std::size_t index, bool value, int64_t stamp);
+
   HardwareInfo info_;
   // interface names to InterfaceDescription
   std::unordered_map<std::string, InterfaceDescription> joint_state_interfaces_;
@@ -620,7 +882,7 @@ private:
   std::unique_ptr<HardwareComponentInterfaceImpl> impl_;
 
 protected:
-  pal_statistics::RegistrationsRAII stats_registrations_;
+  hardware_interface::IntrospectionRegistrations stats_registrations_;
 };
 
 }  // namespace hardware_interface
@@ -0,0 +1,68 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__HARDWARE_COMPONENT_STATISTICS_TABLE_HPP_
+#define HARDWARE_INTERFACE__HARDWARE_COMPONENT_STATISTICS_TABLE_HPP_
+
+#include <cstddef>
+#include <memory>
+
+#include "hardware_interface/hardware_component_info.hpp"
+
+namespace hardware_interface
+{
+/// Preallocated table of the read and write statistics of the hardware components.
+/**
+ * The statistics of all the components are stored in contiguous blocks of slots, one cache line
+ * aligned slot per statistics, instead of one heap allocation per component. The real-time loop
+ * updates the statistics of the components in the order they were acquired, i.e., through
+ * adjacent memory, and the workers reading and writing components in parallel never share a cache
+ * line. The slots never move, so the introspection and the diagnostics keep reading the snapshots
+ * of the statistics through the shared pointers of HardwareComponentInfo.
+ *
+ * A slot is released when the last shared pointer to it is destroyed, e.g., when its component is
+ * unloaded, and reset before it's acquired again. The slots stay valid after the destruction of
+ * the table until they are released.
+ */
+class HardwareComponentStatisticsTable
+{
+public:
+  HardwareComponentStatisticsTable();
+
+  /// Preallocates a contiguous block with enough free slots for the given number of statistics.
+  /**
+   * \note This method is not real-time safe.
+   */
+  void reserve(std::size_t number_of_statistics);
+
+  /// Returns a free slot, allocating a new block if none is left.
+  /**
+   * \note This method is not real-time safe.
+   */
+  std::shared_ptr<HardwareComponentStatisticsData> acquire();
+
+  /// Returns the number of slots of all the blocks.
+  std::size_t get_capacity() const;
+
+  /// Returns the number of slots that are not acquired.
+  std::size_t get_number_of_free_slots() const;
+
+private:
+  struct Storage;
+  std::shared_ptr<Storage> storage_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__HARDWARE_COMPONENT_STATISTICS_TABLE_HPP_
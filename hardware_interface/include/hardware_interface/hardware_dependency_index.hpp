@@ -0,0 +1,149 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__HARDWARE_DEPENDENCY_INDEX_HPP_
+#define HARDWARE_INTERFACE__HARDWARE_DEPENDENCY_INDEX_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Interfaces of a hardware component, as indexed by a HardwareDependencyIndex.
+struct ComponentInterfaces
+{
+  std::string name;
+  std::vector<std::string> command_interfaces;
+  std::vector<std::string> state_interfaces;
+};
+
+/// Dependencies between the hardware components, the controllers and their interfaces.
+/**
+ * The components and the controllers are identified by dense indices, so that the fault handling
+ * of the control loop finds the controllers using a failed component without searching their
+ * names. The components keep the indices given to set_components(), i.e., the order of the
+ * hardware read and write status of the resource manager. The controllers get the first free
+ * index when their interfaces are first added, and release it when they are removed.
+ *
+ * The controllers of a component are listed in the order their dependency on it was added, and
+ * in the order of their indices once the components were set again. The interfaces of the
+ * controllers are kept when the components change, so that a reloaded component is used again by
+ * the controllers claiming its interfaces.
+ *
+ * \note The const methods don't allocate memory and are real-time safe. The index isn't
+ * synchronized, the resource manager publishes immutable copies of it, see RcuPointer.
+ */
+class HardwareDependencyIndex
+{
+public:
+  /// Replaces the indexed components and resolves the interfaces of the controllers again.
+  void set_components(const std::vector<ComponentInterfaces> & components);
+
+  /// Adds the interfaces used by a controller, registering the controller on its first call.
+  /**
+   * The interfaces are added to the ones of the previous calls, the interfaces not exported by
+   * any component are kept, but don't add any dependency.
+   *
+   * \param[in] controller_name name of the controller.
+   * \param[in] command_interfaces command interfaces claimed by the controller.
+   * \param[in] state_interfaces state interfaces used by the controller.
+   * \return index of the controller.
+   */
+  std::size_t add_controller_interfaces(
+    const std::string & controller_name, const std::vector<std::string> & command_interfaces,
+    const std::vector<std::string> & state_interfaces);
+
+  /// Removes a controller and its dependencies, its index can be reused by another controller.
+  /**
+   * \return false if the controller isn't indexed.
+   */
+  bool remove_controller(const std::string & controller_name);
+
+  std::size_t get_number_of_components() const noexcept { return components_.size(); }
+
+  std::optional<std::size_t> find_component(const std::string & component_name) const;
+
+  /// Returns the component exporting an interface, its command interface if it has both.
+  /**
+   * \returns the index of the component, std::nullopt if no component exports the interface.
+   */
+  std::optional<std::size_t> find_interface_owner(const std::string & interface_name) const;
+
+  /// Returns the name of a component, an empty string for an unknown index.
+  const std::string & get_component_name(std::size_t component_index) const noexcept;
+
+  /// Returns the indices of the controllers using any interface of a component.
+  const std::vector<std::size_t> & get_controllers_of_component(
+    std::size_t component_index) const noexcept;
+
+  /// Returns the indices of the controllers using a command interface of a component.
+  const std::vector<std::size_t> & get_command_controllers_of_component(
+    std::size_t component_index) const noexcept;
+
+  /// Returns the number of indexed controllers.
+  std::size_t get_number_of_controllers() const noexcept { return controller_ids_.size(); }
+
+  std::optional<std::size_t> find_controller(const std::string & controller_name) const;
+
+  /// Returns the name of a controller, an empty string for a free or unknown index.
+  const std::string & get_controller_name(std::size_t controller_index) const noexcept;
+
+  /// Returns the indices of the components used by a controller.
+  const std::vector<std::size_t> & get_components_of_controller(
+    std::size_t controller_index) const noexcept;
+
+  /// Returns the command interfaces added for a controller.
+  const std::vector<std::string> & get_controller_command_interfaces(
+    std::size_t controller_index) const noexcept;
+
+  /// Returns the state interfaces added for a controller.
+  const std::vector<std::string> & get_controller_state_interfaces(
+    std::size_t controller_index) const noexcept;
+
+private:
+  struct ComponentEntry
+  {
+    std::string name;
+    std::vector<std::size_t> controllers;
+    std::vector<std::size_t> command_controllers;
+  };
+
+  struct ControllerEntry
+  {
+    std::string name;
+    std::vector<std::string> command_interfaces;
+    std::vector<std::string> state_interfaces;
+    std::vector<std::size_t> components;
+  };
+
+  /// Adds the dependencies of a controller on the owner of an interface, if it is exported.
+  void add_dependency(
+    std::size_t controller_index, const std::string & interface_name, bool is_command_interface);
+
+  std::vector<ComponentEntry> components_;
+  /// Components exporting the command and the state interfaces
+  std::unordered_map<std::string, std::size_t> command_interface_owners_;
+  std::unordered_map<std::string, std::size_t> state_interface_owners_;
+
+  std::vector<ControllerEntry> controllers_;
+  std::unordered_map<std::string, std::size_t> controller_ids_;
+  std::vector<std::size_t> free_controller_indices_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__HARDWARE_DEPENDENCY_INDEX_HPP_
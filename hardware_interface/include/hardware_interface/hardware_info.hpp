@@ -18,10 +18,14 @@
 #include <fmt/compile.h>
 
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <variant>
 #include <vector>
 
+#include "hardware_interface/overload_governor.hpp"
+#include "hardware_interface/sample_batch.hpp"
+#include "hardware_interface/time_budget.hpp"
 #include "joint_limits/joint_limits.hpp"
 
 namespace hardware_interface
@@ -46,13 +50,20 @@ struct InterfaceInfo
   /// (Optional) The datatype of the interface, e.g. "bool", "int".
   std::string data_type = "double";
   /// (Optional) If the handle is an array, the size of the array.
-  int size;
+  int size = 1;
   /// (Optional) Key-value pairs of command/stateInterface parameters. This is
   /// useful for drivers that operate on protocols like modbus, where each
   /// interface needs own address(register), datatype, etc.
   std::unordered_map<std::string, std::string> parameters;
   /// (Optional) enable or disable the limits for the command interfaces
   bool enable_limits;
+  /// (Optional) If true, the value is stored in an atomic word instead of being guarded by the
+  /// handle mutex. Readers never fail and writers never block. Only valid for scalar data types.
+  bool lock_free = false;
+  /// (Optional) If true, the value of type bool, uint8 or int8 is stored with the other packed
+  /// interfaces of the hardware component in one dense, cache-line aligned block of bytes. Set by
+  /// the `packed` attribute of the `<gpio>` tag for all its interfaces.
+  bool packed = false;
 };
 
 /// @brief This structure stores information about a joint that is mimicking another joint
@@ -144,6 +155,19 @@ struct TransmissionInfo
 
 using HANDLE_DATATYPE = std::variant<
   std::monostate, double, float, bool, uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t>;
+
+/**
+ * Hardware handles supported array types, the size of an array is fixed when the handle is created
+ */
+using HANDLE_ARRAY_DATATYPE =
+  std::variant<std::monostate, std::vector<double>, std::vector<float>, std::vector<uint16_t>>;
+
+/**
+ * Hardware handles supported sample batch types, the capacity of a batch is fixed when the handle
+ * is created
+ */
+using HANDLE_SAMPLE_BATCH_DATATYPE =
+  std::variant<std::monostate, SampleRing<double>, SampleRing<float>>;
 class HandleDataType
 {
 public:
@@ -159,6 +183,11 @@ public:
     INT16,
     UINT32,
     INT32,
+    DOUBLE_ARRAY,
+    FLOAT32_ARRAY,
+    UINT16_ARRAY,
+    DOUBLE_SAMPLES,
+    FLOAT32_SAMPLES,
   };
 
   HandleDataType() = default;
@@ -201,6 +230,26 @@ public:
     {
       value_ = INT32;
     }
+    else if (data_type == "double_array")
+    {
+      value_ = DOUBLE_ARRAY;
+    }
+    else if (data_type == "float32_array")
+    {
+      value_ = FLOAT32_ARRAY;
+    }
+    else if (data_type == "uint16_array")
+    {
+      value_ = UINT16_ARRAY;
+    }
+    else if (data_type == "double_samples")
+    {
+      value_ = DOUBLE_SAMPLES;
+    }
+    else if (data_type == "float32_samples")
+    {
+      value_ = FLOAT32_SAMPLES;
+    }
     else
     {
       value_ = UNKNOWN;
@@ -239,6 +288,16 @@ public:
         return "uint32";
       case INT32:
         return "int32";
+      case DOUBLE_ARRAY:
+        return "double_array";
+      case FLOAT32_ARRAY:
+        return "float32_array";
+      case UINT16_ARRAY:
+        return "uint16_array";
+      case DOUBLE_SAMPLES:
+        return "double_samples";
+      case FLOAT32_SAMPLES:
+        return "float32_samples";
       default:
         return "unknown";
     }
@@ -305,6 +364,105 @@ public:
 
   HandleDataType from_string(const std::string & data_type) { return HandleDataType(data_type); }
 
+  /// Returns true if the handle holds a fixed-size array of values instead of a single value.
+  constexpr bool is_array() const
+  {
+    return value_ == DOUBLE_ARRAY || value_ == FLOAT32_ARRAY || value_ == UINT16_ARRAY;
+  }
+
+  /// Returns the data type of the arrays of values of type T, UNKNOWN if the type is not supported.
+  template <typename T>
+  static constexpr Value from_array_element_type()
+  {
+    if constexpr (std::is_same_v<T, double>)
+    {
+      return DOUBLE_ARRAY;
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+      return FLOAT32_ARRAY;
+    }
+    else if constexpr (std::is_same_v<T, uint16_t>)
+    {
+      return UINT16_ARRAY;
+    }
+    else
+    {
+      return UNKNOWN;
+    }
+  }
+
+  /// Returns true if the handle holds a batch of timestamped samples instead of a single value.
+  constexpr bool is_sample_batch() const
+  {
+    return value_ == DOUBLE_SAMPLES || value_ == FLOAT32_SAMPLES;
+  }
+
+  /// Returns the data type of the batches of samples of type T, UNKNOWN if the type is not
+  /// supported.
+  template <typename T>
+  static constexpr Value from_sample_element_type()
+  {
+    if constexpr (std::is_same_v<T, double>)
+    {
+      return DOUBLE_SAMPLES;
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+      return FLOAT32_SAMPLES;
+    }
+    else
+    {
+      return UNKNOWN;
+    }
+  }
+
+  /// Returns the data type of the values of type T, UNKNOWN if the type is not supported.
+  template <typename T>
+  static constexpr Value from_type()
+  {
+    if constexpr (std::is_same_v<T, double>)
+    {
+      return DOUBLE;
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+      return FLOAT32;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+      return BOOL;
+    }
+    else if constexpr (std::is_same_v<T, uint8_t>)
+    {
+      return UINT8;
+    }
+    else if constexpr (std::is_same_v<T, int8_t>)
+    {
+      return INT8;
+    }
+    else if constexpr (std::is_same_v<T, uint16_t>)
+    {
+      return UINT16;
+    }
+    else if constexpr (std::is_same_v<T, int16_t>)
+    {
+      return INT16;
+    }
+    else if constexpr (std::is_same_v<T, uint32_t>)
+    {
+      return UINT32;
+    }
+    else if constexpr (std::is_same_v<T, int32_t>)
+    {
+      return INT32;
+    }
+    else
+    {
+      return UNKNOWN;
+    }
+  }
+
 private:
   Value value_ = UNKNOWN;
 };
@@ -358,6 +516,21 @@ struct HardwareAsyncParams
   std::vector<int> cpu_affinity_cores = {};
   /// Whether to print warnings when the async thread doesn't meet its deadline
   bool print_warnings = true;
+  /// Control loop of the controller manager running the async cycles, empty for the default
+  std::string control_loop = "";
+};
+
+/// Recovery of a hardware component after an error in its read or write.
+struct HardwareRecoveryParams
+{
+  /// Attempts to re-activate the component after its error transition, 0 disables the recovery
+  unsigned int max_attempts = 0;
+  /// Time before the first attempt in seconds, doubled after every failed attempt
+  double initial_backoff = 0.1;
+  /// Upper bound of the time between two attempts in seconds
+  double max_backoff = 5.0;
+  /// Whether the controllers deactivated by the error are activated again once recovered
+  bool restore_controllers = false;
 };
 
 /// This structure stores information about hardware defined in a robot's URDF.
@@ -369,12 +542,33 @@ struct HardwareInfo
   std::string type;
   ///  Hardware group to which the hardware belongs.
   std::string group;
+  /// Resource namespace of the hardware, e.g., the robot cell it belongs to, empty if none.
+  /// Namespaces are hierarchical, with the levels separated by slashes, e.g. "cell_1/arm".
+  std::string resource_namespace;
+  /// Fieldbus shared with other hardware components, exchanged once per cycle for all of them by
+  /// a HardwareBusInterface plugin, empty if none.
+  std::string bus;
+  /// Name of the pluginlib plugin of the bus, it has to be given by at least one of its members.
+  std::string bus_plugin_name;
   /// Component's read and write rates in Hz.
   unsigned int rw_rate;
+  /// Phase of the read and write cycles if rw_rate divides the update rate, -1 if not set.
+  int rw_phase = -1;
+  /// Budget of the execution time of every read and write in microseconds, 0 if not checked.
+  double time_budget_us = 0.0;
+  /// Action taken when a read or write exceeds the time budget.
+  TimeBudgetPolicy time_budget_policy = TimeBudgetPolicy::REPORT;
+  /// Window of the execution time and periodicity statistics, e.g., "window:1000" or "ewma:0.5s",
+  /// see ros2_control::parse_statistics_config().
+  std::string statistics_type = "cumulative";
+  /// Criticality class of the hardware, the auxiliary ones are shed when the loop is overloaded.
+  Criticality criticality = Criticality::CONTROL;
   /// Component is async
   bool is_async;
   /// Async Parameters
   HardwareAsyncParams async_params;
+  /// Recovery of the component after an error, disabled by default
+  HardwareRecoveryParams recovery_params;
   /// Name of the pluginlib plugin of the hardware that will be loaded.
   std::string hardware_plugin_name;
   /// (Optional) Key-value pairs for hardware parameters.
@@ -407,6 +601,11 @@ struct HardwareInfo
    * The XML contents prior to parsing
    */
   std::string original_xml;
+  /**
+   * The XML of the ros2_control tag of the hardware component, used to detect the changes of its
+   * description when the robot description is reloaded.
+   */
+  std::string description_xml;
   /**
    * The URDF parsed limits of the hardware components joint command interfaces
    */
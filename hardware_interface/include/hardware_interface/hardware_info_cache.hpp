@@ -0,0 +1,91 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__HARDWARE_INFO_CACHE_HPP_
+#define HARDWARE_INTERFACE__HARDWARE_INFO_CACHE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/hardware_info.hpp"
+
+namespace hardware_interface
+{
+/// Version of the binary format, to be increased whenever the HardwareInfo structures change.
+constexpr uint32_t HARDWARE_INFO_CACHE_VERSION = 9;
+
+/// Serializes the hardware infos, including their joint limits, into a binary buffer.
+/**
+ * The buffer uses the native byte order and sizes, so it's only meant to be read on the same
+ * machine, e.g., from a cache file.
+ */
+std::string serialize_hardware_info(const std::vector<HardwareInfo> & hardware_info);
+
+/// Deserializes the hardware infos written by serialize_hardware_info.
+/**
+ * \throws std::runtime_error if the data is truncated or malformed.
+ */
+std::vector<HardwareInfo> deserialize_hardware_info(const char * data, std::size_t size);
+
+/// Cache of the hardware infos parsed from robot descriptions, stored in files of a directory.
+/**
+ * Every robot description is stored in the file `hardware_info_<hash>.bin`, where the hash is the
+ * 64-bit FNV-1a hash of the URDF. The file also holds the URDF itself, so a hash collision is
+ * detected and handled as a cache miss. The files are memory-mapped when they are loaded and
+ * written to a temporary file first, so that several processes can share a cache directory.
+ */
+class HardwareInfoCache
+{
+public:
+  /**
+   * \param[in] directory directory of the cache files, created when the first file is stored.
+   */
+  explicit HardwareInfoCache(const std::string & directory);
+
+  /// Returns the hardware infos of the URDF, from the cache if possible.
+  /**
+   * If the URDF is not cached yet, or the cache file cannot be read, the URDF is parsed with
+   * hardware_interface::parse_control_resources_from_urdf and the result is stored in the cache.
+   * Errors of the cache are logged and never prevent the URDF from being parsed.
+   *
+   * \throws std::runtime_error if the URDF cannot be parsed.
+   */
+  std::vector<HardwareInfo> parse_control_resources_from_urdf(const std::string & urdf) const;
+
+  /// Loads the hardware infos of the URDF from the cache.
+  /**
+   * \returns false if the URDF is not cached or the cache file is invalid.
+   */
+  bool load(const std::string & urdf, std::vector<HardwareInfo> & hardware_info) const;
+
+  /// Stores the hardware infos of the URDF in the cache.
+  /**
+   * \throws std::runtime_error if the cache file cannot be written.
+   */
+  void store(const std::string & urdf, const std::vector<HardwareInfo> & hardware_info) const;
+
+  /// Returns the path of the cache file of the URDF.
+  std::string get_file_path(const std::string & urdf) const;
+
+  /// Returns the 64-bit FNV-1a hash of the URDF.
+  static uint64_t hash(const std::string & urdf);
+
+private:
+  std::string directory_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__HARDWARE_INFO_CACHE_HPP_
@@ -0,0 +1,154 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__HARDWARE_STATUS_AGGREGATOR_HPP_
+#define HARDWARE_INTERFACE__HARDWARE_STATUS_AGGREGATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "control_msgs/msg/hardware_status.hpp"
+#include "hardware_interface/types/hardware_interface_return_values.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/publisher.hpp"
+#include "rclcpp/time.hpp"
+#include "rclcpp/timer.hpp"
+
+namespace hardware_interface
+{
+/// Hardware status message of a component, published by a HardwareStatusAggregator.
+/**
+ * The source keeps the message initialized by the component, and update() fills it in place with
+ * the update_hardware_status_message() of the component, without copying the message.
+ */
+class HardwareStatusSource
+{
+public:
+  using UpdateCallback = std::function<return_type(control_msgs::msg::HardwareStatus &)>;
+
+  /**
+   * \param[in] component_name name of the component.
+   * \param[in] publish_rate rate the message is updated at, in Hz.
+   * \param[in] message_template message initialized by the component.
+   * \param[in] update_callback fills the dynamic values of the message.
+   */
+  HardwareStatusSource(
+    const std::string & component_name, double publish_rate,
+    const control_msgs::msg::HardwareStatus & message_template, UpdateCallback update_callback);
+
+  const std::string & get_component_name() const { return component_name_; }
+
+  double get_publish_rate() const { return publish_rate_; }
+
+  /// Fills the message with the latest values of the component.
+  /**
+   * \returns false if the update of the component failed or the component was detached.
+   */
+  bool update();
+
+  /// Returns the message, filled by the last update().
+  const control_msgs::msg::HardwareStatus & get_message() const { return message_; }
+
+  /// Stops calling the component, which has to be detached before it is destroyed.
+  void detach();
+
+private:
+  std::string component_name_;
+  double publish_rate_;
+  control_msgs::msg::HardwareStatus message_;
+  std::mutex update_mutex_;
+  UpdateCallback update_callback_;
+};
+
+/// Publishes the status of all the hardware components in a single message.
+/**
+ * The device states of all the sources are concatenated in one control_msgs::msg::HardwareStatus,
+ * published on the "~/hardware_status" topic of the node at a single rate, instead of one
+ * publisher and one timer per component. The ids of the devices are prefixed with the hardware id
+ * of their component, i.e., "<hardware_id>/<device_id>", so that they stay unique.
+ *
+ * Every source is updated at its own publish rate, bounded by the rate of the aggregator, and only
+ * the device states that changed since the last update are copied into the aggregated message. The
+ * message is published through a loaned message if the middleware supports loans for it.
+ */
+class HardwareStatusAggregator
+{
+public:
+  /**
+   * \param[in] node node of the publisher and of the timer, spun by the executor.
+   * \param[in] publish_rate rate of the aggregated message, in Hz. With 0, no timer is created and
+   * publish() has to be called by the user.
+   */
+  HardwareStatusAggregator(const rclcpp::Node::SharedPtr & node, double publish_rate);
+
+  ~HardwareStatusAggregator();
+
+  HardwareStatusAggregator(const HardwareStatusAggregator &) = delete;
+  HardwareStatusAggregator & operator=(const HardwareStatusAggregator &) = delete;
+
+  /// Replaces the published sources, e.g., after hardware components were loaded.
+  void set_sources(const std::vector<std::shared_ptr<HardwareStatusSource>> & sources);
+
+  /// Updates the sources that are due and publishes the aggregated message.
+  /**
+   * \param[in] time stamp of the message, and time deciding which sources are due.
+   */
+  void publish(const rclcpp::Time & time);
+
+  /// Returns the last published message.
+  /**
+   * \note This method is not thread-safe with publish(), e.g., with the timer.
+   */
+  const control_msgs::msg::HardwareStatus & get_message() const { return message_; }
+
+  /// Returns the number of device states copied by the last publish().
+  std::size_t get_changed_device_states() const { return changed_device_states_; }
+
+  std::size_t get_number_of_sources() const;
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<HardwareStatusSource> source;
+    /// First device state of the source in the aggregated message
+    std::size_t offset = 0;
+    std::size_t number_of_devices = 0;
+    /// Unprefixed ids of the devices, swapped with the prefixed ones to compare the device states
+    std::vector<std::string> device_ids;
+    int64_t period_ns = 0;
+    int64_t next_update_ns = 0;
+  };
+
+  /// Lays out the device states of all the sources in the aggregated message
+  void rebuild_message();
+
+  rclcpp::Node::SharedPtr node_;
+  /// Period of the timer, in nanoseconds, 0 without timer
+  int64_t period_ns_ = 0;
+  rclcpp::Publisher<control_msgs::msg::HardwareStatus>::SharedPtr publisher_;
+  rclcpp::TimerBase::SharedPtr timer_;
+  mutable std::mutex mutex_;
+  std::vector<Entry> entries_;
+  control_msgs::msg::HardwareStatus message_;
+  std::size_t changed_device_states_ = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__HARDWARE_STATUS_AGGREGATOR_HPP_
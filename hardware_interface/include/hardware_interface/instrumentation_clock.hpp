@@ -0,0 +1,62 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__INSTRUMENTATION_CLOCK_HPP_
+#define HARDWARE_INTERFACE__INSTRUMENTATION_CLOCK_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+namespace hardware_interface
+{
+/// Clock of the execution times and statistics measured in the control loop.
+/**
+ * By default, now() reads the steady clock, through the vDSO on Linux. With use_cpu_counter(), it
+ * reads the invariant time stamp counter of the CPU instead, `rdtsc` on x86-64 or `cntvct_el0` on
+ * AArch64, converted to the steady clock with a calibration, so that a sample costs a few
+ * nanoseconds instead of a few tens.
+ *
+ * The samples are time points of the steady clock in both cases, so that they can be compared
+ * with and subtracted from the other samples of the steady clock, e.g., to compute a deadline.
+ * The counter isn't slewed like the steady clock, they drift apart by the error of the calibration
+ * of a few parts per million, which is negligible for the execution times measured with it.
+ *
+ * The source is process-wide, the methods are thread-safe and now() is real-time safe.
+ */
+class InstrumentationClock
+{
+public:
+  /// Samples the clock of the instrumentation.
+  static std::chrono::steady_clock::time_point now() noexcept;
+
+  /// Calibrates the counter of the CPU against the steady clock and uses it for now().
+  /**
+   * \returns false if the CPU has no invariant counter, the steady clock is used then.
+   * \note This method is not real-time safe, it waits for the calibration of a few milliseconds.
+   */
+  static bool use_cpu_counter();
+
+  /// Uses the steady clock for now().
+  static void use_steady_clock() noexcept;
+
+  /// Returns true if now() reads the counter of the CPU.
+  static bool is_using_cpu_counter() noexcept;
+
+  /// Returns the frequency of the counter of the CPU in Hz, 0 if the counter isn't available.
+  static double get_counter_frequency();
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__INSTRUMENTATION_CLOCK_HPP_
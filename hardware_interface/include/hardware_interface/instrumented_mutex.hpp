@@ -0,0 +1,95 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__INSTRUMENTED_MUTEX_HPP_
+#define HARDWARE_INTERFACE__INSTRUMENTED_MUTEX_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hardware_interface
+{
+/// Contention of an InstrumentedRecursiveMutex since its construction.
+struct LockContentionStatistics
+{
+  /// Number of times the mutex was acquired by a thread that didn't hold it yet.
+  uint64_t locks = 0;
+  /// Number of lock() calls that waited for another thread holding the mutex.
+  uint64_t contended_locks = 0;
+  /// Number of try_lock() calls that failed because another thread held the mutex.
+  uint64_t try_lock_failures = 0;
+  /// Longest wait of a lock() for another thread.
+  std::chrono::nanoseconds max_wait_time = std::chrono::nanoseconds::zero();
+  /// Longest time a thread held the mutex, from its first lock to its last unlock.
+  std::chrono::nanoseconds max_hold_time = std::chrono::nanoseconds::zero();
+  /// Thread that held the mutex at the last failed try_lock(), 0 if no try_lock() failed.
+  int64_t last_blocking_thread = 0;
+  /// Thread holding the mutex when the statistics were sampled, 0 if the mutex is free.
+  int64_t owner_thread = 0;
+};
+
+/// Recursive mutex measuring its contention, a drop-in replacement of std::recursive_mutex.
+/**
+ * The real-time loop only takes the locks it shares with the non real-time threads with
+ * try_lock(), and skips its work when they are held. The mutex counts these failures and the
+ * waits of lock(), measures how long its holders keep it, and records the thread holding it, so
+ * that a skipped cycle can be traced back to the thread that caused it.
+ *
+ * The threads are identified by their kernel thread id on Linux, as shown by `top -H` or `ps -L`.
+ * lock(), try_lock() and unlock() don't allocate memory, get_statistics() can be called by any
+ * thread without taking the mutex.
+ */
+class InstrumentedRecursiveMutex
+{
+public:
+  InstrumentedRecursiveMutex() = default;
+
+  InstrumentedRecursiveMutex(const InstrumentedRecursiveMutex &) = delete;
+
+  InstrumentedRecursiveMutex & operator=(const InstrumentedRecursiveMutex &) = delete;
+
+  void lock();
+
+  bool try_lock() noexcept;
+
+  void unlock() noexcept;
+
+  LockContentionStatistics get_statistics() const;
+
+  /// Returns the id of the calling thread, as recorded in the statistics.
+  static int64_t get_current_thread_id() noexcept;
+
+private:
+  void on_acquired() noexcept;
+
+  std::recursive_mutex mutex_;
+  /// Only accessed by the thread holding the mutex
+  std::size_t depth_ = 0;
+  std::chrono::steady_clock::time_point acquire_time_;
+
+  std::atomic<int64_t> owner_thread_{0};
+  std::atomic<uint64_t> locks_{0};
+  std::atomic<uint64_t> contended_locks_{0};
+  std::atomic<uint64_t> try_lock_failures_{0};
+  std::atomic<int64_t> max_wait_ns_{0};
+  std::atomic<int64_t> max_hold_ns_{0};
+  std::atomic<int64_t> last_blocking_thread_{0};
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__INSTRUMENTED_MUTEX_HPP_
@@ -0,0 +1,106 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__INTERFACE_CHANGE_TRACKER_HPP_
+#define HARDWARE_INTERFACE__INTERFACE_CHANGE_TRACKER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+
+namespace hardware_interface
+{
+/// Tracks the changes of the values of a set of interfaces through their generations.
+/**
+ * The tracker keeps the generation of every interface it last reported, see
+ * Handle::get_value_generation(), so that a publisher of the interface values, e.g., a broadcaster
+ * or a recorder, only copies and sends the values that changed since its previous cycle. Checking
+ * an interface is a single atomic load, its value isn't read.
+ *
+ * All the interfaces are reported as changed by the first call of for_each_changed() and after
+ * reset(), and the interfaces whose changes aren't tracked, see Handle::is_value_change_tracked(),
+ * at every call.
+ *
+ * \note The tracker isn't thread-safe, it's meant to be used by the thread publishing the values.
+ */
+class InterfaceChangeTracker
+{
+public:
+  InterfaceChangeTracker() = default;
+
+  /**
+   * \param[in] handles interfaces to track, reported by their index in this vector.
+   */
+  explicit InterfaceChangeTracker(std::vector<std::shared_ptr<const Handle>> handles)
+  : handles_(std::move(handles)), generations_(handles_.size(), UNREPORTED)
+  {
+  }
+
+  /// Calls \p callback with the index and the handle of the interfaces changed since the last call.
+  /**
+   * \param[in] callback callable with the signature `void(std::size_t, const Handle &)`.
+   * \returns the number of changed interfaces.
+   * \note The method is real-time safe if the callback is.
+   */
+  template <typename Callback>
+  std::size_t for_each_changed(Callback && callback)
+  {
+    std::size_t number_of_changes = 0;
+    for (std::size_t i = 0; i < handles_.size(); ++i)
+    {
+      const Handle & handle = *handles_[i];
+      const uint64_t generation = handle.get_value_generation();
+      if (generation != generations_[i] || !handle.is_value_change_tracked())
+      {
+        generations_[i] = generation;
+        ++number_of_changes;
+        callback(i, handle);
+      }
+    }
+    return number_of_changes;
+  }
+
+  /// Returns true if the interface at \p index changed since it was last reported.
+  bool has_changed(std::size_t index) const
+  {
+    const Handle & handle = *handles_[index];
+    return handle.get_value_generation() != generations_[index] ||
+           !handle.is_value_change_tracked();
+  }
+
+  /// Reports all the interfaces as changed at the next call of for_each_changed().
+  void reset() { generations_.assign(handles_.size(), UNREPORTED); }
+
+  /// Returns the number of tracked interfaces.
+  std::size_t size() const { return handles_.size(); }
+
+  /// Returns the interface at \p index.
+  const Handle & get_handle(std::size_t index) const { return *handles_[index]; }
+
+private:
+  /// Generation of the interfaces that were never reported, never reached by a handle
+  static constexpr uint64_t UNREPORTED = std::numeric_limits<uint64_t>::max();
+
+  std::vector<std::shared_ptr<const Handle>> handles_;
+  std::vector<uint64_t> generations_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__INTERFACE_CHANGE_TRACKER_HPP_
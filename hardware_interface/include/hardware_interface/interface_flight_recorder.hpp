@@ -0,0 +1,210 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef HARDWARE_INTERFACE__INTERFACE_FLIGHT_RECORDER_HPP_
+#define HARDWARE_INTERFACE__INTERFACE_FLIGHT_RECORDER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+#include "rclcpp/logger.hpp"
+
+namespace hardware_interface
+{
+/// Cycles recorded by the InterfaceFlightRecorder, stored column by column.
+struct FlightRecording
+{
+  /// Names of the recorded interfaces, the state interfaces first
+  std::vector<std::string> interface_names;
+  /// Data types of the recorded interfaces, the values are recorded casted to double
+  std::vector<HandleDataType> data_types;
+  std::size_t number_of_state_interfaces = 0;
+  /// Read cycle of the ResourceManager of every recorded cycle
+  std::vector<uint64_t> cycles;
+  /// Time of the read and the write of every recorded cycle, in nanoseconds
+  std::vector<int64_t> read_stamps_ns;
+  std::vector<int64_t> write_stamps_ns;
+  /// One column per interface, in the order of interface_names, with one value per cycle
+  std::vector<std::vector<double>> columns;
+
+  /// Returns the number of recorded cycles.
+  std::size_t size() const { return cycles.size(); }
+
+  /// Removes the recorded cycles, keeping the description of the interfaces.
+  void clear_cycles();
+
+  /// Writes the description of the interfaces, which starts a recording file.
+  void write_header(std::ostream & os) const;
+
+  /// Writes the recorded cycles as a block of columns, appended to a file started by write_header.
+  void write_block(std::ostream & os) const;
+
+  /// Reads a recording file, concatenating all its blocks.
+  /**
+   * \throws std::runtime_error if the file cannot be opened or is not a valid recording.
+   */
+  static FlightRecording load(const std::string & file_name);
+};
+
+/// In-process recorder of the values of the state and command interfaces of every cycle.
+/**
+ * The values are copied into a preallocated ring buffer in record_states() and
+ * record_commands(), which are real-time safe, lock-free and don't allocate memory. A row of the
+ * ring buffer is committed at the write of the cycle, then the oldest rows are overwritten, so the
+ * buffer always holds the last cycles, e.g., the last 10 s of a 1 kHz loop with a capacity of
+ * 10000 cycles.
+ *
+ * A non real-time thread started with start() appends the new cycles to an output file every
+ * 100 ms, and writes the whole content of the buffer to a new dump file when a dump has been
+ * requested with request_dump(), e.g., when a hardware component failed. The files are written
+ * block by block, every block storing the values of each interface contiguously, see
+ * FlightRecording::load().
+ */
+class InterfaceFlightRecorder
+{
+public:
+  InterfaceFlightRecorder() = default;
+
+  ~InterfaceFlightRecorder();
+
+  InterfaceFlightRecorder(const InterfaceFlightRecorder &) = delete;
+  InterfaceFlightRecorder & operator=(const InterfaceFlightRecorder &) = delete;
+
+  /// Allocates the ring buffer recording the given interfaces.
+  /**
+   * \param[in] state_interfaces state interfaces recorded first.
+   * \param[in] command_interfaces command interfaces recorded after the state interfaces.
+   * \param[in] capacity number of cycles kept in the ring buffer.
+   * \throws std::invalid_argument if the capacity is lower than 2.
+   * \note This method is not real-time safe and stops the thread writing the files.
+   */
+  void configure(
+    const std::vector<StateInterface::ConstSharedPtr> & state_interfaces,
+    const std::vector<CommandInterface::SharedPtr> & command_interfaces, std::size_t capacity);
+
+  /// Starts the thread writing the files.
+  /**
+   * \param[in] output_file file to which all the cycles are appended, not written if empty.
+   * \param[in] dump_file_prefix prefix of the dump files, followed by the number of the dump and
+   * the ".bin" extension. No dump is written if empty.
+   * \param[in] logger logger reporting the written dumps and the errors of the thread.
+   * \throws std::runtime_error if the output file cannot be created.
+   */
+  void start(
+    const std::string & output_file, const std::string & dump_file_prefix,
+    const rclcpp::Logger & logger);
+
+  /// Stops the thread writing the files, after writing the pending cycles and dump.
+  void stop();
+
+  /// Copies the values of the state interfaces into the row of the current cycle.
+  void record_states(int64_t stamp_ns, uint64_t cycle) noexcept;
+
+  /// Copies the values of the command interfaces and commits the row of the current cycle.
+  void record_commands(int64_t stamp_ns) noexcept;
+
+  /// Requests the thread writing the files to dump the content of the ring buffer.
+  void request_dump() noexcept { dump_requested_.store(true, std::memory_order_relaxed); }
+
+  /// Appends the cycles committed since the previous drain to the recording.
+  /**
+   * \returns number of appended cycles.
+   * \note Only one thread can drain the cycles at a time. The cycles overwritten before they
+   * were drained are counted in get_dropped_cycles().
+   */
+  std::size_t drain(FlightRecording & recording);
+
+  /// Returns a copy of the description of the interfaces and of all the cycles of the buffer.
+  FlightRecording snapshot() const;
+
+  /// Returns an empty recording with the description of the recorded interfaces.
+  FlightRecording make_recording() const;
+
+  /// Returns the number of cycles overwritten before they were drained.
+  uint64_t get_dropped_cycles() const noexcept
+  {
+    return dropped_cycles_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns the number of committed cycles.
+  uint64_t get_recorded_cycles() const noexcept { return head_.load(std::memory_order_acquire); }
+
+  /// Returns the number of dump files written.
+  std::size_t get_number_of_dumps() const noexcept
+  {
+    return number_of_dumps_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns the number of recorded interfaces.
+  std::size_t get_number_of_interfaces() const { return number_of_columns_; }
+
+private:
+  /// Appends the committed rows from \p first_cycle until the head to the recording
+  /**
+   * \param[out] skipped_cycles number of cycles from \p first_cycle that were overwritten before
+   * or during the copy, they are not appended.
+   * \returns the cycle following the last copied one.
+   */
+  uint64_t copy_rows(
+    uint64_t first_cycle, FlightRecording & recording, uint64_t & skipped_cycles) const;
+
+  /// Writes the content of the ring buffer to the next dump file
+  void write_dump();
+
+  /// Loop of the thread writing the files
+  void write_files();
+
+  std::vector<StateInterface::ConstSharedPtr> state_interfaces_;
+  std::vector<CommandInterface::SharedPtr> command_interfaces_;
+  std::vector<std::string> interface_names_;
+  std::vector<HandleDataType> data_types_;
+  std::size_t number_of_columns_ = 0;
+  std::size_t capacity_ = 0;
+
+  /// Ring buffer, one row of values per cycle
+  std::unique_ptr<std::atomic<double>[]> values_;
+  std::unique_ptr<std::atomic<uint64_t>[]> cycles_;
+  std::unique_ptr<std::atomic<int64_t>[]> read_stamps_ns_;
+  std::unique_ptr<std::atomic<int64_t>[]> write_stamps_ns_;
+  /// Number of committed rows, written by the recording thread only
+  alignas(64) std::atomic<uint64_t> head_{0};
+  /// First cycle not drained yet, accessed by the draining thread only
+  alignas(64) uint64_t drain_cycle_ = 0;
+  std::atomic<uint64_t> dropped_cycles_{0};
+  std::atomic<bool> dump_requested_{false};
+  std::atomic<std::size_t> number_of_dumps_{0};
+
+  std::unique_ptr<std::ofstream> output_;
+  std::string dump_file_prefix_;
+  std::unique_ptr<rclcpp::Logger> logger_;
+  std::thread writer_thread_;
+  std::mutex writer_mutex_;
+  std::condition_variable writer_cv_;
+  bool stop_writer_ = false;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__INTERFACE_FLIGHT_RECORDER_HPP_
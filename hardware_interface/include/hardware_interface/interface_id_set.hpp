@@ -0,0 +1,151 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__INTERFACE_ID_SET_HPP_
+#define HARDWARE_INTERFACE__INTERFACE_ID_SET_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/name_pool.hpp"
+
+namespace hardware_interface
+{
+/// Set of interface names as a bitset over their dense ids in the NamePool.
+/**
+ * The conflicts between the interfaces of controllers are found with a bitwise AND of their sets
+ * instead of comparing the names, in 64 ids per operation. The size of a set grows with the
+ * largest id inserted into it, and the ids are dense, so a set of all the interfaces of a robot
+ * takes a few hundred bytes.
+ *
+ * \note Inserting names interns them and may allocate memory, the other methods don't.
+ */
+class InterfaceIdSet
+{
+public:
+  InterfaceIdSet() = default;
+
+  /// Creates the set of the given interface names.
+  explicit InterfaceIdSet(const std::vector<std::string> & names) { insert(names); }
+
+  void insert(NameId id)
+  {
+    const std::size_t word = id / BITS_PER_WORD;
+    if (word >= words_.size())
+    {
+      words_.resize(word + 1, 0u);
+    }
+    words_[word] |= bit(id);
+  }
+
+  void insert(const std::string & name) { insert(NamePool::intern(name)); }
+
+  void insert(const std::vector<std::string> & names)
+  {
+    for (const auto & name : names)
+    {
+      insert(name);
+    }
+  }
+
+  /// Adds all the interfaces of the other set.
+  void insert(const InterfaceIdSet & other)
+  {
+    if (other.words_.size() > words_.size())
+    {
+      words_.resize(other.words_.size(), 0u);
+    }
+    for (std::size_t i = 0; i < other.words_.size(); ++i)
+    {
+      words_[i] |= other.words_[i];
+    }
+  }
+
+  /// Removes all the interfaces of the other set.
+  void erase(const InterfaceIdSet & other) noexcept
+  {
+    const std::size_t size = std::min(words_.size(), other.words_.size());
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      words_[i] &= ~other.words_[i];
+    }
+  }
+
+  bool contains(NameId id) const noexcept
+  {
+    const std::size_t word = id / BITS_PER_WORD;
+    return word < words_.size() && (words_[word] & bit(id)) != 0u;
+  }
+
+  /// Returns true if an interface of \p name is in the set, without interning the name.
+  bool contains(const std::string & name) const
+  {
+    const NameId id = NamePool::find(name);
+    return id != NamePool::EMPTY_ID && contains(id);
+  }
+
+  bool intersects(const InterfaceIdSet & other) const noexcept
+  {
+    return find_first_common(other).has_value();
+  }
+
+  /// Returns the smallest id of the interfaces in both sets, std::nullopt if they are disjoint.
+  std::optional<NameId> find_first_common(const InterfaceIdSet & other) const noexcept
+  {
+    const std::size_t size = std::min(words_.size(), other.words_.size());
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const uint64_t common = words_[i] & other.words_[i];
+      if (common != 0u)
+      {
+        return static_cast<NameId>(i * BITS_PER_WORD + lowest_bit_index(common));
+      }
+    }
+    return std::nullopt;
+  }
+
+  bool empty() const noexcept
+  {
+    return std::all_of(words_.begin(), words_.end(), [](uint64_t word) { return word == 0u; });
+  }
+
+  /// Removes all the interfaces, keeping the memory of the set.
+  void clear() noexcept { std::fill(words_.begin(), words_.end(), 0u); }
+
+private:
+  static constexpr std::size_t BITS_PER_WORD = 64;
+
+  static uint64_t bit(NameId id) noexcept { return uint64_t{1} << (id % BITS_PER_WORD); }
+
+  static std::size_t lowest_bit_index(uint64_t word) noexcept
+  {
+    std::size_t index = 0;
+    while ((word & 1u) == 0u)
+    {
+      word >>= 1;
+      ++index;
+    }
+    return index;
+  }
+
+  std::vector<uint64_t> words_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__INTERFACE_ID_SET_HPP_
@@ -0,0 +1,168 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__INTERFACE_LAYOUT_HPP_
+#define HARDWARE_INTERFACE__INTERFACE_LAYOUT_HPP_
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "hardware_interface/hardware_info.hpp"
+
+namespace hardware_interface
+{
+/**
+ * Helpers for the layouts generated from a robot description by the
+ * ros2_control_generate_interface_layout() CMake function.
+ *
+ * A generated layout has, for every ros2_control tag, the names and the compile-time indices of
+ * its joints, sensors and GPIOs, and of its state and command interfaces together with their
+ * types, e.g., `Layout::state_interfaces::joint1_position` and
+ * `Layout::state_interfaces::joint1_position_type`. The interfaces are listed in the order of the
+ * description, joints first, then sensors and GPIOs.
+ */
+
+/// Returns the names of the interfaces of a generated layout, e.g., `Layout::command_interfaces`.
+/**
+ * The loaned interfaces of a controller are in the order of its interface configuration, so a
+ * controller returning these names from command_interface_configuration() accesses its loaned
+ * interfaces with the indices of the layout, e.g.,
+ * `command_interfaces_[Layout::command_interfaces::joint1_position]`.
+ */
+template <typename InterfacesT>
+std::vector<std::string> get_layout_interface_names()
+{
+  return std::vector<std::string>(InterfacesT::NAMES.begin(), InterfacesT::NAMES.end());
+}
+
+/// Resolves the indices of the interfaces of a generated layout in a hardware component.
+/**
+ * The names are resolved once, e.g., in on_configure(), with the resolver, e.g.,
+ * `[this](const std::string & name) { return get_state_interface_index(name); }`, then read()
+ * accesses the interfaces without lookup, e.g.,
+ * `set_state(indices[Layout::state_interfaces::joint1_position], position)`.
+ *
+ * \param[in] resolve function returning the index of an interface from its name.
+ * \return the indices of the interfaces, in the order of the layout.
+ */
+template <typename InterfacesT, typename ResolverT>
+std::array<std::size_t, InterfacesT::COUNT> resolve_layout_indices(ResolverT && resolve)
+{
+  std::array<std::size_t, InterfacesT::COUNT> indices{};
+  for (std::size_t i = 0; i < InterfacesT::COUNT; ++i)
+  {
+    indices[i] = resolve(std::string(InterfacesT::NAMES[i]));
+  }
+  return indices;
+}
+
+namespace detail
+{
+template <typename NamesT>
+void validate_layout_names(
+  const std::string & context, const NamesT & layout_names,
+  const std::vector<std::string> & names)
+{
+  if (layout_names.size() != names.size())
+  {
+    throw std::runtime_error(
+      "The generated layout has " + std::to_string(layout_names.size()) + " " + context +
+      " but the robot description has " + std::to_string(names.size()) + ".");
+  }
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    if (layout_names[i] != names[i])
+    {
+      throw std::runtime_error(
+        "The entry " + std::to_string(i) + " of the " + context + " of the generated layout is '" +
+        std::string(layout_names[i]) + "' but '" + names[i] + "' in the robot description.");
+    }
+  }
+}
+
+inline void collect_interfaces(
+  const std::vector<ComponentInfo> & components, bool state_interfaces,
+  std::vector<std::string> & names, std::vector<std::string> & data_types)
+{
+  for (const auto & component : components)
+  {
+    for (const auto & interface_info :
+         state_interfaces ? component.state_interfaces : component.command_interfaces)
+    {
+      names.push_back(component.name + "/" + interface_info.name);
+      data_types.push_back(interface_info.data_type);
+    }
+  }
+}
+}  // namespace detail
+
+/// Checks that a generated layout matches the description parsed at runtime.
+/**
+ * parse_control_resources_from_urdf() remains the source of truth, a layout generated from
+ * another version of the description, e.g., not rebuilt after a change, is rejected.
+ *
+ * \param[in] info the hardware information of the component, parsed from the description.
+ * \throws std::runtime_error if the name, the joints, the sensors, the GPIOs or the interfaces
+ * and their data types don't match.
+ */
+template <typename LayoutT>
+void validate_interface_layout(const HardwareInfo & info)
+{
+  if (LayoutT::NAME != info.name)
+  {
+    throw std::runtime_error(
+      "The generated layout of '" + std::string(LayoutT::NAME) + "' doesn't match the '" +
+      info.name + "' component.");
+  }
+  const auto component_names = [](const std::vector<ComponentInfo> & components)
+  {
+    std::vector<std::string> names;
+    for (const auto & component : components)
+    {
+      names.push_back(component.name);
+    }
+    return names;
+  };
+  detail::validate_layout_names("joints", LayoutT::joints::NAMES, component_names(info.joints));
+  detail::validate_layout_names("sensors", LayoutT::sensors::NAMES, component_names(info.sensors));
+  detail::validate_layout_names("gpios", LayoutT::gpios::NAMES, component_names(info.gpios));
+
+  std::vector<std::string> names;
+  std::vector<std::string> data_types;
+  for (const auto * components : {&info.joints, &info.sensors, &info.gpios})
+  {
+    detail::collect_interfaces(*components, true, names, data_types);
+  }
+  detail::validate_layout_names("state interfaces", LayoutT::state_interfaces::NAMES, names);
+  detail::validate_layout_names(
+    "state interface data types", LayoutT::state_interfaces::DATA_TYPES, data_types);
+
+  names.clear();
+  data_types.clear();
+  for (const auto * components : {&info.joints, &info.sensors, &info.gpios})
+  {
+    detail::collect_interfaces(*components, false, names, data_types);
+  }
+  detail::validate_layout_names("command interfaces", LayoutT::command_interfaces::NAMES, names);
+  detail::validate_layout_names(
+    "command interface data types", LayoutT::command_interfaces::DATA_TYPES, data_types);
+}
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__INTERFACE_LAYOUT_HPP_
@@ -17,9 +17,16 @@
 #ifndef HARDWARE_INTERFACE__INTROSPECTION_HPP_
 #define HARDWARE_INTERFACE__INTROSPECTION_HPP_
 
+#include <array>
+#include <functional>
 #include <string>
+#include <type_traits>
+#include <utility>
 
+#include "hardware_interface/introspection_sink.hpp"
+#include "hardware_interface/memory_arena.hpp"
 #include "hardware_interface/types/statistics_types.hpp"
+#include "hardware_interface/udp_interface_link.hpp"
 #include "pal_statistics/pal_statistics_macros.hpp"
 #include "pal_statistics/pal_statistics_utils.hpp"
 
@@ -40,6 +47,77 @@ inline IdType customRegister(
   { return static_cast<double>(variable->sample_count); };
   return registry.registerFunction(name + "/sample_count", sample_func, bookkeeping, enabled);
 }
+
+template <>
+inline IdType customRegister(
+  StatisticsRegistry & registry, const std::string & name,
+  const ros2_control::LatencyPercentiles * variable, RegistrationsRAII * bookkeeping, bool enabled)
+{
+  registry.registerVariable(name + "/p50", &variable->p50, bookkeeping, enabled);
+  registry.registerVariable(name + "/p99", &variable->p99, bookkeeping, enabled);
+  registry.registerVariable(name + "/p99_9", &variable->p99_9, bookkeeping, enabled);
+  return registry.registerVariable(name + "/p99_99", &variable->p99_99, bookkeeping, enabled);
+}
+
+template <>
+inline IdType customRegister(
+  StatisticsRegistry & registry, const std::string & name,
+  const ros2_control::LatencyHistogram * variable, RegistrationsRAII * bookkeeping, bool enabled)
+{
+  const std::array<std::pair<std::string, double>, 4> percentiles = {
+    {{"/p50", 50.0}, {"/p99", 99.0}, {"/p99_9", 99.9}, {"/p99_99", 99.99}}};
+  IdType id = 0;
+  for (const auto & [suffix, percentile] : percentiles)
+  {
+    std::function<double()> percentile_func = [variable, percentile = percentile]
+    { return variable->get_percentile(percentile); };
+    id = registry.registerFunction(name + suffix, percentile_func, bookkeeping, enabled);
+  }
+  return id;
+}
+
+template <>
+inline IdType customRegister(
+  StatisticsRegistry & registry, const std::string & name,
+  const hardware_interface::MemoryArena * variable, RegistrationsRAII * bookkeeping, bool enabled)
+{
+  using Getter = std::size_t (hardware_interface::MemoryArena::*)() const;
+  const std::array<std::pair<std::string, Getter>, 4> values = {
+    {{"/capacity", &hardware_interface::MemoryArena::get_capacity},
+     {"/used_bytes", &hardware_interface::MemoryArena::get_used_bytes},
+     {"/high_water_mark", &hardware_interface::MemoryArena::get_high_water_mark},
+     {"/overflow_bytes", &hardware_interface::MemoryArena::get_overflow_bytes}}};
+  IdType id = 0;
+  for (const auto & [suffix, getter] : values)
+  {
+    std::function<double()> value_func = [variable, getter = getter]
+    { return static_cast<double>((variable->*getter)()); };
+    id = registry.registerFunction(name + suffix, value_func, bookkeeping, enabled);
+  }
+  return id;
+}
+
+template <>
+inline IdType customRegister(
+  StatisticsRegistry & registry, const std::string & name,
+  const hardware_interface::UdpInterfaceLinkStatistics * variable, RegistrationsRAII * bookkeeping,
+  bool enabled)
+{
+  using Counter = uint64_t hardware_interface::UdpInterfaceLinkStatistics::*;
+  const std::array<std::pair<std::string, Counter>, 5> counters = {
+    {{"/sent_frames", &hardware_interface::UdpInterfaceLinkStatistics::sent_frames},
+     {"/send_errors", &hardware_interface::UdpInterfaceLinkStatistics::send_errors},
+     {"/received_frames", &hardware_interface::UdpInterfaceLinkStatistics::received_frames},
+     {"/lost_frames", &hardware_interface::UdpInterfaceLinkStatistics::lost_frames},
+     {"/rejected_frames", &hardware_interface::UdpInterfaceLinkStatistics::rejected_frames}}};
+  for (const auto & [suffix, counter] : counters)
+  {
+    std::function<double()> counter_func = [variable, counter = counter]
+    { return static_cast<double>(variable->*counter); };
+    registry.registerFunction(name + suffix, counter_func, bookkeeping, enabled);
+  }
+  return customRegister(registry, name + "/age", &variable->age, bookkeeping, enabled);
+}
 }  // namespace pal_statistics
 
 namespace hardware_interface
@@ -49,13 +127,147 @@ constexpr char DEFAULT_INTROSPECTION_TOPIC[] = "~/introspection_data";
 constexpr char CM_STATISTICS_KEY[] = "cm_execution_statistics";
 constexpr char CM_STATISTICS_TOPIC[] = "~/statistics";
 
-#define REGISTER_ROS2_CONTROL_INTROSPECTION(ID, ENTITY)                      \
-  REGISTER_ENTITY(                                                           \
-    hardware_interface::DEFAULT_REGISTRY_KEY, get_name() + "." + ID, ENTITY, \
-    &stats_registrations_, false);
+/// Bookkeeping of the introspection variables of an object, in pal_statistics and the
+/// IntrospectionSink. The variables are unregistered from both on its destruction.
+class IntrospectionRegistrations : public pal_statistics::RegistrationsRAII
+{
+public:
+  void enableAll()
+  {
+    pal_statistics::RegistrationsRAII::enableAll();
+    sink_registrations_.enable_all();
+  }
+
+  void disableAll()
+  {
+    pal_statistics::RegistrationsRAII::disableAll();
+    sink_registrations_.disable_all();
+  }
+
+  IntrospectionSinkRegistrations * get_sink_registrations() { return &sink_registrations_; }
+
+private:
+  IntrospectionSinkRegistrations sink_registrations_;
+};
+
+/// Registers an introspection entity in the IntrospectionSink.
+/**
+ * Arithmetic variables, functions returning a double and the statistics types are sampled by the
+ * sink, the other entities are only published through pal_statistics.
+ */
+template <typename EntityT>
+void register_sink_entity(
+  const std::string & name, const EntityT & entity, IntrospectionSinkRegistrations * registrations,
+  bool enabled)
+{
+  if constexpr (std::is_pointer_v<EntityT>)
+  {
+    using T = std::remove_cv_t<std::remove_pointer_t<EntityT>>;
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+      IntrospectionSink::register_variable<T>(name, entity, registrations, enabled);
+    }
+    else if constexpr (std::is_same_v<
+                         T, libstatistics_collector::moving_average_statistics::StatisticData>)
+    {
+      IntrospectionSink::register_variable(name + "/max", &entity->max, registrations, enabled);
+      IntrospectionSink::register_variable(name + "/min", &entity->min, registrations, enabled);
+      IntrospectionSink::register_variable(
+        name + "/average", &entity->average, registrations, enabled);
+      IntrospectionSink::register_variable(
+        name + "/standard_deviation", &entity->standard_deviation, registrations, enabled);
+      IntrospectionSink::register_variable(
+        name + "/sample_count", &entity->sample_count, registrations, enabled);
+    }
+    else if constexpr (std::is_same_v<T, ros2_control::LatencyPercentiles>)
+    {
+      IntrospectionSink::register_variable(name + "/p50", &entity->p50, registrations, enabled);
+      IntrospectionSink::register_variable(name + "/p99", &entity->p99, registrations, enabled);
+      IntrospectionSink::register_variable(
+        name + "/p99_9", &entity->p99_9, registrations, enabled);
+      IntrospectionSink::register_variable(
+        name + "/p99_99", &entity->p99_99, registrations, enabled);
+    }
+    else if constexpr (std::is_same_v<T, ros2_control::LatencyHistogram>)
+    {
+      const std::array<std::pair<std::string, double>, 4> percentiles = {
+        {{"/p50", 50.0}, {"/p99", 99.0}, {"/p99_9", 99.9}, {"/p99_99", 99.99}}};
+      for (const auto & [suffix, percentile] : percentiles)
+      {
+        IntrospectionSink::register_function(
+          name + suffix, [entity, percentile = percentile]
+          { return entity->get_percentile(percentile); }, registrations, enabled);
+      }
+    }
+    else if constexpr (std::is_same_v<T, hardware_interface::MemoryArena>)
+    {
+      IntrospectionSink::register_function(
+        name + "/capacity", [entity] { return static_cast<double>(entity->get_capacity()); },
+        registrations, enabled);
+      IntrospectionSink::register_function(
+        name + "/used_bytes", [entity] { return static_cast<double>(entity->get_used_bytes()); },
+        registrations, enabled);
+      IntrospectionSink::register_function(
+        name + "/high_water_mark",
+        [entity] { return static_cast<double>(entity->get_high_water_mark()); }, registrations,
+        enabled);
+      IntrospectionSink::register_function(
+        name + "/overflow_bytes",
+        [entity] { return static_cast<double>(entity->get_overflow_bytes()); }, registrations,
+        enabled);
+    }
+    else if constexpr (std::is_same_v<T, hardware_interface::UdpInterfaceLinkStatistics>)
+    {
+      using Counter = uint64_t hardware_interface::UdpInterfaceLinkStatistics::*;
+      const std::array<std::pair<std::string, Counter>, 5> counters = {
+        {{"/sent_frames", &T::sent_frames},
+         {"/send_errors", &T::send_errors},
+         {"/received_frames", &T::received_frames},
+         {"/lost_frames", &T::lost_frames},
+         {"/rejected_frames", &T::rejected_frames}}};
+      for (const auto & [suffix, counter] : counters)
+      {
+        IntrospectionSink::register_function(
+          name + suffix, [entity, counter = counter]
+          { return static_cast<double>(entity->*counter); }, registrations, enabled);
+      }
+      register_sink_entity(name + "/age", &entity->age, registrations, enabled);
+    }
+  }
+  else if constexpr (std::is_convertible_v<EntityT, std::function<double()>>)
+  {
+    IntrospectionSink::register_function(
+      name, std::function<double()>(entity), registrations, enabled);
+  }
+}
+
+/// Registers the entity in the IntrospectionSink, unregistered with the bookkeeping.
+template <typename EntityT>
+void register_sink_entity(
+  const std::string & name, const EntityT & entity, IntrospectionRegistrations * registrations,
+  bool enabled)
+{
+  register_sink_entity(name, entity, registrations->get_sink_registrations(), enabled);
+}
+
+/// Doesn't register the entity in the IntrospectionSink, as it couldn't be unregistered with the
+/// bookkeeping.
+template <typename EntityT>
+void register_sink_entity(
+  const std::string &, const EntityT &, pal_statistics::RegistrationsRAII *, bool)
+{
+}
+
+#define REGISTER_ROS2_CONTROL_INTROSPECTION(ID, ENTITY)                       \
+  REGISTER_ENTITY(                                                            \
+    hardware_interface::DEFAULT_REGISTRY_KEY, get_name() + "." + ID, ENTITY,  \
+    &stats_registrations_, false);                                            \
+  hardware_interface::register_sink_entity(                                   \
+    get_name() + "." + ID, ENTITY, &stats_registrations_, false);
 
-#define UNREGISTER_ROS2_CONTROL_INTROSPECTION(ID) \
-  UNREGISTER_ENTITY(DEFAULT_REGISTRY_KEY, get_name() + "." + ID);
+#define UNREGISTER_ROS2_CONTROL_INTROSPECTION(ID)                  \
+  UNREGISTER_ENTITY(DEFAULT_REGISTRY_KEY, get_name() + "." + ID);  \
+  hardware_interface::IntrospectionSink::unregister_entity(get_name() + "." + ID);
 
 #define CLEAR_ALL_ROS2_CONTROL_INTROSPECTION_REGISTRIES() CLEAR_ALL_REGISTRIES();
 
@@ -69,10 +281,13 @@ constexpr char CM_STATISTICS_TOPIC[] = "~/statistics";
   PUBLISH_ASYNC_STATISTICS(registry_key);
 
 #define DEFAULT_REGISTER_ROS2_CONTROL_INTROSPECTION(ID, ENTITY) \
-  REGISTER_ENTITY(DEFAULT_REGISTRY_KEY, ID, ENTITY);
+  REGISTER_ENTITY(DEFAULT_REGISTRY_KEY, ID, ENTITY);            \
+  hardware_interface::register_sink_entity(                     \
+    ID, ENTITY, static_cast<hardware_interface::IntrospectionSinkRegistrations *>(nullptr), true);
 
 #define DEFAULT_UNREGISTER_ROS2_CONTROL_INTROSPECTION(ID) \
-  UNREGISTER_ENTITY(DEFAULT_REGISTRY_KEY, ID);
+  UNREGISTER_ENTITY(DEFAULT_REGISTRY_KEY, ID);            \
+  hardware_interface::IntrospectionSink::unregister_entity(ID);
 }  // namespace hardware_interface
 
 #endif  // HARDWARE_INTERFACE__INTROSPECTION_HPP_
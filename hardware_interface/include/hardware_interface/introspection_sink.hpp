@@ -0,0 +1,209 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef HARDWARE_INTERFACE__INTROSPECTION_SINK_HPP_
+#define HARDWARE_INTERFACE__INTROSPECTION_SINK_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Samples of the introspection variables, as drained from the IntrospectionSink or loaded.
+struct IntrospectionRecording
+{
+  /// Consecutive samples of the same set of variables
+  struct Segment
+  {
+    /// Version of the set of variables, incremented whenever a variable is added, removed,
+    /// enabled or disabled
+    uint32_t schema_version = 0;
+    std::vector<std::string> names;
+    /// Time of every sample, in nanoseconds
+    std::vector<int64_t> stamps_ns;
+    /// Values of the samples row by row, with one value per variable in the order of the names
+    std::vector<double> values;
+
+    /// Returns the number of samples of the segment.
+    std::size_t size() const { return stamps_ns.size(); }
+
+    /// Returns the value of the variable at \p column of the sample at \p row.
+    double get_value(std::size_t row, std::size_t column) const
+    {
+      return values[row * names.size() + column];
+    }
+  };
+
+  std::vector<Segment> segments;
+
+  /// Writes the header starting a recording file.
+  static void write_file_header(std::ostream & os);
+
+  /// Appends the segments to a file started by write_file_header.
+  /**
+   * The names of a segment are only written if its schema version differs from the version of
+   * the last segment written to the file, so that the names are written once per schema.
+   *
+   * \param[in,out] written_schema_version schema version of the last written names, updated.
+   */
+  void write_segments(std::ostream & os, uint32_t & written_schema_version) const;
+
+  /// Reads a recording file, merging the consecutive samples of the same schema into a segment.
+  /**
+   * \throws std::runtime_error if the file cannot be opened or is not a valid recording.
+   */
+  static IntrospectionRecording load(const std::string & file_name);
+};
+
+class IntrospectionSinkRegistrations;
+
+/// In-process sink of the introspection variables, sampled into a compact binary recording.
+/**
+ * The variables registered with REGISTER_ROS2_CONTROL_INTROSPECTION or
+ * DEFAULT_REGISTER_ROS2_CONTROL_INTROSPECTION are also registered in the sink, together with their
+ * enabled state. Once the sink is enabled, sample() copies the values of all the enabled variables
+ * into a preallocated ring buffer of dense rows, and drain() moves them to a recording, e.g., to be
+ * written by a non real-time thread into a file. The names of the variables are written once per
+ * set of variables instead of with every sample.
+ *
+ * sample() is real-time safe and doesn't allocate memory. It only tries to lock the registry, the
+ * samples taken while a variable is registered or the ring buffer is full are dropped and counted.
+ * A single thread is expected to sample the variables.
+ */
+class IntrospectionSink
+{
+public:
+  /// Reader of a registered variable, converting its value to double
+  using ReadFunction = double (*)(const void *);
+
+  /// Allocates the ring buffer and enables the sampling.
+  /**
+   * The ring buffer is allocated on the first call only and never released, so that the sampling
+   * thread can't access released memory. Later calls only enable the sampling again.
+   *
+   * \param[in] capacity number of samples of the ring buffer.
+   * \param[in] max_variables number of values per sample, further enabled variables are not
+   * sampled.
+   */
+  static void enable(std::size_t capacity, std::size_t max_variables);
+
+  /// Disables the sampling, the taken samples can still be drained.
+  static void disable() noexcept;
+
+  static bool is_enabled() noexcept;
+
+  /// Registers an arithmetic variable, read every sample.
+  /**
+   * \param[in] registrations bookkeeping unregistering the variable on its destruction, if not
+   * nullptr. Otherwise the variable has to be unregistered with unregister_entity().
+   * \returns the id of the registration.
+   */
+  template <typename T>
+  static uint64_t register_variable(
+    const std::string & name, const T * variable, IntrospectionSinkRegistrations * registrations,
+    bool enabled)
+  {
+    static_assert(std::is_arithmetic_v<T>, "Only arithmetic variables can be sampled");
+    return register_reader(
+      name, variable, [](const void * value)
+      { return static_cast<double>(*static_cast<const T *>(value)); }, {}, registrations,
+      enabled);
+  }
+
+  /// Registers a function, called every sample.
+  static uint64_t register_function(
+    const std::string & name, const std::function<double()> & function,
+    IntrospectionSinkRegistrations * registrations, bool enabled)
+  {
+    return register_reader(name, nullptr, nullptr, function, registrations, enabled);
+  }
+
+  /// Unregisters all the variables registered with the name.
+  static void unregister_entity(const std::string & name);
+
+  /// Unregisters the variable with the id, if it is still registered.
+  static void unregister_id(uint64_t id);
+
+  /// Enables or disables the sampling of the variable with the id.
+  static void set_enabled(uint64_t id, bool enabled);
+
+  /// Excludes the variables whose name starts with one of the prefixes from the samples.
+  /**
+   * The excluded variables keep their enabled state and are sampled again once they are no longer
+   * excluded, so that the selection can be changed at runtime, e.g., from a parameter, without
+   * interfering with the owners enabling and disabling their variables. Every call replaces the
+   * previous prefixes, an empty list samples all the enabled variables.
+   */
+  static void set_excluded_prefixes(const std::vector<std::string> & prefixes);
+
+  /// Returns the number of registered variables, enabled or not.
+  static std::size_t get_number_of_variables();
+
+  /// Returns the number of values per sample, i.e., of the enabled and not excluded variables.
+  static std::size_t get_number_of_sampled_variables();
+
+  /// Samples the values of all the enabled and not excluded variables, if the sampling is enabled.
+  static void sample(int64_t stamp_ns) noexcept;
+
+  /// Moves the taken samples to the end of the recording.
+  /**
+   * \returns number of moved samples.
+   * \note Only one thread can drain the samples at a time.
+   */
+  static std::size_t drain(IntrospectionRecording & recording);
+
+  /// Returns the number of samples dropped because the ring buffer was full or the registry busy.
+  static uint64_t get_dropped_samples() noexcept;
+
+private:
+  static uint64_t register_reader(
+    const std::string & name, const void * variable, ReadFunction read,
+    const std::function<double()> & function, IntrospectionSinkRegistrations * registrations,
+    bool enabled);
+};
+
+/// Bookkeeping of the variables registered in the IntrospectionSink by an object.
+/**
+ * The variables are unregistered when the bookkeeping is destroyed, so it has to be declared
+ * after the registered variables.
+ */
+class IntrospectionSinkRegistrations
+{
+public:
+  IntrospectionSinkRegistrations() = default;
+
+  ~IntrospectionSinkRegistrations();
+
+  IntrospectionSinkRegistrations(const IntrospectionSinkRegistrations &) = delete;
+  IntrospectionSinkRegistrations & operator=(const IntrospectionSinkRegistrations &) = delete;
+
+  void add(uint64_t id) { ids_.push_back(id); }
+
+  void enable_all();
+
+  void disable_all();
+
+private:
+  std::vector<uint64_t> ids_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__INTROSPECTION_SINK_HPP_
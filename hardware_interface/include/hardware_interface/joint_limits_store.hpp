@@ -0,0 +1,88 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__JOINT_LIMITS_STORE_HPP_
+#define HARDWARE_INTERFACE__JOINT_LIMITS_STORE_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "hardware_interface/rcu_pointer.hpp"
+#include "joint_limits/joint_limits.hpp"
+
+namespace hardware_interface
+{
+/// Joint limits of the robot published at once by a JointLimitsStore.
+struct JointLimitsSnapshot
+{
+  std::unordered_map<std::string, joint_limits::JointLimits> hard_joint_limits;
+  std::unordered_map<std::string, joint_limits::SoftJointLimits> soft_joint_limits;
+  /// Number of updates of the store when the snapshot was published, 0 before the first one.
+  uint64_t version = 0u;
+};
+
+/// Joint limits of the robot, shared by the resource manager and the controllers.
+/**
+ * The resource manager publishes the joint limits parsed from the robot description once per
+ * process, and every time they change, e.g., when the robot description is reloaded. The
+ * controllers read the published snapshot instead of keeping their own copy of the limits.
+ * The snapshots are replaced with read-copy-update, so that the real-time readers never wait for an
+ * update, see RcuPointer.
+ */
+class JointLimitsStore
+{
+public:
+  using ReadGuard = RcuPointer<const JointLimitsSnapshot>::ReadGuard;
+
+  JointLimitsStore() : snapshot_(std::make_unique<const JointLimitsSnapshot>()) {}
+
+  /// Returns the current snapshot of the joint limits, valid until the guard is destroyed.
+  /**
+   * \note This method is real-time safe and lock-free. The guard has to be short-lived, copy the
+   * limits that are kept longer.
+   */
+  ReadGuard read() const noexcept { return snapshot_.read(); }
+
+  /// Returns the version of the current snapshot, to detect its updates.
+  /**
+   * \note This method is real-time safe and lock-free.
+   */
+  uint64_t get_version() const noexcept { return read()->version; }
+
+  /// Publishes new joint limits.
+  /**
+   * \note This method is not real-time safe, it waits for the readers of the previous snapshot.
+   */
+  void update(
+    std::unordered_map<std::string, joint_limits::JointLimits> hard_joint_limits,
+    std::unordered_map<std::string, joint_limits::SoftJointLimits> soft_joint_limits)
+  {
+    auto snapshot = std::make_unique<JointLimitsSnapshot>();
+    snapshot->hard_joint_limits = std::move(hard_joint_limits);
+    snapshot->soft_joint_limits = std::move(soft_joint_limits);
+    snapshot->version = updates_count_.fetch_add(1u, std::memory_order_relaxed) + 1u;
+    snapshot_.update(std::move(snapshot));
+  }
+
+private:
+  RcuPointer<const JointLimitsSnapshot> snapshot_;
+  std::atomic<uint64_t> updates_count_{0u};
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__JOINT_LIMITS_STORE_HPP_
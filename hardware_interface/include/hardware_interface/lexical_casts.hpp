@@ -15,12 +15,15 @@
 #ifndef HARDWARE_INTERFACE__LEXICAL_CASTS_HPP_
 #define HARDWARE_INTERFACE__LEXICAL_CASTS_HPP_
 
+#include <charconv>
 #include <cstdint>
 #include <limits>
-#include <regex>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <vector>
 
@@ -39,6 +42,33 @@ double stod(const std::string & s);
  */
 float stof(const std::string & s);
 
+/** \brief Converts a string to double in a locale-independent way, without throwing.
+ * \return The converted value, std::nullopt if not a valid number or if it exceeds the limits.
+ */
+std::optional<double> try_stod(std::string_view s);
+
+/** \brief Converts a string to float in a locale-independent way, without throwing.
+ * \return The converted value, std::nullopt if not a valid number or if it exceeds the limits.
+ */
+std::optional<float> try_stof(std::string_view s);
+
+namespace impl
+{
+/// Skips the leading whitespaces and the '+' sign, like std::stol.
+inline const char * skip_integer_prefix(const char * begin, const char * end)
+{
+  while (begin != end && (*begin == ' ' || (*begin >= '\t' && *begin <= '\r')))
+  {
+    ++begin;
+  }
+  if (begin != end && *begin == '+' && (begin + 1) != end && *(begin + 1) != '-')
+  {
+    ++begin;
+  }
+  return begin;
+}
+}  // namespace impl
+
 /** \brief Overflow-safe conversion from string to int32_t.
  * \throws std::out_of_range if the converted value would fall out of the range of int32_t
  * \throws std::invalid_argument if no conversion could be performed
@@ -48,13 +78,21 @@ T stoi_generic(const std::string & s)
 {
   static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "T must be a signed integral type");
 
-  size_t pos;
-  const auto v = std::stol(s, &pos);  // stol returns long
-  if (pos != s.length())
+  const char * end = s.data() + s.size();
+  const char * begin = impl::skip_integer_prefix(s.data(), end);
+  int64_t v;
+  const auto result = std::from_chars(begin, end, v);
+  if (result.ec == std::errc::invalid_argument)
+  {
+    throw std::invalid_argument("No conversion could be performed");
+  }
+  if (result.ec == std::errc() && result.ptr != end)
   {
     throw std::invalid_argument("Invalid characters in string");
   }
-  if (v < std::numeric_limits<T>::min() || v > std::numeric_limits<T>::max())
+  if (
+    result.ec == std::errc::result_out_of_range || v < std::numeric_limits<T>::min() ||
+    v > std::numeric_limits<T>::max())
   {
     throw std::out_of_range("value not in range of target type");
   }
@@ -77,13 +115,23 @@ T stoui_generic(const std::string & s)
   static_assert(
     std::is_integral_v<T> && std::is_unsigned_v<T>, "T must be an unsigned integral type");
 
-  size_t pos;
-  const auto v = std::stoul(s, &pos);  // stoul returns unsigned long
-  if (pos != s.length())
+  const char * end = s.data() + s.size();
+  const char * begin = impl::skip_integer_prefix(s.data(), end);
+  // negative values are out of range, std::from_chars doesn't parse them for unsigned types
+  const bool is_negative = begin != end && *begin == '-';
+  uint64_t v;
+  const auto result = std::from_chars(is_negative ? begin + 1 : begin, end, v);
+  if (result.ec == std::errc::invalid_argument)
+  {
+    throw std::invalid_argument("No conversion could be performed");
+  }
+  if (result.ec == std::errc() && result.ptr != end)
   {
     throw std::invalid_argument("Invalid characters in string");
   }
-  if (v > std::numeric_limits<T>::max())
+  if (
+    result.ec == std::errc::result_out_of_range || (is_negative && v != 0u) ||
+    v > std::numeric_limits<T>::max())
   {
     throw std::out_of_range("value not in range of target type");
   }
@@ -111,48 +159,25 @@ std::string to_lower_case(const std::string & string);
  */
 bool parse_bool(const std::string & bool_string);
 
+/**
+ * \brief Splits a flat array like "[a, b, c]" into its values.
+ * \param array_string The input string, starting with '[' and ending with ']'.
+ * \return The values of the array, without the surrounding whitespaces.
+ * \throws std::invalid_argument if the string is not a flat array of comma-separated values.
+ */
+std::vector<std::string_view> split_array(std::string_view array_string);
+
 template <typename T>
 std::vector<T> parse_array(const std::string & array_string)
 {
-  // Use regex to check for a flat array: starts with [, ends with ], no nested brackets
-  const std::regex array_regex(R"(^\[\s*([^\[\]]*\s*(,\s*[^\[\]]+\s*)*)?\]$)");
-  if (!std::regex_match(array_string, array_regex))
-  {
-    throw std::invalid_argument(
-      "String must be a flat array: starts with '[' and ends with ']', no nested arrays");
-  }
-
-  // Use regex for the expression that either empty or contains only spaces
-  const std::regex empty_or_spaces_regex(R"(^\[\s*\]$)");
-  if (std::regex_match(array_string, empty_or_spaces_regex))
-  {
-    return {};  // Return empty array if input is "[]"
-  }
-
-  // Use regex to find cases of comma-separated but only whitespaces or no spaces between them like
-  // "[,]" "[a,b,,c]"
-  const std::regex comma_separated_regex(R"(^\[\s*([^,\s]+(\s*,\s*[^,\s]+)*)?\s*\]$)");
-  if (!std::regex_match(array_string, comma_separated_regex))
-  {
-    throw std::invalid_argument(
-      "String must be a flat array with comma-separated values and no spaces between them");
-  }
+  // the values are split in a single pass, without building regular expressions at every call
+  const std::vector<std::string_view> values = split_array(array_string);
 
   std::vector<T> result = {};
-  if (array_string == "[]")
-  {
-    return result;  // Return empty array if input is "[]"
-  }
-
-  // regex for comma separated values and no spaces between them or just content like "[a,b,c]" or
-  // "[a]" or "[a, b, c]"
-  const std::regex value_regex(R"([^\s,\[\]]+)");
-  auto begin = std::sregex_iterator(array_string.begin(), array_string.end(), value_regex);
-  auto end = std::sregex_iterator();
-
-  for (auto it = begin; it != end; ++it)
+  result.reserve(values.size());
+  for (const auto & value : values)
   {
-    const std::string value_str = it->str();  // Get the first capturing group
+    const std::string value_str(value);
     if constexpr (std::is_same_v<T, std::string>)
     {
       result.push_back(value_str);
@@ -163,16 +188,13 @@ std::vector<T> parse_array(const std::string & array_string)
     }
     else if constexpr (std::is_floating_point_v<T> || std::is_integral_v<T>)
     {
-      try
-      {
-        const T value = static_cast<T>(hardware_interface::stod(value_str));
-        result.push_back(value);
-      }
-      catch (const std::exception &)
+      const auto converted_value = hardware_interface::try_stod(value);
+      if (!converted_value)
       {
         throw std::invalid_argument(
           "Failed converting string to floating point or integer: " + value_str);
       }
+      result.push_back(static_cast<T>(*converted_value));
     }
     else
     {
@@ -15,6 +15,8 @@
 #ifndef HARDWARE_INTERFACE__LOANED_COMMAND_INTERFACE_HPP_
 #define HARDWARE_INTERFACE__LOANED_COMMAND_INTERFACE_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <string>
@@ -26,6 +28,70 @@
 
 namespace hardware_interface
 {
+/// Gate of the writes of the loaned command interfaces of an asynchronous controller.
+/**
+ * The control loop closes the gate when it deactivates the controller while its update is
+ * running, so that the update keeps accessing valid loans but can't write the command interfaces
+ * anymore. The writes are counted by the gate, so close() tells if one is still in progress, and
+ * the synchronous controllers, whose loans have no gate, don't pay for it.
+ */
+class LoanWriteGate
+{
+public:
+  /// Write of a loan through the gate, the command interface may be written while it is allowed.
+  class Write
+  {
+  public:
+    /// Enters the gate, \p gate may be nullptr for the loans without a gate.
+    explicit Write(LoanWriteGate * gate) : gate_(gate)
+    {
+      if (gate_ && (gate_->state_.fetch_add(1, std::memory_order_acquire) & CLOSED) != 0)
+      {
+        gate_->state_.fetch_sub(1, std::memory_order_release);
+        gate_ = nullptr;
+        allowed_ = false;
+      }
+    }
+
+    ~Write()
+    {
+      if (gate_)
+      {
+        gate_->state_.fetch_sub(1, std::memory_order_release);
+      }
+    }
+
+    Write(const Write &) = delete;
+    Write & operator=(const Write &) = delete;
+
+    /// Returns false if the gate is closed, the command interface must not be written then.
+    bool allowed() const { return allowed_; }
+
+  private:
+    LoanWriteGate * gate_;
+    bool allowed_ = true;
+  };
+
+  /// Closes the gate, the writes entering it afterwards aren't allowed.
+  /**
+   * \returns true if no write is in progress, so the command interfaces aren't written through
+   * the gate anymore, false if a write that entered before has to finish first.
+   * \note The method is real-time safe, it doesn't wait for the writes in progress.
+   */
+  bool close() { return (state_.fetch_or(CLOSED, std::memory_order_acq_rel) & ~CLOSED) == 0; }
+
+  /// Opens the gate for new loans, no write must be in progress.
+  void open() { state_.store(0, std::memory_order_release); }
+
+  /// Returns true if the gate is closed.
+  bool is_closed() const { return (state_.load(std::memory_order_acquire) & CLOSED) != 0; }
+
+private:
+  static constexpr uint32_t CLOSED = 1u << 31;
+  /// CLOSED flag and number of the writes in progress
+  std::atomic<uint32_t> state_{0};
+};
+
 class LoanedCommandInterface
 {
 public:
@@ -78,6 +144,40 @@ public:
 
   const std::string & get_name() const { return command_interface_.get_name(); }
 
+  /**
+   * @brief Set the gate of the writes of the loan, see LoanWriteGate.
+   *
+   * The setters of the loan, and of the views created from it afterwards, return false without
+   * writing the command interface while the gate is closed, and its getters keep working. Used for
+   * the loans of the asynchronous controllers, the loans without a gate are always writable.
+   *
+   * @param write_gate The gate, it has to outlive the loan, or nullptr.
+   * @note This method is not thread-safe with the setters.
+   */
+  void set_write_gate(LoanWriteGate * write_gate) { write_gate_ = write_gate; }
+
+  /// Returns true if the write gate of the loan is closed, see set_write_gate().
+  bool is_revoked() const { return write_gate_ && write_gate_->is_closed(); }
+
+  /**
+   * @brief Release the claim of the loan before it is destroyed.
+   *
+   * Used to deactivate an asynchronous controller from the control loop while its update may still
+   * be running: the update keeps accessing a valid loan, and the command interface can be claimed
+   * again at once.
+   *
+   * @note The method is real-time safe if the deleter of the loan is. The write gate of the loan
+   * has to be closed without a write in progress, see LoanWriteGate::close().
+   */
+  void release_claim()
+  {
+    if (deleter_)
+    {
+      deleter_();
+      deleter_ = nullptr;
+    }
+  }
+
   const std::string & get_interface_name() const { return command_interface_.get_interface_name(); }
 
   const std::string & get_prefix_name() const { return command_interface_.get_prefix_name(); }
@@ -87,7 +187,7 @@ public:
    * @tparam T The type of the value to be set.
    * @param value The value to set.
    * @param max_tries The maximum number of tries to set the value.
-   * @return true if the value is set successfully, false otherwise.
+   * @return true if the value is set successfully, false otherwise, also if the loan is revoked.
    *
    * @note The method is thread-safe and non-blocking.
    * @note When different threads access the internal handle at same instance, and if they are
@@ -100,10 +200,26 @@ public:
   template <typename T>
   [[nodiscard]] bool set_value(const T & value, unsigned int max_tries = 10)
   {
+    if (is_revoked())
+    {
+      return false;
+    }
     unsigned int nr_tries = 0;
     ++set_value_statistics_.total_counter;
-    while (!command_interface_.set_limited_value(value))
+    while (true)
     {
+      {
+        // each try enters the gate again, the loan can be revoked while yielding
+        LoanWriteGate::Write write(write_gate_);
+        if (!write.allowed())
+        {
+          return false;
+        }
+        if (command_interface_.set_limited_value(value))
+        {
+          return true;
+        }
+      }
       ++set_value_statistics_.failed_counter;
       ++nr_tries;
       if (nr_tries == max_tries)
@@ -113,7 +229,6 @@ public:
       }
       std::this_thread::yield();
     }
-    return true;
   }
 
   /**
@@ -151,12 +266,104 @@ public:
     return std::nullopt;
   }
 
+  /**
+   * @brief Set the value of a command interface of type double in a single try, without checking
+   * its data type and without updating the access statistics.
+   * @param value The value to set, passed through the command limiter of the interface.
+   * @return true if the value is set successfully, false otherwise.
+   *
+   * @note The method is thread-safe and non-blocking.
+   * @note The interface must be checked with is_double_readable() beforehand, e.g., at the
+   * activation of the controller. Ideal for writing many interfaces in bulk in the real-time loop.
+   */
+  [[nodiscard]] bool set_double_unchecked(double value)
+  {
+    LoanWriteGate::Write write(write_gate_);
+    return write.allowed() && command_interface_.set_limited_double_unchecked(value);
+  }
+
+  /**
+   * @brief Get the value of a command interface of type double in a single try, without checking
+   * its data type and without updating the access statistics.
+   * @param value The variable to store the retrieved value.
+   * @return true if the value is retrieved successfully, false otherwise.
+   *
+   * @note The method is thread-safe and non-blocking.
+   * @note The interface must be checked with is_double_readable() beforehand.
+   */
+  [[nodiscard]] bool get_double_unchecked(double & value) const
+  {
+    return command_interface_.get_double_unchecked(value);
+  }
+
+  /**
+   * @brief Get the number of values of an array command interface.
+   * @return The size of the array, 0 if the command interface holds a single value.
+   */
+  std::size_t get_array_size() const { return command_interface_.get_array_size(); }
+
+  /**
+   * @brief Read the values of an array command interface in place in a single try, see
+   * Handle::read_array().
+   * @return true if the values were read, false if the command interface could not be locked.
+   */
+  template <typename T, typename Reader>
+  [[nodiscard]] bool read_array(Reader && reader) const
+  {
+    return command_interface_.read_array<T>(std::forward<Reader>(reader));
+  }
+
+  /**
+   * @brief Update the values of an array command interface in place in a single try, see
+   * Handle::write_array().
+   * @return true if the values were updated, false if the command interface could not be locked.
+   *
+   * @note The values of the arrays are not passed through the command limiter.
+   */
+  template <typename T, typename Writer>
+  [[nodiscard]] bool write_array(Writer && writer)
+  {
+    LoanWriteGate::Write write(write_gate_);
+    return write.allowed() && command_interface_.write_array<T>(std::forward<Writer>(writer));
+  }
+
+  /**
+   * @brief Copy the values of an array command interface in a single try, see
+   * Handle::get_array().
+   * @return true if the values were copied, false if the command interface could not be locked.
+   */
+  template <typename T>
+  [[nodiscard]] bool get_array(T * values, std::size_t size) const
+  {
+    return command_interface_.get_array(values, size);
+  }
+
+  /**
+   * @brief Set all the values of an array command interface in a single try, see
+   * Handle::set_array().
+   * @return true if the values were set, false if the command interface could not be locked.
+   *
+   * @note The values of the arrays are not passed through the command limiter.
+   */
+  template <typename T>
+  [[nodiscard]] bool set_array(const T * values, std::size_t size)
+  {
+    LoanWriteGate::Write write(write_gate_);
+    return write.allowed() && command_interface_.set_array(values, size);
+  }
+
   /**
    * @brief Get the data type of the command interface.
    * @return The data type of the command interface.
    */
   HandleDataType get_data_type() const { return command_interface_.get_data_type(); }
 
+  /**
+   * @brief Check if the command interface is accessed as double by the unchecked accessors and the
+   * views of type double, see Handle::is_double_readable().
+   */
+  bool is_double_readable() const { return command_interface_.is_double_readable(); }
+
   /**
    * @brief Check if the state interface can be casted to double.
    * @return True if the state interface can be casted to double, false otherwise.
@@ -169,6 +376,9 @@ protected:
   Deleter deleter_;
 
 private:
+  template <typename T>
+  friend class LoanedCommandView;
+
   struct HandleRTStatistics
   {
     unsigned int total_counter = 0;
@@ -177,6 +387,8 @@ private:
   };
   mutable HandleRTStatistics get_value_statistics_;
   HandleRTStatistics set_value_statistics_;
+  /// Gate of the writes, nullptr if the loan is always writable, see set_write_gate()
+  LoanWriteGate * write_gate_ = nullptr;
 };
 
 }  // namespace hardware_interface
@@ -0,0 +1,304 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef HARDWARE_INTERFACE__LOANED_INTERFACE_VIEW_HPP_
+#define HARDWARE_INTERFACE__LOANED_INTERFACE_VIEW_HPP_
+
+#include <fmt/compile.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/loaned_command_interface.hpp"
+#include "hardware_interface/loaned_state_interface.hpp"
+
+namespace hardware_interface
+{
+namespace detail
+{
+/// Resolves the storage of a value of type T in a handle, nullptr if the handle isn't of type T.
+template <typename T>
+const T * resolve_value_storage(
+  const HANDLE_DATATYPE & value, const double * value_ptr, const uint8_t * packed_value_ptr,
+  HandleDataType data_type)
+{
+  if constexpr (std::is_same_v<T, double>)
+  {
+    return data_type == HandleDataType::DOUBLE ? value_ptr : nullptr;
+  }
+  else
+  {
+    if constexpr (is_external_value_type_v<T>)
+    {
+      if (packed_value_ptr && std::holds_alternative<T>(value))
+      {
+        // the value was created in the external storage of the hardware component
+        return std::launder(reinterpret_cast<const T *>(packed_value_ptr));
+      }
+    }
+    return std::get_if<T>(&value);
+  }
+}
+
+template <typename T>
+T load_bits(const std::atomic<uint64_t> & bits)
+{
+  const uint64_t value_bits = bits.load(std::memory_order_acquire);
+  T value;
+  std::memcpy(&value, &value_bits, sizeof(T));
+  return value;
+}
+}  // namespace detail
+
+/// Typed read access to a loaned state interface, resolved once when the view is created.
+/**
+ * The data type and the storage of the value are checked when the view is created, e.g., at the
+ * activation of a controller, so get() is a single load of an atomic for the interfaces with the
+ * `lock_free` attribute, a plain copy for the interfaces with serial access, see
+ * Handle::enable_serial_access(), and a non-blocking try-lock and a copy for the others, without
+ * the type checks, retries and statistics of LoanedStateInterface::get_optional(). A view of type
+ * double also reads a double value narrowed to float32, see Handle::is_double_readable().
+ *
+ * \note The view is only valid while the state interface is loaned.
+ */
+template <typename T>
+class LoanedStateView
+{
+public:
+  /// Creates an empty view, valid() returns false.
+  LoanedStateView() = default;
+
+  /**
+   * \param[in] loaned_interface state interface to view.
+   * \throws std::runtime_error if the state interface isn't of type T.
+   */
+  explicit LoanedStateView(const LoanedStateInterface & loaned_interface)
+  : LoanedStateView(loaned_interface.state_interface_)
+  {
+  }
+
+  /// Creates a read-only view of a handle, e.g., of a command interface exported by the hardware
+  /// component reading it.
+  /**
+   * \param[in] handle handle to view, it has to outlive the view.
+   * \throws std::runtime_error if the handle isn't of type T.
+   */
+  explicit LoanedStateView(const Handle & handle)
+  {
+    value_ = detail::resolve_value_storage<T>(
+      handle.value_, handle.value_ptr_, handle.packed_value_ptr_, handle.data_type_);
+    if constexpr (std::is_same_v<T, double>)
+    {
+      // the double value narrowed to float32 is converted by every access
+      narrowed_value_ = handle.narrowed_to_float32_ ? handle.get_typed_value_ptr<float>() : nullptr;
+    }
+    if (
+      !value_ && !narrowed_value_ &&
+      !(handle.lock_free_ && std::holds_alternative<T>(handle.value_)))
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid data type: '{}' view for interface: {} of type: '{}'"),
+          get_type_name<T>(), handle.get_name(), handle.data_type_.to_string()));
+    }
+    mutex_ = &handle.handle_mutex_;
+    lock_free_value_ = handle.lock_free_ ? &handle.lock_free_value_ : nullptr;
+    serial_access_ = handle.serial_access_;
+  }
+
+  /// Returns true if the view is created from a state interface.
+  bool valid() const { return mutex_ != nullptr; }
+
+  /**
+   * \param[out] value the value of the state interface.
+   * \returns true if the value is read, false if the interface is locked by another thread.
+   * \note The method is thread-safe, non-blocking and doesn't allocate memory.
+   */
+  [[nodiscard]] bool get(T & value) const
+  {
+    if (lock_free_value_)
+    {
+      value = detail::load_bits<T>(*lock_free_value_);
+      return true;
+    }
+    if (serial_access_)
+    {
+      value = *value_;
+      return true;
+    }
+    std::shared_lock<std::shared_mutex> lock(*mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    value = narrowed_value_ ? static_cast<T>(*narrowed_value_) : *value_;
+    return true;
+  }
+
+  /// Returns the value of the state interface, std::nullopt if it is locked by another thread.
+  [[nodiscard]] std::optional<T> get_optional() const
+  {
+    T value;
+    return get(value) ? std::optional<T>(value) : std::nullopt;
+  }
+
+private:
+  const T * value_ = nullptr;
+  /// Storage of a double value narrowed to float32, see Handle::narrow_to_float32()
+  const float * narrowed_value_ = nullptr;
+  std::shared_mutex * mutex_ = nullptr;
+  const std::atomic<uint64_t> * lock_free_value_ = nullptr;
+  bool serial_access_ = false;
+};
+
+/// Typed write access to a loaned command interface, resolved once when the view is created.
+/**
+ * The data type and the storage of the value are checked when the view is created, so set() is a
+ * single store of an atomic for the interfaces with the `lock_free` attribute, and a non-blocking
+ * try-lock and a copy for the others. The values of type double are passed through the command
+ * limiter of the interface, like LoanedCommandInterface::set_value().
+ *
+ * \note The view is only valid while the command interface is loaned.
+ */
+template <typename T>
+class LoanedCommandView
+{
+public:
+  /// Creates an empty view, valid() returns false.
+  LoanedCommandView() = default;
+
+  /**
+   * \param[in] loaned_interface command interface to view.
+   * \throws std::runtime_error if the command interface isn't of type T.
+   */
+  explicit LoanedCommandView(LoanedCommandInterface & loaned_interface)
+  : command_interface_(&loaned_interface.command_interface_),
+    write_gate_(loaned_interface.write_gate_)
+  {
+    CommandInterface & handle = *command_interface_;
+    value_ = const_cast<T *>(detail::resolve_value_storage<T>(
+      handle.value_, handle.value_ptr_, handle.packed_value_ptr_, handle.data_type_));
+    if constexpr (std::is_same_v<T, double>)
+    {
+      narrowed_value_ = handle.narrowed_to_float32_ ? handle.get_typed_value_ptr<float>() : nullptr;
+    }
+    if (
+      !value_ && !narrowed_value_ &&
+      !(handle.lock_free_ && std::holds_alternative<T>(handle.value_)))
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid data type: '{}' view for command interface: {} of type: '{}'"),
+          get_type_name<T>(), handle.get_name(), handle.data_type_.to_string()));
+    }
+    lock_free_value_ = handle.lock_free_ ? &handle.lock_free_value_ : nullptr;
+    serial_access_ = handle.serial_access_;
+  }
+
+  /// Returns true if the view is created from a command interface.
+  bool valid() const { return command_interface_ != nullptr; }
+
+  /**
+   * \param[in] value the value to set.
+   * \returns true if the value is set, false if the interface is locked by another thread or if
+   * its loan is revoked, see LoanedCommandInterface::set_write_gate().
+   * \note The method is thread-safe, non-blocking and doesn't allocate memory.
+   */
+  [[nodiscard]] bool set(const T & value)
+  {
+    LoanWriteGate::Write write(write_gate_);
+    if (!write.allowed())
+    {
+      return false;
+    }
+    T limited_value = value;
+    if constexpr (std::is_same_v<T, double>)
+    {
+      limited_value =
+        command_interface_->on_set_command_limiter_(value, command_interface_->is_command_limited_);
+    }
+    if (lock_free_value_)
+    {
+      uint64_t bits = 0;
+      std::memcpy(&bits, &limited_value, sizeof(T));
+      command_interface_->store_lock_free_word(bits);
+      return true;
+    }
+    if (serial_access_)
+    {
+      command_interface_->store_value(*value_, limited_value);
+      return true;
+    }
+    std::unique_lock<std::shared_mutex> lock(command_interface_->handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    if (narrowed_value_)
+    {
+      command_interface_->store_value(*narrowed_value_, static_cast<float>(limited_value));
+      return true;
+    }
+    command_interface_->store_value(*value_, limited_value);
+    return true;
+  }
+
+  /**
+   * \param[out] value the current value of the command interface.
+   * \returns true if the value is read, false if the interface is locked by another thread.
+   */
+  [[nodiscard]] bool get(T & value) const
+  {
+    if (lock_free_value_)
+    {
+      value = detail::load_bits<T>(*lock_free_value_);
+      return true;
+    }
+    if (serial_access_)
+    {
+      value = *value_;
+      return true;
+    }
+    std::shared_lock<std::shared_mutex> lock(command_interface_->handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    value = narrowed_value_ ? static_cast<T>(*narrowed_value_) : *value_;
+    return true;
+  }
+
+private:
+  CommandInterface * command_interface_ = nullptr;
+  LoanWriteGate * write_gate_ = nullptr;
+  T * value_ = nullptr;
+  /// Storage of a double value narrowed to float32, see Handle::narrow_to_float32()
+  float * narrowed_value_ = nullptr;
+  std::atomic<uint64_t> * lock_free_value_ = nullptr;
+  bool serial_access_ = false;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__LOANED_INTERFACE_VIEW_HPP_
@@ -22,6 +22,7 @@
 #include <utility>
 
 #include "hardware_interface/handle.hpp"
+#include "hardware_interface/read_stamp.hpp"
 #include "rclcpp/logging.hpp"
 namespace hardware_interface
 {
@@ -42,6 +43,14 @@ public:
   {
   }
 
+  explicit LoanedStateInterface(
+    StateInterface::ConstSharedPtr state_interface, std::shared_ptr<const ReadStamp> read_stamp,
+    Deleter && deleter)
+  : LoanedStateInterface(state_interface, std::forward<Deleter>(deleter))
+  {
+    read_stamp_ = std::move(read_stamp);
+  }
+
   LoanedStateInterface(const LoanedStateInterface & other) = delete;
 
   LoanedStateInterface(LoanedStateInterface && other) = default;
@@ -106,24 +115,124 @@ public:
     return std::nullopt;
   }
 
+  /**
+   * @brief Get the value of a state interface of type double in a single try, without checking
+   * its data type and without updating the access statistics.
+   * @param value The variable to store the retrieved value.
+   * @return true if the value is retrieved successfully, false otherwise.
+   *
+   * @note The method is thread-safe and non-blocking.
+   * @note The interface must be checked with is_double_readable() beforehand, e.g., at the
+   * activation of the controller. Ideal for reading many interfaces in bulk in the real-time loop.
+   */
+  [[nodiscard]] bool get_double_unchecked(double & value) const
+  {
+    return state_interface_.get_double_unchecked(value);
+  }
+
+  /**
+   * @brief Get the number of values of an array state interface.
+   * @return The size of the array, 0 if the state interface holds a single value.
+   */
+  std::size_t get_array_size() const { return state_interface_.get_array_size(); }
+
+  /// Returns the number of changes of the value, see Handle::get_value_generation().
+  uint64_t get_value_generation() const { return state_interface_.get_value_generation(); }
+
+  /// Returns true if all the changes of the value are counted, see
+  /// Handle::is_value_change_tracked().
+  bool is_value_change_tracked() const { return state_interface_.is_value_change_tracked(); }
+
+  /**
+   * @brief Read the values of an array state interface in place in a single try, see
+   * Handle::read_array().
+   * @return true if the values were read, false if the state interface could not be locked.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  template <typename T, typename Reader>
+  [[nodiscard]] bool read_array(Reader && reader) const
+  {
+    return state_interface_.read_array<T>(std::forward<Reader>(reader));
+  }
+
+  /**
+   * @brief Get the capacity of a sample batch state interface.
+   * @return The capacity of the batch, 0 if the state interface holds a single value.
+   */
+  std::size_t get_sample_capacity() const { return state_interface_.get_sample_capacity(); }
+
+  /**
+   * @brief Read the samples of a sample batch state interface in place in a single try, see
+   * Handle::read_samples().
+   * @return true if the samples were read, false if the state interface could not be locked.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  template <typename T, typename Reader>
+  [[nodiscard]] bool read_samples(Reader && reader) const
+  {
+    return state_interface_.read_samples<T>(std::forward<Reader>(reader));
+  }
+
+  /**
+   * @brief Copy the values of an array state interface in a single try, see Handle::get_array().
+   * @return true if the values were copied, false if the state interface could not be locked.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  template <typename T>
+  [[nodiscard]] bool get_array(T * values, std::size_t size) const
+  {
+    return state_interface_.get_array(values, size);
+  }
+
   /**
    * @brief Get the data type of the state interface.
    * @return The data type of the state interface.
    */
   HandleDataType get_data_type() const { return state_interface_.get_data_type(); }
 
+  /**
+   * @brief Check if the state interface is accessed as double by get_double_unchecked() and the
+   * views of type double, see Handle::is_double_readable().
+   */
+  bool is_double_readable() const { return state_interface_.is_double_readable(); }
+
   /**
    * @brief Check if the state interface can be casted to double.
    * @return True if the state interface can be casted to double, false otherwise.
    */
   bool is_castable_to_double() const { return state_interface_.is_castable_to_double(); }
 
+  /**
+   * @brief Get the time and cycle of the last successful read of the hardware component exporting
+   * the state interface.
+   * @return The stamp of the last read, with cycle 0 if the component was never read or if the
+   * state interface isn't exported by a hardware component, e.g., by a chainable controller.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  ReadStampData get_read_stamp() const
+  {
+    return read_stamp_ ? read_stamp_->get() : ReadStampData{};
+  }
+
+  /**
+   * @brief Check if the state interface is stamped by the read of a hardware component.
+   */
+  bool has_read_stamp() const { return read_stamp_ != nullptr; }
+
 protected:
   const StateInterface & state_interface_;
   std::string interface_name_;
   Deleter deleter_;
+  std::shared_ptr<const ReadStamp> read_stamp_;
 
 private:
+  template <typename T>
+  friend class LoanedStateView;
+
   struct HandleRTStatistics
   {
     unsigned int total_counter = 0;
@@ -0,0 +1,124 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__MEMORY_ARENA_HPP_
+#define HARDWARE_INTERFACE__MEMORY_ARENA_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace hardware_interface
+{
+/// Pre-faulted and locked memory of a controller or of a hardware component.
+/**
+ * The buffer of the arena is allocated, written once so that all its pages are mapped, and locked
+ * in RAM with mlock when the arena is constructed. The containers of a controller or of a
+ * component using the arena, e.g., through std::pmr::vector, then don't page-fault when they are
+ * first touched in the real-time loop, even if they are allocated in on_configure or on_activate.
+ *
+ * The allocations are served by a pool on top of the buffer, so that the blocks freed, e.g., when
+ * the controller is configured again, are reused for the allocations of the same size. Once the
+ * buffer is exhausted, the allocations fall back to the default heap and are counted in
+ * get_overflow_bytes(). The statistics are meant to size the arena: get_used_bytes() is the size
+ * of the buffer needed so far, get_high_water_mark() the peak of the allocated bytes.
+ *
+ * The arena is thread-safe, the allocations lock a mutex, so they are still better done outside
+ * of the real-time loop.
+ */
+class MemoryArena : public std::pmr::memory_resource
+{
+public:
+  /// Allocates, pre-faults and locks the buffer.
+  /**
+   * \param[in] capacity size of the buffer in bytes, rounded up to a page.
+   * \throws std::runtime_error if the buffer can't be allocated.
+   */
+  explicit MemoryArena(std::size_t capacity);
+
+  ~MemoryArena() override;
+
+  MemoryArena(const MemoryArena &) = delete;
+  MemoryArena & operator=(const MemoryArena &) = delete;
+
+  /// Size of the buffer in bytes.
+  std::size_t get_capacity() const noexcept { return buffer_.capacity; }
+
+  /// Whether the buffer is locked in RAM, false if mlock failed, e.g., due to RLIMIT_MEMLOCK.
+  bool is_locked() const noexcept { return buffer_.locked; }
+
+  /// Bytes of the buffer used by the pool, including its bookkeeping. Never decreases.
+  std::size_t get_used_bytes() const noexcept
+  {
+    return buffer_.used_bytes.load(std::memory_order_relaxed);
+  }
+
+  /// Bytes currently allocated through the arena.
+  std::size_t get_allocated_bytes() const noexcept
+  {
+    return allocated_bytes_.load(std::memory_order_relaxed);
+  }
+
+  /// Peak of get_allocated_bytes() since the construction of the arena.
+  std::size_t get_high_water_mark() const noexcept
+  {
+    return high_water_mark_.load(std::memory_order_relaxed);
+  }
+
+  /// Bytes allocated from the default heap because the buffer was exhausted. Never decreases.
+  std::size_t get_overflow_bytes() const noexcept
+  {
+    return buffer_.overflow_bytes.load(std::memory_order_relaxed);
+  }
+
+protected:
+  void * do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+private:
+  /// Monotonic allocation from the buffer, falling back to the default heap once it is exhausted
+  struct Buffer : public std::pmr::memory_resource
+  {
+    explicit Buffer(std::size_t requested_capacity);
+    ~Buffer() override;
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+    bool contains(const void * p) const noexcept;
+
+    unsigned char * data = nullptr;
+    std::size_t capacity = 0;
+    bool locked = false;
+    /// Offset of the free part of the buffer, only changed with the pool mutex held
+    std::size_t offset = 0;
+    std::atomic<std::size_t> used_bytes{0};
+    std::atomic<std::size_t> overflow_bytes{0};
+  };
+
+  Buffer buffer_;
+  std::mutex pool_mutex_;
+  std::pmr::unsynchronized_pool_resource pool_;
+  std::atomic<std::size_t> allocated_bytes_{0};
+  std::atomic<std::size_t> high_water_mark_{0};
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__MEMORY_ARENA_HPP_
@@ -0,0 +1,66 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef HARDWARE_INTERFACE__NAME_POOL_HPP_
+#define HARDWARE_INTERFACE__NAME_POOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hardware_interface
+{
+/// Id of a name interned in the NamePool
+using NameId = uint32_t;
+
+/// Process-wide table of the names of the interfaces, joints, components and controllers.
+/**
+ * Every name is stored once and represented by a 32-bit id, which can be compared and hashed
+ * instead of the string. The names are never removed, so the ids and the references to the
+ * interned names stay valid for the lifetime of the process.
+ *
+ * Id 0 is the empty name, it is returned for the unknown names and ids.
+ */
+class NamePool
+{
+public:
+  /// Id of the empty name
+  static constexpr NameId EMPTY_ID = 0;
+
+  /// Returns the id of the \p name, adding it to the pool if needed.
+  /**
+   * \note This method is not real-time safe, it may allocate memory.
+   */
+  static NameId intern(const std::string & name);
+
+  /// Returns the id of the \p name, or EMPTY_ID if it was never interned.
+  static NameId find(const std::string & name);
+
+  /// Returns the interned name of the id, or the empty name if the id is unknown.
+  static const std::string & get_name(NameId id);
+
+  /// Returns the interned copy of the \p name, adding it to the pool if needed.
+  static const std::string & get_interned(const std::string & name)
+  {
+    return get_name(intern(name));
+  }
+
+  /// Returns the number of interned names, including the empty name.
+  static std::size_t size();
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__NAME_POOL_HPP_
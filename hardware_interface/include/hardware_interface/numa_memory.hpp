@@ -0,0 +1,57 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__NUMA_MEMORY_HPP_
+#define HARDWARE_INTERFACE__NUMA_MEMORY_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Range of memory to place on a NUMA node
+struct NumaMemoryRange
+{
+  const void * data = nullptr;
+  std::size_t size = 0;
+};
+
+/// Placement of the memory accessed by the real-time threads on their NUMA node.
+/**
+ * The memory allocated while loading the hardware components and the controllers is placed on the
+ * NUMA node of the loading thread, and is accessed remotely by a real-time thread running on
+ * another node of a multi-socket machine. move_to_node() migrates the pages of the memory to the
+ * node of the real-time thread, without changing their addresses, through the move_pages system
+ * call, so no NUMA library is needed. On a machine with a single node, the pages are already on
+ * the node and nothing is moved.
+ */
+struct NumaMemory
+{
+  /// Returns the NUMA node of the CPU running the calling thread, -1 if it is unknown.
+  static int get_current_node() noexcept;
+
+  /// Moves the pages overlapping the memory ranges to the NUMA node.
+  /**
+   * \param[in] ranges memory ranges, the overlapping pages are moved once.
+   * \param[in] node NUMA node to move the pages to.
+   * \return number of pages that are placed on \p node afterwards, 0 if the pages can't be moved,
+   * e.g., on a kernel without NUMA support.
+   * \note This method is not real-time safe, the pages are copied by the kernel.
+   */
+  static std::size_t move_to_node(const std::vector<NumaMemoryRange> & ranges, int node);
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__NUMA_MEMORY_HPP_
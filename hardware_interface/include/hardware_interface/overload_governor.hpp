@@ -0,0 +1,214 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__OVERLOAD_GOVERNOR_HPP_
+#define HARDWARE_INTERFACE__OVERLOAD_GOVERNOR_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace hardware_interface
+{
+/// Criticality class of a controller or hardware component, used by the OverloadGovernor.
+enum class Criticality : std::uint8_t
+{
+  /// Protects the robot and its environment, never shed
+  SAFETY,
+  /// Controls the robot, never shed
+  CONTROL,
+  /// Can be decimated or paused when the control loop is overloaded, e.g., broadcasters
+  AUXILIARY
+};
+
+/// Parses the name of a Criticality: "safety", "control" or "auxiliary".
+/**
+ * \throws std::invalid_argument if the name is not valid.
+ */
+inline Criticality parse_criticality(const std::string & criticality)
+{
+  if (criticality == "safety")
+  {
+    return Criticality::SAFETY;
+  }
+  if (criticality == "control")
+  {
+    return Criticality::CONTROL;
+  }
+  if (criticality == "auxiliary")
+  {
+    return Criticality::AUXILIARY;
+  }
+  throw std::invalid_argument(
+    "Invalid criticality '" + criticality + "', expected 'safety', 'control' or 'auxiliary'.");
+}
+
+/// Returns the name of a Criticality, as parsed by parse_criticality().
+inline const char * to_string(Criticality criticality)
+{
+  switch (criticality)
+  {
+    case Criticality::SAFETY:
+      return "safety";
+    case Criticality::AUXILIARY:
+      return "auxiliary";
+    case Criticality::CONTROL:
+    default:
+      return "control";
+  }
+}
+
+/// Sheds the load of the auxiliary controllers and hardware components of an overloaded loop.
+/**
+ * The governor watches the headroom of the control cycles, i.e., the fraction of the period left
+ * after the read, the update and the write. At the end of every window of cycles, if the lowest
+ * headroom of the window was below the minimal headroom, the auxiliary controllers and components
+ * are shed one more level: their cycles are decimated by 2, 4, ... up to the maximal decimation,
+ * and then paused. After a number of consecutive windows whose lowest headroom is above the
+ * restore headroom, their rate is restored one level.
+ *
+ * \note All the methods are real-time safe and don't allocate memory. The governor is only used
+ * by the thread executing the control loop.
+ */
+class OverloadGovernor
+{
+public:
+  /// Decimation of the auxiliary cycles when they are paused
+  static constexpr uint32_t PAUSED = 0u;
+
+  /// Configures the governor and restores the full rate.
+  /**
+   * \param[in] window number of cycles of a window, at least 1.
+   * \param[in] min_headroom headroom below which the load is shed one more level.
+   * \param[in] restore_headroom headroom above which the rate is restored, if larger than
+   * \p min_headroom.
+   * \param[in] restore_windows number of consecutive windows above \p restore_headroom before the
+   * rate is restored one level, at least 1.
+   * \param[in] max_decimation maximal decimation before the cycles are paused, rounded down to a
+   * power of 2 and bounded by \p window so that every window contains a decimated cycle.
+   */
+  void configure(
+    uint32_t window, double min_headroom, double restore_headroom, uint32_t restore_windows,
+    uint32_t max_decimation) noexcept
+  {
+    window_ = std::max(window, 1u);
+    min_headroom_ = min_headroom;
+    restore_headroom_ = std::max(restore_headroom, min_headroom);
+    restore_windows_ = std::max(restore_windows, 1u);
+    max_decimation = std::clamp(max_decimation, 1u, window_);
+    max_level_ = 1u;
+    while ((2u << (max_level_ - 1u)) <= max_decimation)
+    {
+      ++max_level_;
+    }
+    reset();
+  }
+
+  /// Restores the full rate and starts a new window.
+  void reset() noexcept
+  {
+    level_ = 0u;
+    cycle_ = 0u;
+    window_cycle_ = 0u;
+    calm_windows_ = 0u;
+    window_min_headroom_ = std::numeric_limits<double>::max();
+  }
+
+  /// Adds the execution time of a cycle of the control loop.
+  /**
+   * \param[in] execution_time_us execution time of the read, the update and the write.
+   * \param[in] period_us period of the control loop.
+   * \returns true if the decimation changed at the end of this cycle.
+   */
+  bool add_cycle(double execution_time_us, double period_us) noexcept
+  {
+    ++cycle_;
+    if (period_us > 0.0)
+    {
+      window_min_headroom_ =
+        std::min(window_min_headroom_, 1.0 - (execution_time_us / period_us));
+    }
+    if (++window_cycle_ < window_)
+    {
+      return false;
+    }
+    const double headroom = window_min_headroom_;
+    window_cycle_ = 0u;
+    window_min_headroom_ = std::numeric_limits<double>::max();
+    if (headroom < min_headroom_)
+    {
+      calm_windows_ = 0u;
+      if (level_ < max_level_)
+      {
+        ++level_;
+        return true;
+      }
+      return false;
+    }
+    if (headroom <= restore_headroom_ || level_ == 0u)
+    {
+      calm_windows_ = 0u;
+      return false;
+    }
+    if (++calm_windows_ < restore_windows_)
+    {
+      return false;
+    }
+    calm_windows_ = 0u;
+    --level_;
+    return true;
+  }
+
+  /// Returns the shedding level, 0 if the auxiliary cycles run at their rate.
+  uint32_t get_level() const noexcept { return level_; }
+
+  /// Returns the decimation of the auxiliary cycles, 1 at their rate and PAUSED if paused.
+  uint32_t get_decimation() const noexcept
+  {
+    return level_ == max_level_ ? PAUSED : (1u << level_);
+  }
+
+  /// Returns true if an auxiliary cycle runs in the current cycle with the given decimation.
+  /**
+   * \param[in] decimation decimation returned by get_decimation().
+   * \param[in] cycle counter of the cycles of the control loop.
+   */
+  static bool is_due(uint32_t decimation, uint64_t cycle) noexcept
+  {
+    return decimation == 1u || (decimation != PAUSED && cycle % decimation == 0u);
+  }
+
+  /// Returns true if an auxiliary cycle runs in the current cycle.
+  bool is_due() const noexcept { return is_due(get_decimation(), cycle_); }
+
+private:
+  uint32_t window_ = 100u;
+  double min_headroom_ = 0.2;
+  double restore_headroom_ = 0.4;
+  uint32_t restore_windows_ = 10u;
+  /// Level at which the auxiliary cycles are paused
+  uint32_t max_level_ = 4u;
+
+  uint32_t level_ = 0u;
+  uint64_t cycle_ = 0u;
+  uint32_t window_cycle_ = 0u;
+  uint32_t calm_windows_ = 0u;
+  double window_min_headroom_ = std::numeric_limits<double>::max();
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__OVERLOAD_GOVERNOR_HPP_
@@ -0,0 +1,136 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef HARDWARE_INTERFACE__PACKED_INTERFACE_VALUES_HPP_
+#define HARDWARE_INTERFACE__PACKED_INTERFACE_VALUES_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "hardware_interface/loaned_interface_view.hpp"
+
+namespace hardware_interface
+{
+/// Returns the number of bytes holding \p number_of_values packed values of type T.
+/**
+ * The values of type bool are packed as bits, the values of type uint8_t as bytes.
+ */
+template <typename T>
+constexpr std::size_t get_packed_size(std::size_t number_of_values)
+{
+  static_assert(
+    std::is_same_v<T, bool> || std::is_same_v<T, uint8_t>,
+    "Only values of type bool or uint8_t can be packed");
+  return std::is_same_v<T, bool> ? (number_of_values + 7u) / 8u : number_of_values;
+}
+
+/// Returns the packed value at \p index, the bit `index % 8` of the byte `index / 8` for bool.
+template <typename T>
+T get_packed_value(const uint8_t * packed, std::size_t index)
+{
+  if constexpr (std::is_same_v<T, bool>)
+  {
+    return (packed[index / 8u] >> (index % 8u)) & 1u;
+  }
+  else
+  {
+    return packed[index];
+  }
+}
+
+/// Sets the packed value at \p index, see get_packed_value().
+template <typename T>
+void set_packed_value(uint8_t * packed, std::size_t index, T value)
+{
+  if constexpr (std::is_same_v<T, bool>)
+  {
+    const auto mask = static_cast<uint8_t>(1u << (index % 8u));
+    packed[index / 8u] = value ? (packed[index / 8u] | mask) : (packed[index / 8u] & ~mask);
+  }
+  else
+  {
+    packed[index] = value;
+  }
+}
+
+/// Reads many interfaces of type bool or uint8_t into a packed buffer of bits or bytes.
+/**
+ * For instance, a hardware component with hundreds of digital outputs receives the commands of
+ * its GPIO command interfaces as one buffer per cycle that it can send to the device as is, see
+ * semantic_components::PackedCommandArray for the controller side. The data types are checked
+ * once when the reader is created, reading a value is then a single non-blocking access.
+ *
+ * \note The handles have to outlive the reader.
+ */
+template <typename T>
+class PackedInterfaceReader
+{
+public:
+  PackedInterfaceReader() = default;
+
+  /**
+   * \param[in] handles pointers to the handles, in the order of the packed values.
+   * \throws std::runtime_error if a handle isn't of type T.
+   */
+  template <typename HandlePointers>
+  explicit PackedInterfaceReader(const HandlePointers & handles)
+  {
+    views_.reserve(handles.size());
+    for (const auto & handle : handles)
+    {
+      views_.emplace_back(*handle);
+    }
+  }
+
+  /// Returns the number of packed values.
+  std::size_t size() const { return views_.size(); }
+
+  /// Returns the number of bytes of the packed buffer.
+  std::size_t get_packed_size() const { return hardware_interface::get_packed_size<T>(size()); }
+
+  /// Reads all the values into \p packed, which has to hold get_packed_size() bytes.
+  /**
+   * The values of the interfaces locked by another thread keep their previous value in the buffer.
+   *
+   * \returns true if all the values are read.
+   * \note The method is non-blocking and doesn't allocate memory.
+   */
+  bool read(uint8_t * packed) const
+  {
+    bool all_read = true;
+    for (std::size_t i = 0; i < views_.size(); ++i)
+    {
+      T value;
+      if (views_[i].get(value))
+      {
+        set_packed_value<T>(packed, i, value);
+      }
+      else
+      {
+        all_read = false;
+      }
+    }
+    return all_read;
+  }
+
+private:
+  std::vector<LoanedStateView<T>> views_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__PACKED_INTERFACE_VALUES_HPP_
@@ -0,0 +1,70 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__PERFORMANCE_COUNTERS_HPP_
+#define HARDWARE_INTERFACE__PERFORMANCE_COUNTERS_HPP_
+
+#include <cstdint>
+
+namespace hardware_interface
+{
+/// Hardware performance counters of the calling thread.
+/**
+ * The difference of two samples taken around a code section gives the CPU cycles, the retired
+ * instructions, the last level cache misses and the branch misses of the section, counted in user
+ * space only, so its instructions per cycle and cache miss rate can be monitored in production
+ * without running perf.
+ *
+ * The sampling is enabled process-wide with set_sampling_enabled(). The counters of a thread are
+ * opened with perf_event_open at its first sample while the sampling is enabled, and closed when
+ * the thread exits: the first sample of a thread is not real-time safe, the next ones cost a
+ * single system call and don't allocate memory. The samples are zero while the sampling is
+ * disabled, if the counters can't be opened, e.g., when forbidden by the perf_event_paranoid
+ * setting or in a virtual machine without performance monitoring unit, and on the platforms
+ * without perf_event_open. A counter that isn't supported by the CPU stays zero.
+ */
+struct PerformanceCounters
+{
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t cache_misses = 0;
+  uint64_t branch_misses = 0;
+
+  /// Samples the counters of the calling thread, if the sampling is enabled.
+  static PerformanceCounters now() noexcept;
+
+  static void set_sampling_enabled(bool enabled) noexcept;
+
+  static bool is_sampling_enabled() noexcept;
+
+  /// Opens the counters of the calling thread if needed and returns whether they could be opened.
+  static bool is_available() noexcept;
+
+  PerformanceCounters operator-(const PerformanceCounters & other) const noexcept
+  {
+    return {
+      cycles - other.cycles, instructions - other.instructions, cache_misses - other.cache_misses,
+      branch_misses - other.branch_misses};
+  }
+
+  /// Returns the retired instructions per CPU cycle, 0 if no cycle was counted.
+  double get_instructions_per_cycle() const noexcept
+  {
+    return cycles > 0 ? static_cast<double>(instructions) / static_cast<double>(cycles) : 0.0;
+  }
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__PERFORMANCE_COUNTERS_HPP_
@@ -0,0 +1,209 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__RATE_DIVIDER_HPP_
+#define HARDWARE_INTERFACE__RATE_DIVIDER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Schedules an entity running at a rate dividing the rate of the loop it is executed in.
+/**
+ * The entity is executed every `divider` cycles of the loop, at the cycles whose index modulo the
+ * divider equals the phase of the entity. This replaces the comparison of the elapsed time with the
+ * period of the entity for the rates dividing the loop rate, so that the executions don't depend on
+ * the jitter of the loop.
+ *
+ * The phase is either set explicitly, e.g., by a RatePhaseAllocator, or anchored at the first
+ * cycle the entity is checked in.
+ */
+class RateDivider
+{
+public:
+  static constexpr uint32_t NO_PHASE = std::numeric_limits<uint32_t>::max();
+
+  /// Configures the divider and resets the phase.
+  /**
+   * \param[in] loop_rate rate of the loop in Hz.
+   * \param[in] rate rate of the entity in Hz, 0 or a rate above the loop rate run at every cycle.
+   */
+  void configure(unsigned int loop_rate, unsigned int rate) noexcept
+  {
+    if (rate == 0u || rate >= loop_rate)
+    {
+      divider_ = 1u;
+    }
+    else
+    {
+      divider_ = loop_rate % rate == 0u ? loop_rate / rate : 0u;
+    }
+    phase_ = NO_PHASE;
+  }
+
+  /// Returns true if the rate of the entity divides the loop rate.
+  bool is_divisible() const noexcept { return divider_ != 0u; }
+
+  /// Returns the number of loop cycles between two executions, 0 if the rate isn't divisible.
+  uint32_t get_divider() const noexcept { return divider_; }
+
+  /// Returns true if the phase is set.
+  bool has_phase() const noexcept { return phase_ != NO_PHASE; }
+
+  /// Returns the phase, NO_PHASE if it isn't set.
+  uint32_t get_phase() const noexcept { return phase_; }
+
+  /// Sets the phase so that the entity is executed at the given cycle.
+  void set_phase(uint64_t cycle) noexcept
+  {
+    phase_ = divider_ == 0u ? NO_PHASE : static_cast<uint32_t>(cycle % divider_);
+  }
+
+  /// Unsets the phase, it is anchored again at the next check.
+  void reset_phase() noexcept { phase_ = NO_PHASE; }
+
+  /// Returns true if the entity has to be executed at the given cycle.
+  /**
+   * If the phase isn't set, it is anchored at the given cycle.
+   * \returns false if the rate isn't divisible.
+   */
+  bool is_due(uint64_t cycle) noexcept
+  {
+    if (divider_ <= 1u)
+    {
+      return divider_ == 1u;
+    }
+    if (phase_ == NO_PHASE)
+    {
+      set_phase(cycle);
+    }
+    return cycle % divider_ == phase_;
+  }
+
+private:
+  uint32_t divider_ = 1u;
+  uint32_t phase_ = NO_PHASE;
+};
+
+/// Assigns the phases of rate dividers, spreading the load over the cycles of the loop.
+/**
+ * The allocator sums the loads scheduled at every cycle of one second of the loop, which is a
+ * multiple of the hyperperiod of all the dividers. A new entity gets the phase that minimizes the
+ * maximal load of its cycles, so that, e.g., the 100 Hz entities of a 1 kHz loop don't all run in
+ * the same cycle. The load of an entity is typically its measured execution time, or 1 to count
+ * the entities.
+ *
+ * \note allocate(), reserve() and release() don't allocate memory and are real-time safe, their
+ * complexity is linear in the loop rate.
+ */
+class RatePhaseAllocator
+{
+public:
+  RatePhaseAllocator() = default;
+
+  explicit RatePhaseAllocator(unsigned int loop_rate) { reset(loop_rate); }
+
+  /// Removes all the allocated phases.
+  /**
+   * \note This method only allocates memory if the loop rate changes.
+   */
+  void reset(unsigned int loop_rate) { load_per_cycle_.assign(loop_rate, 0.0); }
+
+  /// Returns the least loaded phase for the divider and adds the load to its cycles.
+  /**
+   * \returns 0 if the divider doesn't divide the loop rate, without adding the load.
+   */
+  uint32_t allocate(uint32_t divider, double load = 1.0) noexcept
+  {
+    const std::size_t number_of_cycles = load_per_cycle_.size();
+    if (divider <= 1u || number_of_cycles % divider != 0u)
+    {
+      return 0u;
+    }
+    uint32_t best_phase = 0u;
+    double best_max = std::numeric_limits<double>::infinity();
+    double best_sum = std::numeric_limits<double>::infinity();
+    for (uint32_t phase = 0u; phase < divider; ++phase)
+    {
+      double max = 0.0;
+      double sum = 0.0;
+      for (std::size_t cycle = phase; cycle < number_of_cycles; cycle += divider)
+      {
+        max = std::max(max, load_per_cycle_[cycle]);
+        sum += load_per_cycle_[cycle];
+      }
+      if (max < best_max || (max == best_max && sum < best_sum))
+      {
+        best_phase = phase;
+        best_max = max;
+        best_sum = sum;
+      }
+    }
+    reserve(divider, best_phase, load);
+    return best_phase;
+  }
+
+  /// Adds the load of a phase chosen by the caller, e.g., a phase set manually.
+  void reserve(uint32_t divider, uint32_t phase, double load = 1.0) noexcept
+  {
+    add_load(divider, phase, load);
+  }
+
+  /// Removes the load of a phase returned by allocate() or reserved.
+  void release(uint32_t divider, uint32_t phase, double load = 1.0) noexcept
+  {
+    add_load(divider, phase, -load);
+  }
+
+  /// Returns the load allocated at the given cycle.
+  double get_load(uint64_t cycle) const noexcept
+  {
+    const std::size_t number_of_cycles = load_per_cycle_.size();
+    return number_of_cycles == 0u
+             ? 0.0
+             : load_per_cycle_[static_cast<std::size_t>(cycle % number_of_cycles)];
+  }
+
+  /// Returns the maximal load of all the cycles.
+  double get_max_load() const noexcept
+  {
+    return load_per_cycle_.empty()
+             ? 0.0
+             : *std::max_element(load_per_cycle_.begin(), load_per_cycle_.end());
+  }
+
+private:
+  void add_load(uint32_t divider, uint32_t phase, double load) noexcept
+  {
+    const std::size_t number_of_cycles = load_per_cycle_.size();
+    if (divider <= 1u || number_of_cycles % divider != 0u || phase >= divider)
+    {
+      return;
+    }
+    for (std::size_t cycle = phase; cycle < number_of_cycles; cycle += divider)
+    {
+      load_per_cycle_[cycle] = std::max(0.0, load_per_cycle_[cycle] + load);
+    }
+  }
+
+  std::vector<double> load_per_cycle_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__RATE_DIVIDER_HPP_
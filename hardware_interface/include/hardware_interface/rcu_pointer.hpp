@@ -0,0 +1,120 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__RCU_POINTER_HPP_
+#define HARDWARE_INTERFACE__RCU_POINTER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace hardware_interface
+{
+/// Owning pointer that is replaced by a writer while any number of real-time readers use it.
+/**
+ * The readers access the current object inside a ReadGuard, with a few atomic operations and
+ * without ever waiting. The writer publishes a new object prepared off-thread with a single atomic
+ * exchange, then waits until the readers that may still use the previous object left their guard,
+ * before destroying it (read-copy-update). The readers therefore never contend with the writer,
+ * only the writer waits.
+ *
+ * \note The guards have to be short-lived, e.g., for one call, a writer waits for all of them.
+ */
+template <class T>
+class RcuPointer
+{
+public:
+  /// Read-side critical section, the object stays valid until the guard is destroyed.
+  class ReadGuard
+  {
+  public:
+    ReadGuard(const ReadGuard &) = delete;
+    ReadGuard & operator=(const ReadGuard &) = delete;
+
+    ~ReadGuard() { readers_.fetch_sub(1u, std::memory_order_release); }
+
+    /// Returns the current object, nullptr if none was published.
+    T * get() const { return value_; }
+    T * operator->() const { return value_; }
+    explicit operator bool() const { return value_ != nullptr; }
+
+  private:
+    friend class RcuPointer;
+
+    ReadGuard(std::atomic<uint32_t> & readers, T * value) : readers_(readers), value_(value) {}
+
+    std::atomic<uint32_t> & readers_;
+    T * value_;
+  };
+
+  RcuPointer() = default;
+
+  explicit RcuPointer(std::unique_ptr<T> value) : current_(value.release()) {}
+
+  RcuPointer(const RcuPointer &) = delete;
+  RcuPointer & operator=(const RcuPointer &) = delete;
+
+  ~RcuPointer() { delete current_.load(std::memory_order_acquire); }
+
+  /// Enters a read-side critical section.
+  /**
+   * \note This method is real-time safe and lock-free.
+   */
+  ReadGuard read() const noexcept
+  {
+    while (true)
+    {
+      const uint32_t epoch = epoch_.load(std::memory_order_seq_cst);
+      auto & readers = readers_[epoch & 1u];
+      readers.fetch_add(1u, std::memory_order_seq_cst);
+      // a writer that changed the phase in between may not wait for this counter
+      if (epoch_.load(std::memory_order_seq_cst) == epoch)
+      {
+        return ReadGuard(readers, current_.load(std::memory_order_seq_cst));
+      }
+      readers.fetch_sub(1u, std::memory_order_release);
+    }
+  }
+
+  /// Publishes a new object and destroys the previous one once no reader uses it anymore.
+  /**
+   * \param[in] value new object, can be nullptr.
+   * \note This method is not real-time safe, it waits for the readers of the previous object.
+   */
+  void update(std::unique_ptr<T> value)
+  {
+    std::lock_guard<std::mutex> guard(writer_mutex_);
+    std::unique_ptr<T> previous(current_.exchange(value.release(), std::memory_order_seq_cst));
+    const uint32_t epoch = epoch_.fetch_add(1u, std::memory_order_seq_cst);
+    while (readers_[epoch & 1u].load(std::memory_order_seq_cst) != 0u)
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+  }
+
+private:
+  std::atomic<T *> current_{nullptr};
+  mutable std::atomic<uint32_t> epoch_{0u};
+  /// Number of readers that entered in the even and in the odd phases
+  mutable std::array<std::atomic<uint32_t>, 2> readers_{};
+  std::mutex writer_mutex_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__RCU_POINTER_HPP_
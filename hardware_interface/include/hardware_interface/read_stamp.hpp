@@ -0,0 +1,91 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__READ_STAMP_HPP_
+#define HARDWARE_INTERFACE__READ_STAMP_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+#include "rclcpp/time.hpp"
+
+namespace hardware_interface
+{
+/// Time and cycle of the last successful read of a hardware component.
+struct ReadStampData
+{
+  /// Time passed to the read of the hardware component.
+  rclcpp::Time time = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
+  /// Number of successful reads of the hardware component, 0 if it was never read.
+  uint64_t cycle = 0;
+};
+
+/// Stamp of the state interfaces of a hardware component, updated at every successful read.
+/**
+ * The ResourceManager stamps the component after its read, and the loaned state interfaces of the
+ * component share the stamp. A controller can so tell from which read cycle a state value comes
+ * and how old it is, e.g., for a component running asynchronously or at a lower rate.
+ *
+ * The stamp is published through a sequence lock: stamp() never blocks and get() never returns a
+ * time and a cycle of different reads.
+ */
+class ReadStamp
+{
+public:
+  /// Stamps a successful read of the component.
+  /**
+   * \note This method must be called from a single thread at a time, the thread reading the
+   * component.
+   */
+  void stamp(const rclcpp::Time & time)
+  {
+    const auto sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    time_ns_.store(time.nanoseconds(), std::memory_order_relaxed);
+    clock_type_.store(time.get_clock_type(), std::memory_order_relaxed);
+    cycle_.store(cycle_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  /// Returns the time and cycle of the last successful read.
+  ReadStampData get() const
+  {
+    while (true)
+    {
+      const auto sequence = sequence_.load(std::memory_order_acquire);
+      if (sequence % 2 == 0)
+      {
+        const auto time_ns = time_ns_.load(std::memory_order_relaxed);
+        const auto clock_type = clock_type_.load(std::memory_order_relaxed);
+        const auto cycle = cycle_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) == sequence)
+        {
+          return ReadStampData{rclcpp::Time(time_ns, clock_type), cycle};
+        }
+      }
+    }
+  }
+
+private:
+  std::atomic<uint64_t> sequence_{0};
+  std::atomic<int64_t> time_ns_{0};
+  std::atomic<rcl_clock_type_t> clock_type_{RCL_CLOCK_UNINITIALIZED};
+  std::atomic<uint64_t> cycle_{0};
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__READ_STAMP_HPP_
@@ -0,0 +1,77 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__REALTIME_THREAD_HPP_
+#define HARDWARE_INTERFACE__REALTIME_THREAD_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/logger.hpp"
+
+namespace hardware_interface
+{
+/// Setup of a thread created by ros2_control
+struct RealtimeThreadParams
+{
+  /// Name of the thread, shown by top and the debuggers, truncated to 15 characters on Linux
+  std::string name = "";
+  /// SCHED_FIFO priority of the thread, the scheduling policy is not changed if 0 or less
+  int thread_priority = 0;
+  /// CPU cores the thread is pinned to, the affinity is not changed if empty
+  std::vector<int> cpu_affinity_cores = {};
+  /// Bytes of the stack that are written once, so that they don't page-fault later
+  std::size_t stack_prefault_size = 0;
+};
+
+/// Sets the name of the calling thread.
+void set_current_thread_name(const std::string & name);
+
+/// Writes the next bytes of the stack of the calling thread, so that they are mapped.
+/**
+ * Together with mlockall(MCL_CURRENT | MCL_FUTURE), e.g., with the lock_memory option of the
+ * ros2_control_node, the pages stay mapped and a deep call in the real-time loop doesn't
+ * page-fault. The size is limited to the stack size of the thread, minus a safety margin.
+ *
+ * \param[in] size bytes of the stack to write.
+ */
+void prefault_current_thread_stack(std::size_t size);
+
+/// Applies the name, the CPU affinity, the scheduling and the stack prefaulting to the thread.
+/**
+ * \param[in] params setup of the thread.
+ * \param[in] logger logger of the warnings if the affinity or the scheduling can't be set.
+ * \return false if the affinity or the scheduling can't be set.
+ */
+bool configure_current_thread(const RealtimeThreadParams & params, const rclcpp::Logger & logger);
+
+/// Same as configure_current_thread, but only at the first call on the calling thread.
+/**
+ * Meant for the threads that are not created by ros2_control but run its callbacks, e.g., the
+ * threads of realtime_tools::AsyncFunctionHandler, which are then set up at their first cycle.
+ */
+void configure_current_thread_once(
+  const RealtimeThreadParams & params, const rclcpp::Logger & logger);
+
+/// Creates a thread that is set up with configure_current_thread before running the function.
+std::thread create_realtime_thread(
+  const RealtimeThreadParams & params, const rclcpp::Logger & logger,
+  std::function<void()> function);
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__REALTIME_THREAD_HPP_
@@ -15,21 +15,34 @@
 #ifndef HARDWARE_INTERFACE__RESOURCE_MANAGER_HPP_
 #define HARDWARE_INTERFACE__RESOURCE_MANAGER_HPP_
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "hardware_interface/actuator.hpp"
+#include "hardware_interface/cycle_context.hpp"
+#include "hardware_interface/edge_event_queue.hpp"
+#include "hardware_interface/failed_hardware_components.hpp"
 #include "hardware_interface/hardware_component_info.hpp"
+#include "hardware_interface/hardware_dependency_index.hpp"
 #include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/instrumented_mutex.hpp"
+#include "hardware_interface/interface_change_tracker.hpp"
+#include "hardware_interface/joint_limits_store.hpp"
 #include "hardware_interface/loaned_command_interface.hpp"
 #include "hardware_interface/loaned_state_interface.hpp"
+#include "hardware_interface/rcu_pointer.hpp"
 #include "hardware_interface/sensor.hpp"
 #include "hardware_interface/system.hpp"
 #include "hardware_interface/system_interface.hpp"
+#include "hardware_interface/transmission_stage_interface.hpp"
 #include "hardware_interface/types/hardware_interface_return_values.hpp"
 #include "hardware_interface/types/resource_manager_params.hpp"
+#include "hardware_interface/udp_interface_link.hpp"
 #include "rclcpp/duration.hpp"
 #include "rclcpp/executor.hpp"
 #include "rclcpp/node_interfaces/node_logging_interface.hpp"
@@ -43,7 +56,27 @@ class ControllerManager;
 struct HardwareReadWriteStatus
 {
   return_type result;
-  std::vector<std::string> failed_hardware_names;
+  /// Failed hardware components, iterable as their names.
+  FailedHardwareComponents failed_hardware_names;
+};
+
+/// Differences between the loaded hardware components and the components of a robot description.
+struct RobotDescriptionDiff
+{
+  /// Parsed hardware descriptions of the new robot description.
+  std::vector<HardwareInfo> hardware_info;
+  /// Components of the new description that are not loaded.
+  std::vector<std::string> added_components;
+  /// Loaded components that are not in the new description.
+  std::vector<std::string> removed_components;
+  /// Loaded components whose `<ros2_control>` tag differs in the new description.
+  std::vector<std::string> changed_components;
+
+  /// Returns true if no component has to be loaded, unloaded or reloaded.
+  bool empty() const
+  {
+    return added_components.empty() && removed_components.empty() && changed_components.empty();
+  }
 };
 
 class ResourceManager
@@ -136,10 +169,39 @@ public:
 
   /**
    * @brief Import joint limiters from the URDF.
+   * The limiters of the joints that were imported before are replaced, and the joints whose limits
+   * are not in the URDF anymore are not limited anymore.
    * @param urdf string containing the URDF.
    */
   void import_joint_limiters(const std::string & urdf);
 
+  /// Compares the components of a robot description with the loaded hardware components.
+  /**
+   * A loaded component is changed if its `<ros2_control>` tag differs from the loaded one, changes
+   * of the rest of the URDF, e.g., of the joint limits, don't change the components.
+   *
+   * \param[in] urdf string containing the new robot description.
+   * \returns the added, removed and changed components and the parsed new description.
+   * \throws std::runtime_error if the robot description cannot be parsed.
+   */
+  RobotDescriptionDiff diff_robot_description(const std::string & urdf) const;
+
+  /// Loads, unloads and reloads only the components that differ in a new robot description.
+  /**
+   * The removed and changed components are shut down and removed with their interfaces, then the
+   * added and changed components are loaded and initialized from the new description. The other
+   * components keep their state and keep running. The joint limits are updated separately with
+   * import_joint_limiters().
+   *
+   * \param[in] diff differences returned by diff_robot_description().
+   * \param[in] params parameters of the components, with the new robot description.
+   * \returns false if a command interface of a removed or changed component is claimed, nothing is
+   * changed then, or if a component failed to be loaded or initialized, it is then not loaded.
+   * \note The removed and changed components must not be used by any controller.
+   */
+  bool reload_components(
+    const RobotDescriptionDiff & diff, const hardware_interface::ResourceManagerParams & params);
+
   /**
    * @brief if the resource manager load_and_initialize_components(...) function has been called
    * this returns true. We want to permit to loading the urdf later on, but we currently don't want
@@ -168,6 +230,16 @@ public:
    */
   std::vector<std::string> state_interface_keys() const;
 
+  /// Returns the state interfaces keys of the components of a resource namespace.
+  /**
+   * The components of the sub-namespaces are included, e.g., those of "cell_1/arm" for "cell_1".
+   * The cost depends on the number of interfaces of the namespace only.
+   * \param[in] resource_namespace namespace of the components, see
+   * HardwareInfo::resource_namespace.
+   * \return Vector of strings, containing the keys of the namespace in the order of the components.
+   */
+  std::vector<std::string> state_interface_keys(const std::string & resource_namespace) const;
+
   /// Returns all available state interfaces keys.
   /**
    * The keys are collected from the available list.
@@ -189,6 +261,17 @@ public:
    */
   std::string get_state_interface_data_type(const std::string & name) const;
 
+  /// Creates a tracker of the changes of the values of state interfaces.
+  /**
+   * The publishers of the state values, e.g., the broadcasters, can use it to iterate only over the
+   * state interfaces whose value changed since their previous cycle.
+   * \param[in] names names of the state interfaces, the tracker reports them by their index.
+   * \return tracker of the state interfaces.
+   * \throws std::runtime_error if a state interface does not exist.
+   */
+  InterfaceChangeTracker make_state_interface_change_tracker(
+    const std::vector<std::string> & names) const;
+
   /// Add controllers' exported state interfaces to resource manager.
   /**
    * Interface for transferring management of exported state interfaces to resource manager.
@@ -300,12 +383,36 @@ public:
    * Find mapping between controller and hardware based on interfaces controller with
    * \p controller_name is using and cache those for later usage.
    *
+   * The interfaces are matched with both the command and the state interfaces of the hardware,
+   * so that the controller is deactivated on a DEACTIVATE of any hardware exporting a command
+   * interface of the same name. Prefer the overload separating the command interfaces.
+   *
    * \param[in] controller_name name of the controller which interfaces are provided.
    * \param[in] interfaces list of interfaces controller with \p controller_name is using.
    */
   void cache_controller_to_hardware(
     const std::string & controller_name, const std::vector<std::string> & interfaces);
 
+  /// Cache mapping between hardware and controllers using it
+  /**
+   * The interfaces are added to the ones cached before for the controller. Only the hardware
+   * exporting the command interfaces lists the controller in its command controllers, see
+   * HardwareDependencyIndex::get_command_controllers_of_component().
+   *
+   * \param[in] controller_name name of the controller which interfaces are provided.
+   * \param[in] command_interfaces command interfaces claimed by the controller.
+   * \param[in] state_interfaces state interfaces used by the controller.
+   */
+  void cache_controller_to_hardware(
+    const std::string & controller_name, const std::vector<std::string> & command_interfaces,
+    const std::vector<std::string> & state_interfaces);
+
+  /// Remove a controller from the cached mapping between hardware and controllers.
+  /**
+   * \param[in] controller_name name of the controller, e.g., when it is unloaded.
+   */
+  void remove_cached_controller_to_hardware(const std::string & controller_name);
+
   /// Return cached controllers for a specific hardware.
   /**
    * Return list of cached controller names that use the hardware with name \p hardware_name.
@@ -316,6 +423,31 @@ public:
    */
   std::vector<std::string> get_cached_controllers_to_hardware(const std::string & hardware_name);
 
+  using HardwareDependencies = RcuPointer<const HardwareDependencyIndex>::ReadGuard;
+
+  /// Return the cached dependencies between the hardware components and the controllers.
+  /**
+   * The controllers of the components are resolved when the components are loaded and when the
+   * controllers are cached, so that the controllers using the failed components of a read or
+   * write cycle can be found in the real-time loop without allocating memory or comparing names.
+   * The components are numbered as in get_hardware_component_index().
+   *
+   * \note This method is real-time safe and lock-free. The index is valid until the returned
+   * guard is destroyed, which has to be short-lived, as the cache updates wait for it.
+   */
+  HardwareDependencies get_hardware_dependencies() const;
+
+  /// Return the index of a loaded hardware component.
+  /**
+   * The indices number the actuators, the sensors and then the systems, and are the ones reported
+   * in the failed_hardware_names of the read and write cycles. They change when the components are
+   * loaded or unloaded.
+   *
+   * \param[in] hardware_name name of the hardware component.
+   * \returns the index of the component, std::nullopt if the component is not loaded.
+   */
+  std::optional<std::size_t> get_hardware_component_index(const std::string & hardware_name) const;
+
   /// Checks whether a command interface is already claimed.
   /**
    * Any command interface can only be claimed by a single instance.
@@ -327,6 +459,15 @@ public:
    */
   bool command_interface_is_claimed(const std::string & key) const;
 
+  /// Returns the version of the interfaces, their availability and their claimed state.
+  /**
+   * The version changes whenever an interface is added or removed, made available or unavailable,
+   * claimed or released, e.g., to rebuild a cached list of the interfaces only when it changed.
+   * \note This method is lock-free.
+   * \return the version, never decreasing.
+   */
+  uint64_t get_interfaces_version() const;
+
   /// Claim a command interface given its key.
   /**
    * The resource is claimed as long as being in scope.
@@ -338,6 +479,19 @@ public:
    */
   LoanedCommandInterface claim_command_interface(const std::string & key);
 
+  /// Creates detached copies of command interfaces, without claiming them.
+  /**
+   * The commands written to the copies never reach the hardware, so the command interfaces can be
+   * claimed by another controller at the same time, see
+   * CommandInterface::make_detached_copy().
+   *
+   * \param[in] keys identifiers of the command interfaces to copy
+   * \return the copies, in the order of \p keys
+   * \throws std::runtime_error if a command interface doesn't exist or isn't available.
+   */
+  std::vector<CommandInterface::SharedPtr> make_detached_command_interfaces(
+    const std::vector<std::string> & keys) const;
+
   /// Returns all registered command interfaces keys.
   /**
    * The keys are collected from each loaded hardware component.
@@ -345,6 +499,18 @@ public:
    */
   std::vector<std::string> command_interface_keys() const;
 
+  /// Returns the command interfaces keys of the components of a resource namespace.
+  /**
+   * \param[in] resource_namespace namespace of the components, see
+   * HardwareInfo::resource_namespace.
+   * \return vector of strings, containing the keys of the namespace, see
+   * state_interface_keys(const std::string &).
+   */
+  std::vector<std::string> command_interface_keys(const std::string & resource_namespace) const;
+
+  /// Returns the resource namespaces of the loaded components, sorted.
+  std::vector<std::string> get_resource_namespaces() const;
+
   /// Returns all available command interfaces keys.
   /**
    * The keys are collected from the available list.
@@ -367,6 +533,15 @@ public:
    */
   std::string get_command_interface_data_type(const std::string & name) const;
 
+  /// Creates a tracker of the changes of the values of command interfaces.
+  /**
+   * \param[in] names names of the command interfaces, the tracker reports them by their index.
+   * \return tracker of the command interfaces.
+   * \throws std::runtime_error if a command interface does not exist.
+   */
+  InterfaceChangeTracker make_command_interface_change_tracker(
+    const std::vector<std::string> & names) const;
+
   /// Return the number size_t of loaded actuator components.
   /**
    * \return number of actuator components.
@@ -441,6 +616,32 @@ public:
    */
   const std::unordered_map<std::string, HardwareComponentInfo> & get_components_status();
 
+  /// Return the cycle trigger of a hardware component.
+  /**
+   * \param[in] component_name name of the hardware component.
+   * \return cycle trigger of the component, nullptr if the component doesn't exist.
+   */
+  std::shared_ptr<CycleTrigger> get_cycle_trigger(const std::string & component_name) const;
+
+  /// Return the execution time statistics of the transmission stage.
+  /**
+   * \return statistics of the transmission stage, nullptr if the stage is not enabled.
+   */
+  std::shared_ptr<const TransmissionStageStatistics> get_transmission_stage_statistics() const;
+
+  /// Return the contention of the locks of the resource manager.
+  /**
+   * The read() and write() of the control loop skip their cycle when the `resources` lock, or the
+   * lock of a component, is held by another thread, see the `skipped_cycles` statistics of the
+   * components.
+   *
+   * \return statistics of the `resources`, `resource_interfaces`, `claimed_command_interfaces` and
+   * `joint_limiters` locks, by name.
+   * \note This method is thread-safe and doesn't take the locks.
+   */
+  std::vector<std::pair<std::string, LockContentionStatistics>> get_lock_contention_statistics()
+    const;
+
   /// Return the unordered map of hard joint limits.
   /**
    * \return unordered map of hard joint limits.
@@ -454,6 +655,52 @@ public:
   const std::unordered_map<std::string, joint_limits::SoftJointLimits> & get_soft_joint_limits()
     const;
 
+  /// Return the store of the hard and soft joint limits shared with the controllers.
+  /**
+   * The store is updated whenever the joint limits are imported from a robot description.
+   * \return store of the joint limits, never nullptr.
+   */
+  std::shared_ptr<const JointLimitsStore> get_joint_limits_store() const;
+
+  /// Return the list of the edge events of the hardware components shared with the controllers.
+  /**
+   * The list is filled at every read() with the events pushed by the components since the
+   * previous read, see HardwareComponentInterface::push_edge_event().
+   * \return list of the edge events of the last read cycle, never nullptr.
+   */
+  std::shared_ptr<const EdgeEventList> get_edge_events() const;
+
+  /// Sets the decimation of the read and write cycles of the auxiliary hardware components.
+  /**
+   * Used by the overload governor of the controller manager to shed the load of the components
+   * whose criticality is auxiliary, see hardware_interface::OverloadGovernor.
+   *
+   * \param[in] decimation 1 to read and write them at their rate, N to only read and write them
+   * every N cycles, OverloadGovernor::PAUSED to stop reading and writing them.
+   * \note This method is real-time safe.
+   */
+  void set_auxiliary_decimation(uint32_t decimation);
+
+  /// Returns the decimation set with set_auxiliary_decimation().
+  uint32_t get_auxiliary_decimation() const;
+
+  /// Sets which state and command interfaces are registered for introspection.
+  /**
+   * Only the interfaces whose name matches one of the patterns are registered, in which `*`
+   * matches any sequence of characters and `?` any single character, e.g., `joint1/*` or
+   * `*/effort`. The registered interfaces that don't match anymore are unregistered, so that the
+   * introspection only samples and publishes the interfaces that are watched. The interfaces
+   * loaded later are registered if they match.
+   *
+   * \param[in] patterns patterns of the interface names, `{"*"}` for all and `{}` for none.
+   */
+  void set_introspected_interfaces(const std::vector<std::string> & patterns);
+
+  /// Returns the names of the state interfaces and of the command interfaces registered for
+  /// introspection, sorted.
+  std::pair<std::vector<std::string>, std::vector<std::string>> get_introspected_interfaces()
+    const;
+
   /// Prepare the hardware components for a new command interface mode
   /**
    * Hardware components are asked to prepare a new command interface claim.
@@ -508,6 +755,62 @@ public:
   return_type set_component_state(
     const std::string & component_name, rclcpp_lifecycle::State & target_state);
 
+  /// Sets the state of several hardware components.
+  /**
+   * Takes care of all transitions needed to reach the target state, as set_component_state.
+   * The components of different groups, or without group, are set concurrently by up to
+   * component_initialization_threads threads, the components of the same group one after the
+   * other in order. The available interfaces are updated once all the components are set.
+   *
+   * The method is not part of the real-time critical update loop.
+   *
+   * \param[in] component_names names of the components to change state, each listed once.
+   * \param[in] target_state target state to set for all the hardware components.
+   * \return for each component, hardware_interface::return_type::OK if it successfully switched
+   *         its state and hardware_interface::return_type::ERROR if it is unknown or any of its
+   *         state transitions has failed.
+   */
+  std::vector<return_type> set_components_state(
+    const std::vector<std::string> & component_names, rclcpp_lifecycle::State & target_state);
+
+  /// Runs the transitions of the hardware components requested by read() and write().
+  /**
+   * With ResourceManagerParams::defer_control_loop_transitions, a component failing its read or
+   * write, or returning DEACTIVATE from its write, only requests its transition in the control
+   * loop, see HardwareComponent::request_transition, and its interfaces are made unavailable at
+   * once in case of an error. The transitions are then run by this method, called by a thread of
+   * the resource manager: the on_error of the failed components, and the deactivation of the
+   * others as with set_component_state.
+   *
+   * The method is not part of the real-time critical update loop.
+   *
+   * \return number of transitions run.
+   */
+  std::size_t run_requested_transitions();
+
+  /// Runs the due attempts to recover the hardware components after their error transition.
+  /**
+   * A component with a recovery in its description, see HardwareRecoveryParams, defers its
+   * transitions out of the control loop, and once its on_error returned SUCCESS, the thread
+   * running run_requested_transitions() calls this method to activate it again, as with
+   * set_component_state. A failed attempt is retried after an exponential backoff, up to
+   * HardwareRecoveryParams::max_attempts, and the interfaces of the component become available
+   * again in one step once it is active.
+   *
+   * The method is not part of the real-time critical update loop.
+   *
+   * \return number of components recovered.
+   */
+  std::size_t run_component_recoveries();
+
+  /// A method to register a callback to be called when a hardware component has been recovered.
+  /**
+   * \param[in] callback function called with the name of the component and its
+   * HardwareRecoveryParams::restore_controllers, from the thread running the recoveries.
+   */
+  void set_on_component_recovered_callback(
+    std::function<void(const std::string &, bool)> callback);
+
   /**
    * Enforce the command limits for the position, velocity, effort, and acceleration interfaces.
    * @note This method is RT-safe
@@ -522,8 +825,19 @@ public:
    *
    * Part of the real-time critical update loop.
    * It is realtime-safe if used hardware interfaces are implemented adequately.
+   *
+   * \returns the status of the read cycle, valid until the next read or write cycle.
    */
-  HardwareReadWriteStatus read(const rclcpp::Time & time, const rclcpp::Duration & period);
+  const HardwareReadWriteStatus & read(const rclcpp::Time & time, const rclcpp::Duration & period);
+
+  /// Reads all loaded hardware components in the control cycle \p cycle.
+  /**
+   * Like read(const rclcpp::Time &, const rclcpp::Duration &), with the trigger time and the
+   * period of the cycle instead of a new sample of the clock.
+   *
+   * Part of the real-time critical update loop.
+   */
+  const HardwareReadWriteStatus & read(const CycleContext & cycle);
 
   /// Write all loaded hardware components.
   /**
@@ -531,8 +845,39 @@ public:
    *
    * Part of the real-time critical update loop.
    * It is realtime-safe if used hardware interfaces are implemented adequately.
+   *
+   * \returns the status of the write cycle, valid until the next read or write cycle.
+   */
+  const HardwareReadWriteStatus & write(
+    const rclcpp::Time & time, const rclcpp::Duration & period);
+
+  /// Write all loaded hardware components in the control cycle \p cycle.
+  /**
+   * Like write(const rclcpp::Time &, const rclcpp::Duration &), with the trigger time and the
+   * period of the cycle instead of a new sample of the clock.
+   *
+   * Part of the real-time critical update loop.
+   */
+  const HardwareReadWriteStatus & write(const CycleContext & cycle);
+
+  /// Sets the NUMA node of the real-time thread, where the memory of the read and write cycles is
+  /// placed.
+  /**
+   * The memory the real-time thread is already using is not moved. The interface value arenas are
+   * moved to \p node when they are allocated, and the interface handles of a component before its
+   * activation, see NumaMemory.
+   *
+   * \param[in] node NUMA node of the real-time thread, -1 if it is unknown.
+   * \note This method is not real-time safe.
+   */
+  void set_realtime_numa_node(int node);
+
+  /// Returns the statistics of the link of the remote interface export.
+  /**
+   * The statistics are reset when the export is configured, and stay at zero while it is
+   * disabled, see ResourceManagerParams::remote_interface_export.
    */
-  HardwareReadWriteStatus write(const rclcpp::Time & time, const rclcpp::Duration & period);
+  const UdpInterfaceLinkStatistics & get_remote_interface_export_statistics() const;
 
   /// Checks whether a command interface is registered under the given key.
   /**
@@ -572,10 +917,10 @@ protected:
   bool allow_controller_activation_with_inactive_hardware_ = false;
   bool return_failed_hardware_names_on_return_deactivate_write_cycle_ = true;
 
-  mutable std::recursive_mutex resource_interfaces_lock_;
-  mutable std::recursive_mutex claimed_command_interfaces_lock_;
-  mutable std::recursive_mutex resources_lock_;
-  mutable std::recursive_mutex joint_limiters_lock_;
+  mutable InstrumentedRecursiveMutex resource_interfaces_lock_;
+  mutable InstrumentedRecursiveMutex claimed_command_interfaces_lock_;
+  mutable InstrumentedRecursiveMutex resources_lock_;
+  mutable InstrumentedRecursiveMutex joint_limiters_lock_;
 
 private:
   bool validate_storage(const std::vector<hardware_interface::HardwareInfo> & hardware_info) const;
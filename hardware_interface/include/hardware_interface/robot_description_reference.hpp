@@ -0,0 +1,68 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__ROBOT_DESCRIPTION_REFERENCE_HPP_
+#define HARDWARE_INTERFACE__ROBOT_DESCRIPTION_REFERENCE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace hardware_interface
+{
+/// Reference to a robot description stored outside of the message carrying it.
+/**
+ * A reference is `file://<path>` for a file, or `shm://<name>` for a POSIX shared-memory segment
+ * holding the description, e.g., `shm:///robot_description`. It can be followed by
+ * `#<hash>`, the 64-bit FNV-1a hash of the description in hexadecimal, see
+ * HardwareInfoCache::hash, so that a description whose hash is the one of the loaded description
+ * doesn't need to be mapped at all.
+ */
+struct RobotDescriptionReference
+{
+  enum class Kind
+  {
+    FILE,
+    SHARED_MEMORY
+  };
+
+  Kind kind = Kind::FILE;
+  /// Path of the file, or name of the shared-memory segment.
+  std::string location;
+  std::optional<uint64_t> hash;
+
+  /// Parses a reference from the data of a robot description message.
+  /**
+   * \returns std::nullopt if \p data is not a reference, i.e., it's the description itself.
+   * \throws std::runtime_error if \p data starts like a reference but is malformed.
+   */
+  static std::optional<RobotDescriptionReference> parse(const std::string & data);
+
+  /// Maps the referenced description read-only and returns its content.
+  /**
+   * The description is copied out of the mapping once, and the returned string is meant to be
+   * shared by the users of the description instead of being copied again.
+   * \throws std::runtime_error if the description can't be mapped, or if its hash is not the
+   * expected one, e.g., because the file is being rewritten.
+   */
+  std::shared_ptr<const std::string> read() const;
+
+  /// Returns the reference as it's written in a message.
+  std::string to_string() const;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__ROBOT_DESCRIPTION_REFERENCE_HPP_
@@ -0,0 +1,171 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__RT_WORKER_POOL_HPP_
+#define HARDWARE_INTERFACE__RT_WORKER_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/logger.hpp"
+
+namespace hardware_interface
+{
+/// Parameters of a dedicated worker thread of the RTWorkerPool
+struct RTDedicatedWorkerParams
+{
+  /// SCHED_FIFO priority of the worker thread
+  int thread_priority = 50;
+  /// CPU cores the worker thread is pinned to, empty to not change the affinity
+  std::vector<int> cpu_affinity_cores = {};
+  /// Name of the worker thread, used for logging
+  std::string name = "rt_dedicated_worker";
+};
+
+/// Parameters of the RTWorkerPool
+struct RTWorkerPoolParams
+{
+  /// Number of worker threads spawned in addition to the calling thread, 0 disables the pool
+  unsigned int number_of_workers = 0;
+  /// SCHED_FIFO priority of the worker threads
+  int thread_priority = 50;
+  /// CPU cores the worker threads are pinned to, empty to not change the affinity
+  std::vector<int> cpu_affinity_cores = {};
+  /// Name prefix of the worker threads, used for logging
+  std::string name = "rt_worker";
+  /// Worker threads executing only the tasks assigned to them in parallel_for(), e.g., to run a
+  /// task on the core handling the interrupts of its device
+  std::vector<RTDedicatedWorkerParams> dedicated_workers = {};
+  /// Bytes of the stack of every worker thread prefaulted at its start, see RealtimeThreadParams
+  std::size_t stack_prefault_size = 0;
+};
+
+/// Pool of pre-spawned real-time worker threads executing fork-join parallel loops.
+/**
+ * The worker threads are spawned once at construction with create_realtime_thread(), configured
+ * with the SCHED_FIFO priority, CPU affinity and stack prefaulting from the parameters, and sleep
+ * until parallel_for() publishes new work. The calling thread takes part in the execution and
+ * parallel_for() returns only once all the tasks are finished, so the pool can be used inside a
+ * synchronous control cycle.
+ *
+ * The dedicated worker threads only execute the tasks assigned to them, so that a task always runs
+ * with the same priority and on the same cores, and the other tasks run on the shared worker
+ * threads and the calling thread.
+ */
+class RTWorkerPool
+{
+public:
+  explicit RTWorkerPool(
+    const RTWorkerPoolParams & params, rclcpp::Logger logger = rclcpp::get_logger("rt_worker_pool"));
+
+  ~RTWorkerPool();
+
+  RTWorkerPool(const RTWorkerPool &) = delete;
+  RTWorkerPool & operator=(const RTWorkerPool &) = delete;
+
+  /// Executes task(i) for every i in [0, number_of_tasks) and waits for all of them to finish.
+  /**
+   * The tasks are distributed dynamically over the worker threads and the calling thread. If a
+   * task throws, the remaining tasks are still executed and the first exception is rethrown in the
+   * calling thread.
+   *
+   * \param[in] number_of_tasks number of tasks to execute.
+   * \param[in] task callable invoked with the index of the task.
+   * \note This method is real-time safe, it doesn't allocate memory.
+   * \note If another parallel_for() of the pool is running, e.g., when called from a task of the
+   * pool or by another thread, the tasks are executed sequentially by the calling thread.
+   */
+  void parallel_for(std::size_t number_of_tasks, const std::function<void(std::size_t)> & task);
+
+  /// Executes task(i) for every i in [0, number_of_tasks), on the dedicated worker task_workers[i].
+  /**
+   * As parallel_for() without the assignments, the tasks assigned to -1 or to an index beyond the
+   * dedicated workers are distributed over the shared worker threads and the calling thread. If
+   * the pool is busy, all the tasks are executed sequentially by the calling thread.
+   *
+   * \param[in] task_workers index of the dedicated worker of every task, at least
+   * \p number_of_tasks entries.
+   */
+  void parallel_for(
+    std::size_t number_of_tasks, const std::function<void(std::size_t)> & task,
+    const std::vector<int> & task_workers);
+
+  /// Executes task(i) as parallel_for(), unless another parallel_for() of the pool is running.
+  /**
+   * Lets several threads share the pool, e.g., the controllers updated in parallel or a task of
+   * the pool itself: a caller finding the pool busy can execute its tasks by itself instead of
+   * waiting for the pool.
+   *
+   * \returns false if the pool is busy, the tasks aren't executed then.
+   * \note This method is real-time safe, it doesn't allocate memory or block on another caller.
+   */
+  bool try_parallel_for(std::size_t number_of_tasks, const std::function<void(std::size_t)> & task);
+
+  /// Returns the number of worker threads, excluding the calling thread.
+  std::size_t get_number_of_workers() const { return workers_.size(); }
+
+  /// Returns the number of dedicated worker threads.
+  std::size_t get_number_of_dedicated_workers() const { return dedicated_workers_.size(); }
+
+private:
+  void worker_loop(int dedicated_worker_index);
+
+  void run(
+    std::size_t number_of_tasks, const std::function<void(std::size_t)> & task,
+    const std::vector<int> * task_workers);
+
+  /// Returns true if the task runs on a dedicated worker.
+  bool is_dedicated_task(std::size_t task_index) const;
+
+  /// Executes the shared tasks of the current job until none is left.
+  void execute_tasks();
+
+  /// Executes the tasks of the current job assigned to the dedicated worker.
+  void execute_dedicated_tasks(int dedicated_worker_index);
+
+  void execute_task(std::size_t task_index);
+
+  rclcpp::Logger logger_;
+  std::vector<std::thread> workers_;
+  std::vector<std::thread> dedicated_workers_;
+
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  /// Incremented for every job, the workers wait for it to change
+  std::size_t generation_ = 0;
+  bool stop_ = false;
+  /// Number of workers that still have to finish the current job
+  std::size_t active_workers_ = 0;
+
+  const std::function<void(std::size_t)> * task_ = nullptr;
+  std::size_t number_of_tasks_ = 0;
+  const std::vector<int> * task_workers_ = nullptr;
+  std::atomic<std::size_t> next_task_{0};
+  /// Set while a job is running, taken by every parallel loop before it publishes its job
+  std::atomic<bool> busy_{false};
+  std::exception_ptr exception_ = nullptr;
+  std::mutex exception_mutex_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__RT_WORKER_POOL_HPP_
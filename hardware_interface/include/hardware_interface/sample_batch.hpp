@@ -0,0 +1,137 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__SAMPLE_BATCH_HPP_
+#define HARDWARE_INTERFACE__SAMPLE_BATCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hardware_interface
+{
+/// View of the timestamped samples of a sample batch interface, see Handle::read_samples().
+/**
+ * The values and the time stamps are contiguous, the oldest sample first, so that they can be
+ * filtered with vectorized loops.
+ */
+template <typename T>
+class SampleBatch
+{
+public:
+  SampleBatch(
+    const T * values, const int64_t * stamps, std::size_t size, uint64_t dropped_samples)
+  : values_(values), stamps_(stamps), size_(size), dropped_samples_(dropped_samples)
+  {
+  }
+
+  std::size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  /// Values of the samples
+  const T * values() const { return values_; }
+
+  /// Time stamps of the samples in nanoseconds, in the clock of the hardware component
+  const int64_t * stamps() const { return stamps_; }
+
+  const T & value(std::size_t index) const { return values_[index]; }
+
+  int64_t stamp(std::size_t index) const { return stamps_[index]; }
+
+  /// Number of samples of the batch overwritten because more samples than its capacity were added
+  uint64_t get_dropped_samples() const { return dropped_samples_; }
+
+  const T * begin() const { return values_; }
+
+  const T * end() const { return values_ + size_; }
+
+private:
+  const T * values_;
+  const int64_t * stamps_;
+  std::size_t size_;
+  uint64_t dropped_samples_;
+};
+
+/// Fixed-capacity ring of the timestamped samples of a batch, e.g., of one control cycle.
+/**
+ * When the ring is full, a new sample overwrites the oldest one. Every sample is stored twice, at
+ * the indices i and i + capacity, so that the stored samples are always contiguous and are read
+ * as a SampleBatch without being copied or rotated.
+ *
+ * \note The ring is not thread-safe and doesn't allocate memory after its construction.
+ */
+template <typename T>
+class SampleRing
+{
+public:
+  SampleRing(std::size_t capacity, T initial_value)
+  : capacity_(capacity), values_(2 * capacity, initial_value), stamps_(2 * capacity, 0)
+  {
+  }
+
+  std::size_t capacity() const { return capacity_; }
+
+  std::size_t size() const { return size_; }
+
+  /// Removes all the samples, e.g., to start the batch of a new cycle.
+  void clear()
+  {
+    head_ = 0;
+    size_ = 0;
+    dropped_samples_ = 0;
+  }
+
+  /// Adds a sample, overwriting the oldest one if the ring is full.
+  void push(T value, int64_t stamp)
+  {
+    if (capacity_ == 0)
+    {
+      ++dropped_samples_;
+      return;
+    }
+    const std::size_t index = (head_ + size_) % capacity_;
+    values_[index] = value;
+    values_[index + capacity_] = value;
+    stamps_[index] = stamp;
+    stamps_[index + capacity_] = stamp;
+    if (size_ < capacity_)
+    {
+      ++size_;
+    }
+    else
+    {
+      head_ = (head_ + 1) % capacity_;
+      ++dropped_samples_;
+    }
+  }
+
+  /// Returns the stored samples, the oldest first.
+  SampleBatch<T> get_batch() const
+  {
+    return SampleBatch<T>(values_.data() + head_, stamps_.data() + head_, size_, dropped_samples_);
+  }
+
+private:
+  std::size_t capacity_;
+  std::vector<T> values_;
+  std::vector<int64_t> stamps_;
+  std::size_t head_ = 0;
+  std::size_t size_ = 0;
+  uint64_t dropped_samples_ = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__SAMPLE_BATCH_HPP_
@@ -0,0 +1,188 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__SHARED_MEMORY_BRIDGE_HPP_
+#define HARDWARE_INTERFACE__SHARED_MEMORY_BRIDGE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/shared_memory_interface_export.hpp"
+
+namespace hardware_interface
+{
+namespace shared_memory
+{
+/// "R2CB" in little endian
+constexpr uint32_t BRIDGE_MAGIC = 0x42433252;
+constexpr uint32_t BRIDGE_VERSION = 1;
+
+/// Values exchanged in one direction, published by a single writer under a sequence lock.
+struct alignas(64) SharedMemoryBridgeChannel
+{
+  /// Odd while the writer modifies the values
+  std::atomic<uint32_t> sequence;
+  /// Number of published frames, the readers wait on it with a futex
+  std::atomic<uint32_t> frame;
+  /// Time given by the writer to the last frame, in nanoseconds
+  std::atomic<int64_t> stamp_ns;
+};
+
+struct SharedMemoryBridgeHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  /// Total size of the segment in bytes
+  uint64_t size;
+  uint32_t number_of_state_interfaces;
+  uint32_t number_of_command_interfaces;
+  /// Offsets from the beginning of the segment
+  uint64_t descriptors_offset;
+  uint64_t names_offset;
+  uint64_t state_values_offset;
+  uint64_t command_values_offset;
+  std::atomic<uint32_t> state;
+  /// States written by the driver process
+  SharedMemoryBridgeChannel states;
+  /// Commands written by the hardware component
+  SharedMemoryBridgeChannel commands;
+};
+}  // namespace shared_memory
+
+/// Exchanges the state and command values of a hardware component with a driver process.
+/**
+ * The hardware component creates the segment with create() and the driver process attaches to it
+ * with open(). Each side publishes its values with a wait-free write under the sequence lock of
+ * its channel, then wakes the other side through a futex on the frame counter of the channel. The
+ * other side can wait for a new frame with a timeout, to give deterministic deadlines to the
+ * exchange, or just copy the latest frame.
+ *
+ * The segment reuses the interface descriptors of the shared-memory interface export, the
+ * state interfaces first.
+ *
+ * \note The bridge is only available on POSIX systems, the futex handoff only on Linux. On other
+ * POSIX systems the waits poll the frame counter.
+ */
+class SharedMemoryBridge
+{
+public:
+  SharedMemoryBridge() = default;
+
+  ~SharedMemoryBridge();
+
+  SharedMemoryBridge(const SharedMemoryBridge &) = delete;
+  SharedMemoryBridge & operator=(const SharedMemoryBridge &) = delete;
+
+  /// Creates the segment, replacing an existing segment with the same name.
+  /**
+   * \param[in] segment_name name of the segment, starting with a slash.
+   * \param[in] state_interface_names names of the state interfaces written by the driver.
+   * \param[in] command_interface_names names of the command interfaces written by the component.
+   * \throws std::runtime_error if the segment cannot be created.
+   * \note This method is not real-time safe.
+   */
+  void create(
+    const std::string & segment_name, const std::vector<std::string> & state_interface_names,
+    const std::vector<std::string> & command_interface_names);
+
+  /// Attaches to a segment created by another process.
+  /**
+   * \param[in] segment_name name of the segment, as given to create().
+   * \returns false if the segment doesn't exist, isn't active or has an unknown layout.
+   * \note This method is not real-time safe.
+   */
+  bool open(const std::string & segment_name);
+
+  /// Unmaps the segment, and marks it stale and unlinks it if it was created by this object.
+  void close() noexcept;
+
+  /// Returns true if the segment is mapped and wasn't closed by its creator.
+  bool is_active() const noexcept;
+
+  /// Publishes the state values, called by the driver process.
+  /**
+   * \param[in] values state values, in the order of get_state_interface_names().
+   * \param[in] stamp_ns time of the values.
+   * \returns false if the segment isn't mapped or the number of values doesn't match.
+   */
+  bool write_states(const std::vector<double> & values, int64_t stamp_ns) noexcept;
+
+  /// Publishes the command values, called by the hardware component.
+  bool write_commands(const std::vector<double> & values, int64_t stamp_ns) noexcept;
+
+  /// Copies the latest state values.
+  /**
+   * \param[out] values resized to the number of state interfaces, allocates only if it differs.
+   * \param[out] frame number of the copied frame, 0 if the driver didn't publish any values yet.
+   * \param[out] stamp_ns time of the copied values.
+   * \returns false if the segment isn't mapped or became stale.
+   */
+  bool read_states(std::vector<double> & values, uint32_t & frame, int64_t & stamp_ns) const;
+
+  /// Copies the latest command values.
+  bool read_commands(std::vector<double> & values, uint32_t & frame, int64_t & stamp_ns) const;
+
+  /// Waits until the driver publishes a state frame other than last_frame.
+  /**
+   * \returns true if a new frame is available, false on timeout or if the segment isn't mapped.
+   */
+  bool wait_for_states(uint32_t last_frame, std::chrono::nanoseconds timeout) const noexcept;
+
+  /// Waits until the component publishes a command frame other than last_frame.
+  bool wait_for_commands(uint32_t last_frame, std::chrono::nanoseconds timeout) const noexcept;
+
+  /// Returns the names of the state interfaces.
+  const std::vector<std::string> & get_state_interface_names() const
+  {
+    return state_interface_names_;
+  }
+
+  /// Returns the names of the command interfaces.
+  const std::vector<std::string> & get_command_interface_names() const
+  {
+    return command_interface_names_;
+  }
+
+private:
+  bool write_channel(
+    shared_memory::SharedMemoryBridgeChannel & channel, std::atomic<double> * channel_values,
+    const std::vector<double> & values, std::size_t number_of_values, int64_t stamp_ns) noexcept;
+
+  bool read_channel(
+    const shared_memory::SharedMemoryBridgeChannel & channel,
+    const std::atomic<double> * channel_values, std::size_t number_of_values,
+    std::vector<double> & values, uint32_t & frame, int64_t & stamp_ns) const;
+
+  bool wait_for_frame(
+    const shared_memory::SharedMemoryBridgeChannel & channel, uint32_t last_frame,
+    std::chrono::nanoseconds timeout) const noexcept;
+
+  std::string segment_name_;
+  bool is_owner_ = false;
+  void * segment_ = nullptr;
+  std::size_t segment_size_ = 0;
+  shared_memory::SharedMemoryBridgeHeader * header_ = nullptr;
+  std::atomic<double> * state_values_ = nullptr;
+  std::atomic<double> * command_values_ = nullptr;
+  std::vector<std::string> state_interface_names_;
+  std::vector<std::string> command_interface_names_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__SHARED_MEMORY_BRIDGE_HPP_
@@ -0,0 +1,220 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__SHARED_MEMORY_INTERFACE_EXPORT_HPP_
+#define HARDWARE_INTERFACE__SHARED_MEMORY_INTERFACE_EXPORT_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+
+namespace hardware_interface
+{
+/// Layout of the shared-memory segment exporting the interface values.
+/**
+ * The segment starts with a SharedMemoryHeader, followed by one SharedMemoryInterfaceDescriptor
+ * per exported interface, the null-terminated names of the interfaces and finally the values of
+ * the interfaces as lock-free atomic doubles, aligned to a cache line.
+ *
+ * The values are protected by the sequence lock of the header: a reader copies the values and
+ * retries if the sequence was odd or changed during the copy, so the writer never waits for the
+ * readers. When the exported interfaces change, the segment is marked stale and a new segment is
+ * created under the same name, the readers then have to open it again.
+ */
+namespace shared_memory
+{
+/// "R2CI" in little endian
+constexpr uint32_t MAGIC = 0x49433252;
+constexpr uint32_t VERSION = 1;
+
+enum class SegmentState : uint32_t
+{
+  /// The segment is being created
+  INITIALIZING = 0,
+  /// The values are updated by the controller manager
+  ACTIVE = 1,
+  /// The segment was replaced or its writer stopped, the readers have to open it again
+  STALE = 2,
+};
+
+struct SharedMemoryHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  /// Total size of the segment in bytes
+  uint64_t size;
+  uint32_t number_of_interfaces;
+  /// Number of state interfaces, they are exported before the command interfaces
+  uint32_t number_of_state_interfaces;
+  /// Offsets from the beginning of the segment
+  uint64_t descriptors_offset;
+  uint64_t names_offset;
+  uint64_t values_offset;
+  std::atomic<uint32_t> state;
+  /// Odd while the writer modifies the values
+  std::atomic<uint32_t> sequence;
+  /// Number of updates of the values
+  std::atomic<uint64_t> update_count;
+  /// Time of the last update of the state and the command values, in nanoseconds
+  std::atomic<int64_t> state_stamp_ns;
+  std::atomic<int64_t> command_stamp_ns;
+};
+
+struct SharedMemoryInterfaceDescriptor
+{
+  /// Offset of the null-terminated name from the beginning of the names
+  uint32_t name_offset;
+  /// Length of the name, without the null terminator
+  uint32_t name_length;
+  /// Data type of the interface, as HandleDataType::Value. The value is exported casted to double
+  int32_t data_type;
+  /// 1 for a command interface, 0 for a state interface
+  uint32_t is_command_interface;
+};
+
+static_assert(std::atomic<double>::is_always_lock_free, "Lock-free atomic doubles are required");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Lock-free atomic words are required");
+}  // namespace shared_memory
+
+/// Exports the values of state and command interfaces into a POSIX shared-memory segment.
+/**
+ * The exporter maps the segment once in configure() and copies the values into it in
+ * update_state_values() and update_command_values(), which are real-time safe. The values of the
+ * handles are read without blocking, a handle that cannot be locked keeps its previous value.
+ *
+ * \note The exporter is only available on POSIX systems, configure() throws otherwise.
+ */
+class SharedMemoryInterfaceExporter
+{
+public:
+  explicit SharedMemoryInterfaceExporter(const std::string & segment_name);
+
+  ~SharedMemoryInterfaceExporter();
+
+  SharedMemoryInterfaceExporter(const SharedMemoryInterfaceExporter &) = delete;
+  SharedMemoryInterfaceExporter & operator=(const SharedMemoryInterfaceExporter &) = delete;
+
+  /// Creates the segment exporting the given interfaces, replacing the previous one.
+  /**
+   * \param[in] state_interfaces state interfaces exported first in the segment.
+   * \param[in] command_interfaces command interfaces exported after the state interfaces.
+   * \throws std::runtime_error if the segment cannot be created.
+   * \note This method is not real-time safe.
+   */
+  void configure(
+    const std::vector<StateInterface::ConstSharedPtr> & state_interfaces,
+    const std::vector<CommandInterface::SharedPtr> & command_interfaces);
+
+  /// Copies the values of the state interfaces into the segment.
+  void update_state_values(int64_t stamp_ns) noexcept;
+
+  /// Copies the values of the command interfaces into the segment.
+  void update_command_values(int64_t stamp_ns) noexcept;
+
+  /// Returns the name of the shared-memory segment.
+  const std::string & get_segment_name() const { return segment_name_; }
+
+  /// Returns the number of exported interfaces.
+  std::size_t get_number_of_interfaces() const
+  {
+    return state_interfaces_.size() + command_interfaces_.size();
+  }
+
+private:
+  /// Marks the segment stale, unmaps and unlinks it
+  void release_segment() noexcept;
+
+  /// Copies the values of the handles under the sequence lock, header_ must be valid
+  template <typename HandlesT>
+  void update_values(
+    const HandlesT & handles, std::size_t first_index, std::atomic<int64_t> & stamp,
+    int64_t stamp_ns) noexcept;
+
+  std::string segment_name_;
+  std::vector<StateInterface::ConstSharedPtr> state_interfaces_;
+  std::vector<CommandInterface::SharedPtr> command_interfaces_;
+  void * segment_ = nullptr;
+  std::size_t segment_size_ = 0;
+  shared_memory::SharedMemoryHeader * header_ = nullptr;
+  std::atomic<double> * values_ = nullptr;
+};
+
+/// Reads the interface values exported by a SharedMemoryInterfaceExporter, from any process.
+class SharedMemoryInterfaceReader
+{
+public:
+  /// Consistent copy of the exported values
+  struct Snapshot
+  {
+    /// Values in the order of get_interface_names()
+    std::vector<double> values;
+    uint64_t update_count = 0;
+    int64_t state_stamp_ns = 0;
+    int64_t command_stamp_ns = 0;
+  };
+
+  SharedMemoryInterfaceReader() = default;
+
+  ~SharedMemoryInterfaceReader();
+
+  SharedMemoryInterfaceReader(const SharedMemoryInterfaceReader &) = delete;
+  SharedMemoryInterfaceReader & operator=(const SharedMemoryInterfaceReader &) = delete;
+
+  /// Maps the segment read-only and parses its layout.
+  /**
+   * \param[in] segment_name name of the segment, as given to the exporter.
+   * \returns false if the segment doesn't exist, isn't active yet or has an unknown layout.
+   */
+  bool open(const std::string & segment_name);
+
+  /// Unmaps the segment.
+  void close() noexcept;
+
+  /// Returns true if the segment is mapped and still updated by its writer.
+  bool is_active() const noexcept;
+
+  /// Copies the values into the snapshot, allocating only if the number of values changed.
+  /**
+   * \returns false if the segment isn't mapped or became stale, the reader should then be opened
+   * again.
+   */
+  bool read(Snapshot & snapshot) const;
+
+  /// Returns the names of the exported interfaces, the state interfaces first.
+  const std::vector<std::string> & get_interface_names() const { return interface_names_; }
+
+  /// Returns the data types of the exported interfaces, before their cast to double.
+  const std::vector<HandleDataType> & get_data_types() const { return data_types_; }
+
+  /// Returns the number of state interfaces, they precede the command interfaces.
+  std::size_t get_number_of_state_interfaces() const { return number_of_state_interfaces_; }
+
+private:
+  const void * segment_ = nullptr;
+  std::size_t segment_size_ = 0;
+  const shared_memory::SharedMemoryHeader * header_ = nullptr;
+  const std::atomic<double> * values_ = nullptr;
+  std::vector<std::string> interface_names_;
+  std::vector<HandleDataType> data_types_;
+  std::size_t number_of_state_interfaces_ = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__SHARED_MEMORY_INTERFACE_EXPORT_HPP_
@@ -0,0 +1,126 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__SIMULATION_STEP_BARRIER_HPP_
+#define HARDWARE_INTERFACE__SIMULATION_STEP_BARRIER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/shared_memory_bridge.hpp"
+
+namespace hardware_interface
+{
+/// Lock-step clock and barrier between a simulator process and the control loop.
+/**
+ * The control loop creates the barrier with create() and the simulator attaches to it with open().
+ * After each of its steps, the simulator requests a control cycle at the time of the simulation
+ * with step(), which wakes the control loop waiting in wait_for_step() through a futex, and waits
+ * until the control loop signals the end of the cycle with complete_step(). One step of the
+ * simulation and of the control loop is then exchanged without the latency of the /clock topic.
+ *
+ * The barrier is a SharedMemoryBridge without interfaces: the time of the step is the stamp of the
+ * "states" frame written by the simulator, and the end of the cycle the "commands" frame written
+ * by the control loop.
+ *
+ * \note Each side is used by one thread. The methods waiting are only real-time safe on Linux,
+ * where they wait on a futex.
+ */
+class SimulationStepBarrier
+{
+public:
+  /// Creates the barrier, called by the control loop.
+  /**
+   * \param[in] segment_name name of the segment, starting with a slash.
+   * \throws std::runtime_error if the segment cannot be created.
+   */
+  void create(const std::string & segment_name)
+  {
+    bridge_.create(segment_name, {}, {});
+    last_step_ = 0;
+  }
+
+  /// Attaches to the barrier of the control loop, called by the simulator.
+  /**
+   * \returns false if the segment doesn't exist or isn't active.
+   */
+  bool open(const std::string & segment_name) { return bridge_.open(segment_name); }
+
+  void close() noexcept { bridge_.close(); }
+
+  /// Returns true if the segment is mapped and wasn't closed by the control loop.
+  bool is_active() const noexcept { return bridge_.is_active(); }
+
+  /// Waits until the simulator requests a control cycle.
+  /**
+   * \param[in] timeout maximal time to wait for the request.
+   * \param[out] time_ns time of the simulation of the requested cycle.
+   * \returns false on timeout, the cycle must not be run then.
+   */
+  bool wait_for_step(std::chrono::nanoseconds timeout, int64_t & time_ns)
+  {
+    bridge_.wait_for_states(last_step_, timeout);
+    uint32_t step = last_step_;
+    if (!bridge_.read_states(no_values_, step, time_ns) || step == last_step_)
+    {
+      return false;
+    }
+    last_step_ = step;
+    return true;
+  }
+
+  /// Signals the simulator that the requested cycle ran.
+  /**
+   * \param[in] time_ns time of the cycle, as returned by wait_for_step().
+   */
+  bool complete_step(int64_t time_ns) noexcept
+  {
+    return bridge_.write_commands(no_values_, time_ns);
+  }
+
+  /// Requests a control cycle at the time of the simulation and waits until it ran.
+  /**
+   * \param[in] time_ns time of the simulation after its last step.
+   * \param[in] timeout maximal time to wait for the cycle.
+   * \returns false if the cycle didn't run within the timeout or the segment isn't active.
+   */
+  bool step(int64_t time_ns, std::chrono::nanoseconds timeout)
+  {
+    uint32_t completed_step = 0;
+    int64_t completed_time_ns = 0;
+    // the cycles completed before the request are not awaited
+    if (
+      !bridge_.read_commands(no_values_, completed_step, completed_time_ns) ||
+      !bridge_.write_states(no_values_, time_ns))
+    {
+      return false;
+    }
+    const uint32_t previous_step = completed_step;
+    bridge_.wait_for_commands(previous_step, timeout);
+    return bridge_.read_commands(no_values_, completed_step, completed_time_ns) &&
+           completed_step != previous_step;
+  }
+
+private:
+  SharedMemoryBridge bridge_;
+  /// The barrier exchanges no values, only the frames and their stamps
+  std::vector<double> no_values_;
+  uint32_t last_step_ = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__SIMULATION_STEP_BARRIER_HPP_
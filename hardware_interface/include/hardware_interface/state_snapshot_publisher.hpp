@@ -0,0 +1,132 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__STATE_SNAPSHOT_PUBLISHER_HPP_
+#define HARDWARE_INTERFACE__STATE_SNAPSHOT_PUBLISHER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "control_msgs/msg/dynamic_interface_group_values.hpp"
+#include "hardware_interface/handle.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/publisher.hpp"
+#include "rclcpp/time.hpp"
+
+namespace hardware_interface
+{
+/// State interfaces of a hardware component, published by a StateSnapshotPublisher.
+struct StateSnapshotGroup
+{
+  /// Name of the hardware component.
+  std::string name;
+  /// Full names of the state interfaces, in the order of their values.
+  std::vector<std::string> interface_names;
+  /// Values of the interfaces stored contiguously, e.g., in the contiguous interface storage of
+  /// the ResourceManager, copied with a single memcpy. If nullptr, the values are read from the
+  /// interfaces.
+  const double * values = nullptr;
+  /// Interfaces read one by one when the values are not stored contiguously.
+  std::vector<StateInterface::ConstSharedPtr> interfaces;
+};
+
+/// Publishes the values of the state interfaces of all the hardware components.
+/**
+ * Every \p decimation cycles, capture() copies the values of every group into a preallocated
+ * control_msgs::msg::DynamicInterfaceGroupValues message, with one memcpy per group whose values
+ * are stored contiguously, and wakes a thread that publishes it on the "~/values" topic. The
+ * message is published through a loaned message if the middleware supports loans for it.
+ *
+ * The names are not repeated in the published values: they are published once on the transient
+ * local "~/names" topic, whenever the groups change, with the same layout: the
+ * interface_groups of the message are the names of the groups and interface_values[i] holds the
+ * interface names of the i-th group.
+ *
+ * The real-time thread never waits: the captured message is swapped with the published one, and a
+ * snapshot captured while the previous one wasn't picked up by the thread yet is dropped, see
+ * get_dropped_snapshots().
+ */
+class StateSnapshotPublisher
+{
+public:
+  /**
+   * \param[in] node node of the publishers.
+   * \param[in] decimation number of capture() calls per published snapshot, at least 1.
+   */
+  StateSnapshotPublisher(const rclcpp::Node::SharedPtr & node, unsigned int decimation);
+
+  ~StateSnapshotPublisher();
+
+  StateSnapshotPublisher(const StateSnapshotPublisher &) = delete;
+  StateSnapshotPublisher & operator=(const StateSnapshotPublisher &) = delete;
+
+  /// Replaces the published groups and publishes their names.
+  /**
+   * \note This method is not real-time safe, the contiguous values of the groups have to outlive
+   * the next call.
+   */
+  void set_groups(const std::vector<StateSnapshotGroup> & groups);
+
+  /// Copies the values of the groups into the message every decimation calls.
+  /**
+   * \param[in] time stamp of the snapshot.
+   * \returns true if a snapshot was captured.
+   * \note This method is real-time safe, it doesn't allocate and doesn't block.
+   */
+  bool capture(const rclcpp::Time & time);
+
+  /// Returns the number of values of a snapshot.
+  std::size_t get_number_of_values() const { return number_of_values_; }
+
+  /// Returns the number of snapshots published so far.
+  std::size_t get_published_snapshots() const { return published_snapshots_.load(); }
+
+  /// Returns the number of snapshots dropped because the previous one wasn't published yet.
+  std::size_t get_dropped_snapshots() const { return dropped_snapshots_.load(); }
+
+private:
+  void publishing_loop();
+
+  rclcpp::Node::SharedPtr node_;
+  unsigned int decimation_;
+  unsigned int cycles_until_capture_ = 0;
+  rclcpp::Publisher<control_msgs::msg::DynamicInterfaceGroupValues>::SharedPtr values_publisher_;
+  rclcpp::Publisher<control_msgs::msg::DynamicInterfaceGroupValues>::SharedPtr names_publisher_;
+
+  /// Protects the groups and the captured message, capture() only tries to lock it
+  mutable std::mutex mutex_;
+  std::condition_variable snapshot_captured_;
+  std::vector<StateSnapshotGroup> groups_;
+  std::size_t number_of_values_ = 0;
+  control_msgs::msg::DynamicInterfaceGroupValues captured_message_;
+  bool snapshot_pending_ = false;
+  bool stop_ = false;
+  /// Protects the published message, swapped with the captured one without allocation
+  std::mutex publish_mutex_;
+  control_msgs::msg::DynamicInterfaceGroupValues published_message_;
+  std::atomic<std::size_t> published_snapshots_{0};
+  std::atomic<std::size_t> dropped_snapshots_{0};
+  std::thread publishing_thread_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__STATE_SNAPSHOT_PUBLISHER_HPP_
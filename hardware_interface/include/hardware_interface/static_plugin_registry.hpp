@@ -0,0 +1,136 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__STATIC_PLUGIN_REGISTRY_HPP_
+#define HARDWARE_INTERFACE__STATIC_PLUGIN_REGISTRY_HPP_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Registry of the plugins compiled into the executable, looked up before pluginlib.
+/**
+ * The hardware components and the controllers are normally loaded by pluginlib, which scans the
+ * plugin manifests and opens their libraries. A plugin registered here with
+ * HARDWARE_INTERFACE_REGISTER_STATIC_PLUGIN() is created directly by the resource manager or the
+ * controller manager, under the same name as its pluginlib class, and the libraries of the
+ * other plugins are still loaded by pluginlib.
+ *
+ * The registration runs during the static initialization of the object file of the macro. If
+ * the plugin is linked from a static library, the object file has to be kept by the linker,
+ * e.g., with `-Wl,--whole-archive` or an object library.
+ *
+ * \tparam BaseT base class of the plugins, e.g., hardware_interface::SystemInterface or
+ * controller_interface::ControllerInterface, like the base class of the pluginlib ClassLoader.
+ */
+template <typename BaseT>
+class StaticPluginRegistry
+{
+public:
+  using Factory = std::unique_ptr<BaseT> (*)();
+
+  /// Registers the \p factory of the plugin \p class_name.
+  /**
+   * \returns false if a plugin with the same name was already registered, it is kept.
+   */
+  static bool register_class(const std::string & class_name, Factory factory)
+  {
+    auto & registry = get_registry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    return registry.factories.emplace(class_name, factory).second;
+  }
+
+  static bool is_class_available(const std::string & class_name)
+  {
+    auto & registry = get_registry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    return registry.factories.find(class_name) != registry.factories.end();
+  }
+
+  /// Creates an instance of the plugin \p class_name, nullptr if it isn't registered.
+  static std::unique_ptr<BaseT> create_unique_instance(const std::string & class_name)
+  {
+    Factory factory = nullptr;
+    {
+      auto & registry = get_registry();
+      std::lock_guard<std::mutex> guard(registry.mutex);
+      const auto it = registry.factories.find(class_name);
+      if (it == registry.factories.end())
+      {
+        return nullptr;
+      }
+      factory = it->second;
+    }
+    // the plugin is constructed without the lock, its constructor may look up other plugins
+    return factory();
+  }
+
+  /// Returns the names of the registered plugins, in alphabetical order.
+  static std::vector<std::string> get_declared_classes()
+  {
+    auto & registry = get_registry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    std::vector<std::string> classes;
+    classes.reserve(registry.factories.size());
+    for (const auto & [class_name, factory] : registry.factories)
+    {
+      classes.push_back(class_name);
+    }
+    return classes;
+  }
+
+private:
+  struct Registry
+  {
+    std::mutex mutex;
+    std::map<std::string, Factory> factories;
+  };
+
+  /// Constructed on first use, so that the plugins can be registered by any static initializer
+  static Registry & get_registry()
+  {
+    static Registry registry;
+    return registry;
+  }
+};
+
+}  // namespace hardware_interface
+
+#define HARDWARE_INTERFACE_STATIC_PLUGIN_CONCAT_IMPL(a, b) a##b
+#define HARDWARE_INTERFACE_STATIC_PLUGIN_CONCAT(a, b) \
+  HARDWARE_INTERFACE_STATIC_PLUGIN_CONCAT_IMPL(a, b)
+
+/// Registers the class \p Derived as the plugin \p class_name of the base class \p Base.
+/**
+ * It is used like PLUGINLIB_EXPORT_CLASS() in a source file, with the name of the class in the
+ * plugin manifest, and both macros can be used for the same class:
+ *
+ *     HARDWARE_INTERFACE_REGISTER_STATIC_PLUGIN(
+ *       my_robot_driver::MyRobotSystem, hardware_interface::SystemInterface,
+ *       "my_robot_driver/MyRobotSystem")
+ */
+#define HARDWARE_INTERFACE_REGISTER_STATIC_PLUGIN(Derived, Base, class_name)                   \
+  namespace                                                                                    \
+  {                                                                                            \
+  [[maybe_unused]] const bool HARDWARE_INTERFACE_STATIC_PLUGIN_CONCAT(                         \
+    static_plugin_registered_, __LINE__) =                                                     \
+    ::hardware_interface::StaticPluginRegistry<Base>::register_class(                          \
+      class_name, []() -> std::unique_ptr<Base> { return std::make_unique<Derived>(); });      \
+  }  // namespace
+
+#endif  // HARDWARE_INTERFACE__STATIC_PLUGIN_REGISTRY_HPP_
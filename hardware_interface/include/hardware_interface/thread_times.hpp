@@ -0,0 +1,65 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__THREAD_TIMES_HPP_
+#define HARDWARE_INTERFACE__THREAD_TIMES_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+namespace hardware_interface
+{
+/// CPU time and context switches of the calling thread.
+/**
+ * The difference of two samples taken around a code section tells whether its wall time was spent
+ * computing or waiting: the wall time minus the CPU time is the time the thread was preempted or
+ * blocked, and the involuntary context switches show the preemptions by the scheduler.
+ *
+ * The sampling is enabled process-wide with set_sampling_enabled(), since every sample costs two
+ * system calls. The samples are zero while it is disabled, and on the platforms without per-thread
+ * times. now() is real-time safe and doesn't allocate memory.
+ */
+struct ThreadTimes
+{
+  /// CPU time consumed by the thread, from CLOCK_THREAD_CPUTIME_ID
+  std::chrono::nanoseconds cpu_time{0};
+  /// Context switches of the thread, from getrusage(RUSAGE_THREAD)
+  uint64_t voluntary_context_switches = 0;
+  uint64_t involuntary_context_switches = 0;
+
+  /// Samples the calling thread, if the sampling is enabled.
+  static ThreadTimes now() noexcept;
+
+  static void set_sampling_enabled(bool enabled) noexcept;
+
+  static bool is_sampling_enabled() noexcept;
+
+  ThreadTimes operator-(const ThreadTimes & other) const noexcept
+  {
+    return {
+      cpu_time - other.cpu_time, voluntary_context_switches - other.voluntary_context_switches,
+      involuntary_context_switches - other.involuntary_context_switches};
+  }
+
+  /// Returns the time the thread didn't run during the \p wall_time of the section.
+  std::chrono::nanoseconds get_preempted_time(std::chrono::nanoseconds wall_time) const noexcept
+  {
+    // the CPU time is accounted at a coarser granularity than the steady clock
+    return wall_time > cpu_time ? wall_time - cpu_time : std::chrono::nanoseconds::zero();
+  }
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__THREAD_TIMES_HPP_
@@ -0,0 +1,108 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__TIME_BUDGET_HPP_
+#define HARDWARE_INTERFACE__TIME_BUDGET_HPP_
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace hardware_interface
+{
+/// Action taken when the execution of a controller or hardware component exceeds its budget.
+enum class TimeBudgetPolicy : std::uint8_t
+{
+  /// The overrun is only counted and reported
+  REPORT,
+  /// The next execution is skipped, to give the loop time to catch up
+  SKIP_NEXT_CYCLE,
+  /// The execution is handled as if it returned an error, e.g., a controller is deactivated and
+  /// its fallback controllers are activated
+  ERROR
+};
+
+/// Parses the name of a TimeBudgetPolicy: "report", "skip_next_cycle" or "error".
+/**
+ * \throws std::invalid_argument if the name is not valid.
+ */
+inline TimeBudgetPolicy parse_time_budget_policy(const std::string & policy)
+{
+  if (policy == "report")
+  {
+    return TimeBudgetPolicy::REPORT;
+  }
+  if (policy == "skip_next_cycle")
+  {
+    return TimeBudgetPolicy::SKIP_NEXT_CYCLE;
+  }
+  if (policy == "error")
+  {
+    return TimeBudgetPolicy::ERROR;
+  }
+  throw std::invalid_argument(
+    "Invalid time budget policy '" + policy +
+    "', expected 'report', 'skip_next_cycle' or 'error'.");
+}
+
+/// Execution time budget of a controller update or of a hardware component read or write.
+/**
+ * The budget is checked with the execution time measured by the caller, so that a single
+ * misbehaving controller or component can be handled before it makes the whole loop overrun
+ * repeatedly. A budget of 0 disables the check.
+ *
+ * \note All the methods are real-time safe and don't allocate memory. A budget is checked by the
+ * thread executing its controller or component only.
+ */
+struct TimeBudget
+{
+  /// Maximal execution time in microseconds, 0 if the execution time is not checked
+  double budget_us = 0.0;
+  TimeBudgetPolicy policy = TimeBudgetPolicy::REPORT;
+  /// Number of executions that exceeded the budget
+  unsigned int overruns = 0;
+  /// True if the next execution has to be skipped because of the SKIP_NEXT_CYCLE policy
+  bool skip_next_cycle = false;
+
+  /// Returns true if the execution time is checked.
+  bool is_enabled() const noexcept { return budget_us > 0.0; }
+
+  /// Checks the measured execution time and returns true if it exceeded the budget.
+  /**
+   * An overrun is counted, and the next execution is marked to be skipped with the
+   * SKIP_NEXT_CYCLE policy.
+   */
+  bool check(double execution_time_us) noexcept
+  {
+    if (!is_enabled() || execution_time_us <= budget_us)
+    {
+      return false;
+    }
+    ++overruns;
+    skip_next_cycle = policy == TimeBudgetPolicy::SKIP_NEXT_CYCLE;
+    return true;
+  }
+
+  /// Returns true if the current execution has to be skipped and clears the request.
+  bool consume_skip() noexcept
+  {
+    const bool skip = skip_next_cycle;
+    skip_next_cycle = false;
+    return skip;
+  }
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__TIME_BUDGET_HPP_
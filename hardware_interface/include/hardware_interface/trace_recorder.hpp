@@ -0,0 +1,141 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__TRACE_RECORDER_HPP_
+#define HARDWARE_INTERFACE__TRACE_RECORDER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/cycle_profiler.hpp"
+#include "hardware_interface/cycle_trace_ring.hpp"
+
+namespace hardware_interface
+{
+/// Section of the control loop recorded by the TraceRecorder
+struct TraceEvent
+{
+  /// Id of the name of the section, see TraceRecorder::register_name()
+  uint32_t name_id = 0;
+  /// Index of the recording thread
+  uint32_t thread_index = 0;
+  /// Begin and end of the section on the steady clock, in nanoseconds
+  int64_t begin_ns = 0;
+  int64_t end_ns = 0;
+};
+
+/// Recorder of the begin and end timestamps of the sections of the control loop.
+/**
+ * Every recording thread writes into its own preallocated ring buffer, which is drained by a non
+ * real-time thread, e.g., to write the events into a trace file with write_chrome_trace_events().
+ * When a ring buffer is full, the new events of the thread are dropped until it is drained.
+ *
+ * The names of the sections are registered once outside of the real-time loop, the events only
+ * carry the id of their name. record(), now() and TraceScope are real-time safe and don't
+ * allocate memory.
+ */
+class TraceRecorder
+{
+public:
+  /// Allocates the ring buffers and enables the recording.
+  /**
+   * The ring buffers are allocated on the first call only and never released, so that the
+   * recording threads can't access released memory. Later calls only enable the recording again.
+   *
+   * \param[in] events_per_thread capacity of the ring buffer of every thread.
+   * \param[in] max_threads number of ring buffers, the events of further threads are dropped.
+   */
+  static void enable(std::size_t events_per_thread, std::size_t max_threads);
+
+  /// Disables the recording, the recorded events can still be drained.
+  static void disable() noexcept;
+
+  static bool is_enabled() noexcept;
+
+  /// Returns the id of the \p name, registering it if needed. Id 0 is only used for empty names.
+  /**
+   * The ids are the ones of the NamePool, so they are shared with the other interned names.
+   */
+  static uint32_t register_name(const std::string & name);
+
+  /// Returns the registered name of the id, or an empty string if it is unknown.
+  static std::string get_name(uint32_t name_id);
+
+  /// Returns the current time of the steady clock, in nanoseconds.
+  static int64_t now() noexcept;
+
+  /// Records a section of the current thread, if the recording is enabled.
+  static void record(uint32_t name_id, int64_t begin_ns, int64_t end_ns) noexcept;
+
+  /// Moves the recorded events of all the threads to the end of \p events.
+  /**
+   * \return number of moved events.
+   * \note Only one thread can drain the events at a time.
+   */
+  static std::size_t drain(std::vector<TraceEvent> & events);
+
+  /// Returns the number of events dropped because the ring buffer of their thread was full.
+  static uint64_t get_dropped_events() noexcept;
+
+  /// Writes the events in the Chrome trace event format, as read by Perfetto.
+  /**
+   * Every event is written as a complete event followed by a comma and a new line, so the events
+   * of several drains can be appended to a file starting with '['. The closing bracket of the
+   * array is optional in this format.
+   */
+  static void write_chrome_trace_events(std::ostream & os, const std::vector<TraceEvent> & events);
+};
+
+/// Records the section between its construction and its destruction.
+/**
+ * The section is recorded by the TraceRecorder, the CycleProfiler and the CycleTraceRing, if they
+ * are recording.
+ */
+class TraceScope
+{
+public:
+  explicit TraceScope(uint32_t name_id) noexcept
+  : name_id_(name_id),
+    begin_ns_(
+      TraceRecorder::is_enabled() || CycleProfiler::is_recording() || CycleTraceRing::is_enabled()
+        ? TraceRecorder::now()
+        : 0)
+  {
+  }
+
+  ~TraceScope()
+  {
+    if (begin_ns_ != 0)
+    {
+      const int64_t end_ns = TraceRecorder::now();
+      TraceRecorder::record(name_id_, begin_ns_, end_ns);
+      CycleProfiler::record(name_id_, begin_ns_, end_ns);
+      CycleTraceRing::record(name_id_, begin_ns_, end_ns);
+    }
+  }
+
+  TraceScope(const TraceScope &) = delete;
+  TraceScope & operator=(const TraceScope &) = delete;
+
+private:
+  uint32_t name_id_;
+  int64_t begin_ns_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__TRACE_RECORDER_HPP_
@@ -0,0 +1,106 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__TRANSMISSION_STAGE_INTERFACE_HPP_
+#define HARDWARE_INTERFACE__TRANSMISSION_STAGE_INTERFACE_HPP_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/types/statistics_types.hpp"
+
+namespace hardware_interface
+{
+/// Execution time statistics of the transmission stage of the ResourceManager.
+struct TransmissionStageStatistics
+{
+  /// Conversion of the actuator states to the joint states, after the read cycle
+  ros2_control::MovingAverageStatisticsData actuator_to_joint;
+  /// Conversion of the joint commands to the actuator commands, before the write cycle
+  ros2_control::MovingAverageStatisticsData joint_to_actuator;
+};
+
+/// Pipeline stage applying the transmissions of the hardware components in the ResourceManager.
+/**
+ * The stage is loaded as a plugin by the ResourceManager, e.g., the
+ * "transmission_interface/TransmissionStage" plugin, so that the ResourceManager doesn't depend on
+ * the transmission implementations. The ResourceManager adds the transmissions of all synchronous
+ * hardware components to one stage, calls actuator_to_joint() once after all the components are
+ * read and joint_to_actuator() once before they are written.
+ *
+ * The actuator and the joint interfaces of a transmission are interfaces exported by the hardware
+ * component, named `<actuator name>/<interface type>` and `<joint name>/<interface type>`. The
+ * component reads and writes the actuator interfaces, the stage computes the joint states from the
+ * actuator states and the actuator commands from the joint commands.
+ */
+class TransmissionStageInterface
+{
+public:
+  /// Returns the state interface with the given name, or nullptr if it doesn't exist.
+  using StateInterfaceLookup = std::function<StateInterface::SharedPtr(const std::string &)>;
+  /// Returns the command interface with the given name, or nullptr if it doesn't exist.
+  using CommandInterfaceLookup = std::function<CommandInterface::SharedPtr(const std::string &)>;
+
+  virtual ~TransmissionStageInterface() = default;
+
+  /// Adds the transmissions of a hardware component to the stage.
+  /**
+   * \param[in] component_name name of the hardware component, used for logging.
+   * \param[in] transmissions transmissions parsed from the description of the component.
+   * \param[in] get_state_interface lookup of the state interfaces of the component.
+   * \param[in] get_command_interface lookup of the command interfaces of the component.
+   * \returns false if one of the transmissions could not be loaded or configured, the other
+   * transmissions are added nonetheless.
+   * \note This method is not real-time safe.
+   */
+  virtual bool add_transmissions(
+    const std::string & component_name, const std::vector<TransmissionInfo> & transmissions,
+    const StateInterfaceLookup & get_state_interface,
+    const CommandInterfaceLookup & get_command_interface) = 0;
+
+  /// Removes all the transmissions from the stage.
+  virtual void clear() = 0;
+
+  /// Binds the transmissions added from now on in place to the interfaces of type double.
+  /**
+   * The joint states and actuator commands are then computed directly in the storage of the
+   * interfaces, without copying them and without locking them, see Handle::bind_value_storage().
+   * It must only be enabled if the interfaces of the transmissions are not accessed by other
+   * threads than the control loop.
+   *
+   * \param[in] in_place true to bind the interfaces in place.
+   * \note The default implementation ignores it, the interfaces are then accessed through their
+   * thread-safe API.
+   */
+  virtual void set_in_place_binding(bool /*in_place*/) {}
+
+  /// Computes the joint state interfaces from the actuator state interfaces.
+  /**
+   * \note This method has to be real-time safe.
+   */
+  virtual void actuator_to_joint() = 0;
+
+  /// Computes the actuator command interfaces from the joint command interfaces.
+  /**
+   * \note This method has to be real-time safe.
+   */
+  virtual void joint_to_actuator() = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__TRANSMISSION_STAGE_INTERFACE_HPP_
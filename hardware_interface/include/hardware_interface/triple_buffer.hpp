@@ -0,0 +1,92 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__TRIPLE_BUFFER_HPP_
+#define HARDWARE_INTERFACE__TRIPLE_BUFFER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace hardware_interface
+{
+/// Lock-free exchange of the latest value between one producer and one consumer thread.
+/**
+ * The producer fills the write buffer and publishes it, the consumer takes the latest published
+ * buffer and reads it. Both sides only exchange an index with the third buffer, so they never wait
+ * for each other and the consumer never sees a partially written value. Values published before
+ * the consumer took them are overwritten by the newer ones.
+ *
+ * The buffers are allocated by initialize(), publishing and reading afterwards doesn't allocate
+ * memory as long as the copies of T don't.
+ */
+template <class T>
+class TripleBuffer
+{
+public:
+  /// Sets all the buffers to the given value and marks it as not published.
+  /**
+   * \note This method is not thread-safe, it has to be called while no other thread uses the
+   * buffer.
+   */
+  void initialize(const T & value)
+  {
+    buffers_.fill(value);
+    write_index_ = 0u;
+    read_index_ = 1u;
+    middle_.store(2u, std::memory_order_relaxed);
+  }
+
+  /// Returns the buffer to be filled by the producer.
+  T & get_write_buffer() { return buffers_[write_index_]; }
+
+  /// Publishes the write buffer, the producer gets another write buffer then.
+  void publish()
+  {
+    const uint8_t previous = middle_.exchange(write_index_ | FRESH, std::memory_order_acq_rel);
+    write_index_ = previous & INDEX_MASK;
+  }
+
+  /// Takes the latest published buffer for the consumer, if any was published since the last call.
+  /**
+   * \returns true if a new buffer was taken, false if the read buffer is unchanged.
+   */
+  bool update_read_buffer()
+  {
+    if ((middle_.load(std::memory_order_relaxed) & FRESH) == 0u)
+    {
+      return false;
+    }
+    const uint8_t previous = middle_.exchange(read_index_, std::memory_order_acq_rel);
+    read_index_ = previous & INDEX_MASK;
+    return true;
+  }
+
+  /// Returns the buffer taken by the last update_read_buffer().
+  const T & get_read_buffer() const { return buffers_[read_index_]; }
+
+private:
+  static constexpr uint8_t INDEX_MASK = 0x3u;
+  static constexpr uint8_t FRESH = 0x4u;
+
+  std::array<T, 3> buffers_{};
+  /// Index of the buffer between the producer and the consumer, with the FRESH flag if published
+  std::atomic<uint8_t> middle_{2u};
+  uint8_t write_index_ = 0u;
+  uint8_t read_index_ = 1u;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__TRIPLE_BUFFER_HPP_
@@ -44,6 +44,14 @@ struct HardwareComponentInterfaceParams
    * to the ControllerManager's executor.
    */
   rclcpp::Executor::WeakPtr executor;
+
+  /**
+   * @brief If true, the component is initialized by a warm restart of the controller manager and
+   * is set again to the state it had before the restart of the process. A component supporting
+   * it may then skip, e.g., the homing of its joints or the enumeration of its bus, if the
+   * hardware kept running in the meantime.
+   */
+  bool warm_restart = false;
 };
 
 }  // namespace hardware_interface
@@ -17,7 +17,9 @@
 
 #include <memory>
 #include <string>
+#include "hardware_interface/async_worker_pool.hpp"
 #include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/memory_arena.hpp"
 #include "rclcpp/rclcpp.hpp"
 
 namespace hardware_interface
@@ -62,6 +64,44 @@ struct HardwareComponentParams
    * to the ControllerManager's executor.
    */
   rclcpp::Executor::WeakPtr executor;
+
+  /**
+   * @brief Pool running the asynchronous cycles of the components with the synchronized
+   * scheduling policy. If nullptr, every asynchronous component spawns its own thread.
+   */
+  std::shared_ptr<hardware_interface::AsyncWorkerPool> async_worker_pool = nullptr;
+
+  /**
+   * @brief Pre-faulted and locked memory the component allocates its buffers from, see
+   * HardwareComponentInterface::get_memory_resource. If nullptr, the default heap is used.
+   */
+  std::shared_ptr<hardware_interface::MemoryArena> memory_arena = nullptr;
+
+  /**
+   * @brief Bytes of the stack of the asynchronous thread of the component prefaulted at its first
+   * cycle, see RealtimeThreadParams::stack_prefault_size.
+   */
+  std::size_t thread_stack_prefault_size = 0;
+
+  /**
+   * @brief If true, the hardware status message of the component is published by the
+   * aggregated publisher of the ResourceManager instead of its own publisher, see
+   * HardwareComponentInterface::get_hardware_status_source.
+   */
+  bool aggregate_hardware_status = false;
+
+  /**
+   * @brief If true, the error and deactivation transitions caused by the read and the write of
+   * the component are requested, see HardwareComponent::request_transition, and run by the
+   * ResourceManager outside of the control loop, instead of being run in the control loop.
+   */
+  bool defer_control_loop_transitions = false;
+
+  /**
+   * @brief If true, the component is initialized by a warm restart of the controller manager,
+   * see HardwareComponentInterfaceParams::warm_restart.
+   */
+  bool warm_restart = false;
 };
 
 }  // namespace hardware_interface
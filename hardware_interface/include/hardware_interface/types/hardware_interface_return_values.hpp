@@ -19,6 +19,9 @@
 #include <cstdint>
 #include <optional>
 
+#include "hardware_interface/performance_counters.hpp"
+#include "hardware_interface/thread_times.hpp"
+
 namespace hardware_interface
 {
 enum class return_type : std::uint8_t
@@ -36,12 +39,23 @@ enum class return_type : std::uint8_t
  * @var successful: true if it was triggered successfully, false if not.
  * @var result: return_type::OK if update is successfully, otherwise return_type::ERROR.
  * @var execution_time: duration of the execution of the update method.
+ * @var thread_times: CPU time and context switches of the thread during the execution, only set
+ * if the ThreadTimes sampling is enabled.
+ * @var performance_counters: hardware performance counters of the thread during the execution,
+ * only set if the PerformanceCounters sampling is enabled.
+ * @var read_time_ns: time passed to the read the states come from, only set if the states were
+ * read since the previous trigger, e.g., not set while an asynchronous read is still running.
  */
 struct HardwareComponentCycleStatus
 {
   bool successful = true;
   return_type result = return_type::OK;
   std::optional<std::chrono::nanoseconds> execution_time = std::nullopt;
+  std::optional<ThreadTimes> thread_times = std::nullopt;
+  std::optional<PerformanceCounters> performance_counters = std::nullopt;
+  /// Fraction of the command interfaces changed since the previous write, if they are tracked
+  std::optional<double> changed_command_ratio = std::nullopt;
+  std::optional<int64_t> read_time_ns = std::nullopt;
 };
 
 }  // namespace hardware_interface
@@ -15,13 +15,110 @@
 #ifndef HARDWARE_INTERFACE__TYPES__RESOURCE_MANAGER_PARAMS_HPP_
 #define HARDWARE_INTERFACE__TYPES__RESOURCE_MANAGER_PARAMS_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
+#include "hardware_interface/async_worker_pool.hpp"
+#include "hardware_interface/rt_worker_pool.hpp"
 #include "rclcpp/rclcpp.hpp"
 
 namespace hardware_interface
 {
 
+/**
+ * @brief Parameters of the export of the interface values into a POSIX shared-memory segment,
+ * readable by other processes with hardware_interface::SharedMemoryInterfaceReader.
+ */
+struct SharedMemoryExportParams
+{
+  /// If true, the values are copied into the segment after every read and write cycle.
+  bool enable = false;
+  /// Name of the shared-memory segment, starting with a slash.
+  std::string segment_name = "/ros2_control_interfaces";
+  /// If true, the command interfaces are exported after the state interfaces.
+  bool include_command_interfaces = true;
+};
+
+/**
+ * @brief Parameters of the export of interfaces to a controller manager running on another
+ * machine, which imports them with the remote_components/RemoteSystem hardware component, see
+ * hardware_interface::UdpInterfaceLink.
+ */
+struct RemoteInterfaceExportParams
+{
+  /// If true, the states are sent after every read cycle and the latest received commands are
+  /// applied before every write cycle.
+  bool enable = false;
+  /// UDP port the commands are received on.
+  uint16_t local_port = 0;
+  /// Host name or IP address of the controller manager importing the interfaces.
+  std::string remote_address = "";
+  /// UDP port of the importing controller manager.
+  uint16_t remote_port = 0;
+  /// Full names of the exported state interfaces, in the order of the importing component.
+  std::vector<std::string> state_interfaces = {};
+  /// Full names of the exported command interfaces, in the order of the importing component. They
+  /// are claimed by the export and can't be claimed by the local controllers.
+  std::vector<std::string> command_interfaces = {};
+};
+
+/**
+ * @brief Parameters of the in-process recorder of the interface values of every cycle, see
+ * hardware_interface::InterfaceFlightRecorder.
+ */
+struct FlightRecorderParams
+{
+  /// If true, the values are recorded into a ring buffer after every read and write cycle.
+  bool enable = false;
+  /// Number of cycles kept in the ring buffer.
+  std::size_t capacity = 10000;
+  /// Full names of the recorded interfaces. If empty, all the interfaces are recorded.
+  std::vector<std::string> interfaces = {};
+  /// If true, the command interfaces are recorded after the state interfaces.
+  bool include_command_interfaces = true;
+  /// File to which all the recorded cycles are appended. Not written if empty.
+  std::string output_file = "";
+  /// Prefix of the files to which the ring buffer is dumped when a hardware component fails.
+  /// No dump is written if empty.
+  std::string dump_file_prefix = "/tmp/ros2_control_flight_recorder";
+};
+
+/**
+ * @brief Parameters of the aggregated publisher of the hardware status messages of all the
+ * components, see hardware_interface::HardwareStatusAggregator.
+ */
+struct HardwareStatusAggregationParams
+{
+  /// If true, the components publish their status through the aggregated publisher.
+  bool enable = false;
+  /// Rate of the aggregated message in Hz, bounding the `status_publish_rate` of the components.
+  double publish_rate = 10.0;
+};
+
+/**
+ * @brief Parameters of the publisher of the state values of all the components, see
+ * hardware_interface::StateSnapshotPublisher.
+ */
+struct StateSnapshotPublisherParams
+{
+  /// If true, the state values are captured after every decimation read cycles and published.
+  bool enable = false;
+  /// Number of read cycles per published snapshot.
+  unsigned int decimation = 1;
+};
+
+/**
+ * @brief Parameters of the list of the edge events of all the components, see
+ * hardware_interface::EdgeEventList.
+ */
+struct EdgeEventParams
+{
+  /// Maximal number of edge events collected in one read cycle, the others are dropped.
+  std::size_t capacity = 1024;
+};
+
 /**
  * @brief Parameters required for the construction and initial setup of a ResourceManager.
  * This struct is typically populated by the ControllerManager.
@@ -103,6 +200,169 @@ struct ResourceManagerParams
    * and will cause the ResourceManager to crash.
    */
   bool handle_exceptions = true;
+
+  /**
+   * @brief If true, the double values of all the hardware component interfaces are stored in one
+   * contiguous, cache-line aligned memory arena instead of inside the individually allocated
+   * handles. This improves the cache locality of the read/update/write cycle for robots with many
+   * interfaces.
+   */
+  bool contiguous_interface_storage = false;
+
+  /**
+   * @brief If true, the state interfaces of type double of all the hardware components are
+   * stored as float32, densely in one cache-line aligned memory arena, halving the memory moved by
+   * the read/update/write cycle. Their data type becomes float32: the typed views of type float
+   * read the values directly, while the accessors of type double used by the legacy hardware
+   * components and controllers convert them from and to float32.
+   */
+  bool float32_state_interface_storage = false;
+
+  /**
+   * @brief Parameters of the worker pool used to read and write the synchronous hardware
+   * components in parallel within the same cycle. The components of a group are read and written
+   * one after the other by the same thread, the groups and the components without group in
+   * parallel. With 0 workers the components are read and written sequentially in the calling
+   * thread.
+   * @note The components are accessed concurrently, so they must not share any unprotected state.
+   */
+  RTWorkerPoolParams read_write_worker_pool;
+
+  /**
+   * @brief Pool shared by the asynchronous hardware components with the synchronized scheduling
+   * policy, instead of one thread per component. If nullptr, every component spawns its thread.
+   */
+  std::shared_ptr<AsyncWorkerPool> async_worker_pool = nullptr;
+
+  /**
+   * @brief Pools of the additional control loops of the controller manager, by loop name. The
+   * asynchronous hardware components with the synchronized scheduling policy and the control_loop
+   * attribute in their async tag run on the pool of their loop instead of async_worker_pool.
+   */
+  std::unordered_map<std::string, std::shared_ptr<AsyncWorkerPool>> control_loop_pools = {};
+
+  /**
+   * @brief Parameters of the export of the interface values into shared memory, for monitoring
+   * or logging tools running in other processes.
+   */
+  SharedMemoryExportParams shared_memory_export;
+
+  /**
+   * @brief Parameters of the export of interfaces to a controller manager running on another
+   * machine.
+   */
+  RemoteInterfaceExportParams remote_interface_export;
+
+  /**
+   * @brief Parameters of the recording of the interface values of the last cycles, e.g., to
+   * analyze the cycles preceding the failure of a hardware component.
+   */
+  FlightRecorderParams flight_recorder;
+
+  /**
+   * @brief Parameters of the publishing of the hardware status messages of all the components
+   * in a single message, instead of one publisher per component. Requires the executor.
+   */
+  HardwareStatusAggregationParams hardware_status_aggregation;
+
+  /**
+   * @brief Parameters of the publishing of the state values of all the components in a single
+   * message, copied from the contiguous interface storage if enabled.
+   */
+  StateSnapshotPublisherParams state_snapshot_publisher;
+
+  /**
+   * @brief Parameters of the edge events pushed by the components and shared with the controllers.
+   */
+  EdgeEventParams edge_events;
+
+  /**
+   * @brief If true, the phases of the hardware components whose rw_rate divides the update rate
+   * are spread over the update cycles, e.g., two 500 Hz components of a 1 kHz controller manager
+   * are read and written in alternate cycles. Otherwise, the components are read and written at
+   * the first cycle and then every update_rate / rw_rate cycles.
+   */
+  bool spread_rate_divider_phases = false;
+
+  /**
+   * @brief Name of the plugin applying the transmissions of the hardware components, e.g.,
+   * "transmission_interface/TransmissionStage". If set, the ResourceManager converts the actuator
+   * states of the transmissions of all synchronous components to joint states right after the
+   * components are read, and the joint commands to actuator commands right before they are
+   * written. The components then must not apply their transmissions themselves. If empty, the
+   * transmissions are left to the components.
+   */
+  std::string transmission_stage_plugin = "";
+
+  /**
+   * @brief If true, the transmission stage binds the transmissions in place to the interfaces of
+   * type double, so the joint states and the actuator commands are computed directly in their
+   * storage, without copying and locking them. Only to be set if these interfaces aren't accessed
+   * by other threads than the control loop, e.g., by asynchronous controllers, the shared memory
+   * export or the flight recorder.
+   */
+  bool transmission_stage_in_place = false;
+
+  /**
+   * @brief Directory of the cache of the hardware infos parsed from the robot description. If
+   * set, the hardware infos and joint limits of a robot description are stored in a binary file
+   * keyed by a hash of the URDF, and loaded from it instead of parsing the URDF again, e.g., when
+   * the controller manager is restarted. If empty, the URDF is always parsed.
+   */
+  std::string hardware_info_cache_directory = "";
+
+  /**
+   * @brief Names of the components initialized by a warm restart of the controller manager, see
+   * HardwareComponentInterfaceParams::warm_restart.
+   */
+  std::vector<std::string> warm_restart_components = {};
+
+  /**
+   * @brief Number of threads initializing the hardware components when they are loaded. With
+   * more than one thread, the plugins are still loaded in the order of the robot description, but
+   * the on_init of the components of different groups, or without group, run concurrently. The
+   * components of the same group are initialized one after the other. With 0 or 1 thread, the
+   * components are loaded and initialized one after the other. The same number of threads sets
+   * the components concurrently in ResourceManager::set_components_state, and prepares their
+   * command mode switches in ResourceManager::prepare_command_mode_switch.
+   * @note The on_init and the lifecycle transitions of concurrently initialized components must
+   * not share unprotected state.
+   */
+  unsigned int component_initialization_threads = 0;
+
+  /**
+   * @brief Maximum time in seconds a hardware component may take to prepare a command mode
+   * switch. A component taking longer rejects the switch, which is then aborted. The preparation
+   * is not interrupted, the timeout is checked once it returns. Disabled if 0.
+   */
+  double command_mode_switch_prepare_timeout = 0.0;
+
+  /**
+   * @brief Size in bytes of the pre-faulted and locked memory arena of every hardware component,
+   * see HardwareComponentInterface::get_memory_resource. Disabled if 0.
+   */
+  std::size_t memory_arena_size = 0;
+
+  /**
+   * @brief Bytes of the stack of the threads of the resource manager and of the asynchronous
+   * components prefaulted when they start, see RealtimeThreadParams::stack_prefault_size. The
+   * threads of read_write_worker_pool use its own stack_prefault_size.
+   */
+  std::size_t thread_stack_prefault_size = 0;
+
+  /**
+   * @brief If true, the error and deactivation transitions of the hardware components caused by
+   * their read and write are run by a thread of the ResourceManager instead of the control loop,
+   * see ResourceManager::run_requested_transitions.
+   */
+  bool defer_control_loop_transitions = false;
+
+  /**
+   * @brief Patterns of the names of the state and command interfaces registered for
+   * introspection, see ResourceManager::set_introspected_interfaces. All the interfaces are
+   * registered by default.
+   */
+  std::vector<std::string> introspected_interfaces = {"*"};
 };
 
 }  // namespace hardware_interface
@@ -18,21 +18,482 @@
 #define HARDWARE_INTERFACE__TYPES__STATISTICS_TYPES_HPP_
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
-#include "hardware_interface/introspection.hpp"
+#include "hardware_interface/lexical_casts.hpp"
+#include "hardware_interface/performance_counters.hpp"
 #include "libstatistics_collector/moving_average_statistics/moving_average.hpp"
 #include "libstatistics_collector/moving_average_statistics/types.hpp"
-#if !defined(_WIN32) && !defined(__APPLE__)
-#include "realtime_tools/mutex.hpp"
-#define DEFAULT_MUTEX realtime_tools::prio_inherit_mutex
-#else
-#define DEFAULT_MUTEX std::mutex
-#endif
 
 namespace ros2_control
 {
+/// Percentiles of the measurements of a LatencyHistogram, NaN if no observations have been made
+struct LatencyPercentiles
+{
+  double p50 = std::numeric_limits<double>::quiet_NaN();
+  double p99 = std::numeric_limits<double>::quiet_NaN();
+  double p99_9 = std::numeric_limits<double>::quiet_NaN();
+  double p99_99 = std::numeric_limits<double>::quiet_NaN();
+};
+
+/**
+ *  A constant memory, lock-free histogram with logarithmic buckets, in the spirit of the HDR
+ * histograms, for calculating the percentiles of the measurements.
+ *
+ *  Every power of two between 2^(MIN_EXPONENT - 1) and 2^(MIN_EXPONENT + NUMBER_OF_EXPONENTS - 1)
+ * is split into NUMBER_OF_SUB_BUCKETS linear buckets, so the relative error of the percentiles is
+ * below 1 / (2 * NUMBER_OF_SUB_BUCKETS). The measurements outside of this range are counted in the
+ * first and the last bucket.
+ *
+ *  The measurements are added with relaxed atomic increments, so a single writer never blocks and
+ * readers may run concurrently, observing a slightly outdated set of measurements.
+ */
+class LatencyHistogram
+{
+public:
+  static constexpr int MIN_EXPONENT = -8;
+  static constexpr std::size_t NUMBER_OF_EXPONENTS = 40;
+  static constexpr std::size_t NUMBER_OF_SUB_BUCKETS = 32;
+
+  LatencyHistogram() { reset(); }
+
+  /**
+   *  Adds a measurement to the histogram, non-finite values are discarded.
+   *
+   *  @param item The item that was observed
+   */
+  void add_measurement(const double item) noexcept
+  {
+    if (!std::isfinite(item))
+    {
+      return;
+    }
+    std::size_t exponent_index = 0;
+    std::size_t sub_bucket_index = 0;
+    get_bucket_index(item, exponent_index, sub_bucket_index);
+    buckets_[exponent_index][sub_bucket_index].fetch_add(1, std::memory_order_relaxed);
+    exponent_counts_[exponent_index].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   *  Removes a measurement previously added to the histogram, e.g., when it leaves a sliding
+   * window. Non-finite values are discarded, as they were never added.
+   *
+   *  @param item The item that was observed
+   */
+  void remove_measurement(const double item) noexcept
+  {
+    if (!std::isfinite(item))
+    {
+      return;
+    }
+    std::size_t exponent_index = 0;
+    std::size_t sub_bucket_index = 0;
+    get_bucket_index(item, exponent_index, sub_bucket_index);
+    buckets_[exponent_index][sub_bucket_index].fetch_sub(1, std::memory_order_relaxed);
+    exponent_counts_[exponent_index].fetch_sub(1, std::memory_order_relaxed);
+    count_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  /**
+   *  Returns the value below which the given percentage of the measurements fall. If no
+   * observations have been made, returns NaN.
+   *
+   *  @param percentile The percentage of the measurements, in [0, 100]
+   *  @return The center of the bucket holding the percentile, or NaN if the sample count is 0.
+   */
+  double get_percentile(const double percentile) const noexcept
+  {
+    const uint64_t count = count_.load(std::memory_order_relaxed);
+    if (count == 0)
+    {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    const double clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+    const uint64_t rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(clamped_percentile / 100.0 * static_cast<double>(count))));
+    uint64_t cumulative_count = 0;
+    double last_value = get_bucket_value(0, 0);
+    for (std::size_t e = 0; e < NUMBER_OF_EXPONENTS; ++e)
+    {
+      const uint64_t exponent_count = exponent_counts_[e].load(std::memory_order_relaxed);
+      if (exponent_count == 0)
+      {
+        continue;
+      }
+      if (cumulative_count + exponent_count < rank)
+      {
+        cumulative_count += exponent_count;
+        last_value = get_bucket_value(e, NUMBER_OF_SUB_BUCKETS - 1);
+        continue;
+      }
+      for (std::size_t s = 0; s < NUMBER_OF_SUB_BUCKETS; ++s)
+      {
+        const uint64_t bucket_count = buckets_[e][s].load(std::memory_order_relaxed);
+        if (bucket_count == 0)
+        {
+          continue;
+        }
+        cumulative_count += bucket_count;
+        last_value = get_bucket_value(e, s);
+        if (cumulative_count >= rank)
+        {
+          return last_value;
+        }
+      }
+    }
+    // only reached while measurements are added concurrently
+    return last_value;
+  }
+
+  /// Returns the 50th, 99th, 99.9th and 99.99th percentiles of the measurements.
+  LatencyPercentiles get_percentiles() const noexcept
+  {
+    LatencyPercentiles percentiles;
+    percentiles.p50 = get_percentile(50.0);
+    percentiles.p99 = get_percentile(99.0);
+    percentiles.p99_9 = get_percentile(99.9);
+    percentiles.p99_99 = get_percentile(99.99);
+    return percentiles;
+  }
+
+  /// Returns the number of measurements in the histogram.
+  uint64_t get_count() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+  /// Removes all the measurements from the histogram.
+  void reset() noexcept
+  {
+    for (auto & exponent_buckets : buckets_)
+    {
+      for (auto & bucket : exponent_buckets)
+      {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+    for (auto & exponent_count : exponent_counts_)
+    {
+      exponent_count.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+  }
+
+  /// Returns the value in the center of the given bucket.
+  static double get_bucket_value(std::size_t exponent_index, std::size_t sub_bucket_index) noexcept
+  {
+    return std::ldexp(
+      0.5 + (static_cast<double>(sub_bucket_index) + 0.5) / (2.0 * NUMBER_OF_SUB_BUCKETS),
+      static_cast<int>(exponent_index) + MIN_EXPONENT);
+  }
+
+private:
+  /// Returns the bucket of a finite measurement
+  static void get_bucket_index(
+    const double item, std::size_t & exponent_index, std::size_t & sub_bucket_index) noexcept
+  {
+    exponent_index = 0;
+    sub_bucket_index = 0;
+    if (item > 0.0)
+    {
+      int exponent = 0;
+      const double mantissa = std::frexp(item, &exponent);
+      if (exponent >= MIN_EXPONENT + static_cast<int>(NUMBER_OF_EXPONENTS))
+      {
+        exponent_index = NUMBER_OF_EXPONENTS - 1;
+        sub_bucket_index = NUMBER_OF_SUB_BUCKETS - 1;
+      }
+      else if (exponent >= MIN_EXPONENT)
+      {
+        exponent_index = static_cast<std::size_t>(exponent - MIN_EXPONENT);
+        // the mantissa is in [0.5, 1)
+        sub_bucket_index = std::min(
+          NUMBER_OF_SUB_BUCKETS - 1,
+          static_cast<std::size_t>((mantissa - 0.5) * 2.0 * NUMBER_OF_SUB_BUCKETS));
+      }
+    }
+  }
+
+  std::array<std::array<std::atomic<uint64_t>, NUMBER_OF_SUB_BUCKETS>, NUMBER_OF_EXPONENTS>
+    buckets_;
+  /// Number of measurements per power of two, to skip the empty ranges when searching a percentile
+  std::array<std::atomic<uint64_t>, NUMBER_OF_EXPONENTS> exponent_counts_;
+  std::atomic<uint64_t> count_{0};
+};
+
+/**
+ *  Snapshot of statistics shared between the thread updating them and the threads reading them,
+ * protected by a sequence lock.
+ *
+ *  The writer never waits for the readers, which retry their copy if it was concurrently modified.
+ * The values are stored in relaxed atomics, so the concurrent accesses are well defined. There is a
+ * single writer, the other threads request a reset with request_reset(), which the writer applies
+ * at its next write, so it never waits for them.
+ */
+class StatisticsSnapshot
+{
+public:
+  using StatisticData = libstatistics_collector::moving_average_statistics::StatisticData;
+
+  /// Returns the statistics without measurements.
+  static StatisticData get_empty_statistics() noexcept
+  {
+    StatisticData statistics;
+    statistics.average = std::numeric_limits<double>::quiet_NaN();
+    statistics.min = std::numeric_limits<double>::quiet_NaN();
+    statistics.max = std::numeric_limits<double>::quiet_NaN();
+    statistics.standard_deviation = std::numeric_limits<double>::quiet_NaN();
+    statistics.sample_count = 0;
+    return statistics;
+  }
+
+  /// Values of the snapshot
+  struct Data
+  {
+    StatisticData statistics = get_empty_statistics();
+    double current_measurement = std::numeric_limits<double>::quiet_NaN();
+    LatencyPercentiles percentiles;
+  };
+
+  StatisticsSnapshot() { store(Data()); }
+
+  /// Starts a modification of the snapshot, must only be called by the writer.
+  void begin_write() noexcept
+  {
+    sequence_.store(sequence_.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+    // the stores of the values must not become visible before the odd sequence
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  /// Publishes the modification started by begin_write().
+  void end_write() noexcept
+  {
+    sequence_.store(sequence_.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+  }
+
+  /// Requests the writer to reset the values at its next write, can be called from any thread.
+  /**
+   * Until the writer applies the reset, the readers get the values of a default Data.
+   */
+  void request_reset() noexcept { reset_requested_.store(true, std::memory_order_release); }
+
+  /// Returns true if a reset was requested and not applied by the writer yet.
+  bool is_reset_requested() const noexcept
+  {
+    return reset_requested_.load(std::memory_order_acquire);
+  }
+
+  /// Clears the reset request, returns true if there was one.
+  /**
+   * Must be called by the writer between begin_write() and end_write(), the writer then resets its
+   * values before storing them.
+   */
+  bool take_reset_request() noexcept
+  {
+    return reset_requested_.load(std::memory_order_relaxed) &&
+           reset_requested_.exchange(false, std::memory_order_acq_rel);
+  }
+
+  /// Stores the values, must be called between begin_write() and end_write().
+  void store(const Data & data) noexcept
+  {
+    average_.store(data.statistics.average, std::memory_order_relaxed);
+    min_.store(data.statistics.min, std::memory_order_relaxed);
+    max_.store(data.statistics.max, std::memory_order_relaxed);
+    standard_deviation_.store(data.statistics.standard_deviation, std::memory_order_relaxed);
+    sample_count_.store(data.statistics.sample_count, std::memory_order_relaxed);
+    current_measurement_.store(data.current_measurement, std::memory_order_relaxed);
+    p50_.store(data.percentiles.p50, std::memory_order_relaxed);
+    p99_.store(data.percentiles.p99, std::memory_order_relaxed);
+    p99_9_.store(data.percentiles.p99_9, std::memory_order_relaxed);
+    p99_99_.store(data.percentiles.p99_99, std::memory_order_relaxed);
+  }
+
+  /// Returns a consistent copy of the values, never blocks the writer.
+  Data load() const noexcept
+  {
+    Data data;
+    // the request is cleared by the writer once its values are reset, before they are published
+    if (is_reset_requested())
+    {
+      return data;
+    }
+    uint32_t sequence_begin = 0;
+    uint32_t sequence_end = 0;
+    do
+    {
+      sequence_begin = sequence_.load(std::memory_order_acquire);
+      data.statistics.average = average_.load(std::memory_order_relaxed);
+      data.statistics.min = min_.load(std::memory_order_relaxed);
+      data.statistics.max = max_.load(std::memory_order_relaxed);
+      data.statistics.standard_deviation = standard_deviation_.load(std::memory_order_relaxed);
+      data.statistics.sample_count = sample_count_.load(std::memory_order_relaxed);
+      data.current_measurement = current_measurement_.load(std::memory_order_relaxed);
+      data.percentiles.p50 = p50_.load(std::memory_order_relaxed);
+      data.percentiles.p99 = p99_.load(std::memory_order_relaxed);
+      data.percentiles.p99_9 = p99_9_.load(std::memory_order_relaxed);
+      data.percentiles.p99_99 = p99_99_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      sequence_end = sequence_.load(std::memory_order_relaxed);
+    } while ((sequence_begin & 1u) != 0u || sequence_begin != sequence_end);
+    return data;
+  }
+
+  /// Returns the sample count of the snapshot, never blocks the writer.
+  uint64_t get_count() const noexcept
+  {
+    return is_reset_requested() ? 0u : sample_count_.load(std::memory_order_relaxed);
+  }
+
+private:
+  /// Odd while the writer modifies the values
+  std::atomic<uint32_t> sequence_{0};
+  /// Set by request_reset(), cleared by the writer
+  std::atomic_bool reset_requested_{false};
+  std::atomic<double> average_;
+  std::atomic<double> min_;
+  std::atomic<double> max_;
+  std::atomic<double> standard_deviation_;
+  std::atomic<uint64_t> sample_count_;
+  std::atomic<double> current_measurement_;
+  std::atomic<double> p50_;
+  std::atomic<double> p99_;
+  std::atomic<double> p99_9_;
+  std::atomic<double> p99_99_;
+};
+
+/// Window over which a MovingAverageStatistics calculates its statistics.
+enum class StatisticsType : std::uint8_t
+{
+  /// All the measurements since the last reset()
+  CUMULATIVE,
+  /// The last measurements, limited by their number and their age
+  SLIDING_WINDOW,
+  /// All the measurements, weighted by an exponential decay with their age
+  EXPONENTIAL_DECAY
+};
+
+/// Configuration of the window of a MovingAverageStatistics.
+struct StatisticsConfig
+{
+  /// Maximal number of samples of a SLIDING_WINDOW limited by its duration only
+  static constexpr std::size_t DEFAULT_WINDOW_CAPACITY = 10000;
+
+  StatisticsType type = StatisticsType::CUMULATIVE;
+  /// Maximal number of samples of a SLIDING_WINDOW
+  std::size_t window_size = 0;
+  /// Maximal age in seconds of the samples of a SLIDING_WINDOW, 0 if not limited
+  double window_duration = 0.0;
+  /// Half-life of an EXPONENTIAL_DECAY, in samples, or in seconds if half_life_is_duration is true
+  double half_life = 0.0;
+  bool half_life_is_duration = false;
+
+  /// Returns true if the measurements have to be timestamped.
+  bool uses_time() const noexcept
+  {
+    return (type == StatisticsType::SLIDING_WINDOW && window_duration > 0.0) ||
+           (type == StatisticsType::EXPONENTIAL_DECAY && half_life_is_duration);
+  }
+};
+
+/// Parses a StatisticsConfig: "cumulative", "window:<limits>" or "ewma:<half-life>".
+/**
+ * The limits of a window are a number of samples, e.g., "window:1000", a duration in seconds
+ * suffixed by "s", e.g., "window:2.5s", or both separated by a comma, e.g., "window:1000,2.5s". A
+ * window limited by its duration only holds at most StatisticsConfig::DEFAULT_WINDOW_CAPACITY
+ * samples. The half-life of an ewma is a number of samples, e.g., "ewma:100", or a duration in
+ * seconds, e.g., "ewma:0.5s".
+ *
+ * \throws std::invalid_argument if the configuration is not valid.
+ */
+inline StatisticsConfig parse_statistics_config(const std::string & config)
+{
+  const auto invalid = [&config]()
+  {
+    return std::invalid_argument(
+      "Invalid statistics type '" + config +
+      "', expected 'cumulative', 'window:<samples>', 'window:<seconds>s', "
+      "'window:<samples>,<seconds>s', 'ewma:<samples>' or 'ewma:<seconds>s'.");
+  };
+  // parses a positive number of samples, or a positive duration suffixed by "s"
+  const auto parse_limit = [&invalid](std::string limit, bool & is_duration)
+  {
+    is_duration = !limit.empty() && limit.back() == 's';
+    if (is_duration)
+    {
+      limit.pop_back();
+    }
+    const auto value = hardware_interface::try_stod(limit);
+    if (!value || !std::isfinite(*value) || *value <= 0.0)
+    {
+      throw invalid();
+    }
+    return *value;
+  };
+
+  StatisticsConfig statistics_config;
+  if (config.empty() || config == "cumulative")
+  {
+    return statistics_config;
+  }
+  const auto separator = config.find(':');
+  if (separator == std::string::npos)
+  {
+    throw invalid();
+  }
+  const std::string type = config.substr(0, separator);
+  const std::string arguments = config.substr(separator + 1);
+  if (type == "window")
+  {
+    statistics_config.type = StatisticsType::SLIDING_WINDOW;
+    std::size_t start = 0;
+    while (start <= arguments.size())
+    {
+      const auto end = std::min(arguments.find(',', start), arguments.size());
+      bool is_duration = false;
+      const double value = parse_limit(arguments.substr(start, end - start), is_duration);
+      if (is_duration && statistics_config.window_duration == 0.0)
+      {
+        statistics_config.window_duration = value;
+      }
+      else if (
+        !is_duration && statistics_config.window_size == 0 && value == std::floor(value) &&
+        value <= static_cast<double>(std::numeric_limits<uint32_t>::max()))
+      {
+        statistics_config.window_size = static_cast<std::size_t>(value);
+      }
+      else
+      {
+        throw invalid();
+      }
+      start = end + 1;
+    }
+    if (statistics_config.window_size == 0)
+    {
+      statistics_config.window_size = StatisticsConfig::DEFAULT_WINDOW_CAPACITY;
+    }
+  }
+  else if (type == "ewma")
+  {
+    statistics_config.type = StatisticsType::EXPONENTIAL_DECAY;
+    statistics_config.half_life = parse_limit(arguments, statistics_config.half_life_is_duration);
+  }
+  else
+  {
+    throw invalid();
+  }
+  return statistics_config;
+}
+
 /**
  *  A class for calculating moving average statistics. This operates in constant memory and constant
  * time. Note: reset() must be called manually in order to start a new measurement window.
@@ -43,6 +504,21 @@ namespace ros2_control
  * https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Welford%27s_online_algorithm)
  *  for standard deviation.
  *
+ *  The measurements are also added to a LatencyHistogram, to provide the percentiles of the
+ * measurements of the window.
+ *
+ *  With configure(), the statistics can instead be calculated over a sliding window of the last
+ * samples, or with an exponential decay of the weight of the older samples, so that a spike or a
+ * regression is forgotten or noticed without reset(). In a sliding window, the samples leaving the
+ * window are removed from the running average, the variance and the histogram, and the minimum
+ * and the maximum are tracked with monotonic queues, in amortized constant time. With an
+ * exponential decay, the average and the variance are exponentially weighted, the minimum and the
+ * maximum are envelopes decaying towards the average at the same rate, and the percentiles are the
+ * ones of all the samples since the last reset().
+ *
+ *  The measurements are meant to be added by a single thread, usually the real-time loop. The
+ * getters returning copies read a StatisticsSnapshot, so the readers never block the writer.
+ *
  *  When statistics are not available, e.g. no observations have been made, NaNs are returned.
  */
 class MovingAverageStatistics
@@ -53,39 +529,65 @@ public:
 
   ~MovingAverageStatistics() = default;
 
+  /**
+   *  Sets the window of the statistics and resets them. This allocates the buffers of a sliding
+   * window, so it must not be called from the real-time loop, nor concurrently with
+   * add_measurement().
+   *
+   *  @param config The window of the statistics
+   *  @throws std::invalid_argument if a sliding window has no samples or an exponential decay has
+   * no half-life.
+   */
+  void configure(const StatisticsConfig & config)
+  {
+    if (config.type == StatisticsType::SLIDING_WINDOW && config.window_size == 0)
+    {
+      throw std::invalid_argument("A sliding window of statistics needs at least one sample.");
+    }
+    if (
+      config.type == StatisticsType::EXPONENTIAL_DECAY &&
+      !(std::isfinite(config.half_life) && config.half_life > 0.0))
+    {
+      throw std::invalid_argument("An exponential decay of statistics needs a positive half-life.");
+    }
+    config_ = config;
+    const std::size_t capacity =
+      config_.type == StatisticsType::SLIDING_WINDOW ? config_.window_size : 0;
+    window_values_.assign(capacity, 0.0);
+    window_times_.assign(capacity, std::chrono::steady_clock::time_point());
+    window_min_sequences_.assign(capacity, 0);
+    window_max_sequences_.assign(capacity, 0);
+    // nothing is added concurrently, so the reset is applied at once
+    snapshot_.begin_write();
+    snapshot_.take_reset_request();
+    clear();
+    publish_snapshot();
+  }
+
+  /// Returns the window of the statistics.
+  const StatisticsConfig & get_config() const { return config_; }
+
   /**
    *  Returns the arithmetic mean of all data recorded. If no observations have been made, returns
    * NaN.
    *
    *  @return The arithmetic mean of all data recorded, or NaN if the sample count is 0.
    */
-  double get_average() const
-  {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return statistics_data_.average;
-  }
+  double get_average() const { return snapshot_.load().statistics.average; }
 
   /**
    *  Returns the maximum value recorded. If size of list is zero, returns NaN.
    *
    *  @return The maximum value recorded, or NaN if size of data is zero.
    */
-  double get_max() const
-  {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return statistics_data_.max;
-  }
+  double get_max() const { return snapshot_.load().statistics.max; }
 
   /**
    *  Returns the minimum value recorded. If size of list is zero, returns NaN.
    *
    *  @return The minimum value recorded, or NaN if size of data is zero.
    */
-  double get_min() const
-  {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return statistics_data_.min;
-  }
+  double get_min() const { return snapshot_.load().statistics.min; }
 
   /**
    *  Returns the standard deviation (population) of all data recorded. If size of list is zero,
@@ -98,97 +600,127 @@ public:
    *  @return The standard deviation (population) of all data recorded, or NaN if size of data is
    * zero.
    */
-  double get_standard_deviation() const
-  {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return statistics_data_.standard_deviation;
-  }
+  double get_standard_deviation() const { return snapshot_.load().statistics.standard_deviation; }
 
   /**
    *  Return a StatisticData object, containing average, minimum, maximum, standard deviation
    * (population), and sample count. For the case of no observations, the average, min, max, and
    * standard deviation are NaN.
    *
+   *  The returned reference is the data of the writer, it is meant to be registered in the
+   * introspection registry sampled by the thread adding the measurements. Other threads should use
+   * get_statistics().
+   *
    *  @return StatisticData object, containing average, minimum, maximum, standard deviation
    * (population), and sample count.
    */
-  const StatisticData & get_statistics_const_ptr() const
-  {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return statistics_data_;
-  }
+  const StatisticData & get_statistics_const_ptr() const { return statistics_data_; }
 
-  StatisticData get_statistics() const
-  {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return statistics_data_;
-  }
+  StatisticData get_statistics() const { return snapshot_.load().statistics; }
 
   /**
    *  Get the current measurement value.
    *  This is the last value added to the statistics collector.
    *
+   *  The returned reference is the data of the writer, see get_statistics_const_ptr().
+   *
    *  @return The current measurement value, or NaN if no measurements have been made.
    */
-  const double & get_current_measurement_const_ptr() const
+  const double & get_current_measurement_const_ptr() const { return current_measurement_; }
+
+  double get_current_measurement() const { return snapshot_.load().current_measurement; }
+
+  /**
+   *  Returns the value below which the given percentage of the measurements fall, see
+   * LatencyHistogram::get_percentile().
+   *
+   *  @param percentile The percentage of the measurements, in [0, 100]
+   *  @return The percentile of the measurements, or NaN if the sample count is 0.
+   */
+  double get_percentile(const double percentile) const
   {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return current_measurement_;
+    return snapshot_.is_reset_requested() ? std::numeric_limits<double>::quiet_NaN()
+                                          : histogram_.get_percentile(percentile);
   }
 
-  double get_current_measurement() const
+  /// Returns the 50th, 99th, 99.9th and 99.99th percentiles of the measurements.
+  LatencyPercentiles get_percentiles() const
   {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return current_measurement_;
+    return snapshot_.is_reset_requested() ? LatencyPercentiles() : histogram_.get_percentiles();
   }
 
+  /// Returns the histogram of the measurements, it can be read without locking.
+  /**
+   * A requested reset() is only applied to the histogram by the next measurement.
+   */
+  const LatencyHistogram & get_histogram() const { return histogram_; }
+
   /**
    *  Reset all calculated values. Equivalent to a new window for a moving average.
+   *
+   *  It can be called from any thread, the reset is applied by the thread adding the measurements
+   * at its next measurement, so that it never waits for the caller. The getters meanwhile return
+   * the values of statistics without measurements.
    */
-  void reset()
-  {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    statistics_data_.average = 0.0;
-    statistics_data_.min = std::numeric_limits<double>::max();
-    statistics_data_.max = std::numeric_limits<double>::lowest();
-    statistics_data_.standard_deviation = 0.0;
-    statistics_data_.sample_count = 0;
-    current_measurement_ = std::numeric_limits<double>::quiet_NaN();
-    sum_of_square_diff_from_mean_ = 0;
-  }
+  void reset() { snapshot_.request_reset(); }
 
   void reset_current_measurement()
   {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
+    snapshot_.begin_write();
+    if (snapshot_.take_reset_request())
+    {
+      clear();
+    }
     current_measurement_ = 0.0;
+    publish_snapshot();
   }
 
   /**
    *  Observe a sample for the given window. The input item is used to calculate statistics.
    *  Note: any input values of NaN will be discarded and not added as a measurement.
    *
+   *  The steady clock is only read if the window of the statistics is limited by a duration.
+   *
    *  @param item The item that was observed
    */
   void add_measurement(const double item)
   {
-    std::lock_guard<DEFAULT_MUTEX> guard{mutex_};
+    add_measurement(
+      item, config_.uses_time() ? std::chrono::steady_clock::now()
+                                : std::chrono::steady_clock::time_point());
+  }
 
+  /**
+   *  Observe a sample at the given time, see add_measurement(). The time is only used by the
+   * windows limited by a duration, and must not decrease between the samples.
+   *
+   *  @param item The item that was observed
+   *  @param time The time at which the item was observed
+   */
+  void add_measurement(const double item, const std::chrono::steady_clock::time_point time)
+  {
+    snapshot_.begin_write();
+    if (snapshot_.take_reset_request())
+    {
+      clear();
+    }
     current_measurement_ = item;
     if (std::isfinite(item))
     {
-      statistics_data_.sample_count = statistics_data_.sample_count + 1;
-      const double previous_average = statistics_data_.average;
-      statistics_data_.average =
-        previous_average + (current_measurement_ - previous_average) /
-                             static_cast<double>(statistics_data_.sample_count);
-      statistics_data_.min = std::min(statistics_data_.min, current_measurement_);
-      statistics_data_.max = std::max(statistics_data_.max, current_measurement_);
-      sum_of_square_diff_from_mean_ =
-        sum_of_square_diff_from_mean_ + (current_measurement_ - previous_average) *
-                                          (current_measurement_ - statistics_data_.average);
-      statistics_data_.standard_deviation = std::sqrt(
-        sum_of_square_diff_from_mean_ / static_cast<double>(statistics_data_.sample_count));
+      switch (config_.type)
+      {
+        case StatisticsType::CUMULATIVE:
+          add_cumulative_measurement(item);
+          break;
+        case StatisticsType::SLIDING_WINDOW:
+          add_window_measurement(item, time);
+          break;
+        case StatisticsType::EXPONENTIAL_DECAY:
+          add_decaying_measurement(item, time);
+          break;
+      }
     }
+    publish_snapshot();
   }
 
   /**
@@ -196,22 +728,216 @@ public:
    *
    * @return the number of samples observed
    */
-  uint64_t get_count() const
+  uint64_t get_count() const { return snapshot_.get_count(); }
+
+private:
+  /// Resets the data of the writer, the caller publishes it
+  void clear() noexcept
   {
-    std::lock_guard<DEFAULT_MUTEX> lock(mutex_);
-    return statistics_data_.sample_count;
+    statistics_data_.average = 0.0;
+    statistics_data_.min = std::numeric_limits<double>::max();
+    statistics_data_.max = std::numeric_limits<double>::lowest();
+    statistics_data_.standard_deviation = 0.0;
+    statistics_data_.sample_count = 0;
+    current_measurement_ = std::numeric_limits<double>::quiet_NaN();
+    sum_of_square_diff_from_mean_ = 0;
+    histogram_.reset();
+    window_begin_ = 0;
+    window_end_ = 0;
+    window_min_begin_ = 0;
+    window_min_end_ = 0;
+    window_max_begin_ = 0;
+    window_max_end_ = 0;
+    last_measurement_time_ = std::chrono::steady_clock::time_point();
   }
 
-private:
-  mutable DEFAULT_MUTEX mutex_;
+  void add_cumulative_measurement(const double item)
+  {
+    statistics_data_.sample_count = statistics_data_.sample_count + 1;
+    const double previous_average = statistics_data_.average;
+    statistics_data_.average =
+      previous_average + (item - previous_average) /
+                           static_cast<double>(statistics_data_.sample_count);
+    statistics_data_.min = std::min(statistics_data_.min, item);
+    statistics_data_.max = std::max(statistics_data_.max, item);
+    sum_of_square_diff_from_mean_ =
+      sum_of_square_diff_from_mean_ + (item - previous_average) * (item - statistics_data_.average);
+    statistics_data_.standard_deviation =
+      std::sqrt(sum_of_square_diff_from_mean_ / static_cast<double>(statistics_data_.sample_count));
+    histogram_.add_measurement(item);
+  }
+
+  void add_window_measurement(const double item, const std::chrono::steady_clock::time_point time)
+  {
+    const std::size_t capacity = window_values_.size();
+    // the samples are identified by a sequence number, their slot is the number modulo capacity
+    if (config_.window_duration > 0.0)
+    {
+      const auto oldest_time =
+        time - std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                 std::chrono::duration<double>(config_.window_duration));
+      while (window_begin_ != window_end_ && window_times_[window_begin_ % capacity] < oldest_time)
+      {
+        remove_oldest_window_measurement();
+      }
+    }
+    if (window_end_ - window_begin_ == capacity)
+    {
+      remove_oldest_window_measurement();
+    }
+    const uint64_t sequence = window_end_++;
+    window_values_[sequence % capacity] = item;
+    window_times_[sequence % capacity] = time;
+
+    // Welford's algorithm, also used in reverse when a sample leaves the window
+    const uint64_t count = window_end_ - window_begin_;
+    const double previous_average = statistics_data_.average;
+    statistics_data_.average =
+      previous_average + (item - previous_average) / static_cast<double>(count);
+    sum_of_square_diff_from_mean_ += (item - previous_average) * (item - statistics_data_.average);
+
+    // the queues hold the sequences of the samples that can still become the minimum / maximum
+    while (window_min_end_ != window_min_begin_ &&
+           get_window_value(window_min_sequences_[(window_min_end_ - 1) % capacity]) >= item)
+    {
+      --window_min_end_;
+    }
+    window_min_sequences_[window_min_end_++ % capacity] = sequence;
+    while (window_max_end_ != window_max_begin_ &&
+           get_window_value(window_max_sequences_[(window_max_end_ - 1) % capacity]) <= item)
+    {
+      --window_max_end_;
+    }
+    window_max_sequences_[window_max_end_++ % capacity] = sequence;
+
+    histogram_.add_measurement(item);
+    update_window_statistics();
+  }
+
+  void remove_oldest_window_measurement()
+  {
+    const std::size_t capacity = window_values_.size();
+    const uint64_t sequence = window_begin_++;
+    const double item = get_window_value(sequence);
+    const uint64_t count = window_end_ - window_begin_;
+    if (count == 0)
+    {
+      statistics_data_.average = 0.0;
+      sum_of_square_diff_from_mean_ = 0.0;
+    }
+    else
+    {
+      const double previous_average = statistics_data_.average;
+      statistics_data_.average =
+        previous_average + (previous_average - item) / static_cast<double>(count);
+      // rounding errors must not make the variance negative
+      const double square_diff = (item - previous_average) * (item - statistics_data_.average);
+      sum_of_square_diff_from_mean_ = std::max(0.0, sum_of_square_diff_from_mean_ - square_diff);
+    }
+    if (window_min_sequences_[window_min_begin_ % capacity] == sequence)
+    {
+      ++window_min_begin_;
+    }
+    if (window_max_sequences_[window_max_begin_ % capacity] == sequence)
+    {
+      ++window_max_begin_;
+    }
+    histogram_.remove_measurement(item);
+  }
+
+  double get_window_value(const uint64_t sequence) const
+  {
+    return window_values_[sequence % window_values_.size()];
+  }
+
+  void update_window_statistics()
+  {
+    const std::size_t capacity = window_values_.size();
+    const uint64_t count = window_end_ - window_begin_;
+    statistics_data_.sample_count = count;
+    statistics_data_.min = get_window_value(window_min_sequences_[window_min_begin_ % capacity]);
+    statistics_data_.max = get_window_value(window_max_sequences_[window_max_begin_ % capacity]);
+    statistics_data_.standard_deviation =
+      std::sqrt(sum_of_square_diff_from_mean_ / static_cast<double>(count));
+  }
+
+  void add_decaying_measurement(const double item, const std::chrono::steady_clock::time_point time)
+  {
+    histogram_.add_measurement(item);
+    if (statistics_data_.sample_count == 0)
+    {
+      statistics_data_.sample_count = 1;
+      statistics_data_.average = item;
+      statistics_data_.min = item;
+      statistics_data_.max = item;
+      statistics_data_.standard_deviation = 0.0;
+      sum_of_square_diff_from_mean_ = 0.0;
+      last_measurement_time_ = time;
+      return;
+    }
+    double age = 1.0;
+    if (config_.half_life_is_duration)
+    {
+      age = std::max(0.0, std::chrono::duration<double>(time - last_measurement_time_).count());
+      last_measurement_time_ = time;
+    }
+    // weight of the new sample, the weight of the older ones is halved every half-life
+    const double alpha = 1.0 - std::exp2(-age / config_.half_life);
+    statistics_data_.sample_count = statistics_data_.sample_count + 1;
+    // the exponentially weighted variance is stored in sum_of_square_diff_from_mean_
+    const double difference = item - statistics_data_.average;
+    const double increment = alpha * difference;
+    statistics_data_.average += increment;
+    sum_of_square_diff_from_mean_ =
+      (1.0 - alpha) * (sum_of_square_diff_from_mean_ + difference * increment);
+    statistics_data_.standard_deviation = std::sqrt(sum_of_square_diff_from_mean_);
+    statistics_data_.min = std::min(
+      item, statistics_data_.min + alpha * (statistics_data_.average - statistics_data_.min));
+    statistics_data_.max = std::max(
+      item, statistics_data_.max - alpha * (statistics_data_.max - statistics_data_.average));
+  }
+
+  /// Copies the data of the writer to the snapshot and ends the write started by the caller
+  void publish_snapshot() noexcept
+  {
+    StatisticsSnapshot::Data data;
+    // the statistics without measurements are NaN, as before the writer applies a reset
+    if (statistics_data_.sample_count > 0)
+    {
+      data.statistics = statistics_data_;
+    }
+    data.current_measurement = current_measurement_;
+    snapshot_.store(data);
+    snapshot_.end_write();
+  }
+
+  StatisticsSnapshot snapshot_;
   StatisticData statistics_data_;
   double current_measurement_ = std::numeric_limits<double>::quiet_NaN();
   double sum_of_square_diff_from_mean_ = 0.0;
+  LatencyHistogram histogram_;
+  StatisticsConfig config_;
+  /// Ring buffers of the samples of a sliding window, indexed by their sequence modulo the capacity
+  std::vector<double> window_values_;
+  std::vector<std::chrono::steady_clock::time_point> window_times_;
+  /// Sequences of the oldest sample in the window and of the next sample
+  uint64_t window_begin_ = 0;
+  uint64_t window_end_ = 0;
+  /// Monotonic queues of the sequences of the candidates for the minimum and the maximum
+  std::vector<uint64_t> window_min_sequences_;
+  std::vector<uint64_t> window_max_sequences_;
+  uint64_t window_min_begin_ = 0;
+  uint64_t window_min_end_ = 0;
+  uint64_t window_max_begin_ = 0;
+  uint64_t window_max_end_ = 0;
+  /// Time of the last sample of an exponential decay with a half-life in seconds
+  std::chrono::steady_clock::time_point last_measurement_time_;
 };
 
 /**
- * @brief Data structure to store the statistics of a moving average. The data is protected by a
- * mutex and the data can be updated and retrieved.
+ * @brief Data structure to store the statistics of a moving average. The data is updated by a
+ * single thread and published through a StatisticsSnapshot, so it can be retrieved from any thread
+ * without blocking the update.
  */
 class MovingAverageStatisticsData
 {
@@ -220,7 +946,9 @@ class MovingAverageStatisticsData
 public:
   MovingAverageStatisticsData()
   {
-    reset();
+    snapshot_.begin_write();
+    clear();
+    publish_snapshot();
     reset_statistics_sample_count_ = std::numeric_limits<unsigned int>::max();
   }
 
@@ -230,18 +958,25 @@ public:
    */
   void update_statistics(const std::shared_ptr<MovingAverageStatistics> & statistics)
   {
-    std::unique_lock<DEFAULT_MUTEX> lock(mutex_);
-    if (statistics->get_count() > 0)
+    const StatisticData statistics_data = statistics->get_statistics();
+    if (statistics_data.sample_count > 0 || snapshot_.is_reset_requested())
     {
-      statistics_data_.average = statistics->get_average();
-      statistics_data_.min = statistics->get_min();
-      statistics_data_.max = statistics->get_max();
-      statistics_data_.standard_deviation = statistics->get_standard_deviation();
-      statistics_data_.sample_count = statistics->get_count();
-      statistics_data_ = statistics->get_statistics();
-      current_data_ = statistics->get_current_measurement();
+      snapshot_.begin_write();
+      if (snapshot_.take_reset_request())
+      {
+        clear();
+      }
+      if (statistics_data.sample_count > 0)
+      {
+        statistics_data_ = statistics_data;
+        current_data_ = statistics->get_current_measurement();
+        percentiles_ = statistics->get_percentiles();
+      }
+      publish_snapshot();
     }
-    if (statistics->get_count() >= reset_statistics_sample_count_)
+    if (
+      statistics_data.sample_count >=
+      reset_statistics_sample_count_.load(std::memory_order_relaxed))
     {
       statistics->reset();
     }
@@ -253,52 +988,125 @@ public:
    */
   void set_reset_statistics_sample_count(unsigned int reset_sample_count)
   {
-    std::unique_lock<DEFAULT_MUTEX> lock(mutex_);
-    reset_statistics_sample_count_ = reset_sample_count;
+    reset_statistics_sample_count_.store(reset_sample_count, std::memory_order_relaxed);
   }
 
-  void reset()
-  {
-    statistics_data_.average = std::numeric_limits<double>::quiet_NaN();
-    statistics_data_.min = std::numeric_limits<double>::quiet_NaN();
-    statistics_data_.max = std::numeric_limits<double>::quiet_NaN();
-    statistics_data_.standard_deviation = std::numeric_limits<double>::quiet_NaN();
-    statistics_data_.sample_count = 0;
-  }
+  /**
+   * @brief Reset the statistics data, applied by the next update_statistics() so that it can be
+   * called from any thread.
+   */
+  void reset() { snapshot_.request_reset(); }
 
   /**
    * @brief Get the statistics data.
    * @return statistics data.
    */
-  const StatisticData & get_statistics() const
+  StatisticData get_statistics() const { return snapshot_.load().statistics; }
+
+  /**
+   * @brief Get the statistics data of the writer, to register it in the introspection registry
+   * sampled by the thread updating the statistics.
+   * @return reference to the statistics data.
+   */
+  const StatisticData & get_statistics_const_ptr() const { return statistics_data_; }
+
+  const double & get_current_data() const { return current_data_; }
+
+  /**
+   * @brief Get the percentiles of the statistics data.
+   * @return percentiles of the statistics data.
+   */
+  LatencyPercentiles get_percentiles() const { return snapshot_.load().percentiles; }
+
+  /**
+   * @brief Get the percentiles of the writer, see get_statistics_const_ptr().
+   * @return reference to the percentiles of the statistics data.
+   */
+  const LatencyPercentiles & get_percentiles_const_ptr() const { return percentiles_; }
+
+private:
+  /// Resets the data of the writer, the caller publishes it
+  void clear() noexcept
   {
-    std::unique_lock<DEFAULT_MUTEX> lock(mutex_);
-    return statistics_data_;
+    statistics_data_ = StatisticsSnapshot::get_empty_statistics();
+    percentiles_ = LatencyPercentiles();
   }
 
-  const double & get_current_data() const
+  /// Copies the data of the writer to the snapshot and ends the write started by the caller
+  void publish_snapshot() noexcept
   {
-    std::unique_lock<DEFAULT_MUTEX> lock(mutex_);
-    return current_data_;
+    StatisticsSnapshot::Data data;
+    data.statistics = statistics_data_;
+    data.current_measurement = current_data_;
+    data.percentiles = percentiles_;
+    snapshot_.store(data);
+    snapshot_.end_write();
   }
 
-private:
-  /// Mutex to protect the statistics data
-  mutable DEFAULT_MUTEX mutex_;
+  /// Snapshot of the statistics data, for the readers
+  StatisticsSnapshot snapshot_;
   /// Statistics data
   StatisticData statistics_data_;
   /// Current data value, used to calculate the statistics
   double current_data_ = std::numeric_limits<double>::quiet_NaN();
+  /// Percentiles of the data
+  LatencyPercentiles percentiles_;
   /// Number of samples to reset the statistics
-  unsigned int reset_statistics_sample_count_ = std::numeric_limits<unsigned int>::max();
+  std::atomic<unsigned int> reset_statistics_sample_count_{
+    std::numeric_limits<unsigned int>::max()};
 };
 }  // namespace ros2_control
 
 namespace hardware_interface
 {
 /**
- * @brief Data structure with two moving average statistics collectors. One for the execution time
- * and the other for the periodicity.
+ * @brief Data structure with the moving average statistics collectors of the hardware performance
+ * counters of the cycles.
+ */
+struct PerformanceCountersStatisticsCollector
+{
+  PerformanceCountersStatisticsCollector()
+  {
+    cycles = std::make_shared<ros2_control::MovingAverageStatistics>();
+    instructions_per_cycle = std::make_shared<ros2_control::MovingAverageStatistics>();
+    cache_misses = std::make_shared<ros2_control::MovingAverageStatistics>();
+    branch_misses = std::make_shared<ros2_control::MovingAverageStatistics>();
+  }
+
+  /**
+   * @brief Adds the counters of a cycle to the statistics.
+   * @param counters difference of the counters sampled around the cycle.
+   */
+  void add_measurement(const PerformanceCounters & counters)
+  {
+    cycles->add_measurement(static_cast<double>(counters.cycles));
+    instructions_per_cycle->add_measurement(counters.get_instructions_per_cycle());
+    cache_misses->add_measurement(static_cast<double>(counters.cache_misses));
+    branch_misses->add_measurement(static_cast<double>(counters.branch_misses));
+  }
+
+  void reset_statistics()
+  {
+    cycles->reset();
+    instructions_per_cycle->reset();
+    cache_misses->reset();
+    branch_misses->reset();
+  }
+
+  /// CPU cycles of the cycles
+  std::shared_ptr<ros2_control::MovingAverageStatistics> cycles = nullptr;
+  /// Retired instructions per CPU cycle of the cycles
+  std::shared_ptr<ros2_control::MovingAverageStatistics> instructions_per_cycle = nullptr;
+  /// Last level cache misses of the cycles
+  std::shared_ptr<ros2_control::MovingAverageStatistics> cache_misses = nullptr;
+  /// Branch misses of the cycles
+  std::shared_ptr<ros2_control::MovingAverageStatistics> branch_misses = nullptr;
+};
+
+/**
+ * @brief Data structure with the moving average statistics collectors of the execution time and
+ * the periodicity, and of the CPU time, the preempted time and the performance counters of the
+ * cycles.
  */
 struct HardwareComponentStatisticsCollector
 {
@@ -306,6 +1114,9 @@ struct HardwareComponentStatisticsCollector
   {
     execution_time = std::make_shared<ros2_control::MovingAverageStatistics>();
     periodicity = std::make_shared<ros2_control::MovingAverageStatistics>();
+    cpu_time = std::make_shared<ros2_control::MovingAverageStatistics>();
+    preempted_time = std::make_shared<ros2_control::MovingAverageStatistics>();
+    changed_command_ratio = std::make_shared<ros2_control::MovingAverageStatistics>();
   }
 
   /**
@@ -316,12 +1127,29 @@ struct HardwareComponentStatisticsCollector
   {
     execution_time->reset();
     periodicity->reset();
+    cpu_time->reset();
+    preempted_time->reset();
+    changed_command_ratio->reset();
+    performance_counters.reset_statistics();
   }
 
   /// Execution time statistics collector
   std::shared_ptr<ros2_control::MovingAverageStatistics> execution_time = nullptr;
   /// Periodicity statistics collector
   std::shared_ptr<ros2_control::MovingAverageStatistics> periodicity = nullptr;
+  /// CPU time statistics collector, only sampled if the ThreadTimes sampling is enabled
+  std::shared_ptr<ros2_control::MovingAverageStatistics> cpu_time = nullptr;
+  /// Statistics collector of the execution time minus the CPU time
+  std::shared_ptr<ros2_control::MovingAverageStatistics> preempted_time = nullptr;
+  /// Context switches of the thread during the last cycle
+  unsigned int voluntary_context_switches = 0;
+  unsigned int involuntary_context_switches = 0;
+  /// Performance counters statistics collectors, only sampled if the PerformanceCounters sampling
+  /// is enabled
+  PerformanceCountersStatisticsCollector performance_counters;
+  /// Statistics collector of the fraction of the commands changed at every write, only sampled if
+  /// the component tracks the changes of its commands
+  std::shared_ptr<ros2_control::MovingAverageStatistics> changed_command_ratio = nullptr;
 };
 }  // namespace hardware_interface
 
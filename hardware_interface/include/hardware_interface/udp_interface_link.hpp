@@ -0,0 +1,157 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__UDP_INTERFACE_LINK_HPP_
+#define HARDWARE_INTERFACE__UDP_INTERFACE_LINK_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/types/statistics_types.hpp"
+
+namespace hardware_interface
+{
+namespace udp_link
+{
+/// "R2CU" in little endian
+constexpr uint32_t FRAME_MAGIC = 0x55433252;
+constexpr uint32_t FRAME_VERSION = 1;
+
+/// Header of a datagram, followed by the values as doubles in the byte order of the sender.
+struct FrameHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  /// Hash of the names of the values, both sides have to exchange the same interfaces
+  uint64_t layout_hash;
+  /// Incremented for every sent frame, to detect the lost and the reordered frames
+  uint32_t sequence;
+  uint32_t number_of_values;
+  /// Time given by the sender to the values, in nanoseconds
+  int64_t stamp_ns;
+};
+}  // namespace udp_link
+
+/// Statistics of the frames exchanged by a UdpInterfaceLink.
+struct UdpInterfaceLinkStatistics
+{
+  uint64_t sent_frames = 0;
+  /// Frames that couldn't be sent, e.g., while the remote side isn't running
+  uint64_t send_errors = 0;
+  uint64_t received_frames = 0;
+  /// Frames missing in the sequence of the received frames
+  uint64_t lost_frames = 0;
+  /// Frames with another layout, size or version, and the frames older than the last one
+  uint64_t rejected_frames = 0;
+  /// Time from the stamp of the received frames to their reception, in seconds. It includes the
+  /// offset between the clocks of the two machines, which have to be synchronized, e.g., with PTP
+  ros2_control::LatencyHistogram age;
+};
+
+/// Exchanges the values of interfaces with a remote controller manager over UDP.
+/**
+ * Every frame is a single datagram, sent without waiting. The receiving side keeps the latest
+ * frame, i.e., the frames received since the last call of receive() are dropped except the newest
+ * one, so a slow side never builds up a backlog. Both sides describe the exchanged values by their
+ * names, whose hash is checked on every frame.
+ *
+ * The socket is bound to the local port and connected to the remote address, so only the frames
+ * of the remote side are received. The buffers are allocated by open(), send() and receive() are
+ * real-time safe.
+ *
+ * \note The link is only available on POSIX systems, open() throws otherwise.
+ */
+class UdpInterfaceLink
+{
+public:
+  UdpInterfaceLink() = default;
+
+  ~UdpInterfaceLink();
+
+  UdpInterfaceLink(const UdpInterfaceLink &) = delete;
+  UdpInterfaceLink & operator=(const UdpInterfaceLink &) = delete;
+
+  /// Opens the socket, replacing the previous one.
+  /**
+   * \param[in] local_port UDP port the frames of the remote side are received on.
+   * \param[in] remote_address host name or IP address of the remote side.
+   * \param[in] remote_port UDP port of the remote side.
+   * \param[in] sent_names names of the values sent to the remote side.
+   * \param[in] received_names names of the values received from the remote side.
+   * \throws std::runtime_error if the address can't be resolved or the socket can't be opened.
+   * \note This method is not real-time safe.
+   */
+  void open(
+    uint16_t local_port, const std::string & remote_address, uint16_t remote_port,
+    const std::vector<std::string> & sent_names, const std::vector<std::string> & received_names);
+
+  /// Closes the socket.
+  void close() noexcept;
+
+  /// Returns true if the socket is open.
+  bool is_open() const noexcept { return socket_ >= 0; }
+
+  /// Sends a frame with the values.
+  /**
+   * \param[in] values values in the order of the sent names.
+   * \param[in] stamp_ns time of the values.
+   * \returns false if the socket isn't open, the number of values doesn't match or the frame
+   * couldn't be sent.
+   */
+  bool send(const std::vector<double> & values, int64_t stamp_ns) noexcept;
+
+  /// Copies the values of the newest frame received since the last call.
+  /**
+   * \param[out] values values in the order of the received names, unchanged without a new frame.
+   * \param[out] stamp_ns time the remote side gave to the values.
+   * \param[in] now_ns local time, for the age statistics of the frame.
+   * \param[in] timeout time to wait for a frame if none is pending, 0 to not wait.
+   * \returns true if a new frame was copied.
+   */
+  bool receive(
+    std::vector<double> & values, int64_t & stamp_ns, int64_t now_ns,
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds(0)) noexcept;
+
+  /// Returns the statistics of the exchanged frames, reset by open().
+  const UdpInterfaceLinkStatistics & get_statistics() const { return statistics_; }
+
+  /// Returns the hash of the names of the values, as checked on every frame.
+  static uint64_t compute_layout_hash(const std::vector<std::string> & names);
+
+private:
+  /// Reads the pending datagrams, keeping the newest valid one in the receive buffer
+  bool read_pending_frames(int64_t & stamp_ns, int64_t now_ns) noexcept;
+
+  int socket_ = -1;
+  uint64_t sent_layout_hash_ = 0;
+  uint64_t received_layout_hash_ = 0;
+  std::size_t number_of_sent_values_ = 0;
+  std::size_t number_of_received_values_ = 0;
+  uint32_t sent_sequence_ = 0;
+  uint32_t last_received_sequence_ = 0;
+  bool has_received_frame_ = false;
+  std::vector<unsigned char> send_buffer_;
+  /// Datagram being read, one byte larger than a valid frame to detect the larger ones
+  std::vector<unsigned char> receive_buffer_;
+  /// Values of the newest valid frame read from the socket
+  std::vector<unsigned char> newest_frame_;
+  UdpInterfaceLinkStatistics statistics_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__UDP_INTERFACE_LINK_HPP_
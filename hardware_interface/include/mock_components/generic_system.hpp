@@ -17,6 +17,8 @@
 #ifndef MOCK_COMPONENTS__GENERIC_SYSTEM_HPP_
 #define MOCK_COMPONENTS__GENERIC_SYSTEM_HPP_
 
+#include <array>
+#include <chrono>
 #include <string>
 #include <vector>
 #include "hardware_interface/handle.hpp"
@@ -24,6 +26,7 @@
 #include "hardware_interface/system_interface.hpp"
 #include "hardware_interface/types/hardware_interface_return_values.hpp"
 #include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "mock_components/joint_dynamics.hpp"
 
 using hardware_interface::return_type;
 
@@ -57,10 +60,7 @@ public:
 
   return_type read(const rclcpp::Time & time, const rclcpp::Duration & period) override;
 
-  return_type write(const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
-  {
-    return return_type::OK;
-  }
+  return_type write(const rclcpp::Time & time, const rclcpp::Duration & period) override;
 
 protected:
   /// Use standard interfaces for joints because they are relevant for dynamic behavior
@@ -80,6 +80,42 @@ private:
     const std::vector<hardware_interface::ComponentInfo> & components,
     std::vector<hardware_interface::InterfaceDescription> & command_interface_descriptions) const;
 
+  /// Integrate the joints with joint_dynamics_ and write their states.
+  void update_joint_dynamics(double period);
+
+  /// Look up the handles accessed by read(), so that it neither builds nor hashes their names.
+  void precompute_read_handles();
+
+  /// Handles of the position, velocity and acceleration interfaces of a joint, null if missing
+  struct JointHandles
+  {
+    std::array<hardware_interface::StateInterface::SharedPtr, 3> states;
+    std::array<hardware_interface::CommandInterface::SharedPtr, 3> commands;
+  };
+
+  /// State interface mirroring a command interface
+  struct LoopbackHandles
+  {
+    hardware_interface::StateInterface::SharedPtr state;
+    hardware_interface::CommandInterface::SharedPtr command;
+    hardware_interface::HandleDataType data_type;
+    // position command the state follows with position_state_following_offset_, if any
+    hardware_interface::CommandInterface::SharedPtr following_command;
+  };
+
+  struct MimicJointHandles
+  {
+    std::array<hardware_interface::StateInterface::SharedPtr, 3> states;
+    std::array<hardware_interface::StateInterface::SharedPtr, 3> mimicked_states;
+    double multiplier;
+    double offset;
+  };
+
+  std::vector<JointHandles> joint_handles_;
+  std::vector<LoopbackHandles> joint_loopback_handles_;
+  std::vector<MimicJointHandles> mimic_joint_handles_;
+  std::vector<LoopbackHandles> component_loopback_handles_;
+
   bool use_mock_gpio_command_interfaces_;
   bool use_mock_sensor_command_interfaces_;
 
@@ -89,7 +125,16 @@ private:
   bool calculate_dynamics_;
   std::vector<size_t> joint_control_mode_;
 
+  // set by the dynamics_model parameter, replaces the integration of calculate_dynamics
+  bool use_joint_dynamics_ = false;
+  JointDynamics joint_dynamics_;
+  std::vector<double> joint_dynamics_commands_;
+
   bool command_propagation_disabled_;
+
+  // synthetic CPU load of read() and write(), to stress-test the control loop
+  std::chrono::nanoseconds read_cpu_load_{0};
+  std::chrono::nanoseconds write_cpu_load_{0};
 };
 
 typedef GenericSystem GenericRobot;
@@ -0,0 +1,208 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef MOCK_COMPONENTS__JOINT_DYNAMICS_HPP_
+#define MOCK_COMPONENTS__JOINT_DYNAMICS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mock_components
+{
+/// Simulates the dynamics of all the joints of a mock system at once.
+/**
+ * The commanded quantity of every joint, i.e., its position, velocity or acceleration depending
+ * on its control mode, follows its command through a first-order lag or a second-order system.
+ * The quantities below it are integrated with the semi-implicit Euler method, the quantities
+ * above it are differentiated. The commands are optionally delayed by a number of cycles to
+ * emulate the latency of a bus.
+ *
+ * The states are stored as structure of arrays, indexed by joint, and update() runs one loop over
+ * all the joints without allocating memory.
+ */
+class JointDynamics
+{
+public:
+  enum class Model
+  {
+    FIRST_ORDER_LAG,
+    SECOND_ORDER,
+  };
+
+  struct Parameters
+  {
+    Model model = Model::FIRST_ORDER_LAG;
+    /// time constant of the first-order lag in seconds, 0 to follow the commands immediately
+    double time_constant = 0.0;
+    /// natural frequency of the second-order system in rad/s
+    double natural_frequency = 10.0;
+    /// damping ratio of the second-order system
+    double damping_ratio = 1.0;
+    /// number of cycles a command is delayed by
+    std::size_t command_delay_cycles = 0;
+  };
+
+  /// Parses the name of a model, "first_order_lag" or "second_order".
+  /**
+   * \throws std::invalid_argument if the name is unknown.
+   */
+  static Model parse_model(const std::string & name)
+  {
+    if (name == "first_order_lag")
+    {
+      return Model::FIRST_ORDER_LAG;
+    }
+    if (name == "second_order")
+    {
+      return Model::SECOND_ORDER;
+    }
+    throw std::invalid_argument("Unknown dynamics model '" + name + "'.");
+  }
+
+  /// Allocates the states of the joints and resets them to zero.
+  /**
+   * \throws std::invalid_argument if the parameters are negative or the natural frequency is 0.
+   */
+  void configure(std::size_t number_of_joints, const Parameters & parameters)
+  {
+    if (
+      parameters.time_constant < 0.0 || parameters.damping_ratio < 0.0 ||
+      !(parameters.natural_frequency > 0.0))
+    {
+      throw std::invalid_argument("Invalid parameters of the joint dynamics.");
+    }
+    parameters_ = parameters;
+    for (auto & derivative : derivatives_)
+    {
+      derivative.assign(number_of_joints, 0.0);
+    }
+    delayed_commands_.assign(
+      (parameters.command_delay_cycles + 1) * number_of_joints,
+      std::numeric_limits<double>::quiet_NaN());
+    delay_slot_ = 0;
+  }
+
+  std::size_t size() const { return derivatives_[0].size(); }
+
+  /// Sets the states of a joint, e.g., to its initial values, non-finite values are set to 0.
+  void reset(std::size_t joint, double position, double velocity, double acceleration)
+  {
+    derivatives_[0][joint] = std::isfinite(position) ? position : 0.0;
+    derivatives_[1][joint] = std::isfinite(velocity) ? velocity : 0.0;
+    derivatives_[2][joint] = std::isfinite(acceleration) ? acceleration : 0.0;
+    derivatives_[3][joint] = 0.0;
+  }
+
+  const std::vector<double> & positions() const { return derivatives_[0]; }
+  const std::vector<double> & velocities() const { return derivatives_[1]; }
+  const std::vector<double> & accelerations() const { return derivatives_[2]; }
+
+  /// Integrates the states of all the joints over one period.
+  /**
+   * \param[in] control_modes the commanded quantity of every joint, 0 for the position, 1 for the
+   * velocity and 2 for the acceleration.
+   * \param[in] commands the command of every joint, a NaN holds the commanded quantity.
+   * \param[in] period the period in seconds, the states are left unchanged if it isn't positive.
+   * \note This method doesn't allocate memory and is real-time safe.
+   */
+  void update(
+    const std::vector<std::size_t> & control_modes, const std::vector<double> & commands,
+    double period)
+  {
+    const std::size_t number_of_joints = size();
+    const std::size_t number_of_slots = parameters_.command_delay_cycles + 1;
+    // the newest commands overwrite the oldest ones, the commands of the next slot are applied
+    std::copy(
+      commands.begin(), commands.begin() + static_cast<std::ptrdiff_t>(number_of_joints),
+      delayed_commands_.begin() + static_cast<std::ptrdiff_t>(delay_slot_ * number_of_joints));
+    delay_slot_ = (delay_slot_ + 1) % number_of_slots;
+    const double * const applied_commands =
+      delayed_commands_.data() + delay_slot_ * number_of_joints;
+    if (!(period > 0.0))
+    {
+      return;
+    }
+
+    if (parameters_.model == Model::FIRST_ORDER_LAG)
+    {
+      const double gain = parameters_.time_constant > 0.0
+                            ? 1.0 - std::exp(-period / parameters_.time_constant)
+                            : 1.0;
+      integrate(
+        control_modes, applied_commands, period,
+        [gain, period](double target, double & quantity, double & rate)
+        {
+          const double new_quantity = quantity + gain * (target - quantity);
+          rate = (new_quantity - quantity) / period;
+          quantity = new_quantity;
+        });
+    }
+    else
+    {
+      const double stiffness = parameters_.natural_frequency * parameters_.natural_frequency;
+      const double damping = 2.0 * parameters_.damping_ratio * parameters_.natural_frequency;
+      integrate(
+        control_modes, applied_commands, period,
+        [stiffness, damping, period](double target, double & quantity, double & rate)
+        {
+          rate += (stiffness * (target - quantity) - damping * rate) * period;
+          quantity += rate * period;
+        });
+    }
+  }
+
+private:
+  template <typename StepT>
+  void integrate(
+    const std::vector<std::size_t> & control_modes, const double * applied_commands,
+    double period, StepT step)
+  {
+    for (std::size_t j = 0; j < size(); ++j)
+    {
+      const std::size_t mode = control_modes[j] < 2 ? control_modes[j] : 2;
+      double & quantity = derivatives_[mode][j];
+      double & rate = derivatives_[mode + 1][j];
+      const double old_rate = rate;
+      step(std::isfinite(applied_commands[j]) ? applied_commands[j] : quantity, quantity, rate);
+      // the acceleration of the position controlled joints is differentiated
+      if (mode == 0)
+      {
+        derivatives_[2][j] = (rate - old_rate) / period;
+      }
+      // the quantities below the commanded one are integrated with the updated rates
+      for (std::size_t k = mode; k-- > 0;)
+      {
+        derivatives_[k][j] += derivatives_[k + 1][j] * period;
+      }
+    }
+  }
+
+  Parameters parameters_;
+  // position, velocity, acceleration and jerk of every joint
+  std::array<std::vector<double>, 4> derivatives_;
+  // ring buffer of the commands of the last command_delay_cycles + 1 cycles
+  std::vector<double> delayed_commands_;
+  std::size_t delay_slot_ = 0;
+};
+
+}  // namespace mock_components
+
+#endif  // MOCK_COMPONENTS__JOINT_DYNAMICS_HPP_
@@ -0,0 +1,229 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef MOCK_COMPONENTS__REPLAY_LOG_HPP_
+#define MOCK_COMPONENTS__REPLAY_LOG_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mock_components
+{
+/// Recorded values of state and command interfaces, replayed by the ReplaySystem.
+/**
+ * Every record holds the time of the record and the values of all the state and command
+ * interfaces, in the order of their names. The records are stored contiguously, so that replaying
+ * a record only copies its values.
+ *
+ * The binary file starts with the magic "RC2CLOG1", the number of state and command interfaces
+ * and their names, followed by the number of records and the records. The integers and doubles
+ * are stored in the byte order of the machine.
+ */
+class ReplayLog
+{
+public:
+  ReplayLog() = default;
+
+  ReplayLog(std::vector<std::string> state_names, std::vector<std::string> command_names)
+  : state_names_(std::move(state_names)), command_names_(std::move(command_names))
+  {
+  }
+
+  const std::vector<std::string> & get_state_names() const { return state_names_; }
+  const std::vector<std::string> & get_command_names() const { return command_names_; }
+
+  /// Returns the number of records.
+  std::size_t size() const { return times_ns_.size(); }
+
+  bool empty() const { return times_ns_.empty(); }
+
+  /// Appends a record.
+  /**
+   * \throws std::invalid_argument if the number of values doesn't match the number of names.
+   */
+  void add_record(
+    int64_t time_ns, const std::vector<double> & states, const std::vector<double> & commands)
+  {
+    if (states.size() != state_names_.size() || commands.size() != command_names_.size())
+    {
+      throw std::invalid_argument(
+        "The record has " + std::to_string(states.size()) + " state and " +
+        std::to_string(commands.size()) + " command values, the log records " +
+        std::to_string(state_names_.size()) + " state and " +
+        std::to_string(command_names_.size()) + " command interfaces.");
+    }
+    times_ns_.push_back(time_ns);
+    states_.insert(states_.end(), states.begin(), states.end());
+    commands_.insert(commands_.end(), commands.begin(), commands.end());
+  }
+
+  int64_t get_time(std::size_t record) const { return times_ns_[record]; }
+
+  /// Returns the state values of a record, in the order of get_state_names().
+  const double * get_states(std::size_t record) const
+  {
+    return states_.data() + record * state_names_.size();
+  }
+
+  /// Returns the command values of a record, in the order of get_command_names().
+  const double * get_commands(std::size_t record) const
+  {
+    return commands_.data() + record * command_names_.size();
+  }
+
+  /// Writes the log to a binary file.
+  /**
+   * \throws std::runtime_error if the file cannot be written.
+   */
+  void save(const std::string & path) const
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+      throw std::runtime_error("Cannot open the replay log '" + path + "' for writing.");
+    }
+    file.write(MAGIC, sizeof(MAGIC));
+    write_value(file, static_cast<uint32_t>(state_names_.size()));
+    write_value(file, static_cast<uint32_t>(command_names_.size()));
+    for (const auto * names : {&state_names_, &command_names_})
+    {
+      for (const auto & name : *names)
+      {
+        write_value(file, static_cast<uint32_t>(name.size()));
+        file.write(name.data(), static_cast<std::streamsize>(name.size()));
+      }
+    }
+    write_value(file, static_cast<uint64_t>(times_ns_.size()));
+    for (std::size_t record = 0; record < size(); ++record)
+    {
+      write_value(file, times_ns_[record]);
+      write_values(file, get_states(record), state_names_.size());
+      write_values(file, get_commands(record), command_names_.size());
+    }
+    if (!file)
+    {
+      throw std::runtime_error("Cannot write the replay log '" + path + "'.");
+    }
+  }
+
+  /// Reads a log from a binary file written by save().
+  /**
+   * \throws std::runtime_error if the file cannot be read or isn't a replay log.
+   */
+  static ReplayLog load(const std::string & path)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+      throw std::runtime_error("Cannot open the replay log '" + path + "'.");
+    }
+    char magic[sizeof(MAGIC)];
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+    {
+      throw std::runtime_error("The file '" + path + "' is not a replay log.");
+    }
+    const auto number_of_states = read_value<uint32_t>(file, path);
+    const auto number_of_commands = read_value<uint32_t>(file, path);
+    ReplayLog log;
+    for (auto * names : {&log.state_names_, &log.command_names_})
+    {
+      const uint32_t number_of_names = names == &log.state_names_ ? number_of_states
+                                                                   : number_of_commands;
+      for (uint32_t i = 0; i < number_of_names; ++i)
+      {
+        std::string name(read_value<uint32_t>(file, path), '\0');
+        file.read(&name[0], static_cast<std::streamsize>(name.size()));
+        names->push_back(std::move(name));
+      }
+    }
+    const auto number_of_records = read_value<uint64_t>(file, path);
+    // check the size before allocating the records
+    const auto records_begin = file.tellg();
+    file.seekg(0, std::ios::end);
+    const auto records_size = static_cast<uint64_t>(file.tellg() - records_begin);
+    file.seekg(records_begin);
+    const uint64_t record_size =
+      sizeof(int64_t) + (uint64_t{number_of_states} + number_of_commands) * sizeof(double);
+    if (number_of_records > records_size / record_size)
+    {
+      throw std::runtime_error("The replay log '" + path + "' is truncated.");
+    }
+    log.times_ns_.resize(number_of_records);
+    log.states_.resize(number_of_records * number_of_states);
+    log.commands_.resize(number_of_records * number_of_commands);
+    for (uint64_t record = 0; record < number_of_records; ++record)
+    {
+      log.times_ns_[record] = read_value<int64_t>(file, path);
+      read_values(file, &log.states_[record * number_of_states], number_of_states);
+      read_values(file, &log.commands_[record * number_of_commands], number_of_commands);
+    }
+    if (!file)
+    {
+      throw std::runtime_error("The replay log '" + path + "' is truncated.");
+    }
+    return log;
+  }
+
+private:
+  static constexpr char MAGIC[8] = {'R', 'C', '2', 'C', 'L', 'O', 'G', '1'};
+
+  template <typename T>
+  static void write_value(std::ofstream & file, const T & value)
+  {
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  static void write_values(std::ofstream & file, const double * values, std::size_t size)
+  {
+    file.write(
+      reinterpret_cast<const char *>(values), static_cast<std::streamsize>(size * sizeof(double)));
+  }
+
+  template <typename T>
+  static T read_value(std::ifstream & file, const std::string & path)
+  {
+    T value{};
+    file.read(reinterpret_cast<char *>(&value), sizeof(T));
+    if (!file)
+    {
+      throw std::runtime_error("The replay log '" + path + "' is truncated.");
+    }
+    return value;
+  }
+
+  static void read_values(std::ifstream & file, double * values, std::size_t size)
+  {
+    file.read(
+      reinterpret_cast<char *>(values), static_cast<std::streamsize>(size * sizeof(double)));
+  }
+
+  std::vector<std::string> state_names_;
+  std::vector<std::string> command_names_;
+  std::vector<int64_t> times_ns_;
+  // values of the records, one row per record
+  std::vector<double> states_;
+  std::vector<double> commands_;
+};
+
+}  // namespace mock_components
+
+#endif  // MOCK_COMPONENTS__REPLAY_LOG_HPP_
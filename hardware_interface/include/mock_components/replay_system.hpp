@@ -0,0 +1,100 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef MOCK_COMPONENTS__REPLAY_SYSTEM_HPP_
+#define MOCK_COMPONENTS__REPLAY_SYSTEM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/system_interface.hpp"
+#include "hardware_interface/types/hardware_interface_return_values.hpp"
+#include "mock_components/replay_log.hpp"
+
+namespace mock_components
+{
+using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
+
+/// System replaying the state values of a ReplayLog, for reproducible tests of controllers.
+/**
+ * read() sets the state interfaces to the values of the current record of the log, write()
+ * compares the command interfaces with the recorded commands of that record. The deviations are
+ * reported when the component is deactivated.
+ *
+ * Hardware parameters:
+ *  - log_file: path of the replay log, required. All the state interfaces of the component have
+ *    to be recorded in the log, the recorded commands are optional.
+ *  - playback_speed: factor of the time of the log to the time of the control loop, 1.0 by
+ *    default. With 0, every read() replays the next record, independently of the period, e.g.,
+ *    for a controller manager running faster than real time.
+ *  - loop: restart the log at its end, false by default. Otherwise the last record is held.
+ *  - command_tolerance: maximal absolute deviation of a command from the recorded command,
+ *    1e-6 by default.
+ *
+ * The interfaces have to be of type double or bool, the bool values are recorded as 0.0 or 1.0.
+ */
+class ReplaySystem : public hardware_interface::SystemInterface
+{
+public:
+  CallbackReturn on_init(
+    const hardware_interface::HardwareComponentInterfaceParams & params) override;
+
+  CallbackReturn on_configure(const rclcpp_lifecycle::State & previous_state) override;
+
+  CallbackReturn on_activate(const rclcpp_lifecycle::State & previous_state) override;
+
+  CallbackReturn on_deactivate(const rclcpp_lifecycle::State & previous_state) override;
+
+  hardware_interface::return_type read(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+  hardware_interface::return_type write(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+private:
+  /// Restarts the playback at the first record.
+  void restart();
+
+  /// Copies the state values of the current record to the state interfaces.
+  void apply_record();
+
+  std::string log_file_;
+  double playback_speed_ = 1.0;
+  bool loop_ = false;
+  double command_tolerance_ = 1e-6;
+
+  ReplayLog log_;
+  /// Replayed state interfaces and the columns of their values in the log
+  std::vector<hardware_interface::StateInterface::SharedPtr> state_handles_;
+  std::vector<std::size_t> state_columns_;
+  /// Recorded command interfaces and the columns of their values in the log
+  std::vector<hardware_interface::CommandInterface::SharedPtr> command_handles_;
+  std::vector<std::size_t> command_columns_;
+
+  std::size_t record_ = 0;
+  bool started_ = false;
+  int64_t playback_time_ns_ = 0;
+  std::size_t compared_commands_ = 0;
+  std::size_t command_deviations_ = 0;
+  double max_command_deviation_ = 0.0;
+};
+
+}  // namespace mock_components
+
+#endif  // MOCK_COMPONENTS__REPLAY_SYSTEM_HPP_
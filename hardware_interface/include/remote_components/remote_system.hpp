@@ -0,0 +1,99 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef REMOTE_COMPONENTS__REMOTE_SYSTEM_HPP_
+#define REMOTE_COMPONENTS__REMOTE_SYSTEM_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/system_interface.hpp"
+#include "hardware_interface/types/hardware_interface_return_values.hpp"
+#include "hardware_interface/udp_interface_link.hpp"
+
+namespace remote_components
+{
+using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
+
+/// System importing the interfaces of a controller manager running on another machine.
+/**
+ * The remote controller manager exports the interfaces of its hardware components with its
+ * remote_interface_export parameters, and this component makes them claimable by the local
+ * controllers. read() copies the states of the latest frame of the remote side and write() sends
+ * the commands, both through a hardware_interface::UdpInterfaceLink. The interfaces of the
+ * component have to be the exported interfaces, with the same names and in the same order.
+ *
+ * Hardware parameters:
+ *  - remote_address: host name or IP address of the remote controller manager, required.
+ *  - remote_port: UDP port of the remote controller manager, required.
+ *  - local_port: UDP port the states are received on, required.
+ *  - read_deadline_us: time read() of the active component waits for a new state frame, in
+ *    microseconds, to align the cycles of the two controller managers. With 0, the default,
+ *    read() copies the latest frame without waiting and no deadline is missed.
+ *  - max_missed_deadlines: number of consecutive missed read deadlines before read() returns an
+ *    error, 10 by default.
+ *  - connection_timeout_ms: time the activation waits for the first state frame of the remote
+ *    side, in milliseconds, 1000 by default.
+ *
+ * The statistics of the link are published as the "<name>.remote_link" introspection variables.
+ * The interfaces have to be of type double or bool, the bool values are exchanged as 0.0 or 1.0.
+ */
+class RemoteSystem : public hardware_interface::SystemInterface
+{
+public:
+  CallbackReturn on_init(
+    const hardware_interface::HardwareComponentInterfaceParams & params) override;
+
+  CallbackReturn on_configure(const rclcpp_lifecycle::State & previous_state) override;
+
+  CallbackReturn on_cleanup(const rclcpp_lifecycle::State & previous_state) override;
+
+  CallbackReturn on_shutdown(const rclcpp_lifecycle::State & previous_state) override;
+
+  CallbackReturn on_activate(const rclcpp_lifecycle::State & previous_state) override;
+
+  hardware_interface::return_type read(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+  hardware_interface::return_type write(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+private:
+  /// Copies the state values of the last frame to the state interfaces.
+  void apply_state_values();
+
+  std::string remote_address_;
+  uint16_t remote_port_ = 0;
+  uint16_t local_port_ = 0;
+  std::chrono::nanoseconds read_deadline_{0};
+  std::chrono::milliseconds connection_timeout_{1000};
+  std::size_t max_missed_deadlines_ = 10;
+  std::size_t missed_deadlines_ = 0;
+
+  hardware_interface::UdpInterfaceLink link_;
+  /// Exchanged interfaces, in the order of the frames
+  std::vector<hardware_interface::StateInterface::SharedPtr> state_handles_;
+  std::vector<hardware_interface::CommandInterface::SharedPtr> command_handles_;
+  /// Preallocated values of the frames
+  std::vector<double> state_values_;
+  std::vector<double> command_values_;
+};
+
+}  // namespace remote_components
+
+#endif  // REMOTE_COMPONENTS__REMOTE_SYSTEM_HPP_
@@ -0,0 +1,93 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SHARED_MEMORY_COMPONENTS__SHARED_MEMORY_SYSTEM_HPP_
+#define SHARED_MEMORY_COMPONENTS__SHARED_MEMORY_SYSTEM_HPP_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/shared_memory_bridge.hpp"
+#include "hardware_interface/system_interface.hpp"
+#include "hardware_interface/types/hardware_interface_return_values.hpp"
+
+namespace shared_memory_components
+{
+using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
+
+/// System forwarding its interfaces to a driver running in another process.
+/**
+ * The component creates a hardware_interface::SharedMemoryBridge segment when it is configured.
+ * The driver process attaches to it, waits for the command frames written in write() and
+ * publishes the state frames copied in read(). A crash of the driver doesn't affect the controller
+ * manager, it is detected through the missed read deadlines.
+ *
+ * Hardware parameters:
+ *  - segment_name: name of the shared-memory segment, "/ros2_control_<component name>" by default.
+ *  - read_deadline_us: time read() of the active component waits for a new state frame, in
+ *    microseconds. With 0, the default, read() copies the latest frame without waiting and no
+ *    deadline is missed.
+ *  - max_missed_deadlines: number of consecutive missed read deadlines before read() returns an
+ *    error, 10 by default.
+ *  - connection_timeout_ms: time the activation waits for the first state frame of the driver, in
+ *    milliseconds, 1000 by default. The activation fails if the driver didn't publish any states.
+ *
+ * The interfaces have to be of type double or bool, the bool values are exchanged as 0.0 or 1.0.
+ */
+class SharedMemorySystem : public hardware_interface::SystemInterface
+{
+public:
+  CallbackReturn on_init(
+    const hardware_interface::HardwareComponentInterfaceParams & params) override;
+
+  CallbackReturn on_configure(const rclcpp_lifecycle::State & previous_state) override;
+
+  CallbackReturn on_cleanup(const rclcpp_lifecycle::State & previous_state) override;
+
+  CallbackReturn on_shutdown(const rclcpp_lifecycle::State & previous_state) override;
+
+  CallbackReturn on_activate(const rclcpp_lifecycle::State & previous_state) override;
+
+  hardware_interface::return_type read(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+  hardware_interface::return_type write(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+private:
+  /// Copies the state values of the last frame to the state interfaces.
+  void apply_state_values();
+
+  std::string segment_name_;
+  std::chrono::nanoseconds read_deadline_{0};
+  std::chrono::milliseconds connection_timeout_{1000};
+  std::size_t max_missed_deadlines_ = 10;
+  std::size_t missed_deadlines_ = 0;
+
+  hardware_interface::SharedMemoryBridge bridge_;
+  /// Exchanged interfaces, in the order of the bridge
+  std::vector<hardware_interface::StateInterface::SharedPtr> state_handles_;
+  std::vector<hardware_interface::CommandInterface::SharedPtr> command_handles_;
+  /// Preallocated buffers of the frames
+  std::vector<double> state_values_;
+  std::vector<double> command_values_;
+  uint32_t last_state_frame_ = 0;
+};
+
+}  // namespace shared_memory_components
+
+#endif  // SHARED_MEMORY_COMPONENTS__SHARED_MEMORY_SYSTEM_HPP_
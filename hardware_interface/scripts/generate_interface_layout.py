@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+# Copyright 2026 ros2_control Development Team
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate a C++ header with the layout of the interfaces of the ros2_control tags of a URDF."""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import xml.etree.ElementTree as ET
+
+# C++ types of the data types of the interfaces, see hardware_interface::HandleDataType
+CPP_TYPES = {
+    "double": "double",
+    "float32": "float",
+    "bool": "bool",
+    "uint8": "uint8_t",
+    "int8": "int8_t",
+    "uint16": "uint16_t",
+    "int16": "int16_t",
+    "uint32": "uint32_t",
+    "int32": "int32_t",
+    "double_array": "std::vector<double>",
+    "float32_array": "std::vector<float>",
+    "uint16_array": "std::vector<uint16_t>",
+    "double_samples": "hardware_interface::SampleBatch<double>",
+    "float32_samples": "hardware_interface::SampleBatch<float>",
+}
+
+CPP_KEYWORDS = {
+    "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break",
+    "case", "catch", "char", "class", "compl", "const", "constexpr", "const_cast", "continue",
+    "decltype", "default", "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit",
+    "export", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long",
+    "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or",
+    "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "return", "short",
+    "signed", "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template",
+    "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union",
+    "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq",
+}  # fmt: skip
+
+# names of the generated structs and of their members, that no identifier may shadow
+GROUPS = ("joints", "sensors", "gpios", "state_interfaces", "command_interfaces")
+RESERVED_NAMES = {"COUNT", "NAMES", "DATA_TYPES", *GROUPS}
+LAYOUT_MEMBERS = {"NAME", "TYPE", "PLUGIN", *GROUPS}
+
+COMPONENT_TAGS = (("joint", "joints"), ("sensor", "sensors"), ("gpio", "gpios"))
+
+
+class LayoutError(Exception):
+    pass
+
+
+def to_identifier(name, reserved=RESERVED_NAMES):
+    """Return a C++ identifier for a name of the robot description, e.g., 'joint1/position'."""
+    identifier = re.sub(r"[^0-9a-zA-Z_]", "_", name)
+    if not identifier or identifier[0].isdigit():
+        identifier = "_" + identifier
+    if identifier in CPP_KEYWORDS or identifier in reserved:
+        identifier += "_"
+    return identifier
+
+
+def read_description(path, xacro_args):
+    if path.endswith(".xacro"):
+        try:
+            return subprocess.run(
+                ["xacro", path] + xacro_args, check=True, capture_output=True, text=True
+            ).stdout
+        except (OSError, subprocess.CalledProcessError) as e:
+            stderr = getattr(e, "stderr", None) or str(e)
+            raise LayoutError(f"Unable to process the xacro file '{path}': {stderr}")
+    with open(path, encoding="utf-8") as description:
+        return description.read()
+
+
+def parse_interfaces(component, tag):
+    interfaces = []
+    for interface in component.findall(tag):
+        name = interface.get("name")
+        if not name:
+            raise LayoutError(f"A {tag} of '{component.get('name')}' has no name.")
+        data_type = interface.get("data_type", "double").strip()
+        if data_type not in CPP_TYPES:
+            raise LayoutError(f"Unsupported data type '{data_type}' of the interface '{name}'.")
+        interfaces.append((f"{component.get('name')}/{name}", data_type))
+    return interfaces
+
+
+def parse_layouts(urdf):
+    """Return the layouts of the ros2_control tags, in the order of the description."""
+    try:
+        robot = ET.fromstring(urdf)
+    except ET.ParseError as e:
+        raise LayoutError(f"Unable to parse the robot description: {e}")
+    layouts = []
+    for ros2_control in robot.iter("ros2_control"):
+        name = ros2_control.get("name")
+        if not name:
+            raise LayoutError("A ros2_control tag has no name.")
+        plugin = ros2_control.find("hardware/plugin")
+        layout = {
+            "name": name,
+            "type": ros2_control.get("type", ""),
+            "plugin": plugin.text.strip() if plugin is not None and plugin.text else "",
+            "state_interfaces": [],
+            "command_interfaces": [],
+        }
+        for tag, group in COMPONENT_TAGS:
+            components = ros2_control.findall(tag)
+            layout[group] = [component.get("name") for component in components]
+            for component in components:
+                layout["state_interfaces"] += parse_interfaces(component, "state_interface")
+                layout["command_interfaces"] += parse_interfaces(component, "command_interface")
+        layouts.append(layout)
+    if not layouts:
+        raise LayoutError("The robot description has no ros2_control tag.")
+    return layouts
+
+
+def check_unique(context, names):
+    identifiers = {}
+    for name in names:
+        identifier = to_identifier(name)
+        if identifier in identifiers:
+            raise LayoutError(
+                f"The names '{identifiers[identifier]}' and '{name}' of {context} have the same "
+                f"identifier '{identifier}'."
+            )
+        identifiers[identifier] = name
+
+
+def generate_names_struct(lines, struct_name, names, data_types=None, indent="  "):
+    lines.append(f"{indent}struct {struct_name}")
+    lines.append(f"{indent}{{")
+    for index, name in enumerate(names):
+        lines.append(f"{indent}  static constexpr std::size_t {to_identifier(name)} = {index};")
+    if data_types is not None:
+        for name, data_type in zip(names, data_types):
+            lines.append(f"{indent}  using {to_identifier(name)}_type = {CPP_TYPES[data_type]};")
+    lines.append(f"{indent}  static constexpr std::size_t COUNT = {len(names)};")
+    quoted_names = ", ".join(f'"{name}"' for name in names)
+    lines.append(
+        f"{indent}  static constexpr std::array<std::string_view, COUNT> NAMES = "
+        f"{{{quoted_names}}};"
+    )
+    if data_types is not None:
+        quoted_types = ", ".join(f'"{data_type}"' for data_type in data_types)
+        lines.append(
+            f"{indent}  static constexpr std::array<std::string_view, COUNT> DATA_TYPES = "
+            f"{{{quoted_types}}};"
+        )
+    lines.append(f"{indent}}};")
+
+
+def generate_header(layouts, namespace, source, header_name):
+    guard = to_identifier(header_name).upper().strip("_") + "_"
+    lines = [
+        f"// Generated by hardware_interface/generate_interface_layout.py from {source}.",
+        "// Do not edit, the header is generated again when the robot description changes.",
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "#include <array>",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "#include <string_view>",
+        "#include <vector>",
+        "",
+        '#include "hardware_interface/sample_batch.hpp"',
+        "",
+        f"namespace {namespace}",
+        "{",
+    ]
+    struct_names = set()
+    for layout in layouts:
+        struct_name = to_identifier(layout["name"], LAYOUT_MEMBERS)
+        if struct_name in struct_names:
+            raise LayoutError(f"Two ros2_control tags have the identifier '{struct_name}'.")
+        struct_names.add(struct_name)
+        for group in ("joints", "sensors", "gpios"):
+            check_unique(f"the {group} of '{layout['name']}'", layout[group])
+        for group in ("state_interfaces", "command_interfaces"):
+            names = [name for name, _ in layout[group]]
+            check_unique(f"the {group} of '{layout['name']}'", names)
+            # the index constants must not collide with the type aliases
+            type_aliases = {to_identifier(name) + "_type" for name in names}
+            for name in names:
+                if to_identifier(name) in type_aliases:
+                    raise LayoutError(
+                        f"The identifier of the interface '{name}' of '{layout['name']}' collides "
+                        "with the type of another interface."
+                    )
+
+        lines.append(f"/// Layout of the interfaces of the {layout['type']} '{layout['name']}'")
+        lines.append(f"struct {struct_name}")
+        lines.append("{")
+        lines.append(f'  static constexpr std::string_view NAME = "{layout["name"]}";')
+        lines.append(f'  static constexpr std::string_view TYPE = "{layout["type"]}";')
+        lines.append(f'  static constexpr std::string_view PLUGIN = "{layout["plugin"]}";')
+        lines.append("")
+        for group in ("joints", "sensors", "gpios"):
+            generate_names_struct(lines, group, layout[group])
+        lines.append("")
+        for group in ("state_interfaces", "command_interfaces"):
+            generate_names_struct(
+                lines,
+                group,
+                [name for name, _ in layout[group]],
+                [data_type for _, data_type in layout[group]],
+            )
+        lines.append("};")
+        lines.append("")
+    lines.append(f"}}  // namespace {namespace}")
+    lines.append("")
+    lines.append(f"#endif  // {guard}")
+    return "\n".join(lines) + "\n"
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("description", help="URDF or xacro file of the robot description")
+    parser.add_argument("--output", required=True, help="path of the generated header")
+    parser.add_argument("--namespace", required=True, help="C++ namespace of the layouts")
+    parser.add_argument(
+        "--header-name",
+        help="include path of the generated header, used for its include guard",
+    )
+    parser.add_argument("xacro_args", nargs="*", help="arguments of xacro, after '--'")
+    args = parser.parse_args(argv)
+
+    try:
+        layouts = parse_layouts(read_description(args.description, args.xacro_args))
+        header = generate_header(
+            layouts,
+            args.namespace,
+            os.path.basename(args.description),
+            args.header_name or os.path.basename(args.output),
+        )
+    except (LayoutError, OSError) as e:
+        print(f"generate_interface_layout: {e}", file=sys.stderr)
+        return 1
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "w", encoding="utf-8") as output:
+        output.write(header)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
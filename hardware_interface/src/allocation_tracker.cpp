@@ -0,0 +1,53 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/allocation_tracker.hpp"
+
+#include <atomic>
+
+namespace
+{
+// trivially constructed, so they are usable from the operator new replacement at any time
+thread_local bool tracking_enabled = false;
+thread_local uint64_t allocation_count = 0;
+std::atomic<bool> hook_installed{false};
+}  // namespace
+
+namespace hardware_interface
+{
+void AllocationTracker::record_allocation() noexcept
+{
+  if (tracking_enabled)
+  {
+    ++allocation_count;
+  }
+}
+
+void AllocationTracker::set_hook_installed() noexcept
+{
+  hook_installed.store(true, std::memory_order_relaxed);
+}
+
+bool AllocationTracker::is_hook_installed() noexcept
+{
+  return hook_installed.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::set_tracking_enabled(bool enabled) noexcept { tracking_enabled = enabled; }
+
+bool AllocationTracker::is_tracking_enabled() noexcept { return tracking_enabled; }
+
+uint64_t AllocationTracker::get_allocation_count() noexcept { return allocation_count; }
+
+}  // namespace hardware_interface
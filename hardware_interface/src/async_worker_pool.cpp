@@ -0,0 +1,303 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "hardware_interface/async_worker_pool.hpp"
+
+#include <cerrno>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <condition_variable>
+#else
+#include <semaphore.h>
+#endif
+
+#include "hardware_interface/realtime_thread.hpp"
+#include "rclcpp/logging.hpp"
+
+namespace hardware_interface
+{
+/// Semaphore of a worker, posted once per trigger of a task
+struct AsyncWorkerPool::Worker
+{
+#if defined(_WIN32)
+  void post()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++count;
+    }
+    cv.notify_one();
+  }
+
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]() { return count > 0; });
+    --count;
+  }
+#else
+  Worker() { sem_init(&semaphore, 0, 0); }
+  ~Worker() { sem_destroy(&semaphore); }
+
+  /// Lock-free, only enters the kernel if the worker is blocked in wait()
+  void post() { sem_post(&semaphore); }
+
+  void wait()
+  {
+    while (sem_wait(&semaphore) != 0 && errno == EINTR)
+    {
+    }
+  }
+#endif
+
+  Worker(const Worker &) = delete;
+  Worker & operator=(const Worker &) = delete;
+
+  /// Set by the trigger waking the worker up and while it scans or executes the tasks, a trigger
+  /// then wakes another worker up
+  std::atomic_bool busy{false};
+
+private:
+#if defined(_WIN32)
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::size_t count = 0;
+#else
+  sem_t semaphore;
+#endif
+};
+
+bool AsyncWorkerPool::Task::trigger(const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  if (state_.load(std::memory_order_acquire) != IDLE)
+  {
+    return false;
+  }
+  // the worker reads the arguments only once the task is pending
+  time_ = time;
+  period_ = period;
+  std::uint8_t expected = IDLE;
+  if (!state_.compare_exchange_strong(expected, PENDING, std::memory_order_acq_rel))
+  {
+    return false;
+  }
+  pool_->notify_pending(home_worker_);
+  return true;
+}
+
+bool AsyncWorkerPool::Task::is_idle() const
+{
+  const auto state = state_.load(std::memory_order_acquire);
+  return state != PENDING && state != RUNNING;
+}
+
+void AsyncWorkerPool::Task::wait_until_idle() const
+{
+  while (!is_idle())
+  {
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+}
+
+AsyncWorkerPool::AsyncWorkerPool(const AsyncWorkerPoolParams & params, rclcpp::Logger logger)
+: logger_(logger), tasks_(std::make_unique<Task[]>(params.max_tasks)), max_tasks_(params.max_tasks)
+{
+  for (std::size_t i = 0; i < max_tasks_; ++i)
+  {
+    tasks_[i].pool_ = this;
+    // the consecutive tasks are spread over the workers
+    tasks_[i].home_worker_ = params.number_of_workers > 0 ? i % params.number_of_workers : 0;
+  }
+  RealtimeThreadParams thread_params;
+  thread_params.thread_priority = params.thread_priority;
+  thread_params.stack_prefault_size = params.stack_prefault_size;
+  const std::size_t number_of_workers = params.number_of_workers;
+  wakeups_ = std::make_unique<Worker[]>(number_of_workers);
+  workers_.reserve(number_of_workers);
+  for (std::size_t i = 0; i < number_of_workers; ++i)
+  {
+    thread_params.name = params.name + "_" + std::to_string(i);
+    if (!params.cpu_affinity_cores.empty())
+    {
+      thread_params.cpu_affinity_cores = {
+        params.cpu_affinity_cores[i % params.cpu_affinity_cores.size()]};
+    }
+    workers_.push_back(create_realtime_thread(
+      thread_params, logger_,
+      [this, i, number_of_workers]() { worker_loop(i, number_of_workers); }));
+  }
+}
+
+AsyncWorkerPool::~AsyncWorkerPool()
+{
+  stop_.store(true, std::memory_order_release);
+  for (std::size_t i = 0; i < workers_.size(); ++i)
+  {
+    wakeups_[i].post();
+  }
+  for (auto & worker : workers_)
+  {
+    if (worker.joinable())
+    {
+      worker.join();
+    }
+  }
+}
+
+std::shared_ptr<AsyncWorkerPool::Task> AsyncWorkerPool::add_task(Callback callback)
+{
+  if (workers_.empty())
+  {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> guard(tasks_mutex_);
+  for (std::size_t i = 0; i < max_tasks_; ++i)
+  {
+    auto & task = tasks_[i];
+    std::uint8_t expected = Task::FREE;
+    if (!task.state_.compare_exchange_strong(expected, Task::DISABLED, std::memory_order_acq_rel))
+    {
+      continue;
+    }
+    task.callback_ = std::move(callback);
+    task.time_ = rclcpp::Time();
+    task.last_execution_time_ns_.store(0, std::memory_order_relaxed);
+    if (i >= used_tasks_.load(std::memory_order_relaxed))
+    {
+      used_tasks_.store(i + 1, std::memory_order_release);
+    }
+    task.state_.store(Task::IDLE, std::memory_order_release);
+    // the task shares the ownership of the pool
+    return std::shared_ptr<Task>(shared_from_this(), &task);
+  }
+  RCLCPP_ERROR(logger_, "Unable to add a task, the pool already has %zu tasks.", max_tasks_);
+  return nullptr;
+}
+
+void AsyncWorkerPool::remove_task(const std::shared_ptr<Task> & task)
+{
+  if (!task || task->pool_ != this)
+  {
+    return;
+  }
+  while (true)
+  {
+    std::uint8_t state = task->state_.load(std::memory_order_acquire);
+    if (state == Task::FREE || state == Task::DISABLED)
+    {
+      return;
+    }
+    if (state == Task::RUNNING)
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+      continue;
+    }
+    if (task->state_.compare_exchange_weak(state, Task::DISABLED, std::memory_order_acq_rel))
+    {
+      break;
+    }
+  }
+  std::lock_guard<std::mutex> guard(tasks_mutex_);
+  task->callback_ = nullptr;
+  task->state_.store(Task::FREE, std::memory_order_release);
+}
+
+void AsyncWorkerPool::notify_pending(std::size_t home_worker)
+{
+  // the woken worker scans all the tasks after the post, even if it is busy at the moment, so the
+  // choice of the worker only affects the latency of the task
+  const std::size_t number_of_workers = workers_.size();
+  for (std::size_t i = 0; i < number_of_workers; ++i)
+  {
+    auto & worker = wakeups_[(home_worker + i) % number_of_workers];
+    // the worker is claimed before the post, so that the next trigger doesn't choose it too
+    if (!worker.busy.exchange(true, std::memory_order_acq_rel))
+    {
+      worker.post();
+      return;
+    }
+  }
+  wakeups_[home_worker].post();
+}
+
+bool AsyncWorkerPool::try_execute(Task & task)
+{
+  std::uint8_t expected = Task::PENDING;
+  if (!task.state_.compare_exchange_strong(expected, Task::RUNNING, std::memory_order_acq_rel))
+  {
+    return false;
+  }
+  const auto start_time = std::chrono::steady_clock::now();
+  try
+  {
+    task.callback_(task.time_, task.period_);
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(logger_, "Caught exception in the asynchronous cycle of a task: %s", e.what());
+  }
+  catch (...)
+  {
+    RCLCPP_ERROR(logger_, "Caught unknown exception in the asynchronous cycle of a task.");
+  }
+  task.last_execution_time_ns_.store(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start_time)
+      .count(),
+    std::memory_order_release);
+  task.state_.store(Task::IDLE, std::memory_order_release);
+  return true;
+}
+
+void AsyncWorkerPool::worker_loop(std::size_t worker_index, std::size_t number_of_workers)
+{
+  auto & wakeup = wakeups_[worker_index];
+  while (true)
+  {
+    wakeup.busy.store(false, std::memory_order_release);
+    wakeup.wait();
+    if (stop_.load(std::memory_order_acquire))
+    {
+      return;
+    }
+    wakeup.busy.store(true, std::memory_order_release);
+
+    // the tasks of this worker first, then the tasks of the other workers. The post may have been
+    // consumed by an earlier scan that already executed the task, which isn't pending anymore.
+    const std::size_t used_tasks = used_tasks_.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < used_tasks; ++i)
+    {
+      if (tasks_[i].home_worker_ == worker_index)
+      {
+        try_execute(tasks_[i]);
+      }
+    }
+    for (std::size_t i = 0; i < used_tasks; ++i)
+    {
+      const auto offset = (i + worker_index * used_tasks / number_of_workers) % used_tasks;
+      if (tasks_[offset].home_worker_ != worker_index)
+      {
+        try_execute(tasks_[offset]);
+      }
+    }
+  }
+}
+
+}  // namespace hardware_interface
@@ -16,9 +16,11 @@
 #include <tinyxml2.h>
 
 #include <iostream>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -35,6 +37,7 @@
 #include "hardware_interface/helpers.hpp"
 #include "hardware_interface/lexical_casts.hpp"
 #include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "hardware_interface/types/statistics_types.hpp"
 #include "joint_limits/joint_limits_urdf.hpp"
 
 namespace
@@ -47,8 +50,11 @@ constexpr const auto kHardwareTag = "hardware";
 constexpr const auto kPluginNameTag = "plugin";
 constexpr const auto kParamTag = "param";
 constexpr const auto kGroupTag = "group";
+constexpr const auto kResourceNamespaceTag = "resource_namespace";
+constexpr const auto kBusTag = "bus";
 constexpr const auto kActuatorTag = "actuator";
 constexpr const auto kJointTag = "joint";
+constexpr const auto kLinkTag = "link";
 constexpr const auto kSensorTag = "sensor";
 constexpr const auto kGPIOTag = "gpio";
 constexpr const auto kTransmissionTag = "transmission";
@@ -59,11 +65,15 @@ constexpr const auto kMaxTag = "max";
 constexpr const auto kLimitsTag = "limits";
 constexpr const auto kPropertiesTag = "properties";
 constexpr const auto kAsyncTag = "async";
+constexpr const auto kRecoveryTag = "recovery";
 constexpr const auto kEnableAttribute = "enable";
 constexpr const auto kInitialValueTag = "initial_value";
 constexpr const auto kMimicAttribute = "mimic";
 constexpr const auto kDataTypeAttribute = "data_type";
 constexpr const auto kSizeAttribute = "size";
+constexpr const auto kLockFreeAttribute = "lock_free";
+constexpr const auto kPackedAttribute = "packed";
+constexpr const auto kPluginAttribute = "plugin";
 constexpr const auto kNameAttribute = "name";
 constexpr const auto kTypeAttribute = "type";
 constexpr const auto kRoleAttribute = "role";
@@ -71,11 +81,21 @@ constexpr const auto kReadOnlyAttribute = "read_only";
 constexpr const auto kReductionAttribute = "mechanical_reduction";
 constexpr const auto kOffsetAttribute = "offset";
 constexpr const auto kReadWriteRateAttribute = "rw_rate";
+constexpr const auto kReadWritePhaseAttribute = "rw_phase";
+constexpr const auto kTimeBudgetAttribute = "time_budget_us";
+constexpr const auto kTimeBudgetPolicyAttribute = "time_budget_policy";
+constexpr const auto kStatisticsTypeAttribute = "statistics_type";
+constexpr const auto kCriticalityAttribute = "criticality";
 constexpr const auto kIsAsyncAttribute = "is_async";
 constexpr const auto kThreadPriorityAttribute = "thread_priority";
 constexpr const auto kAffinityCoresAttribute = "affinity";
 constexpr const auto kSchedulingPolicyAttribute = "scheduling_policy";
 constexpr const auto kPrintWarningsAttribute = "print_warnings";
+constexpr const auto kControlLoopAttribute = "control_loop";
+constexpr const auto kMaxAttemptsAttribute = "max_attempts";
+constexpr const auto kInitialBackoffAttribute = "initial_backoff";
+constexpr const auto kMaxBackoffAttribute = "max_backoff";
+constexpr const auto kRestoreControllersAttribute = "restore_controllers";
 
 }  // namespace
 
@@ -163,23 +183,16 @@ double get_parameter_value_or(
 {
   while (params_it)
   {
-    try
+    // Fill the map with parameters
+    const auto tag_name = params_it->Name();
+    if (strcmp(tag_name, parameter_name) == 0)
     {
-      // Fill the map with parameters
-      const auto tag_name = params_it->Name();
-      if (strcmp(tag_name, parameter_name) == 0)
+      const auto tag_text = params_it->GetText();
+      if (tag_text)
       {
-        const auto tag_text = params_it->GetText();
-        if (tag_text)
-        {
-          return hardware_interface::stod(ros2_control::strip(tag_text));
-        }
+        return hardware_interface::try_stod(ros2_control::strip(tag_text)).value_or(default_value);
       }
     }
-    catch (const std::exception & e)
-    {
-      return default_value;
-    }
 
     params_it = params_it->NextSiblingElement();
   }
@@ -250,47 +263,284 @@ std::string parse_data_type_attribute(const tinyxml2::XMLElement * elem)
   return data_type;
 }
 
-/// Parse rw_rate attribute
+/// Parse lock_free attribute
 /**
- * Parses an XMLElement and returns the value of the rw_rate attribute.
- * Defaults to 0 if not specified.
+ * Parses an XMLElement and returns the value of the lock_free attribute.
+ * Defaults to "false" if not specified.
  *
- * \param[in] elem XMLElement that has the rw_rate attribute.
- * \return unsigned int specifying the read/write rate.
+ * \param[in] elem XMLElement that has the lock_free attribute.
+ * \return boolean specifying if the interface value should be stored lock-free.
  */
-unsigned int parse_rw_rate_attribute(const tinyxml2::XMLElement * elem)
+bool parse_lock_free_attribute(const tinyxml2::XMLElement * elem)
+{
+  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(kLockFreeAttribute);
+  return attr ? parse_bool(ros2_control::strip(attr->Value())) : false;
+}
+
+/// Parse packed attribute
+/**
+ * Parses an XMLElement and returns the value of the packed attribute.
+ * Defaults to "false" if not specified.
+ *
+ * \param[in] elem XMLElement that has the packed attribute.
+ * \return boolean specifying if the interface values should be stored packed.
+ */
+bool parse_packed_attribute(const tinyxml2::XMLElement * elem)
+{
+  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(kPackedAttribute);
+  return attr ? parse_bool(ros2_control::strip(attr->Value())) : false;
+}
+
+/// Parse a non-negative integer attribute
+/**
+ * Parses an XMLElement and returns the value of the attribute.
+ *
+ * \param[in] elem XMLElement that has the attribute.
+ * \param[in] attribute_name name of the attribute.
+ * \param[in] default_value value returned if the attribute is not specified.
+ * \return int specifying the value of the attribute.
+ * \throws std::runtime_error if the value is not a non-negative integer.
+ */
+int parse_non_negative_int_attribute(
+  const tinyxml2::XMLElement * elem, const char * attribute_name, int default_value)
 {
-  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(kReadWriteRateAttribute);
+  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(attribute_name);
   try
   {
-    const auto rw_rate = attr ? std::stoi(ros2_control::strip(attr->Value())) : 0;
-    if (rw_rate < 0)
+    const auto value = attr ? std::stoi(ros2_control::strip(attr->Value())) : default_value;
+    if (attr && value < 0)
     {
       throw std::runtime_error(
         fmt::format(
           FMT_COMPILE(
-            "Could not parse rw_rate tag in \"{}\". Got \"{}\", but expected a positive integer."),
-          elem->Name(), rw_rate));
+            "Could not parse {} tag in \"{}\". Got \"{}\", but expected a positive integer."),
+          attribute_name, elem->Name(), value));
     }
-    return static_cast<unsigned int>(rw_rate);
+    return value;
   }
   catch (const std::invalid_argument & e)
   {
     throw std::runtime_error(
       fmt::format(
         FMT_COMPILE(
-          "Could not parse rw_rate tag in \"{}\". Invalid value: \"{}\", expected a positive "
+          "Could not parse {} tag in \"{}\". Invalid value: \"{}\", expected a positive "
           "integer."),
-        elem->Name(), ros2_control::strip(attr->Value())));
+        attribute_name, elem->Name(), ros2_control::strip(attr->Value())));
   }
   catch (const std::out_of_range & e)
   {
     throw std::runtime_error(
       fmt::format(
         FMT_COMPILE(
-          "Could not parse rw_rate tag in \"{}\". Out of range value: \"{}\", expected a positive "
+          "Could not parse {} tag in \"{}\". Out of range value: \"{}\", expected a positive "
           "valid integer."),
-        elem->Name(), ros2_control::strip(attr->Value())));
+        attribute_name, elem->Name(), ros2_control::strip(attr->Value())));
+  }
+}
+
+/// Parse rw_rate attribute
+/**
+ * Parses an XMLElement and returns the value of the rw_rate attribute.
+ * Defaults to 0 if not specified.
+ *
+ * \param[in] elem XMLElement that has the rw_rate attribute.
+ * \return unsigned int specifying the read/write rate.
+ */
+unsigned int parse_rw_rate_attribute(const tinyxml2::XMLElement * elem)
+{
+  return static_cast<unsigned int>(
+    parse_non_negative_int_attribute(elem, kReadWriteRateAttribute, 0));
+}
+
+/// Parse rw_phase attribute
+/**
+ * Parses an XMLElement and returns the value of the rw_phase attribute.
+ * Defaults to -1 if not specified.
+ *
+ * \param[in] elem XMLElement that has the rw_phase attribute.
+ * \return int specifying the phase of the read/write cycles.
+ */
+int parse_rw_phase_attribute(const tinyxml2::XMLElement * elem)
+{
+  return parse_non_negative_int_attribute(elem, kReadWritePhaseAttribute, -1);
+}
+
+/// Parse time_budget_us attribute
+/**
+ * Parses an XMLElement and returns the value of the time_budget_us attribute.
+ * Defaults to 0 if not specified.
+ *
+ * \param[in] elem XMLElement that has the time_budget_us attribute.
+ * \return double specifying the time budget of the read and write in microseconds.
+ * \throws std::runtime_error if the value is not a non-negative number.
+ */
+double parse_time_budget_attribute(const tinyxml2::XMLElement * elem)
+{
+  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(kTimeBudgetAttribute);
+  if (!attr)
+  {
+    return 0.0;
+  }
+  const std::string value = ros2_control::strip(attr->Value());
+  const auto time_budget_us = hardware_interface::try_stod(value);
+  if (time_budget_us && *time_budget_us >= 0.0)
+  {
+    return *time_budget_us;
+  }
+  throw std::runtime_error(
+    fmt::format(
+      FMT_COMPILE(
+        "Could not parse {} tag in \"{}\". Invalid value: \"{}\", expected a non-negative "
+        "number."),
+      kTimeBudgetAttribute, elem->Name(), value));
+}
+
+/// Parse a non-negative floating point attribute
+/**
+ * \param[in] elem XMLElement that has the attribute.
+ * \param[in] attribute_name name of the attribute.
+ * \param[in] default_value value returned if the attribute is not specified.
+ * \return double specifying the value of the attribute.
+ * \throws std::runtime_error if the value is not a non-negative number.
+ */
+double parse_non_negative_double_attribute(
+  const tinyxml2::XMLElement * elem, const char * attribute_name, double default_value)
+{
+  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(attribute_name);
+  if (!attr)
+  {
+    return default_value;
+  }
+  const std::string value = ros2_control::strip(attr->Value());
+  const auto parsed_value = hardware_interface::try_stod(value);
+  if (parsed_value && *parsed_value >= 0.0)
+  {
+    return *parsed_value;
+  }
+  throw std::runtime_error(
+    fmt::format(
+      FMT_COMPILE(
+        "Could not parse {} tag in \"{}\". Invalid value: \"{}\", expected a non-negative "
+        "number."),
+      attribute_name, elem->Name(), value));
+}
+
+/// Parse the recovery properties of a hardware component
+/**
+ * Parses the <recovery> tag of the <properties> of a hardware component, e.g.
+ * <recovery max_attempts="5" initial_backoff="0.1" max_backoff="2.0" restore_controllers="true"/>
+ *
+ * \param[in] recovery_it XMLElement of the recovery tag.
+ * \return HardwareRecoveryParams of the component.
+ * \throws std::runtime_error if an attribute is not valid.
+ */
+hardware_interface::HardwareRecoveryParams parse_recovery_params(
+  const tinyxml2::XMLElement * recovery_it)
+{
+  hardware_interface::HardwareRecoveryParams recovery_params;
+  recovery_params.max_attempts = static_cast<unsigned int>(
+    parse_non_negative_int_attribute(recovery_it, kMaxAttemptsAttribute, 0));
+  recovery_params.initial_backoff = parse_non_negative_double_attribute(
+    recovery_it, kInitialBackoffAttribute, recovery_params.initial_backoff);
+  recovery_params.max_backoff = parse_non_negative_double_attribute(
+    recovery_it, kMaxBackoffAttribute, recovery_params.max_backoff);
+  if (recovery_params.max_backoff < recovery_params.initial_backoff)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Could not parse {} tag. The {} ({}) is smaller than the {} ({})."),
+        kRecoveryTag, kMaxBackoffAttribute, recovery_params.max_backoff,
+        kInitialBackoffAttribute, recovery_params.initial_backoff));
+  }
+  if (recovery_it->FindAttribute(kRestoreControllersAttribute))
+  {
+    recovery_params.restore_controllers = parse_bool(
+      get_attribute_value(recovery_it, kRestoreControllersAttribute, kRecoveryTag));
+  }
+  return recovery_params;
+}
+
+/// Parse time_budget_policy attribute
+/**
+ * Parses an XMLElement and returns the value of the time_budget_policy attribute.
+ * Defaults to "report" if not specified.
+ *
+ * \param[in] elem XMLElement that has the time_budget_policy attribute.
+ * \return TimeBudgetPolicy applied when a read or write exceeds the time budget.
+ * \throws std::runtime_error if the policy is not valid.
+ */
+hardware_interface::TimeBudgetPolicy parse_time_budget_policy_attribute(
+  const tinyxml2::XMLElement * elem)
+{
+  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(kTimeBudgetPolicyAttribute);
+  try
+  {
+    return attr ? hardware_interface::parse_time_budget_policy(ros2_control::strip(attr->Value()))
+                : hardware_interface::TimeBudgetPolicy::REPORT;
+  }
+  catch (const std::invalid_argument & e)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Could not parse {} tag in \"{}\". {}"), kTimeBudgetPolicyAttribute,
+        elem->Name(), e.what()));
+  }
+}
+
+/// Parse statistics_type attribute
+/**
+ * Parses an XMLElement and returns the value of the statistics_type attribute.
+ * Defaults to "cumulative" if not specified.
+ *
+ * \param[in] elem XMLElement that has the statistics_type attribute.
+ * \return std::string with the window of the execution time and periodicity statistics.
+ * \throws std::runtime_error if the value is not a valid statistics type.
+ */
+std::string parse_statistics_type_attribute(const tinyxml2::XMLElement * elem)
+{
+  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(kStatisticsTypeAttribute);
+  if (!attr)
+  {
+    return "cumulative";
+  }
+  const std::string value = ros2_control::strip(attr->Value());
+  try
+  {
+    ros2_control::parse_statistics_config(value);
+  }
+  catch (const std::invalid_argument & e)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Could not parse {} tag in \"{}\". {}"), kStatisticsTypeAttribute,
+        elem->Name(), e.what()));
+  }
+  return value;
+}
+
+/// Parse criticality attribute
+/**
+ * Parses an XMLElement and returns the value of the criticality attribute.
+ * Defaults to "control" if not specified.
+ *
+ * \param[in] elem XMLElement that has the criticality attribute.
+ * \return Criticality class of the hardware.
+ * \throws std::runtime_error if the criticality is not valid.
+ */
+hardware_interface::Criticality parse_criticality_attribute(const tinyxml2::XMLElement * elem)
+{
+  const tinyxml2::XMLAttribute * attr = elem->FindAttribute(kCriticalityAttribute);
+  try
+  {
+    return attr ? hardware_interface::parse_criticality(ros2_control::strip(attr->Value()))
+                : hardware_interface::Criticality::CONTROL;
+  }
+  catch (const std::invalid_argument & e)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Could not parse {} tag in \"{}\". {}"), kCriticalityAttribute, elem->Name(),
+        e.what()));
   }
 }
 
@@ -432,6 +682,7 @@ hardware_interface::InterfaceInfo parse_interfaces_from_xml(
 
   interface.data_type = parse_data_type_attribute(interfaces_it);
   interface.size = static_cast<int>(parse_size_attribute(interfaces_it));
+  interface.lock_free = parse_lock_free_attribute(interfaces_it);
 
   return interface;
 }
@@ -522,12 +773,15 @@ ComponentInfo parse_complex_component_from_xml(const tinyxml2::XMLElement * comp
   component.type = component_it->Name();
   component.name = get_attribute_value(component_it, kNameAttribute, component.type);
 
+  const bool packed = parse_packed_attribute(component_it);
+
   // Parse all command interfaces
   const auto * command_interfaces_it = component_it->FirstChildElement(kCommandInterfaceTag);
   while (command_interfaces_it)
   {
     component.command_interfaces.push_back(
       parse_interfaces_from_xml(command_interfaces_it, component.name));
+    component.command_interfaces.back().packed = packed;
     command_interfaces_it = command_interfaces_it->NextSiblingElement(kCommandInterfaceTag);
   }
 
@@ -537,6 +791,7 @@ ComponentInfo parse_complex_component_from_xml(const tinyxml2::XMLElement * comp
   {
     component.state_interfaces.push_back(
       parse_interfaces_from_xml(state_interfaces_it, component.name));
+    component.state_interfaces.back().packed = packed;
     state_interfaces_it = state_interfaces_it->NextSiblingElement(kStateInterfaceTag);
   }
 
@@ -701,6 +956,11 @@ HardwareInfo parse_resource_from_xml(
   hardware.name = get_attribute_value(ros2_control_it, kNameAttribute, kROS2ControlTag);
   hardware.type = get_attribute_value(ros2_control_it, kTypeAttribute, kROS2ControlTag);
   hardware.rw_rate = parse_rw_rate_attribute(ros2_control_it);
+  hardware.rw_phase = parse_rw_phase_attribute(ros2_control_it);
+  hardware.time_budget_us = parse_time_budget_attribute(ros2_control_it);
+  hardware.time_budget_policy = parse_time_budget_policy_attribute(ros2_control_it);
+  hardware.statistics_type = parse_statistics_type_attribute(ros2_control_it);
+  hardware.criticality = parse_criticality_attribute(ros2_control_it);
   hardware.is_async = parse_is_async_attribute(ros2_control_it);
   hardware.async_params.thread_priority = hardware.is_async
                                             ? parse_thread_priority_attribute(ros2_control_it)
@@ -728,6 +988,36 @@ HardwareInfo parse_resource_from_xml(
       {
         hardware.group = get_text_for_element(group_it, std::string("hardware.") + kGroupTag);
       }
+      const auto * namespace_it = ros2_control_child_it->FirstChildElement(kResourceNamespaceTag);
+      if (namespace_it)
+      {
+        hardware.resource_namespace = get_text_for_element(
+          namespace_it, std::string("hardware.") + kResourceNamespaceTag);
+        if (
+          hardware.resource_namespace.empty() || hardware.resource_namespace.front() == '/' ||
+          hardware.resource_namespace.back() == '/' ||
+          hardware.resource_namespace.find("//") != std::string::npos)
+        {
+          throw std::runtime_error(
+            fmt::format(
+              FMT_COMPILE(
+                "Invalid <resource_namespace> '{}' of hardware '{}', the levels of the "
+                "namespace must be non-empty and separated by single slashes."),
+              hardware.resource_namespace, hardware.name));
+        }
+      }
+      const auto * bus_it = ros2_control_child_it->FirstChildElement(kBusTag);
+      if (bus_it)
+      {
+        hardware.bus = get_text_for_element(bus_it, std::string("hardware.") + kBusTag);
+        if (hardware.bus.empty())
+        {
+          throw std::runtime_error(
+            fmt::format(FMT_COMPILE("Empty <bus> name of hardware '{}'."), hardware.name));
+        }
+        const auto * plugin_attribute = bus_it->Attribute(kPluginAttribute);
+        hardware.bus_plugin_name = plugin_attribute ? plugin_attribute : "";
+      }
       const auto * params_it = ros2_control_child_it->FirstChildElement(kParamTag);
       if (params_it)
       {
@@ -761,6 +1051,11 @@ HardwareInfo parse_resource_from_xml(
             hardware.async_params.print_warnings =
               parse_bool(get_attribute_value(async_it, kPrintWarningsAttribute, kAsyncTag));
           }
+          if (async_it->FindAttribute(kControlLoopAttribute))
+          {
+            hardware.async_params.control_loop =
+              get_attribute_value(async_it, kControlLoopAttribute, kAsyncTag);
+          }
         }
         catch (const std::exception & e)
         {
@@ -768,6 +1063,11 @@ HardwareInfo parse_resource_from_xml(
             fmt::format(FMT_COMPILE("Error parsing {} tag: {}"), kAsyncTag, e.what()));
         }
       }
+      const auto * recovery_it = ros2_control_child_it->FirstChildElement(kRecoveryTag);
+      if (recovery_it)
+      {
+        hardware.recovery_params = parse_recovery_params(recovery_it);
+      }
     }
     else if (std::string(kJointTag) == ros2_control_child_it->Name())
     {
@@ -796,6 +1096,9 @@ HardwareInfo parse_resource_from_xml(
   auto_fill_transmission_interfaces(hardware);
 
   hardware.original_xml = urdf;
+  tinyxml2::XMLPrinter description_printer(nullptr, true);
+  ros2_control_it->Accept(&description_printer);
+  hardware.description_xml = description_printer.CStr();
 
   return hardware;
 }
@@ -809,31 +1112,27 @@ HardwareInfo parse_resource_from_xml(
  */
 bool retrieve_min_max_interface_values(const InterfaceInfo & itf, double & min, double & max)
 {
-  try
+  if (itf.min.empty() && itf.max.empty())
   {
-    if (itf.min.empty() && itf.max.empty())
-    {
-      // If the limits don't exist then return false as they are not retrieved
-      return false;
-    }
-    if (!itf.min.empty())
-    {
-      min = hardware_interface::stod(itf.min);
-    }
-    if (!itf.max.empty())
-    {
-      max = hardware_interface::stod(itf.max);
-    }
-    return true;
+    // If the limits don't exist then return false as they are not retrieved
+    return false;
   }
-  catch (const std::invalid_argument & err)
+  // converted without exceptions, the limits are only set if both of them are valid
+  const auto min_value = itf.min.empty() ? std::optional<double>(min)
+                                         : hardware_interface::try_stod(itf.min);
+  const auto max_value = itf.max.empty() ? std::optional<double>(max)
+                                         : hardware_interface::try_stod(itf.max);
+  if (min_value && max_value)
   {
-    std::cerr << "Error parsing the limits for the interface: " << itf.name << " from the tags ["
-              << kMinTag << ": '" << itf.min << "' and " << kMaxTag << ": '" << itf.max
-              << "'] within " << kROS2ControlTag << " tag inside the URDF. Skipping it"
-              << std::endl;
-    return false;
+    min = *min_value;
+    max = *max_value;
+    return true;
   }
+  std::cerr << "Error parsing the limits for the interface: " << itf.name << " from the tags ["
+            << kMinTag << ": '" << itf.min << "' and " << kMaxTag << ": '" << itf.max
+            << "'] within " << kROS2ControlTag << " tag inside the URDF. Skipping it"
+            << std::endl;
+  return false;
 }
 
 /**
@@ -970,8 +1269,158 @@ void update_interface_limits(const ComponentInfo & joint, joint_limits::JointLim
   }
 }
 
+/// Returns the position after the end of an element tag starting at tag_begin, npos if none.
+/**
+ * The attribute values may contain '>', the quotes are skipped.
+ */
+std::size_t find_tag_end(std::string_view text, std::size_t tag_begin)
+{
+  char quote = '\0';
+  for (std::size_t i = tag_begin + 1; i < text.size(); ++i)
+  {
+    const char c = text[i];
+    if (quote != '\0')
+    {
+      quote = (c == quote) ? '\0' : quote;
+    }
+    else if (c == '"' || c == '\'')
+    {
+      quote = c;
+    }
+    else if (c == '>')
+    {
+      return i + 1;
+    }
+  }
+  return std::string_view::npos;
+}
+
+/// Returns the position after the end of the markup, npos if the markup is not terminated.
+std::size_t skip_markup(std::string_view text, std::size_t begin, std::string_view terminator)
+{
+  const auto end = text.find(terminator, begin);
+  return end == std::string_view::npos ? end : end + terminator.size();
+}
+
 }  // namespace detail
 
+std::string extract_control_resources_description(const std::string & urdf)
+{
+  constexpr auto npos = std::string_view::npos;
+  const std::string_view text(urdf);
+  // the reduced description is appended to a single buffer while scanning, only the elements that
+  // are open are tracked
+  std::string description;
+  std::vector<std::string_view> open_elements;
+  open_elements.reserve(32);
+  std::size_t recorded_element_begin = npos;
+  bool root_closed = false;
+
+  std::size_t pos = 0;
+  while ((pos = text.find('<', pos)) != npos)
+  {
+    const std::size_t tag_begin = pos;
+    const std::string_view markup = text.substr(tag_begin);
+    if (markup.compare(0, 4, "<!--") == 0)
+    {
+      pos = detail::skip_markup(text, tag_begin + 4, "-->");
+    }
+    else if (markup.compare(0, 9, "<![CDATA[") == 0)
+    {
+      pos = open_elements.empty() ? npos : detail::skip_markup(text, tag_begin + 9, "]]>");
+    }
+    else if (markup.compare(0, 2, "<?") == 0)
+    {
+      pos = detail::skip_markup(text, tag_begin + 2, "?>");
+    }
+    else if (markup.compare(0, 2, "<!") == 0)
+    {
+      // document type declarations with an internal subset are not supported
+      pos = detail::skip_markup(text, tag_begin + 2, ">");
+      if (pos != npos && text.substr(tag_begin, pos - tag_begin).find('[') != npos)
+      {
+        return {};
+      }
+    }
+    else
+    {
+      pos = detail::find_tag_end(text, tag_begin);
+      if (pos == npos)
+      {
+        return {};
+      }
+      const bool is_end_tag = text[tag_begin + 1] == '/';
+      const bool is_empty_element = !is_end_tag && text[pos - 2] == '/';
+      const std::size_t name_begin = tag_begin + (is_end_tag ? 2 : 1);
+      const std::string_view name =
+        text.substr(name_begin, text.find_first_of(" \t\r\n/>", name_begin) - name_begin);
+      const std::string_view tag = text.substr(tag_begin, pos - tag_begin);
+      if (name.empty() || root_closed)
+      {
+        return {};
+      }
+
+      if (is_end_tag)
+      {
+        if (open_elements.empty() || open_elements.back() != name)
+        {
+          return {};
+        }
+        open_elements.pop_back();
+        if (open_elements.size() == 1 && recorded_element_begin != npos)
+        {
+          description.append(text.substr(recorded_element_begin, pos - recorded_element_begin));
+          recorded_element_begin = npos;
+        }
+        else if (open_elements.empty())
+        {
+          description.append(tag);
+          root_closed = true;
+        }
+        continue;
+      }
+
+      if (open_elements.empty())
+      {
+        // the SDF descriptions are parsed completely
+        if (name != kRobotTag || is_empty_element)
+        {
+          return {};
+        }
+        description.append(tag);
+      }
+      else if (open_elements.size() == 1)
+      {
+        if (name == kROS2ControlTag || name == kJointTag)
+        {
+          if (is_empty_element)
+          {
+            description.append(tag);
+          }
+          else
+          {
+            recorded_element_begin = tag_begin;
+          }
+        }
+        else if (name == kLinkTag)
+        {
+          // only the attributes of the links are needed to build the tree of the robot
+          description.append(tag.substr(0, tag.size() - (is_empty_element ? 2 : 1))).append("/>");
+        }
+      }
+      if (!is_empty_element)
+      {
+        open_elements.push_back(name);
+      }
+    }
+  }
+  if (!root_closed)
+  {
+    return {};
+  }
+  return description;
+}
+
 std::vector<HardwareInfo> parse_control_resources_from_urdf(const std::string & urdf)
 {
   // Check if everything OK with URDF string
@@ -979,8 +1428,13 @@ std::vector<HardwareInfo> parse_control_resources_from_urdf(const std::string &
   {
     throw std::runtime_error("empty URDF passed to robot");
   }
+  // only the control resources and the joints are parsed, the complete URDF is parsed if it can't
+  // be reduced to get the same errors
+  const std::string control_resources_description = extract_control_resources_description(urdf);
+  const std::string & parsed_urdf =
+    control_resources_description.empty() ? urdf : control_resources_description;
   tinyxml2::XMLDocument doc;
-  if (!doc.Parse(urdf.c_str()) && doc.Error())
+  if (!doc.Parse(parsed_urdf.c_str()) && doc.Error())
   {
     throw std::runtime_error(
       fmt::format(FMT_COMPILE("invalid URDF passed in to robot parser: {}"), doc.ErrorStr()));
@@ -1026,7 +1480,7 @@ std::vector<HardwareInfo> parse_control_resources_from_urdf(const std::string &
 
   // parse full URDF for mimic options
   urdf::Model model;
-  if (!model.initString(urdf))
+  if (!model.initString(parsed_urdf))
   {
     throw std::runtime_error("Failed to parse URDF file");
   }
@@ -0,0 +1,436 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/cycle_profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "hardware_interface/name_pool.hpp"
+
+namespace
+{
+struct SectionSample
+{
+  uint32_t name_id = 0;
+  /// Index of the recording thread, the sections of a thread are nested
+  uint32_t thread_index = 0;
+  int64_t begin_ns = 0;
+  int64_t end_ns = 0;
+};
+
+struct CycleRecord
+{
+  int64_t begin_ns = 0;
+  int64_t end_ns = 0;
+  int64_t period_ns = 0;
+};
+
+enum ProfilerState : int
+{
+  IDLE,
+  /// Started, the recording begins at the end of the current cycle
+  ARMED,
+  RECORDING,
+  FINISHED
+};
+
+std::atomic<int> state{IDLE};
+/// Number of threads in record() or end_cycle(), the table isn't reallocated while they run
+std::atomic<int> writers{0};
+std::mutex control_mutex;
+
+std::unique_ptr<SectionSample[]> samples;
+std::unique_ptr<std::atomic<uint32_t>[]> section_counts;
+std::unique_ptr<CycleRecord[]> cycle_records;
+std::size_t cycle_capacity = 0;
+std::size_t sample_capacity = 0;
+std::size_t cycles_to_record = 0;
+std::size_t samples_per_cycle = 0;
+std::atomic<std::size_t> current_cycle{0};
+std::atomic<std::size_t> dropped_sections{0};
+std::atomic<uint32_t> number_of_threads{0};
+
+/// Index of the thread in the samples, assigned at its first recorded section
+thread_local int64_t thread_index = -1;
+
+constexpr double NS_TO_US = 1.e-3;
+
+/// Returns the nearest-rank percentile of the sorted values
+int64_t get_percentile(const std::vector<int64_t> & sorted_values, double percentile)
+{
+  if (sorted_values.empty())
+  {
+    return 0;
+  }
+  const auto rank =
+    static_cast<std::size_t>(std::ceil(percentile * static_cast<double>(sorted_values.size())));
+  return sorted_values[std::min(std::max<std::size_t>(rank, 1), sorted_values.size()) - 1];
+}
+
+double get_mean(const std::vector<int64_t> & values)
+{
+  if (values.empty())
+  {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (const int64_t value : values)
+  {
+    sum += static_cast<double>(value);
+  }
+  return sum / static_cast<double>(values.size());
+}
+
+/// Accumulates, for every sample of the cycle, its time on the critical path of the cycle
+void add_critical_path_times(
+  const CycleRecord & cycle, const SectionSample * cycle_samples, std::size_t number_of_samples,
+  std::vector<int64_t> & critical_ns)
+{
+  critical_ns.assign(number_of_samples, 0);
+  std::vector<int64_t> boundaries;
+  boundaries.reserve(2 * number_of_samples + 2);
+  boundaries.push_back(cycle.begin_ns);
+  boundaries.push_back(cycle.end_ns);
+  for (std::size_t i = 0; i < number_of_samples; ++i)
+  {
+    boundaries.push_back(std::clamp(cycle_samples[i].begin_ns, cycle.begin_ns, cycle.end_ns));
+    boundaries.push_back(std::clamp(cycle_samples[i].end_ns, cycle.begin_ns, cycle.end_ns));
+  }
+  std::sort(boundaries.begin(), boundaries.end());
+  boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+  std::vector<std::size_t> covering;
+  for (std::size_t b = 1; b < boundaries.size(); ++b)
+  {
+    const int64_t interval_begin = boundaries[b - 1];
+    const int64_t interval_end = boundaries[b];
+    covering.clear();
+    for (std::size_t i = 0; i < number_of_samples; ++i)
+    {
+      if (cycle_samples[i].begin_ns <= interval_begin && cycle_samples[i].end_ns >= interval_end)
+      {
+        covering.push_back(i);
+      }
+    }
+    // of the innermost covering sections of the threads, the one ending last gates the progress
+    // of the cycle
+    std::size_t owner = number_of_samples;
+    for (const std::size_t i : covering)
+    {
+      const auto & sample = cycle_samples[i];
+      const bool contains_another = std::any_of(
+        covering.begin(), covering.end(),
+        [&](std::size_t j)
+        {
+          const auto & other = cycle_samples[j];
+          if (other.thread_index != sample.thread_index)
+          {
+            return false;
+          }
+          const bool same_interval =
+            other.begin_ns == sample.begin_ns && other.end_ns == sample.end_ns;
+          // of two equal sections, the inner one is recorded first
+          return j != i && other.begin_ns >= sample.begin_ns && other.end_ns <= sample.end_ns &&
+                 (!same_interval || j < i);
+        });
+      if (
+        !contains_another &&
+        (owner == number_of_samples || sample.end_ns > cycle_samples[owner].end_ns))
+      {
+        owner = i;
+      }
+    }
+    if (owner < number_of_samples)
+    {
+      critical_ns[owner] += interval_end - interval_begin;
+    }
+  }
+}
+}  // namespace
+
+namespace hardware_interface
+{
+std::string CycleProfileReport::to_string() const
+{
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(1);
+  os << "Profiled " << cycles << " cycles with " << overrun_cycles
+     << " overruns, cycle mean = " << cycle_mean_us << " us, p99 = " << cycle_p99_us
+     << " us, max = " << cycle_max_us << " us";
+  for (std::size_t i = 0; i < sections.size(); ++i)
+  {
+    const auto & section = sections[i];
+    os << "\n  " << i + 1 << ". " << section.name << ": p99 = " << section.p99_us
+       << " us, mean = " << section.mean_us << " us, max = " << section.max_us << " us, "
+       << 100.0 * section.critical_path_share << "% of the critical path";
+    if (overrun_cycles > 0)
+    {
+      os << ", " << 100.0 * section.overrun_share << "% of the overruns";
+    }
+  }
+  if (dropped_sections > 0)
+  {
+    os << "\n  " << dropped_sections
+       << " sections were dropped, the cycles ran more sections than preallocated";
+  }
+  return os.str();
+}
+
+bool CycleProfiler::start(std::size_t cycles, std::size_t sections_per_cycle)
+{
+  std::lock_guard<std::mutex> lock(control_mutex);
+  if (cycles == 0 || sections_per_cycle == 0 || state.load() != IDLE)
+  {
+    return false;
+  }
+  // the threads that saw the previous recording have left, the new ones see the idle state
+  while (writers.load() != 0)
+  {
+    std::this_thread::yield();
+  }
+  if (cycles > cycle_capacity)
+  {
+    section_counts = std::make_unique<std::atomic<uint32_t>[]>(cycles);
+    cycle_records = std::make_unique<CycleRecord[]>(cycles);
+    cycle_capacity = cycles;
+  }
+  if (cycles * sections_per_cycle > sample_capacity)
+  {
+    samples = std::make_unique<SectionSample[]>(cycles * sections_per_cycle);
+    sample_capacity = cycles * sections_per_cycle;
+  }
+  for (std::size_t i = 0; i < cycles; ++i)
+  {
+    section_counts[i].store(0, std::memory_order_relaxed);
+  }
+  cycles_to_record = cycles;
+  samples_per_cycle = sections_per_cycle;
+  current_cycle.store(0);
+  dropped_sections.store(0);
+  state.store(ARMED);
+  return true;
+}
+
+bool CycleProfiler::is_recording() noexcept { return state.load() == RECORDING; }
+
+bool CycleProfiler::is_finished() noexcept { return state.load() == FINISHED; }
+
+void CycleProfiler::record(uint32_t name_id, int64_t begin_ns, int64_t end_ns) noexcept
+{
+  if (name_id == 0 || state.load(std::memory_order_relaxed) != RECORDING)
+  {
+    return;
+  }
+  writers.fetch_add(1);
+  if (state.load() == RECORDING)
+  {
+    const std::size_t cycle = current_cycle.load();
+    if (cycle < cycles_to_record)
+    {
+      const uint32_t index = section_counts[cycle].fetch_add(1, std::memory_order_relaxed);
+      if (index < samples_per_cycle)
+      {
+        if (thread_index < 0)
+        {
+          thread_index = number_of_threads.fetch_add(1, std::memory_order_relaxed);
+        }
+        samples[cycle * samples_per_cycle + index] =
+          SectionSample{name_id, static_cast<uint32_t>(thread_index), begin_ns, end_ns};
+      }
+      else
+      {
+        dropped_sections.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+  writers.fetch_sub(1);
+}
+
+void CycleProfiler::end_cycle(int64_t begin_ns, int64_t end_ns, int64_t period_ns) noexcept
+{
+  if (state.load(std::memory_order_relaxed) == IDLE)
+  {
+    return;
+  }
+  writers.fetch_add(1);
+  const int current_state = state.load();
+  if (current_state == ARMED)
+  {
+    state.store(RECORDING);
+  }
+  else if (current_state == RECORDING)
+  {
+    const std::size_t cycle = current_cycle.load();
+    cycle_records[cycle] = CycleRecord{begin_ns, end_ns, period_ns};
+    current_cycle.store(cycle + 1);
+    if (cycle + 1 == cycles_to_record)
+    {
+      state.store(FINISHED);
+    }
+  }
+  writers.fetch_sub(1);
+}
+
+CycleProfileReport CycleProfiler::stop()
+{
+  std::lock_guard<std::mutex> lock(control_mutex);
+  CycleProfileReport report;
+  if (state.exchange(IDLE) == IDLE)
+  {
+    return report;
+  }
+  while (writers.load() != 0)
+  {
+    std::this_thread::yield();
+  }
+  report.cycles = std::min(current_cycle.load(), cycles_to_record);
+  report.dropped_sections = dropped_sections.load();
+
+  struct SectionData
+  {
+    uint32_t name_id = 0;
+    std::vector<int64_t> durations_ns;
+    /// Time on the critical path in every cycle
+    std::vector<int64_t> cycle_critical_ns;
+    int64_t median_critical_ns = 0;
+    std::size_t overruns = 0;
+  };
+  std::vector<SectionData> sections;
+  std::unordered_map<uint32_t, std::size_t> section_indices;
+  std::vector<int64_t> cycle_durations_ns;
+  cycle_durations_ns.reserve(report.cycles);
+  std::vector<bool> overrun(report.cycles, false);
+  int64_t total_cycle_ns = 0;
+  std::vector<int64_t> critical_ns;
+
+  for (std::size_t cycle = 0; cycle < report.cycles; ++cycle)
+  {
+    const CycleRecord & cycle_record = cycle_records[cycle];
+    const int64_t cycle_duration_ns = cycle_record.end_ns - cycle_record.begin_ns;
+    cycle_durations_ns.push_back(cycle_duration_ns);
+    total_cycle_ns += cycle_duration_ns;
+    overrun[cycle] = cycle_record.period_ns > 0 && cycle_duration_ns > cycle_record.period_ns;
+    report.overrun_cycles += overrun[cycle] ? 1 : 0;
+
+    const SectionSample * cycle_samples = &samples[cycle * samples_per_cycle];
+    const std::size_t number_of_samples = std::min<std::size_t>(
+      section_counts[cycle].load(std::memory_order_relaxed), samples_per_cycle);
+    add_critical_path_times(cycle_record, cycle_samples, number_of_samples, critical_ns);
+    for (std::size_t i = 0; i < number_of_samples; ++i)
+    {
+      const auto & sample = cycle_samples[i];
+      auto [it, inserted] = section_indices.emplace(sample.name_id, sections.size());
+      if (inserted)
+      {
+        sections.emplace_back();
+        sections.back().name_id = sample.name_id;
+        sections.back().cycle_critical_ns.assign(report.cycles, 0);
+      }
+      auto & section = sections[it->second];
+      section.durations_ns.push_back(sample.end_ns - sample.begin_ns);
+      section.cycle_critical_ns[cycle] += critical_ns[i];
+    }
+  }
+
+  for (auto & section : sections)
+  {
+    std::vector<int64_t> sorted_critical_ns = section.cycle_critical_ns;
+    std::sort(sorted_critical_ns.begin(), sorted_critical_ns.end());
+    section.median_critical_ns = get_percentile(sorted_critical_ns, 0.5);
+  }
+  // every overrun is attributed to the section exceeding its usual critical time by the most
+  for (std::size_t cycle = 0; cycle < report.cycles; ++cycle)
+  {
+    if (!overrun[cycle])
+    {
+      continue;
+    }
+    SectionData * offender = nullptr;
+    int64_t max_excess_ns = 0;
+    for (auto & section : sections)
+    {
+      const int64_t excess_ns = section.cycle_critical_ns[cycle] - section.median_critical_ns;
+      if (excess_ns > max_excess_ns)
+      {
+        max_excess_ns = excess_ns;
+        offender = &section;
+      }
+    }
+    if (offender)
+    {
+      ++offender->overruns;
+    }
+  }
+
+  std::sort(cycle_durations_ns.begin(), cycle_durations_ns.end());
+  report.cycle_mean_us = get_mean(cycle_durations_ns) * NS_TO_US;
+  report.cycle_p99_us = static_cast<double>(get_percentile(cycle_durations_ns, 0.99)) * NS_TO_US;
+  report.cycle_max_us =
+    cycle_durations_ns.empty() ? 0.0 : static_cast<double>(cycle_durations_ns.back()) * NS_TO_US;
+
+  report.sections.reserve(sections.size());
+  for (auto & section : sections)
+  {
+    std::sort(section.durations_ns.begin(), section.durations_ns.end());
+    ProfiledSection profiled_section;
+    profiled_section.name = NamePool::get_name(section.name_id);
+    profiled_section.count = section.durations_ns.size();
+    profiled_section.mean_us = get_mean(section.durations_ns) * NS_TO_US;
+    profiled_section.p99_us =
+      static_cast<double>(get_percentile(section.durations_ns, 0.99)) * NS_TO_US;
+    profiled_section.max_us = static_cast<double>(section.durations_ns.back()) * NS_TO_US;
+    int64_t section_critical_ns = 0;
+    for (const int64_t cycle_critical_ns : section.cycle_critical_ns)
+    {
+      section_critical_ns += cycle_critical_ns;
+    }
+    profiled_section.critical_path_share =
+      total_cycle_ns > 0
+        ? static_cast<double>(section_critical_ns) / static_cast<double>(total_cycle_ns)
+        : 0.0;
+    profiled_section.overruns = section.overruns;
+    profiled_section.overrun_share =
+      report.overrun_cycles > 0
+        ? static_cast<double>(section.overruns) / static_cast<double>(report.overrun_cycles)
+        : 0.0;
+    report.sections.push_back(std::move(profiled_section));
+  }
+  std::sort(
+    report.sections.begin(), report.sections.end(),
+    [](const ProfiledSection & a, const ProfiledSection & b)
+    {
+      if (a.overruns != b.overruns)
+      {
+        return a.overruns > b.overruns;
+      }
+      if (a.critical_path_share != b.critical_path_share)
+      {
+        return a.critical_path_share > b.critical_path_share;
+      }
+      return a.name < b.name;
+    });
+  return report;
+}
+
+}  // namespace hardware_interface
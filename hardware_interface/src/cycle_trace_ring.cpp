@@ -0,0 +1,215 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/cycle_trace_ring.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "hardware_interface/trace_recorder.hpp"
+
+namespace
+{
+using hardware_interface::TraceEvent;
+
+struct RingSample
+{
+  TraceEvent event;
+  /// Cycle the sample was recorded in, a sample of an older cycle is stale
+  uint64_t cycle = 0;
+};
+
+std::atomic<bool> recording_enabled{false};
+std::mutex enable_mutex;
+
+/// One slot more than the kept cycles, for the cycle that is running
+std::unique_ptr<RingSample[]> samples;
+std::unique_ptr<std::atomic<uint32_t>[]> slot_counts;
+std::unique_ptr<std::atomic<uint64_t>[]> slot_cycles;
+/// The cycles themselves, kept apart so that they are not dropped with the further sections
+std::unique_ptr<TraceEvent[]> cycle_events;
+std::size_t number_of_slots = 0;
+std::size_t samples_per_slot = 0;
+std::atomic<uint64_t> current_cycle{0};
+
+std::unique_ptr<TraceEvent[]> frozen_events;
+std::size_t number_of_frozen_events = 0;
+/// Set by the control loop when the frozen events are written, cleared when they are taken
+std::atomic<bool> frozen_events_pending{false};
+/// Cycle running when the ring was last frozen, to freeze every cycle once
+uint64_t last_frozen_cycle = UINT64_MAX;
+std::atomic<uint64_t> freezes{0};
+std::atomic<uint64_t> skipped_freezes{0};
+
+std::atomic<uint32_t> number_of_threads{0};
+/// Index of the thread in the events, assigned at its first recorded section
+thread_local int64_t thread_index = -1;
+
+void record_in_slot(uint64_t cycle, const TraceEvent & event) noexcept
+{
+  const std::size_t slot = static_cast<std::size_t>(cycle % number_of_slots);
+  const uint32_t index = slot_counts[slot].fetch_add(1, std::memory_order_relaxed);
+  if (index < samples_per_slot)
+  {
+    samples[slot * samples_per_slot + index] = RingSample{event, cycle};
+  }
+}
+
+uint32_t get_thread_index() noexcept
+{
+  if (thread_index < 0)
+  {
+    thread_index = number_of_threads.fetch_add(1, std::memory_order_relaxed);
+  }
+  return static_cast<uint32_t>(thread_index);
+}
+}  // namespace
+
+namespace hardware_interface
+{
+void CycleTraceRing::enable(std::size_t cycles, std::size_t sections_per_cycle)
+{
+  std::lock_guard<std::mutex> lock(enable_mutex);
+  if (!samples && cycles > 0 && sections_per_cycle > 0)
+  {
+    number_of_slots = cycles + 1;
+    samples_per_slot = sections_per_cycle;
+    samples = std::make_unique<RingSample[]>(number_of_slots * samples_per_slot);
+    slot_counts = std::make_unique<std::atomic<uint32_t>[]>(number_of_slots);
+    slot_cycles = std::make_unique<std::atomic<uint64_t>[]>(number_of_slots);
+    cycle_events = std::make_unique<TraceEvent[]>(number_of_slots);
+    for (std::size_t slot = 0; slot < number_of_slots; ++slot)
+    {
+      slot_counts[slot].store(0, std::memory_order_relaxed);
+      // no cycle was recorded in the slots yet
+      slot_cycles[slot].store(UINT64_MAX, std::memory_order_relaxed);
+    }
+    slot_cycles[0].store(0, std::memory_order_relaxed);
+    frozen_events = std::make_unique<TraceEvent[]>(cycles * (sections_per_cycle + 1));
+  }
+  recording_enabled.store(samples != nullptr, std::memory_order_release);
+}
+
+void CycleTraceRing::disable() noexcept
+{
+  recording_enabled.store(false, std::memory_order_release);
+}
+
+bool CycleTraceRing::is_enabled() noexcept
+{
+  return recording_enabled.load(std::memory_order_acquire);
+}
+
+void CycleTraceRing::record(uint32_t name_id, int64_t begin_ns, int64_t end_ns) noexcept
+{
+  if (name_id == 0 || !is_enabled())
+  {
+    return;
+  }
+  record_in_slot(
+    current_cycle.load(std::memory_order_acquire),
+    TraceEvent{name_id, get_thread_index(), begin_ns, end_ns});
+}
+
+void CycleTraceRing::end_cycle(uint32_t name_id, int64_t begin_ns, int64_t end_ns) noexcept
+{
+  if (!is_enabled())
+  {
+    return;
+  }
+  const uint64_t cycle = current_cycle.load(std::memory_order_relaxed);
+  cycle_events[static_cast<std::size_t>(cycle % number_of_slots)] =
+    TraceEvent{name_id, get_thread_index(), begin_ns, end_ns};
+  // the slot of the oldest cycle is reused for the next one
+  const std::size_t next_slot = static_cast<std::size_t>((cycle + 1) % number_of_slots);
+  slot_counts[next_slot].store(0, std::memory_order_relaxed);
+  slot_cycles[next_slot].store(cycle + 1, std::memory_order_relaxed);
+  current_cycle.store(cycle + 1, std::memory_order_release);
+}
+
+bool CycleTraceRing::freeze() noexcept
+{
+  if (!is_enabled())
+  {
+    return false;
+  }
+  const uint64_t running_cycle = current_cycle.load(std::memory_order_relaxed);
+  if (running_cycle == last_frozen_cycle)
+  {
+    return false;
+  }
+  if (frozen_events_pending.load(std::memory_order_acquire))
+  {
+    skipped_freezes.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  last_frozen_cycle = running_cycle;
+  std::size_t number_of_events = 0;
+  // the complete cycles, oldest first, without the running one
+  const uint64_t kept_cycles = number_of_slots - 1;
+  const uint64_t first_cycle = running_cycle > kept_cycles ? running_cycle - kept_cycles : 0;
+  for (uint64_t cycle = first_cycle; cycle < running_cycle; ++cycle)
+  {
+    const std::size_t slot = static_cast<std::size_t>(cycle % number_of_slots);
+    if (slot_cycles[slot].load(std::memory_order_relaxed) != cycle)
+    {
+      continue;
+    }
+    if (cycle_events[slot].name_id != 0)
+    {
+      frozen_events[number_of_events++] = cycle_events[slot];
+    }
+    const std::size_t count = std::min<std::size_t>(
+      slot_counts[slot].load(std::memory_order_relaxed), samples_per_slot);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const RingSample & sample = samples[slot * samples_per_slot + i];
+      if (sample.cycle == cycle)
+      {
+        frozen_events[number_of_events++] = sample.event;
+      }
+    }
+  }
+  number_of_frozen_events = number_of_events;
+  freezes.fetch_add(1, std::memory_order_relaxed);
+  frozen_events_pending.store(true, std::memory_order_release);
+  return true;
+}
+
+std::size_t CycleTraceRing::take_frozen_events(std::vector<TraceEvent> & events)
+{
+  if (!frozen_events_pending.load(std::memory_order_acquire))
+  {
+    return 0;
+  }
+  const std::size_t number_of_events = number_of_frozen_events;
+  events.insert(events.end(), frozen_events.get(), frozen_events.get() + number_of_events);
+  frozen_events_pending.store(false, std::memory_order_release);
+  return number_of_events;
+}
+
+uint64_t CycleTraceRing::get_number_of_freezes() noexcept
+{
+  return freezes.load(std::memory_order_relaxed);
+}
+
+uint64_t CycleTraceRing::get_skipped_freezes() noexcept
+{
+  return skipped_freezes.load(std::memory_order_relaxed);
+}
+
+}  // namespace hardware_interface
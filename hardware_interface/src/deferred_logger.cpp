@@ -0,0 +1,396 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/deferred_logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/realtime_thread.hpp"
+#include "rclcpp/logging.hpp"
+
+namespace
+{
+/// Ring buffer of the records of a single logging thread
+struct DeferredLogRing
+{
+  std::unique_ptr<hardware_interface::DeferredLogRecord[]> records;
+  std::size_t capacity = 0;
+  /// Written by the logging thread only
+  alignas(64) std::atomic<uint64_t> head{0};
+  /// Written by the flushing thread only
+  alignas(64) std::atomic<uint64_t> tail{0};
+};
+
+std::atomic<bool> backend_started{false};
+std::mutex start_mutex;
+std::size_t number_of_users = 0;
+std::unique_ptr<DeferredLogRing[]> rings;
+std::size_t number_of_rings = 0;
+std::atomic<std::size_t> claimed_rings{0};
+std::atomic<uint64_t> dropped_messages{0};
+
+std::mutex flush_mutex;
+uint64_t reported_dropped_messages = 0;
+std::vector<hardware_interface::DeferredLogRecord> flushed_records;
+
+std::thread flush_thread;
+std::mutex flush_thread_mutex;
+std::condition_variable flush_thread_cv;
+bool flush_thread_stop = false;
+
+/// Index of the ring of the thread, -1 if not claimed yet and -2 if no ring is left
+thread_local int64_t thread_ring_index = -1;
+
+void output(const hardware_interface::DeferredLogRecord & record) noexcept
+{
+  try
+  {
+    const std::string message = hardware_interface::DeferredLogger::format(record);
+    rcutils_log(
+      record.location, record.severity, record.logger_name.data(), "%s", message.c_str());
+  }
+  catch (const std::exception &)
+  {
+    // a message that can't be formatted is not output, the logging has no error to report
+  }
+}
+
+/// Appends the conversion of the value with the printf specification
+template <typename T>
+void append_formatted(std::string & message, const std::string & specification, T value)
+{
+  char buffer[128];
+  const int size = std::snprintf(buffer, sizeof(buffer), specification.c_str(), value);
+  if (size < 0)
+  {
+    return;
+  }
+  if (static_cast<std::size_t>(size) < sizeof(buffer))
+  {
+    message.append(buffer, static_cast<std::size_t>(size));
+    return;
+  }
+  const std::size_t offset = message.size();
+  message.resize(offset + static_cast<std::size_t>(size) + 1);
+  std::snprintf(&message[offset], static_cast<std::size_t>(size) + 1, specification.c_str(), value);
+  message.resize(offset + static_cast<std::size_t>(size));
+}
+
+int64_t as_signed(const hardware_interface::DeferredLogArgument & argument)
+{
+  using Type = hardware_interface::DeferredLogArgument::Type;
+  switch (argument.type)
+  {
+    case Type::FLOATING_POINT:
+      return static_cast<int64_t>(argument.floating_point_value);
+    case Type::POINTER:
+      return static_cast<int64_t>(reinterpret_cast<std::uintptr_t>(argument.pointer_value));
+    case Type::STRING:
+      return 0;
+    default:
+      return argument.signed_value;
+  }
+}
+
+double as_floating_point(const hardware_interface::DeferredLogArgument & argument)
+{
+  using Type = hardware_interface::DeferredLogArgument::Type;
+  switch (argument.type)
+  {
+    case Type::FLOATING_POINT:
+      return argument.floating_point_value;
+    case Type::SIGNED:
+      return static_cast<double>(argument.signed_value);
+    case Type::UNSIGNED:
+      return static_cast<double>(argument.unsigned_value);
+    default:
+      return 0.0;
+  }
+}
+
+void flush_loop(std::chrono::milliseconds flush_period)
+{
+  std::unique_lock<std::mutex> lock(flush_thread_mutex);
+  while (!flush_thread_stop)
+  {
+    flush_thread_cv.wait_for(lock, flush_period, [] { return flush_thread_stop; });
+    lock.unlock();
+    hardware_interface::DeferredLogger::flush();
+    lock.lock();
+  }
+}
+}  // namespace
+
+namespace hardware_interface
+{
+void DeferredLogger::start(
+  std::size_t records_per_thread, std::size_t max_threads, std::chrono::milliseconds flush_period)
+{
+  std::lock_guard<std::mutex> lock(start_mutex);
+  if (!rings && records_per_thread > 0 && max_threads > 0)
+  {
+    rings = std::make_unique<DeferredLogRing[]>(max_threads);
+    for (std::size_t i = 0; i < max_threads; ++i)
+    {
+      rings[i].records = std::make_unique<DeferredLogRecord[]>(records_per_thread);
+      rings[i].capacity = records_per_thread;
+    }
+    number_of_rings = max_threads;
+  }
+  if (!rings || number_of_users++ > 0)
+  {
+    return;
+  }
+  flush_thread_stop = false;
+  // the thread runs with the default scheduling, below the priority of the real-time threads
+  RealtimeThreadParams thread_params;
+  thread_params.name = "deferred_logger";
+  flush_thread = create_realtime_thread(
+    thread_params, rclcpp::get_logger("deferred_logger"),
+    [flush_period]() { flush_loop(flush_period); });
+  backend_started.store(true, std::memory_order_release);
+}
+
+void DeferredLogger::stop()
+{
+  std::lock_guard<std::mutex> lock(start_mutex);
+  if (number_of_users == 0 || --number_of_users > 0)
+  {
+    return;
+  }
+  // the messages logged from now on are output immediately, the pending ones are flushed below
+  backend_started.store(false, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> thread_lock(flush_thread_mutex);
+    flush_thread_stop = true;
+  }
+  flush_thread_cv.notify_all();
+  flush_thread.join();
+  flush();
+}
+
+bool DeferredLogger::is_started() noexcept
+{
+  return backend_started.load(std::memory_order_acquire);
+}
+
+std::size_t DeferredLogger::flush()
+{
+  std::lock_guard<std::mutex> lock(flush_mutex);
+  if (!rings)
+  {
+    return 0;
+  }
+  flushed_records.clear();
+  const std::size_t used_rings =
+    std::min(claimed_rings.load(std::memory_order_relaxed), number_of_rings);
+  for (std::size_t i = 0; i < used_rings; ++i)
+  {
+    auto & ring = rings[i];
+    const uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    const uint64_t head = ring.head.load(std::memory_order_acquire);
+    for (uint64_t index = tail; index < head; ++index)
+    {
+      flushed_records.push_back(ring.records[index % ring.capacity]);
+    }
+    ring.tail.store(head, std::memory_order_release);
+  }
+  std::stable_sort(
+    flushed_records.begin(), flushed_records.end(),
+    [](const DeferredLogRecord & a, const DeferredLogRecord & b)
+    { return a.stamp_ns < b.stamp_ns; });
+  for (const auto & record : flushed_records)
+  {
+    output(record);
+  }
+
+  const uint64_t dropped = dropped_messages.load(std::memory_order_relaxed);
+  if (dropped > reported_dropped_messages)
+  {
+    RCLCPP_WARN(
+      rclcpp::get_logger("deferred_logger"),
+      "%lu log messages of the real-time threads were dropped because their buffer was full.",
+      static_cast<unsigned long>(dropped - reported_dropped_messages));  // NOLINT(runtime/int)
+    reported_dropped_messages = dropped;
+  }
+  return flushed_records.size();
+}
+
+uint64_t DeferredLogger::get_dropped_messages() noexcept
+{
+  return dropped_messages.load(std::memory_order_relaxed);
+}
+
+std::string DeferredLogger::format(const DeferredLogRecord & record)
+{
+  std::string message;
+  if (record.format == nullptr)
+  {
+    return message;
+  }
+  std::size_t next_argument = 0;
+  const char * it = record.format;
+  while (*it != '\0')
+  {
+    if (*it != '%')
+    {
+      const char * literal_end = std::strchr(it, '%');
+      const std::size_t size = literal_end ? static_cast<std::size_t>(literal_end - it)
+                                           : std::strlen(it);
+      message.append(it, size);
+      it += size;
+      continue;
+    }
+    if (it[1] == '%')
+    {
+      message.push_back('%');
+      it += 2;
+      continue;
+    }
+    // conversion specification: flags, width, precision, length modifier and conversion
+    const char * specification_begin = it++;
+    it += std::strspn(it, "-+ #0");
+    it += std::strspn(it, "0123456789*");
+    if (*it == '.')
+    {
+      ++it;
+      it += std::strspn(it, "0123456789*");
+    }
+    const char * length_begin = it;
+    it += std::strspn(it, "hljztL");
+    const char conversion = *it;
+    if (conversion == '\0')
+    {
+      message.append(specification_begin);
+      break;
+    }
+    ++it;
+    const std::string flags_and_width(specification_begin, length_begin);
+    if (
+      next_argument >= record.number_of_arguments ||
+      flags_and_width.find('*') != std::string::npos)
+    {
+      message.append(specification_begin, it);
+      continue;
+    }
+    const auto & argument = record.arguments[next_argument++];
+    if (argument.type == DeferredLogArgument::Type::STRING || conversion == 's')
+    {
+      if (argument.type == DeferredLogArgument::Type::STRING)
+      {
+        append_formatted(message, flags_and_width + 's', record.get_string(argument));
+      }
+      else if (argument.type == DeferredLogArgument::Type::FLOATING_POINT)
+      {
+        // the numbers printed as strings use their default conversion
+        append_formatted(message, "%g", argument.floating_point_value);
+      }
+      else
+      {
+        append_formatted(message, "%lld", static_cast<long long>(as_signed(argument)));  // NOLINT
+      }
+      continue;
+    }
+    switch (conversion)
+    {
+      case 'd':
+      case 'i':
+        append_formatted(
+          message, flags_and_width + "ll" + conversion,
+          static_cast<long long>(as_signed(argument)));  // NOLINT(runtime/int)
+        break;
+      case 'o':
+      case 'u':
+      case 'x':
+      case 'X':
+        append_formatted(
+          message, flags_and_width + "ll" + conversion,
+          static_cast<unsigned long long>(as_signed(argument)));  // NOLINT(runtime/int)
+        break;
+      case 'c':
+        append_formatted(message, flags_and_width + 'c', static_cast<int>(as_signed(argument)));
+        break;
+      case 'p':
+        append_formatted(
+          message, flags_and_width + 'p',
+          argument.type == DeferredLogArgument::Type::POINTER
+            ? argument.pointer_value
+            : reinterpret_cast<const void *>(static_cast<std::uintptr_t>(as_signed(argument))));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        append_formatted(message, flags_and_width + conversion, as_floating_point(argument));
+        break;
+      default:
+        message.append(specification_begin, it);
+        break;
+    }
+  }
+  return message;
+}
+
+int64_t DeferredLogger::now() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+void DeferredLogger::push(const DeferredLogRecord & record) noexcept
+{
+  if (!is_started())
+  {
+    output(record);
+    return;
+  }
+  if (thread_ring_index == -1)
+  {
+    const std::size_t index = claimed_rings.fetch_add(1, std::memory_order_relaxed);
+    thread_ring_index = index < number_of_rings ? static_cast<int64_t>(index) : -2;
+  }
+  if (thread_ring_index < 0)
+  {
+    output(record);
+    return;
+  }
+  auto & ring = rings[static_cast<std::size_t>(thread_ring_index)];
+  const uint64_t head = ring.head.load(std::memory_order_relaxed);
+  if (head - ring.tail.load(std::memory_order_acquire) >= ring.capacity)
+  {
+    dropped_messages.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  ring.records[head % ring.capacity] = record;
+  ring.head.store(head + 1, std::memory_order_release);
+}
+
+}  // namespace hardware_interface
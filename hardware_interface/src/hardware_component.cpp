@@ -15,6 +15,7 @@
 #include "hardware_interface/hardware_component.hpp"
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -26,6 +27,7 @@
 #include "hardware_interface/types/hardware_interface_return_values.hpp"
 #include "hardware_interface/types/lifecycle_state_names.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/logging.hpp"
 #include "rclcpp_lifecycle/node_interfaces/lifecycle_node_interface.hpp"
 #include "rclcpp_lifecycle/state.hpp"
 
@@ -33,6 +35,38 @@ namespace hardware_interface
 {
 using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
 
+namespace
+{
+/// Adds the CPU time and the preempted time of the cycle to the statistics, in microseconds
+void add_thread_times_measurement(
+  HardwareComponentStatisticsCollector & statistics, const HardwareComponentCycleStatus & status)
+{
+  if (!status.thread_times.has_value() || !status.execution_time.has_value())
+  {
+    return;
+  }
+  const auto & thread_times = status.thread_times.value();
+  statistics.cpu_time->add_measurement(static_cast<double>(thread_times.cpu_time.count()) / 1.e3);
+  statistics.preempted_time->add_measurement(
+    static_cast<double>(thread_times.get_preempted_time(status.execution_time.value()).count()) /
+    1.e3);
+  statistics.voluntary_context_switches =
+    static_cast<unsigned int>(thread_times.voluntary_context_switches);
+  statistics.involuntary_context_switches =
+    static_cast<unsigned int>(thread_times.involuntary_context_switches);
+}
+
+/// Adds the performance counters of the cycle to the statistics
+void add_performance_counters_measurement(
+  HardwareComponentStatisticsCollector & statistics, const HardwareComponentCycleStatus & status)
+{
+  if (status.performance_counters.has_value() && status.execution_time.has_value())
+  {
+    statistics.performance_counters.add_measurement(status.performance_counters.value());
+  }
+}
+}  // namespace
+
 HardwareComponent::HardwareComponent(std::unique_ptr<HardwareComponentInterface> impl)
 : impl_(std::move(impl))
 {
@@ -40,8 +74,12 @@ HardwareComponent::HardwareComponent(std::unique_ptr<HardwareComponentInterface>
 
 HardwareComponent::HardwareComponent(HardwareComponent && other) noexcept
 {
-  std::lock_guard<std::recursive_mutex> lock(other.component_mutex_);
+  std::lock_guard<InstrumentedRecursiveMutex> lock(other.component_mutex_);
   impl_ = std::move(other.impl_);
+  read_stamp_ = std::move(other.read_stamp_);
+  defer_control_loop_transitions_ = other.defer_control_loop_transitions_;
+  requested_transition_.store(
+    other.requested_transition_.load(std::memory_order_relaxed), std::memory_order_relaxed);
   last_read_cycle_time_ = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
   last_write_cycle_time_ = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
 }
@@ -50,6 +88,11 @@ HardwareComponent::~HardwareComponent()
 {
   if (impl_)
   {
+    // the aggregator may hold the status source longer than the component
+    if (const auto status_source = impl_->get_hardware_status_source())
+    {
+      status_source->detach();
+    }
     impl_->stop_async_handler();
   }
 }
@@ -57,9 +100,29 @@ HardwareComponent::~HardwareComponent()
 const rclcpp_lifecycle::State & HardwareComponent::initialize(
   const hardware_interface::HardwareComponentParams & params)
 {
-  std::unique_lock<std::recursive_mutex> lock(component_mutex_);
+  std::unique_lock<InstrumentedRecursiveMutex> lock(component_mutex_);
   if (impl_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_UNKNOWN)
   {
+    defer_control_loop_transitions_ = params.defer_control_loop_transitions;
+    try
+    {
+      const auto statistics_config =
+        ros2_control::parse_statistics_config(params.hardware_info.statistics_type);
+      read_statistics_.execution_time->configure(statistics_config);
+      read_statistics_.periodicity->configure(statistics_config);
+      write_statistics_.execution_time->configure(statistics_config);
+      write_statistics_.periodicity->configure(statistics_config);
+    }
+    catch (const std::invalid_argument & e)
+    {
+      RCLCPP_ERROR(
+        impl_->get_logger(), "Invalid statistics type of the hardware component '%s': %s",
+        params.hardware_info.name.c_str(), e.what());
+      impl_->set_lifecycle_state(
+        rclcpp_lifecycle::State(
+          lifecycle_msgs::msg::State::PRIMARY_STATE_FINALIZED, lifecycle_state_names::FINALIZED));
+      return impl_->get_lifecycle_state();
+    }
     switch (impl_->init(params))
     {
       case CallbackReturn::SUCCESS:
@@ -81,7 +144,7 @@ const rclcpp_lifecycle::State & HardwareComponent::initialize(
 
 const rclcpp_lifecycle::State & HardwareComponent::configure()
 {
-  std::unique_lock<std::recursive_mutex> lock(component_mutex_);
+  std::unique_lock<InstrumentedRecursiveMutex> lock(component_mutex_);
   if (impl_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED)
   {
     impl_->pause_async_operations();
@@ -108,7 +171,7 @@ const rclcpp_lifecycle::State & HardwareComponent::configure()
 
 const rclcpp_lifecycle::State & HardwareComponent::cleanup()
 {
-  std::unique_lock<std::recursive_mutex> lock(component_mutex_);
+  std::unique_lock<InstrumentedRecursiveMutex> lock(component_mutex_);
   impl_->enable_introspection(false);
   if (impl_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE)
   {
@@ -132,7 +195,7 @@ const rclcpp_lifecycle::State & HardwareComponent::cleanup()
 
 const rclcpp_lifecycle::State & HardwareComponent::shutdown()
 {
-  std::unique_lock<std::recursive_mutex> lock(component_mutex_);
+  std::unique_lock<InstrumentedRecursiveMutex> lock(component_mutex_);
   impl_->enable_introspection(false);
   if (
     impl_->get_lifecycle_id() != lifecycle_msgs::msg::State::PRIMARY_STATE_UNKNOWN &&
@@ -157,7 +220,7 @@ const rclcpp_lifecycle::State & HardwareComponent::shutdown()
 
 const rclcpp_lifecycle::State & HardwareComponent::activate()
 {
-  std::unique_lock<std::recursive_mutex> lock(component_mutex_);
+  std::unique_lock<InstrumentedRecursiveMutex> lock(component_mutex_);
   last_read_cycle_time_ = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
   last_write_cycle_time_ = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
   read_statistics_.reset_statistics();
@@ -192,7 +255,7 @@ const rclcpp_lifecycle::State & HardwareComponent::activate()
 
 const rclcpp_lifecycle::State & HardwareComponent::deactivate()
 {
-  std::unique_lock<std::recursive_mutex> lock(component_mutex_);
+  std::unique_lock<InstrumentedRecursiveMutex> lock(component_mutex_);
   impl_->enable_introspection(false);
   if (impl_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
   {
@@ -219,7 +282,7 @@ const rclcpp_lifecycle::State & HardwareComponent::deactivate()
 
 const rclcpp_lifecycle::State & HardwareComponent::error()
 {
-  std::unique_lock<std::recursive_mutex> lock(component_mutex_);
+  std::unique_lock<InstrumentedRecursiveMutex> lock(component_mutex_);
   impl_->enable_introspection(false);
   if (
     impl_->get_lifecycle_id() != lifecycle_msgs::msg::State::PRIMARY_STATE_UNKNOWN &&
@@ -313,6 +376,13 @@ return_type HardwareComponent::prepare_command_mode_switch(
   return impl_->prepare_command_mode_switch(start_interfaces, stop_interfaces);
 }
 
+return_type HardwareComponent::abort_command_mode_switch(
+  const std::vector<std::string> & start_interfaces,
+  const std::vector<std::string> & stop_interfaces)
+{
+  return impl_->abort_command_mode_switch(start_interfaces, stop_interfaces);
+}
+
 return_type HardwareComponent::perform_command_mode_switch(
   const std::vector<std::string> & start_interfaces,
   const std::vector<std::string> & stop_interfaces)
@@ -324,6 +394,21 @@ const std::string & HardwareComponent::get_name() const { return impl_->get_name
 
 const std::string & HardwareComponent::get_group_name() const { return impl_->get_group_name(); }
 
+std::shared_ptr<CycleTrigger> HardwareComponent::get_cycle_trigger() const
+{
+  return impl_->get_cycle_trigger();
+}
+
+std::shared_ptr<HardwareStatusSource> HardwareComponent::get_hardware_status_source() const
+{
+  return impl_->get_hardware_status_source();
+}
+
+std::size_t HardwareComponent::drain_edge_events(EdgeEventList & events)
+{
+  return impl_->drain_edge_events(events);
+}
+
 const rclcpp_lifecycle::State & HardwareComponent::get_lifecycle_state() const
 {
   return impl_->get_lifecycle_state();
@@ -338,6 +423,11 @@ const rclcpp::Time & HardwareComponent::get_last_write_time() const
   return last_write_cycle_time_;
 }
 
+std::shared_ptr<const ReadStamp> HardwareComponent::get_read_stamp() const
+{
+  return read_stamp_;
+}
+
 const HardwareComponentStatisticsCollector & HardwareComponent::get_read_statistics() const
 {
   return read_statistics_;
@@ -355,6 +445,11 @@ return_type HardwareComponent::read(const rclcpp::Time & time, const rclcpp::Dur
     last_read_cycle_time_ = time;
     return return_type::OK;
   }
+  // the component waits for its requested error transition without being read
+  if (get_requested_transition() == RequestedTransition::ERROR)
+  {
+    return return_type::OK;
+  }
   if (
     impl_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE ||
     impl_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
@@ -362,7 +457,14 @@ return_type HardwareComponent::read(const rclcpp::Time & time, const rclcpp::Dur
     const auto trigger_result = impl_->trigger_read(time, period);
     if (trigger_result.result == return_type::ERROR)
     {
-      error();
+      if (defer_control_loop_transitions_)
+      {
+        request_transition(RequestedTransition::ERROR);
+      }
+      else
+      {
+        error();
+      }
     }
     if (trigger_result.successful)
     {
@@ -371,12 +473,20 @@ return_type HardwareComponent::read(const rclcpp::Time & time, const rclcpp::Dur
         read_statistics_.execution_time->add_measurement(
           static_cast<double>(trigger_result.execution_time.value().count()) / 1.e3);
       }
+      add_thread_times_measurement(read_statistics_, trigger_result);
+      add_performance_counters_measurement(read_statistics_, trigger_result);
       if (last_read_cycle_time_.get_clock_type() != RCL_CLOCK_UNINITIALIZED)
       {
         read_statistics_.periodicity->add_measurement(
           1.0 / (time - last_read_cycle_time_).seconds());
       }
       last_read_cycle_time_ = time;
+      // an asynchronous component is stamped with the time of the read its states come from
+      if (trigger_result.result == return_type::OK && trigger_result.read_time_ns.has_value())
+      {
+        read_stamp_->stamp(
+          rclcpp::Time(trigger_result.read_time_ns.value(), time.get_clock_type()));
+      }
     }
     return trigger_result.result;
   }
@@ -395,13 +505,25 @@ return_type HardwareComponent::write(const rclcpp::Time & time, const rclcpp::Du
     last_write_cycle_time_ = time;
     return return_type::OK;
   }
+  // the component waits for its requested transition without being written
+  if (get_requested_transition() != RequestedTransition::NONE)
+  {
+    return return_type::OK;
+  }
   // only call write in the active state
   if (impl_->get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
   {
     const auto trigger_result = impl_->trigger_write(time, period);
     if (trigger_result.result == return_type::ERROR)
     {
-      error();
+      if (defer_control_loop_transitions_)
+      {
+        request_transition(RequestedTransition::ERROR);
+      }
+      else
+      {
+        error();
+      }
     }
     if (trigger_result.successful)
     {
@@ -410,6 +532,13 @@ return_type HardwareComponent::write(const rclcpp::Time & time, const rclcpp::Du
         write_statistics_.execution_time->add_measurement(
           static_cast<double>(trigger_result.execution_time.value().count()) / 1.e3);
       }
+      add_thread_times_measurement(write_statistics_, trigger_result);
+      add_performance_counters_measurement(write_statistics_, trigger_result);
+      if (trigger_result.changed_command_ratio.has_value())
+      {
+        write_statistics_.changed_command_ratio->add_measurement(
+          trigger_result.changed_command_ratio.value());
+      }
       if (last_write_cycle_time_.get_clock_type() != RCL_CLOCK_UNINITIALIZED)
       {
         write_statistics_.periodicity->add_measurement(
@@ -422,5 +551,28 @@ return_type HardwareComponent::write(const rclcpp::Time & time, const rclcpp::Du
   return return_type::OK;
 }
 
-std::recursive_mutex & HardwareComponent::get_mutex() { return component_mutex_; }
+InstrumentedRecursiveMutex & HardwareComponent::get_mutex() { return component_mutex_; }
+
+void HardwareComponent::request_transition(RequestedTransition transition) noexcept
+{
+  // an error replaces a requested deactivation, but not the other way around
+  const auto requested = static_cast<uint8_t>(transition);
+  uint8_t current = requested_transition_.load(std::memory_order_relaxed);
+  while (current < requested && !requested_transition_.compare_exchange_weak(
+                                  current, requested, std::memory_order_release,
+                                  std::memory_order_relaxed))
+  {
+  }
+}
+
+HardwareComponent::RequestedTransition HardwareComponent::get_requested_transition() const noexcept
+{
+  return static_cast<RequestedTransition>(requested_transition_.load(std::memory_order_acquire));
+}
+
+HardwareComponent::RequestedTransition HardwareComponent::take_requested_transition() noexcept
+{
+  return static_cast<RequestedTransition>(requested_transition_.exchange(
+    static_cast<uint8_t>(RequestedTransition::NONE), std::memory_order_acq_rel));
+}
 }  // namespace hardware_interface
@@ -15,14 +15,70 @@
 #include "hardware_interface/hardware_component_interface.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "hardware_interface/interface_change_tracker.hpp"
+#include "hardware_interface/instrumentation_clock.hpp"
+#include "hardware_interface/realtime_thread.hpp"
 #include "rclcpp/node_options.hpp"
 
 namespace hardware_interface
 {
+namespace
+{
+/// Thread times of the last asynchronous read or write, sampled on the asynchronous thread
+struct AsyncThreadTimes
+{
+  void store(const ThreadTimes & times)
+  {
+    cpu_time.store(times.cpu_time, std::memory_order_relaxed);
+    voluntary_context_switches.store(times.voluntary_context_switches, std::memory_order_relaxed);
+    involuntary_context_switches.store(
+      times.involuntary_context_switches, std::memory_order_relaxed);
+  }
+
+  ThreadTimes load() const
+  {
+    return {
+      cpu_time.load(std::memory_order_relaxed),
+      voluntary_context_switches.load(std::memory_order_relaxed),
+      involuntary_context_switches.load(std::memory_order_relaxed)};
+  }
+
+  std::atomic<std::chrono::nanoseconds> cpu_time = std::chrono::nanoseconds::zero();
+  std::atomic<uint64_t> voluntary_context_switches = 0;
+  std::atomic<uint64_t> involuntary_context_switches = 0;
+};
+
+/// Performance counters of the last asynchronous read or write, sampled on the asynchronous thread
+struct AsyncPerformanceCounters
+{
+  void store(const PerformanceCounters & counters)
+  {
+    cycles.store(counters.cycles, std::memory_order_relaxed);
+    instructions.store(counters.instructions, std::memory_order_relaxed);
+    cache_misses.store(counters.cache_misses, std::memory_order_relaxed);
+    branch_misses.store(counters.branch_misses, std::memory_order_relaxed);
+  }
+
+  PerformanceCounters load() const
+  {
+    return {
+      cycles.load(std::memory_order_relaxed), instructions.load(std::memory_order_relaxed),
+      cache_misses.load(std::memory_order_relaxed), branch_misses.load(std::memory_order_relaxed)};
+  }
+
+  std::atomic<uint64_t> cycles = 0;
+  std::atomic<uint64_t> instructions = 0;
+  std::atomic<uint64_t> cache_misses = 0;
+  std::atomic<uint64_t> branch_misses = 0;
+};
+}  // namespace
 
 class HardwareComponentInterface::HardwareComponentInterfaceImpl
 {
@@ -30,21 +86,101 @@ public:
   HardwareComponentInterfaceImpl() : logger_(rclcpp::get_logger("hardware_component_interface")) {}
 
   rclcpp::Clock::SharedPtr clock_;
+  /// Has to outlive the members of the component allocated from it, so it is kept by the base
+  std::shared_ptr<MemoryArena> memory_arena_;
   rclcpp::Logger logger_;
   rclcpp::Node::SharedPtr hardware_component_node_ = nullptr;
   // interface names to Handle accessed through getters/setters
   std::unordered_map<std::string, StateInterface::SharedPtr> hardware_states_;
   std::unordered_map<std::string, CommandInterface::SharedPtr> hardware_commands_;
+  // Handles in the order of their export and their indices, for the access by index
+  std::vector<StateInterface::SharedPtr> indexed_states_;
+  std::unordered_map<std::string, std::size_t> state_indices_;
+  std::vector<CommandInterface::SharedPtr> indexed_commands_;
+  std::unordered_map<std::string, std::size_t> command_indices_;
+
+  void add_state_handle(const std::string & name, const StateInterface::SharedPtr & handle)
+  {
+    if (hardware_states_.insert(std::make_pair(name, handle)).second)
+    {
+      state_indices_[name] = indexed_states_.size();
+      indexed_states_.push_back(handle);
+    }
+  }
+
+  void add_command_handle(const std::string & name, const CommandInterface::SharedPtr & handle)
+  {
+    if (hardware_commands_.insert(std::make_pair(name, handle)).second)
+    {
+      command_indices_[name] = indexed_commands_.size();
+      indexed_commands_.push_back(handle);
+    }
+  }
   std::atomic<uint8_t> lifecycle_id_cache_ = lifecycle_msgs::msg::State::PRIMARY_STATE_UNKNOWN;
   std::atomic<return_type> read_return_info_ = return_type::OK;
   std::atomic<std::chrono::nanoseconds> read_execution_time_ = std::chrono::nanoseconds::zero();
   std::atomic<return_type> write_return_info_ = return_type::OK;
   std::atomic<std::chrono::nanoseconds> write_execution_time_ = std::chrono::nanoseconds::zero();
+  AsyncThreadTimes read_thread_times_;
+  AsyncThreadTimes write_thread_times_;
+  AsyncPerformanceCounters read_performance_counters_;
+  AsyncPerformanceCounters write_performance_counters_;
 
   std::shared_ptr<rclcpp::Publisher<control_msgs::msg::HardwareStatus>> hardware_status_publisher_;
   realtime_tools::RealtimeThreadSafeBox<std::optional<control_msgs::msg::HardwareStatus>>
     hardware_status_box_;
   rclcpp::TimerBase::SharedPtr hardware_status_timer_;
+  /// Status message published by the aggregator of the resource manager, if aggregated
+  std::shared_ptr<HardwareStatusSource> hardware_status_source_;
+
+  /// Asynchronous cycle in the shared pool, used instead of the own async handler if set
+  std::shared_ptr<AsyncWorkerPool> async_worker_pool_;
+  std::shared_ptr<AsyncWorkerPool::Task> async_task_;
+
+  std::shared_ptr<CycleTrigger> cycle_trigger_ = std::make_shared<CycleTrigger>();
+
+  /// Tracker of the indexed commands, only created by enable_command_change_tracking()
+  std::unique_ptr<InterfaceChangeTracker> command_change_tracker_;
+  /// Indices of the commands changed since the previous write, collected before every write
+  std::vector<std::size_t> changed_commands_;
+  /// Fraction of the commands changed at the last asynchronous write, negative if not tracked
+  std::atomic<double> write_changed_command_ratio_ = -1.0;
+  /// Set by enable_exchange(), then exchange() is called instead of read() and write()
+  std::atomic<bool> exchange_enabled_ = false;
+  /// Set by the synchronous write phase, the commands are sent by the exchange of the next read
+  bool exchange_commands_pending_ = false;
+  /// Time passed to the last asynchronous read, published by incrementing the number of reads
+  std::atomic<int64_t> async_read_time_ns_ = 0;
+  std::atomic<uint64_t> async_reads_ = 0;
+  /// Number of asynchronous reads reported by trigger_read(), to report every read once
+  uint64_t reported_async_reads_ = 0;
+  /// Queue of the edge events, only created by enable_edge_events()
+  std::unique_ptr<EdgeEventQueue> edge_event_queue_;
+  /// Number of dropped edge events already added to the list of a cycle
+  uint64_t reported_dropped_edge_events_ = 0;
+
+  /// Publishes the time of a finished asynchronous read.
+  void publish_async_read(const rclcpp::Time & time)
+  {
+    async_read_time_ns_.store(time.nanoseconds(), std::memory_order_relaxed);
+    async_reads_.fetch_add(1, std::memory_order_release);
+  }
+
+  /// Collects the changed commands and returns their fraction, negative if they aren't tracked.
+  double collect_changed_commands()
+  {
+    if (!command_change_tracker_)
+    {
+      return -1.0;
+    }
+    changed_commands_.clear();
+    command_change_tracker_->for_each_changed(
+      [this](std::size_t index, const Handle &) { changed_commands_.push_back(index); });
+    return command_change_tracker_->size() > 0
+             ? static_cast<double>(changed_commands_.size()) /
+                 static_cast<double>(command_change_tracker_->size())
+             : 0.0;
+  }
 };
 
 HardwareComponentInterface::HardwareComponentInterface()
@@ -62,6 +198,11 @@ HardwareComponentInterface::~HardwareComponentInterface()
     async_handler_->stop_thread();
   }
   async_handler_.reset();
+  if (impl_->async_task_)
+  {
+    impl_->async_worker_pool_->remove_task(impl_->async_task_);
+    impl_->async_task_.reset();
+  }
 }
 
 CallbackReturn HardwareComponentInterface::init(
@@ -69,6 +210,7 @@ CallbackReturn HardwareComponentInterface::init(
 {
   impl_->clock_ = params.clock;
   impl_->logger_ = params.logger;
+  impl_->memory_arena_ = params.memory_arena;
   info_ = params.hardware_info;
   if (params.hardware_info.is_async)
   {
@@ -81,43 +223,112 @@ CallbackReturn HardwareComponentInterface::init(
     async_thread_params.logger = get_logger();
     async_thread_params.exec_rate = params.hardware_info.rw_rate;
     async_thread_params.print_warnings = info_.async_params.print_warnings;
-    RCLCPP_INFO(
-      get_logger(), "Starting async handler with scheduler priority: %d and policy : %s",
-      info_.async_params.thread_priority,
-      async_thread_params.scheduling_policy.to_string().c_str());
-    async_handler_ = std::make_unique<realtime_tools::AsyncFunctionHandler<return_type>>();
     const bool is_sensor_type = (info_.type == "sensor");
-    async_handler_->init(
-      [this, is_sensor_type](const rclcpp::Time & time, const rclcpp::Duration & period)
+    auto async_cycle = [this, is_sensor_type](
+                         const rclcpp::Time & time, const rclcpp::Duration & period)
+    {
+      const bool is_active = impl_->lifecycle_id_cache_.load(std::memory_order_acquire) ==
+                             lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE;
+      if (!is_sensor_type && is_active && impl_->exchange_enabled_.load(std::memory_order_relaxed))
       {
-        const auto read_start_time = std::chrono::steady_clock::now();
-        const auto ret_read = read(time, period);
-        const auto read_end_time = std::chrono::steady_clock::now();
-        impl_->read_return_info_.store(ret_read, std::memory_order_release);
+        // the exchange is measured as the read, it both sends the commands and receives the states
+        const auto start_thread_times = ThreadTimes::now();
+        const auto start_counters = PerformanceCounters::now();
+        impl_->write_changed_command_ratio_.store(
+          impl_->collect_changed_commands(), std::memory_order_relaxed);
+        const auto start_time = InstrumentationClock::now();
+        const auto ret_exchange = exchange(time, period);
+        const auto end_time = InstrumentationClock::now();
+        impl_->read_performance_counters_.store(PerformanceCounters::now() - start_counters);
+        impl_->read_thread_times_.store(ThreadTimes::now() - start_thread_times);
+        impl_->read_return_info_.store(ret_exchange, std::memory_order_release);
         impl_->read_execution_time_.store(
-          std::chrono::duration_cast<std::chrono::nanoseconds>(read_end_time - read_start_time),
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time),
+          std::memory_order_release);
+        impl_->publish_async_read(time);
+        return ret_exchange;
+      }
+      const auto read_start_thread_times = ThreadTimes::now();
+      const auto read_start_counters = PerformanceCounters::now();
+      const auto read_start_time = InstrumentationClock::now();
+      const auto ret_read = read(time, period);
+      const auto read_end_time = InstrumentationClock::now();
+      impl_->read_performance_counters_.store(PerformanceCounters::now() - read_start_counters);
+      impl_->read_thread_times_.store(ThreadTimes::now() - read_start_thread_times);
+      impl_->read_return_info_.store(ret_read, std::memory_order_release);
+      impl_->read_execution_time_.store(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(read_end_time - read_start_time),
+        std::memory_order_release);
+      impl_->publish_async_read(time);
+      if (ret_read != return_type::OK)
+      {
+        return ret_read;
+      }
+      if (!is_sensor_type && is_active)
+      {
+        const auto write_start_thread_times = ThreadTimes::now();
+        const auto write_start_counters = PerformanceCounters::now();
+        impl_->write_changed_command_ratio_.store(
+          impl_->collect_changed_commands(), std::memory_order_relaxed);
+        const auto write_start_time = InstrumentationClock::now();
+        const auto ret_write = write(time, period);
+        const auto write_end_time = InstrumentationClock::now();
+        impl_->write_performance_counters_.store(PerformanceCounters::now() - write_start_counters);
+        impl_->write_thread_times_.store(ThreadTimes::now() - write_start_thread_times);
+        impl_->write_return_info_.store(ret_write, std::memory_order_release);
+        impl_->write_execution_time_.store(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(write_end_time - write_start_time),
           std::memory_order_release);
-        if (ret_read != return_type::OK)
+        return ret_write;
+      }
+      return return_type::OK;
+    };
+    const bool use_async_worker_pool =
+      params.async_worker_pool &&
+      async_thread_params.scheduling_policy == realtime_tools::AsyncSchedulingPolicy::SYNCHRONIZED;
+    if (use_async_worker_pool)
+    {
+      impl_->async_worker_pool_ = params.async_worker_pool;
+      impl_->async_task_ = impl_->async_worker_pool_->add_task(
+        [this, async_cycle](const rclcpp::Time & time, const rclcpp::Duration & period)
         {
-          return ret_read;
-        }
-        if (
-          !is_sensor_type && impl_->lifecycle_id_cache_.load(std::memory_order_acquire) ==
-                               lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+          try
+          {
+            static_cast<void>(async_cycle(time, period));
+          }
+          catch (...)
+          {
+            impl_->read_return_info_.store(return_type::ERROR, std::memory_order_release);
+            throw;
+          }
+        });
+    }
+    if (impl_->async_task_)
+    {
+      RCLCPP_INFO(get_logger(), "Running the async read and write cycles on the async worker pool");
+    }
+    else
+    {
+      RCLCPP_INFO(
+        get_logger(), "Starting async handler with scheduler priority: %d and policy : %s",
+        info_.async_params.thread_priority,
+        async_thread_params.scheduling_policy.to_string().c_str());
+      // the handler sets the priority and the affinity of its thread, the name and the stack are
+      // set up at the first cycle
+      RealtimeThreadParams thread_params;
+      thread_params.name = info_.name;
+      thread_params.stack_prefault_size = params.thread_stack_prefault_size;
+      async_handler_ = std::make_unique<realtime_tools::AsyncFunctionHandler<return_type>>();
+      async_handler_->init(
+        [async_cycle, thread_params, logger = get_logger()](
+          const rclcpp::Time & time, const rclcpp::Duration & period)
         {
-          const auto write_start_time = std::chrono::steady_clock::now();
-          const auto ret_write = write(time, period);
-          const auto write_end_time = std::chrono::steady_clock::now();
-          impl_->write_return_info_.store(ret_write, std::memory_order_release);
-          impl_->write_execution_time_.store(
-            std::chrono::duration_cast<std::chrono::nanoseconds>(write_end_time - write_start_time),
-            std::memory_order_release);
-          return ret_write;
-        }
-        return return_type::OK;
-      },
-      async_thread_params);
-    async_handler_->start_thread();
+          configure_current_thread_once(thread_params, logger);
+          return async_cycle(time, period);
+        },
+        async_thread_params);
+      async_handler_->start_thread();
+    }
   }
 
   if (auto locked_executor = params.executor.lock())
@@ -168,7 +379,15 @@ CallbackReturn HardwareComponentInterface::init(
 
     if (!status_msg_template.hardware_device_states.empty())
     {
-      if (!impl_->hardware_component_node_)
+      if (params.aggregate_hardware_status)
+      {
+        // the resource manager publishes the message with the ones of the other components
+        impl_->hardware_status_source_ = std::make_shared<HardwareStatusSource>(
+          info_.name, publish_rate, status_msg_template,
+          [this](control_msgs::msg::HardwareStatus & msg)
+          { return update_hardware_status_message(msg); });
+      }
+      else if (!impl_->hardware_component_node_)
       {
         RCLCPP_WARN(
           get_logger(),
@@ -228,6 +447,7 @@ CallbackReturn HardwareComponentInterface::init(
   hardware_interface::HardwareComponentInterfaceParams interface_params;
   interface_params.hardware_info = info_;
   interface_params.executor = params.executor;
+  interface_params.warm_restart = params.warm_restart;
   return on_init(interface_params);
 }
 
@@ -313,7 +533,7 @@ std::vector<StateInterface::ConstSharedPtr> HardwareComponentInterface::on_expor
     auto name = description.get_name();
     unlisted_state_interfaces_.insert(std::make_pair(name, description));
     auto state_interface = std::make_shared<StateInterface>(description);
-    impl_->hardware_states_.insert(std::make_pair(name, state_interface));
+    impl_->add_state_handle(name, state_interface);
     unlisted_states_.push_back(state_interface);
     state_interfaces.push_back(std::const_pointer_cast<const StateInterface>(state_interface));
   }
@@ -321,21 +541,21 @@ std::vector<StateInterface::ConstSharedPtr> HardwareComponentInterface::on_expor
   for (const auto & [name, descr] : joint_state_interfaces_)
   {
     auto state_interface = std::make_shared<StateInterface>(descr);
-    impl_->hardware_states_.insert(std::make_pair(name, state_interface));
+    impl_->add_state_handle(name, state_interface);
     joint_states_.push_back(state_interface);
     state_interfaces.push_back(std::const_pointer_cast<const StateInterface>(state_interface));
   }
   for (const auto & [name, descr] : sensor_state_interfaces_)
   {
     auto state_interface = std::make_shared<StateInterface>(descr);
-    impl_->hardware_states_.insert(std::make_pair(name, state_interface));
+    impl_->add_state_handle(name, state_interface);
     sensor_states_.push_back(state_interface);
     state_interfaces.push_back(std::const_pointer_cast<const StateInterface>(state_interface));
   }
   for (const auto & [name, descr] : gpio_state_interfaces_)
   {
     auto state_interface = std::make_shared<StateInterface>(descr);
-    impl_->hardware_states_.insert(std::make_pair(name, state_interface));
+    impl_->add_state_handle(name, state_interface);
     gpio_states_.push_back(state_interface);
     state_interfaces.push_back(std::const_pointer_cast<const StateInterface>(state_interface));
   }
@@ -375,7 +595,7 @@ std::vector<CommandInterface::SharedPtr> HardwareComponentInterface::on_export_c
     auto name = description.get_name();
     unlisted_command_interfaces_.insert(std::make_pair(name, description));
     auto command_interface = std::make_shared<CommandInterface>(description);
-    impl_->hardware_commands_.insert(std::make_pair(name, command_interface));
+    impl_->add_command_handle(name, command_interface);
     unlisted_commands_.push_back(command_interface);
     command_interfaces.push_back(command_interface);
   }
@@ -383,7 +603,7 @@ std::vector<CommandInterface::SharedPtr> HardwareComponentInterface::on_export_c
   for (const auto & [name, descr] : joint_command_interfaces_)
   {
     auto command_interface = std::make_shared<CommandInterface>(descr);
-    impl_->hardware_commands_.insert(std::make_pair(name, command_interface));
+    impl_->add_command_handle(name, command_interface);
     joint_commands_.push_back(command_interface);
     command_interfaces.push_back(command_interface);
   }
@@ -391,7 +611,7 @@ std::vector<CommandInterface::SharedPtr> HardwareComponentInterface::on_export_c
   for (const auto & [name, descr] : gpio_command_interfaces_)
   {
     auto command_interface = std::make_shared<CommandInterface>(descr);
-    impl_->hardware_commands_.insert(std::make_pair(name, command_interface));
+    impl_->add_command_handle(name, command_interface);
     gpio_commands_.push_back(command_interface);
     command_interfaces.push_back(command_interface);
   }
@@ -405,6 +625,13 @@ return_type HardwareComponentInterface::prepare_command_mode_switch(
   return return_type::OK;
 }
 
+return_type HardwareComponentInterface::abort_command_mode_switch(
+  const std::vector<std::string> & /*start_interfaces*/,
+  const std::vector<std::string> & /*stop_interfaces*/)
+{
+  return return_type::OK;
+}
+
 return_type HardwareComponentInterface::perform_command_mode_switch(
   const std::vector<std::string> & /*start_interfaces*/,
   const std::vector<std::string> & /*stop_interfaces*/)
@@ -424,9 +651,25 @@ HardwareComponentCycleStatus HardwareComponentInterface::trigger_read(
     if (read_exec_time.count() > 0)
     {
       status.execution_time = read_exec_time;
+      if (ThreadTimes::is_sampling_enabled())
+      {
+        status.thread_times = impl_->read_thread_times_.load();
+      }
+      if (PerformanceCounters::is_sampling_enabled())
+      {
+        status.performance_counters = impl_->read_performance_counters_.load();
+      }
     }
-    const auto result = async_handler_->trigger_async_callback(time, period);
-    status.successful = result.first;
+    // the states are those of the last finished read, not of this trigger
+    const uint64_t async_reads = impl_->async_reads_.load(std::memory_order_acquire);
+    if (async_reads != impl_->reported_async_reads_)
+    {
+      impl_->reported_async_reads_ = async_reads;
+      status.read_time_ns = impl_->async_read_time_ns_.load(std::memory_order_relaxed);
+    }
+    status.successful = impl_->async_task_
+                          ? impl_->async_task_->trigger(time, period)
+                          : async_handler_->trigger_async_callback(time, period).first;
     if (!status.successful)
     {
       RCLCPP_WARN_EXPRESSION(
@@ -440,11 +683,24 @@ HardwareComponentCycleStatus HardwareComponentInterface::trigger_read(
   }
   else
   {
-    const auto start_time = std::chrono::steady_clock::now();
+    const auto start_thread_times = ThreadTimes::now();
+    const auto start_counters = PerformanceCounters::now();
+    const auto start_time = InstrumentationClock::now();
     status.successful = true;
-    status.result = read(time, period);
+    const bool exchange_commands = impl_->exchange_commands_pending_;
+    impl_->exchange_commands_pending_ = false;
+    status.result = exchange_commands ? exchange(time, period) : read(time, period);
+    status.read_time_ns = time.nanoseconds();
     status.execution_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
-      std::chrono::steady_clock::now() - start_time);
+      InstrumentationClock::now() - start_time);
+    if (PerformanceCounters::is_sampling_enabled())
+    {
+      status.performance_counters = PerformanceCounters::now() - start_counters;
+    }
+    if (ThreadTimes::is_sampling_enabled())
+    {
+      status.thread_times = ThreadTimes::now() - start_thread_times;
+    }
   }
   return status;
 }
@@ -461,16 +717,54 @@ HardwareComponentCycleStatus HardwareComponentInterface::trigger_write(
     if (write_exec_time.count() > 0)
     {
       status.execution_time = write_exec_time;
+      if (ThreadTimes::is_sampling_enabled())
+      {
+        status.thread_times = impl_->write_thread_times_.load();
+      }
+      if (PerformanceCounters::is_sampling_enabled())
+      {
+        status.performance_counters = impl_->write_performance_counters_.load();
+      }
+    }
+    // also set by the exchanges, which are measured as the reads
+    const double changed_command_ratio =
+      impl_->write_changed_command_ratio_.load(std::memory_order_relaxed);
+    if (changed_command_ratio >= 0.0)
+    {
+      status.changed_command_ratio = changed_command_ratio;
     }
     status.result = impl_->write_return_info_.load(std::memory_order_acquire);
   }
   else
   {
-    const auto start_time = std::chrono::steady_clock::now();
+    const double changed_command_ratio = impl_->collect_changed_commands();
+    if (changed_command_ratio >= 0.0)
+    {
+      status.changed_command_ratio = changed_command_ratio;
+    }
+    if (impl_->exchange_enabled_.load(std::memory_order_relaxed))
+    {
+      // the commands are sent by the exchange of the next read phase
+      impl_->exchange_commands_pending_ = true;
+      status.successful = true;
+      status.result = return_type::OK;
+      return status;
+    }
+    const auto start_thread_times = ThreadTimes::now();
+    const auto start_counters = PerformanceCounters::now();
+    const auto start_time = InstrumentationClock::now();
     status.successful = true;
     status.result = write(time, period);
     status.execution_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
-      std::chrono::steady_clock::now() - start_time);
+      InstrumentationClock::now() - start_time);
+    if (PerformanceCounters::is_sampling_enabled())
+    {
+      status.performance_counters = PerformanceCounters::now() - start_counters;
+    }
+    if (ThreadTimes::is_sampling_enabled())
+    {
+      status.thread_times = ThreadTimes::now() - start_thread_times;
+    }
   }
   return status;
 }
@@ -481,6 +775,17 @@ return_type HardwareComponentInterface::write(
   return return_type::OK;
 }
 
+return_type HardwareComponentInterface::exchange(
+  const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  const auto ret_write = write(time, period);
+  if (ret_write != return_type::OK)
+  {
+    return ret_write;
+  }
+  return read(time, period);
+}
+
 const std::string & HardwareComponentInterface::get_name() const { return info_.name; }
 
 const std::string & HardwareComponentInterface::get_group_name() const { return info_.group; }
@@ -494,6 +799,15 @@ void HardwareComponentInterface::set_lifecycle_state(const rclcpp_lifecycle::Sta
 {
   lifecycle_state_ = new_state;
   impl_->lifecycle_id_cache_.store(new_state.id(), std::memory_order_release);
+  // the commands are only exchanged once the controllers updated them in the new state
+  impl_->exchange_commands_pending_ = false;
+  if (
+    impl_->command_change_tracker_ &&
+    new_state.id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+  {
+    // all the commands are written at the first write after the activation
+    impl_->command_change_tracker_->reset();
+  }
 }
 
 uint8_t HardwareComponentInterface::get_lifecycle_id() const
@@ -539,10 +853,172 @@ const CommandInterface::SharedPtr & HardwareComponentInterface::get_command_inte
   return it->second;
 }
 
+std::size_t HardwareComponentInterface::get_state_interface_index(
+  const std::string & interface_name) const
+{
+  auto it = impl_->state_indices_.find(interface_name);
+  if (it == impl_->state_indices_.end())
+  {
+    throw std::runtime_error(
+      fmt::format(
+        "The requested state interface not found: '{}' in hardware component: '{}'.",
+        interface_name, info_.name));
+  }
+  return it->second;
+}
+
+std::vector<std::size_t> HardwareComponentInterface::get_state_interface_indices(
+  const std::vector<std::string> & interface_names) const
+{
+  std::vector<std::size_t> indices;
+  indices.reserve(interface_names.size());
+  for (const auto & interface_name : interface_names)
+  {
+    indices.push_back(get_state_interface_index(interface_name));
+  }
+  return indices;
+}
+
+const StateInterface::SharedPtr & HardwareComponentInterface::get_state_interface_handle(
+  std::size_t index) const
+{
+  return impl_->indexed_states_[index];
+}
+
+bool HardwareComponentInterface::set_states(
+  const std::vector<std::size_t> & indices, const std::vector<double> & values)
+{
+  if (indices.size() != values.size())
+  {
+    return false;
+  }
+  bool all_set = true;
+  for (std::size_t i = 0; i < indices.size(); ++i)
+  {
+    all_set &= impl_->indexed_states_[indices[i]]->set_value(values[i], false);
+  }
+  return all_set;
+}
+
+std::size_t HardwareComponentInterface::get_command_interface_index(
+  const std::string & interface_name) const
+{
+  auto it = impl_->command_indices_.find(interface_name);
+  if (it == impl_->command_indices_.end())
+  {
+    throw std::runtime_error(
+      fmt::format(
+        "The requested command interface not found: '{}' in hardware component: '{}'.",
+        interface_name, info_.name));
+  }
+  return it->second;
+}
+
+std::vector<std::size_t> HardwareComponentInterface::get_command_interface_indices(
+  const std::vector<std::string> & interface_names) const
+{
+  std::vector<std::size_t> indices;
+  indices.reserve(interface_names.size());
+  for (const auto & interface_name : interface_names)
+  {
+    indices.push_back(get_command_interface_index(interface_name));
+  }
+  return indices;
+}
+
+const CommandInterface::SharedPtr & HardwareComponentInterface::get_command_interface_handle(
+  std::size_t index) const
+{
+  return impl_->indexed_commands_[index];
+}
+
+bool HardwareComponentInterface::get_commands(
+  const std::vector<std::size_t> & indices, std::vector<double> & values) const
+{
+  if (values.size() != indices.size())
+  {
+    values.resize(indices.size(), std::numeric_limits<double>::quiet_NaN());
+  }
+  bool all_read = true;
+  for (std::size_t i = 0; i < indices.size(); ++i)
+  {
+    all_read &= impl_->indexed_commands_[indices[i]]->get_value(values[i], false);
+  }
+  return all_read;
+}
+
+void HardwareComponentInterface::enable_command_change_tracking()
+{
+  std::vector<std::shared_ptr<const Handle>> handles(
+    impl_->indexed_commands_.begin(), impl_->indexed_commands_.end());
+  impl_->changed_commands_.clear();
+  impl_->changed_commands_.reserve(handles.size());
+  impl_->command_change_tracker_ = std::make_unique<InterfaceChangeTracker>(std::move(handles));
+}
+
+bool HardwareComponentInterface::is_command_change_tracking_enabled() const
+{
+  return impl_->command_change_tracker_ != nullptr;
+}
+
+void HardwareComponentInterface::enable_exchange()
+{
+  impl_->exchange_enabled_.store(true, std::memory_order_relaxed);
+}
+
+bool HardwareComponentInterface::is_exchange_enabled() const
+{
+  return impl_->exchange_enabled_.load(std::memory_order_relaxed);
+}
+
+void HardwareComponentInterface::enable_edge_events(std::size_t capacity)
+{
+  impl_->edge_event_queue_ = std::make_unique<EdgeEventQueue>(capacity);
+  impl_->reported_dropped_edge_events_ = 0;
+}
+
+bool HardwareComponentInterface::push_edge_event(std::size_t index, bool value, int64_t stamp)
+{
+  if (!impl_->edge_event_queue_ || index >= impl_->indexed_states_.size())
+  {
+    return false;
+  }
+  return impl_->edge_event_queue_->push(
+    EdgeEvent{impl_->indexed_states_[index]->get_name_id(), value, stamp});
+}
+
+std::size_t HardwareComponentInterface::drain_edge_events(EdgeEventList & events)
+{
+  if (!impl_->edge_event_queue_)
+  {
+    return 0;
+  }
+  const std::size_t number_of_events = impl_->edge_event_queue_->pop_all(
+    [&events](const EdgeEvent & event) { events.push(event); });
+  const uint64_t dropped_events = impl_->edge_event_queue_->get_dropped_events();
+  events.add_dropped_events(dropped_events - impl_->reported_dropped_edge_events_);
+  impl_->reported_dropped_edge_events_ = dropped_events;
+  return number_of_events;
+}
+
+const std::vector<std::size_t> & HardwareComponentInterface::get_changed_command_interfaces() const
+{
+  return impl_->changed_commands_;
+}
+
 rclcpp::Logger HardwareComponentInterface::get_logger() const { return impl_->logger_; }
 
 rclcpp::Clock::SharedPtr HardwareComponentInterface::get_clock() const { return impl_->clock_; }
 
+std::pmr::memory_resource * HardwareComponentInterface::get_memory_resource() const
+{
+  if (impl_->memory_arena_)
+  {
+    return impl_->memory_arena_.get();
+  }
+  return std::pmr::get_default_resource();
+}
+
 rclcpp::Node::SharedPtr HardwareComponentInterface::get_node() const
 {
   return impl_->hardware_component_node_;
@@ -550,12 +1026,29 @@ rclcpp::Node::SharedPtr HardwareComponentInterface::get_node() const
 
 const HardwareInfo & HardwareComponentInterface::get_hardware_info() const { return info_; }
 
+std::shared_ptr<CycleTrigger> HardwareComponentInterface::get_cycle_trigger() const
+{
+  return impl_->cycle_trigger_;
+}
+
+std::shared_ptr<HardwareStatusSource> HardwareComponentInterface::get_hardware_status_source()
+  const
+{
+  return impl_->hardware_status_source_;
+}
+
+void HardwareComponentInterface::trigger_control_cycle() { impl_->cycle_trigger_->notify(); }
+
 void HardwareComponentInterface::pause_async_operations()
 {
   if (async_handler_)
   {
     async_handler_->pause_execution();
   }
+  if (impl_->async_task_)
+  {
+    impl_->async_task_->wait_until_idle();
+  }
 }
 
 void HardwareComponentInterface::stop_async_handler()
@@ -565,6 +1058,11 @@ void HardwareComponentInterface::stop_async_handler()
     async_handler_->stop_thread();
     async_handler_.reset();
   }
+  if (impl_->async_task_)
+  {
+    impl_->async_worker_pool_->remove_task(impl_->async_task_);
+    impl_->async_task_.reset();
+  }
 }
 
 void HardwareComponentInterface::prepare_for_activation()
@@ -573,6 +1071,10 @@ void HardwareComponentInterface::prepare_for_activation()
   impl_->read_execution_time_.store(std::chrono::nanoseconds::zero(), std::memory_order_release);
   impl_->write_return_info_.store(return_type::OK, std::memory_order_release);
   impl_->write_execution_time_.store(std::chrono::nanoseconds::zero(), std::memory_order_release);
+  impl_->read_thread_times_.store(ThreadTimes{});
+  impl_->write_thread_times_.store(ThreadTimes{});
+  impl_->read_performance_counters_.store(PerformanceCounters{});
+  impl_->write_performance_counters_.store(PerformanceCounters{});
 }
 
 void HardwareComponentInterface::enable_introspection(bool enable)
@@ -0,0 +1,104 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/hardware_component_statistics_table.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hardware_interface
+{
+namespace
+{
+/// Number of slots of the first block allocated without reserve()
+constexpr std::size_t MINIMUM_BLOCK_SIZE = 8;
+}  // namespace
+
+struct HardwareComponentStatisticsTable::Storage
+{
+  struct alignas(64) Slot
+  {
+    HardwareComponentStatisticsData data;
+  };
+
+  /// Adds a block of slots to the free slots, the lowest addresses are acquired first
+  void add_block(std::size_t size)
+  {
+    blocks.push_back(std::make_unique<Slot[]>(size));
+    capacity += size;
+    Slot * block = blocks.back().get();
+    free_slots.reserve(free_slots.size() + size);
+    for (std::size_t i = size; i > 0; --i)
+    {
+      free_slots.push_back(&block[i - 1].data);
+    }
+  }
+
+  mutable std::mutex mutex;
+  std::vector<std::unique_ptr<Slot[]>> blocks;
+  std::vector<HardwareComponentStatisticsData *> free_slots;
+  std::size_t capacity = 0;
+};
+
+HardwareComponentStatisticsTable::HardwareComponentStatisticsTable()
+: storage_(std::make_shared<Storage>())
+{
+}
+
+void HardwareComponentStatisticsTable::reserve(std::size_t number_of_statistics)
+{
+  std::lock_guard<std::mutex> guard(storage_->mutex);
+  if (storage_->free_slots.size() < number_of_statistics)
+  {
+    storage_->add_block(number_of_statistics - storage_->free_slots.size());
+  }
+}
+
+std::shared_ptr<HardwareComponentStatisticsData> HardwareComponentStatisticsTable::acquire()
+{
+  std::lock_guard<std::mutex> guard(storage_->mutex);
+  if (storage_->free_slots.empty())
+  {
+    storage_->add_block(std::max(MINIMUM_BLOCK_SIZE, storage_->capacity));
+  }
+  HardwareComponentStatisticsData * slot = storage_->free_slots.back();
+  storage_->free_slots.pop_back();
+  // the deleter keeps the storage alive until all the slots are released
+  return std::shared_ptr<HardwareComponentStatisticsData>(
+    slot,
+    [storage = storage_](HardwareComponentStatisticsData * released_slot)
+    {
+      released_slot->~HardwareComponentStatisticsData();
+      new (released_slot) HardwareComponentStatisticsData();
+      std::lock_guard<std::mutex> guard(storage->mutex);
+      storage->free_slots.push_back(released_slot);
+    });
+}
+
+std::size_t HardwareComponentStatisticsTable::get_capacity() const
+{
+  std::lock_guard<std::mutex> guard(storage_->mutex);
+  return storage_->capacity;
+}
+
+std::size_t HardwareComponentStatisticsTable::get_number_of_free_slots() const
+{
+  std::lock_guard<std::mutex> guard(storage_->mutex);
+  return storage_->free_slots.size();
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,246 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/hardware_dependency_index.hpp"
+
+#include <algorithm>
+
+namespace
+{
+const std::string kEmptyName;
+const std::vector<std::size_t> kNoIndices;
+const std::vector<std::string> kNoInterfaces;
+
+/// Appends \p value to \p values if it isn't listed yet, keeping the order of the additions
+void add_unique(std::vector<std::size_t> & values, std::size_t value)
+{
+  if (std::find(values.begin(), values.end(), value) == values.end())
+  {
+    values.push_back(value);
+  }
+}
+
+void remove_value(std::vector<std::size_t> & values, std::size_t value)
+{
+  values.erase(std::remove(values.begin(), values.end(), value), values.end());
+}
+}  // namespace
+
+namespace hardware_interface
+{
+void HardwareDependencyIndex::set_components(const std::vector<ComponentInterfaces> & components)
+{
+  components_.clear();
+  command_interface_owners_.clear();
+  state_interface_owners_.clear();
+  components_.reserve(components.size());
+  for (std::size_t i = 0; i < components.size(); ++i)
+  {
+    components_.push_back(ComponentEntry{components[i].name, {}, {}});
+    for (const auto & interface : components[i].command_interfaces)
+    {
+      command_interface_owners_.emplace(interface, i);
+    }
+    for (const auto & interface : components[i].state_interfaces)
+    {
+      state_interface_owners_.emplace(interface, i);
+    }
+  }
+
+  for (std::size_t controller_index = 0; controller_index < controllers_.size();
+       ++controller_index)
+  {
+    auto & controller = controllers_[controller_index];
+    controller.components.clear();
+    for (const auto & interface : controller.command_interfaces)
+    {
+      add_dependency(controller_index, interface, true);
+    }
+    for (const auto & interface : controller.state_interfaces)
+    {
+      add_dependency(controller_index, interface, false);
+    }
+  }
+}
+
+std::size_t HardwareDependencyIndex::add_controller_interfaces(
+  const std::string & controller_name, const std::vector<std::string> & command_interfaces,
+  const std::vector<std::string> & state_interfaces)
+{
+  auto id_it = controller_ids_.find(controller_name);
+  if (id_it == controller_ids_.end())
+  {
+    std::size_t controller_index = controllers_.size();
+    if (free_controller_indices_.empty())
+    {
+      controllers_.emplace_back();
+    }
+    else
+    {
+      controller_index = free_controller_indices_.back();
+      free_controller_indices_.pop_back();
+    }
+    controllers_[controller_index].name = controller_name;
+    id_it = controller_ids_.emplace(controller_name, controller_index).first;
+  }
+  const std::size_t controller_index = id_it->second;
+
+  auto add_interfaces = [this, controller_index](
+                          std::vector<std::string> & known_interfaces,
+                          const std::vector<std::string> & interfaces, bool is_command_interface)
+  {
+    for (const auto & interface : interfaces)
+    {
+      if (
+        std::find(known_interfaces.begin(), known_interfaces.end(), interface) ==
+        known_interfaces.end())
+      {
+        known_interfaces.push_back(interface);
+        add_dependency(controller_index, interface, is_command_interface);
+      }
+    }
+  };
+  add_interfaces(controllers_[controller_index].command_interfaces, command_interfaces, true);
+  add_interfaces(controllers_[controller_index].state_interfaces, state_interfaces, false);
+  return controller_index;
+}
+
+bool HardwareDependencyIndex::remove_controller(const std::string & controller_name)
+{
+  const auto id_it = controller_ids_.find(controller_name);
+  if (id_it == controller_ids_.end())
+  {
+    return false;
+  }
+  const std::size_t controller_index = id_it->second;
+  auto & controller = controllers_[controller_index];
+  for (const auto component_index : controller.components)
+  {
+    remove_value(components_[component_index].controllers, controller_index);
+    remove_value(components_[component_index].command_controllers, controller_index);
+  }
+  controller = ControllerEntry{};
+  free_controller_indices_.push_back(controller_index);
+  controller_ids_.erase(id_it);
+  return true;
+}
+
+std::optional<std::size_t> HardwareDependencyIndex::find_component(
+  const std::string & component_name) const
+{
+  const auto component_it = std::find_if(
+    components_.begin(), components_.end(),
+    [&component_name](const ComponentEntry & component)
+    { return component.name == component_name; });
+  if (component_it == components_.end())
+  {
+    return std::nullopt;
+  }
+  return static_cast<std::size_t>(std::distance(components_.begin(), component_it));
+}
+
+std::optional<std::size_t> HardwareDependencyIndex::find_interface_owner(
+  const std::string & interface_name) const
+{
+  const auto command_it = command_interface_owners_.find(interface_name);
+  if (command_it != command_interface_owners_.end())
+  {
+    return command_it->second;
+  }
+  const auto state_it = state_interface_owners_.find(interface_name);
+  if (state_it != state_interface_owners_.end())
+  {
+    return state_it->second;
+  }
+  return std::nullopt;
+}
+
+const std::string & HardwareDependencyIndex::get_component_name(
+  std::size_t component_index) const noexcept
+{
+  return component_index < components_.size() ? components_[component_index].name : kEmptyName;
+}
+
+const std::vector<std::size_t> & HardwareDependencyIndex::get_controllers_of_component(
+  std::size_t component_index) const noexcept
+{
+  return component_index < components_.size() ? components_[component_index].controllers
+                                               : kNoIndices;
+}
+
+const std::vector<std::size_t> & HardwareDependencyIndex::get_command_controllers_of_component(
+  std::size_t component_index) const noexcept
+{
+  return component_index < components_.size() ? components_[component_index].command_controllers
+                                               : kNoIndices;
+}
+
+std::optional<std::size_t> HardwareDependencyIndex::find_controller(
+  const std::string & controller_name) const
+{
+  const auto id_it = controller_ids_.find(controller_name);
+  if (id_it == controller_ids_.end())
+  {
+    return std::nullopt;
+  }
+  return id_it->second;
+}
+
+const std::string & HardwareDependencyIndex::get_controller_name(
+  std::size_t controller_index) const noexcept
+{
+  return controller_index < controllers_.size() ? controllers_[controller_index].name
+                                                : kEmptyName;
+}
+
+const std::vector<std::size_t> & HardwareDependencyIndex::get_components_of_controller(
+  std::size_t controller_index) const noexcept
+{
+  return controller_index < controllers_.size() ? controllers_[controller_index].components
+                                                : kNoIndices;
+}
+
+const std::vector<std::string> & HardwareDependencyIndex::get_controller_command_interfaces(
+  std::size_t controller_index) const noexcept
+{
+  return controller_index < controllers_.size() ? controllers_[controller_index].command_interfaces
+                                                : kNoInterfaces;
+}
+
+const std::vector<std::string> & HardwareDependencyIndex::get_controller_state_interfaces(
+  std::size_t controller_index) const noexcept
+{
+  return controller_index < controllers_.size() ? controllers_[controller_index].state_interfaces
+                                                : kNoInterfaces;
+}
+
+void HardwareDependencyIndex::add_dependency(
+  std::size_t controller_index, const std::string & interface_name, bool is_command_interface)
+{
+  const auto & owners = is_command_interface ? command_interface_owners_ : state_interface_owners_;
+  const auto owner_it = owners.find(interface_name);
+  if (owner_it == owners.end())
+  {
+    return;
+  }
+  const std::size_t component_index = owner_it->second;
+  add_unique(controllers_[controller_index].components, component_index);
+  add_unique(components_[component_index].controllers, controller_index);
+  if (is_command_interface)
+  {
+    add_unique(components_[component_index].command_controllers, controller_index);
+  }
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,589 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/hardware_info_cache.hpp"
+
+#include <fmt/compile.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "hardware_interface/component_parser.hpp"
+#include "rcutils/logging_macros.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hardware_interface
+{
+namespace
+{
+/// "R2HI" in little endian
+constexpr uint32_t CACHE_FILE_MAGIC = 0x49483252;
+
+struct CacheFileHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t hash;
+  uint64_t urdf_size;
+  uint64_t payload_size;
+};
+
+class Writer
+{
+public:
+  template <typename T>
+  void write(const T & value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types are written");
+    buffer_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  void write(const std::string & value)
+  {
+    write(static_cast<uint64_t>(value.size()));
+    buffer_.append(value);
+  }
+
+  template <typename T>
+  void write(const std::vector<T> & values)
+  {
+    write(static_cast<uint64_t>(values.size()));
+    for (const auto & value : values)
+    {
+      write(value);
+    }
+  }
+
+  template <typename T>
+  void write(const std::unordered_map<std::string, T> & values)
+  {
+    // sorted by key, so that the same hardware infos always give the same buffer
+    std::vector<typename std::unordered_map<std::string, T>::const_iterator> entries;
+    entries.reserve(values.size());
+    for (auto it = values.cbegin(); it != values.cend(); ++it)
+    {
+      entries.push_back(it);
+    }
+    std::sort(
+      entries.begin(), entries.end(), [](auto lhs, auto rhs) { return lhs->first < rhs->first; });
+    write(static_cast<uint64_t>(entries.size()));
+    for (const auto & entry : entries)
+    {
+      write(entry->first);
+      write(entry->second);
+    }
+  }
+
+  // the fields are written one by one, the padding of the structure is left out
+  void write(const joint_limits::JointLimits & limits)
+  {
+    write(limits.min_position);
+    write(limits.max_position);
+    write(limits.max_velocity);
+    write(limits.max_acceleration);
+    write(limits.max_deceleration);
+    write(limits.max_jerk);
+    write(limits.max_effort);
+    write(limits.has_position_limits);
+    write(limits.has_velocity_limits);
+    write(limits.has_acceleration_limits);
+    write(limits.has_deceleration_limits);
+    write(limits.has_jerk_limits);
+    write(limits.has_effort_limits);
+    write(limits.angle_wraparound);
+  }
+
+  void write(const InterfaceInfo & info)
+  {
+    write(info.name);
+    write(info.min);
+    write(info.max);
+    write(info.initial_value);
+    write(info.data_type);
+    write(info.size);
+    write(info.parameters);
+    write(info.enable_limits);
+    write(info.lock_free);
+    write(info.packed);
+  }
+
+  void write(const ComponentInfo & info)
+  {
+    write(info.name);
+    write(info.type);
+    write(info.is_mimic);
+    write(info.enable_limits);
+    write(info.command_interfaces);
+    write(info.state_interfaces);
+    write(info.parameters);
+  }
+
+  template <typename T>
+  void write_transmission_component(const T & info)
+  {
+    write(info.name);
+    write(info.state_interfaces);
+    write(info.command_interfaces);
+    write(info.role);
+    write(info.mechanical_reduction);
+    write(info.offset);
+    write(info.read_only);
+  }
+
+  void write(const JointInfo & info) { write_transmission_component(info); }
+  void write(const ActuatorInfo & info) { write_transmission_component(info); }
+
+  void write(const TransmissionInfo & info)
+  {
+    write(info.name);
+    write(info.type);
+    write(info.joints);
+    write(info.actuators);
+    write(info.parameters);
+  }
+
+  void write(const HardwareInfo & info)
+  {
+    write(info.name);
+    write(info.type);
+    write(info.group);
+    write(info.resource_namespace);
+    write(info.bus);
+    write(info.bus_plugin_name);
+    write(info.rw_rate);
+    write(info.rw_phase);
+    write(info.time_budget_us);
+    write(info.time_budget_policy);
+    write(info.statistics_type);
+    write(info.criticality);
+    write(info.is_async);
+    write(info.async_params.thread_priority);
+    write(info.async_params.scheduling_policy);
+    write(info.async_params.cpu_affinity_cores);
+    write(info.async_params.print_warnings);
+    write(info.async_params.control_loop);
+    write(info.recovery_params.max_attempts);
+    write(info.recovery_params.initial_backoff);
+    write(info.recovery_params.max_backoff);
+    write(info.recovery_params.restore_controllers);
+    write(info.hardware_plugin_name);
+    write(info.hardware_parameters);
+    write(info.joints);
+    write(info.mimic_joints);
+    write(info.sensors);
+    write(info.gpios);
+    write(info.transmissions);
+    write(info.original_xml);
+    write(info.description_xml);
+    write(info.limits);
+    write(info.soft_limits);
+  }
+
+  const std::string & buffer() const { return buffer_; }
+
+private:
+  std::string buffer_;
+};
+
+class Reader
+{
+public:
+  Reader(const char * data, std::size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  void read(T & value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types are read");
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+  }
+
+  void read(std::string & value)
+  {
+    const auto size = read_size();
+    value.assign(take(size), size);
+  }
+
+  template <typename T>
+  void read(std::vector<T> & values)
+  {
+    values.resize(read_size());
+    for (auto & value : values)
+    {
+      read(value);
+    }
+  }
+
+  template <typename T>
+  void read(std::unordered_map<std::string, T> & values)
+  {
+    const auto size = read_size();
+    values.clear();
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      std::string key;
+      read(key);
+      read(values[key]);
+    }
+  }
+
+  void read(joint_limits::JointLimits & limits)
+  {
+    read(limits.min_position);
+    read(limits.max_position);
+    read(limits.max_velocity);
+    read(limits.max_acceleration);
+    read(limits.max_deceleration);
+    read(limits.max_jerk);
+    read(limits.max_effort);
+    read(limits.has_position_limits);
+    read(limits.has_velocity_limits);
+    read(limits.has_acceleration_limits);
+    read(limits.has_deceleration_limits);
+    read(limits.has_jerk_limits);
+    read(limits.has_effort_limits);
+    read(limits.angle_wraparound);
+  }
+
+  void read(InterfaceInfo & info)
+  {
+    read(info.name);
+    read(info.min);
+    read(info.max);
+    read(info.initial_value);
+    read(info.data_type);
+    read(info.size);
+    read(info.parameters);
+    read(info.enable_limits);
+    read(info.lock_free);
+    read(info.packed);
+  }
+
+  void read(ComponentInfo & info)
+  {
+    read(info.name);
+    read(info.type);
+    read(info.is_mimic);
+    read(info.enable_limits);
+    read(info.command_interfaces);
+    read(info.state_interfaces);
+    read(info.parameters);
+  }
+
+  template <typename T>
+  void read_transmission_component(T & info)
+  {
+    read(info.name);
+    read(info.state_interfaces);
+    read(info.command_interfaces);
+    read(info.role);
+    read(info.mechanical_reduction);
+    read(info.offset);
+    read(info.read_only);
+  }
+
+  void read(JointInfo & info) { read_transmission_component(info); }
+  void read(ActuatorInfo & info) { read_transmission_component(info); }
+
+  void read(TransmissionInfo & info)
+  {
+    read(info.name);
+    read(info.type);
+    read(info.joints);
+    read(info.actuators);
+    read(info.parameters);
+  }
+
+  void read(HardwareInfo & info)
+  {
+    read(info.name);
+    read(info.type);
+    read(info.group);
+    read(info.resource_namespace);
+    read(info.bus);
+    read(info.bus_plugin_name);
+    read(info.rw_rate);
+    read(info.rw_phase);
+    read(info.time_budget_us);
+    read(info.time_budget_policy);
+    read(info.statistics_type);
+    read(info.criticality);
+    read(info.is_async);
+    read(info.async_params.thread_priority);
+    read(info.async_params.scheduling_policy);
+    read(info.async_params.cpu_affinity_cores);
+    read(info.async_params.print_warnings);
+    read(info.async_params.control_loop);
+    read(info.recovery_params.max_attempts);
+    read(info.recovery_params.initial_backoff);
+    read(info.recovery_params.max_backoff);
+    read(info.recovery_params.restore_controllers);
+    read(info.hardware_plugin_name);
+    read(info.hardware_parameters);
+    read(info.joints);
+    read(info.mimic_joints);
+    read(info.sensors);
+    read(info.gpios);
+    read(info.transmissions);
+    read(info.original_xml);
+    read(info.description_xml);
+    read(info.limits);
+    read(info.soft_limits);
+  }
+
+  bool at_end() const { return offset_ == size_; }
+
+private:
+  std::size_t read_size()
+  {
+    uint64_t size = 0;
+    read(size);
+    // every element takes at least one byte, so a larger size can only come from corrupted data
+    if (size > size_ - offset_)
+    {
+      throw std::runtime_error("The hardware info data is malformed.");
+    }
+    return static_cast<std::size_t>(size);
+  }
+
+  const char * take(std::size_t size)
+  {
+    if (size > size_ - offset_)
+    {
+      throw std::runtime_error("The hardware info data is truncated.");
+    }
+    const char * result = data_ + offset_;
+    offset_ += size;
+    return result;
+  }
+
+  const char * data_;
+  std::size_t size_;
+  std::size_t offset_ = 0;
+};
+
+/// Deserializes the cache file if it matches the URDF, returns false otherwise.
+bool read_cache_file(
+  const char * data, std::size_t size, const std::string & urdf,
+  std::vector<HardwareInfo> & hardware_info)
+{
+  CacheFileHeader header;
+  if (size < sizeof(header))
+  {
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(header));
+  if (
+    header.magic != CACHE_FILE_MAGIC || header.version != HARDWARE_INFO_CACHE_VERSION ||
+    header.hash != HardwareInfoCache::hash(urdf) || header.urdf_size != urdf.size() ||
+    size - sizeof(header) < header.urdf_size ||
+    size - sizeof(header) - header.urdf_size != header.payload_size)
+  {
+    return false;
+  }
+  const char * cached_urdf = data + sizeof(header);
+  if (urdf.compare(0, urdf.size(), cached_urdf, header.urdf_size) != 0)
+  {
+    return false;
+  }
+  hardware_info = deserialize_hardware_info(
+    cached_urdf + header.urdf_size, static_cast<std::size_t>(header.payload_size));
+  return true;
+}
+}  // namespace
+
+std::string serialize_hardware_info(const std::vector<HardwareInfo> & hardware_info)
+{
+  Writer writer;
+  writer.write(hardware_info);
+  return writer.buffer();
+}
+
+std::vector<HardwareInfo> deserialize_hardware_info(const char * data, std::size_t size)
+{
+  Reader reader(data, size);
+  std::vector<HardwareInfo> hardware_info;
+  reader.read(hardware_info);
+  if (!reader.at_end())
+  {
+    throw std::runtime_error("The hardware info data has trailing bytes.");
+  }
+  return hardware_info;
+}
+
+HardwareInfoCache::HardwareInfoCache(const std::string & directory) : directory_(directory) {}
+
+std::vector<HardwareInfo> HardwareInfoCache::parse_control_resources_from_urdf(
+  const std::string & urdf) const
+{
+  std::vector<HardwareInfo> hardware_info;
+  try
+  {
+    if (load(urdf, hardware_info))
+    {
+      RCUTILS_LOG_DEBUG_NAMED(
+        "hardware_info_cache", "Loaded the hardware info from the cache file '%s'.",
+        get_file_path(urdf).c_str());
+      return hardware_info;
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCUTILS_LOG_WARN_NAMED(
+      "hardware_info_cache", "Ignoring the invalid cache file '%s': %s",
+      get_file_path(urdf).c_str(), e.what());
+  }
+
+  hardware_info = hardware_interface::parse_control_resources_from_urdf(urdf);
+  try
+  {
+    store(urdf, hardware_info);
+  }
+  catch (const std::exception & e)
+  {
+    RCUTILS_LOG_WARN_NAMED(
+      "hardware_info_cache", "Unable to store the hardware info in the cache: %s", e.what());
+  }
+  return hardware_info;
+}
+
+bool HardwareInfoCache::load(
+  const std::string & urdf, std::vector<HardwareInfo> & hardware_info) const
+{
+  const auto path = get_file_path(urdf);
+#if defined(_WIN32)
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+  {
+    return false;
+  }
+  const std::string data(
+    (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return read_cache_file(data.data(), data.size(), urdf, hardware_info);
+#else
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0)
+  {
+    ::close(fd);
+    return false;
+  }
+  const auto size = static_cast<std::size_t>(file_stat.st_size);
+  void * data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED)
+  {
+    return false;
+  }
+  try
+  {
+    const bool result = read_cache_file(static_cast<const char *>(data), size, urdf, hardware_info);
+    munmap(data, size);
+    return result;
+  }
+  catch (...)
+  {
+    munmap(data, size);
+    throw;
+  }
+#endif
+}
+
+void HardwareInfoCache::store(
+  const std::string & urdf, const std::vector<HardwareInfo> & hardware_info) const
+{
+  const std::string payload = serialize_hardware_info(hardware_info);
+  CacheFileHeader header;
+  header.magic = CACHE_FILE_MAGIC;
+  header.version = HARDWARE_INFO_CACHE_VERSION;
+  header.hash = hash(urdf);
+  header.urdf_size = urdf.size();
+  header.payload_size = payload.size();
+
+  std::error_code error;
+  std::filesystem::create_directories(directory_, error);
+  if (error)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to create the cache directory '{}': {}"), directory_,
+        error.message()));
+  }
+
+  // the file is renamed once complete, so that readers never see a partially written file
+  const auto path = get_file_path(urdf);
+  const auto temporary_path = fmt::format(
+    FMT_COMPILE("{}.{}.tmp"), path, std::chrono::steady_clock::now().time_since_epoch().count());
+  {
+    std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(urdf.data(), static_cast<std::streamsize>(urdf.size()));
+    file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    if (!file)
+    {
+      file.close();
+      std::filesystem::remove(temporary_path, error);
+      throw std::runtime_error(
+        fmt::format(FMT_COMPILE("Unable to write the cache file '{}'."), temporary_path));
+    }
+  }
+  std::filesystem::rename(temporary_path, path, error);
+  if (error)
+  {
+    const auto message = error.message();
+    std::filesystem::remove(temporary_path, error);
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to rename the cache file '{}': {}"), temporary_path, message));
+  }
+}
+
+std::string HardwareInfoCache::get_file_path(const std::string & urdf) const
+{
+  return (std::filesystem::path(directory_) /
+          fmt::format(FMT_COMPILE("hardware_info_{:016x}.bin"), hash(urdf)))
+    .string();
+}
+
+uint64_t HardwareInfoCache::hash(const std::string & urdf)
+{
+  uint64_t result = 0xcbf29ce484222325ULL;
+  for (const char c : urdf)
+  {
+    result ^= static_cast<uint8_t>(c);
+    result *= 0x100000001b3ULL;
+  }
+  return result;
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,184 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/hardware_status_aggregator.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/qos.hpp"
+
+namespace hardware_interface
+{
+HardwareStatusSource::HardwareStatusSource(
+  const std::string & component_name, double publish_rate,
+  const control_msgs::msg::HardwareStatus & message_template, UpdateCallback update_callback)
+: component_name_(component_name),
+  publish_rate_(publish_rate),
+  message_(message_template),
+  update_callback_(std::move(update_callback))
+{
+}
+
+bool HardwareStatusSource::update()
+{
+  std::lock_guard<std::mutex> guard(update_mutex_);
+  return update_callback_ && update_callback_(message_) == return_type::OK;
+}
+
+void HardwareStatusSource::detach()
+{
+  std::lock_guard<std::mutex> guard(update_mutex_);
+  update_callback_ = nullptr;
+}
+
+HardwareStatusAggregator::HardwareStatusAggregator(
+  const rclcpp::Node::SharedPtr & node, double publish_rate)
+: node_(node)
+{
+  message_.hardware_id = node_->get_name();
+  publisher_ = node_->create_publisher<control_msgs::msg::HardwareStatus>(
+    "~/hardware_status", rclcpp::SystemDefaultsQoS());
+  if (publish_rate > 0.0)
+  {
+    period_ns_ = static_cast<int64_t>(1e9 / publish_rate);
+    timer_ = node_->create_wall_timer(
+      std::chrono::nanoseconds(period_ns_), [this]() { publish(node_->get_clock()->now()); });
+  }
+}
+
+HardwareStatusAggregator::~HardwareStatusAggregator()
+{
+  if (timer_)
+  {
+    timer_->cancel();
+  }
+}
+
+void HardwareStatusAggregator::set_sources(
+  const std::vector<std::shared_ptr<HardwareStatusSource>> & sources)
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  entries_.clear();
+  entries_.reserve(sources.size());
+  for (const auto & source : sources)
+  {
+    Entry entry;
+    entry.source = source;
+    entry.period_ns = source->get_publish_rate() > 0.0
+                        ? static_cast<int64_t>(1e9 / source->get_publish_rate())
+                        : 0;
+    entries_.push_back(std::move(entry));
+  }
+  rebuild_message();
+}
+
+std::size_t HardwareStatusAggregator::get_number_of_sources() const
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  return entries_.size();
+}
+
+void HardwareStatusAggregator::publish(const rclcpp::Time & time)
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  const int64_t time_ns = time.nanoseconds();
+  changed_device_states_ = 0;
+  bool layout_changed = false;
+  for (auto & entry : entries_)
+  {
+    // half a period of the timer of tolerance, so that the jitter of the timer doesn't skip the
+    // sources with the same rate
+    if (entry.period_ns > 0 && time_ns + period_ns_ / 2 < entry.next_update_ns)
+    {
+      continue;
+    }
+    entry.next_update_ns += entry.period_ns;
+    if (entry.next_update_ns <= time_ns)
+    {
+      entry.next_update_ns = time_ns + entry.period_ns;
+    }
+    if (!entry.source->update())
+    {
+      continue;
+    }
+    const auto & device_states = entry.source->get_message().hardware_device_states;
+    if (device_states.size() != entry.number_of_devices)
+    {
+      layout_changed = true;
+      continue;
+    }
+    for (std::size_t i = 0; i < entry.number_of_devices; ++i)
+    {
+      auto & aggregated_state = message_.hardware_device_states[entry.offset + i];
+      // compares with the unprefixed id, the swaps don't allocate
+      std::swap(aggregated_state.device_id, entry.device_ids[i]);
+      if (aggregated_state != device_states[i])
+      {
+        aggregated_state = device_states[i];
+        ++changed_device_states_;
+      }
+      std::swap(aggregated_state.device_id, entry.device_ids[i]);
+    }
+  }
+  if (layout_changed)
+  {
+    rebuild_message();
+    changed_device_states_ = message_.hardware_device_states.size();
+  }
+
+  message_.header.stamp = time;
+  if (publisher_->can_loan_messages())
+  {
+    auto loaned_message = publisher_->borrow_loaned_message();
+    loaned_message.get() = message_;
+    publisher_->publish(std::move(loaned_message));
+  }
+  else
+  {
+    publisher_->publish(message_);
+  }
+}
+
+void HardwareStatusAggregator::rebuild_message()
+{
+  std::size_t number_of_devices = 0;
+  for (const auto & entry : entries_)
+  {
+    number_of_devices += entry.source->get_message().hardware_device_states.size();
+  }
+  message_.hardware_device_states.clear();
+  message_.hardware_device_states.reserve(number_of_devices);
+  for (auto & entry : entries_)
+  {
+    const auto & source_message = entry.source->get_message();
+    const std::string & prefix = source_message.hardware_id.empty()
+                                   ? entry.source->get_component_name()
+                                   : source_message.hardware_id;
+    entry.offset = message_.hardware_device_states.size();
+    entry.number_of_devices = source_message.hardware_device_states.size();
+    entry.device_ids.clear();
+    for (const auto & device_state : source_message.hardware_device_states)
+    {
+      entry.device_ids.push_back(device_state.device_id);
+      message_.hardware_device_states.push_back(device_state);
+      message_.hardware_device_states.back().device_id = prefix + "/" + device_state.device_id;
+    }
+  }
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,186 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/instrumentation_clock.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+/// Fixed-point shift of the conversion factor from the ticks of the counter to nanoseconds
+constexpr int CONVERSION_SHIFT = 32;
+
+/// Conversion of the counter to the steady clock, set once by the calibration
+struct CounterCalibration
+{
+  std::once_flag calibrated;
+  bool available = false;
+  double frequency = 0.0;
+  uint64_t base_ticks = 0;
+  int64_t base_ns = 0;
+  /// Nanoseconds per tick, shifted by CONVERSION_SHIFT bits
+  uint64_t multiplier = 0;
+};
+
+CounterCalibration calibration;
+std::atomic<bool> use_counter{false};
+
+bool has_invariant_counter()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  // the invariant TSC ticks at a constant rate in all the power states and on all the cores
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8)) != 0;
+#elif defined(__aarch64__)
+  // the generic timer of the architecture has a fixed frequency
+  return true;
+#else
+  return false;
+#endif
+}
+
+inline uint64_t read_counter() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks = 0;
+  // the barrier keeps the read from being executed before the preceding instructions
+  asm volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks)::"memory");
+  return ticks;
+#else
+  return 0;
+#endif
+}
+
+int64_t steady_ns() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+/// Samples the steady clock and the counter at the same instant, within the narrowest of a few
+/// tries, so that a preemption between the reads doesn't bias the calibration
+void sample_clocks(uint64_t & ticks, int64_t & ns)
+{
+  uint64_t narrowest = std::numeric_limits<uint64_t>::max();
+  for (int i = 0; i < 16; ++i)
+  {
+    const uint64_t before = read_counter();
+    const int64_t sample_ns = steady_ns();
+    const uint64_t after = read_counter();
+    if (after - before < narrowest)
+    {
+      narrowest = after - before;
+      ticks = before + (after - before) / 2;
+      ns = sample_ns;
+    }
+  }
+}
+
+void calibrate()
+{
+  if (!has_invariant_counter())
+  {
+    return;
+  }
+  uint64_t start_ticks = 0;
+  int64_t start_ns = 0;
+  sample_clocks(start_ticks, start_ns);
+#if defined(__aarch64__)
+  uint64_t frequency = 0;
+  asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+  calibration.frequency = static_cast<double>(frequency);
+#else
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  uint64_t end_ticks = 0;
+  int64_t end_ns = 0;
+  sample_clocks(end_ticks, end_ns);
+  if (end_ns <= start_ns || end_ticks <= start_ticks)
+  {
+    return;
+  }
+  calibration.frequency =
+    static_cast<double>(end_ticks - start_ticks) * 1e9 / static_cast<double>(end_ns - start_ns);
+#endif
+  if (calibration.frequency <= 0.0)
+  {
+    return;
+  }
+  calibration.base_ticks = start_ticks;
+  calibration.base_ns = start_ns;
+  calibration.multiplier = static_cast<uint64_t>(
+    1e9 / calibration.frequency * static_cast<double>(uint64_t{1} << CONVERSION_SHIFT));
+  calibration.available = true;
+}
+
+}  // namespace
+
+namespace hardware_interface
+{
+std::chrono::steady_clock::time_point InstrumentationClock::now() noexcept
+{
+  if (!use_counter.load(std::memory_order_acquire))
+  {
+    return std::chrono::steady_clock::now();
+  }
+  const uint64_t ticks = read_counter() - calibration.base_ticks;
+#if defined(__SIZEOF_INT128__)
+  const auto elapsed_ns = static_cast<int64_t>(
+    (static_cast<unsigned __int128>(ticks) * calibration.multiplier) >> CONVERSION_SHIFT);
+#else
+  const auto elapsed_ns = static_cast<int64_t>(
+    static_cast<long double>(ticks) * calibration.multiplier /
+    static_cast<long double>(uint64_t{1} << CONVERSION_SHIFT));
+#endif
+  return std::chrono::steady_clock::time_point(
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::nanoseconds(calibration.base_ns + elapsed_ns)));
+}
+
+bool InstrumentationClock::use_cpu_counter()
+{
+  std::call_once(calibration.calibrated, calibrate);
+  // the calibration is published by the release store
+  use_counter.store(calibration.available, std::memory_order_release);
+  return calibration.available;
+}
+
+void InstrumentationClock::use_steady_clock() noexcept
+{
+  use_counter.store(false, std::memory_order_release);
+}
+
+bool InstrumentationClock::is_using_cpu_counter() noexcept
+{
+  return use_counter.load(std::memory_order_relaxed);
+}
+
+double InstrumentationClock::get_counter_frequency()
+{
+  std::call_once(calibration.calibrated, calibrate);
+  return calibration.frequency;
+}
+
+}  // namespace hardware_interface
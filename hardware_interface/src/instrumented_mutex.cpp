@@ -0,0 +1,119 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/instrumented_mutex.hpp"
+
+#include <functional>
+#include <thread>
+
+#include "hardware_interface/instrumentation_clock.hpp"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+void store_max(std::atomic<int64_t> & max, int64_t value) noexcept
+{
+  int64_t current = max.load(std::memory_order_relaxed);
+  while (value > current &&
+         !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+}  // namespace
+
+namespace hardware_interface
+{
+void InstrumentedRecursiveMutex::lock()
+{
+  // a recursive lock by the holding thread always succeeds here
+  if (!mutex_.try_lock())
+  {
+    const auto start = InstrumentationClock::now();
+    mutex_.lock();
+    contended_locks_.fetch_add(1, std::memory_order_relaxed);
+    store_max(
+      max_wait_ns_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      InstrumentationClock::now() - start)
+                      .count());
+  }
+  on_acquired();
+}
+
+bool InstrumentedRecursiveMutex::try_lock() noexcept
+{
+  if (mutex_.try_lock())
+  {
+    on_acquired();
+    return true;
+  }
+  try_lock_failures_.fetch_add(1, std::memory_order_relaxed);
+  last_blocking_thread_.store(
+    owner_thread_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  return false;
+}
+
+void InstrumentedRecursiveMutex::unlock() noexcept
+{
+  if (--depth_ == 0)
+  {
+    store_max(
+      max_hold_ns_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      InstrumentationClock::now() - acquire_time_)
+                      .count());
+    owner_thread_.store(0, std::memory_order_relaxed);
+  }
+  mutex_.unlock();
+}
+
+LockContentionStatistics InstrumentedRecursiveMutex::get_statistics() const
+{
+  LockContentionStatistics statistics;
+  statistics.locks = locks_.load(std::memory_order_relaxed);
+  statistics.contended_locks = contended_locks_.load(std::memory_order_relaxed);
+  statistics.try_lock_failures = try_lock_failures_.load(std::memory_order_relaxed);
+  statistics.max_wait_time =
+    std::chrono::nanoseconds(max_wait_ns_.load(std::memory_order_relaxed));
+  statistics.max_hold_time =
+    std::chrono::nanoseconds(max_hold_ns_.load(std::memory_order_relaxed));
+  statistics.last_blocking_thread = last_blocking_thread_.load(std::memory_order_relaxed);
+  statistics.owner_thread = owner_thread_.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+int64_t InstrumentedRecursiveMutex::get_current_thread_id() noexcept
+{
+#if defined(__linux__)
+  thread_local const int64_t thread_id = static_cast<int64_t>(syscall(SYS_gettid));
+#else
+  thread_local const int64_t thread_id =
+    static_cast<int64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+#endif
+  return thread_id;
+}
+
+void InstrumentedRecursiveMutex::on_acquired() noexcept
+{
+  if (depth_++ == 0)
+  {
+    acquire_time_ = InstrumentationClock::now();
+    owner_thread_.store(get_current_thread_id(), std::memory_order_relaxed);
+    locks_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,446 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "hardware_interface/interface_flight_recorder.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hardware_interface/realtime_thread.hpp"
+#include "rclcpp/logging.hpp"
+
+namespace hardware_interface
+{
+namespace
+{
+constexpr char MAGIC[8] = {'R', 'C', '2', 'C', 'R', 'E', 'C', '1'};
+constexpr uint32_t VERSION = 1;
+/// Longest interface name accepted when loading a recording
+constexpr uint32_t MAX_NAME_LENGTH = 4096;
+constexpr auto WRITE_PERIOD = std::chrono::milliseconds(100);
+
+template <typename T>
+void write_value(std::ostream & os, const T & value)
+{
+  os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+void write_values(std::ostream & os, const std::vector<T> & values)
+{
+  os.write(
+    reinterpret_cast<const char *>(values.data()),
+    static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+template <typename T>
+bool read_value(std::istream & is, T & value)
+{
+  return static_cast<bool>(is.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+template <typename T>
+bool read_values(std::istream & is, std::vector<T> & values, std::size_t count)
+{
+  const std::size_t offset = values.size();
+  values.resize(offset + count);
+  return static_cast<bool>(is.read(
+    reinterpret_cast<char *>(values.data() + offset),
+    static_cast<std::streamsize>(count * sizeof(T))));
+}
+}  // namespace
+
+void FlightRecording::clear_cycles()
+{
+  cycles.clear();
+  read_stamps_ns.clear();
+  write_stamps_ns.clear();
+  for (auto & column : columns)
+  {
+    column.clear();
+  }
+}
+
+void FlightRecording::write_header(std::ostream & os) const
+{
+  os.write(MAGIC, sizeof(MAGIC));
+  write_value(os, VERSION);
+  write_value(os, static_cast<uint32_t>(interface_names.size()));
+  write_value(os, static_cast<uint32_t>(number_of_state_interfaces));
+  for (std::size_t i = 0; i < interface_names.size(); ++i)
+  {
+    write_value(os, static_cast<uint32_t>(interface_names[i].size()));
+    os.write(interface_names[i].data(), static_cast<std::streamsize>(interface_names[i].size()));
+    write_value(os, static_cast<int32_t>(data_types[i]));
+  }
+}
+
+void FlightRecording::write_block(std::ostream & os) const
+{
+  write_value(os, static_cast<uint64_t>(size()));
+  write_values(os, cycles);
+  write_values(os, read_stamps_ns);
+  write_values(os, write_stamps_ns);
+  for (const auto & column : columns)
+  {
+    write_values(os, column);
+  }
+}
+
+FlightRecording FlightRecording::load(const std::string & file_name)
+{
+  std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+  if (!file)
+  {
+    throw std::runtime_error("Unable to open the flight recording '" + file_name + "'.");
+  }
+  const auto file_size = static_cast<uint64_t>(file.tellg());
+  file.seekg(0);
+  auto invalid = [&file_name](const std::string & reason)
+  { return std::runtime_error("Invalid flight recording '" + file_name + "': " + reason); };
+
+  char magic[sizeof(MAGIC)];
+  uint32_t version = 0;
+  uint32_t number_of_interfaces = 0;
+  uint32_t number_of_state_interfaces = 0;
+  if (
+    !file.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+    !read_value(file, version) || version != VERSION || !read_value(file, number_of_interfaces) ||
+    !read_value(file, number_of_state_interfaces) ||
+    number_of_state_interfaces > number_of_interfaces)
+  {
+    throw invalid("unknown header");
+  }
+
+  FlightRecording recording;
+  recording.number_of_state_interfaces = number_of_state_interfaces;
+  for (uint32_t i = 0; i < number_of_interfaces; ++i)
+  {
+    uint32_t name_length = 0;
+    int32_t data_type = 0;
+    if (!read_value(file, name_length) || name_length > MAX_NAME_LENGTH)
+    {
+      throw invalid("truncated interface description");
+    }
+    std::string name(name_length, '\0');
+    if (!file.read(name.data(), name_length) || !read_value(file, data_type))
+    {
+      throw invalid("truncated interface description");
+    }
+    recording.interface_names.push_back(std::move(name));
+    recording.data_types.emplace_back(static_cast<HandleDataType::Value>(data_type));
+  }
+  recording.columns.resize(number_of_interfaces);
+
+  const uint64_t bytes_per_cycle = 3 * sizeof(int64_t) + number_of_interfaces * sizeof(double);
+  uint64_t number_of_cycles = 0;
+  while (read_value(file, number_of_cycles))
+  {
+    // checked before allocating the memory of the block
+    const auto remaining_bytes = file_size - static_cast<uint64_t>(file.tellg());
+    if (number_of_cycles > remaining_bytes / bytes_per_cycle)
+    {
+      throw invalid("truncated block");
+    }
+    const auto count = static_cast<std::size_t>(number_of_cycles);
+    bool complete = read_values(file, recording.cycles, count) &&
+                    read_values(file, recording.read_stamps_ns, count) &&
+                    read_values(file, recording.write_stamps_ns, count);
+    for (auto & column : recording.columns)
+    {
+      complete = complete && read_values(file, column, count);
+    }
+    if (!complete)
+    {
+      throw invalid("truncated block");
+    }
+  }
+  return recording;
+}
+
+InterfaceFlightRecorder::~InterfaceFlightRecorder() { stop(); }
+
+void InterfaceFlightRecorder::configure(
+  const std::vector<StateInterface::ConstSharedPtr> & state_interfaces,
+  const std::vector<CommandInterface::SharedPtr> & command_interfaces, std::size_t capacity)
+{
+  if (capacity < 2)
+  {
+    throw std::invalid_argument("The capacity of the flight recorder has to be at least 2.");
+  }
+  stop();
+
+  state_interfaces_ = state_interfaces;
+  command_interfaces_ = command_interfaces;
+  interface_names_.clear();
+  data_types_.clear();
+  auto describe = [this](const auto & interfaces)
+  {
+    for (const auto & interface : interfaces)
+    {
+      interface_names_.push_back(interface->get_name());
+      data_types_.push_back(interface->get_data_type());
+    }
+  };
+  describe(state_interfaces_);
+  describe(command_interfaces_);
+  number_of_columns_ = interface_names_.size();
+  capacity_ = capacity;
+
+  values_ = std::make_unique<std::atomic<double>[]>(capacity_ * number_of_columns_);
+  cycles_ = std::make_unique<std::atomic<uint64_t>[]>(capacity_);
+  read_stamps_ns_ = std::make_unique<std::atomic<int64_t>[]>(capacity_);
+  write_stamps_ns_ = std::make_unique<std::atomic<int64_t>[]>(capacity_);
+  for (std::size_t i = 0; i < capacity_ * number_of_columns_; ++i)
+  {
+    values_[i].store(std::numeric_limits<double>::quiet_NaN(), std::memory_order_relaxed);
+  }
+  head_.store(0, std::memory_order_release);
+  drain_cycle_ = 0;
+  dropped_cycles_.store(0, std::memory_order_relaxed);
+  dump_requested_.store(false, std::memory_order_relaxed);
+}
+
+void InterfaceFlightRecorder::start(
+  const std::string & output_file, const std::string & dump_file_prefix,
+  const rclcpp::Logger & logger)
+{
+  stop();
+  if (!output_file.empty())
+  {
+    output_ = std::make_unique<std::ofstream>(output_file, std::ios::binary | std::ios::trunc);
+    if (!*output_)
+    {
+      output_.reset();
+      throw std::runtime_error("Unable to create the flight recording '" + output_file + "'.");
+    }
+    make_recording().write_header(*output_);
+  }
+  dump_file_prefix_ = dump_file_prefix;
+  logger_ = std::make_unique<rclcpp::Logger>(logger);
+  stop_writer_ = false;
+  RealtimeThreadParams thread_params;
+  thread_params.name = "flight_recorder";
+  writer_thread_ = create_realtime_thread(thread_params, logger, [this]() { write_files(); });
+}
+
+void InterfaceFlightRecorder::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    stop_writer_ = true;
+  }
+  writer_cv_.notify_all();
+  if (writer_thread_.joinable())
+  {
+    writer_thread_.join();
+  }
+  output_.reset();
+}
+
+void InterfaceFlightRecorder::record_states(int64_t stamp_ns, uint64_t cycle) noexcept
+{
+  if (!values_)
+  {
+    return;
+  }
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  const std::size_t slot = static_cast<std::size_t>(head % capacity_);
+  // the stores into the slot must not become visible before the commit of the previous cycle,
+  // so that the readers detect that the oldest cycle is overwritten
+  std::atomic_thread_fence(std::memory_order_release);
+  std::atomic<double> * row = &values_[slot * number_of_columns_];
+  for (std::size_t i = 0; i < state_interfaces_.size(); ++i)
+  {
+    double value = std::numeric_limits<double>::quiet_NaN();
+    try
+    {
+      value = state_interfaces_[i]->get_optional_as_double().value_or(value);
+    }
+    catch (...)
+    {
+      // a value that cannot be read is recorded as NaN
+    }
+    row[i].store(value, std::memory_order_relaxed);
+  }
+  cycles_[slot].store(cycle, std::memory_order_relaxed);
+  read_stamps_ns_[slot].store(stamp_ns, std::memory_order_relaxed);
+}
+
+void InterfaceFlightRecorder::record_commands(int64_t stamp_ns) noexcept
+{
+  if (!values_)
+  {
+    return;
+  }
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  const std::size_t slot = static_cast<std::size_t>(head % capacity_);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::atomic<double> * row = &values_[slot * number_of_columns_ + state_interfaces_.size()];
+  for (std::size_t i = 0; i < command_interfaces_.size(); ++i)
+  {
+    double value = std::numeric_limits<double>::quiet_NaN();
+    try
+    {
+      value = command_interfaces_[i]->get_optional_as_double().value_or(value);
+    }
+    catch (...)
+    {
+      // a value that cannot be read is recorded as NaN
+    }
+    row[i].store(value, std::memory_order_relaxed);
+  }
+  write_stamps_ns_[slot].store(stamp_ns, std::memory_order_relaxed);
+  head_.store(head + 1, std::memory_order_release);
+}
+
+uint64_t InterfaceFlightRecorder::copy_rows(
+  uint64_t first_cycle, FlightRecording & recording, uint64_t & skipped_cycles) const
+{
+  skipped_cycles = 0;
+  if (!values_)
+  {
+    return first_cycle;
+  }
+  // the slot of the cycle at the head may already be overwritten by the cycle in progress
+  const uint64_t head = head_.load(std::memory_order_acquire);
+  const uint64_t oldest_cycle = head >= capacity_ ? head - capacity_ + 1 : 0;
+  const uint64_t begin = std::max(first_cycle, oldest_cycle);
+  skipped_cycles = begin - first_cycle;
+
+  const std::size_t offset = recording.size();
+  for (uint64_t cycle = begin; cycle < head; ++cycle)
+  {
+    const std::size_t slot = static_cast<std::size_t>(cycle % capacity_);
+    recording.cycles.push_back(cycles_[slot].load(std::memory_order_relaxed));
+    recording.read_stamps_ns.push_back(read_stamps_ns_[slot].load(std::memory_order_relaxed));
+    recording.write_stamps_ns.push_back(write_stamps_ns_[slot].load(std::memory_order_relaxed));
+    const std::atomic<double> * row = &values_[slot * number_of_columns_];
+    for (std::size_t i = 0; i < number_of_columns_; ++i)
+    {
+      recording.columns[i].push_back(row[i].load(std::memory_order_relaxed));
+    }
+  }
+
+  // remove the cycles whose slot was overwritten while they were copied
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const uint64_t head_after_copy = head_.load(std::memory_order_relaxed);
+  const uint64_t valid_cycle = head_after_copy >= capacity_ ? head_after_copy - capacity_ + 1 : 0;
+  if (valid_cycle > begin)
+  {
+    const auto overwritten = static_cast<std::ptrdiff_t>(std::min(valid_cycle, head) - begin);
+    auto erase_front = [offset, overwritten](auto & values)
+    {
+      const auto first = values.begin() + static_cast<std::ptrdiff_t>(offset);
+      values.erase(first, first + overwritten);
+    };
+    erase_front(recording.cycles);
+    erase_front(recording.read_stamps_ns);
+    erase_front(recording.write_stamps_ns);
+    for (auto & column : recording.columns)
+    {
+      erase_front(column);
+    }
+    skipped_cycles += static_cast<uint64_t>(overwritten);
+  }
+  return head;
+}
+
+std::size_t InterfaceFlightRecorder::drain(FlightRecording & recording)
+{
+  const std::size_t size_before = recording.size();
+  uint64_t skipped_cycles = 0;
+  drain_cycle_ = copy_rows(drain_cycle_, recording, skipped_cycles);
+  dropped_cycles_.fetch_add(skipped_cycles, std::memory_order_relaxed);
+  return recording.size() - size_before;
+}
+
+FlightRecording InterfaceFlightRecorder::make_recording() const
+{
+  FlightRecording recording;
+  recording.interface_names = interface_names_;
+  recording.data_types = data_types_;
+  recording.number_of_state_interfaces = state_interfaces_.size();
+  recording.columns.resize(number_of_columns_);
+  return recording;
+}
+
+FlightRecording InterfaceFlightRecorder::snapshot() const
+{
+  FlightRecording recording = make_recording();
+  uint64_t skipped_cycles = 0;
+  copy_rows(0, recording, skipped_cycles);
+  return recording;
+}
+
+void InterfaceFlightRecorder::write_dump()
+{
+  const std::string file_name = dump_file_prefix_ + "_" +
+                                std::to_string(number_of_dumps_.load(std::memory_order_relaxed)) +
+                                ".bin";
+  const FlightRecording recording = snapshot();
+  std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+  recording.write_header(file);
+  recording.write_block(file);
+  file.close();
+  if (!file)
+  {
+    RCLCPP_ERROR(*logger_, "Unable to write the flight recorder dump '%s'.", file_name.c_str());
+    return;
+  }
+  number_of_dumps_.fetch_add(1, std::memory_order_relaxed);
+  RCLCPP_WARN(
+    *logger_, "Dumped the last %zu cycles of the flight recorder to '%s'.", recording.size(),
+    file_name.c_str());
+}
+
+void InterfaceFlightRecorder::write_files()
+{
+  FlightRecording recording = make_recording();
+  bool stopping = false;
+  while (!stopping)
+  {
+    {
+      std::unique_lock<std::mutex> lock(writer_mutex_);
+      stopping = writer_cv_.wait_for(lock, WRITE_PERIOD, [this]() { return stop_writer_; });
+    }
+    if (output_)
+    {
+      recording.clear_cycles();
+      if (drain(recording) > 0)
+      {
+        recording.write_block(*output_);
+        output_->flush();
+        if (!*output_)
+        {
+          RCLCPP_ERROR(*logger_, "Unable to write the flight recording, stopping the output.");
+          output_.reset();
+        }
+      }
+    }
+    if (dump_requested_.exchange(false, std::memory_order_relaxed) && !dump_file_prefix_.empty())
+    {
+      write_dump();
+    }
+  }
+}
+
+}  // namespace hardware_interface
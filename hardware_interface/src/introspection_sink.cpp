@@ -0,0 +1,563 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "hardware_interface/introspection_sink.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr char MAGIC[8] = {'R', 'C', '2', 'C', 'I', 'N', 'S', '1'};
+constexpr uint32_t VERSION = 1;
+constexpr uint8_t SCHEMA_RECORD = 1;
+constexpr uint8_t SAMPLES_RECORD = 2;
+/// Longest variable name accepted when loading a recording
+constexpr uint32_t MAX_NAME_LENGTH = 4096;
+
+struct SinkVariable
+{
+  uint64_t id = 0;
+  std::string name;
+  const void * variable = nullptr;
+  hardware_interface::IntrospectionSink::ReadFunction read = nullptr;
+  std::function<double()> function;
+  bool enabled = false;
+  /// False if the name matches one of the excluded prefixes
+  bool selected = true;
+
+  bool is_sampled() const { return enabled && selected; }
+};
+
+/// Ring buffer of the samples, one row of values per sample
+struct SampleRing
+{
+  std::size_t capacity = 0;
+  std::size_t width = 0;
+  std::unique_ptr<int64_t[]> stamps_ns;
+  std::unique_ptr<uint32_t[]> schema_versions;
+  std::unique_ptr<uint32_t[]> counts;
+  std::unique_ptr<double[]> values;
+  /// Written by the sampling thread only
+  alignas(64) std::atomic<uint64_t> head{0};
+  /// Written by the draining thread only
+  alignas(64) std::atomic<uint64_t> tail{0};
+};
+
+std::atomic<bool> sampling_enabled{false};
+std::mutex enable_mutex;
+/// Allocated once and never released, published by sampling_enabled
+std::unique_ptr<SampleRing> ring;
+std::atomic<uint64_t> dropped_samples{0};
+
+std::mutex registry_mutex;
+std::vector<std::unique_ptr<SinkVariable>> variables;
+uint64_t next_id = 1;
+uint32_t schema_version = 0;
+std::vector<std::string> excluded_prefixes;
+/// Enabled and selected variables, in the order of their registration
+std::vector<const SinkVariable *> sampled_variables;
+/// Schema of the last sample
+uint32_t last_sampled_schema_version = 0;
+/// Names of the previous schemas that may still be in the ring buffer
+std::map<uint32_t, std::vector<std::string>> schema_names;
+
+/// Returns the names of the variables sampled in the current schema, registry_mutex must be locked
+std::vector<std::string> get_sampled_names()
+{
+  std::vector<std::string> names;
+  const std::size_t count = std::min(sampled_variables.size(), ring ? ring->width : 0);
+  names.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    names.push_back(sampled_variables[i]->name);
+  }
+  return names;
+}
+
+/// Returns true if the name doesn't start with an excluded prefix, registry_mutex must be locked
+bool is_selected(const std::string & name)
+{
+  return std::none_of(
+    excluded_prefixes.begin(), excluded_prefixes.end(),
+    [&name](const std::string & prefix) { return name.compare(0, prefix.size(), prefix) == 0; });
+}
+
+/// Starts a new schema, registry_mutex must be locked
+/**
+ * The names of the current schema are only kept if it was sampled, so that registering many
+ * variables at once doesn't copy the names for every variable.
+ *
+ * \param[in] appended_variable sampled variable appended to the sampled variables, or nullptr
+ * to rebuild the sampled variables from all the registered ones.
+ */
+void update_schema(const SinkVariable * appended_variable)
+{
+  if (ring && last_sampled_schema_version == schema_version)
+  {
+    schema_names[schema_version] = get_sampled_names();
+  }
+  if (appended_variable)
+  {
+    sampled_variables.push_back(appended_variable);
+  }
+  else
+  {
+    sampled_variables.clear();
+    for (const auto & variable : variables)
+    {
+      if (variable->is_sampled())
+      {
+        sampled_variables.push_back(variable.get());
+      }
+    }
+  }
+  ++schema_version;
+}
+
+template <typename T>
+void write_value(std::ostream & os, const T & value)
+{
+  os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_value(std::istream & is, T & value)
+{
+  return static_cast<bool>(is.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+}  // namespace
+
+namespace hardware_interface
+{
+void IntrospectionRecording::write_file_header(std::ostream & os)
+{
+  os.write(MAGIC, sizeof(MAGIC));
+  write_value(os, VERSION);
+}
+
+void IntrospectionRecording::write_segments(
+  std::ostream & os, uint32_t & written_schema_version) const
+{
+  for (const auto & segment : segments)
+  {
+    if (segment.schema_version != written_schema_version)
+    {
+      write_value(os, SCHEMA_RECORD);
+      write_value(os, segment.schema_version);
+      write_value(os, static_cast<uint32_t>(segment.names.size()));
+      for (const auto & name : segment.names)
+      {
+        write_value(os, static_cast<uint32_t>(name.size()));
+        os.write(name.data(), static_cast<std::streamsize>(name.size()));
+      }
+      written_schema_version = segment.schema_version;
+    }
+    const std::size_t width = segment.names.size();
+    write_value(os, SAMPLES_RECORD);
+    write_value(os, static_cast<uint32_t>(segment.size()));
+    write_value(os, static_cast<uint32_t>(width));
+    for (std::size_t row = 0; row < segment.size(); ++row)
+    {
+      write_value(os, segment.stamps_ns[row]);
+      os.write(
+        reinterpret_cast<const char *>(segment.values.data() + row * width),
+        static_cast<std::streamsize>(width * sizeof(double)));
+    }
+  }
+}
+
+IntrospectionRecording IntrospectionRecording::load(const std::string & file_name)
+{
+  std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+  if (!file)
+  {
+    throw std::runtime_error("Unable to open the introspection recording '" + file_name + "'.");
+  }
+  const auto file_size = static_cast<uint64_t>(file.tellg());
+  file.seekg(0);
+  auto invalid = [&file_name](const std::string & reason)
+  { return std::runtime_error("Invalid introspection recording '" + file_name + "': " + reason); };
+
+  char magic[sizeof(MAGIC)];
+  uint32_t version = 0;
+  if (
+    !file.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+    !read_value(file, version) || version != VERSION)
+  {
+    throw invalid("unknown header");
+  }
+
+  IntrospectionRecording recording;
+  bool has_schema = false;
+  uint32_t current_schema_version = 0;
+  std::vector<std::string> current_names;
+  uint8_t record_type = 0;
+  while (read_value(file, record_type))
+  {
+    if (record_type == SCHEMA_RECORD)
+    {
+      uint32_t number_of_names = 0;
+      if (!read_value(file, current_schema_version) || !read_value(file, number_of_names))
+      {
+        throw invalid("truncated schema");
+      }
+      current_names.clear();
+      for (uint32_t i = 0; i < number_of_names; ++i)
+      {
+        uint32_t name_length = 0;
+        if (!read_value(file, name_length) || name_length > MAX_NAME_LENGTH)
+        {
+          throw invalid("truncated schema");
+        }
+        std::string name(name_length, '\0');
+        if (!file.read(name.data(), name_length))
+        {
+          throw invalid("truncated schema");
+        }
+        current_names.push_back(std::move(name));
+      }
+      has_schema = true;
+    }
+    else if (record_type == SAMPLES_RECORD)
+    {
+      uint32_t number_of_samples = 0;
+      uint32_t width = 0;
+      if (
+        !has_schema || !read_value(file, number_of_samples) || !read_value(file, width) ||
+        width != current_names.size())
+      {
+        throw invalid("samples without matching schema");
+      }
+      // checked before allocating the memory of the samples
+      const uint64_t bytes_per_sample = sizeof(int64_t) + uint64_t{width} * sizeof(double);
+      const auto remaining_bytes = file_size - static_cast<uint64_t>(file.tellg());
+      if (number_of_samples > remaining_bytes / bytes_per_sample)
+      {
+        throw invalid("truncated samples");
+      }
+      if (
+        recording.segments.empty() ||
+        recording.segments.back().schema_version != current_schema_version)
+      {
+        recording.segments.emplace_back();
+        recording.segments.back().schema_version = current_schema_version;
+        recording.segments.back().names = current_names;
+      }
+      auto & segment = recording.segments.back();
+      for (uint32_t i = 0; i < number_of_samples; ++i)
+      {
+        int64_t stamp_ns = 0;
+        const std::size_t offset = segment.values.size();
+        segment.values.resize(offset + width);
+        if (
+          !read_value(file, stamp_ns) ||
+          !file.read(
+            reinterpret_cast<char *>(segment.values.data() + offset),
+            static_cast<std::streamsize>(width * sizeof(double))))
+        {
+          throw invalid("truncated samples");
+        }
+        segment.stamps_ns.push_back(stamp_ns);
+      }
+    }
+    else
+    {
+      throw invalid("unknown record");
+    }
+  }
+  return recording;
+}
+
+void IntrospectionSink::enable(std::size_t capacity, std::size_t max_variables)
+{
+  std::lock_guard<std::mutex> lock(enable_mutex);
+  if (!ring)
+  {
+    auto new_ring = std::make_unique<SampleRing>();
+    new_ring->capacity = std::max<std::size_t>(capacity, 1);
+    new_ring->width = max_variables;
+    new_ring->stamps_ns = std::make_unique<int64_t[]>(new_ring->capacity);
+    new_ring->schema_versions = std::make_unique<uint32_t[]>(new_ring->capacity);
+    new_ring->counts = std::make_unique<uint32_t[]>(new_ring->capacity);
+    new_ring->values = std::make_unique<double[]>(new_ring->capacity * new_ring->width);
+    std::lock_guard<std::mutex> registry_lock(registry_mutex);
+    ring = std::move(new_ring);
+    update_schema(nullptr);
+  }
+  sampling_enabled.store(true, std::memory_order_release);
+}
+
+void IntrospectionSink::disable() noexcept
+{
+  sampling_enabled.store(false, std::memory_order_release);
+}
+
+bool IntrospectionSink::is_enabled() noexcept
+{
+  return sampling_enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t IntrospectionSink::register_reader(
+  const std::string & name, const void * variable, ReadFunction read,
+  const std::function<double()> & function, IntrospectionSinkRegistrations * registrations,
+  bool enabled)
+{
+  auto sink_variable = std::make_unique<SinkVariable>();
+  sink_variable->name = name;
+  sink_variable->variable = variable;
+  sink_variable->read = read;
+  sink_variable->function = function;
+  sink_variable->enabled = enabled;
+  uint64_t id = 0;
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    id = next_id++;
+    sink_variable->id = id;
+    sink_variable->selected = is_selected(name);
+    const SinkVariable * registered_variable = sink_variable.get();
+    variables.push_back(std::move(sink_variable));
+    if (registered_variable->is_sampled())
+    {
+      update_schema(registered_variable);
+    }
+  }
+  if (registrations)
+  {
+    registrations->add(id);
+  }
+  return id;
+}
+
+void IntrospectionSink::unregister_entity(const std::string & name)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  const auto removed = std::remove_if(
+    variables.begin(), variables.end(),
+    [&name](const std::unique_ptr<SinkVariable> & variable) { return variable->name == name; });
+  const bool schema_changed = std::any_of(
+    removed, variables.end(),
+    [](const std::unique_ptr<SinkVariable> & variable) { return variable->is_sampled(); });
+  // the sampled variables are updated before the removed variables are released
+  std::vector<std::unique_ptr<SinkVariable>> removed_variables(
+    std::make_move_iterator(removed), std::make_move_iterator(variables.end()));
+  variables.erase(removed, variables.end());
+  if (schema_changed)
+  {
+    update_schema(nullptr);
+  }
+}
+
+void IntrospectionSink::unregister_id(uint64_t id)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  const auto it = std::find_if(
+    variables.begin(), variables.end(),
+    [id](const std::unique_ptr<SinkVariable> & variable) { return variable->id == id; });
+  if (it == variables.end())
+  {
+    return;
+  }
+  const std::unique_ptr<SinkVariable> removed_variable = std::move(*it);
+  variables.erase(it);
+  if (removed_variable->is_sampled())
+  {
+    update_schema(nullptr);
+  }
+}
+
+void IntrospectionSink::set_enabled(uint64_t id, bool enabled)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  const auto it = std::find_if(
+    variables.begin(), variables.end(),
+    [id](const std::unique_ptr<SinkVariable> & variable) { return variable->id == id; });
+  if (it != variables.end() && (*it)->enabled != enabled)
+  {
+    (*it)->enabled = enabled;
+    if ((*it)->selected)
+    {
+      update_schema(nullptr);
+    }
+  }
+}
+
+void IntrospectionSink::set_excluded_prefixes(const std::vector<std::string> & prefixes)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  excluded_prefixes = prefixes;
+  bool schema_changed = false;
+  for (const auto & variable : variables)
+  {
+    const bool selected = is_selected(variable->name);
+    if (variable->selected != selected)
+    {
+      variable->selected = selected;
+      schema_changed = schema_changed || variable->enabled;
+    }
+  }
+  if (schema_changed)
+  {
+    update_schema(nullptr);
+  }
+}
+
+std::size_t IntrospectionSink::get_number_of_variables()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  return variables.size();
+}
+
+std::size_t IntrospectionSink::get_number_of_sampled_variables()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  return ring ? std::min(sampled_variables.size(), ring->width) : sampled_variables.size();
+}
+
+void IntrospectionSink::sample(int64_t stamp_ns) noexcept
+{
+  if (!sampling_enabled.load(std::memory_order_acquire))
+  {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(registry_mutex, std::try_to_lock);
+  if (!lock.owns_lock())
+  {
+    dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  SampleRing & samples = *ring;
+  const uint64_t head = samples.head.load(std::memory_order_relaxed);
+  if (head - samples.tail.load(std::memory_order_acquire) >= samples.capacity)
+  {
+    dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  const std::size_t slot = static_cast<std::size_t>(head % samples.capacity);
+  const std::size_t count = std::min(sampled_variables.size(), samples.width);
+  double * row = &samples.values[slot * samples.width];
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const SinkVariable & variable = *sampled_variables[i];
+    try
+    {
+      row[i] = variable.read ? variable.read(variable.variable) : variable.function();
+    }
+    catch (...)
+    {
+      row[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+  samples.stamps_ns[slot] = stamp_ns;
+  samples.schema_versions[slot] = schema_version;
+  last_sampled_schema_version = schema_version;
+  samples.counts[slot] = static_cast<uint32_t>(count);
+  samples.head.store(head + 1, std::memory_order_release);
+}
+
+std::size_t IntrospectionSink::drain(IntrospectionRecording & recording)
+{
+  SampleRing * samples = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(enable_mutex);
+    samples = ring.get();
+  }
+  if (!samples)
+  {
+    return 0;
+  }
+  const uint64_t head = samples->head.load(std::memory_order_acquire);
+  const uint64_t tail = samples->tail.load(std::memory_order_relaxed);
+  if (head == tail)
+  {
+    return 0;
+  }
+
+  // the names of the schemas of the samples, copied once per drain
+  std::map<uint32_t, std::vector<std::string>> names;
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (uint64_t i = tail; i < head; ++i)
+    {
+      const uint32_t version = samples->schema_versions[i % samples->capacity];
+      if (names.count(version) == 0)
+      {
+        names[version] = version == schema_version ? get_sampled_names() : schema_names[version];
+      }
+    }
+    // the following samples only use the schema of the last sample or newer ones
+    const uint32_t last_version = samples->schema_versions[(head - 1) % samples->capacity];
+    schema_names.erase(schema_names.begin(), schema_names.lower_bound(last_version));
+  }
+
+  for (uint64_t i = tail; i < head; ++i)
+  {
+    const std::size_t slot = static_cast<std::size_t>(i % samples->capacity);
+    const uint32_t version = samples->schema_versions[slot];
+    if (recording.segments.empty() || recording.segments.back().schema_version != version)
+    {
+      recording.segments.emplace_back();
+      recording.segments.back().schema_version = version;
+      recording.segments.back().names = names[version];
+    }
+    auto & segment = recording.segments.back();
+    const double * row = &samples->values[slot * samples->width];
+    segment.stamps_ns.push_back(samples->stamps_ns[slot]);
+    segment.values.insert(segment.values.end(), row, row + samples->counts[slot]);
+  }
+  samples->tail.store(head, std::memory_order_release);
+  return static_cast<std::size_t>(head - tail);
+}
+
+uint64_t IntrospectionSink::get_dropped_samples() noexcept
+{
+  return dropped_samples.load(std::memory_order_relaxed);
+}
+
+IntrospectionSinkRegistrations::~IntrospectionSinkRegistrations()
+{
+  for (const auto id : ids_)
+  {
+    IntrospectionSink::unregister_id(id);
+  }
+}
+
+void IntrospectionSinkRegistrations::enable_all()
+{
+  for (const auto id : ids_)
+  {
+    IntrospectionSink::set_enabled(id, true);
+  }
+}
+
+void IntrospectionSinkRegistrations::disable_all()
+{
+  for (const auto id : ids_)
+  {
+    IntrospectionSink::set_enabled(id, false);
+  }
+}
+
+}  // namespace hardware_interface
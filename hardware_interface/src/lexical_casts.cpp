@@ -21,6 +21,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "hardware_interface/lexical_casts.hpp"
@@ -30,8 +31,10 @@ namespace hardware_interface
 namespace impl
 {
 template <typename FloatingPointType>
-std::optional<FloatingPointType> parse_floating_point_with_from_chars(const std::string & s)
+std::optional<FloatingPointType> parse_floating_point(std::string_view s)
 {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  // Impl with std::from_chars, locale-independent and without any allocation
   const char * begin = s.data();
   const char * end = s.data() + s.size();
 
@@ -60,53 +63,60 @@ std::optional<FloatingPointType> parse_floating_point_with_from_chars(const std:
   }
 
   return std::nullopt;
-}
-
-std::optional<double> stod(const std::string & s)
-{
-#if __cplusplus < 202002L || defined(__APPLE__)
-  // convert from string using no locale
+#else
+  // convert from string using no locale, for the standard libraries without floating-point
+  // std::from_chars
   // Impl with std::istringstream
-  std::istringstream stream(s);
+  std::istringstream stream{std::string(s)};
   stream.imbue(std::locale::classic());
-  double result;
+  FloatingPointType result;
   stream >> result;
   if (stream.fail() || !stream.eof() || !std::isfinite(result))
   {
     return std::nullopt;
   }
   return result;
-#else
-  // Impl with std::from_chars
-  return parse_floating_point_with_from_chars<double>(s);
 #endif
 }
 
-std::optional<float> stof(const std::string & s)
+bool is_space(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+std::string_view strip_spaces(std::string_view s)
 {
-#if __cplusplus < 202002L || defined(__APPLE__)
-  // convert from string using no locale
-  // Impl with std::istringstream
-  std::istringstream stream(s);
-  stream.imbue(std::locale::classic());
-  float result;
-  stream >> result;
-  if (stream.fail() || !stream.eof() || !std::isfinite(result))
+  while (!s.empty() && is_space(s.front()))
   {
-    return std::nullopt;
+    s.remove_prefix(1);
   }
-  return result;
-#else
-  // Impl with std::from_chars
-  return parse_floating_point_with_from_chars<float>(s);
-#endif
+  while (!s.empty() && is_space(s.back()))
+  {
+    s.remove_suffix(1);
+  }
+  return s;
 }
 
+bool equals_ignoring_case(std::string_view s, std::string_view lower_case)
+{
+  return s.size() == lower_case.size() &&
+         std::equal(
+           s.begin(), s.end(), lower_case.begin(),
+           [](char c, char lower_c)
+           { return std::tolower(static_cast<unsigned char>(c)) == lower_c; });
+}
 }  // namespace impl
 
+std::optional<double> try_stod(std::string_view s)
+{
+  return impl::parse_floating_point<double>(s);
+}
+
+std::optional<float> try_stof(std::string_view s)
+{
+  return impl::parse_floating_point<float>(s);
+}
+
 double stod(const std::string & s)
 {
-  if (const auto result = impl::stod(s))
+  if (const auto result = try_stod(s))
   {
     return *result;
   }
@@ -115,7 +125,7 @@ double stod(const std::string & s)
 
 float stof(const std::string & s)
 {
-  if (const auto result = impl::stof(s))
+  if (const auto result = try_stof(s))
   {
     return *result;
   }
@@ -133,14 +143,12 @@ std::string to_lower_case(const std::string & string)
 
 bool parse_bool(const std::string & bool_string)
 {
-  // Copy input to temp and make lowercase
-  std::string temp = to_lower_case(bool_string);
-
-  if (temp == "true")
+  // compared without making a lower case copy of the input
+  if (impl::equals_ignoring_case(bool_string, "true"))
   {
     return true;
   }
-  if (temp == "false")
+  if (impl::equals_ignoring_case(bool_string, "false"))
   {
     return false;
   }
@@ -150,6 +158,45 @@ bool parse_bool(const std::string & bool_string)
     "' is not a valid boolean value. Expected 'true' or 'false'.");
 }
 
+std::vector<std::string_view> split_array(std::string_view array_string)
+{
+  // flat array: starts with [, ends with ], no nested brackets
+  if (
+    array_string.size() < 2 || array_string.front() != '[' || array_string.back() != ']' ||
+    array_string.substr(1, array_string.size() - 2).find_first_of("[]") != std::string_view::npos)
+  {
+    throw std::invalid_argument(
+      "String must be a flat array: starts with '[' and ends with ']', no nested arrays");
+  }
+
+  std::vector<std::string_view> values;
+  std::string_view content = impl::strip_spaces(array_string.substr(1, array_string.size() - 2));
+  if (content.empty())
+  {
+    return values;  // Return empty array if input is "[]" or contains only spaces
+  }
+
+  // comma-separated values, without empty values like in "[,]" "[a,b,,c]" and without spaces
+  // inside of the values
+  while (true)
+  {
+    const auto comma = content.find(',');
+    const std::string_view value = impl::strip_spaces(content.substr(0, comma));
+    if (value.empty() || std::any_of(value.begin(), value.end(), impl::is_space))
+    {
+      throw std::invalid_argument(
+        "String must be a flat array with comma-separated values and no spaces between them");
+    }
+    values.push_back(value);
+    if (comma == std::string_view::npos)
+    {
+      break;
+    }
+    content.remove_prefix(comma + 1);
+  }
+  return values;
+}
+
 std::vector<std::string> parse_string_array(const std::string & string_array_string)
 {
   return parse_array<std::string>(string_array_string);
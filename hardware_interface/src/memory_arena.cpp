@@ -0,0 +1,174 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/memory_arena.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+/// Blocks of a chunk of the pool, small chunks waste less of the buffer for rarely used sizes
+constexpr std::size_t kMaxBlocksPerChunk = 32;
+
+std::size_t get_page_size() noexcept
+{
+#if defined(__linux__)
+  const long page_size = sysconf(_SC_PAGESIZE);
+  if (page_size > 0)
+  {
+    return static_cast<std::size_t>(page_size);
+  }
+#endif
+  return 4096;
+}
+}  // namespace
+
+namespace hardware_interface
+{
+MemoryArena::Buffer::Buffer(std::size_t requested_capacity)
+{
+  const std::size_t page_size = get_page_size();
+  capacity = (requested_capacity + page_size - 1) / page_size * page_size;
+  if (capacity == 0)
+  {
+    return;
+  }
+#if defined(__linux__)
+  void * mapping =
+    mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED)
+  {
+    throw std::runtime_error(
+      "Failed to map the " + std::to_string(capacity) + " bytes of the memory arena");
+  }
+  data = static_cast<unsigned char *>(mapping);
+#else
+  data = static_cast<unsigned char *>(std::malloc(capacity));
+  if (data == nullptr)
+  {
+    throw std::runtime_error(
+      "Failed to allocate the " + std::to_string(capacity) + " bytes of the memory arena");
+  }
+#endif
+  // write every page, so that none of them faults when it is first used
+  std::memset(data, 0, capacity);
+#if defined(__linux__)
+  locked = mlock(data, capacity) == 0;
+#endif
+}
+
+MemoryArena::Buffer::~Buffer()
+{
+  if (data == nullptr)
+  {
+    return;
+  }
+#if defined(__linux__)
+  munmap(data, capacity);
+#else
+  std::free(data);
+#endif
+}
+
+void * MemoryArena::Buffer::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  const auto address = reinterpret_cast<std::uintptr_t>(data) + offset;
+  const std::size_t padding = (alignment - address % alignment) % alignment;
+  if (data != nullptr && padding + bytes <= capacity - offset)
+  {
+    offset += padding + bytes;
+    if (offset > used_bytes.load(std::memory_order_relaxed))
+    {
+      used_bytes.store(offset, std::memory_order_relaxed);
+    }
+    return data + offset - bytes;
+  }
+  overflow_bytes.fetch_add(bytes, std::memory_order_relaxed);
+  return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void MemoryArena::Buffer::do_deallocate(void * p, std::size_t bytes, std::size_t alignment)
+{
+  if (!contains(p))
+  {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    return;
+  }
+  // only the last block can be given back, the others are reused by the pool
+  if (static_cast<unsigned char *>(p) + bytes == data + offset)
+  {
+    offset -= bytes;
+  }
+}
+
+bool MemoryArena::Buffer::do_is_equal(const std::pmr::memory_resource & other) const noexcept
+{
+  return this == &other;
+}
+
+bool MemoryArena::Buffer::contains(const void * p) const noexcept
+{
+  const auto * byte = static_cast<const unsigned char *>(p);
+  return data != nullptr && byte >= data && byte < data + capacity;
+}
+
+MemoryArena::MemoryArena(std::size_t capacity)
+: buffer_(capacity), pool_(std::pmr::pool_options{kMaxBlocksPerChunk, 0}, &buffer_)
+{
+}
+
+MemoryArena::~MemoryArena() = default;
+
+void * MemoryArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  void * p = nullptr;
+  {
+    std::lock_guard<std::mutex> guard(pool_mutex_);
+    p = pool_.allocate(bytes, alignment);
+  }
+  const std::size_t allocated =
+    allocated_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  std::size_t high_water_mark = high_water_mark_.load(std::memory_order_relaxed);
+  while (allocated > high_water_mark &&
+         !high_water_mark_.compare_exchange_weak(
+           high_water_mark, allocated, std::memory_order_relaxed))
+  {
+  }
+  return p;
+}
+
+void MemoryArena::do_deallocate(void * p, std::size_t bytes, std::size_t alignment)
+{
+  {
+    std::lock_guard<std::mutex> guard(pool_mutex_);
+    pool_.deallocate(p, bytes, alignment);
+  }
+  allocated_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool MemoryArena::do_is_equal(const std::pmr::memory_resource & other) const noexcept
+{
+  return this == &other;
+}
+
+}  // namespace hardware_interface
@@ -18,10 +18,14 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <limits>
+#include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "hardware_interface/lexical_casts.hpp"
@@ -30,6 +34,22 @@
 
 namespace mock_components
 {
+namespace
+{
+/// Keeps the CPU busy for the given duration, to emulate the computations of a driver.
+void spin_for(const std::chrono::nanoseconds & duration)
+{
+  if (duration.count() <= 0)
+  {
+    return;
+  }
+  const auto end = std::chrono::steady_clock::now() + duration;
+  while (std::chrono::steady_clock::now() < end)
+  {
+  }
+}
+}  // namespace
+
 
 CallbackReturn GenericSystem::on_init(
   const hardware_interface::HardwareComponentInterfaceParams & params)
@@ -73,6 +93,20 @@ CallbackReturn GenericSystem::on_init(
     command_propagation_disabled_ = false;
   }
 
+  // check if there are parameters that add a synthetic CPU load to read and write
+  auto parse_cpu_load = [this](const std::string & name)
+  {
+    const auto param_it = get_hardware_info().hardware_parameters.find(name);
+    if (param_it == get_hardware_info().hardware_parameters.end())
+    {
+      return std::chrono::nanoseconds(0);
+    }
+    return std::chrono::nanoseconds(
+      static_cast<int64_t>(hardware_interface::stod(param_it->second) * 1e3));
+  };
+  read_cpu_load_ = parse_cpu_load("read_cpu_load_us");
+  write_cpu_load_ = parse_cpu_load("write_cpu_load_us");
+
   // check if there is parameter that enables dynamic calculation
   it = get_hardware_info().hardware_parameters.find("calculate_dynamics");
   if (it != get_hardware_info().hardware_parameters.end())
@@ -83,6 +117,46 @@ CallbackReturn GenericSystem::on_init(
   {
     calculate_dynamics_ = false;
   }
+
+  // check if the joints are integrated by a dynamics model
+  use_joint_dynamics_ = false;
+  it = get_hardware_info().hardware_parameters.find("dynamics_model");
+  if (calculate_dynamics_ && it != get_hardware_info().hardware_parameters.end())
+  {
+    const auto & parameters = get_hardware_info().hardware_parameters;
+    auto get_parameter = [&parameters](const std::string & name, double default_value)
+    {
+      const auto param_it = parameters.find(name);
+      return param_it != parameters.end() ? hardware_interface::stod(param_it->second)
+                                          : default_value;
+    };
+    try
+    {
+      JointDynamics::Parameters dynamics_parameters;
+      dynamics_parameters.model = JointDynamics::parse_model(it->second);
+      dynamics_parameters.time_constant =
+        get_parameter("dynamics_time_constant", dynamics_parameters.time_constant);
+      dynamics_parameters.natural_frequency =
+        get_parameter("dynamics_natural_frequency", dynamics_parameters.natural_frequency);
+      dynamics_parameters.damping_ratio =
+        get_parameter("dynamics_damping_ratio", dynamics_parameters.damping_ratio);
+      const double delay_cycles = get_parameter("command_delay_cycles", 0.0);
+      if (delay_cycles < 0.0)
+      {
+        throw std::invalid_argument("The command delay can not be negative.");
+      }
+      dynamics_parameters.command_delay_cycles = static_cast<size_t>(delay_cycles);
+      joint_dynamics_.configure(get_hardware_info().joints.size(), dynamics_parameters);
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(get_logger(), "Invalid parameters of the dynamics model: %s", e.what());
+      return CallbackReturn::ERROR;
+    }
+    joint_dynamics_commands_.resize(
+      get_hardware_info().joints.size(), std::numeric_limits<double>::quiet_NaN());
+    use_joint_dynamics_ = true;
+  }
   // do loopback on all other interfaces - starts from 1 or 3 because 0, 1, 2 are position,
   // velocity, and acceleration interface
   // Create a subvector of standard_interfaces_ with the given indices
@@ -306,7 +380,7 @@ hardware_interface::CallbackReturn GenericSystem::on_configure(
   for (const auto & joint_state : joint_state_interfaces_)
   {
     const std::string & name = joint_state.second.get_name();
-    if (joint_state.second.get_data_type() == hardware_interface::HandleDataType::DOUBLE)
+    if (joint_state.second.is_double_readable())
     {
       // if initial values are set not set from the URDF
       if (std::isnan(get_state(name)))
@@ -325,31 +399,52 @@ hardware_interface::CallbackReturn GenericSystem::on_configure(
   // Set position control mode per default
   // This will be populated by perform_command_mode_switch
   joint_control_mode_.resize(get_hardware_info().joints.size(), POSITION_INTERFACE_INDEX);
+  precompute_read_handles();
+  if (use_joint_dynamics_)
+  {
+    // the dynamics model starts from the initial states
+    for (size_t j = 0; j < joint_handles_.size(); ++j)
+    {
+      std::array<double, 3> values = {{0.0, 0.0, 0.0}};
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        if (joint_handles_[j].states[i])
+        {
+          std::ignore = get_state(joint_handles_[j].states[i], values[i], true);
+        }
+      }
+      joint_dynamics_.reset(
+        j, values[POSITION_INTERFACE_INDEX], values[VELOCITY_INTERFACE_INDEX],
+        values[ACCELERATION_INTERFACE_INDEX]);
+    }
+  }
   return hardware_interface::CallbackReturn::SUCCESS;
 }
 
 return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Duration & period)
 {
+  spin_for(read_cpu_load_);
   if (command_propagation_disabled_)
   {
     RCLCPP_WARN(get_logger(), "Command propagation is disabled - no values will be returned!");
     return return_type::OK;
   }
 
-  auto mirror_command_to_state = [this](const auto & name, const auto & data_type) -> return_type
+  auto mirror_command_to_state = [this](const LoopbackHandles & loopback) -> return_type
   {
-    switch (data_type)
+    switch (loopback.data_type)
     {
       case hardware_interface::HandleDataType::DOUBLE:
       {
-        auto cmd = get_command(name);
+        double cmd;
+        std::ignore = get_command(loopback.command, cmd, true);
         if (std::isinf(cmd))
         {
           return return_type::ERROR;
         }
         else if (std::isfinite(cmd))
         {
-          set_state(name, cmd);
+          std::ignore = set_state(loopback.state, cmd, true);
         }
         else
         {
@@ -359,7 +454,9 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
       }
       case hardware_interface::HandleDataType::BOOL:
       {
-        set_state(name, get_command<bool>(name));
+        bool cmd;
+        std::ignore = get_command(loopback.command, cmd, true);
+        std::ignore = set_state(loopback.state, cmd, true);
         break;
       }
       default:
@@ -370,8 +467,17 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
     return return_type::OK;
   };
 
-  for (size_t j = 0; j < get_hardware_info().joints.size(); ++j)
+  const double position_offset =
+    custom_interface_with_following_offset_.empty() ? position_state_following_offset_ : 0.0;
+
+  if (use_joint_dynamics_)
+  {
+    update_joint_dynamics(period.seconds());
+  }
+  // the joints integrated by the dynamics model are skipped
+  for (size_t j = 0; !use_joint_dynamics_ && j < joint_handles_.size(); ++j)
   {
+    const auto & handles = joint_handles_[j];
     if (calculate_dynamics_)
     {
       std::array<double, 3> joint_state_values_ = {
@@ -380,17 +486,15 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
       std::array<double, 3> joint_command_values_ = {
         {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(),
          std::numeric_limits<double>::quiet_NaN()}};
-      const auto & joint_name = get_hardware_info().joints[j].name;
       for (size_t i = 0; i < 3; ++i)
       {
-        const auto full_name = joint_name + "/" + standard_interfaces_[i];
-        if (has_command(full_name))
+        if (handles.commands[i])
         {
-          joint_command_values_[i] = get_command(full_name);
+          std::ignore = get_command(handles.commands[i], joint_command_values_[i], true);
         }
-        if (has_state(full_name))
+        if (handles.states[i])
         {
-          joint_state_values_[i] = get_state(full_name);
+          std::ignore = get_state(handles.states[i], joint_state_values_[i], true);
         }
       }
 
@@ -416,9 +520,7 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
           joint_state_values_[POSITION_INTERFACE_INDEX] +=  // apply offset to positions only
             std::isfinite(joint_state_values_[VELOCITY_INTERFACE_INDEX])
               ? joint_state_values_[VELOCITY_INTERFACE_INDEX] * period.seconds()
-              : 0.0 + (custom_interface_with_following_offset_.empty()
-                         ? position_state_following_offset_
-                         : 0.0);
+              : 0.0 + position_offset;
           break;
         }
         case VELOCITY_INTERFACE_INDEX:
@@ -438,9 +540,7 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
           joint_state_values_[POSITION_INTERFACE_INDEX] +=  // apply offset to positions only
             std::isfinite(joint_state_values_[VELOCITY_INTERFACE_INDEX])
               ? joint_state_values_[VELOCITY_INTERFACE_INDEX] * period.seconds()
-              : 0.0 + (custom_interface_with_following_offset_.empty()
-                         ? position_state_following_offset_
-                         : 0.0);
+              : 0.0 + position_offset;
           break;
         }
         case POSITION_INTERFACE_INDEX:
@@ -453,9 +553,7 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
                                           : 0.0;
 
             joint_state_values_[POSITION_INTERFACE_INDEX] =  // apply offset to positions only
-              joint_command_values_[POSITION_INTERFACE_INDEX] +
-              (custom_interface_with_following_offset_.empty() ? position_state_following_offset_
-                                                               : 0.0);
+              joint_command_values_[POSITION_INTERFACE_INDEX] + position_offset;
 
             joint_state_values_[VELOCITY_INTERFACE_INDEX] =
               (joint_state_values_[POSITION_INTERFACE_INDEX] - old_position) / period.seconds();
@@ -469,120 +567,219 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
       // mirror them back
       for (size_t i = 0; i < joint_state_values_.size(); ++i)
       {
-        if (
-          std::isfinite(joint_state_values_[i]) &&
-          has_state(joint_name + "/" + standard_interfaces_[i]))
+        if (std::isfinite(joint_state_values_[i]) && handles.states[i])
         {
-          set_state(joint_name + "/" + standard_interfaces_[i], joint_state_values_[i]);
+          std::ignore = set_state(handles.states[i], joint_state_values_[i], true);
         }
       }
     }
-    else
+    else if (handles.commands[POSITION_INTERFACE_INDEX] && handles.states[POSITION_INTERFACE_INDEX])
     {
-      for (const auto & joint_command : joint_commands_)
+      double cmd;
+      std::ignore = get_command(handles.commands[POSITION_INTERFACE_INDEX], cmd, true);
+      if (std::isfinite(cmd))
       {
-        if (joint_command.get()->get_interface_name() == hardware_interface::HW_IF_POSITION)
-        {
-          const std::string & name = joint_command.get()->get_name();
-          if (has_state(name) && std::isfinite(get_command(name)))
-          {
-            set_state(
-              name, get_command(name) + (custom_interface_with_following_offset_.empty()
-                                           ? position_state_following_offset_
-                                           : 0.0));
-          }
-        }
+        std::ignore =
+          set_state(handles.states[POSITION_INTERFACE_INDEX], cmd + position_offset, true);
       }
     }
   }
 
   // do loopback on all other interfaces
-  for (const auto & joint_state : joint_states_)
+  for (const auto & loopback : joint_loopback_handles_)
   {
-    if (
-      std::find(
-        skip_interfaces_.begin(), skip_interfaces_.end(),
-        joint_state.get()->get_interface_name()) != skip_interfaces_.end())
+    if (loopback.command && mirror_command_to_state(loopback) != return_type::OK)
     {
-      continue;
+      return return_type::ERROR;
     }
-    const std::string & full_interface_name = joint_state.get()->get_name();
-    if (has_command(full_interface_name))
+    if (loopback.following_command)
     {
-      if (
-        mirror_command_to_state(full_interface_name, joint_state.get()->get_data_type()) !=
-        return_type::OK)
+      double cmd;
+      std::ignore = get_command(loopback.following_command, cmd, true);
+      cmd += position_state_following_offset_;
+      if (std::isfinite(cmd))
       {
-        return return_type::ERROR;
+        std::ignore = set_state(loopback.state, cmd, true);
       }
     }
-    if (custom_interface_with_following_offset_ == joint_state.get()->get_interface_name())
+  }
+
+  // Update mimic joints
+  for (const auto & mimic_joint : mimic_joint_handles_)
+  {
+    for (size_t i = 0; i < 3; ++i)
     {
-      const auto cmd =
-        get_command(
-          joint_state.get()->get_prefix_name() + "/" + hardware_interface::HW_IF_POSITION) +
-        position_state_following_offset_;
-      if (std::isfinite(cmd))
+      if (mimic_joint.states[i])
       {
-        set_state(full_interface_name, cmd);
+        double mimicked_state;
+        std::ignore = get_state(mimic_joint.mimicked_states[i], mimicked_state, true);
+        std::ignore = set_state(
+          mimic_joint.states[i],
+          (i == POSITION_INTERFACE_INDEX ? mimic_joint.offset : 0.0) +
+            mimic_joint.multiplier * mimicked_state,
+          true);
       }
     }
   }
 
-  // Update mimic joints
+  // do loopback on the sensor and gpio interfaces
+  for (const auto & loopback : component_loopback_handles_)
+  {
+    if (mirror_command_to_state(loopback) != return_type::OK)
+    {
+      return return_type::ERROR;
+    }
+  }
+
+  return return_type::OK;
+}
+
+return_type GenericSystem::write(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/)
+{
+  spin_for(write_cpu_load_);
+  return return_type::OK;
+}
+
+// Private methods
+void GenericSystem::update_joint_dynamics(double period)
+{
+  const double position_offset =
+    custom_interface_with_following_offset_.empty() ? position_state_following_offset_ : 0.0;
+  for (size_t j = 0; j < joint_handles_.size(); ++j)
+  {
+    const size_t control_mode = joint_control_mode_[j];
+    const auto & command = joint_handles_[j].commands[control_mode];
+    double & value = joint_dynamics_commands_[j];
+    value = std::numeric_limits<double>::quiet_NaN();
+    if (command)
+    {
+      std::ignore = get_command(command, value, true);
+      if (control_mode == POSITION_INTERFACE_INDEX)
+      {
+        value += position_offset;
+      }
+    }
+  }
+
+  joint_dynamics_.update(joint_control_mode_, joint_dynamics_commands_, period);
+
+  const std::array<const std::vector<double> *, 3> states = {
+    {&joint_dynamics_.positions(), &joint_dynamics_.velocities(),
+     &joint_dynamics_.accelerations()}};
+  for (size_t j = 0; j < joint_handles_.size(); ++j)
+  {
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+      if (joint_handles_[j].states[i])
+      {
+        std::ignore = set_state(joint_handles_[j].states[i], (*states[i])[j], true);
+      }
+    }
+  }
+}
+
+void GenericSystem::precompute_read_handles()
+{
   const auto & joints = get_hardware_info().joints;
-  for (const auto & mimic_joint : get_hardware_info().mimic_joints)
+  auto find_state = [this](const std::string & name)
+  {
+    return has_state(name) ? get_state_interface_handle(name)
+                           : hardware_interface::StateInterface::SharedPtr();
+  };
+  auto find_command = [this](const std::string & name)
+  {
+    return has_command(name) ? get_command_interface_handle(name)
+                             : hardware_interface::CommandInterface::SharedPtr();
+  };
+
+  joint_handles_.clear();
+  joint_handles_.reserve(joints.size());
+  for (const auto & joint : joints)
+  {
+    JointHandles handles;
+    for (size_t i = 0; i < 3; ++i)
+    {
+      const auto full_name = joint.name + "/" + standard_interfaces_[i];
+      handles.states[i] = find_state(full_name);
+      handles.commands[i] = find_command(full_name);
+    }
+    joint_handles_.push_back(handles);
+  }
+
+  joint_loopback_handles_.clear();
+  for (const auto & joint_state : joint_states_)
   {
-    const auto & mimic_joint_name = joints.at(mimic_joint.joint_index).name;
-    const auto & mimicked_joint_name = joints.at(mimic_joint.mimicked_joint_index).name;
-    if (has_state(mimic_joint_name + "/" + hardware_interface::HW_IF_POSITION))
+    if (
+      std::find(
+        skip_interfaces_.begin(), skip_interfaces_.end(), joint_state->get_interface_name()) !=
+      skip_interfaces_.end())
     {
-      set_state(
-        mimic_joint_name + "/" + hardware_interface::HW_IF_POSITION,
-        mimic_joint.offset +
-          mimic_joint.multiplier *
-            get_state(mimicked_joint_name + "/" + hardware_interface::HW_IF_POSITION));
+      continue;
     }
-    if (has_state(mimic_joint_name + "/" + hardware_interface::HW_IF_VELOCITY))
+    LoopbackHandles loopback;
+    loopback.state = joint_state;
+    loopback.command = find_command(joint_state->get_name());
+    loopback.data_type = joint_state->get_data_type();
+    if (custom_interface_with_following_offset_ == joint_state->get_interface_name())
     {
-      set_state(
-        mimic_joint_name + "/" + hardware_interface::HW_IF_VELOCITY,
-        mimic_joint.multiplier *
-          get_state(mimicked_joint_name + "/" + hardware_interface::HW_IF_VELOCITY));
+      loopback.following_command =
+        find_command(joint_state->get_prefix_name() + "/" + hardware_interface::HW_IF_POSITION);
     }
-    if (has_state(mimic_joint_name + "/" + hardware_interface::HW_IF_ACCELERATION))
+    if (loopback.command || loopback.following_command)
     {
-      set_state(
-        mimic_joint_name + "/" + hardware_interface::HW_IF_ACCELERATION,
-        mimic_joint.multiplier *
-          get_state(mimicked_joint_name + "/" + hardware_interface::HW_IF_ACCELERATION));
+      joint_loopback_handles_.push_back(loopback);
     }
   }
 
-  if (use_mock_sensor_command_interfaces_)
+  mimic_joint_handles_.clear();
+  for (const auto & mimic_joint : get_hardware_info().mimic_joints)
   {
-    // do loopback on all sensor interfaces as we have exported them all
-    for (const auto & sensor_state : sensor_states_)
+    MimicJointHandles handles;
+    handles.multiplier = mimic_joint.multiplier;
+    handles.offset = mimic_joint.offset;
+    for (size_t i = 0; i < 3; ++i)
     {
-      const std::string & name = sensor_state.get()->get_name();
-      if (mirror_command_to_state(name, sensor_state.get()->get_data_type()) != return_type::OK)
+      handles.states[i] =
+        find_state(joints.at(mimic_joint.joint_index).name + "/" + standard_interfaces_[i]);
+      handles.mimicked_states[i] = find_state(
+        joints.at(mimic_joint.mimicked_joint_index).name + "/" + standard_interfaces_[i]);
+      if (!handles.mimicked_states[i])
       {
-        return return_type::ERROR;
+        handles.states[i].reset();
       }
     }
+    mimic_joint_handles_.push_back(handles);
   }
 
+  component_loopback_handles_.clear();
+  auto add_component_loopback =
+    [&](const hardware_interface::StateInterface::SharedPtr & state,
+        const hardware_interface::CommandInterface::SharedPtr & command,
+        const hardware_interface::HandleDataType & data_type)
+  {
+    if (state && command)
+    {
+      component_loopback_handles_.push_back({state, command, data_type, nullptr});
+    }
+  };
+  if (use_mock_sensor_command_interfaces_)
+  {
+    // do loopback on all sensor interfaces as we have exported them all
+    for (const auto & sensor_state : sensor_states_)
+    {
+      add_component_loopback(
+        sensor_state, find_command(sensor_state->get_name()), sensor_state->get_data_type());
+    }
+  }
   if (use_mock_gpio_command_interfaces_)
   {
     // do loopback on all gpio interfaces as we have exported them all
     // commands are created for all state interfaces, but in unlisted_commands_
     for (const auto & gpio_state : gpio_states_)
     {
-      const std::string & name = gpio_state.get()->get_name();
-      if (mirror_command_to_state(name, gpio_state.get()->get_data_type()) != return_type::OK)
-      {
-        return return_type::ERROR;
-      }
+      add_component_loopback(
+        gpio_state, find_command(gpio_state->get_name()), gpio_state->get_data_type());
     }
   }
   else
@@ -590,21 +787,12 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
     // do loopback on all gpio interfaces, where they exist
     for (const auto & gpio_command : gpio_commands_)
     {
-      const std::string & name = gpio_command.get()->get_name();
-      if (has_state(name))
-      {
-        if (mirror_command_to_state(name, gpio_command.get()->get_data_type()) != return_type::OK)
-        {
-          return return_type::ERROR;
-        }
-      }
+      add_component_loopback(
+        find_state(gpio_command->get_name()), gpio_command, gpio_command->get_data_type());
     }
   }
-
-  return return_type::OK;
 }
 
-// Private methods
 bool GenericSystem::populate_interfaces(
   const std::vector<hardware_interface::ComponentInfo> & components,
   std::vector<hardware_interface::InterfaceDescription> & command_interface_descriptions) const
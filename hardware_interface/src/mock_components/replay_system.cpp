@@ -0,0 +1,266 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "mock_components/replay_system.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "hardware_interface/lexical_casts.hpp"
+#include "rclcpp/logging.hpp"
+
+namespace mock_components
+{
+
+CallbackReturn ReplaySystem::on_init(
+  const hardware_interface::HardwareComponentInterfaceParams & params)
+{
+  if (hardware_interface::SystemInterface::on_init(params) != CallbackReturn::SUCCESS)
+  {
+    return CallbackReturn::ERROR;
+  }
+
+  const auto & hardware_parameters = get_hardware_info().hardware_parameters;
+  auto it = hardware_parameters.find("log_file");
+  if (it == hardware_parameters.end() || it->second.empty())
+  {
+    RCLCPP_ERROR(get_logger(), "The hardware parameter 'log_file' is required.");
+    return CallbackReturn::ERROR;
+  }
+  log_file_ = it->second;
+  try
+  {
+    it = hardware_parameters.find("playback_speed");
+    if (it != hardware_parameters.end())
+    {
+      playback_speed_ = hardware_interface::stod(it->second);
+    }
+    it = hardware_parameters.find("loop");
+    if (it != hardware_parameters.end())
+    {
+      loop_ = hardware_interface::parse_bool(it->second);
+    }
+    it = hardware_parameters.find("command_tolerance");
+    if (it != hardware_parameters.end())
+    {
+      command_tolerance_ = hardware_interface::stod(it->second);
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(get_logger(), "Invalid hardware parameter: %s", e.what());
+    return CallbackReturn::ERROR;
+  }
+  if (playback_speed_ < 0.0)
+  {
+    RCLCPP_ERROR(get_logger(), "The playback speed can not be negative.");
+    return CallbackReturn::ERROR;
+  }
+
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn ReplaySystem::on_configure(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  try
+  {
+    log_ = ReplayLog::load(log_file_);
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(get_logger(), "%s", e.what());
+    return CallbackReturn::ERROR;
+  }
+  if (log_.empty())
+  {
+    RCLCPP_ERROR(get_logger(), "The replay log '%s' has no records.", log_file_.c_str());
+    return CallbackReturn::ERROR;
+  }
+
+  auto column_of = [](const std::vector<std::string> & names, const std::string & name)
+  { return static_cast<std::size_t>(std::find(names.begin(), names.end(), name) - names.begin()); };
+  auto has_supported_data_type = [this](const hardware_interface::Handle & handle)
+  {
+    if (
+      !handle.is_double_readable() &&
+      handle.get_data_type() != hardware_interface::HandleDataType::BOOL)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Interface '%s' has the data type '%s', only double and bool are supported.",
+        handle.get_name().c_str(), handle.get_data_type().to_string().c_str());
+      return false;
+    }
+    return true;
+  };
+
+  state_handles_.clear();
+  state_columns_.clear();
+  for (const auto * states : {&joint_states_, &sensor_states_, &gpio_states_, &unlisted_states_})
+  {
+    for (const auto & handle : *states)
+    {
+      const std::size_t column = column_of(log_.get_state_names(), handle->get_name());
+      if (column == log_.get_state_names().size())
+      {
+        RCLCPP_ERROR(
+          get_logger(), "The state interface '%s' is not recorded in the replay log '%s'.",
+          handle->get_name().c_str(), log_file_.c_str());
+        return CallbackReturn::ERROR;
+      }
+      if (!has_supported_data_type(*handle))
+      {
+        return CallbackReturn::ERROR;
+      }
+      state_handles_.push_back(handle);
+      state_columns_.push_back(column);
+    }
+  }
+  command_handles_.clear();
+  command_columns_.clear();
+  for (const auto * commands : {&joint_commands_, &gpio_commands_, &unlisted_commands_})
+  {
+    for (const auto & handle : *commands)
+    {
+      const std::size_t column = column_of(log_.get_command_names(), handle->get_name());
+      if (column < log_.get_command_names().size() && has_supported_data_type(*handle))
+      {
+        command_handles_.push_back(handle);
+        command_columns_.push_back(column);
+      }
+    }
+  }
+
+  restart();
+  apply_record();
+  RCLCPP_INFO(
+    get_logger(), "Replaying %zu records of %zu state interfaces, comparing %zu commands.",
+    log_.size(), state_handles_.size(), command_handles_.size());
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn ReplaySystem::on_activate(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  restart();
+  apply_record();
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn ReplaySystem::on_deactivate(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  if (command_deviations_ > 0)
+  {
+    RCLCPP_WARN(
+      get_logger(),
+      "%zu of %zu compared commands deviated from the replay log, by up to %g.",
+      command_deviations_, compared_commands_, max_command_deviation_);
+  }
+  else
+  {
+    RCLCPP_INFO(
+      get_logger(), "All the %zu compared commands matched the replay log.", compared_commands_);
+  }
+  return CallbackReturn::SUCCESS;
+}
+
+hardware_interface::return_type ReplaySystem::read(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & period)
+{
+  const std::size_t last_record = log_.size() - 1;
+  if (playback_speed_ > 0.0)
+  {
+    playback_time_ns_ +=
+      static_cast<int64_t>(static_cast<double>(period.nanoseconds()) * playback_speed_);
+    const int64_t duration_ns = log_.get_time(last_record) - log_.get_time(0);
+    if (loop_ && duration_ns > 0 && playback_time_ns_ > duration_ns)
+    {
+      playback_time_ns_ %= duration_ns;
+      record_ = 0;
+    }
+    const int64_t playback_stamp_ns = log_.get_time(0) + playback_time_ns_;
+    while (record_ < last_record && log_.get_time(record_ + 1) <= playback_stamp_ns)
+    {
+      ++record_;
+    }
+  }
+  else if (started_)
+  {
+    // every read replays the next record
+    record_ = record_ < last_record ? record_ + 1 : (loop_ ? 0 : last_record);
+  }
+  started_ = true;
+  apply_record();
+  return hardware_interface::return_type::OK;
+}
+
+hardware_interface::return_type ReplaySystem::write(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/)
+{
+  const double * recorded_commands = log_.get_commands(record_);
+  for (std::size_t i = 0; i < command_handles_.size(); ++i)
+  {
+    // a command that cannot be accessed without blocking is compared in the next cycle
+    const auto value = command_handles_[i]->get_optional_as_double();
+    const double recorded = recorded_commands[command_columns_[i]];
+    if (!value.has_value() || !std::isfinite(value.value()) || !std::isfinite(recorded))
+    {
+      continue;
+    }
+    ++compared_commands_;
+    const double deviation = std::abs(value.value() - recorded);
+    if (deviation > command_tolerance_)
+    {
+      ++command_deviations_;
+      max_command_deviation_ = std::max(max_command_deviation_, deviation);
+    }
+  }
+  return hardware_interface::return_type::OK;
+}
+
+void ReplaySystem::restart()
+{
+  record_ = 0;
+  started_ = false;
+  playback_time_ns_ = 0;
+  compared_commands_ = 0;
+  command_deviations_ = 0;
+  max_command_deviation_ = 0.0;
+}
+
+void ReplaySystem::apply_record()
+{
+  const double * recorded_states = log_.get_states(record_);
+  for (std::size_t i = 0; i < state_handles_.size(); ++i)
+  {
+    // a state that cannot be accessed without blocking is updated with the next record
+    const double value = recorded_states[state_columns_[i]];
+    if (state_handles_[i]->get_data_type() == hardware_interface::HandleDataType::BOOL)
+    {
+      std::ignore = set_state(state_handles_[i], value != 0.0, false);
+    }
+    else
+    {
+      std::ignore = set_state(state_handles_[i], value, false);
+    }
+  }
+}
+
+}  // namespace mock_components
+
+#include "pluginlib/class_list_macros.hpp"
+PLUGINLIB_EXPORT_CLASS(mock_components::ReplaySystem, hardware_interface::SystemInterface)
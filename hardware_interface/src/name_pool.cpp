@@ -0,0 +1,91 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "hardware_interface/name_pool.hpp"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+struct NameTable
+{
+  std::shared_mutex mutex;
+  /// a deque never moves its elements, the references given out stay valid
+  std::deque<std::string> names = {""};
+  /// keys view the names of the deque, so every name is stored once
+  std::unordered_map<std::string_view, hardware_interface::NameId> ids = {{names.front(), 0}};
+};
+
+NameTable & get_table()
+{
+  // never destroyed, the names may be used by static objects until the end of the process
+  static NameTable * table = new NameTable();
+  return *table;
+}
+}  // namespace
+
+namespace hardware_interface
+{
+NameId NamePool::intern(const std::string & name)
+{
+  auto & table = get_table();
+  {
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    const auto it = table.ids.find(name);
+    if (it != table.ids.end())
+    {
+      return it->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(table.mutex);
+  const auto it = table.ids.find(name);
+  if (it != table.ids.end())
+  {
+    return it->second;
+  }
+  const auto id = static_cast<NameId>(table.names.size());
+  table.names.push_back(name);
+  table.ids.emplace(table.names.back(), id);
+  return id;
+}
+
+NameId NamePool::find(const std::string & name)
+{
+  auto & table = get_table();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  const auto it = table.ids.find(name);
+  return it != table.ids.end() ? it->second : EMPTY_ID;
+}
+
+const std::string & NamePool::get_name(NameId id)
+{
+  auto & table = get_table();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  return id < table.names.size() ? table.names[id] : table.names.front();
+}
+
+std::size_t NamePool::size()
+{
+  auto & table = get_table();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  return table.names.size();
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,105 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/numa_memory.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#if defined(__linux__)
+/// MPOL_MF_MOVE of numaif.h: moves the pages that are only mapped by the calling process
+constexpr int kMoveOwnedPages = 1 << 1;
+#endif
+}  // namespace
+
+namespace hardware_interface
+{
+int NumaMemory::get_current_node() noexcept
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned int cpu = 0;
+  unsigned int node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+  {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
+std::size_t NumaMemory::move_to_node(const std::vector<NumaMemoryRange> & ranges, int node)
+{
+#if defined(__linux__) && defined(SYS_move_pages)
+  if (node < 0)
+  {
+    return 0;
+  }
+  const long page_size = sysconf(_SC_PAGESIZE);
+  if (page_size <= 0)
+  {
+    return 0;
+  }
+  const auto page_mask = ~(static_cast<std::uintptr_t>(page_size) - 1);
+  std::vector<std::uintptr_t> page_addresses;
+  for (const auto & range : ranges)
+  {
+    if (range.data == nullptr || range.size == 0)
+    {
+      continue;
+    }
+    const auto begin = reinterpret_cast<std::uintptr_t>(range.data);
+    for (std::uintptr_t page = begin & page_mask; page < begin + range.size; page += page_size)
+    {
+      page_addresses.push_back(page);
+    }
+  }
+  std::sort(page_addresses.begin(), page_addresses.end());
+  page_addresses.erase(
+    std::unique(page_addresses.begin(), page_addresses.end()), page_addresses.end());
+  if (page_addresses.empty())
+  {
+    return 0;
+  }
+
+  std::vector<void *> pages(page_addresses.size());
+  std::transform(
+    page_addresses.begin(), page_addresses.end(), pages.begin(),
+    [](std::uintptr_t address) { return reinterpret_cast<void *>(address); });
+  const std::vector<int> nodes(pages.size(), node);
+  std::vector<int> status(pages.size(), -1);
+  if (
+    syscall(
+      SYS_move_pages, 0 /* calling process */, pages.size(), pages.data(), nodes.data(),
+      status.data(), kMoveOwnedPages) < 0)
+  {
+    return 0;
+  }
+  // the status of every page is its node, or a negative error if it could not be moved
+  return static_cast<std::size_t>(std::count(status.begin(), status.end(), node));
+#else
+  (void)ranges;
+  (void)node;
+  return 0;
+#endif
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,171 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/performance_counters.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace
+{
+std::atomic<bool> sampling_enabled{false};
+
+#if defined(__linux__)
+constexpr std::size_t kNumberOfCounters = 4;
+constexpr std::array<uint64_t, kNumberOfCounters> kCounterConfigs = {
+  PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES};
+
+/// Group of the counters of a thread, read at once so that all the counters cover the same section
+class ThreadCounterGroup
+{
+public:
+  ~ThreadCounterGroup()
+  {
+    for (const int fd : fds_)
+    {
+      if (fd >= 0)
+      {
+        close(fd);
+      }
+    }
+  }
+
+  /// Opens the counters on the first call, returns whether the group is available.
+  bool open() noexcept
+  {
+    if (state_ == State::NOT_OPENED)
+    {
+      state_ = State::UNAVAILABLE;
+      for (std::size_t i = 0; i < kNumberOfCounters; ++i)
+      {
+        fds_[i] = open_counter(kCounterConfigs[i], fds_[0]);
+        if (fds_[i] >= 0)
+        {
+          // the group is read in the order the counters were opened
+          read_index_[i] = number_of_opened_counters_++;
+        }
+        else if (i == 0)
+        {
+          // the other counters can't be read without the group leader
+          return false;
+        }
+      }
+      state_ = State::AVAILABLE;
+    }
+    return state_ == State::AVAILABLE;
+  }
+
+  bool read_counters(hardware_interface::PerformanceCounters & counters) noexcept
+  {
+    if (!open())
+    {
+      return false;
+    }
+    // PERF_FORMAT_GROUP layout: number of counters followed by their values
+    std::array<uint64_t, kNumberOfCounters + 1> buffer{};
+    if (read(fds_[0], buffer.data(), sizeof(buffer)) < static_cast<ssize_t>(sizeof(uint64_t)))
+    {
+      return false;
+    }
+    std::array<uint64_t, kNumberOfCounters> values{};
+    for (std::size_t i = 0; i < kNumberOfCounters; ++i)
+    {
+      if (fds_[i] >= 0 && read_index_[i] < buffer[0])
+      {
+        values[i] = buffer[1 + read_index_[i]];
+      }
+    }
+    counters = {values[0], values[1], values[2], values[3]};
+    return true;
+  }
+
+private:
+  static int open_counter(uint64_t config, int group_fd) noexcept
+  {
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.config = config;
+    attributes.read_format = PERF_FORMAT_GROUP;
+    // the user space counters are allowed by the default perf_event_paranoid setting
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    return static_cast<int>(
+      syscall(SYS_perf_event_open, &attributes, 0 /* calling thread */, -1 /* any CPU */, group_fd,
+              PERF_FLAG_FD_CLOEXEC));
+  }
+
+  enum class State
+  {
+    NOT_OPENED,
+    AVAILABLE,
+    UNAVAILABLE
+  };
+
+  State state_ = State::NOT_OPENED;
+  std::array<int, kNumberOfCounters> fds_ = {-1, -1, -1, -1};
+  std::array<uint64_t, kNumberOfCounters> read_index_{};
+  uint64_t number_of_opened_counters_ = 0;
+};
+
+thread_local ThreadCounterGroup thread_counter_group;
+#endif
+}  // namespace
+
+namespace hardware_interface
+{
+PerformanceCounters PerformanceCounters::now() noexcept
+{
+  PerformanceCounters counters;
+  if (!is_sampling_enabled())
+  {
+    return counters;
+  }
+#if defined(__linux__)
+  thread_counter_group.read_counters(counters);
+#endif
+  return counters;
+}
+
+void PerformanceCounters::set_sampling_enabled(bool enabled) noexcept
+{
+  sampling_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool PerformanceCounters::is_sampling_enabled() noexcept
+{
+  return sampling_enabled.load(std::memory_order_relaxed);
+}
+
+bool PerformanceCounters::is_available() noexcept
+{
+#if defined(__linux__)
+  return thread_counter_group.open();
+#else
+  return false;
+#endif
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,156 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/realtime_thread.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <alloca.h>
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "rclcpp/logging.hpp"
+#include "realtime_tools/realtime_helpers.hpp"
+
+namespace
+{
+/// Part of the stack that is not written, for the frames of the functions up to the prefaulting
+constexpr std::size_t kStackSafetyMargin = 64 * 1024;
+/// Maximum length of a thread name on Linux, without the terminating null character
+constexpr std::size_t kMaxThreadNameLength = 15;
+
+#if defined(__linux__)
+/// Returns the size of the stack of the calling thread, 0 if it is unknown.
+std::size_t get_current_thread_stack_size()
+{
+  pthread_attr_t attributes;
+  if (pthread_getattr_np(pthread_self(), &attributes) != 0)
+  {
+    return 0;
+  }
+  std::size_t stack_size = 0;
+  void * stack_address = nullptr;
+  if (pthread_attr_getstack(&attributes, &stack_address, &stack_size) != 0)
+  {
+    stack_size = 0;
+  }
+  pthread_attr_destroy(&attributes);
+  return stack_size;
+}
+#endif
+}  // namespace
+
+namespace hardware_interface
+{
+void set_current_thread_name(const std::string & name)
+{
+#if defined(__linux__)
+  if (!name.empty())
+  {
+    pthread_setname_np(pthread_self(), name.substr(0, kMaxThreadNameLength).c_str());
+  }
+#else
+  (void)name;
+#endif
+}
+
+void prefault_current_thread_stack(std::size_t size)
+{
+#if defined(__linux__)
+  const std::size_t stack_size = get_current_thread_stack_size();
+  if (stack_size <= kStackSafetyMargin)
+  {
+    return;
+  }
+  size = std::min(size, stack_size - kStackSafetyMargin);
+  if (size == 0)
+  {
+    return;
+  }
+  const long page_size = sysconf(_SC_PAGESIZE);
+  const std::size_t stride = page_size > 0 ? static_cast<std::size_t>(page_size) : 4096;
+  // the stack grows down from this frame, the allocated bytes are released when returning
+  volatile unsigned char * stack = static_cast<volatile unsigned char *>(alloca(size));
+  for (std::size_t i = 0; i < size; i += stride)
+  {
+    stack[i] = 0;
+  }
+  stack[size - 1] = 0;
+#else
+  (void)size;
+#endif
+}
+
+bool configure_current_thread(const RealtimeThreadParams & params, const rclcpp::Logger & logger)
+{
+  set_current_thread_name(params.name);
+  bool result = true;
+  if (!params.cpu_affinity_cores.empty())
+  {
+    const auto affinity_result =
+      realtime_tools::set_current_thread_affinity(params.cpu_affinity_cores);
+    if (!affinity_result.first)
+    {
+      RCLCPP_WARN(
+        logger, "Unable to set the CPU affinity of the thread '%s' : '%s'", params.name.c_str(),
+        affinity_result.second.c_str());
+      result = false;
+    }
+  }
+  if (params.thread_priority > 0 && !realtime_tools::configure_sched_fifo(params.thread_priority))
+  {
+    RCLCPP_WARN(
+      logger,
+      "Could not enable FIFO RT scheduling policy for the thread '%s': with error number "
+      "<%i>(%s).",
+      params.name.c_str(), errno, strerror(errno));
+    result = false;
+  }
+  if (params.stack_prefault_size > 0)
+  {
+    prefault_current_thread_stack(params.stack_prefault_size);
+  }
+  return result;
+}
+
+void configure_current_thread_once(
+  const RealtimeThreadParams & params, const rclcpp::Logger & logger)
+{
+  thread_local bool configured = false;
+  if (!configured)
+  {
+    configured = true;
+    configure_current_thread(params, logger);
+  }
+}
+
+std::thread create_realtime_thread(
+  const RealtimeThreadParams & params, const rclcpp::Logger & logger,
+  std::function<void()> function)
+{
+  return std::thread(
+    [params, logger, function = std::move(function)]()
+    {
+      configure_current_thread(params, logger);
+      function();
+    });
+}
+
+}  // namespace hardware_interface
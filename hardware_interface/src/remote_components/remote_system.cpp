@@ -0,0 +1,262 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "remote_components/remote_system.hpp"
+
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "hardware_interface/introspection.hpp"
+#include "hardware_interface/lexical_casts.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/logging.hpp"
+
+namespace remote_components
+{
+
+CallbackReturn RemoteSystem::on_init(
+  const hardware_interface::HardwareComponentInterfaceParams & params)
+{
+  if (hardware_interface::SystemInterface::on_init(params) != CallbackReturn::SUCCESS)
+  {
+    return CallbackReturn::ERROR;
+  }
+
+  const auto & hardware_parameters = get_hardware_info().hardware_parameters;
+  try
+  {
+    auto get_required = [&hardware_parameters](const std::string & name) -> const std::string &
+    {
+      const auto it = hardware_parameters.find(name);
+      if (it == hardware_parameters.end())
+      {
+        throw std::invalid_argument("the parameter '" + name + "' is required");
+      }
+      return it->second;
+    };
+    remote_address_ = get_required("remote_address");
+    remote_port_ = hardware_interface::stoui16(get_required("remote_port"));
+    local_port_ = hardware_interface::stoui16(get_required("local_port"));
+
+    auto it = hardware_parameters.find("read_deadline_us");
+    if (it != hardware_parameters.end())
+    {
+      read_deadline_ = std::chrono::microseconds(hardware_interface::stoui32(it->second));
+    }
+
+    it = hardware_parameters.find("max_missed_deadlines");
+    if (it != hardware_parameters.end())
+    {
+      max_missed_deadlines_ = hardware_interface::stoui32(it->second);
+    }
+
+    it = hardware_parameters.find("connection_timeout_ms");
+    if (it != hardware_parameters.end())
+    {
+      connection_timeout_ = std::chrono::milliseconds(hardware_interface::stoui32(it->second));
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(get_logger(), "Invalid hardware parameter: %s", e.what());
+    return CallbackReturn::ERROR;
+  }
+
+  REGISTER_ROS2_CONTROL_INTROSPECTION("remote_link", &link_.get_statistics());
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn RemoteSystem::on_configure(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  state_handles_.clear();
+  command_handles_.clear();
+  for (const auto * states : {&joint_states_, &sensor_states_, &gpio_states_, &unlisted_states_})
+  {
+    state_handles_.insert(state_handles_.end(), states->begin(), states->end());
+  }
+  for (const auto * commands : {&joint_commands_, &gpio_commands_, &unlisted_commands_})
+  {
+    command_handles_.insert(command_handles_.end(), commands->begin(), commands->end());
+  }
+
+  std::vector<std::string> state_interface_names;
+  std::vector<std::string> command_interface_names;
+  auto collect_names = [this](const auto & handles, std::vector<std::string> & names)
+  {
+    for (const auto & handle : handles)
+    {
+      if (
+        !handle->is_double_readable() &&
+        handle->get_data_type() != hardware_interface::HandleDataType::BOOL)
+      {
+        RCLCPP_ERROR(
+          get_logger(),
+          "Interface '%s' has the data type '%s', only double and bool are supported.",
+          handle->get_name().c_str(), handle->get_data_type().to_string().c_str());
+        return false;
+      }
+      names.push_back(handle->get_name());
+    }
+    return true;
+  };
+  if (
+    !collect_names(state_handles_, state_interface_names) ||
+    !collect_names(command_handles_, command_interface_names))
+  {
+    return CallbackReturn::ERROR;
+  }
+
+  try
+  {
+    link_.open(
+      local_port_, remote_address_, remote_port_, command_interface_names, state_interface_names);
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(get_logger(), "%s", e.what());
+    return CallbackReturn::ERROR;
+  }
+  state_values_.assign(state_handles_.size(), std::numeric_limits<double>::quiet_NaN());
+  command_values_.assign(command_handles_.size(), std::numeric_limits<double>::quiet_NaN());
+  missed_deadlines_ = 0;
+  RCLCPP_INFO(
+    get_logger(),
+    "Exchanging %zu state and %zu command interfaces with the remote controller manager at "
+    "'%s:%u' from the local port %u.",
+    state_handles_.size(), command_handles_.size(), remote_address_.c_str(), remote_port_,
+    local_port_);
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn RemoteSystem::on_cleanup(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  link_.close();
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn RemoteSystem::on_shutdown(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  link_.close();
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn RemoteSystem::on_activate(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  int64_t stamp_ns = 0;
+  const auto deadline = std::chrono::steady_clock::now() + connection_timeout_;
+  bool connected = false;
+  // the remote side sends its states every cycle, a frame is expected within the timeout
+  while (!connected && std::chrono::steady_clock::now() < deadline)
+  {
+    connected = link_.receive(
+      state_values_, stamp_ns, get_clock()->now().nanoseconds(),
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        deadline - std::chrono::steady_clock::now()));
+  }
+  if (!connected)
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "The remote controller manager at '%s:%u' didn't send any states within %ld ms.",
+      remote_address_.c_str(), remote_port_,
+      static_cast<long>(connection_timeout_.count()));  // NOLINT
+    return CallbackReturn::ERROR;
+  }
+  apply_state_values();
+  missed_deadlines_ = 0;
+  return CallbackReturn::SUCCESS;
+}
+
+hardware_interface::return_type RemoteSystem::read(
+  const rclcpp::Time & time, const rclcpp::Duration & /*period*/)
+{
+  if (!link_.is_open())
+  {
+    RCLCPP_ERROR(get_logger(), "The link to the remote controller manager is not open.");
+    return hardware_interface::return_type::ERROR;
+  }
+  // the deadlines are only enforced while the component is active, an inactive component just
+  // mirrors the states of a remote side that might not be running yet
+  const bool enforce_deadline =
+    read_deadline_.count() > 0 &&
+    get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE;
+  int64_t stamp_ns = 0;
+  if (link_.receive(
+        state_values_, stamp_ns, time.nanoseconds(),
+        enforce_deadline ? read_deadline_ : std::chrono::nanoseconds(0)))
+  {
+    missed_deadlines_ = 0;
+    apply_state_values();
+    return hardware_interface::return_type::OK;
+  }
+  if (!enforce_deadline)
+  {
+    return hardware_interface::return_type::OK;
+  }
+  ++missed_deadlines_;
+  if (missed_deadlines_ > max_missed_deadlines_)
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "The remote controller manager missed %zu consecutive read deadlines, it is considered "
+      "disconnected.",
+      missed_deadlines_);
+    return hardware_interface::return_type::ERROR;
+  }
+  return hardware_interface::return_type::OK;
+}
+
+hardware_interface::return_type RemoteSystem::write(
+  const rclcpp::Time & time, const rclcpp::Duration & /*period*/)
+{
+  for (std::size_t i = 0; i < command_handles_.size(); ++i)
+  {
+    // a command that cannot be accessed without blocking keeps its previous value
+    const auto value = command_handles_[i]->get_optional_as_double();
+    if (value.has_value())
+    {
+      command_values_[i] = value.value();
+    }
+  }
+  // a frame that can't be sent, e.g., before the remote side is started, is counted in the
+  // statistics of the link, the next cycle sends the commands again
+  std::ignore = link_.send(command_values_, time.nanoseconds());
+  return hardware_interface::return_type::OK;
+}
+
+void RemoteSystem::apply_state_values()
+{
+  for (std::size_t i = 0; i < state_handles_.size(); ++i)
+  {
+    // a state that cannot be accessed without blocking is updated with the next frame
+    if (state_handles_[i]->get_data_type() == hardware_interface::HandleDataType::BOOL)
+    {
+      std::ignore = set_state(state_handles_[i], state_values_[i] != 0.0, false);
+    }
+    else
+    {
+      std::ignore = set_state(state_handles_[i], state_values_[i], false);
+    }
+  }
+}
+
+}  // namespace remote_components
+
+#include "pluginlib/class_list_macros.hpp"
+PLUGINLIB_EXPORT_CLASS(remote_components::RemoteSystem, hardware_interface::SystemInterface)
@@ -16,29 +16,73 @@
 
 #include <fmt/compile.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include "hardware_interface/actuator.hpp"
 #include "hardware_interface/actuator_interface.hpp"
+#include "hardware_interface/allocation_tracker.hpp"
 #include "hardware_interface/component_parser.hpp"
+#include "hardware_interface/deferred_logger.hpp"
+#include "hardware_interface/hardware_bus_interface.hpp"
 #include "hardware_interface/hardware_component_info.hpp"
+#include "hardware_interface/hardware_component_statistics_table.hpp"
+#include "hardware_interface/hardware_info_cache.hpp"
+#include "hardware_interface/hardware_status_aggregator.hpp"
 #include "hardware_interface/helpers.hpp"
+#include "hardware_interface/instrumentation_clock.hpp"
+#include "hardware_interface/interface_flight_recorder.hpp"
+#include "hardware_interface/joint_limits_store.hpp"
+#include "hardware_interface/memory_arena.hpp"
+#include "hardware_interface/name_pool.hpp"
+#include "hardware_interface/numa_memory.hpp"
+#include "hardware_interface/overload_governor.hpp"
+#include "hardware_interface/performance_counters.hpp"
+#include "hardware_interface/rate_divider.hpp"
+#include "hardware_interface/rcu_pointer.hpp"
+#include "hardware_interface/realtime_thread.hpp"
+#include "hardware_interface/rt_worker_pool.hpp"
 #include "hardware_interface/sensor.hpp"
 #include "hardware_interface/sensor_interface.hpp"
+#include "hardware_interface/shared_memory_interface_export.hpp"
+#include "hardware_interface/state_snapshot_publisher.hpp"
+#include "hardware_interface/static_plugin_registry.hpp"
 #include "hardware_interface/system.hpp"
 #include "hardware_interface/system_interface.hpp"
+#include "hardware_interface/thread_times.hpp"
+#include "hardware_interface/time_budget.hpp"
+#include "hardware_interface/trace_recorder.hpp"
+#include "hardware_interface/transmission_stage_interface.hpp"
+#include "joint_limits/joint_limiter_pipeline.hpp"
 #include "joint_limits/joint_limits_helpers.hpp"
 #include "joint_limits/joint_saturation_limiter.hpp"
-#include "joint_limits/joint_soft_limiter.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
 #include "pluginlib/class_loader.hpp"
 #include "rclcpp/logging.hpp"
@@ -93,6 +137,28 @@ std::string interfaces_to_string(
   return ss.str();
 }
 
+/// Returns the async worker pool of the control loop of the component, or the default pool.
+std::shared_ptr<AsyncWorkerPool> get_component_async_worker_pool(
+  const ResourceManagerParams & params, const HardwareInfo & hardware_info)
+{
+  const auto & control_loop = hardware_info.async_params.control_loop;
+  if (control_loop.empty())
+  {
+    return params.async_worker_pool;
+  }
+  const auto it = params.control_loop_pools.find(control_loop);
+  if (it == params.control_loop_pools.end())
+  {
+    RCUTILS_LOG_ERROR_NAMED(
+      "resource_manager",
+      "The control loop '%s' of the hardware component '%s' doesn't exist, running it on the "
+      "default async threads.",
+      control_loop.c_str(), hardware_info.name.c_str());
+    return params.async_worker_pool;
+  }
+  return it->second;
+}
+
 void find_common_hardware_interfaces(
   const std::vector<std::string> & hw_command_itfs,
   const std::vector<std::string> & start_stop_interfaces_list,
@@ -123,6 +189,472 @@ void find_common_hardware_interfaces(
   }
 }
 
+/// Returns true if the name matches the pattern, in which `*` matches any sequence of characters,
+/// including `/`, and `?` any single character.
+bool matches_interface_pattern(std::string_view pattern, std::string_view name)
+{
+  std::size_t p = 0;
+  std::size_t n = 0;
+  std::size_t star = std::string_view::npos;
+  std::size_t star_name = 0;
+  while (n < name.size())
+  {
+    if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n]))
+    {
+      ++p;
+      ++n;
+    }
+    else if (p < pattern.size() && pattern[p] == '*')
+    {
+      star = p++;
+      star_name = n;
+    }
+    else if (star != std::string_view::npos)
+    {
+      // the last star matches one more character
+      p = star + 1;
+      n = ++star_name;
+    }
+    else
+    {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '*')
+  {
+    ++p;
+  }
+  return p == pattern.size();
+}
+
+/// Groups the items into the units run one after the other, one per group and one per item
+/// without group.
+/**
+ * \param[in] groups group name of every item, empty if the item doesn't belong to a group.
+ * \return the indices of the items of every unit, in the order of the items.
+ */
+std::vector<std::vector<std::size_t>> group_into_units(const std::vector<std::string> & groups)
+{
+  std::vector<std::vector<std::size_t>> units;
+  std::unordered_map<std::string, std::size_t> group_units;
+  for (std::size_t i = 0; i < groups.size(); ++i)
+  {
+    if (groups[i].empty())
+    {
+      units.push_back({i});
+      continue;
+    }
+    const auto [it, inserted] = group_units.emplace(groups[i], units.size());
+    if (inserted)
+    {
+      units.emplace_back();
+    }
+    units[it->second].push_back(i);
+  }
+  return units;
+}
+
+/// Returns the number of threads running \p units_count units with up to \p number_of_threads.
+std::size_t get_units_threads_count(unsigned int number_of_threads, std::size_t units_count)
+{
+  return std::min<std::size_t>(std::max(number_of_threads, 1u), units_count);
+}
+
+/// Calls \p task with the index of every item of the units, the units concurrently.
+/**
+ * The items of a unit are run in order by the same thread. The calling thread runs units too, so
+ * no thread is started with \p threads_count equal to 1.
+ * \note \p task must not throw.
+ */
+template <class TaskT>
+void run_units_concurrently(
+  const std::vector<std::vector<std::size_t>> & units, std::size_t threads_count,
+  const TaskT & task)
+{
+  std::atomic<std::size_t> next_unit{0};
+  auto run_units = [&units, &next_unit, &task]()
+  {
+    for (std::size_t unit = next_unit++; unit < units.size(); unit = next_unit++)
+    {
+      for (const auto i : units[unit])
+      {
+        task(i);
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < threads_count; ++i)
+  {
+    threads.emplace_back(run_units);
+  }
+  run_units();
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+}
+
+/// Resolves the id of a target state given only by its label, e.g., from a service request.
+void resolve_target_state_id(rclcpp_lifecycle::State & target_state)
+{
+  using lifecycle_msgs::msg::State;
+  if (target_state.id() != 0)
+  {
+    return;
+  }
+  if (target_state.label() == lifecycle_state_names::UNCONFIGURED)
+  {
+    target_state = rclcpp_lifecycle::State(
+      State::PRIMARY_STATE_UNCONFIGURED, lifecycle_state_names::UNCONFIGURED);
+  }
+  if (target_state.label() == lifecycle_state_names::INACTIVE)
+  {
+    target_state =
+      rclcpp_lifecycle::State(State::PRIMARY_STATE_INACTIVE, lifecycle_state_names::INACTIVE);
+  }
+  if (target_state.label() == lifecycle_state_names::ACTIVE)
+  {
+    target_state =
+      rclcpp_lifecycle::State(State::PRIMARY_STATE_ACTIVE, lifecycle_state_names::ACTIVE);
+  }
+  if (target_state.label() == lifecycle_state_names::FINALIZED)
+  {
+    target_state =
+      rclcpp_lifecycle::State(State::PRIMARY_STATE_FINALIZED, lifecycle_state_names::FINALIZED);
+  }
+}
+
+/// List of the interfaces available to the controllers, as a bitmap indexed by interface ID.
+/**
+ * Every interface name gets an ID when it is registered, with one atomic availability bit. The
+ * availability checks are single hash lookups, and the real-time control loop clears the bits of
+ * a failed component without any lookup, string comparison or memory allocation, through the
+ * AvailabilityBit resolved beforehand. Every change of the list increments its version.
+ */
+class AvailableInterfaces
+{
+public:
+  /// Availability bit of one interface, cleared in the real-time loop without any lookup.
+  struct AvailabilityBit
+  {
+    std::atomic<uint64_t> * word = nullptr;
+    uint64_t mask = 0u;
+    std::atomic<uint64_t> * version = nullptr;
+
+    /// Makes the interface unavailable, returns false if it was not available.
+    bool clear() const
+    {
+      if (!word || (word->fetch_and(~mask, std::memory_order_acq_rel) & mask) == 0u)
+      {
+        return false;
+      }
+      version->fetch_add(1u, std::memory_order_release);
+      return true;
+    }
+  };
+
+  /// Registers the interface as unavailable and reserves the storage to make it available.
+  void register_interface(const std::string & name)
+  {
+    make_unavailable(reserve_id(name));
+    version_.fetch_add(1u, std::memory_order_release);
+  }
+
+  /// Makes the interface unavailable, its ID is kept for a later registration of the same name.
+  void unregister_interface(const std::string & name) { make_unavailable(name); }
+
+  bool is_available(const std::string & name) const
+  {
+    const auto it = ids_.find(name);
+    return it != ids_.end() && (get_word(it->second).load(std::memory_order_acquire) &
+                                get_mask(it->second)) != 0u;
+  }
+
+  /// Adds the interface to the available list, returns false if it is already available.
+  bool make_available(const std::string & name)
+  {
+    const auto id = reserve_id(name);
+    if ((get_word(id).fetch_or(get_mask(id), std::memory_order_acq_rel) & get_mask(id)) != 0u)
+    {
+      return false;
+    }
+    version_.fetch_add(1u, std::memory_order_release);
+    return true;
+  }
+
+  /// Removes the interface from the available list, returns false if it is not available.
+  bool make_unavailable(const std::string & name)
+  {
+    const auto it = ids_.find(name);
+    return it != ids_.end() && make_unavailable(it->second);
+  }
+
+  /// Returns the availability bit of the interface, an empty bit if the name is not registered.
+  /**
+   * The bit stays valid until clear() is called.
+   */
+  AvailabilityBit get_availability_bit(const std::string & name)
+  {
+    const auto it = ids_.find(name);
+    if (it == ids_.end())
+    {
+      return {};
+    }
+    return {&get_word(it->second), get_mask(it->second), &version_};
+  }
+
+  /// Returns the version of the list, incremented whenever it changes and never reset.
+  uint64_t get_version() const { return version_.load(std::memory_order_acquire); }
+
+  /// Returns the names of the available interfaces, in the order of their registration.
+  std::vector<std::string> get_names() const
+  {
+    std::vector<std::string> names;
+    for (std::size_t word_index = 0; word_index < words_.size(); ++word_index)
+    {
+      const uint64_t word = words_[word_index].load(std::memory_order_acquire);
+      for (std::size_t bit = 0; word != 0u && bit < BITS_PER_WORD; ++bit)
+      {
+        if ((word & (uint64_t{1u} << bit)) != 0u)
+        {
+          names.push_back(*names_by_id_[word_index * BITS_PER_WORD + bit]);
+        }
+      }
+    }
+    return names;
+  }
+
+  void clear()
+  {
+    ids_.clear();
+    names_by_id_.clear();
+    words_.clear();
+    version_.fetch_add(1u, std::memory_order_release);
+  }
+
+private:
+  static constexpr std::size_t BITS_PER_WORD = 64;
+
+  std::size_t reserve_id(const std::string & name)
+  {
+    const auto it = ids_.find(name);
+    if (it != ids_.end())
+    {
+      return it->second;
+    }
+    // the keys view the interned names, which stay valid for the lifetime of the process
+    const std::string & interned_name = NamePool::get_interned(name);
+    const auto id = names_by_id_.size();
+    ids_.emplace(interned_name, id);
+    names_by_id_.push_back(&interned_name);
+    if (words_.size() * BITS_PER_WORD < names_by_id_.size())
+    {
+      // a deque never moves its elements, the bits given out stay valid
+      words_.emplace_back(0u);
+    }
+    return id;
+  }
+
+  bool make_unavailable(std::size_t id)
+  {
+    if ((get_word(id).fetch_and(~get_mask(id), std::memory_order_acq_rel) & get_mask(id)) == 0u)
+    {
+      return false;
+    }
+    version_.fetch_add(1u, std::memory_order_release);
+    return true;
+  }
+
+  std::atomic<uint64_t> & get_word(std::size_t id) { return words_[id / BITS_PER_WORD]; }
+  const std::atomic<uint64_t> & get_word(std::size_t id) const
+  {
+    return words_[id / BITS_PER_WORD];
+  }
+  static uint64_t get_mask(std::size_t id) { return uint64_t{1u} << (id % BITS_PER_WORD); }
+
+  /// IDs of the interfaces, never reused for another name until clear() is called
+  std::unordered_map<std::string_view, std::size_t> ids_;
+  /// Interned names of the interfaces, see NamePool
+  std::vector<const std::string *> names_by_id_;
+  /// Availability of the interfaces, one bit per ID
+  std::deque<std::atomic<uint64_t>> words_;
+  std::atomic<uint64_t> version_{0u};
+};
+
+/// Size of a cache line, used for aligning the contiguous interface value storage
+constexpr std::size_t INTERFACE_STORAGE_ALIGNMENT = 64;
+
+/// Period of the checks for the transitions requested by the control loop
+constexpr auto TRANSITION_POLL_PERIOD = std::chrono::milliseconds(5);
+
+/// One cache line of the contiguous interface value storage
+struct alignas(INTERFACE_STORAGE_ALIGNMENT) InterfaceValueCacheLine
+{
+  static constexpr std::size_t SIZE = INTERFACE_STORAGE_ALIGNMENT / sizeof(double);
+  double values[SIZE];
+};
+
+/// One cache line of the storage of the state interface values narrowed to float32
+struct alignas(INTERFACE_STORAGE_ALIGNMENT) Float32ValueCacheLine
+{
+  static constexpr std::size_t SIZE = INTERFACE_STORAGE_ALIGNMENT / sizeof(float);
+  float values[SIZE];
+};
+
+/// One cache line of the packed storage of the one byte interface values
+struct alignas(INTERFACE_STORAGE_ALIGNMENT) PackedValueCacheLine
+{
+  static constexpr std::size_t SIZE = INTERFACE_STORAGE_ALIGNMENT;
+  uint8_t values[SIZE];
+};
+
+/// Results of the last read and write of a hardware bus, failing the read or write of its members
+struct HardwareBusCycleState
+{
+  return_type read = return_type::OK;
+  return_type write = return_type::OK;
+};
+
+/// Precomputed data of a hardware component used in every read/write cycle
+struct HardwareComponentCycleContext
+{
+  /// Information about the component, owned by the hardware_info_map_ of the storage
+  HardwareComponentInfo * info = nullptr;
+  /// Slots of the read and write statistics of the component in the statistics table of the
+  /// storage, nullptr if not collected
+  HardwareComponentStatisticsData * read_statistics = nullptr;
+  HardwareComponentStatisticsData * write_statistics = nullptr;
+  /// State of the hardware component group, nullptr if the component doesn't belong to a group
+  return_type * group_state = nullptr;
+  /// State of the bus of the component, nullptr if the component doesn't exchange its data through
+  /// a bus
+  const HardwareBusCycleState * bus_state = nullptr;
+  /// True if the component is read and written at every update cycle of the controller manager
+  bool runs_at_cm_rate = true;
+  /// Read and write rate of the component in Hz
+  double rw_rate = 0.0;
+  /// Cycles of the read and the write of a component whose rate divides the update rate
+  RateDivider read_rate_divider;
+  RateDivider write_rate_divider;
+  /// Load of the component used to spread the phases, its measured read and write time
+  double rate_phase_load = 1.0;
+  /// Budgets of the execution time of the read and the write of a synchronous component
+  TimeBudget read_time_budget;
+  TimeBudget write_time_budget;
+  /// Result of the last read or write of the component, combined with the state of its group
+  return_type result = return_type::OK;
+  /// True if the last read or write was skipped, because the component was locked or shed
+  bool skipped = false;
+  /// True if the overload governor of the controller manager can shed the component
+  bool auxiliary = false;
+  /// Trace name ids of the read and the write of the component
+  uint32_t read_trace_id = 0;
+  uint32_t write_trace_id = 0;
+  /// CPU core of the last read or write of the component, -1 if not recorded yet
+  int last_cpu = -1;
+  /// Availability of the interfaces of the component, cleared when the read or write fails
+  std::vector<AvailableInterfaces::AvailabilityBit> state_interfaces_availability;
+  std::vector<AvailableInterfaces::AvailabilityBit> command_interfaces_availability;
+};
+
+/// Returns true if the component is inactive or active, i.e., its read and write are triggered
+template <class HardwareT>
+bool is_configured(const HardwareT & component)
+{
+  const auto lifecycle_id = component.get_lifecycle_id();
+  return lifecycle_id == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE ||
+         lifecycle_id == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE;
+}
+
+/// Records the CPU core of the read or write of the component, and counts the migrations between
+/// cores, after which the data of the component is transferred from the cache of another core
+void record_cycle_cpu(
+  HardwareComponentCycleContext & cycle_context, HardwareComponentStatisticsData & statistics)
+{
+#if defined(__linux__)
+  const int cpu = sched_getcpu();
+#else
+  const int cpu = -1;
+#endif
+  if (cpu < 0)
+  {
+    return;
+  }
+  if (cycle_context.last_cpu >= 0 && cycle_context.last_cpu != cpu)
+  {
+    ++statistics.cpu_migrations;
+  }
+  cycle_context.last_cpu = cpu;
+  statistics.cpu = cpu;
+}
+
+/// Command interfaces of a hardware component to start and to stop in a command mode switch
+struct CommandModeSwitchEntry
+{
+  HardwareComponent * component = nullptr;
+  std::vector<std::string> start_interfaces;
+  std::vector<std::string> stop_interfaces;
+};
+
+/// Command mode switch resolved per hardware component.
+/**
+ * The plan is built by prepare_command_mode_switch outside of the real-time loop, so that
+ * perform_command_mode_switch only calls the components, without allocating memory or searching
+ * the interfaces of every component.
+ */
+struct CommandModeSwitchPlan
+{
+  /// Interfaces of the switch the plan was built for
+  std::vector<std::string> start_interfaces;
+  std::vector<std::string> stop_interfaces;
+  /// Components with interfaces to switch, in the order of the actuators and of the systems
+  std::vector<CommandModeSwitchEntry> actuator_entries;
+  std::vector<CommandModeSwitchEntry> system_entries;
+  /// True if the plan was prepared and not performed yet
+  bool valid = false;
+};
+
+/// Executes the read or the write of a component and checks its execution time against a budget.
+/**
+ * \returns OK without executing if the previous execution exceeded the budget with the
+ * SKIP_NEXT_CYCLE policy, and ERROR if the execution exceeds the budget with the ERROR policy.
+ */
+template <typename ExecuteT>
+return_type execute_within_time_budget(
+  TimeBudget & budget, const rclcpp::Logger & logger, rclcpp::Clock & clock,
+  const std::string & component_name, const char * cycle_name, ExecuteT && execute)
+{
+  if (!budget.is_enabled())
+  {
+    return execute();
+  }
+  if (budget.consume_skip())
+  {
+    RCLCPP_DEBUG(
+      logger, "Skipping %s() of the component '%s' after it exceeded its time budget", cycle_name,
+      component_name.c_str());
+    return return_type::OK;
+  }
+  const auto start_time = InstrumentationClock::now();
+  auto ret_val = execute();
+  const double execution_time_us =
+    std::chrono::duration<double, std::micro>(InstrumentationClock::now() - start_time)
+      .count();
+  if (budget.check(execution_time_us))
+  {
+    RCLCPP_WARN_THROTTLE(
+      logger, clock, 1000,
+      "The %s() of the component '%s' took %.1f us and exceeded its time budget of %.1f us "
+      "(%u overruns).",
+      cycle_name, component_name.c_str(), execution_time_us, budget.budget_us, budget.overruns);
+    if (budget.policy == TimeBudgetPolicy::ERROR)
+    {
+      ret_val = return_type::ERROR;
+    }
+  }
+  return ret_val;
+}
+
 class ResourceStorage
 {
   static constexpr const char * pkg_name = "hardware_interface";
@@ -130,6 +662,10 @@ class ResourceStorage
   static constexpr const char * actuator_interface_name = "hardware_interface::ActuatorInterface";
   static constexpr const char * sensor_interface_name = "hardware_interface::SensorInterface";
   static constexpr const char * system_interface_name = "hardware_interface::SystemInterface";
+  static constexpr const char * transmission_stage_interface_name =
+    "hardware_interface::TransmissionStageInterface";
+  static constexpr const char * hardware_bus_interface_name =
+    "hardware_interface::HardwareBusInterface";
 
 public:
   // TODO(VX792): Change this when HW ifs get their own update rate,
@@ -176,6 +712,12 @@ public:
     handle_exception_ = rm_param.handle_exceptions;
   }
 
+  ~ResourceStorage()
+  {
+    release_packed_interface_storage();
+    release_contiguous_interface_storage();
+  }
+
   template <class HardwareT, class HardwareInterfaceT>
   [[nodiscard]] bool load_hardware(
     const HardwareInfo & hardware_info, pluginlib::ClassLoader<HardwareInterfaceT> & loader,
@@ -185,14 +727,21 @@ public:
     try
     {
       RCLCPP_INFO(get_logger(), "Loading hardware '%s' ", hardware_info.name.c_str());
+      // the plugins compiled into the executable are created without pluginlib
+      const bool is_static_plugin = StaticPluginRegistry<HardwareInterfaceT>::is_class_available(
+        hardware_info.hardware_plugin_name);
       // hardware_plugin_name has to match class name in plugin xml description
-      auto interface = std::unique_ptr<HardwareInterfaceT>(
-        loader.createUnmanagedInstance(hardware_info.hardware_plugin_name));
+      auto interface =
+        is_static_plugin
+          ? StaticPluginRegistry<HardwareInterfaceT>::create_unique_instance(
+              hardware_info.hardware_plugin_name)
+          : std::unique_ptr<HardwareInterfaceT>(
+              loader.createUnmanagedInstance(hardware_info.hardware_plugin_name));
       if (interface)
       {
         RCLCPP_INFO(
-          get_logger(), "Loaded hardware '%s' from plugin '%s'", hardware_info.name.c_str(),
-          hardware_info.hardware_plugin_name.c_str());
+          get_logger(), "Loaded hardware '%s' from %splugin '%s'", hardware_info.name.c_str(),
+          is_static_plugin ? "static " : "", hardware_info.hardware_plugin_name.c_str());
         HardwareT hardware(std::move(interface));
         container.emplace_back(std::move(hardware));
         // initialize static data about hardware component to reduce later calls
@@ -200,21 +749,42 @@ public:
         component_info.name = hardware_info.name;
         component_info.type = hardware_info.type;
         component_info.group = hardware_info.group;
+        component_info.resource_namespace = hardware_info.resource_namespace;
         component_info.rw_rate = hardware_info.rw_rate;
+        component_info.rw_phase = hardware_info.rw_phase;
+        component_info.time_budget_us = hardware_info.time_budget_us;
+        component_info.time_budget_policy = hardware_info.time_budget_policy;
+        component_info.criticality = hardware_info.criticality;
+        component_info.recovery_params = hardware_info.recovery_params;
         component_info.plugin_name = hardware_info.hardware_plugin_name;
         component_info.is_async = hardware_info.is_async;
-        component_info.read_statistics = std::make_shared<HardwareComponentStatisticsData>();
+        component_info.read_statistics = statistics_table_.acquire();
+        if (memory_arena_size_ > 0)
+        {
+          component_info.memory_arena = std::make_shared<MemoryArena>(memory_arena_size_);
+          if (!component_info.memory_arena->is_locked())
+          {
+            RCLCPP_WARN(
+              get_logger(),
+              "The memory arena of hardware '%s' can't be locked in RAM, its pages may be "
+              "swapped out. Check the memlock limit of the process.",
+              hardware_info.name.c_str());
+          }
+        }
 
         // if the type of the hardware is sensor then don't initialize the write statistics
         if (hardware_info.type != "sensor")
         {
-          component_info.write_statistics = std::make_shared<HardwareComponentStatisticsData>();
+          component_info.write_statistics = statistics_table_.acquire();
         }
 
         hardware_info_map_.insert(std::make_pair(component_info.name, component_info));
         hw_group_state_.insert(std::make_pair(component_info.group, return_type::OK));
-        hardware_used_by_controllers_.insert(
-          std::make_pair(component_info.name, std::vector<std::string>()));
+        if (!component_info.resource_namespace.empty())
+        {
+          namespace_components_[component_info.resource_namespace].push_back(
+            component_info.name);
+        }
         is_loaded = true;
       }
       else
@@ -251,6 +821,36 @@ public:
   template <class HardwareT>
   bool initialize_hardware(
     const hardware_interface::HardwareComponentParams & params, HardwareT & hardware)
+  {
+    const bool result = initialize_hardware_component(params, hardware);
+    if (result)
+    {
+      record_component_transmissions(params.hardware_info);
+      record_component_bus(params.hardware_info);
+    }
+    return result;
+  }
+
+  void record_component_transmissions(const HardwareInfo & hardware_info)
+  {
+    if (!hardware_info.transmissions.empty())
+    {
+      component_transmissions_[hardware_info.name] = hardware_info.transmissions;
+    }
+  }
+
+  void record_component_bus(const HardwareInfo & hardware_info)
+  {
+    if (!hardware_info.bus.empty())
+    {
+      component_bus_infos_[hardware_info.name] = hardware_info;
+    }
+  }
+
+  /// Initializes the component, only accessing the component and the read-only storage members.
+  template <class HardwareT>
+  bool initialize_hardware_component(
+    const hardware_interface::HardwareComponentParams & params, HardwareT & hardware)
   {
     hardware_interface::HardwareComponentParams component_params;
     component_params.hardware_info = params.hardware_info;
@@ -260,6 +860,21 @@ public:
         "hardware_component.{}.{}", params.hardware_info.type, params.hardware_info.name));
     component_params.executor = params.executor;
     component_params.node_namespace = params.node_namespace;
+    component_params.async_worker_pool = params.async_worker_pool;
+    component_params.thread_stack_prefault_size = thread_stack_prefault_size_;
+    // the recovery runs after the error transition, which is then deferred to the transition
+    // thread
+    component_params.defer_control_loop_transitions =
+      defer_control_loop_transitions_ || params.hardware_info.recovery_params.max_attempts > 0;
+    component_params.aggregate_hardware_status = hardware_status_aggregator_ != nullptr;
+    component_params.warm_restart = params.warm_restart;
+    // the arena is created when the component is loaded, the map isn't modified concurrently
+    const auto component_info = hardware_info_map_.find(params.hardware_info.name);
+    if (component_info != hardware_info_map_.end() && component_info->second.memory_arena)
+    {
+      component_params.memory_arena =
+        std::const_pointer_cast<MemoryArena>(component_info->second.memory_arena);
+    }
     RCLCPP_INFO(
       get_logger(), "Initialize hardware '%s' ", component_params.hardware_info.name.c_str());
 
@@ -300,8 +915,35 @@ public:
     return result;
   }
 
+  /// Change of the available lists deferred while the components are set concurrently
+  enum class AvailabilityUpdate
+  {
+    ADD,
+    REMOVE
+  };
+
+  /// Applies the change of the available lists, or defers it if \p deferred_updates is set
+  void update_available_interfaces(
+    const std::string & hardware_name, AvailabilityUpdate update,
+    std::vector<AvailabilityUpdate> * deferred_updates)
+  {
+    if (deferred_updates)
+    {
+      deferred_updates->push_back(update);
+    }
+    else if (update == AvailabilityUpdate::ADD)
+    {
+      add_all_hardware_interfaces_to_available_list(hardware_name);
+    }
+    else
+    {
+      remove_all_hardware_interfaces_from_available_list(hardware_name);
+    }
+  }
+
   template <class HardwareT>
-  bool configure_hardware(HardwareT & hardware)
+  bool configure_hardware(
+    HardwareT & hardware, std::vector<AvailabilityUpdate> * deferred_updates = nullptr)
   {
     bool result = false;
     try
@@ -327,61 +969,7 @@ public:
 
     if (result)
     {
-      // TODO(destogl): is it better to check here if previous state was unconfigured instead of
-      // checking if each state already exists? Or we should somehow know that transition has
-      // happened and only then trigger this part of the code?
-      // On the other side this part of the code should never be executed in real-time critical
-      // thread, so it could be also OK as it is...
-      for (const auto & interface : hardware_info_map_[hardware.get_name()].state_interfaces)
-      {
-        // add all state interfaces to available list
-        auto found_it = std::find(
-          available_state_interfaces_.begin(), available_state_interfaces_.end(), interface);
-
-        if (found_it == available_state_interfaces_.end())
-        {
-          available_state_interfaces_.emplace_back(interface);
-          RCLCPP_DEBUG(
-            get_logger(), "(hardware '%s'): '%s' state interface added into available list",
-            hardware.get_name().c_str(), interface.c_str());
-        }
-        else
-        {
-          // TODO(destogl): do here error management if interfaces are only partially added into
-          // "available" list - this should never be the case!
-          RCLCPP_WARN(
-            get_logger(),
-            "(hardware '%s'): '%s' state interface already in available list."
-            " This can happen due to multiple calls to 'configure'",
-            hardware.get_name().c_str(), interface.c_str());
-        }
-      }
-
-      // add command interfaces to available list
-      for (const auto & interface : hardware_info_map_[hardware.get_name()].command_interfaces)
-      {
-        // TODO(destogl): check if interface should be available on configure
-        auto found_it = std::find(
-          available_command_interfaces_.begin(), available_command_interfaces_.end(), interface);
-
-        if (found_it == available_command_interfaces_.end())
-        {
-          available_command_interfaces_.emplace_back(interface);
-          RCLCPP_DEBUG(
-            get_logger(), "(hardware '%s'): '%s' command interface added into available list",
-            hardware.get_name().c_str(), interface.c_str());
-        }
-        else
-        {
-          // TODO(destogl): do here error management if interfaces are only partially added into
-          // "available" list - this should never be the case!
-          RCLCPP_WARN(
-            get_logger(),
-            "(hardware '%s'): '%s' command interface already in available list."
-            " This can happen due to multiple calls to 'configure'",
-            hardware.get_name().c_str(), interface.c_str());
-        }
-      }
+      update_available_interfaces(hardware.get_name(), AvailabilityUpdate::ADD, deferred_updates);
     }
     if (!hardware.get_group_name().empty())
     {
@@ -390,19 +978,20 @@ public:
     return result;
   }
 
-  void remove_all_hardware_interfaces_from_available_list(const std::string & hardware_name)
+  void add_all_hardware_interfaces_to_available_list(const std::string & hardware_name)
   {
-    // remove all command interfaces from available list
-    for (const auto & interface : hardware_info_map_[hardware_name].command_interfaces)
+    // TODO(destogl): is it better to check here if previous state was unconfigured instead of
+    // checking if each state already exists? Or we should somehow know that transition has
+    // happened and only then trigger this part of the code?
+    // On the other side this part of the code should never be executed in real-time critical
+    // thread, so it could be also OK as it is...
+    for (const auto & interface : hardware_info_map_[hardware_name].state_interfaces)
     {
-      auto found_it = std::find(
-        available_command_interfaces_.begin(), available_command_interfaces_.end(), interface);
-
-      if (found_it != available_command_interfaces_.end())
+      // add all state interfaces to available list
+      if (available_state_interfaces_.make_available(interface))
       {
-        available_command_interfaces_.erase(found_it);
         RCLCPP_DEBUG(
-          get_logger(), "(hardware '%s'): '%s' command interface removed from available list",
+          get_logger(), "(hardware '%s'): '%s' state interface added into available list",
           hardware_name.c_str(), interface.c_str());
       }
       else
@@ -411,20 +1000,81 @@ public:
         // "available" list - this should never be the case!
         RCLCPP_WARN(
           get_logger(),
-          "(hardware '%s'): '%s' command interface not in available list. "
-          "This should not happen (hint: multiple cleanup calls).",
+          "(hardware '%s'): '%s' state interface already in available list."
+          " This can happen due to multiple calls to 'configure'",
           hardware_name.c_str(), interface.c_str());
       }
     }
-    // remove all state interfaces from available list
-    for (const auto & interface : hardware_info_map_[hardware_name].state_interfaces)
-    {
-      auto found_it = std::find(
-        available_state_interfaces_.begin(), available_state_interfaces_.end(), interface);
 
-      if (found_it != available_state_interfaces_.end())
+    // add command interfaces to available list
+    for (const auto & interface : hardware_info_map_[hardware_name].command_interfaces)
+    {
+      // TODO(destogl): check if interface should be available on configure
+      if (available_command_interfaces_.make_available(interface))
+      {
+        RCLCPP_DEBUG(
+          get_logger(), "(hardware '%s'): '%s' command interface added into available list",
+          hardware_name.c_str(), interface.c_str());
+      }
+      else
+      {
+        // TODO(destogl): do here error management if interfaces are only partially added into
+        // "available" list - this should never be the case!
+        RCLCPP_WARN(
+          get_logger(),
+          "(hardware '%s'): '%s' command interface already in available list."
+          " This can happen due to multiple calls to 'configure'",
+          hardware_name.c_str(), interface.c_str());
+      }
+    }
+  }
+
+  /// Removes the interfaces of a component that failed in the real-time loop from the available
+  /// lists.
+  /**
+   * \note This method is real-time safe, it only clears the availability bits resolved in the
+   * cycle context of the component by update_cycle_contexts().
+   */
+  void remove_all_hardware_interfaces_from_available_list(
+    const HardwareComponentCycleContext & cycle_context)
+  {
+    for (const auto & availability : cycle_context.command_interfaces_availability)
+    {
+      availability.clear();
+    }
+    for (const auto & availability : cycle_context.state_interfaces_availability)
+    {
+      availability.clear();
+    }
+  }
+
+  void remove_all_hardware_interfaces_from_available_list(const std::string & hardware_name)
+  {
+    // remove all command interfaces from available list
+    for (const auto & interface : hardware_info_map_[hardware_name].command_interfaces)
+    {
+      if (available_command_interfaces_.make_unavailable(interface))
+      {
+        RCLCPP_DEBUG(
+          get_logger(), "(hardware '%s'): '%s' command interface removed from available list",
+          hardware_name.c_str(), interface.c_str());
+      }
+      else
+      {
+        // TODO(destogl): do here error management if interfaces are only partially added into
+        // "available" list - this should never be the case!
+        RCLCPP_WARN(
+          get_logger(),
+          "(hardware '%s'): '%s' command interface not in available list. "
+          "This should not happen (hint: multiple cleanup calls).",
+          hardware_name.c_str(), interface.c_str());
+      }
+    }
+    // remove all state interfaces from available list
+    for (const auto & interface : hardware_info_map_[hardware_name].state_interfaces)
+    {
+      if (available_state_interfaces_.make_unavailable(interface))
       {
-        available_state_interfaces_.erase(found_it);
         RCLCPP_DEBUG(
           get_logger(), "(hardware '%s'): '%s' state interface removed from available list",
           hardware_name.c_str(), interface.c_str());
@@ -443,7 +1093,8 @@ public:
   }
 
   template <class HardwareT>
-  bool cleanup_hardware(HardwareT & hardware)
+  bool cleanup_hardware(
+    HardwareT & hardware, std::vector<AvailabilityUpdate> * deferred_updates = nullptr)
   {
     bool result = false;
     try
@@ -469,7 +1120,8 @@ public:
 
     if (result)
     {
-      remove_all_hardware_interfaces_from_available_list(hardware.get_name());
+      update_available_interfaces(
+        hardware.get_name(), AvailabilityUpdate::REMOVE, deferred_updates);
     }
     if (!hardware.get_group_name().empty())
     {
@@ -479,7 +1131,8 @@ public:
   }
 
   template <class HardwareT>
-  bool shutdown_hardware(HardwareT & hardware)
+  bool shutdown_hardware(
+    HardwareT & hardware, std::vector<AvailabilityUpdate> * deferred_updates = nullptr)
   {
     bool result = false;
     try
@@ -505,7 +1158,8 @@ public:
 
     if (result)
     {
-      remove_all_hardware_interfaces_from_available_list(hardware.get_name());
+      update_available_interfaces(
+        hardware.get_name(), AvailabilityUpdate::REMOVE, deferred_updates);
       // TODO(destogl): change this - deimport all things if there is there are interfaces there
       // deimport_non_movement_command_interfaces(hardware);
       // deimport_state_interfaces(hardware);
@@ -521,6 +1175,8 @@ public:
   template <class HardwareT>
   bool activate_hardware(HardwareT & hardware)
   {
+    // the real-time loop doesn't write the interfaces of the component before its activation
+    move_component_memory_to_numa_node(hardware.get_name());
     bool result = false;
     try
     {
@@ -578,8 +1234,15 @@ public:
     return result;
   }
 
+  /// Takes care of all the transitions needed to reach the target state.
+  /**
+   * \param[in] deferred_updates if set, the changes of the available lists are appended to it
+   * instead of being applied, e.g., when the component is set concurrently with others.
+   */
   template <class HardwareT>
-  bool set_component_state(HardwareT & hardware, const rclcpp_lifecycle::State & target_state)
+  bool set_component_state(
+    HardwareT & hardware, const rclcpp_lifecycle::State & target_state,
+    std::vector<AvailabilityUpdate> * deferred_updates = nullptr)
   {
     using lifecycle_msgs::msg::State;
 
@@ -594,13 +1257,13 @@ public:
             result = true;
             break;
           case State::PRIMARY_STATE_INACTIVE:
-            result = cleanup_hardware(hardware);
+            result = cleanup_hardware(hardware, deferred_updates);
             break;
           case State::PRIMARY_STATE_ACTIVE:
             result = deactivate_hardware(hardware);
             if (result)
             {
-              result = cleanup_hardware(hardware);
+              result = cleanup_hardware(hardware, deferred_updates);
             }
             break;
           case State::PRIMARY_STATE_FINALIZED:
@@ -615,7 +1278,7 @@ public:
         switch (hardware.get_lifecycle_id())
         {
           case State::PRIMARY_STATE_UNCONFIGURED:
-            result = configure_hardware(hardware);
+            result = configure_hardware(hardware, deferred_updates);
             break;
           case State::PRIMARY_STATE_INACTIVE:
             result = true;
@@ -635,7 +1298,7 @@ public:
         switch (hardware.get_lifecycle_id())
         {
           case State::PRIMARY_STATE_UNCONFIGURED:
-            result = configure_hardware(hardware);
+            result = configure_hardware(hardware, deferred_updates);
             if (result)
             {
               result = activate_hardware(hardware);
@@ -659,13 +1322,13 @@ public:
         switch (hardware.get_lifecycle_id())
         {
           case State::PRIMARY_STATE_UNCONFIGURED:
-            result = shutdown_hardware(hardware);
+            result = shutdown_hardware(hardware, deferred_updates);
             break;
           case State::PRIMARY_STATE_INACTIVE:
-            result = shutdown_hardware(hardware);
+            result = shutdown_hardware(hardware, deferred_updates);
             break;
           case State::PRIMARY_STATE_ACTIVE:
-            result = deactivate_hardware(hardware) && shutdown_hardware(hardware);
+            result = deactivate_hardware(hardware) && shutdown_hardware(hardware, deferred_updates);
             break;
           case State::PRIMARY_STATE_FINALIZED:
             result = true;
@@ -681,6 +1344,112 @@ public:
     return result;
   }
 
+  /// Sets the state of the components, concurrently for the components of different groups.
+  /**
+   * The components of the same group may share a bus or a device, they are set one after the
+   * other in order. The available lists are only updated once all the components are set, for the
+   * components whose lifecycle state changed.
+   * \param[in] component_names names of the components, only the first of duplicates is set.
+   * \param[in] target_state state to set for all the components.
+   * \param[in] number_of_threads maximum number of threads setting the components.
+   * \return the result for each component, false for the unknown or the failed components.
+   * \throws the exception of the first component that threw, in the order of \p component_names,
+   * if the exceptions are not handled. The available lists are updated before it is thrown.
+   */
+  std::vector<bool> set_components_state_concurrently(
+    const std::vector<std::string> & component_names, const rclcpp_lifecycle::State & target_state,
+    unsigned int number_of_threads)
+  {
+    struct PendingTransition
+    {
+      std::function<bool()> set_state;
+      std::vector<AvailabilityUpdate> availability_updates;
+      bool result = false;
+      std::exception_ptr exception = nullptr;
+    };
+    std::vector<PendingTransition> pending(component_names.size());
+    std::vector<std::string> groups(component_names.size());
+    auto find_component = [this, &target_state](
+                            const std::string & name, auto & container,
+                            PendingTransition & transition, std::string & group)
+    {
+      auto it = std::find_if(
+        container.begin(), container.end(),
+        [&name](const auto & component) { return component.get_name() == name; });
+      if (it == container.end())
+      {
+        return false;
+      }
+      transition.set_state = [this, &component = *it, &target_state, &transition]()
+      { return set_component_state(component, target_state, &transition.availability_updates); };
+      group = it->get_group_name();
+      return true;
+    };
+    std::unordered_set<std::string> listed_names;
+    for (std::size_t i = 0; i < component_names.size(); ++i)
+    {
+      const auto & name = component_names[i];
+      if (!listed_names.insert(name).second)
+      {
+        RCLCPP_ERROR(
+          get_logger(), "Hardware Component with name '%s' is listed more than once", name.c_str());
+        continue;
+      }
+      if (
+        !find_component(name, actuators_, pending[i], groups[i]) &&
+        !find_component(name, sensors_, pending[i], groups[i]) &&
+        !find_component(name, systems_, pending[i], groups[i]))
+      {
+        RCLCPP_INFO(
+          get_logger(), "Hardware Component with name '%s' does not exists", name.c_str());
+      }
+    }
+
+    const auto units = group_into_units(groups);
+    run_units_concurrently(
+      units, get_units_threads_count(number_of_threads, units.size()),
+      [&pending](std::size_t i)
+      {
+        if (!pending[i].set_state)
+        {
+          return;
+        }
+        try
+        {
+          pending[i].result = pending[i].set_state();
+        }
+        catch (...)
+        {
+          pending[i].exception = std::current_exception();
+        }
+      });
+
+    std::vector<bool> results(component_names.size(), false);
+    std::exception_ptr exception = nullptr;
+    for (std::size_t i = 0; i < component_names.size(); ++i)
+    {
+      auto & transition = pending[i];
+      if (!transition.set_state)
+      {
+        continue;
+      }
+      results[i] = transition.result;
+      if (!exception)
+      {
+        exception = transition.exception;
+      }
+      for (const auto update : transition.availability_updates)
+      {
+        update_available_interfaces(component_names[i], update, nullptr);
+      }
+    }
+    if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+    return results;
+  }
+
   template <class HardwareT>
   void import_state_interfaces(HardwareT & hardware)
   {
@@ -689,6 +1458,10 @@ public:
       auto interfaces = hardware.export_state_interfaces();
       const auto interface_names = add_state_interfaces(interfaces);
       hardware_info_map_[hardware.get_name()].state_interfaces = interface_names;
+      for (const auto & interface_name : interface_names)
+      {
+        state_interface_read_stamps_[interface_name] = hardware.get_read_stamp();
+      }
 
       RCLCPP_WARN_EXPRESSION(
         get_logger(), interface_names.empty(),
@@ -727,7 +1500,7 @@ public:
         command_interface->get_name());
       throw std::runtime_error(msg);
     }
-    command_interface->registerIntrospection();
+    register_introspection(*command_interface);
   }
 
   // BEGIN (Handle export change): for backward compatibility, can be removed if
@@ -757,8 +1530,6 @@ public:
       auto interfaces = hardware.export_command_interfaces();
       hardware_info_map_[hardware.get_name()].command_interfaces =
         add_command_interfaces(interfaces);
-      start_interfaces_buffer_.reserve(start_interfaces_buffer_.capacity() + interfaces.size());
-      stop_interfaces_buffer_.reserve(stop_interfaces_buffer_.capacity() + interfaces.size());
       // TODO(Manuel) END: for backward compatibility
     }
     catch (const std::exception & ex)
@@ -796,6 +1567,9 @@ public:
       }
       return true;
     };
+    // the new limiters are prepared here and published into the slots of their joints, the
+    // real-time loop keeps using the previous limiter until it is swapped
+    std::unordered_map<std::string, std::unordered_set<std::string>> imported_limiters;
     for (const auto & hw_info : hardware_infos)
     {
       for (const auto & [joint_name, limits] : hw_info.limits)
@@ -809,7 +1583,7 @@ public:
         }
 
         std::vector<joint_limits::SoftJointLimits> soft_limits;
-        hard_joint_limits_.insert({joint_name, limits});
+        hard_joint_limits_.insert_or_assign(joint_name, limits);
         const std::vector<joint_limits::JointLimits> hard_limits{limits};
         joint_limits::JointInterfacesCommandLimiterData data;
         data.set_joint_name(joint_name);
@@ -818,39 +1592,57 @@ public:
         if (hw_info.soft_limits.find(joint_name) != hw_info.soft_limits.end())
         {
           soft_limits = {hw_info.soft_limits.at(joint_name)};
-          soft_joint_limits_.insert({joint_name, hw_info.soft_limits.at(joint_name)});
+          soft_joint_limits_.insert_or_assign(joint_name, hw_info.soft_limits.at(joint_name));
           RCLCPP_INFO(
             get_logger(), "Using SoftJointLimiter for joint '%s' in hardware '%s' : '%s'",
             joint_name.c_str(), hw_info.name.c_str(), soft_limits[0].to_string().c_str());
         }
         else
         {
+          soft_joint_limits_.erase(joint_name);
           RCLCPP_INFO(
             get_logger(), "Using JointLimiter for joint '%s' in hardware '%s' : '%s'",
             joint_name.c_str(), hw_info.name.c_str(), limits.to_string().c_str());
         }
-        std::unique_ptr<
-          joint_limits::JointLimiterInterface<joint_limits::JointControlInterfacesData>>
-          limits_interface;
-        if (soft_limits.empty())
+        // a single fused pass over the stages, the soft stage being active only with soft limits
+        auto pipeline = std::make_unique<joint_limits::JointLimiterPipeline>();
+        pipeline->init({joint_name}, hard_limits, soft_limits, nullptr, nullptr);
+        RCLCPP_INFO(
+          get_logger(), "Creating JointLimiterPipeline [%s] for joint '%s' in hardware '%s'",
+          joint_limits::JointLimiterPipeline::get_stages_string(pipeline->get_stages()).c_str(),
+          joint_name.c_str(), hw_info.name.c_str());
+        std::unique_ptr<JointLimiter> limits_interface = std::move(pipeline);
+        auto & slot = joint_limiters_interface_[hw_info.name][joint_name];
+        if (!slot)
         {
-          RCLCPP_INFO(
-            get_logger(), "Creating JointSaturationLimiter for joint '%s' in hardware '%s'",
-            joint_name.c_str(), hw_info.name.c_str());
-          limits_interface = std::make_unique<
-            joint_limits::JointSaturationLimiter<joint_limits::JointControlInterfacesData>>();
+          slot = std::make_shared<JointLimiterSlot>();
         }
-        else
+        slot->update(std::move(limits_interface));
+        imported_limiters[hw_info.name].insert(joint_name);
+      }
+    }
+    // the joints whose limits were removed from the description are not limited anymore
+    for (auto & [hw_name, limiters] : joint_limiters_interface_)
+    {
+      for (auto & [joint_name, slot] : limiters)
+      {
+        if (imported_limiters[hw_name].count(joint_name) > 0)
         {
-          RCLCPP_INFO(
-            get_logger(), "Creating JointSoftLimiter for joint '%s' in hardware '%s'",
-            joint_name.c_str(), hw_info.name.c_str());
-          limits_interface = std::make_unique<joint_limits::JointSoftLimiter>();
+          continue;
         }
-        limits_interface->init({joint_name}, hard_limits, soft_limits, nullptr, nullptr);
-        joint_limiters_interface_[hw_info.name].insert({joint_name, std::move(limits_interface)});
+        RCLCPP_INFO(
+          get_logger(), "Removing the limits of joint '%s' in hardware '%s'", joint_name.c_str(),
+          hw_name.c_str());
+        hard_joint_limits_.erase(joint_name);
+        soft_joint_limits_.erase(joint_name);
+        auto unlimited = std::make_unique<
+          joint_limits::JointSaturationLimiter<joint_limits::JointControlInterfacesData>>();
+        unlimited->init({joint_name}, {joint_limits::JointLimits()}, {}, nullptr, nullptr);
+        slot->update(std::move(unlimited));
       }
     }
+    joint_limits_store_->update(hard_joint_limits_, soft_joint_limits_);
+    resolve_joint_limiter_bindings();
   }
 
   template <typename T>
@@ -890,64 +1682,193 @@ public:
     fill_interface_data(hardware_interface::HW_IF_ACCELERATION, data.acceleration);
   }
 
-  template <typename T>
-  void update_joint_limiters_commands(
-    const joint_limits::JointControlInterfacesData & limited_command,
-    std::map<std::string, T> & interface_map)
+  /// Resolves the limiter, data and interfaces of every limited joint into joint_limiter_bindings_.
+  /**
+   * The interfaces of a joint are the "<joint>/<type>" state and command interfaces of the
+   * position, velocity, effort and acceleration types that exist at the time of the call.
+   *
+   * The bindings are published as a whole, the real-time loop keeps using the previous bindings
+   * until they are swapped.
+   *
+   * \note This method is not real-time safe and has to be called with the joint limiters lock
+   * whenever the limiters or the hardware interfaces change.
+   */
+  void resolve_joint_limiter_bindings()
   {
-    const auto set_interface_command =
-      [&](const std::string & interface_type, const std::optional<double> & data)
+    auto bindings = std::make_unique<std::vector<JointLimiterBinding>>();
+    for (auto & [hw_name, limiters] : joint_limiters_interface_)
     {
-      const std::string interface_name =
-        fmt::format(FMT_COMPILE("{}/{}"), limited_command.joint_name, interface_type);
-      if (data.has_value() && interface_map.find(interface_name) != interface_map.end())
+      for (auto & [joint_name, slot] : limiters)
       {
-        auto itf_handle = interface_map.at(interface_name);
-        std::unique_lock<std::shared_mutex> lock(itf_handle->get_mutex());
-        std::ignore = itf_handle->set_value(lock, data.value());
+        JointLimiterBinding binding;
+        binding.limiter = slot;
+        binding.data = &limiters_data_[joint_name];
+        for (std::size_t i = 0; i < JointLimiterBinding::INTERFACE_TYPES.size(); ++i)
+        {
+          const std::string interface_name = fmt::format(
+            FMT_COMPILE("{}/{}"), joint_name, JointLimiterBinding::INTERFACE_TYPES[i]);
+          const auto state_it = state_interface_map_.find(interface_name);
+          if (state_it != state_interface_map_.end())
+          {
+            binding.state_interfaces[i] = state_it->second;
+          }
+          const auto command_it = command_interface_map_.find(interface_name);
+          const auto claimed_it = claimed_command_interface_map_.find(interface_name);
+          if (
+            command_it != command_interface_map_.end() &&
+            claimed_it != claimed_command_interface_map_.end())
+          {
+            binding.command_interfaces[i] = command_it->second;
+            binding.command_claimed[i] = &claimed_it->second;
+          }
+        }
+        bindings->push_back(std::move(binding));
       }
-    };
-    // update the command data of the limiters
-    set_interface_command(hardware_interface::HW_IF_POSITION, limited_command.position);
-    set_interface_command(hardware_interface::HW_IF_VELOCITY, limited_command.velocity);
-    set_interface_command(hardware_interface::HW_IF_EFFORT, limited_command.effort);
-    set_interface_command(hardware_interface::HW_IF_ACCELERATION, limited_command.acceleration);
-  }
-
-  void update_joint_limiters_data(joint_limits::JointInterfacesCommandLimiterData & data)
-  {
-    update_joint_limiters_data(data.joint_name, state_interface_map_, data.actual);
-    update_joint_limiters_data(data.joint_name, command_interface_map_, data.command, true);
-    data.limited = data.command;
+    }
+    joint_limiter_bindings_.update(std::move(bindings));
   }
 
-  /// enforce the command limits for a specific joint
+  /// Enforces the command limits of all the joints in a single pass over the resolved bindings.
   /**
-   * @param joint_name name of the joint to enforce the command limits
+   * The values are exchanged directly with the interfaces resolved by
+   * resolve_joint_limiter_bindings(), without any string construction or map lookup.
+   *
+   * \note This method is real-time safe, it never waits for the limiters to be imported again.
    * @param period time period of the command
-   * @return true if the command interfaces are out of limits and the limits are enforced
+   * @return true if the command interfaces of any joint are out of limits and the limits are
+   * enforced
    * @return false if the command interfaces values are within limits
    * \throws std::runtime_error if the actual position is out of bounds if commanding position
    */
-  bool enforce_command_limits(const std::string & joint_name, const rclcpp::Duration & period)
+  bool enforce_command_limits(const rclcpp::Duration & period)
   {
     bool enforce_result = false;
-    for (auto & [hw_name, limiters] : joint_limiters_interface_)
+    const auto bindings = joint_limiter_bindings_.read();
+    if (!bindings)
+    {
+      return false;
+    }
+    for (auto & binding : *bindings.get())
     {
-      if (limiters.find(joint_name) != limiters.end())
+      auto & data = *binding.data;
+      for (std::size_t i = 0; i < JointLimiterBinding::INTERFACE_TYPES.size(); ++i)
+      {
+        const auto member = JointLimiterBinding::INTERFACE_MEMBERS[i];
+        if (binding.state_interfaces[i])
+        {
+          std::shared_lock<std::shared_mutex> lock(binding.state_interfaces[i]->get_mutex());
+          data.actual.*member = binding.state_interfaces[i]->get_optional(lock).value();
+        }
+        if (binding.command_interfaces[i])
+        {
+          // If the command interface is not claimed, then the value is not set
+          if (!*binding.command_claimed[i])
+          {
+            data.command.*member = std::nullopt;
+          }
+          else
+          {
+            std::shared_lock<std::shared_mutex> lock(binding.command_interfaces[i]->get_mutex());
+            data.command.*member = binding.command_interfaces[i]->get_optional(lock).value();
+          }
+        }
+      }
+      data.limited = data.command;
+      const auto limiter = binding.limiter->read();
+      if (!limiter || !limiter->enforce(data.actual, data.limited, period))
+      {
+        continue;
+      }
+      enforce_result = true;
+      for (std::size_t i = 0; i < JointLimiterBinding::INTERFACE_TYPES.size(); ++i)
       {
-        joint_limits::JointInterfacesCommandLimiterData & data = limiters_data_[joint_name];
-        update_joint_limiters_data(data);
-        enforce_result = limiters[joint_name]->enforce(data.actual, data.limited, period);
-        if (enforce_result)
+        const auto & value = data.limited.*JointLimiterBinding::INTERFACE_MEMBERS[i];
+        if (value.has_value() && binding.command_interfaces[i])
         {
-          update_joint_limiters_commands(data.limited, command_interface_map_);
+          std::unique_lock<std::shared_mutex> lock(binding.command_interfaces[i]->get_mutex());
+          std::ignore = binding.command_interfaces[i]->set_value(lock, value.value());
         }
       }
     }
     return enforce_result;
   }
 
+  bool is_introspected(const std::string & interface_name) const
+  {
+    return std::any_of(
+      introspected_interface_patterns_.begin(), introspected_interface_patterns_.end(),
+      [&interface_name](const std::string & pattern)
+      { return matches_interface_pattern(pattern, interface_name); });
+  }
+
+  /// Returns the names of the registered state or command interfaces, which can have the same
+  /// names
+  template <typename InterfaceT>
+  std::unordered_set<std::string> & get_introspected_interfaces()
+  {
+    if constexpr (std::is_same_v<InterfaceT, CommandInterface>)
+    {
+      return introspected_command_interfaces_;
+    }
+    else
+    {
+      return introspected_state_interfaces_;
+    }
+  }
+
+  /// Registers the introspection of the interface if its name matches one of the patterns
+  template <typename InterfaceT>
+  void register_introspection(const InterfaceT & interface)
+  {
+    if (is_introspected(interface.get_name()))
+    {
+      interface.registerIntrospection();
+      get_introspected_interfaces<InterfaceT>().insert(interface.get_name());
+    }
+  }
+
+  template <typename InterfaceT>
+  void unregister_introspection(const InterfaceT & interface)
+  {
+    if (get_introspected_interfaces<InterfaceT>().erase(interface.get_name()) > 0)
+    {
+      interface.unregisterIntrospection();
+    }
+  }
+
+  /// Registers the introspection of the interfaces matching the patterns, and unregisters the
+  /// other ones
+  void set_introspected_interfaces(const std::vector<std::string> & patterns)
+  {
+    if (patterns == introspected_interface_patterns_)
+    {
+      return;
+    }
+    introspected_interface_patterns_ = patterns;
+    const auto update = [this](const auto & interfaces)
+    {
+      for (const auto & [name, interface] : interfaces)
+      {
+        using InterfaceT = std::decay_t<decltype(*interface)>;
+        const bool registered = get_introspected_interfaces<InterfaceT>().count(name) > 0;
+        if (is_introspected(name) == registered)
+        {
+          continue;
+        }
+        if (registered)
+        {
+          unregister_introspection(*interface);
+        }
+        else
+        {
+          register_introspection(*interface);
+        }
+      }
+    };
+    update(state_interface_map_);
+    update(command_interface_map_);
+  }
+
   std::string add_state_interface(StateInterface::ConstSharedPtr interface)
   {
     auto interface_name = interface->get_name();
@@ -960,7 +1881,7 @@ public:
         interface->get_name());
       throw std::runtime_error(msg);
     }
-    interface->registerIntrospection();
+    register_introspection(*interface);
     return interface_name;
   }
   /// Adds exported state interfaces into internal storage.
@@ -984,6 +1905,7 @@ public:
       try
       {
         interface_names.push_back(add_state_interface(interface));
+        available_state_interfaces_.register_interface(interface_names.back());
       }
       // We don't want to crash during runtime because a StateInterface could not be added
       catch (const std::exception & e)
@@ -993,9 +1915,6 @@ public:
         handle_exception_ ? void() : throw;
       }
     }
-    available_state_interfaces_.reserve(
-      available_state_interfaces_.capacity() + interface_names.size());
-
     return interface_names;
   }
 
@@ -1009,8 +1928,10 @@ public:
   {
     for (const auto & interface : interface_names)
     {
-      state_interface_map_[interface]->unregisterIntrospection();
+      unregister_introspection(*state_interface_map_[interface]);
       state_interface_map_.erase(interface);
+      state_interface_read_stamps_.erase(interface);
+      available_state_interfaces_.unregister_interface(interface);
     }
   }
 
@@ -1034,10 +1955,9 @@ public:
       auto key = interface.get_name();
       insert_command_interface(std::move(interface));
       claimed_command_interface_map_.emplace(std::make_pair(key, false));
+      available_command_interfaces_.register_interface(key);
       interface_names.push_back(key);
     }
-    available_command_interfaces_.reserve(
-      available_command_interfaces_.capacity() + interface_names.size());
 
     return interface_names;
   }
@@ -1053,10 +1973,9 @@ public:
       bind_command_limiter_to_interface(interface);
       insert_command_interface(interface);
       claimed_command_interface_map_.emplace(std::make_pair(key, false));
+      available_command_interfaces_.register_interface(key);
       interface_names.push_back(key);
     }
-    available_command_interfaces_.reserve(
-      available_command_interfaces_.capacity() + interface_names.size());
 
     return interface_names;
   }
@@ -1079,7 +1998,8 @@ public:
         auto & limiters = entry.second;
 
         // If the prefix is a joint name, then bind the limiter to the command interface
-        if (limiters.find(interface->get_prefix_name()) != limiters.end())
+        const auto slot_it = limiters.find(interface->get_prefix_name());
+        if (slot_it != limiters.end())
         {
           const std::string & joint_name = interface->get_prefix_name();
           const rclcpp::Duration desired_period =
@@ -1097,7 +2017,8 @@ public:
               interface_name.c_str());
             continue;
           }
-          const auto limiter_fn = [this, joint_name, interface_name, desired_period, &limiters](
+          const auto limiter_fn = [this, joint_name, interface_name, desired_period,
+                                   slot = slot_it->second](
                                     double value, bool & is_limited) -> double
           {
             is_limited = false;
@@ -1125,7 +2046,8 @@ public:
               return value;
             }
             data.limited = data.command;
-            is_limited = limiters[joint_name]->enforce(data.actual, data.limited, desired_period);
+            const auto limiter = slot->read();
+            is_limited = limiter && limiter->enforce(data.actual, data.limited, desired_period);
             if (is_limited)
             {
               RCLCPP_ERROR_THROTTLE(
@@ -1170,7 +2092,8 @@ public:
 
   /// Removes command interfaces from internal storage.
   /**
-   * Command interface are removed from the maps with theirs storage and their claimed status.
+   * Command interface are removed from the maps with theirs storage. Their claimed status is kept
+   * as unclaimed, the joint limiter bindings still used by the real-time loop point to it.
    *
    * \param[interface_names] list of command interface names to remove from storage.
    */
@@ -1178,9 +2101,10 @@ public:
   {
     for (const auto & interface : interface_names)
     {
-      command_interface_map_[interface]->unregisterIntrospection();
+      unregister_introspection(*command_interface_map_[interface]);
       command_interface_map_.erase(interface);
-      claimed_command_interface_map_.erase(interface);
+      claimed_command_interface_map_[interface] = false;
+      available_command_interfaces_.unregister_interface(interface);
     }
   }
 
@@ -1260,109 +2184,1857 @@ public:
     return load_and_init_systems(systems_);
   }
 
-  void initialize_actuator(
-    std::unique_ptr<ActuatorInterface> actuator,
-    const hardware_interface::HardwareComponentParams & params)
+  /// Loads and initializes a hardware component of any type.
+  bool load_and_initialize_component(const hardware_interface::HardwareComponentParams & params)
   {
-    auto init_actuators = [&](auto & container)
+    const auto & type = params.hardware_info.type;
+    if (type == "actuator")
     {
-      container.emplace_back(Actuator(std::move(actuator)));
-      if (initialize_hardware(params, container.back()))
-      {
-        import_state_interfaces(container.back());
-        import_command_interfaces(container.back());
-      }
-      else
-      {
-        RCLCPP_WARN(
-          get_logger(), "Actuator hardware component '%s' from plugin '%s' failed to initialize.",
-          params.hardware_info.name.c_str(), params.hardware_info.hardware_plugin_name.c_str());
-      }
-    };
-
-    init_actuators(actuators_);
+      return load_and_initialize_actuator(params);
+    }
+    if (type == "sensor")
+    {
+      return load_and_initialize_sensor(params);
+    }
+    if (type == "system")
+    {
+      return load_and_initialize_system(params);
+    }
+    RCLCPP_ERROR(
+      get_logger(), "Hardware component '%s' has the unknown type '%s'.",
+      params.hardware_info.name.c_str(), type.c_str());
+    return false;
   }
 
-  void initialize_sensor(
-    std::unique_ptr<SensorInterface> sensor,
-    const hardware_interface::HardwareComponentParams & params)
+  /// Shuts a hardware component down and removes it and its interfaces from the storage.
+  /**
+   * \param[in] component_name name of the component to remove.
+   * \returns false if the component is not loaded.
+   * \note The interface storages and the cycle contexts have to be released before and rebuilt
+   * afterwards, they refer to the removed component.
+   */
+  bool unload_hardware_component(const std::string & component_name)
   {
-    auto init_sensors = [&](auto & container)
+    const auto info_it = hardware_info_map_.find(component_name);
+    if (info_it == hardware_info_map_.end())
     {
-      container.emplace_back(Sensor(std::move(sensor)));
-      if (initialize_hardware(params, container.back()))
+      return false;
+    }
+    const rclcpp_lifecycle::State finalized(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_FINALIZED, lifecycle_state_names::FINALIZED);
+    auto remove_component = [&](auto & container)
+    {
+      // the components are not move-assignable, so the kept ones are moved to a new container
+      std::remove_reference_t<decltype(container)> kept_components;
+      kept_components.reserve(container.size());
+      for (auto & component : container)
       {
-        import_state_interfaces(container.back());
+        if (component.get_name() == component_name)
+        {
+          set_component_state(component, finalized);
+        }
+        else
+        {
+          kept_components.emplace_back(std::move(component));
+        }
       }
-      else
+      container.swap(kept_components);
+    };
+    remove_component(actuators_);
+    remove_component(sensors_);
+    remove_component(systems_);
+
+    remove_state_interfaces(info_it->second.state_interfaces);
+    remove_command_interfaces(info_it->second.command_interfaces);
+    component_transmissions_.erase(component_name);
+    component_bus_infos_.erase(component_name);
+    component_descriptions_.erase(component_name);
+    const auto namespace_it = namespace_components_.find(info_it->second.resource_namespace);
+    if (namespace_it != namespace_components_.end())
+    {
+      std::ignore = ros2_control::remove_item(namespace_it->second, component_name);
+      if (namespace_it->second.empty())
       {
-        RCLCPP_WARN(
-          get_logger(), "Sensor hardware component '%s' from plugin '%s' failed to initialize.",
-          params.hardware_info.name.c_str(), params.hardware_info.hardware_plugin_name.c_str());
+        namespace_components_.erase(namespace_it);
       }
-    };
-
-    init_sensors(sensors_);
+    }
+    hardware_info_map_.erase(info_it);
+    RCLCPP_INFO(get_logger(), "Unloaded hardware '%s'", component_name.c_str());
+    return true;
   }
 
-  void initialize_system(
-    std::unique_ptr<SystemInterface> system,
-    const hardware_interface::HardwareComponentParams & params)
+  /// Calls \p function with the information of every component of a resource namespace.
+  /**
+   * The components of the sub-namespaces are included, e.g., those of "cell_1/arm" for
+   * "cell_1". The namespaces are sorted, so only the components of the namespace are visited,
+   * whatever the number of the other namespaces and components.
+   */
+  template <typename FunctionT>
+  void for_each_namespace_component(
+    const std::string & resource_namespace, FunctionT && function) const
   {
-    auto init_systems = [&](auto & container)
+    for (auto it = namespace_components_.lower_bound(resource_namespace);
+         it != namespace_components_.end() &&
+         it->first.compare(0, resource_namespace.size(), resource_namespace) == 0;
+         ++it)
     {
-      container.emplace_back(System(std::move(system)));
-      if (initialize_hardware(params, container.back()))
+      // skip the namespaces only sharing the prefix, e.g. "cell_10" for "cell_1"
+      if (
+        it->first.size() != resource_namespace.size() &&
+        it->first[resource_namespace.size()] != '/')
       {
-        import_state_interfaces(container.back());
-        import_command_interfaces(container.back());
+        continue;
       }
-      else
+      for (const auto & component_name : it->second)
       {
-        RCLCPP_WARN(
-          get_logger(), "System hardware component '%s' from plugin '%s' failed to initialize.",
-          params.hardware_info.name.c_str(), params.hardware_info.hardware_plugin_name.c_str());
+        function(hardware_info_map_.at(component_name));
+      }
+    }
+  }
+
+  /// Configures the storages and the stages that refer to the interfaces of all the components.
+  /**
+   * \param[in] params parameters of the resource manager.
+   * \param[in] hardware_info descriptions of the loaded hardware components.
+   * \note This method is not real-time safe and has to be called whenever a component is added or
+   * removed.
+   */
+  void configure_interface_storages(
+    const ResourceManagerParams & params, const std::vector<HardwareInfo> & hardware_info)
+  {
+    // the snapshots must not copy the values while they are relocated
+    if (state_snapshot_publisher_)
+    {
+      state_snapshot_publisher_->set_groups({});
+    }
+    // the narrowed interfaces don't hold a double anymore, so they are excluded from the
+    // contiguous storage
+    if (params.float32_state_interface_storage)
+    {
+      allocate_float32_state_interface_storage();
+    }
+    if (params.contiguous_interface_storage)
+    {
+      allocate_contiguous_interface_storage();
+    }
+    allocate_packed_interface_storage(hardware_info);
+    move_value_arenas_to_numa_node();
+    if (params.shared_memory_export.enable)
+    {
+      configure_shared_memory_export(params.shared_memory_export);
+    }
+    if (params.flight_recorder.enable)
+    {
+      configure_flight_recorder(params.flight_recorder);
+    }
+    if (params.remote_interface_export.enable)
+    {
+      configure_remote_interface_export(params.remote_interface_export);
+    }
+    if (!params.transmission_stage_plugin.empty())
+    {
+      load_transmission_stage(params.transmission_stage_plugin);
+      if (transmission_stage_)
+      {
+        transmission_stage_->set_in_place_binding(params.transmission_stage_in_place);
+      }
+      configure_transmission_stage();
+    }
+    configure_hardware_buses();
+    update_state_snapshot_groups();
+  }
+
+  /// Loads the components in order, then initializes independent components concurrently.
+  /**
+   * The plugins are created and registered sequentially in the order of the descriptions. The
+   * components of the same group are then initialized sequentially in that order, while the groups
+   * and the components without group are initialized concurrently by up to \p number_of_threads
+   * threads. The interfaces of the initialized components are imported in the order of the
+   * descriptions once all the initializations are finished, so that the result doesn't depend on
+   * the scheduling of the threads.
+   *
+   * \returns false if a component failed to be loaded or initialized. All the failures are
+   * reported, in the order of the descriptions.
+   * \throws the exception of the first failed component, in the order of the descriptions, if the
+   * exceptions are not handled.
+   */
+  bool load_and_initialize_components_concurrently(
+    const std::vector<hardware_interface::HardwareComponentParams> & components_params,
+    unsigned int number_of_threads)
+  {
+    struct PendingComponent
+    {
+      const hardware_interface::HardwareComponentParams * params;
+      std::function<bool()> initialize;
+      std::function<void()> import_interfaces;
+      bool initialized = false;
+      std::exception_ptr exception = nullptr;
+    };
+    std::vector<PendingComponent> pending;
+    pending.reserve(components_params.size());
+
+    // the containers don't grow anymore once all the plugins are loaded, so indices stay valid
+    auto add_pending =
+      [this, &pending](const hardware_interface::HardwareComponentParams & params, auto & container)
+    {
+      const std::size_t index = container.size() - 1;
+      pending.push_back(
+        {&params, [this, &params, &container, index]()
+         { return initialize_hardware_component(params, container[index]); },
+         [this, &params, &container, index]()
+         {
+           record_component_transmissions(params.hardware_info);
+           record_component_bus(params.hardware_info);
+           import_state_interfaces(container[index]);
+           if constexpr (!std::is_same_v<std::decay_t<decltype(container[index])>, Sensor>)
+           {
+             import_command_interfaces(container[index]);
+           }
+         }});
+    };
+    for (const auto & params : components_params)
+    {
+      const auto & info = params.hardware_info;
+      if (hardware_info_map_.find(info.name) != hardware_info_map_.end())
+      {
+        RCUTILS_LOG_ERROR_NAMED(
+          "resource_manager",
+          "Hardware name %s is duplicated. Please provide a unique 'name' "
+          "in the URDF.",
+          info.name.c_str());
+        return false;
+      }
+      auto load = [&](auto & loader, auto & container)
+      {
+        if (!load_hardware(info, loader, container))
+        {
+          return false;
+        }
+        add_pending(params, container);
+        return true;
+      };
+      bool is_loaded = true;
+      if (info.type == "actuator")
+      {
+        is_loaded = load(actuator_loader_, actuators_);
+      }
+      else if (info.type == "sensor")
+      {
+        is_loaded = load(sensor_loader_, sensors_);
+      }
+      else if (info.type == "system")
+      {
+        is_loaded = load(system_loader_, systems_);
+      }
+      if (!is_loaded)
+      {
+        return false;
+      }
+    }
+
+    // components of the same group may share a bus or a device, they are initialized in order
+    std::vector<std::string> groups;
+    groups.reserve(pending.size());
+    for (const auto & component : pending)
+    {
+      groups.push_back(component.params->hardware_info.group);
+    }
+    const auto units = group_into_units(groups);
+    const std::size_t threads_count = get_units_threads_count(number_of_threads, units.size());
+    RCLCPP_INFO(
+      get_logger(), "Initializing %zu hardware components with %zu threads.", pending.size(),
+      threads_count);
+    run_units_concurrently(
+      units, threads_count,
+      [&pending](std::size_t i)
+      {
+        try
+        {
+          pending[i].initialized = pending[i].initialize();
+        }
+        catch (...)
+        {
+          pending[i].exception = std::current_exception();
+        }
+      });
+
+    bool result = true;
+    for (auto & component : pending)
+    {
+      if (component.exception)
+      {
+        std::rethrow_exception(component.exception);
+      }
+      if (component.initialized)
+      {
+        component.import_interfaces();
+        continue;
+      }
+      RCLCPP_WARN(
+        get_logger(), "Hardware component '%s' of type '%s' from plugin '%s' failed to initialize.",
+        component.params->hardware_info.name.c_str(), component.params->hardware_info.type.c_str(),
+        component.params->hardware_info.hardware_plugin_name.c_str());
+      result = false;
+    }
+    return result;
+  }
+
+  void initialize_actuator(
+    std::unique_ptr<ActuatorInterface> actuator,
+    const hardware_interface::HardwareComponentParams & params)
+  {
+    auto init_actuators = [&](auto & container)
+    {
+      container.emplace_back(Actuator(std::move(actuator)));
+      if (initialize_hardware(params, container.back()))
+      {
+        import_state_interfaces(container.back());
+        import_command_interfaces(container.back());
+      }
+      else
+      {
+        RCLCPP_WARN(
+          get_logger(), "Actuator hardware component '%s' from plugin '%s' failed to initialize.",
+          params.hardware_info.name.c_str(), params.hardware_info.hardware_plugin_name.c_str());
+      }
+    };
+
+    init_actuators(actuators_);
+  }
+
+  void initialize_sensor(
+    std::unique_ptr<SensorInterface> sensor,
+    const hardware_interface::HardwareComponentParams & params)
+  {
+    auto init_sensors = [&](auto & container)
+    {
+      container.emplace_back(Sensor(std::move(sensor)));
+      if (initialize_hardware(params, container.back()))
+      {
+        import_state_interfaces(container.back());
+      }
+      else
+      {
+        RCLCPP_WARN(
+          get_logger(), "Sensor hardware component '%s' from plugin '%s' failed to initialize.",
+          params.hardware_info.name.c_str(), params.hardware_info.hardware_plugin_name.c_str());
+      }
+    };
+
+    init_sensors(sensors_);
+  }
+
+  void initialize_system(
+    std::unique_ptr<SystemInterface> system,
+    const hardware_interface::HardwareComponentParams & params)
+  {
+    auto init_systems = [&](auto & container)
+    {
+      container.emplace_back(System(std::move(system)));
+      if (initialize_hardware(params, container.back()))
+      {
+        import_state_interfaces(container.back());
+        import_command_interfaces(container.back());
+      }
+      else
+      {
+        RCLCPP_WARN(
+          get_logger(), "System hardware component '%s' from plugin '%s' failed to initialize.",
+          params.hardware_info.name.c_str(), params.hardware_info.hardware_plugin_name.c_str());
+      }
+    };
+
+    init_systems(systems_);
+  }
+
+  /// Moves the interface values of all hardware components into one contiguous memory arena.
+  /**
+   * The double values of the state and command interfaces are relocated into a single cache-line
+   * aligned allocation, so that a read → update → write cycle touches a few contiguous pages
+   * instead of the scattered heap nodes of the individual handles. The interfaces of every
+   * hardware component start at a new cache line to avoid false sharing between components that
+   * are accessed from different threads. Interfaces of other data types, lock-free interfaces and
+   * interfaces exported with the legacy pointer based API keep their own storage.
+   *
+   * \note This method is not real-time safe and has to be called before the interfaces are used.
+   */
+  void allocate_contiguous_interface_storage()
+  {
+    release_contiguous_interface_storage();
+
+    std::vector<std::vector<Handle *>> component_handles;
+    // components whose state values are all relocated, in their order, at the start of their block
+    std::vector<std::string> contiguous_state_components;
+    auto collect_handles = [&](const auto & container)
+    {
+      for (const auto & component : container)
+      {
+        const auto & info = hardware_info_map_.at(component.get_name());
+        std::vector<Handle *> handles;
+        for (const auto & name : info.state_interfaces)
+        {
+          // the storage owns the interfaces, so it is allowed to relocate their values
+          auto handle = std::const_pointer_cast<StateInterface>(state_interface_map_.at(name));
+          if (handle->has_relocatable_value_storage())
+          {
+            handles.push_back(handle.get());
+          }
+        }
+        contiguous_state_components.push_back(
+          handles.size() == info.state_interfaces.size() ? component.get_name() : "");
+        for (const auto & name : info.command_interfaces)
+        {
+          const auto & handle = command_interface_map_.at(name);
+          if (handle->has_relocatable_value_storage())
+          {
+            handles.push_back(handle.get());
+          }
+        }
+        component_handles.push_back(std::move(handles));
+      }
+    };
+    collect_handles(actuators_);
+    collect_handles(sensors_);
+    collect_handles(systems_);
+
+    std::size_t number_of_cache_lines = 0;
+    for (const auto & handles : component_handles)
+    {
+      number_of_cache_lines += (handles.size() + InterfaceValueCacheLine::SIZE - 1) /
+                               InterfaceValueCacheLine::SIZE;
+    }
+    interface_value_arena_.resize(number_of_cache_lines);
+
+    double * storage = interface_value_arena_.empty() ? nullptr : interface_value_arena_[0].values;
+    for (std::size_t c = 0; c < component_handles.size(); ++c)
+    {
+      const auto & handles = component_handles[c];
+      for (std::size_t i = 0; i < handles.size(); ++i)
+      {
+        handles[i]->relocate_value_storage(storage + i);
+        relocated_interface_handles_.push_back(handles[i]);
+      }
+      if (!contiguous_state_components[c].empty())
+      {
+        contiguous_state_values_[contiguous_state_components[c]] = storage;
+      }
+      storage += ((handles.size() + InterfaceValueCacheLine::SIZE - 1) /
+                  InterfaceValueCacheLine::SIZE) *
+                 InterfaceValueCacheLine::SIZE;
+    }
+    RCLCPP_INFO(
+      get_logger(),
+      "Allocated contiguous storage for %zu interface values of %zu hardware components (%zu "
+      "bytes).",
+      relocated_interface_handles_.size(), component_handles.size(),
+      interface_value_arena_.size() * sizeof(InterfaceValueCacheLine));
+  }
+
+  /// Narrows the double state interfaces to float32 and stores them densely, per hardware
+  /// component.
+  /**
+   * The state interfaces of type double are converted to float32, see
+   * Handle::narrow_to_float32(), and their values are relocated into a single cache-line aligned
+   * allocation, so that a cache line holds 16 states instead of 8 and the read/update/write cycle
+   * moves half the memory. The controllers using the typed views of type float read the values
+   * directly, the legacy accessors of type double convert them. The interfaces of every hardware
+   * component start at a new cache line to avoid false sharing between components that are
+   * accessed from different threads. Lock-free interfaces, interfaces with serial access and
+   * interfaces exported with the legacy pointer based API keep their double storage.
+   *
+   * \note This method is not real-time safe and has to be called before the interfaces are used.
+   */
+  void allocate_float32_state_interface_storage()
+  {
+    release_float32_state_interface_storage();
+
+    std::vector<std::vector<Handle *>> component_handles;
+    auto collect_handles = [&](const auto & container)
+    {
+      for (const auto & component : container)
+      {
+        const auto & info = hardware_info_map_.at(component.get_name());
+        std::vector<Handle *> handles;
+        for (const auto & name : info.state_interfaces)
+        {
+          // the storage owns the interfaces, so it is allowed to relocate their values
+          auto handle = std::const_pointer_cast<StateInterface>(state_interface_map_.at(name));
+          if (handle->has_narrowable_value_storage())
+          {
+            handle->narrow_to_float32();
+          }
+          if (handle->is_narrowed_to_float32() && handle->has_relocatable_float32_value_storage())
+          {
+            handles.push_back(handle.get());
+          }
+        }
+        if (!handles.empty())
+        {
+          component_handles.push_back(std::move(handles));
+        }
+      }
+    };
+    collect_handles(actuators_);
+    collect_handles(sensors_);
+    collect_handles(systems_);
+
+    std::size_t number_of_cache_lines = 0;
+    for (const auto & handles : component_handles)
+    {
+      number_of_cache_lines +=
+        (handles.size() + Float32ValueCacheLine::SIZE - 1) / Float32ValueCacheLine::SIZE;
+    }
+    float32_value_arena_.resize(number_of_cache_lines);
+
+    float * storage = float32_value_arena_.empty() ? nullptr : float32_value_arena_[0].values;
+    for (const auto & handles : component_handles)
+    {
+      for (std::size_t i = 0; i < handles.size(); ++i)
+      {
+        handles[i]->relocate_float32_value_storage(storage + i);
+        float32_interface_handles_.push_back(handles[i]);
+      }
+      storage +=
+        ((handles.size() + Float32ValueCacheLine::SIZE - 1) / Float32ValueCacheLine::SIZE) *
+        Float32ValueCacheLine::SIZE;
+    }
+    RCLCPP_INFO(
+      get_logger(),
+      "Allocated float32 storage for %zu state interface values of %zu hardware components (%zu "
+      "bytes).",
+      float32_interface_handles_.size(), component_handles.size(),
+      float32_value_arena_.size() * sizeof(Float32ValueCacheLine));
+  }
+
+  /// Stores the values of the packed GPIO interfaces densely, per hardware component.
+  /**
+   * The values of type bool, uint8 and int8 of the interfaces of the `<gpio>` tags with the
+   * `packed` attribute are relocated into one byte each, in a single cache-line aligned
+   * allocation, so that e.g. the 64 digital inputs of an I/O bank fit into one cache line instead
+   * of 64 scattered handles. The interfaces of every hardware component start at a new cache line
+   * to avoid false sharing between components that are accessed from different threads.
+   *
+   * \param[in] hardware_info descriptions of the hardware components, with the packed interfaces.
+   * \note This method is not real-time safe and has to be called before the interfaces are used.
+   */
+  void allocate_packed_interface_storage(const std::vector<HardwareInfo> & hardware_info)
+  {
+    release_packed_interface_storage();
+
+    std::unordered_set<std::string> packed_interfaces;
+    for (const auto & hardware : hardware_info)
+    {
+      for (const auto & gpio : hardware.gpios)
+      {
+        for (const auto & interface : gpio.state_interfaces)
+        {
+          if (interface.packed)
+          {
+            packed_interfaces.insert(gpio.name + "/" + interface.name);
+          }
+        }
+        for (const auto & interface : gpio.command_interfaces)
+        {
+          if (interface.packed)
+          {
+            packed_interfaces.insert(gpio.name + "/" + interface.name);
+          }
+        }
+      }
+    }
+    if (packed_interfaces.empty())
+    {
+      return;
+    }
+
+    std::vector<std::vector<Handle *>> component_handles;
+    auto collect_handle = [&](Handle * handle, std::vector<Handle *> & handles)
+    {
+      if (packed_interfaces.count(handle->get_name()) == 0)
+      {
+        return;
+      }
+      if (handle->has_packable_value_storage())
+      {
+        handles.push_back(handle);
+      }
+      else
+      {
+        RCLCPP_WARN(
+          get_logger(),
+          "Interface '%s' of type '%s' cannot be packed, only the interfaces of type bool, uint8 "
+          "and int8 without the lock_free attribute are. It keeps its own storage.",
+          handle->get_name().c_str(), handle->get_data_type().to_string().c_str());
+      }
+    };
+    auto collect_handles = [&](const auto & container)
+    {
+      for (const auto & component : container)
+      {
+        const auto & info = hardware_info_map_.at(component.get_name());
+        std::vector<Handle *> handles;
+        for (const auto & name : info.state_interfaces)
+        {
+          // the storage owns the interfaces, so it is allowed to relocate their values
+          collect_handle(
+            std::const_pointer_cast<StateInterface>(state_interface_map_.at(name)).get(), handles);
+        }
+        for (const auto & name : info.command_interfaces)
+        {
+          collect_handle(command_interface_map_.at(name).get(), handles);
+        }
+        if (!handles.empty())
+        {
+          component_handles.push_back(std::move(handles));
+        }
+      }
+    };
+    collect_handles(actuators_);
+    collect_handles(sensors_);
+    collect_handles(systems_);
+
+    std::size_t number_of_cache_lines = 0;
+    for (const auto & handles : component_handles)
+    {
+      number_of_cache_lines +=
+        (handles.size() + PackedValueCacheLine::SIZE - 1) / PackedValueCacheLine::SIZE;
+    }
+    packed_value_arena_.resize(number_of_cache_lines);
+
+    uint8_t * storage = packed_value_arena_.empty() ? nullptr : packed_value_arena_[0].values;
+    for (const auto & handles : component_handles)
+    {
+      for (std::size_t i = 0; i < handles.size(); ++i)
+      {
+        handles[i]->relocate_packed_value_storage(storage + i);
+        packed_interface_handles_.push_back(handles[i]);
+      }
+      storage += ((handles.size() + PackedValueCacheLine::SIZE - 1) / PackedValueCacheLine::SIZE) *
+                 PackedValueCacheLine::SIZE;
+    }
+    RCLCPP_INFO(
+      get_logger(),
+      "Allocated packed storage for %zu interface values of %zu hardware components (%zu bytes).",
+      packed_interface_handles_.size(), component_handles.size(),
+      packed_value_arena_.size() * sizeof(PackedValueCacheLine));
+  }
+
+  /// Loads the transmission stage plugin, if it is not loaded yet.
+  /**
+   * The stage is loaded through pluginlib to avoid a dependency of the ResourceManager on the
+   * transmission_interface package, which itself depends on hardware_interface.
+   */
+  void load_transmission_stage(const std::string & plugin_name)
+  {
+    if (transmission_stage_)
+    {
+      return;
+    }
+    try
+    {
+      transmission_stage_loader_ =
+        std::make_unique<pluginlib::ClassLoader<TransmissionStageInterface>>(
+          pkg_name, transmission_stage_interface_name);
+      transmission_stage_ = std::unique_ptr<TransmissionStageInterface>(
+        transmission_stage_loader_->createUnmanagedInstance(plugin_name));
+      transmission_stage_statistics_ = std::make_shared<TransmissionStageStatistics>();
+      RCLCPP_INFO(
+        get_logger(), "Applying the transmissions of the hardware components with plugin '%s'.",
+        plugin_name.c_str());
+    }
+    catch (const pluginlib::PluginlibException & ex)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Unable to load the transmission stage plugin '%s': %s", plugin_name.c_str(),
+        ex.what());
+      transmission_stage_.reset();
+      transmission_stage_loader_.reset();
+      handle_exception_ ? void() : throw;
+    }
+  }
+
+  /// Adds the transmissions of all the synchronous hardware components to the transmission stage.
+  /**
+   * Asynchronous components are read and written in their own thread, so their transmissions are
+   * left to them.
+   */
+  void configure_transmission_stage()
+  {
+    if (!transmission_stage_)
+    {
+      return;
+    }
+    transmission_stage_->clear();
+    for (const auto & [component_name, transmissions] : component_transmissions_)
+    {
+      const auto info_it = hardware_info_map_.find(component_name);
+      if (info_it == hardware_info_map_.end())
+      {
+        continue;
+      }
+      const auto & component_info = info_it->second;
+      if (component_info.is_async)
+      {
+        RCLCPP_WARN(
+          get_logger(),
+          "The transmissions of the asynchronous hardware component '%s' are not applied by the "
+          "resource manager.",
+          component_name.c_str());
+        continue;
+      }
+      // only the interfaces exported by the component itself are used by its transmissions
+      auto get_state_interface = [&](const std::string & name) -> StateInterface::SharedPtr
+      {
+        const auto & names = component_info.state_interfaces;
+        if (std::find(names.begin(), names.end(), name) == names.end())
+        {
+          return nullptr;
+        }
+        // the storage owns the interfaces, so the stage is allowed to write the joint states
+        return std::const_pointer_cast<StateInterface>(state_interface_map_.at(name));
+      };
+      auto get_command_interface = [&](const std::string & name) -> CommandInterface::SharedPtr
+      {
+        const auto & names = component_info.command_interfaces;
+        if (std::find(names.begin(), names.end(), name) == names.end())
+        {
+          return nullptr;
+        }
+        return command_interface_map_.at(name);
+      };
+      if (!transmission_stage_->add_transmissions(
+            component_name, transmissions, get_state_interface, get_command_interface))
+      {
+        RCLCPP_ERROR(
+          get_logger(), "Not all the transmissions of the hardware component '%s' are applied.",
+          component_name.c_str());
+      }
+    }
+  }
+
+  /// Runs one direction of the transmission stage and records its execution time.
+  /**
+   * \note This method is real-time safe if the transmission stage is.
+   */
+  void run_transmission_stage(bool actuator_to_joint)
+  {
+    const auto start_time = InstrumentationClock::now();
+    try
+    {
+      actuator_to_joint ? transmission_stage_->actuator_to_joint()
+                        : transmission_stage_->joint_to_actuator();
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Exception of type : %s thrown by the transmission stage: %s",
+        typeid(e).name(), e.what());
+      handle_exception_ ? void() : throw;
+    }
+    const double execution_time_us =
+      std::chrono::duration<double, std::micro>(InstrumentationClock::now() - start_time)
+        .count();
+    auto & collector = actuator_to_joint ? actuator_to_joint_time_ : joint_to_actuator_time_;
+    collector->add_measurement(execution_time_us);
+    auto & statistics = actuator_to_joint ? transmission_stage_statistics_->actuator_to_joint
+                                          : transmission_stage_statistics_->joint_to_actuator;
+    statistics.update_statistics(collector);
+  }
+
+  /// Loads the buses of the synchronous components and configures them with their members.
+  /**
+   * A bus without plugin, whose plugin can't be loaded or which fails to configure, fails the
+   * read and the write of all its members.
+   *
+   * \note This method is not real-time safe and has to be called whenever a component is added or
+   * removed.
+   */
+  void configure_hardware_buses()
+  {
+    std::map<std::string, std::vector<HardwareBusMember>> bus_members;
+    std::map<std::string, std::string> bus_plugin_names;
+    auto collect_members = [&](const auto & container)
+    {
+      for (const auto & component : container)
+      {
+        const auto bus_info = component_bus_infos_.find(component.get_name());
+        if (bus_info == component_bus_infos_.end())
+        {
+          continue;
+        }
+        const auto & hardware_info = bus_info->second;
+        const auto & component_info = hardware_info_map_.at(component.get_name());
+        if (component_info.is_async)
+        {
+          RCLCPP_WARN(
+            get_logger(),
+            "The asynchronous hardware component '%s' can't exchange its data through the bus "
+            "'%s', it has to access its device itself.",
+            component.get_name().c_str(), hardware_info.bus.c_str());
+          continue;
+        }
+        HardwareBusMember member;
+        member.info = hardware_info;
+        for (const auto & name : component_info.state_interfaces)
+        {
+          // the storage owns the interfaces, so the bus is allowed to write the states
+          member.state_interfaces.push_back(
+            std::const_pointer_cast<StateInterface>(state_interface_map_.at(name)));
+        }
+        for (const auto & name : component_info.command_interfaces)
+        {
+          member.command_interfaces.push_back(command_interface_map_.at(name));
+        }
+        bus_members[hardware_info.bus].push_back(std::move(member));
+        if (!hardware_info.bus_plugin_name.empty())
+        {
+          auto & plugin_name = bus_plugin_names[hardware_info.bus];
+          if (!plugin_name.empty() && plugin_name != hardware_info.bus_plugin_name)
+          {
+            RCLCPP_ERROR(
+              get_logger(),
+              "The plugin '%s' of the bus '%s' given by the hardware component '%s' differs from "
+              "the plugin '%s' given by another member, it is ignored.",
+              hardware_info.bus_plugin_name.c_str(), hardware_info.bus.c_str(),
+              component.get_name().c_str(), plugin_name.c_str());
+          }
+          else
+          {
+            plugin_name = hardware_info.bus_plugin_name;
+          }
+        }
+      }
+    };
+    collect_members(actuators_);
+    collect_members(sensors_);
+    collect_members(systems_);
+
+    for (auto it = hardware_buses_.begin(); it != hardware_buses_.end();)
+    {
+      it = bus_members.count(it->first) == 0 ? hardware_buses_.erase(it) : std::next(it);
+    }
+    for (const auto & [bus_name, members] : bus_members)
+    {
+      auto & bus_state = hw_bus_state_[bus_name];
+      bus_state = {return_type::ERROR, return_type::ERROR};
+      const auto & plugin_name = bus_plugin_names[bus_name];
+      if (plugin_name.empty())
+      {
+        RCLCPP_ERROR(
+          get_logger(),
+          "None of the hardware components of the bus '%s' gives the plugin of the bus.",
+          bus_name.c_str());
+        hardware_buses_.erase(bus_name);
+        continue;
+      }
+      auto & bus = hardware_buses_[bus_name];
+      if (!bus.bus || bus.plugin_name != plugin_name)
+      {
+        try
+        {
+          if (!hardware_bus_loader_)
+          {
+            hardware_bus_loader_ = std::make_unique<pluginlib::ClassLoader<HardwareBusInterface>>(
+              pkg_name, hardware_bus_interface_name);
+          }
+          bus.bus = std::unique_ptr<HardwareBusInterface>(
+            hardware_bus_loader_->createUnmanagedInstance(plugin_name));
+          bus.plugin_name = plugin_name;
+        }
+        catch (const pluginlib::PluginlibException & ex)
+        {
+          RCLCPP_ERROR(
+            get_logger(), "Unable to load the plugin '%s' of the bus '%s': %s",
+            plugin_name.c_str(), bus_name.c_str(), ex.what());
+          hardware_buses_.erase(bus_name);
+          handle_exception_ ? void() : throw;
+          continue;
+        }
+      }
+      if (!bus.bus->configure(bus_name, members, get_logger()))
+      {
+        RCLCPP_ERROR(
+          get_logger(), "The bus '%s' failed to configure with its %zu hardware components.",
+          bus_name.c_str(), members.size());
+        hardware_buses_.erase(bus_name);
+        continue;
+      }
+      bus.state = &bus_state;
+      bus_state = HardwareBusCycleState();
+      RCLCPP_INFO(
+        get_logger(),
+        "Exchanging the data of %zu hardware components on the bus '%s' with plugin '%s'.",
+        members.size(), bus_name.c_str(), plugin_name.c_str());
+    }
+  }
+
+  /// Reads or writes all the hardware buses, once per cycle.
+  /**
+   * \note This method is real-time safe if the bus plugins are.
+   */
+  void exchange_hardware_buses(
+    bool read, const rclcpp::Time & time, const rclcpp::Duration & period)
+  {
+    for (auto & [bus_name, bus] : hardware_buses_)
+    {
+      auto result = return_type::ERROR;
+      try
+      {
+        result = read ? bus.bus->read(time, period) : bus.bus->write(time, period);
+      }
+      catch (const std::exception & e)
+      {
+        RT_LOG_ERROR(
+          get_logger(), "Exception of type : %s thrown during %s of the bus '%s': %s",
+          typeid(e).name(), read ? "read" : "write", bus_name.c_str(), e.what());
+        handle_exception_ ? void() : throw;
+      }
+      catch (...)
+      {
+        RT_LOG_ERROR(
+          get_logger(), "Unknown exception thrown during %s of the bus '%s'",
+          read ? "read" : "write", bus_name.c_str());
+        handle_exception_ ? void() : throw;
+      }
+      auto & state = read ? bus.state->read : bus.state->write;
+      RT_LOG_ERROR_EXPRESSION(
+        get_logger(), result != return_type::OK && state == return_type::OK,
+        "The %s of the bus '%s' failed, the %s of its hardware components fails as well.",
+        read ? "read" : "write", bus_name.c_str(), read ? "read" : "write");
+      state = result;
+    }
+  }
+
+  /// Collects the edge events pushed by the configured components into the list of the cycle.
+  /**
+   * \note This method is real-time safe, called after the read of all the components.
+   */
+  void collect_edge_events()
+  {
+    edge_events_->clear();
+    auto collect = [this](auto & components)
+    {
+      for (auto & component : components)
+      {
+        if (is_configured(component))
+        {
+          component.drain_edge_events(*edge_events_);
+        }
+      }
+    };
+    collect(actuators_);
+    collect(sensors_);
+    collect(systems_);
+    RT_LOG_WARN_EXPRESSION(
+      get_logger(), edge_events_->get_dropped_events() > 0,
+      "%zu edge events were dropped in this cycle, the capacity of the edge event queues of the "
+      "components or of the list of the cycle (%zu) is too small.",
+      static_cast<std::size_t>(edge_events_->get_dropped_events()), edge_events_->capacity());
+  }
+
+  /// Moves the interface values back from the contiguous memory arena to the handles.
+  void release_contiguous_interface_storage()
+  {
+    for (auto * handle : relocated_interface_handles_)
+    {
+      handle->relocate_value_storage(nullptr);
+    }
+    relocated_interface_handles_.clear();
+    contiguous_state_values_.clear();
+    interface_value_arena_.clear();
+  }
+
+  /// Moves the float32 interface values back from their memory arena to the handles, the handles
+  /// stay narrowed to float32.
+  void release_float32_state_interface_storage()
+  {
+    for (auto * handle : float32_interface_handles_)
+    {
+      handle->relocate_float32_value_storage(nullptr);
+    }
+    float32_interface_handles_.clear();
+    float32_value_arena_.clear();
+  }
+
+  /// Moves the packed interface values back from the packed memory arena to the handles.
+  void release_packed_interface_storage()
+  {
+    for (auto * handle : packed_interface_handles_)
+    {
+      handle->relocate_packed_value_storage(nullptr);
+    }
+    packed_interface_handles_.clear();
+    packed_value_arena_.clear();
+  }
+
+  void clear()
+  {
+    if (state_snapshot_publisher_)
+    {
+      state_snapshot_publisher_->set_groups({});
+    }
+    release_packed_interface_storage();
+    release_contiguous_interface_storage();
+    release_float32_state_interface_storage();
+    // the recorder holds the interfaces of the components and is configured again on load
+    flight_recorder_.reset();
+
+    actuators_.clear();
+    sensors_.clear();
+    systems_.clear();
+
+    hardware_info_map_.clear();
+    namespace_components_.clear();
+    component_descriptions_.clear();
+    state_interface_map_.clear();
+    command_interface_map_.clear();
+
+    available_state_interfaces_.clear();
+    available_command_interfaces_.clear();
+
+    // the real-time loop must not use the claimed status of the bindings anymore
+    joint_limiter_bindings_.update(std::make_unique<std::vector<JointLimiterBinding>>());
+    claimed_command_interface_map_.clear();
+
+    component_transmissions_.clear();
+    if (transmission_stage_)
+    {
+      transmission_stage_->clear();
+    }
+    hardware_buses_.clear();
+    component_bus_infos_.clear();
+
+    actuators_cycle_contexts_.clear();
+    sensors_cycle_contexts_.clear();
+    systems_cycle_contexts_.clear();
+    read_lanes_.clear();
+    write_lanes_.clear();
+    read_cycle_count_ = 0;
+    write_cycle_count_ = 0;
+    {
+      std::lock_guard<std::mutex> guard(command_mode_switch_plan_mutex_);
+      command_mode_switch_plan_.valid = false;
+      command_mode_switch_plan_.actuator_entries.clear();
+      command_mode_switch_plan_.system_entries.clear();
+    }
+  }
+
+  /// Resolves the start and stop interfaces of a command mode switch per actuator and system.
+  void build_command_mode_switch_plan(
+    const std::vector<std::string> & start_interfaces,
+    const std::vector<std::string> & stop_interfaces, CommandModeSwitchPlan & plan)
+  {
+    plan.valid = false;
+    plan.start_interfaces = start_interfaces;
+    plan.stop_interfaces = stop_interfaces;
+    auto add_entries = [&](auto & components, std::vector<CommandModeSwitchEntry> & entries)
+    {
+      entries.clear();
+      std::vector<std::string> start_interfaces_buffer;
+      std::vector<std::string> stop_interfaces_buffer;
+      for (auto & component : components)
+      {
+        const auto & hw_command_itfs =
+          hardware_info_map_.at(component.get_name()).command_interfaces;
+        find_common_hardware_interfaces(hw_command_itfs, start_interfaces, start_interfaces_buffer);
+        find_common_hardware_interfaces(hw_command_itfs, stop_interfaces, stop_interfaces_buffer);
+        if (start_interfaces_buffer.empty() && stop_interfaces_buffer.empty())
+        {
+          RCLCPP_DEBUG(
+            get_logger(), "Component '%s' after filtering has no command interfaces to switch",
+            component.get_name().c_str());
+          continue;
+        }
+        entries.push_back({&component, start_interfaces_buffer, stop_interfaces_buffer});
+      }
+    };
+    add_entries(actuators_, plan.actuator_entries);
+    add_entries(systems_, plan.system_entries);
+  }
+
+  /// Moves the interface value arenas to the NUMA node of the real-time loop, if it is known.
+  /**
+   * \note This method is not real-time safe and has to be called once the arenas are allocated,
+   * before the real-time loop accesses them.
+   */
+  void move_value_arenas_to_numa_node()
+  {
+    const int node = realtime_numa_node_.load(std::memory_order_relaxed);
+    if (node < 0)
+    {
+      return;
+    }
+    std::vector<NumaMemoryRange> ranges;
+    auto add_vector = [&ranges](const auto & container)
+    {
+      using ValueType = typename std::decay_t<decltype(container)>::value_type;
+      ranges.push_back({container.data(), container.size() * sizeof(ValueType)});
+    };
+    add_vector(interface_value_arena_);
+    add_vector(float32_value_arena_);
+    add_vector(packed_value_arena_);
+    const std::size_t pages = NumaMemory::move_to_node(ranges, node);
+    RCLCPP_DEBUG(
+      get_logger(), "Placed %zu pages of the interface values on the NUMA node %d.", pages, node);
+  }
+
+  /// Moves the interface handles of a component to the NUMA node of the real-time loop.
+  /**
+   * Called before the activation of the component, while its command interfaces can't be claimed
+   * by the controllers yet. Nothing is moved if the node of the real-time loop is unknown.
+   * \note This method is not real-time safe.
+   */
+  void move_component_memory_to_numa_node(const std::string & component_name)
+  {
+    const int node = realtime_numa_node_.load(std::memory_order_relaxed);
+    const auto info_it = hardware_info_map_.find(component_name);
+    if (node < 0 || info_it == hardware_info_map_.end())
+    {
+      return;
+    }
+    const auto & info = info_it->second;
+    std::vector<NumaMemoryRange> ranges;
+    ranges.reserve(info.state_interfaces.size() + info.command_interfaces.size());
+    for (const auto & name : info.state_interfaces)
+    {
+      const auto state_interface = state_interface_map_.find(name);
+      if (state_interface != state_interface_map_.end())
+      {
+        ranges.push_back({state_interface->second.get(), sizeof(StateInterface)});
+      }
+    }
+    for (const auto & name : info.command_interfaces)
+    {
+      const auto command_interface = command_interface_map_.find(name);
+      if (command_interface != command_interface_map_.end())
+      {
+        ranges.push_back({command_interface->second.get(), sizeof(CommandInterface)});
+      }
+    }
+    const std::size_t pages = NumaMemory::move_to_node(ranges, node);
+    RCLCPP_DEBUG(
+      get_logger(), "Placed %zu pages of the component '%s' on the NUMA node %d.", pages,
+      component_name.c_str(), node);
+  }
+
+  /// Rebuilds the precomputed cycle context of all the hardware components.
+  /**
+   * The contexts are stored in the same order as the components in their containers, so that the
+   * read and write cycles don't need any string construction or hash lookups per component.
+   *
+   * The phases of the components whose rate divides the update rate are set from their rw_phase
+   * attribute if given. Otherwise, they are kept from the previous contexts, and the phases of new
+   * components are anchored at their first read and write. If spread_rate_divider_phases_ is set,
+   * the phases that are not set manually are instead assigned again to balance the load of the
+   * cycles, taking the components with the longest measured read and write time first.
+   *
+   * \note This method is not real-time safe and has to be called whenever a component is added.
+   */
+  void update_cycle_contexts()
+  {
+    {
+      // the plan points to the components, which may have moved
+      std::lock_guard<std::mutex> guard(command_mode_switch_plan_mutex_);
+      command_mode_switch_plan_.valid = false;
+    }
+    auto build_contexts = [this](const auto & components, auto & contexts)
+    {
+      const std::vector<HardwareComponentCycleContext> previous_contexts = std::move(contexts);
+      contexts.clear();
+      contexts.reserve(components.size());
+      for (const auto & component : components)
+      {
+        HardwareComponentCycleContext context;
+        context.info = &hardware_info_map_[component.get_name()];
+        context.read_statistics = context.info->read_statistics.get();
+        context.write_statistics = context.info->write_statistics.get();
+        const auto & group_name = component.get_group_name();
+        context.group_state = group_name.empty() ? nullptr : &hw_group_state_[group_name];
+        const auto bus_info = component_bus_infos_.find(component.get_name());
+        context.bus_state = bus_info == component_bus_infos_.end() || context.info->is_async
+                              ? nullptr
+                              : &hw_bus_state_[bus_info->second.bus];
+        context.runs_at_cm_rate =
+          context.info->rw_rate == 0 || context.info->rw_rate == cm_update_rate_;
+        context.rw_rate = static_cast<double>(context.info->rw_rate);
+        context.auxiliary = context.info->criticality == Criticality::AUXILIARY;
+        context.read_rate_divider.configure(cm_update_rate_, context.info->rw_rate);
+        context.write_rate_divider.configure(cm_update_rate_, context.info->rw_rate);
+        const auto previous_context = std::find_if(
+          previous_contexts.begin(), previous_contexts.end(),
+          [&context](const auto & previous) { return previous.info == context.info; });
+        if (previous_context != previous_contexts.end())
+        {
+          context.read_rate_divider = previous_context->read_rate_divider;
+          context.write_rate_divider = previous_context->write_rate_divider;
+          context.read_time_budget = previous_context->read_time_budget;
+          context.write_time_budget = previous_context->write_time_budget;
+        }
+        else if (!context.info->is_async)
+        {
+          // the read and write of an asynchronous component only trigger its thread
+          context.read_time_budget.budget_us = context.info->time_budget_us;
+          context.read_time_budget.policy = context.info->time_budget_policy;
+          context.write_time_budget = context.read_time_budget;
+        }
+        if (context.info->rw_phase >= 0 && context.read_rate_divider.get_divider() > 1u)
+        {
+          const auto phase = static_cast<uint32_t>(context.info->rw_phase);
+          if (phase >= context.read_rate_divider.get_divider())
+          {
+            RCUTILS_LOG_WARN_NAMED(
+              "resource_manager",
+              "The rw_phase %u of the hardware component '%s' is not below the number of update "
+              "cycles between its reads and writes (%u), using %u instead.",
+              phase, component.get_name().c_str(), context.read_rate_divider.get_divider(),
+              phase % context.read_rate_divider.get_divider());
+          }
+          context.read_rate_divider.set_phase(phase);
+          context.write_rate_divider.set_phase(phase);
+        }
+        // the load of a component is its measured read and write time, 1 if not measured yet
+        const auto & read_time = *component.get_read_statistics().execution_time;
+        const auto & write_time = *component.get_write_statistics().execution_time;
+        context.rate_phase_load = read_time.get_count() + write_time.get_count() > 0
+                                    ? read_time.get_average() + write_time.get_average()
+                                    : 1.0;
+        context.read_trace_id = TraceRecorder::register_name(component.get_name() + "/read");
+        context.write_trace_id = TraceRecorder::register_name(component.get_name() + "/write");
+        for (const auto & interface : context.info->state_interfaces)
+        {
+          context.state_interfaces_availability.push_back(
+            available_state_interfaces_.get_availability_bit(interface));
+        }
+        for (const auto & interface : context.info->command_interfaces)
+        {
+          context.command_interfaces_availability.push_back(
+            available_command_interfaces_.get_availability_bit(interface));
+        }
+        contexts.push_back(context);
+      }
+    };
+    build_contexts(actuators_, actuators_cycle_contexts_);
+    build_contexts(sensors_, sensors_cycle_contexts_);
+    build_contexts(systems_, systems_cycle_contexts_);
+    hardware_component_names_.clear();
+    std::vector<ComponentInterfaces> component_interfaces;
+    auto index_components = [this, &component_interfaces](const auto & components)
+    {
+      for (const auto & component : components)
+      {
+        hardware_component_names_.push_back(component.get_name());
+        const auto & info = hardware_info_map_.at(component.get_name());
+        component_interfaces.push_back(ComponentInterfaces{
+          component.get_name(), info.command_interfaces, info.state_interfaces});
+      }
+    };
+    index_components(actuators_);
+    index_components(sensors_);
+    index_components(systems_);
+    update_hardware_dependencies([&component_interfaces](HardwareDependencyIndex & dependencies)
+                                 { dependencies.set_components(component_interfaces); });
+    if (spread_rate_divider_phases_)
+    {
+      spread_rate_divider_phases();
+    }
+    update_read_write_lanes();
+  }
+
+  /// Groups the components into the lanes of the read and write cycles.
+  /**
+   * A lane holds a whole group, or a single component without group, and its components are read
+   * and written one after the other by the same thread, in the order of their containers. The
+   * state of a group therefore propagates as in a sequential cycle, and the failure of a group is
+   * handled in its lane without holding up the other lanes.
+   */
+  void update_read_write_lanes()
+  {
+    std::vector<std::string> read_groups;
+    std::vector<std::string> write_groups;
+    for (const auto & actuator : actuators_)
+    {
+      read_groups.push_back(actuator.get_group_name());
+      write_groups.push_back(actuator.get_group_name());
+    }
+    for (const auto & sensor : sensors_)
+    {
+      read_groups.push_back(sensor.get_group_name());
+    }
+    for (const auto & system : systems_)
+    {
+      read_groups.push_back(system.get_group_name());
+      write_groups.push_back(system.get_group_name());
+    }
+    read_lanes_ = group_into_units(read_groups);
+    write_lanes_ = group_into_units(write_groups);
+    assign_lane_workers();
+  }
+
+  /// Adds a dedicated worker to the read and write pool for the synchronous components placed on
+  /// cores with the affinity of their async properties.
+  /**
+   * The components with the same affinity and priority share a dedicated worker. The priority is
+   * the thread_priority of their async properties, or the one of the pool.
+   */
+  void add_dedicated_read_write_workers(
+    const std::vector<HardwareInfo> & hardware_info, RTWorkerPoolParams & pool_params)
+  {
+    for (const auto & hw : hardware_info)
+    {
+      if (hw.is_async || hw.async_params.cpu_affinity_cores.empty())
+      {
+        continue;
+      }
+      // the thread priority of the synchronous components is only set by their async properties
+      const int thread_priority =
+        hw.async_params.thread_priority != std::numeric_limits<int>::max()
+          ? hw.async_params.thread_priority
+          : pool_params.thread_priority;
+      const auto it = std::find_if(
+        pool_params.dedicated_workers.begin(), pool_params.dedicated_workers.end(),
+        [&](const RTDedicatedWorkerParams & worker)
+        {
+          return worker.thread_priority == thread_priority &&
+                 worker.cpu_affinity_cores == hw.async_params.cpu_affinity_cores;
+        });
+      if (it != pool_params.dedicated_workers.end())
+      {
+        component_dedicated_workers_[hw.name] =
+          static_cast<int>(std::distance(pool_params.dedicated_workers.begin(), it));
+        continue;
+      }
+      component_dedicated_workers_[hw.name] =
+        static_cast<int>(pool_params.dedicated_workers.size());
+      pool_params.dedicated_workers.push_back(
+        {thread_priority, hw.async_params.cpu_affinity_cores, pool_params.name + "_" + hw.name});
+    }
+  }
+
+  /// Assigns every lane to the dedicated worker of its first component placed on a dedicated
+  /// worker, or to the shared workers.
+  void assign_lane_workers()
+  {
+    auto assign = [this](
+                    const std::vector<std::vector<std::size_t>> & lanes, bool include_sensors,
+                    std::vector<int> & lane_workers)
+    {
+      lane_workers.assign(lanes.size(), -1);
+      for (std::size_t lane = 0; lane < lanes.size(); ++lane)
+      {
+        auto find_worker = [&](const auto & component, const HardwareComponentCycleContext &)
+        {
+          const auto it = component_dedicated_workers_.find(component.get_name());
+          if (it == component_dedicated_workers_.end())
+          {
+            return;
+          }
+          if (lane_workers[lane] < 0)
+          {
+            lane_workers[lane] = it->second;
+          }
+          else if (lane_workers[lane] != it->second)
+          {
+            RCLCPP_WARN(
+              get_logger(),
+              "The component '%s' is read and written with the other components of its group, "
+              "its affinity is ignored.",
+              component.get_name().c_str());
+          }
+        };
+        for (const std::size_t index : lanes[lane])
+        {
+          call_for_component(index, include_sensors, find_worker);
+        }
+      }
+    };
+    assign(read_lanes_, true, read_lane_workers_);
+    assign(write_lanes_, false, write_lane_workers_);
+  }
+
+  /// Assigns the phases of the components not set manually to balance the load of the cycles.
+  void spread_rate_divider_phases()
+  {
+    std::vector<HardwareComponentCycleContext *> unassigned_contexts;
+    rate_phase_allocator_.reset(cm_update_rate_);
+    for (auto * contexts :
+         {&actuators_cycle_contexts_, &sensors_cycle_contexts_, &systems_cycle_contexts_})
+    {
+      for (auto & context : *contexts)
+      {
+        const uint32_t divider = context.read_rate_divider.get_divider();
+        if (divider <= 1u)
+        {
+          continue;
+        }
+        if (context.info->rw_phase >= 0)
+        {
+          rate_phase_allocator_.reserve(
+            divider, context.read_rate_divider.get_phase(), context.rate_phase_load);
+        }
+        else
+        {
+          unassigned_contexts.push_back(&context);
+        }
+      }
+    }
+    // placing the longest components first balances the load better
+    std::stable_sort(
+      unassigned_contexts.begin(), unassigned_contexts.end(),
+      [](const auto * lhs, const auto * rhs)
+      { return lhs->rate_phase_load > rhs->rate_phase_load; });
+    for (auto * context : unassigned_contexts)
+    {
+      const uint32_t phase = rate_phase_allocator_.allocate(
+        context->read_rate_divider.get_divider(), context->rate_phase_load);
+      context->read_rate_divider.set_phase(phase);
+      context->write_rate_divider.set_phase(phase);
+    }
+  }
+
+  /// Calls the function with the component and its cycle context at the given index.
+  /**
+   * The components are indexed over the actuators, the sensors and the systems in this order.
+   *
+   * \param[in] index index of the component.
+   * \param[in] include_sensors if false, the sensors are skipped in the indexing.
+   * \param[in] func function called as func(component, cycle_context).
+   */
+  template <typename FunctionT>
+  void call_for_component(std::size_t index, bool include_sensors, FunctionT & func)
+  {
+    if (index < actuators_.size())
+    {
+      func(actuators_[index], actuators_cycle_contexts_[index]);
+      return;
+    }
+    index -= actuators_.size();
+    if (include_sensors)
+    {
+      if (index < sensors_.size())
+      {
+        func(sensors_[index], sensors_cycle_contexts_[index]);
+        return;
+      }
+      index -= sensors_.size();
+    }
+    func(systems_[index], systems_cycle_contexts_[index]);
+  }
+
+  /**
+   * Returns the return type of the hardware component group state, if the return type is other
+   * than OK, then updates the return type of the group to the respective one
+   */
+  return_type update_hardware_component_group_state(
+    const std::string & group_name, const return_type & value)
+  {
+    // This is for the components that has no configured group
+    if (group_name.empty())
+    {
+      return value;
+    }
+    // If it is anything other than OK, change the return type of the hardware group state
+    // to the respective return type
+    if (value != return_type::OK)
+    {
+      hw_group_state_.at(group_name) = value;
+    }
+    return hw_group_state_.at(group_name);
+  }
+
+  /**
+   * Same as above, using the group state precomputed in the cycle context of the component.
+   */
+  return_type update_hardware_component_group_state(
+    return_type * group_state, const return_type & value) const
+  {
+    // This is for the components that has no configured group
+    if (!group_state)
+    {
+      return value;
+    }
+    if (value != return_type::OK)
+    {
+      *group_state = value;
+    }
+    return *group_state;
+  }
+
+  /// Exports the values of the interfaces of all the hardware components into shared memory.
+  /**
+   * \param[in] params segment name and the interfaces to export.
+   * \note This method is not real-time safe and has to be called before the interfaces are used.
+   */
+  void configure_shared_memory_export(const SharedMemoryExportParams & params)
+  {
+    std::vector<StateInterface::ConstSharedPtr> state_interfaces;
+    std::vector<CommandInterface::SharedPtr> command_interfaces;
+    auto collect_interfaces = [&](const auto & container)
+    {
+      for (const auto & component : container)
+      {
+        const auto & info = hardware_info_map_.at(component.get_name());
+        for (const auto & name : info.state_interfaces)
+        {
+          state_interfaces.push_back(state_interface_map_.at(name));
+        }
+        if (params.include_command_interfaces)
+        {
+          for (const auto & name : info.command_interfaces)
+          {
+            command_interfaces.push_back(command_interface_map_.at(name));
+          }
+        }
       }
     };
+    collect_interfaces(actuators_);
+    collect_interfaces(sensors_);
+    collect_interfaces(systems_);
+
+    try
+    {
+      if (!shared_memory_exporter_)
+      {
+        shared_memory_exporter_ =
+          std::make_unique<SharedMemoryInterfaceExporter>(params.segment_name);
+      }
+      shared_memory_exporter_->configure(state_interfaces, command_interfaces);
+      RCLCPP_INFO(
+        get_logger(), "Exporting the values of %zu interfaces to the shared-memory segment '%s'.",
+        shared_memory_exporter_->get_number_of_interfaces(), params.segment_name.c_str());
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Unable to export the interfaces to the shared-memory segment '%s': %s",
+        params.segment_name.c_str(), e.what());
+      shared_memory_exporter_.reset();
+    }
+  }
+
+  /// Exchanges the values of interfaces with a controller manager running on another machine.
+  /**
+   * The exported command interfaces are marked as claimed, so that only the remote controllers
+   * command them.
+   *
+   * \param[in] params addresses of the link and the exported interfaces.
+   * \note This method is not real-time safe and has to be called before the interfaces are used,
+   * with the claimed command interfaces locked.
+   */
+  void configure_remote_interface_export(const RemoteInterfaceExportParams & params)
+  {
+    for (const auto & name : remote_command_interface_names_)
+    {
+      const auto claimed_it = claimed_command_interface_map_.find(name);
+      if (claimed_it != claimed_command_interface_map_.end())
+      {
+        claimed_it->second = false;
+      }
+    }
+    remote_interface_link_.close();
+    remote_state_interfaces_.clear();
+    remote_command_interfaces_.clear();
+    remote_command_interface_names_.clear();
+    claimed_command_interfaces_version_.fetch_add(1u, std::memory_order_release);
+
+    std::vector<StateInterface::ConstSharedPtr> state_interfaces;
+    std::vector<CommandInterface::SharedPtr> command_interfaces;
+    for (const auto & name : params.state_interfaces)
+    {
+      const auto it = state_interface_map_.find(name);
+      if (it == state_interface_map_.end())
+      {
+        RCLCPP_ERROR(
+          get_logger(), "Unable to export the state interface '%s' to the remote controller "
+          "manager, it doesn't exist.", name.c_str());
+        return;
+      }
+      state_interfaces.push_back(it->second);
+    }
+    for (const auto & name : params.command_interfaces)
+    {
+      const auto it = command_interface_map_.find(name);
+      if (it == command_interface_map_.end() || claimed_command_interface_map_.at(name))
+      {
+        RCLCPP_ERROR(
+          get_logger(), "Unable to export the command interface '%s' to the remote controller "
+          "manager, it doesn't exist or is claimed.", name.c_str());
+        return;
+      }
+      command_interfaces.push_back(it->second);
+    }
+
+    try
+    {
+      remote_interface_link_.open(
+        params.local_port, params.remote_address, params.remote_port, params.state_interfaces,
+        params.command_interfaces);
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Unable to export the interfaces to the remote controller manager: %s",
+        e.what());
+      return;
+    }
+    remote_state_interfaces_ = std::move(state_interfaces);
+    remote_command_interfaces_ = std::move(command_interfaces);
+    remote_command_interface_names_ = params.command_interfaces;
+    for (const auto & name : remote_command_interface_names_)
+    {
+      claimed_command_interface_map_[name] = true;
+    }
+    claimed_command_interfaces_version_.fetch_add(1u, std::memory_order_release);
+    remote_state_values_.assign(
+      remote_state_interfaces_.size(), std::numeric_limits<double>::quiet_NaN());
+    remote_command_values_.assign(remote_command_interfaces_.size(), 0.0);
+    RCLCPP_INFO(
+      get_logger(),
+      "Exporting %zu state and %zu command interfaces to the remote controller manager at "
+      "'%s:%u' from the local port %u.",
+      remote_state_interfaces_.size(), remote_command_interfaces_.size(),
+      params.remote_address.c_str(), params.remote_port, params.local_port);
+  }
 
-    init_systems(systems_);
+  /// Sends the values of the exported state interfaces to the remote controller manager.
+  void send_remote_state_values(int64_t stamp_ns) noexcept
+  {
+    for (std::size_t i = 0; i < remote_state_interfaces_.size(); ++i)
+    {
+      try
+      {
+        const auto value = remote_state_interfaces_[i]->get_optional_as_double();
+        if (value.has_value())
+        {
+          remote_state_values_[i] = value.value();
+        }
+      }
+      catch (...)
+      {
+        // a value that cannot be read keeps its previous value
+      }
+    }
+    std::ignore = remote_interface_link_.send(remote_state_values_, stamp_ns);
   }
 
-  void clear()
+  /// Applies the latest commands received from the remote controller manager, if any.
+  void apply_remote_command_values(int64_t now_ns) noexcept
   {
-    actuators_.clear();
-    sensors_.clear();
-    systems_.clear();
+    int64_t stamp_ns = 0;
+    if (!remote_interface_link_.receive(remote_command_values_, stamp_ns, now_ns))
+    {
+      return;
+    }
+    for (std::size_t i = 0; i < remote_command_interfaces_.size(); ++i)
+    {
+      try
+      {
+        // a command that cannot be accessed without blocking is updated with the next frame
+        if (remote_command_interfaces_[i]->get_data_type() == HandleDataType::BOOL)
+        {
+          std::ignore = remote_command_interfaces_[i]->set_value(
+            remote_command_values_[i] != 0.0, false);
+        }
+        else
+        {
+          std::ignore = remote_command_interfaces_[i]->set_value(remote_command_values_[i], false);
+        }
+      }
+      catch (...)
+      {
+      }
+    }
+  }
 
-    hardware_info_map_.clear();
-    state_interface_map_.clear();
-    command_interface_map_.clear();
+  /// Creates the publisher of the hardware status messages of all the components.
+  /**
+   * The node of the publisher is spun by the executor of the components. Without executor, the
+   * components publish their status messages with their own publishers.
+   *
+   * \note This method is not real-time safe and has to be called before the components are
+   * initialized.
+   */
+  void create_hardware_status_aggregator(const ResourceManagerParams & params)
+  {
+    if (hardware_status_aggregator_)
+    {
+      return;
+    }
+    if (!params.executor)
+    {
+      RCLCPP_WARN(
+        get_logger(),
+        "The hardware status messages cannot be aggregated without an executor, every hardware "
+        "component publishes its own.");
+      return;
+    }
+    rclcpp::NodeOptions options;
+    options.start_parameter_services(false);
+    options.arguments({"--ros-args", "-r", "__node:=hardware_status_aggregator"});
+    auto node =
+      std::make_shared<rclcpp::Node>("hardware_status_aggregator", params.node_namespace, options);
+    params.executor->add_node(node->get_node_base_interface());
+    hardware_status_aggregator_ = std::make_unique<HardwareStatusAggregator>(
+      node, params.hardware_status_aggregation.publish_rate);
+    RCLCPP_INFO(
+      get_logger(), "Publishing the hardware status messages of all the components at %.1f Hz.",
+      params.hardware_status_aggregation.publish_rate);
+  }
 
-    available_state_interfaces_.clear();
-    available_command_interfaces_.clear();
+  /// Passes the status messages of the loaded components to the aggregator, if created.
+  /**
+   * \note This method is not real-time safe and has to be called whenever a component is added or
+   * removed.
+   */
+  void update_hardware_status_sources()
+  {
+    if (!hardware_status_aggregator_)
+    {
+      return;
+    }
+    std::vector<std::shared_ptr<HardwareStatusSource>> sources;
+    auto collect_sources = [&sources](const auto & components)
+    {
+      for (const auto & component : components)
+      {
+        if (auto source = component.get_hardware_status_source())
+        {
+          sources.push_back(std::move(source));
+        }
+      }
+    };
+    collect_sources(actuators_);
+    collect_sources(sensors_);
+    collect_sources(systems_);
+    hardware_status_aggregator_->set_sources(sources);
+  }
 
-    claimed_command_interface_map_.clear();
+  /// Creates the publisher of the state values of all the components.
+  /**
+   * \note This method is not real-time safe.
+   */
+  void create_state_snapshot_publisher(const ResourceManagerParams & params)
+  {
+    if (state_snapshot_publisher_)
+    {
+      return;
+    }
+    rclcpp::NodeOptions options;
+    options.start_parameter_services(false);
+    options.arguments({"--ros-args", "-r", "__node:=state_snapshot_publisher"});
+    auto node =
+      std::make_shared<rclcpp::Node>("state_snapshot_publisher", params.node_namespace, options);
+    state_snapshot_publisher_ =
+      std::make_unique<StateSnapshotPublisher>(node, params.state_snapshot_publisher.decimation);
+    RCLCPP_INFO(
+      get_logger(), "Publishing the state values of all the components every %u cycles.",
+      params.state_snapshot_publisher.decimation);
   }
 
+  /// Passes the state interfaces of the loaded components to the snapshot publisher, if created.
   /**
-   * Returns the return type of the hardware component group state, if the return type is other
-   * than OK, then updates the return type of the group to the respective one
+   * The values of the components whose state interfaces are all stored in the contiguous
+   * interface storage are copied with one memcpy per component, the others are read one by one.
+   *
+   * \note This method is not real-time safe and has to be called whenever the storages of the
+   * interfaces are configured.
    */
-  return_type update_hardware_component_group_state(
-    const std::string & group_name, const return_type & value)
+  void update_state_snapshot_groups()
   {
-    // This is for the components that has no configured group
-    if (group_name.empty())
+    if (!state_snapshot_publisher_)
     {
-      return value;
+      return;
     }
-    // If it is anything other than OK, change the return type of the hardware group state
-    // to the respective return type
-    if (value != return_type::OK)
+    std::vector<StateSnapshotGroup> groups;
+    auto collect_groups = [&](const auto & container)
     {
-      hw_group_state_.at(group_name) = value;
+      for (const auto & component : container)
+      {
+        const auto & info = hardware_info_map_.at(component.get_name());
+        StateSnapshotGroup group;
+        group.name = component.get_name();
+        group.interface_names = info.state_interfaces;
+        const auto contiguous_values = contiguous_state_values_.find(component.get_name());
+        if (contiguous_values != contiguous_state_values_.end())
+        {
+          group.values = contiguous_values->second;
+        }
+        else
+        {
+          for (const auto & name : info.state_interfaces)
+          {
+            group.interfaces.push_back(state_interface_map_.at(name));
+          }
+        }
+        groups.push_back(std::move(group));
+      }
+    };
+    collect_groups(actuators_);
+    collect_groups(sensors_);
+    collect_groups(systems_);
+    state_snapshot_publisher_->set_groups(groups);
+  }
+
+  /// Records the values of the interfaces of the hardware components in every cycle.
+  /**
+   * \param[in] params recorded interfaces, capacity of the ring buffer and the written files.
+   * \note This method is not real-time safe and has to be called before the interfaces are used.
+   */
+  void configure_flight_recorder(const FlightRecorderParams & params)
+  {
+    const std::unordered_set<std::string> selected_interfaces(
+      params.interfaces.begin(), params.interfaces.end());
+    auto is_recorded = [&selected_interfaces](const std::string & name)
+    { return selected_interfaces.empty() || selected_interfaces.count(name) > 0; };
+    std::vector<StateInterface::ConstSharedPtr> state_interfaces;
+    std::vector<CommandInterface::SharedPtr> command_interfaces;
+    auto collect_interfaces = [&](const auto & container)
+    {
+      for (const auto & component : container)
+      {
+        const auto & info = hardware_info_map_.at(component.get_name());
+        for (const auto & name : info.state_interfaces)
+        {
+          if (is_recorded(name))
+          {
+            state_interfaces.push_back(state_interface_map_.at(name));
+          }
+        }
+        if (params.include_command_interfaces)
+        {
+          for (const auto & name : info.command_interfaces)
+          {
+            if (is_recorded(name))
+            {
+              command_interfaces.push_back(command_interface_map_.at(name));
+            }
+          }
+        }
+      }
+    };
+    collect_interfaces(actuators_);
+    collect_interfaces(sensors_);
+    collect_interfaces(systems_);
+
+    try
+    {
+      if (!flight_recorder_)
+      {
+        flight_recorder_ = std::make_unique<InterfaceFlightRecorder>();
+      }
+      flight_recorder_->configure(state_interfaces, command_interfaces, params.capacity);
+      if (!params.output_file.empty() || !params.dump_file_prefix.empty())
+      {
+        flight_recorder_->start(params.output_file, params.dump_file_prefix, get_logger());
+      }
+      RCLCPP_INFO(
+        get_logger(), "Recording the values of %zu interfaces for the last %zu cycles.",
+        flight_recorder_->get_number_of_interfaces(), params.capacity);
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(get_logger(), "Unable to configure the flight recorder: %s", e.what());
+      flight_recorder_.reset();
     }
-    return hw_group_state_.at(group_name);
   }
 
   /// Gets the logger for the resource storage
@@ -1387,15 +4059,238 @@ public:
   rclcpp::Logger rm_logger_;
   bool handle_exception_ = true;
 
+  /// Contiguous storage of the interface values, if enabled. Has to outlive the hardware handles.
+  std::vector<InterfaceValueCacheLine> interface_value_arena_;
+  /// Handles whose values are currently stored in interface_value_arena_
+  std::vector<Handle *> relocated_interface_handles_;
+  /// Contiguous state values in interface_value_arena_, by component name, of the components whose
+  /// state interfaces are all stored in the arena
+  std::unordered_map<std::string, const double *> contiguous_state_values_;
+  /// Storage of the state interface values narrowed to float32. Has to outlive the hardware
+  /// handles.
+  std::vector<Float32ValueCacheLine> float32_value_arena_;
+  /// Handles whose values are currently stored in float32_value_arena_
+  std::vector<Handle *> float32_interface_handles_;
+  /// Packed storage of the one byte GPIO interface values. Has to outlive the hardware handles.
+  std::vector<PackedValueCacheLine> packed_value_arena_;
+  /// Handles whose values are currently stored in packed_value_arena_
+  std::vector<Handle *> packed_interface_handles_;
+  /// Names of the components of every resource namespace, sorted so that the sub-namespaces of a
+  /// namespace follow it
+  std::map<std::string, std::vector<std::string>> namespace_components_;
+  /// XML of the ros2_control tag of every loaded component, see HardwareInfo::description_xml
+  std::unordered_map<std::string, std::string> component_descriptions_;
+
   std::vector<Actuator> actuators_;
   std::vector<Sensor> sensors_;
   std::vector<System> systems_;
 
+  /// Precomputed cycle contexts, in the same order as the components in the containers above
+  std::vector<HardwareComponentCycleContext> actuators_cycle_contexts_;
+  std::vector<HardwareComponentCycleContext> sensors_cycle_contexts_;
+  std::vector<HardwareComponentCycleContext> systems_cycle_contexts_;
+
+  /// Lanes of the read and write cycles, the indices of the components as in call_for_component
+  std::vector<std::vector<std::size_t>> read_lanes_;
+  std::vector<std::vector<std::size_t>> write_lanes_;
+  /// Dedicated worker of every lane in the read_write_pool_, -1 for the shared workers
+  std::vector<int> read_lane_workers_;
+  std::vector<int> write_lane_workers_;
+  /// Dedicated worker of the read_write_pool_ of the components placed with their affinity
+  std::unordered_map<std::string, int> component_dedicated_workers_;
+  /// Worker pool reading and writing the lanes of the synchronous components in parallel, if
+  /// configured
+  std::unique_ptr<RTWorkerPool> read_write_pool_;
+
+  /// If true, the phases of the components running at a divided rate are spread over the cycles
+  bool spread_rate_divider_phases_ = false;
+  /// Size of the memory arena of every component, see ResourceManagerParams::memory_arena_size
+  std::size_t memory_arena_size_ = 0;
+  /// See ResourceManagerParams::thread_stack_prefault_size
+  std::size_t thread_stack_prefault_size_ = 0;
+
+  /// NUMA node of the real-time loop, -1 if it is unknown, see set_realtime_numa_node()
+  std::atomic<int> realtime_numa_node_{-1};
+
+  /// See ResourceManagerParams::defer_control_loop_transitions
+  bool defer_control_loop_transitions_ = false;
+  /// Set by the control loop after requesting a transition of a component
+  std::atomic<bool> transitions_requested_ = false;
+  /// Thread running the requested transitions
+  std::thread transition_thread_;
+  std::mutex transition_mutex_;
+  std::condition_variable transition_cv_;
+  bool stop_transition_thread_ = false;
+
+  /// Recovery of a component after its error transition, see HardwareRecoveryParams
+  struct PendingRecovery
+  {
+    unsigned int attempts = 0;
+    double backoff = 0.0;
+    std::chrono::steady_clock::time_point next_attempt;
+  };
+  /// Recoveries of the components by name, guarded by the resources lock
+  std::unordered_map<std::string, PendingRecovery> pending_recoveries_;
+  /// Set while pending_recoveries_ isn't empty, for the transition thread to skip the lock
+  std::atomic<bool> recoveries_pending_ = false;
+  std::mutex on_component_recovered_mutex_;
+  std::function<void(const std::string &, bool)> on_component_recovered_callback_ = nullptr;
+
+  /// Schedules the recovery of \p component after its error transition if it is configured
+  template <class HardwareT>
+  void schedule_recovery(const HardwareT & component)
+  {
+    const auto info_it = hardware_info_map_.find(component.get_name());
+    if (info_it == hardware_info_map_.end() || info_it->second.recovery_params.max_attempts == 0)
+    {
+      return;
+    }
+    const auto & recovery_params = info_it->second.recovery_params;
+    const auto & state = component.get_lifecycle_state();
+    if (state.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Hardware '%s' can't be recovered, its error transition left it '%s'.",
+        component.get_name().c_str(), state.label().c_str());
+      return;
+    }
+    PendingRecovery recovery;
+    recovery.backoff = recovery_params.initial_backoff;
+    recovery.next_attempt =
+      std::chrono::steady_clock::now() +
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(recovery.backoff));
+    pending_recoveries_[component.get_name()] = recovery;
+    recoveries_pending_.store(true, std::memory_order_release);
+    RCLCPP_INFO(
+      get_logger(), "Recovering hardware '%s' in %.3f s, up to %u attempts.",
+      component.get_name().c_str(), recovery.backoff, recovery_params.max_attempts);
+  }
+
+  /// Requests the \p transition of the \p component from the control loop
+  void request_transition(
+    HardwareComponent & component, HardwareComponent::RequestedTransition transition) noexcept
+  {
+    component.request_transition(transition);
+    transitions_requested_.store(true, std::memory_order_release);
+  }
+
+  /// Starts the thread calling \p run_transitions until stop_transition_thread() is called
+  void start_transition_thread(std::function<void()> run_transitions)
+  {
+    stop_transition_thread_ = false;
+    RealtimeThreadParams thread_params;
+    thread_params.name = "hw_transitions";
+    transition_thread_ = create_realtime_thread(
+      thread_params, get_logger(),
+      [this, run_transitions]()
+      {
+        bool stopping = false;
+        while (!stopping)
+        {
+          {
+            std::unique_lock<std::mutex> lock(transition_mutex_);
+            stopping = transition_cv_.wait_for(
+              lock, TRANSITION_POLL_PERIOD, [this]() { return stop_transition_thread_; });
+          }
+          run_transitions();
+        }
+      });
+  }
+
+  void stop_transition_thread()
+  {
+    {
+      std::lock_guard<std::mutex> lock(transition_mutex_);
+      stop_transition_thread_ = true;
+    }
+    transition_cv_.notify_all();
+    if (transition_thread_.joinable())
+    {
+      transition_thread_.join();
+    }
+  }
+  RatePhaseAllocator rate_phase_allocator_;
+  /// Number of read and write cycles, the cycles of the rate dividers of the components
+  uint64_t read_cycle_count_ = 0;
+  uint64_t write_cycle_count_ = 0;
+  /// Decimation of the cycles of the auxiliary components set by the overload governor
+  std::atomic<uint32_t> auxiliary_decimation_{1u};
+
+  /// Exporter of the interface values into shared memory, if enabled
+  std::unique_ptr<SharedMemoryInterfaceExporter> shared_memory_exporter_;
+  /// Recorder of the interface values of the last cycles, if enabled
+  std::unique_ptr<InterfaceFlightRecorder> flight_recorder_;
+  /// Publisher of the status messages of all the components, if enabled
+  std::unique_ptr<HardwareStatusAggregator> hardware_status_aggregator_;
+  /// Publisher of the state values of all the components, if enabled
+  std::unique_ptr<StateSnapshotPublisher> state_snapshot_publisher_;
+  /// Edge events of the components collected in the last read, shared with the controllers
+  std::shared_ptr<EdgeEventList> edge_events_ =
+    std::make_shared<EdgeEventList>(EdgeEventParams().capacity);
+  /// Contiguous storage of the read and write statistics of all the components
+  HardwareComponentStatisticsTable statistics_table_;
+  /// Link of the remote interface export, open if enabled
+  UdpInterfaceLink remote_interface_link_;
+  std::vector<StateInterface::ConstSharedPtr> remote_state_interfaces_;
+  std::vector<CommandInterface::SharedPtr> remote_command_interfaces_;
+  /// Exported command interfaces, marked as claimed while they are exported
+  std::vector<std::string> remote_command_interface_names_;
+  /// Preallocated values of the frames of the remote interface export
+  std::vector<double> remote_state_values_;
+  std::vector<double> remote_command_values_;
+
+  /// Transmissions parsed from the description of the components, by component name
+  std::unordered_map<std::string, std::vector<TransmissionInfo>> component_transmissions_;
+  /// Descriptions of the components exchanging their data through a bus, by component name
+  std::unordered_map<std::string, HardwareInfo> component_bus_infos_;
+  /// Loaded bus plugin, its members and the state of its last cycle
+  struct HardwareBus
+  {
+    std::string plugin_name;
+    std::unique_ptr<HardwareBusInterface> bus;
+    HardwareBusCycleState * state = nullptr;
+  };
+  /// Buses of the components, by bus name. Declared after their loader to be destroyed before the
+  /// plugin library is unloaded.
+  std::unique_ptr<pluginlib::ClassLoader<HardwareBusInterface>> hardware_bus_loader_;
+  std::map<std::string, HardwareBus> hardware_buses_;
+  /// Stage applying the transmissions of the synchronous components, if enabled. Declared after
+  /// its loader to be destroyed before the plugin library is unloaded.
+  std::unique_ptr<pluginlib::ClassLoader<TransmissionStageInterface>> transmission_stage_loader_;
+  std::unique_ptr<TransmissionStageInterface> transmission_stage_;
+  std::shared_ptr<TransmissionStageStatistics> transmission_stage_statistics_;
+  std::shared_ptr<ros2_control::MovingAverageStatistics> actuator_to_joint_time_ =
+    std::make_shared<ros2_control::MovingAverageStatistics>();
+  std::shared_ptr<ros2_control::MovingAverageStatistics> joint_to_actuator_time_ =
+    std::make_shared<ros2_control::MovingAverageStatistics>();
+
   std::unordered_map<std::string, HardwareComponentInfo> hardware_info_map_;
   std::unordered_map<std::string, hardware_interface::return_type> hw_group_state_;
-
-  /// Mapping between hardware and controllers that are using it (accessing data from it)
-  std::unordered_map<std::string, std::vector<std::string>> hardware_used_by_controllers_;
+  /// States of the buses, by bus name, kept when the buses are unloaded since the cycle contexts
+  /// point to them
+  std::unordered_map<std::string, HardwareBusCycleState> hw_bus_state_;
+
+  /// Names of the components by index, the actuators, the sensors and then the systems
+  std::vector<std::string> hardware_component_names_;
+  /// Controllers using the components by index, replaced with read-copy-update for the real-time
+  /// loop
+  RcuPointer<const HardwareDependencyIndex> hardware_dependencies_{
+    std::make_unique<const HardwareDependencyIndex>()};
+  /// Serializes the updates of the hardware_dependencies_, which copy the current index
+  std::mutex hardware_dependencies_mutex_;
+
+  /// Publishes a copy of the hardware dependencies modified by \p modify.
+  template <typename ModifierT>
+  void update_hardware_dependencies(ModifierT && modify)
+  {
+    std::lock_guard<std::mutex> guard(hardware_dependencies_mutex_);
+    // the guard of the current index is released before the update waits for the readers
+    auto dependencies = std::make_unique<HardwareDependencyIndex>(
+      *hardware_dependencies_.read().get());
+    modify(*dependencies);
+    hardware_dependencies_.update(std::move(dependencies));
+  }
 
   /// Mapping between controllers and list of interfaces they are using
   std::unordered_map<std::string, std::vector<std::string>>
@@ -1404,22 +4299,60 @@ public:
 
   /// Storage of all available state interfaces
   std::map<std::string, StateInterface::ConstSharedPtr> state_interface_map_;
+  /// Read stamps of the hardware components exporting the state interfaces
+  std::unordered_map<std::string, std::shared_ptr<const ReadStamp>> state_interface_read_stamps_;
   /// Storage of all available command interfaces
   std::map<std::string, CommandInterface::SharedPtr> command_interface_map_;
+  /// Patterns of the names of the interfaces registered for introspection
+  std::vector<std::string> introspected_interface_patterns_ = {"*"};
+  /// Names of the state and command interfaces registered for introspection
+  std::unordered_set<std::string> introspected_state_interfaces_;
+  std::unordered_set<std::string> introspected_command_interfaces_;
 
-  /// Vectors with interfaces available to controllers (depending on hardware component state)
-  std::vector<std::string> available_state_interfaces_;
-  std::vector<std::string> available_command_interfaces_;
+  /// Interfaces available to controllers (depending on hardware component state)
+  AvailableInterfaces available_state_interfaces_;
+  AvailableInterfaces available_command_interfaces_;
 
   /// List of all claimed command interfaces
   std::unordered_map<std::string, bool> claimed_command_interface_map_;
+  /// Incremented whenever a command interface is claimed or released
+  std::atomic<uint64_t> claimed_command_interfaces_version_{0u};
 
   std::unordered_map<std::string, joint_limits::JointInterfacesCommandLimiterData> limiters_data_;
 
+  using JointLimiter =
+    joint_limits::JointLimiterInterface<joint_limits::JointControlInterfacesData>;
+  /// Limiter of a joint, swapped without blocking the real-time loop when imported again
+  using JointLimiterSlot = RcuPointer<JointLimiter>;
+
+  /// Limiter of a joint with its data and interfaces, resolved before the control loop
+  struct JointLimiterBinding
+  {
+    /// Interface types exchanged with the limiters, in the order of the interface arrays
+    static constexpr std::array<const char *, 4> INTERFACE_TYPES = {
+      hardware_interface::HW_IF_POSITION, hardware_interface::HW_IF_VELOCITY,
+      hardware_interface::HW_IF_EFFORT, hardware_interface::HW_IF_ACCELERATION};
+    static constexpr std::array<
+      std::optional<double> joint_limits::JointControlInterfacesData::*, 4>
+      INTERFACE_MEMBERS = {
+        &joint_limits::JointControlInterfacesData::position,
+        &joint_limits::JointControlInterfacesData::velocity,
+        &joint_limits::JointControlInterfacesData::effort,
+        &joint_limits::JointControlInterfacesData::acceleration};
+
+    std::shared_ptr<JointLimiterSlot> limiter;
+    joint_limits::JointInterfacesCommandLimiterData * data = nullptr;
+    /// Null if the joint doesn't have the interface type
+    std::array<StateInterface::ConstSharedPtr, 4> state_interfaces;
+    std::array<CommandInterface::SharedPtr, 4> command_interfaces;
+    /// Claimed status of the command interfaces, stable as long as the interfaces are stored
+    std::array<const bool *, 4> command_claimed = {};
+  };
+  /// Flat list of all the limited joints, iterated by enforce_command_limits()
+  RcuPointer<std::vector<JointLimiterBinding>> joint_limiter_bindings_;
+
   std::unordered_map<
-    std::string, std::unordered_map<
-                   std::string, std::unique_ptr<joint_limits::JointLimiterInterface<
-                                  joint_limits::JointControlInterfacesData>>>>
+    std::string, std::unordered_map<std::string, std::shared_ptr<JointLimiterSlot>>>
     joint_limiters_interface_;
 
   std::string robot_description_;
@@ -1427,13 +4360,17 @@ public:
   // Unordered map of the hard and soft limits for the joints
   std::unordered_map<std::string, joint_limits::JointLimits> hard_joint_limits_;
   std::unordered_map<std::string, joint_limits::SoftJointLimits> soft_joint_limits_;
+  /// The hard and soft limits published to the controllers, updated with the maps above
+  std::shared_ptr<JointLimitsStore> joint_limits_store_ = std::make_shared<JointLimitsStore>();
 
   /// The callback to be called when a component state is switched
   std::function<void()> on_component_state_switch_callback_ = nullptr;
 
-  // To be used with the prepare and perform command switch for the hardware components
-  std::vector<std::string> start_interfaces_buffer_;
-  std::vector<std::string> stop_interfaces_buffer_;
+  /// Plan of the last prepared command mode switch, the component pointers are valid until the
+  /// cycle contexts change
+  CommandModeSwitchPlan command_mode_switch_plan_;
+  /// Locked by perform_command_mode_switch with try_lock only, it never waits for the plan
+  std::mutex command_mode_switch_plan_mutex_;
 
   // Update rate of the controller manager, and the clock interface of its node
   // Used by async components.
@@ -1453,7 +4390,11 @@ ResourceManager::ResourceManager(rclcpp::Clock::SharedPtr clock, rclcpp::Logger
 {
 }
 
-ResourceManager::~ResourceManager() = default;
+ResourceManager::~ResourceManager()
+{
+  // the thread runs the transitions through this resource manager
+  resource_storage_->stop_transition_thread();
+}
 
 ResourceManager::ResourceManager(
   const std::string & urdf, rclcpp::node_interfaces::NodeClockInterface::SharedPtr clock_interface,
@@ -1511,7 +4452,7 @@ ResourceManager::ResourceManager(
 
 bool ResourceManager::shutdown_components()
 {
-  std::unique_lock<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::unique_lock<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   bool shutdown_status = true;
   for (auto const & hw_info : resource_storage_->hardware_info_map_)
   {
@@ -1534,81 +4475,185 @@ bool ResourceManager::load_and_initialize_components(
   params_.robot_description = params.robot_description;
   params_.update_rate = params.update_rate;
   params_.handle_exceptions = params.handle_exceptions;
+  params_.contiguous_interface_storage = params.contiguous_interface_storage;
+  params_.float32_state_interface_storage = params.float32_state_interface_storage;
+  params_.shared_memory_export = params.shared_memory_export;
+  params_.remote_interface_export = params.remote_interface_export;
+  params_.flight_recorder = params.flight_recorder;
+  params_.hardware_status_aggregation = params.hardware_status_aggregation;
+  params_.state_snapshot_publisher = params.state_snapshot_publisher;
+  params_.spread_rate_divider_phases = params.spread_rate_divider_phases;
+  params_.transmission_stage_plugin = params.transmission_stage_plugin;
+  params_.hardware_info_cache_directory = params.hardware_info_cache_directory;
+  params_.component_initialization_threads = params.component_initialization_threads;
+  params_.async_worker_pool = params.async_worker_pool;
+  params_.control_loop_pools = params.control_loop_pools;
+  params_.memory_arena_size = params.memory_arena_size;
+  params_.thread_stack_prefault_size = params.thread_stack_prefault_size;
+  params_.introspected_interfaces = params.introspected_interfaces;
+  resource_storage_->introspected_interface_patterns_ = params.introspected_interfaces;
+  resource_storage_->spread_rate_divider_phases_ = params.spread_rate_divider_phases;
+  resource_storage_->memory_arena_size_ = params.memory_arena_size;
+  resource_storage_->thread_stack_prefault_size_ = params.thread_stack_prefault_size;
   resource_storage_->handle_exception_ = params.handle_exceptions;
+  params_.defer_control_loop_transitions = params.defer_control_loop_transitions;
+  resource_storage_->defer_control_loop_transitions_ = params.defer_control_loop_transitions;
+  if (params.hardware_status_aggregation.enable)
+  {
+    resource_storage_->create_hardware_status_aggregator(params);
+  }
+  if (params.state_snapshot_publisher.enable)
+  {
+    resource_storage_->create_state_snapshot_publisher(params);
+  }
+  resource_storage_->edge_events_ = std::make_shared<EdgeEventList>(params.edge_events.capacity);
 
   auto hardware_info =
-    hardware_interface::parse_control_resources_from_urdf(params.robot_description);
+    params.hardware_info_cache_directory.empty()
+      ? hardware_interface::parse_control_resources_from_urdf(params.robot_description)
+      : HardwareInfoCache(params.hardware_info_cache_directory)
+          .parse_control_resources_from_urdf(params.robot_description);
   // Set the update rate for all hardware components
   for (auto & hw : hardware_info)
   {
     hw.rw_rate =
       (hw.rw_rate == 0 || hw.rw_rate > params.update_rate) ? params.update_rate : hw.rw_rate;
   }
+  const bool has_recoveries = std::any_of(
+    hardware_info.begin(), hardware_info.end(),
+    [](const HardwareInfo & hw) { return hw.recovery_params.max_attempts > 0; });
+  if (
+    (params.defer_control_loop_transitions || has_recoveries) &&
+    !resource_storage_->transition_thread_.joinable())
+  {
+    resource_storage_->start_transition_thread(
+      [this]()
+      {
+        run_requested_transitions();
+        run_component_recoveries();
+      });
+  }
+  // one block for the read and write statistics of all the components, so that the update cycle
+  // goes through adjacent memory
+  resource_storage_->statistics_table_.reserve(2 * hardware_info.size());
 
   const std::string system_type = "system";
   const std::string sensor_type = "sensor";
   const std::string actuator_type = "actuator";
 
   components_are_loaded_and_initialized_ = true;
-  std::lock_guard<std::recursive_mutex> resource_guard(resources_lock_);
-  std::lock_guard<std::recursive_mutex> limiters_guard(joint_limiters_lock_);
-  for (const auto & individual_hardware_info : hardware_info)
+  std::lock_guard<InstrumentedRecursiveMutex> resource_guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> limiters_guard(joint_limiters_lock_);
+  if (params.component_initialization_threads > 1)
   {
-    // Check for identical names
-    if (
-      resource_storage_->hardware_info_map_.find(individual_hardware_info.name) !=
-      resource_storage_->hardware_info_map_.end())
+    std::vector<hardware_interface::HardwareComponentParams> components_params;
+    components_params.reserve(hardware_info.size());
+    for (const auto & individual_hardware_info : hardware_info)
     {
-      RCUTILS_LOG_ERROR_NAMED(
-        "resource_manager",
-        "Hardware name %s is duplicated. Please provide a unique 'name' "
-        "in the URDF.",
-        individual_hardware_info.name.c_str());
-      components_are_loaded_and_initialized_ = false;
-      break;
+      hardware_interface::HardwareComponentParams interface_params;
+      interface_params.hardware_info = individual_hardware_info;
+      interface_params.executor = params.executor;
+      interface_params.clock = params.clock;
+      interface_params.logger = params.logger;
+      interface_params.node_namespace = params.node_namespace;
+      interface_params.async_worker_pool =
+        get_component_async_worker_pool(params, individual_hardware_info);
+      interface_params.warm_restart = ros2_control::has_item(
+        params.warm_restart_components, individual_hardware_info.name);
+      components_params.push_back(std::move(interface_params));
     }
-    hardware_interface::HardwareComponentParams interface_params;
-    interface_params.hardware_info = individual_hardware_info;
-    interface_params.executor = params.executor;
-    interface_params.clock = params.clock;
-    interface_params.logger = params.logger;
-    interface_params.node_namespace = params.node_namespace;
-
-    if (individual_hardware_info.type == actuator_type)
+    std::scoped_lock guard(resource_interfaces_lock_, claimed_command_interfaces_lock_);
+    components_are_loaded_and_initialized_ =
+      resource_storage_->load_and_initialize_components_concurrently(
+        components_params, params.component_initialization_threads);
+  }
+  else
+  {
+    for (const auto & individual_hardware_info : hardware_info)
     {
-      std::scoped_lock guard(resource_interfaces_lock_, claimed_command_interfaces_lock_);
-      if (!resource_storage_->load_and_initialize_actuator(interface_params))
+      // Check for identical names
+      if (
+        resource_storage_->hardware_info_map_.find(individual_hardware_info.name) !=
+        resource_storage_->hardware_info_map_.end())
       {
+        RCUTILS_LOG_ERROR_NAMED(
+          "resource_manager",
+          "Hardware name %s is duplicated. Please provide a unique 'name' "
+          "in the URDF.",
+          individual_hardware_info.name.c_str());
         components_are_loaded_and_initialized_ = false;
         break;
       }
-    }
-    if (individual_hardware_info.type == sensor_type)
-    {
-      std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
-      if (!resource_storage_->load_and_initialize_sensor(interface_params))
+      hardware_interface::HardwareComponentParams interface_params;
+      interface_params.hardware_info = individual_hardware_info;
+      interface_params.executor = params.executor;
+      interface_params.clock = params.clock;
+      interface_params.logger = params.logger;
+      interface_params.node_namespace = params.node_namespace;
+      interface_params.async_worker_pool =
+        get_component_async_worker_pool(params, individual_hardware_info);
+      interface_params.warm_restart = ros2_control::has_item(
+        params.warm_restart_components, individual_hardware_info.name);
+
+      if (individual_hardware_info.type == actuator_type)
       {
-        components_are_loaded_and_initialized_ = false;
-        break;
+        std::scoped_lock guard(resource_interfaces_lock_, claimed_command_interfaces_lock_);
+        if (!resource_storage_->load_and_initialize_actuator(interface_params))
+        {
+          components_are_loaded_and_initialized_ = false;
+          break;
+        }
       }
-    }
-    if (individual_hardware_info.type == system_type)
-    {
-      std::scoped_lock guard(resource_interfaces_lock_, claimed_command_interfaces_lock_);
-      if (!resource_storage_->load_and_initialize_system(interface_params))
+      if (individual_hardware_info.type == sensor_type)
       {
-        components_are_loaded_and_initialized_ = false;
-        break;
+        std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+        if (!resource_storage_->load_and_initialize_sensor(interface_params))
+        {
+          components_are_loaded_and_initialized_ = false;
+          break;
+        }
+      }
+      if (individual_hardware_info.type == system_type)
+      {
+        std::scoped_lock guard(resource_interfaces_lock_, claimed_command_interfaces_lock_);
+        if (!resource_storage_->load_and_initialize_system(interface_params))
+        {
+          components_are_loaded_and_initialized_ = false;
+          break;
+        }
       }
     }
   }
 
   if (components_are_loaded_and_initialized_ && validate_storage(hardware_info))
   {
-    std::lock_guard<std::recursive_mutex> guard(resources_lock_);
-    read_write_status.failed_hardware_names.reserve(
-      resource_storage_->actuators_.size() + resource_storage_->sensors_.size() +
-      resource_storage_->systems_.size());
+    std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+    resource_storage_->update_cycle_contexts();
+    read_write_status.failed_hardware_names.reset(resource_storage_->hardware_component_names_);
+    resource_storage_->update_hardware_status_sources();
+    resource_storage_->resolve_joint_limiter_bindings();
+    if (params.read_write_worker_pool.number_of_workers > 0 && !resource_storage_->read_write_pool_)
+    {
+      auto pool_params = params.read_write_worker_pool;
+      resource_storage_->add_dedicated_read_write_workers(hardware_info, pool_params);
+      RCLCPP_INFO(
+        get_logger(),
+        "Reading and writing hardware components in parallel with %u worker threads and %zu "
+        "dedicated worker threads.",
+        pool_params.number_of_workers, pool_params.dedicated_workers.size());
+      resource_storage_->read_write_pool_ =
+        std::make_unique<RTWorkerPool>(pool_params, get_logger());
+      resource_storage_->assign_lane_workers();
+    }
+    {
+      std::scoped_lock interfaces_guard(
+        resource_interfaces_lock_, claimed_command_interfaces_lock_);
+      resource_storage_->configure_interface_storages(params, hardware_info);
+    }
+    for (const auto & hw : hardware_info)
+    {
+      resource_storage_->component_descriptions_[hw.name] = hw.description_xml;
+    }
   }
   else
   {
@@ -1623,11 +4668,143 @@ bool ResourceManager::load_and_initialize_components(
 
 void ResourceManager::import_joint_limiters(const std::string & urdf)
 {
-  std::lock_guard<std::recursive_mutex> guard(joint_limiters_lock_);
-  const auto hardware_info = hardware_interface::parse_control_resources_from_urdf(urdf);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(joint_limiters_lock_);
+  const auto hardware_info =
+    params_.hardware_info_cache_directory.empty()
+      ? hardware_interface::parse_control_resources_from_urdf(urdf)
+      : HardwareInfoCache(params_.hardware_info_cache_directory)
+          .parse_control_resources_from_urdf(urdf);
   resource_storage_->import_joint_limiters(hardware_info);
 }
 
+RobotDescriptionDiff ResourceManager::diff_robot_description(const std::string & urdf) const
+{
+  RobotDescriptionDiff diff;
+  diff.hardware_info =
+    params_.hardware_info_cache_directory.empty()
+      ? hardware_interface::parse_control_resources_from_urdf(urdf)
+      : HardwareInfoCache(params_.hardware_info_cache_directory)
+          .parse_control_resources_from_urdf(urdf);
+  for (auto & hw : diff.hardware_info)
+  {
+    hw.rw_rate =
+      (hw.rw_rate == 0 || hw.rw_rate > params_.update_rate) ? params_.update_rate : hw.rw_rate;
+  }
+
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+  const auto & loaded_descriptions = resource_storage_->component_descriptions_;
+  std::unordered_set<std::string> described_components;
+  for (const auto & hw : diff.hardware_info)
+  {
+    described_components.insert(hw.name);
+    const auto it = loaded_descriptions.find(hw.name);
+    if (it == loaded_descriptions.end())
+    {
+      diff.added_components.push_back(hw.name);
+    }
+    else if (it->second != hw.description_xml)
+    {
+      diff.changed_components.push_back(hw.name);
+    }
+  }
+  for (const auto & [name, description] : loaded_descriptions)
+  {
+    if (described_components.count(name) == 0)
+    {
+      diff.removed_components.push_back(name);
+    }
+  }
+  std::sort(diff.removed_components.begin(), diff.removed_components.end());
+  return diff;
+}
+
+bool ResourceManager::reload_components(
+  const RobotDescriptionDiff & diff, const hardware_interface::ResourceManagerParams & params)
+{
+  std::lock_guard<InstrumentedRecursiveMutex> resource_guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> limiters_guard(joint_limiters_lock_);
+  std::scoped_lock guard(resource_interfaces_lock_, claimed_command_interfaces_lock_);
+
+  std::vector<std::string> unloaded_components = diff.removed_components;
+  unloaded_components.insert(
+    unloaded_components.end(), diff.changed_components.begin(), diff.changed_components.end());
+  for (const auto & component_name : unloaded_components)
+  {
+    const auto info_it = resource_storage_->hardware_info_map_.find(component_name);
+    if (info_it == resource_storage_->hardware_info_map_.end())
+    {
+      continue;
+    }
+    for (const auto & interface : info_it->second.command_interfaces)
+    {
+      if (resource_storage_->claimed_command_interface_map_.at(interface))
+      {
+        RCLCPP_ERROR(
+          get_logger(),
+          "Cannot reload the hardware component '%s', its command interface '%s' is claimed.",
+          component_name.c_str(), interface.c_str());
+        return false;
+      }
+    }
+  }
+
+  // the storages refer to the handles of the unloaded components
+  resource_storage_->release_packed_interface_storage();
+  resource_storage_->release_contiguous_interface_storage();
+  resource_storage_->release_float32_state_interface_storage();
+  for (const auto & component_name : unloaded_components)
+  {
+    resource_storage_->unload_hardware_component(component_name);
+  }
+
+  bool result = true;
+  std::vector<std::string> loaded_components = diff.added_components;
+  loaded_components.insert(
+    loaded_components.end(), diff.changed_components.begin(), diff.changed_components.end());
+  for (const auto & hw : diff.hardware_info)
+  {
+    if (
+      std::find(loaded_components.begin(), loaded_components.end(), hw.name) ==
+      loaded_components.end())
+    {
+      continue;
+    }
+    hardware_interface::HardwareComponentParams interface_params;
+    interface_params.hardware_info = hw;
+    interface_params.executor = params.executor;
+    interface_params.clock = params.clock;
+    interface_params.logger = params.logger;
+    interface_params.node_namespace = params.node_namespace;
+    interface_params.async_worker_pool = get_component_async_worker_pool(params_, hw);
+    if (resource_storage_->load_and_initialize_component(interface_params))
+    {
+      resource_storage_->component_descriptions_[hw.name] = hw.description_xml;
+    }
+    else
+    {
+      result = false;
+      if (resource_storage_->hardware_info_map_.count(hw.name) > 0)
+      {
+        resource_storage_->unload_hardware_component(hw.name);
+      }
+    }
+  }
+
+  resource_storage_->robot_description_ = params.robot_description;
+  params_.robot_description = params.robot_description;
+  resource_storage_->update_cycle_contexts();
+  read_write_status.failed_hardware_names.reset(resource_storage_->hardware_component_names_);
+  resource_storage_->update_hardware_status_sources();
+  resource_storage_->resolve_joint_limiter_bindings();
+  resource_storage_->configure_interface_storages(params_, diff.hardware_info);
+  RCLCPP_INFO(
+    get_logger(),
+    "Reloaded the robot description: %zu added, %zu removed and %zu changed hardware components.",
+    diff.added_components.size(), diff.removed_components.size(),
+    diff.changed_components.size());
+  return result;
+}
+
 bool ResourceManager::are_components_initialized() const
 {
   return components_are_loaded_and_initialized_;
@@ -1642,15 +4819,19 @@ LoanedStateInterface ResourceManager::claim_state_interface(const std::string &
       fmt::format(FMT_COMPILE("State interface with key '{}' does not exist"), key));
   }
 
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
-  return LoanedStateInterface(resource_storage_->state_interface_map_.at(key));
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  const auto stamp_it = resource_storage_->state_interface_read_stamps_.find(key);
+  return LoanedStateInterface(
+    resource_storage_->state_interface_map_.at(key),
+    stamp_it != resource_storage_->state_interface_read_stamps_.end() ? stamp_it->second : nullptr,
+    nullptr);
 }
 
 // CM API: Called in "callback/slow"-thread
 std::vector<std::string> ResourceManager::state_interface_keys() const
 {
   std::vector<std::string> keys;
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   for (const auto & item : resource_storage_->state_interface_map_)
   {
     keys.push_back(std::get<0>(item));
@@ -1658,23 +4839,60 @@ std::vector<std::string> ResourceManager::state_interface_keys() const
   return keys;
 }
 
+// CM API: Called in "callback/slow"-thread
+std::vector<std::string> ResourceManager::state_interface_keys(
+  const std::string & resource_namespace) const
+{
+  std::vector<std::string> keys;
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  resource_storage_->for_each_namespace_component(
+    resource_namespace, [&keys](const HardwareComponentInfo & info)
+    { keys.insert(keys.end(), info.state_interfaces.begin(), info.state_interfaces.end()); });
+  return keys;
+}
+
+// CM API: Called in "callback/slow"-thread
+std::vector<std::string> ResourceManager::command_interface_keys(
+  const std::string & resource_namespace) const
+{
+  std::vector<std::string> keys;
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  resource_storage_->for_each_namespace_component(
+    resource_namespace, [&keys](const HardwareComponentInfo & info)
+    { keys.insert(keys.end(), info.command_interfaces.begin(), info.command_interfaces.end()); });
+  return keys;
+}
+
+// CM API: Called in "callback/slow"-thread
+std::vector<std::string> ResourceManager::get_resource_namespaces() const
+{
+  std::vector<std::string> namespaces;
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  namespaces.reserve(resource_storage_->namespace_components_.size());
+  for (const auto & [resource_namespace, components] : resource_storage_->namespace_components_)
+  {
+    namespaces.push_back(resource_namespace);
+  }
+  return namespaces;
+}
+
 // CM API: Called in "update"-thread
 std::vector<std::string> ResourceManager::available_state_interfaces() const
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
-  return resource_storage_->available_state_interfaces_;
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  return resource_storage_->available_state_interfaces_.get_names();
 }
 
 // CM API: Called in "update"-thread (indirectly through `claim_state_interface`)
 bool ResourceManager::state_interface_is_available(const std::string & name) const
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
-  return ros2_control::has_item(resource_storage_->available_state_interfaces_, name);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  return resource_storage_->available_state_interfaces_.is_available(name);
 }
 
 std::string ResourceManager::get_state_interface_data_type(const std::string & name) const
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   auto it = resource_storage_->state_interface_map_.find(name);
   if (it != resource_storage_->state_interface_map_.end())
   {
@@ -1687,11 +4905,30 @@ std::string ResourceManager::get_state_interface_data_type(const std::string & n
   }
 }
 
+InterfaceChangeTracker ResourceManager::make_state_interface_change_tracker(
+  const std::vector<std::string> & names) const
+{
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  std::vector<std::shared_ptr<const Handle>> handles;
+  handles.reserve(names.size());
+  for (const auto & name : names)
+  {
+    auto it = resource_storage_->state_interface_map_.find(name);
+    if (it == resource_storage_->state_interface_map_.end())
+    {
+      throw std::runtime_error(
+        std::string("State interface with key '") + name + std::string("' does not exist"));
+    }
+    handles.push_back(it->second);
+  }
+  return InterfaceChangeTracker(std::move(handles));
+}
+
 // CM API: Called in "callback/slow"-thread
 void ResourceManager::import_controller_exported_state_interfaces(
   const std::string & controller_name, std::vector<StateInterface::ConstSharedPtr> & interfaces)
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   auto interface_names = resource_storage_->add_state_interfaces(interfaces);
   resource_storage_->controllers_exported_state_interfaces_map_[controller_name] = interface_names;
 }
@@ -1709,8 +4946,11 @@ void ResourceManager::make_controller_exported_state_interfaces_available(
 {
   auto interface_names =
     resource_storage_->controllers_exported_state_interfaces_map_.at(controller_name);
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
-  ros2_control::add_items(resource_storage_->available_state_interfaces_, interface_names);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  for (const auto & interface : interface_names)
+  {
+    resource_storage_->available_state_interfaces_.make_available(interface);
+  }
 }
 
 // CM API: Called in "update"-thread
@@ -1720,15 +4960,11 @@ void ResourceManager::make_controller_exported_state_interfaces_unavailable(
   auto interface_names =
     resource_storage_->controllers_exported_state_interfaces_map_.at(controller_name);
 
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   for (const auto & interface : interface_names)
   {
-    auto found_it = std::find(
-      resource_storage_->available_state_interfaces_.begin(),
-      resource_storage_->available_state_interfaces_.end(), interface);
-    if (found_it != resource_storage_->available_state_interfaces_.end())
+    if (resource_storage_->available_state_interfaces_.make_unavailable(interface))
     {
-      resource_storage_->available_state_interfaces_.erase(found_it);
       RCUTILS_LOG_DEBUG_NAMED(
         "resource_manager", "'%s' state interface removed from available list", interface.c_str());
     }
@@ -1749,7 +4985,7 @@ void ResourceManager::remove_controller_exported_state_interfaces(
     resource_storage_->controllers_exported_state_interfaces_map_.at(controller_name);
   resource_storage_->controllers_exported_state_interfaces_map_.erase(controller_name);
 
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   resource_storage_->remove_state_interfaces(interface_names);
 }
 
@@ -1776,8 +5012,11 @@ void ResourceManager::make_controller_reference_interfaces_available(
 {
   auto interface_names =
     resource_storage_->controllers_reference_interfaces_map_.at(controller_name);
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
-  ros2_control::add_items(resource_storage_->available_command_interfaces_, interface_names);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  for (const auto & interface : interface_names)
+  {
+    resource_storage_->available_command_interfaces_.make_available(interface);
+  }
 }
 
 // CM API: Called in "update"-thread
@@ -1787,15 +5026,11 @@ void ResourceManager::make_controller_reference_interfaces_unavailable(
   auto interface_names =
     resource_storage_->controllers_reference_interfaces_map_.at(controller_name);
 
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   for (const auto & interface : interface_names)
   {
-    auto found_it = std::find(
-      resource_storage_->available_command_interfaces_.begin(),
-      resource_storage_->available_command_interfaces_.end(), interface);
-    if (found_it != resource_storage_->available_command_interfaces_.end())
+    if (resource_storage_->available_command_interfaces_.make_unavailable(interface))
     {
-      resource_storage_->available_command_interfaces_.erase(found_it);
       RCLCPP_DEBUG(
         get_logger(), "'%s' command interface removed from available list", interface.c_str());
     }
@@ -1823,47 +5058,65 @@ void ResourceManager::remove_controller_reference_interfaces(const std::string &
 void ResourceManager::cache_controller_to_hardware(
   const std::string & controller_name, const std::vector<std::string> & interfaces)
 {
-  for (const auto & interface : interfaces)
+  cache_controller_to_hardware(controller_name, interfaces, interfaces);
+}
+
+// CM API: Called in "callback/slow"-thread
+void ResourceManager::cache_controller_to_hardware(
+  const std::string & controller_name, const std::vector<std::string> & command_interfaces,
+  const std::vector<std::string> & state_interfaces)
+{
+  resource_storage_->update_hardware_dependencies(
+    [&](HardwareDependencyIndex & dependencies) {
+      dependencies.add_controller_interfaces(controller_name, command_interfaces, state_interfaces);
+    });
+}
+
+// CM API: Called in "callback/slow"-thread
+void ResourceManager::remove_cached_controller_to_hardware(const std::string & controller_name)
+{
+  if (!get_hardware_dependencies()->find_controller(controller_name).has_value())
   {
-    bool found = false;
-    for (const auto & [hw_name, hw_info] : resource_storage_->hardware_info_map_)
-    {
-      auto cmd_itf_it =
-        std::find(hw_info.command_interfaces.begin(), hw_info.command_interfaces.end(), interface);
-      if (cmd_itf_it != hw_info.command_interfaces.end())
-      {
-        found = true;
-      }
-      auto state_itf_it =
-        std::find(hw_info.state_interfaces.begin(), hw_info.state_interfaces.end(), interface);
-      if (state_itf_it != hw_info.state_interfaces.end())
-      {
-        found = true;
-      }
+    return;
+  }
+  resource_storage_->update_hardware_dependencies(
+    [&controller_name](HardwareDependencyIndex & dependencies)
+    { dependencies.remove_controller(controller_name); });
+}
 
-      if (found)
-      {
-        // check if controller exist already in the list and if not add it
-        auto controllers = resource_storage_->hardware_used_by_controllers_[hw_name];
-        auto ctrl_it = std::find(controllers.begin(), controllers.end(), controller_name);
-        if (ctrl_it == controllers.end())
-        {
-          // add because it does not exist
-          controllers.reserve(controllers.size() + 1);
-          controllers.push_back(controller_name);
-        }
-        resource_storage_->hardware_used_by_controllers_[hw_name] = controllers;
-        break;
-      }
+std::vector<std::string> ResourceManager::get_cached_controllers_to_hardware(
+  const std::string & hardware_name)
+{
+  std::vector<std::string> controllers;
+  const auto dependencies = get_hardware_dependencies();
+  const auto component_index = dependencies->find_component(hardware_name);
+  if (component_index.has_value())
+  {
+    for (const auto controller_index :
+         dependencies->get_controllers_of_component(component_index.value()))
+    {
+      controllers.push_back(dependencies->get_controller_name(controller_index));
     }
   }
+  return controllers;
 }
 
 // CM API: Called in "update"-thread
-std::vector<std::string> ResourceManager::get_cached_controllers_to_hardware(
-  const std::string & hardware_name)
+ResourceManager::HardwareDependencies ResourceManager::get_hardware_dependencies() const
+{
+  return resource_storage_->hardware_dependencies_.read();
+}
+
+std::optional<std::size_t> ResourceManager::get_hardware_component_index(
+  const std::string & hardware_name) const
 {
-  return resource_storage_->hardware_used_by_controllers_[hardware_name];
+  const auto & names = resource_storage_->hardware_component_names_;
+  const auto name_it = std::find(names.begin(), names.end(), hardware_name);
+  if (name_it == names.end())
+  {
+    return std::nullopt;
+  }
+  return static_cast<std::size_t>(std::distance(names.begin(), name_it));
 }
 
 // CM API: Called in "update"-thread
@@ -1874,7 +5127,7 @@ bool ResourceManager::command_interface_is_claimed(const std::string & key) cons
     return false;
   }
 
-  std::lock_guard<std::recursive_mutex> guard_claimed(claimed_command_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard_claimed(claimed_command_interfaces_lock_);
   return resource_storage_->claimed_command_interface_map_.at(key);
 }
 
@@ -1887,7 +5140,7 @@ LoanedCommandInterface ResourceManager::claim_command_interface(const std::strin
       fmt::format(FMT_COMPILE("Command interface with key '{}' does not exist"), key));
   }
 
-  std::lock_guard<std::recursive_mutex> guard_claimed(claimed_command_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard_claimed(claimed_command_interfaces_lock_);
   if (command_interface_is_claimed(key))
   {
     throw std::runtime_error(
@@ -1895,24 +5148,54 @@ LoanedCommandInterface ResourceManager::claim_command_interface(const std::strin
   }
 
   resource_storage_->claimed_command_interface_map_[key] = true;
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  resource_storage_->claimed_command_interfaces_version_.fetch_add(1u, std::memory_order_release);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   return LoanedCommandInterface(
     resource_storage_->command_interface_map_.at(key),
     std::bind(&ResourceManager::release_command_interface, this, key));
 }
 
+// CM API: Called in "callback/slow"-thread
+std::vector<CommandInterface::SharedPtr> ResourceManager::make_detached_command_interfaces(
+  const std::vector<std::string> & keys) const
+{
+  std::vector<CommandInterface::SharedPtr> copies;
+  copies.reserve(keys.size());
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  for (const auto & key : keys)
+  {
+    if (!command_interface_is_available(key))
+    {
+      throw std::runtime_error(
+        fmt::format(FMT_COMPILE("Command interface with key '{}' does not exist"), key));
+    }
+    copies.push_back(
+      CommandInterface::make_detached_copy(*resource_storage_->command_interface_map_.at(key)));
+  }
+  return copies;
+}
+
 // CM API: Called in "update"-thread
 void ResourceManager::release_command_interface(const std::string & key)
 {
-  std::lock_guard<std::recursive_mutex> guard_claimed(claimed_command_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard_claimed(claimed_command_interfaces_lock_);
   resource_storage_->claimed_command_interface_map_[key] = false;
+  resource_storage_->claimed_command_interfaces_version_.fetch_add(1u, std::memory_order_release);
+}
+
+// CM API: Called in "callback/slow"-thread
+uint64_t ResourceManager::get_interfaces_version() const
+{
+  return resource_storage_->available_state_interfaces_.get_version() +
+         resource_storage_->available_command_interfaces_.get_version() +
+         resource_storage_->claimed_command_interfaces_version_.load(std::memory_order_acquire);
 }
 
 // CM API: Called in "callback/slow"-thread
 std::vector<std::string> ResourceManager::command_interface_keys() const
 {
   std::vector<std::string> keys;
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   for (const auto & item : resource_storage_->command_interface_map_)
   {
     keys.push_back(std::get<0>(item));
@@ -1923,20 +5206,20 @@ std::vector<std::string> ResourceManager::command_interface_keys() const
 // CM API: Called in "update"-thread
 std::vector<std::string> ResourceManager::available_command_interfaces() const
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
-  return resource_storage_->available_command_interfaces_;
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  return resource_storage_->available_command_interfaces_.get_names();
 }
 
 // CM API: Called in "callback/slow"-thread
 bool ResourceManager::command_interface_is_available(const std::string & name) const
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
-  return ros2_control::has_item(resource_storage_->available_command_interfaces_, name);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  return resource_storage_->available_command_interfaces_.is_available(name);
 }
 
 std::string ResourceManager::get_command_interface_data_type(const std::string & name) const
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   auto it = resource_storage_->command_interface_map_.find(name);
   if (it != resource_storage_->command_interface_map_.end())
   {
@@ -1949,34 +5232,68 @@ std::string ResourceManager::get_command_interface_data_type(const std::string &
   }
 }
 
+InterfaceChangeTracker ResourceManager::make_command_interface_change_tracker(
+  const std::vector<std::string> & names) const
+{
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  std::vector<std::shared_ptr<const Handle>> handles;
+  handles.reserve(names.size());
+  for (const auto & name : names)
+  {
+    auto it = resource_storage_->command_interface_map_.find(name);
+    if (it == resource_storage_->command_interface_map_.end())
+    {
+      throw std::runtime_error(
+        std::string("Command interface with '") + name + std::string("' does not exist"));
+    }
+    handles.push_back(it->second);
+  }
+  return InterfaceChangeTracker(std::move(handles));
+}
+
 void ResourceManager::import_component(
   std::unique_ptr<ActuatorInterface> actuator, const HardwareComponentParams & params)
 {
-  std::lock_guard<std::recursive_mutex> guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> limiters_guard(joint_limiters_lock_);
   resource_storage_->initialize_actuator(std::move(actuator), params);
-  read_write_status.failed_hardware_names.reserve(
-    resource_storage_->actuators_.size() + resource_storage_->sensors_.size() +
-    resource_storage_->systems_.size());
+  resource_storage_->update_cycle_contexts();
+  read_write_status.failed_hardware_names.reset(resource_storage_->hardware_component_names_);
+  resource_storage_->update_hardware_status_sources();
+  resource_storage_->resolve_joint_limiter_bindings();
+  resource_storage_->configure_transmission_stage();
 }
 
 void ResourceManager::import_component(
   std::unique_ptr<SensorInterface> sensor, const HardwareComponentParams & params)
 {
-  std::lock_guard<std::recursive_mutex> guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> limiters_guard(joint_limiters_lock_);
   resource_storage_->initialize_sensor(std::move(sensor), params);
-  read_write_status.failed_hardware_names.reserve(
-    resource_storage_->actuators_.size() + resource_storage_->sensors_.size() +
-    resource_storage_->systems_.size());
+  resource_storage_->update_cycle_contexts();
+  read_write_status.failed_hardware_names.reset(resource_storage_->hardware_component_names_);
+  resource_storage_->update_hardware_status_sources();
+  resource_storage_->resolve_joint_limiter_bindings();
+  resource_storage_->configure_transmission_stage();
 }
 
 void ResourceManager::import_component(
   std::unique_ptr<SystemInterface> system, const HardwareComponentParams & params)
 {
-  std::lock_guard<std::recursive_mutex> guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> limiters_guard(joint_limiters_lock_);
   resource_storage_->initialize_system(std::move(system), params);
-  read_write_status.failed_hardware_names.reserve(
-    resource_storage_->actuators_.size() + resource_storage_->sensors_.size() +
-    resource_storage_->systems_.size());
+  resource_storage_->update_cycle_contexts();
+  read_write_status.failed_hardware_names.reset(resource_storage_->hardware_component_names_);
+  resource_storage_->update_hardware_status_sources();
+  resource_storage_->resolve_joint_limiter_bindings();
+  resource_storage_->configure_transmission_stage();
+}
+
+std::shared_ptr<const TransmissionStageStatistics>
+ResourceManager::get_transmission_stage_statistics() const
+{
+  return resource_storage_->transmission_stage_statistics_;
 }
 
 // CM API: Called in "callback/slow"-thread
@@ -1999,6 +5316,60 @@ ResourceManager::get_components_status()
   return resource_storage_->hardware_info_map_;
 }
 
+std::vector<std::pair<std::string, LockContentionStatistics>>
+ResourceManager::get_lock_contention_statistics() const
+{
+  return {
+    {"resources", resources_lock_.get_statistics()},
+    {"resource_interfaces", resource_interfaces_lock_.get_statistics()},
+    {"claimed_command_interfaces", claimed_command_interfaces_lock_.get_statistics()},
+    {"joint_limiters", joint_limiters_lock_.get_statistics()}};
+}
+
+std::shared_ptr<CycleTrigger> ResourceManager::get_cycle_trigger(
+  const std::string & component_name) const
+{
+  auto find_cycle_trigger = [&](const auto & components) -> std::shared_ptr<CycleTrigger>
+  {
+    const auto it = std::find_if(
+      components.begin(), components.end(),
+      [&](const auto & component) { return component.get_name() == component_name; });
+    return it == components.end() ? nullptr : it->get_cycle_trigger();
+  };
+
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+  auto cycle_trigger = find_cycle_trigger(resource_storage_->actuators_);
+  if (!cycle_trigger)
+  {
+    cycle_trigger = find_cycle_trigger(resource_storage_->sensors_);
+  }
+  if (!cycle_trigger)
+  {
+    cycle_trigger = find_cycle_trigger(resource_storage_->systems_);
+  }
+  return cycle_trigger;
+}
+
+void ResourceManager::set_introspected_interfaces(const std::vector<std::string> & patterns)
+{
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  resource_storage_->set_introspected_interfaces(patterns);
+}
+
+std::pair<std::vector<std::string>, std::vector<std::string>>
+ResourceManager::get_introspected_interfaces() const
+{
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
+  std::pair<std::vector<std::string>, std::vector<std::string>> interfaces{
+    {resource_storage_->introspected_state_interfaces_.begin(),
+     resource_storage_->introspected_state_interfaces_.end()},
+    {resource_storage_->introspected_command_interfaces_.begin(),
+     resource_storage_->introspected_command_interfaces_.end()}};
+  std::sort(interfaces.first.begin(), interfaces.first.end());
+  std::sort(interfaces.second.begin(), interfaces.second.end());
+  return interfaces;
+}
+
 const std::unordered_map<std::string, joint_limits::JointLimits> &
 ResourceManager::get_hard_joint_limits() const
 {
@@ -2011,6 +5382,26 @@ ResourceManager::get_soft_joint_limits() const
   return resource_storage_->soft_joint_limits_;
 }
 
+std::shared_ptr<const JointLimitsStore> ResourceManager::get_joint_limits_store() const
+{
+  return resource_storage_->joint_limits_store_;
+}
+
+std::shared_ptr<const EdgeEventList> ResourceManager::get_edge_events() const
+{
+  return resource_storage_->edge_events_;
+}
+
+void ResourceManager::set_auxiliary_decimation(uint32_t decimation)
+{
+  resource_storage_->auxiliary_decimation_.store(decimation, std::memory_order_relaxed);
+}
+
+uint32_t ResourceManager::get_auxiliary_decimation() const
+{
+  return resource_storage_->auxiliary_decimation_.load(std::memory_order_relaxed);
+}
+
 // CM API: Called in "callback/slow"-thread
 bool ResourceManager::prepare_command_mode_switch(
   const std::vector<std::string> & start_interfaces,
@@ -2022,150 +5413,227 @@ bool ResourceManager::prepare_command_mode_switch(
     return true;
   }
 
-  // Check if interface exists
-  std::stringstream ss_not_existing;
-  ss_not_existing << "Not existing: " << std::endl << "[" << std::endl;
-  auto check_exist = [&](const std::vector<std::string> & list_to_check)
+  // the messages are only formatted if an interface is rejected
+  auto report_rejected_interfaces = [&](const char * title, auto && is_accepted)
   {
-    bool all_exist = true;
-    for (const auto & interface : list_to_check)
+    auto all_accepted = [&is_accepted](const std::vector<std::string> & list_to_check)
+    {
+      return std::all_of(list_to_check.begin(), list_to_check.end(), is_accepted);
+    };
+    if (all_accepted(start_interfaces) && all_accepted(stop_interfaces))
     {
-      if (!command_interface_exists(interface))
+      return false;
+    }
+    std::stringstream ss_rejected;
+    ss_rejected << title << ": " << std::endl << "[" << std::endl;
+    for (const auto * list_to_check : {&start_interfaces, &stop_interfaces})
+    {
+      for (const auto & interface : *list_to_check)
       {
-        all_exist = false;
-        ss_not_existing << " " << interface << std::endl;
+        if (!is_accepted(interface))
+        {
+          ss_rejected << " " << interface << std::endl;
+        }
       }
     }
-    return all_exist;
-  };
-  if (!(check_exist(start_interfaces) && check_exist(stop_interfaces)))
-  {
-    ss_not_existing << "]" << std::endl;
+    ss_rejected << "]" << std::endl;
     RCLCPP_ERROR(
       get_logger(), "Not acceptable command interfaces combination: \n%s%s",
-      interfaces_to_string(start_interfaces, stop_interfaces).c_str(),
-      ss_not_existing.str().c_str());
+      interfaces_to_string(start_interfaces, stop_interfaces).c_str(), ss_rejected.str().c_str());
+    return true;
+  };
+
+  // Check if interface exists
+  if (report_rejected_interfaces(
+        "Not existing",
+        [this](const std::string & interface) { return command_interface_exists(interface); }))
+  {
     return false;
   }
 
   // Check if interfaces are available
-  std::stringstream ss_not_available;
-  ss_not_available << "Not available: " << std::endl << "[" << std::endl;
-  auto check_available = [&](const std::vector<std::string> & list_to_check)
+  if (report_rejected_interfaces(
+        "Not available", [this](const std::string & interface)
+        { return command_interface_is_available(interface); }))
+  {
+    return false;
+  }
+
+  auto prepare_mode_switch =
+    [logger = get_logger(),
+     allow_controller_activation_with_inactive_hardware =
+       allow_controller_activation_with_inactive_hardware_](const CommandModeSwitchEntry & entry)
   {
-    bool all_available = true;
-    for (const auto & interface : list_to_check)
+    auto & component = *entry.component;
+    const auto & start_interfaces_buffer = entry.start_interfaces;
+    const auto & stop_interfaces_buffer = entry.stop_interfaces;
+    if (
+      !start_interfaces_buffer.empty() &&
+      component.get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE &&
+      !allow_controller_activation_with_inactive_hardware)
     {
-      if (!command_interface_is_available(interface))
-      {
-        all_available = false;
-        ss_not_available << " " << interface << std::endl;
-      }
+      RCLCPP_WARN(
+        logger, "Component '%s' is in INACTIVE state, but has start interfaces to switch: \n%s",
+        component.get_name().c_str(),
+        interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
+      return false;
+    }
+    if (
+      component.get_lifecycle_id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE &&
+      component.get_lifecycle_id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+    {
+      RCLCPP_WARN(
+        logger, "Component '%s' is not in INACTIVE or ACTIVE state, skipping the prepare switch",
+        component.get_name().c_str());
+      return false;
+    }
+    if (
+      return_type::OK !=
+      component.prepare_command_mode_switch(start_interfaces_buffer, stop_interfaces_buffer))
+    {
+      RCLCPP_ERROR(
+        logger, "Component '%s' did not accept command interfaces combination: \n%s",
+        component.get_name().c_str(),
+        interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
+      return false;
     }
-    return all_available;
+    return true;
   };
-  if (!(check_available(start_interfaces) && check_available(stop_interfaces)))
+
+  std::lock_guard<std::mutex> plan_guard(resource_storage_->command_mode_switch_plan_mutex_);
+  auto & plan = resource_storage_->command_mode_switch_plan_;
+  resource_storage_->build_command_mode_switch_plan(start_interfaces, stop_interfaces, plan);
+
+  /// Result of the preparation of a component, written by the thread preparing it
+  struct PendingPrepare
   {
-    ss_not_available << "]" << std::endl;
-    RCLCPP_ERROR(
-      get_logger(), "Not acceptable command interfaces combination: \n%s%s",
-      interfaces_to_string(start_interfaces, stop_interfaces).c_str(),
-      ss_not_available.str().c_str());
-    return false;
+    const CommandModeSwitchEntry * entry = nullptr;
+    bool prepared = false;
+    double duration = 0.0;
+    std::exception_ptr exception = nullptr;
+  };
+  std::vector<PendingPrepare> pending;
+  std::vector<std::string> groups;
+  for (const auto * entries : {&plan.actuator_entries, &plan.system_entries})
+  {
+    for (const auto & entry : *entries)
+    {
+      pending.push_back({&entry});
+      groups.push_back(entry.component->get_group_name());
+    }
   }
 
-  const auto & hardware_info_map = resource_storage_->hardware_info_map_;
-  auto call_prepare_mode_switch =
-    [&start_interfaces, &stop_interfaces, &hardware_info_map, logger = get_logger(),
-     allow_controller_activation_with_inactive_hardware =
-       allow_controller_activation_with_inactive_hardware_,
-     handle_exceptions = params_.handle_exceptions](
-      auto & components, auto & start_interfaces_buffer, auto & stop_interfaces_buffer)
+  // the components of a group are prepared one after the other, e.g., on the same bus
+  const auto units = group_into_units(groups);
+  run_units_concurrently(
+    units, get_units_threads_count(params_.component_initialization_threads, units.size()),
+    [&pending, &prepare_mode_switch](std::size_t i)
+    {
+      const auto start_time = std::chrono::steady_clock::now();
+      try
+      {
+        pending[i].prepared = prepare_mode_switch(*pending[i].entry);
+      }
+      catch (...)
+      {
+        pending[i].exception = std::current_exception();
+      }
+      pending[i].duration =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    });
+
+  bool ret = true;
+  std::exception_ptr exception = nullptr;
+  const double timeout = params_.command_mode_switch_prepare_timeout;
+  for (auto & result : pending)
   {
-    bool ret = true;
-    for (auto & component : components)
+    const auto & component = *result.entry->component;
+    if (result.exception)
     {
-      const auto & hw_command_itfs = hardware_info_map.at(component.get_name()).command_interfaces;
-      find_common_hardware_interfaces(hw_command_itfs, start_interfaces, start_interfaces_buffer);
-      find_common_hardware_interfaces(hw_command_itfs, stop_interfaces, stop_interfaces_buffer);
-      if (start_interfaces_buffer.empty() && stop_interfaces_buffer.empty())
+      try
       {
-        RCLCPP_DEBUG(
-          logger, "Component '%s' after filtering has no command interfaces to switch",
-          component.get_name().c_str());
-        continue;
+        std::rethrow_exception(result.exception);
       }
-      if (
-        !start_interfaces_buffer.empty() &&
-        component.get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE &&
-        !allow_controller_activation_with_inactive_hardware)
+      catch (const std::exception & e)
       {
-        RCLCPP_WARN(
-          logger, "Component '%s' is in INACTIVE state, but has start interfaces to switch: \n%s",
+        RCLCPP_ERROR(
+          get_logger(),
+          "Exception of type : %s occurred while preparing command mode switch for component "
+          "'%s' for the interfaces: \n %s : %s",
+          typeid(e).name(), component.get_name().c_str(),
+          interfaces_to_string(result.entry->start_interfaces, result.entry->stop_interfaces)
+            .c_str(),
+          e.what());
+      }
+      catch (...)
+      {
+        RCLCPP_ERROR(
+          get_logger(),
+          "Unknown exception occurred while preparing command mode switch for component '%s' for "
+          "the interfaces: \n %s",
           component.get_name().c_str(),
-          interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
-        return false;
+          interfaces_to_string(result.entry->start_interfaces, result.entry->stop_interfaces)
+            .c_str());
       }
-      if (
-        component.get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE ||
-        component.get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+      exception = exception ? exception : result.exception;
+    }
+    else if (result.prepared && timeout > 0.0 && result.duration > timeout)
+    {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Component '%s' took %.3f s to prepare the command mode switch, more than the timeout of "
+        "%.3f s.",
+        component.get_name().c_str(), result.duration, timeout);
+      result.prepared = false;
+    }
+    ret &= result.prepared;
+  }
+
+  if (!ret)
+  {
+    // the switch won't be performed, the prepared components drop their preparation
+    for (const auto & result : pending)
+    {
+      if (!result.prepared)
       {
-        try
-        {
-          if (
-            return_type::OK !=
-            component.prepare_command_mode_switch(start_interfaces_buffer, stop_interfaces_buffer))
-          {
-            RCLCPP_ERROR(
-              logger, "Component '%s' did not accept command interfaces combination: \n%s",
-              component.get_name().c_str(),
-              interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
-            ret = false;
-          }
-        }
-        catch (const std::exception & e)
-        {
-          RCLCPP_ERROR(
-            logger,
-            "Exception of type : %s occurred while preparing command mode switch for component "
-            "'%s' for the interfaces: \n %s : %s",
-            typeid(e).name(), component.get_name().c_str(),
-            interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str(),
-            e.what());
-          handle_exceptions ? void() : throw;
-          ret = false;
-        }
-        catch (...)
+        continue;
+      }
+      auto & component = *result.entry->component;
+      try
+      {
+        if (
+          return_type::OK != component.abort_command_mode_switch(
+                               result.entry->start_interfaces, result.entry->stop_interfaces))
         {
           RCLCPP_ERROR(
-            logger,
-            "Unknown exception occurred while preparing command mode switch for component '%s' for "
-            "the interfaces: \n %s",
-            component.get_name().c_str(),
-            interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
-          handle_exceptions ? void() : throw;
-          ret = false;
+            get_logger(), "Component '%s' failed to abort the prepared command mode switch.",
+            component.get_name().c_str());
         }
       }
-      else
+      catch (const std::exception & e)
       {
-        RCLCPP_WARN(
-          logger, "Component '%s' is not in INACTIVE or ACTIVE state, skipping the prepare switch",
-          component.get_name().c_str());
-        ret = false;
+        RCLCPP_ERROR(
+          get_logger(),
+          "Exception of type : %s occurred while aborting the command mode switch of component "
+          "'%s': %s",
+          typeid(e).name(), component.get_name().c_str(), e.what());
       }
-    }
-    return ret;
-  };
-
-  const bool actuators_result = call_prepare_mode_switch(
-    resource_storage_->actuators_, resource_storage_->start_interfaces_buffer_,
-    resource_storage_->stop_interfaces_buffer_);
-  const bool systems_result = call_prepare_mode_switch(
-    resource_storage_->systems_, resource_storage_->start_interfaces_buffer_,
-    resource_storage_->stop_interfaces_buffer_);
+      catch (...)
+      {
+        RCLCPP_ERROR(
+          get_logger(),
+          "Unknown exception occurred while aborting the command mode switch of component '%s'.",
+          component.get_name().c_str());
+      }
+    }
+  }
+  if (exception && !params_.handle_exceptions)
+  {
+    std::rethrow_exception(exception);
+  }
 
-  return actuators_result && systems_result;
+  plan.valid = ret;
+  return ret;
 }
 
 // CM API: Called in "update"-thread
@@ -2179,27 +5647,19 @@ bool ResourceManager::perform_command_mode_switch(
     return true;
   }
 
-  const auto & hardware_info_map = resource_storage_->hardware_info_map_;
   auto call_perform_mode_switch =
-    [&start_interfaces, &stop_interfaces, &hardware_info_map, logger = get_logger(),
+    [logger = get_logger(),
      allow_controller_activation_with_inactive_hardware =
        allow_controller_activation_with_inactive_hardware_,
-     handle_exceptions = params_.handle_exceptions](
-      auto & components, auto & start_interfaces_buffer, auto & stop_interfaces_buffer)
+     handle_exceptions =
+       params_.handle_exceptions](const std::vector<CommandModeSwitchEntry> & entries)
   {
     bool ret = true;
-    for (auto & component : components)
+    for (const auto & entry : entries)
     {
-      const auto & hw_command_itfs = hardware_info_map.at(component.get_name()).command_interfaces;
-      find_common_hardware_interfaces(hw_command_itfs, start_interfaces, start_interfaces_buffer);
-      find_common_hardware_interfaces(hw_command_itfs, stop_interfaces, stop_interfaces_buffer);
-      if (start_interfaces_buffer.empty() && stop_interfaces_buffer.empty())
-      {
-        RCLCPP_DEBUG(
-          logger, "Component '%s' after filtering has no command interfaces to perform switch",
-          component.get_name().c_str());
-        continue;
-      }
+      auto & component = *entry.component;
+      const auto & start_interfaces_buffer = entry.start_interfaces;
+      const auto & stop_interfaces_buffer = entry.stop_interfaces;
       if (
         !start_interfaces_buffer.empty() &&
         component.get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE &&
@@ -2264,24 +5724,42 @@ bool ResourceManager::perform_command_mode_switch(
     return ret;
   };
 
-  const bool actuators_result = call_perform_mode_switch(
-    resource_storage_->actuators_, resource_storage_->start_interfaces_buffer_,
-    resource_storage_->stop_interfaces_buffer_);
-  const bool systems_result = call_perform_mode_switch(
-    resource_storage_->systems_, resource_storage_->start_interfaces_buffer_,
-    resource_storage_->stop_interfaces_buffer_);
+  // the plan is only used if it was prepared for this switch, and never waited for
+  std::unique_lock<std::mutex> plan_lock(
+    resource_storage_->command_mode_switch_plan_mutex_, std::try_to_lock);
+  auto & prepared_plan = resource_storage_->command_mode_switch_plan_;
+  const bool use_prepared_plan = plan_lock.owns_lock() && prepared_plan.valid &&
+                                 prepared_plan.start_interfaces == start_interfaces &&
+                                 prepared_plan.stop_interfaces == stop_interfaces;
+  CommandModeSwitchPlan unprepared_plan;
+  if (!use_prepared_plan)
+  {
+    RCLCPP_DEBUG(
+      get_logger(), "The command mode switch was not prepared, resolving it in the switch.");
+    resource_storage_->build_command_mode_switch_plan(
+      start_interfaces, stop_interfaces, unprepared_plan);
+  }
+  auto & plan = use_prepared_plan ? prepared_plan : unprepared_plan;
+  const bool actuators_result = call_perform_mode_switch(plan.actuator_entries);
+  const bool systems_result = call_perform_mode_switch(plan.system_entries);
+  if (use_prepared_plan)
+  {
+    prepared_plan.valid = false;
+  }
 
   if (actuators_result && systems_result)
   {
     // Reset the internals of the joint limiters
-    for (auto & [hw_name, limiters] : resource_storage_->joint_limiters_interface_)
+    const auto bindings = resource_storage_->joint_limiter_bindings_.read();
+    for (std::size_t i = 0; bindings && i < bindings->size(); ++i)
     {
-      for (const auto & [joint_name, limiter] : limiters)
+      const auto limiter = (*bindings.get())[i].limiter->read();
+      if (limiter)
       {
         limiter->reset_internals();
         RCLCPP_DEBUG(
-          get_logger(), "Resetting internals of joint limiter for joint '%s' in hardware '%s'",
-          joint_name.c_str(), hw_name.c_str());
+          get_logger(), "Resetting internals of joint limiter for joint '%s'",
+          (*bindings.get())[i].data->joint_name.c_str());
       }
     }
   }
@@ -2308,29 +5786,7 @@ return_type ResourceManager::set_component_state(
 
   return_type result = return_type::OK;
 
-  if (target_state.id() == 0)
-  {
-    if (target_state.label() == lifecycle_state_names::UNCONFIGURED)
-    {
-      target_state = rclcpp_lifecycle::State(
-        State::PRIMARY_STATE_UNCONFIGURED, lifecycle_state_names::UNCONFIGURED);
-    }
-    if (target_state.label() == lifecycle_state_names::INACTIVE)
-    {
-      target_state =
-        rclcpp_lifecycle::State(State::PRIMARY_STATE_INACTIVE, lifecycle_state_names::INACTIVE);
-    }
-    if (target_state.label() == lifecycle_state_names::ACTIVE)
-    {
-      target_state =
-        rclcpp_lifecycle::State(State::PRIMARY_STATE_ACTIVE, lifecycle_state_names::ACTIVE);
-    }
-    if (target_state.label() == lifecycle_state_names::FINALIZED)
-    {
-      target_state =
-        rclcpp_lifecycle::State(State::PRIMARY_STATE_FINALIZED, lifecycle_state_names::FINALIZED);
-    }
-  }
+  resolve_target_state_id(target_state);
 
   auto find_set_component_state = [&](auto action, auto & components)
   {
@@ -2353,8 +5809,8 @@ return_type ResourceManager::set_component_state(
     return false;
   };
 
-  std::lock_guard<std::recursive_mutex> guard(resources_lock_);
-  std::lock_guard<std::recursive_mutex> limiters_guard(joint_limiters_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> limiters_guard(joint_limiters_lock_);
   bool found = find_set_component_state(
     std::bind(&ResourceStorage::set_component_state<Actuator>, resource_storage_.get(), _1, _2),
     resource_storage_->actuators_);
@@ -2374,237 +5830,701 @@ return_type ResourceManager::set_component_state(
   return result;
 }
 
-// CM API: Called in "update"-thread
-bool ResourceManager::enforce_command_limits(const rclcpp::Duration & period)
+std::vector<return_type> ResourceManager::set_components_state(
+  const std::vector<std::string> & component_names, rclcpp_lifecycle::State & target_state)
 {
-  std::unique_lock<std::recursive_mutex> limiters_guard(joint_limiters_lock_, std::try_to_lock);
-  if (!limiters_guard.owns_lock())
+  resolve_target_state_id(target_state);
+
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> limiters_guard(joint_limiters_lock_);
+  std::scoped_lock interfaces_guard(resource_interfaces_lock_, claimed_command_interfaces_lock_);
+  const auto results = resource_storage_->set_components_state_concurrently(
+    component_names, target_state, params_.component_initialization_threads);
+  std::vector<return_type> return_values;
+  return_values.reserve(results.size());
+  for (const bool result : results)
   {
-    return false;
+    return_values.push_back(result ? return_type::OK : return_type::ERROR);
+  }
+  return return_values;
+}
+
+std::size_t ResourceManager::run_requested_transitions()
+{
+  if (!resource_storage_->transitions_requested_.exchange(false, std::memory_order_acq_rel))
+  {
+    return 0;
+  }
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+  std::size_t transitions = 0;
+  auto run_component_transition = [&](auto & component)
+  {
+    switch (component.take_requested_transition())
+    {
+      case HardwareComponent::RequestedTransition::ERROR:
+        RCLCPP_INFO(
+          get_logger(), "Running the error transition of hardware '%s' requested by the control "
+          "loop", component.get_name().c_str());
+        component.error();
+        resource_storage_->schedule_recovery(component);
+        ++transitions;
+        break;
+      case HardwareComponent::RequestedTransition::DEACTIVATE:
+      {
+        rclcpp_lifecycle::State inactive_state(
+          lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, lifecycle_state_names::INACTIVE);
+        set_component_state(component.get_name(), inactive_state);
+        ++transitions;
+        break;
+      }
+      case HardwareComponent::RequestedTransition::NONE:
+        break;
+    }
+  };
+  for (auto & actuator : resource_storage_->actuators_)
+  {
+    run_component_transition(actuator);
   }
+  for (auto & sensor : resource_storage_->sensors_)
+  {
+    run_component_transition(sensor);
+  }
+  for (auto & system : resource_storage_->systems_)
+  {
+    run_component_transition(system);
+  }
+  return transitions;
+}
 
-  bool enforce_result = false;
-  // Joint Limiters operations
-  for (auto & [hw_name, limiters] : resource_storage_->joint_limiters_interface_)
+std::size_t ResourceManager::run_component_recoveries()
+{
+  if (!resource_storage_->recoveries_pending_.load(std::memory_order_acquire))
+  {
+    return 0;
+  }
+  std::vector<std::pair<std::string, bool>> recovered_components;
+  {
+    std::lock_guard<InstrumentedRecursiveMutex> guard(resources_lock_);
+    const auto now = std::chrono::steady_clock::now();
+    auto & pending_recoveries = resource_storage_->pending_recoveries_;
+    for (auto it = pending_recoveries.begin(); it != pending_recoveries.end();)
+    {
+      const std::string & name = it->first;
+      auto & recovery = it->second;
+      if (now < recovery.next_attempt)
+      {
+        ++it;
+        continue;
+      }
+      const auto & recovery_params = resource_storage_->hardware_info_map_.at(name).recovery_params;
+      ++recovery.attempts;
+      rclcpp_lifecycle::State active_state(
+        lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, lifecycle_state_names::ACTIVE);
+      if (set_component_state(name, active_state) == return_type::OK)
+      {
+        RCLCPP_INFO(
+          get_logger(), "Recovered hardware '%s' after %u attempt(s).", name.c_str(),
+          recovery.attempts);
+        recovered_components.emplace_back(name, recovery_params.restore_controllers);
+        it = pending_recoveries.erase(it);
+        continue;
+      }
+      if (recovery.attempts >= recovery_params.max_attempts)
+      {
+        RCLCPP_ERROR(
+          get_logger(), "Giving up the recovery of hardware '%s' after %u failed attempts.",
+          name.c_str(), recovery.attempts);
+        it = pending_recoveries.erase(it);
+        continue;
+      }
+      recovery.backoff = std::min(2.0 * recovery.backoff, recovery_params.max_backoff);
+      recovery.next_attempt =
+        now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(recovery.backoff));
+      RCLCPP_WARN(
+        get_logger(), "Attempt %u of %u to recover hardware '%s' failed, retrying in %.3f s.",
+        recovery.attempts, recovery_params.max_attempts, name.c_str(), recovery.backoff);
+      ++it;
+    }
+    resource_storage_->recoveries_pending_.store(
+      !pending_recoveries.empty(), std::memory_order_release);
+  }
+  // the callback is run without the resources lock, it may switch the controllers
+  std::lock_guard<std::mutex> callback_guard(resource_storage_->on_component_recovered_mutex_);
+  if (resource_storage_->on_component_recovered_callback_)
   {
-    for (const auto & [joint_name, limiter] : limiters)
+    for (const auto & [name, restore_controllers] : recovered_components)
     {
-      enforce_result |= resource_storage_->enforce_command_limits(joint_name, period);
+      resource_storage_->on_component_recovered_callback_(name, restore_controllers);
     }
   }
-  return enforce_result;
+  return recovered_components.size();
+}
+
+void ResourceManager::set_on_component_recovered_callback(
+  std::function<void(const std::string &, bool)> callback)
+{
+  std::lock_guard<std::mutex> guard(resource_storage_->on_component_recovered_mutex_);
+  resource_storage_->on_component_recovered_callback_ = std::move(callback);
+}
+
+// CM API: Called in "update"-thread
+bool ResourceManager::enforce_command_limits(const rclcpp::Duration & period)
+{
+  return resource_storage_->enforce_command_limits(period);
 }
 
 // CM API: Called in "update"-thread
-HardwareReadWriteStatus ResourceManager::read(
+const HardwareReadWriteStatus & ResourceManager::read(
   const rclcpp::Time & /*time*/, const rclcpp::Duration & period)
 {
+  CycleContext cycle;
+  cycle.trigger_time = resource_storage_->get_clock()->now();
+  cycle.period = period;
+  return read(cycle);
+}
+
+// CM API: Called in "update"-thread
+const HardwareReadWriteStatus & ResourceManager::read(const CycleContext & cycle)
+{
+  const rclcpp::Duration & period = cycle.period;
   read_write_status.result = return_type::OK;
   read_write_status.failed_hardware_names.clear();
 
   // This is needed while we load and initialize the components
-  std::unique_lock<std::recursive_mutex> resource_guard(resources_lock_, std::try_to_lock);
+  std::unique_lock<InstrumentedRecursiveMutex> resource_guard(resources_lock_, std::try_to_lock);
   if (!resource_guard.owns_lock())
   {
+    RT_LOG_DEBUG(
+      get_logger(), "Skipping the read() cycle since the resources are locked by the thread %ld",
+      static_cast<long>(resources_lock_.get_statistics().last_blocking_thread));
     return read_write_status;
   }
-  auto read_components = [&](auto & components, bool handle_exceptions)
+  // one time sample for all the components, taken at the beginning of the control cycle
+  const rclcpp::Time & current_time = cycle.trigger_time;
+  const double cm_period = 1.0 / static_cast<double>(resource_storage_->cm_update_rate_);
+  const uint64_t read_cycle = resource_storage_->read_cycle_count_++;
+  const bool handle_exceptions = params_.handle_exceptions;
+  const uint32_t auxiliary_decimation =
+    resource_storage_->auxiliary_decimation_.load(std::memory_order_relaxed);
+  auto read_component = [&](auto & component, HardwareComponentCycleContext & cycle_context)
   {
-    for (auto & component : components)
+    if (cycle_context.auxiliary && !OverloadGovernor::is_due(auxiliary_decimation, read_cycle))
+    {
+      cycle_context.skipped = true;
+      return;
+    }
+    std::unique_lock<InstrumentedRecursiveMutex> lock(component.get_mutex(), std::try_to_lock);
+    cycle_context.skipped = !lock.owns_lock();
+    if (cycle_context.skipped)
     {
-      std::unique_lock<std::recursive_mutex> lock(component.get_mutex(), std::try_to_lock);
-      const std::string component_name = component.get_name();
-      if (!lock.owns_lock())
+      if (auto * read_statistics = cycle_context.read_statistics)
       {
-        RCLCPP_DEBUG(
-          get_logger(), "Skipping read() call for the component '%s' since it is locked",
-          component_name.c_str());
-        continue;
+        ++read_statistics->skipped_cycles;
       }
-      auto ret_val = return_type::OK;
-      try
+      RT_LOG_DEBUG(
+        get_logger(), "Skipping read() call for the component '%s' since it is locked",
+        component.get_name().c_str());
+      return;
+    }
+    if (
+      cycle_context.bus_state && cycle_context.bus_state->read != return_type::OK &&
+      is_configured(component))
+    {
+      // the data of the component wasn't received by its bus
+      cycle_context.result = cycle_context.bus_state->read;
+      return;
+    }
+    auto ret_val = return_type::OK;
+    try
+    {
+      TraceScope trace_scope(cycle_context.read_trace_id);
+      const uint64_t allocations_before = AllocationTracker::get_allocation_count();
+      auto read = [&](const rclcpp::Duration & read_period)
       {
-        auto & hardware_component_info = resource_storage_->hardware_info_map_[component_name];
-        const auto current_time = resource_storage_->get_clock()->now();
-        if (
-          hardware_component_info.rw_rate == 0 ||
-          hardware_component_info.rw_rate == resource_storage_->cm_update_rate_)
+        return execute_within_time_budget(
+          cycle_context.read_time_budget, get_logger(), *resource_storage_->get_clock(),
+          component.get_name(), "read",
+          [&]() { return component.read(current_time, read_period); });
+      };
+      if (cycle_context.runs_at_cm_rate)
+      {
+        ret_val = read(period);
+      }
+      else
+      {
+        const double read_rate = cycle_context.rw_rate;
+        const rclcpp::Duration actual_period =
+          component.get_last_read_time().get_clock_type() != RCL_CLOCK_UNINITIALIZED
+            ? current_time - component.get_last_read_time()
+            : rclcpp::Duration::from_seconds(1.0 / read_rate);
+
+        auto & rate_divider = cycle_context.read_rate_divider;
+        bool is_due = false;
+        if (rate_divider.is_divisible())
         {
-          ret_val = component.read(current_time, period);
+          is_due = rate_divider.is_due(read_cycle);
         }
         else
         {
-          const double read_rate = hardware_component_info.rw_rate;
-          const rclcpp::Duration actual_period =
-            component.get_last_read_time().get_clock_type() != RCL_CLOCK_UNINITIALIZED
-              ? current_time - component.get_last_read_time()
-              : rclcpp::Duration::from_seconds(1.0 / static_cast<double>(read_rate));
-
+          // rates not dividing the update rate are scheduled by comparing the elapsed time
           const double error_now = std::abs(actual_period.seconds() * read_rate - 1.0);
-          const double error_if_skipped = std::abs(
-            (actual_period.seconds() + 1.0 / resource_storage_->cm_update_rate_) * read_rate - 1.0);
-          if (error_now <= error_if_skipped)
-          {
-            ret_val = component.read(current_time, actual_period);
-          }
+          const double error_if_skipped =
+            std::abs((actual_period.seconds() + cm_period) * read_rate - 1.0);
+          is_due = error_now <= error_if_skipped;
         }
-        if (hardware_component_info.read_statistics)
+        if (is_due)
         {
-          const auto & read_statistics_collector = component.get_read_statistics();
-          hardware_component_info.read_statistics->execution_time.update_statistics(
-            read_statistics_collector.execution_time);
-          hardware_component_info.read_statistics->periodicity.update_statistics(
-            read_statistics_collector.periodicity);
+          ret_val = read(actual_period);
         }
-        const auto component_group = component.get_group_name();
-        ret_val =
-          resource_storage_->update_hardware_component_group_state(component_group, ret_val);
       }
-      catch (const std::exception & e)
+      if (auto * read_statistics = cycle_context.read_statistics)
       {
-        RCLCPP_ERROR(
-          get_logger(), "Exception of type : %s thrown during read of the component '%s': %s",
-          typeid(e).name(), component_name.c_str(), e.what());
-        handle_exceptions ? void() : throw;
-        ret_val = return_type::ERROR;
+        read_statistics->allocations = static_cast<unsigned int>(
+          AllocationTracker::get_allocation_count() - allocations_before);
+        read_statistics->time_budget_overruns = cycle_context.read_time_budget.overruns;
+        if (resource_storage_->read_write_pool_)
+        {
+          record_cycle_cpu(cycle_context, *read_statistics);
+        }
+        const auto & read_statistics_collector = component.get_read_statistics();
+        read_statistics->execution_time.update_statistics(read_statistics_collector.execution_time);
+        read_statistics->periodicity.update_statistics(read_statistics_collector.periodicity);
+        if (ThreadTimes::is_sampling_enabled())
+        {
+          read_statistics->cpu_time.update_statistics(read_statistics_collector.cpu_time);
+          read_statistics->preempted_time.update_statistics(
+            read_statistics_collector.preempted_time);
+          read_statistics->voluntary_context_switches =
+            read_statistics_collector.voluntary_context_switches;
+          read_statistics->involuntary_context_switches =
+            read_statistics_collector.involuntary_context_switches;
+        }
+        if (PerformanceCounters::is_sampling_enabled())
+        {
+          read_statistics->performance_counters.update_statistics(
+            read_statistics_collector.performance_counters);
+        }
       }
-      catch (...)
+    }
+    catch (const std::exception & e)
+    {
+      RT_LOG_ERROR(
+        get_logger(), "Exception of type : %s thrown during read of the component '%s': %s",
+        typeid(e).name(), component.get_name().c_str(), e.what());
+      handle_exceptions ? void() : throw;
+      ret_val = return_type::ERROR;
+    }
+    catch (...)
+    {
+      RT_LOG_ERROR(
+        get_logger(), "Unknown exception thrown during read of the component '%s'",
+        component.get_name().c_str());
+      handle_exceptions ? void() : throw;
+      ret_val = return_type::ERROR;
+    }
+    cycle_context.result = ret_val;
+  };
+  // The group state is propagated in the lane of the group, in the order of its components, and
+  // a failed component is switched to error in its lane, also when the lanes are read in parallel
+  auto read_lane_component =
+    [&](auto & component, HardwareComponentCycleContext & cycle_context)
+  {
+    read_component(component, cycle_context);
+    if (cycle_context.skipped)
+    {
+      return;
+    }
+    cycle_context.result = resource_storage_->update_hardware_component_group_state(
+      cycle_context.group_state, cycle_context.result);
+    if (cycle_context.result != return_type::OK)
+    {
+      if (component.defers_control_loop_transitions())
       {
-        RCLCPP_ERROR(
-          get_logger(), "Unknown exception thrown during read of the component '%s'",
-          component_name.c_str());
-        handle_exceptions ? void() : throw;
-        ret_val = return_type::ERROR;
+        resource_storage_->request_transition(
+          component, HardwareComponent::RequestedTransition::ERROR);
       }
-      RCLCPP_WARN_EXPRESSION(
-        get_logger(), ret_val == hardware_interface::return_type::DEACTIVATE,
-        "DEACTIVATE returned from read cycle is treated the same as ERROR.");
-      if (ret_val != return_type::OK)
+      else
       {
         component.error();
-        read_write_status.result = return_type::ERROR;
-        read_write_status.failed_hardware_names.push_back(component_name);
-        resource_storage_->remove_all_hardware_interfaces_from_available_list(component_name);
       }
+      resource_storage_->remove_all_hardware_interfaces_from_available_list(cycle_context);
+      if (resource_storage_->flight_recorder_)
+      {
+        resource_storage_->flight_recorder_->request_dump();
+      }
+    }
+  };
+  // The failed components are reported in the order of the components, by their index
+  auto collect_read_results =
+    [&](auto & components, auto & cycle_contexts, std::size_t first_index)
+  {
+    for (std::size_t i = 0; i < components.size(); ++i)
+    {
+      const auto & cycle_context = cycle_contexts[i];
+      if (cycle_context.skipped || cycle_context.result == return_type::OK)
+      {
+        continue;
+      }
+      RT_LOG_WARN_EXPRESSION(
+        get_logger(), cycle_context.result == hardware_interface::return_type::DEACTIVATE,
+        "DEACTIVATE returned from read cycle is treated the same as ERROR.");
+      read_write_status.result = return_type::ERROR;
+      read_write_status.failed_hardware_names.push_back(first_index + i);
+    }
+  };
+
+  // the buses receive the data of their members before the members are read
+  resource_storage_->exchange_hardware_buses(true, current_time, period);
+
+  // captures only two references, so the std::function doesn't allocate
+  auto read_task = [this, &read_lane_component](std::size_t lane)
+  {
+    for (const std::size_t index : resource_storage_->read_lanes_[lane])
+    {
+      resource_storage_->call_for_component(index, true, read_lane_component);
     }
   };
+  const std::size_t number_of_lanes = resource_storage_->read_lanes_.size();
+  if (resource_storage_->read_write_pool_)
+  {
+    resource_storage_->read_write_pool_->parallel_for(
+      number_of_lanes, read_task, resource_storage_->read_lane_workers_);
+  }
+  else
+  {
+    for (std::size_t i = 0; i < number_of_lanes; ++i)
+    {
+      read_task(i);
+    }
+  }
+  const std::size_t number_of_actuators = resource_storage_->actuators_.size();
+  const std::size_t number_of_sensors = resource_storage_->sensors_.size();
+  collect_read_results(
+    resource_storage_->actuators_, resource_storage_->actuators_cycle_contexts_, 0);
+  collect_read_results(
+    resource_storage_->sensors_, resource_storage_->sensors_cycle_contexts_, number_of_actuators);
+  collect_read_results(
+    resource_storage_->systems_, resource_storage_->systems_cycle_contexts_,
+    number_of_actuators + number_of_sensors);
+  resource_storage_->collect_edge_events();
+
+  if (resource_storage_->transmission_stage_)
+  {
+    resource_storage_->run_transmission_stage(true);
+  }
 
-  read_components(resource_storage_->actuators_, params_.handle_exceptions);
-  read_components(resource_storage_->sensors_, params_.handle_exceptions);
-  read_components(resource_storage_->systems_, params_.handle_exceptions);
+  if (resource_storage_->shared_memory_exporter_)
+  {
+    resource_storage_->shared_memory_exporter_->update_state_values(current_time.nanoseconds());
+  }
+  if (resource_storage_->remote_interface_link_.is_open())
+  {
+    resource_storage_->send_remote_state_values(current_time.nanoseconds());
+  }
+  if (resource_storage_->flight_recorder_)
+  {
+    resource_storage_->flight_recorder_->record_states(current_time.nanoseconds(), read_cycle);
+  }
+  if (resource_storage_->state_snapshot_publisher_)
+  {
+    resource_storage_->state_snapshot_publisher_->capture(current_time);
+  }
 
   return read_write_status;
 }
 
 // CM API: Called in "update"-thread
-HardwareReadWriteStatus ResourceManager::write(
+const HardwareReadWriteStatus & ResourceManager::write(
   const rclcpp::Time & /*time*/, const rclcpp::Duration & period)
 {
+  CycleContext cycle;
+  cycle.trigger_time = resource_storage_->get_clock()->now();
+  cycle.period = period;
+  return write(cycle);
+}
+
+// CM API: Called in "update"-thread
+const HardwareReadWriteStatus & ResourceManager::write(const CycleContext & cycle)
+{
+  const rclcpp::Duration & period = cycle.period;
   read_write_status.result = return_type::OK;
   read_write_status.failed_hardware_names.clear();
 
   // This is needed while we load and initialize the components
-  std::unique_lock<std::recursive_mutex> resource_guard(resources_lock_, std::try_to_lock);
+  std::unique_lock<InstrumentedRecursiveMutex> resource_guard(resources_lock_, std::try_to_lock);
   if (!resource_guard.owns_lock())
   {
+    RT_LOG_DEBUG(
+      get_logger(), "Skipping the write() cycle since the resources are locked by the thread %ld",
+      static_cast<long>(resources_lock_.get_statistics().last_blocking_thread));
     return read_write_status;
   }
-  auto write_components = [&](auto & components, bool handle_exceptions)
+  // one time sample for all the components, taken at the beginning of the control cycle
+  const rclcpp::Time & current_time = cycle.trigger_time;
+  const double cm_period = 1.0 / static_cast<double>(resource_storage_->cm_update_rate_);
+  const uint64_t write_cycle = resource_storage_->write_cycle_count_++;
+  const bool handle_exceptions = params_.handle_exceptions;
+  if (resource_storage_->remote_interface_link_.is_open())
+  {
+    resource_storage_->apply_remote_command_values(current_time.nanoseconds());
+  }
+  const uint32_t auxiliary_decimation =
+    resource_storage_->auxiliary_decimation_.load(std::memory_order_relaxed);
+  auto write_component = [&](auto & component, HardwareComponentCycleContext & cycle_context)
   {
-    for (auto & component : components)
+    if (cycle_context.auxiliary && !OverloadGovernor::is_due(auxiliary_decimation, write_cycle))
+    {
+      cycle_context.skipped = true;
+      return;
+    }
+    std::unique_lock<InstrumentedRecursiveMutex> lock(component.get_mutex(), std::try_to_lock);
+    cycle_context.skipped = !lock.owns_lock();
+    if (cycle_context.skipped)
     {
-      std::unique_lock<std::recursive_mutex> lock(component.get_mutex(), std::try_to_lock);
-      const std::string component_name = component.get_name();
-      if (!lock.owns_lock())
+      if (auto * write_statistics = cycle_context.write_statistics)
       {
-        RCLCPP_DEBUG(
-          get_logger(), "Skipping write() call for the component '%s' since it is locked",
-          component_name.c_str());
-        continue;
+        ++write_statistics->skipped_cycles;
       }
-      auto ret_val = return_type::OK;
-      try
+      RT_LOG_DEBUG(
+        get_logger(), "Skipping write() call for the component '%s' since it is locked",
+        component.get_name().c_str());
+      return;
+    }
+    if (
+      cycle_context.bus_state && cycle_context.bus_state->write != return_type::OK &&
+      is_configured(component))
+    {
+      // the commands of the component weren't sent by its bus
+      cycle_context.result = cycle_context.bus_state->write;
+      return;
+    }
+    auto ret_val = return_type::OK;
+    try
+    {
+      TraceScope trace_scope(cycle_context.write_trace_id);
+      const uint64_t allocations_before = AllocationTracker::get_allocation_count();
+      auto write = [&](const rclcpp::Duration & write_period)
       {
-        auto & hardware_component_info = resource_storage_->hardware_info_map_[component_name];
-        const auto current_time = resource_storage_->get_clock()->now();
-        if (
-          hardware_component_info.rw_rate == 0 ||
-          hardware_component_info.rw_rate == resource_storage_->cm_update_rate_)
+        return execute_within_time_budget(
+          cycle_context.write_time_budget, get_logger(), *resource_storage_->get_clock(),
+          component.get_name(), "write",
+          [&]() { return component.write(current_time, write_period); });
+      };
+      if (cycle_context.runs_at_cm_rate)
+      {
+        ret_val = write(period);
+      }
+      else
+      {
+        const double write_rate = cycle_context.rw_rate;
+        const rclcpp::Duration actual_period =
+          component.get_last_write_time().get_clock_type() != RCL_CLOCK_UNINITIALIZED
+            ? current_time - component.get_last_write_time()
+            : rclcpp::Duration::from_seconds(1.0 / write_rate);
+
+        auto & rate_divider = cycle_context.write_rate_divider;
+        bool is_due = false;
+        if (rate_divider.is_divisible())
         {
-          ret_val = component.write(current_time, period);
+          is_due = rate_divider.is_due(write_cycle);
         }
         else
         {
-          const double write_rate = hardware_component_info.rw_rate;
-          const rclcpp::Duration actual_period =
-            component.get_last_write_time().get_clock_type() != RCL_CLOCK_UNINITIALIZED
-              ? current_time - component.get_last_write_time()
-              : rclcpp::Duration::from_seconds(1.0 / static_cast<double>(write_rate));
-
+          // rates not dividing the update rate are scheduled by comparing the elapsed time
           const double error_now = std::abs(actual_period.seconds() * write_rate - 1.0);
-          const double error_if_skipped = std::abs(
-            (actual_period.seconds() + 1.0 / resource_storage_->cm_update_rate_) * write_rate -
-            1.0);
-          if (error_now <= error_if_skipped)
-          {
-            ret_val = component.write(current_time, actual_period);
-          }
+          const double error_if_skipped =
+            std::abs((actual_period.seconds() + cm_period) * write_rate - 1.0);
+          is_due = error_now <= error_if_skipped;
         }
-        if (hardware_component_info.write_statistics)
+        if (is_due)
         {
-          const auto & write_statistics_collector = component.get_write_statistics();
-          hardware_component_info.write_statistics->execution_time.update_statistics(
-            write_statistics_collector.execution_time);
-          hardware_component_info.write_statistics->periodicity.update_statistics(
-            write_statistics_collector.periodicity);
+          ret_val = write(actual_period);
         }
-        const auto component_group = component.get_group_name();
-        ret_val =
-          resource_storage_->update_hardware_component_group_state(component_group, ret_val);
       }
-      catch (const std::exception & e)
+      if (auto * write_statistics = cycle_context.write_statistics)
       {
-        RCLCPP_ERROR(
-          get_logger(), "Exception of type : %s thrown during write of the component '%s': %s",
-          typeid(e).name(), component_name.c_str(), e.what());
-        handle_exceptions ? void() : throw;
-        ret_val = return_type::ERROR;
+        write_statistics->allocations = static_cast<unsigned int>(
+          AllocationTracker::get_allocation_count() - allocations_before);
+        write_statistics->time_budget_overruns = cycle_context.write_time_budget.overruns;
+        if (resource_storage_->read_write_pool_)
+        {
+          record_cycle_cpu(cycle_context, *write_statistics);
+        }
+        const auto & write_statistics_collector = component.get_write_statistics();
+        write_statistics->execution_time.update_statistics(
+          write_statistics_collector.execution_time);
+        write_statistics->periodicity.update_statistics(write_statistics_collector.periodicity);
+        if (ThreadTimes::is_sampling_enabled())
+        {
+          write_statistics->cpu_time.update_statistics(write_statistics_collector.cpu_time);
+          write_statistics->preempted_time.update_statistics(
+            write_statistics_collector.preempted_time);
+          write_statistics->voluntary_context_switches =
+            write_statistics_collector.voluntary_context_switches;
+          write_statistics->involuntary_context_switches =
+            write_statistics_collector.involuntary_context_switches;
+        }
+        if (PerformanceCounters::is_sampling_enabled())
+        {
+          write_statistics->performance_counters.update_statistics(
+            write_statistics_collector.performance_counters);
+        }
+        if (write_statistics_collector.changed_command_ratio->get_count() > 0)
+        {
+          write_statistics->changed_command_ratio.update_statistics(
+            write_statistics_collector.changed_command_ratio);
+        }
       }
-      catch (...)
+    }
+    catch (const std::exception & e)
+    {
+      RT_LOG_ERROR(
+        get_logger(), "Exception of type : %s thrown during write of the component '%s': %s",
+        typeid(e).name(), component.get_name().c_str(), e.what());
+      handle_exceptions ? void() : throw;
+      ret_val = return_type::ERROR;
+    }
+    catch (...)
+    {
+      RT_LOG_ERROR(
+        get_logger(), "Unknown exception thrown during write of the component '%s'",
+        component.get_name().c_str());
+      handle_exceptions ? void() : throw;
+      ret_val = return_type::ERROR;
+    }
+    cycle_context.result = ret_val;
+  };
+  // The group state is propagated in the lane of the group, in the order of its components, and
+  // a failed component is switched to error in its lane, also when the lanes are written in
+  // parallel
+  auto write_lane_component =
+    [&](auto & component, HardwareComponentCycleContext & cycle_context)
+  {
+    write_component(component, cycle_context);
+    if (cycle_context.skipped)
+    {
+      return;
+    }
+    cycle_context.result = resource_storage_->update_hardware_component_group_state(
+      cycle_context.group_state, cycle_context.result);
+    if (cycle_context.result == return_type::ERROR)
+    {
+      if (component.defers_control_loop_transitions())
       {
-        RCLCPP_ERROR(
-          get_logger(), "Unknown exception thrown during write of the component '%s'",
-          component_name.c_str());
-        handle_exceptions ? void() : throw;
-        ret_val = return_type::ERROR;
+        resource_storage_->request_transition(
+          component, HardwareComponent::RequestedTransition::ERROR);
       }
-      if (ret_val == return_type::ERROR)
+      else
       {
         component.error();
+      }
+      resource_storage_->remove_all_hardware_interfaces_from_available_list(cycle_context);
+      if (resource_storage_->flight_recorder_)
+      {
+        resource_storage_->flight_recorder_->request_dump();
+      }
+    }
+  };
+  // The failed components are reported by their index, and the components to deactivate are
+  // deactivated, in the order of the components
+  auto collect_write_results =
+    [&](auto & components, auto & cycle_contexts, std::size_t first_index)
+  {
+    for (std::size_t i = 0; i < components.size(); ++i)
+    {
+      const auto & cycle_context = cycle_contexts[i];
+      if (cycle_context.skipped)
+      {
+        continue;
+      }
+      const auto ret_val = cycle_context.result;
+      auto & component = components[i];
+      if (ret_val == return_type::ERROR)
+      {
         read_write_status.result = ret_val;
-        read_write_status.failed_hardware_names.push_back(component_name);
-        resource_storage_->remove_all_hardware_interfaces_from_available_list(component_name);
+        read_write_status.failed_hardware_names.push_back(first_index + i);
       }
       else if (ret_val == return_type::DEACTIVATE)
       {
-        rclcpp_lifecycle::State inactive_state(
-          lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, lifecycle_state_names::INACTIVE);
-        set_component_state(component_name, inactive_state);
+        if (component.defers_control_loop_transitions())
+        {
+          resource_storage_->request_transition(
+            component, HardwareComponent::RequestedTransition::DEACTIVATE);
+        }
+        else
+        {
+          rclcpp_lifecycle::State inactive_state(
+            lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, lifecycle_state_names::INACTIVE);
+          set_component_state(component.get_name(), inactive_state);
+        }
         read_write_status.result = ret_val;
         if (return_failed_hardware_names_on_return_deactivate_write_cycle_)
         {
-          read_write_status.failed_hardware_names.push_back(component_name);
+          read_write_status.failed_hardware_names.push_back(first_index + i);
         }
       }
     }
   };
 
-  write_components(resource_storage_->actuators_, params_.handle_exceptions);
-  write_components(resource_storage_->systems_, params_.handle_exceptions);
+  if (resource_storage_->transmission_stage_)
+  {
+    resource_storage_->run_transmission_stage(false);
+  }
+  // the buses send the commands of their members before the members are written
+  resource_storage_->exchange_hardware_buses(false, current_time, period);
+
+  // sensors are not written
+  // captures only two references, so the std::function doesn't allocate
+  auto write_task = [this, &write_lane_component](std::size_t lane)
+  {
+    for (const std::size_t index : resource_storage_->write_lanes_[lane])
+    {
+      resource_storage_->call_for_component(index, false, write_lane_component);
+    }
+  };
+  const std::size_t number_of_lanes = resource_storage_->write_lanes_.size();
+  if (resource_storage_->read_write_pool_)
+  {
+    resource_storage_->read_write_pool_->parallel_for(
+      number_of_lanes, write_task, resource_storage_->write_lane_workers_);
+  }
+  else
+  {
+    for (std::size_t i = 0; i < number_of_lanes; ++i)
+    {
+      write_task(i);
+    }
+  }
+  auto & actuators = resource_storage_->actuators_;
+  auto & systems = resource_storage_->systems_;
+  collect_write_results(actuators, resource_storage_->actuators_cycle_contexts_, 0);
+  collect_write_results(
+    systems, resource_storage_->systems_cycle_contexts_,
+    actuators.size() + resource_storage_->sensors_.size());
+
+  if (resource_storage_->shared_memory_exporter_)
+  {
+    resource_storage_->shared_memory_exporter_->update_command_values(current_time.nanoseconds());
+  }
+  if (resource_storage_->flight_recorder_)
+  {
+    resource_storage_->flight_recorder_->record_commands(current_time.nanoseconds());
+  }
 
   return read_write_status;
 }
 
+const UdpInterfaceLinkStatistics & ResourceManager::get_remote_interface_export_statistics() const
+{
+  return resource_storage_->remote_interface_link_.get_statistics();
+}
+
+void ResourceManager::set_realtime_numa_node(int node)
+{
+  resource_storage_->realtime_numa_node_.store(node, std::memory_order_relaxed);
+}
+
 // BEGIN: "used only in tests and locally"
 size_t ResourceManager::actuator_components_size() const
 {
@@ -2623,14 +6543,14 @@ size_t ResourceManager::system_components_size() const
 
 bool ResourceManager::command_interface_exists(const std::string & key) const
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   return resource_storage_->command_interface_map_.find(key) !=
          resource_storage_->command_interface_map_.end();
 }
 
 bool ResourceManager::state_interface_exists(const std::string & key) const
 {
-  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  std::lock_guard<InstrumentedRecursiveMutex> guard(resource_interfaces_lock_);
   return resource_storage_->state_interface_map_.find(key) !=
          resource_storage_->state_interface_map_.end();
 }
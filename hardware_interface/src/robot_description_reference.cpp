@@ -0,0 +1,196 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/robot_description_reference.hpp"
+
+#include <fmt/compile.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "hardware_interface/hardware_info_cache.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hardware_interface
+{
+namespace
+{
+constexpr char FILE_SCHEME[] = "file://";
+constexpr char SHARED_MEMORY_SCHEME[] = "shm://";
+
+bool starts_with(const std::string & data, const char * prefix)
+{
+  return data.compare(0, std::strlen(prefix), prefix) == 0;
+}
+
+#if !defined(_WIN32)
+/// Copies the content of the mapping of \p fd, and closes \p fd.
+std::string read_mapping(int fd, const std::string & location)
+{
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0)
+  {
+    const std::string error = std::strerror(errno);
+    ::close(fd);
+    throw std::runtime_error(
+      fmt::format(FMT_COMPILE("Unable to stat the robot description '{}': {}"), location, error));
+  }
+  const auto size = static_cast<std::size_t>(file_stat.st_size);
+  if (size == 0)
+  {
+    ::close(fd);
+    return "";
+  }
+  void * data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to map the robot description '{}': {}"), location,
+        std::strerror(errno)));
+  }
+  std::string content(static_cast<const char *>(data), size);
+  munmap(data, size);
+  return content;
+}
+#endif
+}  // namespace
+
+std::optional<RobotDescriptionReference> RobotDescriptionReference::parse(const std::string & data)
+{
+  RobotDescriptionReference reference;
+  std::size_t scheme_size = 0;
+  if (starts_with(data, FILE_SCHEME))
+  {
+    reference.kind = Kind::FILE;
+    scheme_size = std::strlen(FILE_SCHEME);
+  }
+  else if (starts_with(data, SHARED_MEMORY_SCHEME))
+  {
+    reference.kind = Kind::SHARED_MEMORY;
+    scheme_size = std::strlen(SHARED_MEMORY_SCHEME);
+  }
+  else
+  {
+    return std::nullopt;
+  }
+
+  const auto hash_separator = data.find('#', scheme_size);
+  reference.location = data.substr(scheme_size, hash_separator - scheme_size);
+  if (reference.location.empty())
+  {
+    throw std::runtime_error(
+      fmt::format(FMT_COMPILE("The robot description reference '{}' has no location."), data));
+  }
+  if (hash_separator != std::string::npos)
+  {
+    const std::string hash = data.substr(hash_separator + 1);
+    if (
+      hash.empty() || hash.size() > 16 ||
+      !std::all_of(
+        hash.begin(), hash.end(), [](char c) { return std::isxdigit(static_cast<uint8_t>(c)); }))
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid hash '{}' in the robot description reference '{}'."), hash, data));
+    }
+    reference.hash = std::stoull(hash, nullptr, 16);
+  }
+  return reference;
+}
+
+std::shared_ptr<const std::string> RobotDescriptionReference::read() const
+{
+  std::string content;
+  if (kind == Kind::FILE)
+  {
+#if defined(_WIN32)
+    std::ifstream file(location, std::ios::binary);
+    if (!file)
+    {
+      throw std::runtime_error(
+        fmt::format(FMT_COMPILE("Unable to open the robot description '{}'."), location));
+    }
+    content.assign((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+#else
+    const int fd = ::open(location.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Unable to open the robot description '{}': {}"), location,
+          std::strerror(errno)));
+    }
+    content = read_mapping(fd, location);
+#endif
+  }
+  else
+  {
+#if defined(_WIN32)
+    throw std::runtime_error(
+      "Robot descriptions in shared memory are only supported on POSIX systems.");
+#else
+    const int fd = shm_open(location.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Unable to open the shared-memory segment '{}': {}"), location,
+          std::strerror(errno)));
+    }
+    content = read_mapping(fd, location);
+    // the segment can be larger than the description, which is then terminated by a '\0'
+    const auto end = content.find('\0');
+    if (end != std::string::npos)
+    {
+      content.resize(end);
+    }
+#endif
+  }
+
+  if (hash.has_value() && HardwareInfoCache::hash(content) != hash.value())
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("The hash of the robot description '{}' is {:016x} instead of {:016x}."),
+        location, HardwareInfoCache::hash(content), hash.value()));
+  }
+  return std::make_shared<const std::string>(std::move(content));
+}
+
+std::string RobotDescriptionReference::to_string() const
+{
+  std::string reference = (kind == Kind::FILE ? FILE_SCHEME : SHARED_MEMORY_SCHEME) + location;
+  if (hash.has_value())
+  {
+    reference += fmt::format(FMT_COMPILE("#{:016x}"), hash.value());
+  }
+  return reference;
+}
+
+}  // namespace hardware_interface
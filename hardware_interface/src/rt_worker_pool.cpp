@@ -0,0 +1,278 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/rt_worker_pool.hpp"
+
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/realtime_thread.hpp"
+
+namespace hardware_interface
+{
+namespace
+{
+/// Marks the pool as idle when the job is finished, also when a task threw
+struct BusyReset
+{
+  std::atomic<bool> & busy;
+  ~BusyReset() { busy.store(false, std::memory_order_release); }
+};
+
+/// Executes the tasks in the calling thread, with the exception handling of parallel_for()
+void run_sequentially(std::size_t number_of_tasks, const std::function<void(std::size_t)> & task)
+{
+  std::exception_ptr exception = nullptr;
+  for (std::size_t i = 0; i < number_of_tasks; ++i)
+  {
+    try
+    {
+      task(i);
+    }
+    catch (...)
+    {
+      if (!exception)
+      {
+        exception = std::current_exception();
+      }
+    }
+  }
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+}  // namespace
+
+RTWorkerPool::RTWorkerPool(const RTWorkerPoolParams & params, rclcpp::Logger logger)
+: logger_(logger)
+{
+  RealtimeThreadParams thread_params;
+  thread_params.thread_priority = params.thread_priority;
+  thread_params.cpu_affinity_cores = params.cpu_affinity_cores;
+  thread_params.stack_prefault_size = params.stack_prefault_size;
+  workers_.reserve(params.number_of_workers);
+  for (std::size_t i = 0; i < params.number_of_workers; ++i)
+  {
+    thread_params.name = params.name + "_" + std::to_string(i);
+    workers_.push_back(
+      create_realtime_thread(thread_params, logger_, [this]() { worker_loop(-1); }));
+  }
+  dedicated_workers_.reserve(params.dedicated_workers.size());
+  for (std::size_t i = 0; i < params.dedicated_workers.size(); ++i)
+  {
+    const auto & dedicated_worker = params.dedicated_workers[i];
+    thread_params.name = dedicated_worker.name;
+    thread_params.thread_priority = dedicated_worker.thread_priority;
+    thread_params.cpu_affinity_cores = dedicated_worker.cpu_affinity_cores;
+    const int dedicated_worker_index = static_cast<int>(i);
+    dedicated_workers_.push_back(create_realtime_thread(
+      thread_params, logger_,
+      [this, dedicated_worker_index]() { worker_loop(dedicated_worker_index); }));
+  }
+}
+
+RTWorkerPool::~RTWorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto * workers : {&workers_, &dedicated_workers_})
+  {
+    for (auto & worker : *workers)
+    {
+      if (worker.joinable())
+      {
+        worker.join();
+      }
+    }
+  }
+}
+
+void RTWorkerPool::parallel_for(
+  std::size_t number_of_tasks, const std::function<void(std::size_t)> & task)
+{
+  if (!try_parallel_for(number_of_tasks, task))
+  {
+    // the job running on the pool owns its state, so the tasks can't be published to it
+    run_sequentially(number_of_tasks, task);
+  }
+}
+
+void RTWorkerPool::parallel_for(
+  std::size_t number_of_tasks, const std::function<void(std::size_t)> & task,
+  const std::vector<int> & task_workers)
+{
+  if (busy_.exchange(true, std::memory_order_acquire))
+  {
+    run_sequentially(number_of_tasks, task);
+    return;
+  }
+  BusyReset busy_reset{busy_};
+  run(number_of_tasks, task, &task_workers);
+}
+
+bool RTWorkerPool::try_parallel_for(
+  std::size_t number_of_tasks, const std::function<void(std::size_t)> & task)
+{
+  if (busy_.exchange(true, std::memory_order_acquire))
+  {
+    return false;
+  }
+  BusyReset busy_reset{busy_};
+  run(number_of_tasks, task, nullptr);
+  return true;
+}
+
+void RTWorkerPool::run(
+  std::size_t number_of_tasks, const std::function<void(std::size_t)> & task,
+  const std::vector<int> * task_workers)
+{
+  if (number_of_tasks == 0)
+  {
+    return;
+  }
+  task_workers_ = task_workers;
+  bool has_dedicated_tasks = false;
+  for (std::size_t i = 0; task_workers && i < number_of_tasks && !has_dedicated_tasks; ++i)
+  {
+    has_dedicated_tasks = is_dedicated_task(i);
+  }
+  if (!has_dedicated_tasks && (workers_.empty() || number_of_tasks == 1))
+  {
+    task_workers_ = nullptr;
+    for (std::size_t i = 0; i < number_of_tasks; ++i)
+    {
+      task(i);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    number_of_tasks_ = number_of_tasks;
+    next_task_.store(0, std::memory_order_relaxed);
+    exception_ = nullptr;
+    active_workers_ = workers_.size() + dedicated_workers_.size();
+    ++generation_;
+  }
+  work_cv_.notify_all();
+
+  execute_tasks();
+
+  std::exception_ptr exception = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return active_workers_ == 0; });
+    task_ = nullptr;
+    task_workers_ = nullptr;
+    exception = exception_;
+    exception_ = nullptr;
+  }
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
+bool RTWorkerPool::is_dedicated_task(std::size_t task_index) const
+{
+  if (!task_workers_ || task_index >= task_workers_->size())
+  {
+    return false;
+  }
+  const int worker = (*task_workers_)[task_index];
+  return worker >= 0 && static_cast<std::size_t>(worker) < dedicated_workers_.size();
+}
+
+void RTWorkerPool::execute_tasks()
+{
+  for (std::size_t i = next_task_.fetch_add(1, std::memory_order_relaxed); i < number_of_tasks_;
+       i = next_task_.fetch_add(1, std::memory_order_relaxed))
+  {
+    if (!is_dedicated_task(i))
+    {
+      execute_task(i);
+    }
+  }
+}
+
+void RTWorkerPool::execute_dedicated_tasks(int dedicated_worker_index)
+{
+  if (!task_workers_)
+  {
+    return;
+  }
+  for (std::size_t i = 0; i < number_of_tasks_ && i < task_workers_->size(); ++i)
+  {
+    if ((*task_workers_)[i] == dedicated_worker_index)
+    {
+      execute_task(i);
+    }
+  }
+}
+
+void RTWorkerPool::execute_task(std::size_t task_index)
+{
+  try
+  {
+    (*task_)(task_index);
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(exception_mutex_);
+    if (!exception_)
+    {
+      exception_ = std::current_exception();
+    }
+  }
+}
+
+void RTWorkerPool::worker_loop(int dedicated_worker_index)
+{
+  std::size_t last_generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_cv_.wait(lock, [&]() { return stop_ || generation_ != last_generation; });
+      if (stop_)
+      {
+        return;
+      }
+      last_generation = generation_;
+    }
+
+    if (dedicated_worker_index < 0)
+    {
+      execute_tasks();
+    }
+    else
+    {
+      execute_dedicated_tasks(dedicated_worker_index);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --active_workers_;
+    }
+    done_cv_.notify_one();
+  }
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,438 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/shared_memory_bridge.hpp"
+
+#include <fmt/compile.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace hardware_interface
+{
+namespace
+{
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+std::size_t align_to_cache_line(std::size_t offset)
+{
+  return (offset + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+}
+
+void wake_waiters(std::atomic<uint32_t> & word) noexcept
+{
+#if defined(__linux__)
+  // the segment is shared between processes, so the futex must not be FUTEX_PRIVATE_FLAG
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+  (void)word;
+#endif
+}
+
+void wait_while_equal(
+  const std::atomic<uint32_t> & word, uint32_t value, std::chrono::nanoseconds timeout) noexcept
+{
+#if defined(__linux__)
+  struct timespec relative_timeout;
+  relative_timeout.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+  relative_timeout.tv_nsec = static_cast<long>(timeout.count() % 1000000000);  // NOLINT
+  syscall(
+    SYS_futex, reinterpret_cast<uint32_t *>(const_cast<std::atomic<uint32_t> *>(&word)),
+    FUTEX_WAIT, value, &relative_timeout, nullptr, 0);
+#else
+  (void)word;
+  (void)value;
+  std::this_thread::sleep_for(std::min(timeout, std::chrono::nanoseconds(50000)));
+#endif
+}
+}  // namespace
+
+SharedMemoryBridge::~SharedMemoryBridge() { close(); }
+
+void SharedMemoryBridge::create(
+  const std::string & segment_name, const std::vector<std::string> & state_interface_names,
+  const std::vector<std::string> & command_interface_names)
+{
+#if defined(_WIN32)
+  (void)segment_name;
+  (void)state_interface_names;
+  (void)command_interface_names;
+  throw std::runtime_error("The shared-memory bridge is only supported on POSIX systems.");
+#else
+  if (segment_name.empty() || segment_name.front() != '/')
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Invalid shared-memory segment name '{}', it has to start with a '/'."),
+        segment_name));
+  }
+  close();
+
+  using shared_memory::SharedMemoryBridgeHeader;
+  using shared_memory::SharedMemoryInterfaceDescriptor;
+  std::vector<SharedMemoryInterfaceDescriptor> descriptors;
+  std::string names;
+  auto add_descriptor = [&descriptors, &names](const std::string & name, bool is_command_interface)
+  {
+    SharedMemoryInterfaceDescriptor descriptor;
+    descriptor.name_offset = static_cast<uint32_t>(names.size());
+    descriptor.name_length = static_cast<uint32_t>(name.size());
+    descriptor.data_type = static_cast<int32_t>(HandleDataType::DOUBLE);
+    descriptor.is_command_interface = is_command_interface ? 1u : 0u;
+    descriptors.push_back(descriptor);
+    names.append(name);
+    names.push_back('\0');
+  };
+  for (const auto & name : state_interface_names)
+  {
+    add_descriptor(name, false);
+  }
+  for (const auto & name : command_interface_names)
+  {
+    add_descriptor(name, true);
+  }
+
+  const std::size_t descriptors_offset = align_to_cache_line(sizeof(SharedMemoryBridgeHeader));
+  const std::size_t names_offset =
+    descriptors_offset + descriptors.size() * sizeof(SharedMemoryInterfaceDescriptor);
+  const std::size_t state_values_offset = align_to_cache_line(names_offset + names.size());
+  // the command values are on their own cache lines, so that both sides don't false share
+  const std::size_t command_values_offset = align_to_cache_line(
+    state_values_offset + state_interface_names.size() * sizeof(std::atomic<double>));
+  const std::size_t segment_size =
+    command_values_offset + command_interface_names.size() * sizeof(std::atomic<double>);
+
+  // unlinking first makes sure that a driver attached to a previous segment never sees this one
+  shm_unlink(segment_name.c_str());
+  const int fd = shm_open(segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+  if (fd < 0)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to create the shared-memory segment '{}': {}"), segment_name,
+        std::strerror(errno)));
+  }
+  if (ftruncate(fd, static_cast<off_t>(segment_size)) != 0)
+  {
+    const std::string error = std::strerror(errno);
+    ::close(fd);
+    shm_unlink(segment_name.c_str());
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to resize the shared-memory segment '{}': {}"), segment_name, error));
+  }
+  void * segment = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (segment == MAP_FAILED)
+  {
+    const std::string error = std::strerror(errno);
+    shm_unlink(segment_name.c_str());
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to map the shared-memory segment '{}': {}"), segment_name, error));
+  }
+  // lock the pages, so that the real-time exchange doesn't page fault
+  mlock(segment, segment_size);
+  segment_name_ = segment_name;
+  is_owner_ = true;
+  segment_ = segment;
+  segment_size_ = segment_size;
+
+  auto * bytes = static_cast<uint8_t *>(segment_);
+  header_ = new (bytes) SharedMemoryBridgeHeader();
+  header_->magic = shared_memory::BRIDGE_MAGIC;
+  header_->version = shared_memory::BRIDGE_VERSION;
+  header_->size = segment_size;
+  header_->number_of_state_interfaces = static_cast<uint32_t>(state_interface_names.size());
+  header_->number_of_command_interfaces = static_cast<uint32_t>(command_interface_names.size());
+  header_->descriptors_offset = descriptors_offset;
+  header_->names_offset = names_offset;
+  header_->state_values_offset = state_values_offset;
+  header_->command_values_offset = command_values_offset;
+  for (auto * channel : {&header_->states, &header_->commands})
+  {
+    channel->sequence.store(0, std::memory_order_relaxed);
+    channel->frame.store(0, std::memory_order_relaxed);
+    channel->stamp_ns.store(0, std::memory_order_relaxed);
+  }
+  if (!descriptors.empty())
+  {
+    std::memcpy(
+      bytes + descriptors_offset, descriptors.data(),
+      descriptors.size() * sizeof(SharedMemoryInterfaceDescriptor));
+  }
+  std::memcpy(bytes + names_offset, names.data(), names.size());
+  state_values_ = reinterpret_cast<std::atomic<double> *>(bytes + state_values_offset);
+  for (std::size_t i = 0; i < state_interface_names.size(); ++i)
+  {
+    new (&state_values_[i]) std::atomic<double>(std::numeric_limits<double>::quiet_NaN());
+  }
+  command_values_ = reinterpret_cast<std::atomic<double> *>(bytes + command_values_offset);
+  for (std::size_t i = 0; i < command_interface_names.size(); ++i)
+  {
+    new (&command_values_[i]) std::atomic<double>(std::numeric_limits<double>::quiet_NaN());
+  }
+  state_interface_names_ = state_interface_names;
+  command_interface_names_ = command_interface_names;
+  header_->state.store(
+    static_cast<uint32_t>(shared_memory::SegmentState::ACTIVE), std::memory_order_release);
+#endif
+}
+
+bool SharedMemoryBridge::open(const std::string & segment_name)
+{
+#if defined(_WIN32)
+  (void)segment_name;
+  return false;
+#else
+  close();
+  const int fd = shm_open(segment_name.c_str(), O_RDWR, 0);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat segment_stat;
+  if (
+    fstat(fd, &segment_stat) != 0 ||
+    static_cast<std::size_t>(segment_stat.st_size) <
+      sizeof(shared_memory::SharedMemoryBridgeHeader))
+  {
+    ::close(fd);
+    return false;
+  }
+  const auto segment_size = static_cast<std::size_t>(segment_stat.st_size);
+  void * segment = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (segment == MAP_FAILED)
+  {
+    return false;
+  }
+  mlock(segment, segment_size);
+  segment_name_ = segment_name;
+  segment_ = segment;
+  segment_size_ = segment_size;
+  header_ = static_cast<shared_memory::SharedMemoryBridgeHeader *>(segment_);
+  const std::size_t number_of_interfaces =
+    static_cast<std::size_t>(header_->number_of_state_interfaces) +
+    header_->number_of_command_interfaces;
+  if (
+    header_->state.load(std::memory_order_acquire) !=
+      static_cast<uint32_t>(shared_memory::SegmentState::ACTIVE) ||
+    header_->magic != shared_memory::BRIDGE_MAGIC ||
+    header_->version != shared_memory::BRIDGE_VERSION || header_->size > segment_size_ ||
+    header_->state_values_offset +
+        header_->number_of_state_interfaces * sizeof(std::atomic<double>) >
+      header_->command_values_offset ||
+    header_->command_values_offset +
+        header_->number_of_command_interfaces * sizeof(std::atomic<double>) >
+      segment_size_)
+  {
+    close();
+    return false;
+  }
+
+  auto * bytes = static_cast<uint8_t *>(segment_);
+  const auto * descriptors =
+    reinterpret_cast<const shared_memory::SharedMemoryInterfaceDescriptor *>(
+      bytes + header_->descriptors_offset);
+  const auto * names = reinterpret_cast<const char *>(bytes + header_->names_offset);
+  const std::size_t names_size = header_->state_values_offset - header_->names_offset;
+  for (std::size_t i = 0; i < number_of_interfaces; ++i)
+  {
+    if (descriptors[i].name_offset + descriptors[i].name_length > names_size)
+    {
+      close();
+      return false;
+    }
+    auto & interface_names =
+      descriptors[i].is_command_interface ? command_interface_names_ : state_interface_names_;
+    interface_names.emplace_back(names + descriptors[i].name_offset, descriptors[i].name_length);
+  }
+  state_values_ = reinterpret_cast<std::atomic<double> *>(bytes + header_->state_values_offset);
+  command_values_ =
+    reinterpret_cast<std::atomic<double> *>(bytes + header_->command_values_offset);
+  return true;
+#endif
+}
+
+void SharedMemoryBridge::close() noexcept
+{
+#if !defined(_WIN32)
+  if (segment_)
+  {
+    if (is_owner_)
+    {
+      header_->state.store(
+        static_cast<uint32_t>(shared_memory::SegmentState::STALE), std::memory_order_release);
+      // wake up a waiting driver, so that it notices the stale segment
+      header_->commands.frame.fetch_add(1, std::memory_order_release);
+      wake_waiters(header_->commands.frame);
+      shm_unlink(segment_name_.c_str());
+    }
+    munmap(segment_, segment_size_);
+  }
+#endif
+  segment_name_.clear();
+  is_owner_ = false;
+  segment_ = nullptr;
+  segment_size_ = 0;
+  header_ = nullptr;
+  state_values_ = nullptr;
+  command_values_ = nullptr;
+  state_interface_names_.clear();
+  command_interface_names_.clear();
+}
+
+bool SharedMemoryBridge::is_active() const noexcept
+{
+  return header_ && header_->state.load(std::memory_order_acquire) ==
+                      static_cast<uint32_t>(shared_memory::SegmentState::ACTIVE);
+}
+
+bool SharedMemoryBridge::write_channel(
+  shared_memory::SharedMemoryBridgeChannel & channel, std::atomic<double> * channel_values,
+  const std::vector<double> & values, std::size_t number_of_values, int64_t stamp_ns) noexcept
+{
+  if (!is_active() || values.size() != number_of_values)
+  {
+    return false;
+  }
+  const uint32_t sequence = channel.sequence.load(std::memory_order_relaxed);
+  channel.sequence.store(sequence + 1u, std::memory_order_relaxed);
+  // the stores of the values must not become visible before the odd sequence
+  std::atomic_thread_fence(std::memory_order_release);
+  for (std::size_t i = 0; i < number_of_values; ++i)
+  {
+    channel_values[i].store(values[i], std::memory_order_relaxed);
+  }
+  channel.stamp_ns.store(stamp_ns, std::memory_order_relaxed);
+  const uint32_t frame = channel.frame.load(std::memory_order_relaxed);
+  channel.frame.store(frame + 1u, std::memory_order_relaxed);
+  channel.sequence.store(sequence + 2u, std::memory_order_release);
+  wake_waiters(channel.frame);
+  return true;
+}
+
+bool SharedMemoryBridge::read_channel(
+  const shared_memory::SharedMemoryBridgeChannel & channel,
+  const std::atomic<double> * channel_values, std::size_t number_of_values,
+  std::vector<double> & values, uint32_t & frame, int64_t & stamp_ns) const
+{
+  if (!is_active())
+  {
+    return false;
+  }
+  values.resize(number_of_values);
+  uint32_t sequence_begin = 0;
+  uint32_t sequence_end = 0;
+  do
+  {
+    sequence_begin = channel.sequence.load(std::memory_order_acquire);
+    frame = channel.frame.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < number_of_values; ++i)
+    {
+      values[i] = channel_values[i].load(std::memory_order_relaxed);
+    }
+    stamp_ns = channel.stamp_ns.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    sequence_end = channel.sequence.load(std::memory_order_relaxed);
+  } while ((sequence_begin & 1u) != 0u || sequence_begin != sequence_end);
+  return true;
+}
+
+bool SharedMemoryBridge::wait_for_frame(
+  const shared_memory::SharedMemoryBridgeChannel & channel, uint32_t last_frame,
+  std::chrono::nanoseconds timeout) const noexcept
+{
+  if (!header_)
+  {
+    return false;
+  }
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (channel.frame.load(std::memory_order_acquire) == last_frame)
+  {
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::nanoseconds::zero())
+    {
+      return false;
+    }
+    wait_while_equal(
+      channel.frame, last_frame, std::chrono::duration_cast<std::chrono::nanoseconds>(remaining));
+  }
+  return true;
+}
+
+bool SharedMemoryBridge::write_states(const std::vector<double> & values, int64_t stamp_ns) noexcept
+{
+  return header_ && write_channel(
+                      header_->states, state_values_, values, state_interface_names_.size(),
+                      stamp_ns);
+}
+
+bool SharedMemoryBridge::write_commands(
+  const std::vector<double> & values, int64_t stamp_ns) noexcept
+{
+  return header_ && write_channel(
+                      header_->commands, command_values_, values, command_interface_names_.size(),
+                      stamp_ns);
+}
+
+bool SharedMemoryBridge::read_states(
+  std::vector<double> & values, uint32_t & frame, int64_t & stamp_ns) const
+{
+  return header_ && read_channel(
+                      header_->states, state_values_, state_interface_names_.size(), values, frame,
+                      stamp_ns);
+}
+
+bool SharedMemoryBridge::read_commands(
+  std::vector<double> & values, uint32_t & frame, int64_t & stamp_ns) const
+{
+  return header_ && read_channel(
+                      header_->commands, command_values_, command_interface_names_.size(), values,
+                      frame, stamp_ns);
+}
+
+bool SharedMemoryBridge::wait_for_states(
+  uint32_t last_frame, std::chrono::nanoseconds timeout) const noexcept
+{
+  return header_ && wait_for_frame(header_->states, last_frame, timeout);
+}
+
+bool SharedMemoryBridge::wait_for_commands(
+  uint32_t last_frame, std::chrono::nanoseconds timeout) const noexcept
+{
+  return header_ && wait_for_frame(header_->commands, last_frame, timeout);
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,258 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "shared_memory_components/shared_memory_system.hpp"
+
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "hardware_interface/lexical_casts.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/logging.hpp"
+
+namespace shared_memory_components
+{
+
+CallbackReturn SharedMemorySystem::on_init(
+  const hardware_interface::HardwareComponentInterfaceParams & params)
+{
+  if (hardware_interface::SystemInterface::on_init(params) != CallbackReturn::SUCCESS)
+  {
+    return CallbackReturn::ERROR;
+  }
+
+  const auto & hardware_parameters = get_hardware_info().hardware_parameters;
+  try
+  {
+    auto it = hardware_parameters.find("segment_name");
+    segment_name_ = it != hardware_parameters.end() ? it->second
+                                                    : "/ros2_control_" + get_hardware_info().name;
+
+    it = hardware_parameters.find("read_deadline_us");
+    if (it != hardware_parameters.end())
+    {
+      read_deadline_ = std::chrono::microseconds(hardware_interface::stoui32(it->second));
+    }
+
+    it = hardware_parameters.find("max_missed_deadlines");
+    if (it != hardware_parameters.end())
+    {
+      max_missed_deadlines_ = hardware_interface::stoui32(it->second);
+    }
+
+    it = hardware_parameters.find("connection_timeout_ms");
+    if (it != hardware_parameters.end())
+    {
+      connection_timeout_ = std::chrono::milliseconds(hardware_interface::stoui32(it->second));
+    }
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(get_logger(), "Invalid hardware parameter: %s", e.what());
+    return CallbackReturn::ERROR;
+  }
+
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn SharedMemorySystem::on_configure(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  state_handles_.clear();
+  command_handles_.clear();
+  for (const auto * states : {&joint_states_, &sensor_states_, &gpio_states_, &unlisted_states_})
+  {
+    state_handles_.insert(state_handles_.end(), states->begin(), states->end());
+  }
+  for (const auto * commands : {&joint_commands_, &gpio_commands_, &unlisted_commands_})
+  {
+    command_handles_.insert(command_handles_.end(), commands->begin(), commands->end());
+  }
+
+  std::vector<std::string> state_interface_names;
+  for (const auto & handle : state_handles_)
+  {
+    state_interface_names.push_back(handle->get_name());
+  }
+  std::vector<std::string> command_interface_names;
+  for (const auto & handle : command_handles_)
+  {
+    command_interface_names.push_back(handle->get_name());
+  }
+  auto has_supported_data_type = [this](const hardware_interface::Handle & handle)
+  {
+    if (
+      !handle.is_double_readable() &&
+      handle.get_data_type() != hardware_interface::HandleDataType::BOOL)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Interface '%s' has the data type '%s', only double and bool are supported.",
+        handle.get_name().c_str(), handle.get_data_type().to_string().c_str());
+      return false;
+    }
+    return true;
+  };
+  for (const auto & handle : state_handles_)
+  {
+    if (!has_supported_data_type(*handle))
+    {
+      return CallbackReturn::ERROR;
+    }
+  }
+  for (const auto & handle : command_handles_)
+  {
+    if (!has_supported_data_type(*handle))
+    {
+      return CallbackReturn::ERROR;
+    }
+  }
+
+  try
+  {
+    bridge_.create(segment_name_, state_interface_names, command_interface_names);
+  }
+  catch (const std::exception & e)
+  {
+    RCLCPP_ERROR(get_logger(), "%s", e.what());
+    return CallbackReturn::ERROR;
+  }
+  state_values_.assign(state_handles_.size(), std::numeric_limits<double>::quiet_NaN());
+  command_values_.assign(command_handles_.size(), std::numeric_limits<double>::quiet_NaN());
+  last_state_frame_ = 0;
+  missed_deadlines_ = 0;
+  RCLCPP_INFO(
+    get_logger(),
+    "Created the shared-memory segment '%s' for %zu state and %zu command interfaces, waiting for "
+    "the driver process.",
+    segment_name_.c_str(), state_handles_.size(), command_handles_.size());
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn SharedMemorySystem::on_cleanup(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  bridge_.close();
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn SharedMemorySystem::on_shutdown(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  bridge_.close();
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn SharedMemorySystem::on_activate(const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  int64_t stamp_ns = 0;
+  bridge_.wait_for_states(last_state_frame_, connection_timeout_);
+  if (!bridge_.read_states(state_values_, last_state_frame_, stamp_ns) || last_state_frame_ == 0)
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "The driver process didn't publish any states to the shared-memory segment '%s' within %ld "
+      "ms.",
+      segment_name_.c_str(), static_cast<long>(connection_timeout_.count()));  // NOLINT
+    return CallbackReturn::ERROR;
+  }
+  apply_state_values();
+  missed_deadlines_ = 0;
+  return CallbackReturn::SUCCESS;
+}
+
+hardware_interface::return_type SharedMemorySystem::read(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/)
+{
+  // the deadlines are only enforced while the component is active, an inactive component just
+  // mirrors the states of a driver that might not be running yet
+  const bool enforce_deadline =
+    read_deadline_.count() > 0 &&
+    get_lifecycle_id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE;
+  if (enforce_deadline)
+  {
+    bridge_.wait_for_states(last_state_frame_, read_deadline_);
+  }
+  const uint32_t previous_frame = last_state_frame_;
+  int64_t stamp_ns = 0;
+  if (!bridge_.read_states(state_values_, last_state_frame_, stamp_ns))
+  {
+    RCLCPP_ERROR(
+      get_logger(), "The shared-memory segment '%s' is not active.", segment_name_.c_str());
+    return hardware_interface::return_type::ERROR;
+  }
+  if (last_state_frame_ == previous_frame)
+  {
+    if (!enforce_deadline)
+    {
+      return hardware_interface::return_type::OK;
+    }
+    ++missed_deadlines_;
+    if (missed_deadlines_ > max_missed_deadlines_)
+    {
+      RCLCPP_ERROR(
+        get_logger(),
+        "The driver process missed %zu consecutive read deadlines, it is considered disconnected.",
+        missed_deadlines_);
+      return hardware_interface::return_type::ERROR;
+    }
+    return hardware_interface::return_type::OK;
+  }
+  missed_deadlines_ = 0;
+  apply_state_values();
+  return hardware_interface::return_type::OK;
+}
+
+hardware_interface::return_type SharedMemorySystem::write(
+  const rclcpp::Time & time, const rclcpp::Duration & /*period*/)
+{
+  for (std::size_t i = 0; i < command_handles_.size(); ++i)
+  {
+    // a command that cannot be accessed without blocking keeps its previous value
+    const auto value = command_handles_[i]->get_optional_as_double();
+    if (value.has_value())
+    {
+      command_values_[i] = value.value();
+    }
+  }
+  if (!bridge_.write_commands(command_values_, time.nanoseconds()))
+  {
+    RCLCPP_ERROR(
+      get_logger(), "The shared-memory segment '%s' is not active.", segment_name_.c_str());
+    return hardware_interface::return_type::ERROR;
+  }
+  return hardware_interface::return_type::OK;
+}
+
+void SharedMemorySystem::apply_state_values()
+{
+  for (std::size_t i = 0; i < state_handles_.size(); ++i)
+  {
+    // a state that cannot be accessed without blocking is updated with the next frame
+    if (state_handles_[i]->get_data_type() == hardware_interface::HandleDataType::BOOL)
+    {
+      std::ignore = set_state(state_handles_[i], state_values_[i] != 0.0, false);
+    }
+    else
+    {
+      std::ignore = set_state(state_handles_[i], state_values_[i], false);
+    }
+  }
+}
+
+}  // namespace shared_memory_components
+
+#include "pluginlib/class_list_macros.hpp"
+PLUGINLIB_EXPORT_CLASS(
+  shared_memory_components::SharedMemorySystem, hardware_interface::SystemInterface)
@@ -0,0 +1,349 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/shared_memory_interface_export.hpp"
+
+#include <fmt/compile.h>
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hardware_interface
+{
+namespace
+{
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+std::size_t align_to_cache_line(std::size_t offset)
+{
+  return (offset + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+}
+}  // namespace
+
+SharedMemoryInterfaceExporter::SharedMemoryInterfaceExporter(const std::string & segment_name)
+: segment_name_(segment_name)
+{
+}
+
+SharedMemoryInterfaceExporter::~SharedMemoryInterfaceExporter() { release_segment(); }
+
+void SharedMemoryInterfaceExporter::configure(
+  const std::vector<StateInterface::ConstSharedPtr> & state_interfaces,
+  const std::vector<CommandInterface::SharedPtr> & command_interfaces)
+{
+#if defined(_WIN32)
+  (void)state_interfaces;
+  (void)command_interfaces;
+  throw std::runtime_error(
+    "The shared-memory export of the interfaces is only supported on POSIX systems.");
+#else
+  if (segment_name_.empty() || segment_name_.front() != '/')
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Invalid shared-memory segment name '{}', it has to start with a '/'."),
+        segment_name_));
+  }
+  release_segment();
+  state_interfaces_ = state_interfaces;
+  command_interfaces_ = command_interfaces;
+
+  std::vector<shared_memory::SharedMemoryInterfaceDescriptor> descriptors;
+  std::string names;
+  auto add_descriptor = [&descriptors, &names](const Handle & handle, bool is_command_interface)
+  {
+    shared_memory::SharedMemoryInterfaceDescriptor descriptor;
+    descriptor.name_offset = static_cast<uint32_t>(names.size());
+    descriptor.name_length = static_cast<uint32_t>(handle.get_name().size());
+    descriptor.data_type = static_cast<int32_t>(handle.get_data_type());
+    descriptor.is_command_interface = is_command_interface ? 1u : 0u;
+    descriptors.push_back(descriptor);
+    names.append(handle.get_name());
+    names.push_back('\0');
+  };
+  for (const auto & state_interface : state_interfaces_)
+  {
+    add_descriptor(*state_interface, false);
+  }
+  for (const auto & command_interface : command_interfaces_)
+  {
+    add_descriptor(*command_interface, true);
+  }
+
+  using shared_memory::SharedMemoryHeader;
+  using shared_memory::SharedMemoryInterfaceDescriptor;
+  const std::size_t descriptors_offset = align_to_cache_line(sizeof(SharedMemoryHeader));
+  const std::size_t names_offset =
+    descriptors_offset + descriptors.size() * sizeof(SharedMemoryInterfaceDescriptor);
+  const std::size_t values_offset = align_to_cache_line(names_offset + names.size());
+  const std::size_t segment_size = values_offset + descriptors.size() * sizeof(std::atomic<double>);
+
+  // unlinking first makes sure the readers of a previous segment never see the new layout
+  shm_unlink(segment_name_.c_str());
+  const int fd = shm_open(segment_name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to create the shared-memory segment '{}': {}"), segment_name_,
+        std::strerror(errno)));
+  }
+  if (ftruncate(fd, static_cast<off_t>(segment_size)) != 0)
+  {
+    const std::string error = std::strerror(errno);
+    ::close(fd);
+    shm_unlink(segment_name_.c_str());
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to resize the shared-memory segment '{}': {}"), segment_name_, error));
+  }
+  void * segment = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (segment == MAP_FAILED)
+  {
+    const std::string error = std::strerror(errno);
+    shm_unlink(segment_name_.c_str());
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to map the shared-memory segment '{}': {}"), segment_name_, error));
+  }
+  // lock the pages, so that the real-time updates don't page fault
+  mlock(segment, segment_size);
+  segment_ = segment;
+  segment_size_ = segment_size;
+
+  auto * bytes = static_cast<uint8_t *>(segment_);
+  header_ = new (bytes) SharedMemoryHeader();
+  header_->magic = shared_memory::MAGIC;
+  header_->version = shared_memory::VERSION;
+  header_->size = segment_size;
+  header_->number_of_interfaces = static_cast<uint32_t>(descriptors.size());
+  header_->number_of_state_interfaces = static_cast<uint32_t>(state_interfaces_.size());
+  header_->descriptors_offset = descriptors_offset;
+  header_->names_offset = names_offset;
+  header_->values_offset = values_offset;
+  header_->sequence.store(0, std::memory_order_relaxed);
+  header_->update_count.store(0, std::memory_order_relaxed);
+  header_->state_stamp_ns.store(0, std::memory_order_relaxed);
+  header_->command_stamp_ns.store(0, std::memory_order_relaxed);
+  if (!descriptors.empty())
+  {
+    std::memcpy(
+      bytes + descriptors_offset, descriptors.data(),
+      descriptors.size() * sizeof(SharedMemoryInterfaceDescriptor));
+  }
+  std::memcpy(bytes + names_offset, names.data(), names.size());
+  values_ = reinterpret_cast<std::atomic<double> *>(bytes + values_offset);
+  for (std::size_t i = 0; i < descriptors.size(); ++i)
+  {
+    new (&values_[i]) std::atomic<double>(std::numeric_limits<double>::quiet_NaN());
+  }
+  header_->state.store(
+    static_cast<uint32_t>(shared_memory::SegmentState::ACTIVE), std::memory_order_release);
+#endif
+}
+
+template <typename HandlesT>
+void SharedMemoryInterfaceExporter::update_values(
+  const HandlesT & handles, std::size_t first_index, std::atomic<int64_t> & stamp,
+  int64_t stamp_ns) noexcept
+{
+  const uint32_t sequence = header_->sequence.load(std::memory_order_relaxed);
+  header_->sequence.store(sequence + 1u, std::memory_order_relaxed);
+  // the stores of the values must not become visible before the odd sequence
+  std::atomic_thread_fence(std::memory_order_release);
+  for (std::size_t i = 0; i < handles.size(); ++i)
+  {
+    try
+    {
+      const auto value = handles[i]->get_optional_as_double();
+      if (value.has_value())
+      {
+        values_[first_index + i].store(value.value(), std::memory_order_relaxed);
+      }
+    }
+    catch (...)
+    {
+      // a value that cannot be read keeps its previous value
+    }
+  }
+  stamp.store(stamp_ns, std::memory_order_relaxed);
+  header_->update_count.fetch_add(1, std::memory_order_relaxed);
+  header_->sequence.store(sequence + 2u, std::memory_order_release);
+}
+
+void SharedMemoryInterfaceExporter::update_state_values(int64_t stamp_ns) noexcept
+{
+  if (header_)
+  {
+    update_values(state_interfaces_, 0, header_->state_stamp_ns, stamp_ns);
+  }
+}
+
+void SharedMemoryInterfaceExporter::update_command_values(int64_t stamp_ns) noexcept
+{
+  if (header_)
+  {
+    update_values(
+      command_interfaces_, state_interfaces_.size(), header_->command_stamp_ns, stamp_ns);
+  }
+}
+
+void SharedMemoryInterfaceExporter::release_segment() noexcept
+{
+#if !defined(_WIN32)
+  if (!segment_)
+  {
+    return;
+  }
+  header_->state.store(
+    static_cast<uint32_t>(shared_memory::SegmentState::STALE), std::memory_order_release);
+  munmap(segment_, segment_size_);
+  shm_unlink(segment_name_.c_str());
+  segment_ = nullptr;
+  segment_size_ = 0;
+  header_ = nullptr;
+  values_ = nullptr;
+#endif
+}
+
+SharedMemoryInterfaceReader::~SharedMemoryInterfaceReader() { close(); }
+
+bool SharedMemoryInterfaceReader::open(const std::string & segment_name)
+{
+#if defined(_WIN32)
+  (void)segment_name;
+  return false;
+#else
+  close();
+  const int fd = shm_open(segment_name.c_str(), O_RDONLY, 0);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat segment_stat;
+  if (
+    fstat(fd, &segment_stat) != 0 ||
+    static_cast<std::size_t>(segment_stat.st_size) < sizeof(shared_memory::SharedMemoryHeader))
+  {
+    ::close(fd);
+    return false;
+  }
+  const auto segment_size = static_cast<std::size_t>(segment_stat.st_size);
+  void * segment = mmap(nullptr, segment_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (segment == MAP_FAILED)
+  {
+    return false;
+  }
+  segment_ = segment;
+  segment_size_ = segment_size;
+  header_ = static_cast<const shared_memory::SharedMemoryHeader *>(segment_);
+  if (
+    header_->state.load(std::memory_order_acquire) !=
+      static_cast<uint32_t>(shared_memory::SegmentState::ACTIVE) ||
+    header_->magic != shared_memory::MAGIC || header_->version != shared_memory::VERSION ||
+    header_->size > segment_size_ ||
+    header_->values_offset + header_->number_of_interfaces * sizeof(std::atomic<double>) >
+      segment_size_)
+  {
+    close();
+    return false;
+  }
+
+  const auto * bytes = static_cast<const uint8_t *>(segment_);
+  const auto * descriptors =
+    reinterpret_cast<const shared_memory::SharedMemoryInterfaceDescriptor *>(
+      bytes + header_->descriptors_offset);
+  const auto * names = reinterpret_cast<const char *>(bytes + header_->names_offset);
+  const std::size_t names_size = header_->values_offset - header_->names_offset;
+  interface_names_.reserve(header_->number_of_interfaces);
+  data_types_.reserve(header_->number_of_interfaces);
+  for (uint32_t i = 0; i < header_->number_of_interfaces; ++i)
+  {
+    if (descriptors[i].name_offset + descriptors[i].name_length > names_size)
+    {
+      close();
+      return false;
+    }
+    interface_names_.emplace_back(names + descriptors[i].name_offset, descriptors[i].name_length);
+    data_types_.emplace_back(static_cast<HandleDataType::Value>(descriptors[i].data_type));
+  }
+  number_of_state_interfaces_ = header_->number_of_state_interfaces;
+  values_ = reinterpret_cast<const std::atomic<double> *>(bytes + header_->values_offset);
+  return true;
+#endif
+}
+
+void SharedMemoryInterfaceReader::close() noexcept
+{
+#if !defined(_WIN32)
+  if (segment_)
+  {
+    munmap(const_cast<void *>(segment_), segment_size_);
+  }
+#endif
+  segment_ = nullptr;
+  segment_size_ = 0;
+  header_ = nullptr;
+  values_ = nullptr;
+  interface_names_.clear();
+  data_types_.clear();
+  number_of_state_interfaces_ = 0;
+}
+
+bool SharedMemoryInterfaceReader::is_active() const noexcept
+{
+  return header_ && header_->state.load(std::memory_order_acquire) ==
+                      static_cast<uint32_t>(shared_memory::SegmentState::ACTIVE);
+}
+
+bool SharedMemoryInterfaceReader::read(Snapshot & snapshot) const
+{
+  if (!is_active())
+  {
+    return false;
+  }
+  snapshot.values.resize(interface_names_.size());
+  uint32_t sequence_begin = 0;
+  uint32_t sequence_end = 0;
+  do
+  {
+    sequence_begin = header_->sequence.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < snapshot.values.size(); ++i)
+    {
+      snapshot.values[i] = values_[i].load(std::memory_order_relaxed);
+    }
+    snapshot.update_count = header_->update_count.load(std::memory_order_relaxed);
+    snapshot.state_stamp_ns = header_->state_stamp_ns.load(std::memory_order_relaxed);
+    snapshot.command_stamp_ns = header_->command_stamp_ns.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    sequence_end = header_->sequence.load(std::memory_order_relaxed);
+  } while ((sequence_begin & 1u) != 0u || sequence_begin != sequence_end);
+  return true;
+}
+
+}  // namespace hardware_interface
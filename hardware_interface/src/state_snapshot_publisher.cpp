@@ -0,0 +1,166 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/state_snapshot_publisher.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/qos.hpp"
+
+namespace hardware_interface
+{
+StateSnapshotPublisher::StateSnapshotPublisher(
+  const rclcpp::Node::SharedPtr & node, unsigned int decimation)
+: node_(node), decimation_(std::max(decimation, 1u))
+{
+  values_publisher_ = node_->create_publisher<control_msgs::msg::DynamicInterfaceGroupValues>(
+    "~/values", rclcpp::SensorDataQoS());
+  // the late subscribers receive the names published once
+  names_publisher_ = node_->create_publisher<control_msgs::msg::DynamicInterfaceGroupValues>(
+    "~/names", rclcpp::QoS(1).reliable().transient_local());
+  publishing_thread_ = std::thread(&StateSnapshotPublisher::publishing_loop, this);
+}
+
+StateSnapshotPublisher::~StateSnapshotPublisher()
+{
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stop_ = true;
+  }
+  snapshot_captured_.notify_one();
+  if (publishing_thread_.joinable())
+  {
+    publishing_thread_.join();
+  }
+}
+
+void StateSnapshotPublisher::set_groups(const std::vector<StateSnapshotGroup> & groups)
+{
+  control_msgs::msg::DynamicInterfaceGroupValues names_message;
+  {
+    std::lock_guard<std::mutex> publish_guard(publish_mutex_);
+    std::lock_guard<std::mutex> guard(mutex_);
+    groups_ = groups;
+    number_of_values_ = 0;
+    captured_message_ = control_msgs::msg::DynamicInterfaceGroupValues();
+    captured_message_.interface_values.resize(groups_.size());
+    names_message.interface_groups.reserve(groups_.size());
+    names_message.interface_values.resize(groups_.size());
+    for (std::size_t i = 0; i < groups_.size(); ++i)
+    {
+      captured_message_.interface_values[i].values.resize(groups_[i].interface_names.size());
+      number_of_values_ += groups_[i].interface_names.size();
+      names_message.interface_groups.push_back(groups_[i].name);
+      names_message.interface_values[i].interface_names = groups_[i].interface_names;
+    }
+    // both messages have the same layout, so that swapping them doesn't allocate
+    published_message_ = captured_message_;
+    snapshot_pending_ = false;
+  }
+  names_message.header.stamp = node_->get_clock()->now();
+  names_publisher_->publish(names_message);
+}
+
+bool StateSnapshotPublisher::capture(const rclcpp::Time & time)
+{
+  if (cycles_until_capture_ > 0)
+  {
+    --cycles_until_capture_;
+    return false;
+  }
+  cycles_until_capture_ = decimation_ - 1;
+
+  std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+  if (!lock.owns_lock())
+  {
+    dropped_snapshots_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  if (groups_.empty())
+  {
+    return false;
+  }
+  if (snapshot_pending_)
+  {
+    // the latest snapshot replaces the one that wasn't published yet
+    dropped_snapshots_.fetch_add(1, std::memory_order_relaxed);
+  }
+  for (std::size_t i = 0; i < groups_.size(); ++i)
+  {
+    const auto & group = groups_[i];
+    auto & values = captured_message_.interface_values[i].values;
+    if (values.empty())
+    {
+      continue;
+    }
+    if (group.values)
+    {
+      std::memcpy(values.data(), group.values, values.size() * sizeof(double));
+    }
+    else
+    {
+      for (std::size_t j = 0; j < values.size(); ++j)
+      {
+        values[j] = group.interfaces[j]->get_optional_as_double().value_or(values[j]);
+      }
+    }
+  }
+  captured_message_.header.stamp = time;
+  snapshot_pending_ = true;
+  lock.unlock();
+  snapshot_captured_.notify_one();
+  return true;
+}
+
+void StateSnapshotPublisher::publishing_loop()
+{
+  while (true)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    snapshot_captured_.wait(lock, [this]() { return snapshot_pending_ || stop_; });
+    if (stop_)
+    {
+      return;
+    }
+    lock.unlock();
+
+    std::lock_guard<std::mutex> publish_guard(publish_mutex_);
+    lock.lock();
+    if (!snapshot_pending_)
+    {
+      // the groups were replaced in the meantime
+      continue;
+    }
+    std::swap(captured_message_, published_message_);
+    snapshot_pending_ = false;
+    lock.unlock();
+
+    if (values_publisher_->can_loan_messages())
+    {
+      auto loaned_message = values_publisher_->borrow_loaned_message();
+      loaned_message.get() = published_message_;
+      values_publisher_->publish(std::move(loaned_message));
+    }
+    else
+    {
+      values_publisher_->publish(published_message_);
+    }
+    published_snapshots_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,65 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/thread_times.hpp"
+
+#include <atomic>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+namespace
+{
+std::atomic<bool> sampling_enabled{false};
+}  // namespace
+
+namespace hardware_interface
+{
+ThreadTimes ThreadTimes::now() noexcept
+{
+  ThreadTimes times;
+  if (!is_sampling_enabled())
+  {
+    return times;
+  }
+#if defined(__linux__)
+  timespec cpu_time{};
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time) == 0)
+  {
+    times.cpu_time =
+      std::chrono::seconds(cpu_time.tv_sec) + std::chrono::nanoseconds(cpu_time.tv_nsec);
+  }
+  rusage usage{};
+  if (getrusage(RUSAGE_THREAD, &usage) == 0)
+  {
+    times.voluntary_context_switches = static_cast<uint64_t>(usage.ru_nvcsw);
+    times.involuntary_context_switches = static_cast<uint64_t>(usage.ru_nivcsw);
+  }
+#endif
+  return times;
+}
+
+void ThreadTimes::set_sampling_enabled(bool enabled) noexcept
+{
+  sampling_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool ThreadTimes::is_sampling_enabled() noexcept
+{
+  return sampling_enabled.load(std::memory_order_relaxed);
+}
+
+}  // namespace hardware_interface
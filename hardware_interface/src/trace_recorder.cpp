@@ -0,0 +1,209 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/trace_recorder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hardware_interface/instrumentation_clock.hpp"
+#include "hardware_interface/name_pool.hpp"
+
+namespace
+{
+/// Ring buffer of the events of a single recording thread
+struct TraceRing
+{
+  std::unique_ptr<hardware_interface::TraceEvent[]> events;
+  std::size_t capacity = 0;
+  /// Written by the recording thread only
+  alignas(64) std::atomic<uint64_t> head{0};
+  /// Written by the draining thread only
+  alignas(64) std::atomic<uint64_t> tail{0};
+};
+
+std::atomic<bool> recording_enabled{false};
+std::mutex enable_mutex;
+std::unique_ptr<TraceRing[]> rings;
+std::size_t number_of_rings = 0;
+std::atomic<std::size_t> claimed_rings{0};
+std::atomic<uint64_t> dropped_events{0};
+
+/// Index of the ring of the thread, -1 if not claimed yet and -2 if no ring is left
+thread_local int64_t thread_ring_index = -1;
+
+/// Escapes the characters of the name that are not allowed in a JSON string
+std::string escape_json(const std::string & name)
+{
+  std::string escaped;
+  escaped.reserve(name.size());
+  for (const char c : name)
+  {
+    if (c == '"' || c == '\\')
+    {
+      escaped.push_back('\\');
+      escaped.push_back(c);
+    }
+    else if (static_cast<unsigned char>(c) >= 0x20)
+    {
+      escaped.push_back(c);
+    }
+  }
+  return escaped;
+}
+
+/// Writes the nanoseconds as microseconds with three decimals, without losing precision
+void write_as_microseconds(std::ostream & os, int64_t nanoseconds)
+{
+  if (nanoseconds < 0)
+  {
+    os << '-';
+    nanoseconds = -nanoseconds;
+  }
+  const int64_t fraction = nanoseconds % 1000;
+  os << nanoseconds / 1000 << '.' << static_cast<char>('0' + fraction / 100)
+     << static_cast<char>('0' + (fraction / 10) % 10) << static_cast<char>('0' + fraction % 10);
+}
+}  // namespace
+
+namespace hardware_interface
+{
+void TraceRecorder::enable(std::size_t events_per_thread, std::size_t max_threads)
+{
+  std::lock_guard<std::mutex> lock(enable_mutex);
+  if (!rings && events_per_thread > 0 && max_threads > 0)
+  {
+    rings = std::make_unique<TraceRing[]>(max_threads);
+    for (std::size_t i = 0; i < max_threads; ++i)
+    {
+      rings[i].events = std::make_unique<TraceEvent[]>(events_per_thread);
+      rings[i].capacity = events_per_thread;
+    }
+    number_of_rings = max_threads;
+  }
+  recording_enabled.store(rings != nullptr, std::memory_order_release);
+}
+
+void TraceRecorder::disable() noexcept
+{
+  recording_enabled.store(false, std::memory_order_release);
+}
+
+bool TraceRecorder::is_enabled() noexcept
+{
+  return recording_enabled.load(std::memory_order_acquire);
+}
+
+uint32_t TraceRecorder::register_name(const std::string & name)
+{
+  return NamePool::intern(name);
+}
+
+std::string TraceRecorder::get_name(uint32_t name_id)
+{
+  return NamePool::get_name(name_id);
+}
+
+int64_t TraceRecorder::now() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           InstrumentationClock::now().time_since_epoch())
+    .count();
+}
+
+void TraceRecorder::record(uint32_t name_id, int64_t begin_ns, int64_t end_ns) noexcept
+{
+  if (name_id == 0 || !is_enabled())
+  {
+    return;
+  }
+  if (thread_ring_index == -1)
+  {
+    const std::size_t index = claimed_rings.fetch_add(1, std::memory_order_relaxed);
+    thread_ring_index = index < number_of_rings ? static_cast<int64_t>(index) : -2;
+  }
+  if (thread_ring_index < 0)
+  {
+    dropped_events.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  auto & ring = rings[static_cast<std::size_t>(thread_ring_index)];
+  const uint64_t head = ring.head.load(std::memory_order_relaxed);
+  if (head - ring.tail.load(std::memory_order_acquire) >= ring.capacity)
+  {
+    dropped_events.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  ring.events[head % ring.capacity] = TraceEvent{
+    name_id, static_cast<uint32_t>(thread_ring_index), begin_ns, end_ns};
+  ring.head.store(head + 1, std::memory_order_release);
+}
+
+std::size_t TraceRecorder::drain(std::vector<TraceEvent> & events)
+{
+  if (!rings)
+  {
+    return 0;
+  }
+  std::size_t drained = 0;
+  const std::size_t used_rings =
+    std::min(claimed_rings.load(std::memory_order_relaxed), number_of_rings);
+  for (std::size_t i = 0; i < used_rings; ++i)
+  {
+    auto & ring = rings[i];
+    const uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    const uint64_t head = ring.head.load(std::memory_order_acquire);
+    for (uint64_t index = tail; index < head; ++index)
+    {
+      events.push_back(ring.events[index % ring.capacity]);
+    }
+    ring.tail.store(head, std::memory_order_release);
+    drained += static_cast<std::size_t>(head - tail);
+  }
+  return drained;
+}
+
+uint64_t TraceRecorder::get_dropped_events() noexcept
+{
+  return dropped_events.load(std::memory_order_relaxed);
+}
+
+void TraceRecorder::write_chrome_trace_events(
+  std::ostream & os, const std::vector<TraceEvent> & events)
+{
+  std::unordered_map<uint32_t, std::string> escaped_names;
+  for (const auto & event : events)
+  {
+    auto name_it = escaped_names.find(event.name_id);
+    if (name_it == escaped_names.end())
+    {
+      name_it = escaped_names.emplace(event.name_id, escape_json(get_name(event.name_id))).first;
+    }
+    // the timestamps of the format are in microseconds
+    os << "{\"name\":\"" << name_it->second << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+       << event.thread_index << ",\"ts\":";
+    write_as_microseconds(os, event.begin_ns);
+    os << ",\"dur\":";
+    write_as_microseconds(os, event.end_ns - event.begin_ns);
+    os << "},\n";
+  }
+}
+
+}  // namespace hardware_interface
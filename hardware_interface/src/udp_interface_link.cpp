@@ -0,0 +1,305 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/udp_interface_link.hpp"
+
+#include <fmt/compile.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace hardware_interface
+{
+namespace
+{
+constexpr std::size_t HEADER_SIZE = sizeof(udp_link::FrameHeader);
+
+std::size_t get_frame_size(std::size_t number_of_values)
+{
+  return HEADER_SIZE + number_of_values * sizeof(double);
+}
+}  // namespace
+
+UdpInterfaceLink::~UdpInterfaceLink() { close(); }
+
+void UdpInterfaceLink::open(
+  uint16_t local_port, const std::string & remote_address, uint16_t remote_port,
+  const std::vector<std::string> & sent_names, const std::vector<std::string> & received_names)
+{
+#if defined(_WIN32)
+  (void)local_port;
+  (void)remote_address;
+  (void)remote_port;
+  (void)sent_names;
+  (void)received_names;
+  throw std::runtime_error("The UDP interface link is only supported on POSIX systems.");
+#else
+  close();
+
+  addrinfo hints;
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_DGRAM;
+  addrinfo * remote = nullptr;
+  const std::string remote_service = std::to_string(remote_port);
+  const int resolve_result =
+    getaddrinfo(remote_address.c_str(), remote_service.c_str(), &hints, &remote);
+  if (resolve_result != 0 || remote == nullptr)
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to resolve the remote address '{}': {}"), remote_address,
+        gai_strerror(resolve_result)));
+  }
+
+  const int fd = socket(remote->ai_family, SOCK_DGRAM, 0);
+  if (fd < 0)
+  {
+    freeaddrinfo(remote);
+    throw std::runtime_error(
+      fmt::format(FMT_COMPILE("Unable to open the UDP socket: {}"), std::strerror(errno)));
+  }
+  sockaddr_storage local;
+  std::memset(&local, 0, sizeof(local));
+  socklen_t local_size = 0;
+  if (remote->ai_family == AF_INET6)
+  {
+    auto * local6 = reinterpret_cast<sockaddr_in6 *>(&local);
+    local6->sin6_family = AF_INET6;
+    local6->sin6_addr = in6addr_any;
+    local6->sin6_port = htons(local_port);
+    local_size = sizeof(sockaddr_in6);
+  }
+  else
+  {
+    auto * local4 = reinterpret_cast<sockaddr_in *>(&local);
+    local4->sin_family = AF_INET;
+    local4->sin_addr.s_addr = htonl(INADDR_ANY);
+    local4->sin_port = htons(local_port);
+    local_size = sizeof(sockaddr_in);
+  }
+  const int reuse = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  // connecting the socket filters the datagrams of other senders
+  if (
+    bind(fd, reinterpret_cast<sockaddr *>(&local), local_size) != 0 ||
+    connect(fd, remote->ai_addr, remote->ai_addrlen) != 0)
+  {
+    const std::string error = std::strerror(errno);
+    freeaddrinfo(remote);
+    ::close(fd);
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Unable to bind the UDP port {} and connect it to '{}:{}': {}"), local_port,
+        remote_address, remote_port, error));
+  }
+  freeaddrinfo(remote);
+
+  socket_ = fd;
+  sent_layout_hash_ = compute_layout_hash(sent_names);
+  received_layout_hash_ = compute_layout_hash(received_names);
+  number_of_sent_values_ = sent_names.size();
+  number_of_received_values_ = received_names.size();
+  sent_sequence_ = 0;
+  last_received_sequence_ = 0;
+  has_received_frame_ = false;
+  send_buffer_.assign(get_frame_size(number_of_sent_values_), 0u);
+  receive_buffer_.assign(get_frame_size(number_of_received_values_) + 1u, 0u);
+  newest_frame_.assign(get_frame_size(number_of_received_values_), 0u);
+  statistics_.sent_frames = 0;
+  statistics_.send_errors = 0;
+  statistics_.received_frames = 0;
+  statistics_.lost_frames = 0;
+  statistics_.rejected_frames = 0;
+  statistics_.age.reset();
+#endif
+}
+
+void UdpInterfaceLink::close() noexcept
+{
+#if !defined(_WIN32)
+  if (socket_ >= 0)
+  {
+    ::close(socket_);
+  }
+#endif
+  socket_ = -1;
+}
+
+bool UdpInterfaceLink::send(const std::vector<double> & values, int64_t stamp_ns) noexcept
+{
+#if defined(_WIN32)
+  (void)values;
+  (void)stamp_ns;
+  return false;
+#else
+  if (socket_ < 0 || values.size() != number_of_sent_values_)
+  {
+    return false;
+  }
+  udp_link::FrameHeader header;
+  header.magic = udp_link::FRAME_MAGIC;
+  header.version = udp_link::FRAME_VERSION;
+  header.layout_hash = sent_layout_hash_;
+  header.sequence = ++sent_sequence_;
+  header.number_of_values = static_cast<uint32_t>(number_of_sent_values_);
+  header.stamp_ns = stamp_ns;
+  std::memcpy(send_buffer_.data(), &header, HEADER_SIZE);
+  if (!values.empty())
+  {
+    std::memcpy(send_buffer_.data() + HEADER_SIZE, values.data(), values.size() * sizeof(double));
+  }
+  if (::send(socket_, send_buffer_.data(), send_buffer_.size(), MSG_DONTWAIT) !=
+      static_cast<ssize_t>(send_buffer_.size()))
+  {
+    ++statistics_.send_errors;
+    return false;
+  }
+  ++statistics_.sent_frames;
+  return true;
+#endif
+}
+
+bool UdpInterfaceLink::receive(
+  std::vector<double> & values, int64_t & stamp_ns, int64_t now_ns,
+  std::chrono::nanoseconds timeout) noexcept
+{
+#if defined(_WIN32)
+  (void)values;
+  (void)stamp_ns;
+  (void)now_ns;
+  (void)timeout;
+  return false;
+#else
+  if (socket_ < 0)
+  {
+    return false;
+  }
+  bool received = read_pending_frames(stamp_ns, now_ns);
+  if (!received && timeout.count() > 0)
+  {
+    pollfd descriptor;
+    descriptor.fd = socket_;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    timespec relative_timeout;
+    relative_timeout.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+    relative_timeout.tv_nsec = static_cast<long>(timeout.count() % 1000000000);  // NOLINT
+    if (ppoll(&descriptor, 1, &relative_timeout, nullptr) > 0)
+    {
+      received = read_pending_frames(stamp_ns, now_ns);
+    }
+  }
+  if (received)
+  {
+    // allocates only if the caller didn't size the values
+    values.resize(number_of_received_values_);
+    if (!values.empty())
+    {
+      std::memcpy(
+        values.data(), newest_frame_.data() + HEADER_SIZE, values.size() * sizeof(double));
+    }
+  }
+  return received;
+#endif
+}
+
+bool UdpInterfaceLink::read_pending_frames(int64_t & stamp_ns, int64_t now_ns) noexcept
+{
+#if defined(_WIN32)
+  (void)stamp_ns;
+  (void)now_ns;
+  return false;
+#else
+  const std::size_t frame_size = newest_frame_.size();
+  bool received = false;
+  while (true)
+  {
+    const ssize_t size =
+      recv(socket_, receive_buffer_.data(), receive_buffer_.size(), MSG_DONTWAIT);
+    if (size < 0)
+    {
+      // a refused connection is reported while the remote side isn't running, it's not an error
+      if (errno == EINTR || errno == ECONNREFUSED)
+      {
+        continue;
+      }
+      break;
+    }
+    udp_link::FrameHeader header;
+    if (static_cast<std::size_t>(size) != frame_size)
+    {
+      ++statistics_.rejected_frames;
+      continue;
+    }
+    std::memcpy(&header, receive_buffer_.data(), HEADER_SIZE);
+    if (
+      header.magic != udp_link::FRAME_MAGIC || header.version != udp_link::FRAME_VERSION ||
+      header.layout_hash != received_layout_hash_ ||
+      header.number_of_values != number_of_received_values_)
+    {
+      ++statistics_.rejected_frames;
+      continue;
+    }
+    const auto sequence_difference =
+      static_cast<int32_t>(header.sequence - last_received_sequence_);
+    if (has_received_frame_ && sequence_difference <= 0)
+    {
+      // a reordered or duplicated frame, older than the newest one
+      ++statistics_.rejected_frames;
+      continue;
+    }
+    if (has_received_frame_)
+    {
+      statistics_.lost_frames += static_cast<uint64_t>(sequence_difference - 1);
+    }
+    has_received_frame_ = true;
+    last_received_sequence_ = header.sequence;
+    ++statistics_.received_frames;
+    statistics_.age.add_measurement(static_cast<double>(now_ns - header.stamp_ns) / 1e9);
+    std::memcpy(newest_frame_.data(), receive_buffer_.data(), frame_size);
+    stamp_ns = header.stamp_ns;
+    received = true;
+  }
+  return received;
+#endif
+}
+
+uint64_t UdpInterfaceLink::compute_layout_hash(const std::vector<std::string> & names)
+{
+  // 64-bit FNV-1a of the names, each one terminated by a null character
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (const auto & name : names)
+  {
+    for (const char c : name)
+    {
+      hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+    }
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+}  // namespace hardware_interface
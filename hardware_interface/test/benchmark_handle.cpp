@@ -0,0 +1,194 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "benchmark/benchmark.h"
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/loaned_command_interface.hpp"
+
+using hardware_interface::CommandInterface;
+using hardware_interface::HandleDataType;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceInfo;
+using hardware_interface::LoanedCommandInterface;
+using hardware_interface::StateInterface;
+
+namespace
+{
+/// Maximum number of threads of the contended benchmarks, the first one writes, the others read
+constexpr int MAX_THREADS = 8;
+
+template <typename T>
+InterfaceDescription make_description()
+{
+  InterfaceInfo info;
+  info.name = "position";
+  info.data_type = HandleDataType(HandleDataType::from_type<T>()).to_string();
+  info.initial_value = std::is_same_v<T, bool> ? "false" : "0";
+  return InterfaceDescription("joint1", info);
+}
+
+/// Returns a value different from the previous one, so that every set_value() changes the value
+template <typename T>
+T next_value(T value)
+{
+  if constexpr (std::is_same_v<T, bool>)
+  {
+    return !value;
+  }
+  else
+  {
+    return static_cast<T>(value + static_cast<T>(1));
+  }
+}
+
+/// Handle shared by the threads of a contended benchmark, one per data type
+template <typename T>
+CommandInterface::SharedPtr get_shared_handle()
+{
+  static const auto handle = std::make_shared<CommandInterface>(make_description<T>());
+  return handle;
+}
+
+void report_failures(benchmark::State & state, uint64_t failures)
+{
+  state.counters["failure_rate"] =
+    benchmark::Counter(static_cast<double>(failures), benchmark::Counter::kAvgIterations);
+}
+
+template <typename T>
+void handle_get_optional(benchmark::State & state)
+{
+  const StateInterface handle(make_description<T>());
+  uint64_t failures = 0;
+  for (auto _ : state)
+  {
+    const std::optional<T> value = handle.template get_optional<T>();
+    failures += !value.has_value();
+    benchmark::DoNotOptimize(value);
+  }
+  report_failures(state, failures);
+}
+
+template <typename T>
+void handle_set_value(benchmark::State & state)
+{
+  StateInterface handle(make_description<T>());
+  T value{};
+  uint64_t failures = 0;
+  for (auto _ : state)
+  {
+    value = next_value(value);
+    failures += !handle.set_value(value);
+    benchmark::ClobberMemory();
+  }
+  report_failures(state, failures);
+}
+
+/// The first thread writes the value like the hardware component or the real-time loop, the
+/// others read it like asynchronous controllers.
+template <typename T>
+void contended_handle_access(benchmark::State & state)
+{
+  const auto handle = get_shared_handle<T>();
+  const bool is_writer = state.thread_index() == 0;
+  T value{};
+  uint64_t failures = 0;
+  for (auto _ : state)
+  {
+    if (is_writer)
+    {
+      value = next_value(value);
+      failures += !handle->set_value(value);
+    }
+    else
+    {
+      const std::optional<T> read_value = handle->template get_optional<T>();
+      failures += !read_value.has_value();
+      benchmark::DoNotOptimize(read_value);
+    }
+  }
+  report_failures(state, failures);
+}
+
+/// Like contended_handle_access(), through the loans of the controllers and their retries.
+template <typename T>
+void contended_loaned_interface_access(benchmark::State & state)
+{
+  const auto handle = get_shared_handle<T>();
+  const bool is_writer = state.thread_index() == 0;
+  T value{};
+  uint64_t failures = 0;
+  if (is_writer)
+  {
+    LoanedCommandInterface loaned_command(handle);
+    for (auto _ : state)
+    {
+      value = next_value(value);
+      failures += !loaned_command.set_value(value);
+    }
+  }
+  else
+  {
+    // the readers are loaned the same command interface, e.g., by a hardware component reading it
+    const LoanedCommandInterface loaned_command(handle);
+    for (auto _ : state)
+    {
+      const std::optional<T> read_value = loaned_command.template get_optional<T>();
+      failures += !read_value.has_value();
+      benchmark::DoNotOptimize(read_value);
+    }
+  }
+  report_failures(state, failures);
+}
+
+template <typename T>
+void loaned_command_interface_set_value(benchmark::State & state)
+{
+  LoanedCommandInterface loaned_command(std::make_shared<CommandInterface>(make_description<T>()));
+  T value{};
+  uint64_t failures = 0;
+  for (auto _ : state)
+  {
+    value = next_value(value);
+    failures += !loaned_command.set_value(value);
+  }
+  report_failures(state, failures);
+}
+}  // namespace
+
+#define REGISTER_HANDLE_BENCHMARKS(T)                                                           \
+  BENCHMARK_TEMPLATE(handle_get_optional, T);                                                   \
+  BENCHMARK_TEMPLATE(handle_set_value, T);                                                      \
+  BENCHMARK_TEMPLATE(loaned_command_interface_set_value, T);                                    \
+  BENCHMARK_TEMPLATE(contended_handle_access, T)->ThreadRange(2, MAX_THREADS)->UseRealTime();   \
+  BENCHMARK_TEMPLATE(contended_loaned_interface_access, T)                                      \
+    ->ThreadRange(2, MAX_THREADS)                                                               \
+    ->UseRealTime()
+
+REGISTER_HANDLE_BENCHMARKS(double);
+REGISTER_HANDLE_BENCHMARKS(float);
+REGISTER_HANDLE_BENCHMARKS(bool);
+REGISTER_HANDLE_BENCHMARKS(uint8_t);
+REGISTER_HANDLE_BENCHMARKS(int8_t);
+REGISTER_HANDLE_BENCHMARKS(uint16_t);
+REGISTER_HANDLE_BENCHMARKS(int16_t);
+REGISTER_HANDLE_BENCHMARKS(uint32_t);
+REGISTER_HANDLE_BENCHMARKS(int32_t);
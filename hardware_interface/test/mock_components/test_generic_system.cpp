@@ -14,6 +14,7 @@
 //
 // Author: Denis Stogl
 
+#include <chrono>
 #include <cmath>
 #include <string>
 #include <unordered_map>
@@ -28,6 +29,7 @@
 #include "rclcpp/node.hpp"
 #include "rclcpp_lifecycle/state.hpp"
 #include "ros2_control_test_assets/descriptions.hpp"
+#include "ros2_control_test_assets/generated_descriptions.hpp"
 
 namespace
 {
@@ -635,6 +637,26 @@ protected:
   </ros2_control>
 )";
 
+    hw_sys_2dof_calc_dyn_with_first_order_lag_and_command_delay_ =
+      R"(
+  <ros2_control name="MockHardwareSystem" type="system">
+    <hardware>
+      <plugin>mock_components/GenericSystem</plugin>
+      <param name="calculate_dynamics">true</param>
+      <param name="dynamics_model">first_order_lag</param>
+      <param name="dynamics_time_constant">0.1</param>
+      <param name="command_delay_cycles">1</param>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="position"/>
+      <state_interface name="position">
+        <param name="initial_value">3.45</param>
+      </state_interface>
+      <state_interface name="velocity"/>
+    </joint>
+  </ros2_control>
+)";
+
     hw_sys_2dof_calc_dyn_with_velocity_control_mode_position_state_only_ =
       R"(
   <ros2_control name="MockHardwareSystem" type="system">
@@ -827,6 +849,7 @@ protected:
   std::string hw_sys_2dof_calc_dyn_standard_interfaces_with_different_control_modes_;
   std::string hw_sys_2dof_calc_dyn_with_position_control_mode_position_state_only_;
   std::string hw_sys_2dof_calc_dyn_with_position_control_mode_position_state_only_w_offset_;
+  std::string hw_sys_2dof_calc_dyn_with_first_order_lag_and_command_delay_;
   std::string hw_sys_2dof_standard_interfaces_with_velocity_control_mode_;
   std::string hw_sys_2dof_calc_dyn_with_velocity_control_mode_position_state_only_;
   std::string hw_sys_2dof_calc_dyn_with_velocity_control_mode_position_state_only_w_offset_;
@@ -860,6 +883,11 @@ public:
       cm_update_rate)
   {
   }
+
+  explicit TestableResourceManager(const hardware_interface::ResourceManagerParams & params)
+  : hardware_interface::ResourceManager(params, true)
+  {
+  }
 };
 
 void set_components_state(
@@ -1112,10 +1140,17 @@ void generic_system_functional_test(
 }
 
 void generic_system_error_group_test(
-  const std::string & urdf, const std::string component_prefix, bool validate_same_group)
+  const std::string & urdf, const std::string component_prefix, bool validate_same_group,
+  unsigned int number_of_read_write_workers = 0)
 {
   rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_generic_system");
-  TestableResourceManager rm(node, urdf, false, 200u);
+  hardware_interface::ResourceManagerParams rm_params;
+  rm_params.robot_description = urdf;
+  rm_params.clock = node->get_clock();
+  rm_params.logger = node->get_logger();
+  rm_params.update_rate = 200u;
+  rm_params.read_write_worker_pool.number_of_workers = number_of_read_write_workers;
+  TestableResourceManager rm(rm_params);
   const std::string component1 = component_prefix + "1";
   const std::string component2 = component_prefix + "2";
   // check is hardware is configured
@@ -1293,6 +1328,24 @@ TEST_F(TestGenericSystem, generic_system_2dof_error_propagation_same_group)
   generic_system_error_group_test(urdf, {"MockHardwareSystem"}, true);
 }
 
+TEST_F(TestGenericSystem, generic_system_2dof_error_propagation_different_group_parallel)
+{
+  auto urdf = ros2_control_test_assets::urdf_head +
+              hw_sys_2dof_standard_interfaces_with_two_diff_hw_groups_ +
+              ros2_control_test_assets::urdf_tail;
+
+  generic_system_error_group_test(urdf, {"MockHardwareSystem"}, false, 2u);
+}
+
+TEST_F(TestGenericSystem, generic_system_2dof_error_propagation_same_group_parallel)
+{
+  auto urdf = ros2_control_test_assets::urdf_head +
+              hw_sys_2dof_standard_interfaces_with_same_hardware_group_ +
+              ros2_control_test_assets::urdf_tail;
+
+  generic_system_error_group_test(urdf, {"MockHardwareSystem"}, true, 2u);
+}
+
 TEST_F(TestGenericSystem, generic_system_2dof_other_interfaces)
 {
   auto urdf = ros2_control_test_assets::urdf_head + hw_sys_2dof_with_gpio_ +
@@ -2505,6 +2558,44 @@ TEST_F(TestGenericSystem, simple_dynamics_pos_control_modes_interfaces_w_offset)
   ASSERT_EQ(3.5, j2p_c.get_optional().value());
 }
 
+TEST_F(TestGenericSystem, dynamics_model_first_order_lag_with_command_delay)
+{
+  auto urdf = ros2_control_test_assets::urdf_head +
+              hw_sys_2dof_calc_dyn_with_first_order_lag_and_command_delay_ +
+              ros2_control_test_assets::urdf_tail;
+
+  TestableResourceManager rm(node_, urdf);
+  // Activate components to get all interfaces available
+  activate_components(rm, {"MockHardwareSystem"});
+
+  hardware_interface::LoanedStateInterface j1p_s = rm.claim_state_interface("joint1/position");
+  hardware_interface::LoanedStateInterface j1v_s = rm.claim_state_interface("joint1/velocity");
+  hardware_interface::LoanedCommandInterface j1p_c = rm.claim_command_interface("joint1/position");
+  EXPECT_EQ(3.45, j1p_s.get_optional().value());
+
+  ASSERT_EQ(rm.prepare_command_mode_switch({"joint1/position"}, {}), true);
+  ASSERT_EQ(rm.perform_command_mode_switch({"joint1/position"}, {}), true);
+  ASSERT_TRUE(j1p_c.set_value(0.45));
+
+  // the command is delayed by one cycle
+  ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  EXPECT_EQ(3.45, j1p_s.get_optional().value());
+  EXPECT_EQ(0.0, j1v_s.get_optional().value());
+
+  // the position follows the command with the time constant of the lag
+  const double gain = 1.0 - std::exp(-PERIOD_SEC / 0.1);
+  ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  EXPECT_NEAR(3.45 - 3.0 * gain, j1p_s.get_optional().value(), COMPARE_DELTA);
+  EXPECT_NEAR(-3.0 * gain / PERIOD_SEC, j1v_s.get_optional().value(), COMPARE_DELTA);
+
+  for (int i = 0; i < 50; ++i)
+  {
+    ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  }
+  EXPECT_NEAR(0.45, j1p_s.get_optional().value(), COMPARE_DELTA);
+  EXPECT_NEAR(0.0, j1v_s.get_optional().value(), COMPARE_DELTA);
+}
+
 TEST_F(TestGenericSystem, simple_dynamics_vel_control_modes_interfaces)
 {
   auto urdf = ros2_control_test_assets::urdf_head +
@@ -2656,6 +2747,49 @@ TEST_F(TestGenericSystem, simple_dynamics_vel_control_modes_interfaces_with_offs
   ASSERT_EQ(3.5, j2v_c.get_optional().value());
 }
 
+TEST_F(TestGenericSystem, generated_systems_with_cpu_load)
+{
+  ros2_control_test_assets::GeneratedDescriptionParameters parameters;
+  parameters.number_of_systems = 3;
+  parameters.joints_per_system = 4;
+  parameters.sensors_per_system = 1;
+  parameters.gpios_per_system = 2;
+  parameters.hardware_parameters["read_cpu_load_us"] = "1000";
+  parameters.hardware_parameters["write_cpu_load_us"] = "500";
+
+  const auto urdf = ros2_control_test_assets::generate_robot_description(parameters);
+  TestableResourceManager rm(node_, urdf);
+  activate_components(
+    rm, {ros2_control_test_assets::generated_system_name(0),
+         ros2_control_test_assets::generated_system_name(1),
+         ros2_control_test_assets::generated_system_name(2)});
+
+  // per system: 4 joints with 2 states and a command, a sensor, 2 gpios with 2 states and a command
+  EXPECT_EQ(3u, rm.system_components_size());
+  EXPECT_EQ(39u, rm.state_interface_keys().size());
+  EXPECT_EQ(18u, rm.command_interface_keys().size());
+  EXPECT_TRUE(rm.state_interface_exists(
+    ros2_control_test_assets::generated_joint_name(2, 3) + "/position"));
+  EXPECT_TRUE(rm.state_interface_exists(
+    ros2_control_test_assets::generated_gpio_name(1, 1) + "/digital_input"));
+
+  hardware_interface::LoanedCommandInterface j_c =
+    rm.claim_command_interface(ros2_control_test_assets::generated_joint_name(1, 2) + "/position");
+  hardware_interface::LoanedStateInterface j_s =
+    rm.claim_state_interface(ros2_control_test_assets::generated_joint_name(1, 2) + "/position");
+  ASSERT_TRUE(j_c.set_value(0.5));
+
+  // every system keeps the CPU busy for its load
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(3000));
+  EXPECT_EQ(0.5, j_s.get_optional().value());
+
+  start = std::chrono::steady_clock::now();
+  ASSERT_EQ(rm.write(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(1500));
+}
+
 TEST_F(TestGenericSystem, disabled_commands_flag_is_active)
 {
   auto urdf =
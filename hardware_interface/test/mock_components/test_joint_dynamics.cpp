@@ -0,0 +1,146 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "mock_components/joint_dynamics.hpp"
+
+using mock_components::JointDynamics;
+
+namespace
+{
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+constexpr double PERIOD = 0.01;
+}  // namespace
+
+TEST(TestJointDynamics, parse_model)
+{
+  EXPECT_EQ(JointDynamics::parse_model("first_order_lag"), JointDynamics::Model::FIRST_ORDER_LAG);
+  EXPECT_EQ(JointDynamics::parse_model("second_order"), JointDynamics::Model::SECOND_ORDER);
+  EXPECT_THROW(JointDynamics::parse_model("euler"), std::invalid_argument);
+
+  JointDynamics dynamics;
+  JointDynamics::Parameters parameters;
+  parameters.time_constant = -1.0;
+  EXPECT_THROW(dynamics.configure(1, parameters), std::invalid_argument);
+  parameters.time_constant = 0.0;
+  parameters.natural_frequency = 0.0;
+  EXPECT_THROW(dynamics.configure(1, parameters), std::invalid_argument);
+}
+
+TEST(TestJointDynamics, ideal_tracking_of_the_commands)
+{
+  JointDynamics dynamics;
+  dynamics.configure(3, JointDynamics::Parameters());
+  dynamics.reset(0, 1.0, NaN, NaN);
+  const std::vector<std::size_t> control_modes = {0, 1, 2};
+
+  dynamics.update(control_modes, {2.0, 0.5, 4.0}, PERIOD);
+  // position controlled: the velocity and acceleration are differentiated
+  EXPECT_DOUBLE_EQ(dynamics.positions()[0], 2.0);
+  EXPECT_DOUBLE_EQ(dynamics.velocities()[0], 100.0);
+  EXPECT_DOUBLE_EQ(dynamics.accelerations()[0], 10000.0);
+  // velocity controlled: the position is integrated with the new velocity
+  EXPECT_DOUBLE_EQ(dynamics.velocities()[1], 0.5);
+  EXPECT_DOUBLE_EQ(dynamics.accelerations()[1], 50.0);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[1], 0.005);
+  // acceleration controlled: semi-implicit Euler integration
+  EXPECT_DOUBLE_EQ(dynamics.accelerations()[2], 4.0);
+  EXPECT_DOUBLE_EQ(dynamics.velocities()[2], 0.04);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[2], 0.0004);
+
+  // NaN commands hold the commanded quantities
+  dynamics.update(control_modes, {NaN, NaN, NaN}, PERIOD);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[0], 2.0);
+  EXPECT_DOUBLE_EQ(dynamics.velocities()[0], 0.0);
+  EXPECT_DOUBLE_EQ(dynamics.velocities()[1], 0.5);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[1], 0.01);
+  EXPECT_DOUBLE_EQ(dynamics.accelerations()[2], 4.0);
+  EXPECT_DOUBLE_EQ(dynamics.velocities()[2], 0.08);
+}
+
+TEST(TestJointDynamics, first_order_lag)
+{
+  JointDynamics dynamics;
+  JointDynamics::Parameters parameters;
+  parameters.time_constant = 0.1;
+  dynamics.configure(1, parameters);
+
+  const std::vector<std::size_t> control_modes = {1};
+  const std::vector<double> commands = {1.0};
+  for (int i = 0; i < 10; ++i)
+  {
+    dynamics.update(control_modes, commands, PERIOD);
+  }
+  // after one time constant the velocity reaches 1 - 1/e of the command
+  EXPECT_NEAR(dynamics.velocities()[0], 1.0 - std::exp(-1.0), 1e-9);
+  EXPECT_GT(dynamics.positions()[0], 0.0);
+  EXPECT_LT(dynamics.positions()[0], 0.1);
+}
+
+TEST(TestJointDynamics, second_order_settles_at_the_command)
+{
+  JointDynamics dynamics;
+  JointDynamics::Parameters parameters;
+  parameters.model = JointDynamics::Model::SECOND_ORDER;
+  parameters.natural_frequency = 20.0;
+  parameters.damping_ratio = 0.7;
+  dynamics.configure(2, parameters);
+
+  const std::vector<std::size_t> control_modes = {0, 0};
+  const std::vector<double> commands = {1.0, -2.0};
+  double max_position = 0.0;
+  for (int i = 0; i < 300; ++i)
+  {
+    dynamics.update(control_modes, commands, PERIOD);
+    max_position = std::max(max_position, dynamics.positions()[0]);
+  }
+  // the underdamped joint overshoots, then settles
+  EXPECT_GT(max_position, 1.0);
+  EXPECT_NEAR(dynamics.positions()[0], 1.0, 1e-6);
+  EXPECT_NEAR(dynamics.positions()[1], -2.0, 1e-6);
+  EXPECT_NEAR(dynamics.velocities()[0], 0.0, 1e-6);
+}
+
+TEST(TestJointDynamics, delayed_commands)
+{
+  JointDynamics dynamics;
+  JointDynamics::Parameters parameters;
+  parameters.command_delay_cycles = 2;
+  dynamics.configure(1, parameters);
+
+  const std::vector<std::size_t> control_modes = {0};
+  dynamics.update(control_modes, {1.0}, PERIOD);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[0], 0.0);
+  dynamics.update(control_modes, {2.0}, PERIOD);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[0], 0.0);
+  dynamics.update(control_modes, {3.0}, PERIOD);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[0], 1.0);
+  dynamics.update(control_modes, {4.0}, PERIOD);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[0], 2.0);
+
+  // a period that isn't positive only shifts the commands
+  dynamics.update(control_modes, {5.0}, 0.0);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[0], 2.0);
+  dynamics.update(control_modes, {6.0}, PERIOD);
+  EXPECT_DOUBLE_EQ(dynamics.positions()[0], 4.0);
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mock_components/replay_log.hpp"
+
+using mock_components::ReplayLog;
+using testing::ElementsAre;
+
+class TestReplayLog : public ::testing::Test
+{
+protected:
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  const std::string path_ = "test_replay_log_" + std::to_string(getpid()) + ".bin";
+};
+
+TEST_F(TestReplayLog, save_and_load)
+{
+  ReplayLog log({"joint1/position", "joint1/velocity"}, {"joint1/position"});
+  log.add_record(0, {0.0, 0.0}, {0.1});
+  log.add_record(10000000, {0.1, 10.0}, {0.2});
+  EXPECT_THROW(log.add_record(20000000, {0.2}, {0.3}), std::invalid_argument);
+  ASSERT_EQ(log.size(), 2u);
+  log.save(path_);
+
+  const ReplayLog loaded = ReplayLog::load(path_);
+  EXPECT_THAT(loaded.get_state_names(), ElementsAre("joint1/position", "joint1/velocity"));
+  EXPECT_THAT(loaded.get_command_names(), ElementsAre("joint1/position"));
+  ASSERT_EQ(loaded.size(), 2u);
+  EXPECT_EQ(loaded.get_time(1), 10000000);
+  EXPECT_EQ(loaded.get_states(1)[0], 0.1);
+  EXPECT_EQ(loaded.get_states(1)[1], 10.0);
+  EXPECT_EQ(loaded.get_commands(0)[0], 0.1);
+}
+
+TEST_F(TestReplayLog, invalid_files)
+{
+  EXPECT_THROW(ReplayLog::load(path_ + ".missing"), std::runtime_error);
+
+  {
+    std::ofstream file(path_, std::ios::binary);
+    file << "not a replay log";
+  }
+  EXPECT_THROW(ReplayLog::load(path_), std::runtime_error);
+
+  // a truncated log is detected before its records are allocated
+  ReplayLog log({"joint1/position"}, {});
+  log.add_record(0, {1.0}, {});
+  log.add_record(1, {2.0}, {});
+  log.save(path_);
+  std::string content;
+  {
+    std::ifstream file(path_, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size() - 4));
+  }
+  EXPECT_THROW(ReplayLog::load(path_), std::runtime_error);
+}
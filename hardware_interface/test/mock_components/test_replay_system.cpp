@@ -0,0 +1,172 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/loaned_command_interface.hpp"
+#include "hardware_interface/loaned_state_interface.hpp"
+#include "hardware_interface/resource_manager.hpp"
+#include "hardware_interface/types/lifecycle_state_names.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "mock_components/replay_log.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp_lifecycle/state.hpp"
+#include "ros2_control_test_assets/descriptions.hpp"
+
+namespace
+{
+const auto TIME = rclcpp::Time(0);
+const auto PERIOD = rclcpp::Duration::from_seconds(0.01);
+
+const std::string COMPONENT_NAME = "ReplayHardwareSystem";
+}  // namespace
+
+class TestableResourceManager : public hardware_interface::ResourceManager
+{
+public:
+  explicit TestableResourceManager(rclcpp::Node::SharedPtr node, const std::string & urdf)
+  : hardware_interface::ResourceManager(
+      urdf, node->get_node_clock_interface(), node->get_node_logging_interface(), false, 100)
+  {
+  }
+};
+
+class TestReplaySystem : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // records every 10 ms, the position command leads the position state by one record
+    mock_components::ReplayLog log(
+      {"joint1/position", "joint1/velocity", "flange_vacuum/vacuum"}, {"joint1/position"});
+    for (int i = 0; i < 5; ++i)
+    {
+      log.add_record(
+        i * 10000000, {0.1 * i, 10.0, static_cast<double>(i % 2)}, {0.1 * (i + 1)});
+    }
+    log.save(log_file_);
+  }
+
+  void TearDown() override { std::remove(log_file_.c_str()); }
+
+  std::string make_urdf(const std::string & playback_speed, const std::string & loop)
+  {
+    return ros2_control_test_assets::urdf_head +
+           R"(
+  <ros2_control name=")" +
+           COMPONENT_NAME + R"(" type="system">
+    <hardware>
+      <plugin>mock_components/ReplaySystem</plugin>
+      <param name="log_file">)" +
+           log_file_ + R"(</param>
+      <param name="playback_speed">)" +
+           playback_speed + R"(</param>
+      <param name="loop">)" +
+           loop + R"(</param>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="position"/>
+      <state_interface name="position"/>
+      <state_interface name="velocity"/>
+    </joint>
+    <gpio name="flange_vacuum">
+      <state_interface name="vacuum" data_type="bool"/>
+    </gpio>
+  </ros2_control>
+)" + ros2_control_test_assets::urdf_tail;
+  }
+
+  void activate(TestableResourceManager & rm)
+  {
+    rclcpp_lifecycle::State state(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+      hardware_interface::lifecycle_state_names::ACTIVE);
+    rm.set_component_state(COMPONENT_NAME, state);
+  }
+
+  rclcpp::Node::SharedPtr node_ = std::make_shared<rclcpp::Node>("TestReplaySystem");
+  const std::string log_file_ = "test_replay_system_" + std::to_string(getpid()) + ".bin";
+};
+
+TEST_F(TestReplaySystem, replay_in_real_time)
+{
+  TestableResourceManager rm(node_, make_urdf("1.0", "false"));
+  activate(rm);
+  auto status_map = rm.get_components_status();
+  ASSERT_EQ(
+    status_map[COMPONENT_NAME].state.id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  hardware_interface::LoanedStateInterface j1p_s = rm.claim_state_interface("joint1/position");
+  hardware_interface::LoanedStateInterface vacuum_s =
+    rm.claim_state_interface("flange_vacuum/vacuum");
+  hardware_interface::LoanedCommandInterface j1p_c = rm.claim_command_interface("joint1/position");
+  // the first record is applied on activation
+  EXPECT_EQ(0.0, j1p_s.get_optional().value());
+  EXPECT_FALSE(vacuum_s.get_optional<bool>().value());
+
+  ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  EXPECT_DOUBLE_EQ(0.1, j1p_s.get_optional().value());
+  EXPECT_TRUE(vacuum_s.get_optional<bool>().value());
+  ASSERT_TRUE(j1p_c.set_value(0.2));
+  ASSERT_EQ(rm.write(TIME, PERIOD).result, hardware_interface::return_type::OK);
+
+  // two periods advance two records, the end of the log is held
+  ASSERT_EQ(rm.read(TIME, PERIOD * 2.0).result, hardware_interface::return_type::OK);
+  EXPECT_DOUBLE_EQ(0.3, j1p_s.get_optional().value());
+  ASSERT_EQ(rm.read(TIME, PERIOD * 5.0).result, hardware_interface::return_type::OK);
+  EXPECT_DOUBLE_EQ(0.4, j1p_s.get_optional().value());
+}
+
+TEST_F(TestReplaySystem, replay_a_record_per_cycle_in_a_loop)
+{
+  TestableResourceManager rm(node_, make_urdf("0.0", "true"));
+  activate(rm);
+
+  hardware_interface::LoanedStateInterface j1p_s = rm.claim_state_interface("joint1/position");
+  // the first read replays the first record, every read the next one independently of the period
+  const std::vector<double> expected_positions = {0.0, 0.1, 0.2, 0.3, 0.4, 0.0, 0.1};
+  for (const double expected_position : expected_positions)
+  {
+    ASSERT_EQ(
+      rm.read(TIME, rclcpp::Duration::from_seconds(1.0)).result,
+      hardware_interface::return_type::OK);
+    EXPECT_DOUBLE_EQ(expected_position, j1p_s.get_optional().value());
+  }
+}
+
+TEST_F(TestReplaySystem, missing_state_interface_fails_configuration)
+{
+  mock_components::ReplayLog log({"joint1/position"}, {});
+  log.add_record(0, {0.0}, {});
+  log.save(log_file_);
+
+  TestableResourceManager rm(node_, make_urdf("1.0", "false"));
+  activate(rm);
+  auto status_map = rm.get_components_status();
+  EXPECT_NE(
+    status_map[COMPONENT_NAME].state.id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
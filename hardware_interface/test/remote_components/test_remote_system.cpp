@@ -0,0 +1,176 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/loaned_command_interface.hpp"
+#include "hardware_interface/loaned_state_interface.hpp"
+#include "hardware_interface/resource_manager.hpp"
+#include "hardware_interface/types/lifecycle_state_names.hpp"
+#include "hardware_interface/udp_interface_link.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp_lifecycle/state.hpp"
+#include "ros2_control_test_assets/descriptions.hpp"
+
+using testing::ElementsAre;
+
+namespace
+{
+const auto TIME = rclcpp::Time(0);
+const auto PERIOD = rclcpp::Duration::from_seconds(0.01);
+
+const std::string COMPONENT_NAME = "RemoteHardwareSystem";
+}  // namespace
+
+class TestableResourceManager : public hardware_interface::ResourceManager
+{
+public:
+  explicit TestableResourceManager(rclcpp::Node::SharedPtr node, const std::string & urdf)
+  : hardware_interface::ResourceManager(
+      urdf, node->get_node_clock_interface(), node->get_node_logging_interface(), false, 100)
+  {
+  }
+};
+
+class TestRemoteSystem : public ::testing::Test
+{
+protected:
+  std::string make_urdf(const std::string & connection_timeout_ms)
+  {
+    return ros2_control_test_assets::urdf_head +
+           R"(
+  <ros2_control name=")" +
+           COMPONENT_NAME + R"(" type="system">
+    <hardware>
+      <plugin>remote_components/RemoteSystem</plugin>
+      <param name="remote_address">127.0.0.1</param>
+      <param name="remote_port">)" +
+           std::to_string(remote_port_) + R"(</param>
+      <param name="local_port">)" +
+           std::to_string(local_port_) + R"(</param>
+      <param name="read_deadline_us">1000</param>
+      <param name="max_missed_deadlines">2</param>
+      <param name="connection_timeout_ms">)" +
+           connection_timeout_ms + R"(</param>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="position"/>
+      <state_interface name="position"/>
+      <state_interface name="velocity"/>
+    </joint>
+  </ros2_control>
+)" + ros2_control_test_assets::urdf_tail;
+  }
+
+  // plays the remote controller manager, exporting the interfaces of the component
+  void open_remote()
+  {
+    remote_.open(
+      remote_port_, "127.0.0.1", local_port_, {"joint1/position", "joint1/velocity"},
+      {"joint1/position"});
+  }
+
+  void set_component_state(
+    TestableResourceManager & rm, const uint8_t state_id, const std::string & state_name)
+  {
+    rclcpp_lifecycle::State state(state_id, state_name);
+    rm.set_component_state(COMPONENT_NAME, state);
+  }
+
+  rclcpp::Node::SharedPtr node_ = std::make_shared<rclcpp::Node>("TestRemoteSystem");
+  // the ports depend on the process, so that parallel test runs don't interfere
+  uint16_t local_port_ = static_cast<uint16_t>(40000 + (getpid() % 10000) * 2);
+  uint16_t remote_port_ = static_cast<uint16_t>(local_port_ + 1);
+  hardware_interface::UdpInterfaceLink remote_;
+};
+
+TEST_F(TestRemoteSystem, exchange_with_remote_controller_manager)
+{
+  TestableResourceManager rm(node_, make_urdf("1000"));
+  set_component_state(
+    rm, lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    hardware_interface::lifecycle_state_names::INACTIVE);
+
+  open_remote();
+  ASSERT_TRUE(remote_.send({0.5, 0.0}, 1));
+  set_component_state(
+    rm, lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    hardware_interface::lifecycle_state_names::ACTIVE);
+  auto status_map = rm.get_components_status();
+  ASSERT_EQ(
+    status_map[COMPONENT_NAME].state.id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  hardware_interface::LoanedStateInterface j1p_s = rm.claim_state_interface("joint1/position");
+  hardware_interface::LoanedStateInterface j1v_s = rm.claim_state_interface("joint1/velocity");
+  hardware_interface::LoanedCommandInterface j1p_c = rm.claim_command_interface("joint1/position");
+  // the first frame of the remote side is applied on activation
+  EXPECT_EQ(0.5, j1p_s.get_optional().value());
+
+  ASSERT_TRUE(j1p_c.set_value(0.75));
+  ASSERT_EQ(rm.write(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  std::vector<double> commands;
+  int64_t stamp_ns = 0;
+  ASSERT_TRUE(remote_.receive(commands, stamp_ns, 0, std::chrono::seconds(1)));
+  EXPECT_THAT(commands, ElementsAre(0.75));
+
+  ASSERT_TRUE(remote_.send({0.75, 2.5}, 2));
+  ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  EXPECT_EQ(0.75, j1p_s.get_optional().value());
+  EXPECT_EQ(2.5, j1v_s.get_optional().value());
+}
+
+TEST_F(TestRemoteSystem, missed_read_deadlines_return_error)
+{
+  TestableResourceManager rm(node_, make_urdf("1000"));
+  // the socket of the component is opened when it is configured
+  set_component_state(
+    rm, lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    hardware_interface::lifecycle_state_names::INACTIVE);
+  open_remote();
+  ASSERT_TRUE(remote_.send({0.5, 0.0}, 1));
+  set_component_state(
+    rm, lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    hardware_interface::lifecycle_state_names::ACTIVE);
+
+  // the remote side doesn't send new frames anymore, max_missed_deadlines is 2
+  ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  auto result = rm.read(TIME, PERIOD);
+  ASSERT_EQ(result.result, hardware_interface::return_type::ERROR);
+  EXPECT_THAT(result.failed_hardware_names, ElementsAre(COMPONENT_NAME));
+}
+
+TEST_F(TestRemoteSystem, activation_fails_without_remote_controller_manager)
+{
+  TestableResourceManager rm(node_, make_urdf("10"));
+  set_component_state(
+    rm, lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    hardware_interface::lifecycle_state_names::ACTIVE);
+  auto status_map = rm.get_components_status();
+  EXPECT_NE(
+    status_map[COMPONENT_NAME].state.id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
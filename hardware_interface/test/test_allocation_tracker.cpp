@@ -0,0 +1,98 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/allocation_hook.hpp"
+#include "hardware_interface/allocation_tracker.hpp"
+
+using hardware_interface::AllocationTracker;
+
+// the same hook as the one of the ros2_control_node
+HARDWARE_INTERFACE_DEFINE_ALLOCATION_HOOK();
+
+TEST(TestAllocationTracker, counts_only_while_enabled)
+{
+  AllocationTracker::set_hook_installed();
+  EXPECT_TRUE(AllocationTracker::is_hook_installed());
+  EXPECT_FALSE(AllocationTracker::is_tracking_enabled());
+
+  const auto initial_count = AllocationTracker::get_allocation_count();
+  auto untracked = std::make_unique<double>(1.0);
+  EXPECT_EQ(initial_count, AllocationTracker::get_allocation_count());
+
+  AllocationTracker::set_tracking_enabled(true);
+  EXPECT_TRUE(AllocationTracker::is_tracking_enabled());
+  auto tracked = std::make_unique<double>(2.0);
+  std::vector<int> vec(10, 0);
+  EXPECT_EQ(initial_count + 2u, AllocationTracker::get_allocation_count());
+
+  // no allocation, no count
+  vec[0] = 1;
+  *tracked += *untracked;
+  EXPECT_EQ(initial_count + 2u, AllocationTracker::get_allocation_count());
+
+  AllocationTracker::set_tracking_enabled(false);
+  auto untracked_again = std::make_unique<double>(3.0);
+  EXPECT_EQ(initial_count + 2u, AllocationTracker::get_allocation_count());
+}
+
+TEST(TestAllocationTracker, counts_per_thread)
+{
+  AllocationTracker::set_tracking_enabled(true);
+  const auto initial_count = AllocationTracker::get_allocation_count();
+
+  uint64_t other_thread_count = 0;
+  std::thread other_thread(
+    [&other_thread_count]()
+    {
+      // the tracking is disabled by default in the new thread
+      auto untracked = std::make_unique<double>(1.0);
+      AllocationTracker::set_tracking_enabled(true);
+      auto tracked = std::make_unique<double>(2.0);
+      other_thread_count = AllocationTracker::get_allocation_count();
+    });
+  other_thread.join();
+  EXPECT_EQ(1u, other_thread_count);
+
+  auto tracked = std::make_unique<double>(1.0);
+  // allocations of the std::thread itself are also counted
+  EXPECT_LE(initial_count + 1u, AllocationTracker::get_allocation_count());
+  AllocationTracker::set_tracking_enabled(false);
+}
+
+TEST(TestAllocationTracker, counts_the_array_aligned_and_nothrow_allocations)
+{
+  struct alignas(64) CacheLine
+  {
+    double values[8];
+  };
+  AllocationTracker::set_tracking_enabled(true);
+  const auto initial_count = AllocationTracker::get_allocation_count();
+
+  auto array = std::make_unique<double[]>(16);
+  auto aligned = std::make_unique<CacheLine>();
+  auto aligned_array = std::make_unique<CacheLine[]>(4);
+  std::unique_ptr<double> nothrow(new (std::nothrow) double(1.0));
+  EXPECT_EQ(initial_count + 4u, AllocationTracker::get_allocation_count());
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(aligned.get()) % alignof(CacheLine));
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(aligned_array.get()) % alignof(CacheLine));
+  AllocationTracker::set_tracking_enabled(false);
+}
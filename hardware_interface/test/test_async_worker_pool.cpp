@@ -0,0 +1,176 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "hardware_interface/async_worker_pool.hpp"
+
+using hardware_interface::AsyncWorkerPool;
+using hardware_interface::AsyncWorkerPoolParams;
+
+namespace
+{
+const auto kPeriod = rclcpp::Duration::from_nanoseconds(1000000);
+
+std::shared_ptr<AsyncWorkerPool> make_pool(unsigned int number_of_workers, std::size_t max_tasks)
+{
+  AsyncWorkerPoolParams params;
+  params.number_of_workers = number_of_workers;
+  params.max_tasks = max_tasks;
+  return std::make_shared<AsyncWorkerPool>(params);
+}
+}  // namespace
+
+TEST(TestAsyncWorkerPool, no_tasks_without_workers)
+{
+  auto pool = make_pool(0, 4);
+  EXPECT_EQ(pool->get_number_of_workers(), 0u);
+  EXPECT_EQ(pool->add_task([](const rclcpp::Time &, const rclcpp::Duration &) {}), nullptr);
+}
+
+TEST(TestAsyncWorkerPool, trigger_fails_while_the_previous_cycle_runs)
+{
+  auto pool = make_pool(2, 4);
+  std::atomic_bool release{false};
+  std::atomic_int cycles{0};
+  auto task = pool->add_task(
+    [&](const rclcpp::Time &, const rclcpp::Duration &)
+    {
+      while (!release)
+      {
+        std::this_thread::yield();
+      }
+      cycles++;
+    });
+  ASSERT_NE(task, nullptr);
+  EXPECT_TRUE(task->is_idle());
+
+  EXPECT_TRUE(task->trigger(rclcpp::Time(1), kPeriod));
+  EXPECT_FALSE(task->trigger(rclcpp::Time(2), kPeriod));
+  EXPECT_EQ(task->get_current_callback_time().nanoseconds(), 1);
+  release = true;
+  task->wait_until_idle();
+  EXPECT_EQ(cycles, 1);
+
+  EXPECT_TRUE(task->trigger(rclcpp::Time(3), kPeriod));
+  task->wait_until_idle();
+  EXPECT_EQ(cycles, 2);
+  pool->remove_task(task);
+}
+
+TEST(TestAsyncWorkerPool, executes_more_tasks_than_workers)
+{
+  auto pool = make_pool(2, 16);
+  std::vector<std::atomic_int> cycles(10);
+  std::vector<std::shared_ptr<AsyncWorkerPool::Task>> tasks;
+  for (std::size_t i = 0; i < cycles.size(); ++i)
+  {
+    tasks.push_back(pool->add_task(
+      [&cycles, i](const rclcpp::Time &, const rclcpp::Duration &) { cycles[i]++; }));
+    ASSERT_NE(tasks.back(), nullptr);
+    EXPECT_EQ(tasks.back()->get_home_worker(), i % 2);
+  }
+  for (int cycle = 0; cycle < 100; ++cycle)
+  {
+    for (auto & task : tasks)
+    {
+      ASSERT_TRUE(task->trigger(rclcpp::Time(cycle), kPeriod));
+    }
+    for (auto & task : tasks)
+    {
+      task->wait_until_idle();
+    }
+  }
+  for (const auto & count : cycles)
+  {
+    EXPECT_EQ(count, 100);
+  }
+  for (auto & task : tasks)
+  {
+    pool->remove_task(task);
+  }
+}
+
+TEST(TestAsyncWorkerPool, idle_workers_execute_the_tasks_of_a_busy_worker)
+{
+  auto pool = make_pool(2, 4);
+  std::atomic_bool release{false};
+  std::atomic_int cycles{0};
+  auto blocking_task = pool->add_task(
+    [&](const rclcpp::Time &, const rclcpp::Duration &)
+    {
+      while (!release)
+      {
+        std::this_thread::yield();
+      }
+    });
+  auto other_task = pool->add_task([](const rclcpp::Time &, const rclcpp::Duration &) {});
+  auto task = pool->add_task([&](const rclcpp::Time &, const rclcpp::Duration &) { cycles++; });
+  ASSERT_NE(task, nullptr);
+  ASSERT_EQ(task->get_home_worker(), blocking_task->get_home_worker());
+
+  ASSERT_TRUE(blocking_task->trigger(rclcpp::Time(1), kPeriod));
+  // no wake-up is lost while the home worker of the task is busy
+  for (int cycle = 0; cycle < 1000; ++cycle)
+  {
+    ASSERT_TRUE(task->trigger(rclcpp::Time(cycle), kPeriod));
+    task->wait_until_idle();
+  }
+  EXPECT_EQ(cycles, 1000);
+  release = true;
+  blocking_task->wait_until_idle();
+  pool->remove_task(blocking_task);
+  pool->remove_task(other_task);
+  pool->remove_task(task);
+}
+
+TEST(TestAsyncWorkerPool, removed_tasks_are_reused)
+{
+  auto pool = make_pool(1, 1);
+  auto callback = [](const rclcpp::Time &, const rclcpp::Duration &) {};
+  auto task = pool->add_task(callback);
+  ASSERT_NE(task, nullptr);
+  EXPECT_EQ(pool->add_task(callback), nullptr);
+
+  // a pending cycle is dropped
+  std::ignore = task->trigger(rclcpp::Time(1), kPeriod);
+  pool->remove_task(task);
+  auto new_task = pool->add_task(callback);
+  ASSERT_NE(new_task, nullptr);
+  EXPECT_TRUE(new_task->trigger(rclcpp::Time(2), kPeriod));
+  new_task->wait_until_idle();
+  pool->remove_task(new_task);
+}
+
+TEST(TestAsyncWorkerPool, exceptions_are_caught)
+{
+  auto pool = make_pool(1, 2);
+  auto task = pool->add_task(
+    [](const rclcpp::Time &, const rclcpp::Duration &) { throw std::runtime_error("failure"); });
+  ASSERT_NE(task, nullptr);
+  EXPECT_TRUE(task->trigger(rclcpp::Time(1), kPeriod));
+  task->wait_until_idle();
+  EXPECT_TRUE(task->trigger(rclcpp::Time(2), kPeriod));
+  task->wait_until_idle();
+  pool->remove_task(task);
+}
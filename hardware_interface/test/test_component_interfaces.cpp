@@ -769,6 +769,90 @@ class DummySystemPreparePerform : public hardware_interface::SystemInterface
   }
 };
 
+class DummySystemCommandChanges : public hardware_interface::SystemInterface
+{
+public:
+  CallbackReturn on_configure(const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    enable_command_change_tracking();
+    return CallbackReturn::SUCCESS;
+  }
+
+  hardware_interface::return_type read(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    return hardware_interface::return_type::OK;
+  }
+
+  hardware_interface::return_type write(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    written_commands_ = get_changed_command_interfaces();
+    return hardware_interface::return_type::OK;
+  }
+
+  std::vector<std::size_t> written_commands_;
+};
+
+class DummySystemExchange : public hardware_interface::SystemInterface
+{
+public:
+  CallbackReturn on_configure(const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    enable_exchange();
+    return CallbackReturn::SUCCESS;
+  }
+
+  hardware_interface::return_type read(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    ++reads_;
+    return hardware_interface::return_type::OK;
+  }
+
+  hardware_interface::return_type write(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    ++writes_;
+    return hardware_interface::return_type::OK;
+  }
+
+  hardware_interface::return_type exchange(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    ++exchanges_;
+    return hardware_interface::return_type::OK;
+  }
+
+  std::size_t reads_ = 0;
+  std::size_t writes_ = 0;
+  std::size_t exchanges_ = 0;
+};
+
+class DummySystemEdgeEvents : public hardware_interface::SystemInterface
+{
+public:
+  CallbackReturn on_configure(const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    enable_edge_events(2);
+    return CallbackReturn::SUCCESS;
+  }
+
+  hardware_interface::return_type read(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    return hardware_interface::return_type::OK;
+  }
+
+  hardware_interface::return_type write(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    return hardware_interface::return_type::OK;
+  }
+
+  using hardware_interface::SystemInterface::push_edge_event;
+};
+
 }  // namespace test_components
 class TestComponentInterfaces : public ::testing::Test
 {
@@ -1519,6 +1603,230 @@ TEST_F(TestComponentInterfaces, dummy_system_default)
   EXPECT_EQ(hardware_interface::return_type::OK, system_hw.perform_command_mode_switch({}, {}));
 }
 
+TEST_F(TestComponentInterfaces, dummy_system_default_access_by_index)
+{
+  auto dummy_system_hw = std::make_unique<test_components::DummySystemDefault>();
+  auto * const dummy_system_ptr = dummy_system_hw.get();
+  hardware_interface::System system_hw(std::move(dummy_system_hw));
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  params.executor = executor_;
+  system_hw.initialize(params);
+
+  auto state_interfaces = system_hw.export_state_interfaces();
+  auto command_interfaces = system_hw.export_command_interfaces();
+  ASSERT_EQ(6u, state_interfaces.size());
+  ASSERT_EQ(3u, command_interfaces.size());
+
+  // the indices refer to the same handles as the names
+  const auto position_indices = dummy_system_ptr->get_state_interface_indices(
+    {"joint1/position", "joint2/position", "joint3/position"});
+  ASSERT_EQ(3u, position_indices.size());
+  for (size_t i = 0; i < position_indices.size(); ++i)
+  {
+    const auto name = "joint" + std::to_string(i + 1) + "/position";
+    EXPECT_EQ(position_indices[i], dummy_system_ptr->get_state_interface_index(name));
+    EXPECT_EQ(
+      name, dummy_system_ptr->get_state_interface_handle(position_indices[i])->get_name());
+  }
+  EXPECT_THROW(
+    dummy_system_ptr->get_state_interface_index("joint1/nonexisting/interface"),
+    std::runtime_error);
+  EXPECT_THROW(
+    dummy_system_ptr->get_command_interface_indices({"joint1/velocity", "joint1/nonexisting"}),
+    std::runtime_error);
+
+  EXPECT_TRUE(dummy_system_ptr->set_state(position_indices[1], 2.0));
+  EXPECT_EQ(2.0, dummy_system_ptr->get_state<double>("joint2/position"));
+  double position = 0.0;
+  EXPECT_TRUE(dummy_system_ptr->get_state(position_indices[1], position));
+  EXPECT_EQ(2.0, position);
+
+  EXPECT_TRUE(dummy_system_ptr->set_states(position_indices, {1.0, 2.0, 3.0}));
+  EXPECT_EQ(3.0, dummy_system_ptr->get_state<double>("joint3/position"));
+  EXPECT_FALSE(dummy_system_ptr->set_states(position_indices, {1.0}));
+  EXPECT_EQ(1.0, dummy_system_ptr->get_state<double>("joint1/position"));
+
+  const auto velocity_index = dummy_system_ptr->get_command_interface_index("joint2/velocity");
+  EXPECT_TRUE(dummy_system_ptr->set_command(velocity_index, 0.5));
+  EXPECT_EQ(0.5, dummy_system_ptr->get_command<double>("joint2/velocity"));
+  double velocity = 0.0;
+  EXPECT_TRUE(dummy_system_ptr->get_command(velocity_index, velocity));
+  EXPECT_EQ(0.5, velocity);
+
+  const auto velocity_indices = dummy_system_ptr->get_command_interface_indices(
+    {"joint3/velocity", "joint2/velocity", "joint1/velocity"});
+  dummy_system_ptr->set_command("joint3/velocity", 0.3);
+  dummy_system_ptr->set_command("joint1/velocity", 0.1);
+  std::vector<double> velocities;
+  EXPECT_TRUE(dummy_system_ptr->get_commands(velocity_indices, velocities));
+  EXPECT_THAT(velocities, ::testing::ElementsAre(0.3, 0.5, 0.1));
+}
+
+TEST_F(TestComponentInterfaces, dummy_system_writes_only_the_changed_commands)
+{
+  auto dummy_system_hw = std::make_unique<test_components::DummySystemCommandChanges>();
+  auto * const dummy_system_ptr = dummy_system_hw.get();
+  hardware_interface::System system_hw(std::move(dummy_system_hw));
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  params.executor = executor_;
+  system_hw.initialize(params);
+  auto state_interfaces = system_hw.export_state_interfaces();
+  auto command_interfaces = system_hw.export_command_interfaces();
+  ASSERT_EQ(3u, command_interfaces.size());
+  EXPECT_FALSE(dummy_system_ptr->is_command_change_tracking_enabled());
+
+  auto state = system_hw.configure();
+  ASSERT_EQ(lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, state.id());
+  EXPECT_TRUE(dummy_system_ptr->is_command_change_tracking_enabled());
+  state = system_hw.activate();
+  ASSERT_EQ(lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, state.id());
+
+  // all the commands are written at the first write after the activation
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(TIME, PERIOD));
+  EXPECT_THAT(dummy_system_ptr->written_commands_, ElementsAre(0u, 1u, 2u));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(TIME, PERIOD));
+  EXPECT_THAT(dummy_system_ptr->written_commands_, IsEmpty());
+
+  const auto velocity_index = dummy_system_ptr->get_command_interface_index("joint2/velocity");
+  EXPECT_TRUE(dummy_system_ptr->set_command(velocity_index, 0.5));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(TIME, PERIOD));
+  EXPECT_THAT(dummy_system_ptr->written_commands_, ElementsAre(velocity_index));
+  // setting the same value again isn't a change
+  EXPECT_TRUE(dummy_system_ptr->set_command(velocity_index, 0.5));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(TIME, PERIOD));
+  EXPECT_THAT(dummy_system_ptr->written_commands_, IsEmpty());
+
+  // the fraction of the changed commands is added to the write statistics
+  const auto & changed_command_ratio = *system_hw.get_write_statistics().changed_command_ratio;
+  EXPECT_EQ(4u, changed_command_ratio.get_count());
+  EXPECT_NEAR((1.0 + 1.0 / 3.0) / 4.0, changed_command_ratio.get_average(), 1e-9);
+}
+
+TEST_F(TestComponentInterfaces, dummy_system_edge_events)
+{
+  auto dummy_system_hw = std::make_unique<test_components::DummySystemEdgeEvents>();
+  auto * const dummy_system_ptr = dummy_system_hw.get();
+  hardware_interface::System system_hw(std::move(dummy_system_hw));
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  params.executor = executor_;
+  system_hw.initialize(params);
+  auto state_interfaces = system_hw.export_state_interfaces();
+  auto command_interfaces = system_hw.export_command_interfaces();
+  const auto position_index = dummy_system_ptr->get_state_interface_index("joint1/position");
+
+  hardware_interface::EdgeEventList events(8);
+  // the edge events are only queued once enabled
+  EXPECT_FALSE(dummy_system_ptr->push_edge_event(position_index, true, 10));
+  EXPECT_EQ(0u, system_hw.drain_edge_events(events));
+
+  ASSERT_EQ(lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, system_hw.configure().id());
+  EXPECT_TRUE(dummy_system_ptr->push_edge_event(position_index, true, 20));
+  EXPECT_TRUE(dummy_system_ptr->push_edge_event(position_index, false, 30));
+  EXPECT_FALSE(dummy_system_ptr->push_edge_event(position_index, true, 40));
+  EXPECT_FALSE(dummy_system_ptr->push_edge_event(state_interfaces.size(), true, 50));
+
+  EXPECT_EQ(2u, system_hw.drain_edge_events(events));
+  ASSERT_EQ(2u, events.size());
+  EXPECT_EQ(hardware_interface::NamePool::find("joint1/position"), events[0].interface_id);
+  EXPECT_TRUE(events[0].value);
+  EXPECT_EQ(20, events[0].stamp);
+  EXPECT_FALSE(events[1].value);
+  EXPECT_EQ(30, events[1].stamp);
+  EXPECT_EQ(1u, events.get_dropped_events());
+
+  // the dropped events are reported once
+  events.clear();
+  EXPECT_EQ(0u, system_hw.drain_edge_events(events));
+  EXPECT_EQ(0u, events.get_dropped_events());
+}
+
+TEST_F(TestComponentInterfaces, dummy_system_exchange)
+{
+  auto dummy_system_hw = std::make_unique<test_components::DummySystemExchange>();
+  auto * const dummy_system_ptr = dummy_system_hw.get();
+  hardware_interface::System system_hw(std::move(dummy_system_hw));
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  params.executor = executor_;
+  system_hw.initialize(params);
+  system_hw.export_state_interfaces();
+  system_hw.export_command_interfaces();
+  EXPECT_FALSE(dummy_system_ptr->is_exchange_enabled());
+
+  auto state = system_hw.configure();
+  ASSERT_EQ(lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, state.id());
+  EXPECT_TRUE(dummy_system_ptr->is_exchange_enabled());
+  state = system_hw.activate();
+  ASSERT_EQ(lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, state.id());
+
+  // the states are read until the controllers updated the commands
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(TIME, PERIOD));
+  EXPECT_EQ(1u, dummy_system_ptr->reads_);
+  EXPECT_EQ(0u, dummy_system_ptr->exchanges_);
+  // the commands are sent by the exchange of the next read
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(TIME, PERIOD));
+  EXPECT_EQ(0u, dummy_system_ptr->writes_);
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(TIME, PERIOD));
+  EXPECT_EQ(1u, dummy_system_ptr->reads_);
+  EXPECT_EQ(1u, dummy_system_ptr->exchanges_);
+  // the commands are only exchanged once
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(TIME, PERIOD));
+  EXPECT_EQ(2u, dummy_system_ptr->reads_);
+  EXPECT_EQ(1u, dummy_system_ptr->exchanges_);
+
+  // the commands of the last cycle before the deactivation aren't sent
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(TIME, PERIOD));
+  state = system_hw.deactivate();
+  ASSERT_EQ(lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, state.id());
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(TIME, PERIOD));
+  EXPECT_EQ(3u, dummy_system_ptr->reads_);
+  EXPECT_EQ(1u, dummy_system_ptr->exchanges_);
+  EXPECT_EQ(0u, dummy_system_ptr->writes_);
+}
+
 TEST_F(TestComponentInterfaces, dummy_command_mode_system)
 {
   hardware_interface::System system_hw(
@@ -36,6 +36,7 @@ using hardware_interface::HW_IF_ACCELERATION;
 using hardware_interface::HW_IF_EFFORT;
 using hardware_interface::HW_IF_POSITION;
 using hardware_interface::HW_IF_VELOCITY;
+using hardware_interface::extract_control_resources_description;
 using hardware_interface::parse_control_resources_from_urdf;
 
 TEST_F(TestComponentParser, empty_string_throws_error)
@@ -467,6 +468,57 @@ TEST_F(TestComponentParser, successfully_parse_valid_urdf_system_robot_with_exte
   ASSERT_THAT(hardware_info.soft_limits, SizeIs(0));
 }
 
+TEST_F(TestComponentParser, parse_resource_namespace)
+{
+  auto make_urdf = [](const std::string & resource_namespace)
+  {
+    std::string description =
+      ros2_control_test_assets::valid_urdf_ros2_control_actuator_modular_robot;
+    const std::string group_tag = "<group>Hardware Group</group>";
+    description.insert(
+      description.find(group_tag) + group_tag.size(),
+      "<resource_namespace>" + resource_namespace + "</resource_namespace>");
+    return std::string(ros2_control_test_assets::urdf_head) + description +
+           ros2_control_test_assets::urdf_tail;
+  };
+  const auto control_hardware = parse_control_resources_from_urdf(make_urdf("cell_1/arm"));
+  ASSERT_THAT(control_hardware, SizeIs(2));
+  EXPECT_EQ(control_hardware[0].resource_namespace, "cell_1/arm");
+  EXPECT_THAT(control_hardware[1].resource_namespace, IsEmpty());
+
+  for (const auto & invalid_namespace : {"/cell_1", "cell_1/", "cell_1//arm"})
+  {
+    EXPECT_THROW(
+      parse_control_resources_from_urdf(make_urdf(invalid_namespace)), std::runtime_error);
+  }
+}
+
+TEST_F(TestComponentParser, parse_hardware_bus)
+{
+  auto make_urdf = [](const std::string & bus_tag)
+  {
+    std::string description =
+      ros2_control_test_assets::valid_urdf_ros2_control_actuator_modular_robot;
+    const std::string group_tag = "<group>Hardware Group</group>";
+    description.insert(description.find(group_tag) + group_tag.size(), bus_tag);
+    return std::string(ros2_control_test_assets::urdf_head) + description +
+           ros2_control_test_assets::urdf_tail;
+  };
+  const auto control_hardware = parse_control_resources_from_urdf(
+    make_urdf("<bus plugin=\"test_bus/TestBus\">ethercat0</bus>"));
+  ASSERT_THAT(control_hardware, SizeIs(2));
+  EXPECT_EQ(control_hardware[0].bus, "ethercat0");
+  EXPECT_EQ(control_hardware[0].bus_plugin_name, "test_bus/TestBus");
+  EXPECT_THAT(control_hardware[1].bus, IsEmpty());
+
+  // the plugin can be given by another member of the bus
+  const auto member_hardware = parse_control_resources_from_urdf(make_urdf("<bus>ethercat0</bus>"));
+  EXPECT_EQ(member_hardware[0].bus, "ethercat0");
+  EXPECT_THAT(member_hardware[0].bus_plugin_name, IsEmpty());
+
+  EXPECT_THROW(parse_control_resources_from_urdf(make_urdf("<bus></bus>")), std::runtime_error);
+}
+
 TEST_F(TestComponentParser, successfully_parse_valid_urdf_actuator_modular_robot)
 {
   std::string urdf_to_test =
@@ -1493,6 +1545,23 @@ TEST_F(TestComponentParser, successfully_parse_valid_urdf_async_components)
   ASSERT_EQ(1u, hardware_info.async_params.cpu_affinity_cores.size());
   ASSERT_THAT(
     hardware_info.async_params.cpu_affinity_cores, testing::ContainerEq(std::vector<int>({1})));
+  // when not set, the component runs in the default async threads
+  EXPECT_THAT(hardware_info.async_params.control_loop, IsEmpty());
+}
+
+TEST_F(TestComponentParser, successfully_parse_async_control_loop)
+{
+  std::string urdf_to_test = ros2_control_test_assets::minimal_async_robot_urdf;
+  const std::string scheduling_policy = "scheduling_policy=\"synchronized\"";
+  urdf_to_test.replace(
+    urdf_to_test.find(scheduling_policy), scheduling_policy.size(),
+    scheduling_policy + " control_loop=\"whole_body\"");
+  std::vector<hardware_interface::HardwareInfo> hw_info;
+  ASSERT_NO_THROW(hw_info = parse_control_resources_from_urdf(urdf_to_test));
+  ASSERT_THAT(hw_info, SizeIs(3));
+  EXPECT_THAT(hw_info[0].async_params.control_loop, IsEmpty());
+  EXPECT_EQ(hw_info[2].name, "TestSystemHardware");
+  EXPECT_EQ(hw_info[2].async_params.control_loop, "whole_body");
 }
 
 TEST_F(TestComponentParser, successfully_parse_parameter_empty)
@@ -1677,6 +1746,112 @@ TEST_F(TestComponentParser, valid_rw_rate)
   ASSERT_THAT(hw_info[2].gpios, SizeIs(1));
   EXPECT_EQ(hw_info[2].gpios[0].name, "configuration");
   EXPECT_EQ(hw_info[2].rw_rate, 25u);
+  // when not set, rw_phase should be -1
+  EXPECT_EQ(hw_info[2].rw_phase, -1);
+}
+
+TEST_F(TestComponentParser, valid_rw_phase)
+{
+  std::string urdf_to_test = ros2_control_test_assets::minimal_robot_urdf_with_different_hw_rw_rate;
+  const std::string rw_rate = "rw_rate=\"50\"";
+  urdf_to_test.replace(urdf_to_test.find(rw_rate), rw_rate.size(), rw_rate + " rw_phase=\"1\"");
+  std::vector<hardware_interface::HardwareInfo> hw_info;
+  ASSERT_NO_THROW(hw_info = parse_control_resources_from_urdf(urdf_to_test));
+  ASSERT_THAT(hw_info, SizeIs(3));
+  EXPECT_EQ(hw_info[0].rw_rate, 50u);
+  EXPECT_EQ(hw_info[0].rw_phase, 1);
+  EXPECT_EQ(hw_info[1].rw_phase, -1);
+
+  urdf_to_test.replace(urdf_to_test.find("rw_phase=\"1\""), 12, "rw_phase=\"-1\"");
+  ASSERT_THROW(parse_control_resources_from_urdf(urdf_to_test), std::runtime_error);
+}
+
+TEST_F(TestComponentParser, valid_time_budget)
+{
+  std::string urdf_to_test = ros2_control_test_assets::minimal_robot_urdf_with_different_hw_rw_rate;
+  const std::string rw_rate = "rw_rate=\"50\"";
+  const std::string time_budget =
+    rw_rate + " time_budget_us=\"250.5\" time_budget_policy=\"skip_next_cycle\"";
+  urdf_to_test.replace(urdf_to_test.find(rw_rate), rw_rate.size(), time_budget);
+  std::vector<hardware_interface::HardwareInfo> hw_info;
+  ASSERT_NO_THROW(hw_info = parse_control_resources_from_urdf(urdf_to_test));
+  ASSERT_THAT(hw_info, SizeIs(3));
+  EXPECT_DOUBLE_EQ(hw_info[0].time_budget_us, 250.5);
+  EXPECT_EQ(hw_info[0].time_budget_policy, hardware_interface::TimeBudgetPolicy::SKIP_NEXT_CYCLE);
+  // when not set, the time budget is disabled
+  EXPECT_DOUBLE_EQ(hw_info[1].time_budget_us, 0.0);
+  EXPECT_EQ(hw_info[1].time_budget_policy, hardware_interface::TimeBudgetPolicy::REPORT);
+
+  std::string invalid_policy = urdf_to_test;
+  invalid_policy.replace(invalid_policy.find("skip_next_cycle"), 15, "async");
+  ASSERT_THROW(parse_control_resources_from_urdf(invalid_policy), std::runtime_error);
+  std::string invalid_budget = urdf_to_test;
+  invalid_budget.replace(invalid_budget.find("250.5"), 5, "-1");
+  ASSERT_THROW(parse_control_resources_from_urdf(invalid_budget), std::runtime_error);
+}
+
+TEST_F(TestComponentParser, valid_statistics_type)
+{
+  std::string urdf_to_test = ros2_control_test_assets::minimal_robot_urdf_with_different_hw_rw_rate;
+  const std::string rw_rate = "rw_rate=\"50\"";
+  const std::string statistics_type = rw_rate + " statistics_type=\"ewma:0.5s\"";
+  urdf_to_test.replace(urdf_to_test.find(rw_rate), rw_rate.size(), statistics_type);
+  std::vector<hardware_interface::HardwareInfo> hw_info;
+  ASSERT_NO_THROW(hw_info = parse_control_resources_from_urdf(urdf_to_test));
+  ASSERT_THAT(hw_info, SizeIs(3));
+  EXPECT_EQ(hw_info[0].statistics_type, "ewma:0.5s");
+  EXPECT_EQ(hw_info[1].statistics_type, "cumulative");
+
+  std::string invalid_type = urdf_to_test;
+  invalid_type.replace(invalid_type.find("ewma:0.5s"), 9, "median:10");
+  ASSERT_THROW(parse_control_resources_from_urdf(invalid_type), std::runtime_error);
+}
+
+TEST_F(TestComponentParser, valid_criticality)
+{
+  std::string urdf_to_test = ros2_control_test_assets::minimal_robot_urdf_with_different_hw_rw_rate;
+  const std::string rw_rate = "rw_rate=\"50\"";
+  const std::string criticality = rw_rate + " criticality=\"auxiliary\"";
+  urdf_to_test.replace(urdf_to_test.find(rw_rate), rw_rate.size(), criticality);
+  std::vector<hardware_interface::HardwareInfo> hw_info;
+  ASSERT_NO_THROW(hw_info = parse_control_resources_from_urdf(urdf_to_test));
+  ASSERT_THAT(hw_info, SizeIs(3));
+  EXPECT_EQ(hw_info[0].criticality, hardware_interface::Criticality::AUXILIARY);
+  EXPECT_EQ(hw_info[1].criticality, hardware_interface::Criticality::CONTROL);
+
+  std::string invalid_criticality = urdf_to_test;
+  invalid_criticality.replace(invalid_criticality.find("auxiliary"), 9, "optional");
+  ASSERT_THROW(parse_control_resources_from_urdf(invalid_criticality), std::runtime_error);
+}
+
+TEST_F(TestComponentParser, valid_recovery_properties)
+{
+  std::string urdf_to_test = ros2_control_test_assets::minimal_async_robot_urdf;
+  const std::string properties = "<properties>";
+  urdf_to_test.replace(
+    urdf_to_test.find(properties), properties.size(),
+    properties +
+      "<recovery max_attempts=\"3\" initial_backoff=\"0.05\" max_backoff=\"1.5\" "
+      "restore_controllers=\"true\"/>");
+  std::vector<hardware_interface::HardwareInfo> hw_info;
+  ASSERT_NO_THROW(hw_info = parse_control_resources_from_urdf(urdf_to_test));
+  ASSERT_THAT(hw_info, SizeIs(3));
+  EXPECT_EQ(hw_info[0].recovery_params.max_attempts, 3u);
+  EXPECT_DOUBLE_EQ(hw_info[0].recovery_params.initial_backoff, 0.05);
+  EXPECT_DOUBLE_EQ(hw_info[0].recovery_params.max_backoff, 1.5);
+  EXPECT_TRUE(hw_info[0].recovery_params.restore_controllers);
+  // the async properties are still parsed
+  EXPECT_EQ(hw_info[0].async_params.scheduling_policy, "detached");
+  // when not set, the recovery is disabled
+  EXPECT_EQ(hw_info[1].recovery_params.max_attempts, 0u);
+  EXPECT_FALSE(hw_info[1].recovery_params.restore_controllers);
+
+  std::string invalid_attempts = urdf_to_test;
+  invalid_attempts.replace(invalid_attempts.find("max_attempts=\"3\""), 16, "max_attempts=\"-3\"");
+  ASSERT_THROW(parse_control_resources_from_urdf(invalid_attempts), std::runtime_error);
+  std::string invalid_backoff = urdf_to_test;
+  invalid_backoff.replace(invalid_backoff.find("1.5"), 3, "0.01");
+  ASSERT_THROW(parse_control_resources_from_urdf(invalid_backoff), std::runtime_error);
 }
 
 TEST_F(TestComponentParser, gripper_mimic_with_unknown_joint_throws_error)
@@ -2129,3 +2304,148 @@ TEST_F(TestComponentParser, parameter_missing_name_includes_parent_context)
     EXPECT_THAT(std::string(e.what()), HasSubstr("parameter name"));
   }
 }
+
+TEST_F(TestComponentParser, successfully_parse_lock_free_interfaces)
+{
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    R"(
+  <ros2_control name="RRBotSystemLockFree" type="system">
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemLockFree</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="position" lock_free="true"/>
+      <state_interface name="position" lock_free="true"/>
+      <state_interface name="velocity"/>
+    </joint>
+    <gpio name="flange_IOS">
+      <command_interface name="digital_output" data_type="bool" lock_free="false"/>
+    </gpio>
+  </ros2_control>
+)" + ros2_control_test_assets::urdf_tail;
+
+  const auto control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  ASSERT_THAT(control_hardware, SizeIs(1));
+  const auto hardware_info = control_hardware.front();
+
+  ASSERT_THAT(hardware_info.joints, SizeIs(1));
+  ASSERT_THAT(hardware_info.joints[0].command_interfaces, SizeIs(1));
+  EXPECT_TRUE(hardware_info.joints[0].command_interfaces[0].lock_free);
+  ASSERT_THAT(hardware_info.joints[0].state_interfaces, SizeIs(2));
+  EXPECT_TRUE(hardware_info.joints[0].state_interfaces[0].lock_free);
+  EXPECT_FALSE(hardware_info.joints[0].state_interfaces[1].lock_free);
+  ASSERT_THAT(hardware_info.gpios, SizeIs(1));
+  ASSERT_THAT(hardware_info.gpios[0].command_interfaces, SizeIs(1));
+  EXPECT_FALSE(hardware_info.gpios[0].command_interfaces[0].lock_free);
+
+  hardware_interface::StateInterface state_itf{hardware_interface::InterfaceDescription(
+    hardware_info.joints[0].name, hardware_info.joints[0].state_interfaces[0])};
+  EXPECT_TRUE(state_itf.is_lock_free());
+}
+
+TEST_F(TestComponentParser, successfully_parse_packed_gpio_interfaces)
+{
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    R"(
+  <ros2_control name="RRBotSystemPackedIO" type="system">
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemPackedIO</plugin>
+    </hardware>
+    <gpio name="io_bank" packed="true">
+      <command_interface name="digital_output_1" data_type="bool"/>
+      <state_interface name="digital_input_1" data_type="bool"/>
+      <state_interface name="analog_range" data_type="uint8"/>
+    </gpio>
+    <gpio name="flange_IOS">
+      <command_interface name="digital_output" data_type="bool"/>
+    </gpio>
+  </ros2_control>
+)" + ros2_control_test_assets::urdf_tail;
+
+  const auto control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  ASSERT_THAT(control_hardware, SizeIs(1));
+  const auto hardware_info = control_hardware.front();
+
+  ASSERT_THAT(hardware_info.gpios, SizeIs(2));
+  ASSERT_THAT(hardware_info.gpios[0].command_interfaces, SizeIs(1));
+  EXPECT_TRUE(hardware_info.gpios[0].command_interfaces[0].packed);
+  ASSERT_THAT(hardware_info.gpios[0].state_interfaces, SizeIs(2));
+  EXPECT_TRUE(hardware_info.gpios[0].state_interfaces[0].packed);
+  EXPECT_TRUE(hardware_info.gpios[0].state_interfaces[1].packed);
+  ASSERT_THAT(hardware_info.gpios[1].command_interfaces, SizeIs(1));
+  EXPECT_FALSE(hardware_info.gpios[1].command_interfaces[0].packed);
+}
+
+TEST_F(TestComponentParser, extract_control_resources_description_keeps_only_parsed_elements)
+{
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    R"(
+  <!-- <ros2_control name="Commented" type="system"></ros2_control> -->
+  <gazebo reference="link1">
+    <joint name="nested_joint" type="fixed"/>
+  </gazebo>
+)" + std::string(ros2_control_test_assets::hardware_resources) +
+    ros2_control_test_assets::urdf_tail;
+
+  const std::string description = extract_control_resources_description(urdf_to_test);
+  ASSERT_FALSE(description.empty());
+  EXPECT_THAT(description, HasSubstr(R"(<robot name="MinimalRobot">)"));
+  EXPECT_THAT(description, HasSubstr(R"(<link name="base_link"/>)"));
+  EXPECT_THAT(description, HasSubstr(R"(<joint name="joint1" type="revolute">)"));
+  EXPECT_THAT(description, HasSubstr(R"(<ros2_control name="TestActuatorHardware")"));
+  EXPECT_THAT(description, Not(HasSubstr("<visual>")));
+  EXPECT_THAT(description, Not(HasSubstr("Commented")));
+  EXPECT_THAT(description, Not(HasSubstr("nested_joint")));
+  EXPECT_THAT(description, EndsWith("</robot>"));
+
+  const auto control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  const auto control_hardware_from_description = parse_control_resources_from_urdf(description);
+  ASSERT_THAT(control_hardware, SizeIs(control_hardware_from_description.size()));
+  for (std::size_t i = 0; i < control_hardware.size(); ++i)
+  {
+    EXPECT_EQ(control_hardware[i].name, control_hardware_from_description[i].name);
+    ASSERT_THAT(
+      control_hardware[i].joints, SizeIs(control_hardware_from_description[i].joints.size()));
+    for (std::size_t j = 0; j < control_hardware[i].joints.size(); ++j)
+    {
+      EXPECT_EQ(
+        control_hardware[i].joints[j].name, control_hardware_from_description[i].joints[j].name);
+    }
+    ASSERT_THAT(
+      control_hardware[i].limits, SizeIs(control_hardware_from_description[i].limits.size()));
+    for (const auto & [joint_name, limits] : control_hardware[i].limits)
+    {
+      const auto & limits_from_description =
+        control_hardware_from_description[i].limits.at(joint_name);
+      EXPECT_EQ(limits.max_velocity, limits_from_description.max_velocity);
+      EXPECT_EQ(limits.max_position, limits_from_description.max_position);
+    }
+  }
+}
+
+TEST_F(TestComponentParser, extract_control_resources_description_fails_on_unsupported_input)
+{
+  EXPECT_THAT(
+    extract_control_resources_description(ros2_control_test_assets::diff_drive_robot_sdf),
+    IsEmpty());
+  EXPECT_THAT(extract_control_resources_description(R"(<robot name="r"/>)"), IsEmpty());
+  EXPECT_THAT(
+    extract_control_resources_description(R"(<robot name="r"><link name="l"></robot>)"),
+    IsEmpty());
+  EXPECT_THAT(
+    extract_control_resources_description(R"(<robot name="r"><joint name="j">)"), IsEmpty());
+  EXPECT_THAT(
+    extract_control_resources_description(R"(<robot name="r"><!-- unterminated </robot>)"),
+    IsEmpty());
+  EXPECT_THAT(
+    extract_control_resources_description(
+      R"(<!DOCTYPE robot [<!ENTITY e "x">]><robot name="r"></robot>)"),
+    IsEmpty());
+  EXPECT_EQ(
+    extract_control_resources_description(
+      R"(<robot name="a>b"><link name="l"><visual/></link></robot>)"),
+    R"(<robot name="a>b"><link name="l"/></robot>)");
+}
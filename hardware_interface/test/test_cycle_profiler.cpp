@@ -0,0 +1,177 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <thread>
+
+#include "hardware_interface/cycle_profiler.hpp"
+#include "hardware_interface/trace_recorder.hpp"
+
+using hardware_interface::CycleProfiler;
+using hardware_interface::CycleProfileReport;
+using hardware_interface::TraceRecorder;
+using hardware_interface::TraceScope;
+
+namespace
+{
+constexpr int64_t kPeriodNs = 1000;
+
+class TestCycleProfiler : public ::testing::Test
+{
+protected:
+  void TearDown() override { CycleProfiler::stop(); }
+
+  /// Starts the recording, which begins after the current cycle
+  void start(std::size_t cycles, std::size_t sections_per_cycle)
+  {
+    ASSERT_TRUE(CycleProfiler::start(cycles, sections_per_cycle));
+    EXPECT_FALSE(CycleProfiler::is_recording());
+    CycleProfiler::end_cycle(0, 0, kPeriodNs);
+    EXPECT_TRUE(CycleProfiler::is_recording());
+  }
+
+  const hardware_interface::ProfiledSection & find_section(
+    const CycleProfileReport & report, const std::string & name)
+  {
+    for (const auto & section : report.sections)
+    {
+      if (section.name == name)
+      {
+        return section;
+      }
+    }
+    ADD_FAILURE() << "no section " << name;
+    return report.sections.front();
+  }
+};
+}  // namespace
+
+TEST_F(TestCycleProfiler, ranks_the_sections_causing_the_overruns_first)
+{
+  const auto cm_read = TraceRecorder::register_name("cm/read");
+  const auto hw_read = TraceRecorder::register_name("hw/read");
+  const auto update = TraceRecorder::register_name("controller/update");
+  const auto hw_write = TraceRecorder::register_name("hw/write");
+
+  ASSERT_TRUE(CycleProfiler::start(4, 8));
+  // the sections of the cycle running when the profiler is started are not recorded
+  CycleProfiler::record(hw_write, -500, -100);
+  CycleProfiler::end_cycle(-1000, 0, kPeriodNs);
+  for (int64_t cycle = 0; cycle < 4; ++cycle)
+  {
+    const int64_t begin = cycle * 10000;
+    const int64_t write_end = begin + (cycle == 3 ? 1500 : 800);
+    // the inner sections are recorded first
+    CycleProfiler::record(hw_read, begin + 50, begin + 250);
+    CycleProfiler::record(cm_read, begin, begin + 300);
+    CycleProfiler::record(update, begin + 300, begin + 500);
+    CycleProfiler::record(hw_write, begin + 500, write_end);
+    CycleProfiler::end_cycle(begin, write_end, kPeriodNs);
+  }
+  EXPECT_TRUE(CycleProfiler::is_finished());
+  CycleProfiler::record(hw_write, 50000, 60000);
+
+  const auto report = CycleProfiler::stop();
+  EXPECT_FALSE(CycleProfiler::is_recording());
+  EXPECT_EQ(report.cycles, 4u);
+  EXPECT_EQ(report.overrun_cycles, 1u);
+  EXPECT_EQ(report.dropped_sections, 0u);
+  EXPECT_DOUBLE_EQ(report.cycle_max_us, 1.5);
+  EXPECT_DOUBLE_EQ(report.cycle_mean_us, 0.975);
+  ASSERT_EQ(report.sections.size(), 4u);
+
+  const auto & offender = report.sections.front();
+  EXPECT_EQ(offender.name, "hw/write");
+  EXPECT_EQ(offender.count, 4u);
+  EXPECT_EQ(offender.overruns, 1u);
+  EXPECT_DOUBLE_EQ(offender.overrun_share, 1.0);
+  EXPECT_DOUBLE_EQ(offender.p99_us, 1.0);
+  EXPECT_DOUBLE_EQ(offender.max_us, 1.0);
+  EXPECT_DOUBLE_EQ(offender.mean_us, 0.475);
+  EXPECT_DOUBLE_EQ(offender.critical_path_share, 1900.0 / 3900.0);
+
+  // the outer section only owns the time not spent in its inner section
+  EXPECT_DOUBLE_EQ(find_section(report, "cm/read").critical_path_share, 400.0 / 3900.0);
+  EXPECT_DOUBLE_EQ(find_section(report, "hw/read").critical_path_share, 800.0 / 3900.0);
+  EXPECT_EQ(find_section(report, "cm/read").overruns, 0u);
+  EXPECT_EQ(report.sections.back().name, "cm/read");
+
+  const std::string text = report.to_string();
+  EXPECT_THAT(text, ::testing::HasSubstr("Profiled 4 cycles with 1 overruns"));
+  EXPECT_THAT(text, ::testing::HasSubstr("1. hw/write: p99 = 1.0 us"));
+  EXPECT_THAT(text, ::testing::HasSubstr("100.0% of the overruns"));
+}
+
+TEST_F(TestCycleProfiler, attributes_parallel_sections_to_the_one_ending_last)
+{
+  const auto read = TraceRecorder::register_name("cm/read");
+  const auto fast_read = TraceRecorder::register_name("fast/read");
+  const auto slow_read = TraceRecorder::register_name("slow/read");
+  start(1, 4);
+  std::thread worker([fast_read]() { CycleProfiler::record(fast_read, 0, 300); });
+  worker.join();
+  CycleProfiler::record(slow_read, 0, 500);
+  CycleProfiler::record(read, 0, 600);
+  CycleProfiler::end_cycle(0, 600, kPeriodNs);
+
+  const auto report = CycleProfiler::stop();
+  EXPECT_EQ(report.overrun_cycles, 0u);
+  EXPECT_DOUBLE_EQ(find_section(report, "slow/read").critical_path_share, 500.0 / 600.0);
+  EXPECT_DOUBLE_EQ(find_section(report, "fast/read").critical_path_share, 0.0);
+  EXPECT_DOUBLE_EQ(find_section(report, "cm/read").critical_path_share, 100.0 / 600.0);
+  EXPECT_EQ(report.sections.front().name, "slow/read");
+}
+
+TEST_F(TestCycleProfiler, counts_the_sections_exceeding_the_table)
+{
+  const auto update = TraceRecorder::register_name("controller/update");
+  EXPECT_FALSE(CycleProfiler::start(0, 4));
+  EXPECT_FALSE(CycleProfiler::start(4, 0));
+  start(2, 2);
+  EXPECT_FALSE(CycleProfiler::start(2, 2));
+  for (int64_t i = 0; i < 3; ++i)
+  {
+    CycleProfiler::record(update, 100 * i, 100 * i + 50);
+  }
+  CycleProfiler::end_cycle(0, 300, kPeriodNs);
+  EXPECT_FALSE(CycleProfiler::is_finished());
+
+  // a stopped recording reports the cycles recorded so far and can be started again
+  const auto report = CycleProfiler::stop();
+  EXPECT_EQ(report.cycles, 1u);
+  EXPECT_EQ(report.dropped_sections, 1u);
+  ASSERT_EQ(report.sections.size(), 1u);
+  EXPECT_EQ(report.sections.front().count, 2u);
+  EXPECT_EQ(CycleProfiler::stop().cycles, 0u);
+  EXPECT_TRUE(CycleProfiler::start(2, 2));
+}
+
+TEST_F(TestCycleProfiler, records_the_trace_scopes_without_tracing)
+{
+  const auto update = TraceRecorder::register_name("controller/update");
+  ASSERT_FALSE(TraceRecorder::is_enabled());
+  start(1, 4);
+  const int64_t begin_ns = TraceRecorder::now();
+  {
+    TraceScope scope(update);
+  }
+  CycleProfiler::end_cycle(begin_ns, TraceRecorder::now(), kPeriodNs);
+
+  const auto report = CycleProfiler::stop();
+  ASSERT_EQ(report.sections.size(), 1u);
+  EXPECT_EQ(report.sections.front().name, "controller/update");
+  EXPECT_EQ(report.sections.front().count, 1u);
+}
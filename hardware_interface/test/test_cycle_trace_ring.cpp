@@ -0,0 +1,139 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "hardware_interface/cycle_trace_ring.hpp"
+#include "hardware_interface/trace_recorder.hpp"
+
+using hardware_interface::CycleTraceRing;
+using hardware_interface::TraceEvent;
+using hardware_interface::TraceRecorder;
+using hardware_interface::TraceScope;
+
+// the ring is allocated once per process, so all the tests share it
+constexpr std::size_t kCycles = 3;
+constexpr std::size_t kSectionsPerCycle = 2;
+
+class TestCycleTraceRing : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    CycleTraceRing::enable(kCycles, kSectionsPerCycle);
+    cycle_id_ = TraceRecorder::register_name("cm/cycle");
+    update_id_ = TraceRecorder::register_name("controller/update");
+    std::vector<TraceEvent> stale_events;
+    CycleTraceRing::take_frozen_events(stale_events);
+  }
+
+  void TearDown() override { CycleTraceRing::disable(); }
+
+  /// Runs a cycle with the given number of controller updates
+  void run_cycle(int64_t begin_ns, std::size_t updates)
+  {
+    for (std::size_t i = 0; i < updates; ++i)
+    {
+      CycleTraceRing::record(update_id_, begin_ns + 10, begin_ns + 20);
+    }
+    CycleTraceRing::end_cycle(cycle_id_, begin_ns, begin_ns + 100);
+  }
+
+  uint32_t cycle_id_ = 0;
+  uint32_t update_id_ = 0;
+};
+
+TEST_F(TestCycleTraceRing, freezes_the_last_cycles)
+{
+  for (int64_t cycle = 0; cycle < 5; ++cycle)
+  {
+    run_cycle(1000 * cycle, 1);
+  }
+  // a section of the running cycle isn't frozen
+  CycleTraceRing::record(update_id_, 5010, 5020);
+  ASSERT_TRUE(CycleTraceRing::freeze());
+
+  std::vector<TraceEvent> events;
+  ASSERT_EQ(CycleTraceRing::take_frozen_events(events), 2 * kCycles);
+  for (std::size_t i = 0; i < kCycles; ++i)
+  {
+    const int64_t begin_ns = 1000 * static_cast<int64_t>(i + 2);
+    EXPECT_EQ(events[2 * i].name_id, cycle_id_);
+    EXPECT_EQ(events[2 * i].begin_ns, begin_ns);
+    EXPECT_EQ(events[2 * i].end_ns, begin_ns + 100);
+    EXPECT_EQ(events[2 * i + 1].name_id, update_id_);
+    EXPECT_EQ(events[2 * i + 1].begin_ns, begin_ns + 10);
+  }
+  EXPECT_EQ(CycleTraceRing::take_frozen_events(events), 0u);
+}
+
+TEST_F(TestCycleTraceRing, freezes_once_until_the_events_are_taken)
+{
+  run_cycle(0, 1);
+  const auto freezes = CycleTraceRing::get_number_of_freezes();
+  const auto skipped_freezes = CycleTraceRing::get_skipped_freezes();
+  ASSERT_TRUE(CycleTraceRing::freeze());
+  // the same cycle is only frozen once, e.g., by two detections of the same overrun
+  EXPECT_FALSE(CycleTraceRing::freeze());
+  EXPECT_EQ(CycleTraceRing::get_skipped_freezes(), skipped_freezes);
+
+  run_cycle(1000, 1);
+  EXPECT_FALSE(CycleTraceRing::freeze());
+  EXPECT_EQ(CycleTraceRing::get_skipped_freezes(), skipped_freezes + 1);
+
+  std::vector<TraceEvent> events;
+  EXPECT_GT(CycleTraceRing::take_frozen_events(events), 0u);
+  run_cycle(2000, 1);
+  EXPECT_TRUE(CycleTraceRing::freeze());
+  EXPECT_EQ(CycleTraceRing::get_number_of_freezes(), freezes + 2);
+}
+
+TEST_F(TestCycleTraceRing, keeps_the_cycle_when_its_sections_are_dropped)
+{
+  for (std::size_t cycle = 0; cycle < kCycles; ++cycle)
+  {
+    run_cycle(1000 * static_cast<int64_t>(cycle), kSectionsPerCycle + 2);
+  }
+  ASSERT_TRUE(CycleTraceRing::freeze());
+  std::vector<TraceEvent> events;
+  ASSERT_EQ(CycleTraceRing::take_frozen_events(events), kCycles * (kSectionsPerCycle + 1));
+  EXPECT_EQ(events.front().name_id, cycle_id_);
+}
+
+TEST_F(TestCycleTraceRing, records_the_trace_scopes_without_tracing)
+{
+  ASSERT_FALSE(TraceRecorder::is_enabled());
+  {
+    TraceScope scope(update_id_);
+  }
+  CycleTraceRing::end_cycle(cycle_id_, 0, 100);
+  ASSERT_TRUE(CycleTraceRing::freeze());
+  std::vector<TraceEvent> events;
+  CycleTraceRing::take_frozen_events(events);
+  // the last frozen cycle is followed by its section
+  ASSERT_GE(events.size(), 2u);
+  EXPECT_EQ(events[events.size() - 2].name_id, cycle_id_);
+  EXPECT_EQ(events.back().name_id, update_id_);
+  EXPECT_LE(events.back().begin_ns, events.back().end_ns);
+
+  CycleTraceRing::disable();
+  {
+    TraceScope scope(update_id_);
+  }
+  CycleTraceRing::end_cycle(cycle_id_, 0, 100);
+  EXPECT_FALSE(CycleTraceRing::freeze());
+}
@@ -0,0 +1,167 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/deferred_logger.hpp"
+#include "rclcpp/logger.hpp"
+#include "rcutils/logging.h"
+
+using hardware_interface::DeferredLogger;
+using hardware_interface::DeferredLogRecord;
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+using ::testing::SizeIs;
+
+namespace
+{
+// the ring buffers are allocated once per process, every test uses the same capacity
+constexpr std::size_t kRecordsPerThread = 4;
+constexpr std::size_t kMaxThreads = 2;
+// the tests flush explicitly, the background thread doesn't flush during a test
+constexpr std::chrono::milliseconds kFlushPeriod = std::chrono::hours(1);
+constexpr const char * kLoggerName = "test_deferred_logger";
+
+std::vector<std::string> output_messages;  // NOLINT
+
+void capture_output(
+  const rcutils_log_location_t * /*location*/, int /*severity*/, const char * name,
+  rcutils_time_point_value_t /*timestamp*/, const char * format, va_list * args)
+{
+  char buffer[1024];
+  std::vsnprintf(buffer, sizeof(buffer), format, *args);
+  output_messages.push_back(std::string(name) + ": " + buffer);
+}
+}  // namespace
+
+class TestDeferredLogger : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    output_messages.clear();
+    previous_handler_ = rcutils_logging_get_output_handler();
+    rcutils_logging_set_output_handler(capture_output);
+  }
+
+  void TearDown() override { rcutils_logging_set_output_handler(previous_handler_); }
+
+  rcutils_logging_output_handler_t previous_handler_;
+  rclcpp::Logger logger_ = rclcpp::get_logger(kLoggerName);
+};
+
+TEST_F(TestDeferredLogger, format_converts_the_copied_arguments)
+{
+  DeferredLogRecord record;
+  record.format = "%s=%d %u %05.2f %x %c %s %% %5s|%-4d| %d %s";
+  std::string name = "joint1";
+  record.add_argument(name);
+  record.add_argument(-3);
+  record.add_argument(uint64_t{18446744073709551615ull});
+  record.add_argument(3.14159);
+  record.add_argument(255u);
+  record.add_argument('a');
+  record.add_argument("literal");
+  record.add_argument(static_cast<const char *>(nullptr));
+  record.add_argument(7);
+  record.add_argument(2.5);
+  // the argument is copied
+  name = "overwritten";
+
+  EXPECT_EQ(
+    DeferredLogger::format(record),
+    "joint1=-3 18446744073709551615 03.14 ff a literal % (null)|7   | 2 %s");
+}
+
+TEST_F(TestDeferredLogger, format_prints_the_unsupported_conversions_verbatim)
+{
+  DeferredLogRecord record;
+  record.format = "%*d %.*f %d %";
+  record.add_argument(1);
+  EXPECT_EQ(DeferredLogger::format(record), "%*d %.*f 1 %");
+}
+
+TEST_F(TestDeferredLogger, when_not_started_expect_immediate_output)
+{
+  ASSERT_FALSE(DeferredLogger::is_started());
+  RT_LOG_ERROR(logger_, "Component '%s' failed %d times", std::string("system"), 2);
+  RT_LOG_ERROR_EXPRESSION(logger_, false, "Not logged");
+  RT_LOG_DEBUG(logger_, "Below the logger level");
+
+  EXPECT_THAT(
+    output_messages, ElementsAre(std::string(kLoggerName) + ": Component 'system' failed 2 times"));
+}
+
+TEST_F(TestDeferredLogger, when_started_expect_output_on_flush_in_capture_order)
+{
+  DeferredLogger::start(kRecordsPerThread, kMaxThreads, kFlushPeriod);
+  ASSERT_TRUE(DeferredLogger::is_started());
+
+  RT_LOG_WARN(logger_, "first %d", 1);
+  std::thread other_thread([this]() { RT_LOG_WARN(logger_, "second %d", 2); });
+  other_thread.join();
+  RT_LOG_INFO_EXPRESSION(logger_, true, "third %d", 3);
+  EXPECT_THAT(output_messages, IsEmpty());
+
+  EXPECT_EQ(DeferredLogger::flush(), 3u);
+  const std::string prefix = std::string(kLoggerName) + ": ";
+  EXPECT_THAT(
+    output_messages, ElementsAre(prefix + "first 1", prefix + "second 2", prefix + "third 3"));
+  EXPECT_EQ(DeferredLogger::flush(), 0u);
+
+  DeferredLogger::stop();
+  EXPECT_FALSE(DeferredLogger::is_started());
+}
+
+TEST_F(TestDeferredLogger, when_ring_buffer_is_full_expect_messages_dropped_and_reported)
+{
+  DeferredLogger::start(kRecordsPerThread, kMaxThreads, kFlushPeriod);
+  const uint64_t dropped_before = DeferredLogger::get_dropped_messages();
+  for (int i = 0; i < 10; ++i)
+  {
+    RT_LOG_ERROR(logger_, "error %d", i);
+  }
+  EXPECT_EQ(DeferredLogger::get_dropped_messages() - dropped_before, 6u);
+  EXPECT_THAT(output_messages, IsEmpty());
+
+  // the pending messages are flushed when the backend is stopped
+  DeferredLogger::stop();
+  ASSERT_THAT(output_messages, SizeIs(kRecordsPerThread + 1));
+  EXPECT_THAT(output_messages[0], HasSubstr("error 0"));
+  EXPECT_THAT(output_messages[3], HasSubstr("error 3"));
+  EXPECT_THAT(output_messages[4], HasSubstr("6 log messages of the real-time threads were dropped"));
+}
+
+TEST_F(TestDeferredLogger, when_started_twice_expect_running_until_last_stop)
+{
+  DeferredLogger::start(kRecordsPerThread, kMaxThreads, kFlushPeriod);
+  DeferredLogger::start(kRecordsPerThread, kMaxThreads, kFlushPeriod);
+  DeferredLogger::stop();
+  EXPECT_TRUE(DeferredLogger::is_started());
+  RT_LOG_WARN(logger_, "deferred");
+  EXPECT_THAT(output_messages, IsEmpty());
+
+  DeferredLogger::stop();
+  EXPECT_FALSE(DeferredLogger::is_started());
+  EXPECT_THAT(output_messages, ElementsAre(std::string(kLoggerName) + ": deferred"));
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/edge_event_queue.hpp"
+
+using hardware_interface::EdgeEvent;
+using hardware_interface::EdgeEventList;
+using hardware_interface::EdgeEventQueue;
+
+TEST(TestEdgeEventQueue, pops_the_events_in_order)
+{
+  EdgeEventQueue queue(4);
+  EXPECT_EQ(queue.capacity(), 4u);
+  EXPECT_TRUE(queue.push(EdgeEvent{1, true, 10}));
+  EXPECT_TRUE(queue.push(EdgeEvent{2, false, 20}));
+
+  std::vector<int64_t> stamps;
+  EXPECT_EQ(
+    queue.pop_all([&stamps](const EdgeEvent & event) { stamps.push_back(event.stamp); }), 2u);
+  EXPECT_THAT(stamps, testing::ElementsAre(10, 20));
+  EXPECT_EQ(queue.pop_all([](const EdgeEvent &) { FAIL(); }), 0u);
+}
+
+TEST(TestEdgeEventQueue, full_queue_drops_the_new_events)
+{
+  EdgeEventQueue queue(2);
+  EXPECT_TRUE(queue.push(EdgeEvent{1, true, 10}));
+  EXPECT_TRUE(queue.push(EdgeEvent{1, false, 20}));
+  EXPECT_FALSE(queue.push(EdgeEvent{1, true, 30}));
+  EXPECT_EQ(queue.get_dropped_events(), 1u);
+
+  std::vector<bool> values;
+  queue.pop_all([&values](const EdgeEvent & event) { values.push_back(event.value); });
+  EXPECT_THAT(values, testing::ElementsAre(true, false));
+  // the popped slots are reused after the queue wrapped around
+  EXPECT_TRUE(queue.push(EdgeEvent{1, true, 40}));
+  EXPECT_TRUE(queue.push(EdgeEvent{1, false, 50}));
+}
+
+TEST(TestEdgeEventQueue, events_pushed_by_another_thread_are_popped_once)
+{
+  EdgeEventQueue queue(16);
+  constexpr int64_t number_of_events = 10000;
+  std::thread producer(
+    [&queue]()
+    {
+      for (int64_t i = 0; i < number_of_events;)
+      {
+        if (queue.push(EdgeEvent{1, i % 2 == 0, i}))
+        {
+          ++i;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+  int64_t next_stamp = 0;
+  while (next_stamp < number_of_events)
+  {
+    queue.pop_all(
+      [&next_stamp](const EdgeEvent & event)
+      {
+        EXPECT_EQ(event.stamp, next_stamp);
+        ++next_stamp;
+      });
+    std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_EQ(next_stamp, number_of_events);
+}
+
+TEST(TestEdgeEventList, full_list_counts_the_dropped_events)
+{
+  EdgeEventList list(2);
+  EXPECT_EQ(list.capacity(), 2u);
+  EXPECT_TRUE(list.empty());
+  list.push(EdgeEvent{1, true, 10});
+  list.push(EdgeEvent{2, true, 20});
+  list.push(EdgeEvent{3, true, 30});
+  list.add_dropped_events(2);
+  ASSERT_EQ(list.size(), 2u);
+  EXPECT_EQ(list[1].interface_id, 2u);
+  EXPECT_EQ(list.get_dropped_events(), 3u);
+
+  // the next cycle starts without the events of the previous one
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.get_dropped_events(), 0u);
+  EXPECT_EQ(list.capacity(), 2u);
+}
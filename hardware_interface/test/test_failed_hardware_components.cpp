@@ -0,0 +1,62 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include "hardware_interface/failed_hardware_components.hpp"
+
+using hardware_interface::FailedHardwareComponents;
+
+TEST(TestFailedHardwareComponents, yields_the_names_of_the_failed_components)
+{
+  const std::vector<std::string> names = {"actuator", "sensor", "system"};
+  FailedHardwareComponents failed_components;
+  failed_components.reset(names);
+  EXPECT_TRUE(failed_components.empty());
+  EXPECT_THAT(failed_components, ::testing::IsEmpty());
+
+  failed_components.push_back(2);
+  failed_components.push_back(0);
+  ASSERT_EQ(failed_components.size(), 2u);
+  EXPECT_THAT(failed_components.get_indices(), ::testing::ElementsAre(2u, 0u));
+  EXPECT_THAT(failed_components, ::testing::ElementsAre("system", "actuator"));
+  EXPECT_EQ(failed_components[1], "actuator");
+
+  // the copies refer to the same names
+  const FailedHardwareComponents copy = failed_components;
+  EXPECT_THAT(
+    copy, ::testing::ElementsAreArray(std::vector<std::string>({"system", "actuator"})));
+}
+
+TEST(TestFailedHardwareComponents, reports_without_allocating)
+{
+  const std::vector<std::string> names(8, "component_with_a_long_name");
+  FailedHardwareComponents failed_components;
+  failed_components.reset(names);
+  const std::size_t * data = failed_components.get_indices().data();
+  for (int cycle = 0; cycle < 3; ++cycle)
+  {
+    failed_components.clear();
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+      failed_components.push_back(i);
+    }
+  }
+  // the indices are stored in the memory preallocated by reset()
+  EXPECT_EQ(failed_components.get_indices().data(), data);
+  EXPECT_EQ(failed_components.size(), names.size());
+}
@@ -12,11 +12,18 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "hardware_interface/handle.hpp"
 #include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/loaned_interface_view.hpp"
 
 using hardware_interface::CommandInterface;
 using hardware_interface::InterfaceDescription;
@@ -1031,3 +1038,842 @@ TEST(TestHandle, handle_getters)
     EXPECT_EQ(val, true);
   }
 }
+
+TEST(TestHandle, lock_free_storage)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.lock_free = true;
+  {
+    info.data_type = "double";
+    info.initial_value = "1.337";
+    hardware_interface::Handle handle{InterfaceDescription{JOINT_NAME, info}};
+    ASSERT_TRUE(handle.is_lock_free());
+    EXPECT_DOUBLE_EQ(handle.get_optional().value(), 1.337);
+    ASSERT_TRUE(handle.set_value(0.52));
+    EXPECT_DOUBLE_EQ(handle.get_optional().value(), 0.52);
+    double val;
+    EXPECT_TRUE(handle.get_value(val, false));
+    EXPECT_DOUBLE_EQ(val, 0.52);
+    EXPECT_THROW({ std::ignore = handle.get_optional<bool>(); }, std::runtime_error);
+    EXPECT_THROW({ std::ignore = handle.set_value(true); }, std::runtime_error);
+
+    hardware_interface::Handle copy(handle);
+    ASSERT_TRUE(copy.is_lock_free());
+    EXPECT_DOUBLE_EQ(copy.get_optional().value(), 0.52);
+    ASSERT_TRUE(copy.set_value(3.0));
+    EXPECT_DOUBLE_EQ(copy.get_optional().value(), 3.0);
+    EXPECT_DOUBLE_EQ(handle.get_optional().value(), 0.52);
+  }
+  {
+    info.data_type = "bool";
+    info.initial_value = "true";
+    hardware_interface::Handle handle{InterfaceDescription{JOINT_NAME, info}};
+    EXPECT_TRUE(handle.get_optional<bool>().value());
+    EXPECT_DOUBLE_EQ(handle.get_optional().value(), 1.0);
+    ASSERT_TRUE(handle.set_value(false, true));
+    EXPECT_FALSE(handle.get_optional<bool>().value());
+  }
+  {
+    info.data_type = "int32";
+    info.initial_value = "-1000000000";
+    hardware_interface::Handle handle{InterfaceDescription{JOINT_NAME, info}};
+    EXPECT_EQ(handle.get_optional<int32_t>().value(), -1000000000);
+    EXPECT_THROW({ std::ignore = handle.get_optional<double>(); }, std::runtime_error);
+    ASSERT_TRUE(handle.set_value(static_cast<int32_t>(42)));
+    EXPECT_EQ(handle.get_optional<int32_t>().value(), 42);
+  }
+  {
+    info.data_type = "float32";
+    info.initial_value = "1.5";
+    hardware_interface::Handle handle{InterfaceDescription{JOINT_NAME, info}};
+    EXPECT_FLOAT_EQ(handle.get_optional<float>().value(), 1.5f);
+    ASSERT_TRUE(handle.set_value(2.5f));
+    EXPECT_FLOAT_EQ(handle.get_optional<float>().value(), 2.5f);
+  }
+}
+
+TEST(TestHandle, lock_free_storage_never_fails_under_contention)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.initial_value = "0.0";
+  info.lock_free = true;
+  CommandInterface handle{InterfaceDescription{JOINT_NAME, info}};
+
+  std::atomic_bool done{false};
+  std::thread writer(
+    [&]()
+    {
+      for (int i = 1; i <= 100000; ++i)
+      {
+        ASSERT_TRUE(handle.set_value(static_cast<double>(i)));
+      }
+      done = true;
+    });
+
+  double last_value = 0.0;
+  while (!done)
+  {
+    const auto value = handle.get_optional();
+    ASSERT_TRUE(value.has_value());
+    // values are written in increasing order, a torn or stale read would break this
+    ASSERT_GE(value.value(), last_value);
+    last_value = value.value();
+  }
+  writer.join();
+  EXPECT_DOUBLE_EQ(handle.get_optional().value(), 100000.0);
+}
+
+TEST(TestHandle, relocate_value_storage)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.initial_value = "1.337";
+  StateInterface handle{InterfaceDescription{JOINT_NAME, info}};
+  ASSERT_TRUE(handle.has_relocatable_value_storage());
+
+  double storage = 0.0;
+  handle.relocate_value_storage(&storage);
+  EXPECT_DOUBLE_EQ(storage, 1.337);
+  storage = 2.0;
+  EXPECT_DOUBLE_EQ(handle.get_optional().value(), 2.0);
+
+  // copies own their value
+  StateInterface copy(handle);
+  storage = 3.0;
+  EXPECT_DOUBLE_EQ(copy.get_optional().value(), 2.0);
+  EXPECT_DOUBLE_EQ(handle.get_optional().value(), 3.0);
+
+  // moving back to the own storage keeps the latest value
+  handle.relocate_value_storage(nullptr);
+  storage = 4.0;
+  EXPECT_DOUBLE_EQ(handle.get_optional().value(), 3.0);
+
+  info.data_type = "bool";
+  info.initial_value = "true";
+  StateInterface bool_handle{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_FALSE(bool_handle.has_relocatable_value_storage());
+  EXPECT_THROW(bool_handle.relocate_value_storage(&storage), std::runtime_error);
+
+  info.data_type = "double";
+  info.initial_value = "1.0";
+  info.lock_free = true;
+  StateInterface lock_free_handle{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_FALSE(lock_free_handle.has_relocatable_value_storage());
+}
+
+TEST(TestHandle, detached_copy_of_a_command_interface)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.initial_value = "1.337";
+  CommandInterface command{InterfaceDescription{JOINT_NAME, info}};
+  command.set_on_set_command_limiter(
+    [](double value, bool & is_limited)
+    {
+      is_limited = true;
+      return std::min(value, 1.0);
+    });
+  double storage = 0.0;
+  command.relocate_value_storage(&storage);
+
+  auto copy = CommandInterface::make_detached_copy(command);
+  EXPECT_EQ(copy->get_name(), command.get_name());
+  EXPECT_DOUBLE_EQ(copy->get_optional().value(), 1.337);
+  ASSERT_TRUE(copy->set_limited_value(5.0));
+  EXPECT_FALSE(copy->is_limited());
+  EXPECT_DOUBLE_EQ(copy->get_optional().value(), 5.0);
+  EXPECT_DOUBLE_EQ(storage, 1.337);
+  EXPECT_DOUBLE_EQ(command.get_optional().value(), 1.337);
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  // the value of a legacy handle is owned by the hardware component
+  double value = 2.0;
+  CommandInterface legacy_command{JOINT_NAME, FOO_INTERFACE, &value};
+#pragma GCC diagnostic pop
+  auto legacy_copy = CommandInterface::make_detached_copy(legacy_command);
+  ASSERT_TRUE(legacy_copy->set_value(3.0));
+  EXPECT_DOUBLE_EQ(legacy_copy->get_optional().value(), 3.0);
+  EXPECT_DOUBLE_EQ(value, 2.0);
+}
+
+TEST(TestHandle, relocate_packed_value_storage)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "bool";
+  info.initial_value = "true";
+  StateInterface handle{InterfaceDescription{JOINT_NAME, info}};
+  ASSERT_TRUE(handle.has_packable_value_storage());
+
+  alignas(8) uint8_t storage[2] = {0, 0};
+  handle.relocate_packed_value_storage(&storage[1]);
+  EXPECT_EQ(storage[1], 1u);
+  ASSERT_TRUE(handle.set_value(false));
+  EXPECT_EQ(storage[1], 0u);
+  EXPECT_FALSE(handle.get_optional<bool>().value());
+  EXPECT_DOUBLE_EQ(handle.get_optional_as_double().value(), 0.0);
+
+  // the views access the packed value directly
+  hardware_interface::LoanedStateView<bool> view(handle);
+  ASSERT_TRUE(handle.set_value(true));
+  EXPECT_TRUE(view.get_optional().value());
+
+  // copies own their value
+  StateInterface copy(handle);
+  ASSERT_TRUE(handle.set_value(false));
+  EXPECT_TRUE(copy.get_optional<bool>().value());
+
+  // moving back to the own storage keeps the latest value
+  handle.relocate_packed_value_storage(nullptr);
+  storage[1] = 1;
+  EXPECT_FALSE(handle.get_optional<bool>().value());
+  EXPECT_EQ(storage[0], 0u);
+
+  info.data_type = "uint8";
+  info.initial_value = "42";
+  StateInterface uint8_handle{InterfaceDescription{JOINT_NAME, info}};
+  uint8_handle.relocate_packed_value_storage(&storage[0]);
+  EXPECT_EQ(storage[0], 42u);
+  storage[0] = 7;
+  EXPECT_EQ(uint8_handle.get_optional<uint8_t>().value(), 7u);
+  uint8_handle.relocate_packed_value_storage(nullptr);
+
+  info.data_type = "double";
+  info.initial_value = "1.0";
+  StateInterface double_handle{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_FALSE(double_handle.has_packable_value_storage());
+  EXPECT_THROW(double_handle.relocate_packed_value_storage(&storage[0]), std::runtime_error);
+}
+
+TEST(TestHandle, narrow_to_float32)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "double";
+  info.initial_value = "1.5";
+  StateInterface handle{InterfaceDescription{JOINT_NAME, info}};
+  ASSERT_TRUE(handle.has_narrowable_value_storage());
+  EXPECT_FALSE(handle.has_relocatable_float32_value_storage());
+
+  handle.narrow_to_float32();
+  EXPECT_TRUE(handle.is_narrowed_to_float32());
+  EXPECT_EQ(handle.get_data_type(), hardware_interface::HandleDataType::FLOAT32);
+  EXPECT_FALSE(handle.has_relocatable_value_storage());
+  EXPECT_FLOAT_EQ(handle.get_optional<float>().value(), 1.5f);
+  // the legacy accessors of type double convert the value
+  EXPECT_DOUBLE_EQ(handle.get_optional<double>().value(), 1.5);
+  ASSERT_TRUE(handle.set_value(0.1));
+  EXPECT_FLOAT_EQ(handle.get_optional<float>().value(), 0.1f);
+  EXPECT_DOUBLE_EQ(handle.get_optional().value(), static_cast<double>(0.1f));
+  double value = 0.0;
+  ASSERT_TRUE(handle.get_value(value, false));
+  EXPECT_DOUBLE_EQ(value, static_cast<double>(0.1f));
+
+  alignas(16) float storage[2] = {0.0f, 0.0f};
+  ASSERT_TRUE(handle.has_relocatable_float32_value_storage());
+  handle.relocate_float32_value_storage(&storage[1]);
+  EXPECT_FLOAT_EQ(storage[1], 0.1f);
+  ASSERT_TRUE(handle.set_value(2.0));
+  EXPECT_FLOAT_EQ(storage[1], 2.0f);
+  EXPECT_DOUBLE_EQ(handle.get_optional_as_double().value(), 2.0);
+
+  // the views of type float read the stored value directly
+  hardware_interface::LoanedStateView<float> view(handle);
+  storage[1] = 3.0f;
+  EXPECT_FLOAT_EQ(view.get_optional().value(), 3.0f);
+  // and the ones of type double convert it, like the unchecked accessors
+  ASSERT_TRUE(handle.is_double_readable());
+  hardware_interface::LoanedStateView<double> double_view(handle);
+  EXPECT_DOUBLE_EQ(double_view.get_optional().value(), 3.0);
+  ASSERT_TRUE(handle.set_double_unchecked(3.5));
+  EXPECT_FLOAT_EQ(storage[1], 3.5f);
+  ASSERT_TRUE(handle.get_double_unchecked(value));
+  EXPECT_DOUBLE_EQ(value, 3.5);
+  storage[1] = 3.0f;
+
+  // copies own their value and stay narrowed
+  StateInterface copy(handle);
+  storage[1] = 4.0f;
+  EXPECT_TRUE(copy.is_narrowed_to_float32());
+  EXPECT_DOUBLE_EQ(copy.get_optional<double>().value(), 3.0);
+
+  // moving back to the own storage keeps the latest value
+  handle.relocate_float32_value_storage(nullptr);
+  storage[1] = 5.0f;
+  EXPECT_TRUE(handle.is_narrowed_to_float32());
+  EXPECT_DOUBLE_EQ(handle.get_optional<double>().value(), 4.0);
+  EXPECT_THROW(handle.narrow_to_float32(), std::runtime_error);
+
+  info.data_type = "bool";
+  info.initial_value = "true";
+  StateInterface bool_handle{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_FALSE(bool_handle.is_double_readable());
+  EXPECT_FALSE(bool_handle.has_narrowable_value_storage());
+  EXPECT_THROW(bool_handle.narrow_to_float32(), std::runtime_error);
+  EXPECT_THROW(bool_handle.relocate_float32_value_storage(&storage[0]), std::runtime_error);
+}
+
+TEST(TestHandle, typed_access_follows_the_storage_of_the_value)
+{
+  static_assert(
+    hardware_interface::HandleDataType::from_type<int8_t>() ==
+    hardware_interface::HandleDataType::INT8);
+  static_assert(
+    hardware_interface::HandleDataType::from_type<std::string>() ==
+    hardware_interface::HandleDataType::UNKNOWN);
+
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "bool";
+  info.initial_value = "true";
+  StateInterface handle{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_TRUE(handle.get_optional<bool>().value());
+  alignas(8) uint8_t storage[1] = {0};
+  handle.relocate_packed_value_storage(&storage[0]);
+  ASSERT_TRUE(handle.set_value(false));
+  EXPECT_EQ(storage[0], 0u);
+  storage[0] = 1;
+  EXPECT_TRUE(handle.get_optional<bool>().value());
+
+  // the copies and the moved handles access their own storage
+  StateInterface copy(handle);
+  ASSERT_TRUE(copy.set_value(false));
+  EXPECT_EQ(storage[0], 1u);
+  StateInterface moved(std::move(copy));
+  EXPECT_FALSE(moved.get_optional<bool>().value());
+  handle.relocate_packed_value_storage(nullptr);
+  storage[0] = 0;
+  EXPECT_TRUE(handle.get_optional<bool>().value());
+
+  info.data_type = "uint16";
+  info.initial_value = "7";
+  StateInterface uint16_handle{InterfaceDescription{JOINT_NAME, info}};
+  ASSERT_TRUE(uint16_handle.set_value(static_cast<uint16_t>(8)));
+  uint16_t value = 0;
+  ASSERT_TRUE(uint16_handle.get_value(value, false));
+  EXPECT_EQ(value, 8u);
+  // the accesses of another type are still checked
+  EXPECT_THROW((void)uint16_handle.get_optional<int16_t>(), std::runtime_error);
+  EXPECT_THROW((void)uint16_handle.get_optional(), std::runtime_error);
+
+  info.data_type = "double";
+  info.initial_value = "1.5";
+  StateInterface double_handle{InterfaceDescription{JOINT_NAME, info}};
+  double external_storage = 0.0;
+  double_handle.relocate_value_storage(&external_storage);
+  ASSERT_TRUE(double_handle.set_value(2.5));
+  EXPECT_DOUBLE_EQ(external_storage, 2.5);
+  EXPECT_DOUBLE_EQ(double_handle.get_optional().value(), 2.5);
+  double_handle.relocate_value_storage(nullptr);
+  external_storage = 0.0;
+  EXPECT_DOUBLE_EQ(double_handle.get_optional().value(), 2.5);
+}
+
+TEST(TestHandle, names_are_shared_by_the_copies)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "double";
+  StateInterface handle{InterfaceDescription{JOINT_NAME, info}};
+  StateInterface copy(handle);
+  EXPECT_EQ(copy.get_name(), JOINT_NAME + std::string("/") + FOO_INTERFACE);
+  EXPECT_EQ(&copy.get_name(), &handle.get_name());
+  EXPECT_EQ(&copy.get_prefix_name(), &handle.get_prefix_name());
+
+  StateInterface moved(std::move(copy));
+  EXPECT_EQ(&moved.get_name(), &handle.get_name());
+  // NOLINTNEXTLINE(bugprone-use-after-move)
+  EXPECT_EQ(copy.get_name(), "/");
+}
+
+TEST(TestHandle, names_are_interned)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "double";
+  StateInterface state{InterfaceDescription{JOINT_NAME, info}};
+  CommandInterface command{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_EQ(state.get_name_id(), command.get_name_id());
+  EXPECT_EQ(&state.get_name(), &command.get_name());
+  EXPECT_EQ(&state.get_interface_name(), &command.get_interface_name());
+  EXPECT_EQ(state.get_name(), hardware_interface::NamePool::get_name(state.get_name_id()));
+}
+
+TEST(TestHandle, loaned_interface_views)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  for (const bool lock_free : {false, true})
+  {
+    info.lock_free = lock_free;
+    info.data_type = "double";
+    info.initial_value = "1.5";
+    auto state = std::make_shared<StateInterface>(InterfaceDescription{JOINT_NAME, info});
+    auto command = std::make_shared<CommandInterface>(InterfaceDescription{JOINT_NAME, info});
+    hardware_interface::LoanedStateInterface loaned_state(state);
+    hardware_interface::LoanedCommandInterface loaned_command(command);
+
+    hardware_interface::LoanedStateView<double> state_view(loaned_state);
+    hardware_interface::LoanedCommandView<double> command_view(loaned_command);
+    ASSERT_TRUE(state_view.valid());
+    EXPECT_DOUBLE_EQ(state_view.get_optional().value(), 1.5);
+    ASSERT_TRUE(command_view.set(2.5));
+    EXPECT_DOUBLE_EQ(loaned_command.get_optional().value(), 2.5);
+    double value = 0.0;
+    ASSERT_TRUE(command_view.get(value));
+    EXPECT_DOUBLE_EQ(value, 2.5);
+
+    // the command limiter is applied as with set_value
+    command->set_on_set_command_limiter(
+      [](double value, bool & is_limited)
+      {
+        is_limited = value > 1.0;
+        return std::min(value, 1.0);
+      });
+    ASSERT_TRUE(command_view.set(3.0));
+    EXPECT_DOUBLE_EQ(command->get_optional().value(), 1.0);
+    EXPECT_TRUE(command->is_limited());
+
+    // the data type is checked once, when the view is created
+    EXPECT_THROW(
+      { hardware_interface::LoanedStateView<bool> bool_view(loaned_state); }, std::runtime_error);
+    EXPECT_THROW(
+      { hardware_interface::LoanedCommandView<int32_t> int_view(loaned_command); },
+      std::runtime_error);
+
+    info.data_type = "int32";
+    info.initial_value = "7";
+    auto int_state = std::make_shared<StateInterface>(InterfaceDescription{JOINT_NAME, info});
+    hardware_interface::LoanedStateInterface loaned_int_state(int_state);
+    hardware_interface::LoanedStateView<int32_t> int_view(loaned_int_state);
+    EXPECT_EQ(int_view.get_optional().value(), 7);
+  }
+  hardware_interface::LoanedStateView<double> empty_view;
+  EXPECT_FALSE(empty_view.valid());
+}
+
+TEST(TestHandle, loaned_state_view_of_a_locked_interface)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "double";
+  info.initial_value = "1.0";
+  auto state = std::make_shared<StateInterface>(InterfaceDescription{JOINT_NAME, info});
+  hardware_interface::LoanedStateInterface loaned_state(state);
+  hardware_interface::LoanedStateView<double> view(loaned_state);
+  {
+    std::unique_lock<std::shared_mutex> lock(state->get_mutex());
+    EXPECT_FALSE(view.get_optional().has_value());
+  }
+  EXPECT_DOUBLE_EQ(view.get_optional().value(), 1.0);
+}
+
+TEST(TestHandle, serial_access)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "double";
+  info.initial_value = "1.0";
+  CommandInterface handle{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_FALSE(handle.is_serial_access());
+  handle.enable_serial_access();
+  ASSERT_TRUE(handle.is_serial_access());
+
+  // the handle is not locked anymore for the values of type double
+  std::unique_lock<std::shared_mutex> lock(handle.get_mutex());
+  ASSERT_TRUE(handle.set_value(2.0));
+  EXPECT_DOUBLE_EQ(handle.get_optional().value(), 2.0);
+  double value = 0.0;
+  ASSERT_TRUE(handle.get_double_unchecked(value));
+  EXPECT_DOUBLE_EQ(value, 2.0);
+  lock.unlock();
+
+  info.data_type = "bool";
+  info.initial_value = "true";
+  CommandInterface bool_handle{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_THROW(bool_handle.enable_serial_access(), std::runtime_error);
+
+  info.data_type = "double";
+  info.initial_value = "1.0";
+  info.lock_free = true;
+  CommandInterface lock_free_handle{InterfaceDescription{JOINT_NAME, info}};
+  EXPECT_THROW(lock_free_handle.enable_serial_access(), std::runtime_error);
+}
+
+TEST(TestHandle, value_generation_counts_the_changes)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  for (const bool lock_free : {false, true})
+  {
+    info.lock_free = lock_free;
+    info.data_type = "double";
+    info.initial_value = "1.0";
+    auto command = std::make_shared<CommandInterface>(InterfaceDescription{JOINT_NAME, info});
+    ASSERT_TRUE(command->is_value_change_tracked());
+    const uint64_t initial_generation = command->get_value_generation();
+
+    ASSERT_TRUE(command->set_value(1.0));
+    EXPECT_EQ(command->get_value_generation(), initial_generation);
+    ASSERT_TRUE(command->set_value(2.0));
+    EXPECT_EQ(command->get_value_generation(), initial_generation + 1);
+    // the same NaN doesn't count as a change
+    ASSERT_TRUE(command->set_value(std::numeric_limits<double>::quiet_NaN()));
+    ASSERT_TRUE(command->set_value(std::numeric_limits<double>::quiet_NaN()));
+    EXPECT_EQ(command->get_value_generation(), initial_generation + 2);
+
+    hardware_interface::LoanedCommandInterface loaned_command(command);
+    hardware_interface::LoanedCommandView<double> command_view(loaned_command);
+    ASSERT_TRUE(command_view.set(3.0));
+    ASSERT_TRUE(command_view.set(3.0));
+    EXPECT_EQ(command->get_value_generation(), initial_generation + 3);
+
+    info.data_type = "bool";
+    info.initial_value = "false";
+    CommandInterface bool_command{InterfaceDescription{JOINT_NAME, info}};
+    const uint64_t bool_generation = bool_command.get_value_generation();
+    ASSERT_TRUE(bool_command.set_value(false));
+    ASSERT_TRUE(bool_command.set_value(true));
+    EXPECT_EQ(bool_command.get_value_generation(), bool_generation + 1);
+  }
+
+  info.lock_free = false;
+  info.data_type = "double";
+  info.initial_value = "1.0";
+  CommandInterface serial_command{InterfaceDescription{JOINT_NAME, info}};
+  serial_command.enable_serial_access();
+  ASSERT_TRUE(serial_command.set_double_unchecked(4.0));
+  EXPECT_EQ(serial_command.get_value_generation(), 1u);
+
+  // the generation moves with the handle
+  CommandInterface moved_command(std::move(serial_command));
+  EXPECT_EQ(moved_command.get_value_generation(), 1u);
+}
+
+TEST(TestHandle, revoked_loans_cannot_write)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  for (const bool lock_free : {false, true})
+  {
+    info.lock_free = lock_free;
+    info.data_type = "double";
+    info.initial_value = "1.0";
+    auto command = std::make_shared<CommandInterface>(InterfaceDescription{JOINT_NAME, info});
+    int released = 0;
+    hardware_interface::LoanWriteGate gate;
+    hardware_interface::LoanedCommandInterface loaned_command(
+      command, [&released]() { ++released; });
+    loaned_command.set_write_gate(&gate);
+    hardware_interface::LoanedCommandView<double> command_view(loaned_command);
+    ASSERT_FALSE(loaned_command.is_revoked());
+    ASSERT_TRUE(loaned_command.set_value(2.0));
+
+    // no write is in progress, the claim can be released at once
+    ASSERT_TRUE(gate.close());
+    loaned_command.release_claim();
+    EXPECT_EQ(released, 1);
+    EXPECT_TRUE(loaned_command.is_revoked());
+    EXPECT_FALSE(loaned_command.set_value(3.0));
+    EXPECT_FALSE(loaned_command.set_double_unchecked(3.0));
+    EXPECT_FALSE(command_view.set(3.0));
+    EXPECT_DOUBLE_EQ(loaned_command.get_optional().value(), 2.0);
+
+    // a new loan without a gate can write again
+    {
+      hardware_interface::LoanedCommandInterface new_loan(command);
+      EXPECT_FALSE(new_loan.is_revoked());
+      ASSERT_TRUE(new_loan.set_value(4.0));
+      EXPECT_TRUE(hardware_interface::LoanedCommandView<double>(new_loan).set(5.0));
+    }
+    EXPECT_FALSE(loaned_command.set_value(3.0));
+    EXPECT_DOUBLE_EQ(command->get_optional().value(), 5.0);
+    // the claim is not released again when the loan is destroyed
+    loaned_command.release_claim();
+    EXPECT_EQ(released, 1);
+
+    // the gate can be opened again for new loans
+    gate.open();
+    EXPECT_FALSE(loaned_command.is_revoked());
+    EXPECT_TRUE(loaned_command.set_value(6.0));
+  }
+}
+
+TEST(TestHandle, closing_a_write_gate_reports_the_writes_in_progress)
+{
+  hardware_interface::LoanWriteGate gate;
+  {
+    hardware_interface::LoanWriteGate::Write write(&gate);
+    ASSERT_TRUE(write.allowed());
+    EXPECT_FALSE(gate.close());
+    EXPECT_TRUE(gate.is_closed());
+    // the writes entering a closed gate aren't allowed
+    hardware_interface::LoanWriteGate::Write late_write(&gate);
+    EXPECT_FALSE(late_write.allowed());
+    EXPECT_FALSE(gate.close());
+  }
+  EXPECT_TRUE(gate.close());
+  // the loans without a gate are always writable
+  hardware_interface::LoanWriteGate::Write write(nullptr);
+  EXPECT_TRUE(write.allowed());
+}
+
+TEST(TestHandle, revoked_loans_never_write_after_the_revocation)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "double";
+  info.initial_value = "1.0";
+  for (const bool lock_free : {false, true})
+  {
+    info.lock_free = lock_free;
+    auto command = std::make_shared<CommandInterface>(InterfaceDescription{JOINT_NAME, info});
+    for (int i = 0; i < 100; ++i)
+    {
+      hardware_interface::LoanWriteGate gate;
+      hardware_interface::LoanedCommandInterface loaned_command(command);
+      loaned_command.set_write_gate(&gate);
+      hardware_interface::LoanedCommandView<double> command_view(loaned_command);
+      std::atomic_bool started{false};
+      std::atomic_bool stop{false};
+      std::thread writer(
+        [&]()
+        {
+          while (!stop)
+          {
+            (void)command_view.set(2.0);
+            (void)loaned_command.set_double_unchecked(3.0);
+            started = true;
+          }
+        });
+      while (!started)
+      {
+        std::this_thread::yield();
+      }
+      // the write in progress when the gate is closed is the last one of the loan
+      while (!gate.close())
+      {
+        std::this_thread::yield();
+      }
+      // the command written once the gate is closed is not overwritten by the running writes
+      EXPECT_TRUE(command->set_value(4.0));
+      std::this_thread::yield();
+      stop = true;
+      writer.join();
+      ASSERT_DOUBLE_EQ(command->get_optional().value(), 4.0);
+    }
+  }
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+TEST(TestHandle, value_changes_through_a_raw_pointer_are_not_tracked)
+{
+  double value = 1.0;
+  StateInterface state{JOINT_NAME, FOO_INTERFACE, &value};
+  EXPECT_FALSE(state.is_value_change_tracked());
+}
+
+TEST(TestHandle, array_interfaces)
+{
+  InterfaceInfo info;
+  info.name = "taxels";
+  info.data_type = "uint16_array";
+  info.size = 4;
+  info.initial_value = "7";
+  StateInterface state{InterfaceDescription("skin", info)};
+  ASSERT_EQ(state.get_data_type(), hardware_interface::HandleDataType::UINT16_ARRAY);
+  EXPECT_TRUE(state.get_data_type().is_array());
+  EXPECT_FALSE(state.is_castable_to_double());
+  EXPECT_TRUE(state.is_valid());
+  ASSERT_EQ(state.get_array_size(), 4u);
+
+  std::vector<uint16_t> values(4, 0);
+  ASSERT_TRUE(state.get_array(values.data(), values.size()));
+  EXPECT_THAT(values, ::testing::ElementsAre(7, 7, 7, 7));
+
+  // the generation is only incremented if a value changed
+  const uint64_t generation = state.get_value_generation();
+  values = {1, 2, 3, 4};
+  ASSERT_TRUE(state.set_array(values.data(), values.size()));
+  ASSERT_TRUE(state.set_array(values.data(), values.size()));
+  EXPECT_EQ(state.get_value_generation(), generation + 1);
+
+  ASSERT_TRUE(
+    state.write_array<uint16_t>(
+      [](hardware_interface::ArraySpan<uint16_t> array) { array[3] = 40; }));
+  EXPECT_EQ(state.get_value_generation(), generation + 2);
+  uint32_t sum = 0;
+  ASSERT_TRUE(
+    state.read_array<uint16_t>(
+      [&sum](hardware_interface::ArraySpan<const uint16_t> array)
+      {
+        for (const uint16_t value : array)
+        {
+          sum += value;
+        }
+      }));
+  EXPECT_EQ(sum, 46u);
+
+  // the copies own their values
+  StateInterface copy(state);
+  ASSERT_TRUE(copy.get_array(values.data(), values.size()));
+  EXPECT_THAT(values, ::testing::ElementsAre(1, 2, 3, 40));
+  ASSERT_TRUE(copy.set_array(values.data(), values.size()));
+
+  // the readers and writers of a locked array fail
+  {
+    std::unique_lock<std::shared_mutex> lock(state.get_mutex());
+    std::thread(
+      [&state, &values]()
+      {
+        EXPECT_FALSE(state.get_array(values.data(), values.size()));
+        EXPECT_FALSE(state.set_array(values.data(), values.size()));
+      })
+      .join();
+  }
+
+  EXPECT_THROW(std::ignore = state.get_array(values.data(), 3), std::runtime_error);
+  std::vector<double> doubles(4, 0.0);
+  EXPECT_THROW(std::ignore = state.get_array(doubles.data(), doubles.size()), std::runtime_error);
+  EXPECT_THROW(std::ignore = state.get_optional<double>(), std::runtime_error);
+  EXPECT_THROW(std::ignore = state.set_value(1.0), std::runtime_error);
+}
+
+TEST(TestHandle, array_interface_initial_values)
+{
+  InterfaceInfo info;
+  info.name = "forces";
+  info.data_type = "double_array";
+  info.size = 3;
+  CommandInterface command{InterfaceDescription("sensor", info)};
+  ASSERT_EQ(command.get_array_size(), 3u);
+  std::vector<double> values(3, 0.0);
+  ASSERT_TRUE(command.get_array(values.data(), values.size()));
+  EXPECT_TRUE(std::isnan(values[0]) && std::isnan(values[2]));
+
+  info.data_type = "float32_array";
+  info.initial_value = "0.5";
+  StateInterface state{InterfaceDescription("sensor", info)};
+  std::vector<float> floats(3, 0.0f);
+  ASSERT_TRUE(state.get_array(floats.data(), floats.size()));
+  EXPECT_THAT(floats, ::testing::Each(0.5f));
+
+  // the scalar interfaces aren't arrays
+  info.data_type = "double";
+  StateInterface scalar{InterfaceDescription("sensor", info)};
+  EXPECT_EQ(scalar.get_array_size(), 0u);
+  EXPECT_THROW(std::ignore = scalar.get_array(values.data(), 1), std::runtime_error);
+
+  info.data_type = "uint16_array";
+  info.initial_value = "seven";
+  EXPECT_THROW(StateInterface{InterfaceDescription("sensor", info)}, std::invalid_argument);
+
+  // the arrays are guarded by the handle mutex
+  info.initial_value = "";
+  info.lock_free = true;
+  EXPECT_THROW(StateInterface{InterfaceDescription("sensor", info)}, std::runtime_error);
+}
+
+TEST(TestHandle, bind_value_storage)
+{
+  InterfaceInfo info;
+  info.name = "position";
+  info.initial_value = "1.5";
+  StateInterface state{InterfaceDescription("joint1", info)};
+  ASSERT_TRUE(state.is_value_change_tracked());
+  ASSERT_TRUE(state.has_narrowable_value_storage());
+
+  double * storage = state.bind_value_storage();
+  ASSERT_NE(storage, nullptr);
+  EXPECT_TRUE(state.is_value_storage_bound());
+  EXPECT_EQ(*storage, 1.5);
+  // the value is accessed in place, its changes aren't counted anymore
+  *storage = 3.0;
+  EXPECT_EQ(state.get_optional().value(), 3.0);
+  EXPECT_FALSE(state.is_value_change_tracked());
+  EXPECT_FALSE(state.has_narrowable_value_storage());
+
+  info.data_type = "float32";
+  StateInterface float_state{InterfaceDescription("joint1", info)};
+  EXPECT_THROW(std::ignore = float_state.bind_value_storage(), std::runtime_error);
+  info.data_type = "double";
+  info.lock_free = true;
+  StateInterface lock_free_state{InterfaceDescription("joint1", info)};
+  EXPECT_THROW(std::ignore = lock_free_state.bind_value_storage(), std::runtime_error);
+}
+
+TEST(TestHandle, sample_batch_interfaces)
+{
+  InterfaceInfo info;
+  info.name = "linear_acceleration.x";
+  info.data_type = "double_samples";
+  info.size = 4;
+  StateInterface state{InterfaceDescription("imu", info)};
+  ASSERT_EQ(state.get_data_type(), hardware_interface::HandleDataType::DOUBLE_SAMPLES);
+  EXPECT_TRUE(state.get_data_type().is_sample_batch());
+  EXPECT_FALSE(state.is_castable_to_double());
+  EXPECT_TRUE(state.is_valid());
+  EXPECT_EQ(state.get_sample_capacity(), 4u);
+  EXPECT_EQ(state.get_array_size(), 0u);
+
+  // the samples of a cycle replace the samples of the previous one
+  const uint64_t generation = state.get_value_generation();
+  const std::vector<double> values = {1.0, 2.0, 3.0};
+  const std::vector<int64_t> stamps = {100, 200, 300};
+  ASSERT_TRUE(state.set_samples(values.data(), stamps.data(), values.size()));
+  ASSERT_TRUE(state.push_samples(values.data(), stamps.data(), 2));
+  EXPECT_EQ(state.get_value_generation(), generation + 2);
+  std::vector<double> read_values;
+  uint64_t dropped_samples = 0;
+  ASSERT_TRUE(
+    state.read_samples<double>(
+      [&](hardware_interface::SampleBatch<double> batch)
+      {
+        read_values.assign(batch.begin(), batch.end());
+        dropped_samples = batch.get_dropped_samples();
+      }));
+  EXPECT_THAT(read_values, ::testing::ElementsAre(2.0, 3.0, 1.0, 2.0));
+  EXPECT_EQ(dropped_samples, 1u);
+
+  // the copies own their samples
+  StateInterface copy(state);
+  ASSERT_TRUE(copy.clear_samples());
+  ASSERT_TRUE(
+    copy.read_samples<double>([](hardware_interface::SampleBatch<double> batch)
+                              { EXPECT_TRUE(batch.empty()); }));
+  ASSERT_TRUE(
+    state.read_samples<double>([](hardware_interface::SampleBatch<double> batch)
+                               { EXPECT_EQ(batch.size(), 4u); }));
+
+  // the readers and writers of a locked batch fail
+  {
+    std::unique_lock<std::shared_mutex> lock(state.get_mutex());
+    std::thread(
+      [&state, &values, &stamps]()
+      {
+        EXPECT_FALSE(state.read_samples<double>([](hardware_interface::SampleBatch<double>) {}));
+        EXPECT_FALSE(state.push_samples(values.data(), stamps.data(), 1));
+      })
+      .join();
+  }
+
+  EXPECT_THROW(
+    std::ignore = state.read_samples<float>([](hardware_interface::SampleBatch<float>) {}),
+    std::runtime_error);
+  EXPECT_THROW(std::ignore = state.get_optional<double>(), std::runtime_error);
+
+  // the scalar interfaces aren't sample batches
+  info.data_type = "double";
+  StateInterface scalar{InterfaceDescription("imu", info)};
+  EXPECT_EQ(scalar.get_sample_capacity(), 0u);
+  EXPECT_THROW(std::ignore = scalar.clear_samples(), std::runtime_error);
+
+  info.data_type = "float32_samples";
+  info.lock_free = true;
+  EXPECT_THROW(StateInterface{InterfaceDescription("imu", info)}, std::runtime_error);
+}
+#pragma GCC diagnostic pop
@@ -0,0 +1,92 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/hardware_component_statistics_table.hpp"
+
+using hardware_interface::HardwareComponentStatisticsData;
+using hardware_interface::HardwareComponentStatisticsTable;
+
+TEST(TestHardwareComponentStatisticsTable, reserved_slots_are_contiguous_and_aligned)
+{
+  HardwareComponentStatisticsTable table;
+  table.reserve(4);
+  ASSERT_EQ(table.get_capacity(), 4u);
+
+  std::vector<std::shared_ptr<HardwareComponentStatisticsData>> slots;
+  for (int i = 0; i < 4; ++i)
+  {
+    slots.push_back(table.acquire());
+  }
+  EXPECT_EQ(table.get_capacity(), 4u);
+  EXPECT_EQ(table.get_number_of_free_slots(), 0u);
+  const auto stride = reinterpret_cast<uintptr_t>(slots[1].get()) -
+                      reinterpret_cast<uintptr_t>(slots[0].get());
+  EXPECT_EQ(stride % 64, 0u);
+  for (std::size_t i = 0; i < slots.size(); ++i)
+  {
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(slots[i].get()) % 64, 0u);
+    EXPECT_EQ(
+      reinterpret_cast<uintptr_t>(slots[i].get()),
+      reinterpret_cast<uintptr_t>(slots[0].get()) + i * stride);
+  }
+}
+
+TEST(TestHardwareComponentStatisticsTable, released_slots_are_reset_and_reused)
+{
+  HardwareComponentStatisticsTable table;
+  table.reserve(1);
+  auto slot = table.acquire();
+  HardwareComponentStatisticsData * address = slot.get();
+  slot->allocations = 3;
+  slot->time_budget_overruns = 2;
+  slot.reset();
+  EXPECT_EQ(table.get_number_of_free_slots(), 1u);
+
+  slot = table.acquire();
+  EXPECT_EQ(slot.get(), address);
+  EXPECT_EQ(slot->allocations, 0u);
+  EXPECT_EQ(slot->time_budget_overruns, 0u);
+  EXPECT_EQ(table.get_capacity(), 1u);
+}
+
+TEST(TestHardwareComponentStatisticsTable, grows_without_moving_the_acquired_slots)
+{
+  HardwareComponentStatisticsTable table;
+  auto first = table.acquire();
+  first->allocations = 5;
+  std::vector<std::shared_ptr<HardwareComponentStatisticsData>> slots;
+  for (int i = 0; i < 20; ++i)
+  {
+    slots.push_back(table.acquire());
+  }
+  EXPECT_GE(table.get_capacity(), 21u);
+  EXPECT_EQ(first->allocations, 5u);
+}
+
+TEST(TestHardwareComponentStatisticsTable, slots_outlive_the_table)
+{
+  std::shared_ptr<HardwareComponentStatisticsData> slot;
+  {
+    HardwareComponentStatisticsTable table;
+    slot = table.acquire();
+  }
+  slot->allocations = 1;
+  EXPECT_EQ(slot->allocations, 1u);
+  slot.reset();
+}
@@ -180,6 +180,16 @@ public:
     return hardware_interface::return_type::OK;
   }
 
+  hardware_interface::return_type abort_command_mode_switch(
+    const std::vector<std::string> & /*start_interfaces*/,
+    const std::vector<std::string> & /*stop_interfaces*/) override
+  {
+    double accel = 0.0;
+    std::ignore = acceleration_state_interfaces_[0]->get_value(accel, true);
+    std::ignore = acceleration_state_interfaces_[0]->set_value(accel + 1000.0, true);
+    return hardware_interface::return_type::OK;
+  }
+
   hardware_interface::return_type perform_command_mode_switch(
     const std::vector<std::string> & start_interfaces,
     const std::vector<std::string> & /*stop_interfaces*/) override
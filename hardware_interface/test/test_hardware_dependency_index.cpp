@@ -0,0 +1,115 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include "hardware_interface/hardware_dependency_index.hpp"
+
+using hardware_interface::ComponentInterfaces;
+using hardware_interface::HardwareDependencyIndex;
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+class TestHardwareDependencyIndex : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    index_.set_components(
+      {ComponentInterfaces{"actuator", {"joint1/effort"}, {"joint1/position", "joint1/velocity"}},
+       ComponentInterfaces{"sensor", {}, {"sensor1/force"}},
+       ComponentInterfaces{"system", {"joint2/position"}, {"joint2/position"}}});
+  }
+
+  HardwareDependencyIndex index_;
+};
+
+TEST_F(TestHardwareDependencyIndex, resolves_the_components_of_the_controllers)
+{
+  const auto controller = index_.add_controller_interfaces(
+    "controller", {"joint1/effort", "joint2/position"}, {"joint1/position"});
+  const auto broadcaster =
+    index_.add_controller_interfaces("broadcaster", {}, {"joint2/position", "sensor1/force"});
+  EXPECT_EQ(index_.get_number_of_controllers(), 2u);
+  EXPECT_EQ(index_.get_controller_name(controller), "controller");
+  EXPECT_EQ(index_.find_controller("broadcaster"), broadcaster);
+  EXPECT_EQ(index_.find_component("system"), 2u);
+  EXPECT_FALSE(index_.find_component("unknown").has_value());
+  EXPECT_EQ(index_.find_interface_owner("joint1/velocity"), 0u);
+  EXPECT_EQ(index_.find_interface_owner("sensor1/force"), 1u);
+  EXPECT_EQ(index_.find_interface_owner("joint2/position"), 2u);
+  EXPECT_FALSE(index_.find_interface_owner("unknown/position").has_value());
+
+  EXPECT_THAT(index_.get_components_of_controller(controller), ElementsAre(0u, 2u));
+  EXPECT_THAT(index_.get_components_of_controller(broadcaster), ElementsAre(2u, 1u));
+  EXPECT_THAT(index_.get_controllers_of_component(0), ElementsAre(controller));
+  EXPECT_THAT(index_.get_controllers_of_component(2), ElementsAre(controller, broadcaster));
+  // the state interface of the system has the name of its command interface
+  EXPECT_THAT(index_.get_command_controllers_of_component(2), ElementsAre(controller));
+  EXPECT_THAT(index_.get_command_controllers_of_component(1), IsEmpty());
+
+  // the interfaces accumulate and an unknown interface adds no dependency
+  EXPECT_EQ(
+    index_.add_controller_interfaces("broadcaster", {}, {"joint1/velocity", "unknown/position"}),
+    broadcaster);
+  EXPECT_THAT(index_.get_controllers_of_component(0), ElementsAre(controller, broadcaster));
+  EXPECT_THAT(
+    index_.get_controller_state_interfaces(broadcaster),
+    ElementsAre("joint2/position", "sensor1/force", "joint1/velocity", "unknown/position"));
+
+  EXPECT_THAT(index_.get_controllers_of_component(3), IsEmpty());
+  EXPECT_THAT(index_.get_components_of_controller(7), IsEmpty());
+  EXPECT_EQ(index_.get_controller_name(7), "");
+}
+
+TEST_F(TestHardwareDependencyIndex, reuses_the_indices_of_the_removed_controllers)
+{
+  const auto first = index_.add_controller_interfaces("first", {"joint1/effort"}, {});
+  const auto second = index_.add_controller_interfaces("second", {"joint1/effort"}, {});
+  EXPECT_FALSE(index_.remove_controller("unknown"));
+  ASSERT_TRUE(index_.remove_controller("first"));
+  EXPECT_FALSE(index_.find_controller("first").has_value());
+  EXPECT_EQ(index_.get_controller_name(first), "");
+  EXPECT_THAT(index_.get_command_controllers_of_component(0), ElementsAre(second));
+
+  const auto third = index_.add_controller_interfaces("third", {}, {"sensor1/force"});
+  EXPECT_EQ(third, first);
+  EXPECT_THAT(index_.get_controllers_of_component(0), ElementsAre(second));
+  EXPECT_THAT(index_.get_controllers_of_component(1), ElementsAre(third));
+  EXPECT_EQ(index_.get_number_of_controllers(), 2u);
+}
+
+TEST_F(TestHardwareDependencyIndex, keeps_the_controllers_when_the_components_change)
+{
+  const auto controller =
+    index_.add_controller_interfaces("controller", {"joint2/position"}, {"sensor1/force"});
+  // the sensor is unloaded and the system moves to its index
+  index_.set_components(
+    {ComponentInterfaces{"actuator", {"joint1/effort"}, {"joint1/position"}},
+     ComponentInterfaces{"system", {"joint2/position"}, {"joint2/position"}}});
+  EXPECT_THAT(index_.get_components_of_controller(controller), ElementsAre(1u));
+  EXPECT_THAT(index_.get_command_controllers_of_component(1), ElementsAre(controller));
+  EXPECT_EQ(index_.get_component_name(2), "");
+
+  // the controller uses the sensor again once it is reloaded
+  index_.set_components(
+    {ComponentInterfaces{"sensor", {}, {"sensor1/force"}},
+     ComponentInterfaces{"system", {"joint2/position"}, {"joint2/position"}}});
+  EXPECT_THAT(index_.get_components_of_controller(controller), ElementsAre(1u, 0u));
+  EXPECT_THAT(index_.get_controllers_of_component(0), ElementsAre(controller));
+  EXPECT_THAT(index_.get_command_controllers_of_component(0), IsEmpty());
+}
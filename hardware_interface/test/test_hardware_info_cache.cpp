@@ -0,0 +1,185 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/component_parser.hpp"
+#include "hardware_interface/hardware_info_cache.hpp"
+#include "ros2_control_test_assets/descriptions.hpp"
+
+using hardware_interface::HardwareInfo;
+using hardware_interface::HardwareInfoCache;
+
+namespace
+{
+HardwareInfo make_hardware_info()
+{
+  HardwareInfo info;
+  info.name = "system";
+  info.type = "system";
+  info.group = "group";
+  info.bus = "ethercat0";
+  info.bus_plugin_name = "test_bus/TestBus";
+  info.rw_rate = 500;
+  info.rw_phase = 1;
+  info.time_budget_us = 150.0;
+  info.time_budget_policy = hardware_interface::TimeBudgetPolicy::SKIP_NEXT_CYCLE;
+  info.statistics_type = "window:1000";
+  info.criticality = hardware_interface::Criticality::AUXILIARY;
+  info.is_async = true;
+  info.async_params.thread_priority = 40;
+  info.async_params.cpu_affinity_cores = {2, 3};
+  info.async_params.control_loop = "whole_body";
+  info.hardware_plugin_name = "test_plugin/System";
+  info.hardware_parameters = {{"port", "/dev/ttyUSB0"}, {"baud", "115200"}};
+
+  hardware_interface::ComponentInfo joint;
+  joint.name = "joint1";
+  joint.type = "joint";
+  joint.is_mimic = hardware_interface::MimicAttribute::FALSE;
+  hardware_interface::InterfaceInfo position;
+  position.name = "position";
+  position.min = "-1.0";
+  position.max = "1.0";
+  position.size = 1;
+  position.enable_limits = true;
+  position.parameters = {{"register", "12"}};
+  joint.command_interfaces.push_back(position);
+  joint.state_interfaces.push_back(position);
+  info.joints.push_back(joint);
+  info.mimic_joints.push_back({1, 0, -2.0, 0.5});
+  info.gpios.push_back(joint);
+
+  hardware_interface::TransmissionInfo transmission;
+  transmission.name = "transmission1";
+  transmission.type = "transmission_interface/SimpleTransmission";
+  transmission.joints.push_back({"joint1", {"position"}, {"position"}, "role1", 10.0, 0.1, false});
+  transmission.actuators.push_back({"actuator1", {"position"}, {}, "role1", 2.0, 0.0, true});
+  transmission.parameters = {{"key", "value"}};
+  info.transmissions.push_back(transmission);
+
+  info.original_xml = "<ros2_control name=\"system\"/>";
+  info.limits["joint1"].has_velocity_limits = true;
+  info.limits["joint1"].max_velocity = 2.5;
+  info.soft_limits["joint1"].k_position = 10.0;
+  return info;
+}
+
+/// Cache in a new temporary directory, removed at the end of the test
+class HardwareInfoCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    directory_ = std::filesystem::temp_directory_path() /
+                 ("hardware_info_cache_test_" +
+                  std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  std::filesystem::path directory_;
+};
+}  // namespace
+
+TEST(TestHardwareInfoSerialization, round_trip_keeps_all_the_fields)
+{
+  std::vector<HardwareInfo> infos = {make_hardware_info(), make_hardware_info()};
+  infos[1].name = "system2";
+  infos[1].joints.clear();
+  const auto data = hardware_interface::serialize_hardware_info(infos);
+  const auto result = hardware_interface::deserialize_hardware_info(data.data(), data.size());
+  ASSERT_EQ(2u, result.size());
+  EXPECT_EQ(data, hardware_interface::serialize_hardware_info(result));
+
+  const auto & info = result[0];
+  EXPECT_EQ("group", info.group);
+  EXPECT_EQ("ethercat0", info.bus);
+  EXPECT_EQ("test_bus/TestBus", info.bus_plugin_name);
+  EXPECT_EQ(500u, info.rw_rate);
+  EXPECT_EQ(hardware_interface::TimeBudgetPolicy::SKIP_NEXT_CYCLE, info.time_budget_policy);
+  EXPECT_EQ("window:1000", info.statistics_type);
+  EXPECT_EQ(hardware_interface::Criticality::AUXILIARY, info.criticality);
+  EXPECT_THAT(info.async_params.cpu_affinity_cores, testing::ElementsAre(2, 3));
+  EXPECT_EQ("whole_body", info.async_params.control_loop);
+  EXPECT_EQ("/dev/ttyUSB0", info.hardware_parameters.at("port"));
+  ASSERT_EQ(1u, info.joints.size());
+  EXPECT_EQ(hardware_interface::MimicAttribute::FALSE, info.joints[0].is_mimic);
+  EXPECT_EQ("12", info.joints[0].command_interfaces[0].parameters.at("register"));
+  ASSERT_EQ(1u, info.mimic_joints.size());
+  EXPECT_DOUBLE_EQ(-2.0, info.mimic_joints[0].multiplier);
+  ASSERT_EQ(1u, info.transmissions.size());
+  EXPECT_DOUBLE_EQ(10.0, info.transmissions[0].joints[0].mechanical_reduction);
+  EXPECT_TRUE(info.transmissions[0].actuators[0].read_only);
+  EXPECT_DOUBLE_EQ(2.5, info.limits.at("joint1").max_velocity);
+  EXPECT_DOUBLE_EQ(10.0, info.soft_limits.at("joint1").k_position);
+}
+
+TEST(TestHardwareInfoSerialization, rejects_truncated_data)
+{
+  const auto data = hardware_interface::serialize_hardware_info({make_hardware_info()});
+  for (const std::size_t size : {std::size_t(0), std::size_t(4), data.size() / 2, data.size() - 1})
+  {
+    EXPECT_THROW(
+      hardware_interface::deserialize_hardware_info(data.data(), size), std::runtime_error);
+  }
+  EXPECT_THROW(
+    hardware_interface::deserialize_hardware_info((data + "x").data(), data.size() + 1),
+    std::runtime_error);
+}
+
+TEST_F(HardwareInfoCacheTest, stores_and_loads_the_parsed_urdf)
+{
+  const HardwareInfoCache cache(directory_.string());
+  const auto & urdf = ros2_control_test_assets::minimal_robot_urdf;
+  std::vector<HardwareInfo> infos;
+  EXPECT_FALSE(cache.load(urdf, infos));
+
+  const auto parsed = cache.parse_control_resources_from_urdf(urdf);
+  EXPECT_EQ(
+    hardware_interface::serialize_hardware_info(
+      hardware_interface::parse_control_resources_from_urdf(urdf)),
+    hardware_interface::serialize_hardware_info(parsed));
+  EXPECT_TRUE(std::filesystem::exists(cache.get_file_path(urdf)));
+
+  ASSERT_TRUE(cache.load(urdf, infos));
+  EXPECT_EQ(
+    hardware_interface::serialize_hardware_info(parsed),
+    hardware_interface::serialize_hardware_info(infos));
+  // another robot description is not in the cache
+  EXPECT_FALSE(cache.load(urdf + " ", infos));
+}
+
+TEST_F(HardwareInfoCacheTest, ignores_invalid_cache_files)
+{
+  const HardwareInfoCache cache(directory_.string());
+  const auto & urdf = ros2_control_test_assets::minimal_robot_urdf;
+  std::filesystem::create_directories(directory_);
+  std::ofstream(cache.get_file_path(urdf), std::ios::binary) << "not a cache file";
+
+  std::vector<HardwareInfo> infos;
+  EXPECT_FALSE(cache.load(urdf, infos));
+  const auto parsed = cache.parse_control_resources_from_urdf(urdf);
+  EXPECT_FALSE(parsed.empty());
+  // the invalid file is replaced
+  EXPECT_TRUE(cache.load(urdf, infos));
+  EXPECT_EQ(parsed.size(), infos.size());
+}
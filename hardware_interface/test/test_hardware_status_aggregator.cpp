@@ -0,0 +1,141 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "control_msgs/msg/generic_state.hpp"
+#include "gmock/gmock.h"
+#include "hardware_interface/hardware_status_aggregator.hpp"
+#include "rclcpp/node.hpp"
+
+using control_msgs::msg::GenericState;
+using hardware_interface::HardwareStatusAggregator;
+using hardware_interface::HardwareStatusSource;
+
+namespace
+{
+control_msgs::msg::HardwareStatus make_template(
+  const std::string & hardware_id, const std::vector<std::string> & device_ids)
+{
+  control_msgs::msg::HardwareStatus msg;
+  msg.hardware_id = hardware_id;
+  msg.hardware_device_states.resize(device_ids.size());
+  for (std::size_t i = 0; i < device_ids.size(); ++i)
+  {
+    msg.hardware_device_states[i].device_id = device_ids[i];
+    msg.hardware_device_states[i].generic_hardware_status.resize(1);
+  }
+  return msg;
+}
+}  // namespace
+
+class TestHardwareStatusAggregator : public ::testing::Test
+{
+protected:
+  /// Creates a source whose devices report the health in health_
+  std::shared_ptr<HardwareStatusSource> make_source(
+    const std::string & name, double publish_rate, const std::vector<std::string> & device_ids)
+  {
+    return std::make_shared<HardwareStatusSource>(
+      name, publish_rate, make_template(name, device_ids),
+      [this](control_msgs::msg::HardwareStatus & msg)
+      {
+        ++updates_;
+        for (auto & device_state : msg.hardware_device_states)
+        {
+          device_state.generic_hardware_status[0].health_status = health_;
+        }
+        return hardware_interface::return_type::OK;
+      });
+  }
+
+  rclcpp::Node::SharedPtr node_ = std::make_shared<rclcpp::Node>("test_hardware_status_aggregator");
+  uint8_t health_ = GenericState::HEALTH_OK;
+  std::size_t updates_ = 0;
+};
+
+TEST_F(TestHardwareStatusAggregator, aggregates_the_device_states_of_all_sources)
+{
+  HardwareStatusAggregator aggregator(node_, 0.0);
+  aggregator.set_sources(
+    {make_source("arm", 0.0, {"joint1", "joint2"}), make_source("gripper", 0.0, {"finger"})});
+  ASSERT_EQ(aggregator.get_number_of_sources(), 2u);
+
+  health_ = GenericState::HEALTH_ERROR;
+  aggregator.publish(rclcpp::Time(1, 0));
+  const auto & msg = aggregator.get_message();
+  EXPECT_EQ(msg.hardware_id, "test_hardware_status_aggregator");
+  EXPECT_EQ(rclcpp::Time(msg.header.stamp), rclcpp::Time(1, 0));
+  ASSERT_EQ(msg.hardware_device_states.size(), 3u);
+  EXPECT_EQ(msg.hardware_device_states[0].device_id, "arm/joint1");
+  EXPECT_EQ(msg.hardware_device_states[1].device_id, "arm/joint2");
+  EXPECT_EQ(msg.hardware_device_states[2].device_id, "gripper/finger");
+  for (const auto & device_state : msg.hardware_device_states)
+  {
+    EXPECT_EQ(device_state.generic_hardware_status[0].health_status, GenericState::HEALTH_ERROR);
+  }
+}
+
+TEST_F(TestHardwareStatusAggregator, copies_only_the_changed_device_states)
+{
+  HardwareStatusAggregator aggregator(node_, 0.0);
+  aggregator.set_sources({make_source("arm", 0.0, {"joint1", "joint2"})});
+
+  health_ = GenericState::HEALTH_ERROR;
+  aggregator.publish(rclcpp::Time(1, 0));
+  EXPECT_EQ(aggregator.get_changed_device_states(), 2u);
+  aggregator.publish(rclcpp::Time(2, 0));
+  EXPECT_EQ(aggregator.get_changed_device_states(), 0u);
+  // the prefixed ids are kept when the unchanged states are compared
+  EXPECT_EQ(aggregator.get_message().hardware_device_states[1].device_id, "arm/joint2");
+}
+
+TEST_F(TestHardwareStatusAggregator, updates_the_sources_at_their_rate)
+{
+  HardwareStatusAggregator aggregator(node_, 0.0);
+  aggregator.set_sources({make_source("arm", 10.0, {"joint1"})});
+
+  for (int64_t time_ms = 0; time_ms < 1000; time_ms += 20)
+  {
+    aggregator.publish(rclcpp::Time(time_ms * 1000000));
+  }
+  EXPECT_EQ(updates_, 10u);
+}
+
+TEST_F(TestHardwareStatusAggregator, keeps_the_last_status_of_a_detached_source)
+{
+  HardwareStatusAggregator aggregator(node_, 0.0);
+  auto source = make_source("arm", 0.0, {"joint1"});
+  aggregator.set_sources({source});
+  aggregator.publish(rclcpp::Time(1, 0));
+
+  source->detach();
+  health_ = GenericState::HEALTH_ERROR;
+  aggregator.publish(rclcpp::Time(2, 0));
+  EXPECT_EQ(updates_, 1u);
+  EXPECT_EQ(
+    aggregator.get_message().hardware_device_states[0].generic_hardware_status[0].health_status,
+    GenericState::HEALTH_OK);
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleMock(&argc, argv);
+  const int result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
@@ -0,0 +1,75 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <thread>
+
+#include "hardware_interface/instrumentation_clock.hpp"
+
+using hardware_interface::InstrumentationClock;
+using namespace std::chrono_literals;
+
+class TestInstrumentationClock : public ::testing::Test
+{
+protected:
+  void TearDown() override { InstrumentationClock::use_steady_clock(); }
+};
+
+TEST_F(TestInstrumentationClock, reads_the_steady_clock_by_default)
+{
+  EXPECT_FALSE(InstrumentationClock::is_using_cpu_counter());
+  const auto before = std::chrono::steady_clock::now();
+  const auto sample = InstrumentationClock::now();
+  EXPECT_LE(before, sample);
+  EXPECT_LE(sample, std::chrono::steady_clock::now());
+}
+
+TEST_F(TestInstrumentationClock, cpu_counter_follows_the_steady_clock)
+{
+  if (!InstrumentationClock::use_cpu_counter())
+  {
+    GTEST_SKIP() << "The CPU has no invariant counter";
+  }
+  EXPECT_TRUE(InstrumentationClock::is_using_cpu_counter());
+  EXPECT_GT(InstrumentationClock::get_counter_frequency(), 0.0);
+
+  // the samples are comparable with the steady clock, within the error of the calibration
+  const auto steady_start = std::chrono::steady_clock::now();
+  const auto start = InstrumentationClock::now();
+  EXPECT_LT(std::chrono::abs(start - steady_start), 1ms);
+
+  std::this_thread::sleep_for(10ms);
+  const auto elapsed = InstrumentationClock::now() - start;
+  const auto steady_elapsed = std::chrono::steady_clock::now() - steady_start;
+  EXPECT_GE(elapsed, 10ms);
+  EXPECT_LT(std::chrono::abs(elapsed - steady_elapsed), 100us);
+
+  // the samples never go backwards
+  auto previous = InstrumentationClock::now();
+  for (int i = 0; i < 1000; ++i)
+  {
+    const auto sample = InstrumentationClock::now();
+    EXPECT_LE(previous, sample);
+    previous = sample;
+  }
+}
+
+TEST_F(TestInstrumentationClock, switches_back_to_the_steady_clock)
+{
+  InstrumentationClock::use_cpu_counter();
+  InstrumentationClock::use_steady_clock();
+  EXPECT_FALSE(InstrumentationClock::is_using_cpu_counter());
+}
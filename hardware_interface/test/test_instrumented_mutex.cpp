@@ -0,0 +1,100 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "hardware_interface/instrumented_mutex.hpp"
+
+using hardware_interface::InstrumentedRecursiveMutex;
+using namespace std::chrono_literals;
+
+TEST(TestInstrumentedMutex, counts_the_outermost_locks_of_a_thread)
+{
+  InstrumentedRecursiveMutex mutex;
+  {
+    std::lock_guard<InstrumentedRecursiveMutex> guard(mutex);
+    std::lock_guard<InstrumentedRecursiveMutex> nested_guard(mutex);
+    ASSERT_TRUE(mutex.try_lock());
+    EXPECT_EQ(
+      mutex.get_statistics().owner_thread, InstrumentedRecursiveMutex::get_current_thread_id());
+    mutex.unlock();
+  }
+  const auto statistics = mutex.get_statistics();
+  EXPECT_EQ(statistics.locks, 1u);
+  EXPECT_EQ(statistics.contended_locks, 0u);
+  EXPECT_EQ(statistics.try_lock_failures, 0u);
+  EXPECT_EQ(statistics.owner_thread, 0);
+  EXPECT_EQ(statistics.last_blocking_thread, 0);
+}
+
+TEST(TestInstrumentedMutex, records_the_thread_blocking_a_try_lock)
+{
+  InstrumentedRecursiveMutex mutex;
+  std::atomic<bool> locked{false};
+  std::atomic<bool> release{false};
+  std::atomic<int64_t> holder_thread{0};
+  std::thread holder(
+    [&]()
+    {
+      std::lock_guard<InstrumentedRecursiveMutex> guard(mutex);
+      holder_thread = InstrumentedRecursiveMutex::get_current_thread_id();
+      locked = true;
+      while (!release)
+      {
+        std::this_thread::sleep_for(1ms);
+      }
+      std::this_thread::sleep_for(20ms);
+    });
+  while (!locked)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_FALSE(mutex.try_lock());
+  EXPECT_FALSE(mutex.try_lock());
+  auto statistics = mutex.get_statistics();
+  EXPECT_EQ(statistics.try_lock_failures, 2u);
+  EXPECT_EQ(statistics.last_blocking_thread, holder_thread.load());
+  EXPECT_EQ(statistics.owner_thread, holder_thread.load());
+  EXPECT_NE(statistics.owner_thread, InstrumentedRecursiveMutex::get_current_thread_id());
+
+  // the lock waits for the holder to release the mutex
+  release = true;
+  {
+    std::lock_guard<InstrumentedRecursiveMutex> guard(mutex);
+  }
+  holder.join();
+  statistics = mutex.get_statistics();
+  EXPECT_EQ(statistics.locks, 2u);
+  EXPECT_EQ(statistics.contended_locks, 1u);
+  EXPECT_GT(statistics.max_wait_time, 10ms);
+  EXPECT_GT(statistics.max_hold_time, 10ms);
+}
+
+TEST(TestInstrumentedMutex, works_with_the_standard_multiple_locks)
+{
+  InstrumentedRecursiveMutex first_mutex;
+  InstrumentedRecursiveMutex second_mutex;
+  {
+    std::scoped_lock guard(first_mutex, second_mutex);
+    EXPECT_NE(first_mutex.get_statistics().owner_thread, 0);
+    EXPECT_NE(second_mutex.get_statistics().owner_thread, 0);
+  }
+  EXPECT_EQ(first_mutex.get_statistics().owner_thread, 0);
+  EXPECT_EQ(second_mutex.get_statistics().locks, 1u);
+}
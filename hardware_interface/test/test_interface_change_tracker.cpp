@@ -0,0 +1,88 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/interface_change_tracker.hpp"
+
+using hardware_interface::InterfaceChangeTracker;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceInfo;
+using hardware_interface::StateInterface;
+using ::testing::ElementsAre;
+
+namespace
+{
+std::shared_ptr<StateInterface> make_state(const std::string & name)
+{
+  InterfaceInfo info;
+  info.name = name;
+  info.data_type = "double";
+  info.initial_value = "0.0";
+  return std::make_shared<StateInterface>(InterfaceDescription{"joint_1", info});
+}
+
+std::vector<std::size_t> collect_changed(InterfaceChangeTracker & tracker)
+{
+  std::vector<std::size_t> changed;
+  tracker.for_each_changed(
+    [&changed](std::size_t index, const hardware_interface::Handle &)
+    { changed.push_back(index); });
+  return changed;
+}
+}  // namespace
+
+TEST(TestInterfaceChangeTracker, reports_only_the_changed_interfaces)
+{
+  auto position = make_state("position");
+  auto velocity = make_state("velocity");
+  auto effort = make_state("effort");
+  InterfaceChangeTracker tracker({position, velocity, effort});
+  ASSERT_EQ(tracker.size(), 3u);
+
+  // all the interfaces are reported at the first call
+  EXPECT_THAT(collect_changed(tracker), ElementsAre(0u, 1u, 2u));
+  EXPECT_TRUE(collect_changed(tracker).empty());
+
+  ASSERT_TRUE(velocity->set_value(1.0));
+  EXPECT_TRUE(tracker.has_changed(1));
+  EXPECT_FALSE(tracker.has_changed(0));
+  EXPECT_THAT(collect_changed(tracker), ElementsAre(1u));
+
+  // setting the same value is not a change
+  ASSERT_TRUE(velocity->set_value(1.0));
+  ASSERT_TRUE(effort->set_value(2.0));
+  EXPECT_THAT(collect_changed(tracker), ElementsAre(2u));
+  EXPECT_EQ(&tracker.get_handle(2), effort.get());
+
+  tracker.reset();
+  EXPECT_THAT(collect_changed(tracker), ElementsAre(0u, 1u, 2u));
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+TEST(TestInterfaceChangeTracker, reports_the_untracked_interfaces_at_every_call)
+{
+  double value = 1.0;
+  auto legacy_state = std::make_shared<StateInterface>("joint_1", "position", &value);
+  InterfaceChangeTracker tracker({legacy_state, make_state("velocity")});
+
+  EXPECT_THAT(collect_changed(tracker), ElementsAre(0u, 1u));
+  EXPECT_THAT(collect_changed(tracker), ElementsAre(0u));
+}
+#pragma GCC diagnostic pop
@@ -0,0 +1,226 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/interface_flight_recorder.hpp"
+#include "rclcpp/logging.hpp"
+
+using hardware_interface::CommandInterface;
+using hardware_interface::FlightRecording;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceFlightRecorder;
+using hardware_interface::InterfaceInfo;
+using hardware_interface::StateInterface;
+using testing::ElementsAre;
+
+namespace
+{
+InterfaceDescription make_description(const std::string & prefix, const std::string & name)
+{
+  InterfaceInfo info;
+  info.name = name;
+  info.data_type = "double";
+  return InterfaceDescription(prefix, info);
+}
+}  // namespace
+
+class TestInterfaceFlightRecorder : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    joint1_position_ = std::make_shared<StateInterface>(make_description("joint1", "position"));
+    joint1_velocity_ = std::make_shared<StateInterface>(make_description("joint1", "velocity"));
+    joint1_command_ = std::make_shared<CommandInterface>(make_description("joint1", "position"));
+    // the files are unique per process, so that parallel test runs don't interfere
+    directory_ = std::filesystem::temp_directory_path() /
+                 ("test_flight_recorder_" + std::to_string(getpid()));
+    std::filesystem::create_directories(directory_);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  /// Records a cycle with the position, velocity and command set from the cycle number
+  void record_cycle(InterfaceFlightRecorder & recorder, uint64_t cycle)
+  {
+    const double value = static_cast<double>(cycle);
+    ASSERT_TRUE(joint1_position_->set_value(value));
+    ASSERT_TRUE(joint1_velocity_->set_value(10.0 * value));
+    ASSERT_TRUE(joint1_command_->set_value(100.0 * value));
+    recorder.record_states(static_cast<int64_t>(1000 * cycle), cycle);
+    recorder.record_commands(static_cast<int64_t>(1000 * cycle + 500));
+  }
+
+  StateInterface::SharedPtr joint1_position_;
+  StateInterface::SharedPtr joint1_velocity_;
+  CommandInterface::SharedPtr joint1_command_;
+  std::filesystem::path directory_;
+};
+
+TEST_F(TestInterfaceFlightRecorder, cycles_are_drained_column_by_column)
+{
+  InterfaceFlightRecorder recorder;
+  recorder.configure({joint1_position_, joint1_velocity_}, {joint1_command_}, 8);
+  ASSERT_EQ(3u, recorder.get_number_of_interfaces());
+
+  FlightRecording recording = recorder.make_recording();
+  EXPECT_THAT(
+    recording.interface_names,
+    ElementsAre("joint1/position", "joint1/velocity", "joint1/position"));
+  EXPECT_EQ(2u, recording.number_of_state_interfaces);
+  EXPECT_EQ(0u, recorder.drain(recording));
+
+  for (uint64_t cycle = 1; cycle <= 3; ++cycle)
+  {
+    record_cycle(recorder, cycle);
+  }
+  EXPECT_EQ(3u, recorder.get_recorded_cycles());
+  ASSERT_EQ(3u, recorder.drain(recording));
+  EXPECT_THAT(recording.cycles, ElementsAre(1u, 2u, 3u));
+  EXPECT_THAT(recording.read_stamps_ns, ElementsAre(1000, 2000, 3000));
+  EXPECT_THAT(recording.write_stamps_ns, ElementsAre(1500, 2500, 3500));
+  EXPECT_THAT(recording.columns[0], ElementsAre(1.0, 2.0, 3.0));
+  EXPECT_THAT(recording.columns[1], ElementsAre(10.0, 20.0, 30.0));
+  EXPECT_THAT(recording.columns[2], ElementsAre(100.0, 200.0, 300.0));
+
+  // only the new cycles are drained
+  EXPECT_EQ(0u, recorder.drain(recording));
+  record_cycle(recorder, 4);
+  EXPECT_EQ(1u, recorder.drain(recording));
+  EXPECT_THAT(recording.cycles, ElementsAre(1u, 2u, 3u, 4u));
+  EXPECT_EQ(0u, recorder.get_dropped_cycles());
+}
+
+TEST_F(TestInterfaceFlightRecorder, oldest_cycles_are_overwritten)
+{
+  InterfaceFlightRecorder recorder;
+  recorder.configure({joint1_position_}, {joint1_command_}, 4);
+  for (uint64_t cycle = 0; cycle < 10; ++cycle)
+  {
+    record_cycle(recorder, cycle);
+  }
+
+  // the slot of the cycle in progress is not part of the buffer
+  const FlightRecording snapshot = recorder.snapshot();
+  EXPECT_THAT(snapshot.cycles, ElementsAre(7u, 8u, 9u));
+  EXPECT_THAT(snapshot.columns[1], ElementsAre(700.0, 800.0, 900.0));
+
+  FlightRecording recording = recorder.make_recording();
+  EXPECT_EQ(3u, recorder.drain(recording));
+  EXPECT_THAT(recording.cycles, ElementsAre(7u, 8u, 9u));
+  EXPECT_EQ(7u, recorder.get_dropped_cycles());
+}
+
+TEST_F(TestInterfaceFlightRecorder, drained_cycles_are_consistent_while_recording)
+{
+  InterfaceFlightRecorder recorder;
+  recorder.configure({joint1_position_, joint1_velocity_}, {joint1_command_}, 16);
+  constexpr uint64_t number_of_cycles = 20000;
+  std::thread recording_thread(
+    [&]()
+    {
+      for (uint64_t cycle = 0; cycle < number_of_cycles; ++cycle)
+      {
+        record_cycle(recorder, cycle);
+      }
+    });
+
+  FlightRecording recording = recorder.make_recording();
+  std::size_t drained_cycles = 0;
+  while (recorder.get_recorded_cycles() < number_of_cycles)
+  {
+    drained_cycles += recorder.drain(recording);
+  }
+  recording_thread.join();
+  drained_cycles += recorder.drain(recording);
+
+  EXPECT_EQ(number_of_cycles, drained_cycles + recorder.get_dropped_cycles());
+  for (std::size_t i = 0; i < recording.size(); ++i)
+  {
+    const double value = static_cast<double>(recording.cycles[i]);
+    ASSERT_DOUBLE_EQ(value, recording.columns[0][i]);
+    ASSERT_DOUBLE_EQ(10.0 * value, recording.columns[1][i]);
+    ASSERT_DOUBLE_EQ(100.0 * value, recording.columns[2][i]);
+    ASSERT_EQ(static_cast<int64_t>(1000 * recording.cycles[i]), recording.read_stamps_ns[i]);
+  }
+}
+
+TEST_F(TestInterfaceFlightRecorder, output_file_and_dump_are_written)
+{
+  const std::string output_file = (directory_ / "recording.bin").string();
+  const std::string dump_file_prefix = (directory_ / "dump").string();
+  InterfaceFlightRecorder recorder;
+  recorder.configure({joint1_position_, joint1_velocity_}, {joint1_command_}, 4);
+  recorder.start(output_file, dump_file_prefix, rclcpp::get_logger("test_flight_recorder"));
+  for (uint64_t cycle = 0; cycle < 3; ++cycle)
+  {
+    record_cycle(recorder, cycle);
+  }
+  recorder.request_dump();
+  recorder.stop();
+  EXPECT_EQ(1u, recorder.get_number_of_dumps());
+
+  const FlightRecording recording = FlightRecording::load(output_file);
+  EXPECT_THAT(
+    recording.interface_names,
+    ElementsAre("joint1/position", "joint1/velocity", "joint1/position"));
+  EXPECT_EQ(2u, recording.number_of_state_interfaces);
+  EXPECT_THAT(recording.cycles, ElementsAre(0u, 1u, 2u));
+  EXPECT_THAT(recording.columns[1], ElementsAre(0.0, 10.0, 20.0));
+
+  const FlightRecording dump = FlightRecording::load(dump_file_prefix + "_0.bin");
+  EXPECT_THAT(dump.cycles, ElementsAre(0u, 1u, 2u));
+  EXPECT_THAT(dump.write_stamps_ns, ElementsAre(500, 1500, 2500));
+  EXPECT_THAT(dump.columns[2], ElementsAre(0.0, 100.0, 200.0));
+}
+
+TEST_F(TestInterfaceFlightRecorder, invalid_recordings_are_rejected)
+{
+  EXPECT_THROW(FlightRecording::load((directory_ / "missing.bin").string()), std::runtime_error);
+
+  const std::string file_name = (directory_ / "invalid.bin").string();
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file << "not a flight recording";
+  }
+  EXPECT_THROW(FlightRecording::load(file_name), std::runtime_error);
+
+  // a block announcing more cycles than the file contains
+  InterfaceFlightRecorder recorder;
+  recorder.configure({joint1_position_}, {}, 4);
+  record_cycle(recorder, 1);
+  const std::string truncated_file_name = (directory_ / "truncated.bin").string();
+  {
+    std::ofstream file(truncated_file_name, std::ios::binary);
+    const FlightRecording recording = recorder.snapshot();
+    recording.write_header(file);
+    const uint64_t number_of_cycles = 1000000;
+    file.write(reinterpret_cast<const char *>(&number_of_cycles), sizeof(number_of_cycles));
+  }
+  EXPECT_THROW(FlightRecording::load(truncated_file_name), std::runtime_error);
+
+  EXPECT_THROW(recorder.configure({joint1_position_}, {}, 1), std::invalid_argument);
+}
@@ -0,0 +1,72 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include "hardware_interface/interface_id_set.hpp"
+
+using hardware_interface::InterfaceIdSet;
+using hardware_interface::NamePool;
+
+TEST(TestInterfaceIdSet, finds_the_common_interfaces)
+{
+  const InterfaceIdSet controller_1({"set_joint1/position", "set_joint2/position"});
+  const InterfaceIdSet controller_2({"set_joint2/position", "set_joint3/position"});
+  const InterfaceIdSet controller_3({"set_joint3/velocity"});
+
+  EXPECT_TRUE(controller_1.intersects(controller_2));
+  EXPECT_FALSE(controller_1.intersects(controller_3));
+  ASSERT_TRUE(controller_1.find_first_common(controller_2).has_value());
+  EXPECT_EQ(
+    NamePool::get_name(*controller_1.find_first_common(controller_2)), "set_joint2/position");
+  EXPECT_FALSE(controller_2.find_first_common(controller_3).has_value());
+  EXPECT_FALSE(InterfaceIdSet().intersects(controller_1));
+
+  EXPECT_TRUE(controller_1.contains("set_joint1/position"));
+  EXPECT_FALSE(controller_1.contains("set_joint3/position"));
+  // a name that was never interned isn't added by the lookup
+  const auto pool_size = NamePool::size();
+  EXPECT_FALSE(controller_1.contains("set_never_interned/position"));
+  EXPECT_EQ(NamePool::size(), pool_size);
+}
+
+TEST(TestInterfaceIdSet, merges_and_removes_sets)
+{
+  InterfaceIdSet claimed;
+  EXPECT_TRUE(claimed.empty());
+  claimed.insert(InterfaceIdSet({"set_joint1/effort"}));
+  // ids beyond the size of the set grow it
+  std::vector<std::string> many_interfaces;
+  for (int i = 0; i < 200; ++i)
+  {
+    many_interfaces.push_back("set_joint" + std::to_string(i) + "/velocity");
+  }
+  const InterfaceIdSet many(many_interfaces);
+  claimed.insert(many);
+  EXPECT_TRUE(claimed.contains("set_joint1/effort"));
+  EXPECT_TRUE(claimed.contains("set_joint199/velocity"));
+
+  claimed.erase(many);
+  EXPECT_FALSE(claimed.intersects(many));
+  EXPECT_TRUE(claimed.contains("set_joint1/effort"));
+  claimed.erase(InterfaceIdSet({"set_joint1/effort"}));
+  EXPECT_TRUE(claimed.empty());
+
+  claimed.insert(std::string("set_joint1/effort"));
+  claimed.clear();
+  EXPECT_TRUE(claimed.empty());
+}
@@ -0,0 +1,93 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "hardware_interface/component_parser.hpp"
+#include "hardware_interface/interface_layout.hpp"
+#include "test_interface_layout/interface_layout.hpp"
+
+using test_interface_layout::ArmSystem;
+using test_interface_layout::ft_sensor;
+
+namespace
+{
+std::vector<hardware_interface::HardwareInfo> parse_test_description()
+{
+  std::ifstream file(std::string(TEST_FILES_PATH) + "test_interface_layout.urdf");
+  const std::string urdf((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return hardware_interface::parse_control_resources_from_urdf(urdf);
+}
+}  // namespace
+
+// the layout is known at compile time
+static_assert(ArmSystem::joints::COUNT == 2);
+static_assert(ArmSystem::joints::joint2 == 1);
+static_assert(ArmSystem::state_interfaces::COUNT == 5);
+static_assert(ArmSystem::state_interfaces::flange_io_analog_in == 4);
+static_assert(ArmSystem::command_interfaces::joint2_velocity == 2);
+static_assert(std::is_same_v<ArmSystem::state_interfaces::flange_io_vacuum_type, bool>);
+static_assert(std::is_same_v<ArmSystem::state_interfaces::flange_io_analog_in_type, float>);
+static_assert(ft_sensor::sensors::tcp_fts_sensor == 0);
+static_assert(ft_sensor::command_interfaces::COUNT == 0);
+
+TEST(TestInterfaceLayout, layout_matches_the_parsed_description)
+{
+  const auto hardware_info = parse_test_description();
+  ASSERT_EQ(hardware_info.size(), 2u);
+  EXPECT_EQ(ArmSystem::NAME, hardware_info[0].name);
+  EXPECT_EQ(ArmSystem::TYPE, "system");
+  EXPECT_EQ(ArmSystem::PLUGIN, hardware_info[0].hardware_plugin_name);
+  EXPECT_NO_THROW(hardware_interface::validate_interface_layout<ArmSystem>(hardware_info[0]));
+  EXPECT_NO_THROW(hardware_interface::validate_interface_layout<ft_sensor>(hardware_info[1]));
+  EXPECT_EQ(ft_sensor::state_interfaces::NAMES[2], "tcp_fts_sensor/force.z");
+
+  // the layout of another component, or of another version of the description, is rejected
+  EXPECT_THROW(
+    hardware_interface::validate_interface_layout<ft_sensor>(hardware_info[0]), std::runtime_error);
+  auto changed_info = hardware_info[0];
+  changed_info.joints[1].command_interfaces.pop_back();
+  EXPECT_THROW(
+    hardware_interface::validate_interface_layout<ArmSystem>(changed_info), std::runtime_error);
+  changed_info = hardware_info[0];
+  changed_info.gpios[0].state_interfaces[0].data_type = "double";
+  EXPECT_THROW(
+    hardware_interface::validate_interface_layout<ArmSystem>(changed_info), std::runtime_error);
+}
+
+TEST(TestInterfaceLayout, interface_names_and_indices)
+{
+  EXPECT_THAT(
+    hardware_interface::get_layout_interface_names<ArmSystem::command_interfaces>(),
+    testing::ElementsAre(
+      "joint1/position", "joint2/position", "joint2/velocity", "flange_io/vacuum"));
+
+  // e.g., the indices of the interfaces in a hardware component
+  const std::unordered_map<std::string, std::size_t> component_indices = {
+    {"joint2/position", 0}, {"joint1/position", 1}, {"joint1/velocity", 2},
+    {"flange_io/analog_in", 3}, {"flange_io/vacuum", 4}};
+  const auto indices = hardware_interface::resolve_layout_indices<ArmSystem::state_interfaces>(
+    [&component_indices](const std::string & name) { return component_indices.at(name); });
+  EXPECT_EQ(indices[ArmSystem::state_interfaces::joint1_position], 1u);
+  EXPECT_EQ(indices[ArmSystem::state_interfaces::joint2_position], 0u);
+  EXPECT_EQ(indices[ArmSystem::state_interfaces::flange_io_vacuum], 4u);
+}
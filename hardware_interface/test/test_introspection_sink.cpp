@@ -0,0 +1,208 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/introspection_sink.hpp"
+
+using hardware_interface::IntrospectionRecording;
+using hardware_interface::IntrospectionSink;
+using hardware_interface::IntrospectionSinkRegistrations;
+using testing::ElementsAre;
+
+// The sink is shared by the whole process, so the tests drain the samples of the previous tests
+class TestIntrospectionSink : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    IntrospectionSink::enable(8, 16);
+    IntrospectionRecording previous_samples;
+    IntrospectionSink::drain(previous_samples);
+    file_name_ = (std::filesystem::temp_directory_path() /
+                  ("test_introspection_sink_" + std::to_string(getpid()) + ".bin"))
+                   .string();
+  }
+
+  void TearDown() override { std::filesystem::remove(file_name_); }
+
+  std::string file_name_;
+};
+
+TEST_F(TestIntrospectionSink, enabled_variables_are_sampled_with_their_schema)
+{
+  double position = 1.0;
+  int counter = 2;
+  bool flag = true;
+  auto registrations = std::make_unique<IntrospectionSinkRegistrations>();
+  IntrospectionSink::register_variable("test.position", &position, registrations.get(), true);
+  IntrospectionSink::register_variable("test.counter", &counter, registrations.get(), true);
+  IntrospectionSink::register_variable("test.flag", &flag, registrations.get(), false);
+  IntrospectionSink::register_function(
+    "test.twice_position", [&position]() { return 2.0 * position; }, registrations.get(), true);
+
+  IntrospectionSink::sample(100);
+  position = 3.0;
+  counter = 4;
+  IntrospectionSink::sample(200);
+
+  IntrospectionRecording recording;
+  ASSERT_EQ(2u, IntrospectionSink::drain(recording));
+  ASSERT_EQ(1u, recording.segments.size());
+  const auto & segment = recording.segments[0];
+  EXPECT_THAT(segment.names, ElementsAre("test.position", "test.counter", "test.twice_position"));
+  EXPECT_THAT(segment.stamps_ns, ElementsAre(100, 200));
+  EXPECT_THAT(segment.values, ElementsAre(1.0, 2.0, 2.0, 3.0, 4.0, 6.0));
+  EXPECT_DOUBLE_EQ(4.0, segment.get_value(1, 1));
+
+  // enabling a variable starts a new schema
+  registrations->enable_all();
+  IntrospectionSink::sample(300);
+  registrations.reset();
+  IntrospectionSink::sample(400);
+
+  ASSERT_EQ(2u, IntrospectionSink::drain(recording));
+  ASSERT_EQ(3u, recording.segments.size());
+  EXPECT_THAT(
+    recording.segments[1].names,
+    ElementsAre("test.position", "test.counter", "test.flag", "test.twice_position"));
+  EXPECT_THAT(recording.segments[1].values, ElementsAre(3.0, 4.0, 1.0, 6.0));
+  // the variables were unregistered with their bookkeeping
+  EXPECT_TRUE(recording.segments[2].names.empty());
+  EXPECT_THAT(recording.segments[2].stamps_ns, ElementsAre(400));
+}
+
+TEST_F(TestIntrospectionSink, variables_are_unregistered_by_name)
+{
+  double value = 5.0;
+  IntrospectionSink::register_variable("test.value", &value, nullptr, true);
+  IntrospectionSink::sample(1);
+  IntrospectionSink::unregister_entity("test.value");
+  IntrospectionSink::sample(2);
+
+  IntrospectionRecording recording;
+  ASSERT_EQ(2u, IntrospectionSink::drain(recording));
+  ASSERT_EQ(2u, recording.segments.size());
+  EXPECT_THAT(recording.segments[0].names, ElementsAre("test.value"));
+  EXPECT_THAT(recording.segments[0].values, ElementsAre(5.0));
+  EXPECT_TRUE(recording.segments[1].names.empty());
+}
+
+TEST_F(TestIntrospectionSink, excluded_variables_are_not_sampled)
+{
+  double position = 1.0;
+  double velocity = 2.0;
+  double effort = 3.0;
+  IntrospectionSinkRegistrations registrations;
+  IntrospectionSink::register_variable("arm.position", &position, &registrations, true);
+  IntrospectionSink::register_variable("arm.velocity", &velocity, &registrations, false);
+  IntrospectionSink::set_excluded_prefixes({"arm.vel", "gripper."});
+  IntrospectionSink::register_variable("gripper.effort", &effort, &registrations, true);
+  EXPECT_EQ(1u, IntrospectionSink::get_number_of_sampled_variables());
+  IntrospectionSink::sample(1);
+
+  // the excluded variables keep their enabled state
+  registrations.enable_all();
+  EXPECT_EQ(1u, IntrospectionSink::get_number_of_sampled_variables());
+  IntrospectionSink::set_excluded_prefixes({"arm."});
+  IntrospectionSink::sample(2);
+  IntrospectionSink::set_excluded_prefixes({});
+  EXPECT_EQ(3u, IntrospectionSink::get_number_of_sampled_variables());
+  IntrospectionSink::sample(3);
+
+  IntrospectionRecording recording;
+  ASSERT_EQ(3u, IntrospectionSink::drain(recording));
+  ASSERT_EQ(3u, recording.segments.size());
+  EXPECT_THAT(recording.segments[0].names, ElementsAre("arm.position"));
+  EXPECT_THAT(recording.segments[1].names, ElementsAre("gripper.effort"));
+  EXPECT_THAT(
+    recording.segments[2].names, ElementsAre("arm.position", "arm.velocity", "gripper.effort"));
+  EXPECT_THAT(recording.segments[2].values, ElementsAre(1.0, 2.0, 3.0));
+}
+
+TEST_F(TestIntrospectionSink, samples_are_dropped_when_the_buffer_is_full)
+{
+  const auto dropped_before = IntrospectionSink::get_dropped_samples();
+  for (int64_t i = 0; i < 10; ++i)
+  {
+    IntrospectionSink::sample(i);
+  }
+  EXPECT_EQ(dropped_before + 2u, IntrospectionSink::get_dropped_samples());
+  IntrospectionRecording recording;
+  EXPECT_EQ(8u, IntrospectionSink::drain(recording));
+
+  IntrospectionSink::disable();
+  EXPECT_FALSE(IntrospectionSink::is_enabled());
+  IntrospectionSink::sample(10);
+  EXPECT_EQ(0u, IntrospectionSink::drain(recording));
+  IntrospectionSink::enable(8, 16);
+  EXPECT_TRUE(IntrospectionSink::is_enabled());
+}
+
+TEST_F(TestIntrospectionSink, recording_file_round_trip)
+{
+  double first = 1.0;
+  double second = 2.0;
+  IntrospectionSinkRegistrations registrations;
+  IntrospectionSink::register_variable("test.first", &first, &registrations, true);
+  IntrospectionSink::sample(10);
+  IntrospectionSink::sample(20);
+
+  uint32_t written_schema_version = 0;
+  {
+    std::ofstream file(file_name_, std::ios::binary);
+    IntrospectionRecording::write_file_header(file);
+    IntrospectionRecording recording;
+    IntrospectionSink::drain(recording);
+    recording.write_segments(file, written_schema_version);
+    // the samples of the same schema drained later are appended without the names
+    IntrospectionSink::sample(30);
+    recording.segments.clear();
+    IntrospectionSink::drain(recording);
+    recording.write_segments(file, written_schema_version);
+
+    IntrospectionSink::register_variable("test.second", &second, &registrations, true);
+    IntrospectionSink::sample(40);
+    recording.segments.clear();
+    IntrospectionSink::drain(recording);
+    recording.write_segments(file, written_schema_version);
+  }
+
+  const auto recording = IntrospectionRecording::load(file_name_);
+  ASSERT_EQ(2u, recording.segments.size());
+  EXPECT_THAT(recording.segments[0].names, ElementsAre("test.first"));
+  EXPECT_THAT(recording.segments[0].stamps_ns, ElementsAre(10, 20, 30));
+  EXPECT_THAT(recording.segments[0].values, ElementsAre(1.0, 1.0, 1.0));
+  EXPECT_THAT(recording.segments[1].names, ElementsAre("test.first", "test.second"));
+  EXPECT_THAT(recording.segments[1].values, ElementsAre(1.0, 2.0));
+}
+
+TEST_F(TestIntrospectionSink, invalid_recordings_are_rejected)
+{
+  EXPECT_THROW(IntrospectionRecording::load(file_name_), std::runtime_error);
+  {
+    std::ofstream file(file_name_, std::ios::binary);
+    file << "not an introspection recording";
+  }
+  EXPECT_THROW(IntrospectionRecording::load(file_name_), std::runtime_error);
+}
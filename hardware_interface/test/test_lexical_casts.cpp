@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "gmock/gmock.h"
 
@@ -44,6 +47,27 @@ TEST(TestLexicalCasts, test_stof)
   ASSERT_EQ(stof("1.0"), 1.0f);
 }
 
+TEST(TestLexicalCasts, test_try_stod_and_try_stof)
+{
+  using hardware_interface::try_stod;
+  using hardware_interface::try_stof;
+
+  EXPECT_FALSE(try_stod("").has_value());
+  EXPECT_FALSE(try_stod("+").has_value());
+  EXPECT_FALSE(try_stod("1,2").has_value());
+  EXPECT_FALSE(try_stod("1.2 ").has_value());
+  EXPECT_FALSE(try_stod("nan").has_value());
+  EXPECT_FALSE(try_stod("1.8e308").has_value());
+  EXPECT_FALSE(try_stof("3.4e39").has_value());
+  EXPECT_EQ(try_stod("1.2"), 1.2);
+  EXPECT_EQ(try_stod("+1.2"), 1.2);
+  EXPECT_EQ(try_stod("-1e-3"), -1e-3);
+  EXPECT_EQ(try_stof("-1.2"), -1.2f);
+  // only the given characters are converted
+  const std::string values = "1.5,2.5";
+  EXPECT_EQ(try_stod(std::string_view(values).substr(4)), 2.5);
+}
+
 TEST(TestLexicalCasts, test_stoi8)
 {
   using hardware_interface::stoi8;
@@ -211,6 +235,20 @@ TEST(TestLexicalCasts, test_parse_string_array)
   ASSERT_EQ(parse_string_array("[ abc, def ]"), std::vector<std::string>({"abc", "def"}));
 }
 
+TEST(TestLexicalCasts, test_split_array)
+{
+  using hardware_interface::split_array;
+
+  ASSERT_THROW(split_array(""), std::invalid_argument);
+  ASSERT_THROW(split_array("["), std::invalid_argument);
+  ASSERT_THROW(split_array("[a]]"), std::invalid_argument);
+  ASSERT_THROW(split_array("[a b]"), std::invalid_argument);
+  ASSERT_THROW(split_array("[a, ,b]"), std::invalid_argument);
+
+  ASSERT_TRUE(split_array("[\t ]").empty());
+  ASSERT_EQ(split_array("[ a,b ,\tc ]"), std::vector<std::string_view>({"a", "b", "c"}));
+}
+
 TEST(TestLexicalCasts, test_parse_double_array)
 {
   using hardware_interface::parse_array;
@@ -0,0 +1,94 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/memory_arena.hpp"
+
+using hardware_interface::MemoryArena;
+
+namespace
+{
+bool is_in_range(const void * p, const void * begin, std::size_t size)
+{
+  const auto address = reinterpret_cast<std::uintptr_t>(p);
+  const auto begin_address = reinterpret_cast<std::uintptr_t>(begin);
+  return address >= begin_address && address < begin_address + size;
+}
+}  // namespace
+
+TEST(TestMemoryArena, capacity_is_rounded_up_to_a_page)
+{
+  MemoryArena arena(1);
+  EXPECT_GE(arena.get_capacity(), 1u);
+  EXPECT_EQ(arena.get_capacity() % 1024u, 0u);
+  // the bookkeeping of the pool is already in the buffer
+  EXPECT_LE(arena.get_used_bytes(), arena.get_capacity());
+  EXPECT_EQ(arena.get_allocated_bytes(), 0u);
+  EXPECT_EQ(arena.get_high_water_mark(), 0u);
+  EXPECT_EQ(arena.get_overflow_bytes(), 0u);
+}
+
+TEST(TestMemoryArena, containers_are_allocated_from_the_buffer)
+{
+  MemoryArena arena(64 * 1024);
+  void * first_block = arena.allocate(sizeof(double), alignof(double));
+  arena.deallocate(first_block, sizeof(double), alignof(double));
+
+  std::pmr::vector<double> values(100, 1.0, &arena);
+  std::pmr::string name("a name longer than the small string buffer", &arena);
+  EXPECT_GE(arena.get_allocated_bytes(), 100 * sizeof(double) + name.size());
+  EXPECT_GT(arena.get_used_bytes(), 0u);
+  EXPECT_LE(arena.get_used_bytes(), arena.get_capacity());
+  EXPECT_EQ(arena.get_overflow_bytes(), 0u);
+  // the blocks are from the pool in the buffer, which is around the first block
+  EXPECT_TRUE(is_in_range(values.data(), first_block, arena.get_capacity()) ||
+              is_in_range(first_block, values.data(), arena.get_capacity()));
+}
+
+TEST(TestMemoryArena, high_water_mark_keeps_the_peak_allocation)
+{
+  MemoryArena arena(64 * 1024);
+  {
+    std::pmr::vector<double> values(512, 0.0, &arena);
+    EXPECT_GE(arena.get_high_water_mark(), 512 * sizeof(double));
+  }
+  EXPECT_EQ(arena.get_allocated_bytes(), 0u);
+  EXPECT_GE(arena.get_high_water_mark(), 512 * sizeof(double));
+
+  // the freed blocks are reused by the next allocations of the same size
+  const std::size_t used_bytes = arena.get_used_bytes();
+  for (int i = 0; i < 10; ++i)
+  {
+    std::pmr::vector<double> values(512, 0.0, &arena);
+  }
+  EXPECT_EQ(arena.get_used_bytes(), used_bytes);
+}
+
+TEST(TestMemoryArena, when_exhausted_expect_fallback_to_the_heap)
+{
+  MemoryArena arena(4096);
+  std::pmr::vector<double> values(&arena);
+  values.resize(arena.get_capacity());
+  EXPECT_GE(arena.get_overflow_bytes(), arena.get_capacity() * sizeof(double));
+  values[arena.get_capacity() - 1] = 1.0;
+  values.clear();
+  values.shrink_to_fit();
+  EXPECT_EQ(arena.get_allocated_bytes(), 0u);
+}
@@ -0,0 +1,83 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gmock/gmock.h>
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/name_pool.hpp"
+
+using hardware_interface::NameId;
+using hardware_interface::NamePool;
+
+TEST(TestNamePool, interns_names_once)
+{
+  const auto id = NamePool::intern("joint1/position");
+  EXPECT_NE(NamePool::EMPTY_ID, id);
+  EXPECT_EQ(id, NamePool::intern("joint1/position"));
+  EXPECT_EQ(id, NamePool::find("joint1/position"));
+  EXPECT_NE(id, NamePool::intern("joint1/velocity"));
+  EXPECT_EQ("joint1/position", NamePool::get_name(id));
+  EXPECT_EQ(&NamePool::get_name(id), &NamePool::get_interned("joint1/position"));
+}
+
+TEST(TestNamePool, unknown_names_and_ids_are_empty)
+{
+  EXPECT_EQ(NamePool::EMPTY_ID, NamePool::intern(""));
+  EXPECT_EQ(NamePool::EMPTY_ID, NamePool::find("never/interned"));
+  EXPECT_EQ("", NamePool::get_name(NamePool::EMPTY_ID));
+  EXPECT_EQ("", NamePool::get_name(static_cast<NameId>(NamePool::size())));
+}
+
+TEST(TestNamePool, references_stay_valid_when_the_pool_grows)
+{
+  const std::string & name = NamePool::get_interned("joint2/effort");
+  for (int i = 0; i < 1000; ++i)
+  {
+    NamePool::intern("joint2/effort_" + std::to_string(i));
+  }
+  EXPECT_EQ(&name, &NamePool::get_interned("joint2/effort"));
+  EXPECT_EQ("joint2/effort", name);
+}
+
+TEST(TestNamePool, threads_get_the_same_ids)
+{
+  constexpr int kThreads = 4;
+  constexpr int kNames = 200;
+  std::vector<std::vector<NameId>> ids(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t)
+  {
+    threads.emplace_back(
+      [&ids, t]()
+      {
+        for (int i = 0; i < kNames; ++i)
+        {
+          ids[t].push_back(NamePool::intern("controller_" + std::to_string(i) + "/update"));
+        }
+      });
+  }
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+  for (int t = 1; t < kThreads; ++t)
+  {
+    EXPECT_EQ(ids[0], ids[t]);
+  }
+  const std::set<NameId> unique_ids(ids[0].begin(), ids[0].end());
+  EXPECT_EQ(static_cast<std::size_t>(kNames), unique_ids.size());
+}
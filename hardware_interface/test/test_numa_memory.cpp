@@ -0,0 +1,54 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <unistd.h>
+
+#include <vector>
+
+#include "hardware_interface/numa_memory.hpp"
+
+using hardware_interface::NumaMemory;
+using hardware_interface::NumaMemoryRange;
+
+TEST(TestNumaMemory, without_ranges_expect_no_page_moved)
+{
+  EXPECT_EQ(NumaMemory::move_to_node({}, 0), 0u);
+  EXPECT_EQ(NumaMemory::move_to_node({{nullptr, 64}}, 0), 0u);
+  std::vector<double> values(8, 0.0);
+  EXPECT_EQ(NumaMemory::move_to_node({{values.data(), values.size() * sizeof(double)}}, -1), 0u);
+}
+
+TEST(TestNumaMemory, overlapping_ranges_are_moved_once_to_the_current_node)
+{
+  const int node = NumaMemory::get_current_node();
+  if (node < 0)
+  {
+    GTEST_SKIP() << "The NUMA node of the thread is unknown on this platform";
+  }
+  const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  // the pages are touched, so that they are mapped
+  std::vector<char> buffer(4 * page_size, 1);
+  const std::vector<NumaMemoryRange> ranges = {
+    {buffer.data(), buffer.size()}, {buffer.data() + page_size, page_size}, {buffer.data(), 1}};
+  const std::size_t moved_pages = NumaMemory::move_to_node(ranges, node);
+  if (moved_pages == 0)
+  {
+    GTEST_SKIP() << "The pages can't be moved on this kernel";
+  }
+  // the buffer spans 4 pages, or 5 if it isn't aligned to a page
+  EXPECT_GE(moved_pages, 4u);
+  EXPECT_LE(moved_pages, 5u);
+}
@@ -0,0 +1,102 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+
+#include "hardware_interface/overload_governor.hpp"
+
+using hardware_interface::Criticality;
+using hardware_interface::OverloadGovernor;
+using hardware_interface::parse_criticality;
+
+namespace
+{
+/// Adds a window of cycles with the given execution time, returns true if the decimation changed
+bool add_window(OverloadGovernor & governor, uint32_t window, double execution_time_us)
+{
+  bool changed = false;
+  for (uint32_t i = 0; i < window; ++i)
+  {
+    changed = governor.add_cycle(execution_time_us, 1000.0) || changed;
+  }
+  return changed;
+}
+}  // namespace
+
+TEST(TestOverloadGovernor, parse_criticality)
+{
+  EXPECT_EQ(parse_criticality("safety"), Criticality::SAFETY);
+  EXPECT_EQ(parse_criticality("control"), Criticality::CONTROL);
+  EXPECT_EQ(parse_criticality("auxiliary"), Criticality::AUXILIARY);
+  EXPECT_THROW(parse_criticality("critical"), std::invalid_argument);
+  EXPECT_STREQ(hardware_interface::to_string(Criticality::AUXILIARY), "auxiliary");
+}
+
+TEST(TestOverloadGovernor, sheds_and_restores_one_level_per_window)
+{
+  OverloadGovernor governor;
+  governor.configure(10u, 0.2, 0.4, 2u, 4u);
+  EXPECT_EQ(governor.get_decimation(), 1u);
+
+  // a single cycle without headroom sheds the load at the end of its window
+  EXPECT_FALSE(add_window(governor, 9u, 500.0));
+  EXPECT_TRUE(governor.add_cycle(900.0, 1000.0));
+  EXPECT_EQ(governor.get_decimation(), 2u);
+  EXPECT_TRUE(add_window(governor, 10u, 900.0));
+  EXPECT_EQ(governor.get_decimation(), 4u);
+  EXPECT_TRUE(add_window(governor, 10u, 900.0));
+  EXPECT_EQ(governor.get_decimation(), OverloadGovernor::PAUSED);
+  EXPECT_EQ(governor.get_level(), 3u);
+  EXPECT_FALSE(add_window(governor, 10u, 900.0));
+
+  // a headroom between the thresholds keeps the level
+  EXPECT_FALSE(add_window(governor, 10u, 700.0));
+  EXPECT_FALSE(add_window(governor, 10u, 700.0));
+  EXPECT_EQ(governor.get_decimation(), OverloadGovernor::PAUSED);
+
+  // the rate is restored after the consecutive windows with enough headroom
+  EXPECT_FALSE(add_window(governor, 10u, 500.0));
+  EXPECT_TRUE(add_window(governor, 10u, 500.0));
+  EXPECT_EQ(governor.get_decimation(), 4u);
+  EXPECT_FALSE(add_window(governor, 10u, 500.0));
+  EXPECT_FALSE(add_window(governor, 10u, 700.0));
+  EXPECT_FALSE(add_window(governor, 10u, 500.0));
+  EXPECT_TRUE(add_window(governor, 10u, 500.0));
+  EXPECT_EQ(governor.get_decimation(), 2u);
+  EXPECT_FALSE(add_window(governor, 10u, 500.0));
+  EXPECT_TRUE(add_window(governor, 10u, 500.0));
+  EXPECT_EQ(governor.get_decimation(), 1u);
+  EXPECT_FALSE(add_window(governor, 30u, 100.0));
+}
+
+TEST(TestOverloadGovernor, decimated_cycles_are_due)
+{
+  EXPECT_TRUE(OverloadGovernor::is_due(1u, 3u));
+  EXPECT_TRUE(OverloadGovernor::is_due(4u, 8u));
+  EXPECT_FALSE(OverloadGovernor::is_due(4u, 9u));
+  EXPECT_FALSE(OverloadGovernor::is_due(OverloadGovernor::PAUSED, 8u));
+
+  // the maximal decimation is rounded down to a power of 2 and bounded by the window
+  OverloadGovernor governor;
+  governor.configure(4u, 0.2, 0.4, 1u, 100u);
+  EXPECT_TRUE(add_window(governor, 4u, 2000.0));
+  EXPECT_TRUE(add_window(governor, 4u, 2000.0));
+  EXPECT_EQ(governor.get_decimation(), 4u);
+  EXPECT_TRUE(add_window(governor, 4u, 2000.0));
+  EXPECT_EQ(governor.get_decimation(), OverloadGovernor::PAUSED);
+  governor.reset();
+  EXPECT_EQ(governor.get_decimation(), 1u);
+  EXPECT_TRUE(governor.is_due());
+}
@@ -0,0 +1,82 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <thread>
+
+#include "hardware_interface/performance_counters.hpp"
+
+using hardware_interface::PerformanceCounters;
+
+class TestPerformanceCounters : public ::testing::Test
+{
+protected:
+  void TearDown() override { PerformanceCounters::set_sampling_enabled(false); }
+};
+
+TEST_F(TestPerformanceCounters, when_sampling_disabled_expect_zero_samples)
+{
+  PerformanceCounters::set_sampling_enabled(false);
+  const PerformanceCounters counters = PerformanceCounters::now();
+  EXPECT_EQ(counters.cycles, 0u);
+  EXPECT_EQ(counters.instructions, 0u);
+  EXPECT_EQ(counters.cache_misses, 0u);
+  EXPECT_EQ(counters.branch_misses, 0u);
+}
+
+TEST_F(TestPerformanceCounters, when_computing_expect_instructions_and_cycles)
+{
+  PerformanceCounters::set_sampling_enabled(true);
+  if (!PerformanceCounters::is_available())
+  {
+    GTEST_SKIP() << "The hardware performance counters can't be opened on this machine";
+  }
+  const PerformanceCounters before = PerformanceCounters::now();
+  volatile double sum = 0.0;
+  for (int i = 0; i < 1000000; ++i)
+  {
+    sum = sum + 1.0;
+  }
+  const PerformanceCounters counters = PerformanceCounters::now() - before;
+  EXPECT_GT(counters.instructions, 1000000u);
+  EXPECT_GT(counters.cycles, 0u);
+  EXPECT_GT(counters.get_instructions_per_cycle(), 0.0);
+}
+
+TEST_F(TestPerformanceCounters, every_thread_has_its_own_counters)
+{
+  PerformanceCounters::set_sampling_enabled(true);
+  const bool available = PerformanceCounters::is_available();
+  bool available_on_other_thread = false;
+  std::thread other_thread(
+    [&available_on_other_thread]()
+    {
+      available_on_other_thread = PerformanceCounters::is_available();
+      PerformanceCounters::now();
+    });
+  other_thread.join();
+  // the counters of the exited thread are closed, the ones of this thread are still readable
+  EXPECT_EQ(available, available_on_other_thread);
+  EXPECT_EQ(available, PerformanceCounters::is_available());
+}
+
+TEST_F(TestPerformanceCounters, instructions_per_cycle_without_cycles_is_zero)
+{
+  PerformanceCounters counters;
+  counters.instructions = 10;
+  EXPECT_EQ(counters.get_instructions_per_cycle(), 0.0);
+  counters.cycles = 4;
+  EXPECT_DOUBLE_EQ(counters.get_instructions_per_cycle(), 2.5);
+}
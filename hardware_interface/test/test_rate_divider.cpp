@@ -0,0 +1,131 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "hardware_interface/rate_divider.hpp"
+
+using hardware_interface::RateDivider;
+using hardware_interface::RatePhaseAllocator;
+
+TEST(TestRateDivider, configure_divider)
+{
+  RateDivider divider;
+  divider.configure(1000, 100);
+  EXPECT_TRUE(divider.is_divisible());
+  EXPECT_EQ(divider.get_divider(), 10u);
+  EXPECT_FALSE(divider.has_phase());
+
+  // rates at or above the loop rate and the unset rate run at every cycle
+  for (const unsigned int rate : {0u, 1000u, 2000u})
+  {
+    divider.configure(1000, rate);
+    EXPECT_EQ(divider.get_divider(), 1u);
+    EXPECT_TRUE(divider.is_due(0));
+    EXPECT_TRUE(divider.is_due(1));
+  }
+
+  divider.configure(1000, 300);
+  EXPECT_FALSE(divider.is_divisible());
+  EXPECT_FALSE(divider.is_due(0));
+  EXPECT_FALSE(divider.has_phase());
+}
+
+TEST(TestRateDivider, phase_is_anchored_at_first_check)
+{
+  RateDivider divider;
+  divider.configure(100, 25);
+  std::vector<uint64_t> due_cycles;
+  for (uint64_t cycle = 7; cycle < 20; ++cycle)
+  {
+    if (divider.is_due(cycle))
+    {
+      due_cycles.push_back(cycle);
+    }
+  }
+  EXPECT_THAT(due_cycles, testing::ElementsAre(7u, 11u, 15u, 19u));
+  EXPECT_EQ(divider.get_phase(), 3u);
+
+  divider.set_phase(2);
+  EXPECT_FALSE(divider.is_due(19));
+  EXPECT_TRUE(divider.is_due(22));
+
+  // reconfiguring resets the phase
+  divider.configure(100, 50);
+  EXPECT_FALSE(divider.has_phase());
+}
+
+TEST(TestRatePhaseAllocator, spreads_equal_rates)
+{
+  RatePhaseAllocator allocator(1000);
+  // ten 100 Hz entities in a 1 kHz loop get ten different phases
+  std::vector<uint32_t> phases;
+  for (int i = 0; i < 10; ++i)
+  {
+    phases.push_back(allocator.allocate(10));
+  }
+  EXPECT_THAT(phases, testing::UnorderedElementsAre(0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u));
+  for (uint64_t cycle = 0; cycle < 1000; ++cycle)
+  {
+    EXPECT_EQ(allocator.get_load(cycle), 1.0);
+  }
+
+  // the released phase is allocated again
+  allocator.release(10, phases[3]);
+  EXPECT_EQ(allocator.get_load(phases[3]), 0.0);
+  EXPECT_EQ(allocator.allocate(10), phases[3]);
+}
+
+TEST(TestRatePhaseAllocator, spreads_mixed_rates)
+{
+  RatePhaseAllocator allocator(100);
+  // a 50 Hz entity takes the even cycles, the 25 Hz entities then share the odd cycles
+  EXPECT_EQ(allocator.allocate(2), 0u);
+  const uint32_t first = allocator.allocate(4);
+  const uint32_t second = allocator.allocate(4);
+  EXPECT_EQ(first % 2u, 1u);
+  EXPECT_EQ(second % 2u, 1u);
+  EXPECT_NE(first, second);
+  for (uint64_t cycle = 0; cycle < 100; ++cycle)
+  {
+    EXPECT_EQ(allocator.get_load(cycle), 1.0);
+  }
+
+  // dividers that don't divide the loop rate are not tracked
+  EXPECT_EQ(allocator.allocate(3), 0u);
+  EXPECT_EQ(allocator.get_load(0), 1.0);
+}
+
+TEST(TestRatePhaseAllocator, balances_measured_loads)
+{
+  RatePhaseAllocator allocator(100);
+  // the expensive 50 Hz entity is alone in its cycles, the cheap ones share the other cycles
+  const uint32_t heavy = allocator.allocate(2, 300.0);
+  const uint32_t light_1 = allocator.allocate(2, 50.0);
+  const uint32_t light_2 = allocator.allocate(2, 50.0);
+  EXPECT_NE(heavy, light_1);
+  EXPECT_EQ(light_1, light_2);
+  EXPECT_DOUBLE_EQ(allocator.get_max_load(), 300.0);
+
+  // a manually set phase is counted as well
+  allocator.reserve(2, light_1, 200.0);
+  EXPECT_DOUBLE_EQ(allocator.get_load(light_1), 300.0);
+  EXPECT_EQ(allocator.allocate(2, 10.0), heavy);
+
+  allocator.reset(100);
+  EXPECT_DOUBLE_EQ(allocator.get_max_load(), 0.0);
+}
@@ -0,0 +1,125 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/rcu_pointer.hpp"
+
+using hardware_interface::RcuPointer;
+
+TEST(TestRcuPointer, reads_the_latest_published_value)
+{
+  RcuPointer<int> pointer;
+  EXPECT_FALSE(pointer.read());
+
+  pointer.update(std::make_unique<int>(1));
+  {
+    const auto guard = pointer.read();
+    ASSERT_TRUE(guard);
+    EXPECT_EQ(1, *guard.get());
+  }
+  pointer.update(std::make_unique<int>(2));
+  EXPECT_EQ(2, *pointer.read().get());
+  pointer.update(nullptr);
+  EXPECT_FALSE(pointer.read());
+}
+
+TEST(TestRcuPointer, previous_value_outlives_the_readers)
+{
+  struct Frame
+  {
+    explicit Frame(std::atomic<bool> & destroyed) : destroyed_(destroyed) {}
+    ~Frame() { destroyed_ = true; }
+    std::atomic<bool> & destroyed_;
+  };
+  std::atomic<bool> first_destroyed{false};
+  std::atomic<bool> second_destroyed{false};
+  RcuPointer<Frame> pointer(std::make_unique<Frame>(first_destroyed));
+
+  std::atomic<bool> reading{false};
+  std::atomic<bool> release{false};
+  std::thread reader(
+    [&]()
+    {
+      const auto guard = pointer.read();
+      reading = true;
+      while (!release)
+      {
+        std::this_thread::yield();
+      }
+    });
+  while (!reading)
+  {
+    std::this_thread::yield();
+  }
+  std::thread writer([&]() { pointer.update(std::make_unique<Frame>(second_destroyed)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  // the writer waits for the guard of the previous value
+  EXPECT_FALSE(first_destroyed);
+  release = true;
+  reader.join();
+  writer.join();
+  EXPECT_TRUE(first_destroyed);
+  EXPECT_FALSE(second_destroyed);
+}
+
+TEST(TestRcuPointer, readers_never_see_a_destroyed_value)
+{
+  constexpr std::size_t kFrameSize = 16;
+  constexpr uint64_t kFrames = 2000;
+  RcuPointer<std::vector<uint64_t>> pointer(
+    std::make_unique<std::vector<uint64_t>>(kFrameSize, 0u));
+
+  std::atomic<bool> done{false};
+  std::atomic<uint64_t> torn_frames{0u};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 3; ++i)
+  {
+    readers.emplace_back(
+      [&]()
+      {
+        while (!done)
+        {
+          const auto guard = pointer.read();
+          const auto & frame = *guard.get();
+          for (const auto value : frame)
+          {
+            if (value != frame.front())
+            {
+              ++torn_frames;
+            }
+          }
+        }
+      });
+  }
+  for (uint64_t frame = 1; frame <= kFrames; ++frame)
+  {
+    pointer.update(std::make_unique<std::vector<uint64_t>>(kFrameSize, frame));
+  }
+  done = true;
+  for (auto & reader : readers)
+  {
+    reader.join();
+  }
+  EXPECT_EQ(0u, torn_frames);
+  EXPECT_EQ(kFrames, pointer.read()->front());
+}
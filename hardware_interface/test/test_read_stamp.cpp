@@ -0,0 +1,71 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "hardware_interface/read_stamp.hpp"
+
+using hardware_interface::ReadStamp;
+
+TEST(TestReadStamp, counts_the_stamped_reads)
+{
+  ReadStamp stamp;
+  EXPECT_EQ(stamp.get().cycle, 0u);
+  EXPECT_EQ(stamp.get().time.get_clock_type(), RCL_CLOCK_UNINITIALIZED);
+
+  const rclcpp::Time time(1, 500, RCL_ROS_TIME);
+  stamp.stamp(time);
+  EXPECT_EQ(stamp.get().cycle, 1u);
+  EXPECT_EQ(stamp.get().time, time);
+  EXPECT_EQ(stamp.get().time.get_clock_type(), RCL_ROS_TIME);
+
+  stamp.stamp(time + rclcpp::Duration(0, 1000));
+  EXPECT_EQ(stamp.get().cycle, 2u);
+  EXPECT_EQ(stamp.get().time.nanoseconds(), time.nanoseconds() + 1000);
+}
+
+TEST(TestReadStamp, concurrent_reader_never_sees_a_torn_stamp)
+{
+  ReadStamp stamp;
+  std::atomic_bool done{false};
+  // the time of every read is ten times its cycle
+  std::thread writer(
+    [&]()
+    {
+      for (int64_t cycle = 1; cycle <= 100000; ++cycle)
+      {
+        stamp.stamp(rclcpp::Time(cycle * 10, RCL_STEADY_TIME));
+      }
+      done = true;
+    });
+
+  uint64_t last_cycle = 0;
+  while (!done)
+  {
+    const auto data = stamp.get();
+    if (data.cycle > 0)
+    {
+      ASSERT_EQ(data.time.nanoseconds(), static_cast<int64_t>(data.cycle) * 10);
+    }
+    ASSERT_GE(data.cycle, last_cycle);
+    last_cycle = data.cycle;
+  }
+  writer.join();
+  EXPECT_EQ(stamp.get().cycle, 100000u);
+}
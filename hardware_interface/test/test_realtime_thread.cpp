@@ -0,0 +1,79 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <pthread.h>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include "hardware_interface/realtime_thread.hpp"
+#include "rclcpp/logger.hpp"
+
+using hardware_interface::RealtimeThreadParams;
+
+namespace
+{
+std::string get_current_thread_name()
+{
+  char name[16] = {};
+  pthread_getname_np(pthread_self(), name, sizeof(name));
+  return name;
+}
+}  // namespace
+
+TEST(TestRealtimeThread, created_thread_is_named_before_running_the_function)
+{
+  RealtimeThreadParams params;
+  params.name = "a_too_long_thread_name";
+  params.stack_prefault_size = 256 * 1024;
+  std::string name;
+  std::thread thread = hardware_interface::create_realtime_thread(
+    params, rclcpp::get_logger("test_realtime_thread"),
+    [&name]() { name = get_current_thread_name(); });
+  thread.join();
+  EXPECT_EQ(name, "a_too_long_thre");
+}
+
+TEST(TestRealtimeThread, stack_prefault_is_limited_to_the_stack_size)
+{
+  std::thread thread(
+    []()
+    {
+      hardware_interface::prefault_current_thread_stack(std::numeric_limits<std::size_t>::max());
+      hardware_interface::prefault_current_thread_stack(0);
+    });
+  thread.join();
+}
+
+TEST(TestRealtimeThread, configure_once_only_applies_the_first_params)
+{
+  std::string name;
+  std::thread thread(
+    [&name]()
+    {
+      const auto logger = rclcpp::get_logger("test_realtime_thread");
+      RealtimeThreadParams params;
+      params.name = "first";
+      hardware_interface::configure_current_thread_once(params, logger);
+      params.name = "second";
+      hardware_interface::configure_current_thread_once(params, logger);
+      name = get_current_thread_name();
+    });
+  thread.join();
+  EXPECT_EQ(name, "first");
+}
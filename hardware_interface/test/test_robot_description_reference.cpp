@@ -0,0 +1,116 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "hardware_interface/hardware_info_cache.hpp"
+#include "hardware_interface/robot_description_reference.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using hardware_interface::HardwareInfoCache;
+using hardware_interface::RobotDescriptionReference;
+
+namespace
+{
+const char URDF[] = "<robot name=\"test\"><ros2_control name=\"system\"/></robot>";
+}  // namespace
+
+TEST(TestRobotDescriptionReference, parse_reference)
+{
+  EXPECT_FALSE(RobotDescriptionReference::parse(URDF).has_value());
+  EXPECT_FALSE(RobotDescriptionReference::parse("").has_value());
+
+  auto reference = RobotDescriptionReference::parse("file:///tmp/robot.urdf");
+  ASSERT_TRUE(reference.has_value());
+  EXPECT_EQ(reference->kind, RobotDescriptionReference::Kind::FILE);
+  EXPECT_EQ(reference->location, "/tmp/robot.urdf");
+  EXPECT_FALSE(reference->hash.has_value());
+  EXPECT_EQ(reference->to_string(), "file:///tmp/robot.urdf");
+
+  reference = RobotDescriptionReference::parse("shm:///robot_description#00000000000000ff");
+  ASSERT_TRUE(reference.has_value());
+  EXPECT_EQ(reference->kind, RobotDescriptionReference::Kind::SHARED_MEMORY);
+  EXPECT_EQ(reference->location, "/robot_description");
+  ASSERT_TRUE(reference->hash.has_value());
+  EXPECT_EQ(reference->hash.value(), 0xffu);
+  EXPECT_EQ(reference->to_string(), "shm:///robot_description#00000000000000ff");
+
+  EXPECT_THROW(RobotDescriptionReference::parse("file://"), std::runtime_error);
+  EXPECT_THROW(RobotDescriptionReference::parse("file:///tmp/robot.urdf#"), std::runtime_error);
+  EXPECT_THROW(RobotDescriptionReference::parse("file:///tmp/robot.urdf#xyz"), std::runtime_error);
+  EXPECT_THROW(
+    RobotDescriptionReference::parse("file:///tmp/robot.urdf#00000000000000000"),
+    std::runtime_error);
+}
+
+TEST(TestRobotDescriptionReference, read_file_with_hash)
+{
+  const auto path =
+    (std::filesystem::temp_directory_path() / "test_robot_description_reference.urdf").string();
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << URDF;
+  }
+
+  RobotDescriptionReference reference;
+  reference.location = path;
+  EXPECT_EQ(*reference.read(), URDF);
+
+  reference.hash = HardwareInfoCache::hash(URDF);
+  const auto parsed = RobotDescriptionReference::parse(reference.to_string());
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(*parsed->read(), URDF);
+
+  // a description that doesn't match the hash, e.g., being rewritten, is not used
+  reference.hash = reference.hash.value() + 1;
+  EXPECT_THROW(reference.read(), std::runtime_error);
+
+  std::filesystem::remove(path);
+  reference.hash.reset();
+  EXPECT_THROW(reference.read(), std::runtime_error);
+}
+
+#if !defined(_WIN32)
+TEST(TestRobotDescriptionReference, read_shared_memory_segment)
+{
+  const std::string segment_name = "/test_robot_description_reference";
+  shm_unlink(segment_name.c_str());
+  const int fd = shm_open(segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  ASSERT_GE(fd, 0);
+  // the segment is larger than the description, which is terminated by a '\0'
+  const std::string urdf = URDF;
+  ASSERT_EQ(ftruncate(fd, 4096), 0);
+  ASSERT_EQ(write(fd, urdf.data(), urdf.size()), static_cast<ssize_t>(urdf.size()));
+  close(fd);
+
+  RobotDescriptionReference reference;
+  reference.kind = RobotDescriptionReference::Kind::SHARED_MEMORY;
+  reference.location = segment_name;
+  reference.hash = HardwareInfoCache::hash(urdf);
+  EXPECT_EQ(*reference.read(), urdf);
+
+  shm_unlink(segment_name.c_str());
+  EXPECT_THROW(reference.read(), std::runtime_error);
+}
+#endif
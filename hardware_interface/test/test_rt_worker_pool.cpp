@@ -0,0 +1,208 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/rt_worker_pool.hpp"
+
+using hardware_interface::RTWorkerPool;
+using hardware_interface::RTWorkerPoolParams;
+
+TEST(TestRTWorkerPool, executes_all_tasks_without_workers)
+{
+  RTWorkerPool pool(RTWorkerPoolParams{});
+  EXPECT_EQ(pool.get_number_of_workers(), 0u);
+
+  std::vector<int> executed(10, 0);
+  pool.parallel_for(executed.size(), [&](std::size_t i) { executed[i]++; });
+  EXPECT_THAT(executed, testing::Each(1));
+}
+
+TEST(TestRTWorkerPool, executes_all_tasks_exactly_once)
+{
+  RTWorkerPoolParams params;
+  params.number_of_workers = 3;
+  RTWorkerPool pool(params);
+  EXPECT_EQ(pool.get_number_of_workers(), 3u);
+
+  for (int cycle = 0; cycle < 1000; ++cycle)
+  {
+    std::vector<int> executed(17, 0);
+    pool.parallel_for(executed.size(), [&](std::size_t i) { executed[i]++; });
+    ASSERT_THAT(executed, testing::Each(1));
+  }
+  // no tasks shouldn't block
+  pool.parallel_for(0, [](std::size_t) { FAIL(); });
+}
+
+TEST(TestRTWorkerPool, tasks_run_concurrently)
+{
+  RTWorkerPoolParams params;
+  params.number_of_workers = 3;
+  RTWorkerPool pool(params);
+
+  std::atomic_int running{0};
+  std::atomic_int max_running{0};
+  pool.parallel_for(
+    4,
+    [&](std::size_t)
+    {
+      const int now_running = ++running;
+      int expected = max_running.load();
+      while (now_running > expected && !max_running.compare_exchange_weak(expected, now_running))
+      {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      --running;
+    });
+  EXPECT_GT(max_running.load(), 1);
+}
+
+TEST(TestRTWorkerPool, rethrows_task_exceptions)
+{
+  RTWorkerPoolParams params;
+  params.number_of_workers = 2;
+  RTWorkerPool pool(params);
+
+  std::atomic_int executed{0};
+  EXPECT_THROW(
+    pool.parallel_for(
+      8,
+      [&](std::size_t i)
+      {
+        executed++;
+        if (i == 5)
+        {
+          throw std::runtime_error("task failed");
+        }
+      }),
+    std::runtime_error);
+  EXPECT_EQ(executed.load(), 8);
+
+  // the pool is still usable afterwards
+  executed = 0;
+  pool.parallel_for(8, [&](std::size_t) { executed++; });
+  EXPECT_EQ(executed.load(), 8);
+}
+
+TEST(TestRTWorkerPool, try_parallel_for_fails_while_the_pool_is_busy)
+{
+  RTWorkerPoolParams params;
+  params.number_of_workers = 2;
+  RTWorkerPool pool(params);
+
+  std::atomic_int executed{0};
+  std::atomic_int rejected{0};
+  pool.parallel_for(
+    4,
+    [&](std::size_t)
+    {
+      // a task of the pool can't wait for the pool
+      if (!pool.try_parallel_for(2, [&](std::size_t) { executed++; }))
+      {
+        rejected++;
+      }
+    });
+  EXPECT_EQ(rejected.load(), 4);
+  EXPECT_EQ(executed.load(), 0);
+
+  // the pool is idle again once the job is finished
+  EXPECT_TRUE(pool.try_parallel_for(8, [&](std::size_t) { executed++; }));
+  EXPECT_EQ(executed.load(), 8);
+}
+
+TEST(TestRTWorkerPool, parallel_for_runs_sequentially_while_the_pool_is_busy)
+{
+  RTWorkerPoolParams params;
+  params.number_of_workers = 2;
+  RTWorkerPool pool(params);
+
+  std::atomic_int executed{0};
+  pool.parallel_for(
+    4,
+    [&](std::size_t)
+    {
+      // the nested loop doesn't overwrite the job of the pool, its tasks run in this thread
+      const auto thread_id = std::this_thread::get_id();
+      pool.parallel_for(
+        3,
+        [&](std::size_t)
+        {
+          EXPECT_EQ(std::this_thread::get_id(), thread_id);
+          executed++;
+        });
+      EXPECT_THROW(
+        pool.parallel_for(
+          2, [](std::size_t) { throw std::runtime_error("failed task"); }, {0, 0}),
+        std::runtime_error);
+    });
+  EXPECT_EQ(executed.load(), 12);
+}
+
+TEST(TestRTWorkerPool, dedicated_workers_execute_only_their_tasks)
+{
+  RTWorkerPoolParams params;
+  params.number_of_workers = 2;
+  params.dedicated_workers.resize(2);
+  RTWorkerPool pool(params);
+  EXPECT_EQ(pool.get_number_of_dedicated_workers(), 2u);
+
+  // the tasks 1 and 4 run on the first dedicated worker, the task 2 on the second one, and the
+  // invalid assignment of the task 5 runs on the shared workers
+  const std::vector<int> task_workers = {-1, 0, 1, -1, 0, 7};
+  for (int cycle = 0; cycle < 100; ++cycle)
+  {
+    std::vector<std::thread::id> thread_ids(task_workers.size());
+    std::vector<int> executed(task_workers.size(), 0);
+    pool.parallel_for(
+      task_workers.size(),
+      [&](std::size_t i)
+      {
+        executed[i]++;
+        thread_ids[i] = std::this_thread::get_id();
+      },
+      task_workers);
+    ASSERT_THAT(executed, testing::Each(1));
+    EXPECT_EQ(thread_ids[1], thread_ids[4]);
+    const std::set<std::thread::id> dedicated_thread_ids = {thread_ids[1], thread_ids[2]};
+    EXPECT_EQ(dedicated_thread_ids.size(), 2u);
+    for (const std::size_t shared_task : {0u, 3u, 5u})
+    {
+      EXPECT_EQ(dedicated_thread_ids.count(thread_ids[shared_task]), 0u);
+    }
+    EXPECT_EQ(dedicated_thread_ids.count(std::this_thread::get_id()), 0u);
+  }
+}
+
+TEST(TestRTWorkerPool, dedicated_tasks_run_without_shared_workers)
+{
+  RTWorkerPoolParams params;
+  params.dedicated_workers.resize(1);
+  RTWorkerPool pool(params);
+
+  std::vector<std::thread::id> thread_ids(3);
+  pool.parallel_for(
+    thread_ids.size(), [&](std::size_t i) { thread_ids[i] = std::this_thread::get_id(); },
+    std::vector<int>{-1, 0, -1});
+  EXPECT_EQ(thread_ids[0], std::this_thread::get_id());
+  EXPECT_EQ(thread_ids[2], std::this_thread::get_id());
+  EXPECT_NE(thread_ids[1], std::this_thread::get_id());
+}
@@ -0,0 +1,63 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "hardware_interface/sample_batch.hpp"
+
+using hardware_interface::SampleBatch;
+using hardware_interface::SampleRing;
+
+TEST(TestSampleBatch, ring_keeps_the_samples_in_order)
+{
+  SampleRing<double> ring(4, 0.0);
+  EXPECT_EQ(ring.capacity(), 4u);
+  EXPECT_TRUE(ring.get_batch().empty());
+
+  ring.push(1.0, 10);
+  ring.push(2.0, 20);
+  const SampleBatch<double> batch = ring.get_batch();
+  ASSERT_EQ(batch.size(), 2u);
+  EXPECT_THAT(std::vector<double>(batch.begin(), batch.end()), testing::ElementsAre(1.0, 2.0));
+  EXPECT_EQ(batch.stamp(1), 20);
+  EXPECT_EQ(batch.get_dropped_samples(), 0u);
+}
+
+TEST(TestSampleBatch, full_ring_overwrites_the_oldest_samples)
+{
+  SampleRing<float> ring(3, 0.0f);
+  for (int i = 1; i <= 7; ++i)
+  {
+    ring.push(static_cast<float>(i), i * 100);
+  }
+  // the samples stay contiguous after the ring wrapped around
+  const SampleBatch<float> batch = ring.get_batch();
+  ASSERT_EQ(batch.size(), 3u);
+  EXPECT_THAT(
+    std::vector<float>(batch.values(), batch.values() + batch.size()),
+    testing::ElementsAre(5.0f, 6.0f, 7.0f));
+  EXPECT_THAT(
+    std::vector<int64_t>(batch.stamps(), batch.stamps() + batch.size()),
+    testing::ElementsAre(500, 600, 700));
+  EXPECT_EQ(batch.get_dropped_samples(), 4u);
+
+  ring.clear();
+  EXPECT_EQ(ring.size(), 0u);
+  ring.push(8.0f, 800);
+  EXPECT_EQ(ring.get_batch().value(0), 8.0f);
+  EXPECT_EQ(ring.get_batch().get_dropped_samples(), 0u);
+}
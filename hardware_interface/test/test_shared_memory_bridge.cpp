@@ -0,0 +1,149 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/shared_memory_bridge.hpp"
+
+using hardware_interface::SharedMemoryBridge;
+using testing::ElementsAre;
+
+namespace
+{
+// the segment names are unique per process, so that parallel test runs don't interfere
+std::string make_segment_name(const std::string & test_name)
+{
+  return "/test_shm_bridge_" + test_name + "_" + std::to_string(getpid());
+}
+}  // namespace
+
+TEST(TestSharedMemoryBridge, open_parses_interface_names)
+{
+  const std::string segment_name = make_segment_name("names");
+  SharedMemoryBridge driver;
+  ASSERT_FALSE(driver.open(segment_name));
+
+  SharedMemoryBridge component;
+  ASSERT_NO_THROW(component.create(
+    segment_name, {"joint1/position", "joint1/velocity"}, {"joint1/position"}));
+  ASSERT_TRUE(driver.open(segment_name));
+  EXPECT_TRUE(driver.is_active());
+  EXPECT_THAT(
+    driver.get_state_interface_names(), ElementsAre("joint1/position", "joint1/velocity"));
+  EXPECT_THAT(driver.get_command_interface_names(), ElementsAre("joint1/position"));
+
+  // nothing was published yet
+  std::vector<double> values;
+  uint32_t frame = 1;
+  int64_t stamp_ns = 1;
+  ASSERT_TRUE(component.read_states(values, frame, stamp_ns));
+  EXPECT_EQ(frame, 0u);
+  ASSERT_EQ(values.size(), 2u);
+  EXPECT_TRUE(std::isnan(values[0]));
+
+  component.close();
+  EXPECT_FALSE(driver.is_active());
+  EXPECT_FALSE(driver.read_commands(values, frame, stamp_ns));
+  EXPECT_FALSE(driver.open(segment_name));
+}
+
+TEST(TestSharedMemoryBridge, invalid_segment_name_throws)
+{
+  SharedMemoryBridge component;
+  EXPECT_THROW(component.create("no_slash", {"a/b"}, {}), std::runtime_error);
+  EXPECT_FALSE(component.is_active());
+}
+
+TEST(TestSharedMemoryBridge, exchange_states_and_commands)
+{
+  const std::string segment_name = make_segment_name("exchange");
+  SharedMemoryBridge component;
+  component.create(segment_name, {"joint1/position", "joint1/velocity"}, {"joint1/position"});
+  SharedMemoryBridge driver;
+  ASSERT_TRUE(driver.open(segment_name));
+
+  EXPECT_TRUE(component.write_commands({1.5}, 10));
+  // the number of values has to match the layout
+  EXPECT_FALSE(component.write_commands({1.5, 2.0}, 10));
+  EXPECT_FALSE(driver.write_states({1.0}, 20));
+
+  std::vector<double> values;
+  uint32_t frame = 0;
+  int64_t stamp_ns = 0;
+  ASSERT_TRUE(driver.wait_for_commands(0, std::chrono::milliseconds(100)));
+  ASSERT_TRUE(driver.read_commands(values, frame, stamp_ns));
+  EXPECT_THAT(values, ElementsAre(1.5));
+  EXPECT_EQ(frame, 1u);
+  EXPECT_EQ(stamp_ns, 10);
+  // no new frame
+  EXPECT_FALSE(driver.wait_for_commands(frame, std::chrono::milliseconds(1)));
+
+  EXPECT_TRUE(driver.write_states({1.5, 0.5}, 20));
+  ASSERT_TRUE(component.read_states(values, frame, stamp_ns));
+  EXPECT_THAT(values, ElementsAre(1.5, 0.5));
+  EXPECT_EQ(frame, 1u);
+  EXPECT_EQ(stamp_ns, 20);
+}
+
+TEST(TestSharedMemoryBridge, wait_is_woken_up_by_the_other_side)
+{
+  const std::string segment_name = make_segment_name("handoff");
+  SharedMemoryBridge component;
+  component.create(segment_name, {"joint1/position"}, {"joint1/position"});
+
+  // the driver mirrors every command frame to the states
+  std::atomic_bool stop = false;
+  std::thread driver_thread(
+    [&]()
+    {
+      SharedMemoryBridge driver;
+      ASSERT_TRUE(driver.open(segment_name));
+      std::vector<double> commands;
+      uint32_t frame = 0;
+      int64_t stamp_ns = 0;
+      while (!stop)
+      {
+        if (driver.wait_for_commands(frame, std::chrono::milliseconds(10)))
+        {
+          ASSERT_TRUE(driver.read_commands(commands, frame, stamp_ns));
+          driver.write_states(commands, stamp_ns);
+        }
+      }
+    });
+
+  std::vector<double> states;
+  uint32_t state_frame = 0;
+  int64_t stamp_ns = 0;
+  for (int i = 1; i <= 100; ++i)
+  {
+    ASSERT_TRUE(component.write_commands({static_cast<double>(i)}, i));
+    // with a generous deadline, so that the test doesn't depend on the scheduling
+    ASSERT_TRUE(component.wait_for_states(state_frame, std::chrono::seconds(5)));
+    ASSERT_TRUE(component.read_states(states, state_frame, stamp_ns));
+    // a frame is never published partially
+    EXPECT_EQ(states[0], static_cast<double>(stamp_ns));
+    // the driver might skip the intermediate frames, but never goes back
+    EXPECT_LE(stamp_ns, i);
+  }
+  stop = true;
+  driver_thread.join();
+}
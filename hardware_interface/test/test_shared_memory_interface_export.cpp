@@ -0,0 +1,185 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/shared_memory_interface_export.hpp"
+
+using hardware_interface::CommandInterface;
+using hardware_interface::HandleDataType;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceInfo;
+using hardware_interface::SharedMemoryInterfaceExporter;
+using hardware_interface::SharedMemoryInterfaceReader;
+using hardware_interface::StateInterface;
+using testing::ElementsAre;
+
+namespace
+{
+InterfaceDescription make_description(
+  const std::string & prefix, const std::string & name, const std::string & data_type = "double")
+{
+  InterfaceInfo info;
+  info.name = name;
+  info.data_type = data_type;
+  return InterfaceDescription(prefix, info);
+}
+
+// the segment names are unique per process, so that parallel test runs don't interfere
+std::string make_segment_name(const std::string & test_name)
+{
+  return "/test_shm_export_" + test_name + "_" + std::to_string(getpid());
+}
+}  // namespace
+
+class TestSharedMemoryInterfaceExport : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    joint1_position_ = std::make_shared<StateInterface>(make_description("joint1", "position"));
+    joint1_velocity_ = std::make_shared<StateInterface>(make_description("joint1", "velocity"));
+    gpio_flag_ = std::make_shared<StateInterface>(make_description("gpio", "flag", "bool"));
+    joint1_command_ = std::make_shared<CommandInterface>(make_description("joint1", "position"));
+    ASSERT_TRUE(joint1_position_->set_value(1.0));
+    ASSERT_TRUE(joint1_velocity_->set_value(2.0));
+    ASSERT_TRUE(gpio_flag_->set_value(true));
+    ASSERT_TRUE(joint1_command_->set_value(3.0));
+  }
+
+  StateInterface::SharedPtr joint1_position_;
+  StateInterface::SharedPtr joint1_velocity_;
+  StateInterface::SharedPtr gpio_flag_;
+  CommandInterface::SharedPtr joint1_command_;
+};
+
+TEST_F(TestSharedMemoryInterfaceExport, export_layout_and_values)
+{
+  const std::string segment_name = make_segment_name("layout");
+  SharedMemoryInterfaceExporter exporter(segment_name);
+  SharedMemoryInterfaceReader reader;
+  ASSERT_FALSE(reader.open(segment_name));
+
+  exporter.configure({joint1_position_, joint1_velocity_, gpio_flag_}, {joint1_command_});
+  ASSERT_EQ(4u, exporter.get_number_of_interfaces());
+  ASSERT_TRUE(reader.open(segment_name));
+  EXPECT_TRUE(reader.is_active());
+  EXPECT_THAT(
+    reader.get_interface_names(),
+    ElementsAre("joint1/position", "joint1/velocity", "gpio/flag", "joint1/position"));
+  EXPECT_EQ(3u, reader.get_number_of_state_interfaces());
+  EXPECT_EQ(HandleDataType::BOOL, reader.get_data_types()[2]);
+
+  // the values are NaN until they are updated
+  SharedMemoryInterfaceReader::Snapshot snapshot;
+  ASSERT_TRUE(reader.read(snapshot));
+  ASSERT_EQ(4u, snapshot.values.size());
+  EXPECT_TRUE(std::isnan(snapshot.values[0]));
+  EXPECT_EQ(0u, snapshot.update_count);
+
+  exporter.update_state_values(100);
+  ASSERT_TRUE(reader.read(snapshot));
+  EXPECT_DOUBLE_EQ(1.0, snapshot.values[0]);
+  EXPECT_DOUBLE_EQ(2.0, snapshot.values[1]);
+  EXPECT_DOUBLE_EQ(1.0, snapshot.values[2]);
+  EXPECT_TRUE(std::isnan(snapshot.values[3]));
+  EXPECT_EQ(100, snapshot.state_stamp_ns);
+
+  exporter.update_command_values(200);
+  ASSERT_TRUE(reader.read(snapshot));
+  EXPECT_DOUBLE_EQ(3.0, snapshot.values[3]);
+  EXPECT_EQ(200, snapshot.command_stamp_ns);
+  EXPECT_EQ(2u, snapshot.update_count);
+}
+
+TEST_F(TestSharedMemoryInterfaceExport, reconfigure_marks_previous_segment_stale)
+{
+  const std::string segment_name = make_segment_name("reconfigure");
+  SharedMemoryInterfaceExporter exporter(segment_name);
+  exporter.configure({joint1_position_}, {});
+  SharedMemoryInterfaceReader reader;
+  ASSERT_TRUE(reader.open(segment_name));
+
+  exporter.configure({joint1_position_, joint1_velocity_}, {});
+  SharedMemoryInterfaceReader::Snapshot snapshot;
+  EXPECT_FALSE(reader.is_active());
+  EXPECT_FALSE(reader.read(snapshot));
+
+  ASSERT_TRUE(reader.open(segment_name));
+  EXPECT_THAT(reader.get_interface_names(), ElementsAre("joint1/position", "joint1/velocity"));
+  exporter.update_state_values(1);
+  ASSERT_TRUE(reader.read(snapshot));
+  EXPECT_THAT(snapshot.values, ElementsAre(1.0, 2.0));
+}
+
+TEST_F(TestSharedMemoryInterfaceExport, destruction_removes_the_segment)
+{
+  const std::string segment_name = make_segment_name("destruction");
+  SharedMemoryInterfaceReader reader;
+  {
+    SharedMemoryInterfaceExporter exporter(segment_name);
+    exporter.configure({joint1_position_}, {});
+    ASSERT_TRUE(reader.open(segment_name));
+  }
+  EXPECT_FALSE(reader.is_active());
+  SharedMemoryInterfaceReader other_reader;
+  EXPECT_FALSE(other_reader.open(segment_name));
+}
+
+TEST_F(TestSharedMemoryInterfaceExport, invalid_segment_name_throws)
+{
+  SharedMemoryInterfaceExporter exporter("no_leading_slash");
+  EXPECT_THROW(exporter.configure({joint1_position_}, {}), std::runtime_error);
+}
+
+TEST_F(TestSharedMemoryInterfaceExport, readers_get_consistent_snapshots)
+{
+  const std::string segment_name = make_segment_name("consistency");
+  SharedMemoryInterfaceExporter exporter(segment_name);
+  exporter.configure({joint1_position_, joint1_velocity_}, {});
+  SharedMemoryInterfaceReader reader;
+  ASSERT_TRUE(reader.open(segment_name));
+
+  std::atomic_bool done{false};
+  std::thread reader_thread(
+    [&]()
+    {
+      SharedMemoryInterfaceReader::Snapshot snapshot;
+      while (!done)
+      {
+        ASSERT_TRUE(reader.read(snapshot));
+        if (snapshot.update_count > 0)
+        {
+          ASSERT_DOUBLE_EQ(snapshot.values[0], snapshot.values[1]);
+          ASSERT_EQ(static_cast<double>(snapshot.state_stamp_ns), snapshot.values[0]);
+        }
+      }
+    });
+  for (int i = 1; i <= 10000; ++i)
+  {
+    ASSERT_TRUE(joint1_position_->set_value(static_cast<double>(i)));
+    ASSERT_TRUE(joint1_velocity_->set_value(static_cast<double>(i)));
+    exporter.update_state_values(i);
+  }
+  done = true;
+  reader_thread.join();
+}
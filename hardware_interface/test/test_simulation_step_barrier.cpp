@@ -0,0 +1,82 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/simulation_step_barrier.hpp"
+
+using hardware_interface::SimulationStepBarrier;
+using namespace std::chrono_literals;
+
+namespace
+{
+// the segment names are unique per process, so that parallel test runs don't interfere
+std::string make_segment_name(const std::string & test_name)
+{
+  return "/test_step_barrier_" + test_name + "_" + std::to_string(getpid());
+}
+}  // namespace
+
+TEST(TestSimulationStepBarrier, runs_the_cycles_in_lock_step)
+{
+  const std::string segment_name = make_segment_name("lock_step");
+  SimulationStepBarrier simulator;
+  ASSERT_FALSE(simulator.open(segment_name));
+
+  SimulationStepBarrier control_loop;
+  ASSERT_NO_THROW(control_loop.create(segment_name));
+  ASSERT_TRUE(simulator.open(segment_name));
+  EXPECT_TRUE(simulator.is_active());
+
+  // no cycle is requested yet
+  int64_t time_ns = 0;
+  EXPECT_FALSE(control_loop.wait_for_step(1ms, time_ns));
+
+  std::vector<int64_t> cycle_times;
+  std::thread loop(
+    [&control_loop, &cycle_times]()
+    {
+      int64_t cycle_time_ns = 0;
+      while (cycle_times.size() < 3)
+      {
+        if (control_loop.wait_for_step(1s, cycle_time_ns))
+        {
+          cycle_times.push_back(cycle_time_ns);
+          EXPECT_TRUE(control_loop.complete_step(cycle_time_ns));
+        }
+      }
+    });
+  for (int64_t step = 1; step <= 3; ++step)
+  {
+    EXPECT_TRUE(simulator.step(step * 1000000, 1s));
+  }
+  loop.join();
+  EXPECT_THAT(cycle_times, testing::ElementsAre(1000000, 2000000, 3000000));
+
+  // without the control loop, the step times out
+  EXPECT_FALSE(simulator.step(4000000, 1ms));
+  // the request is still pending for the control loop
+  ASSERT_TRUE(control_loop.wait_for_step(1ms, time_ns));
+  EXPECT_EQ(time_ns, 4000000);
+
+  control_loop.close();
+  EXPECT_FALSE(simulator.is_active());
+  EXPECT_FALSE(simulator.step(5000000, 1ms));
+}
@@ -0,0 +1,151 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/state_snapshot_publisher.hpp"
+#include "rclcpp/executors.hpp"
+#include "rclcpp/node.hpp"
+
+using control_msgs::msg::DynamicInterfaceGroupValues;
+using hardware_interface::StateSnapshotGroup;
+using hardware_interface::StateSnapshotPublisher;
+using namespace std::chrono_literals;
+
+class TestStateSnapshotPublisher : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    values_subscription_ = subscriber_node_->create_subscription<DynamicInterfaceGroupValues>(
+      "/test_state_snapshot_publisher/values", rclcpp::SensorDataQoS(),
+      [this](const DynamicInterfaceGroupValues & msg) { values_.push_back(msg); });
+  }
+
+  std::vector<StateSnapshotGroup> make_groups()
+  {
+    StateSnapshotGroup arm;
+    arm.name = "arm";
+    arm.interface_names = {"joint1/position", "joint2/position"};
+    arm.values = arm_values_.data();
+    StateSnapshotGroup gripper;
+    gripper.name = "gripper";
+    gripper.interface_names = {"finger/position"};
+    gripper.interfaces = {finger_position_};
+    return {arm, gripper};
+  }
+
+  /// Spins the subscriber until the predicate holds or the timeout expires
+  bool spin_until(const std::function<bool()> & predicate)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!predicate() && std::chrono::steady_clock::now() < deadline)
+    {
+      rclcpp::spin_some(subscriber_node_);
+      std::this_thread::sleep_for(1ms);
+    }
+    return predicate();
+  }
+
+  rclcpp::Node::SharedPtr node_ = std::make_shared<rclcpp::Node>("test_state_snapshot_publisher");
+  rclcpp::Node::SharedPtr subscriber_node_ =
+    std::make_shared<rclcpp::Node>("test_state_snapshot_subscriber");
+  rclcpp::Subscription<DynamicInterfaceGroupValues>::SharedPtr values_subscription_;
+  std::vector<DynamicInterfaceGroupValues> values_;
+  std::vector<double> arm_values_ = {1.0, 2.0};
+  hardware_interface::StateInterface::SharedPtr finger_position_ =
+    std::make_shared<hardware_interface::StateInterface>("finger", "position", "double", "0.5");
+};
+
+TEST_F(TestStateSnapshotPublisher, publishes_the_values_of_all_groups_without_names)
+{
+  StateSnapshotPublisher publisher(node_, 1);
+  publisher.set_groups(make_groups());
+  EXPECT_EQ(publisher.get_number_of_values(), 3u);
+
+  ASSERT_TRUE(spin_until(
+    [&]()
+    {
+      // the subscription may not be matched yet when the first snapshots are published
+      publisher.capture(rclcpp::Time(1, 0));
+      return !values_.empty();
+    }));
+  const auto & msg = values_.back();
+  EXPECT_EQ(rclcpp::Time(msg.header.stamp), rclcpp::Time(1, 0));
+  EXPECT_TRUE(msg.interface_groups.empty());
+  ASSERT_EQ(msg.interface_values.size(), 2u);
+  EXPECT_TRUE(msg.interface_values[0].interface_names.empty());
+  EXPECT_THAT(msg.interface_values[0].values, ::testing::ElementsAre(1.0, 2.0));
+  EXPECT_THAT(msg.interface_values[1].values, ::testing::ElementsAre(0.5));
+}
+
+TEST_F(TestStateSnapshotPublisher, publishes_the_names_once_for_late_subscribers)
+{
+  StateSnapshotPublisher publisher(node_, 1);
+  publisher.set_groups(make_groups());
+
+  std::vector<DynamicInterfaceGroupValues> names;
+  auto names_subscription = subscriber_node_->create_subscription<DynamicInterfaceGroupValues>(
+    "/test_state_snapshot_publisher/names", rclcpp::QoS(1).reliable().transient_local(),
+    [&names](const DynamicInterfaceGroupValues & msg) { names.push_back(msg); });
+  ASSERT_TRUE(spin_until([&names]() { return !names.empty(); }));
+  EXPECT_THAT(names[0].interface_groups, ::testing::ElementsAre("arm", "gripper"));
+  ASSERT_EQ(names[0].interface_values.size(), 2u);
+  EXPECT_THAT(
+    names[0].interface_values[0].interface_names,
+    ::testing::ElementsAre("joint1/position", "joint2/position"));
+  EXPECT_THAT(
+    names[0].interface_values[1].interface_names, ::testing::ElementsAre("finger/position"));
+}
+
+TEST_F(TestStateSnapshotPublisher, captures_every_decimation_cycles)
+{
+  StateSnapshotPublisher publisher(node_, 3);
+  publisher.set_groups(make_groups());
+
+  std::size_t captured = 0;
+  for (int i = 0; i < 9; ++i)
+  {
+    captured += publisher.capture(rclcpp::Time(i, 0)) ? 1u : 0u;
+    // the publishing thread is idle at the next capture
+    std::this_thread::sleep_for(5ms);
+  }
+  EXPECT_EQ(captured, 3u);
+}
+
+TEST_F(TestStateSnapshotPublisher, captures_nothing_without_groups)
+{
+  StateSnapshotPublisher publisher(node_, 1);
+  EXPECT_FALSE(publisher.capture(rclcpp::Time(1, 0)));
+  publisher.set_groups(make_groups());
+  EXPECT_TRUE(publisher.capture(rclcpp::Time(2, 0)));
+  publisher.set_groups({});
+  EXPECT_FALSE(publisher.capture(rclcpp::Time(3, 0)));
+  EXPECT_EQ(publisher.get_number_of_values(), 0u);
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleMock(&argc, argv);
+  const int result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
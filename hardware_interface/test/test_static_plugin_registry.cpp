@@ -0,0 +1,78 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+
+#include "hardware_interface/static_plugin_registry.hpp"
+
+namespace
+{
+class Base
+{
+public:
+  virtual ~Base() = default;
+  virtual std::string get_name() const = 0;
+};
+
+class First : public Base
+{
+public:
+  std::string get_name() const override { return "first"; }
+};
+
+class Second : public Base
+{
+public:
+  std::string get_name() const override { return "second"; }
+};
+
+class OtherBase
+{
+public:
+  virtual ~OtherBase() = default;
+};
+}  // namespace
+
+HARDWARE_INTERFACE_REGISTER_STATIC_PLUGIN(First, Base, "test_plugins/First")
+HARDWARE_INTERFACE_REGISTER_STATIC_PLUGIN(Second, Base, "test_plugins/Second")
+
+using hardware_interface::StaticPluginRegistry;
+using ::testing::ElementsAre;
+
+TEST(TestStaticPluginRegistry, creates_the_registered_plugins)
+{
+  EXPECT_THAT(
+    StaticPluginRegistry<Base>::get_declared_classes(),
+    ElementsAre("test_plugins/First", "test_plugins/Second"));
+  ASSERT_TRUE(StaticPluginRegistry<Base>::is_class_available("test_plugins/Second"));
+  const auto plugin = StaticPluginRegistry<Base>::create_unique_instance("test_plugins/Second");
+  ASSERT_NE(plugin, nullptr);
+  EXPECT_EQ(plugin->get_name(), "second");
+
+  EXPECT_FALSE(StaticPluginRegistry<Base>::is_class_available("test_plugins/Unknown"));
+  EXPECT_EQ(StaticPluginRegistry<Base>::create_unique_instance("test_plugins/Unknown"), nullptr);
+  // the registries of the base classes are separate, like the pluginlib class loaders
+  EXPECT_FALSE(StaticPluginRegistry<OtherBase>::is_class_available("test_plugins/First"));
+}
+
+TEST(TestStaticPluginRegistry, keeps_the_first_registration_of_a_name)
+{
+  EXPECT_FALSE(StaticPluginRegistry<Base>::register_class(
+    "test_plugins/First", []() -> std::unique_ptr<Base> { return std::make_unique<Second>(); }));
+  EXPECT_EQ(
+    StaticPluginRegistry<Base>::create_unique_instance("test_plugins/First")->get_name(), "first");
+}
@@ -0,0 +1,429 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/types/statistics_types.hpp"
+
+using ros2_control::LatencyHistogram;
+using ros2_control::MovingAverageStatistics;
+using ros2_control::MovingAverageStatisticsData;
+using ros2_control::parse_statistics_config;
+using ros2_control::StatisticsConfig;
+using ros2_control::StatisticsSnapshot;
+using ros2_control::StatisticsType;
+
+// the relative error of the percentiles is bounded by the width of the buckets
+constexpr double kRelativeError = 1.0 / (2.0 * LatencyHistogram::NUMBER_OF_SUB_BUCKETS);
+
+TEST(TestLatencyHistogram, empty_histogram_returns_nan)
+{
+  LatencyHistogram histogram;
+  EXPECT_EQ(0u, histogram.get_count());
+  EXPECT_TRUE(std::isnan(histogram.get_percentile(50.0)));
+  const auto percentiles = histogram.get_percentiles();
+  EXPECT_TRUE(std::isnan(percentiles.p50));
+  EXPECT_TRUE(std::isnan(percentiles.p99_99));
+}
+
+TEST(TestLatencyHistogram, percentiles_of_uniform_distribution)
+{
+  LatencyHistogram histogram;
+  for (int i = 1; i <= 10000; ++i)
+  {
+    histogram.add_measurement(static_cast<double>(i));
+  }
+  EXPECT_EQ(10000u, histogram.get_count());
+  EXPECT_NEAR(5000.0, histogram.get_percentile(50.0), 5000.0 * kRelativeError);
+  EXPECT_NEAR(9900.0, histogram.get_percentile(99.0), 9900.0 * kRelativeError);
+  EXPECT_NEAR(9990.0, histogram.get_percentile(99.9), 9990.0 * kRelativeError);
+  EXPECT_NEAR(9999.0, histogram.get_percentile(99.99), 9999.0 * kRelativeError);
+  EXPECT_NEAR(1.0, histogram.get_percentile(0.0), kRelativeError);
+  EXPECT_NEAR(10000.0, histogram.get_percentile(100.0), 10000.0 * kRelativeError);
+}
+
+TEST(TestLatencyHistogram, rare_outliers_show_in_the_tail)
+{
+  LatencyHistogram histogram;
+  for (int i = 0; i < 9995; ++i)
+  {
+    histogram.add_measurement(10.0);
+  }
+  for (int i = 0; i < 5; ++i)
+  {
+    histogram.add_measurement(500.0);
+  }
+  const auto percentiles = histogram.get_percentiles();
+  EXPECT_NEAR(10.0, percentiles.p50, 10.0 * kRelativeError);
+  EXPECT_NEAR(10.0, percentiles.p99, 10.0 * kRelativeError);
+  EXPECT_NEAR(10.0, percentiles.p99_9, 10.0 * kRelativeError);
+  EXPECT_NEAR(500.0, percentiles.p99_99, 500.0 * kRelativeError);
+}
+
+TEST(TestLatencyHistogram, out_of_range_and_invalid_values)
+{
+  LatencyHistogram histogram;
+  histogram.add_measurement(std::numeric_limits<double>::quiet_NaN());
+  histogram.add_measurement(std::numeric_limits<double>::infinity());
+  EXPECT_EQ(0u, histogram.get_count());
+
+  histogram.add_measurement(0.0);
+  histogram.add_measurement(-1.0);
+  histogram.add_measurement(1.e15);
+  EXPECT_EQ(3u, histogram.get_count());
+  EXPECT_DOUBLE_EQ(LatencyHistogram::get_bucket_value(0, 0), histogram.get_percentile(50.0));
+  EXPECT_DOUBLE_EQ(
+    LatencyHistogram::get_bucket_value(
+      LatencyHistogram::NUMBER_OF_EXPONENTS - 1, LatencyHistogram::NUMBER_OF_SUB_BUCKETS - 1),
+    histogram.get_percentile(100.0));
+
+  histogram.reset();
+  EXPECT_EQ(0u, histogram.get_count());
+  EXPECT_TRUE(std::isnan(histogram.get_percentile(100.0)));
+}
+
+TEST(TestLatencyHistogram, concurrent_readers_while_adding)
+{
+  LatencyHistogram histogram;
+  std::thread reader(
+    [&histogram]()
+    {
+      for (int i = 0; i < 1000; ++i)
+      {
+        const double p99 = histogram.get_percentile(99.0);
+        ASSERT_TRUE(std::isnan(p99) || (p99 > 0.0 && p99 < 200.0));
+      }
+    });
+  for (int i = 0; i < 100000; ++i)
+  {
+    histogram.add_measurement(static_cast<double>(1 + i % 100));
+  }
+  reader.join();
+  EXPECT_EQ(100000u, histogram.get_count());
+}
+
+TEST(TestMovingAverageStatistics, percentiles_follow_the_window)
+{
+  MovingAverageStatistics statistics;
+  for (int i = 1; i <= 100; ++i)
+  {
+    statistics.add_measurement(static_cast<double>(i));
+  }
+  EXPECT_NEAR(99.0, statistics.get_percentile(99.0), 99.0 * kRelativeError);
+  EXPECT_EQ(100u, statistics.get_histogram().get_count());
+
+  statistics.reset();
+  EXPECT_TRUE(std::isnan(statistics.get_percentiles().p99));
+  statistics.add_measurement(42.0);
+  EXPECT_NEAR(42.0, statistics.get_percentiles().p99, 42.0 * kRelativeError);
+}
+
+TEST(TestMovingAverageStatistics, parse_statistics_config)
+{
+  auto config = parse_statistics_config("cumulative");
+  EXPECT_EQ(config.type, StatisticsType::CUMULATIVE);
+  EXPECT_FALSE(config.uses_time());
+  EXPECT_EQ(parse_statistics_config("").type, StatisticsType::CUMULATIVE);
+
+  config = parse_statistics_config("window:1000");
+  EXPECT_EQ(config.type, StatisticsType::SLIDING_WINDOW);
+  EXPECT_EQ(config.window_size, 1000u);
+  EXPECT_DOUBLE_EQ(config.window_duration, 0.0);
+  EXPECT_FALSE(config.uses_time());
+
+  config = parse_statistics_config("window:2.5s");
+  EXPECT_EQ(config.window_size, StatisticsConfig::DEFAULT_WINDOW_CAPACITY);
+  EXPECT_DOUBLE_EQ(config.window_duration, 2.5);
+  EXPECT_TRUE(config.uses_time());
+
+  config = parse_statistics_config("window:500,1s");
+  EXPECT_EQ(config.window_size, 500u);
+  EXPECT_DOUBLE_EQ(config.window_duration, 1.0);
+
+  config = parse_statistics_config("ewma:100");
+  EXPECT_EQ(config.type, StatisticsType::EXPONENTIAL_DECAY);
+  EXPECT_DOUBLE_EQ(config.half_life, 100.0);
+  EXPECT_FALSE(config.uses_time());
+  config = parse_statistics_config("ewma:0.5s");
+  EXPECT_DOUBLE_EQ(config.half_life, 0.5);
+  EXPECT_TRUE(config.uses_time());
+
+  for (const auto & invalid :
+       {"window", "window:", "window:0", "window:1.5", "window:10,20", "window:-1s", "ewma:0",
+        "ewma:1,2", "median:10"})
+  {
+    EXPECT_THROW(parse_statistics_config(invalid), std::invalid_argument) << invalid;
+  }
+}
+
+TEST(TestMovingAverageStatistics, sliding_window_of_samples)
+{
+  MovingAverageStatistics statistics;
+  statistics.configure(parse_statistics_config("window:3"));
+  // a spike at startup is forgotten once it left the window
+  statistics.add_measurement(100.0);
+  EXPECT_DOUBLE_EQ(100.0, statistics.get_max());
+  for (double value : {1.0, 2.0, 3.0})
+  {
+    statistics.add_measurement(value);
+  }
+  EXPECT_EQ(3u, statistics.get_count());
+  EXPECT_NEAR(2.0, statistics.get_average(), 1e-9);
+  EXPECT_DOUBLE_EQ(1.0, statistics.get_min());
+  EXPECT_DOUBLE_EQ(3.0, statistics.get_max());
+  EXPECT_NEAR(std::sqrt(2.0 / 3.0), statistics.get_standard_deviation(), 1e-12);
+  EXPECT_EQ(3u, statistics.get_histogram().get_count());
+  EXPECT_NEAR(3.0, statistics.get_percentile(100.0), 3.0 * kRelativeError);
+
+  // the minimum and the maximum follow the window
+  statistics.add_measurement(2.5);
+  EXPECT_DOUBLE_EQ(2.0, statistics.get_min());
+  statistics.add_measurement(2.0);
+  statistics.add_measurement(0.5);
+  EXPECT_DOUBLE_EQ(0.5, statistics.get_min());
+  EXPECT_DOUBLE_EQ(2.5, statistics.get_max());
+  statistics.add_measurement(0.5);
+  EXPECT_DOUBLE_EQ(2.0, statistics.get_max());
+  EXPECT_NEAR(1.0, statistics.get_average(), 1e-9);
+
+  // NaNs are discarded
+  statistics.add_measurement(std::numeric_limits<double>::quiet_NaN());
+  EXPECT_EQ(3u, statistics.get_count());
+
+  // the reset is applied to the histogram by the next measurement
+  statistics.reset();
+  EXPECT_EQ(0u, statistics.get_count());
+  EXPECT_TRUE(std::isnan(statistics.get_average()));
+  statistics.add_measurement(7.0);
+  EXPECT_EQ(1u, statistics.get_histogram().get_count());
+  EXPECT_DOUBLE_EQ(7.0, statistics.get_min());
+  EXPECT_DOUBLE_EQ(7.0, statistics.get_max());
+  EXPECT_DOUBLE_EQ(7.0, statistics.get_average());
+}
+
+TEST(TestMovingAverageStatistics, sliding_window_matches_the_last_samples)
+{
+  MovingAverageStatistics statistics;
+  statistics.configure(parse_statistics_config("window:50"));
+  std::vector<double> values;
+  for (int i = 0; i < 1000; ++i)
+  {
+    const double value = std::sin(i * 0.37) * 10.0 + i * 0.01;
+    values.push_back(value);
+    statistics.add_measurement(value);
+    const auto begin = values.size() > 50 ? values.end() - 50 : values.begin();
+    const std::vector<double> window(begin, values.end());
+    double sum = 0.0;
+    for (double v : window)
+    {
+      sum += v;
+    }
+    const double average = sum / static_cast<double>(window.size());
+    double square_sum = 0.0;
+    for (double v : window)
+    {
+      square_sum += (v - average) * (v - average);
+    }
+    const auto data = statistics.get_statistics();
+    ASSERT_EQ(window.size(), data.sample_count);
+    ASSERT_NEAR(average, data.average, 1e-9);
+    ASSERT_NEAR(
+      std::sqrt(square_sum / static_cast<double>(window.size())), data.standard_deviation, 1e-6);
+    ASSERT_DOUBLE_EQ(*std::min_element(window.begin(), window.end()), data.min);
+    ASSERT_DOUBLE_EQ(*std::max_element(window.begin(), window.end()), data.max);
+  }
+}
+
+TEST(TestMovingAverageStatistics, sliding_window_of_duration)
+{
+  MovingAverageStatistics statistics;
+  statistics.configure(parse_statistics_config("window:1s"));
+  const auto start = std::chrono::steady_clock::time_point();
+  statistics.add_measurement(100.0, start);
+  statistics.add_measurement(1.0, start + std::chrono::milliseconds(500));
+  statistics.add_measurement(2.0, start + std::chrono::milliseconds(900));
+  EXPECT_EQ(3u, statistics.get_count());
+  EXPECT_DOUBLE_EQ(100.0, statistics.get_max());
+
+  // the samples older than the duration leave the window
+  statistics.add_measurement(3.0, start + std::chrono::milliseconds(1200));
+  EXPECT_EQ(3u, statistics.get_count());
+  EXPECT_DOUBLE_EQ(3.0, statistics.get_max());
+  EXPECT_NEAR(2.0, statistics.get_average(), 1e-9);
+  statistics.add_measurement(4.0, start + std::chrono::milliseconds(2500));
+  EXPECT_EQ(1u, statistics.get_count());
+  EXPECT_DOUBLE_EQ(4.0, statistics.get_min());
+  EXPECT_DOUBLE_EQ(0.0, statistics.get_standard_deviation());
+}
+
+TEST(TestMovingAverageStatistics, exponential_decay)
+{
+  MovingAverageStatistics statistics;
+  statistics.configure(parse_statistics_config("ewma:1"));
+  statistics.add_measurement(100.0);
+  EXPECT_DOUBLE_EQ(100.0, statistics.get_average());
+  EXPECT_DOUBLE_EQ(0.0, statistics.get_standard_deviation());
+  // with a half-life of one sample, the new samples weigh half of the average
+  statistics.add_measurement(0.0);
+  EXPECT_DOUBLE_EQ(50.0, statistics.get_average());
+  EXPECT_DOUBLE_EQ(50.0, statistics.get_standard_deviation());
+  EXPECT_DOUBLE_EQ(0.0, statistics.get_min());
+  EXPECT_DOUBLE_EQ(75.0, statistics.get_max());
+  for (int i = 0; i < 100; ++i)
+  {
+    statistics.add_measurement(0.0);
+  }
+  // the spike is forgotten
+  EXPECT_NEAR(0.0, statistics.get_average(), 1e-9);
+  EXPECT_NEAR(0.0, statistics.get_max(), 1e-9);
+  EXPECT_EQ(102u, statistics.get_count());
+
+  statistics.configure(parse_statistics_config("ewma:1s"));
+  const auto start = std::chrono::steady_clock::time_point();
+  statistics.add_measurement(8.0, start);
+  statistics.add_measurement(0.0, start + std::chrono::seconds(2));
+  // the weight of the first sample was halved twice
+  EXPECT_DOUBLE_EQ(2.0, statistics.get_average());
+}
+
+TEST(TestStatisticsSnapshot, readers_never_see_a_partial_write)
+{
+  StatisticsSnapshot snapshot;
+  std::atomic_bool done{false};
+  std::thread reader(
+    [&]()
+    {
+      while (!done)
+      {
+        const auto data = snapshot.load();
+        if (data.statistics.sample_count == 0)
+        {
+          continue;
+        }
+        const double value = static_cast<double>(data.statistics.sample_count);
+        ASSERT_EQ(value, data.statistics.average);
+        ASSERT_EQ(value, data.statistics.max);
+        ASSERT_EQ(value, data.current_measurement);
+        ASSERT_EQ(value, data.percentiles.p99_99);
+      }
+    });
+  for (uint64_t i = 1; i <= 100000; ++i)
+  {
+    const double value = static_cast<double>(i);
+    StatisticsSnapshot::Data data;
+    data.statistics.sample_count = i;
+    data.statistics.average = value;
+    data.statistics.max = value;
+    data.current_measurement = value;
+    data.percentiles.p99_99 = value;
+    snapshot.begin_write();
+    snapshot.store(data);
+    snapshot.end_write();
+  }
+  done = true;
+  reader.join();
+  EXPECT_EQ(100000u, snapshot.get_count());
+}
+
+TEST(TestMovingAverageStatistics, concurrent_reset_and_readers)
+{
+  auto statistics = std::make_shared<MovingAverageStatistics>();
+  statistics->reset();
+  std::atomic_bool done{false};
+  std::thread other_thread(
+    [&]()
+    {
+      while (!done)
+      {
+        const auto data = statistics->get_statistics();
+        ASSERT_TRUE(data.sample_count == 0 || (data.min >= 1.0 && data.max <= 10.0));
+        ASSERT_TRUE(data.sample_count == 0 || data.min <= data.average);
+        if (data.sample_count > 1000)
+        {
+          statistics->reset();
+        }
+      }
+    });
+  for (int i = 0; i < 100000; ++i)
+  {
+    statistics->add_measurement(static_cast<double>(1 + i % 10));
+  }
+  done = true;
+  other_thread.join();
+  // a reset requested by the last reads is applied by the next measurement
+  statistics->add_measurement(1.0);
+  EXPECT_LE(statistics->get_count(), 100001u);
+  EXPECT_EQ(statistics->get_count(), statistics->get_histogram().get_count());
+}
+
+TEST(TestMovingAverageStatistics, reset_is_applied_by_the_writer)
+{
+  MovingAverageStatistics statistics;
+  statistics.reset();
+  statistics.add_measurement(1.0);
+  statistics.add_measurement(3.0);
+  ASSERT_EQ(2u, statistics.get_count());
+
+  // the getters report no measurements until the writer applies the reset
+  statistics.reset();
+  EXPECT_EQ(0u, statistics.get_count());
+  EXPECT_TRUE(std::isnan(statistics.get_statistics().average));
+  EXPECT_TRUE(std::isnan(statistics.get_percentiles().p50));
+  EXPECT_EQ(2u, statistics.get_histogram().get_count());
+  statistics.add_measurement(5.0);
+  EXPECT_EQ(1u, statistics.get_count());
+  EXPECT_DOUBLE_EQ(5.0, statistics.get_average());
+  EXPECT_DOUBLE_EQ(5.0, statistics.get_min());
+  EXPECT_EQ(1u, statistics.get_histogram().get_count());
+}
+
+TEST(TestMovingAverageStatisticsData, update_and_reset_after_sample_count)
+{
+  auto statistics = std::make_shared<MovingAverageStatistics>();
+  statistics->reset();
+  MovingAverageStatisticsData data;
+  EXPECT_EQ(0u, data.get_statistics().sample_count);
+  EXPECT_TRUE(std::isnan(data.get_statistics().average));
+  EXPECT_TRUE(std::isnan(data.get_percentiles().p50));
+
+  data.set_reset_statistics_sample_count(3);
+  statistics->add_measurement(1.0);
+  statistics->add_measurement(2.0);
+  data.update_statistics(statistics);
+  EXPECT_EQ(2u, data.get_statistics().sample_count);
+  EXPECT_DOUBLE_EQ(1.5, data.get_statistics().average);
+  EXPECT_DOUBLE_EQ(2.0, data.get_current_data());
+  EXPECT_NEAR(2.0, data.get_percentiles().p99, 2.0 * kRelativeError);
+  EXPECT_EQ(2u, statistics->get_count());
+
+  statistics->add_measurement(3.0);
+  data.update_statistics(statistics);
+  EXPECT_EQ(3u, data.get_statistics_const_ptr().sample_count);
+  // the collector is reset once the sample count is reached, the data keeps the last window
+  EXPECT_EQ(0u, statistics->get_count());
+
+  data.reset();
+  EXPECT_EQ(0u, data.get_statistics().sample_count);
+  EXPECT_TRUE(std::isnan(data.get_percentiles().p99));
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <thread>
+
+#include "hardware_interface/thread_times.hpp"
+
+using hardware_interface::ThreadTimes;
+
+class TestThreadTimes : public ::testing::Test
+{
+protected:
+  void TearDown() override { ThreadTimes::set_sampling_enabled(false); }
+};
+
+TEST_F(TestThreadTimes, when_sampling_disabled_expect_zero_samples)
+{
+  ThreadTimes::set_sampling_enabled(false);
+  const ThreadTimes times = ThreadTimes::now();
+  EXPECT_EQ(times.cpu_time.count(), 0);
+  EXPECT_EQ(times.voluntary_context_switches, 0u);
+  EXPECT_EQ(times.involuntary_context_switches, 0u);
+}
+
+#if defined(__linux__)
+TEST_F(TestThreadTimes, when_computing_expect_cpu_time)
+{
+  ThreadTimes::set_sampling_enabled(true);
+  const ThreadTimes before = ThreadTimes::now();
+  const auto start_time = std::chrono::steady_clock::now();
+  volatile double sum = 0.0;
+  while (std::chrono::steady_clock::now() - start_time < std::chrono::milliseconds(20))
+  {
+    sum = sum + 1.0;
+  }
+  const ThreadTimes times = ThreadTimes::now() - before;
+  EXPECT_GT(times.cpu_time, std::chrono::milliseconds(1));
+  EXPECT_LE(times.cpu_time, std::chrono::steady_clock::now() - start_time);
+}
+
+TEST_F(TestThreadTimes, when_sleeping_expect_preempted_time_and_voluntary_context_switch)
+{
+  ThreadTimes::set_sampling_enabled(true);
+  const ThreadTimes before = ThreadTimes::now();
+  const auto start_time = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  const auto wall_time = std::chrono::steady_clock::now() - start_time;
+  const ThreadTimes times = ThreadTimes::now() - before;
+  EXPECT_LT(times.cpu_time, std::chrono::milliseconds(10));
+  EXPECT_GE(times.voluntary_context_switches, 1u);
+  EXPECT_GT(times.get_preempted_time(wall_time), std::chrono::milliseconds(10));
+}
+#endif
+
+TEST_F(TestThreadTimes, preempted_time_is_never_negative)
+{
+  ThreadTimes times;
+  times.cpu_time = std::chrono::microseconds(120);
+  EXPECT_EQ(
+    times.get_preempted_time(std::chrono::microseconds(300)), std::chrono::microseconds(180));
+  EXPECT_EQ(times.get_preempted_time(std::chrono::microseconds(100)).count(), 0);
+}
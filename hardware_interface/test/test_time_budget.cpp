@@ -0,0 +1,64 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+
+#include "hardware_interface/time_budget.hpp"
+
+using hardware_interface::parse_time_budget_policy;
+using hardware_interface::TimeBudget;
+using hardware_interface::TimeBudgetPolicy;
+
+TEST(TestTimeBudget, parse_policy)
+{
+  EXPECT_EQ(parse_time_budget_policy("report"), TimeBudgetPolicy::REPORT);
+  EXPECT_EQ(parse_time_budget_policy("skip_next_cycle"), TimeBudgetPolicy::SKIP_NEXT_CYCLE);
+  EXPECT_EQ(parse_time_budget_policy("error"), TimeBudgetPolicy::ERROR);
+  EXPECT_THROW(parse_time_budget_policy("async"), std::invalid_argument);
+}
+
+TEST(TestTimeBudget, disabled_budget_is_never_exceeded)
+{
+  TimeBudget budget;
+  EXPECT_FALSE(budget.is_enabled());
+  EXPECT_FALSE(budget.check(1.e6));
+  EXPECT_EQ(budget.overruns, 0u);
+}
+
+TEST(TestTimeBudget, overruns_are_counted)
+{
+  TimeBudget budget;
+  budget.budget_us = 100.0;
+  EXPECT_FALSE(budget.check(100.0));
+  EXPECT_TRUE(budget.check(150.0));
+  EXPECT_TRUE(budget.check(200.0));
+  EXPECT_EQ(budget.overruns, 2u);
+  // the report policy never skips
+  EXPECT_FALSE(budget.consume_skip());
+}
+
+TEST(TestTimeBudget, skip_next_cycle_after_overrun)
+{
+  TimeBudget budget;
+  budget.budget_us = 100.0;
+  budget.policy = TimeBudgetPolicy::SKIP_NEXT_CYCLE;
+  EXPECT_FALSE(budget.check(50.0));
+  EXPECT_FALSE(budget.consume_skip());
+  EXPECT_TRUE(budget.check(150.0));
+  EXPECT_TRUE(budget.consume_skip());
+  // only the next execution is skipped
+  EXPECT_FALSE(budget.consume_skip());
+}
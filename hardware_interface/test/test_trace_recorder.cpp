@@ -0,0 +1,118 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/trace_recorder.hpp"
+
+using hardware_interface::TraceEvent;
+using hardware_interface::TraceRecorder;
+using hardware_interface::TraceScope;
+
+// the ring buffers are allocated once per process, so all the tests share them
+constexpr std::size_t kEventsPerThread = 4;
+constexpr std::size_t kMaxThreads = 2;
+
+class TestTraceRecorder : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    TraceRecorder::enable(kEventsPerThread, kMaxThreads);
+    std::vector<TraceEvent> stale_events;
+    TraceRecorder::drain(stale_events);
+  }
+
+  void TearDown() override { TraceRecorder::disable(); }
+};
+
+TEST_F(TestTraceRecorder, registers_names_once)
+{
+  const auto read_id = TraceRecorder::register_name("read");
+  EXPECT_NE(0u, read_id);
+  EXPECT_EQ(read_id, TraceRecorder::register_name("read"));
+  EXPECT_NE(read_id, TraceRecorder::register_name("write"));
+  EXPECT_EQ("read", TraceRecorder::get_name(read_id));
+  EXPECT_EQ("", TraceRecorder::get_name(0));
+}
+
+TEST_F(TestTraceRecorder, records_and_drains_events)
+{
+  const auto name_id = TraceRecorder::register_name("update");
+  TraceRecorder::record(name_id, 10, 20);
+  {
+    TraceScope scope(name_id);
+  }
+  // events without a name are ignored
+  TraceRecorder::record(0, 30, 40);
+
+  std::vector<TraceEvent> events;
+  ASSERT_EQ(2u, TraceRecorder::drain(events));
+  ASSERT_EQ(2u, events.size());
+  EXPECT_EQ(name_id, events[0].name_id);
+  EXPECT_EQ(10, events[0].begin_ns);
+  EXPECT_EQ(20, events[0].end_ns);
+  EXPECT_EQ(name_id, events[1].name_id);
+  EXPECT_LE(events[1].begin_ns, events[1].end_ns);
+
+  // drained events are not returned again
+  EXPECT_EQ(0u, TraceRecorder::drain(events));
+  EXPECT_EQ(2u, events.size());
+}
+
+TEST_F(TestTraceRecorder, drops_events_when_full_or_disabled)
+{
+  const auto name_id = TraceRecorder::register_name("write");
+  const auto dropped_before = TraceRecorder::get_dropped_events();
+  for (std::size_t i = 0; i < kEventsPerThread + 2; ++i)
+  {
+    TraceRecorder::record(name_id, 0, 1);
+  }
+  EXPECT_EQ(dropped_before + 2u, TraceRecorder::get_dropped_events());
+
+  TraceRecorder::disable();
+  TraceRecorder::record(name_id, 0, 1);
+
+  std::vector<TraceEvent> events;
+  EXPECT_EQ(kEventsPerThread, TraceRecorder::drain(events));
+}
+
+TEST_F(TestTraceRecorder, records_every_thread_separately)
+{
+  const auto name_id = TraceRecorder::register_name("component/read");
+  TraceRecorder::record(name_id, 1, 2);
+  std::thread other_thread([name_id]() { TraceRecorder::record(name_id, 3, 4); });
+  other_thread.join();
+
+  std::vector<TraceEvent> events;
+  ASSERT_EQ(2u, TraceRecorder::drain(events));
+  EXPECT_NE(events[0].thread_index, events[1].thread_index);
+}
+
+TEST_F(TestTraceRecorder, writes_chrome_trace_events)
+{
+  const auto name_id = TraceRecorder::register_name("controller \"a\"/update");
+  std::vector<TraceEvent> events = {{name_id, 1, 1234567, 1236067}};
+  std::ostringstream os;
+  TraceRecorder::write_chrome_trace_events(os, events);
+  EXPECT_EQ(
+    "{\"name\":\"controller \\\"a\\\"/update\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+    "\"ts\":1234.567,\"dur\":1.500},\n",
+    os.str());
+}
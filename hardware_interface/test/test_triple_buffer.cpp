@@ -0,0 +1,83 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/triple_buffer.hpp"
+
+using hardware_interface::TripleBuffer;
+
+TEST(TestTripleBuffer, reads_the_latest_published_value)
+{
+  TripleBuffer<int> buffer;
+  buffer.initialize(-1);
+  EXPECT_FALSE(buffer.update_read_buffer());
+  EXPECT_EQ(-1, buffer.get_read_buffer());
+
+  buffer.get_write_buffer() = 1;
+  buffer.publish();
+  buffer.get_write_buffer() = 2;
+  buffer.publish();
+  ASSERT_TRUE(buffer.update_read_buffer());
+  EXPECT_EQ(2, buffer.get_read_buffer());
+  // the read buffer stays valid until a new value is published and taken
+  EXPECT_FALSE(buffer.update_read_buffer());
+  EXPECT_EQ(2, buffer.get_read_buffer());
+
+  buffer.get_write_buffer() = 3;
+  EXPECT_FALSE(buffer.update_read_buffer());
+  buffer.publish();
+  ASSERT_TRUE(buffer.update_read_buffer());
+  EXPECT_EQ(3, buffer.get_read_buffer());
+}
+
+TEST(TestTripleBuffer, consumer_never_reads_a_partially_written_frame)
+{
+  constexpr std::size_t kFrameSize = 64;
+  constexpr uint64_t kFrames = 100000;
+  TripleBuffer<std::vector<uint64_t>> buffer;
+  buffer.initialize(std::vector<uint64_t>(kFrameSize, 0u));
+
+  std::thread producer(
+    [&buffer]()
+    {
+      for (uint64_t frame = 1; frame <= kFrames; ++frame)
+      {
+        auto & values = buffer.get_write_buffer();
+        for (auto & value : values)
+        {
+          value = frame;
+        }
+        buffer.publish();
+      }
+    });
+
+  uint64_t last_frame = 0;
+  while (last_frame < kFrames)
+  {
+    if (!buffer.update_read_buffer())
+    {
+      continue;
+    }
+    const auto & values = buffer.get_read_buffer();
+    ASSERT_THAT(values, testing::Each(values.front()));
+    ASSERT_GT(values.front(), last_frame);
+    last_frame = values.front();
+  }
+  producer.join();
+}
@@ -0,0 +1,116 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/udp_interface_link.hpp"
+
+using hardware_interface::UdpInterfaceLink;
+using testing::ElementsAre;
+
+namespace
+{
+const std::vector<std::string> STATE_NAMES = {"joint1/position", "joint1/velocity"};
+const std::vector<std::string> COMMAND_NAMES = {"joint1/position"};
+constexpr auto TIMEOUT = std::chrono::milliseconds(500);
+
+// the ports depend on the process, so that parallel test runs don't interfere
+uint16_t get_port(uint16_t offset)
+{
+  return static_cast<uint16_t>(20000 + (getpid() % 10000) * 4 + offset);
+}
+}  // namespace
+
+class TestUdpInterfaceLink : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    local_.open(get_port(0), "127.0.0.1", get_port(1), COMMAND_NAMES, STATE_NAMES);
+    remote_.open(get_port(1), "127.0.0.1", get_port(0), STATE_NAMES, COMMAND_NAMES);
+  }
+
+  UdpInterfaceLink local_;
+  UdpInterfaceLink remote_;
+};
+
+TEST_F(TestUdpInterfaceLink, exchange_in_both_directions)
+{
+  ASSERT_TRUE(remote_.send({0.5, 1.5}, 100));
+  std::vector<double> states(STATE_NAMES.size(), 0.0);
+  int64_t stamp_ns = 0;
+  ASSERT_TRUE(local_.receive(states, stamp_ns, 150, TIMEOUT));
+  EXPECT_THAT(states, ElementsAre(0.5, 1.5));
+  EXPECT_EQ(stamp_ns, 100);
+  EXPECT_EQ(local_.get_statistics().received_frames, 1u);
+  EXPECT_EQ(local_.get_statistics().age.get_count(), 1u);
+
+  ASSERT_TRUE(local_.send({0.75}, 200));
+  std::vector<double> commands;
+  ASSERT_TRUE(remote_.receive(commands, stamp_ns, 200, TIMEOUT));
+  EXPECT_THAT(commands, ElementsAre(0.75));
+
+  // nothing new to receive
+  EXPECT_FALSE(local_.receive(states, stamp_ns, 300));
+  EXPECT_THAT(states, ElementsAre(0.5, 1.5));
+}
+
+TEST_F(TestUdpInterfaceLink, only_the_newest_frame_is_kept)
+{
+  ASSERT_TRUE(remote_.send({1.0, 0.0}, 1));
+  ASSERT_TRUE(remote_.send({2.0, 0.0}, 2));
+  ASSERT_TRUE(remote_.send({3.0, 0.0}, 3));
+  std::vector<double> states(STATE_NAMES.size(), 0.0);
+  int64_t stamp_ns = 0;
+  // the three datagrams were sent on the loopback before the first one is awaited
+  const auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+  while (local_.get_statistics().received_frames < 3u &&
+         std::chrono::steady_clock::now() < deadline)
+  {
+    local_.receive(states, stamp_ns, 3, std::chrono::milliseconds(10));
+  }
+  EXPECT_THAT(states, ElementsAre(3.0, 0.0));
+  EXPECT_EQ(stamp_ns, 3);
+  EXPECT_EQ(local_.get_statistics().lost_frames, 0u);
+}
+
+TEST_F(TestUdpInterfaceLink, frames_of_another_layout_are_rejected)
+{
+  UdpInterfaceLink other;
+  remote_.close();
+  other.open(get_port(1), "127.0.0.1", get_port(0), {"joint2/position", "joint2/velocity"}, {});
+  ASSERT_TRUE(other.send({1.0, 2.0}, 1));
+  std::vector<double> states(STATE_NAMES.size(), 0.0);
+  int64_t stamp_ns = 0;
+  EXPECT_FALSE(local_.receive(states, stamp_ns, 1, std::chrono::milliseconds(100)));
+  EXPECT_EQ(local_.get_statistics().rejected_frames, 1u);
+  EXPECT_EQ(local_.get_statistics().received_frames, 0u);
+}
+
+TEST(TestUdpInterfaceLinkOpen, unresolvable_address_throws)
+{
+  UdpInterfaceLink link;
+  EXPECT_THROW(
+    link.open(get_port(2), "host.invalid", get_port(3), {}, {}), std::runtime_error);
+  EXPECT_FALSE(link.is_open());
+  EXPECT_FALSE(link.send({}, 0));
+}
@@ -0,0 +1,372 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE_TESTING__PERFORMANCE_BUDGET_HPP_
+#define HARDWARE_INTERFACE_TESTING__PERFORMANCE_BUDGET_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include "hardware_interface/allocation_hook.hpp"
+#include "hardware_interface/allocation_tracker.hpp"
+#include "hardware_interface/resource_manager.hpp"
+#include "hardware_interface/types/resource_manager_params.hpp"
+#include "hardware_interface/types/statistics_types.hpp"
+#include "rclcpp/clock.hpp"
+#include "rclcpp/duration.hpp"
+#include "rclcpp/logging.hpp"
+#include "rclcpp/time.hpp"
+
+/// Replaces the global operator new of the test executable to count the allocations of the
+/// measured cycles, to be used once at namespace scope of one of its source files.
+/**
+ * See HARDWARE_INTERFACE_DEFINE_ALLOCATION_HOOK().
+ */
+#define HARDWARE_INTERFACE_TESTING_DEFINE_ALLOCATION_HOOK() \
+  HARDWARE_INTERFACE_DEFINE_ALLOCATION_HOOK()
+
+namespace hardware_interface_testing
+{
+/// Limits of the real-time behavior of the cycles run by a PerformanceBudgetRunner.
+/**
+ * The time limits are in microseconds and optional, only the given ones are checked. They are
+ * checked after the warm-up cycles, which may allocate memory and fill the caches.
+ */
+struct PerformanceBudget
+{
+  /// Cycles run before the measurements.
+  std::size_t warmup_cycles = 10;
+  /// Measured cycles.
+  std::size_t cycles = 1000;
+
+  std::optional<double> max_read_time_us;
+  std::optional<double> max_update_time_us;
+  std::optional<double> max_write_time_us;
+  std::optional<double> max_cycle_time_us;
+  std::optional<double> p99_cycle_time_us;
+
+  /// Allows heap allocations in the measured cycles.
+  bool allow_allocations = false;
+
+  /// Relative margin of the time limits, e.g., 0.5 accepts times up to 50% above them, to absorb
+  /// the noise of the machines running the tests.
+  double tolerance = 0.0;
+  /// Number of measured cycles allowed to exceed the maximum time limits.
+  std::size_t allowed_overruns = 0;
+};
+
+/// Measured times of one phase of the cycles in microseconds.
+struct PhaseMeasurements
+{
+  double max_us = 0.0;
+  double p50_us = 0.0;
+  double p99_us = 0.0;
+  /// Number of cycles exceeding the maximum time limit of the phase, with its tolerance.
+  std::size_t overruns = 0;
+};
+
+/// Measurements of the cycles run by a PerformanceBudgetRunner and the budget violations.
+struct PerformanceReport
+{
+  PhaseMeasurements read;
+  PhaseMeasurements update;
+  PhaseMeasurements write;
+  PhaseMeasurements cycle;
+  /// Heap allocations of the measured cycles, only counted if allocations_tracked is true.
+  uint64_t allocations = 0;
+  bool allocations_tracked = false;
+  /// Description of every violated limit of the budget, empty if the cycles are within budget.
+  std::vector<std::string> violations;
+
+  bool within_budget() const { return violations.empty(); }
+
+  std::string to_string() const
+  {
+    const auto phase = [](const std::string & name, const PhaseMeasurements & m)
+    {
+      return fmt::format(
+        "{}: p50 {:.1f} us, p99 {:.1f} us, max {:.1f} us, {} overruns\n", name, m.p50_us,
+        m.p99_us, m.max_us, m.overruns);
+    };
+    std::string text = phase("read", read) + phase("update", update) + phase("write", write) +
+                       phase("cycle", cycle);
+    text += allocations_tracked ? fmt::format("allocations: {}\n", allocations)
+                                : std::string("allocations: not tracked\n");
+    for (const auto & violation : violations)
+    {
+      text += "violation: " + violation + "\n";
+    }
+    return text;
+  }
+};
+
+/// Runs the read, update and write phases of a control loop and checks their budget.
+/**
+ * The phases are given as functions, so that the cycles of a ResourceManager, of a
+ * ControllerManager or of a single component can be measured, e.g.,
+ *
+ * \code
+ * PerformanceBudgetRunner runner(budget);
+ * const auto report = runner.run(
+ *   [&]() { cm->read(time, period); }, [&]() { cm->update(time, period); },
+ *   [&]() { cm->write(time, period); });
+ * EXPECT_TRUE(is_within_budget(report));
+ * \endcode
+ *
+ * The cycles run back to back on the calling thread, whose allocations are counted if the test
+ * executable uses HARDWARE_INTERFACE_TESTING_DEFINE_ALLOCATION_HOOK(). The measurements don't
+ * allocate memory, a budget without allocations fails if the hook is not installed.
+ */
+class PerformanceBudgetRunner
+{
+public:
+  using Phase = std::function<void()>;
+
+  explicit PerformanceBudgetRunner(const PerformanceBudget & budget) : budget_(budget) {}
+
+  /// Runs the cycles, the update phase may be empty.
+  PerformanceReport run(const Phase & read, const Phase & update, const Phase & write)
+  {
+    using hardware_interface::AllocationTracker;
+    const auto no_phase = []() {};
+    const Phase & update_phase = update ? update : Phase(no_phase);
+    for (std::size_t i = 0; i < budget_.warmup_cycles; ++i)
+    {
+      read();
+      update_phase();
+      write();
+    }
+
+    PhaseHistograms histograms;
+    PerformanceReport report;
+    const bool tracking_was_enabled = AllocationTracker::is_tracking_enabled();
+    report.allocations_tracked = AllocationTracker::is_hook_installed();
+    AllocationTracker::set_tracking_enabled(true);
+    const uint64_t allocations_before = AllocationTracker::get_allocation_count();
+    for (std::size_t i = 0; i < budget_.cycles; ++i)
+    {
+      const auto start = Clock::now();
+      read();
+      const auto read_end = Clock::now();
+      update_phase();
+      const auto update_end = Clock::now();
+      write();
+      const auto write_end = Clock::now();
+      add(histograms.read, report.read, budget_.max_read_time_us, elapsed_us(start, read_end));
+      add(
+        histograms.update, report.update, budget_.max_update_time_us,
+        elapsed_us(read_end, update_end));
+      add(
+        histograms.write, report.write, budget_.max_write_time_us,
+        elapsed_us(update_end, write_end));
+      add(histograms.cycle, report.cycle, budget_.max_cycle_time_us, elapsed_us(start, write_end));
+    }
+    report.allocations = AllocationTracker::get_allocation_count() - allocations_before;
+    AllocationTracker::set_tracking_enabled(tracking_was_enabled);
+
+    set_percentiles(histograms.read, report.read);
+    set_percentiles(histograms.update, report.update);
+    set_percentiles(histograms.write, report.write);
+    set_percentiles(histograms.cycle, report.cycle);
+    check_budget(report);
+    return report;
+  }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /// Allocated once per run, before the measured cycles
+  struct PhaseHistograms
+  {
+    ros2_control::LatencyHistogram read;
+    ros2_control::LatencyHistogram update;
+    ros2_control::LatencyHistogram write;
+    ros2_control::LatencyHistogram cycle;
+  };
+
+  static double elapsed_us(const Clock::time_point & start, const Clock::time_point & end)
+  {
+    return std::chrono::duration<double, std::micro>(end - start).count();
+  }
+
+  double with_tolerance(double limit_us) const { return limit_us * (1.0 + budget_.tolerance); }
+
+  void add(
+    ros2_control::LatencyHistogram & histogram, PhaseMeasurements & measurements,
+    const std::optional<double> & max_time_us, double time_us) const
+  {
+    histogram.add_measurement(time_us);
+    measurements.max_us = std::max(measurements.max_us, time_us);
+    if (max_time_us && time_us > with_tolerance(*max_time_us))
+    {
+      ++measurements.overruns;
+    }
+  }
+
+  static void set_percentiles(
+    const ros2_control::LatencyHistogram & histogram, PhaseMeasurements & measurements)
+  {
+    if (histogram.get_count() > 0)
+    {
+      measurements.p50_us = histogram.get_percentile(50.0);
+      measurements.p99_us = histogram.get_percentile(99.0);
+    }
+  }
+
+  void check_budget(PerformanceReport & report) const
+  {
+    const auto check_max = [&](
+                             const std::string & name, const PhaseMeasurements & measurements,
+                             const std::optional<double> & max_time_us)
+    {
+      if (max_time_us && measurements.overruns > budget_.allowed_overruns)
+      {
+        report.violations.push_back(fmt::format(
+          "{} cycles exceeded the maximum {} time of {:.1f} us (with tolerance {:.1f} us), "
+          "{:.1f} us at most, {} allowed",
+          measurements.overruns, name, *max_time_us, with_tolerance(*max_time_us),
+          measurements.max_us, budget_.allowed_overruns));
+      }
+    };
+    check_max("read", report.read, budget_.max_read_time_us);
+    check_max("update", report.update, budget_.max_update_time_us);
+    check_max("write", report.write, budget_.max_write_time_us);
+    check_max("cycle", report.cycle, budget_.max_cycle_time_us);
+    if (
+      budget_.p99_cycle_time_us && budget_.cycles > 0 &&
+      report.cycle.p99_us > with_tolerance(*budget_.p99_cycle_time_us))
+    {
+      report.violations.push_back(fmt::format(
+        "the 99th percentile of the cycle time is {:.1f} us, above {:.1f} us (with tolerance "
+        "{:.1f} us)",
+        report.cycle.p99_us, *budget_.p99_cycle_time_us,
+        with_tolerance(*budget_.p99_cycle_time_us)));
+    }
+    if (!budget_.allow_allocations)
+    {
+      if (!report.allocations_tracked)
+      {
+        report.violations.push_back(
+          "the allocations are not tracked, use "
+          "HARDWARE_INTERFACE_TESTING_DEFINE_ALLOCATION_HOOK() in the test or allow them");
+      }
+      else if (report.allocations > 0)
+      {
+        report.violations.push_back(
+          fmt::format("{} heap allocations in the measured cycles", report.allocations));
+      }
+    }
+  }
+
+  PerformanceBudget budget_;
+};
+
+/// Succeeds if the report has no budget violation, its message lists the measurements otherwise.
+inline ::testing::AssertionResult is_within_budget(const PerformanceReport & report)
+{
+  if (report.within_budget())
+  {
+    return ::testing::AssertionSuccess();
+  }
+  return ::testing::AssertionFailure() << "The cycles are not within budget:\n"
+                                       << report.to_string();
+}
+
+/// Fixture running the read and write cycles of a ResourceManager with the given components.
+/**
+ * A test loads the components of its robot description with load_components(), which activates
+ * them, and checks the budget of their cycles, e.g.,
+ *
+ * \code
+ * HARDWARE_INTERFACE_TESTING_DEFINE_ALLOCATION_HOOK();
+ *
+ * TEST_F(ResourceManagerPerformanceTest, my_system_is_realtime_safe)
+ * {
+ *   ASSERT_TRUE(load_components(my_robot_description));
+ *   PerformanceBudget budget;
+ *   budget.max_read_time_us = 100.0;
+ *   budget.tolerance = 0.5;
+ *   EXPECT_TRUE(is_within_budget(run_cycles(budget)));
+ * }
+ * \endcode
+ */
+class ResourceManagerPerformanceTest : public ::testing::Test
+{
+public:
+  /// Loads, initializes and activates the components of the robot description.
+  bool load_components(const std::string & robot_description, unsigned int update_rate = 1000)
+  {
+    hardware_interface::ResourceManagerParams params;
+    params.robot_description = robot_description;
+    params.clock = clock_;
+    params.logger = rclcpp::get_logger("resource_manager_performance_test");
+    params.activate_all = true;
+    params.update_rate = update_rate;
+    period_ = rclcpp::Duration::from_seconds(1.0 / static_cast<double>(update_rate));
+    resource_manager_ = std::make_unique<hardware_interface::ResourceManager>(params, true);
+    return resource_manager_->are_components_initialized();
+  }
+
+  /// Runs the cycles of the resource manager, a read or write error is reported as a violation.
+  /**
+   * \param[in] budget budget of the cycles.
+   * \param[in] update optional update phase between the read and the write, e.g., of a controller
+   * using the interfaces of the resource manager.
+   */
+  PerformanceReport run_cycles(
+    const PerformanceBudget & budget, const PerformanceBudgetRunner::Phase & update = nullptr)
+  {
+    std::size_t read_errors = 0;
+    std::size_t write_errors = 0;
+    PerformanceBudgetRunner runner(budget);
+    auto report = runner.run(
+      [&]()
+      {
+        time_ += period_;
+        read_errors +=
+          resource_manager_->read(time_, period_).result != hardware_interface::return_type::OK;
+      },
+      update,
+      [&]()
+      {
+        write_errors +=
+          resource_manager_->write(time_, period_).result != hardware_interface::return_type::OK;
+      });
+    if (read_errors > 0 || write_errors > 0)
+    {
+      report.violations.push_back(
+        fmt::format("{} reads and {} writes failed", read_errors, write_errors));
+    }
+    return report;
+  }
+
+protected:
+  rclcpp::Clock::SharedPtr clock_ = std::make_shared<rclcpp::Clock>(RCL_ROS_TIME);
+  std::unique_ptr<hardware_interface::ResourceManager> resource_manager_;
+  rclcpp::Time time_{0, 0, RCL_ROS_TIME};
+  rclcpp::Duration period_ = rclcpp::Duration::from_seconds(0.001);
+};
+
+}  // namespace hardware_interface_testing
+
+#endif  // HARDWARE_INTERFACE_TESTING__PERFORMANCE_BUDGET_HPP_
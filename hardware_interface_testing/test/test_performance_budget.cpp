@@ -0,0 +1,151 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface_testing/performance_budget.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "ros2_control_test_assets/generated_descriptions.hpp"
+
+using hardware_interface_testing::is_within_budget;
+using hardware_interface_testing::PerformanceBudget;
+using hardware_interface_testing::PerformanceBudgetRunner;
+using hardware_interface_testing::ResourceManagerPerformanceTest;
+using testing::HasSubstr;
+
+HARDWARE_INTERFACE_TESTING_DEFINE_ALLOCATION_HOOK();
+
+namespace
+{
+const auto no_phase = []() {};
+
+/// Generous budget, the tests run on shared machines
+PerformanceBudget make_budget()
+{
+  PerformanceBudget budget;
+  budget.warmup_cycles = 10;
+  budget.cycles = 200;
+  budget.tolerance = 1.0;
+  budget.allowed_overruns = 5;
+  return budget;
+}
+}  // namespace
+
+TEST(TestPerformanceBudgetRunner, measures_the_phases_of_the_cycles)
+{
+  auto budget = make_budget();
+  budget.max_read_time_us = 100000.0;
+  budget.p99_cycle_time_us = 100000.0;
+  std::size_t reads = 0;
+  std::size_t updates = 0;
+  PerformanceBudgetRunner runner(budget);
+  const auto report = runner.run(
+    [&]() { ++reads; }, [&]()
+    {
+      ++updates;
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    },
+    no_phase);
+
+  EXPECT_TRUE(is_within_budget(report));
+  EXPECT_EQ(reads, budget.warmup_cycles + budget.cycles);
+  EXPECT_EQ(updates, budget.warmup_cycles + budget.cycles);
+  EXPECT_TRUE(report.allocations_tracked);
+  EXPECT_EQ(report.allocations, 0u);
+  EXPECT_GE(report.update.max_us, 100.0);
+  EXPECT_GE(report.cycle.p50_us, report.update.p50_us * 0.9);
+}
+
+TEST(TestPerformanceBudgetRunner, reports_the_allocations_of_the_measured_cycles)
+{
+  auto budget = make_budget();
+  std::size_t cycle = 0;
+  std::vector<std::unique_ptr<int>> allocated;
+  allocated.reserve(budget.warmup_cycles + budget.cycles);
+  PerformanceBudgetRunner runner(budget);
+  // only the cycles after the warm-up are measured
+  auto report = runner.run(
+    [&]()
+    {
+      if (cycle++ < budget.warmup_cycles || cycle == budget.warmup_cycles + 2)
+      {
+        allocated.push_back(std::make_unique<int>(0));
+      }
+    },
+    nullptr, no_phase);
+  EXPECT_EQ(report.allocations, 1u);
+  ASSERT_FALSE(report.within_budget());
+  EXPECT_THAT(report.to_string(), HasSubstr("1 heap allocations"));
+
+  budget.allow_allocations = true;
+  cycle = 0;
+  allocated.clear();
+  report = PerformanceBudgetRunner(budget).run(
+    [&]()
+    {
+      if (cycle++ == budget.warmup_cycles)
+      {
+        allocated.push_back(std::make_unique<int>(0));
+      }
+    },
+    nullptr, no_phase);
+  EXPECT_EQ(report.allocations, 1u);
+  EXPECT_TRUE(is_within_budget(report));
+}
+
+TEST(TestPerformanceBudgetRunner, reports_the_overruns_beyond_the_tolerance)
+{
+  auto budget = make_budget();
+  budget.cycles = 20;
+  budget.tolerance = 0.5;
+  budget.allowed_overruns = 2;
+  budget.max_write_time_us = 100.0;
+  budget.p99_cycle_time_us = 100.0;
+  const auto slow_write = []() { std::this_thread::sleep_for(std::chrono::microseconds(500)); };
+
+  const auto report = PerformanceBudgetRunner(budget).run(no_phase, nullptr, slow_write);
+  EXPECT_EQ(report.write.overruns, budget.cycles);
+  ASSERT_EQ(report.violations.size(), 2u);
+  EXPECT_THAT(report.violations[0], HasSubstr("maximum write time of 100.0 us"));
+  EXPECT_THAT(report.violations[1], HasSubstr("99th percentile of the cycle time"));
+
+  // the overruns are only counted for the phases with a limit
+  EXPECT_EQ(report.read.overruns, 0u);
+  EXPECT_EQ(report.cycle.overruns, 0u);
+}
+
+TEST_F(ResourceManagerPerformanceTest, cycles_of_mock_systems_are_within_budget)
+{
+  rclcpp::init(0, nullptr);
+  ros2_control_test_assets::GeneratedDescriptionParameters parameters;
+  parameters.number_of_systems = 4;
+  parameters.joints_per_system = 6;
+  parameters.sensors_per_system = 1;
+  ASSERT_TRUE(load_components(ros2_control_test_assets::generate_robot_description(parameters)));
+
+  auto budget = make_budget();
+  budget.max_read_time_us = 10000.0;
+  budget.max_write_time_us = 10000.0;
+  budget.p99_cycle_time_us = 10000.0;
+  const auto report = run_cycles(budget);
+  EXPECT_TRUE(is_within_budget(report));
+  EXPECT_EQ(report.allocations, 0u);
+  rclcpp::shutdown();
+}
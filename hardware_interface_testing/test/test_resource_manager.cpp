@@ -20,14 +20,19 @@
 #include "test_resource_manager.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "hardware_interface/actuator_interface.hpp"
 #include "hardware_interface/helpers.hpp"
+#include "hardware_interface/loaned_interface_view.hpp"
 #include "hardware_interface/types/lifecycle_state_names.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
 #include "rclcpp/version.h"
@@ -111,13 +116,15 @@ TEST_F(ResourceManagerTest, post_initialization_with_urdf)
   ASSERT_NO_THROW(rm.load_and_initialize_components(rm_params));
 }
 
-void test_load_and_initialized_components_failure(const std::string & urdf)
+void test_load_and_initialized_components_failure(
+  const std::string & urdf, unsigned int component_initialization_threads = 0)
 {
   rclcpp::Node node = rclcpp::Node("TestableResourceManager");
   TestableResourceManager rm(node);
   hardware_interface::ResourceManagerParams rm_params;
   rm_params.robot_description = urdf;
   rm_params.update_rate = 100;
+  rm_params.component_initialization_threads = component_initialization_threads;
   ASSERT_NO_THROW(rm.load_and_initialize_components(rm_params));
 
   ASSERT_FALSE(rm.are_components_initialized());
@@ -156,6 +163,10 @@ TEST_F(ResourceManagerTest, test_uninitializable_hardware)
   // validate the interfaces, the interface should not show up
   test_load_and_initialized_components_failure(
     ros2_control_test_assets::minimal_uninitializable_robot_urdf);
+
+  SCOPED_TRACE("test_uninitializable_hardware_concurrent_initialization");
+  test_load_and_initialized_components_failure(
+    ros2_control_test_assets::minimal_uninitializable_robot_urdf, 4);
 }
 
 TEST_F(ResourceManagerTest, initialization_with_urdf_and_manual_validation)
@@ -182,6 +193,24 @@ TEST_F(ResourceManagerTest, initialization_with_urdf_and_manual_validation)
   EXPECT_TRUE(rm.command_interface_exists("joint3/velocity"));
 }
 
+TEST_F(ResourceManagerTest, concurrent_initialization_imports_the_same_interfaces)
+{
+  TestableResourceManager sequential_rm(node_, ros2_control_test_assets::minimal_robot_urdf);
+  TestableResourceManager rm(node_);
+  hardware_interface::ResourceManagerParams rm_params;
+  rm_params.robot_description = ros2_control_test_assets::minimal_robot_urdf;
+  rm_params.update_rate = 100;
+  rm_params.component_initialization_threads = 4;
+  ASSERT_TRUE(rm.load_and_initialize_components(rm_params));
+
+  EXPECT_EQ(1u, rm.actuator_components_size());
+  EXPECT_EQ(1u, rm.sensor_components_size());
+  EXPECT_EQ(1u, rm.system_components_size());
+  EXPECT_EQ(sequential_rm.state_interface_keys(), rm.state_interface_keys());
+  EXPECT_EQ(sequential_rm.command_interface_keys(), rm.command_interface_keys());
+  EXPECT_EQ(sequential_rm.get_components_status().size(), rm.get_components_status().size());
+}
+
 TEST_F(ResourceManagerTest, expect_validation_failure_if_not_all_interfaces_are_exported)
 {
   SCOPED_TRACE("missing state keys");
@@ -277,6 +306,216 @@ TEST_F(ResourceManagerTest, load_and_initialize_components_called_if_async_urdf_
   ASSERT_TRUE(rm.are_components_initialized());
 }
 
+TEST_F(ResourceManagerTest, contiguous_interface_storage)
+{
+  hardware_interface::ResourceManagerParams rm_params;
+  rm_params.robot_description = ros2_control_test_assets::minimal_robot_urdf;
+  rm_params.clock = node_.get_clock();
+  rm_params.logger = node_.get_logger();
+  rm_params.update_rate = 100;
+  rm_params.contiguous_interface_storage = true;
+  TestableResourceManager rm(rm_params);
+  ASSERT_TRUE(rm.are_components_initialized());
+  activate_components(rm);
+
+  {
+    auto actuator_cmd = rm.claim_command_interface(TEST_ACTUATOR_HARDWARE_COMMAND_INTERFACES[0]);
+    auto system_cmd = rm.claim_command_interface(TEST_SYSTEM_HARDWARE_COMMAND_INTERFACES[0]);
+    auto actuator_state = rm.claim_state_interface(TEST_ACTUATOR_HARDWARE_STATE_INTERFACES[0]);
+
+    ASSERT_TRUE(actuator_cmd.set_value(1.1));
+    ASSERT_TRUE(system_cmd.set_value(2.2));
+    EXPECT_DOUBLE_EQ(actuator_cmd.get_optional().value(), 1.1);
+    EXPECT_DOUBLE_EQ(system_cmd.get_optional().value(), 2.2);
+    EXPECT_TRUE(actuator_state.get_optional().has_value());
+
+    const rclcpp::Time time(0, 0, rcl_clock_type_t::RCL_ROS_TIME);
+    const rclcpp::Duration period(0, 10000000);
+    EXPECT_EQ(rm.read(time, period).result, hardware_interface::return_type::OK);
+    EXPECT_EQ(rm.write(time, period).result, hardware_interface::return_type::OK);
+    EXPECT_DOUBLE_EQ(actuator_cmd.get_optional().value(), 1.1);
+    EXPECT_DOUBLE_EQ(system_cmd.get_optional().value(), 2.2);
+  }
+  // the values are moved back to the handles when the storage is shut down
+  EXPECT_NO_THROW(shutdown_components(rm));
+}
+
+TEST_F(ResourceManagerTest, float32_state_interface_storage)
+{
+  hardware_interface::ResourceManagerParams rm_params;
+  rm_params.robot_description = ros2_control_test_assets::minimal_robot_urdf;
+  rm_params.clock = node_.get_clock();
+  rm_params.logger = node_.get_logger();
+  rm_params.update_rate = 100;
+  rm_params.contiguous_interface_storage = true;
+  rm_params.float32_state_interface_storage = true;
+  TestableResourceManager rm(rm_params);
+  ASSERT_TRUE(rm.are_components_initialized());
+  activate_components(rm);
+
+  {
+    auto actuator_cmd = rm.claim_command_interface(TEST_ACTUATOR_HARDWARE_COMMAND_INTERFACES[0]);
+    auto actuator_state = rm.claim_state_interface(TEST_ACTUATOR_HARDWARE_STATE_INTERFACES[0]);
+    auto sensor_state = rm.claim_state_interface(TEST_SENSOR_HARDWARE_STATE_INTERFACES[0]);
+
+    // only the state interfaces are narrowed
+    EXPECT_EQ(actuator_state.get_data_type(), hardware_interface::HandleDataType::FLOAT32);
+    EXPECT_EQ(sensor_state.get_data_type(), hardware_interface::HandleDataType::FLOAT32);
+    EXPECT_EQ(actuator_cmd.get_data_type(), hardware_interface::HandleDataType::DOUBLE);
+    EXPECT_TRUE(actuator_state.is_double_readable());
+    EXPECT_TRUE(sensor_state.is_double_readable());
+    hardware_interface::LoanedStateView<float> actuator_view(actuator_state);
+    hardware_interface::LoanedStateView<double> actuator_double_view(actuator_state);
+
+    ASSERT_TRUE(actuator_cmd.set_value(0.5));
+    const rclcpp::Time time(0, 0, rcl_clock_type_t::RCL_ROS_TIME);
+    const rclcpp::Duration period(0, 10000000);
+    EXPECT_EQ(rm.write(time, period).result, hardware_interface::return_type::OK);
+    EXPECT_EQ(rm.read(time, period).result, hardware_interface::return_type::OK);
+    // the hardware components and the legacy controllers keep using doubles
+    const auto state = actuator_state.get_optional();
+    ASSERT_TRUE(state.has_value());
+    EXPECT_FLOAT_EQ(actuator_view.get_optional().value(), static_cast<float>(state.value()));
+    // the bulk accessors and the views of type double convert the narrowed values
+    EXPECT_DOUBLE_EQ(actuator_double_view.get_optional().value(), state.value());
+    double value = 0.0;
+    ASSERT_TRUE(actuator_state.get_double_unchecked(value));
+    EXPECT_DOUBLE_EQ(value, state.value());
+  }
+  // the values are moved back to the handles when the storage is shut down
+  EXPECT_NO_THROW(shutdown_components(rm));
+}
+
+TEST_F(ResourceManagerTest, interfaces_of_the_resource_namespaces)
+{
+  std::string urdf = ros2_control_test_assets::minimal_robot_urdf;
+  auto add_namespace = [&urdf](const std::string & plugin, const std::string & resource_namespace)
+  {
+    const std::string plugin_tag = "<plugin>" + plugin + "</plugin>";
+    const auto position = urdf.find(plugin_tag);
+    ASSERT_NE(position, std::string::npos);
+    urdf.insert(
+      position + plugin_tag.size(),
+      "<resource_namespace>" + resource_namespace + "</resource_namespace>");
+  };
+  add_namespace("test_actuator", "cell_1/arm");
+  add_namespace("test_sensor", "cell_10");
+  add_namespace("test_system", "cell_1");
+  TestableResourceManager rm(node_, urdf);
+  ASSERT_TRUE(rm.are_components_initialized());
+
+  EXPECT_THAT(
+    rm.get_resource_namespaces(), testing::ElementsAre("cell_1", "cell_1/arm", "cell_10"));
+  EXPECT_EQ(rm.state_interface_keys("cell_10"), TEST_SENSOR_HARDWARE_STATE_INTERFACES);
+  EXPECT_THAT(
+    rm.command_interface_keys("cell_1/arm"),
+    testing::UnorderedElementsAreArray(TEST_ACTUATOR_HARDWARE_COMMAND_INTERFACES));
+  // the namespace includes its sub-namespaces, but not the namespaces sharing its prefix
+  const auto cell_keys = rm.state_interface_keys("cell_1");
+  EXPECT_EQ(
+    cell_keys.size(),
+    TEST_SYSTEM_HARDWARE_STATE_INTERFACES.size() + TEST_ACTUATOR_HARDWARE_STATE_INTERFACES.size());
+  EXPECT_THAT(
+    cell_keys, testing::Not(testing::Contains(TEST_SENSOR_HARDWARE_STATE_INTERFACES[0])));
+  EXPECT_THAT(rm.state_interface_keys("cell"), testing::IsEmpty());
+}
+
+TEST_F(ResourceManagerTest, state_interfaces_are_stamped_by_the_reads)
+{
+  TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf);
+  activate_components(rm);
+
+  auto actuator_state = rm.claim_state_interface(TEST_ACTUATOR_HARDWARE_STATE_INTERFACES[0]);
+  auto sensor_state = rm.claim_state_interface(TEST_SENSOR_HARDWARE_STATE_INTERFACES[0]);
+  ASSERT_TRUE(actuator_state.has_read_stamp());
+  EXPECT_EQ(actuator_state.get_read_stamp().cycle, 0u);
+
+  const rclcpp::Duration period(0, 10000000);
+  for (unsigned int cycle = 1; cycle <= 3; ++cycle)
+  {
+    const rclcpp::Time time(0, cycle * 10000000, rcl_clock_type_t::RCL_ROS_TIME);
+    ASSERT_EQ(rm.read(time, period).result, hardware_interface::return_type::OK);
+    EXPECT_EQ(actuator_state.get_read_stamp().cycle, cycle);
+    EXPECT_EQ(actuator_state.get_read_stamp().time, time);
+    EXPECT_EQ(sensor_state.get_read_stamp().cycle, cycle);
+  }
+}
+
+TEST_F(ResourceManagerTest, contention_of_the_resources_lock_is_recorded)
+{
+  TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf);
+  activate_components(rm);
+
+  auto find_lock_statistics = [&rm](const std::string & lock_name)
+  {
+    for (const auto & [name, statistics] : rm.get_lock_contention_statistics())
+    {
+      if (name == lock_name)
+      {
+        return statistics;
+      }
+    }
+    ADD_FAILURE() << "no lock " << lock_name;
+    return hardware_interface::LockContentionStatistics{};
+  };
+  const auto failures_before = find_lock_statistics("resources").try_lock_failures;
+
+  const rclcpp::Time time(0, 10000000, rcl_clock_type_t::RCL_ROS_TIME);
+  const rclcpp::Duration period(0, 10000000);
+  std::promise<int64_t> holder_thread;
+  std::promise<void> release;
+  std::thread holder(
+    [&]()
+    {
+      std::lock_guard<hardware_interface::InstrumentedRecursiveMutex> guard(rm.resources_lock_);
+      holder_thread.set_value(
+        hardware_interface::InstrumentedRecursiveMutex::get_current_thread_id());
+      release.get_future().wait();
+    });
+  const int64_t holder_thread_id = holder_thread.get_future().get();
+  // the read of the control loop skips its cycle instead of waiting for the holder
+  EXPECT_EQ(rm.read(time, period).result, hardware_interface::return_type::OK);
+  release.set_value();
+  holder.join();
+
+  const auto statistics = find_lock_statistics("resources");
+  EXPECT_EQ(statistics.try_lock_failures, failures_before + 1);
+  EXPECT_EQ(statistics.last_blocking_thread, holder_thread_id);
+  EXPECT_EQ(statistics.owner_thread, 0);
+  EXPECT_GT(statistics.locks, 0u);
+}
+
+TEST_F(ResourceManagerTest, parallel_read_write)
+{
+  hardware_interface::ResourceManagerParams rm_params;
+  rm_params.robot_description = ros2_control_test_assets::minimal_robot_urdf;
+  rm_params.clock = node_.get_clock();
+  rm_params.logger = node_.get_logger();
+  rm_params.update_rate = 100;
+  rm_params.read_write_worker_pool.number_of_workers = 2;
+  TestableResourceManager rm(rm_params);
+  ASSERT_TRUE(rm.are_components_initialized());
+  activate_components(rm);
+
+  auto actuator_cmd = rm.claim_command_interface(TEST_ACTUATOR_HARDWARE_COMMAND_INTERFACES[0]);
+  auto system_cmd = rm.claim_command_interface(TEST_SYSTEM_HARDWARE_COMMAND_INTERFACES[0]);
+
+  const rclcpp::Duration period(0, 10000000);
+  rclcpp::Time time(0, 0, rcl_clock_type_t::RCL_ROS_TIME);
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_TRUE(actuator_cmd.set_value(static_cast<double>(i)));
+    ASSERT_TRUE(system_cmd.set_value(static_cast<double>(i)));
+    const auto read_status = rm.read(time, period);
+    EXPECT_EQ(read_status.result, hardware_interface::return_type::OK);
+    EXPECT_TRUE(read_status.failed_hardware_names.empty());
+    const auto write_status = rm.write(time, period);
+    EXPECT_EQ(write_status.result, hardware_interface::return_type::OK);
+    EXPECT_TRUE(write_status.failed_hardware_names.empty());
+    time += period;
+  }
+}
+
 TEST_F(ResourceManagerTest, resource_claiming)
 {
   TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf);
@@ -355,6 +594,82 @@ TEST_F(ResourceManagerTest, resource_claiming)
   }
 }
 
+TEST_F(ResourceManagerTest, detached_command_interfaces_are_not_claimed)
+{
+  TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf);
+  activate_components(rm);
+
+  const auto key = "joint1/position";
+  auto position_command_interface = rm.claim_command_interface(key);
+  ASSERT_TRUE(position_command_interface.set_value(1.5));
+  const auto copies = rm.make_detached_command_interfaces({key, "joint2/velocity"});
+  ASSERT_EQ(copies.size(), 2u);
+  EXPECT_EQ(copies[0]->get_name(), key);
+  EXPECT_DOUBLE_EQ(copies[0]->get_optional().value(), 1.5);
+  ASSERT_TRUE(copies[0]->set_value(2.5));
+  EXPECT_DOUBLE_EQ(position_command_interface.get_optional().value(), 1.5);
+  EXPECT_FALSE(rm.command_interface_is_claimed("joint2/velocity"));
+
+  EXPECT_THROW(
+    rm.make_detached_command_interfaces({key, "joint1/nonexistent"}), std::runtime_error);
+}
+
+TEST_F(ResourceManagerTest, interfaces_version_changes_with_the_interfaces)
+{
+  TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf);
+  activate_components(rm);
+
+  const auto key = "joint1/position";
+  auto version = rm.get_interfaces_version();
+  EXPECT_TRUE(rm.command_interface_is_available(key));
+  EXPECT_FALSE(rm.command_interface_is_claimed(key));
+  EXPECT_EQ(version, rm.get_interfaces_version());
+  {
+    auto position_command_interface = rm.claim_command_interface(key);
+    EXPECT_LT(version, rm.get_interfaces_version());
+    version = rm.get_interfaces_version();
+  }
+  EXPECT_LT(version, rm.get_interfaces_version());
+  version = rm.get_interfaces_version();
+
+  // the interfaces become unavailable
+  cleanup_components(rm);
+  EXPECT_FALSE(rm.command_interface_is_available(key));
+  EXPECT_LT(version, rm.get_interfaces_version());
+}
+
+TEST_F(ResourceManagerTest, set_components_state_sets_all_the_components)
+{
+  TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf);
+  EXPECT_FALSE(rm.command_interface_is_available("joint1/position"));
+
+  rclcpp_lifecycle::State active_state(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    hardware_interface::lifecycle_state_names::ACTIVE);
+  const auto results = rm.set_components_state(
+    {TEST_ACTUATOR_HARDWARE_NAME, TEST_SENSOR_HARDWARE_NAME, TEST_SYSTEM_HARDWARE_NAME,
+     "unknown_component"},
+    active_state);
+  ASSERT_EQ(results.size(), 4u);
+  EXPECT_EQ(results[0], hardware_interface::return_type::OK);
+  EXPECT_EQ(results[1], hardware_interface::return_type::OK);
+  EXPECT_EQ(results[2], hardware_interface::return_type::OK);
+  EXPECT_EQ(results[3], hardware_interface::return_type::ERROR);
+
+  auto status_map = rm.get_components_status();
+  EXPECT_EQ(
+    status_map[TEST_ACTUATOR_HARDWARE_NAME].state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_EQ(
+    status_map[TEST_SENSOR_HARDWARE_NAME].state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_EQ(
+    status_map[TEST_SYSTEM_HARDWARE_NAME].state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_TRUE(rm.command_interface_is_available("joint1/position"));
+  EXPECT_TRUE(rm.state_interface_is_available("joint1/position"));
+}
+
 class ExternalComponent : public hardware_interface::ActuatorInterface
 {
   std::vector<hardware_interface::StateInterface::ConstSharedPtr> on_export_state_interfaces()
@@ -1599,6 +1914,9 @@ public:
       ASSERT_THAT(
         failed_hardware_names,
         testing::ElementsAreArray(std::vector<std::string>({TEST_ACTUATOR_HARDWARE_NAME})));
+      EXPECT_THAT(
+        failed_hardware_names.get_indices(),
+        testing::ElementsAre(rm->get_hardware_component_index(TEST_ACTUATOR_HARDWARE_NAME)));
       auto status_map = rm->get_components_status();
       EXPECT_EQ(
         status_map[TEST_ACTUATOR_HARDWARE_NAME].state.id(),
@@ -1872,6 +2190,140 @@ TEST_F(ResourceManagerTestReadWriteError, handle_deactivate_on_hardware_write)
     std::bind(&TestableResourceManager::read, rm, _1, _2), test_constants::WRITE_DEACTIVATE_VALUE);
 }
 
+TEST_F(ResourceManagerTestReadWriteError, deferred_transitions_run_outside_of_the_write)
+{
+  using lifecycle_msgs::msg::State;
+  hardware_interface::ResourceManagerParams rm_params;
+  rm_params.robot_description = ros2_control_test_assets::minimal_robot_urdf;
+  rm_params.clock = node_.get_clock();
+  rm_params.logger = node_.get_logger();
+  rm_params.defer_control_loop_transitions = true;
+  rm = std::make_shared<TestableResourceManager>(rm_params);
+  activate_components(*rm);
+  claimed_itfs.push_back(
+    rm->claim_command_interface(TEST_ACTUATOR_HARDWARE_COMMAND_INTERFACES[0]));
+  claimed_itfs.push_back(rm->claim_command_interface(TEST_SYSTEM_HARDWARE_COMMAND_INTERFACES[0]));
+
+  auto wait_for_state = [this](const std::string & component, uint8_t state_id)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (rm->get_components_status()[component].state.id() != state_id &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return rm->get_components_status()[component].state.id();
+  };
+
+  // the failed component is masked out by the write, and its error transition runs later
+  ASSERT_TRUE(claimed_itfs[0].set_value(test_constants::WRITE_FAIL_VALUE));
+  ASSERT_TRUE(claimed_itfs[1].set_value(test_constants::WRITE_FAIL_VALUE - 10.0));
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::ERROR);
+    ASSERT_THAT(
+      failed_hardware_names,
+      testing::ElementsAreArray(std::vector<std::string>({TEST_ACTUATOR_HARDWARE_NAME})));
+    check_if_interface_available(false, true);
+  }
+  EXPECT_EQ(
+    wait_for_state(TEST_ACTUATOR_HARDWARE_NAME, State::PRIMARY_STATE_UNCONFIGURED),
+    State::PRIMARY_STATE_UNCONFIGURED);
+  EXPECT_EQ(
+    rm->get_components_status()[TEST_SYSTEM_HARDWARE_NAME].state.id(),
+    State::PRIMARY_STATE_ACTIVE);
+  EXPECT_EQ(rm->run_requested_transitions(), 0u);
+
+  // the deactivation requested by the write runs later as well
+  ASSERT_TRUE(claimed_itfs[0].set_value(test_constants::WRITE_DEACTIVATE_VALUE - 10.0));
+  ASSERT_TRUE(claimed_itfs[1].set_value(test_constants::WRITE_DEACTIVATE_VALUE));
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::DEACTIVATE);
+    ASSERT_THAT(
+      failed_hardware_names,
+      testing::ElementsAreArray(std::vector<std::string>({TEST_SYSTEM_HARDWARE_NAME})));
+  }
+  EXPECT_EQ(
+    wait_for_state(TEST_SYSTEM_HARDWARE_NAME, State::PRIMARY_STATE_INACTIVE),
+    State::PRIMARY_STATE_INACTIVE);
+  check_if_interface_available(false, true);
+}
+
+TEST_F(ResourceManagerTestReadWriteError, failed_component_is_recovered_with_backoff)
+{
+  using lifecycle_msgs::msg::State;
+  std::string urdf = ros2_control_test_assets::minimal_robot_urdf;
+  const std::string actuator_tag = "<ros2_control name=\"TestActuatorHardware\" type=\"actuator\">";
+  urdf.replace(
+    urdf.find(actuator_tag), actuator_tag.size(),
+    actuator_tag +
+      "<properties><recovery max_attempts=\"3\" initial_backoff=\"0.01\" "
+      "restore_controllers=\"true\"/></properties>");
+  hardware_interface::ResourceManagerParams rm_params;
+  rm_params.robot_description = urdf;
+  rm_params.clock = node_.get_clock();
+  rm_params.logger = node_.get_logger();
+  rm = std::make_shared<TestableResourceManager>(rm_params);
+  activate_components(*rm);
+  claimed_itfs.push_back(
+    rm->claim_command_interface(TEST_ACTUATOR_HARDWARE_COMMAND_INTERFACES[0]));
+  claimed_itfs.push_back(rm->claim_command_interface(TEST_SYSTEM_HARDWARE_COMMAND_INTERFACES[0]));
+
+  std::mutex recovered_mutex;
+  std::vector<std::pair<std::string, bool>> recovered_components;
+  rm->set_on_component_recovered_callback(
+    [&](const std::string & name, bool restore_controllers)
+    {
+      std::lock_guard<std::mutex> guard(recovered_mutex);
+      recovered_components.emplace_back(name, restore_controllers);
+    });
+  auto wait_for_recovery = [&]()
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+      {
+        std::lock_guard<std::mutex> guard(recovered_mutex);
+        if (!recovered_components.empty())
+        {
+          return true;
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+  };
+
+  // the error transition of the failed component runs out of the write, the component is then
+  // activated again and its interfaces available
+  ASSERT_TRUE(claimed_itfs[0].set_value(test_constants::WRITE_FAIL_VALUE));
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::ERROR);
+    ASSERT_THAT(
+      failed_hardware_names,
+      testing::ElementsAreArray(std::vector<std::string>({TEST_ACTUATOR_HARDWARE_NAME})));
+  }
+  ASSERT_TRUE(wait_for_recovery());
+  {
+    std::lock_guard<std::mutex> guard(recovered_mutex);
+    ASSERT_THAT(
+      recovered_components,
+      testing::ElementsAre(std::make_pair(std::string(TEST_ACTUATOR_HARDWARE_NAME), true)));
+  }
+  EXPECT_EQ(
+    rm->get_components_status()[TEST_ACTUATOR_HARDWARE_NAME].state.id(),
+    State::PRIMARY_STATE_ACTIVE);
+  check_if_interface_available(true, true);
+  EXPECT_EQ(rm->run_component_recoveries(), 0u);
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::OK);
+  }
+  rm->set_on_component_recovered_callback(nullptr);
+}
+
 TEST_F(ResourceManagerTest, test_caching_of_controllers_to_hardware)
 {
   TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf, false);
@@ -1918,6 +2370,55 @@ TEST_F(ResourceManagerTest, test_caching_of_controllers_to_hardware)
       testing::ElementsAreArray(
         std::vector<std::string>({TEST_BROADCASTER_SENSOR_NAME, TEST_BROADCASTER_ALL_NAME})));
   }
+
+  // the same controllers are resolved by the index of the components, for the real-time loop
+  for (const auto & hardware_name :
+       {TEST_ACTUATOR_HARDWARE_NAME, TEST_SYSTEM_HARDWARE_NAME, TEST_SENSOR_HARDWARE_NAME})
+  {
+    const auto index = rm.get_hardware_component_index(hardware_name);
+    ASSERT_TRUE(index.has_value()) << hardware_name;
+    const auto dependencies = rm.get_hardware_dependencies();
+    EXPECT_EQ(dependencies->get_component_name(index.value()), hardware_name);
+    std::vector<std::string> controllers;
+    for (const auto controller_index : dependencies->get_controllers_of_component(index.value()))
+    {
+      controllers.push_back(dependencies->get_controller_name(controller_index));
+    }
+    EXPECT_EQ(controllers, rm.get_cached_controllers_to_hardware(hardware_name));
+  }
+  EXPECT_FALSE(rm.get_hardware_component_index("unknown_hardware").has_value());
+  EXPECT_THAT(
+    rm.get_hardware_dependencies()->get_controllers_of_component(3), testing::IsEmpty());
+
+  // the removed controllers are not cached anymore
+  rm.remove_cached_controller_to_hardware(TEST_BROADCASTER_ALL_NAME);
+  rm.remove_cached_controller_to_hardware("unknown_controller");
+  EXPECT_THAT(
+    rm.get_cached_controllers_to_hardware(TEST_SYSTEM_HARDWARE_NAME),
+    testing::ElementsAre(TEST_CONTROLLER_SYSTEM_NAME));
+  EXPECT_THAT(
+    rm.get_cached_controllers_to_hardware(TEST_SENSOR_HARDWARE_NAME),
+    testing::ElementsAre(TEST_BROADCASTER_SENSOR_NAME));
+}
+
+TEST_F(ResourceManagerTest, test_caching_of_command_controllers_to_hardware)
+{
+  TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf, false);
+  activate_components(rm);
+
+  rm.cache_controller_to_hardware(
+    "test_controller_actuator", TEST_ACTUATOR_HARDWARE_COMMAND_INTERFACES,
+    TEST_ACTUATOR_HARDWARE_STATE_INTERFACES);
+  rm.cache_controller_to_hardware("test_broadcaster", {}, TEST_ACTUATOR_HARDWARE_STATE_INTERFACES);
+
+  const auto index = rm.get_hardware_component_index(TEST_ACTUATOR_HARDWARE_NAME);
+  ASSERT_TRUE(index.has_value());
+  const auto dependencies = rm.get_hardware_dependencies();
+  ASSERT_EQ(dependencies->get_controllers_of_component(index.value()).size(), 2u);
+  const auto & command_controllers =
+    dependencies->get_command_controllers_of_component(index.value());
+  ASSERT_EQ(command_controllers.size(), 1u);
+  EXPECT_EQ(dependencies->get_controller_name(command_controllers[0]), "test_controller_actuator");
 }
 
 class ResourceManagerTestReadWriteDifferentReadWriteRate : public ResourceManagerTest
@@ -2585,6 +3086,23 @@ TEST_F(ResourceManagerTestAsyncReadWrite, test_components_with_async_components_
   check_read_and_write_cycles(true, true);
 }
 
+TEST_F(ResourceManagerTestAsyncReadWrite, states_are_stamped_with_the_time_of_the_async_read)
+{
+  setup_resource_manager_and_do_initial_checks();
+
+  const rclcpp::Time trigger_time = time;
+  ASSERT_EQ(rm->read(trigger_time, duration).result, hardware_interface::return_type::OK);
+  const auto cycle = state_itfs[0].get_read_stamp().cycle;
+  node_.get_clock()->sleep_until(time + duration);
+  time = node_.get_clock()->now();
+
+  // the states of the async read triggered before are reported with its time
+  ASSERT_EQ(rm->read(time, duration).result, hardware_interface::return_type::OK);
+  EXPECT_EQ(state_itfs[0].get_read_stamp().cycle, cycle + 1);
+  EXPECT_EQ(state_itfs[0].get_read_stamp().time, trigger_time);
+  EXPECT_EQ(state_itfs[1].get_read_stamp().time, trigger_time);
+}
+
 TEST_F(ResourceManagerTestAsyncReadWrite, test_components_with_async_components_on_deactivate)
 {
   setup_resource_manager_and_do_initial_checks();
@@ -3003,6 +3521,94 @@ TEST_F(ResourceManagerTest, async_hardware_no_pure_virtual_call_on_destroy)
   EXPECT_NO_FATAL_FAILURE(rm.reset());
 }
 
+TEST_F(ResourceManagerTest, reload_only_the_changed_components)
+{
+  TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf, false);
+  activate_components(rm);
+  EXPECT_TRUE(rm.diff_robot_description(ros2_control_test_assets::minimal_robot_urdf).empty());
+
+  // remove the sensor and change a parameter of the system
+  std::string hardware_resources = ros2_control_test_assets::hardware_resources;
+  const std::string component_end = "</ros2_control>";
+  const auto sensor_begin = hardware_resources.find(
+    std::string("<ros2_control name=\"") + TEST_SENSOR_HARDWARE_NAME + "\"");
+  const auto sensor_end = hardware_resources.find(component_end, sensor_begin);
+  hardware_resources.erase(sensor_begin, sensor_end + component_end.size() - sensor_begin);
+  const std::string parameter = "example_param_read_for_sec\">2";
+  hardware_resources.replace(
+    hardware_resources.find(parameter), parameter.size(), "example_param_read_for_sec\">3");
+  const auto urdf = std::string(ros2_control_test_assets::urdf_head) + hardware_resources +
+                    std::string(ros2_control_test_assets::minimal_robot_transmissions) +
+                    std::string(ros2_control_test_assets::urdf_tail);
+
+  const auto diff = rm.diff_robot_description(urdf);
+  EXPECT_THAT(diff.added_components, SizeIs(0));
+  EXPECT_THAT(diff.removed_components, testing::ElementsAre(TEST_SENSOR_HARDWARE_NAME));
+  EXPECT_THAT(diff.changed_components, testing::ElementsAre(TEST_SYSTEM_HARDWARE_NAME));
+
+  hardware_interface::ResourceManagerParams params;
+  params.robot_description = urdf;
+  params.update_rate = 100;
+  params.clock = node_.get_clock();
+  params.logger = node_.get_logger();
+  {
+    // a claimed interface of a changed component prevents the reload
+    auto claimed = rm.claim_command_interface("joint2/velocity");
+    EXPECT_FALSE(rm.reload_components(diff, params));
+    EXPECT_EQ(1u, rm.sensor_components_size());
+  }
+  ASSERT_TRUE(rm.reload_components(diff, params));
+
+  EXPECT_EQ(1u, rm.actuator_components_size());
+  EXPECT_EQ(0u, rm.sensor_components_size());
+  EXPECT_EQ(1u, rm.system_components_size());
+  EXPECT_FALSE(rm.state_interface_exists("sensor1/velocity"));
+  EXPECT_TRUE(rm.command_interface_exists("joint2/velocity"));
+  const auto & status = rm.get_components_status();
+  EXPECT_EQ(status.count(TEST_SENSOR_HARDWARE_NAME), 0u);
+  // the unchanged component keeps running, the reloaded one is initialized again
+  EXPECT_EQ(
+    status.at(TEST_ACTUATOR_HARDWARE_NAME).state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_EQ(
+    status.at(TEST_SYSTEM_HARDWARE_NAME).state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED);
+  EXPECT_TRUE(rm.diff_robot_description(urdf).empty());
+}
+
+TEST_F(ResourceManagerTest, only_the_matching_interfaces_are_introspected)
+{
+  TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf, false);
+
+  // all the interfaces are registered by default
+  auto state_interfaces = rm.state_interface_keys();
+  auto command_interfaces = rm.command_interface_keys();
+  std::sort(state_interfaces.begin(), state_interfaces.end());
+  std::sort(command_interfaces.begin(), command_interfaces.end());
+  auto introspected = rm.get_introspected_interfaces();
+  EXPECT_EQ(introspected.first, state_interfaces);
+  EXPECT_EQ(introspected.second, command_interfaces);
+
+  rm.set_introspected_interfaces({"joint1/*"});
+  introspected = rm.get_introspected_interfaces();
+  EXPECT_THAT(
+    introspected.first, testing::ElementsAre(
+                          "joint1/position", "joint1/some_unlisted_interface", "joint1/velocity"));
+  EXPECT_THAT(introspected.second, testing::ElementsAre("joint1/max_velocity", "joint1/position"));
+
+  rm.set_introspected_interfaces({"*/velocity", "joint?/max_velocity"});
+  introspected = rm.get_introspected_interfaces();
+  EXPECT_THAT(introspected.first, testing::Contains("sensor1/velocity"));
+  EXPECT_THAT(introspected.first, testing::Each(testing::EndsWith("/velocity")));
+  EXPECT_THAT(introspected.second, testing::Contains("joint1/max_velocity"));
+  EXPECT_THAT(introspected.second, testing::Not(testing::Contains("joint1/position")));
+
+  rm.set_introspected_interfaces({});
+  introspected = rm.get_introspected_interfaces();
+  EXPECT_THAT(introspected.first, SizeIs(0));
+  EXPECT_THAT(introspected.second, SizeIs(0));
+}
+
 int main(int argc, char ** argv)
 {
   rclcpp::init(argc, argv);
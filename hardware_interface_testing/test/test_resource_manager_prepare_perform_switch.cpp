@@ -847,6 +847,60 @@ TEST_F(
   EXPECT_NEAR(claimed_actuator_position_state_->get_optional().value(), 0.707, 1e-7);
 };
 
+// System  : ACTIVE
+// Actuator: ACTIVE
+TEST_F(
+  ResourceManagerPreparePerformTest,
+  when_switch_is_not_the_prepared_one_expect_perform_resolving_it)
+{
+  preconfigure_components(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, "active",
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, "active");
+
+  // not prepared at all
+  EXPECT_TRUE(rm_->perform_command_mode_switch(legal_keys_system, legal_keys_system));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 100.0);
+
+  // prepared for another switch
+  EXPECT_TRUE(rm_->prepare_command_mode_switch(legal_keys_system, empty_keys));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 101.0);
+  EXPECT_TRUE(rm_->perform_command_mode_switch(legal_keys_system, legal_keys_system));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 201.0);
+
+  // the prepared plan is used once, the second perform resolves the switch again
+  EXPECT_TRUE(rm_->prepare_command_mode_switch(legal_keys_system, legal_keys_system));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 202.0);
+  EXPECT_TRUE(rm_->perform_command_mode_switch(legal_keys_system, legal_keys_system));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 302.0);
+  EXPECT_TRUE(rm_->perform_command_mode_switch(legal_keys_system, legal_keys_system));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 402.0);
+  EXPECT_EQ(claimed_actuator_position_state_->get_optional().value(), 0.0);
+}
+
+// System  : ACTIVE
+// Actuator: INACTIVE
+TEST_F(
+  ResourceManagerPreparePerformTest,
+  when_one_component_rejects_expect_the_others_aborting_the_switch)
+{
+  preconfigure_components(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, "active",
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, "inactive");
+
+  std::vector<std::string> legal_keys_both = legal_keys_system;
+  legal_keys_both.insert(
+    legal_keys_both.end(), legal_keys_actuator.begin(), legal_keys_actuator.end());
+  // the system prepares the switch, the inactive actuator rejects its start interfaces
+  EXPECT_FALSE(rm_->prepare_command_mode_switch(legal_keys_both, empty_keys));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 1001.0)
+    << "The system should prepare and then abort the switch";
+  EXPECT_EQ(claimed_actuator_position_state_->get_optional().value(), 0.0);
+
+  // nothing to abort when the switch is accepted
+  EXPECT_TRUE(rm_->prepare_command_mode_switch(legal_keys_system, empty_keys));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 1002.0);
+}
+
 int main(int argc, char ** argv)
 {
   rclcpp::init(argc, argv);
@@ -0,0 +1,97 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef JOINT_LIMITS__JOINT_FAST_SATURATION_LIMITER_HPP_
+#define JOINT_LIMITS__JOINT_FAST_SATURATION_LIMITER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "joint_limits/data_structures.hpp"
+#include "joint_limits/joint_saturation_limiter.hpp"
+#include "rclcpp/duration.hpp"
+
+namespace joint_limits
+{
+/**
+ * @brief Saturation limiter with kernels specialized at compile time for every combination of
+ * commanded interfaces.
+ *
+ * The limiter applies the same limits as JointSaturationLimiter<JointControlInterfacesData>. The
+ * kernel matching the interfaces present in the desired command is selected at the first enforce()
+ * after the configuration or a reset, and only selected again if the commanded interfaces change,
+ * so the kernels don't check the presence of the std::optional members of the command. Commands
+ * with a jerk are handled by the generic JointSaturationLimiter::on_enforce().
+ */
+class JointFastSaturationLimiter : public JointSaturationLimiter<JointControlInterfacesData>
+{
+public:
+  /// Bits of the mask of the commanded interfaces
+  static constexpr std::uint8_t POSITION = 1u << 0;
+  static constexpr std::uint8_t VELOCITY = 1u << 1;
+  static constexpr std::uint8_t EFFORT = 1u << 2;
+  static constexpr std::uint8_t ACCELERATION = 1u << 3;
+  static constexpr std::uint8_t JERK = 1u << 4;
+
+  bool on_init() override;
+
+  bool on_configure(const JointControlInterfacesData & current_joint_states) override;
+
+  bool on_enforce(
+    const JointControlInterfacesData & actual, JointControlInterfacesData & desired,
+    const rclcpp::Duration & dt) override;
+
+  void reset_internals() override;
+
+  /// Returns the mask of the interfaces that have a value in the data.
+  static std::uint8_t get_interface_mask(const JointControlInterfacesData & data)
+  {
+    return static_cast<std::uint8_t>(
+      (data.has_position() ? POSITION : 0u) | (data.has_velocity() ? VELOCITY : 0u) |
+      (data.has_effort() ? EFFORT : 0u) | (data.has_acceleration() ? ACCELERATION : 0u) |
+      (data.has_jerk() ? JERK : 0u));
+  }
+
+private:
+  using Kernel = bool (JointFastSaturationLimiter::*)(
+    const JointControlInterfacesData &, JointControlInterfacesData &, double);
+
+  /// Limits the desired command, which has a value for exactly the interfaces of the template
+  /// parameters.
+  template <bool HasPosition, bool HasVelocity, bool HasEffort, bool HasAcceleration>
+  bool enforce_kernel(
+    const JointControlInterfacesData & actual, JointControlInterfacesData & desired,
+    double dt_seconds);
+
+  template <std::size_t... Masks>
+  static constexpr std::array<Kernel, sizeof...(Masks)> make_kernels(
+    std::index_sequence<Masks...>)
+  {
+    return {{&JointFastSaturationLimiter::enforce_kernel<
+      (Masks & POSITION) != 0u, (Masks & VELOCITY) != 0u, (Masks & EFFORT) != 0u,
+      (Masks & ACCELERATION) != 0u>...}};
+  }
+
+  /// Kernels indexed by the mask of the commanded interfaces without the jerk
+  static const std::array<Kernel, JERK> KERNELS;
+
+  Kernel kernel_ = nullptr;
+  std::uint8_t kernel_mask_ = 0u;
+};
+
+}  // namespace joint_limits
+
+#endif  // JOINT_LIMITS__JOINT_FAST_SATURATION_LIMITER_HPP_
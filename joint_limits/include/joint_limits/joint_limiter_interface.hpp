@@ -71,24 +71,21 @@ public:
     // Initialize and get joint limits from parameter server
     if (has_parameter_interface())
     {
-      for (size_t i = 0; i < number_of_joints_; ++i)
+      // the parameters of all the joints are declared and read at once
+      if (!declare_parameters(joint_names, node_param_itf_, node_logging_itf_))
+      {
+        RCLCPP_ERROR(
+          node_logging_itf_->get_logger(), "JointLimiter: parameter declaration has failed");
+        result = false;
+      }
+      else if (!get_joint_limits(joint_names, node_param_itf_, node_logging_itf_, joint_limits_))
+      {
+        RCLCPP_ERROR(
+          node_logging_itf_->get_logger(), "JointLimiter: getting parameters has failed");
+        result = false;
+      }
+      for (size_t i = 0; result && i < number_of_joints_; ++i)
       {
-        if (!declare_parameters(joint_names[i], node_param_itf_, node_logging_itf_))
-        {
-          RCLCPP_ERROR(
-            node_logging_itf_->get_logger(),
-            "JointLimiter: Joint '%s': parameter declaration has failed", joint_names[i].c_str());
-          result = false;
-          break;
-        }
-        if (!get_joint_limits(joint_names[i], node_param_itf_, node_logging_itf_, joint_limits_[i]))
-        {
-          RCLCPP_ERROR(
-            node_logging_itf_->get_logger(),
-            "JointLimiter: Joint '%s': getting parameters has failed", joint_names[i].c_str());
-          result = false;
-          break;
-        }
         RCLCPP_INFO(
           node_logging_itf_->get_logger(), "Limits for joint %zu (%s) are:\n%s", i,
           joint_names[i].c_str(), joint_limits_[i].to_string().c_str());
@@ -208,7 +205,7 @@ public:
     const JointLimitsStateDataType & current_joint_states,
     JointLimitsStateDataType & desired_joint_states, const rclcpp::Duration & dt)
   {
-    joint_limits_ = *(updated_limits_.readFromRT());
+    read_updated_limits();
     return on_enforce(current_joint_states, desired_joint_states, dt);
   }
 
@@ -266,6 +263,13 @@ protected:
    */
   bool has_parameter_interface() const { return node_param_itf_ != nullptr; }
 
+  /**
+   * @brief Applies the joint limits updated through the parameters, if any.
+   *
+   * @note this method is real-time safe, it is called by enforce() before limiting the states.
+   */
+  void read_updated_limits() { joint_limits_ = *(updated_limits_.readFromRT()); }
+
   size_t number_of_joints_;
   std::vector<std::string> joint_names_;
   std::vector<joint_limits::JointLimits> joint_limits_;
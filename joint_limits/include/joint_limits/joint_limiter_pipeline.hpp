@@ -0,0 +1,79 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef JOINT_LIMITS__JOINT_LIMITER_PIPELINE_HPP_
+#define JOINT_LIMITS__JOINT_LIMITER_PIPELINE_HPP_
+
+#include <cstdint>
+#include <string>
+
+#include "joint_limits/data_structures.hpp"
+#include "joint_limits/joint_limits.hpp"
+#include "joint_limits/joint_saturation_limiter.hpp"
+#include "rclcpp/duration.hpp"
+
+namespace joint_limits
+{
+/**
+ * @brief Limiter of a joint composed of stages, range, velocity, acceleration, jerk and soft
+ * limits, fused into a single pass over the joint data.
+ *
+ * Every stage only takes its own limits into account, the others are ignored as if they were not
+ * set: the position and effort ranges, the velocity, the acceleration and deceleration, the jerk,
+ * and the soft limits. The bounds of all the stages of an interface are intersected before the
+ * command is clamped once, and the previous command is updated in the same pass, so the command
+ * goes through the stages without any intermediate copy of the data.
+ *
+ * With all the stages and without soft limits, the limited commands are the ones of
+ * JointSaturationLimiter<JointControlInterfacesData>, and with soft limits the ones of
+ * JointSoftLimiter.
+ */
+class JointLimiterPipeline : public JointSaturationLimiter<JointControlInterfacesData>
+{
+public:
+  /// Bits of the mask of the stages
+  static constexpr std::uint8_t RANGE = 1u << 0;
+  static constexpr std::uint8_t VELOCITY = 1u << 1;
+  static constexpr std::uint8_t ACCELERATION = 1u << 2;
+  static constexpr std::uint8_t JERK = 1u << 3;
+  static constexpr std::uint8_t SOFT = 1u << 4;
+  static constexpr std::uint8_t ALL_STAGES = RANGE | VELOCITY | ACCELERATION | JERK | SOFT;
+
+  /**
+   * @brief Constructor
+   * @param stages mask of the stages of the pipeline, all of them by default. The soft stage is
+   * only active if soft limits are given to init().
+   */
+  explicit JointLimiterPipeline(std::uint8_t stages = ALL_STAGES);
+
+  bool on_init() override;
+
+  bool on_enforce(
+    const JointControlInterfacesData & actual, JointControlInterfacesData & desired,
+    const rclcpp::Duration & dt) override;
+
+  /// Returns the mask of the active stages, resolved by init().
+  std::uint8_t get_stages() const { return active_stages_; }
+
+  /// Returns the names of the stages of \p stages in the order of the pipeline, e.g., for logging.
+  static std::string get_stages_string(std::uint8_t stages);
+
+private:
+  std::uint8_t stages_;
+  std::uint8_t active_stages_ = 0u;
+};
+
+}  // namespace joint_limits
+
+#endif  // JOINT_LIMITS__JOINT_LIMITER_PIPELINE_HPP_
@@ -19,8 +19,13 @@
 
 #include <fmt/compile.h>
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "joint_limits/joint_limits.hpp"
@@ -846,6 +851,322 @@ inline bool check_for_limits_update(
   return changed;
 }
 
+/// Values of the joint limits parameters of all the joints of a node.
+/**
+ * All the parameters declared under the `joint_limits` namespace are read at once, with a single
+ * list and get of the parameters, instead of the separate calls to the parameters interface for
+ * every parameter of every joint. The limits of the joints are then parsed from the read values,
+ * with the same rules as the `get_joint_limits` functions of a single joint.
+ */
+class JointLimitsParameters
+{
+public:
+  /// Names of the JointLimits and SoftJointLimits parameters of a joint, see declare_parameters.
+  static constexpr std::array<const char *, 19> PARAMETER_NAMES = {
+    "has_position_limits",
+    "min_position",
+    "max_position",
+    "has_velocity_limits",
+    "max_velocity",
+    "has_acceleration_limits",
+    "max_acceleration",
+    "has_deceleration_limits",
+    "max_deceleration",
+    "has_jerk_limits",
+    "max_jerk",
+    "has_effort_limits",
+    "max_effort",
+    "angle_wraparound",
+    "has_soft_limits",
+    "k_position",
+    "k_velocity",
+    "soft_lower_limit",
+    "soft_upper_limit"};
+  /// Number of the JointLimits parameters at the beginning of PARAMETER_NAMES.
+  static constexpr std::size_t JOINT_LIMITS_PARAMETERS_COUNT = 14;
+
+  /**
+   * @param[in] param_itf node parameters interface of the node where parameters are specified.
+   * @throws std::exception if the parameters cannot be read.
+   */
+  explicit JointLimitsParameters(
+    const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr & param_itf)
+  {
+    const auto parameter_names = param_itf->list_parameters({"joint_limits"}, 0u).names;
+    for (const auto & parameter : param_itf->get_parameters(parameter_names))
+    {
+      // the names are `joint_limits.<joint_name>.<parameter_name>`, the joint name can contain dots
+      const std::string & name = parameter.get_name();
+      const auto separator_pos = name.find_last_of('.');
+      if (separator_pos == std::string::npos || separator_pos <= PREFIX_SIZE)
+      {
+        continue;
+      }
+      joints_[name.substr(PREFIX_SIZE, separator_pos - PREFIX_SIZE)].emplace(
+        name.substr(separator_pos + 1), parameter.get_parameter_value());
+    }
+  }
+
+  /// Returns true if any JointLimits or SoftJointLimits parameter is declared for the joint.
+  bool has_joint(const std::string & joint_name) const { return joints_.count(joint_name) > 0; }
+
+  /// Returns true if the parameter of the joint is declared, e.g., `k_position`.
+  bool has_parameter(const std::string & joint_name, const std::string & parameter_name) const
+  {
+    const auto joint_it = joints_.find(joint_name);
+    return joint_it != joints_.end() && joint_it->second.count(parameter_name) > 0;
+  }
+
+  /**
+   * @brief Populate a JointLimits instance from the read parameters.
+   *
+   * Same as the `get_joint_limits` function of a joint with the node parameters interface, without
+   * the logging.
+   *
+   * @throws rclcpp::ParameterTypeException if a parameter has the wrong type.
+   * @return True if a limits specification is found, false otherwise.
+   */
+  bool get_joint_limits(const std::string & joint_name, JointLimits & limits) const
+  {
+    const auto joint_it = joints_.find(joint_name);
+    if (joint_it == joints_.end())
+    {
+      return false;
+    }
+    const auto & values = joint_it->second;
+    const auto has = [&values](const char * parameter_name)
+    { return values.count(parameter_name) > 0; };
+    const auto get = [&values](const char * parameter_name) -> const rclcpp::ParameterValue &
+    { return values.at(parameter_name); };
+    if (std::none_of(
+          PARAMETER_NAMES.begin(), PARAMETER_NAMES.begin() + JOINT_LIMITS_PARAMETERS_COUNT, has))
+    {
+      return false;
+    }
+
+    const auto get_limit =
+      [&has, &get](const char * flag_name, const char * value_name, bool & flag, double & value)
+    {
+      if (!has(flag_name))
+      {
+        return;
+      }
+      flag = get(flag_name).get<bool>();
+      if (flag && has(value_name))
+      {
+        value = get(value_name).get<double>();
+      }
+      else
+      {
+        flag = false;
+      }
+    };
+
+    if (has("has_position_limits"))
+    {
+      limits.has_position_limits = get("has_position_limits").get<bool>();
+      if (limits.has_position_limits && has("min_position") && has("max_position"))
+      {
+        limits.min_position = get("min_position").get<double>();
+        limits.max_position = get("max_position").get<double>();
+      }
+      else
+      {
+        limits.has_position_limits = false;
+      }
+
+      if (!limits.has_position_limits && has("angle_wraparound"))
+      {
+        limits.angle_wraparound = get("angle_wraparound").get<bool>();
+      }
+    }
+    get_limit(
+      "has_velocity_limits", "max_velocity", limits.has_velocity_limits, limits.max_velocity);
+    get_limit(
+      "has_acceleration_limits", "max_acceleration", limits.has_acceleration_limits,
+      limits.max_acceleration);
+    get_limit(
+      "has_deceleration_limits", "max_deceleration", limits.has_deceleration_limits,
+      limits.max_deceleration);
+    get_limit("has_jerk_limits", "max_jerk", limits.has_jerk_limits, limits.max_jerk);
+    get_limit("has_effort_limits", "max_effort", limits.has_effort_limits, limits.max_effort);
+    return true;
+  }
+
+  /**
+   * @brief Populate a SoftJointLimits instance from the read parameters.
+   *
+   * Same as the `get_joint_limits` function of a joint with the node parameters interface, without
+   * the logging.
+   *
+   * @throws rclcpp::ParameterTypeException if a parameter has the wrong type.
+   * @return True if a complete soft limits specification is found, false otherwise.
+   */
+  bool get_joint_limits(const std::string & joint_name, SoftJointLimits & soft_limits) const
+  {
+    const auto joint_it = joints_.find(joint_name);
+    if (joint_it == joints_.end())
+    {
+      return false;
+    }
+    const auto & values = joint_it->second;
+    const auto has = [&values](const char * parameter_name)
+    { return values.count(parameter_name) > 0; };
+    if (
+      has("has_soft_limits") && values.at("has_soft_limits").get<bool>() && has("k_position") &&
+      has("k_velocity") && has("soft_lower_limit") && has("soft_upper_limit"))
+    {
+      soft_limits.k_position = values.at("k_position").get<double>();
+      soft_limits.k_velocity = values.at("k_velocity").get<double>();
+      soft_limits.min_position = values.at("soft_lower_limit").get<double>();
+      soft_limits.max_position = values.at("soft_upper_limit").get<double>();
+      return true;
+    }
+    return false;
+  }
+
+private:
+  /// Size of the `joint_limits.` prefix of the parameter names
+  static constexpr std::size_t PREFIX_SIZE = 13;
+
+  /// Values of the parameters by parameter name and by joint name
+  std::unordered_map<std::string, std::unordered_map<std::string, rclcpp::ParameterValue>> joints_;
+};
+
+/**
+ * @brief Declare JointLimits and SoftJointLimits parameters for all the joints with @p joint_names
+ * using node parameters interface @p param_itf.
+ *
+ * Same as calling `declare_parameters` for every joint, but the declared parameters are listed
+ * once, and only the parameters that are not declared yet are declared, without reading them back.
+ *
+ * @param[in] joint_names names of the joints for which parameters will be declared.
+ * @param[in] param_itf node parameters interface object to access parameters.
+ * @param[in] logging_itf node logging interface to log if error happens.
+ *
+ * @return True if parameters are successfully declared, false otherwise.
+ */
+inline bool declare_parameters(
+  const std::vector<std::string> & joint_names,
+  const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr & param_itf,
+  const rclcpp::node_interfaces::NodeLoggingInterface::SharedPtr & logging_itf)
+{
+  try
+  {
+    const auto declared_names = param_itf->list_parameters({"joint_limits"}, 0u).names;
+    const std::unordered_set<std::string> declared(declared_names.begin(), declared_names.end());
+    const rclcpp::ParameterValue bool_default(false);
+    const rclcpp::ParameterValue double_default(std::numeric_limits<double>::quiet_NaN());
+    for (const auto & joint_name : joint_names)
+    {
+      for (const char * parameter_name : JointLimitsParameters::PARAMETER_NAMES)
+      {
+        const std::string name =
+          fmt::format(FMT_COMPILE("joint_limits.{}.{}"), joint_name, parameter_name);
+        if (declared.count(name) == 0)
+        {
+          const bool is_flag = std::string_view(parameter_name).substr(0, 4) == "has_" ||
+                               std::string_view(parameter_name) == "angle_wraparound";
+          param_itf->declare_parameter(name, is_flag ? bool_default : double_default);
+        }
+      }
+    }
+  }
+  catch (const std::exception & ex)
+  {
+    RCLCPP_ERROR(logging_itf->get_logger(), "%s", ex.what());
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Populate the JointLimits instances of all the joints with @p joint_names from the node
+ * parameters.
+ *
+ * Same as calling `get_joint_limits` for every joint, but all the parameters are read at once,
+ * see JointLimitsParameters.
+ *
+ * @param[in] joint_names Names of the joints whose limits are to be fetched.
+ * @param[in] param_itf node parameters interface of the node where parameters are specified.
+ * @param[in] logging_itf node logging interface to provide log errors.
+ * @param[out] limits Where the joint limits of the joints get written into, resized to the number
+ * of joints. Values not specified in the parameter server remain unchanged.
+ *
+ * @return True if a limits specification is found for all the joints, false otherwise.
+ */
+inline bool get_joint_limits(
+  const std::vector<std::string> & joint_names,
+  const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr & param_itf,
+  const rclcpp::node_interfaces::NodeLoggingInterface::SharedPtr & logging_itf,
+  std::vector<JointLimits> & limits)
+{
+  limits.resize(joint_names.size());
+  bool result = true;
+  try
+  {
+    const JointLimitsParameters parameters(param_itf);
+    for (std::size_t i = 0; i < joint_names.size(); ++i)
+    {
+      if (!parameters.get_joint_limits(joint_names[i], limits[i]))
+      {
+        RCLCPP_ERROR(
+          logging_itf->get_logger(),
+          "No joint limits specification found for joint '%s' in the parameter server "
+          "(param name: joint_limits.%s).",
+          joint_names[i].c_str(), joint_names[i].c_str());
+        result = false;
+      }
+    }
+  }
+  catch (const std::exception & ex)
+  {
+    RCLCPP_ERROR(logging_itf->get_logger(), "%s", ex.what());
+    return false;
+  }
+  return result;
+}
+
+/**
+ * @brief Populate the SoftJointLimits instances of all the joints with @p joint_names from the node
+ * parameters.
+ *
+ * Same as calling `get_joint_limits` for every joint, but all the parameters are read at once,
+ * see JointLimitsParameters.
+ *
+ * @param[in] joint_names Names of the joints whose soft limits are to be fetched.
+ * @param[in] param_itf node parameters interface of the node where parameters are specified.
+ * @param[in] logging_itf node logging interface to provide log errors.
+ * @param[out] soft_limits Where the soft joint limits of the joints get written into, resized to
+ * the number of joints. Only complete specifications overwrite the existing values.
+ *
+ * @return True if a complete soft limits specification is found for all the joints, false
+ * otherwise.
+ */
+inline bool get_joint_limits(
+  const std::vector<std::string> & joint_names,
+  const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr & param_itf,
+  const rclcpp::node_interfaces::NodeLoggingInterface::SharedPtr & logging_itf,
+  std::vector<SoftJointLimits> & soft_limits)
+{
+  soft_limits.resize(joint_names.size());
+  bool result = true;
+  try
+  {
+    const JointLimitsParameters parameters(param_itf);
+    for (std::size_t i = 0; i < joint_names.size(); ++i)
+    {
+      result &= parameters.get_joint_limits(joint_names[i], soft_limits[i]);
+    }
+  }
+  catch (const std::exception & ex)
+  {
+    RCLCPP_ERROR(logging_itf->get_logger(), "%s", ex.what());
+    return false;
+  }
+  return result;
+}
+
 }  // namespace joint_limits
 
 #endif  // JOINT_LIMITS__JOINT_LIMITS_ROSPARAM_HPP_
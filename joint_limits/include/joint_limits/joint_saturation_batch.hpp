@@ -0,0 +1,135 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef JOINT_LIMITS__JOINT_SATURATION_BATCH_HPP_
+#define JOINT_LIMITS__JOINT_SATURATION_BATCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "joint_limits/joint_limits.hpp"
+
+namespace joint_limits
+{
+/// Position, velocity, effort and acceleration of several joints in structure-of-arrays layout.
+/**
+ * Every array has one entry per joint. A value is only used if the validity flag of the joint is
+ * set to 1, the flags replace the std::optional members of JointControlInterfacesData so that the
+ * values of all the joints are contiguous.
+ */
+struct JointBatchData
+{
+  std::vector<double> position;
+  std::vector<double> velocity;
+  std::vector<double> effort;
+  std::vector<double> acceleration;
+
+  std::vector<std::uint8_t> has_position;
+  std::vector<std::uint8_t> has_velocity;
+  std::vector<std::uint8_t> has_effort;
+  std::vector<std::uint8_t> has_acceleration;
+
+  /// Resizes all the arrays to the number of joints, the added values are invalid.
+  void resize(std::size_t number_of_joints);
+
+  /// Returns the number of joints.
+  std::size_t size() const { return position.size(); }
+};
+
+namespace internal
+{
+/// Initializes the previous commands of the joints that don't have any, like the single-joint
+/// limiters at their first enforce().
+void initialize_prev_command(
+  const JointBatchData & actual, const JointBatchData & desired, JointBatchData & prev_command);
+
+/// Stores the valid desired commands as the previous commands, see update_prev_command().
+void update_prev_command(const JointBatchData & desired, JointBatchData & prev_command);
+
+/// Throws std::runtime_error if the actual position of a joint with a valid desired position is
+/// out of its position limits.
+void verify_actual_positions(
+  const std::vector<std::string> & joint_names, const std::vector<double> & min_position,
+  const std::vector<double> & max_position, const std::vector<std::uint8_t> & has_position_limits,
+  const JointBatchData & actual, const JointBatchData & desired);
+}  // namespace internal
+
+/**
+ * @brief Saturates the commands of several joints at once, with the same limits as
+ * JointSaturationLimiter<JointControlInterfacesData>.
+ *
+ * The limits are copied into contiguous arrays at configuration, and every kind of command is
+ * limited in a separate pass over all the joints, so that the loops are simple enough to be
+ * auto-vectorized by the compiler. This avoids the virtual call, the mutex and the std::optional
+ * handling per joint of the single-joint limiter for robots with many joints.
+ *
+ * Unlike JointSaturationLimiter, the jerk is not limited and nothing is logged in enforce().
+ *
+ * @note enforce() doesn't allocate memory and is real-time safe, as long as the actual position of
+ * the joints is not out of bounds.
+ */
+class JointSaturationBatch
+{
+public:
+  /**
+   * @brief Configures the limits of the joints and resets the previous commands.
+   * @param joint_names The names of the joints, used for the error messages.
+   * @param limits The limits of the joints, in the same order as the names.
+   * @return False if the number of limits doesn't match the number of joints.
+   */
+  bool configure(
+    const std::vector<std::string> & joint_names, const std::vector<JointLimits> & limits);
+
+  /// Resets the previous commands, they are initialized again at the next enforce().
+  void reset();
+
+  /// Returns the number of configured joints.
+  std::size_t size() const { return joint_names_.size(); }
+
+  /**
+   * @brief Limits the desired commands of all the joints.
+   * @param actual The actual state of the joints.
+   * @param desired The desired commands of the joints, limited in place.
+   * @param dt The time step in seconds.
+   * @return True if any command was limited, false if dt is not positive or if the sizes of the
+   * data don't match the configured joints.
+   * @throws std::runtime_error if the actual position of a joint whose position is commanded is out
+   * of bounds.
+   */
+  bool enforce(const JointBatchData & actual, JointBatchData & desired, double dt);
+
+private:
+  std::vector<std::string> joint_names_;
+
+  std::vector<double> min_position_;
+  std::vector<double> max_position_;
+  std::vector<double> max_velocity_;
+  std::vector<double> max_acceleration_;
+  std::vector<double> max_deceleration_;
+  std::vector<double> max_effort_;
+
+  std::vector<std::uint8_t> has_position_limits_;
+  std::vector<std::uint8_t> has_velocity_limits_;
+  std::vector<std::uint8_t> has_acceleration_limits_;
+  std::vector<std::uint8_t> has_deceleration_limits_;
+  std::vector<std::uint8_t> has_effort_limits_;
+
+  JointBatchData prev_command_;
+};
+
+}  // namespace joint_limits
+
+#endif  // JOINT_LIMITS__JOINT_SATURATION_BATCH_HPP_
@@ -17,6 +17,8 @@
 #ifndef JOINT_LIMITS__JOINT_SATURATION_LIMITER_HPP_
 #define JOINT_LIMITS__JOINT_SATURATION_LIMITER_HPP_
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -75,6 +77,27 @@ public:
     const JointLimitsStateDataType & current_joint_states,
     JointLimitsStateDataType & desired_joint_states, const rclcpp::Duration & dt) override;
 
+  /**
+   * @brief Enforce joint limits to consecutive points of a trajectory, in place.
+   *
+   * Only implemented for trajectory_msgs::msg::JointTrajectoryPoint. Every point is limited like
+   * with on_enforce(), from the previous point of the trajectory once limited, or from the current
+   * joint states for the first point, with the difference of their time_from_start as time delta.
+   * The points that don't come after the previous one in time are left untouched. The buffers of
+   * the limiter are reused for all the points, so that limiting a long trajectory doesn't allocate
+   * memory per point.
+   *
+   * @param[in] current_joint_states current joint states a robot is in, before the first point.
+   * @param[in,out] trajectory_points points that should be adjusted to obey the limits.
+   * @param[in] first_point index of the first point to limit.
+   * @param[in] number_of_points number of points to limit, the remaining points by default.
+   * @return true if limits are enforced on any point, otherwise false.
+   */
+  bool enforce_trajectory(
+    const JointLimitsStateDataType & current_joint_states,
+    std::vector<JointLimitsStateDataType> & trajectory_points, size_t first_point = 0,
+    size_t number_of_points = std::numeric_limits<size_t>::max());
+
   /**
    * @brief Reset internal states of the limiter.
    *
@@ -88,9 +111,62 @@ public:
   }
 
 protected:
+  /// Buffers of the limiting of a trajectory point, reused between the calls.
+  struct TrajectoryPointBuffers
+  {
+    std::vector<double> desired_pos;
+    std::vector<double> desired_vel;
+    std::vector<double> desired_acc;
+    std::vector<double> expected_pos;
+    std::vector<double> zero_velocities;
+    /// Indices of the joints whose limits were triggered
+    std::vector<size_t> limited_jnts_pos;
+    std::vector<size_t> limited_jnts_vel;
+    std::vector<size_t> limited_jnts_acc;
+    std::vector<size_t> limited_jnts_dec;
+
+    void resize(size_t number_of_joints)
+    {
+      for (auto * values : {&desired_pos, &desired_vel, &desired_acc, &expected_pos})
+      {
+        values->resize(number_of_joints);
+      }
+      zero_velocities.assign(number_of_joints, 0.0);
+      for (auto * joints :
+           {&limited_jnts_pos, &limited_jnts_vel, &limited_jnts_acc, &limited_jnts_dec})
+      {
+        joints->reserve(number_of_joints);
+      }
+    }
+
+    /// Resets the values to zero and clears the limited joints, without releasing the memory.
+    void clear()
+    {
+      for (auto * values : {&desired_pos, &desired_vel, &desired_acc, &expected_pos})
+      {
+        std::fill(values->begin(), values->end(), 0.0);
+      }
+      for (auto * joints :
+           {&limited_jnts_pos, &limited_jnts_vel, &limited_jnts_acc, &limited_jnts_dec})
+      {
+        joints->clear();
+      }
+    }
+  };
+
+  /**
+   * @brief Limits a single point with a valid time delta, without locking the mutex.
+   *
+   * Only implemented for trajectory_msgs::msg::JointTrajectoryPoint, see on_enforce().
+   */
+  bool limit_point(
+    const JointLimitsStateDataType & current_joint_states,
+    JointLimitsStateDataType & desired_joint_states, double dt_seconds);
+
   rclcpp::Clock::SharedPtr clock_;
   JointLimitsStateDataType prev_command_;
   std::mutex mutex_;
+  TrajectoryPointBuffers trajectory_point_buffers_;
 };
 
 template <typename JointLimitsStateDataType>
@@ -114,6 +190,17 @@ bool JointSaturationLimiter<JointLimitsStateDataType>::on_init()
 template <>
 bool JointSaturationLimiter<JointControlInterfacesData>::on_init();
 
+template <>
+bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::enforce_trajectory(
+  const trajectory_msgs::msg::JointTrajectoryPoint & current_joint_states,
+  std::vector<trajectory_msgs::msg::JointTrajectoryPoint> & trajectory_points, size_t first_point,
+  size_t number_of_points);
+
+template <>
+bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::limit_point(
+  const trajectory_msgs::msg::JointTrajectoryPoint & current_joint_states,
+  trajectory_msgs::msg::JointTrajectoryPoint & desired_joint_states, double dt_seconds);
+
 }  // namespace joint_limits
 
 #endif  // JOINT_LIMITS__JOINT_SATURATION_LIMITER_HPP_
@@ -0,0 +1,120 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef JOINT_LIMITS__JOINT_SOFT_BATCH_HPP_
+#define JOINT_LIMITS__JOINT_SOFT_BATCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "joint_limits/joint_limits.hpp"
+#include "joint_limits/joint_saturation_batch.hpp"
+
+namespace joint_limits
+{
+/**
+ * @brief Limits the commands of several joints at once, with the same hard and soft limits as
+ * JointSoftLimiter.
+ *
+ * The parts of the soft bounds that don't depend on the commands or on the period, i.e., the
+ * presence of the soft limits, the soft position range, the gains and the tolerance bounds, are
+ * resolved once at configuration into contiguous arrays. In enforce(), the soft velocity bounds of
+ * all the joints are computed in one pass, and every kind of command is then limited in a separate
+ * pass, so that the loops are simple enough to be auto-vectorized by the compiler. The limited
+ * commands are the same as the ones of a JointSoftLimiter per joint.
+ *
+ * Like JointSaturationBatch, the jerk is not limited and nothing is logged in enforce().
+ *
+ * @note enforce() doesn't allocate memory and is real-time safe, as long as the actual position of
+ * the joints is not out of bounds.
+ */
+class JointSoftBatch
+{
+public:
+  /**
+   * @brief Configures the limits of the joints and resets the previous commands.
+   * @param joint_names The names of the joints, used for the error messages.
+   * @param limits The hard limits of the joints, in the same order as the names.
+   * @param soft_limits The soft limits of the joints, in the same order as the names, or empty if
+   * none of the joints has soft limits.
+   * @return False if the number of limits doesn't match the number of joints.
+   */
+  bool configure(
+    const std::vector<std::string> & joint_names, const std::vector<JointLimits> & limits,
+    const std::vector<SoftJointLimits> & soft_limits);
+
+  /// Resets the previous commands, they are initialized again at the next enforce().
+  void reset();
+
+  /// Returns the number of configured joints.
+  std::size_t size() const { return joint_names_.size(); }
+
+  /**
+   * @brief Limits the desired commands of all the joints.
+   * @param actual The actual state of the joints.
+   * @param desired The desired commands of the joints, limited in place.
+   * @param dt The time step in seconds.
+   * @return True if any command was limited, false if dt is not positive or if the sizes of the
+   * data don't match the configured joints.
+   * @throws std::runtime_error if the actual position of a joint whose position is commanded is out
+   * of bounds.
+   */
+  bool enforce(const JointBatchData & actual, JointBatchData & desired, double dt);
+
+private:
+  std::vector<std::string> joint_names_;
+
+  // hard limits
+  std::vector<double> min_position_;
+  std::vector<double> max_position_;
+  std::vector<double> max_velocity_;
+  std::vector<double> max_acceleration_;
+  std::vector<double> max_deceleration_;
+  std::vector<double> max_effort_;
+
+  std::vector<std::uint8_t> has_position_limits_;
+  std::vector<std::uint8_t> has_velocity_limits_;
+  std::vector<std::uint8_t> has_acceleration_limits_;
+  std::vector<std::uint8_t> has_deceleration_limits_;
+  std::vector<std::uint8_t> has_effort_limits_;
+
+  // soft limits resolved at configuration
+  std::vector<double> soft_min_position_;
+  std::vector<double> soft_max_position_;
+  /// Soft position range limiting the position commands, infinite without soft position limits
+  std::vector<double> soft_lower_position_bound_;
+  std::vector<double> soft_upper_position_bound_;
+  /// Hard position limits extended by the position bounds tolerance
+  std::vector<double> lower_position_tolerance_bound_;
+  std::vector<double> upper_position_tolerance_bound_;
+  std::vector<double> negated_k_position_;
+  std::vector<double> negated_k_velocity_;
+  /// The velocity is limited by the soft position limits
+  std::vector<std::uint8_t> has_soft_velocity_bounds_;
+  /// The effort is limited by the soft velocity bounds
+  std::vector<std::uint8_t> has_soft_effort_bounds_;
+
+  // soft bounds computed at every enforce()
+  std::vector<double> position_reference_;
+  std::vector<double> soft_min_velocity_;
+  std::vector<double> soft_max_velocity_;
+
+  JointBatchData prev_command_;
+};
+
+}  // namespace joint_limits
+
+#endif  // JOINT_LIMITS__JOINT_SOFT_BATCH_HPP_
@@ -0,0 +1,212 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "joint_limits/joint_fast_saturation_limiter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+#include "joint_limits/joint_limits_helpers.hpp"
+
+namespace joint_limits
+{
+const std::array<JointFastSaturationLimiter::Kernel, JointFastSaturationLimiter::JERK>
+  JointFastSaturationLimiter::KERNELS =
+    JointFastSaturationLimiter::make_kernels(std::make_index_sequence<JERK>());
+
+bool JointFastSaturationLimiter::on_init()
+{
+  kernel_ = nullptr;
+  return JointSaturationLimiter<JointControlInterfacesData>::on_init();
+}
+
+bool JointFastSaturationLimiter::on_configure(
+  const JointControlInterfacesData & current_joint_states)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  prev_command_ = current_joint_states;
+  kernel_ = nullptr;
+  return true;
+}
+
+void JointFastSaturationLimiter::reset_internals()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  prev_command_ = JointControlInterfacesData();
+  kernel_ = nullptr;
+}
+
+bool JointFastSaturationLimiter::on_enforce(
+  const JointControlInterfacesData & actual, JointControlInterfacesData & desired,
+  const rclcpp::Duration & dt)
+{
+  const std::uint8_t mask = get_interface_mask(desired);
+  if (mask & JERK)
+  {
+    return JointSaturationLimiter<JointControlInterfacesData>::on_enforce(actual, desired, dt);
+  }
+
+  const auto dt_seconds = dt.seconds();
+  // negative or null is not allowed
+  if (dt_seconds <= 0.0)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (kernel_ == nullptr || mask != kernel_mask_)
+  {
+    kernel_ = KERNELS[mask];
+    kernel_mask_ = mask;
+  }
+  return (this->*kernel_)(actual, desired, dt_seconds);
+}
+
+template <bool HasPosition, bool HasVelocity, bool HasEffort, bool HasAcceleration>
+bool JointFastSaturationLimiter::enforce_kernel(
+  const JointControlInterfacesData & actual, JointControlInterfacesData & desired,
+  double dt_seconds)
+{
+  bool limits_enforced = false;
+  const auto & joint_limits = joint_limits_[0];
+  const auto & joint_name = joint_names_[0];
+
+  // The following conditional filling is needed for cases of having certain information missing
+  if (!prev_command_.has_data())
+  {
+    if constexpr (HasPosition)
+    {
+      if (actual.has_position())
+      {
+        prev_command_.position = actual.position;
+      }
+      else if (!std::isnan(*desired.position))
+      {
+        prev_command_.position = desired.position;
+      }
+    }
+    if constexpr (HasVelocity)
+    {
+      if (actual.has_velocity())
+      {
+        prev_command_.velocity = actual.velocity;
+      }
+      else if (!std::isnan(*desired.velocity))
+      {
+        prev_command_.velocity = desired.velocity;
+      }
+    }
+    if constexpr (HasEffort)
+    {
+      if (actual.has_effort())
+      {
+        prev_command_.effort = actual.effort;
+      }
+      else if (!std::isnan(*desired.effort))
+      {
+        prev_command_.effort = desired.effort;
+      }
+    }
+    if constexpr (HasAcceleration)
+    {
+      if (actual.has_acceleration())
+      {
+        prev_command_.acceleration = actual.acceleration;
+      }
+      else if (!std::isnan(*desired.acceleration))
+      {
+        prev_command_.acceleration = desired.acceleration;
+      }
+    }
+    if (actual.has_data())
+    {
+      prev_command_.joint_name = actual.joint_name;
+    }
+    else if (HasPosition || HasVelocity || HasEffort || HasAcceleration)
+    {
+      prev_command_.joint_name = desired.joint_name;
+    }
+  }
+
+  if constexpr (HasPosition)
+  {
+    double & position = *desired.position;
+    if (!std::isnan(position))
+    {
+      const auto limits = compute_position_limits(
+        joint_name, joint_limits, actual.velocity, actual.position, prev_command_.position,
+        dt_seconds);
+      limits_enforced = is_limited(position, limits.lower_limit, limits.upper_limit);
+      position = std::clamp(position, limits.lower_limit, limits.upper_limit);
+      prev_command_.position = position;
+    }
+  }
+
+  if constexpr (HasVelocity)
+  {
+    double & velocity = *desired.velocity;
+    if (!std::isnan(velocity))
+    {
+      const auto limits = compute_velocity_limits(
+        joint_name, joint_limits, velocity, actual.position, prev_command_.velocity, dt_seconds);
+      limits_enforced =
+        is_limited(velocity, limits.lower_limit, limits.upper_limit) || limits_enforced;
+      velocity = std::clamp(velocity, limits.lower_limit, limits.upper_limit);
+      prev_command_.velocity = velocity;
+    }
+  }
+
+  if constexpr (HasEffort)
+  {
+    double & effort = *desired.effort;
+    if (!std::isnan(effort))
+    {
+      const auto limits =
+        compute_effort_limits(joint_limits, actual.position, actual.velocity, dt_seconds);
+      limits_enforced =
+        is_limited(effort, limits.lower_limit, limits.upper_limit) || limits_enforced;
+      effort = std::clamp(effort, limits.lower_limit, limits.upper_limit);
+      prev_command_.effort = effort;
+    }
+  }
+
+  if constexpr (HasAcceleration)
+  {
+    double & acceleration = *desired.acceleration;
+    if (!std::isnan(acceleration))
+    {
+      const auto limits =
+        compute_acceleration_limits(joint_limits, acceleration, actual.velocity);
+      limits_enforced =
+        is_limited(acceleration, limits.lower_limit, limits.upper_limit) || limits_enforced;
+      acceleration = std::clamp(acceleration, limits.lower_limit, limits.upper_limit);
+      prev_command_.acceleration = acceleration;
+    }
+  }
+
+  // see update_prev_command()
+  prev_command_.joint_name = desired.joint_name;
+
+  return limits_enforced;
+}
+
+}  // namespace joint_limits
+
+#include "pluginlib/class_list_macros.hpp"
+
+typedef joint_limits::JointFastSaturationLimiter JointInterfacesFastSaturationLimiter;
+typedef joint_limits::JointLimiterInterface<joint_limits::JointControlInterfacesData>
+  JointInterfacesLimiterInterfaceBase;
+PLUGINLIB_EXPORT_CLASS(JointInterfacesFastSaturationLimiter, JointInterfacesLimiterInterfaceBase)
@@ -0,0 +1,335 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "joint_limits/joint_limiter_pipeline.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <optional>
+
+#include "joint_limits/joint_limits_helpers.hpp"
+#include "joint_limits/joint_soft_limiter.hpp"
+
+namespace joint_limits
+{
+namespace
+{
+bool has_soft_position_limits(const SoftJointLimits & soft_joint_limits)
+{
+  return std::isfinite(soft_joint_limits.min_position) &&
+         std::isfinite(soft_joint_limits.max_position) &&
+         (soft_joint_limits.max_position - soft_joint_limits.min_position) > VALUE_CONSIDERED_ZERO;
+}
+
+bool has_soft_limits(const SoftJointLimits & soft_joint_limits)
+{
+  return has_soft_position_limits(soft_joint_limits) &&
+         std::isfinite(soft_joint_limits.k_position) &&
+         std::abs(soft_joint_limits.k_position) > VALUE_CONSIDERED_ZERO;
+}
+
+/// Initializes the previous command of the commanded interfaces from the actual state
+void initialize_prev_command(
+  const JointControlInterfacesData & actual, const JointControlInterfacesData & desired,
+  JointControlInterfacesData & prev_command)
+{
+  const auto initialize = [](
+                            const std::optional<double> & actual_value,
+                            const std::optional<double> & desired_value,
+                            std::optional<double> & prev_value)
+  {
+    if (!desired_value.has_value())
+    {
+      return;
+    }
+    if (actual_value.has_value())
+    {
+      prev_value = actual_value;
+    }
+    else if (!std::isnan(desired_value.value()))
+    {
+      prev_value = desired_value;
+    }
+  };
+  initialize(actual.position, desired.position, prev_command.position);
+  initialize(actual.velocity, desired.velocity, prev_command.velocity);
+  initialize(actual.effort, desired.effort, prev_command.effort);
+  initialize(actual.acceleration, desired.acceleration, prev_command.acceleration);
+  initialize(actual.jerk, desired.jerk, prev_command.jerk);
+  if (actual.has_data())
+  {
+    prev_command.joint_name = actual.joint_name;
+  }
+  else if (desired.has_data())
+  {
+    prev_command.joint_name = desired.joint_name;
+  }
+}
+
+/// Clamps the commanded \p value between \p lower and \p upper and stores it as previous command
+bool clamp_command(
+  double & value, double lower, double upper, std::optional<double> & prev_value)
+{
+  const bool limited = is_limited(value, lower, upper);
+  value = std::clamp(value, lower, upper);
+  prev_value = value;
+  return limited;
+}
+}  // namespace
+
+JointLimiterPipeline::JointLimiterPipeline(std::uint8_t stages)
+: JointSaturationLimiter<JointControlInterfacesData>(), stages_(stages)
+{
+}
+
+bool JointLimiterPipeline::on_init()
+{
+  active_stages_ = stages_;
+  if (soft_joint_limits_.empty())
+  {
+    active_stages_ = static_cast<std::uint8_t>(active_stages_ & ~SOFT);
+  }
+  return JointSaturationLimiter<JointControlInterfacesData>::on_init();
+}
+
+std::string JointLimiterPipeline::get_stages_string(std::uint8_t stages)
+{
+  std::string stages_string;
+  for (const auto & [stage, name] :
+       {std::make_pair(RANGE, "range"), std::make_pair(VELOCITY, "velocity"),
+        std::make_pair(ACCELERATION, "acceleration"), std::make_pair(JERK, "jerk"),
+        std::make_pair(SOFT, "soft")})
+  {
+    if (stages & stage)
+    {
+      stages_string += stages_string.empty() ? name : std::string(" -> ") + name;
+    }
+  }
+  return stages_string.empty() ? "none" : stages_string;
+}
+
+bool JointLimiterPipeline::on_enforce(
+  const JointControlInterfacesData & actual, JointControlInterfacesData & desired,
+  const rclcpp::Duration & dt)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool limits_enforced = false;
+
+  const auto dt_seconds = dt.seconds();
+  // negative or null is not allowed
+  if (dt_seconds <= 0.0)
+  {
+    return false;
+  }
+
+  // the limits of the stages out of the pipeline are ignored
+  JointLimits limits = joint_limits_[0];
+  if (!(active_stages_ & RANGE))
+  {
+    limits.has_position_limits = false;
+    limits.has_effort_limits = false;
+    limits.min_position = -std::numeric_limits<double>::infinity();
+    limits.max_position = std::numeric_limits<double>::infinity();
+  }
+  if (!(active_stages_ & VELOCITY))
+  {
+    limits.has_velocity_limits = false;
+  }
+  if (!(active_stages_ & ACCELERATION))
+  {
+    limits.has_acceleration_limits = false;
+    limits.has_deceleration_limits = false;
+  }
+  const bool soft = (active_stages_ & SOFT) != 0u;
+  const SoftJointLimits soft_limits = soft ? soft_joint_limits_[0] : SoftJointLimits();
+  const std::string & joint_name = joint_names_[0];
+
+  if (!prev_command_.has_data())
+  {
+    initialize_prev_command(actual, desired, prev_command_);
+  }
+
+  // soft velocity bounds, from the previous position command and the soft position limits
+  double soft_min_vel = -std::numeric_limits<double>::infinity();
+  double soft_max_vel = std::numeric_limits<double>::infinity();
+  double prev_command_position = std::numeric_limits<double>::infinity();
+  if (soft)
+  {
+    const double act_position =
+      actual.has_position()
+        ? actual.position.value()
+        : ((prev_command_.has_position() && std::isfinite(prev_command_.position.value()))
+             ? prev_command_.position.value()
+             : std::numeric_limits<double>::infinity());
+    prev_command_position =
+      (prev_command_.has_position() && std::isfinite(prev_command_.position.value()))
+        ? prev_command_.position.value()
+        : (actual.has_position() ? actual.position.value()
+                                 : std::numeric_limits<double>::infinity());
+    if (limits.has_velocity_limits)
+    {
+      soft_min_vel = -limits.max_velocity;
+      soft_max_vel = limits.max_velocity;
+      if (
+        limits.has_position_limits && has_soft_limits(soft_limits) &&
+        std::isfinite(prev_command_position))
+      {
+        soft_min_vel = std::clamp(
+          -soft_limits.k_position * (prev_command_position - soft_limits.min_position),
+          -limits.max_velocity, limits.max_velocity);
+        soft_max_vel = std::clamp(
+          -soft_limits.k_position * (prev_command_position - soft_limits.max_position),
+          -limits.max_velocity, limits.max_velocity);
+        if (
+          std::isfinite(act_position) &&
+          ((act_position < (limits.min_position - internal::POSITION_BOUNDS_TOLERANCE)) ||
+           (act_position > (limits.max_position + internal::POSITION_BOUNDS_TOLERANCE))))
+        {
+          soft_min_vel = 0.0;
+          soft_max_vel = 0.0;
+        }
+        else if (
+          (act_position < soft_limits.min_position) || (act_position > soft_limits.max_position))
+        {
+          const double soft_limit_reach_velocity = 1.0 * (M_PI / 180.0);
+          soft_min_vel = std::copysign(soft_limit_reach_velocity, soft_min_vel);
+          soft_max_vel = std::copysign(soft_limit_reach_velocity, soft_max_vel);
+        }
+      }
+    }
+  }
+
+  if (desired.has_position() && !std::isnan(desired.position.value()))
+  {
+    const auto position_limits = compute_position_limits(
+      joint_name, limits, actual.velocity, actual.position, prev_command_.position, dt_seconds);
+    double pos_low = position_limits.lower_limit;
+    double pos_high = position_limits.upper_limit;
+    if (soft)
+    {
+      double soft_low = -std::numeric_limits<double>::infinity();
+      double soft_high = std::numeric_limits<double>::infinity();
+      if (has_soft_position_limits(soft_limits))
+      {
+        soft_low = soft_limits.min_position;
+        soft_high = soft_limits.max_position;
+      }
+      if (limits.has_velocity_limits && std::isfinite(prev_command_position))
+      {
+        soft_low =
+          std::clamp(prev_command_position + soft_min_vel * dt_seconds, soft_low, soft_high);
+        soft_high =
+          std::clamp(prev_command_position + soft_max_vel * dt_seconds, soft_low, soft_high);
+      }
+      // the soft bounds are kept if they don't overlap the hard ones, see JointSoftLimiter
+      pos_low = std::max(soft_low, position_limits.lower_limit);
+      pos_high = std::min(soft_high, position_limits.upper_limit);
+      if (pos_low > pos_high)
+      {
+        pos_low = soft_low;
+        pos_high = soft_high;
+      }
+    }
+    limits_enforced = clamp_command(*desired.position, pos_low, pos_high, prev_command_.position);
+  }
+
+  if (desired.has_velocity() && !std::isnan(desired.velocity.value()))
+  {
+    const auto velocity_limits = compute_velocity_limits(
+      joint_name, limits, desired.velocity.value(), actual.position, prev_command_.velocity,
+      dt_seconds);
+    double vel_low = velocity_limits.lower_limit;
+    double vel_high = velocity_limits.upper_limit;
+    if (soft)
+    {
+      if (limits.has_velocity_limits && limits.has_acceleration_limits && actual.has_velocity())
+      {
+        soft_min_vel =
+          std::max(actual.velocity.value() - limits.max_acceleration * dt_seconds, soft_min_vel);
+        soft_max_vel =
+          std::min(actual.velocity.value() + limits.max_acceleration * dt_seconds, soft_max_vel);
+      }
+      soft_min_vel = std::max(soft_min_vel, vel_low);
+      soft_max_vel = std::min(soft_max_vel, vel_high);
+      vel_low = soft_min_vel;
+      vel_high = soft_max_vel;
+    }
+    limits_enforced =
+      clamp_command(*desired.velocity, vel_low, vel_high, prev_command_.velocity) ||
+      limits_enforced;
+  }
+
+  if (desired.has_effort() && !std::isnan(desired.effort.value()))
+  {
+    const auto effort_limits =
+      compute_effort_limits(limits, actual.position, actual.velocity, dt_seconds);
+    double eff_low = effort_limits.lower_limit;
+    double eff_high = effort_limits.upper_limit;
+    if (
+      soft && limits.has_effort_limits && std::isfinite(soft_limits.k_velocity) &&
+      actual.has_velocity())
+    {
+      eff_low = std::clamp(
+        -soft_limits.k_velocity * (actual.velocity.value() - soft_min_vel), -limits.max_effort,
+        limits.max_effort);
+      eff_high = std::clamp(
+        -soft_limits.k_velocity * (actual.velocity.value() - soft_max_vel), -limits.max_effort,
+        limits.max_effort);
+      eff_low = std::max(eff_low, effort_limits.lower_limit);
+      eff_high = std::min(eff_high, effort_limits.upper_limit);
+    }
+    limits_enforced =
+      clamp_command(*desired.effort, eff_low, eff_high, prev_command_.effort) || limits_enforced;
+  }
+
+  if (desired.has_acceleration() && !std::isnan(desired.acceleration.value()))
+  {
+    const auto acceleration_limits =
+      compute_acceleration_limits(limits, desired.acceleration.value(), actual.velocity);
+    limits_enforced = clamp_command(
+                        *desired.acceleration, acceleration_limits.lower_limit,
+                        acceleration_limits.upper_limit, prev_command_.acceleration) ||
+                      limits_enforced;
+  }
+
+  if (desired.has_jerk() && !std::isnan(desired.jerk.value()))
+  {
+    if (active_stages_ & JERK)
+    {
+      limits_enforced =
+        clamp_command(*desired.jerk, -limits.max_jerk, limits.max_jerk, prev_command_.jerk) ||
+        limits_enforced;
+    }
+    else
+    {
+      prev_command_.jerk = desired.jerk;
+    }
+  }
+
+  // see update_prev_command()
+  prev_command_.joint_name = desired.joint_name;
+
+  return limits_enforced;
+}
+
+}  // namespace joint_limits
+
+#include "pluginlib/class_list_macros.hpp"
+
+typedef joint_limits::JointLimiterPipeline JointInterfacesLimiterPipeline;
+typedef joint_limits::JointLimiterInterface<joint_limits::JointControlInterfacesData>
+  JointInterfacesLimiterInterfaceBase;
+PLUGINLIB_EXPORT_CLASS(JointInterfacesLimiterPipeline, JointInterfacesLimiterInterfaceBase)
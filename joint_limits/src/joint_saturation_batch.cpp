@@ -0,0 +1,358 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "joint_limits/joint_saturation_batch.hpp"
+
+#include <fmt/compile.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "joint_limits/joint_limits_helpers.hpp"
+
+namespace joint_limits
+{
+namespace
+{
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+/// Same as internal::check_and_swap_limits, without a function call in the kernels.
+inline void order_limits(double & lower_limit, double & upper_limit)
+{
+  if (lower_limit > upper_limit)
+  {
+    std::swap(lower_limit, upper_limit);
+  }
+}
+
+/// Clamps the value and returns true if it was limited, like is_limited() and std::clamp.
+inline bool clamp_value(double & value, double lower_limit, double upper_limit)
+{
+  const bool limited = value < lower_limit || value > upper_limit;
+  value = std::clamp(value, lower_limit, upper_limit);
+  return limited;
+}
+}  // namespace
+
+void JointBatchData::resize(std::size_t number_of_joints)
+{
+  position.resize(number_of_joints, 0.0);
+  velocity.resize(number_of_joints, 0.0);
+  effort.resize(number_of_joints, 0.0);
+  acceleration.resize(number_of_joints, 0.0);
+  has_position.resize(number_of_joints, 0u);
+  has_velocity.resize(number_of_joints, 0u);
+  has_effort.resize(number_of_joints, 0u);
+  has_acceleration.resize(number_of_joints, 0u);
+}
+
+bool JointSaturationBatch::configure(
+  const std::vector<std::string> & joint_names, const std::vector<JointLimits> & limits)
+{
+  if (joint_names.size() != limits.size())
+  {
+    return false;
+  }
+  joint_names_ = joint_names;
+  const std::size_t number_of_joints = limits.size();
+  for (auto * values : {&min_position_, &max_position_, &max_velocity_, &max_acceleration_,
+                        &max_deceleration_, &max_effort_})
+  {
+    values->resize(number_of_joints);
+  }
+  for (auto * flags : {&has_position_limits_, &has_velocity_limits_, &has_acceleration_limits_,
+                       &has_deceleration_limits_, &has_effort_limits_})
+  {
+    flags->resize(number_of_joints);
+  }
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    min_position_[i] = limits[i].min_position;
+    max_position_[i] = limits[i].max_position;
+    max_velocity_[i] = limits[i].max_velocity;
+    max_acceleration_[i] = limits[i].max_acceleration;
+    max_deceleration_[i] = limits[i].max_deceleration;
+    max_effort_[i] = limits[i].max_effort;
+    has_position_limits_[i] = limits[i].has_position_limits;
+    has_velocity_limits_[i] = limits[i].has_velocity_limits;
+    has_acceleration_limits_[i] = limits[i].has_acceleration_limits;
+    has_deceleration_limits_[i] = limits[i].has_deceleration_limits;
+    has_effort_limits_[i] = limits[i].has_effort_limits;
+  }
+  prev_command_ = JointBatchData();
+  prev_command_.resize(number_of_joints);
+  return true;
+}
+
+void JointSaturationBatch::reset()
+{
+  for (auto * flags : {&prev_command_.has_position, &prev_command_.has_velocity,
+                       &prev_command_.has_effort, &prev_command_.has_acceleration})
+  {
+    std::fill(flags->begin(), flags->end(), 0u);
+  }
+}
+
+namespace internal
+{
+void initialize_prev_command(
+  const JointBatchData & actual, const JointBatchData & desired, JointBatchData & prev_command)
+{
+  auto initialize = [](
+                      std::size_t i, const std::vector<double> & actual_values,
+                      const std::vector<std::uint8_t> & actual_valid,
+                      const std::vector<double> & desired_values,
+                      const std::vector<std::uint8_t> & desired_valid,
+                      std::vector<double> & prev_values, std::vector<std::uint8_t> & prev_valid)
+  {
+    if (!desired_valid[i])
+    {
+      return;
+    }
+    if (actual_valid[i])
+    {
+      prev_values[i] = actual_values[i];
+      prev_valid[i] = 1u;
+    }
+    else if (!std::isnan(desired_values[i]))
+    {
+      prev_values[i] = desired_values[i];
+      prev_valid[i] = 1u;
+    }
+  };
+  auto & prev = prev_command;
+  for (std::size_t i = 0; i < prev.size(); ++i)
+  {
+    if (prev.has_position[i] || prev.has_velocity[i] || prev.has_effort[i] ||
+        prev.has_acceleration[i])
+    {
+      continue;
+    }
+    initialize(
+      i, actual.position, actual.has_position, desired.position, desired.has_position,
+      prev.position, prev.has_position);
+    initialize(
+      i, actual.velocity, actual.has_velocity, desired.velocity, desired.has_velocity,
+      prev.velocity, prev.has_velocity);
+    initialize(
+      i, actual.effort, actual.has_effort, desired.effort, desired.has_effort, prev.effort,
+      prev.has_effort);
+    initialize(
+      i, actual.acceleration, actual.has_acceleration, desired.acceleration,
+      desired.has_acceleration, prev.acceleration, prev.has_acceleration);
+  }
+}
+
+void update_prev_command(const JointBatchData & desired, JointBatchData & prev_command)
+{
+  auto update_prev = [](
+                       const std::vector<double> & values, const std::vector<std::uint8_t> & valid,
+                       std::vector<double> & prev_values, std::vector<std::uint8_t> & prev_valid)
+  {
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      if (valid[i] && !std::isnan(values[i]))
+      {
+        prev_values[i] = values[i];
+        prev_valid[i] = 1u;
+      }
+    }
+  };
+  auto & prev = prev_command;
+  update_prev(desired.position, desired.has_position, prev.position, prev.has_position);
+  update_prev(desired.velocity, desired.has_velocity, prev.velocity, prev.has_velocity);
+  update_prev(desired.effort, desired.has_effort, prev.effort, prev.has_effort);
+  update_prev(
+    desired.acceleration, desired.has_acceleration, prev.acceleration, prev.has_acceleration);
+}
+
+void verify_actual_positions(
+  const std::vector<std::string> & joint_names, const std::vector<double> & min_position,
+  const std::vector<double> & max_position, const std::vector<std::uint8_t> & has_position_limits,
+  const JointBatchData & actual, const JointBatchData & desired)
+{
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    if (
+      desired.has_position[i] && !std::isnan(desired.position[i]) && actual.has_position[i] &&
+      has_position_limits[i] &&
+      (actual.position[i] > (max_position[i] + OUT_OF_BOUNDS_EXCEPTION_TOLERANCE) ||
+       actual.position[i] < (min_position[i] - OUT_OF_BOUNDS_EXCEPTION_TOLERANCE)))
+    {
+      throw std::runtime_error(fmt::format(
+        FMT_COMPILE(
+          "Joint position is out of bounds for the joint : '{}' actual position: {} limits: [{}, "
+          "{}]."),
+        joint_names[i], actual.position[i], min_position[i], max_position[i]));
+    }
+  }
+}
+}  // namespace internal
+
+bool JointSaturationBatch::enforce(
+  const JointBatchData & actual, JointBatchData & desired, double dt)
+{
+  const std::size_t number_of_joints = size();
+  // negative or null is not allowed
+  if (dt <= 0.0 || actual.size() != number_of_joints || desired.size() != number_of_joints)
+  {
+    return false;
+  }
+  internal::initialize_prev_command(actual, desired, prev_command_);
+  internal::verify_actual_positions(
+    joint_names_, min_position_, max_position_, has_position_limits_, actual, desired);
+
+  auto & prev = prev_command_;
+  bool limits_enforced = false;
+
+  // position, see compute_position_limits()
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    double lower_limit = min_position_[i];
+    double upper_limit = max_position_[i];
+    const bool has_reference = prev.has_position[i] || actual.has_position[i];
+    if (has_velocity_limits_[i] && has_reference)
+    {
+      const double act_vel_abs = actual.has_velocity[i] ? std::fabs(actual.velocity[i]) : 0.0;
+      const double delta_vel = has_acceleration_limits_[i]
+                                 ? act_vel_abs + (max_acceleration_[i] * dt)
+                                 : max_velocity_[i];
+      const double delta_pos = std::min(max_velocity_[i], delta_vel) * dt;
+      // the previous command is preferred over the actual position
+      const double reference = prev.has_position[i] ? prev.position[i] : actual.position[i];
+      lower_limit = std::max(std::min(reference - delta_pos, upper_limit), lower_limit);
+      upper_limit = std::min(std::max(reference + delta_pos, lower_limit), upper_limit);
+    }
+    order_limits(lower_limit, upper_limit);
+    if (desired.has_position[i] && !std::isnan(desired.position[i]))
+    {
+      limits_enforced |= clamp_value(desired.position[i], lower_limit, upper_limit);
+    }
+  }
+
+  // velocity, see compute_velocity_limits()
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    if (!has_velocity_limits_[i] || !desired.has_velocity[i] || std::isnan(desired.velocity[i]))
+    {
+      continue;
+    }
+    const double desired_vel = desired.velocity[i];
+    double lower_limit = -max_velocity_[i];
+    double upper_limit = max_velocity_[i];
+    if (has_position_limits_[i] && actual.has_position[i])
+    {
+      const double actual_pos = actual.position[i];
+      const double max_pos = max_position_[i];
+      const double min_pos = min_position_[i];
+      lower_limit = std::max((min_pos - actual_pos) / dt, lower_limit);
+      upper_limit = std::min((max_pos - actual_pos) / dt, upper_limit);
+      const bool moving_into_bounds =
+        (actual_pos < (max_pos + internal::POSITION_BOUNDS_TOLERANCE) && actual_pos > min_pos &&
+         desired_vel >= 0.0) ||
+        (actual_pos > (min_pos - internal::POSITION_BOUNDS_TOLERANCE) && actual_pos < max_pos &&
+         desired_vel <= 0.0);
+      const bool far_out_of_bounds =
+        actual_pos > (max_pos + internal::POSITION_BOUNDS_TOLERANCE) ||
+        actual_pos < (min_pos - internal::POSITION_BOUNDS_TOLERANCE);
+      if (
+        (actual_pos > max_pos || actual_pos < min_pos) && (moving_into_bounds || far_out_of_bounds))
+      {
+        lower_limit = 0.0;
+        upper_limit = 0.0;
+      }
+    }
+    if (has_acceleration_limits_[i] && prev.has_velocity[i])
+    {
+      const double delta_vel = max_acceleration_[i] * dt;
+      lower_limit = std::max(prev.velocity[i] - delta_vel, lower_limit);
+      upper_limit = std::min(prev.velocity[i] + delta_vel, upper_limit);
+    }
+    order_limits(lower_limit, upper_limit);
+    limits_enforced |= clamp_value(desired.velocity[i], lower_limit, upper_limit);
+  }
+
+  // effort, see compute_effort_limits()
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    if (!has_effort_limits_[i] || !desired.has_effort[i] || std::isnan(desired.effort[i]))
+    {
+      continue;
+    }
+    double lower_limit = -max_effort_[i];
+    double upper_limit = max_effort_[i];
+    if (has_position_limits_[i] && actual.has_position[i] && actual.has_velocity[i])
+    {
+      if (actual.position[i] <= min_position_[i] && actual.velocity[i] <= 0.0)
+      {
+        lower_limit = 0.0;
+      }
+      else if (actual.position[i] >= max_position_[i] && actual.velocity[i] >= 0.0)
+      {
+        upper_limit = 0.0;
+      }
+    }
+    if (has_velocity_limits_[i] && actual.has_velocity[i])
+    {
+      if (actual.velocity[i] < -max_velocity_[i])
+      {
+        lower_limit = 0.0;
+      }
+      else if (actual.velocity[i] > max_velocity_[i])
+      {
+        upper_limit = 0.0;
+      }
+    }
+    order_limits(lower_limit, upper_limit);
+    limits_enforced |= clamp_value(desired.effort[i], lower_limit, upper_limit);
+  }
+
+  // acceleration, see compute_acceleration_limits()
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    if (!desired.has_acceleration[i] || std::isnan(desired.acceleration[i]))
+    {
+      continue;
+    }
+    const double desired_acc = desired.acceleration[i];
+    const bool decelerating =
+      actual.has_velocity[i] && ((desired_acc < 0 && actual.velocity[i] > 0) ||
+                                 (desired_acc > 0 && actual.velocity[i] < 0));
+    double lower_limit = -INF;
+    double upper_limit = INF;
+    if (has_deceleration_limits_[i] && decelerating)
+    {
+      lower_limit = -max_deceleration_[i];
+      upper_limit = max_deceleration_[i];
+    }
+    else if (has_acceleration_limits_[i])
+    {
+      lower_limit = -max_acceleration_[i];
+      upper_limit = max_acceleration_[i];
+    }
+    order_limits(lower_limit, upper_limit);
+    limits_enforced |= clamp_value(desired.acceleration[i], lower_limit, upper_limit);
+  }
+
+  internal::update_prev_command(desired, prev);
+
+  return limits_enforced;
+}
+
+}  // namespace joint_limits
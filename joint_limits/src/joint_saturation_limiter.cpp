@@ -31,14 +31,56 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
   trajectory_msgs::msg::JointTrajectoryPoint & desired_joint_states, const rclcpp::Duration & dt)
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  bool limits_enforced = false;
-
   const auto dt_seconds = dt.seconds();
   // negative or null is not allowed
   if (dt_seconds <= 0.0)
   {
     return false;
   }
+  return limit_point(current_joint_states, desired_joint_states, dt_seconds);
+}
+
+template <>
+bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::enforce_trajectory(
+  const trajectory_msgs::msg::JointTrajectoryPoint & current_joint_states,
+  std::vector<trajectory_msgs::msg::JointTrajectoryPoint> & trajectory_points,
+  size_t first_point, size_t number_of_points)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (first_point >= trajectory_points.size())
+  {
+    return false;
+  }
+  read_updated_limits();
+  bool limits_enforced = false;
+
+  const size_t end_point =
+    first_point + std::min(number_of_points, trajectory_points.size() - first_point);
+  for (size_t point = first_point; point < end_point; ++point)
+  {
+    // every point is limited from the previous one, already limited
+    const auto & previous_point =
+      (point == first_point) ? current_joint_states : trajectory_points[point - 1];
+    const double dt_seconds = (rclcpp::Duration(trajectory_points[point].time_from_start) -
+                               rclcpp::Duration(previous_point.time_from_start))
+                                .seconds();
+    // negative or null is not allowed, the point is left untouched
+    if (dt_seconds <= 0.0)
+    {
+      continue;
+    }
+    limits_enforced =
+      limit_point(previous_point, trajectory_points[point], dt_seconds) || limits_enforced;
+  }
+  return limits_enforced;
+}
+
+template <>
+bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::limit_point(
+  const trajectory_msgs::msg::JointTrajectoryPoint & current_joint_states,
+  trajectory_msgs::msg::JointTrajectoryPoint & desired_joint_states, double dt_seconds)
+{
+  bool limits_enforced = false;
 
   // TODO(gwalck) compute if the max are not implicitly violated with the given dt
   // e.g. for max vel 2.0 and max acc 5.0, with dt >0.4
@@ -57,20 +99,28 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
   {
     return false;
   }
+
+  // the buffers are members, only allocated when the number of joints changes
+  auto & limiting_buffers = trajectory_point_buffers_;
+  if (limiting_buffers.zero_velocities.size() != number_of_joints_)
+  {
+    limiting_buffers.resize(number_of_joints_);
+  }
+  limiting_buffers.clear();
   const std::vector<double> & current_joint_velocities =
-    has_current_velocity ? current_joint_states.velocities
-                         : std::vector<double>(number_of_joints_, 0.0);
+    has_current_velocity ? current_joint_states.velocities : limiting_buffers.zero_velocities;
 
-  // TODO(destogl): please check if we get too much malloc from this initialization,
-  // if so then we should use members instead local variables and initialize them in other method
-  std::vector<double> desired_pos(number_of_joints_);
-  std::vector<double> desired_vel(number_of_joints_);
-  std::vector<double> desired_acc(number_of_joints_);
-  std::vector<double> expected_vel(number_of_joints_);
-  std::vector<double> expected_pos(number_of_joints_);
+  // every value is set before being used
+  std::vector<double> & desired_pos = limiting_buffers.desired_pos;
+  std::vector<double> & desired_vel = limiting_buffers.desired_vel;
+  std::vector<double> & desired_acc = limiting_buffers.desired_acc;
+  std::vector<double> & expected_pos = limiting_buffers.expected_pos;
 
-  // limits triggered
-  std::vector<std::string> limited_jnts_pos, limited_jnts_vel, limited_jnts_acc, limited_jnts_dec;
+  // indices of the joints whose limits were triggered
+  std::vector<size_t> & limited_jnts_pos = limiting_buffers.limited_jnts_pos;
+  std::vector<size_t> & limited_jnts_vel = limiting_buffers.limited_jnts_vel;
+  std::vector<size_t> & limited_jnts_acc = limiting_buffers.limited_jnts_acc;
+  std::vector<size_t> & limited_jnts_dec = limiting_buffers.limited_jnts_dec;
 
   bool braking_near_position_limit_triggered = false;
 
@@ -100,7 +150,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
         if (pos != desired_pos[index])
         {
           desired_pos[index] = pos;
-          limited_jnts_pos.emplace_back(joint_names_[index]);
+          limited_jnts_pos.emplace_back(index);
           limits_enforced = true;
         }
       }
@@ -129,7 +179,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
       if (std::fabs(desired_vel[index]) > joint_limits_[index].max_velocity)
       {
         desired_vel[index] = std::copysign(joint_limits_[index].max_velocity, desired_vel[index]);
-        limited_jnts_vel.emplace_back(joint_names_[index]);
+        limited_jnts_vel.emplace_back(index);
         limits_enforced = true;
 
         // recompute pos_cmd if needed
@@ -153,12 +203,12 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
         // limiting acc or dec function
         auto apply_acc_or_dec_limit = [&](
                                         const double max_acc_or_dec, std::vector<double> & acc,
-                                        std::vector<std::string> & limited_jnts) -> bool
+                                        std::vector<size_t> & limited_jnts) -> bool
         {
           if (std::fabs(acc[index]) > max_acc_or_dec)
           {
             acc[index] = std::copysign(max_acc_or_dec, acc[index]);
-            limited_jnts.emplace_back(joint_names_[index]);
+            limited_jnts.emplace_back(index);
             limits_enforced = true;
             return true;
           }
@@ -236,7 +286,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
           // zero)
           desired_vel[index] =
             (expected_pos[index] - current_joint_states.positions[index]) / dt_seconds;
-          limited_jnts_pos.emplace_back(joint_names_[index]);
+          limited_jnts_pos.emplace_back(index);
           limits_enforced = true;
         }
       }
@@ -275,7 +325,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
          (joint_limits_[index].max_position - current_joint_states.positions[index] <
           stopping_distance)))
       {
-        limited_jnts_pos.emplace_back(joint_names_[index]);
+        limited_jnts_pos.emplace_back(index);
         braking_near_position_limit_triggered = true;
         limits_enforced = true;
       }
@@ -293,7 +343,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
            (joint_limits_[index].max_position - current_joint_states.positions[index] <
             motion_after_stopping_duration)))
         {
-          limited_jnts_pos.emplace_back(joint_names_[index]);
+          limited_jnts_pos.emplace_back(index);
           braking_near_position_limit_triggered = true;
           limits_enforced = true;
         }
@@ -340,7 +390,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
     std::ostringstream ostr;
     for (auto jnt : limited_jnts_pos)
     {
-      ostr << jnt << " ";
+      ostr << joint_names_[jnt] << " ";
     }
     ostr << "\b \b";  // erase last character
     RCLCPP_WARN_STREAM_THROTTLE(
@@ -358,7 +408,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
     std::ostringstream ostr;
     for (auto jnt : limited_jnts_pos)
     {
-      ostr << jnt << " ";
+      ostr << joint_names_[jnt] << " ";
     }
     ostr << "\b \b";  // erase last character
     RCLCPP_WARN_STREAM_THROTTLE(
@@ -371,7 +421,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
     std::ostringstream ostr;
     for (auto jnt : limited_jnts_vel)
     {
-      ostr << jnt << " ";
+      ostr << joint_names_[jnt] << " ";
     }
     ostr << "\b \b";  // erase last character
     RCLCPP_WARN_STREAM_THROTTLE(
@@ -384,7 +434,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
     std::ostringstream ostr;
     for (auto jnt : limited_jnts_acc)
     {
-      ostr << jnt << " ";
+      ostr << joint_names_[jnt] << " ";
     }
     ostr << "\b \b";  // erase last character
     RCLCPP_WARN_STREAM_THROTTLE(
@@ -397,7 +447,7 @@ bool JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>::on_enfo
     std::ostringstream ostr;
     for (auto jnt : limited_jnts_dec)
     {
-      ostr << jnt << " ";
+      ostr << joint_names_[jnt] << " ";
     }
     ostr << "\b \b";  // erase last character
     RCLCPP_WARN_STREAM_THROTTLE(
@@ -0,0 +1,379 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif
+#include "joint_limits/joint_soft_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "joint_limits/joint_limits_helpers.hpp"
+
+namespace joint_limits
+{
+namespace
+{
+constexpr double INF = std::numeric_limits<double>::infinity();
+/// Same as VALUE_CONSIDERED_ZERO of the JointSoftLimiter
+constexpr double SOFT_LIMITS_CONSIDERED_ZERO = 1e-10;
+/// Velocity towards the soft limits of a joint beyond them, see JointSoftLimiter
+constexpr double SOFT_LIMIT_REACH_VELOCITY = 1.0 * (M_PI / 180.0);
+
+/// Same as internal::check_and_swap_limits, without a function call in the kernels.
+inline void order_limits(double & lower_limit, double & upper_limit)
+{
+  if (lower_limit > upper_limit)
+  {
+    std::swap(lower_limit, upper_limit);
+  }
+}
+
+/// Clamps the value and returns true if it was limited, like is_limited() and std::clamp.
+inline bool clamp_value(double & value, double lower_limit, double upper_limit)
+{
+  const bool limited = value < lower_limit || value > upper_limit;
+  value = std::clamp(value, lower_limit, upper_limit);
+  return limited;
+}
+
+/// See JointSoftLimiter::has_soft_position_limits
+bool has_soft_position_limits(const SoftJointLimits & soft_limits)
+{
+  return std::isfinite(soft_limits.min_position) && std::isfinite(soft_limits.max_position) &&
+         (soft_limits.max_position - soft_limits.min_position) > SOFT_LIMITS_CONSIDERED_ZERO;
+}
+
+/// See JointSoftLimiter::has_soft_limits
+bool has_soft_limits(const SoftJointLimits & soft_limits)
+{
+  return has_soft_position_limits(soft_limits) && std::isfinite(soft_limits.k_position) &&
+         std::abs(soft_limits.k_position) > SOFT_LIMITS_CONSIDERED_ZERO;
+}
+}  // namespace
+
+bool JointSoftBatch::configure(
+  const std::vector<std::string> & joint_names, const std::vector<JointLimits> & limits,
+  const std::vector<SoftJointLimits> & soft_limits)
+{
+  if (
+    joint_names.size() != limits.size() ||
+    (!soft_limits.empty() && soft_limits.size() != limits.size()))
+  {
+    return false;
+  }
+  joint_names_ = joint_names;
+  const std::size_t number_of_joints = limits.size();
+  for (auto * values :
+       {&min_position_, &max_position_, &max_velocity_, &max_acceleration_, &max_deceleration_,
+        &max_effort_, &soft_min_position_, &soft_max_position_, &soft_lower_position_bound_,
+        &soft_upper_position_bound_, &lower_position_tolerance_bound_,
+        &upper_position_tolerance_bound_, &negated_k_position_, &negated_k_velocity_,
+        &position_reference_, &soft_min_velocity_, &soft_max_velocity_})
+  {
+    values->resize(number_of_joints);
+  }
+  for (auto * flags :
+       {&has_position_limits_, &has_velocity_limits_, &has_acceleration_limits_,
+        &has_deceleration_limits_, &has_effort_limits_, &has_soft_velocity_bounds_,
+        &has_soft_effort_bounds_})
+  {
+    flags->resize(number_of_joints);
+  }
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    const auto & hard = limits[i];
+    const SoftJointLimits soft = soft_limits.empty() ? SoftJointLimits() : soft_limits[i];
+    min_position_[i] = hard.min_position;
+    max_position_[i] = hard.max_position;
+    max_velocity_[i] = hard.max_velocity;
+    max_acceleration_[i] = hard.max_acceleration;
+    max_deceleration_[i] = hard.max_deceleration;
+    max_effort_[i] = hard.max_effort;
+    has_position_limits_[i] = hard.has_position_limits;
+    has_velocity_limits_[i] = hard.has_velocity_limits;
+    has_acceleration_limits_[i] = hard.has_acceleration_limits;
+    has_deceleration_limits_[i] = hard.has_deceleration_limits;
+    has_effort_limits_[i] = hard.has_effort_limits;
+
+    soft_min_position_[i] = soft.min_position;
+    soft_max_position_[i] = soft.max_position;
+    const bool soft_position_limits = has_soft_position_limits(soft);
+    soft_lower_position_bound_[i] = soft_position_limits ? soft.min_position : -INF;
+    soft_upper_position_bound_[i] = soft_position_limits ? soft.max_position : INF;
+    lower_position_tolerance_bound_[i] = hard.min_position - internal::POSITION_BOUNDS_TOLERANCE;
+    upper_position_tolerance_bound_[i] = hard.max_position + internal::POSITION_BOUNDS_TOLERANCE;
+    negated_k_position_[i] = -soft.k_position;
+    negated_k_velocity_[i] = -soft.k_velocity;
+    has_soft_velocity_bounds_[i] =
+      hard.has_velocity_limits && hard.has_position_limits && has_soft_limits(soft);
+    has_soft_effort_bounds_[i] = hard.has_effort_limits && std::isfinite(soft.k_velocity);
+  }
+  prev_command_ = JointBatchData();
+  prev_command_.resize(number_of_joints);
+  return true;
+}
+
+void JointSoftBatch::reset()
+{
+  for (auto * flags : {&prev_command_.has_position, &prev_command_.has_velocity,
+                       &prev_command_.has_effort, &prev_command_.has_acceleration})
+  {
+    std::fill(flags->begin(), flags->end(), 0u);
+  }
+}
+
+bool JointSoftBatch::enforce(const JointBatchData & actual, JointBatchData & desired, double dt)
+{
+  const std::size_t number_of_joints = size();
+  // negative or null is not allowed
+  if (dt <= 0.0 || actual.size() != number_of_joints || desired.size() != number_of_joints)
+  {
+    return false;
+  }
+  internal::initialize_prev_command(actual, desired, prev_command_);
+  internal::verify_actual_positions(
+    joint_names_, min_position_, max_position_, has_position_limits_, actual, desired);
+
+  auto & prev = prev_command_;
+  bool limits_enforced = false;
+
+  // soft velocity bounds from the distance of the previous command to the soft position limits
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    const bool has_prev_position = prev.has_position[i] && std::isfinite(prev.position[i]);
+    const double act_position = actual.has_position[i]
+                                  ? actual.position[i]
+                                  : (has_prev_position ? prev.position[i] : INF);
+    const double reference = has_prev_position
+                               ? prev.position[i]
+                               : (actual.has_position[i] ? actual.position[i] : INF);
+    position_reference_[i] = reference;
+    double soft_min_vel = -INF;
+    double soft_max_vel = INF;
+    if (has_velocity_limits_[i])
+    {
+      const double max_vel = max_velocity_[i];
+      soft_min_vel = -max_vel;
+      soft_max_vel = max_vel;
+      if (has_soft_velocity_bounds_[i] && std::isfinite(reference))
+      {
+        soft_min_vel = std::clamp(
+          negated_k_position_[i] * (reference - soft_min_position_[i]), -max_vel, max_vel);
+        soft_max_vel = std::clamp(
+          negated_k_position_[i] * (reference - soft_max_position_[i]), -max_vel, max_vel);
+        if (
+          std::isfinite(act_position) && ((act_position < lower_position_tolerance_bound_[i]) ||
+                                          (act_position > upper_position_tolerance_bound_[i])))
+        {
+          soft_min_vel = 0.0;
+          soft_max_vel = 0.0;
+        }
+        else if (
+          (act_position < soft_min_position_[i]) || (act_position > soft_max_position_[i]))
+        {
+          soft_min_vel = std::copysign(SOFT_LIMIT_REACH_VELOCITY, soft_min_vel);
+          soft_max_vel = std::copysign(SOFT_LIMIT_REACH_VELOCITY, soft_max_vel);
+        }
+      }
+    }
+    soft_min_velocity_[i] = soft_min_vel;
+    soft_max_velocity_[i] = soft_max_vel;
+  }
+
+  // position, see compute_position_limits()
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    if (!desired.has_position[i] || std::isnan(desired.position[i]))
+    {
+      continue;
+    }
+    double lower_limit = min_position_[i];
+    double upper_limit = max_position_[i];
+    if (has_velocity_limits_[i] && (prev.has_position[i] || actual.has_position[i]))
+    {
+      const double act_vel_abs = actual.has_velocity[i] ? std::fabs(actual.velocity[i]) : 0.0;
+      const double delta_vel = has_acceleration_limits_[i]
+                                 ? act_vel_abs + (max_acceleration_[i] * dt)
+                                 : max_velocity_[i];
+      const double delta_pos = std::min(max_velocity_[i], delta_vel) * dt;
+      // the previous command is preferred over the actual position
+      const double hard_reference = prev.has_position[i] ? prev.position[i] : actual.position[i];
+      lower_limit = std::max(std::min(hard_reference - delta_pos, upper_limit), lower_limit);
+      upper_limit = std::min(std::max(hard_reference + delta_pos, lower_limit), upper_limit);
+    }
+    order_limits(lower_limit, upper_limit);
+
+    double pos_low = soft_lower_position_bound_[i];
+    double pos_high = soft_upper_position_bound_[i];
+    const double reference = position_reference_[i];
+    if (has_velocity_limits_[i] && std::isfinite(reference))
+    {
+      pos_low = std::clamp(reference + soft_min_velocity_[i] * dt, pos_low, pos_high);
+      pos_high = std::clamp(reference + soft_max_velocity_[i] * dt, pos_low, pos_high);
+    }
+    // the soft bounds are kept if they don't overlap with the hard ones, see JointSoftLimiter
+    const double vel_clamped_pos_low = pos_low;
+    const double vel_clamped_pos_high = pos_high;
+    pos_low = std::max(pos_low, lower_limit);
+    pos_high = std::min(pos_high, upper_limit);
+    if (pos_low > pos_high)
+    {
+      pos_low = vel_clamped_pos_low;
+      pos_high = vel_clamped_pos_high;
+    }
+    limits_enforced |= clamp_value(desired.position[i], pos_low, pos_high);
+  }
+
+  // velocity, see compute_velocity_limits()
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    if (!has_velocity_limits_[i] || !desired.has_velocity[i] || std::isnan(desired.velocity[i]))
+    {
+      continue;
+    }
+    const double desired_vel = desired.velocity[i];
+    double lower_limit = -max_velocity_[i];
+    double upper_limit = max_velocity_[i];
+    if (has_position_limits_[i] && actual.has_position[i])
+    {
+      const double actual_pos = actual.position[i];
+      const double max_pos = max_position_[i];
+      const double min_pos = min_position_[i];
+      lower_limit = std::max((min_pos - actual_pos) / dt, lower_limit);
+      upper_limit = std::min((max_pos - actual_pos) / dt, upper_limit);
+      const bool moving_into_bounds =
+        (actual_pos < (max_pos + internal::POSITION_BOUNDS_TOLERANCE) && actual_pos > min_pos &&
+         desired_vel >= 0.0) ||
+        (actual_pos > (min_pos - internal::POSITION_BOUNDS_TOLERANCE) && actual_pos < max_pos &&
+         desired_vel <= 0.0);
+      const bool far_out_of_bounds =
+        actual_pos > (max_pos + internal::POSITION_BOUNDS_TOLERANCE) ||
+        actual_pos < (min_pos - internal::POSITION_BOUNDS_TOLERANCE);
+      if (
+        (actual_pos > max_pos || actual_pos < min_pos) && (moving_into_bounds || far_out_of_bounds))
+      {
+        lower_limit = 0.0;
+        upper_limit = 0.0;
+      }
+    }
+    if (has_acceleration_limits_[i] && prev.has_velocity[i])
+    {
+      const double delta_vel = max_acceleration_[i] * dt;
+      lower_limit = std::max(prev.velocity[i] - delta_vel, lower_limit);
+      upper_limit = std::min(prev.velocity[i] + delta_vel, upper_limit);
+    }
+    order_limits(lower_limit, upper_limit);
+
+    double soft_min_vel = soft_min_velocity_[i];
+    double soft_max_vel = soft_max_velocity_[i];
+    if (has_acceleration_limits_[i] && actual.has_velocity[i])
+    {
+      soft_min_vel = std::max(actual.velocity[i] - max_acceleration_[i] * dt, soft_min_vel);
+      soft_max_vel = std::min(actual.velocity[i] + max_acceleration_[i] * dt, soft_max_vel);
+    }
+    soft_min_vel = std::max(soft_min_vel, lower_limit);
+    soft_max_vel = std::min(soft_max_vel, upper_limit);
+    // the narrowed bounds also limit the effort, like in JointSoftLimiter
+    soft_min_velocity_[i] = soft_min_vel;
+    soft_max_velocity_[i] = soft_max_vel;
+    limits_enforced |= clamp_value(desired.velocity[i], soft_min_vel, soft_max_vel);
+  }
+
+  // effort, see compute_effort_limits()
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    if (!has_effort_limits_[i] || !desired.has_effort[i] || std::isnan(desired.effort[i]))
+    {
+      continue;
+    }
+    double lower_limit = -max_effort_[i];
+    double upper_limit = max_effort_[i];
+    if (has_position_limits_[i] && actual.has_position[i] && actual.has_velocity[i])
+    {
+      if (actual.position[i] <= min_position_[i] && actual.velocity[i] <= 0.0)
+      {
+        lower_limit = 0.0;
+      }
+      else if (actual.position[i] >= max_position_[i] && actual.velocity[i] >= 0.0)
+      {
+        upper_limit = 0.0;
+      }
+    }
+    if (has_velocity_limits_[i] && actual.has_velocity[i])
+    {
+      if (actual.velocity[i] < -max_velocity_[i])
+      {
+        lower_limit = 0.0;
+      }
+      else if (actual.velocity[i] > max_velocity_[i])
+      {
+        upper_limit = 0.0;
+      }
+    }
+    order_limits(lower_limit, upper_limit);
+
+    double soft_min_eff = lower_limit;
+    double soft_max_eff = upper_limit;
+    if (has_soft_effort_bounds_[i] && actual.has_velocity[i])
+    {
+      const double max_eff = max_effort_[i];
+      soft_min_eff = std::clamp(
+        negated_k_velocity_[i] * (actual.velocity[i] - soft_min_velocity_[i]), -max_eff, max_eff);
+      soft_max_eff = std::clamp(
+        negated_k_velocity_[i] * (actual.velocity[i] - soft_max_velocity_[i]), -max_eff, max_eff);
+      soft_min_eff = std::max(soft_min_eff, lower_limit);
+      soft_max_eff = std::min(soft_max_eff, upper_limit);
+    }
+    limits_enforced |= clamp_value(desired.effort[i], soft_min_eff, soft_max_eff);
+  }
+
+  // acceleration, see compute_acceleration_limits()
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    if (!desired.has_acceleration[i] || std::isnan(desired.acceleration[i]))
+    {
+      continue;
+    }
+    const double desired_acc = desired.acceleration[i];
+    const bool decelerating =
+      actual.has_velocity[i] && ((desired_acc < 0 && actual.velocity[i] > 0) ||
+                                 (desired_acc > 0 && actual.velocity[i] < 0));
+    double lower_limit = -INF;
+    double upper_limit = INF;
+    if (has_deceleration_limits_[i] && decelerating)
+    {
+      lower_limit = -max_deceleration_[i];
+      upper_limit = max_deceleration_[i];
+    }
+    else if (has_acceleration_limits_[i])
+    {
+      lower_limit = -max_acceleration_[i];
+      upper_limit = max_acceleration_[i];
+    }
+    order_limits(lower_limit, upper_limit);
+    limits_enforced |= clamp_value(desired.acceleration[i], lower_limit, upper_limit);
+  }
+
+  internal::update_prev_command(desired, prev);
+
+  return limits_enforced;
+}
+
+}  // namespace joint_limits
@@ -0,0 +1,200 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "joint_limits/joint_fast_saturation_limiter.hpp"
+#include "joint_limits/joint_saturation_batch.hpp"
+#include "joint_limits/joint_saturation_limiter.hpp"
+#include "joint_limits/joint_soft_batch.hpp"
+#include "joint_limits/joint_soft_limiter.hpp"
+#include "rclcpp/duration.hpp"
+
+using joint_limits::JointBatchData;
+using joint_limits::JointControlInterfacesData;
+
+namespace
+{
+constexpr double DT = 0.01;
+constexpr int MIN_JOINTS = 1;
+constexpr int MAX_JOINTS = 256;
+
+joint_limits::JointLimits make_limits()
+{
+  joint_limits::JointLimits limits;
+  limits.has_position_limits = true;
+  limits.min_position = -1.0;
+  limits.max_position = 1.0;
+  limits.has_velocity_limits = true;
+  limits.max_velocity = 2.0;
+  limits.has_acceleration_limits = true;
+  limits.max_acceleration = 20.0;
+  limits.has_effort_limits = true;
+  limits.max_effort = 5.0;
+  return limits;
+}
+
+joint_limits::SoftJointLimits make_soft_limits()
+{
+  joint_limits::SoftJointLimits soft_limits;
+  soft_limits.min_position = -0.5;
+  soft_limits.max_position = 0.5;
+  soft_limits.k_position = 10.0;
+  soft_limits.k_velocity = 20.0;
+  return soft_limits;
+}
+
+std::vector<std::string> make_joint_names(std::size_t number_of_joints)
+{
+  std::vector<std::string> joint_names;
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    joint_names.push_back("joint" + std::to_string(i));
+  }
+  return joint_names;
+}
+
+/// Desired commands of the given cycle, half of the joints exceed their limits at every cycle
+double desired_value(std::size_t joint, int64_t cycle, double amplitude)
+{
+  return ((joint + static_cast<std::size_t>(cycle)) % 2 == 0) ? amplitude : -0.1 * amplitude;
+}
+
+void report_joints(benchmark::State & state, std::size_t number_of_joints)
+{
+  state.counters["joints"] = static_cast<double>(number_of_joints);
+  // the inverted rate of the processed joints is the time per joint
+  state.counters["time_per_joint"] = benchmark::Counter(
+    static_cast<double>(state.iterations()) * static_cast<double>(number_of_joints),
+    benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/// One single-joint limiter per joint, as used by the hardware components for each joint.
+template <typename LimiterType, bool WithSoftLimits>
+void single_joint_limiters(benchmark::State & state)
+{
+  const auto number_of_joints = static_cast<std::size_t>(state.range(0));
+  const auto joint_names = make_joint_names(number_of_joints);
+  std::vector<LimiterType> limiters(number_of_joints);
+  std::vector<JointControlInterfacesData> actual(number_of_joints);
+  std::vector<JointControlInterfacesData> desired(number_of_joints);
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    const std::vector<joint_limits::SoftJointLimits> soft_limits =
+      WithSoftLimits ? std::vector<joint_limits::SoftJointLimits>{make_soft_limits()}
+                     : std::vector<joint_limits::SoftJointLimits>{};
+    if (!limiters[i].init({joint_names[i]}, {make_limits()}, soft_limits, nullptr, nullptr))
+    {
+      state.SkipWithError("The limiter could not be initialized");
+      return;
+    }
+    actual[i].joint_name = joint_names[i];
+    actual[i].position = 0.0;
+    actual[i].velocity = 0.0;
+    desired[i].joint_name = joint_names[i];
+  }
+
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(DT);
+  int64_t cycle = 0;
+  for (auto _ : state)
+  {
+    bool limited = false;
+    for (std::size_t i = 0; i < number_of_joints; ++i)
+    {
+      desired[i].position = desired_value(i, cycle, 0.5);
+      desired[i].velocity = desired_value(i, cycle, 4.0);
+      desired[i].effort = desired_value(i, cycle, 10.0);
+      limited |= limiters[i].enforce(actual[i], desired[i], period);
+    }
+    benchmark::DoNotOptimize(limited);
+    benchmark::ClobberMemory();
+    ++cycle;
+  }
+  report_joints(state, number_of_joints);
+}
+
+/// The limiters of all the joints at once, with the same commands as single_joint_limiters().
+template <typename BatchType, bool WithSoftLimits>
+void batch_limiter(benchmark::State & state)
+{
+  const auto number_of_joints = static_cast<std::size_t>(state.range(0));
+  BatchType batch;
+  bool configured = false;
+  const std::vector<joint_limits::JointLimits> limits(number_of_joints, make_limits());
+  if constexpr (WithSoftLimits)
+  {
+    configured = batch.configure(
+      make_joint_names(number_of_joints), limits,
+      std::vector<joint_limits::SoftJointLimits>(number_of_joints, make_soft_limits()));
+  }
+  else
+  {
+    configured = batch.configure(make_joint_names(number_of_joints), limits);
+  }
+  if (!configured)
+  {
+    state.SkipWithError("The batch could not be configured");
+    return;
+  }
+
+  JointBatchData actual;
+  JointBatchData desired;
+  actual.resize(number_of_joints);
+  desired.resize(number_of_joints);
+  actual.position.assign(number_of_joints, 0.0);
+  actual.has_position.assign(number_of_joints, 1u);
+  actual.velocity.assign(number_of_joints, 0.0);
+  actual.has_velocity.assign(number_of_joints, 1u);
+  desired.has_position.assign(number_of_joints, 1u);
+  desired.has_velocity.assign(number_of_joints, 1u);
+  desired.has_effort.assign(number_of_joints, 1u);
+
+  int64_t cycle = 0;
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < number_of_joints; ++i)
+    {
+      desired.position[i] = desired_value(i, cycle, 0.5);
+      desired.velocity[i] = desired_value(i, cycle, 4.0);
+      desired.effort[i] = desired_value(i, cycle, 10.0);
+    }
+    const bool limited = batch.enforce(actual, desired, DT);
+    benchmark::DoNotOptimize(limited);
+    benchmark::ClobberMemory();
+    ++cycle;
+  }
+  report_joints(state, number_of_joints);
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(
+  single_joint_limiters, joint_limits::JointSaturationLimiter<JointControlInterfacesData>, false)
+  ->RangeMultiplier(2)
+  ->Range(MIN_JOINTS, MAX_JOINTS);
+BENCHMARK_TEMPLATE(single_joint_limiters, joint_limits::JointFastSaturationLimiter, false)
+  ->RangeMultiplier(2)
+  ->Range(MIN_JOINTS, MAX_JOINTS);
+BENCHMARK_TEMPLATE(single_joint_limiters, joint_limits::JointSoftLimiter, true)
+  ->RangeMultiplier(2)
+  ->Range(MIN_JOINTS, MAX_JOINTS);
+BENCHMARK_TEMPLATE(batch_limiter, joint_limits::JointSaturationBatch, false)
+  ->RangeMultiplier(2)
+  ->Range(MIN_JOINTS, MAX_JOINTS);
+BENCHMARK_TEMPLATE(batch_limiter, joint_limits::JointSoftBatch, true)
+  ->RangeMultiplier(2)
+  ->Range(MIN_JOINTS, MAX_JOINTS);
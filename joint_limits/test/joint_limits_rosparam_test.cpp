@@ -458,6 +458,47 @@ TEST_F(
   }
 }
 
+TEST_F(JointLimitsUndeclaredRosParamTest, parse_declared_joint_limits_of_all_joints_at_once)
+{
+  const std::vector<std::string> joint_names = {
+    "foo_joint", "yinfoo_joint", "yangfoo_joint", "antifoo_joint",
+    "bar_joint", "baz_joint",    "foobar_joint",  "barbaz_joint"};
+  const auto param_itf = node_->get_node_parameters_interface();
+  const auto logging_itf = node_->get_node_logging_interface();
+
+  // try to read existing but undeclared joints
+  std::vector<joint_limits::JointLimits> limits;
+  EXPECT_FALSE(joint_limits::get_joint_limits(joint_names, param_itf, logging_itf, limits));
+  ASSERT_EQ(joint_names.size(), limits.size());
+
+  // declare parameters
+  EXPECT_TRUE(joint_limits::declare_parameters(joint_names, param_itf, logging_itf));
+  // already declared parameters are not declared again
+  EXPECT_TRUE(joint_limits::declare_parameters(joint_names, param_itf, logging_itf));
+
+  // now should be successful, with the same limits as reading the joints one by one
+  std::vector<joint_limits::SoftJointLimits> soft_limits;
+  EXPECT_TRUE(joint_limits::get_joint_limits(joint_names, param_itf, logging_itf, limits));
+  joint_limits::get_joint_limits(joint_names, param_itf, logging_itf, soft_limits);
+  ASSERT_EQ(joint_names.size(), soft_limits.size());
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    joint_limits::JointLimits joint_hard_limits;
+    joint_limits::SoftJointLimits joint_soft_limits;
+    EXPECT_TRUE(get_joint_limits(joint_names[i], node_, joint_hard_limits));
+    get_joint_limits(joint_names[i], node_, joint_soft_limits);
+    EXPECT_EQ(joint_hard_limits.to_string(), limits[i].to_string()) << joint_names[i];
+    EXPECT_EQ(joint_soft_limits.to_string(), soft_limits[i].to_string()) << joint_names[i];
+  }
+
+  EXPECT_TRUE(limits[0].has_position_limits);
+  EXPECT_EQ(0.0, limits[0].min_position);
+  EXPECT_EQ(1.0, limits[0].max_position);
+  EXPECT_EQ(20.0, limits[0].max_effort);
+  EXPECT_EQ(10.0, soft_limits[0].k_position);
+  EXPECT_EQ(0.9, soft_limits[0].max_position);
+}
+
 int main(int argc, char ** argv)
 {
   rclcpp::init(argc, argv);
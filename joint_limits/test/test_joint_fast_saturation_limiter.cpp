@@ -0,0 +1,148 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif
+#include <cmath>
+#include <limits>
+#include "test_joint_limiter.hpp"
+
+TEST_F(JointFastSaturationLimiterTest, when_loading_limiter_plugin_expect_loaded)
+{
+  ASSERT_NO_THROW(
+    joint_limiter_ = std::unique_ptr<JointLimiter>(
+      joint_limiter_loader_.createUnmanagedInstance(joint_limiter_type_)));
+  ASSERT_NE(joint_limiter_, nullptr);
+}
+
+TEST_F(JointFastSaturationLimiterTest, when_invalid_dt_expect_enforce_fail)
+{
+  SetupNode("joint_saturation_limiter");
+  ASSERT_TRUE(Load());
+
+  ASSERT_TRUE(Init());
+  ASSERT_TRUE(Configure());
+  rclcpp::Duration period(0, 0);  // 0 second
+  ASSERT_FALSE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+}
+
+TEST_F(JointFastSaturationLimiterTest, check_desired_position_only_cases)
+{
+  SetupNode("joint_saturation_limiter");
+  ASSERT_TRUE(Load());
+
+  joint_limits::JointLimits limits;
+  limits.has_position_limits = true;
+  limits.min_position = -M_PI;
+  limits.max_position = M_PI;
+  limits.has_velocity_limits = true;
+  limits.max_velocity = 1.0;
+  ASSERT_TRUE(Init(limits));
+  ASSERT_TRUE(joint_limiter_->configure(last_commanded_state_));
+
+  desired_state_ = {};
+  actual_state_ = {};
+  rclcpp::Duration period(1, 0);  // 1 second
+
+  // As per max velocity limit, it can only reach 1.0 in 1 second
+  desired_state_.position = 2.0;
+  ASSERT_TRUE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+  EXPECT_NEAR(desired_state_.position.value(), 1.0, COMMON_THRESHOLD);
+  EXPECT_FALSE(desired_state_.has_velocity());
+  EXPECT_FALSE(desired_state_.has_acceleration());
+  EXPECT_FALSE(desired_state_.has_effort());
+
+  // The next step starts from the previous command
+  desired_state_.position = 4.0;
+  ASSERT_TRUE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+  EXPECT_NEAR(desired_state_.position.value(), 2.0, COMMON_THRESHOLD);
+
+  desired_state_.position = 2.5;
+  ASSERT_FALSE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+  EXPECT_NEAR(desired_state_.position.value(), 2.5, COMMON_THRESHOLD);
+}
+
+TEST_F(JointFastSaturationLimiterTest, when_switching_command_interface_expect_new_kernel)
+{
+  SetupNode("joint_saturation_limiter");
+  ASSERT_TRUE(Load());
+
+  joint_limits::JointLimits limits;
+  limits.has_position_limits = true;
+  limits.min_position = -M_PI;
+  limits.max_position = M_PI;
+  limits.has_velocity_limits = true;
+  limits.max_velocity = 1.0;
+  limits.has_effort_limits = true;
+  limits.max_effort = 10.0;
+  ASSERT_TRUE(Init(limits));
+
+  rclcpp::Duration period(0, 100000000);  // 0.1 second
+  desired_state_ = {};
+  actual_state_ = {};
+  actual_state_.position = 0.0;
+  desired_state_.position = M_PI * 2.0;
+  ASSERT_TRUE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+  EXPECT_NEAR(desired_state_.position.value(), 0.1, COMMON_THRESHOLD);
+
+  // velocity and effort commands, without resetting the limiter
+  desired_state_ = {};
+  desired_state_.velocity = 2.0;
+  desired_state_.effort = -20.0;
+  ASSERT_TRUE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+  EXPECT_FALSE(desired_state_.has_position());
+  EXPECT_NEAR(desired_state_.velocity.value(), 1.0, COMMON_THRESHOLD);
+  EXPECT_NEAR(desired_state_.effort.value(), -10.0, COMMON_THRESHOLD);
+
+  // commands with a jerk are limited by the generic implementation
+  limits.has_jerk_limits = true;
+  limits.max_jerk = 5.0;
+  ASSERT_TRUE(Init(limits));
+  desired_state_ = {};
+  actual_state_ = {};
+  desired_state_.velocity = 0.5;
+  desired_state_.jerk = 10.0;
+  ASSERT_TRUE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+  EXPECT_NEAR(desired_state_.velocity.value(), 0.5, COMMON_THRESHOLD);
+  EXPECT_NEAR(desired_state_.jerk.value(), 5.0, COMMON_THRESHOLD);
+}
+
+TEST_F(JointFastSaturationLimiterTest, when_command_is_nan_expect_no_limiting)
+{
+  SetupNode("joint_saturation_limiter");
+  ASSERT_TRUE(Load());
+
+  joint_limits::JointLimits limits;
+  limits.has_position_limits = true;
+  limits.min_position = -M_PI;
+  limits.max_position = M_PI;
+  ASSERT_TRUE(Init(limits));
+
+  rclcpp::Duration period(1, 0);  // 1 second
+  desired_state_ = {};
+  actual_state_ = {};
+  desired_state_.position = std::numeric_limits<double>::quiet_NaN();
+  ASSERT_FALSE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+  EXPECT_TRUE(std::isnan(desired_state_.position.value()));
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleMock(&argc, argv);
+  rclcpp::init(argc, argv);
+  int result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
@@ -129,6 +129,21 @@ public:
   }
 };
 
+class JointFastSaturationLimiterTest : public JointLimiterTest
+{
+public:
+  JointFastSaturationLimiterTest()
+  : JointLimiterTest("joint_limits/JointInterfacesFastSaturationLimiter")
+  {
+  }
+};
+
+class JointLimiterPipelineTest : public JointLimiterTest
+{
+public:
+  JointLimiterPipelineTest() : JointLimiterTest("joint_limits/JointInterfacesLimiterPipeline") {}
+};
+
 class JointSoftLimiterTest : public JointLimiterTest
 {
 public:
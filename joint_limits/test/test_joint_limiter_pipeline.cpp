@@ -0,0 +1,212 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "joint_limits/joint_limiter_pipeline.hpp"
+#include "joint_limits/joint_soft_limiter.hpp"
+#include "test_joint_limiter.hpp"
+
+namespace
+{
+void expect_same_value(
+  const std::optional<double> & expected, const std::optional<double> & value,
+  const std::string & what)
+{
+  ASSERT_EQ(expected.has_value(), value.has_value()) << what;
+  if (expected.has_value() && !std::isnan(expected.value()))
+  {
+    EXPECT_DOUBLE_EQ(expected.value(), value.value()) << what;
+  }
+}
+
+/// Limits random commands with the pipeline and with the reference limiter, with or without the
+/// soft limits
+void expect_same_commands_as(JointLimiter & reference, bool with_soft_limits)
+{
+  std::mt19937 generator(with_soft_limits ? 7 : 42);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  auto uniform = [&](double low, double high) { return low + (high - low) * unit(generator); };
+  auto chance = [&](double probability) { return unit(generator) < probability; };
+
+  joint_limits::JointLimits limits;
+  limits.has_position_limits = true;
+  limits.min_position = -1.0;
+  limits.max_position = 1.0;
+  limits.has_velocity_limits = true;
+  limits.max_velocity = 2.0;
+  limits.has_acceleration_limits = true;
+  limits.max_acceleration = 20.0;
+  limits.has_deceleration_limits = true;
+  limits.max_deceleration = 30.0;
+  limits.has_effort_limits = true;
+  limits.max_effort = 5.0;
+  limits.has_jerk_limits = true;
+  limits.max_jerk = 100.0;
+  std::vector<joint_limits::SoftJointLimits> soft_limits;
+  if (with_soft_limits)
+  {
+    joint_limits::SoftJointLimits soft;
+    soft.min_position = -0.8;
+    soft.max_position = 0.8;
+    soft.k_position = 10.0;
+    soft.k_velocity = 20.0;
+    soft_limits.push_back(soft);
+  }
+  joint_limits::JointLimiterPipeline pipeline;
+  ASSERT_TRUE(reference.init({"foo_joint"}, {limits}, soft_limits, nullptr, nullptr));
+  ASSERT_TRUE(pipeline.init({"foo_joint"}, {limits}, soft_limits, nullptr, nullptr));
+  EXPECT_EQ(
+    pipeline.get_stages() & joint_limits::JointLimiterPipeline::SOFT,
+    with_soft_limits ? joint_limits::JointLimiterPipeline::SOFT : 0u);
+
+  auto random_value = [&](double low, double high) -> std::optional<double>
+  {
+    if (chance(0.2))
+    {
+      return std::nullopt;
+    }
+    return chance(0.02) ? std::numeric_limits<double>::quiet_NaN() : uniform(low, high);
+  };
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.01);
+  for (std::size_t cycle = 0; cycle < 500; ++cycle)
+  {
+    joint_limits::JointControlInterfacesData actual;
+    actual.joint_name = "foo_joint";
+    if (chance(0.9))
+    {
+      // the actual position stays within the tolerance of the exception
+      actual.position = uniform(-1.005, 1.005);
+    }
+    if (chance(0.8))
+    {
+      actual.velocity = uniform(-3.0, 3.0);
+    }
+    joint_limits::JointControlInterfacesData desired;
+    desired.joint_name = "foo_joint";
+    desired.position = random_value(-2.0, 2.0);
+    desired.velocity = random_value(-3.0, 3.0);
+    desired.effort = random_value(-8.0, 8.0);
+    desired.acceleration = random_value(-40.0, 40.0);
+    desired.jerk = random_value(-200.0, 200.0);
+    auto expected = desired;
+
+    const std::string what = "cycle " + std::to_string(cycle);
+    const bool expected_enforced = reference.enforce(actual, expected, period);
+    ASSERT_EQ(expected_enforced, pipeline.enforce(actual, desired, period)) << what;
+    expect_same_value(expected.position, desired.position, what + " position");
+    expect_same_value(expected.velocity, desired.velocity, what + " velocity");
+    expect_same_value(expected.effort, desired.effort, what + " effort");
+    expect_same_value(expected.acceleration, desired.acceleration, what + " acceleration");
+    expect_same_value(expected.jerk, desired.jerk, what + " jerk");
+  }
+}
+}  // namespace
+
+TEST_F(JointLimiterPipelineTest, when_loading_limiter_plugin_expect_loaded)
+{
+  ASSERT_NO_THROW(
+    joint_limiter_ = std::unique_ptr<JointLimiter>(
+      joint_limiter_loader_.createUnmanagedInstance(joint_limiter_type_)));
+  ASSERT_NE(joint_limiter_, nullptr);
+}
+
+TEST_F(JointLimiterPipelineTest, when_invalid_dt_expect_enforce_fail)
+{
+  SetupNode("joint_saturation_limiter");
+  ASSERT_TRUE(Load());
+
+  ASSERT_TRUE(Init());
+  ASSERT_TRUE(Configure());
+  rclcpp::Duration period(0, 0);  // 0 second
+  ASSERT_FALSE(joint_limiter_->enforce(actual_state_, desired_state_, period));
+}
+
+// with all the stages, the pipeline has to limit the commands like the limiter it replaces
+TEST(TestJointLimiterPipeline, same_commands_as_the_saturation_limiter)
+{
+  joint_limits::JointSaturationLimiter<joint_limits::JointControlInterfacesData> reference;
+  expect_same_commands_as(reference, false);
+}
+
+TEST(TestJointLimiterPipeline, same_commands_as_the_soft_limiter)
+{
+  joint_limits::JointSoftLimiter reference;
+  expect_same_commands_as(reference, true);
+}
+
+TEST(TestJointLimiterPipeline, stages_out_of_the_pipeline_are_ignored)
+{
+  using joint_limits::JointLimiterPipeline;
+  joint_limits::JointLimits limits;
+  limits.has_position_limits = true;
+  limits.min_position = -1.0;
+  limits.max_position = 1.0;
+  limits.has_velocity_limits = true;
+  limits.max_velocity = 0.5;
+  limits.has_jerk_limits = true;
+  limits.max_jerk = 1.0;
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(1.0);
+
+  JointLimiterPipeline range_only(JointLimiterPipeline::RANGE);
+  ASSERT_TRUE(range_only.init({"foo_joint"}, {limits}, {}, nullptr, nullptr));
+  EXPECT_EQ(range_only.get_stages(), JointLimiterPipeline::RANGE);
+  EXPECT_EQ(JointLimiterPipeline::get_stages_string(range_only.get_stages()), "range");
+  joint_limits::JointControlInterfacesData actual;
+  joint_limits::JointControlInterfacesData desired;
+  desired.position = 0.9;
+  desired.velocity = 2.0;
+  desired.jerk = 5.0;
+  // only the position range is enforced
+  EXPECT_FALSE(range_only.enforce(actual, desired, period));
+  EXPECT_DOUBLE_EQ(desired.position.value(), 0.9);
+  EXPECT_DOUBLE_EQ(desired.velocity.value(), 2.0);
+  EXPECT_DOUBLE_EQ(desired.jerk.value(), 5.0);
+  desired.position = 1.5;
+  EXPECT_TRUE(range_only.enforce(actual, desired, period));
+  EXPECT_DOUBLE_EQ(desired.position.value(), 1.0);
+
+  // the soft stage isn't active without soft limits
+  JointLimiterPipeline all_stages;
+  ASSERT_TRUE(all_stages.init({"foo_joint"}, {limits}, {}, nullptr, nullptr));
+  EXPECT_EQ(
+    all_stages.get_stages(),
+    JointLimiterPipeline::RANGE | JointLimiterPipeline::VELOCITY |
+      JointLimiterPipeline::ACCELERATION | JointLimiterPipeline::JERK);
+  EXPECT_EQ(
+    JointLimiterPipeline::get_stages_string(all_stages.get_stages()),
+    "range -> velocity -> acceleration -> jerk");
+  desired = {};
+  desired.velocity = 2.0;
+  desired.jerk = 5.0;
+  EXPECT_TRUE(all_stages.enforce(actual, desired, period));
+  EXPECT_DOUBLE_EQ(desired.velocity.value(), 0.5);
+  EXPECT_DOUBLE_EQ(desired.jerk.value(), 1.0);
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleMock(&argc, argv);
+  rclcpp::init(argc, argv);
+  int result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
@@ -0,0 +1,131 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "joint_limits/joint_saturation_batch.hpp"
+
+namespace
+{
+constexpr double DT = 0.01;
+
+joint_limits::JointLimits make_limits()
+{
+  joint_limits::JointLimits limits;
+  limits.has_position_limits = true;
+  limits.min_position = -1.0;
+  limits.max_position = 1.0;
+  limits.has_velocity_limits = true;
+  limits.max_velocity = 2.0;
+  limits.has_effort_limits = true;
+  limits.max_effort = 5.0;
+  return limits;
+}
+}  // namespace
+
+TEST(TestJointSaturationBatch, configure_checks_sizes)
+{
+  joint_limits::JointSaturationBatch batch;
+  EXPECT_FALSE(batch.configure({"joint1", "joint2"}, {make_limits()}));
+  ASSERT_TRUE(batch.configure({"joint1"}, {make_limits()}));
+  EXPECT_EQ(1u, batch.size());
+
+  joint_limits::JointBatchData actual;
+  joint_limits::JointBatchData desired;
+  actual.resize(1);
+  desired.resize(2);
+  EXPECT_FALSE(batch.enforce(actual, desired, DT));
+  desired.resize(1);
+  // negative or null is not allowed
+  EXPECT_FALSE(batch.enforce(actual, desired, 0.0));
+}
+
+TEST(TestJointSaturationBatch, limits_every_joint_independently)
+{
+  joint_limits::JointSaturationBatch batch;
+  auto no_velocity_limits = make_limits();
+  no_velocity_limits.has_velocity_limits = false;
+  ASSERT_TRUE(batch.configure({"joint1", "joint2"}, {make_limits(), no_velocity_limits}));
+
+  joint_limits::JointBatchData actual;
+  joint_limits::JointBatchData desired;
+  actual.resize(2);
+  desired.resize(2);
+  actual.position = {0.0, 0.0};
+  actual.has_position = {1u, 1u};
+  desired.position = {0.5, 0.5};
+  desired.has_position = {1u, 1u};
+  desired.effort = {0.0, 10.0};
+  desired.has_effort = {0u, 1u};
+
+  EXPECT_TRUE(batch.enforce(actual, desired, DT));
+  // the position step is limited by the velocity limit only for the first joint
+  EXPECT_DOUBLE_EQ(0.02, desired.position[0]);
+  EXPECT_DOUBLE_EQ(0.5, desired.position[1]);
+  // the invalid effort is left untouched
+  EXPECT_DOUBLE_EQ(0.0, desired.effort[0]);
+  EXPECT_DOUBLE_EQ(5.0, desired.effort[1]);
+
+  // the next step starts from the previous command
+  desired.position = {0.5, 0.5};
+  desired.has_effort = {0u, 0u};
+  EXPECT_TRUE(batch.enforce(actual, desired, DT));
+  EXPECT_DOUBLE_EQ(0.04, desired.position[0]);
+  EXPECT_DOUBLE_EQ(0.5, desired.position[1]);
+
+  desired.position = {0.04, 0.5};
+  EXPECT_FALSE(batch.enforce(actual, desired, DT));
+}
+
+TEST(TestJointSaturationBatch, limits_velocity_at_position_limits)
+{
+  joint_limits::JointSaturationBatch batch;
+  ASSERT_TRUE(batch.configure({"joint1"}, {make_limits()}));
+
+  joint_limits::JointBatchData actual;
+  joint_limits::JointBatchData desired;
+  actual.resize(1);
+  desired.resize(1);
+  actual.position = {0.99};
+  actual.has_position = {1u};
+  desired.velocity = {3.0};
+  desired.has_velocity = {1u};
+
+  EXPECT_TRUE(batch.enforce(actual, desired, DT));
+  EXPECT_NEAR(1.0, desired.velocity[0], 1e-9);
+
+  desired.velocity = {-3.0};
+  EXPECT_TRUE(batch.enforce(actual, desired, DT));
+  EXPECT_DOUBLE_EQ(-2.0, desired.velocity[0]);
+}
+
+TEST(TestJointSaturationBatch, throws_if_actual_position_is_out_of_bounds)
+{
+  joint_limits::JointSaturationBatch batch;
+  ASSERT_TRUE(batch.configure({"joint1"}, {make_limits()}));
+
+  joint_limits::JointBatchData actual;
+  joint_limits::JointBatchData desired;
+  actual.resize(1);
+  desired.resize(1);
+  actual.position = {1.5};
+  actual.has_position = {1u};
+  desired.position = {0.0};
+  desired.has_position = {1u};
+  EXPECT_THROW(batch.enforce(actual, desired, DT), std::runtime_error);
+}
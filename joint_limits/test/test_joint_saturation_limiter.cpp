@@ -16,6 +16,10 @@
 
 #include "test_joint_saturation_limiter.hpp"
 
+#include <cmath>
+
+#include "joint_limits/joint_saturation_limiter.hpp"
+
 TEST_F(JointSaturationLimiterTest, when_loading_limiter_plugin_expect_loaded)
 {
   // Test JointSaturationLimiter loading
@@ -517,6 +521,62 @@ TEST_F(JointSaturationLimiterTest, when_deceleration_exceeded_with_no_maxdec_exp
   }
 }
 
+TEST_F(JointSaturationLimiterTest, when_trajectory_exceeds_limits_expect_same_points_as_enforce)
+{
+  SetupNode("joint_saturation_limiter");
+  joint_limits::JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint> limiter;
+  joint_limits::JointSaturationLimiter<trajectory_msgs::msg::JointTrajectoryPoint>
+    reference_limiter;
+  joint_names_ = {"foo_joint"};
+  current_joint_states_.positions = {0.0};
+  current_joint_states_.velocities = {0.0};
+  current_joint_states_.accelerations = {0.0};
+  ASSERT_TRUE(limiter.init(joint_names_, node_));
+  ASSERT_TRUE(reference_limiter.init(joint_names_, node_));
+
+  // the desired positions move too fast towards the position limit
+  std::vector<trajectory_msgs::msg::JointTrajectoryPoint> trajectory(20, current_joint_states_);
+  for (size_t point = 0; point < trajectory.size(); ++point)
+  {
+    trajectory[point].positions[0] = 0.5 * static_cast<double>(point + 1);
+    trajectory[point].velocities[0] = 0.0;
+    trajectory[point].accelerations[0] = 0.0;
+    trajectory[point].time_from_start = rclcpp::Duration::from_seconds(0.1 * (point + 1));
+  }
+  auto expected_trajectory = trajectory;
+  // every point is limited from the previous limited point
+  for (size_t point = 0; point < expected_trajectory.size(); ++point)
+  {
+    const auto & previous_point =
+      point == 0 ? current_joint_states_ : expected_trajectory[point - 1];
+    const rclcpp::Duration period = rclcpp::Duration(expected_trajectory[point].time_from_start) -
+                                    rclcpp::Duration(previous_point.time_from_start);
+    reference_limiter.enforce(previous_point, expected_trajectory[point], period);
+  }
+
+  ASSERT_TRUE(limiter.enforce_trajectory(current_joint_states_, trajectory));
+  for (size_t point = 0; point < trajectory.size(); ++point)
+  {
+    EXPECT_EQ(expected_trajectory[point].positions, trajectory[point].positions);
+    EXPECT_EQ(expected_trajectory[point].velocities, trajectory[point].velocities);
+    EXPECT_EQ(expected_trajectory[point].accelerations, trajectory[point].accelerations);
+    EXPECT_LE(std::fabs(trajectory[point].velocities[0]), 2.0 + COMMON_THRESHOLD);
+    EXPECT_LE(trajectory[point].positions[0], 5.0);
+  }
+
+  // only the points of the window are limited
+  auto window = trajectory;
+  window[5].positions[0] = 4.0;
+  window[5].velocities[0] = 0.0;
+  window[8].positions[0] = 4.0;
+  EXPECT_TRUE(limiter.enforce_trajectory(trajectory[4], window, 5, 3));
+  EXPECT_LT(window[5].positions[0], 4.0);
+  EXPECT_DOUBLE_EQ(4.0, window[8].positions[0]);
+  EXPECT_EQ(trajectory[4].positions, window[4].positions);
+  // out of range window
+  EXPECT_FALSE(limiter.enforce_trajectory(current_joint_states_, window, trajectory.size()));
+}
+
 int main(int argc, char ** argv)
 {
   ::testing::InitGoogleMock(&argc, argv);
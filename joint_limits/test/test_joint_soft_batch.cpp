@@ -0,0 +1,249 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "joint_limits/joint_soft_batch.hpp"
+#include "joint_limits/joint_soft_limiter.hpp"
+#include "rclcpp/duration.hpp"
+
+namespace
+{
+constexpr double DT = 0.01;
+
+joint_limits::JointLimits make_limits()
+{
+  joint_limits::JointLimits limits;
+  limits.has_position_limits = true;
+  limits.min_position = -1.0;
+  limits.max_position = 1.0;
+  limits.has_velocity_limits = true;
+  limits.max_velocity = 2.0;
+  limits.has_effort_limits = true;
+  limits.max_effort = 5.0;
+  return limits;
+}
+
+joint_limits::SoftJointLimits make_soft_limits()
+{
+  joint_limits::SoftJointLimits soft_limits;
+  soft_limits.min_position = -0.5;
+  soft_limits.max_position = 0.5;
+  soft_limits.k_position = 10.0;
+  soft_limits.k_velocity = 20.0;
+  return soft_limits;
+}
+
+void set_value(
+  std::size_t i, const std::optional<double> & value, std::vector<double> & values,
+  std::vector<std::uint8_t> & valid)
+{
+  valid[i] = value.has_value();
+  values[i] = value.value_or(0.0);
+}
+
+/// Equality of the limited values, the NaN commands are left untouched by both limiters.
+void expect_same_value(
+  const std::optional<double> & expected, std::uint8_t valid, double value,
+  const std::string & what)
+{
+  ASSERT_EQ(expected.has_value(), static_cast<bool>(valid)) << what;
+  if (expected.has_value() && std::isnan(expected.value()))
+  {
+    EXPECT_TRUE(std::isnan(value)) << what;
+  }
+  else if (expected.has_value())
+  {
+    EXPECT_EQ(expected.value(), value) << what;
+  }
+}
+}  // namespace
+
+TEST(TestJointSoftBatch, configure_checks_sizes)
+{
+  joint_limits::JointSoftBatch batch;
+  EXPECT_FALSE(batch.configure({"joint1", "joint2"}, {make_limits()}, {}));
+  EXPECT_FALSE(batch.configure({"joint1"}, {make_limits()}, {make_soft_limits(), {}}));
+  ASSERT_TRUE(batch.configure({"joint1"}, {make_limits()}, {}));
+  ASSERT_TRUE(batch.configure({"joint1"}, {make_limits()}, {make_soft_limits()}));
+  EXPECT_EQ(1u, batch.size());
+
+  joint_limits::JointBatchData actual;
+  joint_limits::JointBatchData desired;
+  actual.resize(1);
+  desired.resize(2);
+  EXPECT_FALSE(batch.enforce(actual, desired, DT));
+  desired.resize(1);
+  // negative or null is not allowed
+  EXPECT_FALSE(batch.enforce(actual, desired, 0.0));
+}
+
+TEST(TestJointSoftBatch, limits_velocity_with_soft_position_limits)
+{
+  joint_limits::JointSoftBatch batch;
+  ASSERT_TRUE(batch.configure(
+    {"joint1", "joint2"}, {make_limits(), make_limits()}, {make_soft_limits(), {}}));
+
+  joint_limits::JointBatchData actual;
+  joint_limits::JointBatchData desired;
+  actual.resize(2);
+  desired.resize(2);
+  actual.position = {0.4, 0.4};
+  actual.has_position = {1u, 1u};
+  desired.velocity = {2.0, 2.0};
+  desired.has_velocity = {1u, 1u};
+
+  EXPECT_TRUE(batch.enforce(actual, desired, DT));
+  // the soft limit of the first joint slows it down close to its soft position limit
+  EXPECT_DOUBLE_EQ(1.0, desired.velocity[0]);
+  EXPECT_DOUBLE_EQ(2.0, desired.velocity[1]);
+
+  // beyond its soft limits, the joint may only move slowly
+  actual.position = {0.6, 0.6};
+  desired.velocity = {-2.0, -2.0};
+  EXPECT_TRUE(batch.enforce(actual, desired, DT));
+  EXPECT_DOUBLE_EQ(-M_PI / 180.0, desired.velocity[0]);
+  EXPECT_DOUBLE_EQ(-2.0, desired.velocity[1]);
+}
+
+TEST(TestJointSoftBatch, throws_if_actual_position_is_out_of_bounds)
+{
+  joint_limits::JointSoftBatch batch;
+  ASSERT_TRUE(batch.configure({"joint1"}, {make_limits()}, {make_soft_limits()}));
+
+  joint_limits::JointBatchData actual;
+  joint_limits::JointBatchData desired;
+  actual.resize(1);
+  desired.resize(1);
+  actual.position = {1.5};
+  actual.has_position = {1u};
+  desired.position = {0.0};
+  desired.has_position = {1u};
+  EXPECT_THROW(batch.enforce(actual, desired, DT), std::runtime_error);
+}
+
+// the batch has to limit the commands exactly like a JointSoftLimiter per joint
+TEST(TestJointSoftBatch, same_commands_as_the_soft_limiter_of_every_joint)
+{
+  constexpr std::size_t number_of_joints = 24;
+  constexpr std::size_t number_of_cycles = 200;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  auto uniform = [&](double low, double high) { return low + (high - low) * unit(generator); };
+  auto chance = [&](double probability) { return unit(generator) < probability; };
+
+  std::vector<std::string> joint_names;
+  std::vector<joint_limits::JointLimits> limits(number_of_joints);
+  std::vector<joint_limits::SoftJointLimits> soft_limits(number_of_joints);
+  std::vector<joint_limits::JointSoftLimiter> limiters(number_of_joints);
+  for (std::size_t i = 0; i < number_of_joints; ++i)
+  {
+    joint_names.push_back("joint" + std::to_string(i));
+    auto & hard = limits[i];
+    hard.has_position_limits = chance(0.8);
+    hard.min_position = uniform(-2.0, -0.5);
+    hard.max_position = uniform(0.5, 2.0);
+    hard.has_velocity_limits = chance(0.8);
+    hard.max_velocity = uniform(0.5, 3.0);
+    hard.has_acceleration_limits = chance(0.6);
+    hard.max_acceleration = uniform(5.0, 50.0);
+    hard.has_deceleration_limits = chance(0.4);
+    hard.max_deceleration = uniform(5.0, 50.0);
+    hard.has_effort_limits = chance(0.7);
+    hard.max_effort = uniform(1.0, 10.0);
+    // a few joints without soft limits or with invalid ones
+    auto & soft = soft_limits[i];
+    if (chance(0.8))
+    {
+      soft.min_position = hard.min_position + uniform(0.0, 0.3);
+      soft.max_position = hard.max_position - uniform(0.0, 0.3);
+      soft.k_position = chance(0.9) ? uniform(1.0, 20.0) : 0.0;
+      soft.k_velocity = chance(0.8) ? uniform(1.0, 50.0) : std::numeric_limits<double>::infinity();
+    }
+    ASSERT_TRUE(limiters[i].init({joint_names[i]}, {hard}, {soft}, nullptr, nullptr));
+  }
+  joint_limits::JointSoftBatch batch;
+  ASSERT_TRUE(batch.configure(joint_names, limits, soft_limits));
+
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(DT);
+  joint_limits::JointBatchData actual;
+  joint_limits::JointBatchData desired;
+  actual.resize(number_of_joints);
+  desired.resize(number_of_joints);
+  std::vector<joint_limits::JointControlInterfacesData> actual_states(number_of_joints);
+  std::vector<joint_limits::JointControlInterfacesData> desired_states(number_of_joints);
+  auto random_value = [&](double low, double high) -> std::optional<double>
+  {
+    if (chance(0.2))
+    {
+      return std::nullopt;
+    }
+    return chance(0.02) ? std::numeric_limits<double>::quiet_NaN() : uniform(low, high);
+  };
+
+  for (std::size_t cycle = 0; cycle < number_of_cycles; ++cycle)
+  {
+    bool expected_limited = false;
+    for (std::size_t i = 0; i < number_of_joints; ++i)
+    {
+      auto & actual_state = actual_states[i];
+      auto & desired_state = desired_states[i];
+      // the actual position stays within the tolerance of the exception
+      const double min_position = limits[i].min_position - 0.005;
+      const double max_position = limits[i].max_position + 0.005;
+      actual_state.position = std::nullopt;
+      actual_state.velocity = std::nullopt;
+      if (chance(0.9))
+      {
+        actual_state.position = uniform(min_position, max_position);
+      }
+      if (chance(0.8))
+      {
+        actual_state.velocity = uniform(-4.0, 4.0);
+      }
+      desired_state.position = random_value(-2.5, 2.5);
+      desired_state.velocity = random_value(-4.0, 4.0);
+      desired_state.effort = random_value(-12.0, 12.0);
+      desired_state.acceleration = random_value(-80.0, 80.0);
+      set_value(i, actual_state.position, actual.position, actual.has_position);
+      set_value(i, actual_state.velocity, actual.velocity, actual.has_velocity);
+      set_value(i, desired_state.position, desired.position, desired.has_position);
+      set_value(i, desired_state.velocity, desired.velocity, desired.has_velocity);
+      set_value(i, desired_state.effort, desired.effort, desired.has_effort);
+      set_value(i, desired_state.acceleration, desired.acceleration, desired.has_acceleration);
+
+      expected_limited |= limiters[i].enforce(actual_state, desired_state, period);
+    }
+    ASSERT_EQ(expected_limited, batch.enforce(actual, desired, period.seconds()))
+      << "cycle " << cycle;
+    for (std::size_t i = 0; i < number_of_joints; ++i)
+    {
+      const std::string what = joint_names[i] + " at cycle " + std::to_string(cycle);
+      const auto & expected = desired_states[i];
+      expect_same_value(expected.position, desired.has_position[i], desired.position[i], what);
+      expect_same_value(expected.velocity, desired.has_velocity[i], desired.velocity[i], what);
+      expect_same_value(expected.effort, desired.has_effort[i], desired.effort[i], what);
+      expect_same_value(
+        expected.acceleration, desired.has_acceleration[i], desired.acceleration[i], what);
+    }
+  }
+}
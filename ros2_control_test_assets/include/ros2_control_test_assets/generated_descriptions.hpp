@@ -0,0 +1,157 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef ROS2_CONTROL_TEST_ASSETS__GENERATED_DESCRIPTIONS_HPP_
+#define ROS2_CONTROL_TEST_ASSETS__GENERATED_DESCRIPTIONS_HPP_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ros2_control_test_assets
+{
+/// Interface of the generated components, with its data type
+struct GeneratedInterface
+{
+  std::string name;
+  std::string data_type = "double";
+};
+
+/// Parameters of a robot description generated by generate_robot_description()
+struct GeneratedDescriptionParameters
+{
+  std::string robot_name = "GeneratedRobot";
+  std::size_t number_of_systems = 1;
+  std::size_t joints_per_system = 1;
+  std::size_t sensors_per_system = 0;
+  std::size_t gpios_per_system = 0;
+  std::vector<GeneratedInterface> joint_command_interfaces = {{"position"}};
+  std::vector<GeneratedInterface> joint_state_interfaces = {{"position"}, {"velocity"}};
+  std::vector<GeneratedInterface> sensor_state_interfaces = {{"value"}};
+  std::vector<GeneratedInterface> gpio_command_interfaces = {{"analog_output"}};
+  std::vector<GeneratedInterface> gpio_state_interfaces = {
+    {"analog_input"}, {"digital_input", "bool"}};
+  std::string plugin = "mock_components/GenericSystem";
+  /// parameters of the hardware of every system
+  std::map<std::string, std::string> hardware_parameters;
+};
+
+/// Name of the system with the given index in a generated robot description
+inline std::string generated_system_name(std::size_t system)
+{
+  return "GeneratedSystem" + std::to_string(system + 1);
+}
+
+/// Name of a joint of a system in a generated robot description
+inline std::string generated_joint_name(std::size_t system, std::size_t joint)
+{
+  return "system" + std::to_string(system + 1) + "_joint" + std::to_string(joint + 1);
+}
+
+/// Name of a sensor of a system in a generated robot description
+inline std::string generated_sensor_name(std::size_t system, std::size_t sensor)
+{
+  return "system" + std::to_string(system + 1) + "_sensor" + std::to_string(sensor + 1);
+}
+
+/// Name of a gpio of a system in a generated robot description
+inline std::string generated_gpio_name(std::size_t system, std::size_t gpio)
+{
+  return "system" + std::to_string(system + 1) + "_gpio" + std::to_string(gpio + 1);
+}
+
+/// Generates a robot description with any number of systems, joints, sensors and gpios.
+/**
+ * The joints of all the systems form a serial chain of revolute joints, every system has its own
+ * joints, sensors and gpios with the interfaces of the parameters. This scales the descriptions
+ * to stress-test the ResourceManager and the ControllerManager with thousands of interfaces.
+ */
+inline std::string generate_robot_description(const GeneratedDescriptionParameters & parameters)
+{
+  auto add_interfaces = [](
+                          std::string & urdf, const std::string & tag,
+                          const std::vector<GeneratedInterface> & interfaces)
+  {
+    for (const auto & interface : interfaces)
+    {
+      urdf += "      <" + tag + " name=\"" + interface.name + "\"";
+      if (interface.data_type != "double")
+      {
+        urdf += " data_type=\"" + interface.data_type + "\"";
+      }
+      urdf += "/>\n";
+    }
+  };
+
+  std::string urdf = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+  urdf += "<robot name=\"" + parameters.robot_name + "\">\n";
+  urdf += "  <link name=\"base_link\"/>\n";
+  std::string parent = "base_link";
+  for (std::size_t s = 0; s < parameters.number_of_systems; ++s)
+  {
+    for (std::size_t j = 0; j < parameters.joints_per_system; ++j)
+    {
+      const std::string joint = generated_joint_name(s, j);
+      urdf += "  <link name=\"" + joint + "_link\"/>\n";
+      urdf += "  <joint name=\"" + joint + "\" type=\"revolute\">\n";
+      urdf += "    <parent link=\"" + parent + "\"/>\n";
+      urdf += "    <child link=\"" + joint + "_link\"/>\n";
+      urdf += "    <axis xyz=\"0 0 1\"/>\n";
+      urdf += "    <limit effort=\"100\" lower=\"-3.14\" upper=\"3.14\" velocity=\"10\"/>\n";
+      urdf += "  </joint>\n";
+      parent = joint + "_link";
+    }
+  }
+
+  for (std::size_t s = 0; s < parameters.number_of_systems; ++s)
+  {
+    urdf += "  <ros2_control name=\"" + generated_system_name(s) + "\" type=\"system\">\n";
+    urdf += "    <hardware>\n";
+    urdf += "      <plugin>" + parameters.plugin + "</plugin>\n";
+    for (const auto & [name, value] : parameters.hardware_parameters)
+    {
+      urdf += "      <param name=\"" + name + "\">" + value + "</param>\n";
+    }
+    urdf += "    </hardware>\n";
+    for (std::size_t j = 0; j < parameters.joints_per_system; ++j)
+    {
+      urdf += "    <joint name=\"" + generated_joint_name(s, j) + "\">\n";
+      add_interfaces(urdf, "command_interface", parameters.joint_command_interfaces);
+      add_interfaces(urdf, "state_interface", parameters.joint_state_interfaces);
+      urdf += "    </joint>\n";
+    }
+    for (std::size_t i = 0; i < parameters.sensors_per_system; ++i)
+    {
+      urdf += "    <sensor name=\"" + generated_sensor_name(s, i) + "\">\n";
+      add_interfaces(urdf, "state_interface", parameters.sensor_state_interfaces);
+      urdf += "    </sensor>\n";
+    }
+    for (std::size_t i = 0; i < parameters.gpios_per_system; ++i)
+    {
+      urdf += "    <gpio name=\"" + generated_gpio_name(s, i) + "\">\n";
+      add_interfaces(urdf, "command_interface", parameters.gpio_command_interfaces);
+      add_interfaces(urdf, "state_interface", parameters.gpio_state_interfaces);
+      urdf += "    </gpio>\n";
+    }
+    urdf += "  </ros2_control>\n";
+  }
+  urdf += "</robot>\n";
+  return urdf;
+}
+
+}  // namespace ros2_control_test_assets
+
+#endif  // ROS2_CONTROL_TEST_ASSETS__GENERATED_DESCRIPTIONS_HPP_
@@ -108,9 +108,6 @@ namespace transmission_interface
  *
  * \ingroup transmission_types
  */
-
-constexpr auto HW_IF_ABSOLUTE_POSITION = "absolute_position";
-
 class DifferentialTransmission : public Transmission
 {
 public:
@@ -215,7 +212,7 @@ inline DifferentialTransmission::DifferentialTransmission(
   }
 }
 
-void DifferentialTransmission::configure(
+inline void DifferentialTransmission::configure(
   const std::vector<JointHandle> & joint_handles,
   const std::vector<ActuatorHandle> & actuator_handles)
 {
@@ -578,7 +575,7 @@ inline void DifferentialTransmission::joint_to_actuator()
   }
 }
 
-std::string DifferentialTransmission::get_handles_info() const
+inline std::string DifferentialTransmission::get_handles_info() const
 {
   return fmt::format(
     FMT_COMPILE(
@@ -19,6 +19,7 @@
 
 #include <fmt/compile.h>
 
+#include <array>
 #include <cassert>
 #include <string>
 #include <vector>
@@ -169,10 +170,21 @@ public:
   }
 
 protected:
+  /// Precomputes the mapping matrices and offsets from the reductions and joint offsets.
+  void compute_mappings();
+
   std::vector<double> actuator_reduction_;
   std::vector<double> joint_reduction_;
   std::vector<double> joint_offset_;
 
+  /// Row-major 2x2 matrices computed by configure(), the velocities use the position matrices
+  std::array<double, 4> actuator_to_joint_position_ = {};
+  std::array<double, 4> joint_to_actuator_position_ = {};
+  std::array<double, 4> actuator_to_joint_effort_ = {};
+  std::array<double, 4> joint_to_actuator_effort_ = {};
+  /// Joint offsets mapped to the actuator space, subtracted after joint_to_actuator_position_
+  std::array<double, 2> actuator_position_offset_ = {};
+
   std::vector<JointHandle> joint_position_;
   std::vector<JointHandle> joint_velocity_;
   std::vector<JointHandle> joint_effort_;
@@ -203,7 +215,7 @@ inline FourBarLinkageTransmission::FourBarLinkageTransmission(
   }
 }
 
-void FourBarLinkageTransmission::configure(
+inline void FourBarLinkageTransmission::configure(
   const std::vector<JointHandle> & joint_handles,
   const std::vector<ActuatorHandle> & actuator_handles)
 {
@@ -270,93 +282,87 @@ void FourBarLinkageTransmission::configure(
     throw Exception(
       fmt::format(FMT_COMPILE("Pair-wise mismatch on interfaces. \n{}"), get_handles_info()));
   }
+
+  compute_mappings();
 }
 
-inline void FourBarLinkageTransmission::actuator_to_joint()
+inline void FourBarLinkageTransmission::compute_mappings()
 {
   const auto & ar = actuator_reduction_;
   const auto & jr = joint_reduction_;
 
-  // position
-  auto & act_pos = actuator_position_;
-  auto & joint_pos = joint_position_;
-  if (act_pos.size() == num_actuators() && joint_pos.size() == num_joints())
-  {
-    assert(act_pos[0] && act_pos[1] && joint_pos[0] && joint_pos[1]);
+  // x_j = A x_a + x_off, and the power conservation gives tau_j = A^-T tau_a
+  actuator_to_joint_position_ = {
+    1.0 / (jr[0] * ar[0]), 0.0, -1.0 / (jr[0] * ar[0] * jr[1]), 1.0 / (ar[1] * jr[1])};
+  joint_to_actuator_position_ = {jr[0] * ar[0], 0.0, ar[1], ar[1] * jr[1]};
+  actuator_to_joint_effort_ = {jr[0] * ar[0], ar[1], 0.0, ar[1] * jr[1]};
+  joint_to_actuator_effort_ = {
+    1.0 / (jr[0] * ar[0]), -1.0 / (jr[0] * ar[0] * jr[1]), 0.0, 1.0 / (ar[1] * jr[1])};
+
+  const auto & m = joint_to_actuator_position_;
+  actuator_position_offset_ = {
+    m[0] * joint_offset_[0] + m[1] * joint_offset_[1],
+    m[2] * joint_offset_[0] + m[3] * joint_offset_[1]};
+}
 
-    joint_pos[0].set_value(act_pos[0].get_value() / (jr[0] * ar[0]) + joint_offset_[0]);
-    joint_pos[1].set_value(
-      (act_pos[1].get_value() / ar[1] - act_pos[0].get_value() / (jr[0] * ar[0])) / jr[1] +
-      joint_offset_[1]);
-  }
+namespace detail
+{
+/// Sets the output handles to the product of the row-major 2x2 matrix with the input handles,
+/// minus the offset.
+template <class InputHandle, class OutputHandle>
+inline void multiply_2x2(
+  const std::array<double, 4> & m, const std::vector<InputHandle> & input,
+  std::vector<OutputHandle> & output, const std::array<double, 2> & offset = {})
+{
+  assert(input[0] && input[1] && output[0] && output[1]);
 
-  // velocity
-  auto & act_vel = actuator_velocity_;
-  auto & joint_vel = joint_velocity_;
-  if (act_vel.size() == num_actuators() && joint_vel.size() == num_joints())
-  {
-    assert(act_vel[0] && act_vel[1] && joint_vel[0] && joint_vel[1]);
+  const double x0 = input[0].get_value();
+  const double x1 = input[1].get_value();
+  output[0].set_value(m[0] * x0 + m[1] * x1 - offset[0]);
+  output[1].set_value(m[2] * x0 + m[3] * x1 - offset[1]);
+}
+}  // namespace detail
 
-    joint_vel[0].set_value(act_vel[0].get_value() / (jr[0] * ar[0]));
-    joint_vel[1].set_value(
-      (act_vel[1].get_value() / ar[1] - act_vel[0].get_value() / (jr[0] * ar[0])) / jr[1]);
+inline void FourBarLinkageTransmission::actuator_to_joint()
+{
+  if (actuator_position_.size() == num_actuators() && joint_position_.size() == num_joints())
+  {
+    detail::multiply_2x2(
+      actuator_to_joint_position_, actuator_position_, joint_position_,
+      {-joint_offset_[0], -joint_offset_[1]});
   }
 
-  // effort
-  auto & act_eff = actuator_effort_;
-  auto & joint_eff = joint_effort_;
-  if (act_eff.size() == num_actuators() && joint_eff.size() == num_joints())
+  if (actuator_velocity_.size() == num_actuators() && joint_velocity_.size() == num_joints())
   {
-    assert(act_eff[0] && act_eff[1] && joint_eff[0] && joint_eff[1]);
+    detail::multiply_2x2(actuator_to_joint_position_, actuator_velocity_, joint_velocity_);
+  }
 
-    joint_eff[0].set_value(jr[0] * act_eff[0].get_value() * ar[0] + act_eff[1].get_value() * ar[1]);
-    joint_eff[1].set_value(jr[1] * act_eff[1].get_value() * ar[1]);
+  if (actuator_effort_.size() == num_actuators() && joint_effort_.size() == num_joints())
+  {
+    detail::multiply_2x2(actuator_to_joint_effort_, actuator_effort_, joint_effort_);
   }
 }
 
 inline void FourBarLinkageTransmission::joint_to_actuator()
 {
-  const auto & ar = actuator_reduction_;
-  const auto & jr = joint_reduction_;
-
-  // position
-  auto & act_pos = actuator_position_;
-  auto & joint_pos = joint_position_;
-  if (act_pos.size() == num_actuators() && joint_pos.size() == num_joints())
+  if (actuator_position_.size() == num_actuators() && joint_position_.size() == num_joints())
   {
-    assert(act_pos[0] && act_pos[1] && joint_pos[0] && joint_pos[1]);
-
-    double joints_offset_applied[2] = {
-      joint_pos[0].get_value() - joint_offset_[0], joint_pos[1].get_value() - joint_offset_[1]};
-    act_pos[0].set_value(joints_offset_applied[0] * jr[0] * ar[0]);
-    act_pos[1].set_value((joints_offset_applied[0] + joints_offset_applied[1] * jr[1]) * ar[1]);
+    detail::multiply_2x2(
+      joint_to_actuator_position_, joint_position_, actuator_position_, actuator_position_offset_);
   }
 
-  // velocity
-  auto & act_vel = actuator_velocity_;
-  auto & joint_vel = joint_velocity_;
-  if (act_vel.size() == num_actuators() && joint_vel.size() == num_joints())
+  if (actuator_velocity_.size() == num_actuators() && joint_velocity_.size() == num_joints())
   {
-    assert(act_vel[0] && act_vel[1] && joint_vel[0] && joint_vel[1]);
-
-    act_vel[0].set_value(joint_vel[0].get_value() * jr[0] * ar[0]);
-    act_vel[1].set_value((joint_vel[0].get_value() + joint_vel[1].get_value() * jr[1]) * ar[1]);
+    detail::multiply_2x2(joint_to_actuator_position_, joint_velocity_, actuator_velocity_);
   }
 
-  // effort
-  auto & act_eff = actuator_effort_;
-  auto & joint_eff = joint_effort_;
-  if (act_eff.size() == num_actuators() && joint_eff.size() == num_joints())
+  if (actuator_effort_.size() == num_actuators() && joint_effort_.size() == num_joints())
   {
-    assert(act_eff[0] && act_eff[1] && joint_eff[0] && joint_eff[1]);
-
-    act_eff[0].set_value(
-      (joint_eff[0].get_value() - joint_eff[1].get_value() / jr[1]) / (jr[0] * ar[0]));
-    act_eff[1].set_value(joint_eff[1].get_value() / (ar[1] * jr[1]));
+    detail::multiply_2x2(joint_to_actuator_effort_, joint_effort_, actuator_effort_);
   }
 }
 
-std::string FourBarLinkageTransmission::get_handles_info() const
+inline std::string FourBarLinkageTransmission::get_handles_info() const
 {
   return fmt::format(
     FMT_COMPILE(
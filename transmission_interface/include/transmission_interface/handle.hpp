@@ -15,8 +15,10 @@
 #ifndef TRANSMISSION_INTERFACE__HANDLE_HPP_
 #define TRANSMISSION_INTERFACE__HANDLE_HPP_
 
+#include <cassert>
 #include <string>
-#include "hardware_interface/macros.hpp"
+
+#include "hardware_interface/handle.hpp"
 
 namespace transmission_interface
 {
@@ -30,6 +32,21 @@ public:
   {
   }
 
+  /// Binds the handle in place to the double value of an interface exported by a hardware
+  /// component, so the transmission reads and writes it without copying it.
+  /**
+   * \param[in] interface interface to bind, see hardware_interface::Handle::bind_value_storage().
+   * \throws std::runtime_error if the interface doesn't hold a value of type double or is
+   * lock-free.
+   * \note The interface is then accessed without its lock, so it must only be accessed by the
+   * thread converting the transmission, e.g., in the read() and write() of the component.
+   */
+  explicit Handle(hardware_interface::Handle & interface)
+  : Handle(
+      interface.get_prefix_name(), interface.get_interface_name(), interface.bind_value_storage())
+  {
+  }
+
   Handle(const Handle & other) = default;
 
   Handle(Handle && other) = default;
@@ -49,18 +66,23 @@ public:
 
   const std::string & get_prefix_name() const { return prefix_name_; }
 
+  /// \pre The handle references a value, the transmissions only keep such handles in configure().
   double get_value() const
   {
-    THROW_ON_NULLPTR(value_ptr_);
+    assert(value_ptr_);
     return *value_ptr_;
   }
 
+  /// \pre The handle references a value, the transmissions only keep such handles in configure().
   void set_value(double value)
   {
-    THROW_ON_NULLPTR(this->value_ptr_);
-    *this->value_ptr_ = value;
+    assert(value_ptr_);
+    *value_ptr_ = value;
   }
 
+  /// Returns the pointer to the referenced value, e.g., to access it without the null check.
+  double * get_value_ptr() const { return value_ptr_; }
+
 protected:
   std::string prefix_name_;
   std::string interface_name_;
@@ -0,0 +1,396 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRANSMISSION_INTERFACE__LINEAR_TRANSMISSION_HPP_
+#define TRANSMISSION_INTERFACE__LINEAR_TRANSMISSION_HPP_
+
+#include <fmt/compile.h>
+
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "transmission_interface/accessor.hpp"
+#include "transmission_interface/exception.hpp"
+#include "transmission_interface/transmission.hpp"
+
+namespace transmission_interface
+{
+/// Implementation of a linear transmission coupling \e n actuators with \e n joints.
+/**
+ * The transmission is described by an invertible \f$ n \times n \f$ matrix \f$ A \f$ mapping the
+ * actuator positions to the joint positions, e.g., the coupling matrix of a wrist.
+ *
+ * <CENTER>
+ * <table>
+ * <tr><th></th><th><CENTER>Effort</CENTER></th><th><CENTER>Velocity</CENTER></th><th><CENTER>Position</CENTER></th></tr>
+ * <tr><td><b> Actuator to joint </b></td>
+ * <td>\f$ \tau_j = A^{-T} \tau_a \f$</td>
+ * <td>\f$ \dot{x}_j = A \dot{x}_a \f$</td>
+ * <td>\f$ x_j = A x_a + x_{off} \f$</td></tr>
+ * <tr><td><b> Joint to actuator </b></td>
+ * <td>\f$ \tau_a = A^{T} \tau_j \f$</td>
+ * <td>\f$ \dot{x}_a = A^{-1} \dot{x}_j \f$</td>
+ * <td>\f$ x_a = A^{-1} (x_j - x_{off}) \f$</td></tr>
+ * </table>
+ * </CENTER>
+ *
+ * where \f$ x_{off} \f$ are the joint position offsets. The inverse, the transposed matrices and
+ * the actuator position offsets \f$ A^{-1} x_{off} \f$ are computed when the transmission is
+ * constructed, so every conversion is a matrix-vector product per interface type.
+ *
+ * The rows of \f$ A \f$ follow the order of the joint names and its columns the order of the
+ * actuator names. If the names are not given, the joints and the actuators are sorted by name like
+ * in the other transmissions.
+ *
+ * \ingroup transmission_types
+ */
+class LinearTransmission : public Transmission
+{
+public:
+  /**
+   * \param[in] actuator_to_joint Row-major matrix mapping the actuator to the joint positions.
+   * \param[in] joint_offset      Joint position offsets, the joint offsets are zero if empty.
+   * \param[in] joint_names       Order of the joints, the rows of the matrix.
+   * \param[in] actuator_names    Order of the actuators, the columns of the matrix.
+   * \pre The matrix is square and invertible, and matches the size of the other parameters.
+   */
+  explicit LinearTransmission(
+    const std::vector<double> & actuator_to_joint, const std::vector<double> & joint_offset = {},
+    const std::vector<std::string> & joint_names = {},
+    const std::vector<std::string> & actuator_names = {});
+
+  /**
+   * \param[in] joint_handles     Handles of joint values.
+   * \param[in] actuator_handles  Handles of actuator values.
+   * \pre Handles are valid and matching in size
+   */
+  void configure(
+    const std::vector<JointHandle> & joint_handles,
+    const std::vector<ActuatorHandle> & actuator_handles) override;
+
+  /// Transform variables from actuator to joint space.
+  /**
+   * \pre Actuator and joint vectors must have size n and point to valid data.
+   *  To call this method it is not required that all other data vectors contain valid data, and can
+   * even remain empty.
+   */
+  void actuator_to_joint() override;
+
+  /// Transform variables from joint to actuator space.
+  /**
+   * \pre Actuator and joint vectors must have size n and point to valid data.
+   *  To call this method it is not required that all other data vectors contain valid data, and can
+   * even remain empty.
+   */
+  void joint_to_actuator() override;
+
+  std::size_t num_actuators() const override { return size_; }
+  std::size_t num_joints() const override { return size_; }
+
+  const std::vector<double> & get_actuator_to_joint() const { return actuator_to_joint_; }
+  const std::vector<double> & get_joint_to_actuator() const { return joint_to_actuator_; }
+  const std::vector<double> & get_joint_offset() const { return joint_offset_; }
+
+  /// Get human-friendly report of handles
+  std::string get_handles_info() const;
+
+  std::vector<std::string> get_supported_actuator_interfaces() const override
+  {
+    return {
+      hardware_interface::HW_IF_POSITION, hardware_interface::HW_IF_VELOCITY,
+      hardware_interface::HW_IF_EFFORT};
+  }
+
+  std::vector<std::string> get_supported_joint_interfaces() const override
+  {
+    return {
+      hardware_interface::HW_IF_POSITION, hardware_interface::HW_IF_VELOCITY,
+      hardware_interface::HW_IF_EFFORT};
+  }
+
+protected:
+  /// Sets the output handles to the product of the row-major matrix with the inputs, plus the
+  /// offset if it's not empty.
+  template <class InputHandle, class OutputHandle>
+  void multiply(
+    const std::vector<double> & matrix, const std::vector<InputHandle> & input,
+    std::vector<OutputHandle> & output, const std::vector<double> & offset = {});
+
+  template <class HandleType>
+  std::vector<HandleType> get_handles(
+    const std::vector<HandleType> & handles, const std::vector<std::string> & names,
+    const std::string & interface_type, const char * kind) const;
+
+  std::size_t size_;
+  std::vector<double> actuator_to_joint_;
+  std::vector<double> joint_to_actuator_;
+  std::vector<double> actuator_to_joint_effort_;
+  std::vector<double> joint_to_actuator_effort_;
+  std::vector<double> joint_offset_;
+  /// Joint offsets mapped to the actuator space and negated, added after joint_to_actuator_
+  std::vector<double> actuator_position_offset_;
+  std::vector<std::string> joint_names_;
+  std::vector<std::string> actuator_names_;
+  /// Input values of the current conversion, the outputs may alias the inputs of a handle
+  std::vector<double> input_values_;
+
+  std::vector<JointHandle> joint_position_;
+  std::vector<JointHandle> joint_velocity_;
+  std::vector<JointHandle> joint_effort_;
+
+  std::vector<ActuatorHandle> actuator_position_;
+  std::vector<ActuatorHandle> actuator_velocity_;
+  std::vector<ActuatorHandle> actuator_effort_;
+};
+
+namespace detail
+{
+/// Returns the inverse of the row-major square matrix, computed by Gauss-Jordan elimination.
+/**
+ * \throws Exception if the matrix is singular.
+ */
+inline std::vector<double> invert_matrix(std::vector<double> matrix, std::size_t size)
+{
+  std::vector<double> inverse(size * size, 0.0);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    inverse[i * size + i] = 1.0;
+  }
+  for (std::size_t col = 0; col < size; ++col)
+  {
+    std::size_t pivot = col;
+    for (std::size_t row = col + 1; row < size; ++row)
+    {
+      if (std::abs(matrix[row * size + col]) > std::abs(matrix[pivot * size + col]))
+      {
+        pivot = row;
+      }
+    }
+    if (std::abs(matrix[pivot * size + col]) < 1e-12)
+    {
+      throw Exception("The transmission matrix is singular.");
+    }
+    for (std::size_t k = 0; k < size; ++k)
+    {
+      std::swap(matrix[pivot * size + k], matrix[col * size + k]);
+      std::swap(inverse[pivot * size + k], inverse[col * size + k]);
+    }
+    const double scale = 1.0 / matrix[col * size + col];
+    for (std::size_t k = 0; k < size; ++k)
+    {
+      matrix[col * size + k] *= scale;
+      inverse[col * size + k] *= scale;
+    }
+    for (std::size_t row = 0; row < size; ++row)
+    {
+      const double factor = matrix[row * size + col];
+      if (row == col || factor == 0.0)
+      {
+        continue;
+      }
+      for (std::size_t k = 0; k < size; ++k)
+      {
+        matrix[row * size + k] -= factor * matrix[col * size + k];
+        inverse[row * size + k] -= factor * inverse[col * size + k];
+      }
+    }
+  }
+  return inverse;
+}
+
+/// Returns the transpose of the row-major square matrix.
+inline std::vector<double> transpose_matrix(const std::vector<double> & matrix, std::size_t size)
+{
+  std::vector<double> result(matrix.size());
+  for (std::size_t row = 0; row < size; ++row)
+  {
+    for (std::size_t col = 0; col < size; ++col)
+    {
+      result[col * size + row] = matrix[row * size + col];
+    }
+  }
+  return result;
+}
+}  // namespace detail
+
+inline LinearTransmission::LinearTransmission(
+  const std::vector<double> & actuator_to_joint, const std::vector<double> & joint_offset,
+  const std::vector<std::string> & joint_names, const std::vector<std::string> & actuator_names)
+: size_(static_cast<std::size_t>(std::lround(std::sqrt(actuator_to_joint.size())))),
+  actuator_to_joint_(actuator_to_joint),
+  joint_offset_(joint_offset.empty() ? std::vector<double>(size_, 0.0) : joint_offset),
+  joint_names_(joint_names),
+  actuator_names_(actuator_names)
+{
+  if (size_ == 0 || size_ * size_ != actuator_to_joint_.size())
+  {
+    throw Exception(
+      fmt::format(
+        FMT_COMPILE("The transmission matrix must be square and not empty but has {} elements."),
+        actuator_to_joint_.size()));
+  }
+  if (
+    joint_offset_.size() != size_ || (!joint_names_.empty() && joint_names_.size() != size_) ||
+    (!actuator_names_.empty() && actuator_names_.size() != size_))
+  {
+    throw Exception(
+      fmt::format(
+        FMT_COMPILE("The offsets and the names must have size {} to match the matrix."), size_));
+  }
+
+  joint_to_actuator_ = detail::invert_matrix(actuator_to_joint_, size_);
+  actuator_to_joint_effort_ = detail::transpose_matrix(joint_to_actuator_, size_);
+  joint_to_actuator_effort_ = detail::transpose_matrix(actuator_to_joint_, size_);
+  actuator_position_offset_.assign(size_, 0.0);
+  for (std::size_t row = 0; row < size_; ++row)
+  {
+    for (std::size_t col = 0; col < size_; ++col)
+    {
+      actuator_position_offset_[row] -= joint_to_actuator_[row * size_ + col] * joint_offset_[col];
+    }
+  }
+  input_values_.resize(size_);
+}
+
+inline void LinearTransmission::configure(
+  const std::vector<JointHandle> & joint_handles,
+  const std::vector<ActuatorHandle> & actuator_handles)
+{
+  if (joint_handles.empty())
+  {
+    throw Exception("No joint handles were passed in");
+  }
+
+  if (actuator_handles.empty())
+  {
+    throw Exception("No actuator handles were passed in");
+  }
+
+  const auto joint_names = joint_names_.empty() ? get_names(joint_handles) : joint_names_;
+  if (joint_names.size() != size_)
+  {
+    throw Exception(
+      fmt::format(
+        FMT_COMPILE("There should be exactly {} unique joint names but was given '{}'."), size_,
+        to_string(joint_names)));
+  }
+  const auto actuator_names =
+    actuator_names_.empty() ? get_names(actuator_handles) : actuator_names_;
+  if (actuator_names.size() != size_)
+  {
+    throw Exception(
+      fmt::format(
+        FMT_COMPILE("There should be exactly {} unique actuator names but was given '{}'."), size_,
+        to_string(actuator_names)));
+  }
+
+  joint_position_ =
+    get_handles(joint_handles, joint_names, hardware_interface::HW_IF_POSITION, "joint");
+  joint_velocity_ =
+    get_handles(joint_handles, joint_names, hardware_interface::HW_IF_VELOCITY, "joint");
+  joint_effort_ =
+    get_handles(joint_handles, joint_names, hardware_interface::HW_IF_EFFORT, "joint");
+
+  actuator_position_ = get_handles(
+    actuator_handles, actuator_names, hardware_interface::HW_IF_POSITION, "actuator");
+  actuator_velocity_ = get_handles(
+    actuator_handles, actuator_names, hardware_interface::HW_IF_VELOCITY, "actuator");
+  actuator_effort_ =
+    get_handles(actuator_handles, actuator_names, hardware_interface::HW_IF_EFFORT, "actuator");
+
+  const bool not_matching =
+    (joint_position_.size() != actuator_position_.size()) ||
+    (joint_velocity_.size() != actuator_velocity_.size()) ||
+    (joint_effort_.size() != actuator_effort_.size());
+  const bool empty = joint_position_.empty() && joint_velocity_.empty() && joint_effort_.empty();
+  if (not_matching || empty)
+  {
+    throw Exception(
+      fmt::format(FMT_COMPILE("Pair-wise mismatch on interfaces. \n{}"), get_handles_info()));
+  }
+}
+
+inline void LinearTransmission::actuator_to_joint()
+{
+  multiply(actuator_to_joint_, actuator_position_, joint_position_, joint_offset_);
+  multiply(actuator_to_joint_, actuator_velocity_, joint_velocity_);
+  multiply(actuator_to_joint_effort_, actuator_effort_, joint_effort_);
+}
+
+inline void LinearTransmission::joint_to_actuator()
+{
+  multiply(joint_to_actuator_, joint_position_, actuator_position_, actuator_position_offset_);
+  multiply(joint_to_actuator_, joint_velocity_, actuator_velocity_);
+  multiply(joint_to_actuator_effort_, joint_effort_, actuator_effort_);
+}
+
+template <class InputHandle, class OutputHandle>
+void LinearTransmission::multiply(
+  const std::vector<double> & matrix, const std::vector<InputHandle> & input,
+  std::vector<OutputHandle> & output, const std::vector<double> & offset)
+{
+  if (input.size() != size_ || output.size() != size_)
+  {
+    return;
+  }
+  for (std::size_t col = 0; col < size_; ++col)
+  {
+    input_values_[col] = input[col].get_value();
+  }
+  for (std::size_t row = 0; row < size_; ++row)
+  {
+    double value = offset.empty() ? 0.0 : offset[row];
+    for (std::size_t col = 0; col < size_; ++col)
+    {
+      value += matrix[row * size_ + col] * input_values_[col];
+    }
+    output[row].set_value(value);
+  }
+}
+
+template <class HandleType>
+std::vector<HandleType> LinearTransmission::get_handles(
+  const std::vector<HandleType> & handles, const std::vector<std::string> & names,
+  const std::string & interface_type, const char * kind) const
+{
+  auto result = get_ordered_handles(handles, names, interface_type);
+  if (!result.empty() && result.size() != size_)
+  {
+    throw Exception(
+      fmt::format(
+        FMT_COMPILE("Not enough valid or required {} {} handles were present. \n{}"), kind,
+        interface_type, get_handles_info()));
+  }
+  return result;
+}
+
+inline std::string LinearTransmission::get_handles_info() const
+{
+  return fmt::format(
+    FMT_COMPILE(
+      "Got the following handles:\n"
+      "Joint position: {}, Actuator position: {}\n"
+      "Joint velocity: {}, Actuator velocity: {}\n"
+      "Joint effort: {}, Actuator effort: {}"),
+    to_string(get_names(joint_position_)), to_string(get_names(actuator_position_)),
+    to_string(get_names(joint_velocity_)), to_string(get_names(actuator_velocity_)),
+    to_string(get_names(joint_effort_)), to_string(get_names(actuator_effort_)));
+}
+
+}  // namespace transmission_interface
+
+#endif  // TRANSMISSION_INTERFACE__LINEAR_TRANSMISSION_HPP_
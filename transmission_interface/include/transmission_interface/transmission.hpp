@@ -24,6 +24,9 @@
 
 namespace transmission_interface
 {
+/// Interface name of the absolute position, supported by the simple and differential transmissions
+constexpr auto HW_IF_ABSOLUTE_POSITION = "absolute_position";
+
 /// Abstract base class for representing mechanical transmissions.
 /**
  * Mechanical transmissions transform effort/flow variables such that their product (power) remains
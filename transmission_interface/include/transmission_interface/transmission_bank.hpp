@@ -0,0 +1,375 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRANSMISSION_INTERFACE__TRANSMISSION_BANK_HPP_
+#define TRANSMISSION_INTERFACE__TRANSMISSION_BANK_HPP_
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "transmission_interface/accessor.hpp"
+#include "transmission_interface/differential_transmission.hpp"
+#include "transmission_interface/handle.hpp"
+#include "transmission_interface/simple_transmission.hpp"
+
+namespace transmission_interface
+{
+/// Converts many simple and differential transmissions in one pass per interface.
+/**
+ * The transmissions are grouped by type and interface. Every group stores the resolved value
+ * pointers of the actuators and joints and the reductions and offsets of the transmissions in
+ * contiguous arrays. The conversions gather the input values into a buffer, convert the whole
+ * buffer in a loop that the compiler can vectorize, and scatter the results. The results are
+ * identical to the ones of SimpleTransmission and DifferentialTransmission, without a virtual call
+ * and a null check per value.
+ *
+ * \note actuator_to_joint() and joint_to_actuator() don't allocate memory and are real-time safe.
+ * The buffers are allocated when the transmissions are added.
+ */
+class TransmissionBank
+{
+public:
+  /// Configures the transmission with the handles and adds it to the bank.
+  /**
+   * \throws Exception if the handles are not valid for the transmission, the bank is not modified
+   * in this case.
+   */
+  void add(
+    SimpleTransmission & transmission, const std::vector<JointHandle> & joint_handles,
+    const std::vector<ActuatorHandle> & actuator_handles);
+
+  /// Configures the transmission with the handles and adds it to the bank.
+  /**
+   * \throws Exception if the handles are not valid for the transmission, the bank is not modified
+   * in this case.
+   */
+  void add(
+    DifferentialTransmission & transmission, const std::vector<JointHandle> & joint_handles,
+    const std::vector<ActuatorHandle> & actuator_handles);
+
+  /// Removes all the transmissions.
+  void clear();
+
+  std::size_t num_simple_transmissions() const { return num_simple_transmissions_; }
+  std::size_t num_differential_transmissions() const { return num_differential_transmissions_; }
+
+  /// Transforms the values of all the transmissions from actuator to joint space.
+  void actuator_to_joint();
+
+  /// Transforms the values of all the transmissions from joint to actuator space.
+  void joint_to_actuator();
+
+private:
+  /// Interfaces of the transmissions, in the order of the groups
+  static constexpr std::size_t POSITION = 0;
+  static constexpr std::size_t VELOCITY = 1;
+  static constexpr std::size_t EFFORT = 2;
+  static constexpr std::size_t TORQUE = 3;
+  static constexpr std::size_t FORCE = 4;
+  static constexpr std::size_t ABSOLUTE_POSITION = 5;
+  static constexpr std::size_t NUM_INTERFACES = 6;
+
+  static const std::array<std::string, NUM_INTERFACES> & interface_names()
+  {
+    static const std::array<std::string, NUM_INTERFACES> names = {
+      hardware_interface::HW_IF_POSITION, hardware_interface::HW_IF_VELOCITY,
+      hardware_interface::HW_IF_EFFORT,   hardware_interface::HW_IF_TORQUE,
+      hardware_interface::HW_IF_FORCE,    HW_IF_ABSOLUTE_POSITION};
+    return names;
+  }
+
+  /// Simple transmissions that have both the actuator and the joint handle of one interface
+  struct SimpleGroup
+  {
+    std::vector<double *> actuator_values;
+    std::vector<double *> joint_values;
+    std::vector<double> reduction;
+    std::vector<double> offset;
+    std::vector<double> buffer;
+  };
+
+  /// Differential transmissions that have the handles of both actuators and joints of one interface
+  struct DifferentialGroup
+  {
+    std::array<std::vector<double *>, 2> actuator_values;
+    std::array<std::vector<double *>, 2> joint_values;
+    std::array<std::vector<double>, 2> actuator_reduction;
+    std::array<std::vector<double>, 2> joint_reduction;
+    std::array<std::vector<double>, 2> joint_offset;
+    std::array<std::vector<double>, 2> buffer;
+  };
+
+  std::array<SimpleGroup, NUM_INTERFACES> simple_groups_;
+  std::array<DifferentialGroup, NUM_INTERFACES> differential_groups_;
+  std::size_t num_simple_transmissions_ = 0;
+  std::size_t num_differential_transmissions_ = 0;
+};
+
+inline void TransmissionBank::add(
+  SimpleTransmission & transmission, const std::vector<JointHandle> & joint_handles,
+  const std::vector<ActuatorHandle> & actuator_handles)
+{
+  transmission.configure(joint_handles, actuator_handles);
+  for (std::size_t i = 0; i < NUM_INTERFACES; ++i)
+  {
+    const auto joint = get_by_interface(joint_handles, interface_names()[i]);
+    const auto actuator = get_by_interface(actuator_handles, interface_names()[i]);
+    if (!joint || !actuator)
+    {
+      continue;
+    }
+    auto & group = simple_groups_[i];
+    group.actuator_values.push_back(actuator.get_value_ptr());
+    group.joint_values.push_back(joint.get_value_ptr());
+    group.reduction.push_back(transmission.get_actuator_reduction());
+    group.offset.push_back(transmission.get_joint_offset());
+    group.buffer.push_back(0.0);
+  }
+  ++num_simple_transmissions_;
+}
+
+inline void TransmissionBank::add(
+  DifferentialTransmission & transmission, const std::vector<JointHandle> & joint_handles,
+  const std::vector<ActuatorHandle> & actuator_handles)
+{
+  transmission.configure(joint_handles, actuator_handles);
+  // same order of the joints and actuators as DifferentialTransmission::configure()
+  const auto joint_names = get_names(joint_handles);
+  const auto actuator_names = get_names(actuator_handles);
+  for (std::size_t i = 0; i < NUM_INTERFACES; ++i)
+  {
+    const auto joints = get_ordered_handles(joint_handles, joint_names, interface_names()[i]);
+    const auto actuators =
+      get_ordered_handles(actuator_handles, actuator_names, interface_names()[i]);
+    if (joints.size() != 2 || actuators.size() != 2)
+    {
+      continue;
+    }
+    auto & group = differential_groups_[i];
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+      group.actuator_values[k].push_back(actuators[k].get_value_ptr());
+      group.joint_values[k].push_back(joints[k].get_value_ptr());
+      group.actuator_reduction[k].push_back(transmission.get_actuator_reduction()[k]);
+      group.joint_reduction[k].push_back(transmission.get_joint_reduction()[k]);
+      group.joint_offset[k].push_back(transmission.get_joint_offset()[k]);
+      group.buffer[k].push_back(0.0);
+    }
+  }
+  ++num_differential_transmissions_;
+}
+
+inline void TransmissionBank::clear()
+{
+  simple_groups_ = {};
+  differential_groups_ = {};
+  num_simple_transmissions_ = 0;
+  num_differential_transmissions_ = 0;
+}
+
+inline void TransmissionBank::actuator_to_joint()
+{
+  for (std::size_t i = 0; i < NUM_INTERFACES; ++i)
+  {
+    auto & group = simple_groups_[i];
+    const std::size_t size = group.buffer.size();
+    double * buffer = group.buffer.data();
+    const double * n = group.reduction.data();
+    const double * offset = group.offset.data();
+    for (std::size_t t = 0; t < size; ++t)
+    {
+      buffer[t] = *group.actuator_values[t];
+    }
+    if (i == POSITION || i == ABSOLUTE_POSITION)
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        buffer[t] = buffer[t] / n[t] + offset[t];
+      }
+    }
+    else if (i == VELOCITY)
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        buffer[t] = buffer[t] / n[t];
+      }
+    }
+    else
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        buffer[t] = buffer[t] * n[t];
+      }
+    }
+    for (std::size_t t = 0; t < size; ++t)
+    {
+      *group.joint_values[t] = buffer[t];
+    }
+  }
+
+  for (std::size_t i = 0; i < NUM_INTERFACES; ++i)
+  {
+    auto & group = differential_groups_[i];
+    const std::size_t size = group.buffer[0].size();
+    double * b0 = group.buffer[0].data();
+    double * b1 = group.buffer[1].data();
+    const double * ar0 = group.actuator_reduction[0].data();
+    const double * ar1 = group.actuator_reduction[1].data();
+    const double * jr0 = group.joint_reduction[0].data();
+    const double * jr1 = group.joint_reduction[1].data();
+    const double * off0 = group.joint_offset[0].data();
+    const double * off1 = group.joint_offset[1].data();
+    for (std::size_t t = 0; t < size; ++t)
+    {
+      b0[t] = *group.actuator_values[0][t];
+      b1[t] = *group.actuator_values[1][t];
+    }
+    if (i == POSITION || i == VELOCITY || i == ABSOLUTE_POSITION)
+    {
+      // the velocity has no offset
+      const bool has_offset = i != VELOCITY;
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        const double a0 = b0[t] / ar0[t];
+        const double a1 = b1[t] / ar1[t];
+        b0[t] = (a0 + a1) / (2.0 * jr0[t]);
+        b1[t] = (a0 - a1) / (2.0 * jr1[t]);
+      }
+      if (has_offset)
+      {
+        for (std::size_t t = 0; t < size; ++t)
+        {
+          b0[t] = b0[t] + off0[t];
+          b1[t] = b1[t] + off1[t];
+        }
+      }
+    }
+    else
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        const double a0 = b0[t] * ar0[t];
+        const double a1 = b1[t] * ar1[t];
+        b0[t] = jr0[t] * (a0 + a1);
+        b1[t] = jr1[t] * (a0 - a1);
+      }
+    }
+    for (std::size_t t = 0; t < size; ++t)
+    {
+      *group.joint_values[0][t] = b0[t];
+      *group.joint_values[1][t] = b1[t];
+    }
+  }
+}
+
+inline void TransmissionBank::joint_to_actuator()
+{
+  // like the transmissions, the absolute position is only transformed from actuator to joint
+  for (std::size_t i = 0; i < ABSOLUTE_POSITION; ++i)
+  {
+    auto & group = simple_groups_[i];
+    const std::size_t size = group.buffer.size();
+    double * buffer = group.buffer.data();
+    const double * n = group.reduction.data();
+    const double * offset = group.offset.data();
+    for (std::size_t t = 0; t < size; ++t)
+    {
+      buffer[t] = *group.joint_values[t];
+    }
+    if (i == POSITION)
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        buffer[t] = (buffer[t] - offset[t]) * n[t];
+      }
+    }
+    else if (i == VELOCITY)
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        buffer[t] = buffer[t] * n[t];
+      }
+    }
+    else
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        buffer[t] = buffer[t] / n[t];
+      }
+    }
+    for (std::size_t t = 0; t < size; ++t)
+    {
+      *group.actuator_values[t] = buffer[t];
+    }
+  }
+
+  for (std::size_t i = 0; i < ABSOLUTE_POSITION; ++i)
+  {
+    auto & group = differential_groups_[i];
+    const std::size_t size = group.buffer[0].size();
+    double * b0 = group.buffer[0].data();
+    double * b1 = group.buffer[1].data();
+    const double * ar0 = group.actuator_reduction[0].data();
+    const double * ar1 = group.actuator_reduction[1].data();
+    const double * jr0 = group.joint_reduction[0].data();
+    const double * jr1 = group.joint_reduction[1].data();
+    const double * off0 = group.joint_offset[0].data();
+    const double * off1 = group.joint_offset[1].data();
+    for (std::size_t t = 0; t < size; ++t)
+    {
+      b0[t] = *group.joint_values[0][t];
+      b1[t] = *group.joint_values[1][t];
+    }
+    if (i == POSITION)
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        b0[t] = b0[t] - off0[t];
+        b1[t] = b1[t] - off1[t];
+      }
+    }
+    if (i == POSITION || i == VELOCITY)
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        const double j0 = b0[t] * jr0[t];
+        const double j1 = b1[t] * jr1[t];
+        b0[t] = (j0 + j1) * ar0[t];
+        b1[t] = (j0 - j1) * ar1[t];
+      }
+    }
+    else
+    {
+      for (std::size_t t = 0; t < size; ++t)
+      {
+        const double j0 = b0[t] / jr0[t];
+        const double j1 = b1[t] / jr1[t];
+        b0[t] = (j0 + j1) / (2.0 * ar0[t]);
+        b1[t] = (j0 - j1) / (2.0 * ar1[t]);
+      }
+    }
+    for (std::size_t t = 0; t < size; ++t)
+    {
+      *group.actuator_values[0][t] = b0[t];
+      *group.actuator_values[1][t] = b1[t];
+    }
+  }
+}
+
+}  // namespace transmission_interface
+
+#endif  // TRANSMISSION_INTERFACE__TRANSMISSION_BANK_HPP_
@@ -0,0 +1,123 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRANSMISSION_INTERFACE__TRANSMISSION_STAGE_HPP_
+#define TRANSMISSION_INTERFACE__TRANSMISSION_STAGE_HPP_
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/transmission_stage_interface.hpp"
+#include "pluginlib/class_loader.hpp"
+#include "transmission_interface/transmission.hpp"
+#include "transmission_interface/transmission_bank.hpp"
+#include "transmission_interface/transmission_loader.hpp"
+
+namespace transmission_interface
+{
+/// Transmission stage of the ResourceManager, converting the transmissions of all components.
+/**
+ * The transmissions are created with the TransmissionLoader plugins matching their type. Every
+ * transmission is configured twice, once from the actuator to the joint state interfaces and once
+ * from the joint to the actuator command interfaces. The simple and differential transmissions are
+ * converted together by a TransmissionBank, the other types one by one.
+ *
+ * The values of the hardware interfaces are copied into buffers owned by the stage before the
+ * conversion and copied back after it, so the handles are accessed through their thread-safe API.
+ * With set_in_place_binding(), the interfaces of type double are bound in place instead, and only
+ * the other interfaces, e.g., narrowed to float32, are copied.
+ */
+class TransmissionStage : public hardware_interface::TransmissionStageInterface
+{
+public:
+  TransmissionStage();
+
+  /// \copydoc hardware_interface::TransmissionStageInterface::add_transmissions
+  bool add_transmissions(
+    const std::string & component_name,
+    const std::vector<hardware_interface::TransmissionInfo> & transmissions,
+    const StateInterfaceLookup & get_state_interface,
+    const CommandInterfaceLookup & get_command_interface) override;
+
+  void clear() override;
+
+  void set_in_place_binding(bool in_place) override { in_place_binding_ = in_place; }
+
+  void actuator_to_joint() override;
+
+  void joint_to_actuator() override;
+
+  std::size_t num_state_transmissions() const { return num_state_transmissions_; }
+  std::size_t num_command_transmissions() const { return num_command_transmissions_; }
+  /// Returns the number of interfaces bound in place, see set_in_place_binding()
+  std::size_t num_bound_interfaces() const { return num_bound_interfaces_; }
+
+private:
+  /// Hardware interface with its buffered value, given to the transmission handles
+  template <class InterfaceT>
+  struct BufferedInterface
+  {
+    std::shared_ptr<InterfaceT> interface;
+    double * value;
+  };
+  using BufferedStateInterfaces =
+    std::vector<BufferedInterface<hardware_interface::StateInterface>>;
+  using BufferedCommandInterfaces =
+    std::vector<BufferedInterface<hardware_interface::CommandInterface>>;
+
+  /// Returns the loader of the transmission type, loading it if needed.
+  std::shared_ptr<TransmissionLoader> get_loader(const std::string & transmission_type);
+
+  /// Configures the transmission with the handles and adds it to the bank or the generic list.
+  /**
+   * \throws Exception if the handles are not valid for the transmission.
+   */
+  void add_transmission(
+    std::shared_ptr<Transmission> transmission, const std::vector<JointHandle> & joint_handles,
+    const std::vector<ActuatorHandle> & actuator_handles, TransmissionBank & bank,
+    std::vector<std::shared_ptr<Transmission>> & transmissions);
+
+  /// Returns a new buffer, its address is stable until clear() is called.
+  double * make_buffer(double initial_value);
+
+  pluginlib::ClassLoader<TransmissionLoader> loader_;
+  std::unordered_map<std::string, std::shared_ptr<TransmissionLoader>> loaders_;
+
+  /// Values of all the interfaces, a deque so that the handles stay valid while it grows
+  std::deque<double> buffers_;
+
+  TransmissionBank state_bank_;
+  TransmissionBank command_bank_;
+  /// Transmissions of the types that the banks don't support
+  std::vector<std::shared_ptr<Transmission>> state_transmissions_;
+  std::vector<std::shared_ptr<Transmission>> command_transmissions_;
+  std::size_t num_state_transmissions_ = 0;
+  std::size_t num_command_transmissions_ = 0;
+  bool in_place_binding_ = false;
+  std::size_t num_bound_interfaces_ = 0;
+
+  BufferedStateInterfaces actuator_states_;
+  BufferedStateInterfaces joint_states_;
+  BufferedCommandInterfaces joint_commands_;
+  BufferedCommandInterfaces actuator_commands_;
+};
+
+}  // namespace transmission_interface
+
+#endif  // TRANSMISSION_INTERFACE__TRANSMISSION_STAGE_HPP_
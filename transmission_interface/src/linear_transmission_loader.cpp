@@ -0,0 +1,66 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "transmission_interface/linear_transmission_loader.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/lexical_casts.hpp"
+#include "pluginlib/class_list_macros.hpp"
+#include "rclcpp/logging.hpp"
+#include "transmission_interface/linear_transmission.hpp"
+
+namespace transmission_interface
+{
+std::shared_ptr<Transmission> LinearTransmissionLoader::load(
+  const hardware_interface::TransmissionInfo & transmission_info)
+{
+  try
+  {
+    const auto actuator_to_joint = hardware_interface::parse_array<double>(
+      transmission_info.parameters.at("actuator_to_joint"));
+
+    std::vector<double> joint_offset;
+    std::vector<std::string> joint_names;
+    for (const auto & joint : transmission_info.joints)
+    {
+      joint_offset.push_back(joint.offset);
+      joint_names.push_back(joint.name);
+    }
+    std::vector<std::string> actuator_names;
+    for (const auto & actuator : transmission_info.actuators)
+    {
+      actuator_names.push_back(actuator.name);
+    }
+
+    std::shared_ptr<Transmission> transmission(
+      new LinearTransmission(actuator_to_joint, joint_offset, joint_names, actuator_names));
+    return transmission;
+  }
+  catch (const std::exception & ex)
+  {
+    RCLCPP_ERROR(
+      rclcpp::get_logger("linear_transmission_loader"), "Failed to construct transmission '%s'",
+      ex.what());
+    return std::shared_ptr<Transmission>();
+  }
+}
+
+}  // namespace transmission_interface
+
+PLUGINLIB_EXPORT_CLASS(
+  transmission_interface::LinearTransmissionLoader, transmission_interface::TransmissionLoader)
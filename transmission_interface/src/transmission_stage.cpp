@@ -0,0 +1,282 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "transmission_interface/transmission_stage.hpp"
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "pluginlib/class_list_macros.hpp"
+#include "rclcpp/logging.hpp"
+#include "transmission_interface/differential_transmission.hpp"
+#include "transmission_interface/exception.hpp"
+#include "transmission_interface/simple_transmission.hpp"
+
+namespace transmission_interface
+{
+namespace
+{
+rclcpp::Logger get_logger() { return rclcpp::get_logger("transmission_stage"); }
+}  // namespace
+
+TransmissionStage::TransmissionStage()
+: loader_("transmission_interface", "transmission_interface::TransmissionLoader")
+{
+}
+
+bool TransmissionStage::add_transmissions(
+  const std::string & component_name,
+  const std::vector<hardware_interface::TransmissionInfo> & transmissions,
+  const StateInterfaceLookup & get_state_interface,
+  const CommandInterfaceLookup & get_command_interface)
+{
+  // Returns the existing double interfaces of the given names and types
+  auto find_interfaces = [](
+                           const std::vector<std::string> & names,
+                           const std::vector<std::string> & interface_types, const auto & lookup)
+  {
+    std::vector<decltype(lookup(std::string()))> interfaces;
+    for (const auto & name : names)
+    {
+      for (const auto & interface_type : interface_types)
+      {
+        auto interface = lookup(name + "/" + interface_type);
+        if (
+          interface &&
+          (interface->get_data_type() == hardware_interface::HandleDataType::DOUBLE ||
+           interface->is_narrowed_to_float32()))
+        {
+          interfaces.push_back(std::move(interface));
+        }
+      }
+    }
+    return interfaces;
+  };
+  // Creates the handles of the interfaces, bound in place or to a buffer of the stage
+  auto make_handles = [this](const auto & interfaces, auto & handles, auto & buffered_interfaces)
+  {
+    for (const auto & interface : interfaces)
+    {
+      if (
+        in_place_binding_ &&
+        interface->get_data_type() == hardware_interface::HandleDataType::DOUBLE &&
+        !interface->is_lock_free())
+      {
+        handles.emplace_back(*interface);
+        ++num_bound_interfaces_;
+        continue;
+      }
+      double * value = make_buffer(interface->template get_optional<double>().value_or(0.0));
+      handles.emplace_back(interface->get_prefix_name(), interface->get_interface_name(), value);
+      buffered_interfaces.push_back({interface, value});
+    }
+  };
+
+  bool result = true;
+  for (const auto & transmission_info : transmissions)
+  {
+    std::vector<std::string> joint_names;
+    for (const auto & joint : transmission_info.joints)
+    {
+      joint_names.push_back(joint.name);
+    }
+    std::vector<std::string> actuator_names;
+    for (const auto & actuator : transmission_info.actuators)
+    {
+      actuator_names.push_back(actuator.name);
+    }
+
+    try
+    {
+      auto loader = get_loader(transmission_info.type);
+      // a transmission is configured with one set of handles, so every direction has its own
+      auto state_transmission = loader->load(transmission_info);
+      auto command_transmission = loader->load(transmission_info);
+      if (!state_transmission || !command_transmission)
+      {
+        throw Exception("the transmission loader failed");
+      }
+
+      // the interfaces are only bound once the direction of the transmission is known to be used
+      const auto joint_states = find_interfaces(
+        joint_names, state_transmission->get_supported_joint_interfaces(), get_state_interface);
+      const auto actuator_states = find_interfaces(
+        actuator_names, state_transmission->get_supported_actuator_interfaces(),
+        get_state_interface);
+      const bool has_states = !joint_states.empty() && !actuator_states.empty();
+      if (has_states)
+      {
+        std::vector<JointHandle> joint_handles;
+        std::vector<ActuatorHandle> actuator_handles;
+        BufferedStateInterfaces buffered_joint_states, buffered_actuator_states;
+        make_handles(joint_states, joint_handles, buffered_joint_states);
+        make_handles(actuator_states, actuator_handles, buffered_actuator_states);
+        add_transmission(
+          state_transmission, joint_handles, actuator_handles, state_bank_, state_transmissions_);
+        joint_states_.insert(
+          joint_states_.end(), buffered_joint_states.begin(), buffered_joint_states.end());
+        actuator_states_.insert(
+          actuator_states_.end(), buffered_actuator_states.begin(),
+          buffered_actuator_states.end());
+        ++num_state_transmissions_;
+      }
+
+      const auto joint_commands = find_interfaces(
+        joint_names, command_transmission->get_supported_joint_interfaces(),
+        get_command_interface);
+      const auto actuator_commands = find_interfaces(
+        actuator_names, command_transmission->get_supported_actuator_interfaces(),
+        get_command_interface);
+      const bool has_commands = !joint_commands.empty() && !actuator_commands.empty();
+      if (has_commands)
+      {
+        std::vector<JointHandle> joint_handles;
+        std::vector<ActuatorHandle> actuator_handles;
+        BufferedCommandInterfaces buffered_joint_commands, buffered_actuator_commands;
+        make_handles(joint_commands, joint_handles, buffered_joint_commands);
+        make_handles(actuator_commands, actuator_handles, buffered_actuator_commands);
+        add_transmission(
+          command_transmission, joint_handles, actuator_handles, command_bank_,
+          command_transmissions_);
+        joint_commands_.insert(
+          joint_commands_.end(), buffered_joint_commands.begin(), buffered_joint_commands.end());
+        actuator_commands_.insert(
+          actuator_commands_.end(), buffered_actuator_commands.begin(),
+          buffered_actuator_commands.end());
+        ++num_command_transmissions_;
+      }
+
+      if (!has_states && !has_commands)
+      {
+        throw Exception("the component doesn't export any of its joint and actuator interfaces");
+      }
+      RCLCPP_DEBUG(
+        get_logger(), "Added transmission '%s' of the hardware component '%s'.",
+        transmission_info.name.c_str(), component_name.c_str());
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Unable to add the transmission '%s' of the hardware component '%s': %s",
+        transmission_info.name.c_str(), component_name.c_str(), e.what());
+      result = false;
+    }
+  }
+  return result;
+}
+
+void TransmissionStage::clear()
+{
+  state_bank_.clear();
+  command_bank_.clear();
+  state_transmissions_.clear();
+  command_transmissions_.clear();
+  num_state_transmissions_ = 0;
+  num_command_transmissions_ = 0;
+  num_bound_interfaces_ = 0;
+  actuator_states_.clear();
+  joint_states_.clear();
+  joint_commands_.clear();
+  actuator_commands_.clear();
+  buffers_.clear();
+}
+
+void TransmissionStage::actuator_to_joint()
+{
+  for (auto & actuator_state : actuator_states_)
+  {
+    // the previous value is kept if the interface is locked by another thread
+    const auto value = actuator_state.interface->get_optional<double>();
+    if (value.has_value())
+    {
+      *actuator_state.value = value.value();
+    }
+  }
+  state_bank_.actuator_to_joint();
+  for (auto & transmission : state_transmissions_)
+  {
+    transmission->actuator_to_joint();
+  }
+  for (auto & joint_state : joint_states_)
+  {
+    std::ignore = joint_state.interface->set_value(*joint_state.value);
+  }
+}
+
+void TransmissionStage::joint_to_actuator()
+{
+  for (auto & joint_command : joint_commands_)
+  {
+    // the previous value is kept if the interface is locked by another thread
+    const auto value = joint_command.interface->get_optional<double>();
+    if (value.has_value())
+    {
+      *joint_command.value = value.value();
+    }
+  }
+  command_bank_.joint_to_actuator();
+  for (auto & transmission : command_transmissions_)
+  {
+    transmission->joint_to_actuator();
+  }
+  for (auto & actuator_command : actuator_commands_)
+  {
+    std::ignore = actuator_command.interface->set_value(*actuator_command.value);
+  }
+}
+
+std::shared_ptr<TransmissionLoader> TransmissionStage::get_loader(
+  const std::string & transmission_type)
+{
+  auto it = loaders_.find(transmission_type);
+  if (it == loaders_.end())
+  {
+    it = loaders_.emplace(transmission_type, loader_.createSharedInstance(transmission_type)).first;
+  }
+  return it->second;
+}
+
+void TransmissionStage::add_transmission(
+  std::shared_ptr<Transmission> transmission, const std::vector<JointHandle> & joint_handles,
+  const std::vector<ActuatorHandle> & actuator_handles, TransmissionBank & bank,
+  std::vector<std::shared_ptr<Transmission>> & transmissions)
+{
+  if (auto simple = std::dynamic_pointer_cast<SimpleTransmission>(transmission))
+  {
+    bank.add(*simple, joint_handles, actuator_handles);
+  }
+  else if (auto differential = std::dynamic_pointer_cast<DifferentialTransmission>(transmission))
+  {
+    bank.add(*differential, joint_handles, actuator_handles);
+  }
+  else
+  {
+    transmission->configure(joint_handles, actuator_handles);
+    transmissions.push_back(std::move(transmission));
+  }
+}
+
+double * TransmissionStage::make_buffer(double initial_value)
+{
+  buffers_.push_back(initial_value);
+  return &buffers_.back();
+}
+
+}  // namespace transmission_interface
+
+PLUGINLIB_EXPORT_CLASS(
+  transmission_interface::TransmissionStage, hardware_interface::TransmissionStageInterface)
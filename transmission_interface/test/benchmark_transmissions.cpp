@@ -0,0 +1,216 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "transmission_interface/differential_transmission.hpp"
+#include "transmission_interface/four_bar_linkage_transmission.hpp"
+#include "transmission_interface/simple_transmission.hpp"
+#include "transmission_interface/transmission_bank.hpp"
+
+using hardware_interface::HW_IF_EFFORT;
+using hardware_interface::HW_IF_POSITION;
+using hardware_interface::HW_IF_VELOCITY;
+using transmission_interface::ActuatorHandle;
+using transmission_interface::DifferentialTransmission;
+using transmission_interface::FourBarLinkageTransmission;
+using transmission_interface::JointHandle;
+using transmission_interface::SimpleTransmission;
+using transmission_interface::Transmission;
+using transmission_interface::TransmissionBank;
+
+namespace
+{
+constexpr int MAX_JOINTS = 256;
+const std::array<std::string, 3> INTERFACES = {HW_IF_POSITION, HW_IF_VELOCITY, HW_IF_EFFORT};
+
+std::unique_ptr<Transmission> make_transmission(SimpleTransmission *)
+{
+  return std::make_unique<SimpleTransmission>(10.0, 1.0);
+}
+
+std::unique_ptr<Transmission> make_transmission(DifferentialTransmission *)
+{
+  return std::make_unique<DifferentialTransmission>(
+    std::vector<double>{10.0, 10.0}, std::vector<double>{2.0, 2.0}, std::vector<double>{0.5, 0.5});
+}
+
+std::unique_ptr<Transmission> make_transmission(FourBarLinkageTransmission *)
+{
+  return std::make_unique<FourBarLinkageTransmission>(
+    std::vector<double>{10.0, 10.0}, std::vector<double>{2.0, 2.0}, std::vector<double>{0.5, 0.5});
+}
+
+/// Transmissions of the joints of a robot, with the position, velocity and effort of every joint
+/// and actuator, converted one by one or by a TransmissionBank.
+struct TransmissionChain
+{
+  explicit TransmissionChain(std::size_t number_of_joints)
+  : joint_values(INTERFACES.size() * number_of_joints, 0.0),
+    actuator_values(INTERFACES.size() * number_of_joints, 0.0)
+  {
+  }
+
+  /// Values of the interface of a joint or an actuator, one contiguous block per interface
+  double * value(std::vector<double> & values, std::size_t interface, std::size_t index)
+  {
+    return &values[interface * (values.size() / INTERFACES.size()) + index];
+  }
+
+  void actuator_to_joint()
+  {
+    if (use_bank)
+    {
+      bank.actuator_to_joint();
+      return;
+    }
+    for (const auto & transmission : transmissions)
+    {
+      transmission->actuator_to_joint();
+    }
+  }
+
+  void joint_to_actuator()
+  {
+    if (use_bank)
+    {
+      bank.joint_to_actuator();
+      return;
+    }
+    for (const auto & transmission : transmissions)
+    {
+      transmission->joint_to_actuator();
+    }
+  }
+
+  std::vector<std::unique_ptr<Transmission>> transmissions;
+  TransmissionBank bank;
+  bool use_bank = false;
+  std::vector<double> joint_values;
+  std::vector<double> actuator_values;
+};
+
+template <typename TransmissionType, bool UseBank>
+std::unique_ptr<TransmissionChain> make_chain(std::size_t number_of_joints)
+{
+  const std::size_t joints_per_transmission =
+    make_transmission(static_cast<TransmissionType *>(nullptr))->num_joints();
+  auto chain = std::make_unique<TransmissionChain>(number_of_joints);
+  chain->use_bank = UseBank;
+  for (std::size_t first = 0; first + joints_per_transmission <= number_of_joints;
+       first += joints_per_transmission)
+  {
+    std::vector<JointHandle> joint_handles;
+    std::vector<ActuatorHandle> actuator_handles;
+    for (std::size_t i = first; i < first + joints_per_transmission; ++i)
+    {
+      for (std::size_t interface = 0; interface < INTERFACES.size(); ++interface)
+      {
+        joint_handles.emplace_back(
+          "joint" + std::to_string(i), INTERFACES[interface],
+          chain->value(chain->joint_values, interface, i));
+        actuator_handles.emplace_back(
+          "actuator" + std::to_string(i), INTERFACES[interface],
+          chain->value(chain->actuator_values, interface, i));
+      }
+    }
+    auto transmission = make_transmission(static_cast<TransmissionType *>(nullptr));
+    if constexpr (UseBank)
+    {
+      chain->bank.add(
+        static_cast<TransmissionType &>(*transmission), joint_handles, actuator_handles);
+    }
+    else
+    {
+      transmission->configure(joint_handles, actuator_handles);
+    }
+    chain->transmissions.push_back(std::move(transmission));
+  }
+  return chain;
+}
+
+void report_joints(benchmark::State & state, std::size_t number_of_joints)
+{
+  state.counters["joints"] = static_cast<double>(number_of_joints);
+  // the inverted rate of the processed joints is the time per joint
+  state.counters["time_per_joint"] = benchmark::Counter(
+    static_cast<double>(state.iterations()) * static_cast<double>(number_of_joints),
+    benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/// Maps the state of all the actuators to the joints, like the read() of a hardware component.
+template <typename TransmissionType, bool UseBank>
+void actuator_to_joint(benchmark::State & state)
+{
+  const auto number_of_joints = static_cast<std::size_t>(state.range(0));
+  const auto chain = make_chain<TransmissionType, UseBank>(number_of_joints);
+  double offset = 0.0;
+  for (auto _ : state)
+  {
+    // new actuator values at every cycle
+    offset += 1e-3;
+    for (std::size_t i = 0; i < chain->actuator_values.size(); ++i)
+    {
+      chain->actuator_values[i] = offset + static_cast<double>(i);
+    }
+    chain->actuator_to_joint();
+    benchmark::DoNotOptimize(chain->joint_values.data());
+    benchmark::ClobberMemory();
+  }
+  report_joints(state, number_of_joints);
+}
+
+/// Maps the commands of all the joints to the actuators, like the write() of a hardware component.
+template <typename TransmissionType, bool UseBank>
+void joint_to_actuator(benchmark::State & state)
+{
+  const auto number_of_joints = static_cast<std::size_t>(state.range(0));
+  const auto chain = make_chain<TransmissionType, UseBank>(number_of_joints);
+  double offset = 0.0;
+  for (auto _ : state)
+  {
+    offset += 1e-3;
+    for (std::size_t i = 0; i < chain->joint_values.size(); ++i)
+    {
+      chain->joint_values[i] = offset + static_cast<double>(i);
+    }
+    chain->joint_to_actuator();
+    benchmark::DoNotOptimize(chain->actuator_values.data());
+    benchmark::ClobberMemory();
+  }
+  report_joints(state, number_of_joints);
+}
+}  // namespace
+
+#define REGISTER_TRANSMISSION_BENCHMARKS(TransmissionType, UseBank, MinJoints)      \
+  BENCHMARK_TEMPLATE(actuator_to_joint, TransmissionType, UseBank)                  \
+    ->RangeMultiplier(2)                                                            \
+    ->Range(MinJoints, MAX_JOINTS);                                                 \
+  BENCHMARK_TEMPLATE(joint_to_actuator, TransmissionType, UseBank)                  \
+    ->RangeMultiplier(2)                                                            \
+    ->Range(MinJoints, MAX_JOINTS)
+
+// the differential and four-bar linkage transmissions couple two joints, the bank only converts
+// the simple and differential transmissions
+REGISTER_TRANSMISSION_BENCHMARKS(SimpleTransmission, false, 1);
+REGISTER_TRANSMISSION_BENCHMARKS(SimpleTransmission, true, 1);
+REGISTER_TRANSMISSION_BENCHMARKS(DifferentialTransmission, false, 2);
+REGISTER_TRANSMISSION_BENCHMARKS(DifferentialTransmission, true, 2);
+REGISTER_TRANSMISSION_BENCHMARKS(FourBarLinkageTransmission, false, 2);
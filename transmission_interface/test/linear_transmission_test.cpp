@@ -0,0 +1,187 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "transmission_interface/four_bar_linkage_transmission.hpp"
+#include "transmission_interface/linear_transmission.hpp"
+
+using hardware_interface::HW_IF_EFFORT;
+using hardware_interface::HW_IF_POSITION;
+using hardware_interface::HW_IF_VELOCITY;
+using testing::DoubleNear;
+using transmission_interface::ActuatorHandle;
+using transmission_interface::Exception;
+using transmission_interface::FourBarLinkageTransmission;
+using transmission_interface::JointHandle;
+using transmission_interface::LinearTransmission;
+
+// Floating-point value comparison threshold
+const double EPS = 1e-9;
+
+namespace
+{
+const std::vector<std::string> INTERFACES = {HW_IF_POSITION, HW_IF_VELOCITY, HW_IF_EFFORT};
+
+/// Position, velocity and effort of one joint or actuator, with one handle per interface
+struct Values
+{
+  explicit Values(const std::string & name) : name(name) { values.fill(0.0); }
+
+  template <class HandleType>
+  void add_handles(std::vector<HandleType> & handles)
+  {
+    for (std::size_t i = 0; i < INTERFACES.size(); ++i)
+    {
+      handles.emplace_back(name, INTERFACES[i], &values[i]);
+    }
+  }
+
+  std::string name;
+  std::array<double, 3> values;
+};
+}  // namespace
+
+TEST(LinearTransmissionTest, rejects_invalid_matrices)
+{
+  EXPECT_THROW(LinearTransmission({}), Exception);
+  EXPECT_THROW(LinearTransmission({1.0, 2.0, 3.0}), Exception);
+  EXPECT_THROW(LinearTransmission({1.0, 2.0, 2.0, 4.0}), Exception);
+  EXPECT_THROW(LinearTransmission({1.0, 0.0, 0.0, 1.0}, {1.0}), Exception);
+  EXPECT_THROW(LinearTransmission({1.0, 0.0, 0.0, 1.0}, {}, {"joint1"}), Exception);
+  EXPECT_NO_THROW(LinearTransmission({0.0, 1.0, 1.0, 0.0}, {0.5, -0.5}));
+
+  const LinearTransmission transmission({2.0, 0.0, 1.0, 4.0});
+  EXPECT_EQ(2u, transmission.num_joints());
+  EXPECT_EQ(2u, transmission.num_actuators());
+  EXPECT_THAT(
+    transmission.get_joint_to_actuator(),
+    testing::Pointwise(DoubleNear(EPS), std::vector<double>{0.5, 0.0, -0.125, 0.25}));
+}
+
+TEST(LinearTransmissionTest, matches_four_bar_linkage_transmission)
+{
+  const std::vector<double> actuator_reduction = {2.0, -3.0};
+  const std::vector<double> joint_reduction = {4.0, 1.5};
+  const std::vector<double> joint_offset = {0.5, -1.0};
+  FourBarLinkageTransmission four_bar(actuator_reduction, joint_reduction, joint_offset);
+  const double n0 = joint_reduction[0] * actuator_reduction[0];
+  const double n1 = joint_reduction[1] * actuator_reduction[1];
+  LinearTransmission linear(
+    {1.0 / n0, 0.0, -1.0 / (n0 * joint_reduction[1]), 1.0 / n1}, joint_offset);
+
+  std::vector<Values> joints = {Values("joint1"), Values("joint2")};
+  std::vector<Values> actuators = {Values("actuator1"), Values("actuator2")};
+  auto reference_joints = joints;
+  auto reference_actuators = actuators;
+  auto configure = [](auto & transmission, auto & joint_values, auto & actuator_values)
+  {
+    std::vector<JointHandle> joint_handles;
+    std::vector<ActuatorHandle> actuator_handles;
+    for (auto & value : joint_values)
+    {
+      value.add_handles(joint_handles);
+    }
+    for (auto & value : actuator_values)
+    {
+      value.add_handles(actuator_handles);
+    }
+    transmission.configure(joint_handles, actuator_handles);
+  };
+  configure(linear, joints, actuators);
+  configure(four_bar, reference_joints, reference_actuators);
+
+  actuators[0].values = reference_actuators[0].values = {1.5, -0.25, 3.0};
+  actuators[1].values = reference_actuators[1].values = {-2.0, 0.75, -1.0};
+  linear.actuator_to_joint();
+  four_bar.actuator_to_joint();
+  for (std::size_t i = 0; i < joints.size(); ++i)
+  {
+    EXPECT_THAT(joints[i].values, testing::Pointwise(DoubleNear(EPS), reference_joints[i].values));
+  }
+
+  joints[0].values = reference_joints[0].values = {0.25, 1.0, -2.0};
+  joints[1].values = reference_joints[1].values = {-0.5, -1.5, 0.5};
+  linear.joint_to_actuator();
+  four_bar.joint_to_actuator();
+  for (std::size_t i = 0; i < actuators.size(); ++i)
+  {
+    EXPECT_THAT(
+      actuators[i].values, testing::Pointwise(DoubleNear(EPS), reference_actuators[i].values));
+  }
+}
+
+TEST(LinearTransmissionTest, round_trip_follows_the_given_order)
+{
+  // the joints are intentionally not sorted by name
+  LinearTransmission transmission(
+    {1.0, 2.0, 0.0, 0.0, 1.0, -1.0, 3.0, 0.0, 1.0}, {0.1, 0.2, 0.3},
+    {"wrist_c", "wrist_a", "wrist_b"}, {"motor1", "motor2", "motor3"});
+  std::vector<Values> joints = {Values("wrist_a"), Values("wrist_b"), Values("wrist_c")};
+  std::vector<Values> actuators = {Values("motor1"), Values("motor2"), Values("motor3")};
+  std::vector<JointHandle> joint_handles;
+  std::vector<ActuatorHandle> actuator_handles;
+  for (std::size_t i = 0; i < joints.size(); ++i)
+  {
+    joints[i].add_handles(joint_handles);
+    actuators[i].add_handles(actuator_handles);
+  }
+  transmission.configure(joint_handles, actuator_handles);
+
+  actuators[0].values = {1.0, 2.0, 3.0};
+  actuators[1].values = {-1.0, 0.5, 1.0};
+  actuators[2].values = {2.0, -2.0, 0.0};
+  const auto reference_actuators = actuators;
+  transmission.actuator_to_joint();
+  // first row of the matrix: wrist_c = motor1 + 2 * motor2 + 0.1
+  EXPECT_THAT(joints[2].values[0], DoubleNear(1.0 - 2.0 + 0.1, EPS));
+  EXPECT_THAT(joints[2].values[1], DoubleNear(2.0 + 1.0, EPS));
+
+  for (auto & actuator : actuators)
+  {
+    actuator.values.fill(0.0);
+  }
+  transmission.joint_to_actuator();
+  for (std::size_t i = 0; i < actuators.size(); ++i)
+  {
+    EXPECT_THAT(
+      actuators[i].values, testing::Pointwise(DoubleNear(EPS), reference_actuators[i].values));
+  }
+}
+
+TEST(LinearTransmissionTest, rejects_invalid_handles)
+{
+  LinearTransmission transmission({1.0, 0.0, 0.0, 1.0});
+  double value = 0.0;
+  EXPECT_THROW(transmission.configure({}, {}), Exception);
+  // one joint only
+  EXPECT_THROW(
+    transmission.configure(
+      {JointHandle("joint1", HW_IF_POSITION, &value)},
+      {ActuatorHandle("actuator1", HW_IF_POSITION, &value),
+       ActuatorHandle("actuator2", HW_IF_POSITION, &value)}),
+    Exception);
+  // position on the joints and velocity on the actuators
+  EXPECT_THROW(
+    transmission.configure(
+      {JointHandle("joint1", HW_IF_POSITION, &value),
+       JointHandle("joint2", HW_IF_POSITION, &value)},
+      {ActuatorHandle("actuator1", HW_IF_VELOCITY, &value),
+       ActuatorHandle("actuator2", HW_IF_VELOCITY, &value)}),
+    Exception);
+}
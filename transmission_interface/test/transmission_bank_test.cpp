@@ -0,0 +1,223 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "transmission_interface/transmission_bank.hpp"
+
+using hardware_interface::HW_IF_EFFORT;
+using hardware_interface::HW_IF_FORCE;
+using hardware_interface::HW_IF_POSITION;
+using hardware_interface::HW_IF_TORQUE;
+using hardware_interface::HW_IF_VELOCITY;
+using transmission_interface::ActuatorHandle;
+using transmission_interface::DifferentialTransmission;
+using transmission_interface::Exception;
+using transmission_interface::HW_IF_ABSOLUTE_POSITION;
+using transmission_interface::JointHandle;
+using transmission_interface::SimpleTransmission;
+using transmission_interface::TransmissionBank;
+
+namespace
+{
+const std::vector<std::string> INTERFACES = {HW_IF_POSITION, HW_IF_VELOCITY,
+                                             HW_IF_EFFORT,   HW_IF_TORQUE,
+                                             HW_IF_FORCE,    HW_IF_ABSOLUTE_POSITION};
+
+/// Values of the interfaces of one joint or actuator, with one handle per interface
+struct Values
+{
+  explicit Values(const std::string & name) : name(name) { values.fill(0.0); }
+
+  template <class HandleType>
+  std::vector<HandleType> handles()
+  {
+    std::vector<HandleType> result;
+    for (std::size_t i = 0; i < INTERFACES.size(); ++i)
+    {
+      result.emplace_back(name, INTERFACES[i], &values[i]);
+    }
+    return result;
+  }
+
+  std::string name;
+  std::array<double, 6> values;
+};
+}  // namespace
+
+TEST(TransmissionBankTest, matches_simple_transmissions)
+{
+  std::vector<SimpleTransmission> transmissions = {
+    SimpleTransmission(10.0), SimpleTransmission(-2.5, 1.0), SimpleTransmission(0.5, -0.5)};
+  std::vector<Values> joints, actuators, reference_joints, reference_actuators;
+  for (std::size_t i = 0; i < transmissions.size(); ++i)
+  {
+    joints.emplace_back("joint" + std::to_string(i));
+    actuators.emplace_back("actuator" + std::to_string(i));
+  }
+  reference_joints = joints;
+  reference_actuators = actuators;
+
+  TransmissionBank bank;
+  std::vector<SimpleTransmission> reference_transmissions = transmissions;
+  for (std::size_t i = 0; i < transmissions.size(); ++i)
+  {
+    bank.add(
+      transmissions[i], joints[i].handles<JointHandle>(), actuators[i].handles<ActuatorHandle>());
+    reference_transmissions[i].configure(
+      reference_joints[i].handles<JointHandle>(),
+      reference_actuators[i].handles<ActuatorHandle>());
+  }
+  EXPECT_EQ(3u, bank.num_simple_transmissions());
+  EXPECT_EQ(0u, bank.num_differential_transmissions());
+
+  for (std::size_t i = 0; i < transmissions.size(); ++i)
+  {
+    for (std::size_t k = 0; k < INTERFACES.size(); ++k)
+    {
+      actuators[i].values[k] = reference_actuators[i].values[k] = 1.5 * i - 0.25 * k + 0.1;
+    }
+  }
+  bank.actuator_to_joint();
+  for (auto & transmission : reference_transmissions)
+  {
+    transmission.actuator_to_joint();
+  }
+  for (std::size_t i = 0; i < transmissions.size(); ++i)
+  {
+    EXPECT_EQ(reference_joints[i].values, joints[i].values);
+  }
+
+  for (std::size_t i = 0; i < transmissions.size(); ++i)
+  {
+    for (std::size_t k = 0; k < INTERFACES.size(); ++k)
+    {
+      joints[i].values[k] = reference_joints[i].values[k] = -0.5 * i + 0.75 * k - 0.2;
+    }
+  }
+  bank.joint_to_actuator();
+  for (auto & transmission : reference_transmissions)
+  {
+    transmission.joint_to_actuator();
+  }
+  for (std::size_t i = 0; i < transmissions.size(); ++i)
+  {
+    EXPECT_EQ(reference_actuators[i].values, actuators[i].values);
+  }
+}
+
+TEST(TransmissionBankTest, matches_differential_transmissions)
+{
+  std::vector<DifferentialTransmission> transmissions = {
+    DifferentialTransmission({2.0, -2.0}, {4.0, -4.0}, {1.0, -1.0}),
+    DifferentialTransmission({10.0, 10.0}, {1.0, 1.0})};
+  std::vector<Values> joints, actuators, reference_joints, reference_actuators;
+  for (std::size_t i = 0; i < 2 * transmissions.size(); ++i)
+  {
+    joints.emplace_back("joint" + std::to_string(i));
+    actuators.emplace_back("actuator" + std::to_string(i));
+  }
+  reference_joints = joints;
+  reference_actuators = actuators;
+
+  auto concat = [](auto first, const auto & second)
+  {
+    first.insert(first.end(), second.begin(), second.end());
+    return first;
+  };
+  TransmissionBank bank;
+  std::vector<DifferentialTransmission> reference_transmissions = transmissions;
+  for (std::size_t i = 0; i < transmissions.size(); ++i)
+  {
+    bank.add(
+      transmissions[i],
+      concat(joints[2 * i].handles<JointHandle>(), joints[2 * i + 1].handles<JointHandle>()),
+      concat(
+        actuators[2 * i].handles<ActuatorHandle>(),
+        actuators[2 * i + 1].handles<ActuatorHandle>()));
+    reference_transmissions[i].configure(
+      concat(
+        reference_joints[2 * i].handles<JointHandle>(),
+        reference_joints[2 * i + 1].handles<JointHandle>()),
+      concat(
+        reference_actuators[2 * i].handles<ActuatorHandle>(),
+        reference_actuators[2 * i + 1].handles<ActuatorHandle>()));
+  }
+  EXPECT_EQ(0u, bank.num_simple_transmissions());
+  EXPECT_EQ(2u, bank.num_differential_transmissions());
+
+  for (std::size_t i = 0; i < actuators.size(); ++i)
+  {
+    for (std::size_t k = 0; k < INTERFACES.size(); ++k)
+    {
+      actuators[i].values[k] = reference_actuators[i].values[k] = 1.5 * i - 0.25 * k + 0.1;
+    }
+  }
+  bank.actuator_to_joint();
+  for (auto & transmission : reference_transmissions)
+  {
+    transmission.actuator_to_joint();
+  }
+  for (std::size_t i = 0; i < joints.size(); ++i)
+  {
+    EXPECT_EQ(reference_joints[i].values, joints[i].values);
+  }
+
+  for (std::size_t i = 0; i < joints.size(); ++i)
+  {
+    for (std::size_t k = 0; k < INTERFACES.size(); ++k)
+    {
+      joints[i].values[k] = reference_joints[i].values[k] = -0.5 * i + 0.75 * k - 0.2;
+    }
+  }
+  bank.joint_to_actuator();
+  for (auto & transmission : reference_transmissions)
+  {
+    transmission.joint_to_actuator();
+  }
+  for (std::size_t i = 0; i < actuators.size(); ++i)
+  {
+    EXPECT_EQ(reference_actuators[i].values, actuators[i].values);
+  }
+}
+
+TEST(TransmissionBankTest, skips_missing_interfaces_and_rejects_invalid_handles)
+{
+  SimpleTransmission transmission(2.0);
+  double actuator_velocity = 4.0;
+  double joint_velocity = 0.0;
+  double joint_position = 0.0;
+  TransmissionBank bank;
+  EXPECT_THROW(bank.add(transmission, {}, {}), Exception);
+  EXPECT_EQ(0u, bank.num_simple_transmissions());
+
+  bank.add(
+    transmission,
+    {JointHandle("joint", HW_IF_VELOCITY, &joint_velocity),
+     JointHandle("joint", HW_IF_POSITION, &joint_position)},
+    {ActuatorHandle("actuator", HW_IF_VELOCITY, &actuator_velocity)});
+  bank.actuator_to_joint();
+  EXPECT_DOUBLE_EQ(2.0, joint_velocity);
+  EXPECT_DOUBLE_EQ(0.0, joint_position);
+
+  bank.clear();
+  EXPECT_EQ(0u, bank.num_simple_transmissions());
+  joint_velocity = 0.0;
+  bank.actuator_to_joint();
+  EXPECT_DOUBLE_EQ(0.0, joint_velocity);
+}
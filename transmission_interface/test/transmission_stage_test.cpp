@@ -0,0 +1,227 @@
+// Copyright 2026 ros2_control Development Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/transmission_stage_interface.hpp"
+#include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "pluginlib/class_loader.hpp"
+#include "transmission_interface/transmission_stage.hpp"
+
+using hardware_interface::CommandInterface;
+using hardware_interface::HW_IF_POSITION;
+using hardware_interface::HW_IF_VELOCITY;
+using hardware_interface::StateInterface;
+using transmission_interface::TransmissionStage;
+
+namespace
+{
+/// Interfaces of a fake hardware component, looked up by the stage
+class TransmissionStageTest : public ::testing::Test
+{
+protected:
+  void add_interface(const std::string & prefix, const std::string & type, bool is_command)
+  {
+    hardware_interface::InterfaceInfo info;
+    info.name = type;
+    info.data_type = "double";
+    const hardware_interface::InterfaceDescription description(prefix, info);
+    if (is_command)
+    {
+      command_interfaces_[description.get_name()] = std::make_shared<CommandInterface>(description);
+    }
+    else
+    {
+      state_interfaces_[description.get_name()] = std::make_shared<StateInterface>(description);
+    }
+  }
+
+  double get_state(const std::string & name) const
+  {
+    return state_interfaces_.at(name)->get_optional().value();
+  }
+
+  double get_command(const std::string & name) const
+  {
+    return command_interfaces_.at(name)->get_optional().value();
+  }
+
+  bool add_transmissions(
+    hardware_interface::TransmissionStageInterface & stage,
+    const std::vector<hardware_interface::TransmissionInfo> & transmissions)
+  {
+    return stage.add_transmissions(
+      "component", transmissions,
+      [this](const std::string & name) -> StateInterface::SharedPtr
+      {
+        const auto it = state_interfaces_.find(name);
+        return it == state_interfaces_.end() ? nullptr : it->second;
+      },
+      [this](const std::string & name) -> CommandInterface::SharedPtr
+      {
+        const auto it = command_interfaces_.find(name);
+        return it == command_interfaces_.end() ? nullptr : it->second;
+      });
+  }
+
+  static hardware_interface::TransmissionInfo make_transmission(
+    const std::string & name, const std::string & type, const std::vector<std::string> & joints,
+    const std::vector<std::string> & actuators, double reduction)
+  {
+    hardware_interface::TransmissionInfo info;
+    info.name = name;
+    info.type = type;
+    for (const auto & joint_name : joints)
+    {
+      hardware_interface::JointInfo joint;
+      joint.name = joint_name;
+      joint.mechanical_reduction = reduction;
+      info.joints.push_back(joint);
+    }
+    for (const auto & actuator_name : actuators)
+    {
+      hardware_interface::ActuatorInfo actuator;
+      actuator.name = actuator_name;
+      info.actuators.push_back(actuator);
+    }
+    return info;
+  }
+
+  std::map<std::string, StateInterface::SharedPtr> state_interfaces_;
+  std::map<std::string, CommandInterface::SharedPtr> command_interfaces_;
+};
+}  // namespace
+
+TEST_F(TransmissionStageTest, converts_states_and_commands_of_all_transmission_types)
+{
+  for (const auto & name : {"joint1", "actuator1", "joint2", "joint3", "actuator2", "actuator3"})
+  {
+    add_interface(name, HW_IF_POSITION, false);
+    add_interface(name, HW_IF_VELOCITY, false);
+    add_interface(name, HW_IF_POSITION, true);
+  }
+  TransmissionStage stage;
+  ASSERT_TRUE(add_transmissions(
+    stage, {make_transmission(
+              "simple", "transmission_interface/SimpleTransmission", {"joint1"}, {"actuator1"},
+              10.0),
+            make_transmission(
+              "four_bar", "transmission_interface/FourBarLinkageTransmission",
+              {"joint2", "joint3"}, {"actuator2", "actuator3"}, 2.0)}));
+  EXPECT_EQ(2u, stage.num_state_transmissions());
+  EXPECT_EQ(2u, stage.num_command_transmissions());
+
+  ASSERT_TRUE(state_interfaces_.at("actuator1/position")->set_value(5.0));
+  ASSERT_TRUE(state_interfaces_.at("actuator1/velocity")->set_value(-10.0));
+  ASSERT_TRUE(state_interfaces_.at("actuator2/position")->set_value(1.0));
+  stage.actuator_to_joint();
+  EXPECT_DOUBLE_EQ(0.5, get_state("joint1/position"));
+  EXPECT_DOUBLE_EQ(-1.0, get_state("joint1/velocity"));
+  EXPECT_NE(0.0, get_state("joint2/position"));
+
+  ASSERT_TRUE(command_interfaces_.at("joint1/position")->set_value(2.0));
+  stage.joint_to_actuator();
+  EXPECT_DOUBLE_EQ(20.0, get_command("actuator1/position"));
+  // the joint states are not modified by the commands
+  EXPECT_DOUBLE_EQ(0.5, get_state("joint1/position"));
+
+  stage.clear();
+  EXPECT_EQ(0u, stage.num_state_transmissions());
+  EXPECT_EQ(0u, stage.num_command_transmissions());
+  ASSERT_TRUE(state_interfaces_.at("actuator1/position")->set_value(8.0));
+  stage.actuator_to_joint();
+  EXPECT_DOUBLE_EQ(0.5, get_state("joint1/position"));
+}
+
+TEST_F(TransmissionStageTest, reports_transmissions_that_cannot_be_added)
+{
+  add_interface("joint1", HW_IF_POSITION, false);
+  add_interface("actuator1", HW_IF_POSITION, false);
+  TransmissionStage stage;
+  // unknown type, interfaces not exported by the component, and a read-only transmission
+  EXPECT_FALSE(add_transmissions(
+    stage, {make_transmission("unknown", "transmission_interface/Unknown", {"joint1"},
+                              {"actuator1"}, 1.0),
+            make_transmission(
+              "missing", "transmission_interface/SimpleTransmission", {"joint4"}, {"actuator4"},
+              1.0),
+            make_transmission(
+              "read_only", "transmission_interface/SimpleTransmission", {"joint1"},
+              {"actuator1"}, 4.0)}));
+  EXPECT_EQ(1u, stage.num_state_transmissions());
+  EXPECT_EQ(0u, stage.num_command_transmissions());
+
+  ASSERT_TRUE(state_interfaces_.at("actuator1/position")->set_value(2.0));
+  stage.actuator_to_joint();
+  EXPECT_DOUBLE_EQ(0.5, get_state("joint1/position"));
+}
+
+TEST_F(TransmissionStageTest, binds_the_transmissions_in_place)
+{
+  for (const auto & name : {"joint1", "actuator1"})
+  {
+    add_interface(name, HW_IF_POSITION, false);
+    add_interface(name, HW_IF_POSITION, true);
+  }
+  // an interface that isn't of type double is still copied
+  hardware_interface::InterfaceInfo info;
+  info.name = HW_IF_VELOCITY;
+  info.data_type = "double";
+  info.lock_free = true;
+  const hardware_interface::InterfaceDescription description("joint1", info);
+  state_interfaces_[description.get_name()] = std::make_shared<StateInterface>(description);
+  add_interface("actuator1", HW_IF_VELOCITY, false);
+
+  TransmissionStage stage;
+  stage.set_in_place_binding(true);
+  ASSERT_TRUE(add_transmissions(
+    stage, {make_transmission(
+              "simple", "transmission_interface/SimpleTransmission", {"joint1"}, {"actuator1"},
+              10.0)}));
+  EXPECT_EQ(5u, stage.num_bound_interfaces());
+  EXPECT_TRUE(state_interfaces_.at("joint1/position")->is_value_storage_bound());
+  EXPECT_FALSE(state_interfaces_.at("joint1/position")->is_value_change_tracked());
+  EXPECT_FALSE(state_interfaces_.at("joint1/velocity")->is_value_storage_bound());
+
+  ASSERT_TRUE(state_interfaces_.at("actuator1/position")->set_value(5.0));
+  ASSERT_TRUE(state_interfaces_.at("actuator1/velocity")->set_value(-10.0));
+  stage.actuator_to_joint();
+  EXPECT_DOUBLE_EQ(0.5, get_state("joint1/position"));
+  EXPECT_DOUBLE_EQ(-1.0, get_state("joint1/velocity"));
+
+  ASSERT_TRUE(command_interfaces_.at("joint1/position")->set_value(2.0));
+  stage.joint_to_actuator();
+  EXPECT_DOUBLE_EQ(20.0, get_command("actuator1/position"));
+
+  stage.clear();
+  EXPECT_EQ(0u, stage.num_bound_interfaces());
+}
+
+TEST(TransmissionStagePluginTest, load_transmission_stage_plugin)
+{
+  pluginlib::ClassLoader<hardware_interface::TransmissionStageInterface> loader(
+    "hardware_interface", "hardware_interface::TransmissionStageInterface");
+  std::shared_ptr<hardware_interface::TransmissionStageInterface> stage;
+  ASSERT_NO_THROW(stage = loader.createSharedInstance("transmission_interface/TransmissionStage"));
+  ASSERT_NE(nullptr, stage);
+  EXPECT_TRUE(stage->add_transmissions(
+    "component", {}, [](const std::string &) { return StateInterface::SharedPtr(); },
+    [](const std::string &) { return CommandInterface::SharedPtr(); }));
+}